@@ -73,3 +73,15 @@ void BM_gather(benchmark::State& state)
 
 GBM_BENCHMARK_DEFINE(double_coalesce_x, double, true);
 GBM_BENCHMARK_DEFINE(double_coalesce_o, double, false);
+
+#define GBM_WIDE_BENCHMARK_DEFINE(name, type, coalesce)        \
+  BENCHMARK_DEFINE_F(Gather, name)(::benchmark::State & state) \
+  {                                                            \
+    BM_gather<type, coalesce>(state);                          \
+  }                                                            \
+  BENCHMARK_REGISTER_F(Gather, name)                           \
+    ->ArgsProduct({{1 << 16, 1 << 20}, {64, 256}})             \
+    ->UseManualTime();
+
+GBM_WIDE_BENCHMARK_DEFINE(double_wide_coalesce_o, double, false);
+GBM_WIDE_BENCHMARK_DEFINE(int32_wide_coalesce_o, int32_t, false);
@@ -23,6 +23,7 @@
 
 #include <nvbench/nvbench.cuh>
 
+#include <limits>
 #include <optional>
 
 static void bench_hash(nvbench::state& state)
@@ -102,9 +103,57 @@ static void bench_hash(nvbench::state& state)
   }
 }
 
+static void bench_hash_row_width(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width = static_cast<cudf::size_type>(state.get_int64("row_width"));
+  auto const hash_name = state.get_string("hash_name");
+  if (static_cast<std::size_t>(num_rows) * static_cast<std::size_t>(row_width) >=
+      static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max())) {
+    state.skip("Skip benchmarks greater than size_type limit");
+  }
+
+  // row lengths vary between 0 and twice the row_width
+  data_profile const profile = data_profile_builder().no_validity().distribution(
+    cudf::type_id::STRING, distribution_id::UNIFORM, 0, 2 * row_width);
+  auto const data = create_random_table({cudf::type_id::STRING}, row_count{num_rows}, profile);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+
+  cudf::strings_column_view input(data->get_column(0).view());
+  state.add_global_memory_reads<nvbench::int8_t>(input.chars_size(stream));
+
+  using hash_fn = std::unique_ptr<cudf::column> (*)(
+    cudf::table_view const&, rmm::cuda_stream_view, rmm::device_async_resource_ref);
+  hash_fn fn = nullptr;
+  if (hash_name == "md5") {
+    fn = cudf::hashing::md5;
+  } else if (hash_name == "sha1") {
+    fn = cudf::hashing::sha1;
+  } else if (hash_name == "sha256") {
+    fn = cudf::hashing::sha256;
+  } else if (hash_name == "sha512") {
+    fn = cudf::hashing::sha512;
+  } else {
+    state.skip(hash_name + ": unknown hash name");
+    return;
+  }
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = fn(data->view(), stream, rmm::mr::get_current_device_resource());
+  });
+}
+
 NVBENCH_BENCH(bench_hash)
   .set_name("hashing")
   .add_int64_axis("num_rows", {65536, 16777216})
   .add_float64_axis("nulls", {0.0, 0.1})
   .add_string_axis("hash_name",
                    {"murmurhash3_x86_32", "md5", "sha1", "sha224", "sha256", "sha384", "sha512"});
+
+NVBENCH_BENCH(bench_hash_row_width)
+  .set_name("hashing_row_width")
+  .add_int64_axis("num_rows", {65536, 1048576})
+  .add_int64_axis("row_width", {16, 128, 1024, 4096})
+  .add_string_axis("hash_name", {"md5", "sha1", "sha256", "sha512"});
@@ -251,6 +251,67 @@ void BM_parquet_multithreaded_read_chunked_list(nvbench::state& state)
   nvtxRangePop();
 }
 
+// Every thread repeatedly reads the same small file, so that the runtime is dominated by the
+// host-side work of each read; the throughput only scales with the number of threads if the reads
+// do not serialize on global locks or on the default stream
+void BM_parquet_multithreaded_read_scaling(nvbench::state& state)
+{
+  size_t const read_size         = state.get_int64("read_size");
+  auto const num_threads         = state.get_int64("num_threads");
+  auto const reads_per_thread    = state.get_int64("reads_per_thread");
+  cudf::size_type const num_cols = state.get_int64("num_cols");
+  auto const num_reads           = num_threads * reads_per_thread;
+
+  auto streams = cudf::detail::fork_streams(cudf::get_default_stream(), num_threads);
+  cudf::detail::thread_pool threads(num_threads);
+
+  cuio_source_sink_pair source_sink{cudf::io::io_type::HOST_BUFFER};
+  {
+    auto const tbl = create_random_table(
+      cycle_dtypes({cudf::type_id::INT32, cudf::type_id::DECIMAL64, cudf::type_id::STRING},
+                   num_cols),
+      table_size_bytes{read_size},
+      data_profile_builder().cardinality(1000).avg_run_length(8));
+    cudf::io::parquet_writer_options write_opts =
+      cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), tbl->view())
+        .compression(cudf::io::compression_type::SNAPPY);
+    cudf::io::write_parquet(write_opts);
+  }
+  auto const source_info = source_sink.make_source_info();
+
+  auto mem_stats_logger = cudf::memory_stats_logger();
+
+  auto const label = "scaling, " + std::to_string(num_threads) + " threads";
+  nvtxRangePushA(("(read) " + label).c_str());
+  state.exec(nvbench::exec_tag::sync | nvbench::exec_tag::timer,
+             [&](nvbench::launch& launch, auto& timer) {
+               auto read_func = [&](int index) {
+                 auto const stream = streams[index % num_threads];
+                 cudf::io::parquet_reader_options read_opts =
+                   cudf::io::parquet_reader_options::builder(source_info);
+                 cudf::io::read_parquet(read_opts, stream, rmm::mr::get_current_device_resource());
+               };
+
+               threads.paused = true;
+               for (int64_t i = 0; i < num_reads; ++i) {
+                 threads.submit(read_func, i);
+               }
+               timer.start();
+               threads.paused = false;
+               threads.wait_for_tasks();
+               cudf::detail::join_streams(streams, cudf::get_default_stream());
+               timer.stop();
+             });
+  nvtxRangePop();
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(read_size * num_reads) / time, "bytes_per_second");
+  state.add_element_count(static_cast<double>(num_reads) / time, "reads_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(source_sink.size(), "encoded_file_size", "encoded_file_size");
+}
+
 // mixed data types: fixed width and strings
 NVBENCH_BENCH(BM_parquet_multithreaded_read_mixed)
   .set_name("parquet_multithreaded_read_decode_mixed")
@@ -332,3 +393,11 @@ NVBENCH_BENCH(BM_parquet_multithreaded_read_chunked_list)
   .add_int64_axis("run_length", {8})
   .add_int64_axis("input_limit", {640 * 1024 * 1024})
   .add_int64_axis("output_limit", {640 * 1024 * 1024});
+
+NVBENCH_BENCH(BM_parquet_multithreaded_read_scaling)
+  .set_name("parquet_multithreaded_read_scaling")
+  .set_min_samples(4)
+  .add_int64_axis("read_size", {1024 * 1024, 16 * 1024 * 1024})
+  .add_int64_axis("num_threads", {1, 2, 4, 8, 16})
+  .add_int64_axis("reads_per_thread", {16})
+  .add_int64_axis("num_cols", {4});
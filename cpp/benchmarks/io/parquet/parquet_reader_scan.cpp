@@ -0,0 +1,389 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/io/cuio_common.hpp>
+#include <benchmarks/io/nvbench_helpers.hpp>
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <memory>
+#include <string>
+#include <vector>
+
+// Scans of file layouts seen in production: very wide tables read through a narrow projection,
+// deeply nested schemas, datasets split into many small files, predicate pushdown with and without
+// late materialization, and chunked reads of large files. Every benchmark reports the read
+// throughput and the peak memory usage.
+
+constexpr size_t data_size = 512 << 20;
+
+namespace {
+
+std::vector<cudf::type_id> mixed_dtypes()
+{
+  return get_type_or_group({static_cast<int32_t>(data_type::INTEGRAL),
+                            static_cast<int32_t>(data_type::FLOAT),
+                            static_cast<int32_t>(data_type::DECIMAL),
+                            static_cast<int32_t>(data_type::TIMESTAMP),
+                            static_cast<int32_t>(data_type::STRING)});
+}
+
+/**
+ * @brief Write `view` to `source_sink` with the default page and row group sizes and statistics,
+ * unless given.
+ */
+void write_parquet(cudf::table_view const& view,
+                   cuio_source_sink_pair& source_sink,
+                   cudf::size_type row_group_size_rows = cudf::io::default_row_group_size_rows,
+                   cudf::io::statistics_freq stats_level = cudf::io::STATISTICS_ROWGROUP)
+{
+  cudf::io::parquet_writer_options write_opts =
+    cudf::io::parquet_writer_options::builder(source_sink.make_sink_info(), view)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .row_group_size_rows(row_group_size_rows)
+      .stats_level(stats_level);
+  cudf::io::write_parquet(write_opts);
+}
+
+/**
+ * @brief Time `read`, which returns the number of rows it read, and report the scan metrics.
+ *
+ * @param state The benchmark state
+ * @param read Callable that reads the input
+ * @param expected_num_rows Number of rows `read` is expected to return
+ * @param bytes_scanned Size of the decoded data, used to compute the throughput
+ * @param encoded_size Total size of the input files
+ */
+template <typename ReadFn>
+void parquet_scan_common(nvbench::state& state,
+                         ReadFn read,
+                         cudf::size_type expected_num_rows,
+                         size_t bytes_scanned,
+                         size_t encoded_size)
+{
+  auto mem_stats_logger = cudf::memory_stats_logger();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(cudf::get_default_stream().value()));
+  state.exec(
+    nvbench::exec_tag::sync | nvbench::exec_tag::timer, [&](nvbench::launch& launch, auto& timer) {
+      try_drop_l3_cache();
+
+      timer.start();
+      auto const num_rows_read = read();
+      timer.stop();
+
+      CUDF_EXPECTS(num_rows_read == expected_num_rows, "Unexpected number of rows");
+    });
+
+  auto const time = state.get_summary("nv/cold/time/gpu/mean").get_float64("value");
+  state.add_element_count(static_cast<double>(bytes_scanned) / time, "bytes_per_second");
+  state.add_buffer_size(
+    mem_stats_logger.peak_memory_usage(), "peak_memory_usage", "peak_memory_usage");
+  state.add_buffer_size(encoded_size, "encoded_file_size", "encoded_file_size");
+}
+
+}  // namespace
+
+void BM_parquet_scan_wide_table(nvbench::state& state)
+{
+  auto const num_cols      = static_cast<cudf::size_type>(state.get_int64("num_cols"));
+  auto const num_projected = static_cast<cudf::size_type>(state.get_int64("num_projected_cols"));
+  auto const source_type   = retrieve_io_type_enum(state.get_string("io_type"));
+  cuio_source_sink_pair source_sink(source_type);
+
+  auto const num_rows_written = [&]() {
+    auto const tbl = create_random_table(cycle_dtypes(mixed_dtypes(), num_cols),
+                                         table_size_bytes{data_size},
+                                         data_profile_builder().cardinality(0));
+    write_parquet(tbl->view(), source_sink);
+    return tbl->num_rows();
+  }();
+
+  // project columns spread across the whole schema, the way a query picks a few fields
+  std::vector<std::string> col_names;
+  for (cudf::size_type i = 0; i < num_projected; ++i) {
+    col_names.push_back("_col" + std::to_string(i * (num_cols / num_projected)));
+  }
+  auto const read_opts = cudf::io::parquet_reader_options::builder(source_sink.make_source_info())
+                           .columns(col_names)
+                           .build();
+
+  parquet_scan_common(
+    state,
+    [&]() {
+      auto const result = cudf::io::read_parquet(read_opts);
+      CUDF_EXPECTS(result.tbl->num_columns() == num_projected, "Unexpected number of columns");
+      return result.tbl->num_rows();
+    },
+    num_rows_written,
+    data_size / num_cols * num_projected,
+    source_sink.size());
+}
+
+void BM_parquet_scan_nested(nvbench::state& state)
+{
+  auto const nesting     = state.get_string("nesting");
+  auto const depth       = static_cast<cudf::size_type>(state.get_int64("depth"));
+  auto const source_type = retrieve_io_type_enum(state.get_string("io_type"));
+  constexpr cudf::size_type num_cols = 16;
+  cuio_source_sink_pair source_sink(source_type);
+
+  auto const is_list = nesting == "LIST";
+  auto profile       = data_profile_builder().cardinality(0);
+  if (is_list) {
+    profile.list_depth(depth);
+  } else {
+    profile.struct_depth(depth);
+  }
+  auto const num_rows_written = [&]() {
+    auto const tbl = create_random_table(
+      cycle_dtypes({is_list ? cudf::type_id::LIST : cudf::type_id::STRUCT}, num_cols),
+      table_size_bytes{data_size},
+      profile);
+    write_parquet(tbl->view(), source_sink);
+    return tbl->num_rows();
+  }();
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(source_sink.make_source_info()).build();
+
+  parquet_scan_common(
+    state,
+    [&]() { return cudf::io::read_parquet(read_opts).tbl->num_rows(); },
+    num_rows_written,
+    data_size,
+    source_sink.size());
+}
+
+void BM_parquet_scan_many_files(nvbench::state& state)
+{
+  auto const num_files = static_cast<cudf::size_type>(state.get_int64("num_files"));
+  constexpr cudf::size_type num_cols = 16;
+
+  std::vector<cuio_source_sink_pair> source_sinks;
+  std::vector<cudf::host_span<std::byte const>> buffers;
+  cudf::size_type num_rows_written = 0;
+  size_t encoded_size              = 0;
+  for (cudf::size_type i = 0; i < num_files; ++i) {
+    source_sinks.emplace_back(io_type::HOST_BUFFER);
+    auto const tbl = create_random_table(cycle_dtypes(mixed_dtypes(), num_cols),
+                                         table_size_bytes{data_size / num_files},
+                                         data_profile_builder().cardinality(0),
+                                         i);
+    write_parquet(tbl->view(), source_sinks.back());
+    num_rows_written += tbl->num_rows();
+    encoded_size += source_sinks.back().size();
+  }
+  // the buffers are only stable once all files are written
+  for (auto& source_sink : source_sinks) {
+    buffers.push_back(source_sink.make_source_info().host_buffers().front());
+  }
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(
+      cudf::io::source_info(cudf::host_span<cudf::host_span<std::byte const>>(buffers)))
+      .build();
+
+  parquet_scan_common(
+    state,
+    [&]() { return cudf::io::read_parquet(read_opts).tbl->num_rows(); },
+    num_rows_written,
+    data_size,
+    encoded_size);
+}
+
+void BM_parquet_scan_filter(nvbench::state& state)
+{
+  auto const selectivity = static_cast<double>(state.get_int64("selectivity_percent")) / 100;
+  auto const source_type = retrieve_io_type_enum(state.get_string("io_type"));
+  constexpr cudf::size_type num_cols            = 16;
+  constexpr cudf::size_type row_group_size_rows = 100'000;
+  cuio_source_sink_pair source_sink(source_type);
+
+  // the first column is sorted so the row group statistics let the reader skip whole row groups
+  auto const num_rows_written = [&]() {
+    auto tbl = create_random_table(cycle_dtypes(mixed_dtypes(), num_cols - 1),
+                                   table_size_bytes{data_size},
+                                   data_profile_builder().cardinality(0));
+    auto const num_rows = tbl->num_rows();
+    auto columns        = tbl->release();
+    auto key = create_sequence_table({cudf::type_id::INT32}, row_count{num_rows})->release();
+    columns.insert(columns.begin(), std::move(key.front()));
+    write_parquet(cudf::table{std::move(columns)}.view(), source_sink, row_group_size_rows);
+    return num_rows;
+  }();
+
+  auto const num_rows_selected = static_cast<cudf::size_type>(num_rows_written * selectivity);
+  auto bound                   = cudf::numeric_scalar<int32_t>(num_rows_selected);
+  auto const key_ref           = cudf::ast::column_reference(0);
+  auto const bound_literal     = cudf::ast::literal(bound);
+  auto const filter =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, key_ref, bound_literal);
+
+  auto statistics      = std::make_shared<cudf::io::reader_statistics>();
+  auto const read_opts = cudf::io::parquet_reader_options::builder(source_sink.make_source_info())
+                           .filter(filter)
+                           .statistics(statistics)
+                           .build();
+
+  parquet_scan_common(
+    state,
+    [&]() { return cudf::io::read_parquet(read_opts).tbl->num_rows(); },
+    num_rows_selected,
+    data_size,
+    source_sink.size());
+
+  // the statistics accumulate over all iterations, so only their ratio is meaningful
+  if (statistics->num_row_groups_total > 0) {
+    state.add_element_count(
+      statistics->num_row_groups_pruned * 100 / statistics->num_row_groups_total,
+      "row_groups_pruned_percent");
+  }
+}
+
+void BM_parquet_scan_late_materialization(nvbench::state& state)
+{
+  auto const late_materialization = state.get_int64("late_materialization") != 0;
+  auto const selectivity = static_cast<double>(state.get_int64("selectivity_percent")) / 100;
+  auto const key_layout  = state.get_string("key_layout");
+  auto const source_type = retrieve_io_type_enum(state.get_string("io_type"));
+  constexpr cudf::size_type num_cols = 32;
+  cuio_source_sink_pair source_sink(source_type);
+
+  // The filter is on the first column, whose matching rows are either contiguous (CLUSTERED) or
+  // spread over all pages (RANDOM). No statistics are written, so the pages without matching rows
+  // are only skipped by late materialization.
+  auto const num_rows_written = [&]() {
+    auto tbl = create_random_table(cycle_dtypes(mixed_dtypes(), num_cols - 1),
+                                   table_size_bytes{data_size},
+                                   data_profile_builder().cardinality(0));
+    auto const num_rows = tbl->num_rows();
+    auto columns        = tbl->release();
+    auto key =
+      key_layout == "CLUSTERED"
+        ? create_sequence_table({cudf::type_id::INT32}, row_count{num_rows})->release()
+        : create_random_table(
+            {cudf::type_id::INT32},
+            row_count{num_rows},
+            data_profile_builder().cardinality(0).null_probability(std::nullopt).distribution(
+              cudf::type_id::INT32, distribution_id::UNIFORM, 0, num_rows - 1))
+            ->release();
+    columns.insert(columns.begin(), std::move(key.front()));
+    write_parquet(cudf::table{std::move(columns)}.view(),
+                  source_sink,
+                  cudf::io::default_row_group_size_rows,
+                  cudf::io::STATISTICS_NONE);
+    return num_rows;
+  }();
+
+  auto bound = cudf::numeric_scalar<int32_t>(static_cast<int32_t>(num_rows_written * selectivity));
+  auto const key_ref       = cudf::ast::column_reference(0);
+  auto const bound_literal = cudf::ast::literal(bound);
+  auto const filter = cudf::ast::operation(cudf::ast::ast_operator::LESS, key_ref, bound_literal);
+
+  auto const read_opts = cudf::io::parquet_reader_options::builder(source_sink.make_source_info())
+                           .filter(filter)
+                           .late_materialization(late_materialization)
+                           .build();
+  auto const num_rows_selected = cudf::io::read_parquet(read_opts).tbl->num_rows();
+
+  parquet_scan_common(
+    state,
+    [&]() { return cudf::io::read_parquet(read_opts).tbl->num_rows(); },
+    num_rows_selected,
+    data_size,
+    source_sink.size());
+}
+
+void BM_parquet_scan_chunked(nvbench::state& state)
+{
+  auto const chunk_read_limit = static_cast<size_t>(state.get_int64("chunk_read_limit"));
+  auto const pass_read_limit  = static_cast<size_t>(state.get_int64("pass_read_limit"));
+  auto const source_type      = retrieve_io_type_enum(state.get_string("io_type"));
+  constexpr cudf::size_type num_cols = 64;
+  cuio_source_sink_pair source_sink(source_type);
+
+  auto const num_rows_written = [&]() {
+    auto const tbl = create_random_table(cycle_dtypes(mixed_dtypes(), num_cols),
+                                         table_size_bytes{data_size},
+                                         data_profile_builder().cardinality(0));
+    write_parquet(tbl->view(), source_sink);
+    return tbl->num_rows();
+  }();
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(source_sink.make_source_info()).build();
+
+  parquet_scan_common(
+    state,
+    [&]() {
+      auto reader = cudf::io::chunked_parquet_reader(chunk_read_limit, pass_read_limit, read_opts);
+      cudf::size_type num_rows_read = 0;
+      do {
+        num_rows_read += reader.read_chunk().tbl->num_rows();
+      } while (reader.has_next());
+      return num_rows_read;
+    },
+    num_rows_written,
+    data_size,
+    source_sink.size());
+}
+
+NVBENCH_BENCH(BM_parquet_scan_wide_table)
+  .set_name("parquet_scan_wide_table")
+  .add_string_axis("io_type", {"HOST_BUFFER"})
+  .set_min_samples(4)
+  .add_int64_axis("num_cols", {1000, 2000})
+  .add_int64_axis("num_projected_cols", {1, 10, 100});
+
+NVBENCH_BENCH(BM_parquet_scan_nested)
+  .set_name("parquet_scan_nested")
+  .add_string_axis("io_type", {"DEVICE_BUFFER"})
+  .set_min_samples(4)
+  .add_string_axis("nesting", {"LIST", "STRUCT"})
+  .add_int64_axis("depth", {1, 3, 6});
+
+NVBENCH_BENCH(BM_parquet_scan_many_files)
+  .set_name("parquet_scan_many_files")
+  .set_min_samples(4)
+  .add_int64_axis("num_files", {16, 256, 1024});
+
+NVBENCH_BENCH(BM_parquet_scan_filter)
+  .set_name("parquet_scan_filter")
+  .add_string_axis("io_type", {"HOST_BUFFER"})
+  .set_min_samples(4)
+  .add_int64_axis("selectivity_percent", {1, 10, 50, 100});
+
+NVBENCH_BENCH(BM_parquet_scan_late_materialization)
+  .set_name("parquet_scan_late_materialization")
+  .add_string_axis("io_type", {"HOST_BUFFER"})
+  .set_min_samples(4)
+  .add_int64_axis("late_materialization", {0, 1})
+  .add_string_axis("key_layout", {"CLUSTERED", "RANDOM"})
+  .add_int64_axis("selectivity_percent", {1, 10, 50, 100});
+
+NVBENCH_BENCH(BM_parquet_scan_chunked)
+  .set_name("parquet_scan_chunked")
+  .add_string_axis("io_type", {"HOST_BUFFER"})
+  .set_min_samples(4)
+  .add_int64_axis("chunk_read_limit", {0, 32 << 20, 128 << 20, 512 << 20})
+  .add_int64_axis("pass_read_limit", {0, 256 << 20});
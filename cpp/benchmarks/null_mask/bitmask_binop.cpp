@@ -0,0 +1,73 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+#include <benchmarks/fixture/benchmark_fixture.hpp>
+#include <benchmarks/synchronization/synchronization.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/table/table.hpp>
+
+#include <vector>
+
+class BitmaskBinop : public cudf::benchmark {};
+
+template <bool batched>
+void BM_bitmask_and(benchmark::State& state)
+{
+  auto const num_rows    = static_cast<cudf::size_type>(state.range(0));
+  auto const num_columns = static_cast<cudf::size_type>(state.range(1));
+  auto const num_tables  = static_cast<cudf::size_type>(state.range(2));
+
+  auto const source = create_random_table(
+    cycle_dtypes({cudf::type_id::INT32}, num_columns),
+    row_count{num_rows * num_tables},
+    data_profile_builder().null_probability(0.1).distribution(
+      cudf::type_id::INT32, distribution_id::UNIFORM, 0, 100));
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type i = 1; i < num_tables; ++i) {
+    splits.push_back(i * num_rows);
+  }
+  auto const tables = cudf::split(source->view(), splits);
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);  // flush_l2_cache = true, stream = 0
+    if constexpr (batched) {
+      auto const results = cudf::bitmask_and(tables);
+    } else {
+      for (auto const& table : tables) {
+        auto const result = cudf::bitmask_and(table);
+      }
+    }
+  }
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) * num_rows * num_tables *
+                          num_columns / 8);
+}
+
+#define BITMASK_BINOP_BENCHMARK_DEFINE(name, batched)                \
+  BENCHMARK_DEFINE_F(BitmaskBinop, name)(::benchmark::State & state) \
+  {                                                                  \
+    BM_bitmask_and<batched>(state);                                  \
+  }                                                                  \
+  BENCHMARK_REGISTER_F(BitmaskBinop, name)                           \
+    ->ArgsProduct({{1 << 12, 1 << 20}, {2, 8}, {1, 64}})             \
+    ->UseManualTime()                                                \
+    ->Unit(benchmark::kMillisecond);
+
+BITMASK_BINOP_BENCHMARK_DEFINE(batched_bitmask_and, true);
+BITMASK_BINOP_BENCHMARK_DEFINE(per_table_bitmask_and, false);
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <cstdlib>
+#include <limits>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Forces strings results to use INT64 offsets while in scope
+ *
+ * Setting the large strings threshold to 1 byte makes every new strings column use
+ * INT64 offsets so the 64-bit paths can be compared with the INT32 paths without
+ * allocating more than 2GB of characters.
+ */
+struct offsets_width_setter {
+  explicit offsets_width_setter(bool use_int64) : enabled{use_int64}
+  {
+    if (enabled) {
+      setenv("LIBCUDF_LARGE_STRINGS_ENABLED", "1", 1);
+      setenv("LIBCUDF_LARGE_STRINGS_THRESHOLD", "1", 1);
+    }
+  }
+  ~offsets_width_setter()
+  {
+    if (enabled) {
+      unsetenv("LIBCUDF_LARGE_STRINGS_ENABLED");
+      unsetenv("LIBCUDF_LARGE_STRINGS_THRESHOLD");
+    }
+  }
+  bool const enabled;
+};
+
+std::unique_ptr<cudf::column> create_strings(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width = static_cast<cudf::size_type>(state.get_int64("row_width"));
+
+  data_profile const profile = data_profile_builder().distribution(
+    cudf::type_id::STRING, distribution_id::NORMAL, 0, row_width);
+  auto table = create_random_table({cudf::type_id::STRING}, row_count{num_rows}, profile);
+  return std::move(table->release().front());
+}
+
+}  // namespace
+
+static void bench_large_offsets_gather(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width = static_cast<cudf::size_type>(state.get_int64("row_width"));
+  if (static_cast<std::size_t>(num_rows) * static_cast<std::size_t>(row_width) >=
+      static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max())) {
+    state.skip("Skip benchmarks greater than size_type limit");
+  }
+
+  auto const offsets_setter = offsets_width_setter(state.get_int64("offsets_width") == 64);
+  auto const input          = create_strings(state);
+
+  data_profile const map_profile = data_profile_builder().no_validity().distribution(
+    cudf::type_id::INT32, distribution_id::UNIFORM, 0, num_rows - 1);
+  auto const map_table =
+    create_random_table({cudf::type_id::INT32}, row_count{num_rows}, map_profile);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  auto const chars_size = cudf::strings_column_view(input->view()).chars_size(stream);
+  state.add_global_memory_reads<nvbench::int8_t>(chars_size);
+  state.add_global_memory_writes<nvbench::int8_t>(chars_size);
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto result = cudf::gather(cudf::table_view({input->view()}), map_table->view().column(0));
+  });
+}
+
+static void bench_large_offsets_concatenate(nvbench::state& state)
+{
+  auto const num_rows  = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const row_width = static_cast<cudf::size_type>(state.get_int64("row_width"));
+  if (static_cast<std::size_t>(num_rows) * static_cast<std::size_t>(row_width) >=
+      static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max())) {
+    state.skip("Skip benchmarks greater than size_type limit");
+  }
+
+  auto const offsets_setter = offsets_width_setter(state.get_int64("offsets_width") == 64);
+  auto const input          = create_strings(state);
+
+  // concatenate the input split into a number of equal parts
+  auto const num_parts = static_cast<cudf::size_type>(state.get_int64("num_parts"));
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type part = 1; part < num_parts; ++part) {
+    splits.push_back(static_cast<cudf::size_type>((static_cast<int64_t>(num_rows) * part) /
+                                                  num_parts));
+  }
+  auto const parts = cudf::split(input->view(), splits);
+
+  auto stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  auto const chars_size = cudf::strings_column_view(input->view()).chars_size(stream);
+  state.add_global_memory_reads<nvbench::int8_t>(chars_size);
+  state.add_global_memory_writes<nvbench::int8_t>(chars_size);
+
+  state.exec(nvbench::exec_tag::sync,
+             [&](nvbench::launch& launch) { auto result = cudf::concatenate(parts); });
+}
+
+NVBENCH_BENCH(bench_large_offsets_gather)
+  .set_name("large_offsets_gather")
+  .add_int64_axis("offsets_width", {32, 64})
+  .add_int64_axis("row_width", {32, 128, 1024})
+  .add_int64_axis("num_rows", {262144, 2097152, 16777216});
+
+NVBENCH_BENCH(bench_large_offsets_concatenate)
+  .set_name("large_offsets_concatenate")
+  .add_int64_axis("offsets_width", {32, 64})
+  .add_int64_axis("row_width", {32, 128, 1024})
+  .add_int64_axis("num_rows", {262144, 2097152, 16777216})
+  .add_int64_axis("num_parts", {2, 64, 1024});
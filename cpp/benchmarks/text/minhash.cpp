@@ -31,6 +31,7 @@ static void bench_minhash(nvbench::state& state)
   auto const hash_width = static_cast<cudf::size_type>(state.get_int64("hash_width"));
   auto const seed_count = static_cast<cudf::size_type>(state.get_int64("seed_count"));
   auto const base64     = state.get_int64("hash_type") == 64;
+  auto const permuted   = state.get_int64("permuted") != 0;
 
   if (static_cast<std::size_t>(num_rows) * static_cast<std::size_t>(row_width) >=
       static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max())) {
@@ -57,8 +58,15 @@ static void bench_minhash(nvbench::state& state)
   state.add_global_memory_writes<nvbench::int32_t>(num_rows);  // output are hashes
 
   state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
-    auto result = base64 ? nvtext::minhash64(input, seeds.view(), hash_width)
-                         : nvtext::minhash(input, seeds.view(), hash_width);
+    // the permuted versions reuse the seeds as both permutation parameters
+    if (permuted) {
+      auto result =
+        base64 ? nvtext::minhash64_permuted(input, 0, seeds.view(), seeds.view(), hash_width)
+               : nvtext::minhash_permuted(input, 0, seeds.view(), seeds.view(), hash_width);
+    } else {
+      auto result = base64 ? nvtext::minhash64(input, seeds.view(), hash_width)
+                           : nvtext::minhash(input, seeds.view(), hash_width);
+    }
   });
 }
 
@@ -67,5 +75,6 @@ NVBENCH_BENCH(bench_minhash)
   .add_int64_axis("num_rows", {1024, 8192, 16364, 131072})
   .add_int64_axis("row_width", {128, 512, 2048})
   .add_int64_axis("hash_width", {5, 10})
-  .add_int64_axis("seed_count", {2, 26})
-  .add_int64_axis("hash_type", {32, 64});
+  .add_int64_axis("seed_count", {2, 26, 256})
+  .add_int64_axis("hash_type", {32, 64})
+  .add_int64_axis("permuted", {0, 1});
@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmarks/common/generate_input.hpp>
+
+#include <cudf/row_conversion.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <nvbench/nvbench.cuh>
+
+#include <vector>
+
+namespace {
+
+std::vector<cudf::type_id> make_types(cudf::size_type num_cols, bool include_strings)
+{
+  std::vector<cudf::type_id> const fixed_width{cudf::type_id::INT8,
+                                               cudf::type_id::INT32,
+                                               cudf::type_id::INT64,
+                                               cudf::type_id::FLOAT64,
+                                               cudf::type_id::BOOL8,
+                                               cudf::type_id::TIMESTAMP_MILLISECONDS,
+                                               cudf::type_id::INT16};
+  std::vector<cudf::type_id> types;
+  for (cudf::size_type i = 0; i < num_cols; ++i) {
+    types.push_back(include_strings && i % 4 == 3 ? cudf::type_id::STRING
+                                                  : fixed_width[i % fixed_width.size()]);
+  }
+  return types;
+}
+
+}  // namespace
+
+static void bench_convert_to_rows(nvbench::state& state)
+{
+  auto const num_rows        = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const num_cols        = static_cast<cudf::size_type>(state.get_int64("num_cols"));
+  auto const include_strings = state.get_int64("strings") != 0;
+
+  data_profile const profile =
+    data_profile_builder()
+      .distribution(cudf::type_id::STRING, distribution_id::NORMAL, 0, 32)
+      .null_probability(0.1);
+  auto const source_table =
+    create_random_table(make_types(num_cols, include_strings), row_count{num_rows}, profile);
+  auto const source_view = source_table->view();
+
+  auto const stream = cudf::get_default_stream();
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+
+  std::size_t rows_size = 0;
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    auto const result = cudf::convert_to_rows(source_view, stream);
+    rows_size         = 0;
+    for (auto const& batch : result) {
+      rows_size += cudf::lists_column_view(batch->view()).child().size();
+    }
+  });
+  state.add_global_memory_writes<nvbench::int8_t>(rows_size);
+}
+
+static void bench_convert_from_rows(nvbench::state& state)
+{
+  auto const num_rows        = static_cast<cudf::size_type>(state.get_int64("num_rows"));
+  auto const num_cols        = static_cast<cudf::size_type>(state.get_int64("num_cols"));
+  auto const include_strings = state.get_int64("strings") != 0;
+
+  data_profile const profile =
+    data_profile_builder()
+      .distribution(cudf::type_id::STRING, distribution_id::NORMAL, 0, 32)
+      .null_probability(0.1);
+  auto const types = make_types(num_cols, include_strings);
+  auto const source_table = create_random_table(types, row_count{num_rows}, profile);
+  auto const source_view  = source_table->view();
+
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : source_view) {
+    schema.push_back(col.type());
+  }
+
+  auto const stream = cudf::get_default_stream();
+  auto const rows   = cudf::convert_to_rows(source_view, stream);
+  if (rows.size() > 1) { state.skip("Skip benchmarks with more than one batch of rows"); }
+  auto const rows_view = cudf::lists_column_view(rows.front()->view());
+
+  state.set_cuda_stream(nvbench::make_cuda_stream_view(stream.value()));
+  state.add_global_memory_reads<nvbench::int8_t>(rows_view.child().size());
+
+  state.exec(nvbench::exec_tag::sync, [&](nvbench::launch& launch) {
+    [[maybe_unused]] auto result = cudf::convert_from_rows(rows_view, schema, stream);
+  });
+}
+
+NVBENCH_BENCH(bench_convert_to_rows)
+  .set_name("convert_to_rows")
+  .add_int64_axis("num_rows", {32768, 262144, 2097152})
+  .add_int64_axis("num_cols", {4, 16, 64, 256})
+  .add_int64_axis("strings", {0, 1});
+
+NVBENCH_BENCH(bench_convert_from_rows)
+  .set_name("convert_from_rows")
+  .add_int64_axis("num_rows", {32768, 262144, 2097152})
+  .add_int64_axis("num_cols", {4, 16, 64, 256})
+  .add_int64_axis("strings", {0, 1});
@@ -55,6 +55,38 @@ static void BM_transpose(benchmark::State& state)
                           (bytes_read + bytes_written + null_bytes));
 }
 
+static void BM_transpose_wide(benchmark::State& state)
+{
+  auto const num_cols           = static_cast<cudf::size_type>(state.range(0));
+  auto const num_rows           = static_cast<cudf::size_type>(state.range(1));
+  auto const nullable           = state.range(2) != 0;
+  constexpr auto column_type_id = cudf::type_id::FLOAT64;
+  auto column_generator =
+    thrust::make_transform_iterator(thrust::counting_iterator(0), [&](int i) {
+      return cudf::make_numeric_column(
+        cudf::data_type{column_type_id},
+        num_rows,
+        nullable ? cudf::mask_state::ALL_VALID : cudf::mask_state::UNALLOCATED);
+    });
+
+  auto input_table = cudf::table(std::vector(column_generator, column_generator + num_cols));
+  auto input       = input_table.view();
+
+  for (auto _ : state) {
+    cuda_event_timer raii(state, true);
+    auto output = cudf::transpose(input);
+  }
+
+  auto const bytes_read = static_cast<uint64_t>(num_cols) * num_rows *
+                          sizeof(cudf::id_to_type<column_type_id>);
+  auto const null_bytes =
+    nullable ? 2 * static_cast<uint64_t>(num_cols) * cudf::bitmask_allocation_size_bytes(num_rows)
+             : 0;
+
+  state.SetBytesProcessed(static_cast<int64_t>(state.iterations()) *
+                          (2 * bytes_read + null_bytes));
+}
+
 class Transpose : public cudf::benchmark {};
 
 #define TRANSPOSE_BM_BENCHMARK_DEFINE(name)                                                \
@@ -66,3 +98,12 @@ class Transpose : public cudf::benchmark {};
     ->Unit(benchmark::kMillisecond);
 
 TRANSPOSE_BM_BENCHMARK_DEFINE(transpose_simple);
+
+BENCHMARK_DEFINE_F(Transpose, transpose_wide)(::benchmark::State& state)
+{
+  BM_transpose_wide(state);
+}
+BENCHMARK_REGISTER_F(Transpose, transpose_wide)
+  ->ArgsProduct({{1000, 4000, 16000}, {1000, 4000, 16000}, {0, 1}})
+  ->UseManualTime()
+  ->Unit(benchmark::kMillisecond);
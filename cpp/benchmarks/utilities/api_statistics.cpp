@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/utilities/api_statistics.hpp>
+
+#include <benchmark/benchmark.h>
+
+// Measures the host overhead that CUDF_FUNC_RANGE adds to every public API call, with the API
+// statistics disabled (the default) and enabled on the calling thread.
+
+namespace {
+
+// Stand-ins for a public API with and without the annotation. They are kept out of line so that
+// the annotation is the only difference between the two.
+[[gnu::noinline]] int annotated_api(int value)
+{
+  CUDF_FUNC_RANGE();
+  benchmark::DoNotOptimize(value);
+  return value + 1;
+}
+
+[[gnu::noinline]] int plain_api(int value)
+{
+  benchmark::DoNotOptimize(value);
+  return value + 1;
+}
+
+}  // namespace
+
+static void BM_plain_api(benchmark::State& state)
+{
+  int value = 0;
+  for (auto _ : state) {
+    value = plain_api(value);
+  }
+  benchmark::DoNotOptimize(value);
+}
+
+static void BM_func_range(benchmark::State& state)
+{
+  auto const statistics_enabled = state.range(0) != 0;
+  if (statistics_enabled) { cudf::enable_api_statistics(); }
+
+  int value = 0;
+  for (auto _ : state) {
+    value = annotated_api(value);
+  }
+  benchmark::DoNotOptimize(value);
+
+  cudf::disable_api_statistics();
+  cudf::reset_api_statistics();
+}
+
+BENCHMARK(BM_plain_api);
+BENCHMARK(BM_func_range)->ArgName("statistics_enabled")->Arg(0)->Arg(1);
@@ -60,3 +60,4 @@ build_example basic
 build_example strings
 build_example nested_types
 build_example parquet_io
+build_example graph_capture
@@ -83,42 +83,45 @@ class aggregation {
    * @brief Possible aggregation operations
    */
   enum Kind {
-    SUM,             ///< sum reduction
-    PRODUCT,         ///< product reduction
-    MIN,             ///< min reduction
-    MAX,             ///< max reduction
-    COUNT_VALID,     ///< count number of valid elements
-    COUNT_ALL,       ///< count number of elements
-    ANY,             ///< any reduction
-    ALL,             ///< all reduction
-    SUM_OF_SQUARES,  ///< sum of squares reduction
-    MEAN,            ///< arithmetic mean reduction
-    M2,              ///< sum of squares of differences from the mean
-    VARIANCE,        ///< variance
-    STD,             ///< standard deviation
-    MEDIAN,          ///< median reduction
-    QUANTILE,        ///< compute specified quantile(s)
-    ARGMAX,          ///< Index of max element
-    ARGMIN,          ///< Index of min element
-    NUNIQUE,         ///< count number of unique elements
-    NTH_ELEMENT,     ///< get the nth element
-    ROW_NUMBER,      ///< get row-number of current index (relative to rolling window)
-    RANK,            ///< get rank of current index
-    COLLECT_LIST,    ///< collect values into a list
-    COLLECT_SET,     ///< collect values into a list without duplicate entries
-    LEAD,            ///< window function, accesses row at specified offset following current row
-    LAG,             ///< window function, accesses row at specified offset preceding current row
-    PTX,             ///< PTX  UDF based reduction
-    CUDA,            ///< CUDA UDF based reduction
-    MERGE_LISTS,     ///< merge multiple lists values into one list
-    MERGE_SETS,      ///< merge multiple lists values into one list then drop duplicate entries
-    MERGE_M2,        ///< merge partial values of M2 aggregation,
-    COVARIANCE,      ///< covariance between two sets of elements
-    CORRELATION,     ///< correlation between two sets of elements
-    TDIGEST,         ///< create a tdigest from a set of input values
-    MERGE_TDIGEST,   ///< create a tdigest by merging multiple tdigests together
-    HISTOGRAM,       ///< compute frequency of each element
-    MERGE_HISTOGRAM  ///< merge partial values of HISTOGRAM aggregation,
+    SUM,               ///< sum reduction
+    PRODUCT,           ///< product reduction
+    MIN,               ///< min reduction
+    MAX,               ///< max reduction
+    COUNT_VALID,       ///< count number of valid elements
+    COUNT_ALL,         ///< count number of elements
+    ANY,               ///< any reduction
+    ALL,               ///< all reduction
+    SUM_OF_SQUARES,    ///< sum of squares reduction
+    MEAN,              ///< arithmetic mean reduction
+    M2,                ///< sum of squares of differences from the mean
+    VARIANCE,          ///< variance
+    STD,               ///< standard deviation
+    MEDIAN,            ///< median reduction
+    QUANTILE,          ///< compute specified quantile(s)
+    ARGMAX,            ///< Index of max element
+    ARGMIN,            ///< Index of min element
+    NUNIQUE,           ///< count number of unique elements
+    NTH_ELEMENT,       ///< get the nth element
+    ROW_NUMBER,        ///< get row-number of current index (relative to rolling window)
+    RANK,              ///< get rank of current index
+    COLLECT_LIST,      ///< collect values into a list
+    COLLECT_SET,       ///< collect values into a list without duplicate entries
+    LEAD,              ///< window function, accesses row at specified offset following current row
+    LAG,               ///< window function, accesses row at specified offset preceding current row
+    PTX,               ///< PTX  UDF based reduction
+    CUDA,              ///< CUDA UDF based reduction
+    MERGE_LISTS,       ///< merge multiple lists values into one list
+    MERGE_SETS,        ///< merge multiple lists values into one list then drop duplicate entries
+    MERGE_M2,          ///< merge partial values of M2 aggregation,
+    COVARIANCE,        ///< covariance between two sets of elements
+    CORRELATION,       ///< correlation between two sets of elements
+    TDIGEST,           ///< create a tdigest from a set of input values
+    MERGE_TDIGEST,     ///< create a tdigest by merging multiple tdigests together
+    HISTOGRAM,         ///< compute frequency of each element
+    MERGE_HISTOGRAM,   ///< merge partial values of HISTOGRAM aggregation,
+    HYPERLOGLOG,       ///< create a HyperLogLog sketch of the distinct values of a set of values
+    MERGE_HYPERLOGLOG, ///< create a HyperLogLog sketch by merging multiple sketches together
+    TOP_K              ///< collect the first k values of a group in sorted order into a list
   };
 
   aggregation() = delete;
@@ -730,5 +733,61 @@ std::unique_ptr<Base> make_tdigest_aggregation(int max_centroids = 1000);
 template <typename Base>
 std::unique_ptr<Base> make_merge_tdigest_aggregation(int max_centroids = 1000);
 
+/**
+ * @brief Factory to create a TOP_K aggregation
+ *
+ * `TOP_K` returns a list column holding the first `k` valid values of each group, in the order
+ * given by `column_order`. Groups with fewer than `k` valid values hold all of them. Ties keep
+ * the order of the values in the input.
+ *
+ * @code{.pseudo}
+ * keys   = [1, 2, 1, 1, 2]
+ * values = [3, 8, 5, 4, <NA>]
+ * TOP_K(k=2, order::DESCENDING) = [[5, 4], [8]]
+ * @endcode
+ *
+ * @param k Maximum number of values of each group
+ * @param column_order Order of the values: DESCENDING returns the largest values
+ * @return A TOP_K aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order column_order = order::DESCENDING);
+
+/**
+ * @brief Factory to create a HYPERLOGLOG aggregation
+ *
+ * Produces a HyperLogLog (http://algo.inria.fr/flajolet/Publications/FlFuGaMe07.pdf) sketch of
+ * the distinct values of each group, from which `cudf::approx_distinct_count` estimates the
+ * number of distinct values. Null values are ignored. The input values must be fixed-width or
+ * strings.
+ *
+ * The sketch column produced is a `LIST<INT8>` column. Each output row is a single sketch made of
+ * `2^precision` registers. Sketches of the same precision can be merged with a
+ * `MERGE_HYPERLOGLOG` aggregation.
+ *
+ * @param precision Number of bits of the hash of a value used to select its register, in the
+ * range [4, 18]. The relative error of the estimates is about `1.04 / sqrt(2^precision)`: the
+ * default of 12 gives about 1.6% with sketches of 4KB.
+ *
+ * @return A HYPERLOGLOG aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_hyperloglog_aggregation(int precision = 12);
+
+/**
+ * @brief Factory to create a MERGE_HYPERLOGLOG aggregation
+ *
+ * Merges the sketches produced by previous `make_hyperloglog_aggregation` or
+ * `make_merge_hyperloglog_aggregation` aggregations into a new `LIST<INT8>` sketch column. The
+ * merged sketch of a group is the sketch of the union of the values of its input sketches.
+ *
+ * @param precision Precision of the input sketches, which is also the precision of the output
+ * sketches
+ *
+ * @return A MERGE_HYPERLOGLOG aggregation object
+ */
+template <typename Base>
+std::unique_ptr<Base> make_merge_hyperloglog_aggregation(int precision = 12);
+
 /** @} */  // end of group
 }  // namespace cudf
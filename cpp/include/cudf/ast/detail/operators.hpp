@@ -16,6 +16,8 @@
 #pragma once
 
 #include <cudf/ast/expressions.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/string_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
@@ -221,6 +223,18 @@ CUDF_HOST_DEVICE inline constexpr void ast_operator_dispatcher(ast_operator op,
     case ast_operator::CAST_TO_FLOAT64:
       f.template operator()<ast_operator::CAST_TO_FLOAT64>(std::forward<Ts>(args)...);
       break;
+    case ast_operator::STARTS_WITH:
+      f.template operator()<ast_operator::STARTS_WITH>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::CONTAINS:
+      f.template operator()<ast_operator::CONTAINS>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::LIKE:
+      f.template operator()<ast_operator::LIKE>(std::forward<Ts>(args)...);
+      break;
+    case ast_operator::LENGTH:
+      f.template operator()<ast_operator::LENGTH>(std::forward<Ts>(args)...);
+      break;
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Invalid operator.");
@@ -833,6 +847,95 @@ struct operator_functor<ast_operator::CAST_TO_UINT64, false> : cast<uint64_t> {}
 template <>
 struct operator_functor<ast_operator::CAST_TO_FLOAT64, false> : cast<double> {};
 
+// The string operators are only defined for string operands
+template <typename LHS, typename RHS>
+constexpr bool are_strings =
+  std::is_same_v<LHS, cudf::string_view> && std::is_same_v<RHS, cudf::string_view>;
+
+template <>
+struct operator_functor<ast_operator::STARTS_WITH, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings<LHS, RHS>>* = nullptr>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs.size_bytes() >= rhs.size_bytes() && LHS(lhs.data(), rhs.size_bytes()) == rhs;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::CONTAINS, false> {
+  static constexpr auto arity{2};
+
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings<LHS, RHS>>* = nullptr>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    return lhs.find(rhs) != LHS::npos;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::LIKE, false> {
+  static constexpr auto arity{2};
+
+  /**
+   * @brief Matches the lhs string against the rhs pattern without recursion
+   *
+   * On a mismatch the match resumes after the most recent `%` consuming one more
+   * character of the string. This is the same pattern syntax as `cudf::strings::like`
+   * without an escape character.
+   */
+  template <typename LHS, typename RHS, std::enable_if_t<are_strings<LHS, RHS>>* = nullptr>
+  __device__ inline auto operator()(LHS lhs, RHS rhs) -> bool
+  {
+    auto str               = lhs.data();
+    auto const str_end     = str + lhs.size_bytes();
+    auto pattern           = rhs.data();
+    auto const pattern_end = pattern + rhs.size_bytes();
+    char const* wildcard   = nullptr;  // pattern position after the last `%`
+    char const* resume     = nullptr;  // string position matched to that `%`
+
+    auto const char_bytes = [](char const* ptr) {
+      return cudf::strings::detail::bytes_in_utf8_byte(static_cast<uint8_t>(*ptr));
+    };
+
+    while (str < str_end) {
+      if (pattern < pattern_end && *pattern == '%') {
+        wildcard = ++pattern;
+        resume   = str;
+      } else if (pattern < pattern_end && *pattern == '_') {
+        str += char_bytes(str);
+        ++pattern;
+      } else if (pattern < pattern_end && *pattern == *str) {
+        ++str;
+        ++pattern;
+      } else if (wildcard != nullptr) {
+        resume += char_bytes(resume);
+        str     = resume;
+        pattern = wildcard;
+      } else {
+        return false;
+      }
+    }
+    while (pattern < pattern_end && *pattern == '%') {
+      ++pattern;
+    }
+    return pattern == pattern_end;
+  }
+};
+
+template <>
+struct operator_functor<ast_operator::LENGTH, false> {
+  static constexpr auto arity{1};
+
+  template <typename InputT,
+            std::enable_if_t<std::is_same_v<InputT, cudf::string_view>>* = nullptr>
+  __device__ inline auto operator()(InputT input) -> size_type
+  {
+    return input.length();
+  }
+};
+
 /*
  * The default specialization of nullable operators is to fall back to the non-nullable
  * implementation
@@ -0,0 +1,206 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace ast {
+/**
+ * @addtogroup expressions
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Builds an expression from chained column operations and evaluates it in one pass
+ *
+ * Applying `cudf::binary_operation` and `cudf::unary_operation` one at a time materializes a
+ * column for every intermediate result. The builder instead records the operations as an
+ * expression tree which `evaluate` computes in a single kernel with `cudf::compute_column_jit`,
+ * so only the result column is allocated.
+ *
+ * Operands of a binary operation with different numeric types are cast to a common type:
+ * `FLOAT64` if either is floating-point, `UINT64` if both are unsigned and `INT64` otherwise.
+ *
+ * The builder owns all the expressions and literal values. A `node` refers to the builder
+ * which created it and must not be used after the builder is destroyed.
+ *
+ * @code{.pseudo}
+ * expression_builder builder;
+ * auto a = builder.column(a_view);
+ * auto b = builder.column(b_view);
+ * auto c = builder.column(c_view);
+ * auto d = builder.column(d_view);
+ * auto e = builder.binary(binary_operator::ADD, builder.binary(binary_operator::MUL, a, b), c);
+ * auto result = builder.evaluate(builder.binary(binary_operator::DIV, e, d));
+ * @endcode
+ */
+class expression_builder {
+ public:
+  /**
+   * @brief Handle to an expression created by the builder
+   */
+  class node {
+   public:
+    /**
+     * @brief Returns the expression of this node
+     *
+     * @return The expression
+     */
+    [[nodiscard]] expression const& get_expression() const { return *_expr; }
+
+    /**
+     * @brief Returns the type the expression evaluates to
+     *
+     * @return The output type of the expression
+     */
+    [[nodiscard]] data_type type() const { return _type; }
+
+   private:
+    friend class expression_builder;
+    node(expression const& expr, data_type type) : _expr{&expr}, _type{type} {}
+
+    expression const* _expr;
+    data_type _type;
+  };
+
+  expression_builder() = default;
+  expression_builder(expression_builder const&)            = delete;
+  expression_builder& operator=(expression_builder const&) = delete;
+
+  /**
+   * @brief Adds a column operand
+   *
+   * @throws cudf::logic_error if the column size differs from the previously added columns
+   *
+   * @param col Column referenced by the expression
+   * @return Node referencing the column
+   */
+  node column(column_view const& col);
+
+  /**
+   * @brief Adds a literal operand
+   *
+   * @tparam T Numeric type of the value
+   * @param value Value of the literal
+   * @param stream CUDA stream used to copy the value to device memory
+   * @return Node of the literal
+   */
+  template <typename T>
+  node literal(T value, rmm::cuda_stream_view stream = cudf::get_default_stream())
+  {
+    auto& value_scalar =
+      _scalars.emplace_back(std::make_unique<numeric_scalar<T>>(value, true, stream));
+    auto& expr = _literals.emplace_back(static_cast<numeric_scalar<T>&>(*value_scalar));
+    return node{expr, data_type{type_to_id<T>()}};
+  }
+
+  /**
+   * @brief Adds a unary operation
+   *
+   * @throws cudf::logic_error if the operator does not take one operand
+   *
+   * @param op Operator
+   * @param input Operand
+   * @return Node of the operation
+   */
+  node unary(ast_operator op, node input);
+
+  /**
+   * @copydoc unary(ast_operator, node)
+   */
+  node unary(unary_operator op, node input);
+
+  /**
+   * @brief Adds a binary operation, casting the operands to a common type if needed
+   *
+   * @throws cudf::logic_error if the operator does not take two operands
+   *
+   * @param op Operator
+   * @param lhs Left operand
+   * @param rhs Right operand
+   * @return Node of the operation
+   */
+  node binary(ast_operator op, node lhs, node rhs);
+
+  /**
+   * @copydoc binary(ast_operator, node, node)
+   *
+   * @throws cudf::logic_error if the operator has no expression equivalent, such as `FLOOR_DIV`
+   * whose integer results differ from the AST operator
+   */
+  node binary(binary_operator op, node lhs, node rhs);
+
+  /**
+   * @brief Adds a cast of the operand
+   *
+   * @throws cudf::logic_error if `type` is not `INT64`, `UINT64` or `FLOAT64`
+   *
+   * @param input Operand
+   * @param type Type to cast to
+   * @return Node of the cast, or `input` if it already has the type
+   */
+  node cast(node input, data_type type);
+
+  /**
+   * @brief Returns the columns referenced by the expressions in the order they were added
+   *
+   * @return View of the referenced columns
+   */
+  [[nodiscard]] table_view table() const { return table_view{_columns}; }
+
+  /**
+   * @brief Computes the result of an expression in a single pass over the columns
+   *
+   * @param result Node of the expression to compute
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return The computed column
+   */
+  [[nodiscard]] std::unique_ptr<cudf::column> evaluate(
+    node result,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::vector<column_view> _columns;
+  std::list<std::unique_ptr<cudf::scalar>> _scalars;
+  std::list<ast::literal> _literals;
+  std::list<column_reference> _column_refs;
+  std::list<operation> _operations;
+};
+
+/** @} */  // end of group
+}  // namespace ast
+}  // namespace cudf
@@ -152,7 +152,13 @@ enum class ast_operator : int32_t {
   NOT,             ///< Logical Not (!)
   CAST_TO_INT64,   ///< Cast value to int64_t
   CAST_TO_UINT64,  ///< Cast value to uint64_t
-  CAST_TO_FLOAT64  ///< Cast value to double
+  CAST_TO_FLOAT64,  ///< Cast value to double
+  // String operators
+  STARTS_WITH,  ///< Check if the lhs string begins with the rhs string
+  CONTAINS,     ///< Check if the lhs string contains the rhs string
+  LIKE,         ///< Check if the lhs string matches the rhs pattern where `%` matches any
+                ///< sequence of characters and `_` matches any single character
+  LENGTH        ///< Number of characters in a string
 };
 
 /**
@@ -315,6 +321,13 @@ class literal : public expression {
    */
   [[nodiscard]] generic_scalar_device_view get_value() const { return value; }
 
+  /**
+   * @brief Get the scalar.
+   *
+   * @return The scalar object
+   */
+  [[nodiscard]] cudf::scalar const& get_scalar() const { return scalar; }
+
   /**
    * @copydoc expression::accept
    */
@@ -123,6 +123,64 @@ std::vector<packed_table> contiguous_split(
   std::vector<size_type> const& splits,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Deep-copies a `table_view` into consecutive packed tables of at most `max_bytes` each.
+ *
+ * Produces the same splits as `cudf::split_by_size`, copied as by `contiguous_split`.
+ *
+ * @throws std::invalid_argument if `max_bytes` is 0
+ *
+ * @param input View of a table to split
+ * @param max_bytes Maximum size of each split in bytes, as estimated by `cudf::row_bit_count`
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return The packed consecutive splits of `input`
+ */
+std::vector<packed_table> contiguous_split_by_size(
+  cudf::table_view const& input,
+  std::size_t max_bytes,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The result of a cudf::contiguous_split_batched
+ *
+ * All partitions share a single device allocation and a single host metadata buffer. Partition
+ * `i` occupies bytes `[data_offsets[i], data_offsets[i+1])` of `gpu_data` and is described by
+ * bytes `[metadata_offsets[i], metadata_offsets[i+1])` of `metadata`, in the same format as a
+ * `packed_columns`.
+ */
+struct packed_partitions {
+  /// Host-side metadata of every partition, back to back
+  std::unique_ptr<std::vector<uint8_t>> metadata = std::make_unique<std::vector<uint8_t>>();
+  /// Offset of each partition's metadata in `metadata`, followed by its total size
+  std::vector<std::size_t> metadata_offsets;
+  /// Device-side data of every partition, back to back
+  std::unique_ptr<rmm::device_buffer> gpu_data = std::make_unique<rmm::device_buffer>();
+  /// Offset of each partition's data in `gpu_data`, followed by its total size
+  std::vector<std::size_t> data_offsets;
+};
+
+/**
+ * @brief Performs a deep-copy split of a `table_view` into a single contiguous allocation
+ * holding every split.
+ *
+ * Produces the same splits as `contiguous_split`, but allocates one device buffer for all of
+ * them and copies them with a single kernel launch, which scales to a very large number of
+ * splits. Use `cudf::unpack(packed_partitions const&, std::size_t)` to view a split.
+ *
+ * @throws std::out_of_range if `splits` has end index > size of `input`.
+ * @throws std::out_of_range When the value in `splits` is not in the range [0, input.size()).
+ * @throws std::invalid_argument When the values in the `splits` are 'strictly decreasing'.
+ *
+ * @param input View of a table to split
+ * @param splits A vector of indices where the view will be split
+ * @param mr An optional memory resource to use for all returned device allocations
+ * @return The packed splits of `input`, or no splits if `input` has no columns
+ */
+packed_partitions contiguous_split_batched(
+  cudf::table_view const& input,
+  std::vector<size_type> const& splits,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 namespace detail {
 struct contiguous_split_state;
 };
@@ -270,6 +328,80 @@ class chunked_pack {
   std::unique_ptr<detail::contiguous_split_state> state;
 };
 
+/**
+ * @brief Compression applied to the chunks of a table packed into host memory
+ */
+enum class packed_compression : int32_t {
+  NONE,  ///< Chunks are stored uncompressed
+  LZ4,   ///< Chunks are compressed with nvCOMP LZ4
+  ZSTD   ///< Chunks are compressed with nvCOMP ZSTD
+};
+
+/**
+ * @brief A table packed into host memory chunk by chunk by `chunked_pack_to_host`
+ *
+ * The chunks concatenated in order, after decompression, form the contiguous device buffer of
+ * `cudf::pack`. A compressed chunk is split into 64KB blocks that are compressed separately; a
+ * chunk whose stored size equals its uncompressed size is stored uncompressed.
+ */
+struct host_packed_table {
+  std::unique_ptr<std::vector<uint8_t>> metadata;  ///< Host-side metadata of the packed table
+  packed_compression compression;                 ///< Compression applied to the chunks
+  std::vector<std::size_t> chunk_sizes;           ///< Uncompressed size of each chunk
+  std::vector<std::vector<uint8_t>> chunks;       ///< Stored bytes of each chunk
+};
+
+/**
+ * @brief Packs a table into host memory with `chunked_pack`, overlapping the packing of each
+ * chunk with the copy of the previous chunk to host memory.
+ *
+ * Chunks are packed alternately into two device buffers of `user_buffer_size` bytes. The copy of
+ * a chunk to host memory runs on a separate stream while the next chunk is being packed into the
+ * other buffer. If `compression` is not `NONE`, each chunk is compressed on the device with
+ * nvCOMP before its copy, which reduces the bytes transferred at the cost of temporary device
+ * memory of about twice `user_buffer_size` per buffer.
+ *
+ * The following code snippet spills a table to host memory and restores it:
+ * @code{.pseudo}
+ * auto spilled = cudf::chunked_pack_to_host(tv, 128*1024*1024, cudf::packed_compression::LZ4);
+ * // ... free the device memory of `tv`
+ * auto packed   = cudf::chunked_unpack(spilled);
+ * auto restored = cudf::unpack(packed);
+ * @endcode
+ *
+ * @throws cudf::logic_error When user_buffer_size is less than 1MB
+ * @throws cudf::logic_error When the nvCOMP codec of `compression` is not available
+ *
+ * @param input source `table_view` to pack
+ * @param user_buffer_size size (in bytes) of each of the two device buffers chunks are packed
+ *                         into. Must be at least 1MB
+ * @param compression Compression applied to each chunk
+ * @param temp_mr Memory resource to be used for temporary and scratch allocations only
+ * @return The chunks of the packed table in host memory
+ */
+host_packed_table chunked_pack_to_host(
+  cudf::table_view const& input,
+  std::size_t user_buffer_size,
+  packed_compression compression         = packed_compression::NONE,
+  rmm::device_async_resource_ref temp_mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Copies a table packed by `chunked_pack_to_host` back into one contiguous device buffer.
+ *
+ * The copy of each chunk to the device runs on a separate stream while the previous chunk is
+ * being decompressed, alternating between two host staging buffers. Pass the result to
+ * `cudf::unpack` to obtain a `table_view` of the data.
+ *
+ * @throws cudf::logic_error When a chunk cannot be decompressed
+ *
+ * @param input The chunks of a packed table in host memory
+ * @param mr Device memory resource used to allocate the returned device buffer
+ * @return The packed columns of the table, as returned by `cudf::pack`
+ */
+packed_columns chunked_unpack(
+  host_packed_table const& input,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Deep-copy a `table_view` into a serialized contiguous memory format.
  *
@@ -337,5 +469,21 @@ table_view unpack(packed_columns const& input);
  */
 table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data);
 
+/**
+ * @brief Deserialize one partition of the result of `cudf::contiguous_split_batched`.
+ *
+ * It is the caller's responsibility to ensure that the `table_view` in the output does not outlive
+ * the data in the input.
+ *
+ * No new device memory is allocated in this function.
+ *
+ * @throws std::out_of_range if `partition` is not less than the number of partitions in `input`
+ *
+ * @param input The packed partitions to unpack from
+ * @param partition Index of the partition to unpack
+ * @return The unpacked `table_view`
+ */
+table_view unpack(packed_partitions const& input, std::size_t partition);
+
 /** @} */
 }  // namespace cudf
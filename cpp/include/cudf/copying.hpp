@@ -604,6 +604,37 @@ std::vector<table_view> split(table_view const& input,
                               std::initializer_list<size_type> splits,
                               rmm::cuda_stream_view stream = cudf::get_default_stream());
 
+/**
+ * @brief Splits a `table_view` into consecutive `table_view`s of at most `max_bytes` each.
+ *
+ * @ingroup copy_split
+ *
+ * The size of the rows is estimated with `cudf::row_bit_count`, and each returned view greedily
+ * holds as many rows as fit within `max_bytes`. A row larger than `max_bytes` is returned in a view
+ * of its own. This is the same as calling `cudf::split` with split points computed from the sizes
+ * of the rows, and can be used to bound the size of the batches written, sent or spilled.
+ *
+ * @note It is the caller's responsibility to ensure that the returned views
+ * do not outlive the viewed device memory.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input:     [{10, 12, 14, 16, 18, 20, 22}]  (INT32, no nulls: 4 bytes per row)
+ * max_bytes: 12
+ * output:    [{{10, 12, 14}, {16, 18, 20}, {22}}]
+ * @endcode
+ *
+ * @throws std::invalid_argument if `max_bytes` is 0
+ *
+ * @param input View of a table to split
+ * @param max_bytes Maximum size of each returned view in bytes
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Consecutive views of `input` of at most `max_bytes` each, unless a single row exceeds it
+ */
+std::vector<table_view> split_by_size(table_view const& input,
+                                      std::size_t max_bytes,
+                                      rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief   Returns a new column, where each element is selected from either @p lhs or
  *          @p rhs based on the value of the corresponding element in @p boolean_mask
@@ -854,6 +885,93 @@ std::unique_ptr<table> sample(
   rmm::cuda_stream_view stream        = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr   = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Samples each row of `input` independently with probability `fraction`
+ *
+ * Unlike `sample`, which shuffles the indices of all the rows, each row is kept or dropped based
+ * on a random number computed from `seed` and its index, and the kept rows are compacted in their
+ * original order. The number of sampled rows is therefore only `fraction * input.num_rows()` on
+ * average, and no memory proportional to the number of input rows is allocated.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input: {col1: {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}}
+ * fraction: 0.3
+ *
+ * output: {col1: {2, 7, 8}}
+ * @endcode
+ *
+ * @throws std::invalid_argument if `fraction` is not in `[0, 1]`
+ *
+ * @param input View of a table to sample
+ * @param fraction Probability of sampling each row
+ * @param seed Seed value to initiate random number generator
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return Table containing the sampled rows of `input`
+ */
+std::unique_ptr<table> sample_fraction(
+  table_view const& input,
+  double fraction,
+  int64_t seed                      = 0,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Samples `n` rows of `input` without replacement, in a form that can be merged with the
+ * samples of other batches
+ *
+ * Each row is assigned a uniform random key in `[0, 1)` and the `n` rows with the smallest keys
+ * are returned along with their keys. Since these are also the rows with the smallest keys of any
+ * union of batches containing them, a uniform sample of `n` rows of a dataset processed in batches
+ * is obtained by sampling each batch with a different `seed` and merging the samples with
+ * `merge_reservoir_samples`, so only `n` rows per batch need to be kept.
+ *
+ * If `n >= input.num_rows()`, all the rows are returned.
+ *
+ * @throws std::invalid_argument if `n` < 0
+ *
+ * @param input View of a table to sample
+ * @param n Non-negative number of rows to sample
+ * @param seed Seed value to initiate random number generator, which must differ between batches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The sampled rows of `input` and their FLOAT64 keys
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> reservoir_sample(
+  table_view const& input,
+  size_type n,
+  int64_t seed                      = 0,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Merges samples returned by `reservoir_sample` into a sample of `n` rows of the union of
+ * their batches
+ *
+ * The result can itself be merged with other samples.
+ *
+ * @throws std::invalid_argument if `n` < 0, if `samples` is empty or if `samples` and `keys` have
+ * different sizes
+ * @throws cudf::data_type_error if the keys are not FLOAT64 columns
+ *
+ * @param samples The sampled rows of each batch
+ * @param keys The keys of the sampled rows of each batch
+ * @param n Non-negative number of rows to sample
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @return The sampled rows of the batches and their FLOAT64 keys
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> merge_reservoir_samples(
+  host_span<table_view const> samples,
+  host_span<column_view const> keys,
+  size_type n,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Checks if a column or its descendants have non-empty null rows
  *
@@ -22,6 +22,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <vector>
 
 /**
  * @file datetime.hpp
@@ -36,6 +37,22 @@ namespace datetime {
  * @file
  */
 
+/**
+ * @brief Components of a datetime that can be extracted by `extract_datetime_components`
+ */
+enum class datetime_component : uint8_t {
+  YEAR,         ///< Year
+  MONTH,        ///< Month, 1 to 12
+  DAY,          ///< Day of the month, 1 to 31
+  WEEKDAY,      ///< ISO day of the week, 1 (Monday) to 7 (Sunday)
+  HOUR,         ///< Hour of the day, 0 to 23
+  MINUTE,       ///< Minute of the hour, 0 to 59
+  SECOND,       ///< Second of the minute, 0 to 59
+  MILLISECOND,  ///< Millisecond fraction of the second, 0 to 999
+  MICROSECOND,  ///< Microsecond fraction of the millisecond, 0 to 999
+  NANOSECOND    ///< Nanosecond fraction of the microsecond, 0 to 999
+};
+
 /**
  * @brief  Extracts year from any datetime type and returns an int16_t
  * cudf::column.
@@ -185,6 +202,32 @@ std::unique_ptr<cudf::column> extract_nanosecond_fraction(
   cudf::column_view const& column,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Extracts several datetime components from any datetime type in a single pass
+ *
+ * This is equivalent to calling `extract_year`, `extract_month`, and so on for each requested
+ * component, but the calendar conversion of each timestamp is computed only once.
+ *
+ * @code{.pseudo}
+ * column     = [2024-03-15 10:20:30, 1999-12-31 23:59:59]
+ * components = [YEAR, MONTH, DAY, HOUR]
+ * output     = {[2024, 1999], [3, 12], [15, 31], [10, 23]}
+ * @endcode
+ *
+ * @throw cudf::logic_error if input column datatype is not TIMESTAMP
+ * @throw std::invalid_argument if `components` contains a component more than once
+ *
+ * @param column cudf::column_view of the input datetime values
+ * @param components The components to extract
+ * @param mr Device memory resource used to allocate device memory of the returned table
+ *
+ * @returns A table with one int16_t column per entry of `components`, in the same order
+ */
+std::unique_ptr<cudf::table> extract_datetime_components(
+  cudf::column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup datetime_compute
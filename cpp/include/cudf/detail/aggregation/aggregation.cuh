@@ -275,6 +275,30 @@ struct update_target_element<
   }
 };
 
+template <typename Source, bool target_has_nulls, bool source_has_nulls>
+struct update_target_element<
+  Source,
+  aggregation::SUM,
+  target_has_nulls,
+  source_has_nulls,
+  std::enable_if_t<is_fixed_point<Source>() &&
+                   std::is_same_v<device_storage_type_t<Source>, __int128_t> &&
+                   !cudf::has_atomic_support<device_storage_type_t<Source>>()>> {
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             column_device_view source,
+                             size_type source_index) const noexcept
+  {
+    if (source_has_nulls and source.is_null(source_index)) { return; }
+
+    // 128-bit values are added as two 64-bit limbs
+    cudf::detail::atomic_add(&target.element<__int128_t>(target_index),
+                             source.element<__int128_t>(source_index));
+
+    if (target_has_nulls and target.is_null(target_index)) { target.set_valid(target_index); }
+  }
+};
+
 /**
  * @brief Function object to update a single element in a target column using
  * the dictionary key addressed by the specific index.
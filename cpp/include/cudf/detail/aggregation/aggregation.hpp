@@ -101,6 +101,12 @@ class simple_aggregations_collector {  // Declares the interface for the simple
                                                           class tdigest_aggregation const& agg);
   virtual std::vector<std::unique_ptr<aggregation>> visit(
     data_type col_type, class merge_tdigest_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class hyperloglog_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(
+    data_type col_type, class merge_hyperloglog_aggregation const& agg);
+  virtual std::vector<std::unique_ptr<aggregation>> visit(data_type col_type,
+                                                          class top_k_aggregation const& agg);
 };
 
 class aggregation_finalizer {  // Declares the interface for the finalizer
@@ -140,6 +146,9 @@ class aggregation_finalizer {  // Declares the interface for the finalizer
   virtual void visit(class correlation_aggregation const& agg);
   virtual void visit(class tdigest_aggregation const& agg);
   virtual void visit(class merge_tdigest_aggregation const& agg);
+  virtual void visit(class hyperloglog_aggregation const& agg);
+  virtual void visit(class merge_hyperloglog_aggregation const& agg);
+  virtual void visit(class top_k_aggregation const& agg);
 };
 
 /**
@@ -1142,6 +1151,122 @@ class merge_tdigest_aggregation final : public groupby_aggregation, public reduc
   void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
 };
 
+/**
+ * @brief Derived aggregation class for specifying HYPERLOGLOG aggregation
+ */
+class hyperloglog_aggregation final : public groupby_aggregation, public reduce_aggregation {
+ public:
+  explicit hyperloglog_aggregation(int precision_)
+    : aggregation{HYPERLOGLOG}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< number of hash bits selecting the register of a value
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<hyperloglog_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<hyperloglog_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying MERGE_HYPERLOGLOG aggregation
+ */
+class merge_hyperloglog_aggregation final : public groupby_aggregation,
+                                            public reduce_aggregation {
+ public:
+  explicit merge_hyperloglog_aggregation(int precision_)
+    : aggregation{MERGE_HYPERLOGLOG}, precision{precision_}
+  {
+  }
+
+  int const precision;  ///< number of hash bits selecting the register of a value
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<merge_hyperloglog_aggregation const&>(_other);
+    return precision == other.precision;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ std::hash<int>{}(precision);
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<merge_hyperloglog_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+};
+
+/**
+ * @brief Derived aggregation class for specifying TOP_K aggregation
+ */
+class top_k_aggregation final : public groupby_aggregation {
+ public:
+  top_k_aggregation(size_type k, order column_order)
+    : aggregation{TOP_K}, _k{k}, _column_order{column_order}
+  {
+  }
+
+  size_type _k;         ///< maximum number of values of each group
+  order _column_order;  ///< order of the values
+
+  [[nodiscard]] bool is_equal(aggregation const& _other) const override
+  {
+    if (!this->aggregation::is_equal(_other)) { return false; }
+    auto const& other = dynamic_cast<top_k_aggregation const&>(_other);
+    return _k == other._k and _column_order == other._column_order;
+  }
+
+  [[nodiscard]] size_t do_hash() const override
+  {
+    return this->aggregation::do_hash() ^ hash_impl();
+  }
+
+  [[nodiscard]] std::unique_ptr<aggregation> clone() const override
+  {
+    return std::make_unique<top_k_aggregation>(*this);
+  }
+  std::vector<std::unique_ptr<aggregation>> get_simple_aggregations(
+    data_type col_type, simple_aggregations_collector& collector) const override
+  {
+    return collector.visit(col_type, *this);
+  }
+  void finalize(aggregation_finalizer& finalizer) const override { finalizer.visit(*this); }
+
+ private:
+  size_t hash_impl() const
+  {
+    return std::hash<size_type>{}(_k) ^ std::hash<int>{}(static_cast<int>(_column_order));
+  }
+};
+
 /**
  * @brief Sentinel value used for `ARGMAX` aggregation.
  *
@@ -1341,6 +1466,12 @@ struct target_type_impl<Source, aggregation::COLLECT_LIST> {
   using type = list_view;
 };
 
+// Always use list for TOP_K
+template <typename Source>
+struct target_type_impl<Source, aggregation::TOP_K> {
+  using type = list_view;
+};
+
 // Always use list for COLLECT_SET
 template <typename Source>
 struct target_type_impl<Source, aggregation::COLLECT_SET> {
@@ -1413,6 +1544,23 @@ struct target_type_impl<Source,
   using type = struct_view;
 };
 
+// Always use list for HYPERLOGLOG, whose values must be hashable
+template <typename Source>
+struct target_type_impl<
+  Source,
+  aggregation::HYPERLOGLOG,
+  std::enable_if_t<is_fixed_width<Source>() || std::is_same_v<Source, cudf::string_view>>> {
+  using type = list_view;
+};
+
+// Always use list for MERGE_HYPERLOGLOG, whose values are the sketches to merge
+template <typename Source>
+struct target_type_impl<Source,
+                        aggregation::MERGE_HYPERLOGLOG,
+                        std::enable_if_t<std::is_same_v<Source, cudf::list_view>>> {
+  using type = list_view;
+};
+
 /**
  * @brief Helper alias to get the accumulator type for performing aggregation
  * `k` on elements of type `Source`
@@ -1529,6 +1677,12 @@ CUDF_HOST_DEVICE inline decltype(auto) aggregation_dispatcher(aggregation::Kind
       return f.template operator()<aggregation::TDIGEST>(std::forward<Ts>(args)...);
     case aggregation::MERGE_TDIGEST:
       return f.template operator()<aggregation::MERGE_TDIGEST>(std::forward<Ts>(args)...);
+    case aggregation::HYPERLOGLOG:
+      return f.template operator()<aggregation::HYPERLOGLOG>(std::forward<Ts>(args)...);
+    case aggregation::MERGE_HYPERLOGLOG:
+      return f.template operator()<aggregation::MERGE_HYPERLOGLOG>(std::forward<Ts>(args)...);
+    case aggregation::TOP_K:
+      return f.template operator()<aggregation::TOP_K>(std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
       CUDF_FAIL("Unsupported aggregation.");
@@ -76,5 +76,21 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          data_type output_type,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Compiles the kernel used by `binary_operation` with a PTX function for the given
+ * types, or loads it from the kernel cache
+ *
+ * @throws cudf::logic_error if a type is not supported by binary operations with PTX
+ *
+ * @param lhs_type Type of the left operand column
+ * @param rhs_type Type of the right operand column
+ * @param ptx String containing the PTX of a binary function
+ * @param output_type The desired data type of the output column
+ */
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 std::string const& ptx,
+                                 data_type output_type);
 }  // namespace detail
 }  // namespace cudf
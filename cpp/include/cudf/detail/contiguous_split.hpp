@@ -36,6 +36,26 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
                                            rmm::cuda_stream_view stream,
                                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::contiguous_split_by_size
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+std::vector<packed_table> contiguous_split_by_size(cudf::table_view const& input,
+                                                   std::size_t max_bytes,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::contiguous_split_batched
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ **/
+packed_partitions contiguous_split_batched(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::pack
  *
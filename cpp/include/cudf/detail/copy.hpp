@@ -122,6 +122,31 @@ std::vector<table_view> split(table_view const& input,
                               std::initializer_list<size_type> splits,
                               rmm::cuda_stream_view stream);
 
+/**
+ * @brief Computes the indices at which `input` must be split so that every split holds at most
+ * `max_bytes`, as estimated by `cudf::row_bit_count`.
+ *
+ * Each split greedily takes as many rows as fit within `max_bytes`. A row larger than
+ * `max_bytes` is a split on its own. The indices can be passed to `split` or `contiguous_split`.
+ *
+ * @throws std::invalid_argument if `max_bytes` is 0
+ *
+ * @param input Table to split
+ * @param max_bytes Maximum size of each split in bytes
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Indices where the table must be split, empty if it fits within `max_bytes`
+ */
+std::vector<size_type> split_points_by_size(table_view const& input,
+                                            std::size_t max_bytes,
+                                            rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::split_by_size
+ */
+std::vector<table_view> split_by_size(table_view const& input,
+                                      std::size_t max_bytes,
+                                      rmm::cuda_stream_view stream);
+
 /**
  * @copydoc cudf::shift(column_view const&,size_type,scalar const&,
  * rmm::device_async_resource_ref)
@@ -246,6 +271,35 @@ std::unique_ptr<table> sample(table_view const& input,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::sample_fraction
+ */
+std::unique_ptr<table> sample_fraction(table_view const& input,
+                                       double fraction,
+                                       int64_t seed,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::reservoir_sample
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> reservoir_sample(
+  table_view const& input,
+  size_type n,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::merge_reservoir_samples
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> merge_reservoir_samples(
+  host_span<table_view const> samples,
+  host_span<column_view const> keys,
+  size_type n,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::get_element
  *
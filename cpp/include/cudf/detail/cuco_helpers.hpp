@@ -20,6 +20,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/polymorphic_allocator.hpp>
+#include <rmm/resource_ref.hpp>
 
 namespace cudf::detail {
 
@@ -49,6 +50,14 @@ class cuco_allocator
    * @brief Constructs the allocator adaptor with the given `stream`
    */
   cuco_allocator(rmm::cuda_stream_view stream) : base_type{default_allocator{}, stream} {}
+
+  /**
+   * @brief Constructs the allocator adaptor with the given `mr` and `stream`
+   */
+  cuco_allocator(rmm::device_async_resource_ref mr, rmm::cuda_stream_view stream)
+    : base_type{default_allocator{mr}, stream}
+  {
+  }
 };
 
 }  // namespace cudf::detail
@@ -20,6 +20,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
@@ -33,11 +34,13 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/functional.h>
@@ -46,6 +49,7 @@
 #include <thrust/logical.h>
 
 #include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -619,6 +623,148 @@ void gather_bitmask(table_view const& source,
   }
 }
 
+/**
+ * @brief Smallest number of fixed-width columns gathered together by a single kernel.
+ *
+ * Tables with fewer fixed-width columns gather each column with its own thrust::gather.
+ */
+constexpr size_type batched_gather_min_columns = 4;
+
+/**
+ * @brief Largest number of columns gathered by one launch of `batched_gather_kernel`.
+ */
+constexpr size_type batched_gather_max_columns = 64;
+
+/**
+ * @brief A fixed-width column gathered by `batched_gather_kernel`.
+ */
+struct batched_gather_column {
+  void const* source;      ///< First element of the source column
+  void* target;            ///< First element of the gathered column
+  size_type element_size;  ///< Size in bytes of each element
+};
+
+/**
+ * @brief Copies the element of one column at `source_index` to `target_index`.
+ */
+template <typename T>
+__device__ void gather_element(batched_gather_column const& column,
+                               size_type source_index,
+                               size_type target_index)
+{
+  static_cast<T*>(column.target)[target_index] =
+    static_cast<T const*>(column.source)[source_index];
+}
+
+/**
+ * @brief Gathers the rows of several fixed-width columns.
+ *
+ * Each thread reads the gather map entry of a row once and copies that row of every column.
+ * Elements of 16 bytes are copied with 128-bit loads and stores.
+ *
+ * @param columns The columns to gather, at most `batched_gather_max_columns`
+ * @param gather_map_begin Beginning of the gather map
+ * @param num_rows Number of rows in the gather map
+ * @param source_size Number of rows in the source columns
+ * @param nullify_out_of_bounds Skip rows whose gather map entry is out of bounds
+ */
+template <typename MapIterator>
+CUDF_KERNEL void batched_gather_kernel(device_span<batched_gather_column const> columns,
+                                       MapIterator gather_map_begin,
+                                       size_type num_rows,
+                                       size_type source_size,
+                                       bool nullify_out_of_bounds)
+{
+  __shared__ batched_gather_column s_columns[batched_gather_max_columns];
+  for (auto i = static_cast<size_type>(threadIdx.x); i < static_cast<size_type>(columns.size());
+       i += blockDim.x) {
+    s_columns[i] = columns[i];
+  }
+  __syncthreads();
+
+  using map_type         = typename std::iterator_traits<MapIterator>::value_type;
+  auto const num_columns = static_cast<size_type>(columns.size());
+  auto const stride      = grid_1d::grid_stride();
+  for (auto row = grid_1d::global_thread_id(); row < num_rows; row += stride) {
+    auto const index = gather_map_begin[row];
+    if (nullify_out_of_bounds and not bounds_checker<map_type>{0, source_size}(index)) {
+      continue;
+    }
+    auto const source_index = static_cast<size_type>(index);
+    auto const target_index = static_cast<size_type>(row);
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const& column = s_columns[c];
+      switch (column.element_size) {
+        case 1: gather_element<int8_t>(column, source_index, target_index); break;
+        case 2: gather_element<int16_t>(column, source_index, target_index); break;
+        case 4: gather_element<int32_t>(column, source_index, target_index); break;
+        case 8: gather_element<int64_t>(column, source_index, target_index); break;
+        case 16: gather_element<__int128_t>(column, source_index, target_index); break;
+        default: break;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Gathers the data of several fixed-width columns of a table, reading the gather map once
+ * per `batched_gather_max_columns` columns rather than once per column.
+ *
+ * The null masks of the gathered columns are not set.
+ *
+ * @param source_table The table containing the columns to gather
+ * @param column_indices Indices of the fixed-width columns of `source_table` to gather
+ * @param gather_map_begin Beginning of the gather map
+ * @param gather_map_end End of the gather map
+ * @param nullify_out_of_bounds Leave rows whose gather map entry is out of bounds unwritten
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The gathered columns, in the order of `column_indices`
+ */
+template <typename MapIterator>
+std::vector<std::unique_ptr<column>> gather_fixed_width_columns(
+  table_view const& source_table,
+  host_span<size_type const> column_indices,
+  MapIterator gather_map_begin,
+  MapIterator gather_map_end,
+  bool nullify_out_of_bounds,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = cudf::distance(gather_map_begin, gather_map_end);
+  std::vector<std::unique_ptr<column>> results;
+  std::vector<batched_gather_column> columns;
+  for (auto const index : column_indices) {
+    auto const& source = source_table.column(index);
+    results.push_back(cudf::detail::allocate_like(
+      source, num_rows, cudf::mask_allocation_policy::NEVER, stream, mr));
+    auto const element_size = static_cast<size_type>(cudf::size_of(source.type()));
+    columns.push_back(
+      batched_gather_column{source.head<int8_t>() + source.offset() * element_size,
+                            results.back()->mutable_view().head(),
+                            element_size});
+  }
+  if (num_rows == 0) { return results; }
+
+  auto const d_columns =
+    make_device_uvector_async(columns, stream, rmm::mr::get_current_device_resource());
+  auto const d_columns_span = device_span<batched_gather_column const>(d_columns);
+  constexpr int block_size  = 256;
+  cudf::detail::grid_1d const config(num_rows, block_size);
+  for (std::size_t begin = 0; begin < d_columns_span.size(); begin += batched_gather_max_columns) {
+    auto const count =
+      std::min(d_columns_span.size() - begin, static_cast<std::size_t>(batched_gather_max_columns));
+    batched_gather_kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+      d_columns_span.subspan(begin, count),
+      gather_map_begin,
+      num_rows,
+      source_table.num_rows(),
+      nullify_out_of_bounds);
+  }
+  CUDF_CHECK_CUDA(stream.value());
+  return results;
+}
+
 /**
  * @brief Gathers the specified rows of a set of columns according to a gather map.
  *
@@ -655,21 +801,50 @@ std::unique_ptr<table> gather(table_view const& source_table,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr)
 {
-  std::vector<std::unique_ptr<column>> destination_columns;
+  std::vector<std::unique_ptr<column>> destination_columns(source_table.num_columns());
 
-  // TODO: Could be beneficial to use streams internally here
+  // Gather the fixed-width columns together so each gather map entry is read once per batch
+  std::vector<size_type> fixed_width_indices;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (is_fixed_width(source_table.column(i).type())) { fixed_width_indices.push_back(i); }
+  }
+  if (static_cast<size_type>(fixed_width_indices.size()) >= batched_gather_min_columns) {
+    auto gathered = gather_fixed_width_columns(source_table,
+                                               fixed_width_indices,
+                                               gather_map_begin,
+                                               gather_map_end,
+                                               bounds_policy == out_of_bounds_policy::NULLIFY,
+                                               stream,
+                                               mr);
+    for (std::size_t i = 0; i < fixed_width_indices.size(); ++i) {
+      destination_columns[fixed_width_indices[i]] = std::move(gathered[i]);
+    }
+  }
 
-  for (auto const& source_column : source_table) {
-    // The data gather for n columns will be put on the first n streams
-    destination_columns.push_back(
+  // The other columns are gathered independently, each on its own stream, so that the kernels of
+  // tables made of many small columns run concurrently. Their memory is handed over to `stream`
+  // when the streams are joined.
+  std::vector<size_type> column_indices;
+  for (size_type i = 0; i < source_table.num_columns(); ++i) {
+    if (not destination_columns[i]) { column_indices.push_back(i); }
+  }
+  auto const streams = column_indices.size() > 1
+                         ? cudf::detail::fork_streams(stream, column_indices.size())
+                         : std::vector<rmm::cuda_stream_view>(column_indices.size(), stream);
+  for (std::size_t i = 0; i < column_indices.size(); ++i) {
+    auto const& source_column = source_table.column(column_indices[i]);
+    destination_columns[column_indices[i]] =
       cudf::type_dispatcher<dispatch_storage_type>(source_column.type(),
                                                    column_gatherer{},
                                                    source_column,
                                                    gather_map_begin,
                                                    gather_map_end,
                                                    bounds_policy == out_of_bounds_policy::NULLIFY,
-                                                   stream,
-                                                   mr));
+                                                   streams[i],
+                                                   mr);
+  }
+  if (column_indices.size() > 1) {
+    cudf::detail::join_streams(streams, stream, destination_columns);
   }
 
   auto needs_new_bitmask = bounds_policy == out_of_bounds_policy::NULLIFY ||
@@ -40,9 +40,21 @@ namespace hash {
  */
 bool can_use_hash_groupby(host_span<aggregation_request const> requests);
 
-// Hash-based groupby
+/**
+ * @brief Hash-based groupby
+ *
+ * @param keys The grouping keys
+ * @param preprocessed_keys `keys` preprocessed for row hashing and equality, which may be reused
+ * across calls on the same keys
+ * @param requests The set of columns to aggregate and the aggregations to perform
+ * @param include_null_keys Whether rows in the keys that contain nulls are included
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns
+ * @return The unique keys and the aggregation results
+ */
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_keys,
   host_span<aggregation_request const> requests,
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
@@ -100,8 +100,9 @@ struct reduce_by_row_fn_base {
  *         reduction functor derived from `reduce_by_row_fn_base`
  * @tparam OutputType Type of the reduction results
  * @param map The auxiliary map to perform reduction
- * @param preprocessed_input The preprocessed of the input rows for computing row hashing and row
- *        comparisons
+ * @param preprocessed_input The preprocessed of the input rows for computing row comparisons
+ * @param key_hasher Device functor returning the hash of the row at a given index, which must
+ *        be the hasher used to insert the rows into `map`
  * @param num_rows The number of all input rows
  * @param has_nulls Indicate whether the input rows has any nulls at any nested levels
  * @param has_nested_columns Indicates whether the input table has any nested columns
@@ -113,10 +114,11 @@ struct reduce_by_row_fn_base {
  * @param mr Device memory resource used to allocate the returned vector
  * @return A device_uvector containing the reduction results
  */
-template <typename ReduceFuncBuilder, typename OutputType>
+template <typename ReduceFuncBuilder, typename OutputType, typename KeyHasher>
 rmm::device_uvector<OutputType> hash_reduce_by_row(
   hash_map_type const& map,
   std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const preprocessed_input,
+  KeyHasher const& key_hasher,
   size_type num_rows,
   cudf::nullate::DYNAMIC has_nulls,
   bool has_nested_columns,
@@ -127,10 +129,8 @@ rmm::device_uvector<OutputType> hash_reduce_by_row(
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
 {
-  auto const map_dview  = map.get_device_view();
-  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
-  auto const key_hasher = row_hasher.device_hasher(has_nulls);
-  auto const row_comp   = cudf::experimental::row::equality::self_comparator(preprocessed_input);
+  auto const map_dview = map.get_device_view();
+  auto const row_comp  = cudf::experimental::row::equality::self_comparator(preprocessed_input);
 
   auto reduction_results = rmm::device_uvector<OutputType>(num_rows, stream, mr);
   thrust::uninitialized_fill(
@@ -166,4 +166,55 @@ rmm::device_uvector<OutputType> hash_reduce_by_row(
   return reduction_results;
 }
 
+/**
+ * @copybrief hash_reduce_by_row
+ *
+ * The rows are hashed with the row hasher of `preprocessed_input`.
+ *
+ * @tparam ReduceFuncBuilder The builder class that must have a `build()` method returning a
+ *         reduction functor derived from `reduce_by_row_fn_base`
+ * @tparam OutputType Type of the reduction results
+ * @param map The auxiliary map to perform reduction
+ * @param preprocessed_input The preprocessed of the input rows for computing row hashing and row
+ *        comparisons
+ * @param num_rows The number of all input rows
+ * @param has_nulls Indicate whether the input rows has any nulls at any nested levels
+ * @param has_nested_columns Indicates whether the input table has any nested columns
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN values in floating point column should be
+ *        considered equal.
+ * @param init The initial value for reduction of each row group
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ * @return A device_uvector containing the reduction results
+ */
+template <typename ReduceFuncBuilder, typename OutputType>
+rmm::device_uvector<OutputType> hash_reduce_by_row(
+  hash_map_type const& map,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const preprocessed_input,
+  size_type num_rows,
+  cudf::nullate::DYNAMIC has_nulls,
+  bool has_nested_columns,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  ReduceFuncBuilder func_builder,
+  OutputType init,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
+  return hash_reduce_by_row(map,
+                            preprocessed_input,
+                            row_hasher.device_hasher(has_nulls),
+                            num_rows,
+                            has_nulls,
+                            has_nested_columns,
+                            nulls_equal,
+                            nans_equal,
+                            func_builder,
+                            init,
+                            stream,
+                            mr);
+}
+
 }  // namespace cudf::detail
@@ -52,14 +52,31 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
                                    rmm::device_async_resource_ref mr);
 
 /**
- * @copydoc cudf::to_dlpack
+ * @copydoc cudf::to_dlpack(table_view const&, dlpack_layout, rmm::device_async_resource_ref)
  *
  * @param stream CUDA stream used for device memory operations and kernel launches.
  */
 DLManagedTensor* to_dlpack(table_view const& input,
+                           dlpack_layout layout,
                            rmm::cuda_stream_view stream,
                            rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::make_strided_table
+ */
+strided_table make_strided_table(data_type type,
+                                 size_type num_rows,
+                                 size_type num_columns,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::to_dlpack(strided_table&&)
+ *
+ * @param stream CUDA stream on which the columns of `input` were written
+ */
+DLManagedTensor* to_dlpack(strided_table&& input, rmm::cuda_stream_view stream);
+
 // Creating arrow as per given type_id and buffer arguments
 template <typename... Ts>
 std::shared_ptr<arrow::Array> to_arrow_array(cudf::type_id id, Ts&&... args)
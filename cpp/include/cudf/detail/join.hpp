@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/hashing.hpp>
+#include <cudf/join.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -128,6 +129,28 @@ struct hash_join {
             rmm::cuda_stream_view stream,
             rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @copydoc cudf::hash_join::inner_join_batch
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join_batch(cudf::table_view const& probe,
+                   size_type& probe_row_offset,
+                   std::size_t max_output_size,
+                   rmm::cuda_stream_view stream,
+                   rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @copydoc cudf::hash_join::left_join_batch
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_batch(cudf::table_view const& probe,
+                  size_type& probe_row_offset,
+                  std::size_t max_output_size,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr) const;
+
   /**
    * @copydoc cudf::hash_join::inner_join_size
    */
@@ -147,6 +170,12 @@ struct hash_join {
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr) const;
 
+  /**
+   * @copydoc cudf::hash_join::make_bloom_filter
+   */
+  [[nodiscard]] cudf::bloom_filter make_bloom_filter(size_type bits_per_key,
+                                                     rmm::cuda_stream_view stream) const;
+
  private:
   /**
    * @brief Probes the `_hash_table` built from `_build` for tuples in `probe_table`,
@@ -186,6 +215,34 @@ struct hash_join {
                     std::optional<std::size_t> output_size,
                     rmm::cuda_stream_view stream,
                     rmm::device_async_resource_ref mr) const;
+
+  /**
+   * @brief Probes the `_hash_table` built from `_build` for a batch of the tuples in `probe`,
+   * starting at `probe_row_offset`, and returns the output indices of `build_table` and
+   * `probe_table` as a combined table.
+   *
+   * @throw cudf::logic_error if probe table is empty.
+   * @throw cudf::logic_error if the number of columns in build table and probe table do not match.
+   * @throw cudf::logic_error if the column data types in build table and probe table do not match.
+   *
+   * @param probe Table of probe side columns to join.
+   * @param join The type of join to be performed, either INNER_JOIN or LEFT_JOIN.
+   * @param[in,out] probe_row_offset The first probe row of the batch, updated to the first probe
+   * row of the next batch.
+   * @param max_output_size Maximum number of index pairs of the batch.
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned vectors.
+   *
+   * @return Join output indices vector pair.
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  compute_hash_join_batch(cudf::table_view const& probe,
+                          join_kind join,
+                          size_type& probe_row_offset,
+                          std::size_t max_output_size,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr) const;
 };
 }  // namespace detail
 }  // namespace cudf
@@ -53,6 +53,21 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::one_hot_encode_bins(column_view const& input, column_view const& left_edges,
+ * inclusive left_inclusive, column_view const& right_edges, inclusive right_inclusive,
+ * rmm::cuda_stream_view, rmm::device_async_resource_ref mr)
+ *
+ * @param stream Stream view on which to allocate resources and queue execution.
+ */
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            inclusive left_inclusive,
+                                            column_view const& right_edges,
+                                            inclusive right_inclusive,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr);
+
 /** @} */  // end of group
 }  // namespace detail
 }  // namespace cudf
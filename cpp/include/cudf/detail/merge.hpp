@@ -16,11 +16,19 @@
 
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/pair.h>
 
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -57,5 +65,53 @@ std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merg
                                    rmm::cuda_stream_view stream,
                                    rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Smallest number of non-empty tables merged by `chunked_merger` rather than by merging
+ * pairs of tables.
+ */
+constexpr std::size_t kway_merge_min_tables = 4;
+
+/**
+ * @brief Merges several sorted tables, materializing the merged rows in chunks.
+ *
+ * The merged order of the rows is computed first from the key columns only. Each chunk then
+ * gathers its rows once from the contiguous range of rows each input table contributes to it.
+ */
+class chunked_merger {
+ public:
+  /**
+   * @copydoc cudf::chunked_merge::chunked_merge
+   */
+  chunked_merger(std::vector<table_view> const& tables_to_merge,
+                 std::vector<size_type> const& key_cols,
+                 std::vector<order> const& column_order,
+                 std::vector<null_order> const& null_precedence,
+                 size_type chunk_rows,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr);
+
+  /**
+   * @copydoc cudf::chunked_merge::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::chunked_merge::next_chunk
+   */
+  std::unique_ptr<table> next_chunk();
+
+ private:
+  std::vector<std::unique_ptr<column>> _matched_dictionaries;
+  std::vector<table_view> _tables;
+  std::vector<size_type> _table_offsets;  ///< First merged row index of each table, and the total
+  rmm::device_uvector<size_type> _row_order;  ///< Row indices, offset by table, in merged order
+  std::vector<size_type> _chunk_begins;       ///< First row of each table in each chunk
+  std::vector<size_type> _chunk_counts;       ///< Number of rows of each table in each chunk
+  size_type _chunk_rows;
+  size_type _next_chunk = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
 }  // namespace detail
 }  // namespace cudf
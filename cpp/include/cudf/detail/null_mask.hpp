@@ -227,23 +227,54 @@ std::pair<rmm::device_buffer, size_type> bitmask_and(host_span<bitmask_type cons
                                                      rmm::device_async_resource_ref mr);
 
 /**
- * @copydoc cudf::bitmask_and
- *
- * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @copydoc cudf::compact_null_masks(column_view const&)
+ */
+column_view compact_null_masks(column_view const& input);
+
+/**
+ * @copydoc cudf::compact_null_masks(table_view const&)
+ */
+table_view compact_null_masks(table_view const& input);
+
+/**
+ * @copydoc cudf::compact_null_masks(column&)
+ */
+void compact_null_masks(column& input);
+
+/**
+ * @copydoc cudf::bitmask_and(table_view const&, rmm::cuda_stream_view,
+ *                            rmm::device_async_resource_ref)
  */
 std::pair<rmm::device_buffer, size_type> bitmask_and(table_view const& view,
                                                      rmm::cuda_stream_view stream,
                                                      rmm::device_async_resource_ref mr);
 
 /**
- * @copydoc cudf::bitmask_or
- *
- * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ * @copydoc cudf::bitmask_or(table_view const&, rmm::cuda_stream_view,
+ *                           rmm::device_async_resource_ref)
  */
 std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
                                                     rmm::cuda_stream_view stream,
                                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::bitmask_and(host_span<table_view const>, rmm::cuda_stream_view,
+ *                            rmm::device_async_resource_ref)
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::bitmask_or(host_span<table_view const>, rmm::cuda_stream_view,
+ *                           rmm::device_async_resource_ref)
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
 /**
  * @brief Performs a bitwise AND of the specified bitmasks,
  *        and writes in place to destination
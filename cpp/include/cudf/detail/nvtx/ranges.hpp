@@ -16,6 +16,8 @@
 
 #pragma once
 
+#include <cudf/detail/utilities/api_statistics.hpp>
+
 #include <nvtx3/nvtx3.hpp>
 
 namespace cudf {
@@ -48,7 +50,8 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * from the lifetime of a function.
  *
  * Uses the name of the immediately enclosing function returned by `__func__` to
- * name the range.
+ * name the range. The call is also recorded by `cudf::get_api_statistics` when statistics
+ * are enabled on the calling thread.
  *
  * Example:
  * ```
@@ -58,4 +61,6 @@ using scoped_range = ::nvtx3::scoped_range_in<libcudf_domain>;
  * }
  * ```
  */
-#define CUDF_FUNC_RANGE() NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain)
+#define CUDF_FUNC_RANGE()                    \
+  NVTX3_FUNC_RANGE_IN(cudf::libcudf_domain); \
+  cudf::detail::api_statistics_scope const cudf_api_statistics_scope { __func__ }
@@ -38,6 +38,28 @@ std::unique_ptr<column> quantile(column_view const& input,
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Computes exact quantiles of the valid values of an unsorted column.
+ *
+ * The result is the same as calling `quantile` with the sorted order of the valid elements of
+ * `input`. For large inputs the few values needed to interpolate the quantiles are found by
+ * selection, which takes a few passes over the data instead of a full sort.
+ *
+ * @param input Column from which to compute quantile values; nulls are ignored
+ * @param q Specified quantiles in range [0, 1]
+ * @param interp Strategy used to select between values adjacent to a specified quantile
+ * @param exact If true, returns doubles. If false, returns same type as input.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @returns Column of specified quantiles, all null if `input` has no valid values
+ */
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::quantiles()
  *
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -50,5 +51,15 @@ std::unique_ptr<table> repeat(table_view const& input_table,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::gather_repeated
+ */
+std::unique_ptr<table> gather_repeated(table_view const& input_table,
+                                       column_view const& count,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace cudf
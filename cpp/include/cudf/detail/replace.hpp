@@ -59,6 +59,15 @@ std::unique_ptr<column> replace_nulls(column_view const& input,
                                       rmm::cuda_stream_view stream,
                                       rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::replace_nulls(table_view const&, replace_policy const&, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy const& replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::replace_nans(column_view const&, column_view const&,
  * rmm::device_async_resource_ref)
@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/row_conversion.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @copydoc cudf::convert_to_rows
+ *
+ * @param max_batch_bytes Largest number of bytes of rows stored in one output column
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     int64_t max_batch_bytes,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::convert_from_rows
+ */
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         host_span<data_type const> schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -18,6 +18,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/search.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 
@@ -50,6 +51,32 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::lower_bound(table_view const&, table_view const&, std::vector<order> const&,
+ *          std::vector<null_order> const&, needles_order, rmm::cuda_stream_view,
+ *          rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> lower_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::upper_bound(table_view const&, table_view const&, std::vector<order> const&,
+ *          std::vector<null_order> const&, needles_order, rmm::cuda_stream_view,
+ *          rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> upper_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::contains(column_view const&, scalar const&, rmm::device_async_resource_ref)
  *
@@ -20,11 +20,14 @@
 #include <cudf/stream_compaction.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
+
 namespace cudf {
 namespace detail {
 /**
@@ -61,6 +64,30 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
                                           rmm::cuda_stream_view stream,
                                           rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::apply_boolean_mask(column_view const&, column_view const&,
+ *                                   mutable_column_view const&, size_type*,
+ *                                   device_span<std::byte>, rmm::cuda_stream_view)
+ */
+void apply_boolean_mask(column_view const& input,
+                        column_view const& boolean_mask,
+                        mutable_column_view const& output,
+                        size_type* output_size,
+                        device_span<std::byte> temp_storage,
+                        rmm::cuda_stream_view stream);
+
+/**
+ * @copydoc cudf::filter_gather
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> filter_gather(table_view const& input,
+                                     column_view const& gather_map,
+                                     column_view const& boolean_mask,
+                                     out_of_bounds_policy bounds_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::unique
  *
@@ -86,6 +113,36 @@ std::unique_ptr<table> distinct(table_view const& input,
                                 rmm::cuda_stream_view stream,
                                 rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::distinct(table_view const&, std::vector<size_type> const&,
+ *                         distinct_options const&, duplicate_keep_option, null_equality,
+ *                         nan_equality, rmm::device_async_resource_ref)
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                distinct_options const& options,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::distinct_by_extremum
+ *
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> distinct_by_extremum(table_view const& input,
+                                            std::vector<size_type> const& keys,
+                                            column_view const& order_by,
+                                            keep_extremum keep,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::stable_distinct
  *
@@ -99,6 +156,22 @@ std::unique_ptr<table> stable_distinct(table_view const& input,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::stable_distinct(table_view const&, std::vector<size_type> const&,
+ *                                distinct_options const&, duplicate_keep_option, null_equality,
+ *                                nan_equality, rmm::device_async_resource_ref)
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<table> stable_distinct(table_view const& input,
+                                       std::vector<size_type> const& keys,
+                                       distinct_options const& options,
+                                       duplicate_keep_option keep,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::distinct_indices
  *
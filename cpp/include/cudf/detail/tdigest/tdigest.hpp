@@ -236,6 +236,31 @@ std::unique_ptr<scalar> reduce_merge_tdigest(column_view const& input,
                                              rmm::cuda_stream_view stream,
                                              rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Adds a batch of values to an existing tdigest.
+ *
+ * This allows building a tdigest incrementally from a stream of batches without keeping the
+ * previous values around: the batch is reduced to a tdigest of its own, which is then merged with
+ * the existing one. The result is the same as merging the two tdigests with
+ * `reduce_merge_tdigest`.
+ *
+ * @throws std::invalid_argument if `tdigest` does not contain exactly one tdigest
+ *
+ * @param tdigest Single row tdigest column to update; the row may be an empty tdigest
+ * @param values Numeric values to add to the tdigest
+ * @param max_centroids Parameter controlling the level of compression of the tdigest. Higher
+ * values result in a larger, more precise tdigest.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ *
+ * @returns tdigest column with the updated tdigest as its single row
+ */
+std::unique_ptr<column> update_tdigest(column_view const& tdigest,
+                                       column_view const& values,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr);
+
 }  // namespace detail
 }  // namespace tdigest
 }  // namespace cudf
@@ -26,7 +26,7 @@
 namespace cudf::detail {
 
 /**
- * @brief Returns the UT offset for a given date and given timezone table.
+ * @brief Returns the UT offset for a given date and given timezone transitions.
  *
  * @param transition_times Transition times; trailing `solar_cycle_entry_count` entries are used for
  * all times beyond the one covered by the TZif file
@@ -36,12 +36,11 @@ namespace cudf::detail {
  *
  * @return offset from UT, in seconds
  */
-inline __device__ duration_s get_ut_offset(table_device_view tz_table, timestamp_s ts)
+inline __device__ duration_s get_ut_offset(device_span<timestamp_s const> transition_times,
+                                           device_span<duration_s const> offsets,
+                                           timestamp_s ts)
 {
-  if (tz_table.num_rows() == 0) { return duration_s{0}; }
-
-  cudf::device_span<timestamp_s const> transition_times(tz_table.column(0).head<timestamp_s>(),
-                                                        static_cast<size_t>(tz_table.num_rows()));
+  if (transition_times.empty()) { return duration_s{0}; }
 
   auto const ts_ttime_it = [&]() {
     auto last_less_equal = [](auto begin, auto end, auto value) {
@@ -73,7 +72,25 @@ inline __device__ duration_s get_ut_offset(table_device_view tz_table, timestamp
     }
   }();
 
-  return tz_table.column(1).element<duration_s>(ts_ttime_it - transition_times.begin());
+  return offsets[ts_ttime_it - transition_times.begin()];
+}
+
+/**
+ * @brief Returns the UT offset for a given date and given timezone table.
+ *
+ * @param tz_table Timezone table created by `make_timezone_transition_table`
+ * @param ts ORC timestamp
+ *
+ * @return offset from UT, in seconds
+ */
+inline __device__ duration_s get_ut_offset(table_device_view tz_table, timestamp_s ts)
+{
+  if (tz_table.num_rows() == 0) { return duration_s{0}; }
+
+  auto const num_rows = static_cast<size_t>(tz_table.num_rows());
+  return get_ut_offset({tz_table.column(0).head<timestamp_s>(), num_rows},
+                       {tz_table.column(1).head<duration_s>(), num_rows},
+                       ts);
 }
 
 }  // namespace cudf::detail
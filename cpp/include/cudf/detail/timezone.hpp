@@ -34,4 +34,14 @@ std::unique_ptr<table> make_timezone_transition_table(
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @copydoc cudf::convert_timezone
+ */
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
 }  // namespace cudf::detail
@@ -37,6 +37,22 @@ std::unique_ptr<column> transform(column_view const& input,
                                   rmm::cuda_stream_view stream,
                                   rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Compiles the kernel used by `transform` for the given types and UDF, or loads it from
+ * the kernel cache
+ *
+ * @throws cudf::logic_error if `input_type` or `output_type` is not fixed-width
+ *
+ * @param input_type Type of the input column
+ * @param unary_udf The PTX/CUDA string of the unary function to apply
+ * @param output_type The output type that is compatible with the output type in the UDF
+ * @param is_ptx true: the UDF is treated as PTX code; false: the UDF is treated as CUDA code
+ */
+void precompile_transform(data_type input_type,
+                          std::string const& unary_udf,
+                          data_type output_type,
+                          bool is_ptx);
+
 /**
  * @copydoc cudf::compute_column
  *
@@ -47,6 +63,16 @@ std::unique_ptr<column> compute_column(table_view const& table,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::compute_column_jit
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::nans_to_nulls
  *
@@ -81,6 +107,16 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
                                                               rmm::cuda_stream_view stream,
                                                               rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::one_hot_encode_sparse
+ *
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ */
+std::unique_ptr<column> one_hot_encode_sparse(column_view const& input,
+                                              column_view const& categories,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::mask_to_bools
  *
@@ -18,6 +18,7 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/unary.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -79,13 +80,23 @@ std::unique_ptr<cudf::column> is_valid(cudf::column_view const& input,
                                        rmm::device_async_resource_ref mr);
 
 /**
- * @copydoc cudf::cast
+ * @copydoc cudf::cast(column_view const&, data_type, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
  */
 std::unique_ptr<column> cast(column_view const& input,
                              data_type type,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::cast(table_view const&, host_span<data_type const>, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<table> cast(table_view const& input,
+                            host_span<data_type const> out_types,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc cudf::is_nan
  */
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+namespace cudf::detail {
+
+/**
+ * @brief Records the costs of a libcudf API call when `cudf::enable_api_statistics` was called
+ * on the calling thread.
+ *
+ * Constructed by `CUDF_FUNC_RANGE` for the lifetime of every public API call. Every scope counts
+ * the nesting depth of the calls of its thread, and only the outermost one records anything.
+ * Whether a call is recorded is decided when its outermost scope starts, so enabling or disabling
+ * the statistics within a call takes effect from the next call.
+ */
+class api_statistics_scope {
+ public:
+  /**
+   * @brief Start recording the call of the API `name` if statistics are enabled.
+   *
+   * @param name Name of the API, which must outlive the scope
+   */
+  explicit api_statistics_scope(char const* name);
+
+  /**
+   * @brief Attribute the costs of the call to its API name.
+   */
+  ~api_statistics_scope();
+
+  api_statistics_scope(api_statistics_scope const&)            = delete;
+  api_statistics_scope& operator=(api_statistics_scope const&) = delete;
+};
+
+}  // namespace cudf::detail
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <string>
+
+namespace cudf::detail {
+
+/**
+ * @brief Returns the size bucket of `size` used in autotuning keys: its number of significant bits.
+ *
+ * Inputs whose sizes are within a factor of two of each other share their tuned choices.
+ *
+ * @param size A non-negative size
+ * @return The bucket of the size
+ */
+constexpr int autotune_bucket(int64_t size)
+{
+  int bucket = 0;
+  for (; size > 0; size >>= 1) {
+    ++bucket;
+  }
+  return bucket;
+}
+
+/**
+ * @brief Indicates whether autotuning is enabled with the `LIBCUDF_AUTOTUNE` environment variable.
+ *
+ * Callers can check it to skip building the key of a decision when autotuning is disabled.
+ *
+ * @return true if `autotuned_choice` benchmarks the candidates
+ */
+bool is_autotuning_enabled();
+
+/**
+ * @brief Forgets the choices made by the process.
+ *
+ * The next request of each key reloads the choices of the tuning file, or benchmarks the
+ * candidates if the key is not in the file.
+ */
+void clear_autotuned_choices();
+
+/**
+ * @brief Selects one of several equivalent configurations of a kernel on the current device.
+ *
+ * Autotuning is enabled by defining the `LIBCUDF_AUTOTUNE` environment variable. When it is not
+ * defined, `default_choice` is returned. Otherwise, the first time the process requests a `key`,
+ * every candidate is run and timed on `stream` and the fastest one is returned for that key from
+ * then on. The choices are persisted to the `autotune.txt` file of the kernel cache directory,
+ * which is specific to the compute capability of the device (see `LIBCUDF_KERNEL_CACHE_PATH`), so
+ * each decision is benchmarked once per type of GPU.
+ *
+ * @param key Identifies the decision and the shape of its inputs, without whitespace
+ * @param num_candidates Number of candidate configurations
+ * @param default_choice Candidate returned when autotuning is disabled
+ * @param run_candidate Runs the candidate of the given index on `stream`, which must leave the
+ * inputs unchanged
+ * @param stream CUDA stream used to time the candidates
+ * @return Index of the candidate to use
+ */
+std::size_t autotuned_choice(std::string const& key,
+                             std::size_t num_candidates,
+                             std::size_t default_choice,
+                             std::function<void(std::size_t)> const& run_candidate,
+                             rmm::cuda_stream_view stream);
+
+}  // namespace cudf::detail
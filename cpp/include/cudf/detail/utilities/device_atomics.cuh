@@ -483,6 +483,29 @@ __forceinline__ __device__ T atomic_add(T* address, T val)
   return cudf::detail::genericAtomicOperation(address, val, cudf::DeviceSum{});
 }
 
+/**
+ * @brief Overload of `atomic_add` for `__int128_t`
+ *
+ * There is no 128-bit atomic add, so the value is added as two 64-bit limbs: the low limb with a
+ * native atomic add, then the high limb together with the carry out of the low limb. Concurrent
+ * additions may update the limbs in any order, so `*address` only holds a consistent value once
+ * all of them have completed, and unlike the other overloads the old value is not returned.
+ *
+ * @param address The address of the 16-byte aligned value in global or shared memory
+ * @param val The value to be added
+ */
+__forceinline__ __device__ void atomic_add(__int128_t* address, __int128_t val)
+{
+  using T_int       = unsigned long long int;
+  auto const limbs  = reinterpret_cast<T_int*>(address);
+  auto const low    = static_cast<T_int>(val);
+  auto const high   = static_cast<T_int>(static_cast<__uint128_t>(val) >> 64);
+  auto const old    = atomicAdd(limbs, low);
+  auto const carry  = static_cast<T_int>(old + low < old);
+  auto const update = high + carry;
+  if (update != 0) { atomicAdd(limbs + 1, update); }
+}
+
 /**
  * @brief Overloads for `atomic_mul`
  *
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/utilities/thread_pool.hpp>
+
+namespace cudf::detail {
+
+/**
+ * @brief Retrieves a reference to the global host worker thread pool.
+ *
+ * The pool is intended for host-side tasks such as file reads and metadata parsing. Tasks
+ * submitted to the pool must not submit further tasks and wait on them, as this can exhaust the
+ * threads of the pool.
+ *
+ * This function is thread safe.
+ *
+ * @return A reference to the host worker thread pool
+ */
+thread_pool& host_worker_pool();
+
+}  // namespace cudf::detail
@@ -16,11 +16,13 @@
 
 #pragma once
 
+#include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
 #include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace cudf::detail {
@@ -122,4 +124,21 @@ cuda_stream_pool& global_cuda_stream_pool();
  */
 void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stream_view stream);
 
+/**
+ * @brief Synchronize a stream to an event on a set of streams, and hand the device memory of the
+ * columns built on those streams over to it.
+ *
+ * A device buffer is deallocated on the stream it was allocated on, so a column built on a forked
+ * stream would later be freed out of order with the work of the caller on `stream`. After this
+ * call the buffers of `columns`, including those of their children, are deallocated on `stream`
+ * instead, which is safe since `stream` waits on all of `streams`.
+ *
+ * @param streams Streams to wait on.
+ * @param stream Joined stream that synchronizes with the waited-on streams.
+ * @param columns Columns built on `streams`; null entries are ignored.
+ */
+void join_streams(host_span<rmm::cuda_stream_view const> streams,
+                  rmm::cuda_stream_view stream,
+                  host_span<std::unique_ptr<column>> columns);
+
 }  // namespace cudf::detail
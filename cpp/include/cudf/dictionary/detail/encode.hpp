@@ -57,6 +57,13 @@ std::unique_ptr<column> encode(column_view const& column,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::dictionary::is_low_cardinality
+ */
+bool is_low_cardinality(column_view const& column,
+                        double max_distinct_ratio,
+                        rmm::cuda_stream_view stream);
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
@@ -103,6 +103,21 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
 std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_dictionaries(
   std::vector<table_view> tables, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Replace the dictionary columns of a table with views of their indices.
+ *
+ * The keys of a dictionary are sorted and unique, so comparing the indices of dictionary rows that
+ * share the same keys gives the same result as comparing their values, for both equality and
+ * ordering. The indices can then be hashed and sorted as integers.
+ *
+ * The returned views carry the offset and null mask of the original dictionary columns.
+ * Non-dictionary columns are returned unchanged.
+ *
+ * @param input Table whose dictionary columns are replaced
+ * @return Table view with each dictionary column replaced by its annotated indices
+ */
+table_view replace_dictionaries_with_indices(table_view const& input);
+
 }  // namespace detail
 }  // namespace dictionary
 }  // namespace cudf
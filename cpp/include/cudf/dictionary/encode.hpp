@@ -64,6 +64,33 @@ std::unique_ptr<column> encode(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Estimate whether a column has few enough distinct values to be worth dictionary encoding
+ *
+ * The number of distinct non-null values is approximated with a HyperLogLog sketch of the
+ * column, which is much cheaper than computing the keys. This can be used to decide whether to
+ * call `encode` on a column, for example a strings column just read from a file.
+ *
+ * A column with no non-null values is considered low cardinality.
+ *
+ * @code{.pseudo}
+ * c = ["a", "b", "a", "a", "b", "a"]
+ * is_low_cardinality(c, 0.5) is true since 2 <= 0.5 * 6
+ * @endcode
+ *
+ * @throw std::invalid_argument if `max_distinct_ratio` is not in the range [0, 1]
+ *
+ * @param column The column to check
+ * @param max_distinct_ratio The largest ratio of distinct values to non-null values considered
+ *        low cardinality
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return true if the estimated number of distinct values is at most `max_distinct_ratio`
+ *         times the number of non-null values
+ */
+bool is_low_cardinality(column_view const& column,
+                        double max_distinct_ratio    = 0.5,
+                        rmm::cuda_stream_view stream = cudf::get_default_stream());
+
 /**
  * @brief Create a column by gathering the keys from the provided
  * dictionary_column into a new column using the indices from that column.
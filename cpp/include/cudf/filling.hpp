@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -154,6 +155,46 @@ std::unique_ptr<table> repeat(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Gathers rows of the table that `repeat(input_table, count)` returns without
+ * materializing it.
+ *
+ * A column of runs of repeated values, such as a constant column of a single row repeated for
+ * every row of a table, can be kept as the rows of its runs and their counts. Only the rows that
+ * are gathered are expanded, so the repeated column is never allocated.
+ *
+ * Row `i` of the result is row `gather_map[i]` of `repeat(input_table, count)`.
+ * Example:
+ * ```
+ * in = [4,5,6]
+ * count = [1,2,3]
+ * gather_map = [5,0,2,1]
+ * return = [6,4,5,5]
+ * ```
+ * @p count has the same requirements as in `repeat`. With `out_of_bounds_policy::NULLIFY`, rows
+ * for indices of @p gather_map outside of `[0, sum(count))` are null. With
+ * `out_of_bounds_policy::DONT_CHECK` the behavior is undefined for such indices.
+ *
+ * @throws cudf::logic_error if @p input_table and @p count have different number of rows.
+ * @throws cudf::logic_error if @p count has null values.
+ * @throws std::invalid_argument if @p gather_map has null values or is not of an index type.
+ *
+ * @param input_table Input table
+ * @param count Non-nullable column of an integral type
+ * @param gather_map Non-nullable column of indices of the rows of the repeated table to gather
+ * @param bounds_policy Policy to apply to indices of @p gather_map outside of the repeated table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The gathered rows of the repeated table
+ */
+std::unique_ptr<table> gather_repeated(
+  table_view const& input_table,
+  column_view const& count,
+  column_view const& gather_map,
+  out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK,
+  rmm::cuda_stream_view stream       = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr  = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Fills a column with a sequence of value specified by an initial value and a step.
  *
@@ -21,16 +21,28 @@
 #include <cudf/replace.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstdint>
+#include <limits>
 #include <memory>
 #include <utility>
 #include <vector>
 
+// Forward declaration
+namespace cudf::experimental::row::equality {
+struct preprocessed_table;
+}
+
+namespace cudf::io {
+class chunked_parquet_reader;
+}
+
 namespace cudf {
 //! `groupby` APIs
 namespace groupby {
@@ -196,6 +208,41 @@ class groupby {
     host_span<aggregation_request const> requests,
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Performs grouped aggregations on the specified values, one partition of the groups at
+   * a time.
+   *
+   * The rows are hash-partitioned on their keys, so all rows of a group are in the same partition,
+   * and the partitions are aggregated one after the other. The device memory used by the
+   * aggregation is therefore that of the largest partition rather than that of all groups, which
+   * allows aggregating high-cardinality keys that do not fit in device memory at once.
+   *
+   * If `spill_to_host` is true, the partitions are built from slices of the rows and kept in host
+   * memory until they are aggregated, so only one partition is in device memory at a time. This
+   * also allows the keys and values to be in host-accessible memory larger than the device memory.
+   *
+   * The results are the same as the results of `aggregate`, with groups in arbitrary order.
+   *
+   * @throws cudf::logic_error If `requests[i].values.size() != keys.num_rows()`.
+   * @throws std::invalid_argument If `num_partitions` is not positive
+   *
+   * @param requests The set of columns to aggregate and the aggregations to
+   * perform
+   * @param num_partitions The number of partitions of the groups
+   * @param spill_to_host Whether the partitions are kept in host memory until aggregated
+   * @param stream CUDA stream used for device memory operations and kernel launches.
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and
+   * a vector of aggregation_results for each request in the same order as
+   * specified in `requests`.
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_partitioned(
+    host_span<aggregation_request const> requests,
+    size_type num_partitions,
+    bool spill_to_host                = false,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
   /**
    * @brief Performs grouped scans on the specified values.
    *
@@ -389,6 +436,9 @@ class groupby {
   std::unique_ptr<detail::sort::sort_groupby_helper>
     _helper;  ///< Helper object
               ///< used by sort based implementation
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
+    _preprocessed_keys;  ///< Keys preprocessed for row hashing and equality,
+                         ///< shared by all hash based aggregations
 
   /**
    * @brief Get the sort helper object
@@ -418,6 +468,165 @@ class groupby {
     rmm::cuda_stream_view stream,
     rmm::device_async_resource_ref mr);
 };
+
+/**
+ * @brief Groups successive batches of keys and values and computes aggregations on those groups.
+ *
+ * The partial aggregation state of every group seen so far is kept on device. Each batch is
+ * aggregated on its own and its partial state is then merged into the state of the previous
+ * batches, so the memory used is bounded by the number of groups rather than by the number of
+ * rows aggregated.
+ *
+ * The supported aggregations are SUM, COUNT_VALID, COUNT_ALL, MIN, MAX, M2, TDIGEST, HYPERLOGLOG
+ * and COLLECT_LIST. Their results are the same as if a single `groupby::aggregate` had been called on
+ * the concatenation of all batches, except for the order of the groups.
+ *
+ * When the number of groups grows too large, their state can be spilled to host memory with
+ * `spill()`. The following batches start a new state on device, and the spilled states are merged
+ * back when the results are computed.
+ *
+ * Example:
+ * @code{.pseudo}
+ * aggregations: {{SUM, MAX}}
+ *
+ * aggregate(keys: {1, 2, 1}, values: {{1, 2, 3}})
+ * aggregate(keys: {2, 3},    values: {{4, 5}})
+ *
+ * results() (group orders may be different):
+ * keys:    {1, 2, 3}
+ * results: {{4, 6, 5}, {3, 4, 5}}
+ * @endcode
+ */
+class streaming_groupby {
+ public:
+  streaming_groupby() = delete;
+  ~streaming_groupby();
+  streaming_groupby(streaming_groupby const&)            = delete;
+  streaming_groupby(streaming_groupby&&)                 = delete;
+  streaming_groupby& operator=(streaming_groupby const&) = delete;
+  streaming_groupby& operator=(streaming_groupby&&)      = delete;
+
+  /**
+   * @brief Construct a streaming groupby object with the aggregations to perform
+   *
+   * @throw std::invalid_argument if an aggregation is not supported
+   *
+   * @param aggregations The aggregations to perform on each column of values of the batches
+   * @param include_null_keys Indicates whether rows in the keys that contain NULL values should be
+   * included
+   */
+  explicit streaming_groupby(
+    host_span<std::vector<std::unique_ptr<groupby_aggregation>> const> aggregations,
+    null_policy include_null_keys = null_policy::EXCLUDE);
+
+  /**
+   * @brief Aggregates a batch of keys and values into the state of the groups
+   *
+   * @throw std::invalid_argument if the number of value columns does not match the number of
+   * aggregation lists, or if a value column and the keys have different sizes
+   * @throw cudf::data_type_error if the keys types differ from the keys types of the previous
+   * batches
+   *
+   * @param keys The keys of the batch
+   * @param values The values of the batch, one column per list of aggregations
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void aggregate(table_view const& keys,
+                 host_span<column_view const> values,
+                 rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns the results of the aggregations on all batches aggregated so far
+   *
+   * The state of the groups is left unchanged, so more batches can be aggregated afterwards.
+   *
+   * @throw cudf::logic_error if no batch has been aggregated
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device memory
+   * @return Pair containing the table with each group's unique key and a vector of
+   * aggregation_results for each list of aggregations in the same order as specified in the
+   * constructor
+   */
+  std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> results(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the number of groups whose state is on device
+   *
+   * The groups of the states spilled to host memory are not counted.
+   *
+   * @return The number of groups on device
+   */
+  [[nodiscard]] size_type num_groups() const;
+
+  /**
+   * @brief Moves the state of the groups on device to host memory
+   *
+   * The batches aggregated afterwards start a new state on device.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  void spill(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+ private:
+  /**
+   * @brief The state of groups packed by `cudf::pack` and copied to host memory
+   */
+  struct spilled_state {
+    std::vector<uint8_t> metadata;  ///< Metadata of the packed state
+    std::vector<uint8_t> data;      ///< Packed keys, then partial states
+  };
+
+  std::vector<std::vector<std::unique_ptr<groupby_aggregation>>>
+    _aggregations;                 ///< Aggregations performed on each value column
+  null_policy _include_null_keys;  ///< Include rows in keys with NULLs
+  std::unique_ptr<table> _keys;    ///< Unique keys of the groups on device
+  std::vector<std::vector<std::unique_ptr<column>>>
+    _partials;  ///< Partial aggregation state of the groups, one column per aggregation
+
+  std::vector<spilled_state> _spilled;  ///< States spilled to host memory
+};
+
+/**
+ * @brief Groups the rows of all the chunks of a chunked Parquet reader and computes aggregations
+ * on those groups.
+ *
+ * The chunks are aggregated by a `streaming_groupby`. The next chunk is read on another thread
+ * while the current one is aggregated, so that its decoding overlaps with the aggregation. When
+ * the number of groups on device exceeds `max_device_groups` after a chunk, their state is
+ * spilled to host memory.
+ *
+ * The reader must have been constructed with `stream`, since the chunks it returns are used on
+ * `stream` without synchronization. Up to two chunks are in device memory at once, and the
+ * current device memory resource must be safe to use from multiple threads.
+ *
+ * @throw std::invalid_argument if an aggregation is not supported by `streaming_groupby`, or if
+ * the number of value columns does not match the number of aggregation lists
+ * @throw std::out_of_range if a key or value index is not a column of the chunks
+ *
+ * @param reader The chunked reader, which is read until it has no more chunks
+ * @param key_indices Indices of the key columns of the chunks
+ * @param value_indices Indices of the value columns of the chunks, one per list of aggregations
+ * @param aggregations The aggregations to perform on each value column
+ * @param include_null_keys Indicates whether rows in the keys that contain NULL values should be
+ * included
+ * @param max_device_groups Number of groups on device above which their state is spilled
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table and columns' device memory
+ * @return Pair containing the table with each group's unique key and a vector of
+ * aggregation_results for each list of aggregations in the same order as `value_indices`
+ */
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_chunked_parquet(
+  io::chunked_parquet_reader& reader,
+  host_span<size_type const> key_indices,
+  host_span<size_type const> value_indices,
+  host_span<std::vector<std::unique_ptr<groupby_aggregation>> const> aggregations,
+  null_policy include_null_keys     = null_policy::EXCLUDE,
+  size_type max_device_groups       = std::numeric_limits<size_type>::max(),
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 /** @} */
 }  // namespace groupby
 }  // namespace cudf
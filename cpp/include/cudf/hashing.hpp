@@ -21,6 +21,8 @@
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <vector>
+
 namespace cudf {
 
 /**
@@ -184,6 +186,42 @@ std::unique_ptr<column> xxhash_64(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Identifies a hash function computed by `multi_hash()`
+ */
+enum class hash_function_id : int8_t {
+  MURMURHASH3_X86_32,  ///< Same as `murmurhash3_x86_32()`
+  XXHASH_64,           ///< Same as `xxhash_64()`
+  MD5                  ///< Same as `md5()`
+};
+
+/**
+ * @brief Computes several hash values of each row in the given table
+ *
+ * The result of each hash function is the same as calling its individual API.
+ * Tables of fixed-width and strings columns are read once and each element is passed
+ * to all the requested hash functions. Other tables are hashed with the individual
+ * APIs and support the same types as those functions.
+ *
+ * The lower 32 bits of `seed` are used for `MURMURHASH3_X86_32` and `MD5` ignores the seed.
+ *
+ * @throw cudf::logic_error if `MD5` is requested and the table has a column type
+ *        not supported by `md5()`
+ *
+ * @param input The table of columns to hash
+ * @param hash_ids The hash functions to compute
+ * @param seed Optional seed value to use for the hash functions
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @returns A table with a column for each entry in `hash_ids`
+ */
+std::unique_ptr<table> multi_hash(
+  table_view const& input,
+  std::vector<hash_function_id> const& hash_ids,
+  uint64_t seed                     = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 }  // namespace hashing
 
 /** @} */  // end of group
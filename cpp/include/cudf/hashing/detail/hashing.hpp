@@ -23,6 +23,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <vector>
 
 namespace cudf {
 namespace hashing {
@@ -67,6 +68,12 @@ std::unique_ptr<column> xxhash_64(table_view const& input,
                                   rmm::cuda_stream_view,
                                   rmm::device_async_resource_ref mr);
 
+std::unique_ptr<table> multi_hash(table_view const& input,
+                                  std::vector<hash_function_id> const& hash_ids,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr);
+
 /* Copyright 2005-2014 Daniel James.
  *
  * Use, modification and distribution is subject to the Boost Software
@@ -36,8 +36,11 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
 struct DLManagedTensor;
@@ -98,6 +101,90 @@ DLManagedTensor* to_dlpack(
   table_view const& input,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Layout of the elements of a 2D DLPack tensor
+ */
+enum class dlpack_layout : bool {
+  COLUMN_MAJOR,  ///< The elements of each column are contiguous (Fortran order)
+  ROW_MAJOR      ///< The elements of each row are contiguous (C order)
+};
+
+/**
+ * @brief Convert a cudf table into a DLPack DLTensor with the given layout
+ *
+ * Same as `to_dlpack(table_view const&, rmm::device_async_resource_ref)`, but a 2D tensor is laid
+ * out as specified by `layout`. A row-major tensor is built by interleaving the columns, without
+ * an intermediate column-major copy. Note that `from_dlpack` only accepts column-major tensors.
+ *
+ * @throw cudf::logic_error if the data types are not equal or not numeric,
+ * or if any of columns have non-zero null count
+ *
+ * @param input Table to convert to DLPack
+ * @param layout Layout of the elements of a 2D tensor
+ * @param mr Device memory resource used to allocate the returned DLPack tensor's device memory
+ *
+ * @return 1D or 2D DLPack tensor with a copy of the table data, or nullptr
+ */
+DLManagedTensor* to_dlpack(
+  table_view const& input,
+  dlpack_layout layout,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A table whose columns are carved from one contiguous column-major 2D buffer
+ *
+ * Created by `make_strided_table` to be filled by libcudf APIs that write into preallocated
+ * columns, or by the caller, and then exported to DLPack without a copy.
+ */
+struct strided_table {
+  mutable_table_view table;                   ///< Views of the columns into `data`
+  std::unique_ptr<rmm::device_buffer> data{};  ///< Buffer holding the elements of all the columns
+};
+
+/**
+ * @brief Allocates a table of non-nullable columns of `type` in one contiguous buffer
+ *
+ * Column `i` starts `i * stride` bytes from the start of the buffer, where the stride is the size
+ * of a column rounded up to the allocation alignment, so the buffer is a column-major 2D tensor.
+ * The elements of the columns are uninitialized.
+ *
+ * @throw std::invalid_argument if `num_rows` or `num_columns` is negative
+ * @throw cudf::logic_error if `type` is not numeric
+ *
+ * @param type Type of the columns
+ * @param num_rows Number of rows of the table
+ * @param num_columns Number of columns of the table
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the buffer
+ * @return The buffer and the views of its columns
+ */
+strided_table make_strided_table(
+  data_type type,
+  size_type num_rows,
+  size_type num_columns,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Convert a table created by `make_strided_table` into a DLPack DLTensor without copying
+ *
+ * The returned tensor takes ownership of the buffer of `input`, whose views must not be used
+ * anymore. A table of several columns is exported as a 2D column-major tensor whose column stride
+ * is the stride of the buffer. If the table has zero rows and zero columns, the result will be
+ * nullptr.
+ *
+ * @note The `deleter` method of the returned `DLManagedTensor` must be used to
+ * free the memory of the tensor.
+ *
+ * @throw cudf::logic_error if the columns of `input` are not the views created by
+ * `make_strided_table`
+ *
+ * @param input Strided table to convert to DLPack
+ *
+ * @return 1D or 2D DLPack tensor viewing the buffer of the table, or nullptr
+ */
+DLManagedTensor* to_dlpack(strided_table&& input);
+
 /** @} */  // end of group
 
 /**
@@ -497,7 +584,9 @@ using unique_table_view_t =
  *
  * @note The custom deleter used for the unique_ptr to the table_view maintains ownership
  * over any memory which is allocated, such as converting boolean columns from the bitmap
- * used by Arrow to the 1-byte per value for cudf.
+ * used by Arrow to the 1-byte per value for cudf. Only the buffers which need converting are
+ * allocated; all other buffers, including the int64 offsets of large_string arrays, are used
+ * without copying.
  *
  * @note If the input `ArrowDeviceArray` contained a non-null sync_event it is assumed
  * to be a `cudaEvent_t*` and the passed in stream will have `cudaStreamWaitEvent` called
@@ -540,7 +629,9 @@ using unique_column_view_t =
  *
  * @note The custom deleter used for the unique_ptr to the table_view maintains ownership
  * over any memory which is allocated, such as converting boolean columns from the bitmap
- * used by Arrow to the 1-byte per value for cudf.
+ * used by Arrow to the 1-byte per value for cudf. Only the buffers which need converting are
+ * allocated; all other buffers, including the int64 offsets of large_string arrays, are used
+ * without copying.
  *
  * @note If the input `ArrowDeviceArray` contained a non-null sync_event it is assumed
  * to be a `cudaEvent_t*` and the passed in stream will have `cudaStreamWaitEvent` called
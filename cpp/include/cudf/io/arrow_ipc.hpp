@@ -0,0 +1,650 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "types.hpp"
+
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+
+namespace detail::arrow_ipc {
+/**
+ * @brief Forward declaration of the internal chunked reader class
+ */
+class chunked_reader;
+
+/**
+ * @brief Forward declaration of the internal writer class
+ */
+class writer;
+}  // namespace detail::arrow_ipc
+
+/**
+ * @addtogroup io_readers
+ * @{
+ * @file
+ */
+
+class arrow_ipc_reader_options_builder;
+
+/**
+ * @brief Settings to use for `read_arrow_ipc()`.
+ */
+class arrow_ipc_reader_options {
+  source_info _source;
+
+  // Names of top-level columns to read; empty is all
+  std::vector<std::string> _columns;
+
+  /**
+   * @brief Constructor from source info.
+   *
+   * @param src source information used to read the Arrow IPC stream
+   */
+  explicit arrow_ipc_reader_options(source_info src) : _source{std::move(src)} {}
+
+  friend arrow_ipc_reader_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  arrow_ipc_reader_options() = default;
+
+  /**
+   * @brief Returns source info.
+   *
+   * @return Source info
+   */
+  [[nodiscard]] source_info const& get_source() const { return _source; }
+
+  /**
+   * @brief Returns names of the columns to be read.
+   *
+   * @return Names of the columns to be read
+   */
+  [[nodiscard]] std::vector<std::string> const& get_columns() const { return _columns; }
+
+  /**
+   * @brief Set names of the columns to be read.
+   *
+   * @param col_names Vector of top-level column names
+   */
+  void set_columns(std::vector<std::string> col_names) { _columns = std::move(col_names); }
+
+  /**
+   * @brief Create arrow_ipc_reader_options_builder which will build arrow_ipc_reader_options.
+   *
+   * @param src source information used to read the Arrow IPC stream
+   * @returns builder to build reader options
+   */
+  static arrow_ipc_reader_options_builder builder(source_info src);
+};
+
+/**
+ * @brief Builder to build options for `read_arrow_ipc()`.
+ */
+class arrow_ipc_reader_options_builder {
+  arrow_ipc_reader_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  arrow_ipc_reader_options_builder() = default;
+
+  /**
+   * @brief Constructor from source info.
+   *
+   * @param src The source information used to read the Arrow IPC stream
+   */
+  explicit arrow_ipc_reader_options_builder(source_info src) : options{std::move(src)} {}
+
+  /**
+   * @brief Set names of the columns to be read.
+   *
+   * @param col_names Vector of top-level column names
+   * @return this for chaining
+   */
+  arrow_ipc_reader_options_builder& columns(std::vector<std::string> col_names)
+  {
+    options._columns = std::move(col_names);
+    return *this;
+  }
+
+  /**
+   * @brief move arrow_ipc_reader_options member once it's built.
+   */
+  operator arrow_ipc_reader_options&&() { return std::move(options); }
+
+  /**
+   * @brief move arrow_ipc_reader_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `arrow_ipc_reader_options` object's r-value reference
+   */
+  arrow_ipc_reader_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Reads an Arrow IPC stream into a set of columns.
+ *
+ * The record batches of the stream are decoded directly into device memory. Buffers compressed
+ * with `LZ4_FRAME` or `ZSTD` are decompressed on the device with nvCOMP, except LZ4 frames of
+ * linked blocks, which are decompressed on the host. All the record batches of the stream are
+ * concatenated into the returned table.
+ *
+ * Supported Arrow types are signed and unsigned integers, single and double precision floats,
+ * booleans, dates, timestamps, durations, 32/64/128-bit decimals, utf8, large_utf8, list and
+ * struct. Dictionary-encoded fields are not supported.
+ *
+ * The following code snippet demonstrates how to read a stream from a file:
+ * @code
+ *  auto source  = cudf::io::source_info("dataset.arrows");
+ *  auto options = cudf::io::arrow_ipc_reader_options::builder(source);
+ *  auto result  = cudf::io::read_arrow_ipc(options);
+ * @endcode
+ *
+ * @throws cudf::logic_error if the stream is malformed or contains an unsupported type
+ *
+ * @param options Settings for controlling reading behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the table in the returned
+ * table_with_metadata
+ *
+ * @return The set of columns along with metadata
+ */
+table_with_metadata read_arrow_ipc(
+  arrow_ipc_reader_options const& options,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief The chunked Arrow IPC reader class to read a stream iteratively in a series of tables,
+ * chunk by chunk.
+ *
+ * Each chunk contains the rows of one or more whole record batches of the stream, so a stream of
+ * many record batches can be read with bounded memory use.
+ */
+class chunked_arrow_ipc_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_arrow_ipc_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `arrow_ipc_reader_options` parameter as in
+   * `cudf::read_arrow_ipc()`, and an additional parameter to specify the maximum number of
+   * record batch body bytes to read per chunk. A record batch larger than the limit is read in a
+   * chunk of its own.
+   *
+   * @param chunk_read_limit Limit on the number of body bytes read per chunk, or `0` if there is
+   * no limit
+   * @param options The options used to read the Arrow IPC stream
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_arrow_ipc_reader(
+    std::size_t chunk_read_limit,
+    arrow_ipc_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_arrow_ipc_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given input.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains all the rows of
+   * the stream in order.
+   *
+   * An empty table will be returned if all the data in the input has been read and returned by
+   * the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::arrow_ipc::chunked_reader> reader;
+};
+
+/** @} */  // end of group
+
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+class arrow_ipc_writer_options_builder;
+
+/**
+ * @brief Settings to use for `write_arrow_ipc()`.
+ */
+class arrow_ipc_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Set of columns to output
+  table_view _table;
+  // Optional associated metadata
+  std::optional<table_input_metadata> _metadata;
+  // Compression of the record batch buffers: NONE, LZ4 (LZ4_FRAME) or ZSTD
+  compression_type _compression = compression_type::NONE;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit arrow_ipc_writer_options(sink_info const& sink, table_view const& table)
+    : _sink(sink), _table(table)
+  {
+  }
+
+  friend arrow_ipc_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  arrow_ipc_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `arrow_ipc_writer_options`.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   *
+   * @return Builder to build arrow_ipc_writer_options
+   */
+  static arrow_ipc_writer_options_builder builder(sink_info const& sink, table_view const& table);
+
+  /**
+   * @brief Returns sink info.
+   *
+   * @return Sink info
+   */
+  [[nodiscard]] sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns table to be written to output.
+   *
+   * @return Table to be written to output
+   */
+  [[nodiscard]] table_view get_table() const { return _table; }
+
+  /**
+   * @brief Returns associated metadata.
+   *
+   * @return Optional associated metadata
+   */
+  [[nodiscard]] auto const& get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns compression type.
+   *
+   * @return Compression type
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata
+   */
+  void set_metadata(table_input_metadata metadata) { _metadata = std::move(metadata); }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param comp Compression type: `NONE`, `LZ4` or `ZSTD`
+   */
+  void set_compression(compression_type comp) { _compression = comp; }
+
+  /**
+   * @brief Sets table to be written.
+   *
+   * @param tbl Table for the output
+   */
+  void set_table(table_view tbl) { _table = tbl; }
+};
+
+/**
+ * @brief Builds settings to use for `write_arrow_ipc()`.
+ */
+class arrow_ipc_writer_options_builder {
+  arrow_ipc_writer_options options;  ///< Options to be built.
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  explicit arrow_ipc_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink and table.
+   *
+   * @param sink The sink used for writer output
+   * @param table Table to be written to output
+   */
+  explicit arrow_ipc_writer_options_builder(sink_info const& sink, table_view const& table)
+    : options{sink, table}
+  {
+  }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata
+   * @return this for chaining
+   */
+  arrow_ipc_writer_options_builder& metadata(table_input_metadata metadata)
+  {
+    options._metadata = std::move(metadata);
+    return *this;
+  }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param comp Compression type: `NONE`, `LZ4` or `ZSTD`
+   * @return this for chaining
+   */
+  arrow_ipc_writer_options_builder& compression(compression_type comp)
+  {
+    options._compression = comp;
+    return *this;
+  }
+
+  /**
+   * @brief move arrow_ipc_writer_options member once it's built.
+   */
+  operator arrow_ipc_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move arrow_ipc_writer_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `arrow_ipc_writer_options` object's r-value reference
+   */
+  arrow_ipc_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes a set of columns as an Arrow IPC stream.
+ *
+ * The table is written as a schema message followed by a single record batch. The buffers of
+ * the record batch are compressed on the device with nvCOMP if `LZ4` or `ZSTD` compression is
+ * selected; a buffer that does not become smaller is stored uncompressed. Decimal columns are
+ * written as 128-bit decimals and dictionary columns are not supported.
+ *
+ * The following code snippet demonstrates how to write columns to a file:
+ * @code
+ *  auto destination = cudf::io::sink_info("dataset.arrows");
+ *  auto options     = cudf::io::arrow_ipc_writer_options::builder(destination, table->view());
+ *  cudf::io::write_arrow_ipc(options);
+ * @endcode
+ *
+ * @throws cudf::logic_error if a column type or the compression type is not supported
+ *
+ * @param options Settings for controlling writing behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void write_arrow_ipc(arrow_ipc_writer_options const& options,
+                     rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+class chunked_arrow_ipc_writer_options_builder;
+
+/**
+ * @brief Settings to use for `arrow_ipc_chunked_writer`.
+ */
+class chunked_arrow_ipc_writer_options {
+  // Specify the sink to use for writer output
+  sink_info _sink;
+  // Optional associated metadata
+  std::optional<table_input_metadata> _metadata;
+  // Compression of the record batch buffers: NONE, LZ4 (LZ4_FRAME) or ZSTD
+  compression_type _compression = compression_type::NONE;
+
+  /**
+   * @brief Constructor from sink.
+   *
+   * @param sink The sink used for writer output
+   */
+  explicit chunked_arrow_ipc_writer_options(sink_info const& sink) : _sink(sink) {}
+
+  friend chunked_arrow_ipc_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_arrow_ipc_writer_options() = default;
+
+  /**
+   * @brief Create builder to create `chunked_arrow_ipc_writer_options`.
+   *
+   * @param sink The sink used for writer output
+   *
+   * @return Builder to build chunked_arrow_ipc_writer_options
+   */
+  static chunked_arrow_ipc_writer_options_builder builder(sink_info const& sink);
+
+  /**
+   * @brief Returns sink info.
+   *
+   * @return Sink info
+   */
+  [[nodiscard]] sink_info const& get_sink() const { return _sink; }
+
+  /**
+   * @brief Returns associated metadata.
+   *
+   * @return Optional associated metadata
+   */
+  [[nodiscard]] auto const& get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns compression type.
+   *
+   * @return Compression type
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata
+   */
+  void set_metadata(table_input_metadata metadata) { _metadata = std::move(metadata); }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param comp Compression type: `NONE`, `LZ4` or `ZSTD`
+   */
+  void set_compression(compression_type comp) { _compression = comp; }
+};
+
+/**
+ * @brief Builds settings to use for `arrow_ipc_chunked_writer`.
+ */
+class chunked_arrow_ipc_writer_options_builder {
+  chunked_arrow_ipc_writer_options options;  ///< Options to be built.
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  chunked_arrow_ipc_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from sink.
+   *
+   * @param sink The sink used for writer output
+   */
+  explicit chunked_arrow_ipc_writer_options_builder(sink_info const& sink) : options{sink} {}
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata
+   * @return this for chaining
+   */
+  chunked_arrow_ipc_writer_options_builder& metadata(table_input_metadata metadata)
+  {
+    options._metadata = std::move(metadata);
+    return *this;
+  }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param comp Compression type: `NONE`, `LZ4` or `ZSTD`
+   * @return this for chaining
+   */
+  chunked_arrow_ipc_writer_options_builder& compression(compression_type comp)
+  {
+    options._compression = comp;
+    return *this;
+  }
+
+  /**
+   * @brief move chunked_arrow_ipc_writer_options member once it's built.
+   */
+  operator chunked_arrow_ipc_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move chunked_arrow_ipc_writer_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `chunked_arrow_ipc_writer_options` object's r-value reference
+   */
+  chunked_arrow_ipc_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Chunked Arrow IPC writer class writes an Arrow IPC stream in a chunked/stream form.
+ *
+ * The schema is written with the first table and each table is written as one record batch.
+ * All tables must have the same column types.
+ *
+ * The intent of the arrow_ipc_chunked_writer is to allow writing of an arbitrarily large /
+ * arbitrary number of rows to an Arrow IPC stream in multiple passes.
+ *
+ * The following code snippet demonstrates how to write a stream in two batches:
+ * @code
+ *  auto destination = cudf::io::sink_info("dataset.arrows");
+ *  auto options     = cudf::io::chunked_arrow_ipc_writer_options::builder(destination);
+ *  auto writer      = cudf::io::arrow_ipc_chunked_writer(options);
+ *  writer.write(table0).write(table1);
+ *  writer.close();
+ * @endcode
+ */
+class arrow_ipc_chunked_writer {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *        This is added just to satisfy cython.
+   */
+  arrow_ipc_chunked_writer();
+
+  /**
+   * @brief Constructor with chunked writer options
+   *
+   * @param[in] options options used to write the stream
+   * @param[in] stream CUDA stream used for device memory operations and kernel launches
+   */
+  arrow_ipc_chunked_writer(chunked_arrow_ipc_writer_options const& options,
+                           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Default destructor. This is added to not leak detail API
+   */
+  ~arrow_ipc_chunked_writer();
+
+  /**
+   * @brief Writes a table as the next record batch of the stream.
+   *
+   * @throws cudf::logic_error if the column types differ from the previously written tables
+   *
+   * @param[in] table Table that needs to be written
+   * @return returns reference of the class object
+   */
+  arrow_ipc_chunked_writer& write(table_view const& table);
+
+  /**
+   * @brief Finishes the chunked/streamed write process by writing the end-of-stream marker.
+   */
+  void close();
+
+  /// Unique pointer to impl writer class
+  std::unique_ptr<cudf::io::detail::arrow_ipc::writer> writer;
+};
+
+/** @} */  // end of group
+}  // namespace io
+}  // namespace cudf
@@ -20,7 +20,9 @@
 
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -30,6 +32,13 @@
 
 namespace cudf {
 namespace io {
+
+namespace detail::avro {
+/**
+ * @brief Forward declaration of the internal chunked reader class
+ */
+class chunked_reader;
+}  // namespace detail::avro
 /**
  * @addtogroup io_readers
  * @{
@@ -219,6 +228,74 @@ table_with_metadata read_avro(
   avro_reader_options const& options,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked Avro reader class to read an Avro dataset iteratively in a series of tables,
+ * chunk by chunk.
+ *
+ * Each chunk contains the rows of one or more whole files of the dataset, so a dataset of many
+ * files can be read with bounded memory use.
+ */
+class chunked_avro_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_avro_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `avro_reader_options` parameter as in
+   * `cudf::read_avro()`, and an additional parameter to specify the maximum number of input bytes
+   * to read per chunk. A file larger than the limit is read in a chunk of its own.
+   *
+   * @param chunk_read_limit Limit on the number of input bytes read per chunk, or `0` if there is
+   * no limit
+   * @param options The options used to read the Avro input
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_avro_reader(
+    std::size_t chunk_read_limit,
+    avro_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_avro_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given input.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains all the selected
+   * rows of the input in order. A chunk whose files only contain skipped rows has no rows.
+   *
+   * An empty table will be returned if all the data in the input has been read and returned by
+   * the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::avro::chunked_reader> reader;
+};
+
 /** @} */  // end of group
 }  // namespace io
 }  // namespace cudf
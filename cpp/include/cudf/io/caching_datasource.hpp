@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "datasource.hpp"
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstddef>
+#include <memory>
+
+namespace cudf::io {
+/**
+ * @addtogroup io_datasources
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Options to configure a `caching_datasource`
+ */
+struct datasource_cache_options {
+  /// Bytes of pinned host memory to cache
+  std::size_t host_capacity{std::size_t{1} << 30};
+  /// Bytes of device memory to cache; zero disables promotion to the device
+  std::size_t device_capacity{0};
+  /// Host cache hits after which a range is copied to the device cache
+  std::size_t promotion_hits{2};
+};
+
+/**
+ * @brief Hit and miss counters of a `caching_datasource`
+ */
+struct datasource_cache_statistics {
+  std::size_t host_hits{0};     ///< Reads served from the host cache
+  std::size_t device_hits{0};   ///< Reads served from the device cache
+  std::size_t misses{0};        ///< Reads forwarded to the wrapped source
+  std::size_t host_bytes{0};    ///< Bytes currently held in the host cache
+  std::size_t device_bytes{0};  ///< Bytes currently held in the device cache
+};
+
+/**
+ * @brief Datasource decorator that caches the byte ranges read from another source.
+ *
+ * Every range read from the wrapped source is kept in pinned host memory, allocated from
+ * `cudf::io::get_host_memory_resource()`, and evicted in least recently used order once
+ * `host_capacity` bytes are cached. A later read that falls within a cached range is served from
+ * memory, so repeated scans of the same column chunks skip the storage read. With a non-zero
+ * `device_capacity`, ranges that are hit `promotion_hits` times are also copied to device memory
+ * and device reads of them return views of the cached data.
+ *
+ * The cached data is the raw (typically compressed) bytes of the source. The object can be shared
+ * by several readers and accessed concurrently, and must outlive the buffers it returned.
+ */
+class caching_datasource : public datasource {
+ public:
+  /**
+   * @brief Wrap a datasource with a cache
+   *
+   * @param source The source to read from
+   * @param options Capacities and promotion policy of the cache
+   */
+  caching_datasource(std::unique_ptr<datasource> source, datasource_cache_options options = {});
+
+  ~caching_datasource() override;
+
+  /**
+   * @copydoc cudf::io::datasource::host_read(size_t, size_t)
+   */
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  /**
+   * @copydoc cudf::io::datasource::host_read(size_t, size_t, uint8_t*)
+   */
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  /**
+   * @brief Device reads are always supported; uncached ranges are copied from the host cache
+   *
+   * @return True
+   */
+  [[nodiscard]] bool supports_device_read() const override { return true; }
+
+  /**
+   * @copydoc cudf::io::datasource::is_device_read_preferred
+   */
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override;
+
+  /**
+   * @copydoc cudf::io::datasource::device_read(size_t, size_t, rmm::cuda_stream_view)
+   */
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  /**
+   * @copydoc cudf::io::datasource::device_read(size_t, size_t, uint8_t*, rmm::cuda_stream_view)
+   */
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  /**
+   * @copydoc cudf::io::datasource::device_read_async
+   */
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
+  /**
+   * @copydoc cudf::io::datasource::size
+   */
+  [[nodiscard]] size_t size() const override;
+
+  /**
+   * @brief Returns the hit and miss counters of the cache
+   *
+   * @return The cache statistics
+   */
+  [[nodiscard]] datasource_cache_statistics statistics() const;
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/** @} */  // end of group
+}  // namespace cudf::io
@@ -16,15 +16,20 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <variant>
@@ -33,6 +38,13 @@
 namespace cudf {
 namespace io {
 
+namespace detail::csv {
+/**
+ * @brief Forward declaration of the internal chunked reader class
+ */
+class chunked_reader;
+}  // namespace detail::csv
+
 /**
  * @addtogroup io_readers
  * @{
@@ -80,6 +92,8 @@ class csv_reader_options {
   size_type _skipfooter = 0;
   // Header row index
   size_type _header = 0;
+  // Predicate filter as AST to filter output rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
 
   // Parsing settings
 
@@ -294,6 +308,13 @@ class csv_reader_options {
    */
   [[nodiscard]] size_type get_header() const { return _header; }
 
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Returns line terminator.
    *
@@ -618,6 +639,21 @@ class csv_reader_options {
    */
   void set_header(size_type hdr) { _header = hdr; }
 
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Only the rows for which the filter evaluates to true are returned. The columns referenced by
+   * the filter are parsed first, and the other columns are only parsed for the matching rows.
+   *
+   * The filter refers to the output columns, by their index with cudf::ast::column_reference or
+   * by their name with cudf::ast::column_name_reference. For example, with
+   * `use_cols_names({"A", "C"})`, `column_reference{1}` and `column_name_reference{"C"}` both refer
+   * to column "C". Columns that are not read cannot be referenced.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Sets line terminator
    *
@@ -1004,6 +1040,17 @@ class csv_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc csv_reader_options::set_filter
+   *
+   * @return this for chaining
+   */
+  csv_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Sets line terminator.
    *
@@ -1354,6 +1401,134 @@ table_with_metadata read_csv(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked CSV reader class to read a CSV dataset iteratively in a series of tables,
+ * chunk by chunk.
+ *
+ * The input is split into byte ranges at row boundaries outside of quoted fields, so rows that
+ * straddle the end of a chunk are read in the chunk they start in. The column types inferred from
+ * a chunk are used for the later chunks, which skip the type inference of those columns and
+ * return the same types.
+ */
+class chunked_csv_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_csv_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `csv_reader_options` parameter as in
+   * `cudf::read_csv()`, and an additional parameter to specify the maximum number of input bytes
+   * to parse per chunk. The byte range options are not supported.
+   *
+   * @throw cudf::logic_error if the input is compressed, there is more than one source, a byte
+   * range is set, or columns are selected while the column names are read from the header
+   *
+   * @param chunk_read_limit Limit on the number of input bytes parsed per read, or `0` if there is
+   * no limit
+   * @param options The options used to read the CSV input
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_csv_reader(
+    std::size_t chunk_read_limit,
+    csv_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_csv_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of rows in the given input.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains all the rows of the
+   * input in order.
+   *
+   * An empty table will be returned if the given input is empty, or all the data in the input has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::detail::csv::chunked_reader> reader;
+};
+
+/**
+ * @brief Splits a CSV dataset into byte ranges of similar size that can be read independently.
+ *
+ * The split points are row terminators outside of quoted fields. The quote state at each split
+ * point is found by counting the quotes of the input sections in parallel host threads, so the
+ * ranges are correct even if quoted fields contain row terminators. Every range after the first
+ * starts at the row terminator that ends the previous row and every row belongs to exactly one
+ * range. Fewer than `num_ranges` ranges are returned when the input does not contain enough rows.
+ *
+ * @throw cudf::logic_error if the input is compressed, there is more than one source, or
+ * `num_ranges` is zero
+ *
+ * @param options Settings for reading the dataset; the byte range options are ignored
+ * @param num_ranges Maximum number of byte ranges
+ *
+ * @return Byte ranges that cover the whole input
+ */
+std::vector<text::byte_range_info> plan_csv_byte_ranges(csv_reader_options const& options,
+                                                        std::size_t num_ranges);
+
+/**
+ * @brief Reads byte ranges of a CSV dataset concurrently, with the same column types in all
+ * ranges.
+ *
+ * The ranges, e.g. from `plan_csv_byte_ranges`, are distributed over one host thread per stream
+ * and each thread reads its ranges on its stream. If the header is read from the data, the first
+ * range is read first to get the column names for the other ranges. The column types inferred
+ * for the ranges are merged; mixed numeric types are merged to FLOAT64 and any other mix to
+ * STRING. The ranges whose types differ from the merged types are read again with them.
+ *
+ * The following code snippet reads a dataset in eight ranges on four streams:
+ * @code
+ *  auto options = cudf::io::csv_reader_options::builder(source).build();
+ *  auto ranges  = cudf::io::plan_csv_byte_ranges(options, 8);
+ *  auto streams = cudf::detail::fork_streams(cudf::get_default_stream(), 4);
+ *  auto parts   = cudf::io::read_csv_byte_ranges(options, ranges, streams);
+ * @endcode
+ *
+ * @throw cudf::logic_error if `streams` is empty, or if columns are selected while the column
+ * names are read from the header
+ *
+ * @param options Settings for reading the dataset; the byte range options are ignored
+ * @param ranges Byte ranges to read
+ * @param streams CUDA streams used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate device memory of the tables in the returned
+ * table_with_metadata
+ *
+ * @return A table with metadata for each byte range, in the order of the ranges
+ */
+std::vector<table_with_metadata> read_csv_byte_ranges(
+  csv_reader_options const& options,
+  host_span<text::byte_range_info const> ranges,
+  host_span<rmm::cuda_stream_view const> streams,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 /**
  * @addtogroup io_writers
@@ -85,6 +85,9 @@ class datasource {
   /**
    * @brief Creates a source from a file path.
    *
+   * Paths starting with `http://` are read from the remote server with parallel HTTP range
+   * requests and readahead; `offset` and `size` are ignored for them.
+   *
    * @param[in] filepath Path to the file to use
    * @param[in] offset Bytes from the start of the file (the default is zero)
    * @param[in] size Bytes from the offset; use zero for entire file (the default is zero)
@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/arrow_ipc.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+
+/**
+ * @brief Reads an entire Arrow IPC stream.
+ *
+ * @param source Input `datasource` object to read the stream from
+ * @param options Settings for controlling reading behavior
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return The set of columns along with table metadata
+ */
+table_with_metadata read_arrow_ipc(std::unique_ptr<cudf::io::datasource>&& source,
+                                   arrow_ipc_reader_options const& options,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr);
+
+/**
+ * @brief The reader class that supports iterative reading of an Arrow IPC stream.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from a body size limit and a data source with reader options.
+   *
+   * The message headers of the whole stream are read on construction. Each call to
+   * `read_chunk()` decodes consecutive whole record batches whose total body size is at most
+   * `chunk_read_limit` bytes, or a single record batch if it is larger than the limit.
+   *
+   * @param chunk_read_limit Limit on the number of body bytes read per chunk, or `0` if there is
+   * no limit
+   * @param source Input `datasource` object to read the stream from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::unique_ptr<cudf::io::datasource>&& source,
+                          arrow_ipc_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~chunked_reader();
+
+  /**
+   * @copydoc cudf::io::chunked_arrow_ipc_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_arrow_ipc_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/**
+ * @brief The writer class that writes tables as the record batches of an Arrow IPC stream.
+ */
+class writer {
+ public:
+  /**
+   * @brief Constructor for writing a single table.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  explicit writer(std::unique_ptr<cudf::io::data_sink> sink,
+                  arrow_ipc_writer_options const& options,
+                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Constructor with chunked writer options.
+   *
+   * @param sink The data sink to write the data to
+   * @param options Settings for controlling writing behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  explicit writer(std::unique_ptr<cudf::io::data_sink> sink,
+                  chunked_arrow_ipc_writer_options const& options,
+                  rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Destructor explicitly declared to avoid inlining in header
+   */
+  ~writer();
+
+  /**
+   * @brief Writes a table as one record batch, preceded by the schema for the first table.
+   *
+   * @param table The table to be written
+   */
+  void write(table_view const& table);
+
+  /**
+   * @brief Writes the end-of-stream marker and flushes the sink.
+   */
+  void close();
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
@@ -22,6 +22,10 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -30,18 +34,68 @@ namespace avro {
 /**
  * @brief Reads the entire dataset.
  *
- * @param source Input `datasource` object to read the dataset from
+ * The rows of the sources are returned in order, and all sources must have the same columns.
+ * Files after the last row to read are not opened.
+ *
+ * @param sources Input `datasource` objects to read the dataset from
  * @param options Settings for controlling reading behavior
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource to use for device memory allocation
  *
  * @return The set of columns along with table metadata
  */
-table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
+table_with_metadata read_avro(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
                               avro_reader_options const& options,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @brief The reader class that supports iterative reading of an Avro dataset.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from an input size limit and data sources with reader options.
+   *
+   * Each call to `read_chunk()` reads consecutive whole files whose total size is at most
+   * `chunk_read_limit` bytes, or a single file if it is larger than the limit, so the host and
+   * device memory used scales with the chunk instead of the whole dataset.
+   *
+   * @param chunk_read_limit Limit on the number of input bytes read per chunk, or `0` if there is
+   * no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                          avro_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @copydoc cudf::io::chunked_avro_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_avro_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  std::size_t _chunk_read_limit;
+  std::vector<std::unique_ptr<cudf::io::datasource>> _sources;
+  std::vector<std::string> _columns;
+  std::size_t _next_source = 0;
+  // Rows left to skip and to read; a negative number of rows reads all remaining rows
+  size_type _skip_rows;
+  size_type _num_rows;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -17,10 +17,18 @@
 #pragma once
 
 #include <cudf/io/csv.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace io {
 namespace detail {
@@ -41,6 +49,81 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
                              rmm::cuda_stream_view stream,
                              rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Splits the data into byte ranges of similar size that start at quote-aware row
+ * boundaries.
+ *
+ * @param source Uncompressed input `datasource` object
+ * @param options Settings for reading the dataset, used for the row terminator and quoting
+ * @param num_ranges Maximum number of byte ranges
+ *
+ * @return Byte ranges that cover the whole input
+ */
+std::vector<text::byte_range_info> plan_byte_ranges(cudf::io::datasource& source,
+                                                    csv_reader_options const& options,
+                                                    std::size_t num_ranges);
+
+/**
+ * @brief Merges the column types inferred when reading separate byte ranges of the same data.
+ *
+ * Columns that are null in a range do not contribute to its type. Mixed numeric types are merged
+ * to FLOAT64 and any other mix of types is merged to STRING.
+ *
+ * @param tables Tables read from the byte ranges
+ *
+ * @return Merged type of each column
+ */
+std::vector<data_type> merge_dtypes(host_span<table_with_metadata const> tables);
+
+/**
+ * @brief The reader class that supports iterative reading of a CSV dataset.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from an input size limit and a data source with reader options.
+   *
+   * The input is split into byte ranges of at most about `chunk_read_limit` bytes that start at
+   * quote-aware row boundaries. Each call to `read_chunk()` parses one range, so the device memory
+   * used for the input and its row offsets scales with the range instead of the whole input.
+   *
+   * @param chunk_read_limit Limit on the number of input bytes parsed per chunk, or `0` if there is
+   * no limit
+   * @param source Uncompressed input `datasource` object to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::unique_ptr<cudf::io::datasource>&& source,
+                          csv_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_csv_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  std::unique_ptr<cudf::io::datasource> _source;
+  csv_reader_options _options;
+  // Options for the chunks after the first one, which do not contain the header
+  csv_reader_options _later_options;
+  std::vector<text::byte_range_info> _ranges;
+  std::size_t _next_range = 0;
+  // Column types given in the options or inferred from the chunks read so far; unset if the
+  // types are given by column index
+  std::optional<std::map<std::string, data_type>> _dtypes;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
 /**
  * @brief Write an entire dataset to CSV format.
  *
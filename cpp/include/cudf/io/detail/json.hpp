@@ -18,10 +18,17 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/json.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <map>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace cudf::io::json::detail {
 
 /**
@@ -39,6 +46,73 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
                               rmm::cuda_stream_view stream,
                               rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Splits JSON Lines data into byte ranges of similar size that start at record boundaries.
+ *
+ * @param sources Uncompressed input `datasource` objects
+ * @param num_ranges Maximum number of byte ranges
+ *
+ * @return Byte ranges that cover the whole input
+ */
+std::vector<text::byte_range_info> plan_byte_ranges(host_span<std::unique_ptr<datasource>> sources,
+                                                    size_t num_ranges);
+
+/**
+ * @copydoc cudf::io::extract_json_schema
+ */
+std::map<std::string, schema_element> extract_schema(table_with_metadata const& table);
+
+/**
+ * @copydoc cudf::io::merge_json_schemas
+ */
+std::map<std::string, schema_element> merge_schemas(host_span<table_with_metadata const> tables);
+
+/**
+ * @brief The reader class that supports iterative reading of a JSON Lines dataset.
+ */
+class chunked_reader {
+ public:
+  /**
+   * @brief Constructor from an input size limit and an array of data sources with reader options.
+   *
+   * The input is split into byte ranges of at most about `chunk_read_limit` bytes that start at
+   * record boundaries. Each call to `read_chunk()` parses one range, so the memory used by the
+   * token stream and the tree scales with the range instead of the whole input.
+   *
+   * @param chunk_read_limit Limit on the number of input bytes parsed per chunk, or `0` if there is
+   * no limit
+   * @param sources Input `datasource` objects to read the dataset from
+   * @param options Settings for controlling reading behavior
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  explicit chunked_reader(std::size_t chunk_read_limit,
+                          std::vector<std::unique_ptr<datasource>>&& sources,
+                          json_reader_options const& options,
+                          rmm::cuda_stream_view stream,
+                          rmm::device_async_resource_ref mr);
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::has_next
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @copydoc cudf::io::chunked_json_reader::read_chunk
+   */
+  [[nodiscard]] table_with_metadata read_chunk();
+
+ private:
+  std::vector<std::unique_ptr<datasource>> _sources;
+  json_reader_options _options;
+  std::vector<text::byte_range_info> _ranges;
+  std::size_t _next_range = 0;
+  // Column types inferred from the chunks read so far; unset if the types are given in `_options`
+  std::optional<std::map<std::string, schema_element>> _schema;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
 /**
  * @brief Write an entire dataset to JSON format.
  *
@@ -18,19 +18,29 @@
 
 #include "types.hpp"
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <functional>
 #include <map>
+#include <memory>
+#include <optional>
 #include <string>
 #include <variant>
 #include <vector>
 
 namespace cudf {
 namespace io {
+namespace json::detail {
+class chunked_reader;
+}  // namespace json::detail
+
 /**
  * @addtogroup io_readers
  * @{
@@ -105,6 +115,10 @@ class json_reader_options {
   char _delimiter = '\n';
   // Prune columns on read, selected based on the _dtypes option
   bool _prune_columns = false;
+  // Names of the column paths to read; read all columns if not set
+  std::optional<std::vector<std::string>> _columns;
+  // Predicate filter as AST to filter output rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
 
   // Bytes to skip from the start
   size_t _byte_range_offset = 0;
@@ -263,6 +277,20 @@ class json_reader_options {
    */
   bool is_enabled_prune_columns() const { return _prune_columns; }
 
+  /**
+   * @brief Returns names of the column paths to be read, if set.
+   *
+   * @return Names of the column paths; `nullopt` if all columns are read
+   */
+  [[nodiscard]] auto const& get_columns() const { return _columns; }
+
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
   /**
    * @brief Whether to parse dates as DD/MM versus MM/DD.
    *
@@ -331,14 +359,14 @@ class json_reader_options {
    *
    * @param offset Number of bytes of offset
    */
-  void set_byte_range_offset(size_type offset) { _byte_range_offset = offset; }
+  void set_byte_range_offset(size_t offset) { _byte_range_offset = offset; }
 
   /**
    * @brief Set number of bytes to read.
    *
    * @param size Number of bytes to read
    */
-  void set_byte_range_size(size_type size) { _byte_range_size = size; }
+  void set_byte_range_size(size_t size) { _byte_range_size = size; }
 
   /**
    * @brief Set delimiter separating records in JSON lines
@@ -390,6 +418,33 @@ class json_reader_options {
    */
   void enable_prune_columns(bool val) { _prune_columns = val; }
 
+  /**
+   * @brief Sets the names of the column paths to be read.
+   *
+   * Nested struct fields are selected with `.` separated paths, e.g. `"a.b"`; list levels are
+   * traversed implicitly. Selecting a column selects all of its children. Columns that are not
+   * selected are pruned before the output columns are built, and the types of the selected
+   * columns are still inferred unless set with @ref set_dtypes. When set, this selection takes
+   * precedence over @ref enable_prune_columns.
+   *
+   * @param col_names Vector of column paths
+   */
+  void set_columns(std::vector<std::string> col_names) { _columns = std::move(col_names); }
+
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Only the rows for which the filter evaluates to true are returned. The filter is evaluated
+   * by the reader on the parsed columns, and the rows that fail it are dropped before the output
+   * table is allocated with the caller's memory resource.
+   *
+   * The filter refers to the top-level output columns, by their index with
+   * cudf::ast::column_reference or by their name with cudf::ast::column_name_reference.
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -504,7 +559,7 @@ class json_reader_options_builder {
    * @param offset Number of bytes of offset
    * @return this for chaining
    */
-  json_reader_options_builder& byte_range_offset(size_type offset)
+  json_reader_options_builder& byte_range_offset(size_t offset)
   {
     options._byte_range_offset = offset;
     return *this;
@@ -516,7 +571,7 @@ class json_reader_options_builder {
    * @param size Number of bytes to read
    * @return this for chaining
    */
-  json_reader_options_builder& byte_range_size(size_type size)
+  json_reader_options_builder& byte_range_size(size_t size)
   {
     options._byte_range_size = size;
     return *this;
@@ -575,6 +630,29 @@ class json_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the names of the column paths to be read.
+   *
+   * @param col_names Vector of column paths; see @ref json_reader_options::set_columns
+   * @return this for chaining
+   */
+  json_reader_options_builder& columns(std::vector<std::string> col_names)
+  {
+    options.set_columns(std::move(col_names));
+    return *this;
+  }
+
+  /**
+   * @copydoc json_reader_options::set_filter
+   *
+   * @return this for chaining
+   */
+  json_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
   /**
    * @brief Set whether to parse dates as DD/MM versus MM/DD.
    *
@@ -675,6 +753,151 @@ table_with_metadata read_json(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief The chunked JSON Lines reader class to read a dataset iteratively in a series of tables,
+ * chunk by chunk.
+ *
+ * This class is designed to read JSON Lines inputs that are too large to be parsed at once. The
+ * input is split into byte ranges that start at record boundaries, and each chunk is parsed
+ * separately, so the peak memory use is proportional to the size of the chunk rather than the
+ * size of the input.
+ *
+ * Unless the column types are specified in the options, the types inferred from the chunks read
+ * so far are used to read the following chunks, so the columns of all chunks have the same types
+ * as long as the first chunk that contains a non-null value of a column also has its final type.
+ */
+class chunked_json_reader {
+ public:
+  /**
+   * @brief Default constructor, this should never be used.
+   *
+   * This is added just to satisfy cython.
+   */
+  chunked_json_reader() = default;
+
+  /**
+   * @brief Constructor for chunked reader.
+   *
+   * This constructor requires the same `json_reader_options` parameter as in
+   * `cudf::read_json()`, and an additional parameter to specify the maximum number of input bytes
+   * to parse per chunk. The byte range options are not supported.
+   *
+   * @throw cudf::logic_error if the options do not enable JSON Lines, the input is compressed, or
+   * a byte range is set
+   *
+   * @param chunk_read_limit Limit on the number of input bytes parsed per read, or `0` if there is
+   * no limit
+   * @param options The options used to read the JSON Lines input
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource to use for device memory allocation
+   */
+  chunked_json_reader(
+    std::size_t chunk_read_limit,
+    json_reader_options const& options,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal reader instance.
+   *
+   * Since the declaration of the internal `reader` object does not exist in this header, this
+   * destructor needs to be defined in a separate source file which can access to that object's
+   * declaration.
+   */
+  ~chunked_json_reader();
+
+  /**
+   * @brief Check if there is any data in the given input that has not yet been read.
+   *
+   * @return A boolean value indicating if there is any data left to read
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Read a chunk of records in the given input.
+   *
+   * The sequence of returned tables, if concatenated by their order, contains all the records of
+   * the input in order.
+   *
+   * An empty table will be returned if the given input is empty, or all the data in the input has
+   * been read and returned by the previous calls.
+   *
+   * @return An output `cudf::table` along with its metadata
+   */
+  [[nodiscard]] table_with_metadata read_chunk() const;
+
+ private:
+  std::unique_ptr<cudf::io::json::detail::chunked_reader> reader;
+};
+
+/**
+ * @brief Splits a JSON Lines dataset into byte ranges of similar size that can be read
+ * independently.
+ *
+ * Every range after the first starts at a line delimiter, so each range is read with a single
+ * extra read past its end and every record belongs to exactly one range. The ranges are passed to
+ * `read_json` through the byte range options, for example by different GPUs or processes. Fewer
+ * than `num_ranges` ranges are returned when the input does not contain enough records.
+ *
+ * The following code snippet reads the ranges with a common schema:
+ * @code
+ *  auto options = cudf::io::json_reader_options::builder(source).lines(true).build();
+ *  std::vector<cudf::io::table_with_metadata> parts;
+ *  for (auto range : cudf::io::plan_json_byte_ranges(options, num_ranges)) {
+ *    options.set_byte_range_offset(range.offset());
+ *    options.set_byte_range_size(range.size());
+ *    parts.push_back(cudf::io::read_json(options));
+ *  }
+ *  options.set_dtypes(cudf::io::merge_json_schemas(parts));
+ *  // read the ranges again, or cast the parts, to get matching column types
+ * @endcode
+ *
+ * @throw cudf::logic_error if the options do not enable JSON Lines, the input is compressed, or
+ * `num_ranges` is zero
+ *
+ * @param options Settings for reading the dataset; the byte range options are ignored
+ * @param num_ranges Maximum number of byte ranges
+ *
+ * @return Byte ranges that cover the whole input
+ */
+std::vector<text::byte_range_info> plan_json_byte_ranges(json_reader_options const& options,
+                                                         size_t num_ranges);
+
+/**
+ * @brief Extracts the column types of a table read from JSON, to reuse them for later reads.
+ *
+ * Reads of data with the same shape can pass the returned schema to
+ * `json_reader_options::set_dtypes` to skip the type inference of the columns, and enable
+ * `json_reader_options::enable_prune_columns` to also drop the fields that are not part of the
+ * schema early. Unlike `merge_json_schemas`, the columns keep the exact type they were read with,
+ * including the columns with only null values.
+ *
+ * @throw cudf::logic_error if the metadata of the table does not match its columns
+ *
+ * @param table Table read from JSON, including the column names
+ *
+ * @return Column types to pass to `json_reader_options::set_dtypes`
+ */
+std::map<std::string, schema_element> extract_json_schema(table_with_metadata const& table);
+
+/**
+ * @brief Merges the column types inferred when reading parts of the same JSON dataset.
+ *
+ * Columns are matched by name, recursively for the children of struct and list columns. Columns
+ * with only null values in a part do not affect the merged type. Different numeric types are
+ * merged into `FLOAT64`, any other different types are merged into `STRING`; reading a nested
+ * value as a string requires the `mixed_types_as_string` option. Columns that are null in all
+ * parts are typed as `STRING`.
+ *
+ * @throw cudf::logic_error if the metadata of a table does not match its columns
+ *
+ * @param tables Tables read from the parts of the dataset, including the column names
+ *
+ * @return Column types to pass to `json_reader_options::set_dtypes`
+ */
+std::map<std::string, schema_element> merge_json_schemas(
+  host_span<table_with_metadata const> tables);
+
 /** @} */  // end of group
 
 /**
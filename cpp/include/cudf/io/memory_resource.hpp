@@ -18,6 +18,7 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <optional>
 
 namespace cudf::io {
@@ -62,4 +63,62 @@ struct host_mr_options {
  */
 bool config_default_host_memory_resource(host_mr_options const& opts);
 
+/**
+ * @brief Options to configure the pinned staging arenas
+ */
+struct pinned_staging_options {
+  std::size_t num_arenas{16};  ///< Number of arenas. Threads are assigned to arenas round-robin.
+  std::size_t arena_size{std::size_t{4} * 1024 * 1024};  ///< Size of each arena in bytes
+  std::size_t large_allocation_threshold{std::size_t{1} * 1024 * 1024};  ///< Allocations of at
+                                                                         ///< least this size use
+                                                                         ///< the large buffer pool
+  std::size_t large_pool_size{std::size_t{256} * 1024 * 1024};  ///< Maximum number of bytes the
+                                                                ///< large buffer pool keeps cached
+};
+
+/**
+ * @brief Statistics of the pinned staging allocations made by the calling thread
+ *
+ * Multi-file readers typically run one reader per thread, so these are per-reader counters.
+ */
+struct pinned_staging_statistics {
+  std::size_t num_allocations{0};   ///< Number of allocations made by the thread
+  std::size_t arena_bytes{0};       ///< Bytes served from the thread's arena
+  std::size_t large_pool_bytes{0};  ///< Bytes served from cached blocks of the large buffer pool
+  std::size_t upstream_bytes{0};    ///< Bytes allocated directly from the upstream resource
+};
+
+/**
+ * @brief Layer per-thread pinned staging arenas over the current host memory resource.
+ *
+ * Installs a resource, as if by `set_host_memory_resource`, that serves host allocations of
+ * cudf::detail::hostdevice_vector from per-thread arenas carved out of the current host memory
+ * resource. Small allocations are bump-allocated from the calling thread's arena without touching
+ * the shared pool, and only fall back to the current resource when the arena is full. Allocations
+ * of at least `large_allocation_threshold` bytes are rounded up to a size class and served from a
+ * separate pool that caches freed blocks, evicting the least recently used size classes once
+ * `large_pool_size` bytes are cached.
+ *
+ * Memory handed back to the arenas is reused without stream ordering, like the default pinned
+ * pool, so host buffers must not be released while copies from them are still pending.
+ *
+ * @throws cudf::logic_error if `num_arenas` or `arena_size` is zero
+ *
+ * @param opts Options to configure the staging arenas
+ * @return True if this call installed the staging arenas, false if they were already installed
+ */
+bool config_pinned_staging_arenas(pinned_staging_options const& opts);
+
+/**
+ * @brief Get the pinned staging statistics of the calling thread
+ *
+ * @return The statistics accumulated by the calling thread since the last reset
+ */
+pinned_staging_statistics get_pinned_staging_statistics();
+
+/**
+ * @brief Reset the pinned staging statistics of the calling thread
+ */
+void reset_pinned_staging_statistics();
+
 }  // namespace cudf::io
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/detail/orc.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/table/table_view.hpp>
@@ -74,6 +75,18 @@ class orc_reader_options {
   // Columns that should be read as Decimal128
   std::vector<std::string> _decimal128_columns;
 
+  // Top-level string columns that should be read as DICTIONARY32
+  std::vector<std::string> _dictionary_columns;
+
+  // Predicate filter as AST to filter output rows
+  std::optional<std::reference_wrapper<ast::expression const>> _filter;
+
+  // Whether the chunked reader loads the next stripes while decoding the current ones
+  bool _prefetch_next_stripes = false;
+
+  // Statistics of the read, filled in by the reader
+  std::shared_ptr<reader_statistics> _statistics;
+
   friend orc_reader_options_builder;
 
   /**
@@ -163,6 +176,37 @@ class orc_reader_options {
    */
   std::vector<std::string> const& get_decimal128_columns() const { return _decimal128_columns; }
 
+  /**
+   * @brief Returns names of top-level string columns that should be read as dictionary columns.
+   *
+   * @return Names of string columns that should be read as DICTIONARY32
+   */
+  [[nodiscard]] std::vector<std::string> const& get_dictionary_columns() const
+  {
+    return _dictionary_columns;
+  }
+
+  /**
+   * @brief Returns AST based filter for predicate pushdown.
+   *
+   * @return AST expression to use as filter
+   */
+  [[nodiscard]] auto const& get_filter() const { return _filter; }
+
+  /**
+   * @brief Returns true/false depending whether the chunked reader prefetches the next stripes.
+   *
+   * @return `true` if the next stripes are loaded while the current ones are decoded
+   */
+  [[nodiscard]] bool is_enabled_prefetch_next_stripes() const { return _prefetch_next_stripes; }
+
+  /**
+   * @brief Returns a shared pointer to the user-provided reader statistics.
+   *
+   * @return Reader statistics
+   */
+  [[nodiscard]] std::shared_ptr<reader_statistics> get_statistics() const { return _statistics; }
+
   // Setters
 
   /**
@@ -250,6 +294,65 @@ class orc_reader_options {
   {
     _decimal128_columns = std::move(val);
   }
+
+  /**
+   * @brief Set top-level string columns that should be read as dictionary columns.
+   *
+   * The listed columns are output as DICTIONARY32 columns with sorted keys. The dictionaries of
+   * the decoded stripes are merged on the device, without materializing the string of each row.
+   * Names that do not refer to a top-level string column are ignored.
+   *
+   * @param val Vector of column names
+   */
+  void set_dictionary_columns(std::vector<std::string> val)
+  {
+    _dictionary_columns = std::move(val);
+  }
+
+  /**
+   * @brief Sets AST based filter for predicate pushdown.
+   *
+   * Stripes whose statistics show that no row can satisfy the filter are not read, and the rows
+   * of the read stripes are filtered. Equality comparisons with a literal are also checked
+   * against the Bloom filters of the stripes, when the file contains them. The filter refers to
+   * the output columns by index, using cudf::ast::column_reference.
+   *
+   * For an ORC file with columns ["A", "B", "C"]:
+   * @code
+   * columns({"C", "A"})
+   * .filter(operation(ast_operator::LESS, column_reference{1}, literal{100}));
+   * @endcode
+   * Here, `1` will refer to column "A" because output will contain 2 columns in
+   * order ["C", "A"].
+   *
+   * @param filter AST expression to use as filter
+   */
+  void set_filter(ast::expression const& filter) { _filter = filter; }
+
+  /**
+   * @brief Sets to enable/disable prefetching of the next stripes in the chunked reader.
+   *
+   * When enabled and the stripes are loaded in multiple steps (see `pass_read_limit` of
+   * `chunked_orc_reader`), the data of the next stripes is read to device memory on a separate
+   * stream while the loaded stripes are decompressed and decoded. The stripes loaded at a time are
+   * halved so that both fit in the `pass_read_limit` memory budget.
+   *
+   * @param val Boolean value whether to prefetch the next stripes
+   */
+  void enable_prefetch_next_stripes(bool val) { _prefetch_next_stripes = val; }
+
+  /**
+   * @brief Sets the pointer to the reader statistics.
+   *
+   * The bytes read and decompressed, the stripes pruned and the time spent in each phase of the
+   * read are added to the statistics.
+   *
+   * @param statistics Pointer to reader statistics to be updated while reading
+   */
+  void set_statistics(std::shared_ptr<reader_statistics> statistics)
+  {
+    _statistics = std::move(statistics);
+  }
 };
 
 /**
@@ -369,6 +472,46 @@ class orc_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @copydoc orc_reader_options::set_dictionary_columns
+   * @return this for chaining
+   */
+  orc_reader_options_builder& dictionary_columns(std::vector<std::string> val)
+  {
+    options.set_dictionary_columns(std::move(val));
+    return *this;
+  }
+
+  /**
+   * @copydoc orc_reader_options::set_filter
+   * @return this for chaining
+   */
+  orc_reader_options_builder& filter(ast::expression const& filter)
+  {
+    options.set_filter(filter);
+    return *this;
+  }
+
+  /**
+   * @copydoc orc_reader_options::enable_prefetch_next_stripes
+   * @return this for chaining
+   */
+  orc_reader_options_builder& prefetch_next_stripes(bool val)
+  {
+    options.enable_prefetch_next_stripes(val);
+    return *this;
+  }
+
+  /**
+   * @copydoc orc_reader_options::set_statistics
+   * @return this for chaining
+   */
+  orc_reader_options_builder& statistics(std::shared_ptr<reader_statistics> statistics)
+  {
+    options.set_statistics(std::move(statistics));
+    return *this;
+  }
+
   /**
    * @brief move orc_reader_options member once it's built.
    */
@@ -594,6 +737,8 @@ class orc_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // Specify whether string dictionaries should be alphabetically sorted
   bool _enable_dictionary_sort = true;
+  // Optional limit on the device memory used to hold encoded stripes
+  std::optional<size_t> _max_encode_buffer_bytes;
 
   friend orc_writer_options_builder;
 
@@ -723,6 +868,16 @@ class orc_writer_options {
    */
   [[nodiscard]] bool get_enable_dictionary_sort() const { return _enable_dictionary_sort; }
 
+  /**
+   * @brief Returns the limit on the device memory used to hold encoded stripes, if set.
+   *
+   * @return Maximum size of the encoded stripe buffer, in bytes
+   */
+  [[nodiscard]] std::optional<size_t> get_max_encode_buffer_bytes() const
+  {
+    return _max_encode_buffer_bytes;
+  }
+
   // Setters
 
   /**
@@ -828,6 +983,20 @@ class orc_writer_options {
    * @param val Boolean value to enable/disable
    */
   void set_enable_dictionary_sort(bool val) { _enable_dictionary_sort = val; }
+
+  /**
+   * @brief Sets the limit on the device memory used to hold encoded stripes.
+   *
+   * When set, stripes are compressed and written to the sink in batches that fit in the limit,
+   * instead of all at once. A single stripe is always processed, even if it exceeds the limit.
+   *
+   * @param size_bytes Maximum size of the encoded stripe buffer, in bytes
+   */
+  void set_max_encode_buffer_bytes(size_t size_bytes)
+  {
+    CUDF_EXPECTS(size_bytes > 0, "The encode buffer limit must be positive");
+    _max_encode_buffer_bytes = size_bytes;
+  }
 };
 
 /**
@@ -980,6 +1149,18 @@ class orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the limit on the device memory used to hold encoded stripes.
+   *
+   * @param val Maximum size of the encoded stripe buffer, in bytes
+   * @return this for chaining
+   */
+  orc_writer_options_builder& max_encode_buffer_bytes(size_t val)
+  {
+    options.set_max_encode_buffer_bytes(val);
+    return *this;
+  }
+
   /**
    * @brief move orc_writer_options member once it's built.
    */
@@ -1040,6 +1221,8 @@ class chunked_orc_writer_options {
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // Specify whether string dictionaries should be alphabetically sorted
   bool _enable_dictionary_sort = true;
+  // Optional limit on the device memory used to hold encoded stripes
+  std::optional<size_t> _max_encode_buffer_bytes;
 
   friend chunked_orc_writer_options_builder;
 
@@ -1147,6 +1330,16 @@ class chunked_orc_writer_options {
    */
   [[nodiscard]] bool get_enable_dictionary_sort() const { return _enable_dictionary_sort; }
 
+  /**
+   * @brief Returns the limit on the device memory used to hold encoded stripes, if set.
+   *
+   * @return Maximum size of the encoded stripe buffer, in bytes
+   */
+  [[nodiscard]] std::optional<size_t> get_max_encode_buffer_bytes() const
+  {
+    return _max_encode_buffer_bytes;
+  }
+
   // Setters
 
   /**
@@ -1245,6 +1438,20 @@ class chunked_orc_writer_options {
    * @param val Boolean value to enable/disable
    */
   void set_enable_dictionary_sort(bool val) { _enable_dictionary_sort = val; }
+
+  /**
+   * @brief Sets the limit on the device memory used to hold encoded stripes.
+   *
+   * When set, stripes are compressed and written to the sink in batches that fit in the limit,
+   * instead of all at once. A single stripe is always processed, even if it exceeds the limit.
+   *
+   * @param size_bytes Maximum size of the encoded stripe buffer, in bytes
+   */
+  void set_max_encode_buffer_bytes(size_t size_bytes)
+  {
+    CUDF_EXPECTS(size_bytes > 0, "The encode buffer limit must be positive");
+    _max_encode_buffer_bytes = size_bytes;
+  }
 };
 
 /**
@@ -1383,6 +1590,18 @@ class chunked_orc_writer_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the limit on the device memory used to hold encoded stripes.
+   *
+   * @param val Maximum size of the encoded stripe buffer, in bytes
+   * @return this for chaining
+   */
+  chunked_orc_writer_options_builder& max_encode_buffer_bytes(size_t val)
+  {
+    options.set_max_encode_buffer_bytes(val);
+    return *this;
+  }
+
   /**
    * @brief move chunked_orc_writer_options member once it's built.
    */
@@ -29,6 +29,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace cudf::io {
@@ -45,6 +46,7 @@ constexpr size_type default_max_page_size_rows  = 20000;       ///< 20k rows per
 constexpr int32_t default_column_index_truncate_length = 64;   ///< truncate to 64 bytes
 constexpr size_t default_max_dictionary_size           = 1024 * 1024;  ///< 1MB dictionary size
 constexpr size_type default_max_page_fragment_size     = 5000;  ///< 5000 rows per page fragment
+constexpr double default_bloom_filter_fpp = 0.01;  ///< 1% Bloom filter false positive probability
 
 class parquet_reader_options_builder;
 
@@ -63,16 +65,26 @@ class parquet_reader_options {
   int64_t _skip_rows = 0;
   // Number of rows to read; `nullopt` is all
   std::optional<size_type> _num_rows;
+  // List of [start, end) ranges of rows to read (ignored if empty)
+  std::vector<std::pair<int64_t, int64_t>> _row_ranges;
 
   // Predicate filter as AST to filter output rows.
   std::optional<std::reference_wrapper<ast::expression const>> _filter;
 
   // Whether to store string data as categorical type
   bool _convert_strings_to_categories = false;
+  // Whether to read dictionary-encoded string columns as dictionary columns
+  bool _convert_strings_to_dictionaries = false;
   // Whether to use PANDAS metadata to load columns
   bool _use_pandas_metadata = true;
   // Whether to read and use ARROW schema
   bool _use_arrow_schema = true;
+  // Whether to read the filter columns first and the other columns for the matching rows only
+  bool _late_materialization = false;
+  // Whether the chunked reader reads the data of the next pass while decoding the current one
+  bool _prefetch_next_pass = false;
+  // Statistics of the read, filled in by the reader
+  std::shared_ptr<reader_statistics> _statistics;
   // Cast timestamp columns to a specific type
   data_type _timestamp_type{type_id::EMPTY};
 
@@ -121,6 +133,17 @@ class parquet_reader_options {
     return _convert_strings_to_categories;
   }
 
+  /**
+   * @brief Returns true/false depending on whether top-level string columns should be read as
+   * dictionary columns or not.
+   *
+   * @return `true` if string columns should be read as dictionary columns
+   */
+  [[nodiscard]] bool is_enabled_convert_strings_to_dictionaries() const
+  {
+    return _convert_strings_to_dictionaries;
+  }
+
   /**
    * @brief Returns true/false depending whether to use pandas metadata or not while reading.
    *
@@ -135,6 +158,28 @@ class parquet_reader_options {
    */
   [[nodiscard]] bool is_enabled_use_arrow_schema() const { return _use_arrow_schema; }
 
+  /**
+   * @brief Returns true/false depending whether to use late materialization for filtered reads.
+   *
+   * @return `true` if the filter columns are read first and the remaining columns are only decoded
+   * for the matching rows
+   */
+  [[nodiscard]] bool is_enabled_late_materialization() const { return _late_materialization; }
+
+  /**
+   * @brief Returns true/false depending whether the chunked reader prefetches the next pass.
+   *
+   * @return `true` if the data of the next pass is read while the current pass is decoded
+   */
+  [[nodiscard]] bool is_enabled_prefetch_next_pass() const { return _prefetch_next_pass; }
+
+  /**
+   * @brief Returns a shared pointer to the user-provided reader statistics.
+   *
+   * @return Reader statistics
+   */
+  [[nodiscard]] std::shared_ptr<reader_statistics> get_statistics() const { return _statistics; }
+
   /**
    * @brief Returns optional tree of metadata.
    *
@@ -160,6 +205,13 @@ class parquet_reader_options {
    */
   [[nodiscard]] std::optional<size_type> const& get_num_rows() const { return _num_rows; }
 
+  /**
+   * @brief Returns the ranges of rows to read.
+   *
+   * @return List of [start, end) row ranges to read; empty if all rows are read
+   */
+  [[nodiscard]] auto const& get_row_ranges() const { return _row_ranges; }
+
   /**
    * @brief Returns names of column to be read, if set.
    *
@@ -241,6 +293,18 @@ class parquet_reader_options {
    */
   void enable_convert_strings_to_categories(bool val) { _convert_strings_to_categories = val; }
 
+  /**
+   * @brief Sets to enable/disable reading string columns as dictionary columns.
+   *
+   * When enabled, top-level string columns are returned as `DICTIONARY32` columns whose keys are
+   * built from the dictionary pages of the file, without materializing the characters of each row.
+   * All data pages of these columns must be dictionary encoded. Ignored if conversion of strings
+   * to categories is enabled.
+   *
+   * @param val Boolean value to enable/disable reading string columns as dictionary columns
+   */
+  void enable_convert_strings_to_dictionaries(bool val) { _convert_strings_to_dictionaries = val; }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -255,6 +319,47 @@ class parquet_reader_options {
    */
   void enable_use_arrow_schema(bool val) { _use_arrow_schema = val; }
 
+  /**
+   * @brief Sets to enable/disable late materialization for filtered reads.
+   *
+   * When enabled and a filter is set, the columns referenced by the filter are read and evaluated
+   * first, and the remaining columns are then read for the matching rows only. Their pages without
+   * matching rows are not decoded, unless one of them is a list column, in which case the rows
+   * without matches are decoded and dropped. The filter columns are decoded once.
+   *
+   * This pays off for selective filters over tables with columns besides the filter columns. The
+   * output is the same as without late materialization. Row groups given in an order other than
+   * the file order are read without it, and the chunked reader does not support it.
+   *
+   * @param val Boolean value whether to use late materialization
+   */
+  void enable_late_materialization(bool val) { _late_materialization = val; }
+
+  /**
+   * @brief Sets to enable/disable prefetching of the next pass in the chunked reader.
+   *
+   * When enabled and the input is read in multiple passes (see `pass_read_limit` of
+   * `chunked_parquet_reader`), the column chunks of the next pass are read to device memory on a
+   * separate stream while the current pass is decoded. The prefetched data is counted against the
+   * `pass_read_limit` memory budget.
+   *
+   * @param val Boolean value whether to prefetch the next pass
+   */
+  void enable_prefetch_next_pass(bool val) { _prefetch_next_pass = val; }
+
+  /**
+   * @brief Sets the pointer to the reader statistics.
+   *
+   * The bytes read and decompressed, the row groups pruned, the pages skipped using the page index
+   * and the time spent in each phase of the read are added to the statistics.
+   *
+   * @param statistics Pointer to reader statistics to be updated while reading
+   */
+  void set_statistics(std::shared_ptr<reader_statistics> statistics)
+  {
+    _statistics = std::move(statistics);
+  }
+
   /**
    * @brief Sets reader column schema.
    *
@@ -269,6 +374,9 @@ class parquet_reader_options {
   /**
    * @brief Sets number of rows to skip.
    *
+   * When the file has page indexes, the pages that end before the first row to be read are not
+   * decoded, so skipping deep into a large row group does not process the skipped data.
+   *
    * @param val Number of rows to skip from start
    */
   void set_skip_rows(int64_t val);
@@ -280,6 +388,22 @@ class parquet_reader_options {
    */
   void set_num_rows(size_type val);
 
+  /**
+   * @brief Sets the ranges of rows to read.
+   *
+   * Each range is a [start, end) pair of row indices across all sources, in the same row space as
+   * `skip_rows`. The ranges may be given in any order and may overlap; the output contains every
+   * selected row once, in file order. Row groups that do not overlap any range are not read, and
+   * when the file has page indexes, the leading pages of the first row group that end before the
+   * first range are not decoded.
+   *
+   * @throw cudf::logic_error if a range is invalid, or if `row_groups`, `skip_rows` or `num_rows`
+   * have been set
+   *
+   * @param row_ranges List of [start, end) row ranges to read
+   */
+  void set_row_ranges(std::vector<std::pair<int64_t, int64_t>> row_ranges);
+
   /**
    * @brief Sets timestamp_type used to cast timestamp columns.
    *
@@ -355,6 +479,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable reading string columns as dictionary columns.
+   *
+   * @param val Boolean value to enable/disable reading string columns as dictionary columns
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& convert_strings_to_dictionaries(bool val)
+  {
+    options._convert_strings_to_dictionaries = val;
+    return *this;
+  }
+
   /**
    * @brief Sets to enable/disable use of pandas metadata to read.
    *
@@ -379,6 +515,42 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets to enable/disable late materialization for filtered reads.
+   *
+   * @param val Boolean value whether to use late materialization
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& late_materialization(bool val)
+  {
+    options._late_materialization = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets to enable/disable prefetching of the next pass in the chunked reader.
+   *
+   * @param val Boolean value whether to prefetch the next pass
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& prefetch_next_pass(bool val)
+  {
+    options._prefetch_next_pass = val;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the pointer to the reader statistics.
+   *
+   * @param statistics Pointer to reader statistics to be updated while reading
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& statistics(std::shared_ptr<reader_statistics> statistics)
+  {
+    options._statistics = std::move(statistics);
+    return *this;
+  }
+
   /**
    * @brief Sets reader metadata.
    *
@@ -415,6 +587,18 @@ class parquet_reader_options_builder {
     return *this;
   }
 
+  /**
+   * @brief Sets the ranges of rows to read.
+   *
+   * @param row_ranges List of [start, end) row ranges to read
+   * @return this for chaining
+   */
+  parquet_reader_options_builder& row_ranges(std::vector<std::pair<int64_t, int64_t>> row_ranges)
+  {
+    options.set_row_ranges(std::move(row_ranges));
+    return *this;
+  }
+
   /**
    * @brief timestamp_type used to cast timestamp columns.
    *
@@ -464,6 +648,29 @@ table_with_metadata read_parquet(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Sets the capacity of the process-wide cache of parsed Parquet footers.
+ *
+ * When the capacity is non-zero, the parsed footers of the files read by path are cached and
+ * reused by later reads of the same files, skipping the footer parsing. The footers are keyed by
+ * the path, inode, size, and nanosecond modification and status change times of the file, so a
+ * file that is rewritten or replaced is parsed again. The least recently used footers are evicted
+ * once the total encoded size of the cached footers would exceed the capacity.
+ *
+ * The cache is disabled by default. Setting the capacity to zero disables it again and releases
+ * all cached footers.
+ *
+ * @param capacity_bytes Maximum total encoded size of the cached footers and page indexes
+ */
+void set_parquet_footer_cache_capacity(std::size_t capacity_bytes);
+
+/**
+ * @brief Returns the capacity of the process-wide cache of parsed Parquet footers.
+ *
+ * @return Maximum total encoded size of the cached footers in bytes, 0 if the cache is disabled
+ */
+std::size_t get_parquet_footer_cache_capacity();
+
 /**
  * @brief The chunked parquet reader class to read Parquet file iteratively in to a series of
  * tables, chunk by chunk.
@@ -489,6 +696,8 @@ class chunked_parquet_reader {
    * `cudf::read_parquet()`, and an additional parameter to specify the size byte limit of the
    * output table for each reading.
    *
+   * @throw std::invalid_argument if late materialization is enabled in `options`
+   *
    * @param chunk_read_limit Limit on total number of bytes to be returned per read,
    *        or `0` if there is no limit
    * @param options The options used to read Parquet file
@@ -512,6 +721,8 @@ class chunked_parquet_reader {
    * absolute limit - if a single row group cannot fit within the limit given, it will still be
    * loaded.
    *
+   * @throw std::invalid_argument if late materialization is enabled in `options`
+   *
    * @param chunk_read_limit Limit on total number of bytes to be returned per read,
    * or `0` if there is no limit
    * @param pass_read_limit Limit on the amount of memory used for reading and decompressing data or
@@ -618,12 +829,18 @@ class parquet_writer_options {
   dictionary_policy _dictionary_policy = dictionary_policy::ADAPTIVE;
   // Maximum size of column chunk dictionary (in bytes)
   size_t _max_dictionary_size = default_max_dictionary_size;
+  // Target false positive probability of column chunk Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
   // Maximum number of rows in a page fragment
   std::optional<size_type> _max_page_fragment_size;
+  // Optional limit on the device memory used to hold encoded pages
+  std::optional<size_t> _max_encode_buffer_bytes;
   // Optional compression statistics
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // write V2 page headers?
   bool _v2_page_headers = false;
+  // pick the smallest data encoding for each column chunk?
+  bool _adaptive_encoding = false;
   // Which columns in _table are used for sorting
   std::optional<std::vector<sorting_column>> _sorting_columns;
 
@@ -800,6 +1017,13 @@ class parquet_writer_options {
    */
   [[nodiscard]] auto get_max_dictionary_size() const { return _max_dictionary_size; }
 
+  /**
+   * @brief Returns the target false positive probability of Bloom filters.
+   *
+   * @return Target false positive probability of Bloom filters
+   */
+  [[nodiscard]] auto get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   /**
    * @brief Returns maximum page fragment size, in rows.
    *
@@ -807,6 +1031,13 @@ class parquet_writer_options {
    */
   [[nodiscard]] auto get_max_page_fragment_size() const { return _max_page_fragment_size; }
 
+  /**
+   * @brief Returns the maximum size of the encoded page buffers, in bytes.
+   *
+   * @return Maximum size of the encoded page buffers, in bytes
+   */
+  [[nodiscard]] auto get_max_encode_buffer_bytes() const { return _max_encode_buffer_bytes; }
+
   /**
    * @brief Returns a shared pointer to the user-provided compression statistics.
    *
@@ -824,6 +1055,13 @@ class parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns `true` if the data encoding of each column chunk is chosen by estimated size.
+   *
+   * @return `true` if the data encoding of each column chunk is chosen by estimated size
+   */
+  [[nodiscard]] auto is_enabled_adaptive_encoding() const { return _adaptive_encoding; }
+
   /**
    * @brief Returns the sorting_columns.
    *
@@ -939,6 +1177,13 @@ class parquet_writer_options {
    */
   void set_max_dictionary_size(size_t size_bytes);
 
+  /**
+   * @brief Sets the target false positive probability of Bloom filters.
+   *
+   * @param fpp Target false positive probability, in the range (0, 1)
+   */
+  void set_bloom_filter_fpp(double fpp);
+
   /**
    * @brief Sets the maximum page fragment size, in rows.
    *
@@ -946,6 +1191,19 @@ class parquet_writer_options {
    */
   void set_max_page_fragment_size(size_type size_rows);
 
+  /**
+   * @brief Sets the maximum size of the encoded page buffers, in bytes.
+   *
+   * By default all row groups of a table are encoded before any of them is written to the sink.
+   * With a limit, the row groups are encoded and written in batches whose encoded pages fit in
+   * `size_bytes` of device memory, and the statistics and page indexes are gathered batch by
+   * batch. A batch always holds at least one row group. Since the sink receives data as soon as a
+   * batch is encoded, a failed write may leave a partial table in the sink.
+   *
+   * @param size_bytes Maximum size of the encoded page buffers, in bytes
+   */
+  void set_max_encode_buffer_bytes(size_t size_bytes);
+
   /**
    * @brief Sets the pointer to the output compression statistics.
    *
@@ -963,6 +1221,18 @@ class parquet_writer_options {
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
 
+  /**
+   * @brief Sets whether the data encoding of each column chunk is chosen by estimated size.
+   *
+   * When enabled, column chunks that are not dictionary encoded and have no encoding requested
+   * via `column_in_metadata::set_encoding` use whichever of PLAIN, DELTA_BINARY_PACKED (INT32 and
+   * INT64 columns) or DELTA_LENGTH_BYTE_ARRAY (string columns) is estimated to produce the
+   * smallest uncompressed data.
+   *
+   * @param val Boolean value to enable/disable adaptive encoding selection
+   */
+  void enable_adaptive_encoding(bool val) { _adaptive_encoding = val; }
+
   /**
    * @brief Sets sorting columns.
    *
@@ -1166,6 +1436,20 @@ class parquet_writer_options_builder {
    */
   parquet_writer_options_builder& max_dictionary_size(size_t val);
 
+  /**
+   * @brief Sets the target false positive probability of Bloom filters.
+   *
+   * Bloom filters are only written for columns with `column_in_metadata::set_bloom_filter`
+   * enabled. Each filter is sized from the number of distinct values in its column chunk to meet
+   * this probability.
+   *
+   * Default value is 0.01.
+   *
+   * @param val Target false positive probability
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& bloom_filter_fpp(double val);
+
   /**
    * @brief Sets the maximum page fragment size, in rows.
    *
@@ -1178,6 +1462,14 @@ class parquet_writer_options_builder {
    */
   parquet_writer_options_builder& max_page_fragment_size(size_type val);
 
+  /**
+   * @brief Sets the maximum size of the encoded page buffers, in bytes.
+   *
+   * @param val Maximum size of the encoded page buffers, in bytes
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& max_encode_buffer_bytes(size_t val);
+
   /**
    * @brief Sets the pointer to the output compression statistics.
    *
@@ -1223,6 +1515,15 @@ class parquet_writer_options_builder {
    */
   parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Set to true if the data encoding of each column chunk is to be chosen by estimated
+   * size.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   * @return this for chaining
+   */
+  parquet_writer_options_builder& adaptive_encoding(bool enabled);
+
   /**
    * @brief Sets column sorting metadata to chunked_parquet_writer_options.
    *
@@ -1312,12 +1613,18 @@ class chunked_parquet_writer_options {
   dictionary_policy _dictionary_policy = dictionary_policy::ADAPTIVE;
   // Maximum size of column chunk dictionary (in bytes)
   size_t _max_dictionary_size = default_max_dictionary_size;
+  // Target false positive probability of column chunk Bloom filters
+  double _bloom_filter_fpp = default_bloom_filter_fpp;
   // Maximum number of rows in a page fragment
   std::optional<size_type> _max_page_fragment_size;
+  // Optional limit on the device memory used to hold encoded pages
+  std::optional<size_t> _max_encode_buffer_bytes;
   // Optional compression statistics
   std::shared_ptr<writer_compression_statistics> _compression_stats;
   // write V2 page headers?
   bool _v2_page_headers = false;
+  // pick the smallest data encoding for each column chunk?
+  bool _adaptive_encoding = false;
   // Which columns in _table are used for sorting
   std::optional<std::vector<sorting_column>> _sorting_columns;
 
@@ -1450,6 +1757,13 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] auto get_max_dictionary_size() const { return _max_dictionary_size; }
 
+  /**
+   * @brief Returns the target false positive probability of Bloom filters.
+   *
+   * @return Target false positive probability of Bloom filters
+   */
+  [[nodiscard]] auto get_bloom_filter_fpp() const { return _bloom_filter_fpp; }
+
   /**
    * @brief Returns maximum page fragment size, in rows.
    *
@@ -1457,6 +1771,13 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] auto get_max_page_fragment_size() const { return _max_page_fragment_size; }
 
+  /**
+   * @brief Returns the maximum size of the encoded page buffers, in bytes.
+   *
+   * @return Maximum size of the encoded page buffers, in bytes
+   */
+  [[nodiscard]] auto get_max_encode_buffer_bytes() const { return _max_encode_buffer_bytes; }
+
   /**
    * @brief Returns a shared pointer to the user-provided compression statistics.
    *
@@ -1474,6 +1795,13 @@ class chunked_parquet_writer_options {
    */
   [[nodiscard]] auto is_enabled_write_v2_headers() const { return _v2_page_headers; }
 
+  /**
+   * @brief Returns `true` if the data encoding of each column chunk is chosen by estimated size.
+   *
+   * @return `true` if the data encoding of each column chunk is chosen by estimated size
+   */
+  [[nodiscard]] auto is_enabled_adaptive_encoding() const { return _adaptive_encoding; }
+
   /**
    * @brief Returns the sorting_columns.
    *
@@ -1574,6 +1902,13 @@ class chunked_parquet_writer_options {
    */
   void set_max_dictionary_size(size_t size_bytes);
 
+  /**
+   * @brief Sets the target false positive probability of Bloom filters.
+   *
+   * @param fpp Target false positive probability, in the range (0, 1)
+   */
+  void set_bloom_filter_fpp(double fpp);
+
   /**
    * @brief Sets the maximum page fragment size, in rows.
    *
@@ -1581,6 +1916,19 @@ class chunked_parquet_writer_options {
    */
   void set_max_page_fragment_size(size_type size_rows);
 
+  /**
+   * @brief Sets the maximum size of the encoded page buffers, in bytes.
+   *
+   * By default all row groups of a table are encoded before any of them is written to the sink.
+   * With a limit, the row groups are encoded and written in batches whose encoded pages fit in
+   * `size_bytes` of device memory, and the statistics and page indexes are gathered batch by
+   * batch. A batch always holds at least one row group. Since the sink receives data as soon as a
+   * batch is encoded, a failed write may leave a partial table in the sink.
+   *
+   * @param size_bytes Maximum size of the encoded page buffers, in bytes
+   */
+  void set_max_encode_buffer_bytes(size_t size_bytes);
+
   /**
    * @brief Sets the pointer to the output compression statistics.
    *
@@ -1598,6 +1946,18 @@ class chunked_parquet_writer_options {
    */
   void enable_write_v2_headers(bool val) { _v2_page_headers = val; }
 
+  /**
+   * @brief Sets whether the data encoding of each column chunk is chosen by estimated size.
+   *
+   * When enabled, column chunks that are not dictionary encoded and have no encoding requested
+   * via `column_in_metadata::set_encoding` use whichever of PLAIN, DELTA_BINARY_PACKED (INT32 and
+   * INT64 columns) or DELTA_LENGTH_BYTE_ARRAY (string columns) is estimated to produce the
+   * smallest uncompressed data.
+   *
+   * @param val Boolean value to enable/disable adaptive encoding selection
+   */
+  void enable_adaptive_encoding(bool val) { _adaptive_encoding = val; }
+
   /**
    * @brief Sets sorting columns.
    *
@@ -1719,6 +2079,15 @@ class chunked_parquet_writer_options_builder {
    */
   chunked_parquet_writer_options_builder& write_v2_headers(bool enabled);
 
+  /**
+   * @brief Set to true if the data encoding of each column chunk is to be chosen by estimated
+   * size.
+   *
+   * @param enabled Boolean value to enable/disable adaptive encoding selection
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& adaptive_encoding(bool enabled);
+
   /**
    * @brief Sets the maximum row group size, in bytes.
    *
@@ -1822,6 +2191,20 @@ class chunked_parquet_writer_options_builder {
    */
   chunked_parquet_writer_options_builder& max_dictionary_size(size_t val);
 
+  /**
+   * @brief Sets the target false positive probability of Bloom filters.
+   *
+   * Bloom filters are only written for columns with `column_in_metadata::set_bloom_filter`
+   * enabled. Each filter is sized from the number of distinct values in its column chunk to meet
+   * this probability.
+   *
+   * Default value is 0.01.
+   *
+   * @param val Target false positive probability
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& bloom_filter_fpp(double val);
+
   /**
    * @brief Sets the maximum page fragment size, in rows.
    *
@@ -1834,6 +2217,14 @@ class chunked_parquet_writer_options_builder {
    */
   chunked_parquet_writer_options_builder& max_page_fragment_size(size_type val);
 
+  /**
+   * @brief Sets the maximum size of the encoded page buffers, in bytes.
+   *
+   * @param val Maximum size of the encoded page buffers, in bytes
+   * @return this for chaining
+   */
+  chunked_parquet_writer_options_builder& max_encode_buffer_bytes(size_t val);
+
   /**
    * @brief Sets the pointer to the output compression statistics.
    *
@@ -0,0 +1,349 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/types.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf::io {
+/**
+ * @addtogroup io_writers
+ * @{
+ * @file
+ */
+
+constexpr size_t default_max_dataset_file_size     = 128 * 1024 * 1024;  ///< 128MB per file
+constexpr size_type default_max_open_dataset_files = 64;                 ///< 64 files written at once
+
+class parquet_dataset_writer_options_builder;
+
+/**
+ * @brief Settings for `parquet_dataset_writer`.
+ */
+class parquet_dataset_writer_options {
+  // Root directory of the dataset
+  std::string _base_path;
+  // Indices of the columns whose values select the partition directory of each row
+  std::vector<size_type> _partition_columns;
+  // Optional names and per-column settings of all columns, including the partition columns
+  std::optional<table_input_metadata> _metadata;
+  // Specify the compression format to use
+  compression_type _compression = compression_type::AUTO;
+  // Specify the level of statistics in the output files
+  statistics_freq _stats_level = statistics_freq::STATISTICS_ROWGROUP;
+  // Size after which a file is closed and the partition continues in a new file
+  size_t _max_file_size = default_max_dataset_file_size;
+  // Maximum number of files written concurrently
+  size_type _max_open_files = default_max_open_dataset_files;
+
+  /**
+   * @brief Constructor from the dataset location and partitioning.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_columns Indices of the partition key columns
+   */
+  explicit parquet_dataset_writer_options(std::string base_path,
+                                          std::vector<size_type> partition_columns)
+    : _base_path(std::move(base_path)), _partition_columns(std::move(partition_columns))
+  {
+  }
+
+  friend parquet_dataset_writer_options_builder;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  parquet_dataset_writer_options() = default;
+
+  /**
+   * @brief Returns the root directory of the dataset.
+   *
+   * @return Root directory of the dataset
+   */
+  [[nodiscard]] std::string const& get_base_path() const { return _base_path; }
+
+  /**
+   * @brief Returns the indices of the partition key columns.
+   *
+   * @return Indices of the partition key columns
+   */
+  [[nodiscard]] std::vector<size_type> const& get_partition_columns() const
+  {
+    return _partition_columns;
+  }
+
+  /**
+   * @brief Returns associated metadata.
+   *
+   * @return Metadata information
+   */
+  [[nodiscard]] auto const& get_metadata() const { return _metadata; }
+
+  /**
+   * @brief Returns compression format used.
+   *
+   * @return Compression format
+   */
+  [[nodiscard]] compression_type get_compression() const { return _compression; }
+
+  /**
+   * @brief Returns level of statistics requested in output files.
+   *
+   * @return Level of statistics requested in output files
+   */
+  [[nodiscard]] statistics_freq get_stats_level() const { return _stats_level; }
+
+  /**
+   * @brief Returns the size after which a file of a partition is closed.
+   *
+   * @return Maximum file size in bytes
+   */
+  [[nodiscard]] size_t get_max_file_size() const { return _max_file_size; }
+
+  /**
+   * @brief Returns the maximum number of files written concurrently.
+   *
+   * @return Maximum number of open files
+   */
+  [[nodiscard]] size_type get_max_open_files() const { return _max_open_files; }
+
+  /**
+   * @brief Sets metadata.
+   *
+   * @param metadata Associated metadata of all columns, including the partition columns
+   */
+  void set_metadata(table_input_metadata metadata) { _metadata = std::move(metadata); }
+
+  /**
+   * @brief Sets compression type.
+   *
+   * @param compression The compression type to use
+   */
+  void set_compression(compression_type compression) { _compression = compression; }
+
+  /**
+   * @brief Sets the level of statistics.
+   *
+   * @param sf Level of statistics requested in the output files
+   */
+  void set_stats_level(statistics_freq sf) { _stats_level = sf; }
+
+  /**
+   * @brief Sets the size after which a file of a partition is closed.
+   *
+   * A file may grow past this size by up to the data of one `write` call.
+   *
+   * @param size_bytes Maximum file size in bytes
+   */
+  void set_max_file_size(size_t size_bytes);
+
+  /**
+   * @brief Sets the maximum number of files written concurrently.
+   *
+   * When a new partition is written while this many files are open, the file of the least
+   * recently written partition is closed. A later write to that partition starts a new file.
+   *
+   * @param max_open_files Maximum number of open files
+   */
+  void set_max_open_files(size_type max_open_files);
+
+  /**
+   * @brief Creates builder to build parquet_dataset_writer_options.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_columns Indices of the partition key columns
+   *
+   * @return Builder to build `parquet_dataset_writer_options`
+   */
+  static parquet_dataset_writer_options_builder builder(std::string base_path,
+                                                        std::vector<size_type> partition_columns);
+};
+
+/**
+ * @brief Builds options for parquet_dataset_writer_options.
+ */
+class parquet_dataset_writer_options_builder {
+  parquet_dataset_writer_options options;
+
+ public:
+  /**
+   * @brief Default constructor.
+   *
+   * This has been added since Cython requires a default constructor to create objects on stack.
+   */
+  parquet_dataset_writer_options_builder() = default;
+
+  /**
+   * @brief Constructor from the dataset location and partitioning.
+   *
+   * @param base_path Root directory of the dataset
+   * @param partition_columns Indices of the partition key columns
+   */
+  parquet_dataset_writer_options_builder(std::string base_path,
+                                         std::vector<size_type> partition_columns)
+    : options(std::move(base_path), std::move(partition_columns))
+  {
+  }
+
+  /**
+   * @brief Sets metadata to parquet_dataset_writer_options.
+   *
+   * @param metadata Associated metadata of all columns, including the partition columns
+   * @return this for chaining
+   */
+  parquet_dataset_writer_options_builder& metadata(table_input_metadata metadata)
+  {
+    options._metadata = std::move(metadata);
+    return *this;
+  }
+
+  /**
+   * @brief Sets compression type to parquet_dataset_writer_options.
+   *
+   * @param compression The compression type to use
+   * @return this for chaining
+   */
+  parquet_dataset_writer_options_builder& compression(compression_type compression)
+  {
+    options._compression = compression;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the level of statistics in parquet_dataset_writer_options.
+   *
+   * @param sf Level of statistics requested in the output files
+   * @return this for chaining
+   */
+  parquet_dataset_writer_options_builder& stats_level(statistics_freq sf)
+  {
+    options._stats_level = sf;
+    return *this;
+  }
+
+  /**
+   * @brief Sets the size after which a file of a partition is closed.
+   *
+   * @param size_bytes Maximum file size in bytes
+   * @return this for chaining
+   */
+  parquet_dataset_writer_options_builder& max_file_size(size_t size_bytes)
+  {
+    options.set_max_file_size(size_bytes);
+    return *this;
+  }
+
+  /**
+   * @brief Sets the maximum number of files written concurrently.
+   *
+   * @param max_open_files Maximum number of open files
+   * @return this for chaining
+   */
+  parquet_dataset_writer_options_builder& max_open_files(size_type max_open_files)
+  {
+    options.set_max_open_files(max_open_files);
+    return *this;
+  }
+
+  /**
+   * @brief move parquet_dataset_writer_options member once it's built.
+   */
+  operator parquet_dataset_writer_options&&() { return std::move(options); }
+
+  /**
+   * @brief move parquet_dataset_writer_options member once it's built.
+   *
+   * This has been added since Cython does not support overloading of conversion operators.
+   *
+   * @return Built `parquet_dataset_writer_options` object's r-value reference
+   */
+  parquet_dataset_writer_options&& build() { return std::move(options); }
+};
+
+/**
+ * @brief Writes tables as a Hive-partitioned dataset of Parquet files.
+ *
+ * The rows of each table are grouped on the device by the values of the partition columns, and
+ * each group is appended to a file in the directory of its partition,
+ * `<base_path>/<name1>=<value1>/<name2>=<value2>/part-<n>.parquet`. The partition columns are
+ * encoded in the directory names and are not stored in the files. Null keys are written as
+ * `__HIVE_DEFAULT_PARTITION__`, and characters that are not valid in paths are percent-encoded.
+ *
+ * One chunked Parquet writer is kept open per partition, so that the rows of a partition from
+ * consecutive `write` calls end up in the same file until it reaches the maximum file size.
+ *
+ * @code
+ *  auto const options = cudf::io::parquet_dataset_writer_options::builder("/data/events", {0, 1})
+ *                         .metadata(metadata)
+ *                         .build();
+ *  cudf::io::parquet_dataset_writer writer{options};
+ *  writer.write(table0);
+ *  writer.write(table1);
+ *  auto const files = writer.close();
+ * @endcode
+ */
+class parquet_dataset_writer {
+ public:
+  /**
+   * @brief Constructor with dataset writer options.
+   *
+   * @param options Settings for the dataset and its files
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  parquet_dataset_writer(parquet_dataset_writer_options const& options,
+                         rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  ~parquet_dataset_writer();
+
+  /**
+   * @brief Writes the rows of a table to the files of their partitions.
+   *
+   * @throws cudf::logic_error if the table does not match the schema of the previous tables
+   * @throws cudf::logic_error if a partition column is nested
+   *
+   * @param table Table that contains the partition columns at the configured indices
+   * @return A reference to this object
+   */
+  parquet_dataset_writer& write(table_view const& table);
+
+  /**
+   * @brief Finishes all open files.
+   *
+   * @return Paths of all files written, in the order in which they were created
+   */
+  std::vector<std::string> close();
+
+ private:
+  class impl;
+  std::unique_ptr<impl> _impl;
+};
+
+/** @} */  // end of group
+}  // namespace cudf::io
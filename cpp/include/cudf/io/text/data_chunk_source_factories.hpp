@@ -18,6 +18,7 @@
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
+#include <cudf/io/types.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -76,6 +77,24 @@ std::unique_ptr<data_chunk_source> make_source_from_bgzip_file(std::string_view
                                                                uint64_t virtual_begin,
                                                                uint64_t virtual_end);
 
+/**
+ * @brief Creates a data source capable of producing device-buffered views of a GZIP or ZSTD
+ *        compressed file.
+ *
+ * The file is decompressed block by block on a background thread, ahead of the chunks being
+ * requested. GZIP files are decompressed on the host, ZSTD files are decompressed on the device,
+ * with the frames of each block being decompressed in parallel.
+ *
+ * @throw std::invalid_argument if the compression type is neither GZIP nor ZSTD
+ *
+ * @param filename the filename of the compressed file to be exposed as a data chunk source.
+ * @param compression the compression type of the file, either GZIP or ZSTD.
+ * @return the data chunk source for the provided filename. It reads data from the file and
+ *         decompresses it, copying the decompressed data to the device.
+ */
+std::unique_ptr<data_chunk_source> make_source_from_compressed_file(std::string_view filename,
+                                                                    compression_type compression);
+
 /**
  * @brief Creates a data source capable of producing views of the given device string scalar
  * @param data the device data to be exposed as a data chunk source. Its lifetime must be at least
@@ -47,7 +47,7 @@ struct trie_device_view {
   /**
    * @brief create a multistate which contains all partial path matches for the given token.
    */
-  constexpr multistate transition_init(char c)
+  constexpr multistate transition_init(char c) const
   {
     auto result = multistate();
 
@@ -66,7 +66,7 @@ struct trie_device_view {
    *
    * @note always enqueues (0, 0] as the first state of the returned multistate.
    */
-  constexpr multistate transition(char c, multistate const& states)
+  constexpr multistate transition(char c, multistate const& states) const
   {
     auto result = multistate();
 
@@ -82,20 +82,31 @@ struct trie_device_view {
   /**
    * @brief returns true if the given index is associated with a matching state.
    */
-  constexpr bool is_match(uint16_t idx) { return static_cast<bool>(get_match_length(idx)); }
+  constexpr bool is_match(uint16_t idx) const { return static_cast<bool>(get_match_length(idx)); }
 
   /**
    * @brief returns the match length if the given index is associated with a matching state,
    * otherwise zero.
    */
-  constexpr uint8_t get_match_length(uint16_t idx) { return _nodes[idx].match_length; }
+  constexpr uint8_t get_match_length(uint16_t idx) const { return _nodes[idx].match_length; }
+
+  /**
+   * @brief returns true if any of the tails of the given multistate is a matching state.
+   */
+  constexpr bool is_match(multistate const& states) const
+  {
+    for (uint8_t i = 0; i < states.size(); i++) {
+      if (is_match(states.get_tail(i))) { return true; }
+    }
+    return false;
+  }
 
  private:
   constexpr void transition_enqueue_all(  //
     char c,
     multistate& states,
     uint8_t head,
-    uint8_t curr)
+    uint8_t curr) const
   {
     for (uint32_t tail = _nodes[curr].child_begin; tail < _nodes[curr + 1].child_begin; tail++) {
       if (_nodes[tail].token == c) {  //
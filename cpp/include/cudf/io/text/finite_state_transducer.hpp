@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace text {
+
+/**
+ * @brief Definition of a finite-state transducer (FST) that is run on the device.
+ *
+ * The FST reads one byte at a time. Every byte is mapped to a symbol group: the i-th symbol group
+ * holds the bytes of `symbol_groups[i]`, and all the bytes that are not part of any symbol group
+ * are mapped to the additional symbol group `symbol_groups.size()`. For every state and symbol
+ * group, the transition table gives the next state and the translation table gives the bytes that
+ * are output by the transition.
+ *
+ * The FST is simulated with the same parallel algorithm that drives the JSON tokenizer: the input
+ * is split across threads, which each simulate their part from every possible state at once.
+ *
+ * @code{.pseudo}
+ * Example: mark the start of the keys and of the values of space-separated key=value pairs
+ *  symbol_groups:     ["=", " "]
+ *  transition_table:  [[2, 0, 1],       // between pairs
+ *                      [2, 0, 1],       // in a key
+ *                      [2, 0, 2]]       // in a value
+ *  translation_table: [["v", "", "k"],  // between pairs: a key starts
+ *                      ["v", "", ""],   // in a key: '=' starts the value
+ *                      ["", "", ""]]    // in a value
+ *  input:   a=1 bc=22
+ *  symbols: kvkv
+ *  indices: [0, 1, 4, 6]
+ * @endcode
+ */
+class finite_state_transducer {
+ public:
+  /// Maximum number of states of a finite-state transducer
+  static constexpr int32_t max_num_states = 16;
+  /// Maximum number of user-defined symbol groups, excluding the group of the other bytes
+  static constexpr int32_t max_num_symbol_groups = 14;
+  /// Maximum total number of bytes in the translation table
+  static constexpr int32_t max_translation_size = 1024;
+
+  /**
+   * @brief Constructs a finite-state transducer from its lookup tables.
+   *
+   * @throw cudf::logic_error if there are more states or symbol groups than supported
+   * @throw cudf::logic_error if a byte is part of more than one symbol group
+   * @throw cudf::logic_error if a table does not have `symbol_groups.size() + 1` entries per state
+   * @throw cudf::logic_error if a transition or the start state is not a valid state
+   * @throw cudf::logic_error if the translation table outputs more than `max_translation_size`
+   * bytes in total
+   *
+   * @param symbol_groups The bytes of each symbol group
+   * @param transition_table The next state of each (state, symbol group) pair
+   * @param translation_table The bytes output by each (state, symbol group) pair
+   * @param start_state The state the transducer starts in
+   */
+  finite_state_transducer(std::vector<std::string> symbol_groups,
+                          std::vector<std::vector<int32_t>> transition_table,
+                          std::vector<std::vector<std::string>> translation_table,
+                          int32_t start_state = 0);
+
+  /**
+   * @brief Returns the bytes of each symbol group.
+   *
+   * @return The bytes of each symbol group
+   */
+  [[nodiscard]] std::vector<std::string> const& symbol_groups() const { return _symbol_groups; }
+
+  /**
+   * @brief Returns the next state of each (state, symbol group) pair.
+   *
+   * @return The transition table
+   */
+  [[nodiscard]] std::vector<std::vector<int32_t>> const& transition_table() const
+  {
+    return _transition_table;
+  }
+
+  /**
+   * @brief Returns the bytes output by each (state, symbol group) pair.
+   *
+   * @return The translation table
+   */
+  [[nodiscard]] std::vector<std::vector<std::string>> const& translation_table() const
+  {
+    return _translation_table;
+  }
+
+  /**
+   * @brief Returns the state the transducer starts in.
+   *
+   * @return The start state
+   */
+  [[nodiscard]] int32_t start_state() const { return _start_state; }
+
+ private:
+  std::vector<std::string> _symbol_groups;
+  std::vector<std::vector<int32_t>> _transition_table;
+  std::vector<std::vector<std::string>> _translation_table;
+  int32_t _start_state;
+};
+
+/**
+ * @brief Output of a finite-state transducer run over a device buffer.
+ */
+struct transduce_result {
+  std::unique_ptr<cudf::column> symbols;  ///< INT8 column of the output bytes
+  std::unique_ptr<cudf::column> indices;  ///< INT64 column of the input byte of each output byte
+};
+
+/**
+ * @brief Runs a finite-state transducer over a device buffer.
+ *
+ * The whole buffer is a single input, starting in the start state of the transducer.
+ *
+ * @param input The bytes to transduce
+ * @param fst The finite-state transducer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The output bytes, and the index of the input byte that produced each of them
+ */
+transduce_result transduce(
+  cudf::device_span<char const> input,
+  finite_state_transducer const& fst,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Runs a finite-state transducer over each string of a strings column.
+ *
+ * Every string is transduced independently, starting in the start state of the transducer. The
+ * whole column is still processed in a single pass over its bytes.
+ *
+ * @code{.pseudo}
+ * Example, using the key=value transducer of `finite_state_transducer`:
+ *  input:  ['a=1 bc=22', 'x=y', null]
+ *  output: ['kvkv', 'kv', null]
+ * @endcode
+ *
+ * @param input Strings column to transduce
+ * @param fst The finite-state transducer
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Strings column of the output bytes of each row
+ */
+std::unique_ptr<cudf::column> transduce(
+  cudf::strings_column_view const& input,
+  finite_state_transducer const& fst,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+}  // namespace text
+}  // namespace io
+}  // namespace cudf
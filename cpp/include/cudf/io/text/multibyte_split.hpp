@@ -26,6 +26,8 @@
 
 #include <memory>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace cudf {
 namespace io {
@@ -89,6 +91,37 @@ std::unique_ptr<cudf::column> multibyte_split(
   parse_options options             = {},
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Splits the source text into a strings column using any of multiple delimiters.
+ *
+ * A row ends wherever any of the delimiters ends, so records terminated by e.g. either `"\r\n"`
+ * or `"\n"` can be split in a single pass. If multiple delimiters end at the same position, the
+ * longest one is stripped when `options.strip_delimiters` is set. The byte range is handled the
+ * same way as for a single delimiter.
+ *
+ * @code{.pseudo}
+ * Examples:
+ *  source:     "abc\r\ndef\nghi"
+ *  delimiters: ["\r\n", "\n"]
+ *  return:     ["abc\r\n", "def\n", "ghi"]
+ * @endcode
+ *
+ * @throw cudf::logic_error if no delimiters are given, or one of multiple delimiters is empty
+ * @throw cudf::logic_error if the delimiters have too many tokens for a deterministic result
+ *
+ * @param source The source string
+ * @param delimiters UTF-8 encoded strings for which to find offsets in the source
+ * @param options the parsing options to use (including byte range)
+ * @param mr Memory resource to use for the device memory allocation
+ * @return The strings found by splitting the source by the delimiters within the relevant byte
+ * range.
+ */
+std::unique_ptr<cudf::column> multibyte_split(
+  data_chunk_source const& source,
+  std::vector<std::string> const& delimiters,
+  parse_options options             = {},
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 std::unique_ptr<cudf::column> multibyte_split(
   data_chunk_source const& source,
   std::string const& delimiter,
@@ -25,6 +25,7 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <chrono>
 #include <map>
 #include <memory>
 #include <optional>
@@ -218,6 +219,50 @@ class writer_compression_statistics {
   std::size_t _num_compressed_output_bytes = 0;  ///< The number of bytes in the compressed output
 };
 
+/**
+ * @brief Statistics about the data read and the time spent in each phase of a reader.
+ *
+ * Filled in by the Parquet and ORC readers when attached to their options. The values are
+ * accumulated, so one object can collect the statistics of all the chunks of a chunked read or of
+ * several reads. Row groups refer to ORC stripes for the ORC reader.
+ *
+ * The phase times are host wall-clock times. Work enqueued on the stream at the end of a phase is
+ * attributed to the phase that next waits for the stream.
+ */
+struct reader_statistics {
+  std::size_t num_bytes_read         = 0;         ///< Bytes of column data read from the sources
+  std::size_t num_compressed_bytes   = 0;         ///< Bytes of column data decompressed
+  std::size_t num_decompressed_bytes = 0;         ///< Bytes of column data after decompression
+  std::size_t num_row_groups_total   = 0;         ///< Row groups considered for reading
+  std::size_t num_row_groups_pruned  = 0;         ///< Row groups not read (filter or row selection)
+  std::size_t num_pages_skipped      = 0;         ///< Parquet pages skipped using the page index
+  std::chrono::nanoseconds metadata_time{};       ///< Time parsing metadata and selecting rows
+  std::chrono::nanoseconds io_time{};             ///< Time reading column data from the sources
+  std::chrono::nanoseconds decompression_time{};  ///< Time decompressing column data
+  std::chrono::nanoseconds decode_time{};         ///< Time decoding column data
+
+  /**
+   * @brief Adds the values from another `reader_statistics` object.
+   *
+   * @param other The other reader_statistics object
+   * @return reader_statistics& Reference to this object
+   */
+  reader_statistics& operator+=(reader_statistics const& other) noexcept
+  {
+    num_bytes_read += other.num_bytes_read;
+    num_compressed_bytes += other.num_compressed_bytes;
+    num_decompressed_bytes += other.num_decompressed_bytes;
+    num_row_groups_total += other.num_row_groups_total;
+    num_row_groups_pruned += other.num_row_groups_pruned;
+    num_pages_skipped += other.num_pages_skipped;
+    metadata_time += other.metadata_time;
+    io_time += other.io_time;
+    decompression_time += other.decompression_time;
+    decode_time += other.decode_time;
+    return *this;
+  }
+};
+
 /**
  * @brief Control use of dictionary encoding for parquet writer
  */
@@ -609,6 +654,7 @@ class column_in_metadata {
   bool _use_int96_timestamp = false;
   bool _output_as_binary    = false;
   bool _skip_compression    = false;
+  bool _bloom_filter        = false;
   std::optional<uint8_t> _decimal_precision;
   std::optional<int32_t> _parquet_field_id;
   std::optional<int32_t> _type_length;
@@ -756,6 +802,21 @@ class column_in_metadata {
     return *this;
   }
 
+  /**
+   * @brief Specifies whether a split block Bloom filter should be written for this column.
+   *
+   * Only valid for leaf columns. The filter is not written for boolean columns or for timestamp
+   * columns written as INT96.
+   *
+   * @param enabled If `true` write a Bloom filter for each column chunk of this column
+   * @return this for chaining
+   */
+  column_in_metadata& set_bloom_filter(bool enabled) noexcept
+  {
+    _bloom_filter = enabled;
+    return *this;
+  }
+
   /**
    * @brief Sets the encoding to use for this column.
    *
@@ -901,6 +962,13 @@ class column_in_metadata {
    */
   [[nodiscard]] bool is_enabled_skip_compression() const noexcept { return _skip_compression; }
 
+  /**
+   * @brief Get whether to write a Bloom filter for this column
+   *
+   * @return Boolean indicating whether to write a Bloom filter for this column
+   */
+  [[nodiscard]] bool is_enabled_bloom_filter() const noexcept { return _bloom_filter; }
+
   /**
    * @brief Get the encoding that was set for this column.
    *
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <future>
+#include <string>
+#include <vector>
+
+/**
+ * @file jit_cache.hpp
+ * @brief APIs to inspect and warm the JIT kernel cache
+ */
+
+namespace cudf {
+/**
+ * @addtogroup utility_jit
+ * @{
+ */
+
+/**
+ * @brief Kinds of operations compiling a kernel for a user-defined function
+ */
+enum class jit_kernel_kind : int8_t {
+  TRANSFORM,         ///< `cudf::transform`
+  BINARY_OPERATION,  ///< `cudf::binary_operation` with a PTX function
+};
+
+/**
+ * @brief The operation, types and user-defined function of a kernel to precompile
+ *
+ * The kernel compiled for the spec is the same kernel used by the operation called with
+ * inputs of `input_types`, so the operation does not compile it again.
+ */
+struct jit_kernel_spec {
+  jit_kernel_kind kind;                ///< Operation using the kernel
+  std::string udf;                     ///< Source of the user-defined function
+  data_type output_type;               ///< Type of the output column
+  std::vector<data_type> input_types;  ///< Input type for TRANSFORM, lhs and rhs types otherwise
+  bool is_ptx = true;                  ///< If `udf` is PTX; BINARY_OPERATION is always PTX
+};
+
+/**
+ * @brief Statistics of the JIT kernel cache
+ */
+struct jit_cache_statistics {
+  std::size_t kernel_requests;  ///< Number of kernels requested by JIT operations in the process
+  std::size_t kernels_loaded;   ///< Number of distinct kernels compiled or loaded from disk
+  double load_seconds;          ///< Time spent compiling or loading those kernels
+  std::string cache_dir;        ///< Directory of the disk cache or empty if it is disabled
+  std::size_t disk_files;       ///< Number of files in `cache_dir`
+  std::size_t disk_bytes;       ///< Total size of the files in `cache_dir`
+};
+
+/**
+ * @brief Compiles the kernels of the given specs in background threads
+ *
+ * Each kernel is compiled, or loaded from the disk cache, and kept in the in-process kernel
+ * cache. Calling this at startup moves the compile time of the first call of each operation
+ * off the critical path. The threads use the CUDA device that is current for the calling
+ * thread.
+ *
+ * @throws cudf::logic_error from `std::future::get` if a spec has an unsupported type or
+ * the wrong number of input types
+ *
+ * @param specs Kernels to compile
+ * @param num_threads Number of threads compiling kernels concurrently
+ * @return Future which is ready when all the kernels are compiled
+ */
+std::future<void> precompile_jit_kernels(std::vector<jit_kernel_spec> specs,
+                                         std::size_t num_threads = 4);
+
+/**
+ * @brief Returns statistics of the kernels requested by this process and of the disk cache
+ *
+ * @return Statistics of the JIT kernel cache
+ */
+jit_cache_statistics get_jit_cache_statistics();
+
+/**
+ * @brief Removes the disk cache directories of other libcudf versions
+ *
+ * The disk cache is stored in a directory per libcudf version under
+ * `LIBCUDF_KERNEL_CACHE_PATH` (`$HOME/.cudf` by default). Kernels cached by other versions
+ * cannot be used by this version and are only removed by this function.
+ *
+ * @return Number of version directories removed
+ */
+std::size_t evict_stale_jit_cache_versions();
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -52,6 +52,10 @@ class hash_join;
 
 template <cudf::has_nested HasNested>
 class distinct_hash_join;
+
+class filtered_join;
+
+class mixed_join_impl;
 }  // namespace detail
 
 /**
@@ -178,6 +182,159 @@ full_join(cudf::table_view const& left_keys,
           null_equality compare_nulls       = null_equality::EQUAL,
           rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the
+ * specified tables, computed one hash partition at a time.
+ *
+ * Both tables are hash-partitioned on their keys into `num_partitions` partitions, which are
+ * spilled to host memory. Rows of different partitions never match, so each pair of partitions
+ * is then copied back to device memory and joined on its own. This bounds the device memory used
+ * by the join to roughly the size of one pair of partitions plus the result, which allows joining
+ * tables that do not fit in device memory when they are in device-accessible host memory, e.g.
+ * managed or pinned memory.
+ *
+ * The result is the same as the result of `inner_join`, in unspecified order.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw std::invalid_argument if `num_partitions` is not positive
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param num_partitions The number of partitions the tables are split into
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(cudf::table_view const& left_keys,
+                       cudf::table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls       = null_equality::EQUAL,
+                       rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                       rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to a left join between the
+ * specified tables, computed one hash partition at a time.
+ *
+ * The tables are partitioned and joined as in `partitioned_inner_join`. The result is the same
+ * as the result of `left_join`, in unspecified order.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw std::invalid_argument if `num_partitions` is not positive
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param num_partitions The number of partitions the tables are split into
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing a left join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls       = null_equality::EQUAL,
+                      rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                      rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, which must be sorted on their keys.
+ *
+ * The matches of each left row form a run of equal rows in the sorted right table, which is found
+ * with `lower_bound` and `upper_bound`, so no hash table is built. The output pairs are distributed
+ * evenly over the threads, such that keys with many matches do not slow down the join. The result
+ * is ordered by left row index and then by right row index.
+ *
+ * @code{.pseudo}
+ * Left: {{0, 1, 1, 2}}
+ * Right: {{1, 1, 2, 3}}
+ * Result: {{1, 1, 2, 2, 3}, {0, 1, 0, 1, 2}}
+ * @endcode
+ *
+ * @note With `null_equality::UNEQUAL`, only rows with null keys at the top level are excluded
+ * from the join.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw cudf::data_type_error if the column types of the tables differ
+ * @throw std::invalid_argument if `check_sorted` is true and either table is not sorted in the
+ * order given by `column_order` and `null_precedence`
+ * @throw std::overflow_error if the number of output pairs exceeds the column size limit
+ *
+ * @param left_keys The left table, sorted on the keys
+ * @param right_keys The right table, sorted on the keys in the same order as `left_keys`
+ * @param column_order The sort order of each key column. If empty, all columns are ascending.
+ * @param null_precedence The order of nulls of each key column. If empty, nulls come first.
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param check_sorted Whether to verify that both tables are sorted before joining them
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(cudf::table_view const& left_keys,
+                      cudf::table_view const& right_keys,
+                      std::vector<order> const& column_order         = {},
+                      std::vector<null_order> const& null_precedence = {},
+                      null_equality compare_nulls                    = null_equality::EQUAL,
+                      bool check_sorted                              = false,
+                      rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+                      rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a pair of row index vectors corresponding to an inner join between the specified
+ * tables, with heavy hitter keys of the right table handled separately.
+ *
+ * The keys of the right table with at least `heavy_hitter_threshold` rows are heavy hitters. The
+ * other right rows are joined with a regular hash join. The heavy hitters are joined through a
+ * table of their distinct keys, and the matches of each left row with a heavy hitter are then
+ * split evenly over the threads. This avoids the load imbalance of probing keys with very many
+ * matches, which dominates the join time when the keys are heavily skewed.
+ *
+ * The result is the same as the result of `inner_join`, in unspecified order.
+ *
+ * @throw cudf::logic_error if number of elements in `left_keys` or `right_keys`
+ * mismatch.
+ * @throw std::invalid_argument if `heavy_hitter_threshold` is not positive
+ *
+ * @param left_keys The left table
+ * @param right_keys The right table
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param heavy_hitter_threshold Minimum number of rows of a right key to treat it as a heavy hitter
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned indices' device memory
+ *
+ * @return A pair of vectors [`left_indices`, `right_indices`] that can be used to construct
+ * the result of performing an inner join between two tables with `left_keys` and `right_keys`
+ * as the join keys.
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_inner_join(cudf::table_view const& left_keys,
+                  cudf::table_view const& right_keys,
+                  null_equality compare_nulls       = null_equality::EQUAL,
+                  size_type heavy_hitter_threshold  = 1024,
+                  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a vector of row indices corresponding to a left semi-join
  * between the specified tables.
@@ -274,6 +431,80 @@ std::unique_ptr<cudf::table> cross_join(
  */
 enum class nullable_join : bool { YES, NO };
 
+/**
+ * @brief Bloom filter over the rows of a table of join keys.
+ *
+ * The filter tells whether a row may be equal to any of the rows it was built from. Rows for which
+ * `contains` returns false have no match, while rows for which it returns true have a match with
+ * a probability that grows with the number of bits per key. The filter is much more compact than
+ * a hash table, so it can be used to discard most of the non-matching probe rows of a join early,
+ * e.g. with `cudf::apply_boolean_mask`, before they are decoded, gathered or joined.
+ *
+ * @code{.pseudo}
+ * Keys: {{1, 2, 3}}
+ * Probe: {{0, 1, 2, 4}}
+ * contains(Probe): {false, true, true, false} (rows without a match may also be true)
+ * @endcode
+ */
+class bloom_filter {
+ public:
+  bloom_filter()                               = delete;
+  ~bloom_filter()                              = default;
+  bloom_filter(bloom_filter const&)            = delete;
+  bloom_filter(bloom_filter&&)                 = default;
+  bloom_filter& operator=(bloom_filter const&) = delete;
+  bloom_filter& operator=(bloom_filter&&)      = default;
+
+  /**
+   * @brief Constructs a Bloom filter over the rows of `keys`.
+   *
+   * With the default of 10 bits per key, about 1% of the non-matching rows pass the filter.
+   *
+   * @throw cudf::logic_error if the number of columns in `keys` is 0
+   * @throw std::invalid_argument if `bits_per_key` is not positive
+   *
+   * @param keys The keys to build the filter from
+   * @param compare_nulls Controls whether null keys should match or not. If nulls are unequal,
+   * rows with null keys are not added to the filter and never pass it.
+   * @param bits_per_key Number of filter bits per row of `keys`
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  bloom_filter(cudf::table_view const& keys,
+               null_equality compare_nulls  = null_equality::EQUAL,
+               size_type bits_per_key       = 10,
+               rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Returns a boolean column that is false for the rows of `probe` that are not equal to
+   * any of the rows the filter was built from.
+   *
+   * @throw cudf::logic_error if the number of columns in `probe` differs from the number of key
+   * columns the filter was built from
+   *
+   * @param probe The rows to look up in the filter
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A BOOL8 column without nulls with one element per row of `probe`
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the size of the filter in bytes.
+   *
+   * @return The size of the filter in bytes
+   */
+  [[nodiscard]] std::size_t size_bytes() const { return _bits.size() * sizeof(uint32_t); }
+
+ private:
+  size_type _num_columns;               ///< Number of key columns
+  cudf::null_equality _nulls_equal;     ///< Whether null keys match
+  int32_t _num_hashes;                  ///< Number of bits set per key
+  rmm::device_uvector<uint32_t> _bits;  ///< Filter bits
+};
+
 /**
  * @brief Hash join that builds hash table in creation and probes results in subsequent `*_join`
  * member functions.
@@ -393,6 +624,80 @@ class hash_join {
             rmm::cuda_stream_view stream           = cudf::get_default_stream(),
             rmm::device_async_resource_ref mr      = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns the row indices of an inner join for a batch of the probe rows, starting at
+   * `probe_row_offset`, so the join output can be retrieved in batches of bounded size.
+   *
+   * The batch contains all the matches of a run of consecutive probe rows, and `probe_row_offset`
+   * is advanced past that run. Calling this function until `probe_row_offset` reaches
+   * `probe.num_rows()` returns the same index pairs as `inner_join`, and the probe indices are
+   * row indices of the whole `probe` table. A batch may exceed `max_output_size` only if a single
+   * probe row has more matches.
+   *
+   * @code{.cpp}
+   * cudf::size_type probe_row_offset = 0;
+   * while (probe_row_offset < probe.num_rows()) {
+   *   auto [left_indices, right_indices] =
+   *     hash_join.inner_join_batch(probe, probe_row_offset, max_output_size);
+   *   ...
+   * }
+   * @endcode
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param[in,out] probe_row_offset The first probe row of the batch, updated to the first probe
+   * row of the next batch
+   * @param max_output_size Maximum number of index pairs of the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw std::out_of_range If `probe_row_offset` is not within `[0, probe.num_rows()]`
+   * @throw std::invalid_argument If `max_output_size` is zero
+   *
+   * @return A pair of columns [`left_indices`, `right_indices`] of the batch
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join_batch(
+    cudf::table_view const& probe,
+    size_type& probe_row_offset,
+    std::size_t max_output_size,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices of a left join for a batch of the probe rows, starting at
+   * `probe_row_offset`, so the join output can be retrieved in batches of bounded size.
+   *
+   * The batches are formed as in `inner_join_batch`, and together return the same index pairs as
+   * `left_join`.
+   *
+   * @param probe The probe table, from which the tuples are probed
+   * @param[in,out] probe_row_offset The first probe row of the batch, updated to the first probe
+   * row of the next batch
+   * @param max_output_size Maximum number of index pairs of the batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table and columns' device
+   * memory.
+   *
+   * @throw cudf::logic_error If the input probe table has nulls while this hash_join object was not
+   * constructed with null check.
+   * @throw std::out_of_range If `probe_row_offset` is not within `[0, probe.num_rows()]`
+   * @throw std::invalid_argument If `max_output_size` is zero
+   *
+   * @return A pair of columns [`left_indices`, `right_indices`] of the batch
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join_batch(
+    cudf::table_view const& probe,
+    size_type& probe_row_offset,
+    std::size_t max_output_size,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
   /**
    * Returns the exact number of matches (rows) when performing an inner join with the specified
    * probe table.
@@ -445,10 +750,107 @@ class hash_join {
     rmm::cuda_stream_view stream      = cudf::get_default_stream(),
     rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
 
+  /**
+   * Returns a Bloom filter over the rows of the build table, which can be used to discard probe
+   * rows that have no match before they are joined. @see cudf::bloom_filter.
+   *
+   * Null keys match in the filter if and only if they match in this join.
+   *
+   * @param bits_per_key Number of filter bits per row of the build table
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   *
+   * @return A Bloom filter over the rows of the build table
+   */
+  [[nodiscard]] bloom_filter make_bloom_filter(
+    size_type bits_per_key       = 10,
+    rmm::cuda_stream_view stream = cudf::get_default_stream()) const;
+
  private:
   const std::unique_ptr<impl_type const> _impl;
 };
 
+/**
+ * @brief Semi and anti join that builds a hash table of the build table in creation and probes it
+ * in subsequent `*_join` member functions.
+ *
+ * This class is the counterpart of `hash_join` for `left_semi_join` and `left_anti_join`: the
+ * hash table is built once and can be probed with any number of probe tables, e.g. with the
+ * batches of a stream of rows, instead of being rebuilt for every probe table.
+ *
+ * @code{.pseudo}
+ * Build: {{1, 2, 3}}
+ * Probe: {{0, 1, 2}}
+ * semi_join(Probe): {1, 2}
+ * anti_join(Probe): {0}
+ * @endcode
+ */
+class filtered_join {
+ public:
+  using impl_type = cudf::detail::filtered_join;  ///< Implementation type
+
+  filtered_join() = delete;
+  ~filtered_join();
+  filtered_join(filtered_join const&)            = delete;
+  filtered_join(filtered_join&&)                 = delete;
+  filtered_join& operator=(filtered_join const&) = delete;
+  filtered_join& operator=(filtered_join&&)      = delete;
+
+  /**
+   * @brief Constructs a filtered join object and builds its hash table from the given `build`
+   * table.
+   *
+   * @note The `build` table must remain valid while the filtered join object is used.
+   *
+   * @throw cudf::logic_error if the number of columns in `build` table is 0
+   *
+   * @param build The build table, from which the hash table is built
+   * @param compare_nulls Controls whether null join-key values should match or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  filtered_join(cudf::table_view const& build,
+                null_equality compare_nulls  = null_equality::EQUAL,
+                rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * Returns the row indices of the probe table that have a match in the build table. @see
+   * cudf::left_semi_join().
+   *
+   * @throw cudf::logic_error if the number of columns in the build and probe tables differ
+   * @throw cudf::data_type_error if the column types of the build and probe tables differ
+   *
+   * @param probe The probe table, from which the rows are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return The row indices of `probe` that have a match in the build table
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> semi_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices of the probe table that do not have a match in the build table.
+   * @see cudf::left_anti_join().
+   *
+   * @throw cudf::logic_error if the number of columns in the build and probe tables differ
+   * @throw cudf::data_type_error if the column types of the build and probe tables differ
+   *
+   * @param probe The probe table, from which the rows are probed
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector's device memory
+   *
+   * @return The row indices of `probe` that do not have a match in the build table
+   */
+  [[nodiscard]] std::unique_ptr<rmm::device_uvector<size_type>> anti_join(
+    cudf::table_view const& probe,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<impl_type const> _impl;  ///< Filtered join implementation
+};
+
 /**
  * @brief Distinct hash join that builds hash table in creation and probes results in subsequent
  * `*_join` member functions
@@ -537,6 +939,13 @@ class distinct_hash_join {
  * If the provided predicate returns NULL for a pair of rows
  * (left, right), that pair is not included in the output.
  *
+ * Band and range predicates, i.e. a comparison of a left and a right column
+ * or the logical and of a lower and an upper bound comparison of the same
+ * key column, such as `Left.ts >= Right.start and Left.ts <= Right.end`, are
+ * computed by sorting the key column instead of evaluating the predicate for
+ * all pairs of rows. This requires the columns to have the same integral,
+ * timestamp, or duration type.
+ *
  * @code{.pseudo}
  * Left: {{0, 1, 2}}
  * Right: {{1, 2, 3}}
@@ -1086,6 +1495,121 @@ std::pair<std::size_t, std::unique_ptr<rmm::device_uvector<size_type>>> mixed_le
   null_equality compare_nulls       = null_equality::EQUAL,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Mixed join that builds the hash table of the build equality table and the plan of the
+ * binary predicate in creation and probes them in subsequent `*_join` member functions.
+ *
+ * This class is the counterpart of `hash_join` for `mixed_inner_join` and `mixed_left_join`: the
+ * build state is created once and can be probed with any number of probe tables, e.g. with the
+ * batches of a stream of rows, instead of being recreated for every probe table. The probe tables
+ * are the left tables and the build tables are the right tables of the join and the expression.
+ *
+ * If the provided predicate returns NULL for a pair of rows (probe, build), that pair is not
+ * included in the output. It is the user's responsibility to choose a suitable compare_nulls value
+ * AND use appropriate null-safe operators in the expression.
+ *
+ * @code{.pseudo}
+ * build_equality: {{1, 2, 3}}
+ * build_conditional: {{3, 4, 5}}
+ * probe_equality: {{0, 1, 2}}
+ * probe_conditional: {{4, 4, 4}}
+ * Expression: Left.Column_0 > Right.Column_0
+ * inner_join(probe_equality, probe_conditional): {{1}, {0}}
+ * left_join(probe_equality, probe_conditional): {{0, 1, 2}, {None, 0, None}}
+ * @endcode
+ */
+class mixed_join {
+ public:
+  using impl_type = cudf::detail::mixed_join_impl;  ///< Implementation type
+
+  mixed_join() = delete;
+  ~mixed_join();
+  mixed_join(mixed_join const&)            = delete;
+  mixed_join(mixed_join&&)                 = delete;
+  mixed_join& operator=(mixed_join const&) = delete;
+  mixed_join& operator=(mixed_join&&)      = delete;
+
+  /**
+   * @brief Constructs a mixed join object from the build tables and the binary predicate.
+   *
+   * The plan of the expression only depends on the column types of the conditional tables, so
+   * `probe_conditional` may be an empty table with the schema of the probe conditional tables.
+   *
+   * @note The build tables and `binary_predicate` must remain valid while the mixed join object
+   * is used.
+   *
+   * @throw cudf::logic_error If the binary predicate outputs a non-boolean result.
+   * @throw cudf::logic_error If the number of rows in build_equality and build_conditional do not
+   * match.
+   *
+   * @param build_equality The build table used for the equality join
+   * @param build_conditional The build table used for the conditional join
+   * @param probe_conditional A table with the schema of the probe conditional tables
+   * @param binary_predicate The condition on which to join
+   * @param compare_nulls Whether or not null values join to each other or not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  mixed_join(table_view const& build_equality,
+             table_view const& build_conditional,
+             table_view const& probe_conditional,
+             ast::expression const& binary_predicate,
+             null_equality compare_nulls  = null_equality::EQUAL,
+             rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * Returns the row indices that can be used to construct the result of performing a mixed inner
+   * join between the probe tables and the build tables. @see cudf::mixed_inner_join().
+   *
+   * @throw cudf::logic_error If the number of rows in probe_equality and probe_conditional do not
+   * match.
+   * @throw cudf::data_type_error If the column types of the probe and build equality tables
+   * differ, or if the column types of `probe_conditional` differ from the schema passed at
+   * construction.
+   *
+   * @param probe_equality The probe table used for the equality join
+   * @param probe_conditional The probe table used for the conditional join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory
+   *
+   * @return A pair of vectors [`probe_indices`, `build_indices`] that can be used to construct
+   * the result of performing a mixed inner join between the probe and build tables
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>
+  inner_join(table_view const& probe_equality,
+             table_view const& probe_conditional,
+             rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+             rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * Returns the row indices that can be used to construct the result of performing a mixed left
+   * join between the probe tables and the build tables. @see cudf::mixed_left_join().
+   *
+   * @throw cudf::logic_error If the number of rows in probe_equality and probe_conditional do not
+   * match.
+   * @throw cudf::data_type_error If the column types of the probe and build equality tables
+   * differ, or if the column types of `probe_conditional` differ from the schema passed at
+   * construction.
+   *
+   * @param probe_equality The probe table used for the equality join
+   * @param probe_conditional The probe table used for the conditional join
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned indices' device memory
+   *
+   * @return A pair of vectors [`probe_indices`, `build_indices`] that can be used to construct
+   * the result of performing a mixed left join between the probe and build tables
+   */
+  [[nodiscard]] std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                          std::unique_ptr<rmm::device_uvector<size_type>>>
+  left_join(table_view const& probe_equality,
+            table_view const& probe_conditional,
+            rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+            rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<impl_type const> _impl;  ///< Mixed join implementation
+};
+
 /**
  * @brief Returns the exact number of matches (rows) when performing a
  * conditional inner join between the specified tables where the predicate
@@ -16,13 +16,17 @@
 #pragma once
 
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/optional.h>
 
+#include <string>
+
 namespace cudf {
 
 /**
@@ -172,5 +176,28 @@ std::unique_ptr<cudf::column> get_json_object(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Apply several JSONPath strings to all rows in an input strings column.
+ *
+ * Produces the same results as calling `get_json_object()` once per path, but evaluates
+ * all of the paths in a single pass over the input. Column `i` of the returned table
+ * holds the results of `json_paths[i]`.
+ *
+ * @throw std::invalid_argument if any path contains an invalid operator or an empty name
+ *
+ * @param col The input strings column. Each row must contain a valid json string
+ * @param json_paths The JSONPath strings to be applied to each row
+ * @param options Options for controlling the behavior of the function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Resource for allocating device memory
+ * @return New table with one strings column of retrieved json object strings per path
+ */
+std::unique_ptr<cudf::table> get_json_object(
+  cudf::strings_column_view const& col,
+  cudf::host_span<std::string const> json_paths,
+  get_json_object_options options   = get_json_object_options{},
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace cudf
@@ -78,5 +78,37 @@ std::unique_ptr<column> label_bins(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief One-hot encodes elements by their membership in the specified bins.
+ *
+ * Equivalent to `one_hot_encode_sparse(label_bins(...), sequence(left_edges.size()))` without
+ * materializing the labels: row `j` of the output is `[i]` if `input[j]` belongs to bin `i` and
+ * `[]` if it belongs to no bin. The bins are defined as in `label_bins`, and the output is the
+ * CSR-style layout of `one_hot_encode_sparse`, which needs memory proportional to the number of
+ * input elements rather than to the number of elements times the number of bins.
+ *
+ * @throws cudf::logic_error if `input.type() == left_edges.type() == right_edges.type()` is
+ * violated.
+ * @throws cudf::logic_error if `left_edges.size() != right_edges.size()`
+ * @throws cudf::logic_error if `left_edges.has_nulls()` or `right_edges.has_nulls()`
+ *
+ * @param input The input elements to encode according to the specified bins.
+ * @param left_edges Values of the left edge of each bin.
+ * @param left_inclusive Whether or not the left edge is inclusive.
+ * @param right_edges Value of the right edge of each bin.
+ * @param right_inclusive Whether or not the right edge is inclusive.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST<INT32> column of the bin index of each element of `input`, if any
+ */
+std::unique_ptr<column> one_hot_encode_bins(
+  column_view const& input,
+  column_view const& left_edges,
+  inclusive left_inclusive,
+  column_view const& right_edges,
+  inclusive right_inclusive,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace cudf
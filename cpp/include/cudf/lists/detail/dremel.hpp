@@ -17,6 +17,7 @@
 #pragma once
 
 #include <cudf/column/column.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/device_uvector.hpp>
 
@@ -196,6 +197,30 @@ dremel_data get_dremel_data(column_view input,
                             bool output_as_byte_array,
                             rmm::cuda_stream_view stream);
 
+/**
+ * @brief Get the dremel offsets and repetition and definition levels for several LIST columns
+ *
+ * Columns that share all their nesting levels but the leaf, like the single-child paths to the
+ * sibling leaves of a struct column, have the same dremel offsets and repetition levels. Their
+ * levels above the leaves are traversed once, and the definition levels of each column are derived
+ * by adding the contribution of its own leaf. The other columns are encoded as by
+ * `get_dremel_data(column_view, std::vector<uint8_t>, bool, rmm::cuda_stream_view)`.
+ *
+ * No list level is considered as the last level for a `uint8_t` child, so columns to be written as
+ * byte arrays must use the single column overload.
+ *
+ * @throws std::invalid_argument if the sizes of `inputs` and `nullability` differ, or a
+ * nullability is empty
+ *
+ * @param inputs Columns of LIST type
+ * @param nullability Pre-determined nullability at each level of each input
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @return The dremel data of each input
+ */
+std::vector<dremel_data> get_dremel_data(host_span<column_view const> inputs,
+                                         host_span<std::vector<uint8_t> const> nullability,
+                                         rmm::cuda_stream_view stream);
+
 /**
  * @brief Get Dremel offsets, repetition levels, and modified definition levels to be used for
  *        lexicographical comparators. The modified definition levels are produced by treating
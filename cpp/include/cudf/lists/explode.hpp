@@ -24,6 +24,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <utility>
 
 namespace cudf {
 /**
@@ -205,6 +206,35 @@ std::unique_ptr<table> explode_outer_position(
   size_type explode_column_idx,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row mapping of exploding a list column, without materializing any other
+ * column.
+ *
+ * This returns the pieces that `explode` would assemble: a gather map holding, for each element
+ * of the list column's child, the index of the input row it came from, and the flattened child
+ * itself. Gathering any other column of the input table with the gather map yields the same rows
+ * as `explode`, so callers can gather only the columns they need, or apply a filter first.
+ * ```
+ * [[5,10,15],
+ *  null,
+ *  [20,25]]
+ * returns
+ * gather map:       [0, 0, 0, 2, 2]
+ * flattened child:  [5, 10, 15, 20, 25]
+ * ```
+ * As with `explode`, null and empty lists produce no output rows.
+ *
+ * @throw cudf::logic_error if `explode_column` is not a list column
+ *
+ * @param explode_column List column to explode
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @return A pair of the INT32 gather map and the flattened child column
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_gather_map(
+  column_view const& explode_column,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 
 }  // namespace cudf
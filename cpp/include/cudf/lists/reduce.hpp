@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+namespace cudf {
+namespace lists {
+/**
+ * @addtogroup lists_elements
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Reduces the elements of each list row in the given lists column.
+ *
+ * Each `output[i]` is the reduction of the elements of `input[i]` using `agg`. The child column
+ * is reduced in place using the list offsets as segment boundaries, so no explode or gather of
+ * the child is needed. `MIN` and `MAX` also accept nested child types (lists, structs), which are
+ * compared lexicographically.
+ *
+ * @code{.pseudo}
+ * l = { {1, 2, 3}, {4}, {}, null, {5, null, 6} }
+ * r = reduce(l, SUM, INT64)
+ * r is now {6, 4, null, null, 11}
+ * @endcode
+ *
+ * A null or empty input row results in a null output row. Null elements within a row are
+ * handled according to `null_handling`; see `cudf::segmented_reduce`.
+ *
+ * @throw cudf::logic_error if `agg` or `output_dtype` is not supported for the child type
+ *
+ * @param input Input lists column
+ * @param agg Aggregation operator applied to the elements of each list row
+ * @param output_dtype Data type of the output column
+ * @param null_handling If `INCLUDE`, the reduction of a row is null if any element is null.
+ *                      If `EXCLUDE`, null elements are skipped.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with one reduced value per list row
+ */
+std::unique_ptr<column> reduce(
+  lists_column_view const& input,
+  segmented_reduce_aggregation const& agg,
+  data_type output_dtype,
+  null_policy null_handling         = null_policy::EXCLUDE,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of lists_elements group
+
+}  // namespace lists
+}  // namespace cudf
@@ -17,7 +17,9 @@
 #pragma once
 
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -25,6 +27,11 @@
 #include <vector>
 
 namespace cudf {
+//! Inner interfaces and implementations
+namespace detail {
+class chunked_merger;
+}  // namespace detail
+
 /**
  * @addtogroup column_merge
  * @{
@@ -108,5 +115,67 @@ std::unique_ptr<cudf::table> merge(
   std::vector<cudf::null_order> const& null_precedence = {},
   rmm::device_async_resource_ref mr                    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Merges a set of sorted tables, returning the merged rows in chunks of bounded size.
+ *
+ * The chunks, concatenated in the order they are returned, form the same table as `merge()`.
+ * Rows with equal keys are ordered by the index of their table in `tables_to_merge`.
+ *
+ * The merged order is computed once, from the key columns only, and each chunk copies its rows
+ * from the inputs once. A single fixed-width key column of at most 8 bytes is merged on encoded
+ * radix keys rather than with a row comparator.
+ *
+ * The tables in `tables_to_merge` must outlive this object.
+ *
+ * @throws cudf::logic_error for the same invalid inputs as `merge()`
+ * @throws std::invalid_argument if `chunk_rows` is not positive
+ */
+class chunked_merge {
+ public:
+  /**
+   * @brief Computes the merged order of the rows of `tables_to_merge`.
+   *
+   * @param tables_to_merge Non-empty list of tables to be merged
+   * @param key_cols Indices of the columns of each table to be used for comparison criteria
+   * @param column_order Sort order types of columns indexed by key_cols
+   * @param null_precedence Array indicating the order of nulls with respect to non-nulls for the
+   * indexing columns (key_cols)
+   * @param chunk_rows Largest number of rows in each returned chunk
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned tables' device memory
+   */
+  chunked_merge(std::vector<table_view> const& tables_to_merge,
+                std::vector<cudf::size_type> const& key_cols,
+                std::vector<cudf::order> const& column_order,
+                std::vector<cudf::null_order> const& null_precedence,
+                cudf::size_type chunk_rows,
+                rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor, destroying the internal merger instance.
+   */
+  ~chunked_merge();
+
+  /**
+   * @brief Check if there are merged rows that have not been returned yet.
+   *
+   * @return A boolean value indicating if there are merged rows left to return
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the next chunk of merged rows.
+   *
+   * An empty table is returned once all merged rows have been returned.
+   *
+   * @return A table with the next `chunk_rows` merged rows, or fewer for the last chunk
+   */
+  std::unique_ptr<cudf::table> next_chunk();
+
+ private:
+  std::unique_ptr<cudf::detail::chunked_merger> merger;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
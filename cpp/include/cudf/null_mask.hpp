@@ -187,6 +187,40 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Performs bitwise AND of the bitmasks of the columns of each of several tables.
+ *
+ * Returns the same masks and null counts as calling `bitmask_and(table_view const&, ...)` on
+ * each table, but combines the masks of all tables in a single kernel launch. Masks whose
+ * offsets are word-aligned are read 128 bits at a time.
+ *
+ * @param views The tables whose column masks are combined
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffers
+ * @return A pair of resulting bitmask and count of unset bits for each table
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Performs bitwise OR of the bitmasks of the columns of each of several tables.
+ *
+ * Returns the same masks and null counts as calling `bitmask_or(table_view const&, ...)` on
+ * each table, but combines the masks of all tables in a single kernel launch. Masks whose
+ * offsets are word-aligned are read 128 bits at a time.
+ *
+ * @param views The tables whose column masks are combined
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffers
+ * @return A pair of resulting bitmask and count of unset bits for each table
+ */
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Given a validity bitmask, counts the number of null elements (unset bits)
  * in the range `[start, stop)`.
@@ -207,5 +241,34 @@ cudf::size_type null_count(bitmask_type const* bitmask,
                            size_type start,
                            size_type stop,
                            rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Returns a view of `input` without the null masks that have no null elements.
+ *
+ * A column with a null mask but a null count of zero, as readers and filters often produce,
+ * makes kernels take their null-aware paths for no benefit. The returned view, and each of its
+ * descendants, has a null mask only if it contains nulls. No device memory is copied.
+ *
+ * @param input The column to view
+ * @return View of `input` with the all-valid null masks removed
+ */
+column_view compact_null_masks(column_view const& input);
+
+/**
+ * @brief Returns a view of `input` without the null masks that have no null elements.
+ *
+ * @see compact_null_masks(column_view const&)
+ *
+ * @param input The table to view
+ * @return View of `input` with the all-valid null masks removed
+ */
+table_view compact_null_masks(table_view const& input);
+
+/**
+ * @brief Frees the null masks of `input` and its descendants that have no null elements.
+ *
+ * @param input The column whose all-valid null masks are freed
+ */
+void compact_null_masks(column& input);
 /** @} */  // end of group
 }  // namespace cudf
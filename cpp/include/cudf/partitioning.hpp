@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include <cudf/contiguous_split.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
@@ -110,6 +111,114 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash partitions rows from the input table directly into one packed
+ * buffer per partition.
+ *
+ * Produces the same partitions as `hash_partition` followed by
+ * `contiguous_split` at the returned offsets, but tables of fixed-width columns
+ * are scattered straight into their packed partition buffers without
+ * materializing the reordered table. Each result uses the `pack` layout and
+ * can be read with `cudf::unpack`. The order of rows within a partition is
+ * unspecified.
+ *
+ * @throw std::out_of_range if index is `columns_to_hash` is invalid
+ *
+ * @param input The table to partition
+ * @param columns_to_hash Indices of input columns to hash
+ * @param num_partitions The number of partitions to use
+ * @param hash_function Optional hash id that chooses the hash function to use
+ * @param seed Optional seed value to the hash function
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device memory
+ *
+ * @returns One packed table per partition, empty when `num_partitions <= 0`
+ */
+std::vector<packed_columns> partition_and_pack(
+  table_view const& input,
+  std::vector<size_type> const& columns_to_hash,
+  int num_partitions,
+  hash_id hash_function             = hash_id::HASH_MURMUR3,
+  uint32_t seed                     = DEFAULT_HASH_SEED,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Partitions rows from the input table by ranges of their key values.
+ *
+ * The keys of `input` are the columns specified by `key_columns`. A row belongs to partition `i`
+ * if its keys are not less than the boundary row `i - 1` and less than the boundary row `i`, as
+ * ordered by `column_order` and `null_precedence`, so there are `sorted_boundaries.num_rows() + 1`
+ * partitions. The partition of every row is found with one batched `upper_bound` search and the
+ * rows are then scattered into their partitions in a single pass, as in `partition`. Rows
+ * partitioned into the same bin are grouped consecutively in the output table, in an unspecified
+ * order. Returns a vector of row offsets to the start of each partition in the output table.
+ *
+ * Sorting each partition of the output yields a globally sorted table, so the partitions of a
+ * distributed sort can be sorted independently.
+ *
+ * @code{.pseudo}
+ * Example:
+ * input:             {{5, 1, 9, 3, 7, 2}}
+ * key_columns:       {0}
+ * sorted_boundaries: {{3, 7}}
+ * output:            {{1, 2, 5, 3, 9, 7}}, offsets: {0, 2, 4, 6}
+ * @endcode
+ *
+ * @throw std::out_of_range if an index in `key_columns` is invalid
+ * @throw std::invalid_argument if the number of key columns differs from the number of columns
+ * of `sorted_boundaries`
+ *
+ * @param input The table to partition
+ * @param key_columns Indices of the input columns compared with the boundaries
+ * @param sorted_boundaries Boundaries between the partitions, sorted by `column_order` and
+ * `null_precedence`
+ * @param column_order The order of each key column
+ * @param null_precedence The order of the nulls of each key column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns An output table and a vector of `sorted_boundaries.num_rows() + 2` row offsets to each
+ * partition
+ */
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& sorted_boundaries,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Picks the boundaries of `num_partitions` range partitions of balanced sizes from a sample
+ * of the keys.
+ *
+ * The boundaries are the rows of ranks `i * sample.num_rows() / num_partitions` of the sample
+ * sorted by `column_order` and `null_precedence`, for `i` in `[1, num_partitions)`. Only the sort
+ * order of the sample is computed, not the sorted sample. The sample can be obtained with
+ * `sample_fraction` or `reservoir_sample`, for example from each batch or node of a distributed
+ * sort, and the result passed to `range_partition`.
+ *
+ * @throw std::invalid_argument if `num_partitions` is not positive
+ *
+ * @param sample A sample of the key columns of the table to partition
+ * @param num_partitions The number of partitions to use
+ * @param column_order The order of each key column
+ * @param null_precedence The order of the nulls of each key column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns The `num_partitions - 1` sorted boundaries, or none if the sample is empty
+ */
+std::unique_ptr<table> range_partition_boundaries(
+  table_view const& sample,
+  size_type num_partitions,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Round-robin partition.
  *
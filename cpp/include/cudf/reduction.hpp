@@ -17,12 +17,17 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf {
 /**
@@ -110,6 +115,37 @@ std::unique_ptr<scalar> reduce(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief  Computes several reductions of the values in all rows of a column.
+ *
+ * The result of each aggregation is the same as that of calling `reduce()` with it and its output
+ * type. `min`, `max`, `sum`, `sum_of_squares`, `mean`, `variance` and `std` reductions of a numeric
+ * column are computed together in a single pass over the column when their output types allow
+ * it: `min` and `max` of the column's type, `sum` of an integral type or FLOAT64, and the others
+ * of FLOAT64. The other aggregations are computed one by one.
+ *
+ * @code{.pseudo}
+ * col = {1, 2, 3, 4}
+ * reduce(col, {min, max, mean}, {INT32, INT32, FLOAT64}) = {1, 4, 2.5}
+ * @endcode
+ *
+ * @throw std::invalid_argument if the number of aggregations and output types differ
+ * @throw cudf::logic_error for any aggregation for which `reduce()` throws
+ *
+ * @param col Input column view
+ * @param aggs Aggregation operators applied by the reductions
+ * @param output_dtypes The output scalar type of each aggregation
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalars' device memory
+ * @returns Output scalars with the reduce results, in the order of `aggs`
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Compute reduction of each segment in the input column
  *
@@ -189,6 +225,65 @@ std::unique_ptr<column> segmented_reduce(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Statistics of each segment of a column computed by `compute_statistics`.
+ */
+struct segment_statistics {
+  std::unique_ptr<column> min;         ///< Minimum of each segment
+  std::unique_ptr<column> max;         ///< Maximum of each segment
+  std::unique_ptr<column> null_count;  ///< INT32 number of null values in each segment
+  std::unique_ptr<column> sum;         ///< Sum of each segment, or `nullptr` if not summable
+  std::unique_ptr<column> sketch;      ///< HyperLogLog sketches, or `nullptr` if not requested
+};
+
+/**
+ * @brief Computes the minimum, maximum, null count and sum of each segment of every column of a
+ * table in a single pass.
+ *
+ * All the statistics of a segment are computed by one thread block, using the same reduction as
+ * the column statistics of the ORC and Parquet writers, so profiling a table does not need a
+ * separate reduction per column and statistic.
+ *
+ * The `min` and `max` columns have the type of the input column and are null for segments
+ * without valid values. The `sum` columns are `UINT64` for booleans and unsigned integers, `INT64`
+ * for signed integers, `FLOAT64` for floating point types, `DECIMAL64` for `DECIMAL32` and
+ * `DECIMAL64`, `DECIMAL128` for `DECIMAL128` and of the input type for durations. NaNs are skipped
+ * by the sums. A sum is null for segments without valid values and for segments whose sum may
+ * overflow. Timestamp and string columns have no sum.
+ *
+ * If `sketch_precision` is set, the `sketch` columns hold the `LIST<INT8>` HyperLogLog sketch of
+ * the distinct values of each segment, from which `cudf::approx_distinct_count` estimates the
+ * number of distinct values.
+ *
+ * If any index in `offsets` is out of bound of `input`, the behavior is undefined.
+ *
+ * @code{.pseudo}
+ * input   = [[1, 5, null, 3, 2, null]]
+ * offsets = [0, 3, 6]
+ * result[0].min        = [1, 2]
+ * result[0].max        = [5, 3]
+ * result[0].null_count = [1, 1]
+ * result[0].sum        = [6, 5]
+ * @endcode
+ *
+ * @throw std::invalid_argument if a column of `input` is neither fixed-width nor strings
+ * @throw std::invalid_argument if `sketch_precision` is not in the range [4, 18]
+ *
+ * @param input Table whose columns are profiled
+ * @param offsets Each segment's offset in the columns of `input`. A list of offsets with size
+ * `num_segments + 1`. If empty, each column is a single segment.
+ * @param sketch_precision Precision of the HyperLogLog sketches, or `std::nullopt` to skip them
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The statistics of each column of `input`
+ */
+std::vector<segment_statistics> compute_statistics(
+  table_view const& input,
+  device_span<size_type const> offsets,
+  std::optional<int> sketch_precision = std::nullopt,
+  rmm::cuda_stream_view stream        = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr   = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Computes the scan of a column.
  *
@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+
+namespace cudf::reduction::detail {
+
+/**
+ * @brief Compute a HyperLogLog sketch of the distinct values of each group.
+ *
+ * The returned column is a `LIST<INT8>` column with one sketch of `2^precision` registers per
+ * group. Null values, and values whose group label is not less than `num_groups`, are ignored.
+ * The values do not need to be grouped: only their labels matter.
+ *
+ * @code{.pseudo}
+ * values       = [2, 1, 1, 3, 5, 2, 2, 3, 1, 4]
+ * group_labels = [0, 0, 0, 1, 1, 1, 1, 1, 2, 2]
+ * num_groups   = 3
+ *
+ * approx_distinct_count(output) = [2, 3, 2]
+ * @endcode
+ *
+ * @throws std::invalid_argument if `precision` is not in the range [4, 18]
+ *
+ * @param values Values to sketch
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param num_groups Number of groups
+ * @param precision Number of hash bits selecting the register of a value
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A `LIST<INT8>` column of sketches
+ */
+std::unique_ptr<column> group_hyperloglog(column_view const& values,
+                                          device_span<size_type const> group_labels,
+                                          size_type num_groups,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Merge the HyperLogLog sketches of each group.
+ *
+ * Each register of a merged sketch is the maximum of the corresponding registers of the sketches
+ * of its group. Null sketches are ignored.
+ *
+ * @throws std::invalid_argument if `sketches` is not a `LIST<INT8>` column of sketches of
+ * `2^precision` registers
+ *
+ * @param sketches Sketches produced by HYPERLOGLOG or MERGE_HYPERLOGLOG aggregations
+ * @param group_labels ID of group that the corresponding sketch belongs to
+ * @param num_groups Number of groups
+ * @param precision Precision of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A `LIST<INT8>` column of the merged sketches
+ */
+std::unique_ptr<column> group_merge_hyperloglog(column_view const& sketches,
+                                                device_span<size_type const> group_labels,
+                                                size_type num_groups,
+                                                int precision,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::approx_distinct_count
+ */
+std::unique_ptr<column> approx_distinct_count(column_view const& sketches,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr);
+
+}  // namespace cudf::reduction::detail
@@ -17,12 +17,18 @@
 #pragma once
 
 #include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
 #include <optional>
+#include <vector>
 
 namespace cudf::reduction::detail {
 
@@ -39,4 +45,39 @@ std::unique_ptr<scalar> reduce(column_view const& col,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc cudf::reduce(column_view const&, host_span<std::unique_ptr<reduce_aggregation> const>,
+ * host_span<data_type const>, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ */
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::segmented_reduce(column_view const&, device_span<size_type const>,
+ * segmented_reduce_aggregation const&, data_type, null_policy,
+ * std::optional<std::reference_wrapper<scalar const>>, rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> segmented_reduce(column_view const& segmented_values,
+                                         device_span<size_type const> offsets,
+                                         segmented_reduce_aggregation const& agg,
+                                         data_type output_dtype,
+                                         null_policy null_handling,
+                                         std::optional<std::reference_wrapper<scalar const>> init,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::compute_statistics
+ */
+std::vector<segment_statistics> compute_statistics(table_view const& input,
+                                                   device_span<size_type const> offsets,
+                                                   std::optional<int> sketch_precision,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr);
+
 }  // namespace cudf::reduction::detail
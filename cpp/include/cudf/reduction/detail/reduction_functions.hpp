@@ -159,6 +159,34 @@ std::unique_ptr<scalar> merge_histogram(column_view const& input,
                                         rmm::cuda_stream_view stream,
                                         rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Compute a HyperLogLog sketch of the distinct values of the input column.
+ *
+ * @param input The column to sketch
+ * @param precision Number of hash bits selecting the register of a value
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return A list_scalar storing the `2^precision` registers of the sketch
+ */
+std::unique_ptr<scalar> hyperloglog(column_view const& input,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Merge multiple HyperLogLog sketches together.
+ *
+ * @param input The input given as a `LIST<INT8>` column of sketches
+ * @param precision Precision of the sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned scalar's device memory
+ * @return A list_scalar storing the registers of the merged sketch
+ */
+std::unique_ptr<scalar> merge_hyperloglog(column_view const& input,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr);
+
 /**
  * @brief Computes product of elements in input column
  *
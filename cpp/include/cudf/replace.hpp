@@ -97,6 +97,28 @@ std::unique_ptr<column> replace_nulls(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Replaces all null values in each column of a table with the first non-null value that
+ * precedes/follows in the same column.
+ *
+ * The result is the same as replacing the null values of each column with
+ * `replace_nulls(column_view const&, replace_policy const&)`, but the gather maps of all the
+ * columns are computed by one segmented scan, and columns sharing a null mask share their gather
+ * map and are gathered together. Columns without nulls are copied.
+ *
+ * @param[in] input A table whose null values will be replaced
+ * @param[in] replace_policy Specify the position of replacement values relative to null values
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param[in] mr Device memory resource used to allocate device memory of the returned table
+ *
+ * @returns Copy of `input` with null values replaced based on `replace_policy`
+ */
+std::unique_ptr<table> replace_nulls(
+  table_view const& input,
+  replace_policy const& replace_policy,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Replaces all NaN values in a column with corresponding values from another column
  *
@@ -16,13 +16,17 @@
 
 #pragma once
 
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/rolling/range_window_bounds.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
+#include <vector>
 
 namespace cudf {
 /**
@@ -307,6 +311,56 @@ std::unique_ptr<column> grouped_rolling_window(
   rolling_aggregation const& aggr,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Request for rolling window aggregation(s) of a column.
+ *
+ * Every aggregation is computed over the windows of `values` with the same `min_periods`.
+ */
+struct rolling_request {
+  column_view values;         ///< The elements to aggregate
+  size_type min_periods = 1;  ///< Minimum number of observations in a window to have a value
+  std::vector<std::unique_ptr<rolling_aggregation>> aggregations;  ///< Desired aggregations
+};
+
+/**
+ * @brief The result(s) of a `rolling_request`
+ *
+ * The `rolling_result` holds one column for each aggregation of the `rolling_request`, in the
+ * same order.
+ */
+struct rolling_result {
+  /// Columns of results from a `rolling_request`
+  std::vector<std::unique_ptr<column>> results{};
+};
+
+/**
+ * @brief  Applies several grouping-aware, fixed-size rolling window functions to several columns.
+ *
+ * Computes the same results as calling `grouped_rolling_window()` for each aggregation of each
+ * request, with empty `default_outputs`. The groups and the group-bounded window of every row are
+ * computed once, and shared by all the aggregations.
+ *
+ * @throws cudf::logic_error if the `values` of a request do not have as many rows as `group_keys`
+ * @throws cudf::logic_error if the `min_periods` of a request is negative
+ *
+ * @param[in] group_keys The (pre-sorted) grouping columns
+ * @param[in] preceding_window The static rolling window size in the backward direction (for
+ * positive values), or forward direction (for negative values)
+ * @param[in] following_window The static rolling window size in the forward direction (for positive
+ * values), or backward direction (for negative values)
+ * @param[in] requests The set of columns to aggregate and the aggregations to compute
+ * @param[in] mr Device memory resource used to allocate the returned columns' device memory
+ *
+ * @returns   One `rolling_result` for each request, holding the nullable output columns of its
+ *            aggregations
+ */
+std::vector<rolling_result> grouped_rolling_window(
+  table_view const& group_keys,
+  window_bounds preceding_window,
+  window_bounds following_window,
+  host_span<rolling_request const> requests,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief  Applies a grouping-aware, timestamp-based rolling window function to the values in a
  *         column.
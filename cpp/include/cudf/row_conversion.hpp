@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+/**
+ * @addtogroup reshape_transpose
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Converts a table into rows stored one after another in row-major order.
+ *
+ * Each row is laid out as follows:
+ * - A slot per column, in column order. Each slot is aligned to the size of its type, up to
+ *   8 bytes. Fixed-width values are stored in their slot. A string slot holds two `uint32_t`
+ *   values: the offset of the string's bytes from the start of the row, then its size.
+ * - One validity bit per column, starting at the first byte after the last slot. Bit `i % 8`
+ *   of byte `i / 8` is set if column `i` is valid in that row.
+ * - The bytes of the row's strings, in column order. Null strings have no bytes.
+ * - Zero padding up to a multiple of 8 bytes.
+ *
+ * The rows are returned as `LIST<INT8>` columns, one list per row. Rows are split into
+ * several columns so that each column holds less than 2GB of row data.
+ *
+ * @throw std::invalid_argument if the table has no columns or a column is neither fixed-width
+ * nor a string column
+ * @throw std::overflow_error if a single row is larger than 2GB
+ *
+ * @param input Table to convert
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Columns of rows, in order, that together hold all rows of `input`
+ */
+std::vector<std::unique_ptr<column>> convert_to_rows(
+  table_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts rows produced by `convert_to_rows()` back into a table.
+ *
+ * @throw std::invalid_argument if the input is not a `LIST<INT8>` column or `schema` contains a
+ * type that is neither fixed-width nor a string
+ *
+ * @param input Column of rows, one list per row
+ * @param schema Types of the columns stored in the rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table with one column per entry of `schema`
+ */
+std::unique_ptr<table> convert_from_rows(
+  lists_column_view const& input,
+  host_span<data_type const> schema,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of group
+}  // namespace cudf
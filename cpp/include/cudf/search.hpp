@@ -20,13 +20,20 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <vector>
 
 namespace cudf {
+// forward declaration
+namespace detail {
+class hash_set;
+}  // namespace detail
+
 /**
  * @addtogroup column_search
  * @{
@@ -118,6 +125,114 @@ std::unique_ptr<column> upper_bound(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Whether the needles of an ordered search are sorted.
+ */
+enum class needles_order : bool {
+  UNSORTED,  ///< Needles are in any order
+  SORTED     ///< Needles are sorted in the same order as the haystack
+};
+
+/**
+ * @copydoc cudf::lower_bound(table_view const&, table_view const&, std::vector<order> const&,
+ *          std::vector<null_order> const&, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ * With `needles_order::SORTED`, the needles must be sorted by `column_order` and
+ * `null_precedence`. The haystack and the needles are then searched together along their merge
+ * path in O(haystack + needles) time rather than with a binary search per needle, which is faster
+ * unless the haystack is much larger than the needles.
+ *
+ * @param needles_are_sorted Whether `needles` is sorted in the order of `haystack`
+ */
+std::unique_ptr<column> lower_bound(
+  table_view const& haystack,
+  table_view const& needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  needles_order needles_are_sorted,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @copydoc cudf::upper_bound(table_view const&, table_view const&, std::vector<order> const&,
+ *          std::vector<null_order> const&, rmm::cuda_stream_view, rmm::device_async_resource_ref)
+ *
+ * With `needles_order::SORTED`, the needles must be sorted by `column_order` and
+ * `null_precedence`. The haystack and the needles are then searched together along their merge
+ * path in O(haystack + needles) time rather than with a binary search per needle, which is faster
+ * unless the haystack is much larger than the needles.
+ *
+ * @param needles_are_sorted Whether `needles` is sorted in the order of `haystack`
+ */
+std::unique_ptr<column> upper_bound(
+  table_view const& haystack,
+  table_view const& needles,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  needles_order needles_are_sorted,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief A sorted haystack laid out for repeated `lower_bound` and `upper_bound` searches.
+ *
+ * The rows of the haystack are copied in Eytzinger order, the breadth-first order of the binary
+ * search tree over the sorted rows. The first steps of every search then read the same few rows
+ * at the start of each column, which stay in cache, and each step reads the row after those of
+ * the previous step. Building the index costs a copy of the haystack, which pays off when it is
+ * searched many times.
+ */
+class ordered_search_index {
+ public:
+  /**
+   * @brief Builds the search index of a sorted haystack.
+   *
+   * @param haystack The sorted table containing the search space
+   * @param column_order Vector of column sort order
+   * @param null_precedence Vector of null_precedence enums
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the index's device memory
+   */
+  ordered_search_index(
+    table_view const& haystack,
+    std::vector<order> const& column_order,
+    std::vector<null_order> const& null_precedence,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Returns the same insertion points as `cudf::lower_bound` on the indexed haystack.
+   *
+   * @param needles Values for which to find the insert locations in the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of elements containing the insertion points
+   */
+  [[nodiscard]] std::unique_ptr<column> lower_bound(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Returns the same insertion points as `cudf::upper_bound` on the indexed haystack.
+   *
+   * @param needles Values for which to find the insert locations in the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable column of elements containing the insertion points
+   */
+  [[nodiscard]] std::unique_ptr<column> upper_bound(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<table> _haystack;         ///< Haystack rows in Eytzinger order
+  std::unique_ptr<column> _sorted_indices;  ///< Index in the sorted haystack of each row
+  std::vector<order> _column_order;
+  std::vector<null_order> _null_precedence;
+};
+
 /**
  * @brief Check if the given `needle` value exists in the `haystack` column.
  *
@@ -167,5 +282,69 @@ std::unique_ptr<column> contains(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hash set of the rows of a haystack table, built once and probed with any number of
+ * needles tables.
+ *
+ * `cudf::contains` builds a hash table of the haystack on every call. This class builds it, along
+ * with the haystack's row operator preprocessing, in its constructor so that checking a stream of
+ * needles batches against the same haystack only pays for the probes.
+ *
+ * @code{.pseudo}
+ * haystack = { { 5, 4, 1, 2, 3 } }
+ * set      = hash_set(haystack)
+ * set.contains({ { 0, 1, 2 } }) = { false, true, true }
+ * set.contains({ { 3, 6 } })    = { true, false }
+ * @endcode
+ */
+class hash_set {
+ public:
+  using impl_type = cudf::detail::hash_set;  ///< Implementation type
+
+  hash_set() = delete;
+  ~hash_set();
+  hash_set(hash_set const&)            = delete;
+  hash_set(hash_set&&)                 = delete;
+  hash_set& operator=(hash_set const&) = delete;
+  hash_set& operator=(hash_set&&)      = delete;
+
+  /**
+   * @brief Builds the hash set of the rows of `haystack`.
+   *
+   * @note The `haystack` table must remain valid while the hash set is used.
+   *
+   * @throws std::invalid_argument If `haystack` has no columns
+   *
+   * @param haystack The table containing the search space
+   * @param compare_nulls Control whether nulls should be compared as equal or not
+   * @param compare_nans Control whether floating-point NaNs values should be compared as equal or
+   * not
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   */
+  hash_set(table_view const& haystack,
+           null_equality compare_nulls  = null_equality::EQUAL,
+           nan_equality compare_nans    = nan_equality::ALL_EQUAL,
+           rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Check if rows in the given `needles` table exist in the haystack.
+   *
+   * @throws cudf::data_type_error If column types of the haystack and `needles` don't match
+   *
+   * @param needles A table of rows whose existence to check in the search space
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return A non-nullable BOOL column indicating if each row in `needles` has a matching row in
+   * the haystack
+   */
+  [[nodiscard]] std::unique_ptr<column> contains(
+    table_view const& needles,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  std::unique_ptr<impl_type const> _impl;  ///< Hash set implementation
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -171,6 +171,71 @@ std::unique_ptr<table> stable_sort_by_key(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Computes the row indices of the first `k` rows of `keys` in lexicographical sorted order.
+ *
+ * The result is the same as the first `k` rows of `stable_sorted_order(keys, ...)`, but only the
+ * rows that may be among the first `k` are sorted: a sample of the keys fixes a threshold row and
+ * the rows ordered after the threshold are discarded before sorting. When `k` is close to the
+ * number of rows, the whole table is sorted instead.
+ *
+ * @code{.pseudo}
+ * keys   = [40, 10, 30, 20, 50]
+ * top_k_order(keys, 2, {order::DESCENDING}) = [4, 0]
+ * @endcode
+ *
+ * @throws std::invalid_argument if `k` is negative
+ *
+ * @param keys The table that determines the ordering
+ * @param k Number of row indices to return. If `k` exceeds the number of rows, all of them are
+ * returned.
+ * @param column_order The desired order for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * column in `keys`. Size must be equal to `keys.num_columns()` or empty. If empty, all columns
+ * will be sorted with `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return A non-nullable column of `min(k, keys.num_rows())` `size_type` row indices
+ */
+std::unique_ptr<column> top_k_order(
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the first `k` rows of `values` in the lexicographical order of the rows of
+ * `keys`.
+ *
+ * This is the `ORDER BY ... LIMIT k` of `values`, computed without sorting all the rows.
+ *
+ * @throws cudf::logic_error if `values.num_rows() != keys.num_rows()`
+ * @throws std::invalid_argument if `k` is negative
+ *
+ * @param values The table to take the rows from
+ * @param keys The table that determines the ordering
+ * @param k Number of rows to return
+ * @param column_order The desired order for each column in `keys`. Size must be equal to
+ * `keys.num_columns()` or empty. If empty, all columns are sorted in ascending order.
+ * @param null_precedence The desired order of a null element compared to other elements for each
+ * column in `keys`. Size must be equal to `keys.num_columns()` or empty. If empty, all columns
+ * will be sorted with `null_order::BEFORE`.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return The first `min(k, values.num_rows())` rows of `values` in the order of `keys`
+ */
+std::unique_ptr<table> top_k(
+  table_view const& values,
+  table_view const& keys,
+  size_type k,
+  std::vector<order> const& column_order         = {},
+  std::vector<null_order> const& null_precedence = {},
+  rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Computes the ranks of input column in sorted order.
  *
@@ -345,5 +410,103 @@ std::unique_ptr<table> stable_segmented_sort_by_key(
   rmm::cuda_stream_view stream                   = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr              = rmm::mr::get_current_device_resource());
 
+namespace detail {
+struct external_sort_state;
+}  // namespace detail
+
+/**
+ * @brief Sorts a table too large to fit in device memory
+ *
+ * The table is pushed in batches with `push`. Batches are buffered until they exceed a fraction of
+ * `memory_limit`; the buffered rows are then sorted into a run which is spilled to pinned host
+ * memory. Once all the batches have been pushed, the sorted table is returned in chunks by
+ * `get_next`, each produced by merging the next rows of the runs with `cudf::merge` so that only
+ * a bounded part of every run is on device at a time.
+ *
+ * The order of rows with equal keys is not specified.
+ *
+ * @code{.cpp}
+ * auto sorter = cudf::external_sort({0}, {cudf::order::ASCENDING}, {}, 4ul << 30);
+ * for (auto const& batch : batches) {
+ *   sorter.push(batch);
+ * }
+ * while (sorter.has_next()) {
+ *   auto const chunk = sorter.get_next();
+ *   // write the chunk
+ * }
+ * @endcode
+ */
+class external_sort {
+ public:
+  /**
+   * @brief Construct an `external_sort` object
+   *
+   * @throws std::invalid_argument if `key_columns` is empty
+   * @throws std::invalid_argument if `column_order` or `null_precedence` is not empty and does
+   * not have the size of `key_columns`
+   * @throws std::invalid_argument if `memory_limit` is 0
+   *
+   * @param key_columns Indices of the columns of the pushed tables to sort by
+   * @param column_order The desired sort order for each key column. If empty, all the keys are
+   * sorted in ascending order.
+   * @param null_precedence The desired order of null compared to other elements for each key
+   * column. If empty, all the keys are sorted in `null_order::BEFORE`.
+   * @param memory_limit Approximate number of bytes of device memory the sort may use, including
+   * the returned chunks
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned tables' device memory
+   */
+  external_sort(std::vector<size_type> key_columns,
+                std::vector<order> column_order,
+                std::vector<null_order> null_precedence,
+                std::size_t memory_limit,
+                rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Destructor declared here because `external_sort_state` is incomplete at this stage
+   */
+  ~external_sort();
+
+  /**
+   * @brief Adds a batch of rows to sort
+   *
+   * The rows are copied, so `input` may be freed after the call returns. A single batch should
+   * not be larger than a quarter of `memory_limit`.
+   *
+   * @throws std::invalid_argument if the columns of `input` do not have the types of the
+   * previously pushed batches
+   * @throws std::out_of_range if a key column index is not a column of `input`
+   * @throws cudf::logic_error if called after `has_next` or `get_next`
+   *
+   * @param input Rows to sort
+   */
+  void push(table_view const& input);
+
+  /**
+   * @brief Checks if there are sorted chunks left to be returned
+   *
+   * The first call ends the pushing of batches.
+   *
+   * @return true if `get_next` returns another chunk
+   */
+  [[nodiscard]] bool has_next();
+
+  /**
+   * @brief Returns the next chunk of the sorted table
+   *
+   * The first call ends the pushing of batches. Concatenating the chunks in the order returned
+   * gives the sorted table.
+   *
+   * @throws cudf::logic_error if there are no chunks left
+   *
+   * @return The next sorted rows
+   */
+  std::unique_ptr<table> get_next();
+
+ private:
+  std::unique_ptr<detail::external_sort_state> state;
+};
+
 /** @} */  // end of group
 }  // namespace cudf
@@ -16,13 +16,19 @@
 
 #pragma once
 
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <vector>
 
 namespace cudf {
@@ -208,6 +214,85 @@ std::unique_ptr<table> apply_boolean_mask(
   column_view const& boolean_mask,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the number of bytes of temporary device storage needed by the fixed-capacity
+ * `apply_boolean_mask` to filter `num_rows` rows of type `type`.
+ *
+ * @throws cudf::logic_error if `type` is not a fixed-width type
+ *
+ * @param type Type of the column to filter
+ * @param num_rows Number of rows of the column to filter
+ * @return Size of the temporary storage in bytes
+ */
+[[nodiscard]] std::size_t apply_boolean_mask_temp_storage_size(data_type type, size_type num_rows);
+
+/**
+ * @brief Filters the fixed-width column `input` into the preallocated column `output` using
+ * `boolean_mask`, and writes the number of rows kept to `output_size` in device memory.
+ *
+ * Element `i` of `input` is copied to the next row of `output` if element `i` of `boolean_mask`
+ * is non-null and `true`. The operation is stable. Rows of `output` past the rows kept are left
+ * unchanged.
+ *
+ * Unlike the table overload, this neither allocates memory nor copies the number of rows kept to
+ * the host, so it can be captured into a CUDA graph: `output` and `temp_storage` are sized for all
+ * the rows of `input`, and the operations captured after it read the number of rows kept from
+ * `output_size` on the device.
+ *
+ * @throws cudf::logic_error if `input` is not a fixed-width column without a null mask
+ * @throws cudf::logic_error if `boolean_mask` is not of type `type_id::BOOL8`
+ * @throws cudf::logic_error if `input.size() != boolean_mask.size()`
+ * @throws cudf::logic_error if `output` does not have the type of `input`, has fewer rows than
+ * `input` or has a null mask
+ * @throws cudf::logic_error if `temp_storage` is smaller than
+ * `apply_boolean_mask_temp_storage_size(input.type(), input.size())`
+ *
+ * @param[in] input The input column to filter
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used as a mask to filter
+ * the `input`
+ * @param[out] output Column receiving the rows kept
+ * @param[out] output_size Device memory receiving the number of rows kept
+ * @param[in] temp_storage Temporary device storage of at least
+ * `apply_boolean_mask_temp_storage_size(input.type(), input.size())` bytes
+ * @param[in] stream CUDA stream used for device memory operations and kernel launches
+ */
+void apply_boolean_mask(column_view const& input,
+                        column_view const& boolean_mask,
+                        mutable_column_view const& output,
+                        size_type* output_size,
+                        device_span<std::byte> temp_storage,
+                        rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+/**
+ * @brief Filters `input` using `boolean_mask`, then gathers the rows of the filtered table using
+ * `gather_map`.
+ *
+ * Returns the same table as `gather(apply_boolean_mask(input, boolean_mask), gather_map,
+ * bounds_policy)`, but composes the two row mappings so that the output is materialized once,
+ * without the intermediate filtered table. Entry `i` of `gather_map` refers to the `i`th row of
+ * `input` for which `boolean_mask` is valid and `true`. As in `gather()`, a negative index `i` of
+ * a signed `gather_map` refers to row `i + n` of the `n` filtered rows.
+ *
+ * @throws cudf::logic_error if `input.num_rows() != boolean_mask.size()`.
+ * @throws cudf::logic_error if `boolean_mask` is not `type_id::BOOL8` type.
+ * @throws cudf::logic_error if `gather_map` is not an integer column or contains nulls.
+ *
+ * @param[in] input The input table_view to filter and gather from
+ * @param[in] gather_map Column of row indices into the filtered table
+ * @param[in] boolean_mask A nullable column_view of type type_id::BOOL8 used as a mask to filter
+ * the `input`
+ * @param[in] bounds_policy Policy for indices of `gather_map` outside the filtered table.
+ * `NULLIFY` produces null rows for them, `DONT_CHECK` requires all indices to be in bounds.
+ * @param[in] mr Device memory resource used to allocate the returned table's device memory
+ * @return Table with one row per entry of `gather_map`
+ */
+std::unique_ptr<table> filter_gather(
+  table_view const& input,
+  column_view const& gather_map,
+  column_view const& boolean_mask,
+  out_of_bounds_policy bounds_policy = out_of_bounds_policy::DONT_CHECK,
+  rmm::device_async_resource_ref mr  = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Choices for drop_duplicates API for retainment of duplicate rows
  */
@@ -218,6 +303,77 @@ enum class duplicate_keep_option {
   KEEP_NONE      ///< Keep no (remove all) occurrences of duplicates
 };
 
+/**
+ * @brief Which row of each group of duplicates `distinct_by_extremum()` keeps
+ */
+enum class keep_extremum : bool {
+  MIN,  ///< Keep the row with the smallest value of the ordering column
+  MAX   ///< Keep the row with the largest value of the ordering column
+};
+
+/**
+ * @brief Hints about the input of `distinct()` and `stable_distinct()`.
+ *
+ * The hints let the implementation skip work the caller has already done. They do not change
+ * the set of rows returned, provided they are accurate.
+ */
+class distinct_options {
+  // hash of each input row, computed over the key columns
+  std::optional<column_view> row_hashes;
+
+  // equivalent key rows are adjacent to each other in the input
+  bool keys_are_sorted = false;
+
+ public:
+  /**
+   * @brief Default constructor.
+   */
+  explicit distinct_options() = default;
+
+  /**
+   * @brief Returns the precomputed hashes of the input rows, if any.
+   *
+   * @return Column of row hashes, or an empty optional if the rows are to be hashed
+   */
+  [[nodiscard]] std::optional<column_view> const& get_row_hashes() const { return row_hashes; }
+
+  /**
+   * @brief Returns whether equivalent key rows are adjacent in the input.
+   *
+   * @return true if the keys are sorted or clustered
+   */
+  [[nodiscard]] bool get_keys_are_sorted() const { return keys_are_sorted; }
+
+  /**
+   * @brief Sets precomputed hashes of the input rows.
+   *
+   * The hashes are used in place of hashing the key columns, for example when the rows were
+   * already hashed to partition them. Rows with equivalent keys must have equal hashes under
+   * the `nulls_equal` and `nans_equal` settings of the call.
+   *
+   * @throw std::invalid_argument if the column is not a `UINT32` column without nulls
+   *
+   * @param hashes `UINT32` column with one hash per input row
+   */
+  void set_row_hashes(column_view const& hashes)
+  {
+    CUDF_EXPECTS(hashes.type().id() == type_id::UINT32 && !hashes.has_nulls(),
+                 "Row hashes must be a UINT32 column without nulls",
+                 std::invalid_argument);
+    row_hashes = hashes;
+  }
+
+  /**
+   * @brief Sets whether equivalent key rows are adjacent in the input.
+   *
+   * When set, duplicates are removed by comparing adjacent rows, as `unique()` does, instead of
+   * building a hash table of the rows.
+   *
+   * @param sorted true if the input is sorted or clustered by the key columns
+   */
+  void set_keys_are_sorted(bool sorted) { keys_are_sorted = sorted; }
+};
+
 /**
  * @brief Create a new table with consecutive duplicate rows removed.
  *
@@ -279,6 +435,73 @@ std::unique_ptr<table> distinct(
   nan_equality nans_equal           = nan_equality::ALL_EQUAL,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, using hints about the input.
+ *
+ * Returns the same rows as `distinct(table_view const&, std::vector<size_type> const&,
+ * duplicate_keep_option, null_equality, nan_equality, rmm::device_async_resource_ref)`.
+ * If the keys are sorted and NaNs compare equal, the rows are returned in input order.
+ *
+ * @throw std::invalid_argument if the row hashes in `options` do not have one hash per row
+ *
+ * @param input The input table
+ * @param keys Vector of indices indicating key columns in the `input` table
+ * @param options Hints about the input rows
+ * @param keep Copy any, first, last, or none of the found duplicates
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param mr Device memory resource used to allocate the returned table
+ * @return Table with distinct rows in an unspecified order
+ */
+std::unique_ptr<table> distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  distinct_options const& options,
+  duplicate_keep_option keep        = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal         = null_equality::EQUAL,
+  nan_equality nans_equal           = nan_equality::ALL_EQUAL,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Create a new table without duplicate rows, keeping from each group of duplicates the
+ * row with the smallest or largest value of an ordering column.
+ *
+ * This is equivalent to sorting by the keys and `order_by` and keeping the first or last row of
+ * each group, but without sorting. For example, it keeps the latest record of each key when
+ * `order_by` is a timestamp column and `keep` is `MAX`.
+ *
+ * Null values of `order_by` are never kept over valid values. Among rows with equal values of
+ * `order_by`, or with only null values, the row with the smallest index is kept. NaN values are
+ * larger than all other floating-point values.
+ *
+ * @code{.pseudo}
+ * keys     = [1, 2, 1, 2, 1]
+ * order_by = [5, 3, 9, 4, 7]
+ * distinct_by_extremum([keys], {0}, order_by, MAX) = [[1, 2]] in an unspecified order,
+ *                                                   from rows 2 and 3
+ * @endcode
+ *
+ * @throw std::invalid_argument if `order_by` does not have one row per input row
+ * @throw cudf::data_type_error if `order_by` is not a fixed-width column that can be ordered
+ *
+ * @param input The input table
+ * @param keys Vector of indices indicating key columns in the `input` table
+ * @param order_by Column whose smallest or largest value selects the row kept for each key
+ * @param keep Whether to keep the row with the smallest or the largest `order_by` value
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param mr Device memory resource used to allocate the returned table
+ * @return Table with distinct rows in an unspecified order
+ */
+std::unique_ptr<table> distinct_by_extremum(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  column_view const& order_by,
+  keep_extremum keep,
+  null_equality nulls_equal         = null_equality::EQUAL,
+  nan_equality nans_equal           = nan_equality::ALL_EQUAL,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Create a column of indices of all distinct rows in the input table.
  *
@@ -331,6 +554,33 @@ std::unique_ptr<table> stable_distinct(
   nan_equality nans_equal           = nan_equality::ALL_EQUAL,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a new table without duplicate rows, preserving input order, using hints about
+ * the input.
+ *
+ * Returns the same table as `stable_distinct(table_view const&, std::vector<size_type> const&,
+ * duplicate_keep_option, null_equality, nan_equality, rmm::device_async_resource_ref)`.
+ *
+ * @throw std::invalid_argument if the row hashes in `options` do not have one hash per row
+ *
+ * @param input The input table
+ * @param keys Vector of indices indicating key columns in the `input` table
+ * @param options Hints about the input rows
+ * @param keep Copy any, first, last, or none of the found duplicates
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN elements should be considered as equal
+ * @param mr Device memory resource used to allocate the returned table
+ * @return Table with distinct rows, preserving input order
+ */
+std::unique_ptr<table> stable_distinct(
+  table_view const& input,
+  std::vector<size_type> const& keys,
+  distinct_options const& options,
+  duplicate_keep_option keep        = duplicate_keep_option::KEEP_ANY,
+  null_equality nulls_equal         = null_equality::EQUAL,
+  nan_equality nans_equal           = nan_equality::ALL_EQUAL,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Count the number of consecutive groups of equivalent rows in a column.
  *
@@ -398,5 +648,33 @@ cudf::size_type distinct_count(column_view const& input,
 cudf::size_type distinct_count(table_view const& input,
                                null_equality nulls_equal = null_equality::EQUAL);
 
+/**
+ * @brief Estimate the number of distinct values summarized by each HyperLogLog sketch.
+ *
+ * The sketches are produced by the HYPERLOGLOG and MERGE_HYPERLOGLOG aggregations. Approximate
+ * counts need a fixed `2^precision` bytes of state per group, whereas an exact `distinct_count`
+ * or NUNIQUE needs a hash set of all the distinct values.
+ *
+ * Small cardinalities are estimated by linear counting of the empty registers. Null sketches
+ * produce null estimates.
+ *
+ * @code{.pseudo}
+ * values = [1, 2, 2, 3, 3, 3]
+ * sketch = reduce(values, make_hyperloglog_aggregation(12))
+ * approx_distinct_count([sketch]) = [3]
+ * @endcode
+ *
+ * @throws std::invalid_argument if `sketches` is not a `LIST<INT8>` column
+ *
+ * @param sketches The `LIST<INT8>` column of sketches
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return INT64 column of the estimated number of distinct values of each sketch
+ */
+std::unique_ptr<column> approx_distinct_count(
+  column_view const& sketches,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */
 }  // namespace cudf
@@ -52,6 +52,36 @@ std::unique_ptr<column> to_floats(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new numeric column by parsing float values from each string
+ * in the provided strings column and setting null entries for invalid strings.
+ *
+ * This is the same as calling `is_float` and `to_floats` except the strings
+ * are checked and parsed in a single pass.
+ *
+ * Any null or invalid entries result in corresponding null entries in the output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['123', '-456.5', '', 'A', '1e5', 'NaN']
+ * r = try_to_floats(s, data_type{type_id::FLOAT64})
+ * r is [123.0, -456.5, null, null, 100000.0, NaN]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not float type.
+ *
+ * @param input Strings instance for this operation
+ * @param output_type Type of float numeric column to return
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with floats converted from strings
+ */
+std::unique_ptr<column> try_to_floats(
+  strings_column_view const& input,
+  data_type output_type,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a new strings column converting the float values from the
  * provided column into strings.
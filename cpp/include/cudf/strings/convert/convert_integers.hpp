@@ -59,6 +59,38 @@ std::unique_ptr<column> to_integers(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a new integer numeric column parsing integer values from the
+ * provided strings column and setting null entries for invalid strings.
+ *
+ * This is the same as calling `is_integer(input, output_type)` and `to_integers`
+ * except the strings are checked and parsed in a single pass.
+ *
+ * A string is valid if it has only characters [0-9] after an optional '-' or '+'
+ * prefix and its value fits within `output_type`. Any null or invalid entries result
+ * in corresponding null entries in the output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ['123', '-456', '', 'A', '+7', '300']
+ * r = try_to_integers(s, data_type{type_id::INT8})
+ * r is [123, null, null, null, 7, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if output_type is not integral type.
+ *
+ * @param input Strings instance for this operation
+ * @param output_type Type of integer numeric column to return
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New column with integers converted from strings
+ */
+std::unique_ptr<column> try_to_integers(
+  strings_column_view const& input,
+  data_type output_type,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns a new strings column converting the integer values from the
  * provided column into strings.
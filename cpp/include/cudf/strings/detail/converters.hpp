@@ -36,6 +36,15 @@ std::unique_ptr<column> to_integers(strings_column_view const& strings,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc try_to_integers(strings_column_view const&,data_type,rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> try_to_integers(strings_column_view const& input,
+                                        data_type output_type,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc from_integers(strings_column_view const&,rmm::device_async_resource_ref)
  *
@@ -55,6 +64,15 @@ std::unique_ptr<column> to_floats(strings_column_view const& strings,
                                   rmm::cuda_stream_view stream,
                                   rmm::device_async_resource_ref mr);
 
+/**
+ * @copydoc try_to_floats(strings_column_view const&,data_type,rmm::cuda_stream_view,
+ * rmm::device_async_resource_ref)
+ */
+std::unique_ptr<column> try_to_floats(strings_column_view const& input,
+                                      data_type output_type,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr);
+
 /**
  * @copydoc from_floats(strings_column_view const&,rmm::device_async_resource_ref)
  *
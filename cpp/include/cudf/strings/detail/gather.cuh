@@ -66,6 +66,7 @@ __forceinline__ __device__ uint4 load_uint4(char const* ptr)
  *
  * @tparam StringIterator Iterator should produce `string_view` objects.
  * @tparam MapIterator Iterator for retrieving integer indices of the `StringIterator`.
+ * @tparam OffsetIterator Iterator or pointer for retrieving the output offsets.
  *
  * @param strings_begin Start of the iterator to retrieve `string_view` instances.
  * @param out_chars Output buffer for gathered characters.
@@ -73,10 +74,10 @@ __forceinline__ __device__ uint4 load_uint4(char const* ptr)
  * @param string_indices Start of index iterator.
  * @param total_out_strings Number of output strings to be gathered.
  */
-template <typename StringIterator, typename MapIterator>
+template <typename StringIterator, typename MapIterator, typename OffsetIterator>
 CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
                                                  char* out_chars,
-                                                 cudf::detail::input_offsetalator const out_offsets,
+                                                 OffsetIterator const out_offsets,
                                                  MapIterator string_indices,
                                                  size_type total_out_strings)
 {
@@ -92,8 +93,8 @@ CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
   uint4* out_chars_aligned    = reinterpret_cast<uint4*>(out_chars - alignment_offset);
 
   for (size_type istring = global_warp_id; istring < total_out_strings; istring += nwarps) {
-    auto const out_start = out_offsets[istring];
-    auto const out_end   = out_offsets[istring + 1];
+    int64_t const out_start = out_offsets[istring];
+    int64_t const out_end   = out_offsets[istring + 1];
 
     // This check is necessary because string_indices[istring] may be out of bound.
     if (out_start == out_end) continue;
@@ -148,6 +149,7 @@ CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
  *
  * @tparam StringIterator Iterator should produce `string_view` objects.
  * @tparam MapIterator Iterator for retrieving integer indices of the `StringIterator`.
+ * @tparam OffsetIterator Iterator or pointer for retrieving the output offsets.
  *
  * @param strings_begin Start of the iterator to retrieve `string_view` instances.
  * @param out_chars Output buffer for gathered characters.
@@ -155,10 +157,13 @@ CUDF_KERNEL void gather_chars_fn_string_parallel(StringIterator strings_begin,
  * @param string_indices Start of index iterator.
  * @param total_out_strings Number of output strings to be gathered.
  */
-template <int strings_per_threadblock, typename StringIterator, typename MapIterator>
+template <int strings_per_threadblock,
+          typename StringIterator,
+          typename MapIterator,
+          typename OffsetIterator>
 CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
                                                char* out_chars,
-                                               cudf::detail::input_offsetalator const out_offsets,
+                                               OffsetIterator const out_offsets,
                                                MapIterator string_indices,
                                                size_type total_out_strings)
 {
@@ -207,6 +212,7 @@ CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
  *
  * @tparam StringIterator Iterator should produce `string_view` objects.
  * @tparam MapIterator Iterator for retrieving integer indices of the `StringIterator`.
+ * @tparam OffsetIterator Iterator or pointer for retrieving the output offsets.
  *
  * @param strings_begin Start of the iterator to retrieve `string_view` instances.
  * @param map_begin Start of index iterator.
@@ -217,11 +223,11 @@ CUDF_KERNEL void gather_chars_fn_char_parallel(StringIterator strings_begin,
  * @param mr Device memory resource used to allocate the returned column's device memory.
  * @return New chars column fit for a strings column.
  */
-template <typename StringIterator, typename MapIterator>
+template <typename StringIterator, typename MapIterator, typename OffsetIterator>
 rmm::device_uvector<char> gather_chars(StringIterator strings_begin,
                                        MapIterator map_begin,
                                        MapIterator map_end,
-                                       cudf::detail::input_offsetalator const offsets,
+                                       OffsetIterator const offsets,
                                        int64_t chars_bytes,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
@@ -259,6 +265,42 @@ rmm::device_uvector<char> gather_chars(StringIterator strings_begin,
   return chars_data;
 }
 
+/**
+ * @brief Returns a new chars column using the specified indices to select
+ * strings from the input iterator.
+ *
+ * The kernels are instantiated for the type of the `offsets` column so the
+ * offsets are read directly rather than through an offsets normalizing iterator.
+ *
+ * @tparam StringIterator Iterator should produce `string_view` objects.
+ * @tparam MapIterator Iterator for retrieving integer indices of the `StringIterator`.
+ *
+ * @param strings_begin Start of the iterator to retrieve `string_view` instances.
+ * @param map_begin Start of index iterator.
+ * @param map_end End of index iterator.
+ * @param offsets The INT32 or INT64 offsets column to be associated with the output chars.
+ * @param chars_bytes The total number of bytes for the output chars column.
+ * @param stream CUDA stream used for device memory operations and kernel launches.
+ * @param mr Device memory resource used to allocate the returned column's device memory.
+ * @return New chars column fit for a strings column.
+ */
+template <typename StringIterator, typename MapIterator>
+rmm::device_uvector<char> gather_chars(StringIterator strings_begin,
+                                       MapIterator map_begin,
+                                       MapIterator map_end,
+                                       column_view const& offsets,
+                                       int64_t chars_bytes,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  if (offsets.type().id() == type_id::INT64) {
+    return gather_chars(
+      strings_begin, map_begin, map_end, offsets.data<int64_t>(), chars_bytes, stream, mr);
+  }
+  return gather_chars(
+    strings_begin, map_begin, map_end, offsets.data<int32_t>(), chars_bytes, stream, mr);
+}
+
 /**
  * @brief Returns a new strings column using the specified indices to select
  * elements from the `strings` column.
@@ -310,10 +352,13 @@ std::unique_ptr<cudf::column> gather(strings_column_view const& strings,
     sizes_itr, sizes_itr + output_count, stream, mr);
 
   // build chars column
-  auto const offsets_view =
-    cudf::detail::offsetalator_factory::make_input_iterator(out_offsets_column->view());
-  auto out_chars_data = gather_chars(
-    d_strings->begin<string_view>(), begin, end, offsets_view, total_bytes, stream, mr);
+  auto out_chars_data = gather_chars(d_strings->begin<string_view>(),
+                                     begin,
+                                     end,
+                                     out_offsets_column->view(),
+                                     total_bytes,
+                                     stream,
+                                     mr);
 
   return make_strings_column(output_count,
                              std::move(out_offsets_column),
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/strings/string_headers.hpp>
+#include <cudf/strings/string_view.cuh>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+/**
+ * @brief Returns the string described by a header
+ *
+ * The returned string references the header itself when the string is inline
+ * so the header must outlive the returned object.
+ *
+ * @param header Header of the string
+ * @param chars Characters buffer of the strings which are not inline
+ * @return The string
+ */
+__device__ inline string_view to_string_view(string_header const& header, char const* chars)
+{
+  return header.is_inline() ? string_view{header.data, header.size}
+                            : string_view{chars + header.offset(), header.size};
+}
+
+/**
+ * @brief Compares two strings described by headers
+ *
+ * The bytes stored in the headers are compared first so the characters
+ * buffers are only read when the prefixes of the strings are equal.
+ *
+ * @param lhs Header of the first string
+ * @param lhs_chars Characters buffer of the first string
+ * @param rhs Header of the second string
+ * @param rhs_chars Characters buffer of the second string
+ * @return Negative, zero or positive as for `string_view::compare`
+ */
+__device__ inline int compare(string_header const& lhs,
+                              char const* lhs_chars,
+                              string_header const& rhs,
+                              char const* rhs_chars)
+{
+  auto const both_inline = lhs.is_inline() && rhs.is_inline();
+  auto const ptr1        = reinterpret_cast<unsigned char const*>(lhs.data);
+  auto const ptr2        = reinterpret_cast<unsigned char const*>(rhs.data);
+  auto const limit       = both_inline ? string_header::inline_size : string_header::prefix_size;
+  auto const bytes       = lhs.size < rhs.size ? lhs.size : rhs.size;
+  for (int32_t idx = 0; idx < bytes && idx < limit; ++idx) {
+    if (ptr1[idx] != ptr2[idx]) {
+      return static_cast<int>(ptr1[idx]) - static_cast<int>(ptr2[idx]);
+    }
+  }
+  if (both_inline) { return lhs.size - rhs.size; }
+  return to_string_view(lhs, lhs_chars).compare(to_string_view(rhs, rhs_chars));
+}
+
+/**
+ * @brief Returns true if two strings described by headers are equal
+ *
+ * Strings of different sizes or prefixes are resolved from the headers alone.
+ *
+ * @param lhs Header of the first string
+ * @param lhs_chars Characters buffer of the first string
+ * @param rhs Header of the second string
+ * @param rhs_chars Characters buffer of the second string
+ * @return True if the strings are equal
+ */
+__device__ inline bool is_equal(string_header const& lhs,
+                                char const* lhs_chars,
+                                string_header const& rhs,
+                                char const* rhs_chars)
+{
+  if (lhs.size != rhs.size) { return false; }
+  return compare(lhs, lhs_chars, rhs, rhs_chars) == 0;
+}
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -99,7 +99,14 @@ std::unique_ptr<column> make_strings_column(IndexPairIterator begin,
     (null_count > 0) ? std::move(new_nulls.first) : rmm::device_buffer{0, stream, mr};
 
   // build chars column
-  auto chars_data = [d_offsets, bytes = bytes, begin, strings_count, null_count, stream, mr] {
+  auto chars_data = [d_offsets,
+                     offsets_view = offsets_column->view(),
+                     bytes        = bytes,
+                     begin,
+                     strings_count,
+                     null_count,
+                     stream,
+                     mr] {
     auto const avg_bytes_per_row = bytes / std::max(strings_count - null_count, 1);
     // use a character-parallel kernel for long string lengths
     if (avg_bytes_per_row > FACTORY_BYTES_PER_ROW_THRESHOLD) {
@@ -111,7 +118,7 @@ std::unique_ptr<column> make_strings_column(IndexPairIterator begin,
       return gather_chars(str_begin,
                           thrust::make_counting_iterator<size_type>(0),
                           thrust::make_counting_iterator<size_type>(strings_count),
-                          d_offsets,
+                          offsets_view,
                           bytes,
                           stream,
                           mr);
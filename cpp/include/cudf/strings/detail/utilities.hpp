@@ -96,6 +96,20 @@ int64_t get_offset_value(cudf::column_view const& offsets,
                          size_type index,
                          rmm::cuda_stream_view stream);
 
+/**
+ * @brief Returns the average number of bytes in the non-null rows of a strings column
+ *
+ * Functions compare this with a tuned threshold to choose between processing each
+ * string with a single thread and processing each string with a warp (or a block) of
+ * threads which performs better for longer strings.
+ * Only the bytes of the rows in the view are counted so sliced columns are measured correctly.
+ *
+ * @param input Strings column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Average number of bytes per non-null row or 0 if all rows are null
+ */
+int64_t average_bytes_per_row(strings_column_view const& input, rmm::cuda_stream_view stream);
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
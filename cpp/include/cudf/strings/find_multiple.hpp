@@ -61,6 +61,68 @@ std::unique_ptr<column> find_multiple(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns a column of boolean values for each string where true indicates
+ * at least one of the target strings was found within that string.
+ *
+ * The characters of each string are only read once regardless of the number of targets.
+ * If any target is an empty string, true is returned for all non-null entries.
+ *
+ * Any null string entries return corresponding null entries in the output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "def", "ghi"]
+ * t = ["ab", "f", "xyz"]
+ * r = contains_any(s, t)
+ * r is now [true, true, false]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets` is empty or contains nulls
+ *
+ * @param input Strings instance for this operation
+ * @param targets Strings to search for in each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New BOOL8 column
+ */
+std::unique_ptr<column> contains_any(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the index of the first target string found within each string.
+ *
+ * `output[i]` is the smallest `j` such that `targets[j]` is found in `input[i]`
+ * or -1 if none of the targets are found.
+ * The characters of each string are only read once regardless of the number of targets.
+ *
+ * Any null string entries return corresponding null entries in the output column.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["abc", "def", "ghi"]
+ * t = ["xyz", "c", "ab", "e"]
+ * r = find_any(s, t)
+ * r is now [1, 3, -1]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `targets` is empty or contains nulls
+ *
+ * @param input Strings instance for this operation
+ * @param targets Strings to search for in each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New INT32 column of target indices
+ */
+std::unique_ptr<column> find_any(
+  strings_column_view const& input,
+  strings_column_view const& targets,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,151 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/side_type.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_modify
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Sequence of character-level operations applied to each string in a single pass
+ *
+ * Each operation consumes the characters produced by the previous operation so
+ * a pipeline produces the same result as calling the individual APIs one after
+ * the other without building the intermediate strings columns.
+ *
+ * A pipeline holds at most `max_steps` operations and adding more throws
+ * a `cudf::logic_error`.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["  Hello World  ", " ABC_abc "]
+ * p = transform_pipeline().to_lower().strip().replace({"_", "l"}, {" ", "L"})
+ * r = apply_pipeline(s, p)
+ * r is now ["heLLo worLd", "abc abc"]
+ * @endcode
+ */
+class transform_pipeline {
+ public:
+  static constexpr size_type max_steps = 8;  ///< Maximum number of operations in a pipeline
+
+  /**
+   * @brief Kinds of operations in a pipeline
+   */
+  enum class step_kind : int8_t {
+    LOWER,   ///< Same as `to_lower()`
+    UPPER,   ///< Same as `to_upper()`
+    STRIP,   ///< Same as `strip()`
+    REPLACE  ///< Same as `replace()` with multiple targets
+  };
+
+  /**
+   * @brief Parameters of a single operation
+   */
+  struct step {
+    step_kind kind;                    ///< The operation
+    side_type side;                    ///< Ends of the string to strip
+    std::string to_strip;              ///< Characters to strip
+    std::vector<std::string> targets;  ///< Strings to replace
+    std::vector<std::string> repls;    ///< Replacement strings
+  };
+
+  /**
+   * @brief Adds a conversion of upper case characters to lower case
+   *
+   * @return This pipeline
+   */
+  transform_pipeline& to_lower();
+
+  /**
+   * @brief Adds a conversion of lower case characters to upper case
+   *
+   * @return This pipeline
+   */
+  transform_pipeline& to_upper();
+
+  /**
+   * @brief Adds the removal of characters from the beginning or end of the strings
+   *
+   * @param side Ends of the strings to strip from
+   * @param to_strip UTF-8 encoded characters to strip;
+   *        the empty string indicates whitespace characters
+   * @return This pipeline
+   */
+  transform_pipeline& strip(side_type side = side_type::BOTH, std::string to_strip = "");
+
+  /**
+   * @brief Adds the replacement of each target string with its corresponding replacement
+   *
+   * At each position the targets are checked in order and the first match is replaced.
+   *
+   * @throw cudf::logic_error if `targets` is empty or contains an empty string
+   * @throw cudf::logic_error if `repls` does not have 1 element or as many as `targets`
+   *
+   * @param targets Strings to search for
+   * @param repls Replacement strings; a single string replaces all the targets
+   * @return This pipeline
+   */
+  transform_pipeline& replace(std::vector<std::string> targets, std::vector<std::string> repls);
+
+  /**
+   * @brief Returns the operations of this pipeline
+   */
+  [[nodiscard]] std::vector<step> const& steps() const;
+
+ private:
+  transform_pipeline& add_step(step&& new_step);
+
+  std::vector<step> _steps;
+};
+
+/**
+ * @brief Applies the operations of a pipeline to each string
+ *
+ * The output of each row is sized and written in two passes over the input
+ * regardless of the number of operations in the pipeline.
+ *
+ * Any null string entries return corresponding null output column entries.
+ *
+ * @param input Strings column for this operation
+ * @param pipeline Operations to apply to each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+std::unique_ptr<column> apply_pipeline(
+  strings_column_view const& input,
+  transform_pipeline const& pipeline,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
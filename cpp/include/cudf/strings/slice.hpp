@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/string_view_array.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -112,6 +113,37 @@ std::unique_ptr<column> slice_strings(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns substrings of the strings in the provided column without
+ * copying any characters.
+ *
+ * The character positions of each substring are `[start,stop)` as in `slice_strings`.
+ * A negative `start` is treated as 0 and a negative `stop` indicates the end of each string.
+ * The returned rows reference the characters of `input` which must outlive them.
+ *
+ * Null string entries will return null output entries.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s = ["hello", "goodbye"]
+ * r = slice_strings_view(s,2,6)
+ * r.materialize() is ["llo","odby"]
+ * @endcode
+ *
+ * @param input Strings column for this operation
+ * @param start First character position to begin the substring
+ * @param stop Last character position (exclusive) to end the substring
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned rows
+ * @return Rows referencing the substrings within `input`
+ */
+string_view_array slice_strings_view(
+  strings_column_view const& input,
+  size_type start,
+  size_type stop                    = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
@@ -15,6 +15,7 @@
  */
 #pragma once
 
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -243,6 +244,147 @@ std::unique_ptr<column> rsplit_record(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the byte positions of the tokens in each string
+ *
+ * The tokens are identified exactly as `split_record` would identify them so
+ * the result can be passed to `split_record_with_index`, `split_with_index`, or
+ * `get_token_with_index` to build tokens without searching the strings again.
+ * The number of tokens in each row is the size of its list and can be retrieved
+ * with `cudf::lists::count_elements`.
+ *
+ * Each row of the output is a list of structs with two INT32 fields: the byte
+ * position of the start and the end of each token relative to the start of
+ * the string.
+ *
+ * @code{.pseudo}
+ * s = ["a_bc_def", "a__bc", null]
+ * r = split_token_index(s, "_")
+ * r is now [ [{0,1}, {2,4}, {5,8}],
+ *            [{0,1}, {2,2}, {3,5}],
+ *            null ]
+ * @endcode
+ *
+ * A null string element will result in a null list item for that row.
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid.
+ * @throw std::overflow_error if the number of tokens exceeds the column size limit
+ *
+ * @param input Strings instance for this operation
+ * @param delimiter The string to identify split points in each string;
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform;
+ *        Default of -1 indicates all possible splits on each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of token positions
+ */
+std::unique_ptr<column> split_token_index(
+  strings_column_view const& input,
+  string_scalar const& delimiter    = string_scalar(""),
+  size_type maxsplit                = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the byte positions of the tokens in each string where the
+ * delimiters are searched from the end of each string
+ *
+ * The tokens are identified exactly as `rsplit_record` would identify them.
+ * The output is otherwise the same as `split_token_index`.
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid.
+ * @throw std::overflow_error if the number of tokens exceeds the column size limit
+ *
+ * @param input Strings instance for this operation
+ * @param delimiter The string to identify split points in each string;
+ *        Default of empty string indicates split on whitespace.
+ * @param maxsplit Maximum number of splits to perform;
+ *        Default of -1 indicates all possible splits on each string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of token positions
+ */
+std::unique_ptr<column> rsplit_token_index(
+  strings_column_view const& input,
+  string_scalar const& delimiter    = string_scalar(""),
+  size_type maxsplit                = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Splits individual strings elements into a list of strings using
+ * the token positions created by `split_token_index` or `rsplit_token_index`
+ *
+ * The result is the same as `split_record` or `rsplit_record` with the parameters
+ * used to build the `token_index`.
+ *
+ * @throw cudf::logic_error if `token_index` was not created from `input`
+ *
+ * @param input Strings instance for this operation
+ * @param token_index Token positions for each row of `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of strings
+ */
+std::unique_ptr<column> split_record_with_index(
+  strings_column_view const& input,
+  lists_column_view const& token_index,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns a list of columns by splitting each string using the
+ * token positions created by `split_token_index` or `rsplit_token_index`
+ *
+ * Column `i` of the output contains the `i`th token of each row.
+ * A row with fewer tokens results in a null entry for the remaining columns.
+ * The output contains at least one column.
+ *
+ * @throw cudf::logic_error if `token_index` was not created from `input`
+ *
+ * @param input Strings instance for this operation
+ * @param token_index Token positions for each row of `input`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return New table of strings columns
+ */
+std::unique_ptr<table> split_with_index(
+  strings_column_view const& input,
+  lists_column_view const& token_index,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the token at `index` of each string using the token positions
+ * created by `split_token_index` or `rsplit_token_index`
+ *
+ * A row with `index` tokens or fewer results in a null entry.
+ *
+ * @code{.pseudo}
+ * s = ["a_bc_def", "a__bc", "ab", null]
+ * t = split_token_index(s, "_")
+ * r = get_token_with_index(s, t, 1)
+ * r is now ["bc", "", null, null]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `token_index` was not created from `input`
+ * @throw cudf::logic_error if `index` is negative
+ *
+ * @param input Strings instance for this operation
+ * @param token_index Token positions for each row of `input`
+ * @param index Position of the token to return
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+std::unique_ptr<column> get_token_with_index(
+  strings_column_view const& input,
+  lists_column_view const& token_index,
+  size_type index,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
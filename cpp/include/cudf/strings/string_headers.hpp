@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cstdint>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_classes
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Fixed-size description of a single string
+ *
+ * This is the 16-byte layout of the Arrow StringView type. Strings of up to
+ * `inline_size` bytes are stored entirely in the header. Longer strings keep
+ * their first `prefix_size` bytes in the header followed by the index of the
+ * buffer and the byte offset of the string in that buffer.
+ *
+ * Since the prefix is stored in the header, most comparisons of two strings
+ * are resolved without reading the characters buffer.
+ */
+struct alignas(16) string_header {
+  static constexpr int32_t inline_size = 12;  ///< Maximum bytes stored in the header
+  static constexpr int32_t prefix_size = 4;   ///< Bytes stored in the header of longer strings
+
+  int32_t size;            ///< Number of bytes in the string
+  char data[inline_size];  ///< Inline bytes or the prefix, buffer index, and offset
+
+  /**
+   * @brief Returns true if all the bytes of the string are stored in the header
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE inline bool is_inline() const { return size <= inline_size; }
+
+  /**
+   * @brief Returns the index of the buffer holding a string which is not inline
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE inline int32_t buffer_index() const
+  {
+    return *reinterpret_cast<int32_t const*>(data + prefix_size);
+  }
+
+  /**
+   * @brief Returns the byte offset within its buffer of a string which is not inline
+   */
+  [[nodiscard]] CUDF_HOST_DEVICE inline int32_t offset() const
+  {
+    return *reinterpret_cast<int32_t const*>(data + prefix_size + sizeof(int32_t));
+  }
+};
+
+static_assert(sizeof(string_header) == 16, "string_header must be 16 bytes");
+
+/**
+ * @brief Strings stored as an array of `string_header` values
+ *
+ * The characters of the strings which are not inline are stored in a single buffer
+ * so the buffer index of every header is 0. Null rows have a size of 0.
+ */
+class string_headers {
+ public:
+  string_headers(string_headers&&)            = default;
+  string_headers& operator=(string_headers&&) = default;
+  ~string_headers()                           = default;
+
+  /**
+   * @brief Construct from the header of each row and the buffer of the longer strings
+   *
+   * @param headers Header of each row
+   * @param chars Characters of the strings which are not inline
+   * @param null_mask Validity of each row or an empty buffer if `null_count` is 0
+   * @param null_count Number of null rows
+   */
+  string_headers(rmm::device_uvector<string_header>&& headers,
+                 rmm::device_buffer&& chars,
+                 rmm::device_buffer&& null_mask,
+                 size_type null_count);
+
+  /**
+   * @brief Returns the number of rows
+   */
+  [[nodiscard]] size_type size() const;
+
+  /**
+   * @brief Returns the number of null rows
+   */
+  [[nodiscard]] size_type null_count() const;
+
+  /**
+   * @brief Returns the header of each row
+   */
+  [[nodiscard]] device_span<string_header const> headers() const;
+
+  /**
+   * @brief Returns the characters of the strings which are not inline
+   */
+  [[nodiscard]] char const* chars() const;
+
+  /**
+   * @brief Returns the validity of each row or nullptr if there are no nulls
+   */
+  [[nodiscard]] bitmask_type const* null_mask() const;
+
+ private:
+  rmm::device_uvector<string_header> _headers;
+  rmm::device_buffer _chars;
+  rmm::device_buffer _null_mask;
+  size_type _null_count{};
+};
+
+/**
+ * @brief Converts a strings column into the `string_header` layout
+ *
+ * @param input Strings column to convert
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned object's device memory
+ * @return Headers and characters of the strings in `input`
+ */
+string_headers to_string_headers(
+  strings_column_view const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Converts strings in the `string_header` layout into a strings column
+ *
+ * @param input Strings to convert
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return New strings column
+ */
+std::unique_ptr<column> from_string_headers(
+  string_headers const& input,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
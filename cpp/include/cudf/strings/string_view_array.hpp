@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/string_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+namespace cudf {
+namespace strings {
+/**
+ * @addtogroup strings_classes
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Array of strings referencing the characters of another strings column
+ *
+ * Each row is a `string_view` (a pointer and a size) into the chars of the strings column
+ * it was created from, so functions like `slice_strings_view` and `strip_view` produce their
+ * results without copying any characters. Consumers may read the rows directly with `rows()`
+ * or build a new strings column with `materialize()`.
+ *
+ * A null row is represented by a `string_view` with a null data pointer.
+ *
+ * The strings column the rows reference must outlive this object.
+ */
+class string_view_array {
+ public:
+  string_view_array(string_view_array&&)            = default;
+  string_view_array& operator=(string_view_array&&) = default;
+  ~string_view_array()                              = default;
+
+  /**
+   * @brief Construct from the rows which reference the characters of another column
+   *
+   * @param rows The row strings where null rows have a null data pointer
+   * @param null_count Number of null rows
+   */
+  string_view_array(rmm::device_uvector<string_view>&& rows, size_type null_count);
+
+  /**
+   * @brief Returns the number of rows
+   */
+  [[nodiscard]] size_type size() const;
+
+  /**
+   * @brief Returns the number of null rows
+   */
+  [[nodiscard]] size_type null_count() const;
+
+  /**
+   * @brief Returns the device rows
+   */
+  [[nodiscard]] device_span<string_view const> rows() const;
+
+  /**
+   * @brief Copies the characters of the rows into a new strings column
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   * @return New strings column
+   */
+  [[nodiscard]] std::unique_ptr<column> materialize(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+ private:
+  rmm::device_uvector<string_view> _rows;
+  size_type _null_count{};
+};
+
+/** @} */  // end of doxygen group
+}  // namespace strings
+}  // namespace cudf
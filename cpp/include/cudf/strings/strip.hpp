@@ -18,6 +18,7 @@
 #include <cudf/column/column.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/side_type.hpp>
+#include <cudf/strings/string_view_array.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -69,6 +70,31 @@ std::unique_ptr<column> strip(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Removes the specified characters from the beginning or end
+ * (or both) of each string without copying any characters.
+ *
+ * This is the same as `strip` except the returned rows reference the characters
+ * of `input` which must outlive them.
+ *
+ * @throw cudf::logic_error if `to_strip` is invalid.
+ *
+ * @param input Strings column for this operation
+ * @param side Indicates characters are to be stripped from the beginning, end, or both of each
+ *        string; Default is both
+ * @param to_strip UTF-8 encoded characters to strip from each string;
+ *        Default is empty string which indicates strip whitespace characters
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned rows
+ * @return Rows referencing the stripped strings within `input`
+ */
+string_view_array strip_view(
+  strings_column_view const& input,
+  side_type side                    = side_type::BOTH,
+  string_scalar const& to_strip     = string_scalar(""),
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of doxygen group
 }  // namespace strings
 }  // namespace cudf
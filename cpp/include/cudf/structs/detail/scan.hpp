@@ -32,12 +32,15 @@ namespace detail {
  * @tparam Op Either DeviceMin or DeviceMax operations
  *
  * @param input Input column
+ * @param mask Mask of the output rows; rows that are null in it are nullified in the output
+ * children, may be `nullptr` if all output rows are valid
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned column's device memory
  * @return New struct column
  */
 template <typename Op>
 std::unique_ptr<column> scan_inclusive(column_view const& input,
+                                       bitmask_type const* mask,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr);
 
@@ -15,12 +15,18 @@
  */
 #pragma once
 
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <memory>
 #include <optional>
 #include <string>
+#include <string_view>
 
 namespace cudf {
 class table;
@@ -52,4 +58,42 @@ std::unique_ptr<table> make_timezone_transition_table(
   std::string_view timezone_name,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Converts timestamps from the wall-clock time of one timezone to that of another.
+ *
+ * Each timestamp is interpreted as a local time in `from_timezone`, converted to UTC, and then
+ * converted to the local time in `to_timezone`. Pass "UTC" as `from_timezone` to convert UTC
+ * timestamps to local times, or as `to_timezone` to convert local times to UTC.
+ *
+ * A local time that is skipped or repeated by a Daylight Saving Time transition is converted
+ * using the offset from one side of the transition.
+ *
+ * The transition tables are read from the TZif files once per process and then reused, so
+ * converting many columns with the same timezones does not re-read the files.
+ *
+ * @code{.pseudo}
+ * ts = [2024-01-15 12:00:00, 2024-07-15 12:00:00]
+ * convert_timezone(ts, "UTC", "America/Los_Angeles")
+ *    = [2024-01-15 04:00:00, 2024-07-15 05:00:00]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `timestamps` is not a timestamp column
+ * @throw cudf::logic_error if the TZif file of either timezone cannot be read
+ *
+ * @param timestamps Timestamps to convert
+ * @param from_timezone Timezone of the input timestamps (for example, "Europe/Paris")
+ * @param to_timezone Timezone of the output timestamps
+ * @param tzif_dir The directory where the TZif files are located
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Timestamps of the same type as the input, in `to_timezone`
+ */
+std::unique_ptr<column> convert_timezone(
+  column_view const& timestamps,
+  std::string_view from_timezone,
+  std::string_view to_timezone,
+  std::optional<std::string_view> tzif_dir = std::nullopt,
+  rmm::cuda_stream_view stream             = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr        = rmm::mr::get_current_device_resource());
+
 }  // namespace cudf
@@ -90,6 +90,30 @@ std::unique_ptr<column> compute_column(
   ast::expression const& expr,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Compute a new column by evaluating an expression tree on a table using a kernel
+ * generated from the expression.
+ *
+ * The expression tree is translated into CUDA source which is compiled at runtime and cached
+ * by the structure and types of the expression. Literal values are passed to the kernel so
+ * expressions differing only in their literal values share the same compiled kernel.
+ *
+ * This produces the same result as `compute_column`. Expressions containing operators or
+ * types that cannot be translated, such as `NULL_EQUAL`, `IS_NULL`, `POW` or non-numeric
+ * data, are evaluated by `compute_column` instead.
+ *
+ * @throws cudf::logic_error if passed an expression operating on table_reference::RIGHT.
+ *
+ * @param table The table used for expression evaluation
+ * @param expr The root of the expression tree
+ * @param mr Device memory resource
+ * @return Output column
+ */
+std::unique_ptr<column> compute_column_jit(
+  table_view const& table,
+  ast::expression const& expr,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a bitmask from a column of boolean elements.
  *
@@ -169,6 +193,35 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(
   column_view const& categories,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Encodes `input` like `one_hot_encode`, but returns only the positions of the ones.
+ *
+ * The dense encoding holds `input.size() * categories.size()` booleans. This compact encoding is
+ * a CSR-style sparse matrix instead: a LIST<INT32> column whose row `i` holds, in ascending
+ * order, the indices `j` for which `input[i] == categories[j]`. The offsets of the lists are the
+ * row offsets of the matrix and their child column holds the column indices of its non-zeros. Rows
+ * matching no category are empty lists. As in `one_hot_encode`, null elements are equal to null
+ * categories.
+ *
+ * Examples:
+ * @code{.pseudo}
+ * input: [{'a', 'c', null, 'c', 'b'}]
+ * categories: ['c', null]
+ * output: [[], [0], [1], [0], []]
+ * @endcode
+ *
+ * @throws cudf::data_type_error if input and categories are of different types.
+ *
+ * @param input Column containing values to be encoded
+ * @param categories Column containing categories
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return LIST<INT32> column of the indices of the categories matching each row of `input`
+ */
+std::unique_ptr<column> one_hot_encode_sparse(
+  column_view const& input,
+  column_view const& categories,
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a boolean column from given bitmask.
  *
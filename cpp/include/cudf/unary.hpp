@@ -19,6 +19,7 @@
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 
 #include <rmm/mr/device/per_device_resource.hpp>
@@ -202,6 +203,29 @@ std::unique_ptr<column> cast(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Casts each column of a table to the corresponding type of `out_types`.
+ *
+ * Columns that already have their output type are copied, and the other columns are cast as by
+ * `cast(column_view const&, data_type, rmm::cuda_stream_view, rmm::device_async_resource_ref)`.
+ * Each column is cast on its own stream from the global stream pool, all of which are joined
+ * back to `stream` before returning. The memory of the output columns is deallocated on `stream`.
+ *
+ * @param input Input table
+ * @param out_types Desired datatype of each output column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ *
+ * @returns Table of the cast columns of `input`
+ * @throw std::invalid_argument if `out_types` does not have one type per column of `input`
+ * @throw cudf::logic_error if a column is cast to a different type that is not fixed-width
+ */
+std::unique_ptr<table> cast(
+  table_view const& input,
+  host_span<data_type const> out_types,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Creates a column of `type_id::BOOL8` elements indicating the presence of `NaN` values
  * in a column of floating point values.
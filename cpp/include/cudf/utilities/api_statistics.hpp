@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <chrono>
+#include <cstddef>
+#include <map>
+#include <string>
+
+namespace cudf {
+/**
+ * @addtogroup utility_api_statistics
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Costs of the calls to one libcudf API made by a thread.
+ *
+ * Memory is only accounted for allocations made through an `api_statistics_resource_adaptor`
+ * on the calling thread, so allocations made by worker threads of the IO readers are not
+ * included.
+ */
+struct api_statistics {
+  std::size_t calls{};                    ///< Number of calls
+  std::chrono::nanoseconds host_time{};   ///< Total wall-clock time spent in the calls
+  std::chrono::nanoseconds device_time{}; ///< Total time of the calls' work on their streams
+  std::size_t allocated_bytes{};          ///< Total bytes allocated by the calls
+  std::size_t temporary_bytes{};          ///< Total bytes allocated and freed within the calls
+  std::size_t output_bytes{};             ///< Total bytes allocated and still alive on return
+  std::size_t peak_memory_bytes{};        ///< Largest memory footprint reached by one call
+};
+
+/**
+ * @brief Resource adaptor that accounts the allocations made through it to the libcudf API
+ * in flight on the calling thread.
+ *
+ * Install it as the current device resource (and pass it as `mr`) to collect the memory costs
+ * reported by `get_api_statistics`. The adaptor only forwards to `upstream` on threads that have
+ * not called `enable_api_statistics`.
+ */
+class api_statistics_resource_adaptor final : public rmm::mr::device_memory_resource {
+ public:
+  /**
+   * @brief Construct an adaptor forwarding allocations to `upstream`.
+   *
+   * @param upstream The resource used to allocate and free device memory
+   */
+  explicit api_statistics_resource_adaptor(rmm::device_async_resource_ref upstream);
+
+  /**
+   * @brief Get the upstream resource.
+   *
+   * @return The resource used to allocate and free device memory
+   */
+  [[nodiscard]] rmm::device_async_resource_ref get_upstream_resource() const noexcept;
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override;
+
+  rmm::device_async_resource_ref upstream_;
+};
+
+/**
+ * @brief Start collecting the costs of the libcudf APIs called by the calling thread.
+ *
+ * Every public API call is attributed to the API name. Calls made from within another API call
+ * are attributed to the outermost call. The device time of a call is measured with events on the
+ * stream of its first allocation, from that allocation to the return of the call; calls that
+ * allocate nothing through an `api_statistics_resource_adaptor` report no device time.
+ *
+ * Collecting statistics costs two CUDA events per call and is disabled by default. While it is
+ * disabled, an API call only updates a thread-local nesting depth. A call already in flight on the
+ * thread is not recorded.
+ */
+void enable_api_statistics();
+
+/**
+ * @brief Stop collecting the costs of the libcudf APIs called by the calling thread.
+ *
+ * The statistics collected so far are kept until `reset_api_statistics` is called. A call already
+ * in flight on the thread is still recorded.
+ */
+void disable_api_statistics();
+
+/**
+ * @brief Return the costs of the libcudf APIs called by the calling thread, per API name.
+ *
+ * Waits for the work of the calls whose device time has not been read yet.
+ *
+ * @return The statistics of every API called since the last reset
+ */
+std::map<std::string, api_statistics> get_api_statistics();
+
+/**
+ * @brief Clear the statistics collected on the calling thread.
+ */
+void reset_api_statistics();
+
+/** @} */  // end of group
+}  // namespace cudf
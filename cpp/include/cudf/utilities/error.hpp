@@ -270,9 +270,11 @@ inline void throw_cuda_error(cudaError_t error, char const* file, unsigned int l
  * @brief Debug macro to check for CUDA errors
  *
  * In a non-release build, this macro will synchronize the specified stream
- * before error checking. In both release and non-release builds, this macro
- * checks for any pending CUDA errors from previous calls. If an error is
- * reported, an exception is thrown detailing the CUDA error that occurred.
+ * before error checking, unless the stream is being captured into a CUDA graph
+ * where synchronizing is not allowed. In both release and non-release builds,
+ * this macro checks for any pending CUDA errors from previous calls. If an
+ * error is reported, an exception is thrown detailing the CUDA error that
+ * occurred.
  *
  * The intent of this macro is to provide a mechanism for synchronous and
  * deterministic execution for debugging asynchronous CUDA execution. It should
@@ -280,10 +282,14 @@ inline void throw_cuda_error(cudaError_t error, char const* file, unsigned int l
  * asynchronous kernel launch.
  */
 #ifndef NDEBUG
-#define CUDF_CHECK_CUDA(stream)                   \
-  do {                                            \
-    CUDF_CUDA_TRY(cudaStreamSynchronize(stream)); \
-    CUDF_CUDA_TRY(cudaPeekAtLastError());         \
+#define CUDF_CHECK_CUDA(stream)                                          \
+  do {                                                                   \
+    cudaStreamCaptureStatus capture_status{cudaStreamCaptureStatusNone}; \
+    CUDF_CUDA_TRY(cudaStreamIsCapturing(stream, &capture_status));       \
+    if (capture_status == cudaStreamCaptureStatusNone) {                 \
+      CUDF_CUDA_TRY(cudaStreamSynchronize(stream));                      \
+    }                                                                    \
+    CUDF_CUDA_TRY(cudaPeekAtLastError());                                \
   } while (0);
 #else
 #define CUDF_CHECK_CUDA(stream) CUDF_CUDA_TRY(cudaPeekAtLastError());
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <rmm/resource_ref.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <optional>
+
+namespace cudf {
+/**
+ * @addtogroup utility_memory_resource
+ * @{
+ * @file
+ */
+
+/**
+ * @brief Categories of large temporary device allocations made inside libcudf.
+ *
+ * Temporaries are never returned to the caller, so they are allocated from a
+ * per-category resource instead of the `mr` passed to the API.
+ */
+enum class temporary_allocation : int32_t {
+  JOIN_HASH_TABLE,   ///< Hash tables built by joins
+  IO_SCRATCH,        ///< Raw, compressed and decompressed data buffers of the IO readers
+  IO_COLUMN_BUFFER,  ///< Intermediate column buffers of the IO readers that are not returned
+};
+
+/**
+ * @brief Callback invoked when a temporary allocation fails for lack of memory.
+ *
+ * The callback receives the size of the failed allocation and its category. It should try to
+ * free device memory, for example by spilling buffers to host, and return true to retry the
+ * allocation or false to let the `rmm::out_of_memory` exception propagate.
+ */
+using temporary_allocation_spill_callback =
+  std::function<bool(std::size_t bytes, temporary_allocation kind)>;
+
+/**
+ * @brief Set the resource used for temporary allocations of category `kind`.
+ *
+ * By default temporaries are allocated from the current device resource at the time of the
+ * allocation. Passing `std::nullopt` restores that behavior.
+ *
+ * The resource must not be changed while temporaries allocated from the previous resource are
+ * still alive, i.e. while libcudf calls are in flight.
+ *
+ * @param kind The category of temporary allocations to configure
+ * @param mr The resource to use for `kind`, or `std::nullopt` for the current device resource
+ * @return The previous resource for `kind`, if one was set
+ */
+std::optional<rmm::device_async_resource_ref> set_temporary_memory_resource(
+  temporary_allocation kind, std::optional<rmm::device_async_resource_ref> mr);
+
+/**
+ * @brief Get the resource libcudf uses for temporary allocations of category `kind`.
+ *
+ * Allocations made through the returned resource are forwarded to the resource configured
+ * with `set_temporary_memory_resource` (or the current device resource) and invoke the
+ * callback set with `set_temporary_allocation_spill_callback` on out-of-memory errors.
+ *
+ * @param kind The category of temporary allocations
+ * @return The resource for temporary allocations of category `kind`
+ */
+rmm::device_async_resource_ref get_temporary_memory_resource(temporary_allocation kind);
+
+/**
+ * @brief Set the callback invoked when a temporary allocation runs out of memory.
+ *
+ * The callback may be invoked concurrently from multiple threads and must not allocate
+ * temporaries itself.
+ *
+ * @param callback The callback to invoke, or `std::nullopt` to fail immediately
+ * @return The previous callback, if one was set
+ */
+std::optional<temporary_allocation_spill_callback> set_temporary_allocation_spill_callback(
+  std::optional<temporary_allocation_spill_callback> callback);
+
+/** @} */  // end of group
+}  // namespace cudf
@@ -353,6 +353,61 @@ using scalar_type_t = typename type_to_scalar_type_impl<T>::ScalarType;
 template <typename T>
 using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceType;
 
+/**
+ * @brief Indicates whether a type is disabled in this build of libcudf.
+ *
+ * libcudf can be built with the `CUDF_DISABLED_TYPES` CMake option to omit some timestamp,
+ * duration and decimal types from `type_dispatcher`, which reduces the build time and the binary
+ * size. Dispatching on a disabled type throws a `cudf::data_type_error`.
+ *
+ * @param id The type identifier to check
+ * @return true if `type_dispatcher` does not instantiate the type
+ */
+CUDF_HOST_DEVICE constexpr bool is_type_disabled([[maybe_unused]] type_id id)
+{
+  bool disabled = false;
+#ifdef CUDF_DISABLE_TYPE_TIMESTAMP_DAYS
+  disabled = disabled or id == type_id::TIMESTAMP_DAYS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_TIMESTAMP_SECONDS
+  disabled = disabled or id == type_id::TIMESTAMP_SECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_TIMESTAMP_MILLISECONDS
+  disabled = disabled or id == type_id::TIMESTAMP_MILLISECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_TIMESTAMP_MICROSECONDS
+  disabled = disabled or id == type_id::TIMESTAMP_MICROSECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_TIMESTAMP_NANOSECONDS
+  disabled = disabled or id == type_id::TIMESTAMP_NANOSECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DURATION_DAYS
+  disabled = disabled or id == type_id::DURATION_DAYS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DURATION_SECONDS
+  disabled = disabled or id == type_id::DURATION_SECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DURATION_MILLISECONDS
+  disabled = disabled or id == type_id::DURATION_MILLISECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DURATION_MICROSECONDS
+  disabled = disabled or id == type_id::DURATION_MICROSECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DURATION_NANOSECONDS
+  disabled = disabled or id == type_id::DURATION_NANOSECONDS;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DECIMAL32
+  disabled = disabled or id == type_id::DECIMAL32;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DECIMAL64
+  disabled = disabled or id == type_id::DECIMAL64;
+#endif
+#ifdef CUDF_DISABLE_TYPE_DECIMAL128
+  disabled = disabled or id == type_id::DECIMAL128;
+#endif
+  return disabled;
+}
+
 /**
  * @brief Invokes an `operator()` template with the type instantiation based on
  * the specified `cudf::data_type`'s `id()`.
@@ -443,6 +498,7 @@ using scalar_device_type_t = typename type_to_scalar_type_impl<T>::ScalarDeviceT
  * @param f The callable whose `operator()` template is invoked
  * @param args Parameter pack of arguments forwarded to the `operator()`
  * invocation
+ * @throw cudf::data_type_error if the type is disabled in this build, see `is_type_disabled`
  * @return Whatever is returned by the callable's `operator()`
  */
 // This pragma disables a compiler warning that complains about the valid usage
@@ -491,36 +547,56 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
     case type_id::BOOL8:
       return f.template operator()<typename IdTypeMap<type_id::BOOL8>::type>(
         std::forward<Ts>(args)...);
+#ifndef CUDF_DISABLE_TYPE_TIMESTAMP_DAYS
     case type_id::TIMESTAMP_DAYS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_DAYS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_TIMESTAMP_SECONDS
     case type_id::TIMESTAMP_SECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_SECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_TIMESTAMP_MILLISECONDS
     case type_id::TIMESTAMP_MILLISECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MILLISECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_TIMESTAMP_MICROSECONDS
     case type_id::TIMESTAMP_MICROSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_MICROSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_TIMESTAMP_NANOSECONDS
     case type_id::TIMESTAMP_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::TIMESTAMP_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DURATION_DAYS
     case type_id::DURATION_DAYS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_DAYS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DURATION_SECONDS
     case type_id::DURATION_SECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_SECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DURATION_MILLISECONDS
     case type_id::DURATION_MILLISECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_MILLISECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DURATION_MICROSECONDS
     case type_id::DURATION_MICROSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_MICROSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DURATION_NANOSECONDS
     case type_id::DURATION_NANOSECONDS:
       return f.template operator()<typename IdTypeMap<type_id::DURATION_NANOSECONDS>::type>(
         std::forward<Ts>(args)...);
+#endif
     case type_id::DICTIONARY32:
       return f.template operator()<typename IdTypeMap<type_id::DICTIONARY32>::type>(
         std::forward<Ts>(args)...);
@@ -530,20 +606,29 @@ CUDF_HOST_DEVICE __forceinline__ constexpr decltype(auto) type_dispatcher(cudf::
     case type_id::LIST:
       return f.template operator()<typename IdTypeMap<type_id::LIST>::type>(
         std::forward<Ts>(args)...);
+#ifndef CUDF_DISABLE_TYPE_DECIMAL32
     case type_id::DECIMAL32:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL32>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DECIMAL64
     case type_id::DECIMAL64:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL64>::type>(
         std::forward<Ts>(args)...);
+#endif
+#ifndef CUDF_DISABLE_TYPE_DECIMAL128
     case type_id::DECIMAL128:
       return f.template operator()<typename IdTypeMap<type_id::DECIMAL128>::type>(
         std::forward<Ts>(args)...);
+#endif
     case type_id::STRUCT:
       return f.template operator()<typename IdTypeMap<type_id::STRUCT>::type>(
         std::forward<Ts>(args)...);
     default: {
 #ifndef __CUDA_ARCH__
+      CUDF_EXPECTS(not is_type_disabled(dtype.id()),
+                   "Type is disabled in this build of libcudf (see CUDF_DISABLED_TYPES).",
+                   cudf::data_type_error);
       CUDF_FAIL("Invalid type_id.");
 #else
       CUDF_UNREACHABLE("Invalid type_id.");
@@ -182,6 +182,9 @@
  *   @defgroup utility_bitmask Bitmask
  *   @defgroup utility_error Exception
  *   @defgroup utility_span Exception
+ *   @defgroup utility_jit JIT Kernel Cache
+ *   @defgroup utility_memory_resource Memory Resource
+ *   @defgroup utility_api_statistics API Statistics
  * @}
  * @defgroup labeling_apis Labeling
  * @{
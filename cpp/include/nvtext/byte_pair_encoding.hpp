@@ -21,6 +21,8 @@
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <nvtext/tokenize.hpp>
+
 #include <rmm/resource_ref.hpp>
 
 namespace nvtext {
@@ -131,5 +133,46 @@ std::unique_ptr<cudf::column> byte_pair_encoding(
   cudf::string_scalar const& separator = cudf::string_scalar(" "),
   rmm::device_async_resource_ref mr    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Byte pair encode the input strings and return the token id of each encoded token
+ *
+ * The encoding is the same as @ref byte_pair_encoding but instead of joining the
+ * encoded tokens with a separator, each token is looked up in the given vocabulary
+ * and its id is returned. This avoids building the encoded strings and
+ * tokenizing them again to retrieve the token ids.
+ *
+ * Identical substrings between unpairable characters are encoded only once per call
+ * which speeds up input with many repeated words.
+ *
+ * @code{.pseudo}
+ * merge_pairs = ["e n", "i t", "i s", "e s", "en t", "c e", "es t", "en ce", "t est", "s ent"]
+ * mps = load_merge_pairs(merge_pairs)
+ * vocab = load_vocabulary(["test", " ", "sent", "ence"])
+ * input = ["test sentence", "sentence test"]
+ * result = byte_pair_encoding_ids(input, mps, vocab)
+ * result is now [[0, 1, 2, 3], [2, 3, 1, 0]]
+ * @endcode
+ *
+ * Any null row entry results in a corresponding null entry in the output.
+ *
+ * @throw std::overflow_error if the total number of tokens exceeds the column size limit
+ *
+ * @param input Strings to encode
+ * @param merge_pairs Created by a call to @ref nvtext::load_merge_pairs
+ * @param vocabulary Token ids are the row indices of the tokens in this vocabulary
+ * @param default_id The token id to be used for tokens not found in the `vocabulary`;
+ *                   Default is -1
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Memory resource to allocate any returned objects
+ * @return Lists column of token ids
+ */
+std::unique_ptr<cudf::column> byte_pair_encoding_ids(
+  cudf::strings_column_view const& input,
+  bpe_merge_pairs const& merge_pairs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::size_type default_id        = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
@@ -127,5 +127,84 @@ std::unique_ptr<cudf::column> hash_character_ngrams(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Hashes the ngrams of characters within each string into a sparse feature vector
+ *
+ * This applies the hashing trick to the ngrams built as in `hash_character_ngrams` without
+ * producing the intermediate column of ngram hashes. Each ngram is hashed with MurmurHash32 and
+ * counted in the feature `hash % num_features`.
+ *
+ * If `signed_hash` is true, ngrams whose hash has its highest bit set are counted as -1 instead
+ * of 1 so that collisions tend to cancel out.
+ *
+ * Each output row is a list of `{index, count}` structs for the features with a non-zero count,
+ * in increasing index order. Both struct members are INT32.
+ *
+ * ```
+ * ["abab", "aaa"] with ngrams=2 and num_features=1000 would produce
+ * [[{hash("ab") % 1000, 2}, {hash("ba") % 1000, 1}], [{hash("aa") % 1000, 2}]]
+ * (the structs of each row are ordered by index)
+ * ```
+ *
+ * Null rows produce null output rows. Rows with fewer than `ngrams` characters produce
+ * empty lists.
+ *
+ * @throw std::invalid_argument if `ngrams < 1` or `num_features < 1`
+ * @throw std::overflow_error if the total number of ngrams exceeds the column size limit
+ *
+ * @param input Strings column to produce ngrams from
+ * @param ngrams The ngram number to generate
+ * @param num_features Number of features (dimension) of the output vectors
+ * @param signed_hash Whether to count ngrams as 1 or -1 depending on their hash
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of sparse feature vectors
+ */
+std::unique_ptr<cudf::column> hash_character_ngram_features(
+  cudf::strings_column_view const& input,
+  cudf::size_type ngrams,
+  cudf::size_type num_features,
+  bool signed_hash                  = false,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Hashes the ngrams of words within each string into a sparse feature vector
+ *
+ * Each string is split into tokens with `delimiter` and every `ngrams` adjacent tokens form an
+ * ngram. The tokens are hashed with MurmurHash32 and the hashes of the tokens of each ngram are
+ * combined into the ngram hash, which is counted in the feature `hash % num_features`.
+ *
+ * If `signed_hash` is true, ngrams whose hash has its highest bit set are counted as -1 instead
+ * of 1 so that collisions tend to cancel out.
+ *
+ * Each output row is a list of `{index, count}` structs for the features with a non-zero count,
+ * in increasing index order. Both struct members are INT32.
+ *
+ * Null rows produce null output rows. Rows with fewer than `ngrams` tokens produce empty lists.
+ *
+ * @throw std::invalid_argument if `ngrams < 1` or `num_features < 1`
+ * @throw cudf::logic_error if `delimiter` is invalid
+ * @throw std::overflow_error if the total number of ngrams exceeds the column size limit
+ *
+ * @param input Strings column to tokenize and produce ngrams from
+ * @param ngrams The ngram number to generate
+ * @param delimiter UTF-8 characters used to separate each string into tokens.
+ *                  An empty string will separate tokens using whitespace.
+ * @param num_features Number of features (dimension) of the output vectors
+ * @param signed_hash Whether to count ngrams as 1 or -1 depending on their hash
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Lists column of sparse feature vectors
+ */
+std::unique_ptr<cudf::column> hash_word_ngram_features(
+  cudf::strings_column_view const& input,
+  cudf::size_type ngrams,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type num_features,
+  bool signed_hash                  = false,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
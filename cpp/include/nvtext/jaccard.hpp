@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -77,5 +78,51 @@ std::unique_ptr<cudf::column> jaccard_index(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the pairs of rows from two strings columns with a Jaccard
+ * similarity of at least `threshold`
+ *
+ * The similarity is computed as in `jaccard_index` but between every row of
+ * `input1` and every row of `input2`. Instead of comparing all the pairs,
+ * candidate pairs are generated by prefix filtering: the hashed substrings of
+ * each row are sorted and two rows can only meet the threshold if they share
+ * a value within the first `n - ceil(threshold * n) + 1` values of each row,
+ * where `n` is the number of unique substrings in the row. Candidates are
+ * also pruned by comparing their set sizes before the exact similarity is
+ * computed for the remaining pairs.
+ *
+ * The output table has 3 columns: the row index in `input1`, the row index
+ * in `input2`, and the FLOAT32 Jaccard index of the pair. The pairs are
+ * ordered by the row index in `input1` and then by the row index in `input2`.
+ *
+ * @code{.pseudo}
+ * input1 = ["the fuzzy dog", "little piggy", "funny bunny"]
+ * input2 = ["funny bunny", "the fuzzy cat", "silent partner"]
+ * r = jaccard_join(input1, input2, 5, 0.5)
+ * r is now {[0, 2], [1, 0], [0.5, 1.0]}
+ * @endcode
+ *
+ * Null rows and rows with fewer than `width` characters are not matched.
+ *
+ * @throw std::invalid_argument if the `width < 2`
+ * @throw std::invalid_argument if `threshold` is not in the range (0, 1]
+ * @throw std::overflow_error if the number of output pairs exceeds the column size limit
+ *
+ * @param input1 Strings column to compare with `input2`
+ * @param input2 Strings column to compare with `input1`
+ * @param width The character width used for apply substrings
+ * @param threshold Minimum Jaccard index of the returned pairs
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned table's device memory
+ * @return Table of row indices and Jaccard index values for each qualifying pair
+ */
+std::unique_ptr<cudf::table> jaccard_join(
+  cudf::strings_column_view const& input1,
+  cudf::strings_column_view const& input2,
+  cudf::size_type width,
+  float threshold,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
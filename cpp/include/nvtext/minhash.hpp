@@ -17,6 +17,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/hashing.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
@@ -150,5 +151,115 @@ std::unique_ptr<cudf::column> minhash64(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the minhash values for each string using permutations of a single hash
+ *
+ * Each substring of each string is hashed once using `seed` and the hash value
+ * is then permuted for each pair of `parameter_a` and `parameter_b` values:
+ * ```
+ * permuted_hash = ((parameter_a[i] * hash + parameter_b[i]) % mersenne_prime) & max_uint32
+ * ```
+ * where `mersenne_prime = 2^61 - 1`. The minimum permuted hash value is
+ * returned for each string for each parameter pair. Computing many hash values
+ * this way is much faster than rehashing each substring with a different seed.
+ *
+ * Each row of the list column are the results for the corresponding string.
+ * The order of the elements in each row match the order of the parameter values.
+ *
+ * This function uses MurmurHash3_x86_32 for the hash algorithm.
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::invalid_argument if parameter_a is empty
+ * @throw std::invalid_argument if `parameter_b.size() != parameter_a.size()`
+ * @throw std::overflow_error if `parameter_a.size() * input.size()` exceeds the column size limit
+ *
+ * @param input Strings column to compute minhash
+ * @param seed Seed value used for the hash algorithm
+ * @param parameter_a Multiplier values used for the permutations
+ * @param parameter_b Addend values used for the permutations
+ * @param width The character width used for apply substrings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of minhash values for each string per parameter pair
+ */
+std::unique_ptr<cudf::column> minhash_permuted(
+  cudf::strings_column_view const& input,
+  uint32_t seed,
+  cudf::device_span<uint32_t const> parameter_a,
+  cudf::device_span<uint32_t const> parameter_b,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns the minhash values for each string using permutations of a single hash
+ *
+ * This is the 64-bit version of `minhash_permuted` and uses MurmurHash3_x64_128
+ * for the hash algorithm. Only the first of its 2 uint64 values is used.
+ * ```
+ * permuted_hash = (parameter_a[i] * hash + parameter_b[i]) % mersenne_prime
+ * ```
+ * where the multiply and add wrap at 64 bits and `mersenne_prime = 2^61 - 1`.
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if the width < 2
+ * @throw std::invalid_argument if parameter_a is empty
+ * @throw std::invalid_argument if `parameter_b.size() != parameter_a.size()`
+ * @throw std::overflow_error if `parameter_a.size() * input.size()` exceeds the column size limit
+ *
+ * @param input Strings column to compute minhash
+ * @param seed Seed value used for the hash algorithm
+ * @param parameter_a Multiplier values used for the permutations
+ * @param parameter_b Addend values used for the permutations
+ * @param width The character width used for apply substrings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of minhash values for each string per parameter pair
+ */
+std::unique_ptr<cudf::column> minhash64_permuted(
+  cudf::strings_column_view const& input,
+  uint64_t seed,
+  cudf::device_span<uint64_t const> parameter_a,
+  cudf::device_span<uint64_t const> parameter_b,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+/**
+ * @brief Returns locality-sensitive hashing band values for each row of minhash values
+ *
+ * The minhash values of each row are divided into consecutive bands of
+ * `rows_per_band` values and each band is hashed into a single UINT64 value
+ * using MurmurHash3_x64_128 seeded with the band's position. Two rows sharing
+ * any band value at the same position are candidate near-duplicates so the
+ * output can be exploded and used directly as a groupby or join key.
+ *
+ * @code{.pseudo}
+ * m = minhash_permuted(input, seed, a, b, 5)  // 20 values per row
+ * r = minhash_lsh_bands(m, 4)
+ * r is a lists column with 5 UINT64 band values per row
+ * @endcode
+ *
+ * Any null row entries result in corresponding null output rows.
+ *
+ * @throw std::invalid_argument if `rows_per_band < 1`
+ * @throw std::invalid_argument if the child type of `minhashes` is not UINT32 or UINT64
+ * @throw std::invalid_argument if the size of any row is not a multiple of `rows_per_band`
+ *
+ * @param minhashes Lists column of minhash values such as returned by `minhash_permuted`
+ * @param rows_per_band Number of minhash values hashed together into each band
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return List column of band hash values for each row
+ */
+std::unique_ptr<cudf::column> minhash_lsh_bands(
+  cudf::lists_column_view const& minhashes,
+  cudf::size_type rows_per_band,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of group
 }  // namespace nvtext
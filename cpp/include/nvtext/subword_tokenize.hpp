@@ -18,10 +18,18 @@
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <memory>
+
 namespace nvtext {
+namespace detail {
+class subword_tokenizer_stream_impl;
+}
 
 /**
  * @addtogroup nvtext_tokenize
@@ -159,5 +167,107 @@ tokenizer_result subword_tokenize(
   bool do_truncate,
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Tokenizes batches of strings into caller-provided output buffers
+ *
+ * This object performs the same operation as `subword_tokenize()` for a sequence
+ * of input batches. The vocabulary table and the working memory for building the
+ * output tensor are created once and reused for each batch.
+ *
+ * The token-ids, attention-mask and metadata for each batch are written directly
+ * into the buffers provided to `tokenize()`. These may be device memory or pinned
+ * host memory that is accessible from the device so no separate copy of the
+ * results is required.
+ *
+ * Consecutive calls to `tokenize()` alternate between two internal CUDA streams
+ * so the output of one batch can be written while the next batch is normalized
+ * and tokenized. Each call waits on the stream passed to it before starting and
+ * `synchronize()` makes a stream wait for all the batches submitted so far.
+ * The buffers and the input of a batch must remain valid until then.
+ *
+ * @code{.cpp}
+ * auto tokenizer = nvtext::subword_tokenizer_stream(*vocab, 64, 48, true, false, max_rows);
+ * // one set of output buffers for each batch
+ * for (auto& [batch, out] : work) {
+ *   rows.push_back(tokenizer.tokenize(batch, out.token_ids, out.mask, out.metadata));
+ * }
+ * tokenizer.synchronize();
+ * @endcode
+ *
+ * The `vocabulary_table` must remain valid for the lifetime of this object.
+ */
+class subword_tokenizer_stream {
+ public:
+  /**
+   * @brief Creates a tokenizer for batches producing up to `max_rows_tensor` rows each
+   *
+   * @throw cudf::logic_error if `stride > max_sequence_length`
+   * @throw std::overflow_error if `max_sequence_length * max_rows_tensor`
+   *        exceeds the column size limit
+   *
+   * @param vocabulary_table The vocabulary table pre-loaded into this object
+   * @param max_sequence_length Limit of the number of token-ids per row in final tensor
+   *        for each string
+   * @param stride Each row in the output token-ids will replicate `max_sequence_length - stride`
+   *        the token-ids from the previous row, unless it is the first string
+   * @param do_lower_case If true, the tokenizer will convert uppercase characters in the
+   *        input stream to lower-case and strip accents from those characters
+   * @param do_truncate If true, the tokenizer will discard all the token-ids after
+   *        `max_sequence_length` for each input string
+   * @param max_rows_tensor Maximum number of output tensor rows for any one batch
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the working memory
+   */
+  subword_tokenizer_stream(
+    hashed_vocabulary const& vocabulary_table,
+    uint32_t max_sequence_length,
+    uint32_t stride,
+    bool do_lower_case,
+    bool do_truncate,
+    uint32_t max_rows_tensor,
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  ~subword_tokenizer_stream();
+  subword_tokenizer_stream(subword_tokenizer_stream&&) noexcept;             ///< Move constructor
+  subword_tokenizer_stream& operator=(subword_tokenizer_stream&&) noexcept;  ///< Move assignment
+
+  /**
+   * @brief Tokenizes a batch of strings into the given output buffers
+   *
+   * The output buffers have the same layout as the columns of `tokenizer_result`.
+   * Only the first `rows * max_sequence_length` elements of `token_ids` and
+   * `attention_mask` and the first `rows * 3` elements of `metadata` are written
+   * where `rows` is the returned value.
+   *
+   * The output of an empty or all-null batch is 0 rows.
+   *
+   * @throw std::invalid_argument if the batch produces more than `max_rows_tensor` rows
+   * @throw std::invalid_argument if the output buffers are too small for the batch
+   *
+   * @param input Strings to tokenize
+   * @param token_ids Device accessible buffer for the token-ids
+   * @param attention_mask Device accessible buffer for the attention mask
+   * @param metadata Device accessible buffer for the metadata
+   * @param stream CUDA stream the batch waits on before it starts
+   * @return Number of output tensor rows written for this batch
+   */
+  uint32_t tokenize(cudf::strings_column_view const& input,
+                    cudf::device_span<uint32_t> token_ids,
+                    cudf::device_span<uint32_t> attention_mask,
+                    cudf::device_span<uint32_t> metadata,
+                    rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+  /**
+   * @brief Makes the given stream wait for all the batches submitted so far
+   *
+   * @param stream CUDA stream to synchronize with the submitted batches
+   */
+  void synchronize(rmm::cuda_stream_view stream = cudf::get_default_stream());
+
+ private:
+  std::unique_ptr<detail::subword_tokenizer_stream_impl> _impl;
+};
+
 /** @} */  // end of group
 }  // namespace nvtext
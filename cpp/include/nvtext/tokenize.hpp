@@ -21,6 +21,8 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <vector>
+
 namespace nvtext {
 /**
  * @addtogroup nvtext_tokenize
@@ -229,6 +231,14 @@ std::unique_ptr<cudf::column> detokenize(
   rmm::cuda_stream_view stream         = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr    = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Lookup structure built for a nvtext::tokenize_vocabulary
+ */
+enum class vocabulary_lookup : int8_t {
+  HASH_MAP,     ///< Open addressing hash map; a lookup may probe several slots
+  PERFECT_HASH  ///< Perfect hash built for the static vocabulary; each lookup is a single probe
+};
+
 /**
  * @brief Vocabulary object to be used with nvtext::tokenize_with_vocabulary
  *
@@ -250,6 +260,26 @@ struct tokenize_vocabulary {
   tokenize_vocabulary(cudf::strings_column_view const& input,
                       rmm::cuda_stream_view stream      = cudf::get_default_stream(),
                       rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
+  /**
+   * @brief Vocabulary object constructor with a specific lookup structure
+   *
+   * Building a `vocabulary_lookup::PERFECT_HASH` takes longer than the hash map
+   * and is intended for static vocabularies that are used for many calls.
+   *
+   * @throw cudf::logic_error if `vocabulary` contains nulls or is empty
+   * @throw cudf::logic_error if a perfect hash cannot be built for `vocabulary`
+   *        which happens if it contains duplicate entries
+   *
+   * @param input Strings for the vocabulary
+   * @param lookup Lookup structure to build for the vocabulary
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned column's device memory
+   */
+  tokenize_vocabulary(cudf::strings_column_view const& input,
+                      vocabulary_lookup lookup,
+                      rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+                      rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
   ~tokenize_vocabulary();
 
   struct tokenize_vocabulary_impl;
@@ -274,6 +304,25 @@ std::unique_ptr<tokenize_vocabulary> load_vocabulary(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Create a tokenize_vocabulary object from a strings column
+ * with a specific lookup structure
+ *
+ * @throw cudf::logic_error if `vocabulary` contains nulls or is empty
+ * @throw cudf::logic_error if a perfect hash cannot be built for `vocabulary`
+ *
+ * @param input Strings for the vocabulary
+ * @param lookup Lookup structure to build for the vocabulary
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Object to be used with nvtext::tokenize_with_vocabulary
+ */
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(
+  cudf::strings_column_view const& input,
+  vocabulary_lookup lookup,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /**
  * @brief Returns the token ids for the input string by looking up each delimited
  * token in the given vocabulary
@@ -307,5 +356,40 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(
   rmm::cuda_stream_view stream      = cudf::get_default_stream(),
   rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
 
+/**
+ * @brief Returns the token ids for each of the input strings columns by looking up
+ * each delimited token in the given vocabulary
+ *
+ * This is the same as calling nvtext::tokenize_with_vocabulary for each column
+ * with the same vocabulary, without synchronizing `stream` in between.
+ *
+ * @code{.pseudo}
+ * Example:
+ * s1 = ["hello world", "hello there"]
+ * s2 = ["there there world", "watch out world"]
+ * v = load_vocabulary(["hello", "there", "world"])
+ * r = tokenize_with_vocabulary([s1, s2], v)
+ * r is now [[[0,2], [0,1]], [[1,1,2], [-1,-1,2]]]
+ * @endcode
+ *
+ * @throw cudf::logic_error if `delimiter` is invalid
+ *
+ * @param inputs Strings columns to tokenize
+ * @param vocabulary Used to lookup tokens within
+ * @param delimiter Used to identify tokens within each of the `inputs`
+ * @param default_id The token id to be used for tokens not found in the `vocabulary`;
+ *                   Default is -1
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return Lists column of token ids for each input column
+ */
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  std::vector<cudf::strings_column_view> const& inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id        = -1,
+  rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+  rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource());
+
 /** @} */  // end of tokenize group
 }  // namespace nvtext
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "kafka_callback.hpp"
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <librdkafka/rdkafkacpp.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <map>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+/**
+ * @brief Range of offsets to consume from one Kafka topic/partition
+ */
+struct topic_partition_range {
+  std::string topic;     ///< Name of the Kafka topic
+  int partition;         ///< Partition index within the topic
+  int64_t start_offset;  ///< First offset to consume
+  int64_t end_offset;    ///< Offset to stop consuming at, exclusive
+};
+
+/**
+ * @brief Layout of the messages within a consumed batch
+ */
+enum class message_layout {
+  DELIMITED,       ///< Each message payload is followed by the delimiter, e.g. for JSON lines
+  LENGTH_PREFIXED  ///< Each message payload is preceded by its length as a little-endian uint32
+};
+
+/**
+ * @brief Per-message metadata of a consumed batch, row-aligned with the messages
+ */
+struct kafka_message_metadata {
+  std::vector<char> key_chars;                  ///< Concatenated message keys
+  std::vector<cudf::size_type> key_offsets{0};  ///< Offsets of each key within `key_chars`
+  std::vector<bool> has_key;                    ///< Whether each message has a key
+  std::vector<int32_t> partitions;              ///< Partition of each message
+  std::vector<int64_t> offsets;                 ///< Kafka offset of each message
+  std::vector<int64_t> timestamps;              ///< Timestamp of each message in milliseconds
+  std::vector<std::size_t> payload_offsets;     ///< Byte offset of each payload within the data
+  std::vector<cudf::size_type> payload_sizes;   ///< Size in bytes of each payload
+};
+
+/**
+ * @brief Messages consumed from Kafka into a pinned host buffer
+ *
+ * The data is owned by the consumer and remains valid until the next call to
+ * `kafka_batch_consumer::next_batch()`.
+ */
+struct kafka_batch {
+  cudf::host_span<std::byte const> data;  ///< Consumed messages in the requested layout
+  std::size_t num_messages{0};            ///< Number of messages in the batch
+  kafka_message_metadata metadata;        ///< Key, partition, offset and timestamp of each message
+  /// Offset following the last consumed message of each topic/partition in the batch
+  std::map<std::pair<std::string, int>, int64_t> next_offsets;
+
+  /**
+   * @brief Create a table holding the payload and metadata of each message
+   *
+   * The payloads are located through `metadata.payload_offsets` and `metadata.payload_sizes`, so
+   * the batch data is copied to the device once and split into rows without searching for
+   * delimiters. The table has the columns:
+   *  - key (STRING), null for messages without a key
+   *  - partition (INT32)
+   *  - offset (INT64)
+   *  - timestamp (TIMESTAMP_MILLISECONDS)
+   *  - payload (STRING)
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned table's device memory
+   * @return Table with one row per message
+   */
+  [[nodiscard]] std::unique_ptr<cudf::table> to_table(
+    rmm::cuda_stream_view stream      = cudf::get_default_stream(),
+    rmm::device_async_resource_ref mr = rmm::mr::get_current_device_resource()) const;
+
+  /**
+   * @brief Create a datasource over the batch data for the cudf readers
+   *
+   * @return Datasource that reads the batch data without copying it
+   */
+  [[nodiscard]] std::unique_ptr<cudf::io::datasource> to_datasource() const
+  {
+    return cudf::io::datasource::create(data);
+  }
+};
+
+/**
+ * @brief Double-buffered consumer of several Kafka topic/partitions at once
+ *
+ * Message payloads are copied straight from librdkafka into one of two reusable pinned host
+ * buffers allocated from `cudf::io::get_host_memory_resource()`. While the caller parses the
+ * batch returned by `next_batch()`, the following batch is consumed into the other buffer on a
+ * background thread, so device parsing of batch N overlaps with consuming batch N+1.
+ *
+ * @ingroup io_datasources
+ */
+class kafka_batch_consumer {
+ public:
+  /**
+   * @brief Create a consumer for the given topic/partition ranges and start consuming the first
+   * batch. Documentation for librdkafka configurations can be found at
+   * https://github.com/edenhill/librdkafka/blob/master/CONFIGURATION.md
+   *
+   * @throws cudf::logic_error if the configuration is invalid, `partitions` is empty or
+   * `batch_size` is zero
+   *
+   * @param configs key/value pairs of librdkafka configurations that will be
+   *                passed to the librdkafka client
+   * @param python_callable `python_callable_type` pointer to a Python functools.partial object
+   * @param callable_wrapper `kafka_oauth_callback_wrapper_type` Cython wrapper that will
+   *                 be used to invoke the `python_callable`
+   * @param partitions Topic/partition offset ranges to consume from
+   * @param batch_size Capacity in bytes of each pinned buffer. A batch is only larger than this
+   * when it holds a single message that does not fit.
+   * @param batch_timeout maximum (millisecond) time spent consuming each batch
+   * @param layout Layout of the messages within each batch
+   * @param delimiter Delimiter appended to each message for `message_layout::DELIMITED`
+   */
+  kafka_batch_consumer(std::map<std::string, std::string> const& configs,
+                       python_callable_type python_callable,
+                       kafka_oauth_callback_wrapper_type callable_wrapper,
+                       std::vector<topic_partition_range> partitions,
+                       std::size_t batch_size,
+                       int batch_timeout,
+                       message_layout layout,
+                       std::string delimiter = "\n");
+
+  /**
+   * @brief Waits for the background consumption and releases the pinned buffers
+   */
+  ~kafka_batch_consumer();
+
+  kafka_batch_consumer(kafka_batch_consumer const&)            = delete;
+  kafka_batch_consumer& operator=(kafka_batch_consumer const&) = delete;
+
+  /**
+   * @brief Whether more messages may be consumed
+   *
+   * @return False once the batch that reached the end offset or end of every topic/partition
+   * has been returned
+   */
+  [[nodiscard]] bool has_next() const;
+
+  /**
+   * @brief Returns the batch consumed in the background and starts consuming the next one
+   *
+   * The returned data is overwritten by the call after this one, so the caller must finish
+   * using it (e.g. parsing it with a cudf reader) before calling `next_batch()` again.
+   *
+   * @return The consumed batch, which may be empty if `batch_timeout` elapsed first
+   */
+  kafka_batch next_batch();
+
+  /**
+   * @brief Commits the offsets following a consumed batch to the Kafka broker
+   *
+   * @throws cudf::logic_error on failure to commit the offsets
+   *
+   * @param batch Batch whose offsets should be committed
+   */
+  void commit(kafka_batch const& batch);
+
+ private:
+  /**
+   * @brief Pinned host buffer the messages of one batch are written to
+   */
+  struct pinned_buffer {
+    std::byte* data{nullptr};
+    std::size_t capacity{0};
+    std::size_t size{0};
+  };
+
+  /**
+   * @brief Consumes messages into `buffers_[index]` and returns the batch
+   */
+  kafka_batch consume_batch(std::size_t index);
+
+  void reserve(pinned_buffer& buffer, std::size_t bytes);
+  void append(pinned_buffer& buffer, RdKafka::Message const& msg, kafka_batch& batch);
+
+  std::unique_ptr<RdKafka::Conf> kafka_conf;  // RDKafka configuration object
+  std::unique_ptr<python_oauth_refresh_callback> oauth_callback;
+  std::unique_ptr<RdKafka::KafkaConsumer> consumer;
+
+  std::vector<topic_partition_range> partitions;
+  std::size_t batch_size;
+  int batch_timeout;
+  message_layout layout;
+  std::string delimiter;
+
+  std::array<pinned_buffer, 2> buffers;
+  std::size_t pending_buffer{0};  // index of the buffer being consumed into in the background
+  std::future<kafka_batch> pending_batch;
+  // message consumed by the previous batch that did not fit into its buffer
+  std::unique_ptr<RdKafka::Message> carried_message;
+  // end offset of each topic/partition still being consumed; entries are removed when a partition
+  // is done. Only accessed by the background consumption while a batch is pending.
+  std::map<std::pair<std::string, int>, int64_t> remaining;
+};
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf_kafka/kafka_batch_consumer.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/aligned.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <librdkafka/rdkafkacpp.h>
+
+#include <thrust/pair.h>
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+namespace cudf {
+namespace io {
+namespace external {
+namespace kafka {
+
+kafka_batch_consumer::kafka_batch_consumer(std::map<std::string, std::string> const& configs,
+                                           python_callable_type python_callable,
+                                           kafka_oauth_callback_wrapper_type callable_wrapper,
+                                           std::vector<topic_partition_range> partitions,
+                                           std::size_t batch_size,
+                                           int batch_timeout,
+                                           message_layout layout,
+                                           std::string delimiter)
+  : kafka_conf(RdKafka::Conf::create(RdKafka::Conf::CONF_GLOBAL)),
+    partitions(std::move(partitions)),
+    batch_size(batch_size),
+    batch_timeout(batch_timeout),
+    layout(layout),
+    delimiter(std::move(delimiter))
+{
+  CUDF_EXPECTS(not this->partitions.empty(), "At least one topic/partition must be consumed");
+  CUDF_EXPECTS(batch_size > 0, "Kafka batch size must be greater than zero");
+
+  for (auto const& key_value : configs) {
+    std::string error_string;
+    CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK ==
+                   kafka_conf->set(key_value.first, key_value.second, error_string),
+                 "Invalid Kafka configuration");
+  }
+
+  if (python_callable != nullptr) {
+    std::string error_string;
+    // The callback must outlive the consumer, so it is owned by this object
+    oauth_callback = std::make_unique<python_oauth_refresh_callback>(callable_wrapper,
+                                                                     python_callable);
+    CUDF_EXPECTS(
+      RdKafka::Conf::ConfResult::CONF_OK ==
+        kafka_conf->set("oauthbearer_token_refresh_cb", oauth_callback.get(), error_string),
+      "Failed to set Kafka oauth callback");
+  }
+
+  // Kafka 0.9 > requires group.id in the configuration
+  std::string conf_val;
+  CUDF_EXPECTS(RdKafka::Conf::ConfResult::CONF_OK == kafka_conf->get("group.id", conf_val),
+               "Kafka group.id must be configured");
+
+  std::string errstr;
+  consumer = std::unique_ptr<RdKafka::KafkaConsumer>(
+    RdKafka::KafkaConsumer::create(kafka_conf.get(), errstr));
+  CUDF_EXPECTS(consumer != nullptr, "Failed to create Kafka consumer: " + errstr);
+
+  // Assign all partitions at once so that librdkafka fetches from them concurrently
+  std::vector<RdKafka::TopicPartition*> topic_partitions;
+  for (auto const& range : this->partitions) {
+    CUDF_EXPECTS(range.start_offset <= range.end_offset, "Invalid Kafka offset range");
+    if (range.start_offset == range.end_offset) { continue; }
+    remaining[{range.topic, range.partition}] = range.end_offset;
+    topic_partitions.push_back(
+      RdKafka::TopicPartition::create(range.topic, range.partition, range.start_offset));
+  }
+  auto const err = consumer->assign(topic_partitions);
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  CUDF_EXPECTS(err == RdKafka::ErrorCode::ERR_NO_ERROR, "Failed to assign Kafka partitions");
+
+  for (auto& buffer : buffers) {
+    reserve(buffer, batch_size);
+  }
+
+  pending_batch = std::async(std::launch::async, [this] { return consume_batch(0); });
+}
+
+kafka_batch_consumer::~kafka_batch_consumer()
+{
+  if (pending_batch.valid()) { pending_batch.wait(); }
+  auto const mr = cudf::io::get_host_memory_resource();
+  for (auto& buffer : buffers) {
+    if (buffer.data != nullptr) {
+      mr.deallocate(buffer.data, buffer.capacity, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+    }
+  }
+  if (consumer != nullptr) { consumer->close(); }
+}
+
+bool kafka_batch_consumer::has_next() const { return pending_batch.valid(); }
+
+kafka_batch kafka_batch_consumer::next_batch()
+{
+  CUDF_EXPECTS(has_next(), "No more Kafka batches to consume");
+  auto batch = pending_batch.get();
+
+  // The buffer of the previously returned batch is free again; consume the next batch into it
+  if (not remaining.empty()) {
+    pending_buffer = 1 - pending_buffer;
+    pending_batch  = std::async(std::launch::async,
+                               [this, index = pending_buffer] { return consume_batch(index); });
+  }
+  return batch;
+}
+
+void kafka_batch_consumer::commit(kafka_batch const& batch)
+{
+  std::vector<RdKafka::TopicPartition*> topic_partitions;
+  for (auto const& [topic_partition, offset] : batch.next_offsets) {
+    topic_partitions.push_back(
+      RdKafka::TopicPartition::create(topic_partition.first, topic_partition.second, offset));
+  }
+  auto const err = consumer->commitSync(topic_partitions);
+  RdKafka::TopicPartition::destroy(topic_partitions);
+  CUDF_EXPECTS(err == RdKafka::ErrorCode::ERR_NO_ERROR, "Failed to commit consumer offsets");
+}
+
+void kafka_batch_consumer::reserve(pinned_buffer& buffer, std::size_t bytes)
+{
+  if (bytes <= buffer.capacity) { return; }
+  auto const mr  = cudf::io::get_host_memory_resource();
+  auto const ptr = static_cast<std::byte*>(mr.allocate(bytes, rmm::RMM_DEFAULT_HOST_ALIGNMENT));
+  if (buffer.data != nullptr) {
+    std::memcpy(ptr, buffer.data, buffer.size);
+    mr.deallocate(buffer.data, buffer.capacity, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+  }
+  buffer.data     = ptr;
+  buffer.capacity = bytes;
+}
+
+void kafka_batch_consumer::append(pinned_buffer& buffer,
+                                  RdKafka::Message const& msg,
+                                  kafka_batch& batch)
+{
+  auto dst = buffer.data + buffer.size;
+  if (layout == message_layout::LENGTH_PREFIXED) {
+    auto const length = static_cast<uint32_t>(msg.len());
+    uint8_t const prefix[sizeof(length)]{static_cast<uint8_t>(length),
+                                         static_cast<uint8_t>(length >> 8),
+                                         static_cast<uint8_t>(length >> 16),
+                                         static_cast<uint8_t>(length >> 24)};
+    std::memcpy(dst, prefix, sizeof(prefix));
+    dst += sizeof(prefix);
+  }
+  auto& metadata = batch.metadata;
+  metadata.payload_offsets.push_back(static_cast<std::size_t>(dst - buffer.data));
+  metadata.payload_sizes.push_back(static_cast<cudf::size_type>(msg.len()));
+  std::memcpy(dst, msg.payload(), msg.len());
+  dst += msg.len();
+  if (layout == message_layout::DELIMITED) {
+    std::memcpy(dst, delimiter.data(), delimiter.size());
+    dst += delimiter.size();
+  }
+  buffer.size = static_cast<std::size_t>(dst - buffer.data);
+
+  auto const key = static_cast<char const*>(msg.key_pointer());
+  metadata.has_key.push_back(key != nullptr);
+  if (key != nullptr) {
+    metadata.key_chars.insert(metadata.key_chars.end(), key, key + msg.key_len());
+  }
+  metadata.key_offsets.push_back(static_cast<cudf::size_type>(metadata.key_chars.size()));
+  metadata.partitions.push_back(msg.partition());
+  metadata.offsets.push_back(msg.offset());
+  metadata.timestamps.push_back(msg.timestamp().timestamp);
+}
+
+namespace {
+
+/**
+ * @brief Create a strings column from rows of a host buffer
+ *
+ * The buffer is copied to the device once and the rows are gathered from it on the device.
+ */
+std::unique_ptr<cudf::column> make_strings_column_from_host(
+  cudf::host_span<char const> chars,
+  cudf::host_span<std::size_t const> row_offsets,
+  cudf::host_span<cudf::size_type const> row_sizes,
+  std::vector<bool> const* row_valid,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  using string_index_pair = thrust::pair<char const*, cudf::size_type>;
+
+  rmm::device_buffer d_chars(chars.data(), chars.size(), stream);
+  auto const d_base = static_cast<char const*>(d_chars.data());
+
+  std::vector<string_index_pair> rows(row_offsets.size());
+  for (std::size_t i = 0; i < rows.size(); ++i) {
+    rows[i] = (row_valid == nullptr or (*row_valid)[i])
+                ? string_index_pair{d_base + row_offsets[i], row_sizes[i]}
+                : string_index_pair{nullptr, 0};
+  }
+  rmm::device_buffer d_rows(rows.data(), rows.size() * sizeof(string_index_pair), stream);
+
+  auto result = cudf::make_strings_column(
+    cudf::device_span<string_index_pair const>{static_cast<string_index_pair const*>(d_rows.data()),
+                                               rows.size()},
+    stream,
+    mr);
+  // the host rows must stay alive until the copies complete
+  stream.synchronize();
+  return result;
+}
+
+template <typename T>
+std::unique_ptr<cudf::column> make_fixed_width_column_from_host(cudf::type_id type,
+                                                                std::vector<T> const& values,
+                                                                rmm::cuda_stream_view stream,
+                                                                rmm::device_async_resource_ref mr)
+{
+  return std::make_unique<cudf::column>(
+    cudf::data_type{type},
+    static_cast<cudf::size_type>(values.size()),
+    rmm::device_buffer(values.data(), values.size() * sizeof(T), stream, mr),
+    rmm::device_buffer{},
+    0);
+}
+
+}  // namespace
+
+std::unique_ptr<cudf::table> kafka_batch::to_table(rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr) const
+{
+  std::vector<std::size_t> key_starts(num_messages);
+  std::vector<cudf::size_type> key_sizes(num_messages);
+  for (std::size_t i = 0; i < num_messages; ++i) {
+    key_starts[i] = metadata.key_offsets[i];
+    key_sizes[i]  = metadata.key_offsets[i + 1] - metadata.key_offsets[i];
+  }
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  columns.push_back(make_strings_column_from_host(
+    metadata.key_chars, key_starts, key_sizes, &metadata.has_key, stream, mr));
+  columns.push_back(
+    make_fixed_width_column_from_host(cudf::type_id::INT32, metadata.partitions, stream, mr));
+  columns.push_back(
+    make_fixed_width_column_from_host(cudf::type_id::INT64, metadata.offsets, stream, mr));
+  columns.push_back(make_fixed_width_column_from_host(
+    cudf::type_id::TIMESTAMP_MILLISECONDS, metadata.timestamps, stream, mr));
+  columns.push_back(make_strings_column_from_host(
+    cudf::host_span<char const>{reinterpret_cast<char const*>(data.data()), data.size()},
+    metadata.payload_offsets,
+    metadata.payload_sizes,
+    nullptr,
+    stream,
+    mr));
+  return std::make_unique<cudf::table>(std::move(columns));
+}
+
+kafka_batch kafka_batch_consumer::consume_batch(std::size_t index)
+{
+  auto& buffer = buffers[index];
+  buffer.size  = 0;
+  kafka_batch batch;
+
+  auto const framing = layout == message_layout::LENGTH_PREFIXED ? sizeof(uint32_t)
+                                                                 : delimiter.size();
+  auto const end = std::chrono::steady_clock::now() + std::chrono::milliseconds(batch_timeout);
+
+  while (not remaining.empty()) {
+    auto msg = std::move(carried_message);
+    if (msg == nullptr) {
+      auto const now = std::chrono::steady_clock::now();
+      if (now >= end) { break; }
+      auto const timeout_ms =
+        std::chrono::duration_cast<std::chrono::milliseconds>(end - now).count();
+      msg.reset(consumer->consume(static_cast<int>(timeout_ms)));
+    }
+
+    auto const toppar = std::make_pair(msg->topic_name(), static_cast<int>(msg->partition()));
+    if (msg->err() == RdKafka::ErrorCode::ERR__PARTITION_EOF) {
+      remaining.erase(toppar);
+      continue;
+    }
+    if (msg->err() != RdKafka::ErrorCode::ERR_NO_ERROR) { continue; }
+
+    auto const it = remaining.find(toppar);
+    if (it == remaining.end()) { continue; }
+
+    CUDF_EXPECTS(
+      msg->len() <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
+      "Kafka message exceeds the size limit of a string row");
+    auto const message_size = msg->len() + framing;
+    if (buffer.size + message_size > buffer.capacity) {
+      if (buffer.size > 0) {
+        // Keep the message for the next batch rather than growing the buffer
+        carried_message = std::move(msg);
+        break;
+      }
+      reserve(buffer, message_size);
+    }
+    append(buffer, *msg, batch);
+    ++batch.num_messages;
+
+    auto const next_offset     = msg->offset() + 1;
+    batch.next_offsets[toppar] = next_offset;
+    if (next_offset >= it->second) { remaining.erase(it); }
+  }
+
+  batch.data = cudf::host_span<std::byte const>{buffer.data, buffer.size};
+  return batch;
+}
+
+}  // namespace kafka
+}  // namespace external
+}  // namespace io
+}  // namespace cudf
@@ -16,7 +16,10 @@
 
 #include <cudf/io/csv.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 
+#include <cudf_kafka/kafka_batch_consumer.hpp>
 #include <cudf_kafka/kafka_consumer.hpp>
 
 #include <gtest/gtest.h>
@@ -24,6 +27,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace kafka = cudf::io::external::kafka;
 
@@ -67,3 +71,99 @@ TEST_F(KafkaDatasourceTest, InvalidConfigValues)
       kafka_configs, python_callable, callback_wrapper, "csv-topic", 0, 0, 3, 5000, "\n"),
     cudf::logic_error);
 }
+
+TEST_F(KafkaDatasourceTest, BatchConsumerMissingGroupID)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+
+  kafka::python_callable_type python_callable;
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper;
+  std::vector<kafka::topic_partition_range> partitions{{"json-topic", 0, 0, 3},
+                                                       {"json-topic", 1, 0, 3}};
+
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs,
+                                              python_callable,
+                                              callback_wrapper,
+                                              partitions,
+                                              1024 * 1024,
+                                              5000,
+                                              kafka::message_layout::DELIMITED),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, BatchConsumerInvalidArguments)
+{
+  std::map<std::string, std::string> kafka_configs;
+  kafka_configs["bootstrap.servers"] = "localhost:9092";
+  kafka_configs["group.id"]          = "cudf-batch-test";
+
+  kafka::python_callable_type python_callable{};
+  kafka::kafka_oauth_callback_wrapper_type callback_wrapper{};
+
+  // no partitions to consume
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs,
+                                              python_callable,
+                                              callback_wrapper,
+                                              {},
+                                              1024 * 1024,
+                                              5000,
+                                              kafka::message_layout::LENGTH_PREFIXED),
+               cudf::logic_error);
+
+  // zero sized batches
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs,
+                                              python_callable,
+                                              callback_wrapper,
+                                              {{"json-topic", 0, 0, 3}},
+                                              0,
+                                              5000,
+                                              kafka::message_layout::LENGTH_PREFIXED),
+               cudf::logic_error);
+
+  // end offset before the start offset
+  EXPECT_THROW(kafka::kafka_batch_consumer kc(kafka_configs,
+                                              python_callable,
+                                              callback_wrapper,
+                                              {{"json-topic", 0, 5, 3}},
+                                              1024 * 1024,
+                                              5000,
+                                              kafka::message_layout::LENGTH_PREFIXED),
+               cudf::logic_error);
+}
+
+TEST_F(KafkaDatasourceTest, BatchToTable)
+{
+  // two length-prefixed messages, the second one without a key
+  std::string const data = std::string("\x03\x00\x00\x00", 4) + "abc" +
+                           std::string("\x02\x00\x00\x00", 4) + "de";
+
+  kafka::kafka_batch batch;
+  batch.data = cudf::host_span<std::byte const>{reinterpret_cast<std::byte const*>(data.data()),
+                                                data.size()};
+  batch.num_messages = 2;
+
+  auto& metadata           = batch.metadata;
+  metadata.key_chars       = {'k', '1'};
+  metadata.key_offsets     = {0, 2, 2};
+  metadata.has_key         = {true, false};
+  metadata.partitions      = {0, 1};
+  metadata.offsets         = {10, 20};
+  metadata.timestamps      = {1000, 2000};
+  metadata.payload_offsets = {4, 11};
+  metadata.payload_sizes   = {3, 2};
+
+  auto const result = batch.to_table();
+  ASSERT_EQ(result->num_columns(), 5);
+  EXPECT_EQ(result->num_rows(), 2);
+
+  auto const view = result->view();
+  EXPECT_EQ(view.column(0).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(view.column(0).null_count(), 1);
+  EXPECT_EQ(view.column(1).type().id(), cudf::type_id::INT32);
+  EXPECT_EQ(view.column(2).type().id(), cudf::type_id::INT64);
+  EXPECT_EQ(view.column(3).type().id(), cudf::type_id::TIMESTAMP_MILLISECONDS);
+  EXPECT_EQ(view.column(4).type().id(), cudf::type_id::STRING);
+  EXPECT_EQ(view.column(4).null_count(), 0);
+  EXPECT_EQ(cudf::strings_column_view(view.column(4)).chars_size(cudf::get_default_stream()), 5);
+}
@@ -230,6 +230,24 @@ std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
   return visit(col_type, static_cast<aggregation const&>(agg));
 }
 
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, hyperloglog_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, merge_hyperloglog_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
+std::vector<std::unique_ptr<aggregation>> simple_aggregations_collector::visit(
+  data_type col_type, top_k_aggregation const& agg)
+{
+  return visit(col_type, static_cast<aggregation const&>(agg));
+}
+
 // aggregation_finalizer ----------------------------------------
 
 void aggregation_finalizer::visit(aggregation const& agg) {}
@@ -398,6 +416,21 @@ void aggregation_finalizer::visit(merge_tdigest_aggregation const& agg)
   visit(static_cast<aggregation const&>(agg));
 }
 
+void aggregation_finalizer::visit(hyperloglog_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(merge_hyperloglog_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
+void aggregation_finalizer::visit(top_k_aggregation const& agg)
+{
+  visit(static_cast<aggregation const&>(agg));
+}
+
 }  // namespace detail
 
 std::vector<std::unique_ptr<aggregation>> aggregation::get_simple_aggregations(
@@ -853,6 +886,39 @@ template std::unique_ptr<groupby_aggregation> make_merge_tdigest_aggregation<gro
 template std::unique_ptr<reduce_aggregation> make_merge_tdigest_aggregation<reduce_aggregation>(
   int max_centroids);
 
+template <typename Base>
+std::unique_ptr<Base> make_top_k_aggregation(size_type k, order column_order)
+{
+  return std::make_unique<detail::top_k_aggregation>(k, column_order);
+}
+template std::unique_ptr<aggregation> make_top_k_aggregation<aggregation>(size_type k,
+                                                                          order column_order);
+template std::unique_ptr<groupby_aggregation> make_top_k_aggregation<groupby_aggregation>(
+  size_type k, order column_order);
+
+template <typename Base>
+std::unique_ptr<Base> make_hyperloglog_aggregation(int precision)
+{
+  return std::make_unique<detail::hyperloglog_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_hyperloglog_aggregation<aggregation>(int precision);
+template std::unique_ptr<groupby_aggregation> make_hyperloglog_aggregation<groupby_aggregation>(
+  int precision);
+template std::unique_ptr<reduce_aggregation> make_hyperloglog_aggregation<reduce_aggregation>(
+  int precision);
+
+template <typename Base>
+std::unique_ptr<Base> make_merge_hyperloglog_aggregation(int precision)
+{
+  return std::make_unique<detail::merge_hyperloglog_aggregation>(precision);
+}
+template std::unique_ptr<aggregation> make_merge_hyperloglog_aggregation<aggregation>(
+  int precision);
+template std::unique_ptr<groupby_aggregation>
+make_merge_hyperloglog_aggregation<groupby_aggregation>(int precision);
+template std::unique_ptr<reduce_aggregation> make_merge_hyperloglog_aggregation<reduce_aggregation>(
+  int precision);
+
 namespace detail {
 namespace {
 struct target_type_functor {
@@ -0,0 +1,167 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expression_builder.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+namespace cudf {
+namespace ast {
+namespace {
+
+/**
+ * @brief Returns the AST operator computing the same result as a binary operator
+ */
+ast_operator to_ast_operator(binary_operator op)
+{
+  switch (op) {
+    case binary_operator::ADD: return ast_operator::ADD;
+    case binary_operator::SUB: return ast_operator::SUB;
+    case binary_operator::MUL: return ast_operator::MUL;
+    case binary_operator::DIV: return ast_operator::DIV;
+    case binary_operator::TRUE_DIV: return ast_operator::TRUE_DIV;
+    case binary_operator::MOD: return ast_operator::MOD;
+    case binary_operator::PYMOD: return ast_operator::PYMOD;
+    case binary_operator::POW: return ast_operator::POW;
+    case binary_operator::BITWISE_AND: return ast_operator::BITWISE_AND;
+    case binary_operator::BITWISE_OR: return ast_operator::BITWISE_OR;
+    case binary_operator::BITWISE_XOR: return ast_operator::BITWISE_XOR;
+    case binary_operator::LOGICAL_AND: return ast_operator::LOGICAL_AND;
+    case binary_operator::LOGICAL_OR: return ast_operator::LOGICAL_OR;
+    case binary_operator::EQUAL: return ast_operator::EQUAL;
+    case binary_operator::NOT_EQUAL: return ast_operator::NOT_EQUAL;
+    case binary_operator::LESS: return ast_operator::LESS;
+    case binary_operator::GREATER: return ast_operator::GREATER;
+    case binary_operator::LESS_EQUAL: return ast_operator::LESS_EQUAL;
+    case binary_operator::GREATER_EQUAL: return ast_operator::GREATER_EQUAL;
+    case binary_operator::NULL_EQUALS: return ast_operator::NULL_EQUAL;
+    case binary_operator::NULL_LOGICAL_AND: return ast_operator::NULL_LOGICAL_AND;
+    case binary_operator::NULL_LOGICAL_OR: return ast_operator::NULL_LOGICAL_OR;
+    default: CUDF_FAIL("Unsupported binary operator for expression_builder");
+  }
+}
+
+/**
+ * @brief Returns the AST operator computing the same result as a unary operator
+ */
+ast_operator to_ast_operator(unary_operator op)
+{
+  switch (op) {
+    case unary_operator::SIN: return ast_operator::SIN;
+    case unary_operator::COS: return ast_operator::COS;
+    case unary_operator::TAN: return ast_operator::TAN;
+    case unary_operator::ARCSIN: return ast_operator::ARCSIN;
+    case unary_operator::ARCCOS: return ast_operator::ARCCOS;
+    case unary_operator::ARCTAN: return ast_operator::ARCTAN;
+    case unary_operator::SINH: return ast_operator::SINH;
+    case unary_operator::COSH: return ast_operator::COSH;
+    case unary_operator::TANH: return ast_operator::TANH;
+    case unary_operator::ARCSINH: return ast_operator::ARCSINH;
+    case unary_operator::ARCCOSH: return ast_operator::ARCCOSH;
+    case unary_operator::ARCTANH: return ast_operator::ARCTANH;
+    case unary_operator::EXP: return ast_operator::EXP;
+    case unary_operator::LOG: return ast_operator::LOG;
+    case unary_operator::SQRT: return ast_operator::SQRT;
+    case unary_operator::CBRT: return ast_operator::CBRT;
+    case unary_operator::CEIL: return ast_operator::CEIL;
+    case unary_operator::FLOOR: return ast_operator::FLOOR;
+    case unary_operator::ABS: return ast_operator::ABS;
+    case unary_operator::RINT: return ast_operator::RINT;
+    case unary_operator::BIT_INVERT: return ast_operator::BIT_INVERT;
+    case unary_operator::NOT: return ast_operator::NOT;
+    default: CUDF_FAIL("Unsupported unary operator for expression_builder");
+  }
+}
+
+/**
+ * @brief Returns the type both operands are cast to when their numeric types differ
+ */
+data_type common_type(data_type lhs, data_type rhs)
+{
+  if (is_floating_point(lhs) || is_floating_point(rhs)) { return data_type{type_id::FLOAT64}; }
+  if (is_unsigned(lhs) && is_unsigned(rhs)) { return data_type{type_id::UINT64}; }
+  return data_type{type_id::INT64};
+}
+
+}  // namespace
+
+expression_builder::node expression_builder::column(column_view const& col)
+{
+  CUDF_EXPECTS(_columns.empty() || _columns.front().size() == col.size(),
+               "All columns of an expression must have the same size");
+  auto const& expr = _column_refs.emplace_back(static_cast<size_type>(_columns.size()));
+  _columns.push_back(col);
+  return node{expr, col.type()};
+}
+
+expression_builder::node expression_builder::unary(ast_operator op, node input)
+{
+  CUDF_EXPECTS(detail::ast_operator_arity(op) == 1, "Operator requires one operand");
+  auto const type  = detail::ast_operator_return_type(op, {input.type()});
+  auto const& expr = _operations.emplace_back(op, input.get_expression());
+  return node{expr, type};
+}
+
+expression_builder::node expression_builder::unary(unary_operator op, node input)
+{
+  return unary(to_ast_operator(op), input);
+}
+
+expression_builder::node expression_builder::binary(ast_operator op, node lhs, node rhs)
+{
+  CUDF_EXPECTS(detail::ast_operator_arity(op) == 2, "Operator requires two operands");
+  if (lhs.type() != rhs.type() && is_numeric(lhs.type()) && is_numeric(rhs.type())) {
+    auto const type = common_type(lhs.type(), rhs.type());
+    lhs             = cast(lhs, type);
+    rhs             = cast(rhs, type);
+  }
+  auto const type  = detail::ast_operator_return_type(op, {lhs.type(), rhs.type()});
+  auto const& expr = _operations.emplace_back(op, lhs.get_expression(), rhs.get_expression());
+  return node{expr, type};
+}
+
+expression_builder::node expression_builder::binary(binary_operator op, node lhs, node rhs)
+{
+  return binary(to_ast_operator(op), lhs, rhs);
+}
+
+expression_builder::node expression_builder::cast(node input, data_type type)
+{
+  if (input.type() == type) { return input; }
+  switch (type.id()) {
+    case type_id::INT64: return unary(ast_operator::CAST_TO_INT64, input);
+    case type_id::UINT64: return unary(ast_operator::CAST_TO_UINT64, input);
+    case type_id::FLOAT64: return unary(ast_operator::CAST_TO_FLOAT64, input);
+    default: CUDF_FAIL("Expressions can only be cast to INT64, UINT64 or FLOAT64");
+  }
+}
+
+std::unique_ptr<cudf::column> expression_builder::evaluate(node result,
+                                                           rmm::cuda_stream_view stream,
+                                                           rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return cudf::detail::compute_column_jit(table(), result.get_expression(), stream, mr);
+}
+
+}  // namespace ast
+}  // namespace cudf
@@ -133,26 +133,43 @@ bool is_same_scale_necessary(binary_operator op)
   return op != binary_operator::MUL && op != binary_operator::DIV;
 }
 
+/**
+ * @brief Returns `true` if `type` is supported by binary operations with a PTX function
+ */
+bool is_type_supported_ptx(data_type type)
+{
+  return is_fixed_width(type) and not is_fixed_point(type) and
+         type.id() != type_id::INT8;  // Numba PTX doesn't support int8
+}
+
 namespace jit {
-void binary_operation(mutable_column_view& out,
-                      column_view const& lhs,
-                      column_view const& rhs,
-                      std::string const& ptx,
-                      rmm::cuda_stream_view stream)
+jitify2::Kernel get_binary_kernel(data_type output_type,
+                                  data_type lhs_type,
+                                  data_type rhs_type,
+                                  std::string const& ptx)
 {
-  std::string const output_type_name = cudf::type_to_name(out.type());
+  std::string const output_type_name = cudf::type_to_name(output_type);
 
   std::string cuda_source =
     cudf::jit::parse_single_function_ptx(ptx, "GENERIC_BINARY_OP", output_type_name);
 
   std::string kernel_name = jitify2::reflection::Template("cudf::binops::jit::kernel_v_v")
                               .instantiate(output_type_name,  // list of template arguments
-                                           cudf::type_to_name(lhs.type()),
-                                           cudf::type_to_name(rhs.type()),
+                                           cudf::type_to_name(lhs_type),
+                                           cudf::type_to_name(rhs_type),
                                            std::string("cudf::binops::jit::UserDefinedOp"));
 
-  cudf::jit::get_program_cache(*binaryop_jit_kernel_cu_jit)
-    .get_kernel(kernel_name, {}, {{"binaryop/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})
+  return cudf::jit::get_kernel(
+    *binaryop_jit_kernel_cu_jit, kernel_name, "binaryop/jit/operation-udf.hpp", cuda_source);
+}
+
+void binary_operation(mutable_column_view& out,
+                      column_view const& lhs,
+                      column_view const& rhs,
+                      std::string const& ptx,
+                      rmm::cuda_stream_view stream)
+{
+  get_binary_kernel(out.type(), lhs.type(), rhs.type(), ptx)
     ->configure_1d_max_occupancy(0, 0, 0, stream.value())
     ->launch(out.size(),
              cudf::jit::get_data_ptr(out),
@@ -356,14 +373,9 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
                                          rmm::device_async_resource_ref mr)
 {
   // Check for datatype
-  auto is_type_supported_ptx = [](data_type type) -> bool {
-    return is_fixed_width(type) and not is_fixed_point(type) and
-           type.id() != type_id::INT8;  // Numba PTX doesn't support int8
-  };
-
-  CUDF_EXPECTS(is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
-  CUDF_EXPECTS(is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+  CUDF_EXPECTS(binops::is_type_supported_ptx(lhs.type()), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(binops::is_type_supported_ptx(rhs.type()), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(binops::is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
 
   CUDF_EXPECTS((lhs.size() == rhs.size()), "Column sizes don't match");
 
@@ -379,6 +391,18 @@ std::unique_ptr<column> binary_operation(column_view const& lhs,
   out->set_null_count(cudf::detail::null_count(out_view.null_mask(), 0, out->size(), stream));
   return out;
 }
+
+void precompile_binary_operation(data_type lhs_type,
+                                 data_type rhs_type,
+                                 std::string const& ptx,
+                                 data_type output_type)
+{
+  CUDF_EXPECTS(binops::is_type_supported_ptx(lhs_type), "Invalid/Unsupported lhs datatype");
+  CUDF_EXPECTS(binops::is_type_supported_ptx(rhs_type), "Invalid/Unsupported rhs datatype");
+  CUDF_EXPECTS(binops::is_type_supported_ptx(output_type), "Invalid/Unsupported output datatype");
+
+  binops::jit::get_binary_kernel(output_type, lhs_type, rhs_type, ptx);
+}
 }  // namespace detail
 
 int32_t binary_operation_fixed_point_scale(binary_operator op,
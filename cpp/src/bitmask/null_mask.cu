@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/null_mask.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -42,6 +43,8 @@
 #include <thrust/extrema.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
 #include <numeric>
 #include <type_traits>
 
@@ -510,6 +513,238 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
   return std::pair(std::move(null_mask), 0);
 }
 
+namespace {
+
+/// Number of consecutive mask words each thread combines, one 128-bit vector
+constexpr size_type words_per_thread = sizeof(uint4) / sizeof(bitmask_type);
+
+/**
+ * @brief The masks of one table combined by `batched_bitmask_binop_kernel`.
+ */
+struct mask_segment {
+  bitmask_type* destination;  ///< Combined mask of the table
+  size_type first_mask;       ///< Index of the table's first source mask
+  size_type num_masks;        ///< Number of source masks of the table
+  size_type size_bits;        ///< Number of rows of the table
+  size_type first_block;      ///< First thread block combining the table's masks
+};
+
+/**
+ * @brief Reads `words_per_thread` words of a source mask, shifted to start at `begin_bit`.
+ *
+ * When `begin_bit` is word-aligned and the words are 16-byte aligned and within the mask, they
+ * are read with a single 128-bit load.
+ */
+__device__ void load_mask_words(bitmask_type const* mask,
+                                size_type begin_bit,
+                                size_type size_bits,
+                                size_type first_word,
+                                size_type num_words,
+                                bitmask_type (&words)[words_per_thread])
+{
+  auto const source     = mask + word_index(begin_bit) + first_word;
+  auto const end_word   = word_index(begin_bit + size_bits - 1) + 1;
+  auto const is_aligned = intra_word_index(begin_bit) == 0 &&
+                          word_index(begin_bit) + first_word + words_per_thread <= end_word &&
+                          reinterpret_cast<std::uintptr_t>(source) % sizeof(uint4) == 0;
+  if (is_aligned) {
+    auto const vector = *reinterpret_cast<uint4 const*>(source);
+    words[0]          = vector.x;
+    words[1]          = vector.y;
+    words[2]          = vector.z;
+    words[3]          = vector.w;
+    return;
+  }
+  for (size_type i = 0; i < words_per_thread; ++i) {
+    words[i] = first_word + i < num_words
+                 ? get_mask_offset_word(mask, first_word + i, begin_bit, begin_bit + size_bits)
+                 : 0;
+  }
+}
+
+/**
+ * @brief Combines the masks of several tables, each block working on the masks of one table.
+ *
+ * @param op The binary operator used to combine the masks
+ * @param segments The tables whose masks are combined, ordered by `first_block`
+ * @param masks The source masks of all tables
+ * @param begin_bits The bit offset of each source mask
+ * @param set_counts Output count of set bits in the combined mask of each table
+ */
+template <int block_size, typename Binop>
+CUDF_KERNEL void batched_bitmask_binop_kernel(Binop op,
+                                              device_span<mask_segment const> segments,
+                                              bitmask_type const* const* masks,
+                                              size_type const* begin_bits,
+                                              size_type* set_counts)
+{
+  auto const block = static_cast<size_type>(blockIdx.x);
+  size_type lo     = 0;
+  size_type hi     = static_cast<size_type>(segments.size());
+  while (hi - lo > 1) {
+    auto const mid = lo + (hi - lo) / 2;
+    if (segments[mid].first_block <= block) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  auto const segment   = segments[lo];
+  auto const num_words = util::div_rounding_up_unsafe(
+    segment.size_bits, static_cast<size_type>(size_in_bits<bitmask_type>()));
+  auto const first_word = ((block - segment.first_block) * block_size +
+                           static_cast<size_type>(threadIdx.x)) *
+                          words_per_thread;
+
+  size_type thread_count = 0;
+  if (first_word < num_words) {
+    bitmask_type result[words_per_thread];
+    load_mask_words(masks[segment.first_mask],
+                    begin_bits[segment.first_mask],
+                    segment.size_bits,
+                    first_word,
+                    num_words,
+                    result);
+    for (auto m = segment.first_mask + 1; m < segment.first_mask + segment.num_masks; ++m) {
+      bitmask_type words[words_per_thread];
+      load_mask_words(masks[m], begin_bits[m], segment.size_bits, first_word, num_words, words);
+      for (size_type i = 0; i < words_per_thread; ++i) {
+        result[i] = op(result[i], words[i]);
+      }
+    }
+
+    // mask out the bits past the end of the last word
+    auto const last_word = num_words - 1;
+    if (first_word + words_per_thread > last_word && intra_word_index(segment.size_bits) != 0) {
+      result[last_word - first_word] &=
+        set_least_significant_bits(intra_word_index(segment.size_bits));
+    }
+
+    if (first_word + words_per_thread <= num_words) {
+      *reinterpret_cast<uint4*>(segment.destination + first_word) =
+        uint4{result[0], result[1], result[2], result[3]};
+    } else {
+      for (size_type i = 0; first_word + i < num_words; ++i) {
+        segment.destination[first_word + i] = result[i];
+      }
+    }
+    for (size_type i = 0; i < words_per_thread && first_word + i < num_words; ++i) {
+      thread_count += __popc(result[i]);
+    }
+  }
+
+  using BlockReduce = cub::BlockReduce<size_type, block_size>;
+  __shared__ typename BlockReduce::TempStorage temp_storage;
+  size_type const block_count = BlockReduce(temp_storage).Sum(thread_count);
+  if (threadIdx.x == 0) { atomicAdd(set_counts + lo, block_count); }
+}
+
+/**
+ * @brief Combines the column masks of each table with `op` in a single kernel launch.
+ *
+ * @param op The binary operator used to combine the masks
+ * @param views The tables whose column masks are combined
+ * @param require_all_nullable Whether a table gets a mask only if all its columns are nullable,
+ *        rather than if any column is
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned device_buffers
+ * @return A pair of resulting bitmask and count of unset bits for each table
+ */
+template <typename Binop>
+std::vector<std::pair<rmm::device_buffer, size_type>> batched_bitmask_binop(
+  Binop op,
+  host_span<table_view const> views,
+  bool require_all_nullable,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  constexpr int block_size = 256;
+
+  std::vector<std::pair<rmm::device_buffer, size_type>> results;
+  std::vector<bitmask_type const*> masks;
+  std::vector<size_type> begin_bits;
+  std::vector<mask_segment> segments;
+  std::vector<std::size_t> segment_results;
+  size_type num_blocks = 0;
+
+  for (auto const& view : views) {
+    results.emplace_back(rmm::device_buffer{0, stream, mr}, 0);
+    if (view.num_rows() == 0 or view.num_columns() == 0) { continue; }
+
+    auto const first_mask = static_cast<size_type>(masks.size());
+    for (auto const& col : view) {
+      if (col.nullable()) {
+        masks.push_back(col.null_mask());
+        begin_bits.push_back(col.offset());
+      }
+    }
+    auto const num_masks = static_cast<size_type>(masks.size()) - first_mask;
+    if (num_masks == 0 or (require_all_nullable and num_masks != view.num_columns())) {
+      masks.resize(first_mask);
+      begin_bits.resize(first_mask);
+      continue;
+    }
+
+    results.back().first =
+      rmm::device_buffer{bitmask_allocation_size_bytes(view.num_rows()), stream, mr};
+    segments.push_back(mask_segment{static_cast<bitmask_type*>(results.back().first.data()),
+                                    first_mask,
+                                    num_masks,
+                                    view.num_rows(),
+                                    num_blocks});
+    segment_results.push_back(results.size() - 1);
+    num_blocks += util::div_rounding_up_safe(num_bitmask_words(view.num_rows()),
+                                             block_size * words_per_thread);
+  }
+  if (segments.empty()) { return results; }
+
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const d_segments   = make_device_uvector_async(segments, stream, temp_mr);
+  auto const d_masks      = make_device_uvector_async(masks, stream, temp_mr);
+  auto const d_begin_bits = make_device_uvector_async(begin_bits, stream, temp_mr);
+  auto d_set_counts       = rmm::device_uvector<size_type>(segments.size(), stream, temp_mr);
+  CUDF_CUDA_TRY(cudaMemsetAsync(
+    d_set_counts.data(), 0, d_set_counts.size() * sizeof(size_type), stream.value()));
+
+  batched_bitmask_binop_kernel<block_size><<<num_blocks, block_size, 0, stream.value()>>>(
+    op, d_segments, d_masks.data(), d_begin_bits.data(), d_set_counts.data());
+  CUDF_CHECK_CUDA(stream.value());
+
+  auto const set_counts = make_std_vector_sync(d_set_counts, stream);
+  for (std::size_t i = 0; i < segments.size(); ++i) {
+    results[segment_results[i]].second = segments[i].size_bits - set_counts[i];
+  }
+  return results;
+}
+
+}  // namespace
+
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_bitmask_binop(
+    [] __device__(bitmask_type left, bitmask_type right) { return left & right; },
+    views,
+    false,
+    stream,
+    mr);
+}
+
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return batched_bitmask_binop(
+    [] __device__(bitmask_type left, bitmask_type right) { return left | right; },
+    views,
+    true,
+    stream,
+    mr);
+}
+
 void set_all_valid_null_masks(column_view const& input,
                               column& output,
                               rmm::cuda_stream_view stream,
@@ -525,6 +760,42 @@ void set_all_valid_null_masks(column_view const& input,
   }
 }
 
+column_view compact_null_masks(column_view const& input)
+{
+  std::vector<column_view> children;
+  std::transform(input.child_begin(),
+                 input.child_end(),
+                 std::back_inserter(children),
+                 [](auto const& child) { return compact_null_masks(child); });
+  auto const has_nulls = input.has_nulls();
+  return column_view{input.type(),
+                     input.size(),
+                     input.head(),
+                     has_nulls ? input.null_mask() : nullptr,
+                     has_nulls ? input.null_count() : 0,
+                     input.offset(),
+                     children};
+}
+
+void compact_null_masks(column& input)
+{
+  if (input.nullable() and input.null_count() == 0) {
+    input.set_null_mask(rmm::device_buffer{}, 0);
+  }
+  for (size_type i = 0; i < input.num_children(); ++i) {
+    compact_null_masks(input.child(i));
+  }
+}
+
+table_view compact_null_masks(table_view const& input)
+{
+  std::vector<column_view> columns;
+  std::transform(input.begin(), input.end(), std::back_inserter(columns), [](auto const& col) {
+    return compact_null_masks(col);
+  });
+  return table_view{columns};
+}
+
 }  // namespace detail
 
 // Create a bitmask from a specific range
@@ -563,6 +834,24 @@ std::pair<rmm::device_buffer, size_type> bitmask_or(table_view const& view,
   return detail::bitmask_or(view, stream, mr);
 }
 
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_and(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bitmask_and(views, stream, mr);
+}
+
+std::vector<std::pair<rmm::device_buffer, size_type>> bitmask_or(
+  host_span<table_view const> views,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::bitmask_or(views, stream, mr);
+}
+
 // Count non-zero bits in the specified range
 cudf::size_type null_count(bitmask_type const* bitmask,
                            size_type start,
@@ -573,4 +862,22 @@ cudf::size_type null_count(bitmask_type const* bitmask,
   return detail::null_count(bitmask, start, stop, stream);
 }
 
+column_view compact_null_masks(column_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compact_null_masks(input);
+}
+
+table_view compact_null_masks(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compact_null_masks(input);
+}
+
+void compact_null_masks(column& input)
+{
+  CUDF_FUNC_RANGE();
+  detail::compact_null_masks(input);
+}
+
 }  // namespace cudf
@@ -0,0 +1,382 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+namespace nvcomp = cudf::io::nvcomp;
+
+// Size of the blocks a chunk is split into for compression
+constexpr std::size_t compression_block_size = 64 * 1024;
+// Alignment of the compressed blocks within a stored chunk
+constexpr std::size_t compressed_block_alignment = 8;
+// Number of alternating buffers
+constexpr int num_tickets = 2;
+
+/**
+ * @brief Returns the nvCOMP codec of a packed chunk compression, or `std::nullopt` for `NONE`
+ */
+std::optional<nvcomp::compression_type> to_nvcomp_codec(packed_compression compression)
+{
+  switch (compression) {
+    case packed_compression::NONE: return std::nullopt;
+    case packed_compression::LZ4: return nvcomp::compression_type::LZ4;
+    case packed_compression::ZSTD: return nvcomp::compression_type::ZSTD;
+    default: CUDF_FAIL("Unsupported packed chunk compression");
+  }
+}
+
+/**
+ * @brief Returns the number of compression blocks of a chunk
+ */
+std::size_t num_blocks(std::size_t chunk_size)
+{
+  return cudf::util::div_rounding_up_safe(chunk_size, compression_block_size);
+}
+
+/**
+ * @brief Returns the offset of the first block in a compressed chunk, after the block sizes
+ */
+std::size_t blocks_offset(std::size_t chunk_size)
+{
+  return cudf::util::round_up_safe(num_blocks(chunk_size) * sizeof(uint32_t),
+                                   compressed_block_alignment);
+}
+
+/**
+ * @brief Device and host buffers of one of the alternating pipeline slots
+ */
+struct pack_ticket {
+  cudaEvent_t event;                               // Last use of the buffers of the slot
+  rmm::device_buffer chunk;                        // Packed chunk
+  rmm::device_buffer compressed;                   // Compressed blocks, one per output slot
+  rmm::device_buffer encoded;                      // Compressed blocks gathered contiguously
+  cudf::detail::pinned_host_vector<uint8_t> host;  // Host copy of the stored chunk
+  std::optional<std::size_t> pending;              // Index of the chunk being copied out
+  std::size_t stored_size = 0;                     // Size of the stored chunk being copied out
+};
+
+/**
+ * @brief Compresses a packed chunk into the `encoded` buffer of the ticket
+ *
+ * The sizes of the blocks are written to the start of the host buffer of the ticket; the device
+ * bytes following them are returned for the copy to host memory. Blocks that do not get smaller
+ * are stored uncompressed.
+ *
+ * @return Size of the stored chunk, or `std::nullopt` if the chunk does not get smaller
+ */
+std::optional<std::size_t> compress_chunk(pack_ticket& ticket,
+                                          std::size_t chunk_size,
+                                          nvcomp::compression_type codec,
+                                          std::size_t slot_size,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref temp_mr)
+{
+  auto const count     = num_blocks(chunk_size);
+  auto const* d_chunk  = static_cast<uint8_t const*>(ticket.chunk.data());
+  auto* const d_slots  = static_cast<uint8_t*>(ticket.compressed.data());
+  auto* const d_encode = static_cast<uint8_t*>(ticket.encoded.data());
+
+  std::vector<device_span<uint8_t const>> inputs;
+  std::vector<device_span<uint8_t>> outputs;
+  for (std::size_t b = 0; b < count; ++b) {
+    auto const offset = b * compression_block_size;
+    inputs.emplace_back(d_chunk + offset, std::min(compression_block_size, chunk_size - offset));
+    outputs.emplace_back(d_slots + b * slot_size, slot_size);
+  }
+  auto const d_inputs  = cudf::detail::make_device_uvector_async(inputs, stream, temp_mr);
+  auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream, temp_mr);
+  rmm::device_uvector<cudf::io::compression_result> d_results(count, stream, temp_mr);
+  nvcomp::batched_compress(codec, d_inputs, d_outputs, d_results, stream);
+  auto const results = cudf::detail::make_std_vector_sync(d_results, stream);
+
+  // gather the stored blocks after the block sizes
+  auto const header_size = blocks_offset(chunk_size);
+  std::vector<uint32_t> sizes(count);
+  std::vector<device_span<uint8_t const>> gather_in;
+  std::vector<device_span<uint8_t>> gather_out;
+  auto pos = header_size;
+  for (std::size_t b = 0; b < count; ++b) {
+    auto const is_compressed = results[b].status == cudf::io::compression_status::SUCCESS and
+                               results[b].bytes_written < inputs[b].size();
+    sizes[b] = is_compressed ? results[b].bytes_written : inputs[b].size();
+    pos      = cudf::util::round_up_safe(pos, compressed_block_alignment);
+    if (pos + sizes[b] >= chunk_size) { return std::nullopt; }
+    gather_in.emplace_back(is_compressed ? d_slots + b * slot_size : inputs[b].data(), sizes[b]);
+    gather_out.emplace_back(d_encode + pos, sizes[b]);
+    pos += sizes[b];
+  }
+
+  std::memset(ticket.host.data(), 0, header_size);
+  std::memcpy(ticket.host.data(), sizes.data(), count * sizeof(uint32_t));
+  auto const d_gather_in  = cudf::detail::make_device_uvector_async(gather_in, stream, temp_mr);
+  auto const d_gather_out = cudf::detail::make_device_uvector_async(gather_out, stream, temp_mr);
+  cudf::io::gpu_copy_uncompressed_blocks(d_gather_in, d_gather_out, stream);
+  return pos;
+}
+
+/**
+ * @brief Host and device buffers of one of the alternating unpack pipeline slots
+ */
+struct unpack_ticket {
+  cudaEvent_t event;                               // Last use of the buffers of the slot
+  cudf::detail::pinned_host_vector<uint8_t> host;  // Host staging of the stored chunk
+  rmm::device_buffer staging;                      // Device copy of a compressed chunk
+};
+
+}  // namespace
+
+host_packed_table chunked_pack_to_host(cudf::table_view const& input,
+                                       std::size_t user_buffer_size,
+                                       packed_compression compression,
+                                       rmm::device_async_resource_ref temp_mr)
+{
+  CUDF_FUNC_RANGE();
+  auto const codec = to_nvcomp_codec(compression);
+  if (codec.has_value()) {
+    auto const disabled = nvcomp::is_compression_disabled(*codec);
+    CUDF_EXPECTS(not disabled.has_value(),
+                 "Packed chunk compression unavailable: " + disabled.value_or(""));
+  }
+
+  // chunked_pack packs on the default stream
+  auto const stream = cudf::get_default_stream();
+  auto packer       = chunked_pack::create(input, user_buffer_size, temp_mr);
+
+  host_packed_table out{packer->build_metadata(), compression, {}, {}};
+  if (out.metadata == nullptr) { out.metadata = std::make_unique<std::vector<uint8_t>>(); }
+
+  auto const max_blocks = num_blocks(user_buffer_size);
+  auto const slot_size =
+    codec.has_value()
+      ? cudf::util::round_up_safe(
+          nvcomp::compress_max_output_chunk_size(*codec, compression_block_size),
+          std::size_t{1} << nvcomp::compress_output_alignment_bits(*codec))
+      : 0;
+  std::array<pack_ticket, num_tickets> tickets;
+  for (auto& ticket : tickets) {
+    CUDF_CUDA_TRY(cudaEventCreate(&ticket.event));
+    ticket.chunk = rmm::device_buffer(user_buffer_size, stream, temp_mr);
+    ticket.host.resize(user_buffer_size);
+    if (codec.has_value()) {
+      ticket.compressed = rmm::device_buffer(max_blocks * slot_size, stream, temp_mr);
+      ticket.encoded    = rmm::device_buffer(user_buffer_size, stream, temp_mr);
+    }
+  }
+  // the copies to host run on a forked stream, after the allocations above
+  auto const copy_stream = cudf::detail::fork_streams(stream, 1).front();
+
+  // waits for the copy out of the ticket and moves the chunk bytes to the output
+  auto const finish = [&](pack_ticket& ticket) {
+    if (not ticket.pending.has_value()) { return; }
+    CUDF_CUDA_TRY(cudaEventSynchronize(ticket.event));
+    out.chunks[*ticket.pending].assign(ticket.host.begin(),
+                                       ticket.host.begin() + ticket.stored_size);
+    ticket.pending.reset();
+  };
+
+  while (packer->has_next()) {
+    auto& ticket = tickets[out.chunks.size() % num_tickets];
+    // the device and host buffers of the ticket are free once its last copy completed
+    finish(ticket);
+
+    auto const chunk_size = packer->next(
+      device_span<uint8_t>{static_cast<uint8_t*>(ticket.chunk.data()), ticket.chunk.size()});
+    auto const stored_size =
+      codec.has_value()
+        ? compress_chunk(ticket, chunk_size, *codec, slot_size, stream, temp_mr)
+        : std::nullopt;
+
+    // compressed chunks start with the block sizes already written to the host buffer
+    auto const header_size = stored_size.has_value() ? blocks_offset(chunk_size) : 0;
+    auto const* src        = stored_size.has_value()
+                               ? static_cast<uint8_t const*>(ticket.encoded.data()) + header_size
+                               : static_cast<uint8_t const*>(ticket.chunk.data());
+    ticket.stored_size     = stored_size.value_or(chunk_size);
+    ticket.pending         = out.chunks.size();
+    out.chunk_sizes.push_back(chunk_size);
+    out.chunks.emplace_back();
+
+    CUDF_CUDA_TRY(cudaEventRecord(ticket.event, stream.value()));
+    CUDF_CUDA_TRY(cudaStreamWaitEvent(copy_stream.value(), ticket.event, 0));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(ticket.host.data() + header_size,
+                                  src,
+                                  ticket.stored_size - header_size,
+                                  cudaMemcpyDefault,
+                                  copy_stream.value()));
+    CUDF_CUDA_TRY(cudaEventRecord(ticket.event, copy_stream.value()));
+  }
+
+  for (auto& ticket : tickets) {
+    finish(ticket);
+    CUDF_CUDA_TRY(cudaEventDestroy(ticket.event));
+  }
+  cudf::detail::join_streams(std::vector{copy_stream}, stream);
+  return out;
+}
+
+packed_columns chunked_unpack(host_packed_table const& input, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(input.chunks.size() == input.chunk_sizes.size(),
+               "Mismatch in the number of chunks and chunk sizes");
+  auto const codec = to_nvcomp_codec(input.compression);
+  if (codec.has_value()) {
+    auto const disabled = nvcomp::is_decompression_disabled(*codec);
+    CUDF_EXPECTS(not disabled.has_value(),
+                 "Packed chunk decompression unavailable: " + disabled.value_or(""));
+  }
+
+  auto const stream = cudf::get_default_stream();
+  auto const total_size =
+    std::accumulate(input.chunk_sizes.begin(), input.chunk_sizes.end(), std::size_t{0});
+  auto data = std::make_unique<rmm::device_buffer>(total_size, stream, mr);
+
+  std::size_t max_stored_size = 0;
+  for (auto const& chunk : input.chunks) {
+    max_stored_size = std::max(max_stored_size, chunk.size());
+  }
+  std::array<unpack_ticket, num_tickets> tickets;
+  for (auto& ticket : tickets) {
+    CUDF_CUDA_TRY(cudaEventCreate(&ticket.event));
+    ticket.host.resize(max_stored_size);
+    if (codec.has_value()) { ticket.staging = rmm::device_buffer(max_stored_size, stream); }
+  }
+  // the copies to the device run on a forked stream, after the allocations above
+  auto const copy_stream = cudf::detail::fork_streams(stream, 1).front();
+
+  // decompression results and expected sizes, checked once all chunks are decompressed
+  std::vector<rmm::device_uvector<cudf::io::compression_result>> results;
+  std::vector<std::vector<std::size_t>> expected_sizes;
+
+  std::size_t offset = 0;
+  for (std::size_t i = 0; i < input.chunks.size(); ++i) {
+    auto const& chunk     = input.chunks[i];
+    auto const chunk_size = input.chunk_sizes[i];
+    auto& ticket          = tickets[i % num_tickets];
+    auto* const d_dst     = static_cast<uint8_t*>(data->data()) + offset;
+    auto const compressed = chunk.size() != chunk_size;
+    CUDF_EXPECTS(not compressed or codec.has_value(), "Invalid packed chunk size");
+
+    // the staging buffers of the ticket are free once its last use completed
+    CUDF_CUDA_TRY(cudaEventSynchronize(ticket.event));
+    std::memcpy(ticket.host.data(), chunk.data(), chunk.size());
+    auto* const d_copy = compressed ? static_cast<uint8_t*>(ticket.staging.data()) : d_dst;
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      d_copy, ticket.host.data(), chunk.size(), cudaMemcpyDefault, copy_stream.value()));
+    CUDF_CUDA_TRY(cudaEventRecord(ticket.event, copy_stream.value()));
+
+    if (compressed) {
+      auto const count = num_blocks(chunk_size);
+      CUDF_EXPECTS(chunk.size() >= blocks_offset(chunk_size), "Invalid compressed packed chunk");
+      std::vector<uint32_t> sizes(count);
+      std::memcpy(sizes.data(), chunk.data(), count * sizeof(uint32_t));
+
+      std::vector<device_span<uint8_t const>> inputs;
+      std::vector<device_span<uint8_t>> outputs;
+      std::vector<device_span<uint8_t const>> raw_inputs;
+      std::vector<device_span<uint8_t>> raw_outputs;
+      auto& expected = expected_sizes.emplace_back();
+      auto pos       = blocks_offset(chunk_size);
+      for (std::size_t b = 0; b < count; ++b) {
+        auto const block_offset = b * compression_block_size;
+        auto const block_size   = std::min(compression_block_size, chunk_size - block_offset);
+        pos                     = cudf::util::round_up_safe(pos, compressed_block_alignment);
+        CUDF_EXPECTS(sizes[b] <= block_size && pos + sizes[b] <= chunk.size(),
+                     "Invalid compressed packed chunk");
+        device_span<uint8_t const> const in{d_copy + pos, sizes[b]};
+        device_span<uint8_t> const out{d_dst + block_offset, block_size};
+        if (sizes[b] == block_size) {
+          raw_inputs.push_back(in);
+          raw_outputs.push_back(out);
+        } else {
+          inputs.push_back(in);
+          outputs.push_back(out);
+          expected.push_back(block_size);
+        }
+        pos += sizes[b];
+      }
+
+      CUDF_CUDA_TRY(cudaStreamWaitEvent(stream.value(), ticket.event, 0));
+      auto& d_results = results.emplace_back(inputs.size(), stream);
+      if (not inputs.empty()) {
+        auto const d_inputs = cudf::detail::make_device_uvector_async(
+          inputs, stream, rmm::mr::get_current_device_resource());
+        auto const d_outputs = cudf::detail::make_device_uvector_async(
+          outputs, stream, rmm::mr::get_current_device_resource());
+        nvcomp::batched_decompress(*codec,
+                                   d_inputs,
+                                   d_outputs,
+                                   d_results,
+                                   compression_block_size,
+                                   chunk_size,
+                                   stream);
+      }
+      if (not raw_inputs.empty()) {
+        auto const d_raw_inputs = cudf::detail::make_device_uvector_async(
+          raw_inputs, stream, rmm::mr::get_current_device_resource());
+        auto const d_raw_outputs = cudf::detail::make_device_uvector_async(
+          raw_outputs, stream, rmm::mr::get_current_device_resource());
+        cudf::io::gpu_copy_uncompressed_blocks(d_raw_inputs, d_raw_outputs, stream);
+      }
+      CUDF_CUDA_TRY(cudaEventRecord(ticket.event, stream.value()));
+    }
+    offset += chunk_size;
+  }
+
+  cudf::detail::join_streams(std::vector{copy_stream}, stream);
+  for (std::size_t c = 0; c < results.size(); ++c) {
+    auto const h_results = cudf::detail::make_std_vector_sync(results[c], stream);
+    for (std::size_t b = 0; b < h_results.size(); ++b) {
+      CUDF_EXPECTS(h_results[b].status == cudf::io::compression_status::SUCCESS &&
+                     h_results[b].bytes_written == expected_sizes[c][b],
+                   "Error during packed chunk decompression");
+    }
+  }
+  stream.synchronize();
+  for (auto& ticket : tickets) {
+    CUDF_CUDA_TRY(cudaEventDestroy(ticket.event));
+  }
+
+  return packed_columns{std::make_unique<std::vector<uint8_t>>(*input.metadata), std::move(data)};
+}
+
+}  // namespace cudf
@@ -21,7 +21,9 @@
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/autotune.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/concatenate.hpp>
 #include <cudf/lists/detail/concatenate.hpp>
@@ -31,6 +33,7 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -47,8 +50,11 @@
 #include <thrust/transform_scan.h>
 
 #include <algorithm>
+#include <functional>
 #include <numeric>
+#include <string>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -287,6 +293,190 @@ std::unique_ptr<column> fused_concatenate(host_span<column_view const> views,
   return out_col;
 }
 
+/**
+ * @brief Copies an element of `width` bytes.
+ */
+__device__ void copy_element(
+  void* output, size_type output_index, void const* input, size_type input_index, int32_t width)
+{
+  switch (width) {
+    case 1:
+      static_cast<uint8_t*>(output)[output_index] =
+        static_cast<uint8_t const*>(input)[input_index];
+      break;
+    case 2:
+      static_cast<uint16_t*>(output)[output_index] =
+        static_cast<uint16_t const*>(input)[input_index];
+      break;
+    case 4:
+      static_cast<uint32_t*>(output)[output_index] =
+        static_cast<uint32_t const*>(input)[input_index];
+      break;
+    case 8:
+      static_cast<uint64_t*>(output)[output_index] =
+        static_cast<uint64_t const*>(input)[input_index];
+      break;
+    default:
+      static_cast<__int128_t*>(output)[output_index] =
+        static_cast<__int128_t const*>(input)[input_index];
+      break;
+  }
+}
+
+/**
+ * @brief Concatenates several fixed-width columns of the same tables.
+ *
+ * The y dimension of the grid strides over the columns. All the columns share the partition
+ * offsets, since all the columns of a table have the same number of rows.
+ *
+ * @param input_views Views of the input columns, for each column the view in each table
+ * @param element_widths Size in bytes of the elements of each column
+ * @param input_offsets Prefix sum of the number of rows of the tables
+ * @param num_input_tables Number of tables
+ * @param output_views Views of the output columns
+ * @param num_columns Number of columns
+ * @param out_valid_counts To hold the number of valid rows of each output column
+ */
+template <size_type block_size>
+CUDF_KERNEL void batched_fused_concatenate_kernel(
+  column_device_view const* input_views,
+  int32_t const* element_widths,
+  size_t const* input_offsets,
+  size_type num_input_tables,
+  mutable_column_device_view const* output_views,
+  size_type num_columns,
+  size_type* out_valid_counts)
+{
+  for (auto col_idx = static_cast<size_type>(blockIdx.y); col_idx < num_columns;
+       col_idx += gridDim.y) {
+    auto const& output_view = output_views[col_idx];
+    auto const* col_inputs  = input_views + static_cast<std::size_t>(col_idx) * num_input_tables;
+    auto const width        = element_widths[col_idx];
+    auto const nullable     = output_view.nullable();
+    auto const output_size  = output_view.size();
+
+    auto output_index          = cudf::detail::grid_1d::global_thread_id<block_size>();
+    auto const stride          = cudf::detail::grid_1d::grid_stride<block_size>();
+    size_type warp_valid_count = 0;
+
+    auto active_mask = __ballot_sync(0xFFFF'FFFFu, output_index < output_size);
+    while (output_index < output_size) {
+      auto const offset_it = thrust::prev(thrust::upper_bound(
+        thrust::seq, input_offsets, input_offsets + num_input_tables, output_index));
+      auto const& input_view  = col_inputs[offset_it - input_offsets];
+      auto const offset_index = static_cast<size_type>(output_index - *offset_it);
+      copy_element(output_view.head(),
+                   static_cast<size_type>(output_index),
+                   input_view.head<char>() + static_cast<std::size_t>(input_view.offset()) * width,
+                   offset_index,
+                   width);
+
+      if (nullable) {
+        bitmask_type const new_word =
+          __ballot_sync(active_mask, input_view.is_valid(offset_index));
+        if (threadIdx.x % detail::warp_size == 0) {
+          output_view.null_mask()[word_index(output_index)] = new_word;
+        }
+        warp_valid_count += __popc(new_word);
+      }
+
+      output_index += stride;
+      active_mask = __ballot_sync(active_mask, output_index < output_size);
+    }
+
+    if (nullable) {
+      using detail::single_lane_block_sum_reduce;
+      auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+      if (threadIdx.x == 0) { atomicAdd(out_valid_counts + col_idx, block_valid_count); }
+      // Keep the block-wide reduction storage from being reused by the next column too early
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Concatenates the given fixed-width columns of all the tables with a single kernel.
+ *
+ * The input views of all the columns are uploaded at once, and the null counts of all the
+ * output columns are computed by the kernel and copied back with a single transfer.
+ *
+ * @param tables Tables to concatenate
+ * @param column_indices Indices of the fixed-width columns to concatenate
+ * @param output_size Number of rows of the output columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The concatenated columns, in the order of `column_indices`
+ */
+std::vector<std::unique_ptr<column>> batched_fused_concatenate(
+  host_span<table_view const> tables,
+  host_span<size_type const> column_indices,
+  size_type output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  using mask_policy      = cudf::mask_allocation_policy;
+  auto const num_tables  = tables.size();
+  auto const num_columns = column_indices.size();
+
+  auto offsets = thrust::host_vector<size_t>(num_tables + 1, 0);
+  std::transform_inclusive_scan(
+    tables.begin(), tables.end(), std::next(offsets.begin()), std::plus{}, [](auto const& tbl) {
+      return static_cast<size_t>(tbl.num_rows());
+    });
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(num_columns);
+  auto input_views  = thrust::host_vector<column_device_view>();
+  auto output_views = thrust::host_vector<mutable_column_device_view>();
+  auto widths       = thrust::host_vector<int32_t>();
+  input_views.reserve(num_columns * num_tables);
+  output_views.reserve(num_columns);
+  widths.reserve(num_columns);
+  for (auto const col_idx : column_indices) {
+    auto const has_nulls = std::any_of(tables.begin(), tables.end(), [&](auto const& tbl) {
+      return tbl.column(col_idx).has_nulls();
+    });
+    auto const& first = tables.front().column(col_idx);
+    out_columns.push_back(detail::allocate_like(
+      first, output_size, has_nulls ? mask_policy::ALWAYS : mask_policy::NEVER, stream, mr));
+    // Fixed-width columns have no children, so their device views need no device storage
+    output_views.push_back(
+      *mutable_column_device_view::create(out_columns.back()->mutable_view(), stream));
+    widths.push_back(static_cast<int32_t>(cudf::size_of(first.type())));
+    for (auto const& tbl : tables) {
+      input_views.push_back(*column_device_view::create(tbl.column(col_idx), stream));
+    }
+  }
+
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+  auto d_input_views  = make_device_uvector_async(input_views, stream, temp_mr);
+  auto d_output_views = make_device_uvector_async(output_views, stream, temp_mr);
+  auto d_widths       = make_device_uvector_async(widths, stream, temp_mr);
+  auto d_offsets      = make_device_uvector_async(offsets, stream, temp_mr);
+  auto d_valid_counts = make_zeroed_device_uvector_async<size_type>(num_columns, stream, temp_mr);
+
+  constexpr size_type block_size{256};
+  constexpr size_type max_grid_columns{65535};
+  cudf::detail::grid_1d config(output_size, block_size);
+  dim3 const grid(config.num_blocks, std::min<size_type>(num_columns, max_grid_columns));
+  batched_fused_concatenate_kernel<block_size><<<grid, block_size, 0, stream.value()>>>(
+    d_input_views.data(),
+    d_widths.data(),
+    d_offsets.data(),
+    static_cast<size_type>(num_tables),
+    d_output_views.data(),
+    static_cast<size_type>(num_columns),
+    d_valid_counts.data());
+
+  auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    auto& col = out_columns[i];
+    // Set the null count of columns without nulls to prevent it from being materialized
+    col->set_null_count(col->nullable() ? output_size - valid_counts[i] : 0);
+  }
+  return out_columns;
+}
+
 template <typename T>
 std::unique_ptr<column> for_each_concatenate(host_span<column_view const> views,
                                              bool const has_nulls,
@@ -333,8 +523,29 @@ struct concatenate_dispatch {
     bool const has_nulls =
       std::any_of(views.begin(), views.end(), [](auto const& col) { return col.has_nulls(); });
 
-    // Use a heuristic to guess when the fused kernel will be faster
-    if (use_fused_kernel_heuristic(has_nulls, views.size())) {
+    // Use a heuristic to guess when the fused kernel will be faster, unless it is autotuned
+    auto use_fused = use_fused_kernel_heuristic(has_nulls, views.size());
+    if (is_autotuning_enabled()) {
+      auto const num_rows =
+        std::accumulate(views.begin(), views.end(), int64_t{0}, [](auto acc, auto const& v) {
+          return acc + v.size();
+        });
+      auto const key = "concatenate_fixed_width/" + std::to_string(sizeof(T)) + "/" +
+                       std::to_string(has_nulls) + "/" +
+                       std::to_string(autotune_bucket(views.size())) + "/" +
+                       std::to_string(autotune_bucket(num_rows));
+      // the outputs of the candidates are discarded
+      auto const temp_mr       = rmm::mr::get_current_device_resource();
+      auto const run_candidate = [&](std::size_t fused) {
+        if (fused == 1) {
+          fused_concatenate<T>(views, has_nulls, stream, temp_mr);
+        } else {
+          for_each_concatenate<T>(views, has_nulls, stream, temp_mr);
+        }
+      };
+      use_fused = autotuned_choice(key, 2, use_fused ? 1 : 0, run_candidate, stream) == 1;
+    }
+    if (use_fused) {
       return fused_concatenate<T>(views, has_nulls, stream, mr);
     } else {
       return for_each_concatenate<T>(views, has_nulls, stream, mr);
@@ -516,17 +727,56 @@ std::unique_ptr<table> concatenate(host_span<table_view const> tables_to_concat,
                            }),
                "Mismatch in table columns to concatenate.");
 
-  std::vector<std::unique_ptr<column>> concat_columns;
+  std::vector<std::vector<column_view>> table_columns(first_table.num_columns());
   for (size_type i = 0; i < first_table.num_columns(); ++i) {
-    std::vector<column_view> cols;
     std::transform(tables_to_concat.begin(),
                    tables_to_concat.end(),
-                   std::back_inserter(cols),
+                   std::back_inserter(table_columns[i]),
                    [i](auto const& t) { return t.column(i); });
 
     // verify all types match and that we won't overflow size_type in output size
-    bounds_and_type_check(cols, stream);
-    concat_columns.emplace_back(detail::concatenate(cols, stream, mr));
+    bounds_and_type_check(table_columns[i], stream);
+  }
+
+  // All the fixed-width columns are concatenated together, which saves most of the per-column
+  // host work and synchronizations when there are many small tables
+  auto const output_size = std::accumulate(
+    tables_to_concat.begin(), tables_to_concat.end(), size_type{0}, [](auto acc, auto const& t) {
+      return acc + t.num_rows();
+    });
+  std::vector<size_type> batched_indices;
+  for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (is_fixed_width(first_table.column(i).type())) { batched_indices.push_back(i); }
+  }
+  auto const is_batched = output_size > 0 and batched_indices.size() > 1;
+  std::vector<size_type> column_indices;
+  for (size_type i = 0; i < first_table.num_columns(); ++i) {
+    if (not is_batched or not is_fixed_width(first_table.column(i).type())) {
+      column_indices.push_back(i);
+    }
+  }
+
+  // The other columns are concatenated independently, each on its own stream, so that tables of
+  // many small columns run their kernels concurrently with each other and with the batched ones.
+  // Their memory is handed over to `stream` when the streams are joined.
+  auto const streams = column_indices.size() > 1
+                         ? cudf::detail::fork_streams(stream, column_indices.size())
+                         : std::vector<rmm::cuda_stream_view>(column_indices.size(), stream);
+
+  std::vector<std::unique_ptr<column>> concat_columns(first_table.num_columns());
+  if (is_batched) {
+    auto batched_columns =
+      batched_fused_concatenate(tables_to_concat, batched_indices, output_size, stream, mr);
+    for (std::size_t i = 0; i < batched_indices.size(); ++i) {
+      concat_columns[batched_indices[i]] = std::move(batched_columns[i]);
+    }
+  }
+  for (std::size_t i = 0; i < column_indices.size(); ++i) {
+    auto const index      = column_indices[i];
+    concat_columns[index] = detail::concatenate(table_columns[index], streams[i], mr);
+  }
+  if (column_indices.size() > 1) {
+    cudf::detail::join_streams(streams, stream, concat_columns);
   }
   return std::make_unique<table>(std::move(concat_columns));
 }
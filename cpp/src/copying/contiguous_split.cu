@@ -1773,7 +1773,7 @@ struct contiguous_split_state {
                          rmm::cuda_stream_view stream,
                          std::optional<rmm::device_async_resource_ref> mr,
                          rmm::device_async_resource_ref temp_mr)
-    : contiguous_split_state(input, {}, user_buffer_size, stream, mr, temp_mr)
+    : contiguous_split_state(input, {}, user_buffer_size, stream, mr, temp_mr, false)
   {
   }
 
@@ -1781,8 +1781,9 @@ struct contiguous_split_state {
                          std::vector<size_type> const& splits,
                          rmm::cuda_stream_view stream,
                          std::optional<rmm::device_async_resource_ref> mr,
-                         rmm::device_async_resource_ref temp_mr)
-    : contiguous_split_state(input, splits, 0, stream, mr, temp_mr)
+                         rmm::device_async_resource_ref temp_mr,
+                         bool single_allocation = false)
+    : contiguous_split_state(input, splits, 0, stream, mr, temp_mr, single_allocation)
   {
   }
 
@@ -1796,55 +1797,39 @@ struct contiguous_split_state {
   std::vector<packed_table> contiguous_split()
   {
     CUDF_EXPECTS(user_buffer_size == 0, "Cannot contiguous split with a user buffer");
+    CUDF_EXPECTS(not single_allocation, "Use contiguous_split_batched for a single allocation");
     if (is_empty || input.num_columns() == 0) { return make_packed_tables(); }
 
-    auto const num_batches_total =
-      std::get<1>(chunk_iter_state->get_current_starting_index_and_buff_count());
-
-    // perform the copy.
-    copy_data(num_batches_total,
-              0 /* starting at buffer for single-shot 0*/,
-              src_and_dst_pointers->d_src_bufs,
-              src_and_dst_pointers->d_dst_bufs,
-              chunk_iter_state->d_batched_dst_buf_info,
-              nullptr,
-              stream);
-
-    // these "orig" dst_buf_info pointers describe the prior-to-batching destination
-    // buffers per partition
-    auto d_orig_dst_buf_info = partition_buf_size_and_dst_buf_info->d_dst_buf_info;
-    auto h_orig_dst_buf_info = partition_buf_size_and_dst_buf_info->h_dst_buf_info;
-
-    // postprocess valid_counts: apply the valid counts computed by copy_data for each
-    // batch back to the original dst_buf_infos
-    auto const keys = cudf::detail::make_counting_transform_iterator(
-      0, out_to_in_index_function{chunk_iter_state->d_batch_offsets.begin(), (int)num_bufs});
-
-    auto values = thrust::make_transform_iterator(
-      chunk_iter_state->d_batched_dst_buf_info.begin(),
-      cuda::proclaim_return_type<size_type>(
-        [] __device__(dst_buf_info const& info) { return info.valid_count; }));
-
-    thrust::reduce_by_key(rmm::exec_policy(stream, temp_mr),
-                          keys,
-                          keys + num_batches_total,
-                          values,
-                          thrust::make_discard_iterator(),
-                          dst_valid_count_output_iterator{d_orig_dst_buf_info});
+    perform_copy();
 
-    CUDF_CUDA_TRY(cudaMemcpyAsync(h_orig_dst_buf_info,
-                                  d_orig_dst_buf_info,
-                                  partition_buf_size_and_dst_buf_info->dst_buf_info_size,
-                                  cudaMemcpyDefault,
-                                  stream.value()));
+    return make_packed_tables();
+  }
 
-    stream.synchronize();
+  packed_partitions contiguous_split_batched()
+  {
+    CUDF_EXPECTS(single_allocation, "contiguous_split_batched requires a single allocation");
+    if (input.num_columns() == 0) { return packed_partitions{}; }
+    if (is_empty) { return make_empty_packed_partitions(); }
 
-    // not necessary for the non-chunked case, but it makes it so further calls to has_next
-    // return false, just in case
-    chunk_iter_state->advance_iteration();
+    perform_copy();
 
-    return make_packed_tables();
+    // only the metadata is needed, so skip building the column_views of every partition
+    packed_partitions result;
+    result.metadata_offsets.reserve(num_partitions + 1);
+    result.metadata_offsets.push_back(0);
+    auto cur_dst_buf_info = partition_buf_size_and_dst_buf_info->h_dst_buf_info;
+    detail::metadata_builder mb(input.num_columns());
+    for (std::size_t idx = 0; idx < num_partitions; idx++) {
+      cur_dst_buf_info = populate_metadata(input.begin(), input.end(), cur_dst_buf_info, mb, false);
+      auto const partition_metadata = mb.build();
+      result.metadata->insert(
+        result.metadata->end(), partition_metadata.begin(), partition_metadata.end());
+      result.metadata_offsets.push_back(result.metadata->size());
+      mb.clear();
+    }
+    result.gpu_data     = std::make_unique<rmm::device_buffer>(std::move(out_buffers.front()));
+    result.data_offsets = std::move(partition_offsets);
+    return result;
   }
 
   cudf::size_type contiguous_split_chunk(cudf::device_span<uint8_t> const& user_buffer)
@@ -1900,9 +1885,11 @@ struct contiguous_split_state {
                          std::size_t user_buffer_size,
                          rmm::cuda_stream_view stream,
                          std::optional<rmm::device_async_resource_ref> mr,
-                         rmm::device_async_resource_ref temp_mr)
+                         rmm::device_async_resource_ref temp_mr,
+                         bool single_allocation)
     : input(input),
       user_buffer_size(user_buffer_size),
+      single_allocation(single_allocation),
       stream(stream),
       mr(mr),
       temp_mr(temp_mr),
@@ -1932,20 +1919,94 @@ struct contiguous_split_state {
                                        temp_mr);
 
     // allocate output partition buffers, in the non-chunked case
+    std::vector<uint8_t*> dst_bufs;
     if (user_buffer_size == 0) {
-      out_buffers.reserve(num_partitions);
       auto h_buf_sizes = partition_buf_size_and_dst_buf_info->h_buf_sizes;
-      std::transform(h_buf_sizes,
-                     h_buf_sizes + num_partitions,
-                     std::back_inserter(out_buffers),
-                     [stream = stream,
-                      mr = mr.value_or(rmm::mr::get_current_device_resource())](std::size_t bytes) {
-                       return rmm::device_buffer{bytes, stream, mr};
-                     });
+      auto const out_mr = mr.value_or(rmm::mr::get_current_device_resource());
+      dst_bufs.reserve(num_partitions);
+      if (single_allocation) {
+        // every partition size is a multiple of split_align, so packing the partitions
+        // back to back keeps each of them aligned within the one allocation
+        partition_offsets.resize(num_partitions + 1);
+        partition_offsets[0] = 0;
+        std::inclusive_scan(
+          h_buf_sizes, h_buf_sizes + num_partitions, partition_offsets.begin() + 1);
+        out_buffers.emplace_back(partition_offsets.back(), stream, out_mr);
+        auto const base = static_cast<uint8_t*>(out_buffers.front().data());
+        std::transform(partition_offsets.begin(),
+                       partition_offsets.end() - 1,
+                       std::back_inserter(dst_bufs),
+                       [base](std::size_t offset) { return base + offset; });
+      } else {
+        out_buffers.reserve(num_partitions);
+        std::transform(h_buf_sizes,
+                       h_buf_sizes + num_partitions,
+                       std::back_inserter(out_buffers),
+                       [stream = stream, out_mr](std::size_t bytes) {
+                         return rmm::device_buffer{bytes, stream, out_mr};
+                       });
+        std::transform(out_buffers.begin(),
+                       out_buffers.end(),
+                       std::back_inserter(dst_bufs),
+                       [](auto& buf) { return static_cast<uint8_t*>(buf.data()); });
+      }
     }
 
     src_and_dst_pointers = std::move(setup_src_and_dst_pointers(
-      input, num_partitions, num_src_bufs, out_buffers, stream, temp_mr));
+      input, num_partitions, num_src_bufs, dst_bufs, stream, temp_mr));
+  }
+
+  /**
+   * @brief Copies every partition to its destination with a single batched kernel
+   * and applies the resulting valid counts to the per-partition buffer info.
+   */
+  void perform_copy()
+  {
+    auto const num_batches_total =
+      std::get<1>(chunk_iter_state->get_current_starting_index_and_buff_count());
+
+    // perform the copy.
+    copy_data(num_batches_total,
+              0 /* starting at buffer for single-shot 0*/,
+              src_and_dst_pointers->d_src_bufs,
+              src_and_dst_pointers->d_dst_bufs,
+              chunk_iter_state->d_batched_dst_buf_info,
+              nullptr,
+              stream);
+
+    // these "orig" dst_buf_info pointers describe the prior-to-batching destination
+    // buffers per partition
+    auto d_orig_dst_buf_info = partition_buf_size_and_dst_buf_info->d_dst_buf_info;
+    auto h_orig_dst_buf_info = partition_buf_size_and_dst_buf_info->h_dst_buf_info;
+
+    // postprocess valid_counts: apply the valid counts computed by copy_data for each
+    // batch back to the original dst_buf_infos
+    auto const keys = cudf::detail::make_counting_transform_iterator(
+      0, out_to_in_index_function{chunk_iter_state->d_batch_offsets.begin(), (int)num_bufs});
+
+    auto values = thrust::make_transform_iterator(
+      chunk_iter_state->d_batched_dst_buf_info.begin(),
+      cuda::proclaim_return_type<size_type>(
+        [] __device__(dst_buf_info const& info) { return info.valid_count; }));
+
+    thrust::reduce_by_key(rmm::exec_policy(stream, temp_mr),
+                          keys,
+                          keys + num_batches_total,
+                          values,
+                          thrust::make_discard_iterator(),
+                          dst_valid_count_output_iterator{d_orig_dst_buf_info});
+
+    CUDF_CUDA_TRY(cudaMemcpyAsync(h_orig_dst_buf_info,
+                                  d_orig_dst_buf_info,
+                                  partition_buf_size_and_dst_buf_info->dst_buf_info_size,
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+
+    stream.synchronize();
+
+    // not necessary for the non-chunked case, but it makes it so further calls to has_next
+    // return false, just in case
+    chunk_iter_state->advance_iteration();
   }
 
   std::vector<packed_table> make_packed_tables()
@@ -2014,8 +2075,25 @@ struct contiguous_split_state {
     return result;
   }
 
+  packed_partitions make_empty_packed_partitions()
+  {
+    auto empty_tables = make_empty_packed_table();
+
+    packed_partitions result;
+    result.metadata_offsets.reserve(num_partitions + 1);
+    result.metadata_offsets.push_back(0);
+    for (auto const& table : empty_tables) {
+      result.metadata->insert(
+        result.metadata->end(), table.data.metadata->begin(), table.data.metadata->end());
+      result.metadata_offsets.push_back(result.metadata->size());
+    }
+    result.data_offsets.assign(num_partitions + 1, 0);
+    return result;
+  }
+
   cudf::table_view const input;        ///< The input table_view to operate on
   std::size_t const user_buffer_size;  ///< The size of the user buffer for the chunked_pack case
+  bool const single_allocation;        ///< True if all partitions share one output allocation
   rmm::cuda_stream_view const stream;
   std::optional<rmm::device_async_resource_ref const> mr;  ///< The resource for any data returned
 
@@ -2048,7 +2126,7 @@ struct contiguous_split_state {
   std::unique_ptr<chunk_iteration_state>
     chunk_iter_state;  ///< State object for chunk iteration state
 
-  // Two API usages are allowed:
+  // Three API usages are allowed:
   //  - `chunked_pack`: for this mode, the user will provide a buffer that must be at least 1MB.
   //    The behavior is "chunked" in that it will contiguously copy up until the user specified
   //    `user_buffer_size` limit, exposing a next() call for the user to invoke. Note that in this
@@ -2058,8 +2136,14 @@ struct contiguous_split_state {
   //    `contiguous_split` will allocate a buffer per partition and will place contiguous results in
   //    each buffer.
   //
+  //  - `contiguous_split_batched`: like `contiguous_split`, but a single buffer is allocated for
+  //    all partitions, which are placed back to back at `partition_offsets`.
+  //
   std::vector<rmm::device_buffer>
     out_buffers;  ///< Buffers allocated for a regular `contiguous_split`
+
+  std::vector<std::size_t>
+    partition_offsets;  ///< Offset of each partition in the single allocation, plus the total size
 };
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
@@ -2074,6 +2158,15 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return state.contiguous_split();
 }
 
+packed_partitions contiguous_split_batched(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto state = contiguous_split_state(input, splits, stream, mr, mr, true);
+  return state.contiguous_split_batched();
+}
+
 };  // namespace detail
 
 std::vector<packed_table> contiguous_split(cudf::table_view const& input,
@@ -2084,6 +2177,14 @@ std::vector<packed_table> contiguous_split(cudf::table_view const& input,
   return detail::contiguous_split(input, splits, cudf::get_default_stream(), mr);
 }
 
+packed_partitions contiguous_split_batched(cudf::table_view const& input,
+                                           std::vector<size_type> const& splits,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contiguous_split_batched(input, splits, cudf::get_default_stream(), mr);
+}
+
 chunked_pack::chunked_pack(cudf::table_view const& input,
                            std::size_t user_buffer_size,
                            rmm::device_async_resource_ref temp_mr)
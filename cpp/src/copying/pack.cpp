@@ -22,6 +22,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <stdexcept>
+
 namespace cudf {
 namespace detail {
 
@@ -302,4 +304,21 @@ table_view unpack(uint8_t const* metadata, uint8_t const* gpu_data)
   return detail::unpack(metadata, gpu_data);
 }
 
+/**
+ * @copydoc cudf::unpack(packed_partitions const&, std::size_t)
+ */
+table_view unpack(packed_partitions const& input, std::size_t partition)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(partition + 1 < input.data_offsets.size(),
+               "Partition index out of bounds",
+               std::out_of_range);
+  auto const metadata_offset = input.metadata_offsets[partition];
+  return input.metadata_offsets[partition + 1] == metadata_offset
+           ? table_view{}
+           : detail::unpack(
+               input.metadata->data() + metadata_offset,
+               static_cast<uint8_t const*>(input.gpu_data->data()) + input.data_offsets[partition]);
+}
+
 }  // namespace cudf
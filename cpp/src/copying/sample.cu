@@ -16,6 +16,8 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -25,13 +27,23 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/copy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/random.h>
 #include <thrust/random/uniform_int_distribution.h>
+#include <thrust/random/uniform_real_distribution.h>
+#include <thrust/sequence.h>
 #include <thrust/shuffle.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <vector>
 
 namespace cudf {
 namespace detail {
@@ -86,6 +98,126 @@ std::unique_ptr<table> sample(table_view const& input,
   }
 }
 
+namespace {
+
+/**
+ * @brief Draws the uniform random number in `[0, 1)` of a row.
+ *
+ * The number only depends on the seed and the index of the row, so that rows can be sampled
+ * independently of each other without materializing a random permutation.
+ */
+struct uniform_row_key {
+  int64_t seed;
+
+  __device__ double operator()(size_type i) const
+  {
+    thrust::default_random_engine rng(seed);
+    thrust::uniform_real_distribution<double> dist{0.0, 1.0};
+    rng.discard(i);
+    return dist(rng);
+  }
+};
+
+/**
+ * @brief Keeps the `n` rows of `input` with the smallest `keys`, along with their keys.
+ */
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> smallest_keys(
+  table_view const& input,
+  column_view const& keys,
+  size_type n,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.num_rows();
+  n                   = std::min(n, num_rows);
+
+  rmm::device_uvector<double> sorted_keys(num_rows, stream);
+  thrust::copy(
+    rmm::exec_policy_nosync(stream), keys.begin<double>(), keys.end<double>(), sorted_keys.begin());
+  rmm::device_uvector<size_type> indices(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), indices.begin(), indices.end());
+  thrust::sort_by_key(
+    rmm::exec_policy_nosync(stream), sorted_keys.begin(), sorted_keys.end(), indices.begin());
+
+  auto sample = detail::gather(
+    input, indices.begin(), indices.begin() + n, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  auto sample_keys =
+    make_numeric_column(data_type{type_id::FLOAT64}, n, mask_state::UNALLOCATED, stream, mr);
+  thrust::copy(rmm::exec_policy_nosync(stream),
+               sorted_keys.begin(),
+               sorted_keys.begin() + n,
+               sample_keys->mutable_view().begin<double>());
+  return {std::move(sample), std::move(sample_keys)};
+}
+
+}  // namespace
+
+std::unique_ptr<table> sample_fraction(table_view const& input,
+                                       double fraction,
+                                       int64_t seed,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(fraction >= 0.0 and fraction <= 1.0,
+               "The fraction of rows to sample must be in [0, 1].",
+               std::invalid_argument);
+
+  auto const key = uniform_row_key{seed};
+  return detail::copy_if(
+    input,
+    [key, fraction] __device__(size_type i) { return key(i) < fraction; },
+    stream,
+    mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> reservoir_sample(
+  table_view const& input,
+  size_type n,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(n >= 0, "expected number of samples should be non-negative", std::invalid_argument);
+
+  // the keys of all the rows are only returned if all the rows are sampled
+  auto const num_rows = input.num_rows();
+  auto const keys_mr  = n >= num_rows ? mr : rmm::mr::get_current_device_resource();
+  auto keys           = make_numeric_column(
+    data_type{type_id::FLOAT64}, num_rows, mask_state::UNALLOCATED, stream, keys_mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_rows),
+                    keys->mutable_view().begin<double>(),
+                    uniform_row_key{seed});
+  if (n >= num_rows) { return {std::make_unique<table>(input, stream, mr), std::move(keys)}; }
+
+  return smallest_keys(input, keys->view(), n, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> merge_reservoir_samples(
+  host_span<table_view const> samples,
+  host_span<column_view const> keys,
+  size_type n,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(n >= 0, "expected number of samples should be non-negative", std::invalid_argument);
+  CUDF_EXPECTS(not samples.empty(), "At least one sample is required.", std::invalid_argument);
+  CUDF_EXPECTS(samples.size() == keys.size(),
+               "Each sample must have its keys.",
+               std::invalid_argument);
+  CUDF_EXPECTS(std::all_of(keys.begin(),
+                           keys.end(),
+                           [](auto const& k) { return k.type().id() == type_id::FLOAT64; }),
+               "The keys of the samples must be FLOAT64 columns.",
+               cudf::data_type_error);
+
+  auto const temp_mr     = rmm::mr::get_current_device_resource();
+  auto const all_samples = detail::concatenate(samples, stream, temp_mr);
+  auto const all_keys    = detail::concatenate(keys, stream, temp_mr);
+  return smallest_keys(all_samples->view(), all_keys->view(), n, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> sample(table_view const& input,
@@ -98,4 +230,36 @@ std::unique_ptr<table> sample(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::sample(input, n, replacement, seed, stream, mr);
 }
+
+std::unique_ptr<table> sample_fraction(table_view const& input,
+                                       double fraction,
+                                       int64_t seed,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sample_fraction(input, fraction, seed, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> reservoir_sample(
+  table_view const& input,
+  size_type n,
+  int64_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reservoir_sample(input, n, seed, stream, mr);
+}
+
+std::pair<std::unique_ptr<table>, std::unique_ptr<column>> merge_reservoir_samples(
+  host_span<table_view const> samples,
+  host_span<column_view const> keys,
+  size_type n,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::merge_reservoir_samples(samples, keys, n, stream, mr);
+}
 }  // namespace cudf
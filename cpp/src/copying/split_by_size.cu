@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/scan.h>
+
+#include <algorithm>
+#include <stdexcept>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+struct bits_to_int64 {
+  __device__ int64_t operator()(size_type bits) const { return bits; }
+};
+
+}  // namespace
+
+std::vector<size_type> split_points_by_size(table_view const& input,
+                                            std::size_t max_bytes,
+                                            rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(
+    max_bytes > 0, "The size limit of the splits must be positive.", std::invalid_argument);
+
+  auto const num_rows = input.num_rows();
+  if (input.num_columns() == 0 or num_rows == 0) { return {}; }
+
+  // cumulative_bits[i] is the size of the rows [0, i]
+  auto const row_bits =
+    detail::row_bit_count(input, stream, rmm::mr::get_current_device_resource());
+  rmm::device_uvector<int64_t> cumulative_bits(num_rows, stream);
+  thrust::transform_inclusive_scan(rmm::exec_policy_nosync(stream),
+                                   row_bits->view().begin<size_type>(),
+                                   row_bits->view().end<size_type>(),
+                                   cumulative_bits.begin(),
+                                   bits_to_int64{},
+                                   thrust::plus<int64_t>{});
+
+  auto const total_bits = cumulative_bits.back_element(stream);
+  if (util::div_rounding_up_safe<int64_t>(total_bits, 8) <= static_cast<int64_t>(max_bytes)) {
+    return {};
+  }
+
+  // Greedily end each split after the last row that keeps it within the limit. This searches once
+  // per split, which is cheap since the number of splits is small compared to the number of rows.
+  auto const max_bits = static_cast<int64_t>(max_bytes) * 8;
+  std::vector<size_type> splits;
+  size_type begin{0};
+  int64_t bits_before{0};
+  while (true) {
+    auto const it = thrust::upper_bound(rmm::exec_policy(stream),
+                                        cumulative_bits.begin() + begin,
+                                        cumulative_bits.end(),
+                                        bits_before + max_bits);
+    // a row larger than the limit is a split on its own
+    auto const end =
+      std::max(static_cast<size_type>(thrust::distance(cumulative_bits.begin(), it)), begin + 1);
+    if (end >= num_rows) { break; }
+    splits.push_back(end);
+    begin       = end;
+    bits_before = cumulative_bits.element(end - 1, stream);
+  }
+  return splits;
+}
+
+std::vector<table_view> split_by_size(table_view const& input,
+                                      std::size_t max_bytes,
+                                      rmm::cuda_stream_view stream)
+{
+  auto const splits = split_points_by_size(input, max_bytes, stream);
+  return detail::split(input, splits, stream);
+}
+
+std::vector<packed_table> contiguous_split_by_size(table_view const& input,
+                                                   std::size_t max_bytes,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto const splits = split_points_by_size(input, max_bytes, stream);
+  return detail::contiguous_split(input, splits, stream, mr);
+}
+
+}  // namespace detail
+
+std::vector<table_view> split_by_size(table_view const& input,
+                                      std::size_t max_bytes,
+                                      rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_by_size(input, max_bytes, stream);
+}
+
+std::vector<packed_table> contiguous_split_by_size(table_view const& input,
+                                                   std::size_t max_bytes,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contiguous_split_by_size(input, max_bytes, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
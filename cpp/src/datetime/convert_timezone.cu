@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/timezone.cuh>
+#include <cudf/detail/timezone.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/timezone.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/std/chrono>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+constexpr size_type block_size = 256;
+// Each block stages the transition tables once, so give every thread several timestamps
+constexpr size_type timestamps_per_thread = 16;
+// Largest dynamic shared memory allocation that does not need an opt-in
+constexpr std::size_t max_shared_memory_bytes = 48 * 1024;
+
+/**
+ * @brief Transition times and offsets of a timezone; empty for UTC
+ */
+struct tz_transitions {
+  device_span<timestamp_s const> times;
+  device_span<duration_s const> offsets;
+
+  [[nodiscard]] std::size_t shared_memory_bytes() const
+  {
+    return times.size() * (sizeof(timestamp_s) + sizeof(duration_s));
+  }
+
+  [[nodiscard]] __device__ duration_s ut_offset(timestamp_s ts) const
+  {
+    return get_ut_offset(times, offsets, ts);
+  }
+};
+
+tz_transitions make_transitions(table_view const& tz_table)
+{
+  if (tz_table.num_columns() == 0) { return {}; }
+  return {tz_table.column(0), tz_table.column(1)};
+}
+
+/**
+ * @brief Copies the transitions of a timezone into shared memory with all threads of the block.
+ *
+ * @return The transitions backed by `buffer`
+ */
+__device__ tz_transitions stage_transitions(tz_transitions const& tz, char* buffer)
+{
+  auto const size = tz.times.size();
+  auto times      = reinterpret_cast<timestamp_s*>(buffer);
+  auto offsets    = reinterpret_cast<duration_s*>(times + size);
+  for (auto idx = static_cast<std::size_t>(threadIdx.x); idx < size; idx += blockDim.x) {
+    times[idx]   = tz.times[idx];
+    offsets[idx] = tz.offsets[idx];
+  }
+  return {{times, size}, {offsets, size}};
+}
+
+/**
+ * @brief Converts each timestamp from the local time of `from` to the local time of `to`.
+ *
+ * The local time is first converted to UTC by guessing the offset at the local time itself and
+ * then refining it at the resulting UTC time, which is exact except around a transition.
+ */
+template <typename Timestamp>
+CUDF_KERNEL void convert_timezone_kernel(Timestamp const* input,
+                                         Timestamp* output,
+                                         size_type size,
+                                         tz_transitions from,
+                                         tz_transitions to,
+                                         bool use_shared_memory)
+{
+  extern __shared__ __align__(alignof(timestamp_s)) char shared_transitions[];
+  if (use_shared_memory) {
+    auto const from_bytes = from.shared_memory_bytes();
+    from                  = stage_transitions(from, shared_transitions);
+    to                    = stage_transitions(to, shared_transitions + from_bytes);
+    __syncthreads();
+  }
+
+  using duration = typename Timestamp::duration;
+
+  auto const stride = grid_1d::grid_stride();
+  for (auto idx = grid_1d::global_thread_id(); idx < size; idx += stride) {
+    auto const ts          = input[idx];
+    auto const local       = cuda::std::chrono::time_point_cast<duration_s>(ts);
+    auto const from_offset = from.ut_offset(local - from.ut_offset(local));
+    auto const to_offset   = to.ut_offset(local - from_offset);
+    output[idx] = ts + cuda::std::chrono::duration_cast<duration>(to_offset - from_offset);
+  }
+}
+
+struct convert_timezone_fn {
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_timestamp<T>())>
+  std::unique_ptr<column> operator()(column_view const&,
+                                     tz_transitions const&,
+                                     tz_transitions const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref) const
+  {
+    CUDF_FAIL("Cannot convert the timezone of a non-timestamp column");
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_timestamp<T>())>
+  std::unique_ptr<column> operator()(column_view const& input,
+                                     tz_transitions const& from,
+                                     tz_transitions const& to,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto output = make_timestamp_column(input.type(),
+                                        input.size(),
+                                        detail::copy_bitmask(input, stream, mr),
+                                        input.null_count(),
+                                        stream,
+                                        mr);
+    if (input.is_empty()) { return output; }
+
+    auto const shared_bytes = from.shared_memory_bytes() + to.shared_memory_bytes();
+    auto const use_shared   = shared_bytes <= max_shared_memory_bytes;
+    auto const shared_size  = use_shared ? shared_bytes : 0;
+    grid_1d const grid{input.size(), block_size, use_shared ? timestamps_per_thread : 1};
+    convert_timezone_kernel<T>
+      <<<grid.num_blocks, grid.num_threads_per_block, shared_size, stream.value()>>>(
+        input.begin<T>(), output->mutable_view().begin<T>(), input.size(), from, to, use_shared);
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(cudf::is_timestamp(timestamps.type()), "Input must be a timestamp column");
+
+  auto const from_table = make_timezone_transition_table(
+    tzif_dir, from_timezone, stream, rmm::mr::get_current_device_resource());
+  auto const to_table = make_timezone_transition_table(
+    tzif_dir, to_timezone, stream, rmm::mr::get_current_device_resource());
+
+  return type_dispatcher(timestamps.type(),
+                         convert_timezone_fn{},
+                         timestamps,
+                         make_transitions(from_table->view()),
+                         make_transitions(to_table->view()),
+                         stream,
+                         mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> convert_timezone(column_view const& timestamps,
+                                         std::string_view from_timezone,
+                                         std::string_view to_timezone,
+                                         std::optional<std::string_view> tzif_dir,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_timezone(timestamps, from_timezone, to_timezone, tzif_dir, stream, mr);
+}
+
+}  // namespace cudf
@@ -25,6 +25,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/scalar/scalar.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -37,27 +38,18 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <stdexcept>
+#include <vector>
+
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/transform.h>
 
 namespace cudf {
 namespace datetime {
 namespace detail {
-enum class datetime_component {
-  INVALID = 0,
-  YEAR,
-  MONTH,
-  DAY,
-  WEEKDAY,
-  HOUR,
-  MINUTE,
-  SECOND,
-  MILLISECOND,
-  MICROSECOND,
-  NANOSECOND
-};
-
 enum class rounding_function {
   CEIL,   ///< Rounds up to the next integer multiple of the provided frequency
   FLOOR,  ///< Rounds down to the next integer multiple of the provided frequency
@@ -114,6 +106,84 @@ struct extract_component_operator {
   }
 };
 
+constexpr int num_datetime_components = static_cast<int>(datetime_component::NANOSECOND) + 1;
+
+// Output pointer of each component; null for components that were not requested
+struct component_outputs {
+  int16_t* data[num_datetime_components] = {};
+
+  __device__ inline bool requested(datetime_component component) const
+  {
+    return data[static_cast<int>(component)] != nullptr;
+  }
+};
+
+// Writes every requested component of a timestamp, sharing the calendar conversion between them
+template <typename Timestamp>
+struct extract_components_fn {
+  Timestamp const* input;
+  component_outputs outputs;
+
+  __device__ inline void store(size_type idx, datetime_component component, int16_t value) const
+  {
+    if (outputs.requested(component)) { outputs.data[static_cast<int>(component)][idx] = value; }
+  }
+
+  __device__ void operator()(size_type idx) const
+  {
+    using namespace cuda::std::chrono;
+
+    auto const ts               = input[idx];
+    auto const days_since_epoch = floor<days>(ts);
+
+    if (outputs.requested(datetime_component::YEAR) ||
+        outputs.requested(datetime_component::MONTH) ||
+        outputs.requested(datetime_component::DAY)) {
+      auto const ymd = year_month_day(days_since_epoch);
+      store(idx, datetime_component::YEAR, static_cast<int>(ymd.year()));
+      store(idx, datetime_component::MONTH, static_cast<unsigned>(ymd.month()));
+      store(idx, datetime_component::DAY, static_cast<unsigned>(ymd.day()));
+    }
+    if (outputs.requested(datetime_component::WEEKDAY)) {
+      store(idx, datetime_component::WEEKDAY, weekday(days_since_epoch).iso_encoding());
+    }
+
+    auto time_since_midnight = ts - days_since_epoch;
+    if (time_since_midnight.count() < 0) { time_since_midnight += days(1); }
+
+    // Peel off each unit in turn so every component is the remainder of the coarser ones
+    auto const hrs        = duration_cast<hours>(time_since_midnight);
+    auto const mins       = duration_cast<minutes>(time_since_midnight - hrs);
+    auto const secs       = duration_cast<seconds>(time_since_midnight - hrs - mins);
+    auto const sub_second = duration_cast<nanoseconds>(time_since_midnight - hrs - mins - secs);
+    store(idx, datetime_component::HOUR, hrs.count());
+    store(idx, datetime_component::MINUTE, mins.count());
+    store(idx, datetime_component::SECOND, secs.count());
+    store(idx, datetime_component::MILLISECOND, sub_second.count() / 1'000'000);
+    store(idx, datetime_component::MICROSECOND, (sub_second.count() / 1'000) % 1'000);
+    store(idx, datetime_component::NANOSECOND, sub_second.count() % 1'000);
+  }
+};
+
+struct extract_components_dispatch {
+  template <typename Timestamp, CUDF_ENABLE_IF(not cudf::is_timestamp<Timestamp>())>
+  void operator()(column_view const&, component_outputs const&, rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Cannot extract datetime component from non-timestamp column.");
+  }
+
+  template <typename Timestamp, CUDF_ENABLE_IF(cudf::is_timestamp<Timestamp>())>
+  void operator()(column_view const& input,
+                  component_outputs const& outputs,
+                  rmm::cuda_stream_view stream) const
+  {
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::make_counting_iterator<size_type>(0),
+                       input.size(),
+                       extract_components_fn<Timestamp>{input.begin<Timestamp>(), outputs});
+  }
+};
+
 // This functor takes the rounding type as runtime info and dispatches to the ceil/floor/round
 // function.
 template <typename DurationType>
@@ -449,12 +519,42 @@ std::unique_ptr<column> round_general(rounding_function round_kind,
     column.type(), dispatch_round{}, round_kind, component, column, stream, mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(is_timestamp(column.type()), "Column type should be timestamp");
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  component_outputs outputs;
+  for (auto const component : components) {
+    auto& output = outputs.data[static_cast<int>(component)];
+    CUDF_EXPECTS(output == nullptr,
+                 "Each datetime component can only be extracted once",
+                 std::invalid_argument);
+    columns.push_back(make_fixed_width_column(data_type{type_id::INT16},
+                                              column.size(),
+                                              cudf::detail::copy_bitmask(column, stream, mr),
+                                              column.null_count(),
+                                              stream,
+                                              mr));
+    output = columns.back()->mutable_view().data<int16_t>();
+  }
+
+  if (!column.is_empty() && !columns.empty()) {
+    type_dispatcher(column.type(), extract_components_dispatch{}, column, outputs, stream);
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
 std::unique_ptr<column> extract_year(column_view const& column,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::YEAR>,
+    detail::extract_component_operator<datetime_component::YEAR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -463,7 +563,7 @@ std::unique_ptr<column> extract_month(column_view const& column,
                                       rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MONTH>,
+    detail::extract_component_operator<datetime_component::MONTH>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -472,7 +572,7 @@ std::unique_ptr<column> extract_day(column_view const& column,
                                     rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::DAY>,
+    detail::extract_component_operator<datetime_component::DAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -481,7 +581,7 @@ std::unique_ptr<column> extract_weekday(column_view const& column,
                                         rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::WEEKDAY>,
+    detail::extract_component_operator<datetime_component::WEEKDAY>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -490,7 +590,7 @@ std::unique_ptr<column> extract_hour(column_view const& column,
                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::HOUR>,
+    detail::extract_component_operator<datetime_component::HOUR>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -499,7 +599,7 @@ std::unique_ptr<column> extract_minute(column_view const& column,
                                        rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MINUTE>,
+    detail::extract_component_operator<datetime_component::MINUTE>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -508,7 +608,7 @@ std::unique_ptr<column> extract_second(column_view const& column,
                                        rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::SECOND>,
+    detail::extract_component_operator<datetime_component::SECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -517,7 +617,7 @@ std::unique_ptr<column> extract_millisecond_fraction(column_view const& column,
                                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MILLISECOND>,
+    detail::extract_component_operator<datetime_component::MILLISECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -526,7 +626,7 @@ std::unique_ptr<column> extract_microsecond_fraction(column_view const& column,
                                                      rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::MICROSECOND>,
+    detail::extract_component_operator<datetime_component::MICROSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -535,7 +635,7 @@ std::unique_ptr<column> extract_nanosecond_fraction(column_view const& column,
                                                     rmm::device_async_resource_ref mr)
 {
   return detail::apply_datetime_op<
-    detail::extract_component_operator<detail::datetime_component::NANOSECOND>,
+    detail::extract_component_operator<datetime_component::NANOSECOND>,
     cudf::type_id::INT16>(column, stream, mr);
 }
 
@@ -605,6 +705,15 @@ std::unique_ptr<column> round_datetimes(column_view const& column,
     detail::rounding_function::ROUND, freq, column, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<table> extract_datetime_components(
+  column_view const& column,
+  std::vector<datetime_component> const& components,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::extract_datetime_components(column, components, cudf::get_default_stream(), mr);
+}
+
 std::unique_ptr<column> extract_year(column_view const& column, rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
@@ -24,6 +24,11 @@
 #include <algorithm>
 #include <filesystem>
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
 
 namespace cudf {
 
@@ -377,28 +382,23 @@ static int64_t get_transition_time(dst_transition_s const& trans, int year)
   return trans.time + cuda::std::chrono::duration_cast<duration_s>(duration_D{day}).count();
 }
 
-}  // namespace
-
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::device_async_resource_ref mr)
-{
-  CUDF_FUNC_RANGE();
-  return detail::make_timezone_transition_table(
-    tzif_dir, timezone_name, cudf::get_default_stream(), mr);
-}
-
-namespace detail {
+/**
+ * @brief Host copy of a timezone transition table
+ *
+ * Both vectors are empty when the timezone needs no conversion.
+ */
+struct transition_table {
+  std::vector<timestamp_s> transition_times;
+  std::vector<duration_s> offsets;
+};
 
-std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
-                                                      std::string_view timezone_name,
-                                                      rmm::cuda_stream_view stream,
-                                                      rmm::device_async_resource_ref mr)
+/**
+ * @brief Reads the TZif file of a timezone and builds its transition table.
+ */
+transition_table read_transition_table(std::optional<std::string_view> tzif_dir,
+                                       std::string_view timezone_name)
 {
-  if (timezone_name == "UTC" || timezone_name.empty()) {
-    // Return an empty table for UTC
-    return std::make_unique<cudf::table>();
-  }
+  if (timezone_name == "UTC" || timezone_name.empty()) { return {}; }
 
   timezone_file const tzf(tzif_dir, timezone_name);
 
@@ -428,7 +428,7 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
     if (tzf.typecnt() == 0 || tzf.ttype[0].utcoff == 0) {
       // No transitions, offset is zero; Table would be a no-op.
       // Return an empty table to speed up parsing.
-      return std::make_unique<cudf::table>();
+      return {};
     }
     // No transitions to use for the time/offset - use the first offset and apply to all timestamps
     transition_times[0] = std::numeric_limits<int64_t>::max();
@@ -485,20 +485,68 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   CUDF_EXPECTS(transition_times.size() == offsets.size(),
                "Error reading TZif file for timezone " + std::string{timezone_name});
 
-  std::vector<timestamp_s> ttimes_typed;
-  ttimes_typed.reserve(transition_times.size());
+  transition_table table;
+  table.transition_times.reserve(transition_times.size());
   std::transform(transition_times.cbegin(),
                  transition_times.cend(),
-                 std::back_inserter(ttimes_typed),
+                 std::back_inserter(table.transition_times),
                  [](auto ts) { return timestamp_s{duration_s{ts}}; });
-  std::vector<duration_s> offsets_typed;
-  offsets_typed.reserve(offsets.size());
-  std::transform(offsets.cbegin(), offsets.cend(), std::back_inserter(offsets_typed), [](auto ts) {
+  table.offsets.reserve(offsets.size());
+  std::transform(offsets.cbegin(), offsets.cend(), std::back_inserter(table.offsets), [](auto ts) {
     return duration_s{ts};
   });
+  return table;
+}
+
+/**
+ * @brief Returns the transition table of a timezone, reading its TZif file only on first use.
+ *
+ * The tables are cached for the lifetime of the process, keyed by the TZif directory and the
+ * timezone name, since readers and conversions request the same few timezones over and over.
+ */
+std::shared_ptr<transition_table const> cached_transition_table(
+  std::optional<std::string_view> tzif_dir, std::string_view timezone_name)
+{
+  static std::mutex cache_mutex;
+  static std::map<std::pair<std::string, std::string>, std::shared_ptr<transition_table const>>
+    cache;
+
+  auto key = std::pair{std::string{tzif_dir.value_or(tzif_system_directory)},
+                       std::string{timezone_name}};
+  {
+    std::lock_guard lock(cache_mutex);
+    if (auto const it = cache.find(key); it != cache.end()) { return it->second; }
+  }
+  // Parse outside of the lock; a concurrent parse of the same timezone yields an equal table
+  auto table =
+    std::make_shared<transition_table const>(read_transition_table(tzif_dir, timezone_name));
+  std::lock_guard lock(cache_mutex);
+  return cache.try_emplace(std::move(key), std::move(table)).first->second;
+}
+
+}  // namespace
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_timezone_transition_table(
+    tzif_dir, timezone_name, cudf::get_default_stream(), mr);
+}
+
+namespace detail {
+
+std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_view> tzif_dir,
+                                                      std::string_view timezone_name,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  auto const tz_table = cached_transition_table(tzif_dir, timezone_name);
+  if (tz_table->transition_times.empty()) { return std::make_unique<cudf::table>(); }
 
-  auto d_ttimes  = cudf::detail::make_device_uvector_async(ttimes_typed, stream, mr);
-  auto d_offsets = cudf::detail::make_device_uvector_async(offsets_typed, stream, mr);
+  auto d_ttimes  = cudf::detail::make_device_uvector_async(tz_table->transition_times, stream, mr);
+  auto d_offsets = cudf::detail::make_device_uvector_async(tz_table->offsets, stream, mr);
 
   std::vector<std::unique_ptr<column>> tz_table_columns;
   tz_table_columns.emplace_back(
@@ -506,8 +554,7 @@ std::unique_ptr<table> make_timezone_transition_table(std::optional<std::string_
   tz_table_columns.emplace_back(
     std::make_unique<cudf::column>(std::move(d_offsets), rmm::device_buffer{}, 0));
 
-  // Need to finish copies before transition_times and offsets go out of scope
-  stream.synchronize();
+  // No need to synchronize: the cached host table stays alive for the lifetime of the process
 
   return std::make_unique<cudf::table>(std::move(tz_table_columns));
 }
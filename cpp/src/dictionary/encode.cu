@@ -15,7 +15,9 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/get_value.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
@@ -23,6 +25,8 @@
 #include <cudf/dictionary/detail/encode.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
+#include <cudf/reduction/detail/reduction_functions.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
@@ -31,6 +35,8 @@
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <stdexcept>
+
 namespace cudf {
 namespace dictionary {
 namespace detail {
@@ -74,6 +80,30 @@ std::unique_ptr<column> encode(column_view const& input_column,
                                 input_column.null_count());
 }
 
+bool is_low_cardinality(column_view const& input_column,
+                        double max_distinct_ratio,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(max_distinct_ratio >= 0.0 && max_distinct_ratio <= 1.0,
+               "max_distinct_ratio must be in the range [0, 1]",
+               std::invalid_argument);
+  CUDF_EXPECTS(input_column.type().id() != type_id::DICTIONARY32,
+               "cannot encode a dictionary from a dictionary");
+
+  auto const valid_count = input_column.size() - input_column.null_count();
+  if (valid_count == 0) { return true; }
+
+  // A 2^12 register sketch estimates within a few percent, which is plenty for a threshold.
+  constexpr int precision = 12;
+  auto const mr           = rmm::mr::get_current_device_resource();
+
+  auto const sketch   = reduction::detail::hyperloglog(input_column, precision, stream, mr);
+  auto const sketches = make_column_from_scalar(*sketch, 1, stream, mr);
+  auto const estimate = reduction::detail::approx_distinct_count(sketches->view(), stream, mr);
+  auto const num_distinct = cudf::detail::get_value<int64_t>(estimate->view(), 0, stream);
+  return static_cast<double>(num_distinct) <= max_distinct_ratio * valid_count;
+}
+
 /**
  * @copydoc cudf::dictionary::detail::get_indices_type_for_size
  */
@@ -97,5 +127,13 @@ std::unique_ptr<column> encode(column_view const& input_column,
   return detail::encode(input_column, indices_type, stream, mr);
 }
 
+bool is_low_cardinality(column_view const& input_column,
+                        double max_distinct_ratio,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return detail::is_low_cardinality(input_column, max_distinct_ratio, stream);
+}
+
 }  // namespace dictionary
 }  // namespace cudf
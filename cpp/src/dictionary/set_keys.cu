@@ -193,6 +193,25 @@ std::vector<std::unique_ptr<column>> match_dictionaries(
   return result;
 }
 
+namespace {
+
+/**
+ * @brief Checks if the dictionary columns already view the same keys with the same indices type
+ */
+bool have_matching_keys(host_span<dictionary_column_view const> input)
+{
+  if (std::any_of(input.begin(), input.end(), [](auto const& col) { return col.is_empty(); })) {
+    return false;
+  }
+  auto const& first = input.front();
+  return std::all_of(input.begin() + 1, input.end(), [&first](auto const& col) {
+    return col.indices().type() == first.indices().type() &&
+           is_shallow_equivalent(col.keys(), first.keys());
+  });
+}
+
+}  // namespace
+
 std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_dictionaries(
   std::vector<table_view> tables, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr)
 {
@@ -215,6 +234,8 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
         tables.begin(), tables.end(), std::back_inserter(dict_views), [col_idx](auto& t) {
           return dictionary_column_view(t.column(col_idx));
         });
+      // columns sliced from the same dictionary already have matching keys
+      if (have_matching_keys(dict_views)) { continue; }
       // now match the keys in these dictionary columns
       auto dict_cols = dictionary::detail::match_dictionaries(dict_views, stream, mr);
       // replace the updated_columns vector entries for the set of columns at col_idx
@@ -238,6 +259,17 @@ std::pair<std::vector<std::unique_ptr<column>>, std::vector<table_view>> match_d
   return {std::move(dictionary_columns), std::move(updated_tables)};
 }
 
+table_view replace_dictionaries_with_indices(table_view const& input)
+{
+  std::vector<column_view> columns(input.begin(), input.end());
+  std::transform(columns.begin(), columns.end(), columns.begin(), [](auto const& col) {
+    return col.type().id() == type_id::DICTIONARY32 && col.num_children() > 0
+             ? dictionary_column_view(col).get_indices_annotated()
+             : col;
+  });
+  return table_view{columns};
+}
+
 }  // namespace detail
 
 // external API
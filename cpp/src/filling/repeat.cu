@@ -37,6 +37,7 @@
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
@@ -44,9 +45,11 @@
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
 #include <thrust/sort.h>
+#include <thrust/transform.h>
 
 #include <limits>
 #include <memory>
+#include <stdexcept>
 
 namespace {
 struct count_accessor {
@@ -150,6 +153,45 @@ std::unique_ptr<table> repeat(table_view const& input_table,
   return gather(input_table, map_begin, map_end, out_of_bounds_policy::DONT_CHECK, stream, mr);
 }
 
+std::unique_ptr<table> gather_repeated(table_view const& input_table,
+                                       column_view const& count,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(input_table.num_rows() == count.size(), "in and count must have equal size");
+  CUDF_EXPECTS(not count.has_nulls(), "count cannot contain nulls");
+  CUDF_EXPECTS(
+    is_index_type(gather_map.type()), "gather_map must be of an index type", std::invalid_argument);
+  CUDF_EXPECTS(
+    not gather_map.has_nulls(), "gather_map cannot contain nulls", std::invalid_argument);
+
+  auto count_iter = cudf::detail::indexalator_factory::make_input_iterator(count);
+
+  rmm::device_uvector<cudf::size_type> offsets(count.size(), stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy(stream), count_iter, count_iter + count.size(), offsets.begin());
+
+  // The run of each gathered row is the row of `input_table` to gather, and indices outside of
+  // the repeated table map past the last run.
+  auto const map_begin = cudf::detail::indexalator_factory::make_input_iterator(gather_map);
+  rmm::device_uvector<size_type> indices(gather_map.size(), stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    map_begin,
+    map_begin + gather_map.size(),
+    indices.begin(),
+    cuda::proclaim_return_type<size_type>(
+      [offsets = offsets.data(), num_runs = count.size()] __device__(size_type index) {
+        if (index < 0) { return num_runs; }
+        return static_cast<size_type>(
+          thrust::upper_bound(thrust::seq, offsets, offsets + num_runs, index) - offsets);
+      }));
+
+  return gather(input_table, indices.begin(), indices.end(), bounds_policy, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> repeat(table_view const& input_table,
@@ -170,4 +212,15 @@ std::unique_ptr<table> repeat(table_view const& input_table,
   return detail::repeat(input_table, count, stream, mr);
 }
 
+std::unique_ptr<table> gather_repeated(table_view const& input_table,
+                                       column_view const& count,
+                                       column_view const& gather_map,
+                                       out_of_bounds_policy bounds_policy,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::gather_repeated(input_table, count, gather_map, bounds_policy, stream, mr);
+}
+
 }  // namespace cudf
@@ -26,10 +26,12 @@
 #include <cudf/detail/groupby/sort_helper.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/reduction/detail/histogram.hpp>
 #include <cudf/strings/string_view.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -77,7 +79,15 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::disp
   // satisfied with a hash implementation
   if (_keys_are_sorted == sorted::NO and not _helper and
       detail::hash::can_use_hash_groupby(requests)) {
-    return detail::hash::groupby(_keys, requests, _include_null_keys, stream, mr);
+    // Preprocess the keys once so repeated aggregations on this object skip the flattening of
+    // nested keys done by the row operators. Dictionary keys are hashed and compared by their
+    // indices, which identify their values within each column.
+    if (not _preprocessed_keys) {
+      _preprocessed_keys = cudf::experimental::row::equality::preprocessed_table::create(
+        cudf::dictionary::detail::replace_dictionaries_with_indices(_keys), stream);
+    }
+    return detail::hash::groupby(
+      _keys, _preprocessed_keys, requests, _include_null_keys, stream, mr);
   } else {
     return sort_aggregate(requests, stream, mr);
   }
@@ -16,6 +16,8 @@
 
 #include "groupby/common/utils.hpp"
 #include "groupby/hash/groupby_kernels.cuh"
+#include "groupby/hash/shared_memory_aggs.cuh"
+#include "groupby/sort/group_reductions.hpp"
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
@@ -29,11 +31,17 @@
 #include <cudf/detail/gather.hpp>
 #include <cudf/detail/groupby.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_device_view.cuh>
@@ -46,12 +54,22 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuco/static_set.cuh>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 namespace cudf {
 namespace groupby {
@@ -83,6 +101,16 @@ constexpr std::array<aggregation::Kind, 12> hash_aggregations{aggregation::SUM,
                                                               aggregation::STD,
                                                               aggregation::VARIANCE};
 
+/**
+ * @brief List of aggregation operations that a hash-based implementation computes from the
+ * group of each row instead of atomically updating the result of each group.
+ */
+constexpr std::array<aggregation::Kind, 4> hash_group_label_aggregations{
+  aggregation::NUNIQUE,
+  aggregation::COLLECT_LIST,
+  aggregation::COLLECT_SET,
+  aggregation::HYPERLOGLOG};
+
 // Could be hash: SUM, PRODUCT, MIN, MAX, COUNT_VALID, COUNT_ALL, ANY, ALL,
 // Compound: MEAN(SUM, COUNT_VALID), VARIANCE, STD(MEAN (SUM, COUNT_VALID), COUNT_VALID),
 // ARGMAX, ARGMIN
@@ -110,6 +138,19 @@ bool constexpr is_hash_aggregation(aggregation::Kind t)
   return array_contains(hash_aggregations, t);
 }
 
+/**
+ * @brief Indicates whether the specified aggregation operation is computed from the group of each
+ * row by a hash-based implementation.
+ *
+ * @param t The aggregation operation to verify
+ * @return true `t` is computed from the group labels of the rows
+ * @return false `t` is not computed from the group labels of the rows
+ */
+bool constexpr is_hash_group_label_aggregation(aggregation::Kind t)
+{
+  return array_contains(hash_group_label_aggregations, t);
+}
+
 class groupby_simple_aggregations_collector final
   : public cudf::detail::simple_aggregations_collector {
  public:
@@ -178,6 +219,31 @@ class groupby_simple_aggregations_collector final
 
     return aggs;
   }
+
+  // The group label aggregations need no single pass aggregation
+  std::vector<std::unique_ptr<aggregation>> visit(data_type,
+                                                  cudf::detail::nunique_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::collect_list_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::collect_set_aggregation const&) override
+  {
+    return {};
+  }
+
+  std::vector<std::unique_ptr<aggregation>> visit(
+    data_type, cudf::detail::hyperloglog_aggregation const&) override
+  {
+    return {};
+  }
 };
 
 template <typename SetType>
@@ -191,6 +257,9 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
   bitmask_type const* __restrict__ row_bitmask;
   rmm::cuda_stream_view stream;
   rmm::device_async_resource_ref mr;
+  // Computed on first use by the group label aggregations
+  std::optional<rmm::device_uvector<size_type>> group_labels;
+  std::optional<std::pair<std::unique_ptr<column>, rmm::device_uvector<size_type>>> grouped_values;
 
  public:
   using cudf::detail::aggregation_finalizer::visit;
@@ -254,6 +323,68 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     return std::move(gather_argminmax->release()[0]);
   }
 
+  // Label of the dense result row of each row's group. Rows skipped because of null keys are
+  // labeled with the number of groups.
+  device_span<size_type const> get_group_labels()
+  {
+    if (not group_labels.has_value()) {
+      auto const num_groups = static_cast<size_type>(gather_map.size());
+      rmm::device_uvector<size_type> sparse_to_dense(col.size(), stream);
+      thrust::scatter(rmm::exec_policy_nosync(stream),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(num_groups),
+                      gather_map.begin(),
+                      sparse_to_dense.begin());
+      auto& labels = group_labels.emplace(col.size(), stream);
+      thrust::transform(
+        rmm::exec_policy_nosync(stream),
+        thrust::make_counting_iterator(0),
+        thrust::make_counting_iterator(col.size()),
+        labels.begin(),
+        cudf::detail::group_label_hash_functor<SetType>{
+          set, row_bitmask, sparse_to_dense.data(), num_groups});
+    }
+    return *group_labels;
+  }
+
+  // Values grouped in the order of the dense result rows, as the sort-based aggregations expect
+  // them, and the offsets of the groups. A stable sort of the group labels keeps the values of
+  // each group in their original order, without sorting the keys.
+  std::pair<std::unique_ptr<column>, rmm::device_uvector<size_type>> const& get_grouped_values()
+  {
+    if (not grouped_values.has_value()) {
+      auto const labels     = get_group_labels();
+      auto const num_groups = static_cast<size_type>(gather_map.size());
+      rmm::device_uvector<size_type> sorted_labels(labels.size(), stream);
+      thrust::copy(
+        rmm::exec_policy_nosync(stream), labels.begin(), labels.end(), sorted_labels.begin());
+      rmm::device_uvector<size_type> order(labels.size(), stream);
+      thrust::sequence(rmm::exec_policy_nosync(stream), order.begin(), order.end());
+      thrust::stable_sort_by_key(
+        rmm::exec_policy_nosync(stream), sorted_labels.begin(), sorted_labels.end(), order.begin());
+
+      // The skipped rows sort last and are left out of the grouped values
+      rmm::device_uvector<size_type> group_offsets(num_groups + 1, stream);
+      thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                          sorted_labels.begin(),
+                          sorted_labels.end(),
+                          thrust::make_counting_iterator(0),
+                          thrust::make_counting_iterator(num_groups + 1),
+                          group_offsets.begin());
+      auto const num_grouped_rows = group_offsets.element(num_groups, stream);
+      auto const grouped_rows =
+        device_span<size_type const>{order.data(), static_cast<std::size_t>(num_grouped_rows)};
+      auto values = cudf::detail::gather(table_view{{col}},
+                                         grouped_rows,
+                                         out_of_bounds_policy::DONT_CHECK,
+                                         cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                         stream,
+                                         rmm::mr::get_current_device_resource());
+      grouped_values.emplace(std::move(values->release().front()), std::move(group_offsets));
+    }
+    return *grouped_values;
+  }
+
   // Declare overloads for each kind of aggregation to dispatch
   void visit(cudf::aggregation const& agg) override
   {
@@ -346,6 +477,88 @@ class hash_compound_agg_finalizer final : public cudf::detail::aggregation_final
     auto result = cudf::detail::unary_operation(variance, unary_operator::SQRT, stream, mr);
     dense_results->add_result(col, agg, std::move(result));
   }
+
+  void visit(cudf::detail::nunique_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    // Each distinct (group label, value) row is a distinct value of its group
+    auto const labels     = get_group_labels();
+    auto const num_groups = static_cast<size_type>(gather_map.size());
+    column_view const labels_view(
+      data_type(type_to_id<size_type>()), col.size(), labels.data(), nullptr, 0);
+    auto const distinct_rows =
+      cudf::detail::distinct_indices(table_view{{labels_view, col}},
+                                     duplicate_keep_option::KEEP_ANY,
+                                     null_equality::EQUAL,
+                                     nan_equality::ALL_EQUAL,
+                                     stream,
+                                     rmm::mr::get_current_device_resource());
+
+    auto result = make_fixed_width_column(
+      data_type(type_to_id<size_type>()), num_groups, mask_state::UNALLOCATED, stream, mr);
+    auto const counts = result->mutable_view().template begin<size_type>();
+    thrust::fill(rmm::exec_policy_nosync(stream), counts, counts + num_groups, size_type{0});
+    auto const values_view = column_device_view::create(col, stream);
+    auto const exclude_nulls = agg._null_handling == null_policy::EXCLUDE;
+    thrust::for_each(
+      rmm::exec_policy_nosync(stream),
+      distinct_rows.begin(),
+      distinct_rows.end(),
+      ::cudf::detail::nunique_hash_functor{
+        labels.data(), num_groups, *values_view, exclude_nulls, counts});
+    dense_results->add_result(col, agg, std::move(result));
+  }
+
+  void visit(cudf::detail::collect_list_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto const& [values, group_offsets] = get_grouped_values();
+    dense_results->add_result(col,
+                              agg,
+                              cudf::groupby::detail::group_collect(values->view(),
+                                                                   group_offsets,
+                                                                   gather_map.size(),
+                                                                   agg._null_handling,
+                                                                   stream,
+                                                                   mr));
+  }
+
+  void visit(cudf::detail::collect_set_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    auto const& [values, group_offsets] = get_grouped_values();
+    auto const collect_result =
+      cudf::groupby::detail::group_collect(values->view(),
+                                           group_offsets,
+                                           gather_map.size(),
+                                           agg._null_handling,
+                                           stream,
+                                           rmm::mr::get_current_device_resource());
+    dense_results->add_result(
+      col,
+      agg,
+      lists::detail::distinct(
+        lists_column_view{collect_result->view()}, agg._nulls_equal, agg._nans_equal, stream, mr));
+  }
+
+  void visit(cudf::detail::hyperloglog_aggregation const& agg) override
+  {
+    if (dense_results->has_result(col, agg)) return;
+
+    // The rows skipped because of null keys are labeled past the last group and left out
+    dense_results->add_result(
+      col,
+      agg,
+      cudf::reduction::detail::group_hyperloglog(col,
+                                                 get_group_labels(),
+                                                 static_cast<size_type>(gather_map.size()),
+                                                 agg.precision,
+                                                 stream,
+                                                 mr));
+  }
 };
 // flatten aggs to filter in single pass aggs
 std::tuple<table_view, std::vector<aggregation::Kind>, std::vector<std::unique_ptr<aggregation>>>
@@ -453,9 +666,65 @@ auto create_sparse_results_table(table_view const& flattened_values,
   return sparse_table;
 }
 
+// Block size of the shared memory aggregation kernel
+constexpr size_type shared_memory_aggs_block_size = 128;
+// Shared memory, static and dynamic, used by each block of the shared memory aggregation kernel.
+// This is the default limit of all supported devices, so the kernel needs no opt-in to larger
+// allocations.
+constexpr std::size_t shared_memory_aggs_budget = 48 * 1024;
+
+/**
+ * @brief Returns the layout of the shared memory of `compute_shared_memory_aggs`.
+ *
+ * The layout is the byte offsets of the accumulators of each aggregation followed by the offset
+ * of their validity flags, and the number of slots of the shared memory hash tables. The number
+ * of slots is zero if some aggregation cannot be accumulated in shared memory or if too few slots
+ * fit in `budget` bytes.
+ */
+std::pair<std::vector<size_type>, size_type> shared_memory_aggs_layout(
+  table_view const& flattened_values,
+  std::vector<aggregation::Kind> const& aggs,
+  table_view const& sparse_table,
+  std::size_t budget)
+{
+  auto constexpr alignment = sizeof(int64_t);
+  auto const is_supported  = std::all_of(
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(flattened_values.num_columns()),
+    [&](auto i) {
+      return cudf::detail::dispatch_type_and_aggregation(
+        flattened_values.column(i).type(), aggs[i], shared_memory_aggregation_support{});
+    });
+  if (not is_supported) { return {{}, 0}; }
+
+  // Every slot holds a group, an accumulator and a validity flag per aggregation, and each array
+  // may need some padding to be aligned
+  auto bytes_per_slot = sizeof(size_type);
+  for (auto const& col : sparse_table) {
+    bytes_per_slot += cudf::size_of(col.type()) + sizeof(bool);
+  }
+  auto const padding = alignment * (sparse_table.num_columns() + 1);
+  if (budget <= padding) { return {{}, 0}; }
+  auto const capacity = static_cast<size_type>((budget - padding) / bytes_per_slot);
+  // At least twice as many slots as threads keep a block's table from filling up
+  if (capacity < 2 * shared_memory_aggs_block_size) { return {{}, 0}; }
+
+  std::vector<size_type> offsets;
+  auto offset = cudf::util::round_up_safe(capacity * sizeof(size_type), alignment);
+  for (auto const& col : sparse_table) {
+    offsets.push_back(static_cast<size_type>(offset));
+    offset += cudf::util::round_up_safe(capacity * cudf::size_of(col.type()), alignment);
+  }
+  offsets.push_back(static_cast<size_type>(offset));
+  return {std::move(offsets), capacity};
+}
+
 /**
  * @brief Computes all aggregations from `requests` that require a single pass
  * over the data and stores the results in `sparse_results`
+ *
+ * When all aggregations can be accumulated in shared memory, each block first aggregates its rows
+ * in shared memory, which avoids contention on the output rows of low-cardinality keys.
  */
 template <typename SetType>
 void compute_single_pass_aggs(table_view const& keys,
@@ -484,16 +753,59 @@ void compute_single_pass_aggs(table_view const& keys,
       ? cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first
       : rmm::device_buffer{};
 
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    keys.num_rows(),
-    hash::compute_single_pass_aggs_fn{set,
-                                      *d_values,
-                                      *d_sparse_table,
-                                      d_aggs.data(),
-                                      static_cast<bitmask_type*>(row_bitmask.data()),
-                                      skip_key_rows_with_nulls});
+  // The dynamic shared memory of a block is what the budget leaves after the kernel's static
+  // shared memory
+  auto const kernel = hash::compute_shared_memory_aggs<SetType>;
+  cudaFuncAttributes kernel_attributes;
+  CUDF_CUDA_TRY(cudaFuncGetAttributes(&kernel_attributes, kernel));
+  auto const budget = shared_memory_aggs_budget -
+                      std::min(shared_memory_aggs_budget, kernel_attributes.sharedSizeBytes);
+  auto const [value_offsets, capacity] =
+    shared_memory_aggs_layout(flattened_values, agg_kinds, sparse_table.view(), budget);
+  auto const shared_memory_size =
+    capacity > 0 ? value_offsets.back() + sizeof(bool) * capacity * sparse_table.num_columns() : 0;
+
+  // Each block flushes its table once, so only as many blocks as can be resident are launched.
+  // If no block can be resident the rows are aggregated without shared memory.
+  int max_active_blocks = 0;
+  if (capacity > 0 and keys.num_rows() > 0) {
+    CUDF_CUDA_TRY(cudaOccupancyMaxActiveBlocksPerMultiprocessor(
+      &max_active_blocks, kernel, shared_memory_aggs_block_size, shared_memory_size));
+  }
+  if (max_active_blocks > 0) {
+    auto const d_value_offsets = cudf::detail::make_device_uvector_async(
+      value_offsets, stream, rmm::mr::get_current_device_resource());
+    int device = 0;
+    CUDF_CUDA_TRY(cudaGetDevice(&device));
+    int num_sms = 0;
+    CUDF_CUDA_TRY(cudaDeviceGetAttribute(&num_sms, cudaDevAttrMultiProcessorCount, device));
+    auto const num_blocks =
+      std::min(cudf::util::div_rounding_up_safe(keys.num_rows(), shared_memory_aggs_block_size),
+               max_active_blocks * num_sms);
+
+    kernel<<<num_blocks, shared_memory_aggs_block_size, shared_memory_size, stream.value()>>>(
+      set,
+      keys.num_rows(),
+      *d_values,
+      *d_sparse_table,
+      d_aggs.data(),
+      static_cast<bitmask_type*>(row_bitmask.data()),
+      skip_key_rows_with_nulls,
+      d_value_offsets.data(),
+      capacity);
+    CUDF_CHECK_CUDA(stream.value());
+  } else {
+    thrust::for_each_n(
+      rmm::exec_policy(stream),
+      thrust::make_counting_iterator(0),
+      keys.num_rows(),
+      hash::compute_single_pass_aggs_fn{set,
+                                        *d_values,
+                                        *d_sparse_table,
+                                        d_aggs.data(),
+                                        static_cast<bitmask_type*>(row_bitmask.data()),
+                                        skip_key_rows_with_nulls});
+  }
   // Add results back to sparse_results cache
   auto sparse_result_cols = sparse_table.release();
   for (size_t i = 0; i < aggs.size(); i++) {
@@ -545,22 +857,23 @@ rmm::device_uvector<size_type> extract_populated_keys(SetType const& key_set,
  * results using the aforementioned index vector. Dense results are stored into
  * the in/out parameter `cache`.
  */
-std::unique_ptr<table> groupby(table_view const& keys,
-                               host_span<aggregation_request const> requests,
-                               cudf::detail::result_cache* cache,
-                               bool const keys_have_nulls,
-                               null_policy const include_null_keys,
-                               rmm::cuda_stream_view stream,
-                               rmm::device_async_resource_ref mr)
+std::unique_ptr<table> groupby(
+  table_view const& keys,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_keys,
+  host_span<aggregation_request const> requests,
+  cudf::detail::result_cache* cache,
+  bool const keys_have_nulls,
+  null_policy const include_null_keys,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
 {
   auto const num_keys            = keys.num_rows();
   auto const null_keys_are_equal = null_equality::EQUAL;
   auto const has_null            = nullate::DYNAMIC{cudf::has_nested_nulls(keys)};
 
-  auto preprocessed_keys = cudf::experimental::row::hash::preprocessed_table::create(keys, stream);
-  auto const comparator  = cudf::experimental::row::equality::self_comparator{preprocessed_keys};
-  auto const row_hash    = cudf::experimental::row::hash::row_hasher{std::move(preprocessed_keys)};
-  auto const d_row_hash  = row_hash.device_hasher(has_null);
+  auto const comparator = cudf::experimental::row::equality::self_comparator{preprocessed_keys};
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_keys};
+  auto const d_row_hash = row_hash.device_hasher(has_null);
 
   // Cache of sparse results where the location of aggregate value in each
   // column is indexed by the hash set
@@ -641,8 +954,15 @@ bool can_use_hash_groupby(host_span<aggregation_request const> requests)
     // hash-based aggregations. For those situations, we fallback to sort-based aggregations.
     if (v_type.id() == type_id::STRUCT or v_type.id() == type_id::LIST) { return false; }
 
-    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [v_type](auto const& a) {
-      return cudf::has_atomic_support(cudf::detail::target_type(v_type, a->kind)) and
+    return std::all_of(r.aggregations.begin(), r.aggregations.end(), [&](auto const& a) {
+      if (is_hash_group_label_aggregation(a->kind)) {
+        return not is_dictionary(r.values.type());
+      }
+      // DECIMAL128 sums are accumulated with 64-bit atomics on the two halves of each value
+      auto const target = cudf::detail::target_type(v_type, a->kind);
+      auto const is_decimal128_sum =
+        a->kind == aggregation::SUM and target.id() == type_id::DECIMAL128;
+      return (cudf::has_atomic_support(target) or is_decimal128_sum) and
              is_hash_aggregation(a->kind);
     });
   });
@@ -651,6 +971,7 @@ bool can_use_hash_groupby(host_span<aggregation_request const> requests)
 // Hash-based groupby
 std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
   table_view const& keys,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_keys,
   host_span<aggregation_request const> requests,
   null_policy include_null_keys,
   rmm::cuda_stream_view stream,
@@ -658,8 +979,8 @@ std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby(
 {
   cudf::detail::result_cache cache(requests.size());
 
-  std::unique_ptr<table> unique_keys =
-    groupby(keys, requests, &cache, cudf::has_nulls(keys), include_null_keys, stream, mr);
+  std::unique_ptr<table> unique_keys = groupby(
+    keys, preprocessed_keys, requests, &cache, cudf::has_nulls(keys), include_null_keys, stream, mr);
 
   return std::pair(std::move(unique_keys), extract_results(requests, cache, stream, mr));
 }
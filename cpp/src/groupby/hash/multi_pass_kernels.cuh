@@ -20,8 +20,10 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/aggregation/aggregation.hpp>
 #include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <cuda/atomic>
@@ -111,5 +113,48 @@ struct var_hash_functor {
   }
 };
 
+/**
+ * @brief Computes the dense result row of the group of each row
+ *
+ * `sparse_to_dense` maps the row stored in `set` for each group to the dense result row of the
+ * group. Rows skipped because of null keys are labeled `skipped_label`.
+ */
+template <typename SetType>
+struct group_label_hash_functor {
+  SetType set;
+  bitmask_type const* __restrict__ row_bitmask;
+  size_type const* __restrict__ sparse_to_dense;
+  size_type skipped_label;
+
+  __device__ inline size_type operator()(size_type source_index) const
+  {
+    if (row_bitmask != nullptr and not cudf::bit_is_set(row_bitmask, source_index)) {
+      return skipped_label;
+    }
+    return sparse_to_dense[*set.find(source_index)];
+  }
+};
+
+/**
+ * @brief Counts the distinct (group, value) rows of each group
+ *
+ * Each `source_index` is the index of one distinct (group label, value) row, so the number of
+ * distinct values of a group is the number of its rows.
+ */
+struct nunique_hash_functor {
+  size_type const* __restrict__ group_labels;
+  size_type skipped_label;
+  column_device_view source;
+  bool exclude_nulls;
+  size_type* __restrict__ target;
+
+  __device__ inline void operator()(size_type source_index) const
+  {
+    auto const label = group_labels[source_index];
+    if (label == skipped_label or (exclude_nulls and source.is_null(source_index))) { return; }
+    cudf::detail::atomic_add(&target[label], size_type{1});
+  }
+};
+
 }  // namespace detail
 }  // namespace cudf
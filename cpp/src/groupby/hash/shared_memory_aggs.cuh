@@ -0,0 +1,334 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/detail/utilities/assert.cuh>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/device_atomics.cuh>
+#include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+namespace hash {
+
+/**
+ * @brief Returns true if the single pass aggregation `k` of `Source` values can be accumulated in
+ * shared memory.
+ *
+ * These are the aggregations supported by `cudf::detail::update_target_element`, except for the
+ * dictionary and fixed-point ones.
+ */
+template <typename Source, aggregation::Kind k>
+constexpr bool is_shared_memory_aggregation()
+{
+  if constexpr (cudf::is_dictionary<Source>() or cudf::is_fixed_point<Source>()) {
+    return false;
+  } else if constexpr (k == aggregation::SUM) {
+    return cudf::is_fixed_width<Source>() and cudf::has_atomic_support<Source>() and
+           not cudf::is_timestamp<Source>();
+  } else if constexpr (k == aggregation::MIN or k == aggregation::MAX) {
+    return cudf::is_fixed_width<Source>() and cudf::has_atomic_support<Source>();
+  } else if constexpr (k == aggregation::PRODUCT or k == aggregation::SUM_OF_SQUARES) {
+    return cudf::detail::is_product_supported<Source>();
+  } else if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+    return cudf::detail::is_valid_aggregation<Source, k>();
+  } else if constexpr (k == aggregation::ARGMIN or k == aggregation::ARGMAX) {
+    return cudf::detail::is_valid_aggregation<Source, k>() and
+           cudf::is_relationally_comparable<Source, Source>();
+  } else {
+    return false;
+  }
+}
+
+/**
+ * @brief Dispatched functor returning whether an aggregation can be accumulated in shared memory.
+ */
+struct shared_memory_aggregation_support {
+  template <typename Source, aggregation::Kind k>
+  constexpr bool operator()() const noexcept
+  {
+    return is_shared_memory_aggregation<Source, k>();
+  }
+};
+
+/**
+ * @brief Atomically combines `value` into `*address` with the binary operator of aggregation `k`.
+ *
+ * The partial results of SUM_OF_SQUARES and of the counts are combined by adding them.
+ */
+template <aggregation::Kind k, typename T>
+__device__ inline void atomic_combine(T* address, T value)
+{
+  if constexpr (k == aggregation::MIN) {
+    cudf::detail::atomic_min(address, value);
+  } else if constexpr (k == aggregation::MAX) {
+    cudf::detail::atomic_max(address, value);
+  } else if constexpr (k == aggregation::PRODUCT) {
+    cudf::detail::atomic_mul(address, value);
+  } else {
+    cudf::detail::atomic_add(address, value);
+  }
+}
+
+/**
+ * @brief Dispatched functor initializing a shared memory accumulator with the identity of its
+ * aggregation.
+ */
+struct shared_memory_identity_initializer {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(char* target, bool* target_valid, size_type target_index) const
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target  = cudf::detail::target_type_t<Source, k>;
+      auto& element = reinterpret_cast<Target*>(target)[target_index];
+      if constexpr (k == aggregation::ARGMAX) {
+        element = cudf::detail::ARGMAX_SENTINEL;
+      } else if constexpr (k == aggregation::ARGMIN) {
+        element = cudf::detail::ARGMIN_SENTINEL;
+      } else {
+        element = cudf::detail::corresponding_operator_t<k>::template identity<Target>();
+      }
+      target_valid[target_index] = false;
+    } else {
+      CUDF_UNREACHABLE("Invalid shared memory aggregation.");
+    }
+  }
+};
+
+/**
+ * @brief Dispatched functor aggregating an element of `source` into a shared memory accumulator.
+ *
+ * The null elements of `source` are skipped as in `cudf::detail::update_target_element`.
+ */
+struct shared_memory_element_aggregator {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(char* target,
+                             bool* target_valid,
+                             size_type target_index,
+                             column_device_view source,
+                             size_type source_index) const
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      if (k != aggregation::COUNT_ALL and source.is_null(source_index)) { return; }
+
+      using Target  = cudf::detail::target_type_t<Source, k>;
+      auto* element = reinterpret_cast<Target*>(target) + target_index;
+      if constexpr (k == aggregation::ARGMAX or k == aggregation::ARGMIN) {
+        auto const sentinel =
+          k == aggregation::ARGMAX ? cudf::detail::ARGMAX_SENTINEL : cudf::detail::ARGMIN_SENTINEL;
+        auto const is_better = [&](Target old) {
+          return k == aggregation::ARGMAX
+                   ? source.element<Source>(source_index) > source.element<Source>(old)
+                   : source.element<Source>(source_index) < source.element<Source>(old);
+        };
+        auto old = cudf::detail::atomic_cas(element, sentinel, source_index);
+        if (old != sentinel) {
+          while (is_better(old)) {
+            old = cudf::detail::atomic_cas(element, old, source_index);
+          }
+        }
+      } else if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+        cudf::detail::atomic_add(element, Target{1});
+      } else {
+        auto value = static_cast<Target>(source.element<Source>(source_index));
+        if constexpr (k == aggregation::SUM_OF_SQUARES) { value = value * value; }
+        atomic_combine<k>(element, value);
+      }
+      target_valid[target_index] = true;
+    } else {
+      CUDF_UNREACHABLE("Invalid shared memory aggregation.");
+    }
+  }
+};
+
+/**
+ * @brief Dispatched functor merging a shared memory accumulator into an element of the global
+ * `target` column.
+ *
+ * The partial results of ARGMIN and ARGMAX are indices into `source`, so they are merged like any
+ * other row of `source`.
+ */
+struct shared_memory_element_merger {
+  template <typename Source, aggregation::Kind k>
+  __device__ void operator()(mutable_column_device_view target,
+                             size_type target_index,
+                             column_device_view source,
+                             char const* partial,
+                             bool const* partial_valid,
+                             size_type partial_index) const
+  {
+    if constexpr (is_shared_memory_aggregation<Source, k>()) {
+      using Target     = cudf::detail::target_type_t<Source, k>;
+      auto const value = reinterpret_cast<Target const*>(partial)[partial_index];
+      if constexpr (k == aggregation::COUNT_VALID or k == aggregation::COUNT_ALL) {
+        cudf::detail::atomic_add(&target.element<Target>(target_index), value);
+      } else {
+        if (not partial_valid[partial_index]) { return; }
+        if constexpr (k == aggregation::ARGMAX or k == aggregation::ARGMIN) {
+          cudf::detail::update_target_element<Source, k, true, false>{}(
+            target, target_index, source, value);
+        } else {
+          atomic_combine<k>(&target.element<Target>(target_index), value);
+          if (target.is_null(target_index)) { target.set_valid(target_index); }
+        }
+      }
+    } else {
+      CUDF_UNREACHABLE("Invalid shared memory aggregation.");
+    }
+  }
+};
+
+/**
+ * @brief Finds or inserts the slot of `group` in a block's shared memory hash table.
+ *
+ * New groups are only inserted while the table holds fewer than `max_groups` groups. Since at most
+ * one insertion per thread can be in flight past that check, the table never fills up as long as
+ * `max_groups + blockDim.x` does not exceed `capacity`.
+ *
+ * @return The slot of `group`, or `CUDF_SIZE_TYPE_SENTINEL` if the table is full
+ */
+__device__ inline size_type find_or_insert_group(size_type* slots,
+                                                 size_type capacity,
+                                                 size_type group,
+                                                 size_type* num_groups,
+                                                 size_type max_groups)
+{
+  auto constexpr empty = cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+  auto slot = static_cast<size_type>(cudf::hashing::detail::default_hash<size_type>{}(group) %
+                                     static_cast<uint32_t>(capacity));
+  while (true) {
+    auto const existing = slots[slot];
+    if (existing == group) { return slot; }
+    if (existing == empty) {
+      if (*num_groups >= max_groups) { return empty; }
+      auto const old = cudf::detail::atomic_cas(&slots[slot], empty, group);
+      if (old == empty) {
+        cudf::detail::atomic_add(num_groups, size_type{1});
+        return slot;
+      }
+      if (old == group) { return slot; }
+    }
+    slot = slot + 1 == capacity ? 0 : slot + 1;
+  }
+}
+
+/**
+ * @brief Computes single-pass aggregations like `compute_single_pass_aggs_fn`, but privatizes the
+ * aggregation of each block in a shared memory hash table.
+ *
+ * Each row is mapped to its group, i.e. the row index stored in `set` for its key, and the group
+ * is mapped to a slot of the block's shared memory hash table. The row is aggregated into the
+ * shared memory accumulators of the slot, and the accumulators are merged into `output_values`
+ * once per block. This avoids most global atomics on the same output rows when there are few
+ * groups. Rows whose group does not fit in the block's table are aggregated directly into
+ * `output_values`.
+ *
+ * The dynamic shared memory holds `capacity` slots, followed by the accumulators of every
+ * aggregation starting at the byte offsets `value_offsets[0, num_aggs)`, followed by the
+ * validity flags of the accumulators starting at `value_offsets[num_aggs]`.
+ *
+ * @tparam SetRef The type of the hash set device ref
+ */
+template <typename SetRef>
+CUDF_KERNEL void compute_shared_memory_aggs(SetRef set,
+                                            size_type num_rows,
+                                            table_device_view input_values,
+                                            mutable_table_device_view output_values,
+                                            aggregation::Kind const* __restrict__ aggs,
+                                            bitmask_type const* __restrict__ row_bitmask,
+                                            bool skip_rows_with_nulls,
+                                            size_type const* __restrict__ value_offsets,
+                                            size_type capacity)
+{
+  extern __shared__ char shared_memory[];
+  __shared__ size_type num_groups;
+
+  auto const num_aggs     = output_values.num_columns();
+  auto* const slots       = reinterpret_cast<size_type*>(shared_memory);
+  auto* const valid_flags = reinterpret_cast<bool*>(shared_memory + value_offsets[num_aggs]);
+  auto const max_groups   = capacity / 2;
+
+  if (threadIdx.x == 0) { num_groups = 0; }
+  for (auto slot = static_cast<size_type>(threadIdx.x); slot < capacity;
+       slot += static_cast<size_type>(blockDim.x)) {
+    slots[slot] = cudf::detail::CUDF_SIZE_TYPE_SENTINEL;
+    for (auto i = 0; i < num_aggs; ++i) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(i).type(),
+                                                  aggs[i],
+                                                  shared_memory_identity_initializer{},
+                                                  shared_memory + value_offsets[i],
+                                                  valid_flags + i * capacity,
+                                                  slot);
+    }
+  }
+  __syncthreads();
+
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto idx = cudf::detail::grid_1d::global_thread_id(); idx < num_rows; idx += stride) {
+    auto const row = static_cast<size_type>(idx);
+    if (skip_rows_with_nulls and not cudf::bit_is_set(row_bitmask, row)) { continue; }
+
+    auto const group = *set.insert_and_find(row).first;
+    auto const slot  = find_or_insert_group(slots, capacity, group, &num_groups, max_groups);
+    if (slot == cudf::detail::CUDF_SIZE_TYPE_SENTINEL) {
+      cudf::detail::aggregate_row<true, true>(output_values, group, input_values, row, aggs);
+      continue;
+    }
+    for (auto i = 0; i < num_aggs; ++i) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(i).type(),
+                                                  aggs[i],
+                                                  shared_memory_element_aggregator{},
+                                                  shared_memory + value_offsets[i],
+                                                  valid_flags + i * capacity,
+                                                  slot,
+                                                  input_values.column(i),
+                                                  row);
+    }
+  }
+  __syncthreads();
+
+  for (auto slot = static_cast<size_type>(threadIdx.x); slot < capacity;
+       slot += static_cast<size_type>(blockDim.x)) {
+    auto const group = slots[slot];
+    if (group == cudf::detail::CUDF_SIZE_TYPE_SENTINEL) { continue; }
+    for (auto i = 0; i < num_aggs; ++i) {
+      cudf::detail::dispatch_type_and_aggregation(input_values.column(i).type(),
+                                                  aggs[i],
+                                                  shared_memory_element_merger{},
+                                                  output_values.column(i),
+                                                  group,
+                                                  input_values.column(i),
+                                                  shared_memory + value_offsets[i],
+                                                  valid_flags + i * capacity,
+                                                  slot);
+    }
+  }
+}
+
+}  // namespace hash
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "partitioning/spill_partitions.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+// The partitions are chosen with a different seed than the hash maps of the partitions' groupbys,
+// otherwise all keys of a partition would share the low bits of the hash map's hash values
+constexpr uint32_t partition_seed = DEFAULT_HASH_SEED + 1;
+
+using aggregate_result = std::pair<std::unique_ptr<table>, std::vector<aggregation_result>>;
+
+}  // namespace
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> groupby::aggregate_partitioned(
+  host_span<aggregation_request const> requests,
+  size_type num_partitions,
+  bool spill_to_host,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive", std::invalid_argument);
+  CUDF_EXPECTS(
+    std::all_of(requests.begin(),
+                requests.end(),
+                [this](auto const& request) { return request.values.size() == _keys.num_rows(); }),
+    "Size mismatch between request values and groupby keys.");
+
+  if (num_partitions == 1 or _keys.num_rows() == 0) { return aggregate(requests, stream, mr); }
+
+  // The keys and the values of all requests are partitioned together
+  auto const num_keys = _keys.num_columns();
+  std::vector<column_view> columns(_keys.begin(), _keys.end());
+  std::transform(requests.begin(),
+                 requests.end(),
+                 std::back_inserter(columns),
+                 [](auto const& request) { return request.values; });
+  auto const input = table_view{columns};
+  std::vector<size_type> key_indices(num_keys);
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  // The groups of different partitions are disjoint, so each partition is aggregated on its own
+  // and the results of all aggregations can simply be concatenated
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  std::vector<aggregate_result> partition_results;
+  auto const aggregate_partition = [&](table_view const& partition) {
+    std::vector<aggregation_request> partition_requests(requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      partition_requests[i].values = partition.column(num_keys + i);
+      for (auto const& agg : requests[i].aggregations) {
+        partition_requests[i].aggregations.emplace_back(
+          dynamic_cast<groupby_aggregation*>(agg->clone().release()));
+      }
+    }
+    groupby partition_groupby(partition.select(key_indices), _include_null_keys);
+    partition_results.push_back(partition_groupby.aggregate(partition_requests, stream, temp_mr));
+  };
+
+  if (spill_to_host) {
+    auto const partitions = cudf::detail::spill_hash_partitions(
+      input, key_indices, num_partitions, false, partition_seed, stream);
+    for (auto const& parts : partitions) {
+      if (parts.empty()) { continue; }
+      aggregate_partition(cudf::detail::unspill_partition(parts, stream)->view());
+    }
+  } else {
+    auto const [partitioned, offsets] = cudf::hash_partition(
+      input, key_indices, num_partitions, hash_id::HASH_MURMUR3, partition_seed, stream, temp_mr);
+    for (size_type p = 0; p < num_partitions; ++p) {
+      auto const begin = offsets[p];
+      auto const end   = p + 1 < num_partitions ? offsets[p + 1] : input.num_rows();
+      if (begin == end) { continue; }
+      aggregate_partition(cudf::detail::slice(partitioned->view(), {begin, end}, stream).front());
+    }
+  }
+
+  std::vector<table_view> keys;
+  std::transform(partition_results.begin(),
+                 partition_results.end(),
+                 std::back_inserter(keys),
+                 [](auto const& result) { return result.first->view(); });
+  std::vector<aggregation_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      std::vector<column_view> partition_columns;
+      std::transform(partition_results.begin(),
+                     partition_results.end(),
+                     std::back_inserter(partition_columns),
+                     [&](auto const& result) { return result.second[i].results[j]->view(); });
+      results[i].results.push_back(cudf::detail::concatenate(partition_columns, stream, mr));
+    }
+  }
+  return std::pair(cudf::detail::concatenate(keys, stream, mr), std::move(results));
+}
+
+}  // namespace groupby
+}  // namespace cudf
@@ -32,6 +32,7 @@
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/groupby.hpp>
 #include <cudf/lists/detail/stream_compaction.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -447,6 +448,31 @@ void aggregate_result_functor::operator()<aggregation::COLLECT_SET>(aggregation
       lists_column_view{collect_result->view()}, nulls_equal, nans_equal, stream, mr));
 }
 
+template <>
+void aggregate_result_functor::operator()<aggregation::TOP_K>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const& top_k_agg = dynamic_cast<cudf::detail::top_k_aggregation const&>(agg);
+
+  auto count_agg = make_count_aggregation();
+  operator()<aggregation::COUNT_VALID>(*count_agg);
+  column_view valid_counts = cache.get_result(values, *count_agg);
+
+  cache.add_result(values,
+                   agg,
+                   detail::group_top_k(
+                     get_grouped_values(),
+                     helper.group_labels(stream),
+                     helper.group_offsets(stream),
+                     {valid_counts.begin<size_type>(), static_cast<size_t>(valid_counts.size())},
+                     helper.num_groups(stream),
+                     top_k_agg._k,
+                     top_k_agg._column_order,
+                     stream,
+                     mr));
+}
+
 /**
  * @brief Perform merging for the lists that correspond to the same key value.
  *
@@ -792,6 +818,48 @@ void aggregate_result_functor::operator()<aggregation::MERGE_TDIGEST>(aggregatio
                                                               mr));
 }
 
+/**
+ * @brief Generate a HyperLogLog sketch of the distinct values of each group.
+ *
+ * The sketch column produced is a `LIST<INT8>` column holding the `2^precision` registers of
+ * the sketch of each group.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::HYPERLOGLOG>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision = dynamic_cast<cudf::detail::hyperloglog_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::reduction::detail::group_hyperloglog(get_grouped_values(),
+                                                              helper.group_labels(stream),
+                                                              helper.num_groups(stream),
+                                                              precision,
+                                                              stream,
+                                                              mr));
+}
+
+/**
+ * @brief Merge the HyperLogLog sketches of each group into a new sketch.
+ */
+template <>
+void aggregate_result_functor::operator()<aggregation::MERGE_HYPERLOGLOG>(aggregation const& agg)
+{
+  if (cache.has_result(values, agg)) { return; }
+
+  auto const precision =
+    dynamic_cast<cudf::detail::merge_hyperloglog_aggregation const&>(agg).precision;
+  cache.add_result(values,
+                   agg,
+                   cudf::reduction::detail::group_merge_hyperloglog(get_grouped_values(),
+                                                                    helper.group_labels(stream),
+                                                                    helper.num_groups(stream),
+                                                                    precision,
+                                                                    stream,
+                                                                    mr));
+}
+
 }  // namespace detail
 
 // Sort-based groupby
@@ -245,6 +245,41 @@ std::unique_ptr<column> group_histogram(column_view const& values,
                                         rmm::cuda_stream_view stream,
                                         rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Internal API to collect the first `k` valid values of each group in sorted order.
+ *
+ * Groups with fewer than `k` valid values get all of them. Equal values keep their order in
+ * @p values.
+ *
+ * @code{.pseudo}
+ * values       = [3, 5, 4, 8, <NA>]
+ * group_labels = [0, 0, 0, 1, 1]
+ * valid_counts = [3, 1]
+ * group_top_k(k = 2, order::DESCENDING) = [[5, 4], [8]]
+ * @endcode
+ *
+ * @throws std::invalid_argument if `k` is negative
+ *
+ * @param values Grouped values to collect
+ * @param group_labels ID of group that the corresponding value belongs to
+ * @param group_offsets Offsets of groups' starting points within @p values
+ * @param valid_counts Number of valid values of each group
+ * @param num_groups Number of groups
+ * @param k Maximum number of values of each group
+ * @param column_order Order of the collected values
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ */
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_labels,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    cudf::device_span<size_type const> valid_counts,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order column_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr);
+
 /**
  * @brief Internal API to calculate sum of squares of differences from means.
  *
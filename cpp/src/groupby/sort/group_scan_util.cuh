@@ -23,10 +23,9 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/aggregation/aggregation.cuh>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
-#include <cudf/detail/structs/utilities.hpp>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/span.hpp>
@@ -36,6 +35,7 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -106,9 +106,7 @@ struct group_scan_functor<K, T, std::enable_if_t<is_group_scan_supported<K, T>()
 
     if (values.is_empty()) { return result; }
 
-    auto result_table = mutable_table_view({*result});
-    cudf::detail::initialize_with_identity(result_table, {K}, stream);
-
+    // The segmented scan writes every output row, so the result is not initialized first
     auto result_view = mutable_column_device_view::create(result->mutable_view(), stream);
     auto values_view = column_device_view::create(values, stream);
 
@@ -209,32 +207,33 @@ struct group_scan_functor<K,
                                   thrust::equal_to{},
                                   binop_generator.binop());
 
-    //
-    // Gather the children elements of the prefix min/max struct elements first.
+    // Gather the children elements of the prefix min/max struct elements. Null rows are mapped
+    // out of bounds so the gather nullifies them in the children, instead of pushing the null mask
+    // down into each child afterwards.
     //
     // Typically, we should use `get_sliced_child` for each child column to properly handle the
     // input if it is a sliced view. However, since the input to this function is just generated
     // from groupby internal APIs which is never a sliced view, we just use `child_begin` and
     // `child_end` iterators for simplicity.
+    auto const map_begin = cudf::detail::make_counting_transform_iterator(
+      0,
+      cuda::proclaim_return_type<size_type>(
+        [indices = gather_map.data(),
+         mask    = values.null_mask(),
+         offset  = values.offset(),
+         size    = values.size()] __device__(size_type idx) {
+          return mask == nullptr || bit_is_set(mask, offset + idx) ? indices[idx] : size;
+        }));
     auto scanned_children =
       cudf::detail::gather(
         table_view(std::vector<column_view>{values.child_begin(), values.child_end()}),
-        gather_map,
-        cudf::out_of_bounds_policy::DONT_CHECK,
-        cudf::detail::negative_index_policy::NOT_ALLOWED,
+        map_begin,
+        map_begin + values.size(),
+        cudf::out_of_bounds_policy::NULLIFY,
         stream,
         mr)
         ->release();
 
-    // After gathering the children elements, we need to push down nulls from the root structs
-    // column to them.
-    if (values.has_nulls()) {
-      for (std::unique_ptr<column>& child : scanned_children) {
-        child = structs::detail::superimpose_nulls(
-          values.null_mask(), values.null_count(), std::move(child), stream, mr);
-      }
-    }
-
     return make_structs_column(values.size(),
                                std::move(scanned_children),
                                values.null_count(),
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "groupby/sort/group_reductions.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace cudf {
+namespace groupby {
+namespace detail {
+std::unique_ptr<column> group_top_k(column_view const& values,
+                                    cudf::device_span<size_type const> group_labels,
+                                    cudf::device_span<size_type const> group_offsets,
+                                    cudf::device_span<size_type const> valid_counts,
+                                    size_type num_groups,
+                                    size_type k,
+                                    order column_order,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative", std::invalid_argument);
+  CUDF_EXPECTS(static_cast<size_t>(values.size()) == group_labels.size(),
+               "Size of values column should be same as that of group labels");
+
+  // Sort the values within each group, keeping the groups in place and their nulls last
+  auto const labels_view = column_view{data_type{type_to_id<size_type>()},
+                                       static_cast<size_type>(group_labels.size()),
+                                       group_labels.data(),
+                                       nullptr,
+                                       0};
+  auto const values_null_order =
+    column_order == order::ASCENDING ? null_order::AFTER : null_order::BEFORE;
+  auto const sorted_order =
+    cudf::detail::stable_sorted_order(table_view{{labels_view, values}},
+                                      {order::ASCENDING, column_order},
+                                      {null_order::AFTER, values_null_order},
+                                      stream,
+                                      rmm::mr::get_current_device_resource());
+
+  auto const sizes = thrust::make_transform_iterator(
+    valid_counts.begin(),
+    cuda::proclaim_return_type<size_type>(
+      [k] __device__(size_type count) { return count < k ? count : k; }));
+  auto [offsets_column, total_size] =
+    cudf::detail::make_offsets_child_column(sizes, sizes + num_groups, stream, mr);
+
+  // Entry j of the output taken from group g is the (j - out_offsets[g])-th sorted row of g
+  auto const gather_map = thrust::make_transform_iterator(
+    thrust::counting_iterator<size_type>(0),
+    cuda::proclaim_return_type<size_type>(
+      [d_out_offsets = offsets_column->view().begin<size_type>(),
+       d_group_offsets = group_offsets.data(),
+       d_sorted_order  = sorted_order->view().begin<size_type>(),
+       num_groups] __device__(size_type j) {
+        auto const group = static_cast<size_type>(
+          thrust::upper_bound(thrust::seq, d_out_offsets, d_out_offsets + num_groups, j) -
+          d_out_offsets - 1);
+        return d_sorted_order[d_group_offsets[group] + (j - d_out_offsets[group])];
+      }));
+  auto child = cudf::detail::gather(table_view{{values}},
+                                    gather_map,
+                                    gather_map + total_size,
+                                    out_of_bounds_policy::DONT_CHECK,
+                                    stream,
+                                    mr);
+
+  return make_lists_column(num_groups,
+                           std::move(offsets_column),
+                           std::move(child->release().front()),
+                           0,
+                           rmm::device_buffer{0, stream, mr},
+                           stream,
+                           mr);
+}
+}  // namespace detail
+}  // namespace groupby
+}  // namespace cudf
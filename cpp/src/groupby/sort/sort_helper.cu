@@ -30,14 +30,17 @@
 #include <cudf/detail/sorting.hpp>
 #include <cudf/strings/string_view.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
@@ -51,6 +54,57 @@ namespace cudf {
 namespace groupby {
 namespace detail {
 namespace sort {
+namespace {
+
+/**
+ * @brief Functor to identify the first row of each group of a sorted fixed-width column
+ *
+ * A row starts a group when it differs from the row before it. Nulls compare equal to each other
+ * and so do NaNs.
+ */
+template <typename T>
+struct is_group_start_fn {
+  column_device_view keys;
+
+  __device__ bool operator()(size_type i) const
+  {
+    if (i == 0) { return true; }
+    auto const prev_valid = keys.is_valid(i - 1);
+    auto const curr_valid = keys.is_valid(i);
+    if (not prev_valid or not curr_valid) { return prev_valid != curr_valid; }
+    return not cudf::equality_compare(keys.element<T>(i - 1), keys.element<T>(i));
+  }
+};
+
+/**
+ * @brief Type-dispatched functor computing the group offsets of a single sorted fixed-width key
+ * column by comparing each row directly with the row before it
+ */
+struct sorted_group_offsets_fn {
+  template <typename T, std::enable_if_t<cudf::is_fixed_width<T>()>* = nullptr>
+  size_type operator()(column_view const& keys,
+                       size_type* group_offsets,
+                       rmm::cuda_stream_view stream) const
+  {
+    auto const d_keys     = column_device_view::create(keys, stream);
+    auto const result_end = thrust::copy_if(rmm::exec_policy(stream),
+                                            thrust::counting_iterator<size_type>(0),
+                                            thrust::counting_iterator<size_type>(keys.size()),
+                                            group_offsets,
+                                            is_group_start_fn<T>{*d_keys});
+    return static_cast<size_type>(thrust::distance(group_offsets, result_end));
+  }
+
+  template <typename T,
+            typename... Args,
+            std::enable_if_t<not cudf::is_fixed_width<T>()>* = nullptr>
+  size_type operator()(Args&&...) const
+  {
+    CUDF_FAIL("Unsupported key type for the sorted group offsets");
+  }
+};
+
+}  // namespace
 
 sort_groupby_helper::sort_groupby_helper(table_view const& keys,
                                          null_policy include_null_keys,
@@ -143,6 +197,20 @@ sort_groupby_helper::index_vector const& sort_groupby_helper::group_offsets(
   // This way, a 2nd (parallel) call to this will not be given a partially created object.
   auto group_offsets = std::make_unique<index_vector>(size + 1, stream);
 
+  // A single pre-sorted fixed-width key column needs neither the sort order nor a row comparator:
+  // group starts are found by comparing adjacent elements directly.
+  if (_keys_pre_sorted == sorted::YES and _keys.num_columns() == 1 and
+      cudf::is_fixed_width(_keys.column(0).type())) {
+    auto const keys       = _keys.column(0);
+    auto const num_groups = cudf::type_dispatcher(
+      keys.type(), sorted_group_offsets_fn{}, keys, group_offsets->begin(), stream);
+    group_offsets->set_element_async(num_groups, size, stream);
+    group_offsets->resize(num_groups + 1, stream);
+
+    _group_offsets = std::move(group_offsets);
+    return *_group_offsets;
+  }
+
   auto const comparator = cudf::experimental::row::equality::self_comparator{_keys, stream};
 
   auto const sorted_order = key_sort_order(stream).data<size_type>();
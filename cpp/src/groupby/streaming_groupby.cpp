@@ -0,0 +1,408 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/structs/structs_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <memory>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace groupby {
+namespace {
+
+// Index of the M2 values in the (COUNT_VALID, MEAN, M2) structs of the partial M2 state
+constexpr size_type m2_child_index = 2;
+
+bool is_streaming_aggregation(aggregation::Kind kind)
+{
+  switch (kind) {
+    case aggregation::SUM:
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL:
+    case aggregation::MIN:
+    case aggregation::MAX:
+    case aggregation::M2:
+    case aggregation::TDIGEST:
+    case aggregation::HYPERLOGLOG:
+    case aggregation::COLLECT_LIST: return true;
+    default: return false;
+  }
+}
+
+std::unique_ptr<groupby_aggregation> clone_aggregation(groupby_aggregation const& agg)
+{
+  return std::unique_ptr<groupby_aggregation>(
+    dynamic_cast<groupby_aggregation*>(agg.clone().release()));
+}
+
+/**
+ * @brief Appends the aggregations computing the partial state of `agg` on a batch to `partials`
+ *
+ * The partial state of M2 is made of the COUNT_VALID, MEAN and M2 of each group.
+ */
+void append_partial_aggregations(groupby_aggregation const& agg,
+                                 std::vector<std::unique_ptr<groupby_aggregation>>& partials)
+{
+  if (agg.kind == aggregation::M2) {
+    partials.push_back(make_count_aggregation<groupby_aggregation>());
+    partials.push_back(make_mean_aggregation<groupby_aggregation>());
+    partials.push_back(make_m2_aggregation<groupby_aggregation>());
+  } else {
+    partials.push_back(clone_aggregation(agg));
+  }
+}
+
+/**
+ * @brief Returns the aggregation merging partial states of `agg`
+ */
+std::unique_ptr<groupby_aggregation> make_merge_aggregation(groupby_aggregation const& agg)
+{
+  switch (agg.kind) {
+    case aggregation::COUNT_VALID:
+    case aggregation::COUNT_ALL: return make_sum_aggregation<groupby_aggregation>();
+    case aggregation::M2: return make_merge_m2_aggregation<groupby_aggregation>();
+    case aggregation::TDIGEST:
+      return make_merge_tdigest_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::tdigest_aggregation const&>(agg).max_centroids);
+    case aggregation::HYPERLOGLOG:
+      return make_merge_hyperloglog_aggregation<groupby_aggregation>(
+        dynamic_cast<cudf::detail::hyperloglog_aggregation const&>(agg).precision);
+    case aggregation::COLLECT_LIST: return make_merge_lists_aggregation<groupby_aggregation>();
+    default: return clone_aggregation(agg);
+  }
+}
+
+using partial_states      = std::vector<std::vector<std::unique_ptr<column>>>;
+using partial_state_views = std::vector<std::vector<column_view>>;
+
+partial_state_views views_of(partial_states const& partials)
+{
+  partial_state_views views;
+  for (auto const& columns : partials) {
+    auto& column_views = views.emplace_back();
+    std::transform(columns.begin(),
+                   columns.end(),
+                   std::back_inserter(column_views),
+                   [](auto const& col) { return col->view(); });
+  }
+  return views;
+}
+
+/**
+ * @brief Merges the partial state of the groups `other_keys` into the state `keys`, `partials`
+ *
+ * The two states are concatenated and grouped again, so that the partial states of the groups
+ * found in both are merged by the merge aggregation of each aggregation.
+ */
+void merge_states(host_span<std::vector<std::unique_ptr<groupby_aggregation>> const> aggregations,
+                  null_policy include_null_keys,
+                  table_view const& other_keys,
+                  partial_state_views const& other_partials,
+                  std::unique_ptr<table>& keys,
+                  partial_states& partials,
+                  rmm::cuda_stream_view stream)
+{
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+
+  auto const merged_keys =
+    cudf::concatenate(std::vector<table_view>{keys->view(), other_keys}, stream, temp_mr);
+  std::vector<std::unique_ptr<column>> merge_values;
+  for (std::size_t i = 0; i < aggregations.size(); ++i) {
+    for (std::size_t j = 0; j < aggregations[i].size(); ++j) {
+      merge_values.push_back(cudf::concatenate(
+        std::vector<column_view>{partials[i][j]->view(), other_partials[i][j]}, stream, temp_mr));
+    }
+  }
+  // A request is made per partial state column, since the state columns differ in type
+  std::vector<aggregation_request> state_requests;
+  for (std::size_t i = 0, c = 0; i < aggregations.size(); ++i) {
+    for (std::size_t j = 0; j < aggregations[i].size(); ++j, ++c) {
+      auto& request  = state_requests.emplace_back();
+      request.values = merge_values[c]->view();
+      request.aggregations.push_back(make_merge_aggregation(*aggregations[i][j]));
+    }
+  }
+  auto [state_keys, state_results] =
+    groupby{merged_keys->view(), include_null_keys}.aggregate(state_requests, stream, temp_mr);
+
+  for (std::size_t i = 0, c = 0; i < aggregations.size(); ++i) {
+    for (std::size_t j = 0; j < aggregations[i].size(); ++j, ++c) {
+      auto merged = std::move(state_results[c].results.front());
+      // The counts are merged with a SUM, which widens them
+      auto const kind = aggregations[i][j]->kind;
+      if (kind == aggregation::COUNT_VALID or kind == aggregation::COUNT_ALL) {
+        merged = cudf::cast(merged->view(), data_type{type_to_id<size_type>()}, stream, temp_mr);
+      }
+      partials[i][j] = std::move(merged);
+    }
+  }
+  keys = std::move(state_keys);
+}
+
+}  // namespace
+
+streaming_groupby::~streaming_groupby() = default;
+
+streaming_groupby::streaming_groupby(
+  host_span<std::vector<std::unique_ptr<groupby_aggregation>> const> aggregations,
+  null_policy include_null_keys)
+  : _include_null_keys{include_null_keys}
+{
+  for (auto const& aggs : aggregations) {
+    auto& cloned = _aggregations.emplace_back();
+    for (auto const& agg : aggs) {
+      CUDF_EXPECTS(is_streaming_aggregation(agg->kind),
+                   "Unsupported streaming groupby aggregation",
+                   std::invalid_argument);
+      cloned.push_back(clone_aggregation(*agg));
+    }
+  }
+}
+
+void streaming_groupby::aggregate(table_view const& keys,
+                                  host_span<column_view const> values,
+                                  rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(values.size() == _aggregations.size(),
+               "Number of value columns must match the number of aggregation lists",
+               std::invalid_argument);
+  CUDF_EXPECTS(std::all_of(values.begin(),
+                           values.end(),
+                           [&](auto const& col) { return col.size() == keys.num_rows(); }),
+               "Size mismatch between request values and groupby keys.",
+               std::invalid_argument);
+  CUDF_EXPECTS(_keys == nullptr or cudf::have_same_types(keys, _keys->view()),
+               "Mismatch between the keys types of the batches",
+               cudf::data_type_error);
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+
+  // Aggregate the partial state of the batch
+  std::vector<aggregation_request> requests(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    requests[i].values = values[i];
+    for (auto const& agg : _aggregations[i]) {
+      append_partial_aggregations(*agg, requests[i].aggregations);
+    }
+  }
+  auto [batch_keys, batch_results] =
+    groupby{keys, _include_null_keys}.aggregate(requests, stream, temp_mr);
+
+  std::vector<std::vector<std::unique_ptr<column>>> batch_partials(values.size());
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    auto& results = batch_results[i].results;
+    for (std::size_t j = 0, r = 0; j < _aggregations[i].size(); ++j) {
+      if (_aggregations[i][j]->kind == aggregation::M2) {
+        auto const num_groups = results[r]->size();
+        std::vector<std::unique_ptr<column>> children;
+        std::move(results.begin() + r, results.begin() + r + 3, std::back_inserter(children));
+        batch_partials[i].push_back(make_structs_column(
+          num_groups, std::move(children), 0, rmm::device_buffer{}, stream, temp_mr));
+        r += 3;
+      } else {
+        batch_partials[i].push_back(std::move(results[r++]));
+      }
+    }
+  }
+
+  if (_keys == nullptr) {
+    _keys     = std::move(batch_keys);
+    _partials = std::move(batch_partials);
+    return;
+  }
+
+  // Merge the partial state of the batch into the state of the previous batches
+  merge_states(_aggregations,
+               _include_null_keys,
+               batch_keys->view(),
+               views_of(batch_partials),
+               _keys,
+               _partials,
+               stream);
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> streaming_groupby::results(
+  rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(_keys != nullptr or not _spilled.empty(), "No batch has been aggregated");
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+
+  // The spilled states are merged one at a time with the state on device into a new state
+  std::unique_ptr<table> merged_keys;
+  partial_states merged_partials;
+  auto const merge = [&](table_view const& keys, partial_state_views const& partials) {
+    if (merged_keys != nullptr) {
+      merge_states(
+        _aggregations, _include_null_keys, keys, partials, merged_keys, merged_partials, stream);
+      return;
+    }
+    merged_keys = std::make_unique<table>(keys, stream, temp_mr);
+    for (auto const& columns : partials) {
+      auto& merged_columns = merged_partials.emplace_back();
+      for (auto const& col : columns) {
+        merged_columns.push_back(std::make_unique<column>(col, stream, temp_mr));
+      }
+    }
+  };
+  if (not _spilled.empty()) {
+    auto const num_partials = std::accumulate(
+      _aggregations.begin(), _aggregations.end(), size_type{0}, [](auto acc, auto const& aggs) {
+        return acc + static_cast<size_type>(aggs.size());
+      });
+    for (auto const& spilled : _spilled) {
+      auto const d_data =
+        rmm::device_buffer(spilled.data.data(), spilled.data.size(), stream, temp_mr);
+      auto const state =
+        cudf::unpack(spilled.metadata.data(), static_cast<uint8_t const*>(d_data.data()));
+      auto const num_keys = state.num_columns() - num_partials;
+      partial_state_views partials;
+      auto c = num_keys;
+      for (auto const& aggs : _aggregations) {
+        auto& columns = partials.emplace_back();
+        for (std::size_t j = 0; j < aggs.size(); ++j) {
+          columns.push_back(state.column(c++));
+        }
+      }
+      auto const keys =
+        state.select(thrust::make_counting_iterator(0), thrust::make_counting_iterator(num_keys));
+      merge(keys, partials);
+    }
+    if (_keys != nullptr) { merge(_keys->view(), views_of(_partials)); }
+  }
+  auto const& keys     = merged_keys != nullptr ? *merged_keys : *_keys;
+  auto const& partials = merged_keys != nullptr ? merged_partials : _partials;
+
+  std::vector<aggregation_result> results(_aggregations.size());
+  for (std::size_t i = 0; i < _aggregations.size(); ++i) {
+    for (std::size_t j = 0; j < _aggregations[i].size(); ++j) {
+      auto const partial = partials[i][j]->view();
+      auto const result =
+        _aggregations[i][j]->kind == aggregation::M2
+          ? structs_column_view{partial}.get_sliced_child(m2_child_index, stream)
+          : partial;
+      results[i].results.push_back(std::make_unique<column>(result, stream, mr));
+    }
+  }
+  return std::pair(std::make_unique<table>(keys.view(), stream, mr), std::move(results));
+}
+
+size_type streaming_groupby::num_groups() const
+{
+  return _keys != nullptr ? _keys->num_rows() : 0;
+}
+
+void streaming_groupby::spill(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  if (_keys == nullptr) { return; }
+
+  // The keys are followed by the partial states in the order of the aggregations
+  std::vector<column_view> state(_keys->view().begin(), _keys->view().end());
+  for (auto const& columns : _partials) {
+    std::transform(columns.begin(), columns.end(), std::back_inserter(state), [](auto const& col) {
+      return col->view();
+    });
+  }
+  auto packed =
+    cudf::detail::pack(table_view{state}, stream, rmm::mr::get_current_device_resource());
+
+  auto& spilled    = _spilled.emplace_back();
+  spilled.metadata = std::move(*packed.metadata);
+  spilled.data.resize(packed.gpu_data->size());
+  CUDF_CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                                packed.gpu_data->data(),
+                                spilled.data.size(),
+                                cudaMemcpyDefault,
+                                stream.value()));
+  stream.synchronize();
+
+  _keys.reset();
+  _partials.clear();
+}
+
+std::pair<std::unique_ptr<table>, std::vector<aggregation_result>> aggregate_chunked_parquet(
+  io::chunked_parquet_reader& reader,
+  host_span<size_type const> key_indices,
+  host_span<size_type const> value_indices,
+  host_span<std::vector<std::unique_ptr<groupby_aggregation>> const> aggregations,
+  null_policy include_null_keys,
+  size_type max_device_groups,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(value_indices.size() == aggregations.size(),
+               "Number of value columns must match the number of aggregation lists",
+               std::invalid_argument);
+
+  streaming_groupby streaming(aggregations, include_null_keys);
+  auto chunk = reader.read_chunk();
+  while (true) {
+    // Decode the next chunk while the current one is aggregated
+    std::future<io::table_with_metadata> next;
+    if (reader.has_next()) {
+      next = std::async(std::launch::async, [&reader] { return reader.read_chunk(); });
+    }
+
+    auto const tbl = chunk.tbl->view();
+    std::vector<column_view> values;
+    std::transform(value_indices.begin(),
+                   value_indices.end(),
+                   std::back_inserter(values),
+                   [&tbl](auto index) { return tbl.column(index); });
+    streaming.aggregate(tbl.select(key_indices.begin(), key_indices.end()), values, stream);
+    if (streaming.num_groups() > max_device_groups) { streaming.spill(stream); }
+
+    if (not next.valid()) { break; }
+    chunk = next.get();
+  }
+  return streaming.results(stream, mr);
+}
+
+}  // namespace groupby
+}  // namespace cudf
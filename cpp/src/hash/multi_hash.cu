@@ -0,0 +1,291 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "md5_hash.cuh"
+#include "xxhash_64.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/constant_iterator.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+namespace {
+
+constexpr int block_size = 128;
+// Strings up to this size are copied into shared memory so each hash function
+// reads the bytes from there instead of from global memory
+constexpr size_type staging_size = 64;
+// Digest size of MD5 in bytes
+constexpr size_type md5_digest_size = 32;
+
+/**
+ * @brief Running hash values of a single row
+ */
+struct row_hashes {
+  hash_value_type murmur;  ///< MurmurHash3_x86_32 value combined over the columns so far
+  uint64_t xxhash;         ///< XXHash_64 value which also seeds the next column
+  MD5Hasher* md5;          ///< MD5 state or nullptr if not requested
+};
+
+/**
+ * @brief Passes a single element to each requested hash function
+ *
+ * @tparam Nullate A cudf::nullate type describing whether to check for nulls
+ */
+template <typename Nullate>
+struct multi_element_hasher {
+  Nullate const check_nulls;
+  uint32_t const murmur_seed;
+  bool const do_murmur;
+  bool const do_xxhash;
+  char* staging;  ///< This thread's slice of the shared memory staging buffer
+
+  template <typename T>
+  __device__ T stage(T const& element) const
+  {
+    if constexpr (std::is_same_v<T, string_view>) {
+      auto const size = element.size_bytes();
+      if (size > staging_size) { return element; }
+      auto const data = element.data();
+      for (size_type i = 0; i < size; ++i) {
+        staging[i] = data[i];
+      }
+      return string_view(staging, size);
+    } else {
+      return element;
+    }
+  }
+
+  template <typename T>
+  __device__ void operator()(column_device_view const& col,
+                             size_type row_index,
+                             row_hashes& hashes) const
+  {
+    if constexpr (is_fixed_width<T>() || std::is_same_v<T, string_view>) {
+      if (check_nulls && col.is_null(row_index)) {
+        // same null handling as the individual APIs; md5 skips null elements
+        if (do_murmur) {
+          hashes.murmur =
+            hash_combine(hashes.murmur, std::numeric_limits<hash_value_type>::max());
+        }
+        if (do_xxhash) { hashes.xxhash = std::numeric_limits<uint64_t>::max(); }
+        return;
+      }
+      auto const element = stage(col.element<T>(row_index));
+      if (do_murmur) {
+        hashes.murmur = hash_combine(hashes.murmur, MurmurHash3_x86_32<T>{murmur_seed}(element));
+      }
+      if (do_xxhash) { hashes.xxhash = XXHash_64<T>{hashes.xxhash}(element); }
+      if constexpr (!is_chrono<T>()) {
+        if (hashes.md5 != nullptr) { hashes.md5->process(element); }
+      }
+    } else {
+      (void)col;
+      (void)row_index;
+      (void)hashes;
+      CUDF_UNREACHABLE("Unsupported type for multi_hash");
+    }
+  }
+};
+
+/**
+ * @brief Computes the requested hash values of each row with one thread per row
+ *
+ * Each element is read once and passed to all the requested hash functions.
+ * A nullptr output indicates the corresponding hash was not requested.
+ */
+template <typename Nullate>
+CUDF_KERNEL void multi_hash_kernel(table_device_view const input,
+                                   Nullate check_nulls,
+                                   uint32_t murmur_seed,
+                                   uint64_t xxhash_seed,
+                                   hash_value_type* d_murmur,
+                                   uint64_t* d_xxhash,
+                                   char* d_md5)
+{
+  __shared__ char staging[block_size * staging_size];
+
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx >= input.num_rows()) { return; }
+  auto const row_index = static_cast<size_type>(idx);
+
+  auto const hasher = multi_element_hasher<Nullate>{check_nulls,
+                                                    murmur_seed,
+                                                    d_murmur != nullptr,
+                                                    d_xxhash != nullptr,
+                                                    staging + (threadIdx.x * staging_size)};
+
+  auto hash_row = [&](MD5Hasher* md5) {
+    auto hashes = row_hashes{murmur_seed, xxhash_seed, md5};
+    for (auto const& col : input) {
+      cudf::type_dispatcher<dispatch_storage_type>(col.type(), hasher, col, row_index, hashes);
+    }
+    if (d_murmur != nullptr) { d_murmur[row_index] = hashes.murmur; }
+    if (d_xxhash != nullptr) { d_xxhash[row_index] = hashes.xxhash; }
+  };
+
+  if (d_md5 != nullptr) {
+    // the digest is written when the hasher goes out of scope
+    MD5Hasher md5(d_md5 + (static_cast<int64_t>(row_index) * md5_digest_size));
+    hash_row(&md5);
+  } else {
+    hash_row(nullptr);
+  }
+}
+
+std::unique_ptr<column> hash_single(table_view const& input,
+                                    hash_function_id hash_id,
+                                    uint64_t seed,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  switch (hash_id) {
+    case hash_function_id::MURMURHASH3_X86_32:
+      return murmurhash3_x86_32(input, static_cast<uint32_t>(seed), stream, mr);
+    case hash_function_id::XXHASH_64: return xxhash_64(input, seed, stream, mr);
+    case hash_function_id::MD5: return md5(input, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function for multi_hash");
+  }
+}
+
+bool is_single_pass_type(data_type type)
+{
+  return is_fixed_width(type) || type.id() == type_id::STRING;
+}
+
+}  // namespace
+
+std::unique_ptr<table> multi_hash(table_view const& input,
+                                  std::vector<hash_function_id> const& hash_ids,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  auto const requested = [&hash_ids](hash_function_id id) {
+    return std::find(hash_ids.begin(), hash_ids.end(), id) != hash_ids.end();
+  };
+  auto const do_murmur = requested(hash_function_id::MURMURHASH3_X86_32);
+  auto const do_xxhash = requested(hash_function_id::XXHASH_64);
+  auto const do_md5    = requested(hash_function_id::MD5);
+
+  auto const single_pass =
+    input.num_rows() > 0 && input.num_columns() > 0 &&
+    std::all_of(input.begin(),
+                input.end(),
+                [do_md5](auto const& col) {
+                  return is_single_pass_type(col.type()) && !(do_md5 && is_chrono(col.type()));
+                }) &&
+    (do_murmur || do_xxhash || do_md5);
+
+  std::vector<std::unique_ptr<column>> results;
+  if (!single_pass) {
+    // nested types and empty tables are handled by the individual APIs
+    std::transform(
+      hash_ids.begin(), hash_ids.end(), std::back_inserter(results), [&](auto hash_id) {
+        return hash_single(input, hash_id, seed, stream, mr);
+      });
+    return std::make_unique<table>(std::move(results));
+  }
+
+  auto const num_rows = input.num_rows();
+
+  auto make_output = [&](bool requested, data_type type) -> std::unique_ptr<column> {
+    if (!requested) { return nullptr; }
+    return make_numeric_column(type, num_rows, mask_state::UNALLOCATED, stream, mr);
+  };
+  auto murmur = make_output(do_murmur, data_type(type_to_id<hash_value_type>()));
+  auto xxhash = make_output(do_xxhash, data_type(type_id::UINT64));
+
+  std::unique_ptr<column> md5_offsets;
+  auto md5_chars = rmm::device_uvector<char>(0, stream, mr);
+  if (do_md5) {
+    auto begin = thrust::make_constant_iterator(md5_digest_size);
+    auto [offsets_column, bytes] =
+      cudf::strings::detail::make_offsets_child_column(begin, begin + num_rows, stream, mr);
+    md5_offsets = std::move(offsets_column);
+    md5_chars   = rmm::device_uvector<char>(bytes, stream, mr);
+  }
+
+  auto const d_input  = table_device_view::create(input, stream);
+  auto const d_murmur = do_murmur ? murmur->mutable_view().data<hash_value_type>() : nullptr;
+  auto const d_xxhash = do_xxhash ? xxhash->mutable_view().data<uint64_t>() : nullptr;
+  auto const d_md5    = do_md5 ? md5_chars.data() : nullptr;
+
+  cudf::detail::grid_1d grid{num_rows, block_size};
+  multi_hash_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    *d_input,
+    nullate::DYNAMIC{has_nulls(input)},
+    static_cast<uint32_t>(seed),
+    seed,
+    d_murmur,
+    d_xxhash,
+    d_md5);
+
+  auto md5_result =
+    do_md5 ? make_strings_column(num_rows, std::move(md5_offsets), md5_chars.release(), 0, {})
+           : nullptr;
+
+  // each computed column is moved into the first entry requesting it and copied for any others
+  for (auto const hash_id : hash_ids) {
+    auto& computed = hash_id == hash_function_id::MURMURHASH3_X86_32 ? murmur
+                     : hash_id == hash_function_id::XXHASH_64         ? xxhash
+                                                                      : md5_result;
+    if (computed) {
+      results.emplace_back(std::move(computed));
+      continue;
+    }
+    auto const first = std::find(hash_ids.begin(), hash_ids.end(), hash_id);
+    auto const& col  = results[std::distance(hash_ids.begin(), first)];
+    results.emplace_back(std::make_unique<column>(col->view(), stream, mr));
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
+}  // namespace detail
+
+std::unique_ptr<table> multi_hash(table_view const& input,
+                                  std::vector<hash_function_id> const& hash_ids,
+                                  uint64_t seed,
+                                  rmm::cuda_stream_view stream,
+                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::multi_hash(input, hash_ids, seed, stream, mr);
+}
+
+}  // namespace hashing
+}  // namespace cudf
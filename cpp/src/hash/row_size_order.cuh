@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+
+namespace cudf {
+namespace hashing {
+namespace detail {
+
+/**
+ * @brief Rows with more string bytes than this are hashed in order of their size
+ */
+constexpr int64_t long_row_threshold = 256;
+
+/**
+ * @brief Returns the total number of bytes of the valid strings in a row
+ */
+struct row_string_bytes_fn {
+  table_device_view const d_input;
+
+  __device__ int64_t operator()(size_type row_index) const
+  {
+    int64_t bytes = 0;
+    for (auto const& col : d_input) {
+      if (col.type().id() == type_id::STRING && col.is_valid(row_index)) {
+        bytes += col.element<string_view>(row_index).size_bytes();
+      }
+    }
+    return bytes;
+  }
+};
+
+/**
+ * @brief Calls `fn` with each row index of the input using one thread per row
+ *
+ * The digest hash functions process the bytes of a row serially so the threads of
+ * a warp diverge when their rows have very different lengths. If any row has more
+ * than `long_row_threshold` string bytes, the row indices are assigned to threads in
+ * order of their string size so each warp hashes rows of similar length.
+ *
+ * @param input Table to hash
+ * @param d_input Device view of `input`
+ * @param fn Device callable accepting a row index
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+template <typename RowFn>
+void for_each_row_by_size(table_view const& input,
+                          table_device_view const& d_input,
+                          RowFn fn,
+                          rmm::cuda_stream_view stream)
+{
+  auto const num_rows    = input.num_rows();
+  auto const has_strings = std::any_of(
+    input.begin(), input.end(), [](auto const& col) { return col.type().id() == type_id::STRING; });
+
+  if (has_strings) {
+    rmm::device_uvector<int64_t> row_bytes(num_rows, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(num_rows),
+                      row_bytes.begin(),
+                      row_string_bytes_fn{d_input});
+    auto const has_long_rows =
+      thrust::any_of(rmm::exec_policy(stream),
+                     row_bytes.begin(),
+                     row_bytes.end(),
+                     [] __device__(int64_t bytes) { return bytes > long_row_threshold; });
+    if (has_long_rows) {
+      rmm::device_uvector<size_type> row_order(num_rows, stream);
+      thrust::sequence(rmm::exec_policy_nosync(stream), row_order.begin(), row_order.end());
+      thrust::sort_by_key(
+        rmm::exec_policy_nosync(stream), row_bytes.begin(), row_bytes.end(), row_order.begin());
+      thrust::for_each(rmm::exec_policy(stream), row_order.begin(), row_order.end(), fn);
+      return;
+    }
+  }
+
+  thrust::for_each(rmm::exec_policy(stream),
+                   thrust::counting_iterator<size_type>(0),
+                   thrust::counting_iterator<size_type>(num_rows),
+                   fn);
+}
+
+}  // namespace detail
+}  // namespace hashing
+}  // namespace cudf
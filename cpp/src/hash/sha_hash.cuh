@@ -13,6 +13,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "row_size_order.cuh"
+
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -526,11 +528,10 @@ std::unique_ptr<column> sha_hash(table_view const& input,
   auto const device_input = table_device_view::create(input, stream);
 
   // Hash each row, hashing each element sequentially left to right
-  thrust::for_each(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator(0),
-    thrust::make_counting_iterator(input.num_rows()),
-    [d_chars, device_input = *device_input] __device__(auto row_index) {
+  for_each_row_by_size(
+    input,
+    *device_input,
+    [d_chars, device_input = *device_input] __device__(size_type row_index) {
       Hasher hasher(d_chars + (static_cast<int64_t>(row_index) * Hasher::digest_size));
       for (auto const& col : device_input) {
         if (col.is_valid(row_index)) {
@@ -539,7 +540,8 @@ std::unique_ptr<column> sha_hash(table_view const& input,
         }
       }
       hasher.finalize();
-    });
+    },
+    stream);
 
   return make_strings_column(input.num_rows(), std::move(offsets_column), chars.release(), 0, {});
 }
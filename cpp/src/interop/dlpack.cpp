@@ -16,6 +16,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/interop.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/reshape.hpp>
 #include <cudf/lists/list_view.hpp>
 #include <cudf/structs/struct_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -24,12 +25,16 @@
 #include <cudf/utilities/type_checks.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
+#include <rmm/aligned.hpp>
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <dlpack/dlpack.h>
 
 #include <algorithm>
+#include <memory>
+#include <utility>
 
 namespace cudf {
 namespace {
@@ -130,6 +135,55 @@ struct dltensor_context {
   }
 };
 
+/**
+ * @brief Wraps `buffer` into a managed 1D or 2D tensor that takes ownership of it
+ *
+ * @param row_stride Number of elements between consecutive rows of a 2D tensor
+ * @param column_stride Number of elements between consecutive columns of a 2D tensor
+ */
+DLManagedTensor* make_managed_tensor(data_type type,
+                                     size_type num_rows,
+                                     size_type num_cols,
+                                     int64_t row_stride,
+                                     int64_t column_stride,
+                                     rmm::device_buffer&& buffer)
+{
+  auto managed_tensor = std::make_unique<DLManagedTensor>();
+  auto context        = std::make_unique<dltensor_context>();
+
+  DLTensor& tensor = managed_tensor->dl_tensor;
+  tensor.dtype     = data_type_to_DLDataType(type);
+
+  tensor.ndim     = (num_cols > 1) ? 2 : 1;
+  tensor.shape    = context->shape;
+  tensor.shape[0] = num_rows;
+  if (tensor.ndim > 1) {
+    tensor.shape[1]   = num_cols;
+    tensor.strides    = context->strides;
+    tensor.strides[0] = num_rows > 1 ? row_stride : 0;
+    tensor.strides[1] = column_stride;
+  }
+
+  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
+  tensor.device.device_type = kDLCUDA;
+
+  context->buffer = std::move(buffer);
+  tensor.data     = context->buffer.data();
+
+  // Defer ownership of managed tensor to caller
+  managed_tensor->deleter     = dltensor_context::deleter;
+  managed_tensor->manager_ctx = context.release();
+  return managed_tensor.release();
+}
+
+// Distance in bytes between the columns of a strided table, which keeps each column aligned as if
+// it was allocated separately
+std::size_t strided_column_bytes(data_type type, size_type num_rows)
+{
+  return rmm::align_up(static_cast<std::size_t>(num_rows) * size_of(type),
+                       rmm::CUDA_ALLOCATION_ALIGNMENT);
+}
+
 }  // namespace
 
 namespace detail {
@@ -220,6 +274,7 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
 }
 
 DLManagedTensor* to_dlpack(table_view const& input,
+                           dlpack_layout layout,
                            rmm::cuda_stream_view stream,
                            rmm::device_async_resource_ref mr)
 {
@@ -228,8 +283,8 @@ DLManagedTensor* to_dlpack(table_view const& input,
   if (num_rows == 0 && num_cols == 0) { return nullptr; }
 
   // Ensure that type is convertible to DLDataType
-  data_type const type    = input.column(0).type();
-  DLDataType const dltype = data_type_to_DLDataType(type);
+  data_type const type = input.column(0).type();
+  data_type_to_DLDataType(type);
 
   // Ensure all columns are the same type
   CUDF_EXPECTS(cudf::all_have_same_types(input.begin(), input.end()),
@@ -241,41 +296,28 @@ DLManagedTensor* to_dlpack(table_view const& input,
     std::none_of(input.begin(), input.end(), [](auto const& col) { return col.has_nulls(); }),
     "Input required to have null count zero");
 
-  auto managed_tensor = std::make_unique<DLManagedTensor>();
-  auto context        = std::make_unique<dltensor_context>();
-
-  DLTensor& tensor = managed_tensor->dl_tensor;
-  tensor.dtype     = dltype;
-
-  tensor.ndim     = (num_cols > 1) ? 2 : 1;
-  tensor.shape    = context->shape;
-  tensor.shape[0] = num_rows;
-  if (tensor.ndim > 1) {
-    tensor.shape[1]   = num_cols;
-    tensor.strides    = context->strides;
-    tensor.strides[0] = num_rows > 1 ? 1 : 0;
-    tensor.strides[1] = num_rows;
-  }
-
-  CUDF_CUDA_TRY(cudaGetDevice(&tensor.device.device_id));
-  tensor.device.device_type = kDLCUDA;
-
   // If there is only one column, then a 1D tensor can just copy the pointer
   // to the data in the column, and the deleter should not delete the original
   // data. However, this is inconsistent with the 2D cases where we must do a
   // copy of each column's data into the dense tensor array. Also, if we don't
   // copy, then the original column data could be changed, which would change
   // the contents of the tensor, which might be surprising or cause issues.
-  // Therefore, for now we ALWAYS do a copy of the data. If this becomes
-  // a performance issue we can reevaluate in the future.
+  // Therefore, for now we ALWAYS do a copy of the data. Tables allocated with
+  // `make_strided_table` can be exported without a copy instead.
+
+  if (layout == dlpack_layout::ROW_MAJOR and num_cols > 1) {
+    // Interleaving the columns lays out the elements of each row contiguously
+    auto interleaved = detail::interleave_columns(input, stream, mr)->release();
+    stream.synchronize();
+    return make_managed_tensor(
+      type, num_rows, num_cols, num_cols, 1, std::move(*interleaved.data));
+  }
 
   size_t const stride_bytes = num_rows * size_of(type);
   size_t const total_bytes  = stride_bytes * num_cols;
 
-  context->buffer = rmm::device_buffer(total_bytes, stream, mr);
-  tensor.data     = context->buffer.data();
-
-  auto tensor_data = reinterpret_cast<uintptr_t>(tensor.data);
+  auto buffer      = rmm::device_buffer(total_bytes, stream, mr);
+  auto tensor_data = reinterpret_cast<uintptr_t>(buffer.data());
   for (auto const& col : input) {
     CUDF_CUDA_TRY(cudaMemcpyAsync(reinterpret_cast<void*>(tensor_data),
                                   get_column_data(col),
@@ -285,16 +327,68 @@ DLManagedTensor* to_dlpack(table_view const& input,
     tensor_data += stride_bytes;
   }
 
-  // Defer ownership of managed tensor to caller
-  managed_tensor->deleter     = dltensor_context::deleter;
-  managed_tensor->manager_ctx = context.release();
-
   // synchronize the stream because after the return the data may be accessed from the host before
   // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
   // memory is used).
   stream.synchronize();
 
-  return managed_tensor.release();
+  return make_managed_tensor(type, num_rows, num_cols, 1, num_rows, std::move(buffer));
+}
+
+strided_table make_strided_table(data_type type,
+                                 size_type num_rows,
+                                 size_type num_columns,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    num_rows >= 0 and num_columns >= 0, "Invalid strided table size", std::invalid_argument);
+  // Ensure that type is convertible to DLDataType
+  data_type_to_DLDataType(type);
+
+  auto const column_bytes = strided_column_bytes(type, num_rows);
+  auto data = std::make_unique<rmm::device_buffer>(column_bytes * num_columns, stream, mr);
+
+  std::vector<mutable_column_view> columns;
+  columns.reserve(num_columns);
+  for (size_type i = 0; i < num_columns; ++i) {
+    columns.emplace_back(
+      type, num_rows, static_cast<char*>(data->data()) + i * column_bytes, nullptr, 0);
+  }
+  return strided_table{mutable_table_view{columns}, std::move(data)};
+}
+
+DLManagedTensor* to_dlpack(strided_table&& input, rmm::cuda_stream_view stream)
+{
+  auto const& table   = input.table;
+  auto const num_rows = table.num_rows();
+  auto const num_cols = table.num_columns();
+  if (num_rows == 0 && num_cols == 0) { return nullptr; }
+
+  CUDF_EXPECTS(input.data != nullptr, "Strided table has no data");
+  data_type const type    = table.column(0).type();
+  auto const column_bytes = strided_column_bytes(type, num_rows);
+
+  // The views must still be the columns carved from the buffer by `make_strided_table`
+  for (size_type i = 0; i < num_cols; ++i) {
+    auto const& col = table.column(i);
+    CUDF_EXPECTS(col.type() == type and col.offset() == 0 and not col.nullable() and
+                   col.head() == static_cast<char const*>(input.data->data()) + i * column_bytes,
+                 "Strided table columns must be the views created by make_strided_table");
+  }
+
+  // Writes to the columns must be complete before the tensor is accessed
+  stream.synchronize();
+
+  auto buffer = std::move(*input.data);
+  input.data.reset();
+  input.table = mutable_table_view{};
+  return make_managed_tensor(type,
+                             num_rows,
+                             num_cols,
+                             1,
+                             static_cast<int64_t>(column_bytes / size_of(type)),
+                             std::move(buffer));
 }
 
 }  // namespace detail
@@ -309,7 +403,31 @@ std::unique_ptr<table> from_dlpack(DLManagedTensor const* managed_tensor,
 DLManagedTensor* to_dlpack(table_view const& input, rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
-  return detail::to_dlpack(input, cudf::get_default_stream(), mr);
+  return detail::to_dlpack(input, dlpack_layout::COLUMN_MAJOR, cudf::get_default_stream(), mr);
+}
+
+DLManagedTensor* to_dlpack(table_view const& input,
+                           dlpack_layout layout,
+                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack(input, layout, cudf::get_default_stream(), mr);
+}
+
+strided_table make_strided_table(data_type type,
+                                 size_type num_rows,
+                                 size_type num_columns,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::make_strided_table(type, num_rows, num_columns, stream, mr);
+}
+
+DLManagedTensor* to_dlpack(strided_table&& input)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_dlpack(std::move(input), cudf::get_default_stream());
 }
 
 }  // namespace cudf
@@ -111,24 +111,30 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<bool>(ArrowSchemaView* s
       {});
   }
 
+  // only the data bitmap is converted to bytes, the validity bitmap is used as is
+  // unless the array is sliced since the converted data starts at the slice offset
   auto out_col = mask_to_bools(
     reinterpret_cast<bitmask_type const*>(input->buffers[fixed_width_data_buffer_idx]),
     input->offset,
     input->offset + input->length,
     stream,
     mr);
-  auto const has_nulls = skip_mask ? false : input->buffers[validity_buffer_idx] != nullptr;
-  if (has_nulls) {
+  auto const null_mask =
+    skip_mask ? nullptr
+              : reinterpret_cast<bitmask_type const*>(input->buffers[validity_buffer_idx]);
+  if (null_mask != nullptr && input->offset != 0) {
     auto out_mask = cudf::detail::copy_bitmask(
-      reinterpret_cast<bitmask_type const*>(input->buffers[validity_buffer_idx]),
-      input->offset,
-      input->offset + input->length,
-      stream,
-      mr);
+      null_mask, input->offset, input->offset + input->length, stream, mr);
     out_col->set_null_mask(std::move(out_mask), input->null_count);
   }
 
-  auto out_view = out_col->view();
+  auto out_view = (null_mask != nullptr && input->offset == 0)
+                    ? column_view{type,
+                                  out_col->size(),
+                                  out_col->view().head(),
+                                  null_mask,
+                                  static_cast<size_type>(input->null_count)}
+                    : out_col->view();
   owned_columns_t owned;
   owned.emplace_back(std::move(out_col));
   return std::make_tuple<column_view, owned_columns_t>(std::move(out_view), std::move(owned));
@@ -154,7 +160,11 @@ dispatch_tuple_t dispatch_from_arrow_device::operator()<cudf::string_view>(
       {});
   }
 
-  auto offsets_view = column_view{data_type(type_id::INT32),
+  // large_string offsets are int64 which cudf also supports so both layouts are zero-copy
+  auto const offsets_type = schema->type == NANOARROW_TYPE_LARGE_STRING
+                              ? data_type(type_id::INT64)
+                              : data_type(type_id::INT32);
+  auto offsets_view       = column_view{offsets_type,
                                   static_cast<size_type>(input->offset + input->length) + 1,
                                   input->buffers[fixed_width_data_buffer_idx],
                                   nullptr,
@@ -26,6 +26,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
 #include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/interop/detail/arrow.hpp>
@@ -42,11 +43,136 @@
 #include <nanoarrow/nanoarrow.h>
 #include <nanoarrow/nanoarrow.hpp>
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
 namespace {
 
+/**
+ * @brief Host buffers of at least this many bytes are copied to the device without staging
+ */
+constexpr std::size_t max_staged_copy_size = 1 << 20;
+
+/**
+ * @brief Copy of an `ArrowArray` tree whose small buffers are gathered into pinned host memory
+ *
+ * Every copy from pageable host memory waits for the device, which dominates the import of
+ * tables with many small buffers. The small buffers of all the arrays are instead copied into
+ * one pinned allocation on the host and the copies to the device read from it asynchronously.
+ * The arrays of the tree must not be released and the stream must be synchronized before the
+ * staged array is destroyed.
+ */
+class pinned_staged_array {
+ public:
+  pinned_staged_array(ArrowSchemaView const* schema, ArrowArray const* input)
+  {
+    std::vector<void const**> staged_buffers;
+    std::vector<std::size_t> staged_sizes;
+    _root = stage(schema, input, staged_buffers, staged_sizes);
+
+    // each buffer is padded to 64 bytes like a cudf null mask since masks are copied with
+    // their padding
+    std::vector<std::size_t> offsets(staged_sizes.size() + 1, 0);
+    for (std::size_t i = 0; i < staged_sizes.size(); ++i) {
+      offsets[i + 1] = offsets[i] + (staged_sizes[i] + 63) / 64 * 64;
+    }
+    if (offsets.back() == 0) { return; }
+
+    _staging = pinned_host_vector<uint8_t>(offsets.back());
+    for (std::size_t i = 0; i < staged_sizes.size(); ++i) {
+      std::memcpy(_staging.data() + offsets[i], *staged_buffers[i], staged_sizes[i]);
+      *staged_buffers[i] = _staging.data() + offsets[i];
+    }
+  }
+
+  /**
+   * @brief Returns the root of the staged tree
+   */
+  [[nodiscard]] ArrowArray const* get() const { return _root; }
+
+ private:
+  struct staged_node {
+    ArrowArray array;
+    std::vector<void const*> buffers;
+    std::vector<ArrowArray*> children;
+  };
+
+  /**
+   * @brief Returns the number of bytes of buffer `i` which are read by the import
+   */
+  static std::size_t buffer_size(ArrowSchemaView const* schema, ArrowArray const* input, int i)
+  {
+    auto const num_elements = input->offset + input->length;
+    auto const bits         = schema->layout.element_size_bits[i];
+    switch (schema->layout.buffer_type[i]) {
+      case NANOARROW_BUFFER_TYPE_VALIDITY: return (num_elements + 7) / 8;
+      case NANOARROW_BUFFER_TYPE_DATA_OFFSET: return (num_elements + 1) * bits / 8;
+      case NANOARROW_BUFFER_TYPE_DATA: {
+        if (i > 0 && schema->layout.buffer_type[i - 1] == NANOARROW_BUFFER_TYPE_DATA_OFFSET) {
+          // the size of variable-length data is the last offset
+          auto const* offsets = input->buffers[i - 1];
+          if (offsets == nullptr) { return 0; }
+          auto const last_offset =
+            schema->layout.element_size_bits[i - 1] == 64
+              ? static_cast<int64_t const*>(offsets)[num_elements]
+              : static_cast<int64_t>(static_cast<int32_t const*>(offsets)[num_elements]);
+          return last_offset * bits / 8;
+        }
+        return (num_elements * bits + 7) / 8;
+      }
+      default: return 0;
+    }
+  }
+
+  ArrowArray* stage(ArrowSchemaView const* schema,
+                    ArrowArray const* input,
+                    std::vector<void const**>& staged_buffers,
+                    std::vector<std::size_t>& staged_sizes)
+  {
+    auto& node   = *_nodes.emplace_back(std::make_unique<staged_node>());
+    node.array   = *input;
+    node.buffers = std::vector<void const*>(input->buffers, input->buffers + input->n_buffers);
+    node.array.buffers = node.buffers.data();
+
+    if (input->length > 0) {
+      for (int i = 0; i < static_cast<int>(node.buffers.size()) && i < 3; ++i) {
+        if (node.buffers[i] == nullptr) { continue; }
+        auto const size = buffer_size(schema, input, i);
+        if (size > 0 && size < max_staged_copy_size) {
+          staged_buffers.push_back(&node.buffers[i]);
+          staged_sizes.push_back(size);
+        }
+      }
+    }
+
+    for (int64_t i = 0; i < input->n_children; ++i) {
+      ArrowSchemaView child_schema;
+      NANOARROW_THROW_NOT_OK(
+        ArrowSchemaViewInit(&child_schema, schema->schema->children[i], nullptr));
+      node.children.push_back(
+        stage(&child_schema, input->children[i], staged_buffers, staged_sizes));
+    }
+    node.array.children = node.children.data();
+
+    if (input->dictionary != nullptr) {
+      ArrowSchemaView dictionary_schema;
+      NANOARROW_THROW_NOT_OK(
+        ArrowSchemaViewInit(&dictionary_schema, schema->schema->dictionary, nullptr));
+      node.array.dictionary =
+        stage(&dictionary_schema, input->dictionary, staged_buffers, staged_sizes);
+    }
+    return &node.array;
+  }
+
+  std::vector<std::unique_ptr<staged_node>> _nodes;
+  pinned_host_vector<uint8_t> _staging;
+  ArrowArray const* _root;
+};
+
 struct dispatch_copy_from_arrow_host {
   rmm::cuda_stream_view stream;
   rmm::mr::device_memory_resource* mr;
@@ -186,39 +312,34 @@ std::unique_ptr<column> dispatch_copy_from_arrow_host::operator()<cudf::string_v
          .buffers    = offset_buffers,
   };
 
-  // chars_column does not contain any nulls, they are tracked by the parent string column
-  // itself instead. So we pass nullptr for the validity bitmask.
-  size_type const char_data_length =
-    reinterpret_cast<int32_t const*>(offset_buffers[1])[input->length + input->offset];
-  void const* char_buffers[2] = {nullptr, input->buffers[2]};
-  ArrowArray char_array       = {
-          .length     = char_data_length,
-          .null_count = 0,
-          .offset     = 0,
-          .n_buffers  = 2,
-          .n_children = 0,
-          .buffers    = char_buffers,
-  };
-
+  // large_string offsets are int64 which cudf supports, so only their width differs
+  auto const is_large = schema->type == NANOARROW_TYPE_LARGE_STRING;
   nanoarrow::UniqueSchema offset_schema;
-  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(offset_schema.get(), NANOARROW_TYPE_INT32));
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(
+    offset_schema.get(), is_large ? NANOARROW_TYPE_INT64 : NANOARROW_TYPE_INT32));
 
-  nanoarrow::UniqueSchema char_data_schema;
-  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(char_data_schema.get(), NANOARROW_TYPE_INT8));
-
-  // leverage the dispatch overloads for int32 and char(int8) to generate the child
-  // offset and char data columns for us.
+  // leverage the dispatch overloads for int32 and int64 to generate the child
+  // offsets column for us.
   ArrowSchemaView view;
   NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, offset_schema.get(), nullptr));
   auto offsets_column =
-    this->operator()<int32_t>(&view, &offsets_array, data_type(type_id::INT32), true);
-  NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, char_data_schema.get(), nullptr));
-  auto chars_column = this->operator()<int8_t>(&view, &char_array, data_type(type_id::INT8), true);
+    is_large ? this->operator()<int64_t>(&view, &offsets_array, data_type(type_id::INT64), true)
+             : this->operator()<int32_t>(&view, &offsets_array, data_type(type_id::INT32), true);
+
+  // the chars do not contain any nulls, they are tracked by the parent string column
+  // itself instead, so they are copied as a single buffer.
+  auto const last_offset = input->offset + input->length;
+  int64_t const char_data_length =
+    is_large ? reinterpret_cast<int64_t const*>(offset_buffers[1])[last_offset]
+             : reinterpret_cast<int32_t const*>(offset_buffers[1])[last_offset];
+  auto chars = rmm::device_buffer(char_data_length, stream, mr);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    chars.data(), input->buffers[2], char_data_length, cudaMemcpyDefault, stream.value()));
 
   auto const num_rows = offsets_column->size() - 1;
   auto out_col        = make_strings_column(num_rows,
                                      std::move(offsets_column),
-                                     std::move(chars_column->release().data.release()[0]),
+                                     std::move(chars),
                                      input->null_count,
                                      std::move(*get_mask_buffer(input)));
 
@@ -404,8 +525,10 @@ std::unique_ptr<table> from_arrow_host(ArrowSchema const* schema,
                "Must pass a struct to `from_arrow_host`",
                cudf::data_type_error);
 
-  std::transform(input->array.children,
-                 input->array.children + input->array.n_children,
+  // the small buffers of all the columns are gathered so the copies do not wait for the device
+  auto const staged = pinned_staged_array(&view, &input->array);
+  std::transform(staged.get()->children,
+                 staged.get()->children + staged.get()->n_children,
                  view.schema->children,
                  std::back_inserter(columns),
                  [&stream, &mr](ArrowArray const* child, ArrowSchema const* child_schema) {
@@ -415,6 +538,8 @@ std::unique_ptr<table> from_arrow_host(ArrowSchema const* schema,
                    return get_column_copy(&view, child, type, false, stream, mr);
                  });
 
+  // the staged buffers must stay valid until the copies from them are complete
+  stream.synchronize();
   return std::make_unique<table>(std::move(columns));
 }
 
@@ -433,8 +558,13 @@ std::unique_ptr<column> from_arrow_host_column(ArrowSchema const* schema,
   ArrowSchemaView view;
   NANOARROW_THROW_NOT_OK(ArrowSchemaViewInit(&view, schema, nullptr));
 
-  auto type = arrow_to_cudf_type(&view);
-  return get_column_copy(&view, &input->array, type, false, stream, mr);
+  auto type         = arrow_to_cudf_type(&view);
+  auto const staged = pinned_staged_array(&view, &input->array);
+  auto result       = get_column_copy(&view, staged.get(), type, false, stream, mr);
+
+  // the staged buffers must stay valid until the copies from them are complete
+  stream.synchronize();
+  return result;
 }
 
 }  // namespace detail
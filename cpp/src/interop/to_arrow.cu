@@ -25,6 +25,8 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/dictionary_column_view.hpp>
 #include <cudf/interop.hpp>
 #include <cudf/null_mask.hpp>
@@ -36,34 +38,150 @@
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 
+#include <cub/device/device_memcpy.cuh>
 #include <thrust/copy.h>
 #include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <cstring>
+#include <memory>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 namespace {
 
+/**
+ * @brief Buffers of at least this many bytes are copied to host directly instead of being staged
+ */
+constexpr std::size_t max_staged_copy_size = 1 << 20;
+
+/**
+ * @brief Collects the device to host copies of a table and issues them in a few large transfers
+ *
+ * Each pageable device to host copy has a fixed latency, which dominates for tables with many
+ * small buffers. The small buffers are instead gathered into one device staging buffer with a
+ * single batched memcpy kernel, copied to pinned host memory in one transfer, and then copied
+ * into their Arrow buffers on the host. Large buffers are copied directly.
+ *
+ * The device memory of every added copy must stay valid until `copy` is called. Temporary
+ * device data can be handed to `retain` to keep it alive until then.
+ */
+class host_copy_batch {
+ public:
+  /**
+   * @brief Adds a copy of `size` bytes from device memory `src` to host memory `dst`
+   */
+  void add(void* dst, void const* src, std::size_t size)
+  {
+    if (size == 0) { return; }
+    auto& copies = size < max_staged_copy_size ? _staged : _direct;
+    copies.push_back({static_cast<uint8_t*>(dst), static_cast<uint8_t const*>(src), size});
+  }
+
+  /**
+   * @brief Keeps `data` alive until the copies are complete
+   */
+  template <typename T>
+  void retain(T&& data)
+  {
+    _retained.push_back(std::make_shared<std::decay_t<T>>(std::forward<T>(data)));
+  }
+
+  /**
+   * @brief Issues all the copies on `stream` and waits for them to complete
+   */
+  void copy(rmm::cuda_stream_view stream)
+  {
+    for (auto const& c : _direct) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(c.dst, c.src, c.size, cudaMemcpyDefault, stream.value()));
+    }
+
+    if (!_staged.empty()) {
+      auto const num_copies = _staged.size();
+      std::vector<std::size_t> offsets(num_copies + 1, 0);
+      for (std::size_t i = 0; i < num_copies; ++i) {
+        offsets[i + 1] = offsets[i] + _staged[i].size;
+      }
+      auto const staged_size = offsets.back();
+      auto d_staging         = rmm::device_buffer(staged_size, stream);
+
+      std::vector<uint8_t const*> srcs(num_copies);
+      std::vector<uint8_t*> dsts(num_copies);
+      std::vector<std::size_t> sizes(num_copies);
+      for (std::size_t i = 0; i < num_copies; ++i) {
+        srcs[i]  = _staged[i].src;
+        dsts[i]  = static_cast<uint8_t*>(d_staging.data()) + offsets[i];
+        sizes[i] = _staged[i].size;
+      }
+      auto const mr      = rmm::mr::get_current_device_resource();
+      auto const d_srcs  = make_device_uvector_async(srcs, stream, mr);
+      auto const d_dsts  = make_device_uvector_async(dsts, stream, mr);
+      auto const d_sizes = make_device_uvector_async(sizes, stream, mr);
+
+      std::size_t temp_storage_bytes = 0;
+      CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(nullptr,
+                                               temp_storage_bytes,
+                                               d_srcs.begin(),
+                                               d_dsts.begin(),
+                                               d_sizes.begin(),
+                                               num_copies,
+                                               stream.value()));
+      auto temp_storage = rmm::device_buffer(temp_storage_bytes, stream);
+      CUDF_CUDA_TRY(cub::DeviceMemcpy::Batched(temp_storage.data(),
+                                               temp_storage_bytes,
+                                               d_srcs.begin(),
+                                               d_dsts.begin(),
+                                               d_sizes.begin(),
+                                               num_copies,
+                                               stream.value()));
+
+      auto h_staging = pinned_host_vector<uint8_t>(staged_size);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        h_staging.data(), d_staging.data(), staged_size, cudaMemcpyDefault, stream.value()));
+      stream.synchronize();
+      for (std::size_t i = 0; i < num_copies; ++i) {
+        std::memcpy(_staged[i].dst, h_staging.data() + offsets[i], _staged[i].size);
+      }
+    }
+
+    // synchronize the stream because after the return the data may be accessed from the host
+    // before the direct copies have completed (especially if pinned host memory is used).
+    stream.synchronize();
+    _staged.clear();
+    _direct.clear();
+    _retained.clear();
+  }
+
+ private:
+  struct buffer_copy {
+    uint8_t* dst;
+    uint8_t const* src;
+    std::size_t size;
+  };
+
+  std::vector<buffer_copy> _staged;
+  std::vector<buffer_copy> _direct;
+  std::vector<std::shared_ptr<void>> _retained;
+};
+
 /**
  * @brief Create arrow data buffer from given cudf column
  */
 template <typename T>
 std::shared_ptr<arrow::Buffer> fetch_data_buffer(device_span<T const> input,
                                                  arrow::MemoryPool* ar_mr,
-                                                 rmm::cuda_stream_view stream)
+                                                 host_copy_batch& batch)
 {
   int64_t const data_size_in_bytes = sizeof(T) * input.size();
 
   auto data_buffer = allocate_arrow_buffer(data_size_in_bytes, ar_mr);
 
-  CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                                input.data(),
-                                data_size_in_bytes,
-                                cudaMemcpyDefault,
-                                stream.value()));
+  batch.add(data_buffer->mutable_data(), input.data(), data_size_in_bytes);
 
   return std::move(data_buffer);
 }
@@ -73,25 +191,24 @@ std::shared_ptr<arrow::Buffer> fetch_data_buffer(device_span<T const> input,
  */
 std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
                                                  arrow::MemoryPool* ar_mr,
+                                                 host_copy_batch& batch,
                                                  rmm::cuda_stream_view stream)
 {
-  int64_t const mask_size_in_bytes = cudf::bitmask_allocation_size_bytes(input_view.size());
-
   if (input_view.has_nulls()) {
     auto mask_buffer = allocate_arrow_bitmap(static_cast<int64_t>(input_view.size()), ar_mr);
-    CUDF_CUDA_TRY(cudaMemcpyAsync(
-      mask_buffer->mutable_data(),
-      (input_view.offset() > 0)
-        ? cudf::detail::copy_bitmask(input_view, stream, rmm::mr::get_current_device_resource())
-            .data()
-        : input_view.null_mask(),
-      mask_size_in_bytes,
-      cudaMemcpyDefault,
-      stream.value()));
-
-    // Resets all padded bits to 0
+
+    // Resets all padded bits to 0, only the bytes holding the bits of the rows are copied
     mask_buffer->ZeroPadding();
 
+    if (input_view.offset() > 0) {
+      auto mask =
+        cudf::detail::copy_bitmask(input_view, stream, rmm::mr::get_current_device_resource());
+      batch.add(mask_buffer->mutable_data(), mask.data(), mask_buffer->size());
+      batch.retain(std::move(mask));
+    } else {
+      batch.add(mask_buffer->mutable_data(), input_view.null_mask(), mask_buffer->size());
+    }
+
     return mask_buffer;
   }
 
@@ -102,6 +219,8 @@ std::shared_ptr<arrow::Buffer> fetch_mask_buffer(column_view input_view,
  * @brief Functor to convert cudf column to arrow array
  */
 struct dispatch_to_arrow {
+  host_copy_batch& batch;  ///< Collects the copies of the column buffers
+
   /**
    * @brief Creates vector Arrays from given cudf column children
    */
@@ -117,9 +236,9 @@ struct dispatch_to_arrow {
       input_view.child_end(),
       metadata.begin(),
       std::back_inserter(child_arrays),
-      [&ar_mr, &stream](auto const& child, auto const& meta) {
+      [this, &ar_mr, &stream](auto const& child, auto const& meta) {
         return type_dispatcher(
-          child.type(), dispatch_to_arrow{}, child, child.type().id(), meta, ar_mr, stream);
+          child.type(), dispatch_to_arrow{batch}, child, child.type().id(), meta, ar_mr, stream);
       });
     return child_arrays;
   }
@@ -142,8 +261,8 @@ struct dispatch_to_arrow {
       id,
       static_cast<int64_t>(input_view.size()),
       fetch_data_buffer<T>(
-        device_span<T const>(input_view.data<T>(), input_view.size()), ar_mr, stream),
-      fetch_mask_buffer(input_view, ar_mr, stream),
+        device_span<T const>(input_view.data<T>(), input_view.size()), ar_mr, batch),
+      fetch_mask_buffer(input_view, ar_mr, batch, stream),
       static_cast<int64_t>(input_view.null_count()));
   }
 };
@@ -155,6 +274,7 @@ template <typename DeviceType>
 std::shared_ptr<arrow::Array> unsupported_decimals_to_arrow(column_view input,
                                                             int32_t precision,
                                                             arrow::MemoryPool* ar_mr,
+                                                            host_copy_batch& batch,
                                                             rmm::cuda_stream_view stream)
 {
   constexpr size_type BIT_WIDTH_RATIO = sizeof(__int128_t) / sizeof(DeviceType);
@@ -182,11 +302,11 @@ std::shared_ptr<arrow::Array> unsupported_decimals_to_arrow(column_view input,
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
 
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    data_buffer->mutable_data(), buf.data(), buf_size_in_bytes, cudaMemcpyDefault, stream.value()));
+  batch.add(data_buffer->mutable_data(), buf.data(), buf_size_in_bytes);
+  batch.retain(std::move(buf));
 
   auto type    = arrow::decimal(precision, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, batch, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -203,7 +323,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal32>(
 {
   using DeviceType = int32_t;
   return unsupported_decimals_to_arrow<DeviceType>(
-    input, cudf::detail::max_precision<DeviceType>(), ar_mr, stream);
+    input, cudf::detail::max_precision<DeviceType>(), ar_mr, batch, stream);
 }
 
 template <>
@@ -216,7 +336,7 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal64>(
 {
   using DeviceType = int64_t;
   return unsupported_decimals_to_arrow<DeviceType>(
-    input, cudf::detail::max_precision<DeviceType>(), ar_mr, stream);
+    input, cudf::detail::max_precision<DeviceType>(), ar_mr, batch, stream);
 }
 
 template <>
@@ -240,11 +360,11 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<numeric::decimal128>
   auto const buf_size_in_bytes = buf.size() * sizeof(DeviceType);
   auto data_buffer             = allocate_arrow_buffer(buf_size_in_bytes, ar_mr);
 
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    data_buffer->mutable_data(), buf.data(), buf_size_in_bytes, cudaMemcpyDefault, stream.value()));
+  batch.add(data_buffer->mutable_data(), buf.data(), buf_size_in_bytes);
+  batch.retain(std::move(buf));
 
   auto type    = arrow::decimal(max_precision, -input.type().scale());
-  auto mask    = fetch_mask_buffer(input, ar_mr, stream);
+  auto mask    = fetch_mask_buffer(input, ar_mr, batch, stream);
   auto buffers = std::vector<std::shared_ptr<arrow::Buffer>>{mask, std::move(data_buffer)};
   auto data    = std::make_shared<arrow::ArrayData>(type, input.size(), buffers);
 
@@ -262,15 +382,12 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<bool>(column_view in
 
   auto data_buffer = allocate_arrow_buffer(static_cast<int64_t>(bitmask.first->size()), ar_mr);
 
-  CUDF_CUDA_TRY(cudaMemcpyAsync(data_buffer->mutable_data(),
-                                bitmask.first->data(),
-                                bitmask.first->size(),
-                                cudaMemcpyDefault,
-                                stream.value()));
+  batch.add(data_buffer->mutable_data(), bitmask.first->data(), bitmask.first->size());
+  batch.retain(std::move(bitmask.first));
   return to_arrow_array(id,
                         static_cast<int64_t>(input.size()),
                         std::move(data_buffer),
-                        fetch_mask_buffer(input, ar_mr, stream),
+                        fetch_mask_buffer(input, ar_mr, batch, stream),
                         static_cast<int64_t>(input.null_count()));
 }
 
@@ -305,11 +422,13 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::string_view>(
     device_span<char const>{sview.chars_begin(stream),
                               static_cast<std::size_t>(sview.chars_size(stream))},
     ar_mr,
-    stream);
+    batch);
+  auto mask = fetch_mask_buffer(input_view, ar_mr, batch, stream);
+  if (tmp_column != nullptr) { batch.retain(std::move(tmp_column)); }
   return std::make_shared<arrow::StringArray>(static_cast<int64_t>(input_view.size()),
                                               offset_buffer,
                                               data_buffer,
-                                              fetch_mask_buffer(input_view, ar_mr, stream),
+                                              mask,
                                               static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -329,7 +448,8 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::struct_view>(
 
   column_view input_view = (tmp_column != nullptr) ? tmp_column->view() : input;
   auto child_arrays      = fetch_child_array(input_view, metadata.children_meta, ar_mr, stream);
-  auto mask              = fetch_mask_buffer(input_view, ar_mr, stream);
+  auto mask              = fetch_mask_buffer(input_view, ar_mr, batch, stream);
+  if (tmp_column != nullptr) { batch.retain(std::move(tmp_column)); }
 
   std::vector<std::shared_ptr<arrow::Field>> fields;
   std::transform(child_arrays.cbegin(),
@@ -373,11 +493,13 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::list_view>(
 
   auto offset_buffer = child_arrays[0]->data()->buffers[1];
   auto data          = child_arrays[1];
+  auto mask          = fetch_mask_buffer(input_view, ar_mr, batch, stream);
+  if (tmp_column != nullptr) { batch.retain(std::move(tmp_column)); }
   return std::make_shared<arrow::ListArray>(arrow::list(data->type()),
                                             static_cast<int64_t>(input_view.size()),
                                             offset_buffer,
                                             data,
-                                            fetch_mask_buffer(input_view, ar_mr, stream),
+                                            mask,
                                             static_cast<int64_t>(input_view.null_count()));
 }
 
@@ -395,12 +517,13 @@ std::shared_ptr<arrow::Array> dispatch_to_arrow::operator()<cudf::dictionary32>(
                  cudf::data_type{type_id::INT32},
                  stream,
                  rmm::mr::get_current_device_resource());
-  auto indices = dispatch_to_arrow{}.operator()<int32_t>(
+  auto indices = dispatch_to_arrow{batch}.operator()<int32_t>(
     dict_indices->view(), dict_indices->type().id(), {}, ar_mr, stream);
+  batch.retain(std::move(dict_indices));
   auto dict_keys = cudf::dictionary_column_view(input).keys();
   auto dictionary =
     type_dispatcher(dict_keys.type(),
-                    dispatch_to_arrow{},
+                    dispatch_to_arrow{batch},
                     dict_keys,
                     dict_keys.type().id(),
                     metadata.children_meta.empty() ? column_metadata{} : metadata.children_meta[0],
@@ -422,6 +545,7 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
 
   std::vector<std::shared_ptr<arrow::Array>> arrays;
   std::vector<std::shared_ptr<arrow::Field>> fields;
+  host_copy_batch batch;
 
   std::transform(
     input.begin(),
@@ -430,8 +554,13 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
     std::back_inserter(arrays),
     [&](auto const& c, auto const& meta) {
       return c.type().id() != type_id::EMPTY
-               ? type_dispatcher(
-                   c.type(), detail::dispatch_to_arrow{}, c, c.type().id(), meta, ar_mr, stream)
+               ? type_dispatcher(c.type(),
+                                 detail::dispatch_to_arrow{batch},
+                                 c,
+                                 c.type().id(),
+                                 meta,
+                                 ar_mr,
+                                 stream)
                : std::make_shared<arrow::NullArray>(c.size());
     });
 
@@ -444,10 +573,8 @@ std::shared_ptr<arrow::Table> to_arrow(table_view input,
 
   auto result = arrow::Table::Make(arrow::schema(fields), arrays);
 
-  // synchronize the stream because after the return the data may be accessed from the host before
-  // the above `cudaMemcpyAsync` calls have completed their copies (especially if pinned host
-  // memory is used).
-  stream.synchronize();
+  // the buffers of all the columns are copied together and are complete when this returns
+  batch.copy(stream);
 
   return result;
 }
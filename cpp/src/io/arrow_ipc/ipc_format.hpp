@@ -0,0 +1,107 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "io/parquet/ipc/Message_generated.h"
+#include "io/parquet/ipc/Schema_generated.h"
+
+#include <cudf/utilities/error.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+namespace cudf::io::detail::arrow_ipc {
+
+namespace flatbuf = cudf::io::parquet::flatbuf;
+
+// Message header types of the Arrow format missing from the vendored schema, which was generated
+// for the Parquet `ARROW:schema` metadata and only declares `Schema`
+constexpr auto message_header_dictionary_batch = static_cast<flatbuf::MessageHeader>(2);
+constexpr auto message_header_record_batch     = static_cast<flatbuf::MessageHeader>(3);
+
+// Marker preceding the metadata length of each encapsulated message
+constexpr uint32_t continuation_marker = 0xFFFF'FFFFu;
+// Alignment of the encapsulated messages and of the buffers within a message body
+constexpr std::size_t ipc_alignment = 8;
+// Size of the uncompressed length prefixing each compressed buffer; a length of -1 marks a buffer
+// stored uncompressed
+constexpr std::size_t compressed_length_size        = sizeof(int64_t);
+constexpr int64_t uncompressed_buffer_length_marker = -1;
+
+// LZ4 frame format, see https://github.com/lz4/lz4/blob/dev/doc/lz4_Frame_format.md
+constexpr uint32_t lz4_frame_magic            = 0x184D'2204u;
+constexpr uint8_t lz4_flg_version             = 0x40;
+constexpr uint8_t lz4_flg_version_mask        = 0xC0;
+constexpr uint8_t lz4_flg_block_independence  = 0x20;
+constexpr uint8_t lz4_flg_block_checksum      = 0x10;
+constexpr uint8_t lz4_flg_content_size        = 0x08;
+constexpr uint8_t lz4_flg_content_checksum    = 0x04;
+constexpr uint8_t lz4_flg_dictionary_id       = 0x01;
+constexpr uint32_t lz4_block_uncompressed_bit = 0x8000'0000u;
+// Block maximum size identifier of 4 MiB written in the BD byte
+constexpr uint8_t lz4_bd_max_size_4mb = 0x70;
+
+/**
+ * @brief Returns the maximum uncompressed size of the blocks of an LZ4 frame from its BD byte
+ */
+inline std::size_t lz4_block_max_size(uint8_t bd)
+{
+  auto const id = (bd >> 4) & 0x7;
+  CUDF_EXPECTS(id >= 4, "Invalid LZ4 frame block maximum size");
+  // 4: 64 KiB, 5: 256 KiB, 6: 1 MiB, 7: 4 MiB
+  return std::size_t{1} << (2 * id + 8);
+}
+
+/**
+ * @brief Computes the LZ4 frame header checksum of the frame descriptor
+ *
+ * The checksum is the second byte of the 32-bit xxHash of the descriptor. The descriptor has at
+ * most 11 bytes so only the short input path of xxHash is implemented.
+ *
+ * @param descriptor The FLG byte and the following descriptor bytes
+ * @param size Number of descriptor bytes, less than 16
+ * @return Header checksum byte
+ */
+inline uint8_t lz4_header_checksum(uint8_t const* descriptor, std::size_t size)
+{
+  constexpr uint32_t prime1 = 2654435761u;
+  constexpr uint32_t prime2 = 2246822519u;
+  constexpr uint32_t prime3 = 3266489917u;
+  constexpr uint32_t prime4 = 668265263u;
+  constexpr uint32_t prime5 = 374761393u;
+  auto const rotl           = [](uint32_t x, int r) { return (x << r) | (x >> (32 - r)); };
+
+  uint32_t h    = prime5 + static_cast<uint32_t>(size);
+  std::size_t i = 0;
+  for (; i + 4 <= size; i += 4) {
+    uint32_t word;
+    std::memcpy(&word, descriptor + i, sizeof(word));
+    h = rotl(h + word * prime3, 17) * prime4;
+  }
+  for (; i < size; ++i) {
+    h = rotl(h + descriptor[i] * prime5, 11) * prime1;
+  }
+  h ^= h >> 15;
+  h *= prime2;
+  h ^= h >> 13;
+  h *= prime3;
+  h ^= h >> 16;
+  return static_cast<uint8_t>(h >> 8);
+}
+
+}  // namespace cudf::io::detail::arrow_ipc
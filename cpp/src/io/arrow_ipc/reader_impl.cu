@@ -0,0 +1,900 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/arrow_ipc/ipc_format.hpp"
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/arrow_ipc.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+namespace {
+
+// Decoded buffers are padded so that validity buffers can be used as null masks
+constexpr std::size_t buffer_padding = 64;
+
+/**
+ * @brief An encapsulated message of the stream
+ */
+struct message_info {
+  std::vector<uint8_t> metadata;  // Flatbuffer `Message`
+  std::size_t body_offset;        // Offset of the body in the source
+  std::size_t body_size;          // Size of the body in bytes
+
+  [[nodiscard]] flatbuf::Message const& message() const
+  {
+    return *flatbuf::GetMessage(metadata.data());
+  }
+};
+
+/**
+ * @brief Reads `size` bytes of the source from `offset`
+ */
+std::vector<uint8_t> read_bytes(datasource& source, std::size_t offset, std::size_t size)
+{
+  std::vector<uint8_t> bytes(size);
+  CUDF_EXPECTS(source.host_read(offset, size, bytes.data()) == size,
+               "Unexpected end of the Arrow IPC stream");
+  return bytes;
+}
+
+/**
+ * @brief Reads the message starting at `offset` and moves `offset` past its body
+ *
+ * @return The message, or `std::nullopt` at the end-of-stream marker or the end of the source
+ */
+std::optional<message_info> read_message(datasource& source, std::size_t& offset)
+{
+  auto const source_size = source.size();
+  auto const read_word   = [&]() {
+    CUDF_EXPECTS(offset + sizeof(uint32_t) <= source_size,
+                 "Unexpected end of the Arrow IPC stream");
+    uint32_t word;
+    std::memcpy(&word, read_bytes(source, offset, sizeof(word)).data(), sizeof(word));
+    offset += sizeof(word);
+    return word;
+  };
+
+  if (offset + sizeof(uint32_t) > source_size) { return std::nullopt; }
+  auto word = read_word();
+  // Streams written before Arrow 0.15 start each message with the metadata length
+  if (word == continuation_marker) { word = read_word(); }
+  auto const metadata_size = static_cast<int32_t>(word);
+  if (metadata_size == 0) { return std::nullopt; }
+  CUDF_EXPECTS(metadata_size > 0 && offset + metadata_size <= source_size,
+               "Invalid Arrow IPC message metadata length");
+
+  message_info info{read_bytes(source, offset, metadata_size), 0, 0};
+  offset += metadata_size;
+
+  ::flatbuffers::Verifier verifier(info.metadata.data(), info.metadata.size());
+  CUDF_EXPECTS(flatbuf::VerifyMessageBuffer(verifier), "Invalid Arrow IPC message metadata");
+  auto const& message = info.message();
+  if (message.header_type() == message_header_record_batch) {
+    // The vendored schema does not verify the record batch header
+    ::flatbuffers::Verifier batch_verifier(info.metadata.data(), info.metadata.size());
+    CUDF_EXPECTS(message.header() != nullptr &&
+                   batch_verifier.VerifyTable(
+                     static_cast<flatbuf::RecordBatch const*>(message.header())),
+                 "Invalid Arrow IPC record batch metadata");
+  }
+
+  CUDF_EXPECTS(message.bodyLength() >= 0 &&
+                 offset + static_cast<std::size_t>(message.bodyLength()) <= source_size,
+               "Invalid Arrow IPC message body length");
+  info.body_offset = offset;
+  info.body_size   = message.bodyLength();
+  offset += info.body_size;
+  return info;
+}
+
+/**
+ * @brief Returns the number of children of a field
+ */
+auto field_children(flatbuf::Field const& field)
+{
+  return field.children() != nullptr ? field.children()->size() : 0;
+}
+
+/**
+ * @brief Converts the type of an Arrow field to a cudf type
+ */
+data_type to_cudf_type(flatbuf::Field const& field)
+{
+  CUDF_EXPECTS(field.dictionary() == nullptr,
+               "Dictionary-encoded Arrow IPC fields are not supported");
+  auto const time_unit_type =
+    [](flatbuf::TimeUnit unit, type_id s, type_id ms, type_id us, type_id ns) {
+      switch (unit) {
+        case flatbuf::TimeUnit_SECOND: return data_type{s};
+        case flatbuf::TimeUnit_MILLISECOND: return data_type{ms};
+        case flatbuf::TimeUnit_MICROSECOND: return data_type{us};
+        case flatbuf::TimeUnit_NANOSECOND: return data_type{ns};
+        default: CUDF_FAIL("Invalid Arrow IPC time unit");
+      }
+    };
+
+  switch (field.type_type()) {
+    case flatbuf::Type_Int: {
+      auto const* type = field.type_as_Int();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC integer type");
+      auto const is_signed = type->is_signed();
+      switch (type->bitWidth()) {
+        case 8: return data_type{is_signed ? type_id::INT8 : type_id::UINT8};
+        case 16: return data_type{is_signed ? type_id::INT16 : type_id::UINT16};
+        case 32: return data_type{is_signed ? type_id::INT32 : type_id::UINT32};
+        case 64: return data_type{is_signed ? type_id::INT64 : type_id::UINT64};
+        default: CUDF_FAIL("Invalid Arrow IPC integer bit width");
+      }
+    }
+    case flatbuf::Type_FloatingPoint: {
+      auto const* type = field.type_as_FloatingPoint();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC floating-point type");
+      switch (type->precision()) {
+        case flatbuf::Precision_SINGLE: return data_type{type_id::FLOAT32};
+        case flatbuf::Precision_DOUBLE: return data_type{type_id::FLOAT64};
+        default: CUDF_FAIL("Half precision Arrow IPC fields are not supported");
+      }
+    }
+    case flatbuf::Type_Bool: return data_type{type_id::BOOL8};
+    case flatbuf::Type_Utf8:
+    case flatbuf::Type_LargeUtf8: return data_type{type_id::STRING};
+    case flatbuf::Type_Decimal: {
+      auto const* type = field.type_as_Decimal();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC decimal type");
+      switch (type->bitWidth()) {
+        case 32: return data_type{type_id::DECIMAL32, -type->scale()};
+        case 64: return data_type{type_id::DECIMAL64, -type->scale()};
+        case 128: return data_type{type_id::DECIMAL128, -type->scale()};
+        default: CUDF_FAIL("Only 32, 64 and 128-bit Arrow IPC decimals are supported");
+      }
+    }
+    case flatbuf::Type_Date: {
+      auto const* type = field.type_as_Date();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC date type");
+      return data_type{type->unit() == flatbuf::DateUnit_DAY ? type_id::TIMESTAMP_DAYS
+                                                            : type_id::TIMESTAMP_MILLISECONDS};
+    }
+    case flatbuf::Type_Timestamp: {
+      auto const* type = field.type_as_Timestamp();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC timestamp type");
+      return time_unit_type(type->unit(),
+                            type_id::TIMESTAMP_SECONDS,
+                            type_id::TIMESTAMP_MILLISECONDS,
+                            type_id::TIMESTAMP_MICROSECONDS,
+                            type_id::TIMESTAMP_NANOSECONDS);
+    }
+    case flatbuf::Type_Duration: {
+      auto const* type = field.type_as_Duration();
+      CUDF_EXPECTS(type != nullptr, "Invalid Arrow IPC duration type");
+      return time_unit_type(type->unit(),
+                            type_id::DURATION_SECONDS,
+                            type_id::DURATION_MILLISECONDS,
+                            type_id::DURATION_MICROSECONDS,
+                            type_id::DURATION_NANOSECONDS);
+    }
+    case flatbuf::Type_List:
+      CUDF_EXPECTS(field_children(field) == 1, "Invalid Arrow IPC list type");
+      return data_type{type_id::LIST};
+    case flatbuf::Type_Struct_: return data_type{type_id::STRUCT};
+    default:
+      CUDF_FAIL(std::string{"Unsupported Arrow IPC field type "} +
+                flatbuf::EnumNameType(field.type_type()));
+  }
+}
+
+/**
+ * @brief Appends whether each buffer of the field and its descendants is read, in the order of
+ * the record batch buffers, and returns the number of field nodes
+ */
+std::size_t mark_field_buffers(flatbuf::Field const& field, bool is_read, std::vector<bool>& out)
+{
+  auto const type = to_cudf_type(field);
+  // validity, plus offsets and data for strings, offsets for lists, data for fixed-width types
+  auto const num_buffers = type.id() == type_id::STRING ? 3 : type.id() == type_id::STRUCT ? 1 : 2;
+  out.insert(out.end(), num_buffers, is_read);
+  std::size_t num_nodes = 1;
+  for (std::size_t i = 0; i < field_children(field); ++i) {
+    num_nodes += mark_field_buffers(*field.children()->Get(i), is_read, out);
+  }
+  return num_nodes;
+}
+
+/**
+ * @brief Returns the column name info of a field and its descendants
+ */
+column_name_info make_name_info(flatbuf::Field const& field)
+{
+  column_name_info info{field.name() != nullptr ? field.name()->str() : std::string{}};
+  if (field.type_type() == flatbuf::Type_List) { info.children.emplace_back("offsets"); }
+  for (std::size_t i = 0; i < field_children(field); ++i) {
+    info.children.push_back(make_name_info(*field.children()->Get(i)));
+  }
+  return info;
+}
+
+/**
+ * @brief Returns an empty column of the field type, including the types of its descendants
+ */
+std::unique_ptr<column> make_empty_field_column(flatbuf::Field const& field,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  auto const type = to_cudf_type(field);
+  if (type.id() == type_id::LIST) {
+    return make_lists_column(0,
+                             make_empty_column(type_id::INT32),
+                             make_empty_field_column(*field.children()->Get(0), stream, mr),
+                             0,
+                             {},
+                             stream,
+                             mr);
+  }
+  if (type.id() == type_id::STRUCT) {
+    std::vector<std::unique_ptr<column>> children;
+    for (std::size_t i = 0; i < field_children(field); ++i) {
+      children.push_back(make_empty_field_column(*field.children()->Get(i), stream, mr));
+    }
+    return make_structs_column(0, std::move(children), 0, {}, stream, mr);
+  }
+  return make_empty_column(type);
+}
+
+/**
+ * @brief Blocks of an LZ4 frame
+ */
+struct lz4_frame {
+  struct block {
+    std::size_t offset;  // Offset of the block data in the frame
+    std::size_t size;    // Size of the block data
+    bool is_compressed;
+  };
+  bool independent_blocks;
+  std::size_t block_max_size;
+  std::vector<block> blocks;
+};
+
+/**
+ * @brief Parses the header and block sizes of an LZ4 frame
+ *
+ * Block and content checksums are skipped without being verified.
+ */
+lz4_frame parse_lz4_frame(host_span<uint8_t const> frame)
+{
+  auto const read_u32 = [&](std::size_t pos) {
+    CUDF_EXPECTS(pos + sizeof(uint32_t) <= frame.size(), "Invalid LZ4 frame");
+    uint32_t word;
+    std::memcpy(&word, frame.data() + pos, sizeof(word));
+    return word;
+  };
+  CUDF_EXPECTS(read_u32(0) == lz4_frame_magic, "Invalid LZ4 frame magic number");
+  CUDF_EXPECTS(frame.size() >= 7, "Invalid LZ4 frame");
+  auto const flg = frame[4];
+  CUDF_EXPECTS((flg & lz4_flg_version_mask) == lz4_flg_version, "Unsupported LZ4 frame version");
+  CUDF_EXPECTS((flg & lz4_flg_dictionary_id) == 0,
+               "LZ4 frames with a dictionary are not supported");
+
+  lz4_frame out{(flg & lz4_flg_block_independence) != 0, lz4_block_max_size(frame[5]), {}};
+  // magic number, FLG, BD, optional content size and the header checksum
+  auto pos = sizeof(uint32_t) + 2 + ((flg & lz4_flg_content_size) ? sizeof(uint64_t) : 0) + 1;
+  while (true) {
+    auto const word = read_u32(pos);
+    pos += sizeof(word);
+    if (word == 0) { break; }
+    auto const size = static_cast<std::size_t>(word & ~lz4_block_uncompressed_bit);
+    CUDF_EXPECTS(pos + size <= frame.size(), "Invalid LZ4 frame block size");
+    out.blocks.push_back({pos, size, (word & lz4_block_uncompressed_bit) == 0});
+    pos += size + ((flg & lz4_flg_block_checksum) ? sizeof(uint32_t) : 0);
+  }
+  return out;
+}
+
+/**
+ * @brief Decompresses an LZ4 block on the host
+ *
+ * Matches may refer to the output of the preceding blocks of the frame, so frames of linked
+ * blocks are decompressed by calling this for each block with the same output.
+ *
+ * @param in Compressed block
+ * @param out Output of the whole frame
+ * @param out_pos Position in `out` to write the block to
+ * @return Position in `out` after the decompressed block
+ */
+std::size_t lz4_decompress_block(host_span<uint8_t const> in,
+                                 host_span<uint8_t> out,
+                                 std::size_t out_pos)
+{
+  std::size_t in_pos     = 0;
+  auto const read_length = [&](std::size_t length) {
+    if (length == 15) {
+      uint8_t byte;
+      do {
+        CUDF_EXPECTS(in_pos < in.size(), "Invalid LZ4 block");
+        byte = in[in_pos++];
+        length += byte;
+      } while (byte == 255);
+    }
+    return length;
+  };
+
+  while (in_pos < in.size()) {
+    auto const token    = in[in_pos++];
+    auto const literals = read_length(token >> 4);
+    CUDF_EXPECTS(in_pos + literals <= in.size() && out_pos + literals <= out.size(),
+                 "Invalid LZ4 block");
+    std::memcpy(out.data() + out_pos, in.data() + in_pos, literals);
+    in_pos += literals;
+    out_pos += literals;
+    // the last sequence of a block only has literals
+    if (in_pos == in.size()) { break; }
+
+    CUDF_EXPECTS(in_pos + 2 <= in.size(), "Invalid LZ4 block");
+    std::size_t const match_offset = in[in_pos] | (in[in_pos + 1] << 8);
+    in_pos += 2;
+    auto const match_length = read_length(token & 0xF) + 4;
+    CUDF_EXPECTS(
+      match_offset > 0 && match_offset <= out_pos && out_pos + match_length <= out.size(),
+      "Invalid LZ4 block");
+    // byte by byte since the match may overlap its own output
+    for (std::size_t i = 0; i < match_length; ++i, ++out_pos) {
+      out[out_pos] = out[out_pos - match_offset];
+    }
+  }
+  return out_pos;
+}
+
+/**
+ * @brief Allocates a buffer of `size` bytes, padded to `buffer_padding`
+ */
+rmm::device_buffer allocate_buffer(std::size_t size,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  rmm::device_buffer buffer(cudf::util::round_up_safe(size, buffer_padding), stream, mr);
+  buffer.resize(size, stream);
+  return buffer;
+}
+
+/**
+ * @brief Device chunks of one codec to decompress with nvCOMP
+ */
+struct decompression_batch {
+  std::vector<device_span<uint8_t const>> inputs;
+  std::vector<device_span<uint8_t>> outputs;
+
+  void add(uint8_t const* input, std::size_t input_size, uint8_t* output, std::size_t output_size)
+  {
+    inputs.emplace_back(input, input_size);
+    outputs.emplace_back(output, output_size);
+  }
+
+  void decompress(nvcomp::compression_type codec, rmm::cuda_stream_view stream) const
+  {
+    if (inputs.empty()) { return; }
+    auto const disabled = nvcomp::is_decompression_disabled(codec);
+    CUDF_EXPECTS(not disabled.has_value(),
+                 "Arrow IPC buffer decompression unavailable: " + disabled.value_or(""));
+
+    std::size_t max_output_size   = 0;
+    std::size_t total_output_size = 0;
+    for (auto const& output : outputs) {
+      max_output_size = std::max(max_output_size, output.size());
+      total_output_size += output.size();
+    }
+    auto const mr        = rmm::mr::get_current_device_resource();
+    auto const d_inputs  = cudf::detail::make_device_uvector_async(inputs, stream, mr);
+    auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream, mr);
+    rmm::device_uvector<compression_result> d_results(inputs.size(), stream);
+    nvcomp::batched_decompress(
+      codec, d_inputs, d_outputs, d_results, max_output_size, total_output_size, stream);
+
+    auto const results = cudf::detail::make_std_vector_sync(d_results, stream);
+    for (std::size_t i = 0; i < results.size(); ++i) {
+      CUDF_EXPECTS(results[i].status == compression_status::SUCCESS &&
+                     results[i].bytes_written == outputs[i].size(),
+                   "Error during Arrow IPC buffer decompression");
+    }
+  }
+};
+
+/**
+ * @brief Decodes the buffers of a record batch into separate device buffers
+ *
+ * Uncompressed buffers are copied from the device copy of the body and compressed buffers are
+ * decompressed into their output buffers with nvCOMP. LZ4 frames of linked blocks, whose blocks
+ * cannot be decompressed independently, are decompressed on the host.
+ *
+ * @param batch Record batch metadata
+ * @param body Host copy of the body
+ * @param d_body Device copy of the body
+ * @param is_read Whether each buffer is used by a column to read
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned buffers
+ * @return Decoded buffers, empty for buffers that are not read
+ */
+std::vector<rmm::device_buffer> decode_buffers(flatbuf::RecordBatch const& batch,
+                                               host_span<uint8_t const> body,
+                                               uint8_t const* d_body,
+                                               std::vector<bool> const& is_read,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  auto const& buffers     = *batch.buffers();
+  auto const* compression = batch.compression();
+  if (compression != nullptr) {
+    CUDF_EXPECTS(compression->method() == flatbuf::BodyCompressionMethod_BUFFER,
+                 "Unsupported Arrow IPC body compression method");
+    CUDF_EXPECTS(compression->codec() == flatbuf::CompressionType_LZ4_FRAME ||
+                   compression->codec() == flatbuf::CompressionType_ZSTD,
+                 "Unsupported Arrow IPC compression codec");
+  }
+
+  std::vector<rmm::device_buffer> out;
+  out.reserve(buffers.size());
+  std::vector<device_span<uint8_t const>> copy_in;
+  std::vector<device_span<uint8_t>> copy_out;
+  decompression_batch lz4_chunks;
+  decompression_batch zstd_chunks;
+  // host-decompressed buffers, kept until their copies to the device complete
+  std::vector<std::vector<uint8_t>> host_decoded;
+
+  for (std::size_t i = 0; i < buffers.size(); ++i) {
+    auto const offset = buffers.Get(i)->offset();
+    auto const length = buffers.Get(i)->length();
+    CUDF_EXPECTS(
+      offset >= 0 && length >= 0 && static_cast<std::size_t>(offset + length) <= body.size(),
+      "Arrow IPC buffer exceeds the message body");
+    if (not is_read[i] or length == 0) {
+      out.emplace_back(0, stream, mr);
+      continue;
+    }
+
+    auto const* h_data = body.data() + offset;
+    auto const* d_data = d_body + offset;
+    auto data_size     = static_cast<std::size_t>(length);
+
+    int64_t uncompressed_size = uncompressed_buffer_length_marker;
+    if (compression != nullptr) {
+      CUDF_EXPECTS(data_size >= compressed_length_size, "Invalid compressed Arrow IPC buffer");
+      std::memcpy(&uncompressed_size, h_data, compressed_length_size);
+      h_data += compressed_length_size;
+      d_data += compressed_length_size;
+      data_size -= compressed_length_size;
+    }
+
+    if (uncompressed_size == uncompressed_buffer_length_marker) {
+      auto& buffer = out.emplace_back(allocate_buffer(data_size, stream, mr));
+      copy_in.emplace_back(d_data, data_size);
+      copy_out.emplace_back(static_cast<uint8_t*>(buffer.data()), data_size);
+      continue;
+    }
+    CUDF_EXPECTS(uncompressed_size >= 0, "Invalid uncompressed Arrow IPC buffer length");
+    auto& buffer = out.emplace_back(allocate_buffer(uncompressed_size, stream, mr));
+    auto* dst    = static_cast<uint8_t*>(buffer.data());
+    if (uncompressed_size == 0) { continue; }
+
+    if (compression->codec() == flatbuf::CompressionType_ZSTD) {
+      zstd_chunks.add(d_data, data_size, dst, uncompressed_size);
+      continue;
+    }
+
+    auto const frame = parse_lz4_frame({h_data, data_size});
+    if (not frame.independent_blocks and frame.blocks.size() > 1) {
+      auto& decoded   = host_decoded.emplace_back(uncompressed_size);
+      std::size_t pos = 0;
+      for (auto const& block : frame.blocks) {
+        host_span<uint8_t const> const block_data{h_data + block.offset, block.size};
+        if (block.is_compressed) {
+          pos = lz4_decompress_block(block_data, decoded, pos);
+        } else {
+          CUDF_EXPECTS(pos + block.size <= decoded.size(), "Invalid LZ4 frame block size");
+          std::memcpy(decoded.data() + pos, block_data.data(), block.size);
+          pos += block.size;
+        }
+      }
+      CUDF_EXPECTS(pos == decoded.size(), "Invalid LZ4 frame content size");
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        dst, decoded.data(), decoded.size(), cudaMemcpyDefault, stream.value()));
+      continue;
+    }
+
+    // Every block but the last one is assumed to have the maximum size, which the decompressed
+    // sizes are checked against
+    std::size_t pos = 0;
+    for (std::size_t b = 0; b < frame.blocks.size(); ++b) {
+      auto const& block    = frame.blocks[b];
+      auto const remaining = static_cast<std::size_t>(uncompressed_size) - pos;
+      if (block.is_compressed) {
+        auto const size = b + 1 < frame.blocks.size() ? frame.block_max_size : remaining;
+        CUDF_EXPECTS(size <= remaining, "Invalid LZ4 frame content size");
+        lz4_chunks.add(d_data + block.offset, block.size, dst + pos, size);
+        pos += size;
+      } else {
+        CUDF_EXPECTS(block.size <= remaining, "Invalid LZ4 frame block size");
+        copy_in.emplace_back(d_data + block.offset, block.size);
+        copy_out.emplace_back(dst + pos, block.size);
+        pos += block.size;
+      }
+    }
+    CUDF_EXPECTS(pos == static_cast<std::size_t>(uncompressed_size),
+                 "Invalid LZ4 frame content size");
+  }
+
+  if (not copy_in.empty()) {
+    auto const temp_mr    = rmm::mr::get_current_device_resource();
+    auto const d_copy_in  = cudf::detail::make_device_uvector_async(copy_in, stream, temp_mr);
+    auto const d_copy_out = cudf::detail::make_device_uvector_async(copy_out, stream, temp_mr);
+    gpu_copy_uncompressed_blocks(d_copy_in, d_copy_out, stream);
+  }
+  lz4_chunks.decompress(nvcomp::compression_type::LZ4, stream);
+  zstd_chunks.decompress(nvcomp::compression_type::ZSTD, stream);
+
+  stream.synchronize();
+  return out;
+}
+
+/**
+ * @brief Builds the columns of a record batch from its decoded buffers
+ */
+class column_builder {
+ public:
+  column_builder(flatbuf::RecordBatch const& batch,
+                 std::vector<rmm::device_buffer>&& buffers,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr)
+    : _nodes{*batch.nodes()}, _buffers{std::move(buffers)}, _stream{stream}, _mr{mr}
+  {
+  }
+
+  /**
+   * @brief Builds the column of the next field of the record batch
+   */
+  std::unique_ptr<column> build(flatbuf::Field const& field)
+  {
+    auto const type = to_cudf_type(field);
+    CUDF_EXPECTS(_node < _nodes.size(), "Arrow IPC record batch has too few field nodes");
+    auto const* node = _nodes.Get(_node++);
+    CUDF_EXPECTS(node->length() >= 0 && node->length() <= std::numeric_limits<size_type>::max(),
+                 "Arrow IPC field length exceeds the column size limit");
+    CUDF_EXPECTS(node->null_count() >= 0 && node->null_count() <= node->length(),
+                 "Invalid Arrow IPC field null count");
+    auto const num_rows   = static_cast<size_type>(node->length());
+    auto const null_count = static_cast<size_type>(node->null_count());
+
+    auto null_mask = next_buffer();
+    if (null_count == 0) {
+      null_mask = rmm::device_buffer{0, _stream, _mr};
+    } else {
+      CUDF_EXPECTS(null_mask.size() * 8 >= static_cast<std::size_t>(num_rows),
+                   "Arrow IPC validity buffer is too small");
+    }
+
+    switch (type.id()) {
+      case type_id::STRING: {
+        auto offsets = next_buffer();
+        auto chars   = next_buffer();
+        if (num_rows == 0) { return make_empty_column(type_id::STRING); }
+        auto const offset_type = data_type{
+          field.type_type() == flatbuf::Type_LargeUtf8 ? type_id::INT64 : type_id::INT32};
+        return make_strings_column(num_rows,
+                                   make_offsets(offset_type, num_rows, std::move(offsets)),
+                                   std::move(chars),
+                                   null_count,
+                                   std::move(null_mask));
+      }
+      case type_id::LIST: {
+        auto offsets = next_buffer();
+        auto child   = build(*field.children()->Get(0));
+        auto offsets_column =
+          num_rows == 0 ? make_empty_column(type_id::INT32)
+                        : make_offsets(data_type{type_id::INT32}, num_rows, std::move(offsets));
+        return make_lists_column(num_rows,
+                                 std::move(offsets_column),
+                                 std::move(child),
+                                 null_count,
+                                 std::move(null_mask),
+                                 _stream,
+                                 _mr);
+      }
+      case type_id::STRUCT: {
+        std::vector<std::unique_ptr<column>> children;
+        for (std::size_t i = 0; i < field_children(field); ++i) {
+          children.push_back(build(*field.children()->Get(i)));
+        }
+        return make_structs_column(
+          num_rows, std::move(children), null_count, std::move(null_mask), _stream, _mr);
+      }
+      case type_id::BOOL8: {
+        auto const bits = next_buffer();
+        CUDF_EXPECTS(bits.size() * 8 >= static_cast<std::size_t>(num_rows),
+                     "Arrow IPC boolean buffer is too small");
+        auto result =
+          make_fixed_width_column(type, num_rows, mask_state::UNALLOCATED, _stream, _mr);
+        auto const d_bits = static_cast<uint8_t const*>(bits.data());
+        thrust::transform(rmm::exec_policy_nosync(_stream),
+                          thrust::counting_iterator<size_type>(0),
+                          thrust::counting_iterator<size_type>(num_rows),
+                          result->mutable_view().begin<bool>(),
+                          cuda::proclaim_return_type<bool>([d_bits] __device__(size_type idx) {
+                            return ((d_bits[idx / 8] >> (idx % 8)) & 1) != 0;
+                          }));
+        result->set_null_mask(std::move(null_mask), null_count);
+        // the bits are freed in stream order after the transform
+        return result;
+      }
+      default: {
+        auto data = next_buffer();
+        CUDF_EXPECTS(data.size() >= static_cast<std::size_t>(num_rows) * size_of(type),
+                     "Arrow IPC data buffer is too small");
+        return std::make_unique<column>(
+          type, num_rows, std::move(data), std::move(null_mask), null_count);
+      }
+    }
+  }
+
+  /**
+   * @brief Skips the nodes and buffers of the next field of the record batch
+   */
+  void skip(flatbuf::Field const& field)
+  {
+    std::vector<bool> field_buffers;
+    _node += mark_field_buffers(field, false, field_buffers);
+    _buffer += field_buffers.size();
+  }
+
+ private:
+  rmm::device_buffer next_buffer()
+  {
+    CUDF_EXPECTS(_buffer < _buffers.size(), "Arrow IPC record batch has too few buffers");
+    return std::move(_buffers[_buffer++]);
+  }
+
+  static std::unique_ptr<column> make_offsets(data_type type,
+                                              size_type num_rows,
+                                              rmm::device_buffer&& offsets)
+  {
+    CUDF_EXPECTS(offsets.size() >= (static_cast<std::size_t>(num_rows) + 1) * size_of(type),
+                 "Arrow IPC offsets buffer is too small");
+    return std::make_unique<column>(
+      type, num_rows + 1, std::move(offsets), rmm::device_buffer{}, 0);
+  }
+
+  ::flatbuffers::Vector<flatbuf::FieldNode const*> const& _nodes;
+  std::vector<rmm::device_buffer> _buffers;
+  std::size_t _node   = 0;
+  std::size_t _buffer = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
+}  // namespace
+
+/**
+ * @brief Message index and schema of an Arrow IPC stream
+ */
+class chunked_reader::impl {
+ public:
+  impl(std::size_t chunk_read_limit,
+       std::unique_ptr<cudf::io::datasource>&& source,
+       arrow_ipc_reader_options const& options,
+       rmm::cuda_stream_view stream,
+       rmm::device_async_resource_ref mr)
+    : _chunk_read_limit{chunk_read_limit}, _source{std::move(source)}, _stream{stream}, _mr{mr}
+  {
+    std::size_t offset = 0;
+    auto schema        = read_message(*_source, offset);
+    CUDF_EXPECTS(
+      schema.has_value() && schema->message().header_type() == flatbuf::MessageHeader_Schema,
+      "Arrow IPC stream must start with a schema message");
+    _schema_message = std::move(schema->metadata);
+    CUDF_EXPECTS(this->schema().endianness() == flatbuf::Endianness_Little,
+                 "Big-endian Arrow IPC streams are not supported");
+
+    auto const& fields = this->fields();
+    if (options.get_columns().empty()) {
+      for (std::size_t i = 0; i < fields.size(); ++i) {
+        _selected.push_back(i);
+      }
+    }
+    for (auto const& name : options.get_columns()) {
+      auto const it = std::find_if(fields.begin(), fields.end(), [&](auto const* field) {
+        return field->name() != nullptr && field->name()->str() == name;
+      });
+      CUDF_EXPECTS(it != fields.end(), "Column not found in the Arrow IPC schema: " + name);
+      _selected.push_back(std::distance(fields.begin(), it));
+    }
+    _column_fields.resize(fields.size(), false);
+    for (auto const idx : _selected) {
+      _column_fields[idx] = true;
+    }
+    for (std::size_t i = 0; i < fields.size(); ++i) {
+      _num_nodes += mark_field_buffers(*fields.Get(i), _column_fields[i], _is_buffer_read);
+    }
+
+    while (auto message = read_message(*_source, offset)) {
+      auto const header = message->message().header_type();
+      CUDF_EXPECTS(header != message_header_dictionary_batch,
+                   "Dictionary-encoded Arrow IPC streams are not supported");
+      CUDF_EXPECTS(header == message_header_record_batch, "Unsupported Arrow IPC message type");
+      _batches.push_back(std::move(*message));
+    }
+  }
+
+  [[nodiscard]] bool has_next() const { return _next_batch < _batches.size(); }
+
+  table_with_metadata read_chunk()
+  {
+    auto const first       = _next_batch;
+    std::size_t chunk_size = 0;
+    while (_next_batch < _batches.size()) {
+      auto const body_size = _batches[_next_batch].body_size;
+      if (_next_batch > first and _chunk_read_limit > 0 and
+          chunk_size + body_size > _chunk_read_limit) {
+        break;
+      }
+      chunk_size += body_size;
+      ++_next_batch;
+    }
+
+    table_metadata metadata;
+    for (auto const idx : _selected) {
+      metadata.schema_info.push_back(make_name_info(*fields().Get(idx)));
+    }
+
+    if (first == _next_batch) {
+      std::vector<std::unique_ptr<column>> columns;
+      for (auto const idx : _selected) {
+        columns.push_back(make_empty_field_column(*fields().Get(idx), _stream, _mr));
+      }
+      return {std::make_unique<table>(std::move(columns)), std::move(metadata)};
+    }
+    if (_next_batch - first == 1) {
+      return {read_batch(_batches[first], _mr), std::move(metadata)};
+    }
+
+    std::vector<std::unique_ptr<table>> tables;
+    for (auto i = first; i < _next_batch; ++i) {
+      tables.push_back(read_batch(_batches[i], rmm::mr::get_current_device_resource()));
+    }
+    std::vector<table_view> views;
+    std::transform(tables.begin(), tables.end(), std::back_inserter(views), [](auto const& tbl) {
+      return tbl->view();
+    });
+    return {cudf::detail::concatenate(views, _stream, _mr), std::move(metadata)};
+  }
+
+ private:
+  [[nodiscard]] flatbuf::Schema const& schema() const
+  {
+    return *flatbuf::GetMessage(_schema_message.data())->header_as_Schema();
+  }
+
+  [[nodiscard]] auto const& fields() const
+  {
+    CUDF_EXPECTS(schema().fields() != nullptr, "Arrow IPC schema has no fields");
+    return *schema().fields();
+  }
+
+  std::unique_ptr<table> read_batch(message_info const& info, rmm::device_async_resource_ref mr)
+  {
+    auto const& batch = *static_cast<flatbuf::RecordBatch const*>(info.message().header());
+    CUDF_EXPECTS(batch.nodes() != nullptr && batch.nodes()->size() == _num_nodes &&
+                   batch.buffers() != nullptr && batch.buffers()->size() == _is_buffer_read.size(),
+                 "Arrow IPC record batch does not match the schema");
+
+    auto const h_body = _source->host_read(info.body_offset, info.body_size);
+    CUDF_EXPECTS(h_body->size() == info.body_size, "Unexpected end of the Arrow IPC stream");
+    rmm::device_buffer d_body(h_body->data(), h_body->size(), _stream);
+    auto buffers = decode_buffers(batch,
+                                  {h_body->data(), h_body->size()},
+                                  static_cast<uint8_t const*>(d_body.data()),
+                                  _is_buffer_read,
+                                  _stream,
+                                  mr);
+
+    column_builder builder(batch, std::move(buffers), _stream, mr);
+    std::vector<std::unique_ptr<column>> columns(fields().size());
+    for (std::size_t i = 0; i < fields().size(); ++i) {
+      if (_column_fields[i]) {
+        columns[i] = builder.build(*fields().Get(i));
+      } else {
+        builder.skip(*fields().Get(i));
+      }
+    }
+    std::vector<std::unique_ptr<column>> selected;
+    for (auto const idx : _selected) {
+      selected.push_back(std::move(columns[idx]));
+    }
+    CUDF_EXPECTS(std::all_of(selected.begin(),
+                             selected.end(),
+                             [&](auto const& col) { return col->size() == batch.length(); }),
+                 "Arrow IPC record batch columns have different lengths");
+    return std::make_unique<table>(std::move(selected));
+  }
+
+  std::size_t _chunk_read_limit;
+  std::unique_ptr<cudf::io::datasource> _source;
+  std::vector<uint8_t> _schema_message;
+  // Indices of the fields to read, in the order of the output columns
+  std::vector<std::size_t> _selected;
+  // Whether each field is read, in schema order
+  std::vector<bool> _column_fields;
+  // Whether each buffer of a record batch is read, and the number of field nodes
+  std::vector<bool> _is_buffer_read;
+  std::size_t _num_nodes = 0;
+  std::vector<message_info> _batches;
+  std::size_t _next_batch = 0;
+  rmm::cuda_stream_view _stream;
+  rmm::device_async_resource_ref _mr;
+};
+
+table_with_metadata read_arrow_ipc(std::unique_ptr<cudf::io::datasource>&& source,
+                                   arrow_ipc_reader_options const& options,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  return chunked_reader(0, std::move(source), options, stream, mr).read_chunk();
+}
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               arrow_ipc_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _impl{std::make_unique<impl>(chunk_read_limit, std::move(source), options, stream, mr)}
+{
+}
+
+chunked_reader::~chunked_reader() = default;
+
+bool chunked_reader::has_next() const { return _impl->has_next(); }
+
+table_with_metadata chunked_reader::read_chunk() { return _impl->read_chunk(); }
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
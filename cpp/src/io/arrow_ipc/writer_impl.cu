@@ -0,0 +1,622 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/arrow_ipc/ipc_format.hpp"
+#include "io/comp/gpuinflate.hpp"
+#include "io/comp/nvcomp_adapter.hpp"
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/detail/arrow_ipc.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace detail {
+namespace arrow_ipc {
+namespace {
+
+// Size of the LZ4 frame blocks written, matching the maximum size declared in the BD byte
+constexpr std::size_t lz4_block_size = 4 * 1024 * 1024;
+
+/**
+ * @brief Returns whether the column or any of its descendants has a non-zero offset
+ */
+bool has_offset(column_view const& col)
+{
+  return col.offset() != 0 || std::any_of(col.child_begin(), col.child_end(), [](auto const& c) {
+           return has_offset(c);
+         });
+}
+
+/**
+ * @brief Returns the Arrow time unit of a timestamp or duration type
+ */
+flatbuf::TimeUnit to_time_unit(type_id id)
+{
+  switch (id) {
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::DURATION_SECONDS: return flatbuf::TimeUnit_SECOND;
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::DURATION_MILLISECONDS: return flatbuf::TimeUnit_MILLISECOND;
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::DURATION_MICROSECONDS: return flatbuf::TimeUnit_MICROSECOND;
+    case type_id::TIMESTAMP_NANOSECONDS:
+    case type_id::DURATION_NANOSECONDS: return flatbuf::TimeUnit_NANOSECOND;
+    default: CUDF_FAIL("Unsupported time unit for Arrow IPC");
+  }
+}
+
+/**
+ * @brief Returns whether the strings column uses 64-bit offsets
+ */
+bool has_large_offsets(column_view const& col)
+{
+  return col.num_children() > 0 &&
+         col.child(strings_column_view::offsets_column_index).type().id() == type_id::INT64;
+}
+
+/**
+ * @brief Builds the schema field of a column and its descendants
+ *
+ * @param fbb Builder of the schema message
+ * @param col The column
+ * @param meta Metadata of the column, or `nullptr` if none was provided
+ * @return Offset of the field in the builder
+ */
+::flatbuffers::Offset<flatbuf::Field> build_field(::flatbuffers::FlatBufferBuilder& fbb,
+                                                  column_view const& col,
+                                                  column_in_metadata const* meta)
+{
+  std::vector<::flatbuffers::Offset<flatbuf::Field>> children;
+  auto const child_meta = [&](int index) -> column_in_metadata const* {
+    return (meta != nullptr && index < meta->num_children()) ? &meta->child(index) : nullptr;
+  };
+
+  flatbuf::Type type_type;
+  ::flatbuffers::Offset<void> type;
+  auto const id = col.type().id();
+  switch (id) {
+    case type_id::INT8:
+    case type_id::INT16:
+    case type_id::INT32:
+    case type_id::INT64:
+    case type_id::UINT8:
+    case type_id::UINT16:
+    case type_id::UINT32:
+    case type_id::UINT64: {
+      auto const bit_width = static_cast<int32_t>(size_of(col.type()) * 8);
+      type_type            = flatbuf::Type_Int;
+      type                 = flatbuf::CreateInt(fbb, bit_width, is_signed(col.type())).Union();
+      break;
+    }
+    case type_id::FLOAT32:
+    case type_id::FLOAT64: {
+      auto const precision =
+        id == type_id::FLOAT32 ? flatbuf::Precision_SINGLE : flatbuf::Precision_DOUBLE;
+      type_type = flatbuf::Type_FloatingPoint;
+      type      = flatbuf::CreateFloatingPoint(fbb, precision).Union();
+      break;
+    }
+    case type_id::BOOL8:
+      type_type = flatbuf::Type_Bool;
+      type      = flatbuf::CreateBool(fbb).Union();
+      break;
+    case type_id::STRING:
+      if (has_large_offsets(col)) {
+        type_type = flatbuf::Type_LargeUtf8;
+        type      = flatbuf::CreateLargeUtf8(fbb).Union();
+      } else {
+        type_type = flatbuf::Type_Utf8;
+        type      = flatbuf::CreateUtf8(fbb).Union();
+      }
+      break;
+    case type_id::DECIMAL32:
+    case type_id::DECIMAL64:
+    case type_id::DECIMAL128: {
+      // decimals keep their cudf width, with the maximum precision of that width
+      auto const precision = id == type_id::DECIMAL32 ? 9 : id == type_id::DECIMAL64 ? 18 : 38;
+      auto const bit_width = static_cast<int32_t>(size_of(col.type()) * 8);
+      type_type            = flatbuf::Type_Decimal;
+      type = flatbuf::CreateDecimal(fbb, precision, -col.type().scale(), bit_width).Union();
+      break;
+    }
+    case type_id::TIMESTAMP_DAYS:
+      type_type = flatbuf::Type_Date;
+      type      = flatbuf::CreateDate(fbb, flatbuf::DateUnit_DAY).Union();
+      break;
+    case type_id::TIMESTAMP_SECONDS:
+    case type_id::TIMESTAMP_MILLISECONDS:
+    case type_id::TIMESTAMP_MICROSECONDS:
+    case type_id::TIMESTAMP_NANOSECONDS:
+      type_type = flatbuf::Type_Timestamp;
+      type      = flatbuf::CreateTimestamp(fbb, to_time_unit(id)).Union();
+      break;
+    case type_id::DURATION_SECONDS:
+    case type_id::DURATION_MILLISECONDS:
+    case type_id::DURATION_MICROSECONDS:
+    case type_id::DURATION_NANOSECONDS:
+      type_type = flatbuf::Type_Duration;
+      type      = flatbuf::CreateDuration(fbb, to_time_unit(id)).Union();
+      break;
+    case type_id::LIST:
+      children.push_back(build_field(
+        fbb, lists_column_view{col}.child(), child_meta(lists_column_view::child_column_index)));
+      type_type = flatbuf::Type_List;
+      type      = flatbuf::CreateList(fbb).Union();
+      break;
+    case type_id::STRUCT:
+      for (size_type i = 0; i < col.num_children(); ++i) {
+        children.push_back(build_field(fbb, col.child(i), child_meta(i)));
+      }
+      type_type = flatbuf::Type_Struct_;
+      type      = flatbuf::CreateStruct_(fbb).Union();
+      break;
+    default: CUDF_FAIL("Unsupported column type for Arrow IPC: " + type_to_name(col.type()));
+  }
+
+  auto const nullable =
+    (meta != nullptr && meta->is_nullability_defined()) ? meta->nullable() : true;
+  auto const name = meta != nullptr ? meta->get_name() : std::string{};
+  return flatbuf::CreateFieldDirect(fbb, name.c_str(), nullable, type_type, type, 0, &children);
+}
+
+/**
+ * @brief Field nodes and device buffers of a record batch
+ */
+struct record_batch_buffers {
+  std::vector<flatbuf::FieldNode> nodes;
+  std::vector<device_span<uint8_t const>> buffers;
+  // Buffers converted from the column data, e.g. the bitmasks of boolean columns
+  std::vector<std::unique_ptr<rmm::device_buffer>> converted;
+};
+
+/**
+ * @brief Appends the field nodes and buffers of a column and its descendants
+ *
+ * The column and its descendants must not have an offset.
+ */
+void flatten_column(column_view const& col, record_batch_buffers& out, rmm::cuda_stream_view stream)
+{
+  auto const size     = static_cast<std::size_t>(col.size());
+  auto const bytes_of = [](column_view const& c, std::size_t count) {
+    return device_span<uint8_t const>{c.head<uint8_t>(), count * size_of(c.type())};
+  };
+
+  auto const null_count = col.null_count();
+  out.nodes.emplace_back(col.size(), null_count);
+  if (null_count > 0) {
+    out.buffers.emplace_back(reinterpret_cast<uint8_t const*>(col.null_mask()),
+                             cudf::util::div_rounding_up_safe<std::size_t>(size, 8));
+  } else {
+    out.buffers.emplace_back();
+  }
+
+  switch (col.type().id()) {
+    case type_id::STRING: {
+      if (size == 0 or col.num_children() == 0) {
+        out.buffers.emplace_back();
+        out.buffers.emplace_back();
+        break;
+      }
+      strings_column_view const scv{col};
+      out.buffers.push_back(bytes_of(scv.offsets(), size + 1));
+      out.buffers.emplace_back(reinterpret_cast<uint8_t const*>(scv.chars_begin(stream)),
+                               static_cast<std::size_t>(scv.chars_size(stream)));
+      break;
+    }
+    case type_id::LIST: {
+      lists_column_view const lcv{col};
+      out.buffers.push_back(size == 0 ? device_span<uint8_t const>{}
+                                      : bytes_of(lcv.offsets(), size + 1));
+      flatten_column(lcv.child(), out, stream);
+      break;
+    }
+    case type_id::STRUCT:
+      for (size_type i = 0; i < col.num_children(); ++i) {
+        flatten_column(col.child(i), out, stream);
+      }
+      break;
+    case type_id::BOOL8: {
+      auto mask = std::move(cudf::detail::bools_to_mask(
+                              col, stream, rmm::mr::get_current_device_resource())
+                              .first);
+      out.buffers.emplace_back(static_cast<uint8_t const*>(mask->data()),
+                               cudf::util::div_rounding_up_safe<std::size_t>(size, 8));
+      out.converted.push_back(std::move(mask));
+      break;
+    }
+    default: out.buffers.push_back(bytes_of(col, size)); break;
+  }
+}
+
+/**
+ * @brief A copy from the device to a position of the host body
+ */
+struct body_copy {
+  std::size_t dst;
+  uint8_t const* src;
+  std::size_t size;
+};
+
+/**
+ * @brief Host body of a record batch and the location of each buffer within it
+ */
+struct record_batch_body {
+  cudf::detail::pinned_host_vector<uint8_t> data;
+  std::vector<flatbuf::Buffer> buffers;
+};
+
+/**
+ * @brief Copies the buffers of a record batch into a host body, without compression
+ */
+record_batch_body encode_uncompressed(std::vector<device_span<uint8_t const>> const& buffers,
+                                      rmm::cuda_stream_view stream)
+{
+  record_batch_body body;
+  std::size_t pos = 0;
+  for (auto const& buffer : buffers) {
+    body.buffers.emplace_back(pos, buffer.size());
+    pos += cudf::util::round_up_safe(buffer.size(), ipc_alignment);
+  }
+  body.data.resize(pos);
+  for (std::size_t i = 0; i < buffers.size(); ++i) {
+    if (buffers[i].empty()) { continue; }
+    CUDF_CUDA_TRY(cudaMemcpyAsync(body.data.data() + body.buffers[i].offset(),
+                                  buffers[i].data(),
+                                  buffers[i].size(),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+  stream.synchronize();
+  return body;
+}
+
+/**
+ * @brief Compresses the buffers of a record batch with nvCOMP into a host body
+ *
+ * Each LZ4 buffer is written as an LZ4 frame of independent 4 MiB blocks that are compressed as
+ * separate chunks; each ZSTD buffer is compressed as one chunk. Blocks and buffers that do not
+ * get smaller are stored uncompressed.
+ */
+record_batch_body encode_compressed(std::vector<device_span<uint8_t const>> const& buffers,
+                                    nvcomp::compression_type codec,
+                                    rmm::cuda_stream_view stream)
+{
+  auto const max_allowed = nvcomp::compress_max_allowed_chunk_size(codec);
+  auto const is_lz4      = codec == nvcomp::compression_type::LZ4;
+  auto const chunk_limit = is_lz4 ? std::min(lz4_block_size, max_allowed.value_or(lz4_block_size))
+                                  : max_allowed.value_or(std::numeric_limits<uint32_t>::max());
+
+  // input chunks and the range of chunks of each buffer
+  std::vector<device_span<uint8_t const>> inputs;
+  std::vector<std::pair<std::size_t, std::size_t>> buffer_chunks;
+  std::size_t max_chunk_size = 0;
+  for (auto const& buffer : buffers) {
+    auto const first = inputs.size();
+    if (is_lz4) {
+      for (std::size_t pos = 0; pos < buffer.size(); pos += chunk_limit) {
+        inputs.push_back(buffer.subspan(pos, std::min(chunk_limit, buffer.size() - pos)));
+      }
+    } else if (not buffer.empty() and buffer.size() <= chunk_limit) {
+      inputs.push_back(buffer);
+    }
+    for (auto i = first; i < inputs.size(); ++i) {
+      max_chunk_size = std::max(max_chunk_size, inputs[i].size());
+    }
+    buffer_chunks.emplace_back(first, inputs.size());
+  }
+
+  std::vector<compression_result> results;
+  rmm::device_buffer d_compressed;
+  std::size_t slot_size = 0;
+  if (not inputs.empty()) {
+    slot_size = cudf::util::round_up_safe(
+      nvcomp::compress_max_output_chunk_size(codec, static_cast<uint32_t>(max_chunk_size)),
+      std::size_t{1} << nvcomp::compress_output_alignment_bits(codec));
+    d_compressed = rmm::device_buffer(inputs.size() * slot_size, stream);
+    std::vector<device_span<uint8_t>> outputs;
+    for (std::size_t i = 0; i < inputs.size(); ++i) {
+      outputs.emplace_back(static_cast<uint8_t*>(d_compressed.data()) + i * slot_size, slot_size);
+    }
+    auto const mr        = rmm::mr::get_current_device_resource();
+    auto const d_inputs  = cudf::detail::make_device_uvector_async(inputs, stream, mr);
+    auto const d_outputs = cudf::detail::make_device_uvector_async(outputs, stream, mr);
+    rmm::device_uvector<compression_result> d_results(inputs.size(), stream);
+    nvcomp::batched_compress(codec, d_inputs, d_outputs, d_results, stream);
+    results = cudf::detail::make_std_vector_sync(d_results, stream);
+  }
+  auto const compressed_chunk = [&](std::size_t i) -> std::optional<std::size_t> {
+    if (results[i].status != compression_status::SUCCESS or
+        results[i].bytes_written >= inputs[i].size()) {
+      return std::nullopt;
+    }
+    return results[i].bytes_written;
+  };
+  auto const* d_slots = static_cast<uint8_t const*>(d_compressed.data());
+
+  // host bytes written by the encoder; the copies from the device fill the space left in between
+  std::vector<uint8_t> header;
+  std::vector<std::pair<std::size_t, std::vector<uint8_t>>> host_pieces;
+  std::vector<body_copy> copies;
+  record_batch_body body;
+  std::size_t pos = 0;
+  auto const put_u32 = [&](std::vector<uint8_t>& out, uint32_t value) {
+    auto const at = out.size();
+    out.resize(at + sizeof(value));
+    std::memcpy(out.data() + at, &value, sizeof(value));
+  };
+
+  for (std::size_t b = 0; b < buffers.size(); ++b) {
+    auto const& buffer = buffers[b];
+    if (buffer.empty()) {
+      body.buffers.emplace_back(pos, 0);
+      continue;
+    }
+    auto const [first, last] = buffer_chunks[b];
+
+    // encoded size of the buffer, or `std::nullopt` if it is stored uncompressed
+    std::optional<std::size_t> encoded_size;
+    if (is_lz4) {
+      std::size_t size = sizeof(uint32_t) + 3 + sizeof(uint32_t);
+      for (auto i = first; i < last; ++i) {
+        size += sizeof(uint32_t) + compressed_chunk(i).value_or(inputs[i].size());
+      }
+      if (size < buffer.size()) { encoded_size = size; }
+    } else if (first != last) {
+      encoded_size = compressed_chunk(first);
+    }
+
+    auto const start    = pos;
+    auto const data_pos = start + compressed_length_size;
+    int64_t const prefix = encoded_size.has_value() ? static_cast<int64_t>(buffer.size())
+                                                    : uncompressed_buffer_length_marker;
+    std::vector<uint8_t> bytes(compressed_length_size);
+    std::memcpy(bytes.data(), &prefix, compressed_length_size);
+
+    if (not encoded_size.has_value()) {
+      copies.push_back({data_pos, buffer.data(), buffer.size()});
+      host_pieces.emplace_back(start, std::move(bytes));
+      pos = data_pos + buffer.size();
+    } else if (not is_lz4) {
+      copies.push_back({data_pos, d_slots + first * slot_size, *encoded_size});
+      host_pieces.emplace_back(start, std::move(bytes));
+      pos = data_pos + *encoded_size;
+    } else {
+      put_u32(bytes, lz4_frame_magic);
+      std::array<uint8_t, 2> const descriptor{lz4_flg_version | lz4_flg_block_independence,
+                                              lz4_bd_max_size_4mb};
+      bytes.insert(bytes.end(), descriptor.begin(), descriptor.end());
+      bytes.push_back(lz4_header_checksum(descriptor.data(), descriptor.size()));
+      host_pieces.emplace_back(start, std::move(bytes));
+      auto block_pos = data_pos + sizeof(uint32_t) + 3;
+      for (auto i = first; i < last; ++i) {
+        auto const compressed = compressed_chunk(i);
+        auto const block_size = compressed.value_or(inputs[i].size());
+        std::vector<uint8_t> word;
+        put_u32(word,
+                static_cast<uint32_t>(block_size) |
+                  (compressed.has_value() ? 0u : lz4_block_uncompressed_bit));
+        host_pieces.emplace_back(block_pos, std::move(word));
+        block_pos += sizeof(uint32_t);
+        auto const* src = compressed.has_value() ? d_slots + i * slot_size : inputs[i].data();
+        copies.push_back({block_pos, src, block_size});
+        block_pos += block_size;
+      }
+      std::vector<uint8_t> end_mark;
+      put_u32(end_mark, 0);
+      host_pieces.emplace_back(block_pos, std::move(end_mark));
+      pos = block_pos + sizeof(uint32_t);
+    }
+    body.buffers.emplace_back(start, pos - start);
+    pos = cudf::util::round_up_safe(pos, ipc_alignment);
+  }
+
+  body.data.resize(pos);
+  for (auto const& [at, bytes] : host_pieces) {
+    std::memcpy(body.data.data() + at, bytes.data(), bytes.size());
+  }
+  for (auto const& copy : copies) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      body.data.data() + copy.dst, copy.src, copy.size, cudaMemcpyDefault, stream.value()));
+  }
+  stream.synchronize();
+  return body;
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation of the Arrow IPC stream writer
+ */
+class writer::impl {
+ public:
+  impl(std::unique_ptr<data_sink> sink,
+       std::optional<table_input_metadata> metadata,
+       compression_type compression,
+       rmm::cuda_stream_view stream)
+    : _sink{std::move(sink)}, _metadata{std::move(metadata)}, _stream{stream}
+  {
+    switch (compression) {
+      case compression_type::NONE: break;
+      case compression_type::LZ4: _codec = nvcomp::compression_type::LZ4; break;
+      case compression_type::ZSTD: _codec = nvcomp::compression_type::ZSTD; break;
+      default: CUDF_FAIL("Arrow IPC streams only support LZ4 and ZSTD compression");
+    }
+    if (_codec.has_value()) {
+      auto const disabled = nvcomp::is_compression_disabled(*_codec);
+      CUDF_EXPECTS(not disabled.has_value(),
+                   "Arrow IPC buffer compression unavailable: " + disabled.value_or(""));
+    }
+  }
+
+  ~impl() { close(); }
+
+  void write(table_view const& input)
+  {
+    CUDF_EXPECTS(not _closed, "Data has already been flushed to out and closed");
+    CUDF_EXPECTS(
+      not _metadata.has_value() ||
+        _metadata->column_metadata.size() == static_cast<std::size_t>(input.num_columns()),
+      "Mismatch in table and metadata column count");
+
+    // buffers are written from the start of each column, so sliced columns are copied first
+    std::unique_ptr<table> copied;
+    auto view = input;
+    if (std::any_of(input.begin(), input.end(), [](auto const& c) { return has_offset(c); })) {
+      copied = std::make_unique<table>(input, _stream);
+      view   = copied->view();
+    }
+
+    auto schema = build_schema(view);
+    if (_schema.empty()) {
+      write_message(schema, {});
+      _schema = std::move(schema);
+    } else {
+      CUDF_EXPECTS(schema == _schema, "The table schema differs from the schema of the stream");
+    }
+
+    record_batch_buffers batch;
+    for (auto const& col : view) {
+      flatten_column(col, batch, _stream);
+    }
+    auto const body = _codec.has_value() ? encode_compressed(batch.buffers, *_codec, _stream)
+                                         : encode_uncompressed(batch.buffers, _stream);
+
+    ::flatbuffers::FlatBufferBuilder fbb;
+    auto const compression =
+      _codec.has_value()
+        ? flatbuf::CreateBodyCompression(fbb,
+                                         *_codec == nvcomp::compression_type::LZ4
+                                           ? flatbuf::CompressionType_LZ4_FRAME
+                                           : flatbuf::CompressionType_ZSTD,
+                                         flatbuf::BodyCompressionMethod_BUFFER)
+        : 0;
+    auto const header = flatbuf::CreateRecordBatchDirect(
+      fbb, view.num_rows(), &batch.nodes, &body.buffers, compression);
+    fbb.Finish(flatbuf::CreateMessage(fbb,
+                                      flatbuf::MetadataVersion_V5,
+                                      message_header_record_batch,
+                                      header.Union(),
+                                      static_cast<int64_t>(body.data.size())));
+    write_message({fbb.GetBufferPointer(), fbb.GetSize()}, {body.data.data(), body.data.size()});
+  }
+
+  void close()
+  {
+    if (_closed) { return; }
+    std::array<uint32_t, 2> const end_of_stream{continuation_marker, 0};
+    _sink->host_write(end_of_stream.data(), sizeof(end_of_stream));
+    _sink->flush();
+    _closed = true;
+  }
+
+ private:
+  /**
+   * @brief Returns the serialized schema message of a table
+   */
+  [[nodiscard]] std::vector<uint8_t> build_schema(table_view const& table) const
+  {
+    ::flatbuffers::FlatBufferBuilder fbb;
+    std::vector<::flatbuffers::Offset<flatbuf::Field>> fields;
+    for (size_type i = 0; i < table.num_columns(); ++i) {
+      fields.push_back(build_field(
+        fbb, table.column(i), _metadata.has_value() ? &_metadata->column_metadata[i] : nullptr));
+    }
+    auto const schema = flatbuf::CreateSchemaDirect(fbb, flatbuf::Endianness_Little, &fields);
+    fbb.Finish(flatbuf::CreateMessage(
+      fbb, flatbuf::MetadataVersion_V5, flatbuf::MessageHeader_Schema, schema.Union(), 0));
+    return {fbb.GetBufferPointer(), fbb.GetBufferPointer() + fbb.GetSize()};
+  }
+
+  /**
+   * @brief Writes an encapsulated message: the continuation marker, the padded metadata length,
+   * the metadata and the body
+   */
+  void write_message(host_span<uint8_t const> metadata, host_span<uint8_t const> body)
+  {
+    auto const padded_size =
+      cudf::util::round_up_safe(metadata.size() + 2 * sizeof(uint32_t), ipc_alignment) -
+      2 * sizeof(uint32_t);
+    std::array<uint32_t, 2> const prefix{continuation_marker, static_cast<uint32_t>(padded_size)};
+    _sink->host_write(prefix.data(), sizeof(prefix));
+    _sink->host_write(metadata.data(), metadata.size());
+    std::array<uint8_t, ipc_alignment> const padding{};
+    _sink->host_write(padding.data(), padded_size - metadata.size());
+    if (not body.empty()) { _sink->host_write(body.data(), body.size()); }
+  }
+
+  std::unique_ptr<data_sink> _sink;
+  std::optional<table_input_metadata> _metadata;
+  std::optional<nvcomp::compression_type> _codec;
+  rmm::cuda_stream_view _stream;
+  // Serialized schema message, set by the first write
+  std::vector<uint8_t> _schema;
+  bool _closed = false;
+};
+
+writer::writer(std::unique_ptr<data_sink> sink,
+               arrow_ipc_writer_options const& options,
+               rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl>(
+      std::move(sink), options.get_metadata(), options.get_compression(), stream)}
+{
+}
+
+writer::writer(std::unique_ptr<data_sink> sink,
+               chunked_arrow_ipc_writer_options const& options,
+               rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl>(
+      std::move(sink), options.get_metadata(), options.get_compression(), stream)}
+{
+}
+
+writer::~writer() = default;
+
+void writer::write(table_view const& table) { _impl->write(table); }
+
+void writer::close() { _impl->close(); }
+
+}  // namespace arrow_ipc
+}  // namespace detail
+}  // namespace io
+}  // namespace cudf
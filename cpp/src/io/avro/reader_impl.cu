@@ -20,6 +20,7 @@
 #include "io/utilities/column_buffer.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
@@ -28,6 +29,7 @@
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_buffer.hpp>
@@ -43,6 +45,8 @@
 
 #include <nvcomp/snappy.h>
 
+#include <algorithm>
+#include <future>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -119,16 +123,16 @@ class metadata : public file_metadata {
   /**
    * @brief Initializes the parser and filters down to a subset of rows
    *
-   * @param[in,out] row_start Starting row of the selection
-   * @param[in,out] row_count Total number of rows selected
+   * @param[in] file_data Contents of the whole file
+   * @param[in] row_start Starting row of the selection
+   * @param[in] row_count Maximum number of rows to select, or negative to select all rows
    */
-  void init_and_select_rows(size_type& row_start, size_type& row_count)
+  void init_and_select_rows(datasource::buffer const& file_data,
+                            size_type row_start,
+                            size_type row_count)
   {
-    auto const buffer = source->host_read(0, source->size());
-    avro::container pod(buffer->data(), buffer->size());
+    avro::container pod(file_data.data(), file_data.size());
     CUDF_EXPECTS(pod.parse(this, row_count, row_start), "Cannot parse metadata");
-    row_start = skip_rows;
-    row_count = num_rows;
   }
 
   /**
@@ -481,24 +485,32 @@ std::vector<column_buffer> decode_data(metadata& meta,
   return out_buffers;
 }
 
-table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
-                              avro_reader_options const& options,
-                              rmm::cuda_stream_view stream,
-                              rmm::device_async_resource_ref mr)
+namespace {
+
+/**
+ * @brief Reads the rows and columns selected from a single Avro file.
+ *
+ * @param meta Metadata of the file, with the rows selected
+ * @param source Input `datasource` object of the file
+ * @param file_data Contents of the whole file
+ * @param column_names Names of the columns to read, or empty to read all columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return The set of columns along with table metadata
+ */
+table_with_metadata read_selected_rows(metadata& meta,
+                                       datasource& source,
+                                       datasource::buffer const& file_data,
+                                       std::vector<std::string> const& column_names,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
 {
-  auto skip_rows = options.get_skip_rows();
-  auto num_rows  = options.get_num_rows();
   std::vector<std::unique_ptr<column>> out_columns;
   table_metadata metadata_out;
 
-  // Open the source Avro dataset metadata
-  auto meta = metadata(source.get());
-
-  // Select and read partial metadata / schema within the subset of rows
-  meta.init_and_select_rows(skip_rows, num_rows);
-
   // Select only columns required by the options
-  auto selected_columns = meta.select_columns(options.get_columns());
+  auto selected_columns = meta.select_columns(column_names);
   if (not selected_columns.empty()) {
     // Get a list of column data types
     std::vector<data_type> column_types;
@@ -512,20 +524,21 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
 
     if (meta.num_rows > 0) {
       rmm::device_buffer block_data;
-      if (source->is_device_read_preferred(meta.selected_data_size)) {
+      if (source.is_device_read_preferred(meta.selected_data_size)) {
         block_data      = rmm::device_buffer{meta.selected_data_size, stream};
-        auto read_bytes = source->device_read(meta.block_list[0].offset,
-                                              meta.selected_data_size,
-                                              static_cast<uint8_t*>(block_data.data()),
-                                              stream);
+        auto read_bytes = source.device_read(meta.block_list[0].offset,
+                                             meta.selected_data_size,
+                                             static_cast<uint8_t*>(block_data.data()),
+                                             stream);
         block_data.resize(read_bytes, stream);
       } else {
-        auto const buffer = source->host_read(meta.block_list[0].offset, meta.selected_data_size);
-        block_data        = rmm::device_buffer{buffer->data(), buffer->size(), stream};
+        // The blocks are copied from the file contents that were read for the metadata
+        block_data = rmm::device_buffer{
+          file_data.data() + meta.block_list[0].offset, meta.selected_data_size, stream};
       }
 
       if (meta.codec != "" && meta.codec != "null") {
-        auto decomp_block_data = decompress_data(*source, meta, block_data, stream);
+        auto decomp_block_data = decompress_data(source, meta, block_data, stream);
         block_data             = std::move(decomp_block_data);
       } else {
         auto dst_ofs = meta.block_list[0].offset;
@@ -587,7 +600,7 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
                                      block_data,
                                      dict,
                                      d_global_dict,
-                                     num_rows,
+                                     meta.num_rows,
                                      selected_columns,
                                      column_types,
                                      stream,
@@ -618,6 +631,133 @@ table_with_metadata read_avro(std::unique_ptr<cudf::io::datasource>&& source,
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata_out)};
 }
 
+/**
+ * @brief Reads the given Avro files into a single table.
+ *
+ * @param sources Input `datasource` objects of the files
+ * @param column_names Names of the columns to read, or empty to read all columns
+ * @param[in,out] skip_rows Number of rows to skip, updated with the number left to skip
+ * @param[in,out] num_rows Number of rows to read, or negative to read all rows, updated with the
+ * number left to read
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ *
+ * @return The set of columns along with table metadata
+ */
+table_with_metadata read_sources(host_span<std::unique_ptr<datasource> const> sources,
+                               std::vector<std::string> const& column_names,
+                               size_type& skip_rows,
+                               size_type& num_rows,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(not sources.empty(), "At least one source is required");
+
+  // The contents of each file are read on a separate thread, so the read of the next file
+  // overlaps the decompression and decoding of the current one
+  auto const read_file = [&](std::size_t source_idx) {
+    return std::async(std::launch::async, [source = sources[source_idx].get()] {
+      return source->host_read(0, source->size());
+    });
+  };
+
+  std::vector<table_with_metadata> tables;
+  auto next_file_data = read_file(0);
+  for (std::size_t source_idx = 0; source_idx < sources.size(); ++source_idx) {
+    auto const file_data = next_file_data.get();
+
+    // Open the source Avro dataset metadata and select the rows that remain to be read
+    auto meta = metadata(sources[source_idx].get());
+    meta.init_and_select_rows(*file_data, skip_rows, num_rows);
+
+    // Rows are only taken from this file once all rows to skip have been skipped
+    skip_rows -= meta.block_list.empty() ? std::min(skip_rows, meta.total_num_rows) : skip_rows;
+    if (num_rows >= 0) { num_rows -= meta.num_rows; }
+
+    auto const is_last_source = (source_idx + 1 == sources.size()) or num_rows == 0;
+    if (not is_last_source) { next_file_data = read_file(source_idx + 1); }
+
+    tables.push_back(
+      read_selected_rows(meta, *sources[source_idx], *file_data, column_names, stream, mr));
+    if (is_last_source) { break; }
+  }
+  if (tables.size() == 1) { return std::move(tables.front()); }
+
+  std::vector<table_view> table_views;
+  table_metadata metadata_out;
+  metadata_out.schema_info = tables.front().metadata.schema_info;
+  metadata_out.user_data   = tables.front().metadata.user_data;
+  auto const has_same_name = [](auto const& lhs, auto const& rhs) { return lhs.name == rhs.name; };
+  for (auto const& table : tables) {
+    auto const& schema_info = table.metadata.schema_info;
+    CUDF_EXPECTS(schema_info.size() == metadata_out.schema_info.size() and
+                   std::equal(schema_info.begin(),
+                              schema_info.end(),
+                              metadata_out.schema_info.begin(),
+                              has_same_name),
+                 "All sources must have the same columns");
+    CUDF_EXPECTS(cudf::have_same_types(table.tbl->view(), tables.front().tbl->view()),
+                 "All sources must have the same column types",
+                 cudf::data_type_error);
+    table_views.push_back(table.tbl->view());
+    metadata_out.per_file_user_data.push_back(table.metadata.per_file_user_data.front());
+  }
+
+  return {cudf::detail::concatenate(table_views, stream, mr), std::move(metadata_out)};
+}
+
+}  // namespace
+
+table_with_metadata read_avro(std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                              avro_reader_options const& options,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
+  auto skip_rows = options.get_skip_rows();
+  auto num_rows  = options.get_num_rows();
+  return read_sources(sources, options.get_columns(), skip_rows, num_rows, stream, mr);
+}
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<cudf::io::datasource>>&& sources,
+                               avro_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _chunk_read_limit{chunk_read_limit},
+    _sources{std::move(sources)},
+    _columns{options.get_columns()},
+    _skip_rows{options.get_skip_rows()},
+    _num_rows{options.get_num_rows()},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(not _sources.empty(), "At least one source is required");
+}
+
+bool chunked_reader::has_next() const
+{
+  return _next_source < _sources.size() and (_num_rows != 0 or _next_source == 0);
+}
+
+table_with_metadata chunked_reader::read_chunk()
+{
+  if (not has_next()) { return table_with_metadata{std::make_unique<table>(), {}}; }
+
+  // Each chunk reads whole files, at least one, whose total size is within the limit
+  auto end_source = _next_source + 1;
+  auto chunk_size = _sources[_next_source]->size();
+  while (end_source < _sources.size() and _chunk_read_limit > 0 and
+         chunk_size + _sources[end_source]->size() <= _chunk_read_limit) {
+    chunk_size += _sources[end_source]->size();
+    ++end_source;
+  }
+
+  auto const chunk_sources = host_span<std::unique_ptr<datasource> const>{
+    _sources.data() + _next_source, end_source - _next_source};
+  _next_source = end_source;
+  return read_sources(chunk_sources, _columns, _skip_rows, _num_rows, _stream, _mr);
+}
+
 }  // namespace avro
 }  // namespace detail
 }  // namespace io
@@ -19,6 +19,8 @@
 #include <cudf/io/types.hpp>
 #include <cudf/utilities/span.hpp>
 
+#include <rmm/cuda_stream_view.hpp>
+
 #include <memory>
 #include <string>
 #include <vector>
@@ -38,11 +40,39 @@ namespace io {
  */
 std::vector<uint8_t> decompress(compression_type compression, host_span<uint8_t const> src);
 
+/**
+ * @brief Decompresses a system memory buffer into a given output buffer.
+ *
+ * @param compression Type of compression of the input data
+ * @param src Compressed host buffer
+ * @param dst Host buffer for the decompressed output
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Size of the decompressed output
+ */
 size_t decompress(compression_type compression,
                   host_span<uint8_t const> src,
                   host_span<uint8_t> dst,
                   rmm::cuda_stream_view stream);
 
+/**
+ * @brief Decompresses a batch of system memory buffers in parallel.
+ *
+ * The buffers are decompressed on a pool of host threads, except for ZSTD buffers, which are
+ * decompressed on the device in a single batch.
+ *
+ * @param compression Type of compression of the input data
+ * @param inputs Compressed host buffers
+ * @param outputs Host buffers for the decompressed outputs, one for each input
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ *
+ * @return Sizes of the decompressed outputs
+ */
+std::vector<size_t> decompress(compression_type compression,
+                               host_span<host_span<uint8_t const> const> inputs,
+                               host_span<host_span<uint8_t> const> outputs,
+                               rmm::cuda_stream_view stream);
+
 /**
  * @brief GZIP header flags
  * See https://tools.ietf.org/html/rfc1952
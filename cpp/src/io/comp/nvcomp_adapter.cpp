@@ -19,11 +19,18 @@
 #include "nvcomp_adapter.cuh"
 
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/integer_utils.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/error.hpp>
 
 #include <nvcomp/lz4.h>
 #include <nvcomp/snappy.h>
 
+#include <algorithm>
 #include <mutex>
+#include <optional>
+#include <shared_mutex>
 
 #define NVCOMP_DEFLATE_HEADER <nvcomp/deflate.h>
 #if __has_include(NVCOMP_DEFLATE_HEADER)
@@ -140,6 +147,87 @@ std::string compression_type_name(compression_type compression)
   return "compression_type(" + std::to_string(static_cast<int>(compression)) + ")";
 }
 
+size_t sub_batch_size(size_t num_chunks,
+                      size_t batch_scratch_size,
+                      size_t max_scratch_size,
+                      size_t sm_count)
+{
+  if (num_chunks == 0 or batch_scratch_size <= max_scratch_size) { return num_chunks; }
+
+  auto const chunk_scratch_size = cudf::util::div_rounding_up_safe(batch_scratch_size, num_chunks);
+  auto const batch_size = std::max<size_t>(1, max_scratch_size / chunk_scratch_size);
+  // Split batches fill whole waves of the device when they are large enough
+  return batch_size > sm_count ? batch_size - batch_size % sm_count : batch_size;
+}
+
+namespace {
+
+/**
+ * @brief Returns the limit on the scratch space of a single nvCOMP call.
+ *
+ * Defaults to a quarter of the device memory, and can be set with the
+ * `LIBCUDF_NVCOMP_SCRATCH_LIMIT` environment variable.
+ */
+size_t batch_scratch_limit()
+{
+  size_t free_memory  = 0;
+  size_t total_memory = 0;
+  CUDF_CUDA_TRY(cudaMemGetInfo(&free_memory, &total_memory));
+  return detail::getenv_or<size_t>("LIBCUDF_NVCOMP_SCRATCH_LIMIT", total_memory / 4);
+}
+
+size_t device_sm_count()
+{
+  int device = 0;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  int sm_count = 0;
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&sm_count, cudaDevAttrMultiProcessorCount, device));
+  return sm_count;
+}
+
+/**
+ * @brief Runs a batched nvCOMP operation in sub-batches whose scratch space fits in device memory.
+ *
+ * The batch is split when its scratch space exceeds the limit, and split further whenever the
+ * scratch allocation fails, instead of failing the whole operation.
+ *
+ * @param num_chunks Number of chunks in the batch
+ * @param temp_size_fn Function that returns the scratch size needed for a number of chunks
+ * @param batch_fn Function that processes a number of chunks, starting at the given chunk, with
+ * the given scratch buffer
+ * @param stream CUDA stream to use
+ */
+template <typename TempSizeFn, typename BatchFn>
+void process_in_sub_batches(size_t num_chunks,
+                            TempSizeFn const& temp_size_fn,
+                            BatchFn const& batch_fn,
+                            rmm::cuda_stream_view stream)
+{
+  if (num_chunks == 0) { return; }
+
+  auto const sm_count = device_sm_count();
+  auto batch_size =
+    sub_batch_size(num_chunks, temp_size_fn(num_chunks), batch_scratch_limit(), sm_count);
+  std::optional<rmm::device_buffer> scratch;
+  while (not scratch.has_value()) {
+    auto const scratch_size = temp_size_fn(batch_size);
+    try {
+      scratch.emplace(scratch_size, stream);
+    } catch (rmm::out_of_memory const&) {
+      if (batch_size == 1) { throw; }
+      CUDF_LOG_WARN("nvCOMP scratch allocation of {} bytes failed, splitting the batch",
+                    scratch_size);
+      batch_size = sub_batch_size(batch_size, scratch_size, scratch_size / 2, sm_count);
+    }
+  }
+
+  for (size_t begin = 0; begin < num_chunks; begin += batch_size) {
+    batch_fn(begin, std::min(batch_size, num_chunks - begin), scratch.value());
+  }
+}
+
+}  // namespace
+
 size_t batched_decompress_temp_size(compression_type compression,
                                     size_t num_chunks,
                                     size_t max_uncomp_chunk_size,
@@ -175,22 +263,32 @@ void batched_decompress(compression_type compression,
   auto const nvcomp_args = create_batched_nvcomp_args(inputs, outputs, stream);
   rmm::device_uvector<size_t> actual_uncompressed_data_sizes(num_chunks, stream);
   rmm::device_uvector<nvcompStatus_t> nvcomp_statuses(num_chunks, stream);
-  // Temporary space required for decompression
-  auto const temp_size = batched_decompress_temp_size(
-    compression, num_chunks, max_uncomp_chunk_size, max_total_uncomp_size);
-  rmm::device_buffer scratch(temp_size, stream);
-  auto const nvcomp_status = batched_decompress_async(compression,
-                                                      nvcomp_args.input_data_ptrs.data(),
-                                                      nvcomp_args.input_data_sizes.data(),
-                                                      nvcomp_args.output_data_sizes.data(),
-                                                      actual_uncompressed_data_sizes.data(),
-                                                      num_chunks,
-                                                      scratch.data(),
-                                                      scratch.size(),
-                                                      nvcomp_args.output_data_ptrs.data(),
-                                                      nvcomp_statuses.data(),
-                                                      stream.value());
-  CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess, "unable to perform decompression");
+  // Temporary space required for decompressing a sub-batch; its total uncompressed size is at most
+  // the size of the largest chunk for each chunk
+  auto const temp_size_fn = [&](size_t batch_size) {
+    return batched_decompress_temp_size(
+      compression,
+      batch_size,
+      max_uncomp_chunk_size,
+      std::min(max_total_uncomp_size, batch_size * max_uncomp_chunk_size));
+  };
+  auto const decompress_fn = [&](size_t begin, size_t batch_size, rmm::device_buffer& scratch) {
+    auto const nvcomp_status =
+      batched_decompress_async(compression,
+                               nvcomp_args.input_data_ptrs.data() + begin,
+                               nvcomp_args.input_data_sizes.data() + begin,
+                               nvcomp_args.output_data_sizes.data() + begin,
+                               actual_uncompressed_data_sizes.data() + begin,
+                               batch_size,
+                               scratch.data(),
+                               scratch.size(),
+                               nvcomp_args.output_data_ptrs.data() + begin,
+                               nvcomp_statuses.data() + begin,
+                               stream.value());
+    CUDF_EXPECTS(nvcomp_status == nvcompStatus_t::nvcompSuccess,
+                 "unable to perform decompression");
+  };
+  process_in_sub_batches(num_chunks, temp_size_fn, decompress_fn, stream);
 
   update_compression_results(nvcomp_statuses, actual_uncompressed_data_sizes, results, stream);
 }
@@ -446,24 +544,29 @@ void batched_compress(compression_type compression,
   auto const [max_uncomp_chunk_size, total_uncomp_size] =
     max_chunk_and_total_input_size(nvcomp_args.input_data_sizes, stream);
 
-  auto const temp_size =
-    batched_compress_temp_size(compression, num_chunks, max_uncomp_chunk_size, total_uncomp_size);
-
-  rmm::device_buffer scratch(temp_size, stream);
-  CUDF_EXPECTS(is_aligned(scratch.data(), 8), "Compression failed, misaligned scratch buffer");
-
   rmm::device_uvector<size_t> actual_compressed_data_sizes(num_chunks, stream);
 
-  batched_compress_async(compression,
-                         nvcomp_args.input_data_ptrs.data(),
-                         nvcomp_args.input_data_sizes.data(),
-                         max_uncomp_chunk_size,
-                         num_chunks,
-                         scratch.data(),
-                         scratch.size(),
-                         nvcomp_args.output_data_ptrs.data(),
-                         actual_compressed_data_sizes.data(),
-                         stream.value());
+  auto const temp_size_fn = [&](size_t batch_size) {
+    return batched_compress_temp_size(
+      compression,
+      batch_size,
+      max_uncomp_chunk_size,
+      std::min(total_uncomp_size, batch_size * max_uncomp_chunk_size));
+  };
+  auto const compress_fn = [&](size_t begin, size_t batch_size, rmm::device_buffer& scratch) {
+    CUDF_EXPECTS(is_aligned(scratch.data(), 8), "Compression failed, misaligned scratch buffer");
+    batched_compress_async(compression,
+                           nvcomp_args.input_data_ptrs.data() + begin,
+                           nvcomp_args.input_data_sizes.data() + begin,
+                           max_uncomp_chunk_size,
+                           batch_size,
+                           scratch.data(),
+                           scratch.size(),
+                           nvcomp_args.output_data_ptrs.data() + begin,
+                           actual_compressed_data_sizes.data() + begin,
+                           stream.value());
+  };
+  process_in_sub_batches(num_chunks, temp_size_fn, compress_fn, stream);
 
   update_compression_results(actual_compressed_data_sizes, results, stream);
 }
@@ -544,14 +647,19 @@ std::optional<std::string> is_compression_disabled(compression_type compression,
                                                    feature_status_parameters params)
 {
   static feature_status_memo_map comp_status_reason;
-  static std::mutex memo_map_mutex;
+  static std::shared_mutex memo_map_mutex;
 
-  std::unique_lock memo_map_lock{memo_map_mutex};
-  if (auto mem_res_it = comp_status_reason.find(feature_status_inputs{compression, params});
-      mem_res_it != comp_status_reason.end()) {
-    return mem_res_it->second;
+  {
+    // Lookups are called for every (de)compression batch, so they only take a shared lock
+    std::shared_lock memo_map_lock{memo_map_mutex};
+    if (auto mem_res_it = comp_status_reason.find(feature_status_inputs{compression, params});
+        mem_res_it != comp_status_reason.end()) {
+      return mem_res_it->second;
+    }
   }
 
+  std::unique_lock memo_map_lock{memo_map_mutex};
+
   // The rest of the function will execute only once per run, the memoized result will be returned
   // in all subsequent calls with the same compression type
   auto const reason                         = is_compression_disabled_impl(compression, params);
@@ -629,14 +737,19 @@ std::optional<std::string> is_decompression_disabled(compression_type compressio
                                                      feature_status_parameters params)
 {
   static feature_status_memo_map decomp_status_reason;
-  static std::mutex memo_map_mutex;
+  static std::shared_mutex memo_map_mutex;
 
-  std::unique_lock memo_map_lock{memo_map_mutex};
-  if (auto mem_res_it = decomp_status_reason.find(feature_status_inputs{compression, params});
-      mem_res_it != decomp_status_reason.end()) {
-    return mem_res_it->second;
+  {
+    // Lookups are called for every (de)compression batch, so they only take a shared lock
+    std::shared_lock memo_map_lock{memo_map_mutex};
+    if (auto mem_res_it = decomp_status_reason.find(feature_status_inputs{compression, params});
+        mem_res_it != decomp_status_reason.end()) {
+      return mem_res_it->second;
+    }
   }
 
+  std::unique_lock memo_map_lock{memo_map_mutex};
+
   // The rest of the function will execute only once per run, the memoized result will be returned
   // in all subsequent calls with the same compression type
   auto const reason                           = is_decompression_disabled_impl(compression, params);
@@ -91,9 +91,29 @@ inline bool operator==(feature_status_parameters const& lhs, feature_status_para
 [[nodiscard]] std::optional<std::string> is_decompression_disabled(
   compression_type compression, feature_status_parameters params = feature_status_parameters());
 
+/**
+ * @brief Computes the number of chunks to process per nvCOMP call for a batch.
+ *
+ * A batch whose scratch space exceeds the limit is split into sub-batches, assuming the scratch
+ * space is proportional to the number of chunks. Sub-batches larger than the SM count are
+ * rounded down to a multiple of it, to keep the device occupied in every call.
+ *
+ * @param num_chunks Number of chunks in the batch
+ * @param batch_scratch_size Scratch space required by the whole batch
+ * @param max_scratch_size Limit on the scratch space of a single call
+ * @param sm_count Number of SMs of the device
+ * @returns Number of chunks per call, at least one unless the batch is empty
+ */
+[[nodiscard]] size_t sub_batch_size(size_t num_chunks,
+                                    size_t batch_scratch_size,
+                                    size_t max_scratch_size,
+                                    size_t sm_count);
+
 /**
  * @brief Device batch decompression of given type.
  *
+ * The batch is decompressed in sub-batches if its scratch space does not fit in device memory.
+ *
  * @param[in] compression Compression type
  * @param[in] inputs List of input buffers
  * @param[out] outputs List of output buffers
@@ -164,6 +184,8 @@ size_t batched_decompress_temp_size(compression_type compression,
 /**
  * @brief Device batch compression of given type.
  *
+ * The batch is compressed in sub-batches if its scratch space does not fit in device memory.
+ *
  * @param[in] compression Compression type
  * @param[in] inputs List of input buffers
  * @param[out] outputs List of output buffers
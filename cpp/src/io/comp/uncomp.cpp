@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "io/utilities/config_utils.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 #include "io_uncomp.hpp"
 #include "nvcomp_adapter.hpp"
@@ -22,12 +23,17 @@
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/thread_pool.hpp>
 
 #include <cuda_runtime.h>
 
 #include <zlib.h>  // uncompress
 
+#include <algorithm>
+#include <array>
 #include <cstring>  // memset
+#include <future>
+#include <thread>
 
 using cudf::host_span;
 
@@ -502,60 +508,136 @@ size_t decompress_snappy(host_span<uint8_t const> src, host_span<uint8_t> dst)
 }
 
 /**
- * @brief ZSTD decompressor that uses nvcomp
+ * @brief ZSTD decompressor that uses nvcomp to decompress a batch of buffers in a single call
  */
-size_t decompress_zstd(host_span<uint8_t const> src,
-                       host_span<uint8_t> dst,
-                       rmm::cuda_stream_view stream)
+std::vector<size_t> decompress_zstd(host_span<host_span<uint8_t const> const> inputs,
+                                    host_span<host_span<uint8_t> const> outputs,
+                                    rmm::cuda_stream_view stream)
 {
-  // Init device span of spans (source)
-  auto const d_src =
-    cudf::detail::make_device_uvector_async(src, stream, rmm::mr::get_current_device_resource());
-  auto hd_srcs = cudf::detail::hostdevice_vector<device_span<uint8_t const>>(1, stream);
-  hd_srcs[0]   = d_src;
+  auto const num_buffers = inputs.size();
+
+  // The inputs and the temporary outputs are concatenated in device memory
+  std::vector<size_t> input_offsets(num_buffers + 1, 0);
+  std::vector<size_t> output_offsets(num_buffers + 1, 0);
+  for (size_t i = 0; i < num_buffers; ++i) {
+    input_offsets[i + 1]  = input_offsets[i] + inputs[i].size();
+    output_offsets[i + 1] = output_offsets[i] + outputs[i].size();
+  }
+  auto d_src = rmm::device_uvector<uint8_t>(input_offsets.back(), stream);
+  auto d_dst = rmm::device_uvector<uint8_t>(output_offsets.back(), stream);
+
+  auto hd_srcs  = cudf::detail::hostdevice_vector<device_span<uint8_t const>>(num_buffers, stream);
+  auto hd_dsts  = cudf::detail::hostdevice_vector<device_span<uint8_t>>(num_buffers, stream);
+  auto hd_stats = cudf::detail::hostdevice_vector<compression_result>(num_buffers, stream);
+  size_t max_uncomp_page_size = 0;
+  for (size_t i = 0; i < num_buffers; ++i) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(d_src.data() + input_offsets[i],
+                                  inputs[i].data(),
+                                  inputs[i].size(),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    hd_srcs[i]           = {d_src.data() + input_offsets[i], inputs[i].size()};
+    hd_dsts[i]           = {d_dst.data() + output_offsets[i], outputs[i].size()};
+    hd_stats[i]          = compression_result{0, compression_status::FAILURE};
+    max_uncomp_page_size = std::max(max_uncomp_page_size, outputs[i].size());
+  }
   hd_srcs.host_to_device_async(stream);
-
-  // Init device span of spans (temporary destination)
-  auto d_dst   = rmm::device_uvector<uint8_t>(dst.size(), stream);
-  auto hd_dsts = cudf::detail::hostdevice_vector<device_span<uint8_t>>(1, stream);
-  hd_dsts[0]   = d_dst;
   hd_dsts.host_to_device_async(stream);
-
-  auto hd_stats = cudf::detail::hostdevice_vector<compression_result>(1, stream);
-  hd_stats[0]   = compression_result{0, compression_status::FAILURE};
   hd_stats.host_to_device_async(stream);
-  auto const max_uncomp_page_size = dst.size();
+
   nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
                              hd_srcs,
                              hd_dsts,
                              hd_stats,
                              max_uncomp_page_size,
-                             max_uncomp_page_size,
+                             output_offsets.back(),
                              stream);
 
   hd_stats.device_to_host_sync(stream);
-  CUDF_EXPECTS(hd_stats[0].status == compression_status::SUCCESS, "ZSTD decompression failed");
 
-  // Copy temporary output to `dst`
-  CUDF_CUDA_TRY(cudaMemcpyAsync(
-    dst.data(), d_dst.data(), hd_stats[0].bytes_written, cudaMemcpyDefault, stream.value()));
+  // Copy temporary outputs to `outputs`
+  std::vector<size_t> output_sizes(num_buffers);
+  for (size_t i = 0; i < num_buffers; ++i) {
+    CUDF_EXPECTS(hd_stats[i].status == compression_status::SUCCESS, "ZSTD decompression failed");
+    CUDF_CUDA_TRY(cudaMemcpyAsync(outputs[i].data(),
+                                  d_dst.data() + output_offsets[i],
+                                  hd_stats[i].bytes_written,
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    output_sizes[i] = hd_stats[i].bytes_written;
+  }
+  stream.synchronize();
 
-  return hd_stats[0].bytes_written;
+  return output_sizes;
 }
 
-size_t decompress(compression_type compression,
-                  host_span<uint8_t const> src,
-                  host_span<uint8_t> dst,
-                  rmm::cuda_stream_view stream)
+/**
+ * @brief Decompresses a buffer with one of the host decompressors
+ */
+size_t decompress_on_host(compression_type compression,
+                          host_span<uint8_t const> src,
+                          host_span<uint8_t> dst)
 {
   switch (compression) {
     case compression_type::GZIP: return decompress_gzip(src, dst);
     case compression_type::ZLIB: return decompress_zlib(src, dst);
     case compression_type::SNAPPY: return decompress_snappy(src, dst);
-    case compression_type::ZSTD: return decompress_zstd(src, dst, stream);
     default: CUDF_FAIL("Unsupported compression type");
   }
 }
 
+/**
+ * @brief Returns the thread pool shared by the host decompressors.
+ *
+ * The number of threads can be set with the `LIBCUDF_HOST_DECOMPRESSION_NUM_THREADS` environment
+ * variable, and defaults to the number of hardware threads.
+ */
+cudf::detail::thread_pool& host_decompression_pool()
+{
+  static cudf::detail::thread_pool pool(detail::getenv_or(
+    "LIBCUDF_HOST_DECOMPRESSION_NUM_THREADS", std::thread::hardware_concurrency()));
+  return pool;
+}
+
+size_t decompress(compression_type compression,
+                  host_span<uint8_t const> src,
+                  host_span<uint8_t> dst,
+                  rmm::cuda_stream_view stream)
+{
+  if (compression == compression_type::ZSTD) {
+    auto const inputs  = std::array{src};
+    auto const outputs = std::array{dst};
+    return decompress_zstd(inputs, outputs, stream).front();
+  }
+  return decompress_on_host(compression, src, dst);
+}
+
+std::vector<size_t> decompress(compression_type compression,
+                               host_span<host_span<uint8_t const> const> inputs,
+                               host_span<host_span<uint8_t> const> outputs,
+                               rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == outputs.size(), "The number of inputs and outputs must match");
+  if (inputs.empty()) { return {}; }
+  if (compression == compression_type::ZSTD) { return decompress_zstd(inputs, outputs, stream); }
+  if (inputs.size() == 1) { return {decompress_on_host(compression, inputs[0], outputs[0])}; }
+
+  std::vector<std::future<size_t>> tasks;
+  tasks.reserve(inputs.size());
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    tasks.emplace_back(host_decompression_pool().submit(
+      [compression, src = inputs[i], dst = outputs[i]] {
+        return decompress_on_host(compression, src, dst);
+      }));
+  }
+
+  std::vector<size_t> output_sizes;
+  output_sizes.reserve(tasks.size());
+  for (auto& task : tasks) {
+    output_sizes.push_back(task.get());
+  }
+  return output_sizes;
+}
+
 }  // namespace io
 }  // namespace cudf
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/csv.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/thread_pool.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace cudf::io::detail::csv {
+
+namespace {
+
+// Size of the host reads used while scanning the input
+constexpr std::size_t window_size = 64 * 1024;
+
+/**
+ * @brief Counts the quote characters in the given byte range of the source.
+ */
+std::size_t count_quotes(datasource& source, std::size_t offset, std::size_t size, char quotechar)
+{
+  std::size_t count = 0;
+  auto const end    = offset + size;
+  for (auto pos = offset; pos < end; pos += window_size) {
+    auto const buffer = source.host_read(pos, std::min(window_size, end - pos));
+    auto const data   = reinterpret_cast<char const*>(buffer->data());
+    count += std::count(data, data + buffer->size(), quotechar);
+    if (buffer->size() == 0) { break; }
+  }
+  return count;
+}
+
+/**
+ * @brief Finds the first row terminator at or after `pos` that is not within quotes.
+ *
+ * @param source Input data source
+ * @param pos Position to start the search from
+ * @param is_quoted Whether `pos` is within quotes
+ * @param terminator Row terminator character
+ * @param quotechar Quote character, if quoting is enabled
+ * @return Position of the terminator, or the size of the source if there is none
+ */
+std::size_t find_row_terminator(datasource& source,
+                                std::size_t pos,
+                                bool is_quoted,
+                                char terminator,
+                                std::optional<char> quotechar)
+{
+  auto const total_size = source.size();
+  while (pos < total_size) {
+    auto const buffer = source.host_read(pos, std::min(window_size, total_size - pos));
+    if (buffer->size() == 0) { break; }
+    auto const data = reinterpret_cast<char const*>(buffer->data());
+    for (std::size_t i = 0; i < buffer->size(); ++i) {
+      // Escaped quotes are doubled, so toggling the state for each quote leaves it unchanged
+      if (quotechar.has_value() and data[i] == quotechar.value()) {
+        is_quoted = not is_quoted;
+      } else if (data[i] == terminator and not is_quoted) {
+        return pos + i;
+      }
+    }
+    pos += buffer->size();
+  }
+  return total_size;
+}
+
+bool is_number(data_type type)
+{
+  return cudf::is_integral_not_bool(type) or cudf::is_floating_point(type);
+}
+
+}  // namespace
+
+std::vector<text::byte_range_info> plan_byte_ranges(cudf::io::datasource& source,
+                                                    csv_reader_options const& options,
+                                                    std::size_t num_ranges)
+{
+  CUDF_EXPECTS(num_ranges > 0, "The number of byte ranges must be positive");
+  auto const total_size = source.size();
+  if (total_size == 0) { return {}; }
+  if (num_ranges == 1) { return {text::byte_range_info{0, static_cast<int64_t>(total_size)}}; }
+
+  auto const quotechar =
+    (options.get_quoting() != quote_style::NONE and options.get_quotechar() != '\0')
+      ? std::optional<char>{options.get_quotechar()}
+      : std::nullopt;
+
+  // Target split positions of the ranges; the first one is always at the start of the data
+  std::vector<std::size_t> targets(num_ranges);
+  for (std::size_t i = 0; i < num_ranges; ++i) {
+    targets[i] = total_size / num_ranges * i;
+  }
+
+  auto const num_threads =
+    std::max(1u, std::min(static_cast<unsigned>(num_ranges), std::thread::hardware_concurrency()));
+  cudf::detail::thread_pool pool(num_threads);
+
+  // The quote state at each target is found from the number of quotes before it. The quotes of
+  // the input sections between the targets are counted in parallel.
+  std::vector<bool> is_quoted(num_ranges, false);
+  if (quotechar.has_value()) {
+    std::vector<std::future<std::size_t>> quote_counts;
+    for (std::size_t i = 0; i + 1 < num_ranges; ++i) {
+      quote_counts.emplace_back(pool.submit([&source, &targets, quotechar, i] {
+        return count_quotes(source, targets[i], targets[i + 1] - targets[i], quotechar.value());
+      }));
+    }
+    std::size_t num_quotes = 0;
+    for (std::size_t i = 1; i < num_ranges; ++i) {
+      num_quotes += quote_counts[i - 1].get();
+      is_quoted[i] = num_quotes % 2 == 1;
+    }
+  }
+
+  // Each range after the first starts at the row terminator that ends the previous row, which is
+  // skipped by the reader, and ends at the terminator that starts the next range.
+  std::vector<std::future<std::size_t>> terminators;
+  for (std::size_t i = 1; i < num_ranges; ++i) {
+    terminators.emplace_back(pool.submit([&, i] {
+      return find_row_terminator(
+        source, targets[i], is_quoted[i], options.get_lineterminator(), quotechar);
+    }));
+  }
+
+  std::vector<std::size_t> range_starts{0};
+  for (auto& terminator : terminators) {
+    auto const terminator_pos = terminator.get();
+    // Skip the split if it repeats the previous one or if no row starts after it
+    if (terminator_pos <= range_starts.back() or terminator_pos + 1 >= total_size) { continue; }
+    range_starts.push_back(terminator_pos);
+  }
+
+  std::vector<text::byte_range_info> ranges;
+  for (std::size_t i = 0; i < range_starts.size(); ++i) {
+    auto const end = i + 1 < range_starts.size() ? range_starts[i + 1] : total_size;
+    ranges.emplace_back(range_starts[i], end - range_starts[i]);
+  }
+  return ranges;
+}
+
+std::vector<data_type> merge_dtypes(host_span<table_with_metadata const> tables)
+{
+  std::vector<std::optional<data_type>> merged;
+  for (auto const& table : tables) {
+    // Ranges without rows carry no type information
+    if (table.tbl->num_rows() == 0) { continue; }
+    if (merged.empty()) { merged.resize(table.tbl->num_columns()); }
+    CUDF_EXPECTS(static_cast<size_type>(merged.size()) == table.tbl->num_columns(),
+                 "All byte ranges must have the same number of columns");
+    for (size_type col_idx = 0; col_idx < table.tbl->num_columns(); ++col_idx) {
+      auto const col = table.tbl->get_column(col_idx).view();
+      // All null parts carry no type information
+      if (col.size() == col.null_count()) { continue; }
+      auto& merged_type = merged[col_idx];
+      if (not merged_type.has_value()) {
+        merged_type = col.type();
+      } else if (merged_type.value() != col.type()) {
+        // Mixed numbers are read as floating point, any other mix of types is read as strings
+        merged_type = is_number(merged_type.value()) and is_number(col.type())
+                        ? data_type{type_id::FLOAT64}
+                        : data_type{type_id::STRING};
+      }
+    }
+  }
+
+  std::vector<data_type> dtypes;
+  std::transform(merged.begin(), merged.end(), std::back_inserter(dtypes), [](auto const& type) {
+    // Columns that are null in all ranges are inferred as INT8 by the reader
+    return type.value_or(data_type{type_id::INT8});
+  });
+  return dtypes;
+}
+
+}  // namespace cudf::io::detail::csv
@@ -299,6 +299,7 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
  * @param[in] data The entire CSV data to read
  * @param[in] column_flags Per-column parsing behavior flags
  * @param[in] row_offsets The start the CSV data of interest
+ * @param[in] selected_rows Indices of the rows to decode, or empty to decode all rows
  * @param[in] dtypes The data type of the column
  * @param[out] columns The output column data
  * @param[out] valids The bitmaps indicating whether column fields are valid
@@ -309,6 +310,7 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
                       device_span<char const> data,
                       device_span<column_parse::flags const> column_flags,
                       device_span<uint64_t const> row_offsets,
+                      device_span<size_type const> selected_rows,
                       device_span<cudf::data_type const> dtypes,
                       device_span<void* const> columns,
                       device_span<cudf::bitmask_type* const> valids,
@@ -317,14 +319,16 @@ CUDF_KERNEL void __launch_bounds__(csvparse_block_dim)
   auto const raw_csv = data.data();
   // thread IDs range per block, so also need the block id.
   // this is entry into the field array - tid is an elements within the num_entries array
-  auto const rec_id      = grid_1d::global_thread_id();
-  auto const rec_id_next = rec_id + 1;
+  auto const rec_id   = grid_1d::global_thread_id();
+  auto const num_rows = selected_rows.empty() ? row_offsets.size() - 1 : selected_rows.size();
 
   // we can have more threads than data, make sure we are not past the end of the data
-  if (rec_id_next >= row_offsets.size()) return;
+  if (rec_id >= num_rows) return;
 
-  auto field_start   = raw_csv + row_offsets[rec_id];
-  auto const row_end = raw_csv + row_offsets[rec_id_next];
+  // the output record rec_id is decoded from the selected row of the input, if any
+  auto const row     = selected_rows.empty() ? rec_id : selected_rows[rec_id];
+  auto field_start   = raw_csv + row_offsets[row];
+  auto const row_end = raw_csv + row_offsets[row + 1];
 
   auto next_field = field_start;
   int col         = 0;
@@ -819,6 +823,7 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
                             device_span<char const> data,
                             device_span<column_parse::flags const> column_flags,
                             device_span<uint64_t const> row_offsets,
+                            device_span<size_type const> selected_rows,
                             device_span<cudf::data_type const> dtypes,
                             device_span<void* const> columns,
                             device_span<cudf::bitmask_type* const> valids,
@@ -827,11 +832,11 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
 {
   // Calculate actual block count to use based on records count
   auto const block_size = csvparse_block_dim;
-  auto const num_rows   = row_offsets.size() - 1;
+  auto const num_rows   = selected_rows.empty() ? row_offsets.size() - 1 : selected_rows.size();
   auto const grid_size  = (num_rows + block_size - 1) / block_size;
 
   convert_csv_to_cudf<<<grid_size, block_size, 0, stream.value()>>>(
-    options, data, column_flags, row_offsets, dtypes, columns, valids, valid_counts);
+    options, data, column_flags, row_offsets, selected_rows, dtypes, columns, valids, valid_counts);
 }
 
 uint32_t __host__ gather_row_offsets(parse_options_view const& options,
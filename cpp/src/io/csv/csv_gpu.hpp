@@ -214,6 +214,7 @@ std::vector<column_type_histogram> detect_column_types(
  * @param[in] data The row-column data
  * @param[in] column_flags Flags that control individual column parsing
  * @param[in] row_offsets List of row data start positions (offsets)
+ * @param[in] selected_rows Indices of the rows to decode, or empty to decode all rows
  * @param[in] dtypes List of dtype corresponding to each column
  * @param[out] columns Device memory output of column data
  * @param[out] valids Device memory output of column valids bitmap data
@@ -224,6 +225,7 @@ void decode_row_column_data(cudf::io::parse_options_view const& options,
                             device_span<char const> data,
                             device_span<column_parse::flags const> column_flags,
                             device_span<uint64_t const> row_offsets,
+                            device_span<size_type const> selected_rows,
                             device_span<cudf::data_type const> dtypes,
                             device_span<void* const> columns,
                             device_span<cudf::bitmask_type* const> valids,
@@ -23,9 +23,12 @@
 #include "csv_gpu.hpp"
 #include "io/comp/io_uncomp.hpp"
 #include "io/utilities/column_buffer.hpp"
+#include "io/utilities/column_filter.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 #include "io/utilities/parsing_utils.cuh"
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/utilities/visitor_overload.hpp>
@@ -36,11 +39,16 @@
 #include <cudf/strings/detail/replace.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/integer_utils.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 
@@ -570,6 +578,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
                                        std::vector<std::string> const& column_names,
                                        device_span<char const> data,
                                        device_span<uint64_t const> row_offsets,
+                                       device_span<size_type const> selected_rows,
                                        host_span<data_type const> column_types,
                                        int32_t num_records,
                                        int32_t num_actual_columns,
@@ -607,6 +616,7 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
     data,
     make_device_uvector_async(column_flags, stream, rmm::mr::get_current_device_resource()),
     row_offsets,
+    selected_rows,
     make_device_uvector_async(column_types, stream, rmm::mr::get_current_device_resource()),
     make_device_uvector_async(h_data, stream, rmm::mr::get_current_device_resource()),
     make_device_uvector_async(h_valid, stream, rmm::mr::get_current_device_resource()),
@@ -621,6 +631,159 @@ std::vector<column_buffer> decode_data(parse_options const& parse_opts,
   return out_buffers;
 }
 
+/**
+ * @brief Converts the decoded buffers of the given types into output columns.
+ */
+std::vector<std::unique_ptr<column>> make_output_columns(std::vector<column_buffer>& out_buffers,
+                                                         host_span<data_type const> column_types,
+                                                         parse_options const& parse_opts,
+                                                         rmm::cuda_stream_view stream,
+                                                         rmm::device_async_resource_ref mr)
+{
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(out_buffers.size());
+  cudf::string_scalar quotechar_scalar(std::string(1, parse_opts.quotechar), true, stream);
+  cudf::string_scalar dblquotechar_scalar(std::string(2, parse_opts.quotechar), true, stream);
+  for (size_t i = 0; i < out_buffers.size(); ++i) {
+    if (column_types[i].id() == type_id::STRING && parse_opts.quotechar != '\0' &&
+        parse_opts.doublequote) {
+      // PANDAS' default behavior of enabling doublequote for two consecutive
+      // quotechars in quoted fields results in reduction to a single quotechar
+      // TODO: Would be much more efficient to perform this operation in-place
+      // during the conversion stage
+      std::unique_ptr<column> col = cudf::make_strings_column(*out_buffers[i]._strings, stream);
+      out_columns.emplace_back(cudf::strings::detail::replace(
+        col->view(), dblquotechar_scalar, quotechar_scalar, -1, stream, mr));
+    } else {
+      out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
+    }
+  }
+  return out_columns;
+}
+
+/**
+ * @brief Device functor that checks whether a row of a boolean column is valid and true.
+ */
+struct is_true_row {
+  column_device_view predicate;
+
+  __device__ bool operator()(size_type row) const
+  {
+    return predicate.is_valid(row) and predicate.element<bool>(row);
+  }
+};
+
+/**
+ * @brief Decodes the active columns of the rows that pass the filter.
+ *
+ * The columns referenced by the filter are decoded first to evaluate it, and the other columns are
+ * only decoded for the rows that pass it.
+ */
+std::vector<std::unique_ptr<column>> decode_filtered_data(
+  ast::expression const& filter,
+  parse_options const& parse_opts,
+  std::vector<column_parse::flags> const& column_flags,
+  std::vector<std::string> const& column_names,
+  host_span<std::string const> output_names,
+  device_span<char const> data,
+  device_span<uint64_t const> row_offsets,
+  host_span<data_type const> column_types,
+  int32_t num_records,
+  int32_t num_actual_columns,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const converter       = cudf::io::detail::column_filter_converter{filter, output_names};
+  auto const& filter_columns = converter.get_referenced_columns();
+
+  auto const is_filter_column = [&](size_type output_idx) {
+    return std::binary_search(filter_columns.cbegin(), filter_columns.cend(), output_idx);
+  };
+
+  // Returns the parsing flags and the types of either the filter columns or the other columns
+  auto const select_columns = [&](bool filter_column_selected) {
+    auto flags = column_flags;
+    std::vector<data_type> types;
+    for (int col = 0, active_col = 0; col < num_actual_columns; ++col) {
+      if (not(column_flags[col] & column_parse::enabled)) { continue; }
+      if (is_filter_column(active_col) == filter_column_selected) {
+        types.push_back(column_types[active_col]);
+      } else {
+        flags[col] = column_parse::disabled;
+      }
+      ++active_col;
+    }
+    return std::pair{std::move(flags), std::move(types)};
+  };
+
+  auto const [filter_flags, filter_types] = select_columns(true);
+
+  auto filter_buffers = decode_data(parse_opts,
+                                    filter_flags,
+                                    column_names,
+                                    data,
+                                    row_offsets,
+                                    {},
+                                    filter_types,
+                                    num_records,
+                                    num_actual_columns,
+                                    filter_types.size(),
+                                    stream,
+                                    rmm::mr::get_current_device_resource());
+
+  auto const filter_table = table(make_output_columns(
+    filter_buffers, filter_types, parse_opts, stream, rmm::mr::get_current_device_resource()));
+
+  auto const predicate = cudf::io::detail::evaluate_filter(filter_table.view(), converter, stream);
+  auto filtered_columns =
+    cudf::detail::apply_boolean_mask(filter_table.view(), predicate->view(), stream, mr)->release();
+
+  auto const [other_flags, other_types] = select_columns(false);
+  std::vector<std::unique_ptr<column>> other_columns;
+  if (not other_types.empty()) {
+    auto const d_predicate = column_device_view::create(predicate->view(), stream);
+    rmm::device_uvector<size_type> selected_rows(num_records, stream);
+    auto const selected_end = thrust::copy_if(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(num_records),
+      selected_rows.begin(),
+      is_true_row{*d_predicate});
+    selected_rows.resize(thrust::distance(selected_rows.begin(), selected_end), stream);
+
+    if (selected_rows.is_empty()) {
+      std::transform(other_types.cbegin(),
+                     other_types.cend(),
+                     std::back_inserter(other_columns),
+                     [](auto const& type) { return make_empty_column(type); });
+    } else {
+      auto other_buffers = decode_data(parse_opts,
+                                       other_flags,
+                                       column_names,
+                                       data,
+                                       row_offsets,
+                                       selected_rows,
+                                       other_types,
+                                       selected_rows.size(),
+                                       num_actual_columns,
+                                       other_types.size(),
+                                       stream,
+                                       mr);
+      other_columns = make_output_columns(other_buffers, other_types, parse_opts, stream, mr);
+    }
+  }
+
+  // Restore the order of the active columns
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(column_types.size());
+  auto filtered_it = filtered_columns.begin();
+  auto other_it    = other_columns.begin();
+  for (size_type i = 0; i < static_cast<size_type>(column_types.size()); ++i) {
+    out_columns.emplace_back(std::move(is_filter_column(i) ? *filtered_it++ : *other_it++));
+  }
+  return out_columns;
+}
+
 std::vector<data_type> determine_column_types(csv_reader_options const& reader_opts,
                                               parse_options const& parse_opts,
                                               host_span<std::string const> column_names,
@@ -844,51 +1007,52 @@ table_with_metadata read_csv(cudf::io::datasource* source,
   auto const column_types = determine_column_types(
     reader_opts, parse_opts, column_names, data, row_offsets, num_records, column_flags, stream);
 
-  auto metadata    = table_metadata{};
+  auto metadata = table_metadata{};
+  for (int col = 0; col < num_actual_columns; ++col) {
+    if (column_flags[col] & column_parse::enabled) {
+      metadata.schema_info.emplace_back(column_names[col]);
+    }
+  }
+
   auto out_columns = std::vector<std::unique_ptr<cudf::column>>();
-  out_columns.reserve(column_types.size());
-  if (num_records != 0) {
+  if (num_records != 0 and reader_opts.get_filter().has_value()) {
+    std::vector<std::string> output_names;
+    std::transform(metadata.schema_info.cbegin(),
+                   metadata.schema_info.cend(),
+                   std::back_inserter(output_names),
+                   [](auto const& info) { return info.name; });
+    out_columns = decode_filtered_data(reader_opts.get_filter()->get(),
+                                       parse_opts,
+                                       column_flags,
+                                       column_names,
+                                       output_names,
+                                       data,
+                                       row_offsets,
+                                       column_types,
+                                       num_records,
+                                       num_actual_columns,
+                                       stream,
+                                       mr);
+  } else if (num_records != 0) {
     auto out_buffers = decode_data(  //
       parse_opts,
       column_flags,
       column_names,
       data,
       row_offsets,
+      {},
       column_types,
       num_records,
       num_actual_columns,
       num_active_columns,
       stream,
       mr);
-
-    cudf::string_scalar quotechar_scalar(std::string(1, parse_opts.quotechar), true, stream);
-    cudf::string_scalar dblquotechar_scalar(std::string(2, parse_opts.quotechar), true, stream);
-    for (size_t i = 0; i < column_types.size(); ++i) {
-      metadata.schema_info.emplace_back(out_buffers[i].name);
-      if (column_types[i].id() == type_id::STRING && parse_opts.quotechar != '\0' &&
-          parse_opts.doublequote) {
-        // PANDAS' default behavior of enabling doublequote for two consecutive
-        // quotechars in quoted fields results in reduction to a single quotechar
-        // TODO: Would be much more efficient to perform this operation in-place
-        // during the conversion stage
-        std::unique_ptr<column> col = cudf::make_strings_column(*out_buffers[i]._strings, stream);
-        out_columns.emplace_back(cudf::strings::detail::replace(
-          col->view(), dblquotechar_scalar, quotechar_scalar, -1, stream, mr));
-      } else {
-        out_columns.emplace_back(make_column(out_buffers[i], nullptr, std::nullopt, stream));
-      }
-    }
+    out_columns = make_output_columns(out_buffers, column_types, parse_opts, stream, mr);
   } else {
     // Create empty columns
     for (size_t i = 0; i < column_types.size(); ++i) {
       out_columns.emplace_back(make_empty_column(column_types[i]));
     }
-    // Handle empty metadata
-    for (int col = 0; col < num_actual_columns; ++col) {
-      if (column_flags[col] & column_parse::enabled) {
-        metadata.schema_info.emplace_back(column_names[col]);
-      }
-    }
   }
   return {std::make_unique<table>(std::move(out_columns)), std::move(metadata)};
 }
@@ -1005,6 +1169,80 @@ table_with_metadata read_csv(std::unique_ptr<cudf::io::datasource>&& source,
   return read_csv(source.get(), options, parse_options, stream, mr);
 }
 
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::unique_ptr<cudf::io::datasource>&& source,
+                               csv_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _source{std::move(source)},
+    _options{options},
+    _later_options{options},
+    _stream{stream},
+    _mr{mr}
+{
+  CUDF_EXPECTS(options.get_byte_range_offset() == 0 and options.get_byte_range_size() == 0,
+               "Byte range options are not supported by the chunked reader");
+  CUDF_EXPECTS(options.get_compression() == compression_type::NONE,
+               "Compressed inputs are not supported by the chunked reader");
+  CUDF_EXPECTS(options.get_header() < 0 or not options.get_names().empty() or
+                 (options.get_use_cols_names().empty() and options.get_use_cols_indexes().empty()),
+               "Selecting columns requires the column names when reading chunks with a header");
+
+  auto const total_size = _source->size();
+  auto const num_ranges =
+    chunk_read_limit == 0
+      ? std::size_t{1}
+      : std::max(std::size_t{1}, cudf::util::div_rounding_up_safe(total_size, chunk_read_limit));
+  _ranges = plan_byte_ranges(*_source, options, num_ranges);
+
+  // Types given by column index are used as is, otherwise the inferred types are added
+  std::visit(cudf::detail::visitor_overload{
+               [&](std::vector<data_type> const& dtypes) {
+                 if (dtypes.empty()) { _dtypes.emplace(); }
+               },
+               [&](std::map<std::string, data_type> const& dtypes) { _dtypes = dtypes; }},
+             options.get_dtypes());
+}
+
+bool chunked_reader::has_next() const { return _next_range < _ranges.size(); }
+
+table_with_metadata chunked_reader::read_chunk()
+{
+  if (not has_next()) { return table_with_metadata{std::make_unique<table>(), {}}; }
+
+  auto options = _next_range == 0 ? _options : _later_options;
+  options.set_byte_range_offset(_ranges[_next_range].offset());
+  options.set_byte_range_size(_ranges[_next_range].size());
+  // Columns with known types skip the type inference
+  if (_dtypes.has_value() and not _dtypes->empty()) { options.set_dtypes(_dtypes.value()); }
+  auto result =
+    read_csv(_source.get(), options, make_parse_options(options, _stream), _stream, _mr);
+
+  // The header is only in the first chunk, so the later chunks use the names read from it
+  if (_next_range == 0 and _options.get_header() >= 0) {
+    if (_options.get_names().empty()) {
+      std::vector<std::string> names;
+      for (auto const& col_info : result.metadata.schema_info) {
+        names.push_back(col_info.name);
+      }
+      _later_options.set_names(std::move(names));
+    }
+    _later_options.set_header(-1);
+  }
+
+  // Keep the types of the columns with values, so they are consistent across chunks
+  if (_dtypes.has_value()) {
+    for (size_type col_idx = 0; col_idx < result.tbl->num_columns(); ++col_idx) {
+      auto const col = result.tbl->get_column(col_idx).view();
+      if (col.size() == col.null_count()) { continue; }
+      _dtypes->emplace(result.metadata.schema_info[col_idx].name, col.type());
+    }
+  }
+
+  ++_next_range;
+  return result;
+}
+
 }  // namespace csv
 }  // namespace detail
 }  // namespace io
@@ -24,21 +24,27 @@
 #include "durations.hpp"
 
 #include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/utilities/assert.cuh>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/detail/csv.hpp>
 #include <cudf/null_mask.hpp>
 #include <cudf/scalar/scalar.hpp>
-#include <cudf/strings/detail/combine.hpp>
+#include <cudf/strings/detail/convert/fixed_point_to_string.cuh>
+#include <cudf/strings/detail/convert/int_to_string.cuh>
 #include <cudf/strings/detail/converters.hpp>
-#include <cudf/strings/detail/replace.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
@@ -50,6 +56,7 @@
 #include <thrust/tabulate.h>
 
 #include <algorithm>
+#include <future>
 #include <memory>
 #include <sstream>
 #include <string>
@@ -131,12 +138,11 @@ struct column_to_strings_fn {
   template <typename column_type>
   constexpr static bool is_not_handled()
   {
-    // Note: the case (not std::is_same_v<column_type, bool>)
-    // is already covered by is_integral)
+    // Note: integral (including bool) and fixed point columns are
+    // formatted directly by `csv_row_fn` and never converted
     //
     return not((std::is_same_v<column_type, cudf::string_view>) ||
-               (std::is_integral_v<column_type>) || (std::is_floating_point_v<column_type>) ||
-               (cudf::is_fixed_point<column_type>()) || (cudf::is_timestamp<column_type>()) ||
+               (std::is_floating_point_v<column_type>) || (cudf::is_timestamp<column_type>()) ||
                (cudf::is_duration<column_type>()));
   }
 
@@ -153,19 +159,8 @@ struct column_to_strings_fn {
   column_to_strings_fn(column_to_strings_fn&&)                 = delete;
   column_to_strings_fn& operator=(column_to_strings_fn&&)      = delete;
 
-  // Note: `null` replacement with `na_rep` deferred to `concatenate()`
-  // instead of column-wise; might be faster
-
-  // bools:
-  //
-  template <typename column_type>
-  std::enable_if_t<std::is_same_v<column_type, bool>, std::unique_ptr<column>> operator()(
-    column_view const& column) const
-  {
-    string_scalar true_string{options_.get_true_value(), true, stream_};
-    string_scalar false_string{options_.get_false_value(), true, stream_};
-    return cudf::strings::detail::from_booleans(column, true_string, false_string, stream_, mr_);
-  }
+  // Note: `null` replacement with `na_rep` deferred to `csv_row_fn`
+  // instead of column-wise
 
   // strings:
   //
@@ -192,16 +187,6 @@ struct column_to_strings_fn {
                                cudf::detail::copy_bitmask(column_v, stream_, mr_));
   }
 
-  // ints:
-  //
-  template <typename column_type>
-  std::enable_if_t<std::is_integral_v<column_type> && !std::is_same_v<column_type, bool>,
-                   std::unique_ptr<column>>
-  operator()(column_view const& column) const
-  {
-    return cudf::strings::detail::from_integers(column, stream_, mr_);
-  }
-
   // floats:
   //
   template <typename column_type>
@@ -211,15 +196,6 @@ struct column_to_strings_fn {
     return cudf::strings::detail::from_floats(column, stream_, mr_);
   }
 
-  // fixed point:
-  //
-  template <typename column_type>
-  std::enable_if_t<cudf::is_fixed_point<column_type>(), std::unique_ptr<column>> operator()(
-    column_view const& column) const
-  {
-    return cudf::strings::detail::from_fixed_point(column, stream_, mr_);
-  }
-
   // timestamps:
   //
   template <typename column_type>
@@ -281,6 +257,100 @@ struct column_to_strings_fn {
   rmm::cuda_stream_view stream_;
   rmm::device_async_resource_ref mr_;
 };
+
+/**
+ * @brief Returns true if the values of the column are formatted directly by `csv_row_fn`
+ * instead of being converted to a strings column first.
+ */
+bool is_formatted_directly(data_type type)
+{
+  return cudf::is_integral(type) || cudf::is_fixed_point(type);
+}
+
+/**
+ * @brief Functor to format a single non-null element of a column.
+ *
+ * Returns the number of bytes of the formatted element. The bytes are written
+ * to `d_buffer` only if it is not null.
+ */
+struct format_element_fn {
+  string_view const d_true;   // representation of true values
+  string_view const d_false;  // representation of false values
+
+  template <typename Element>
+  __device__ size_type operator()(column_device_view const& d_column,
+                                  size_type row,
+                                  char* d_buffer) const
+  {
+    if constexpr (std::is_same_v<Element, bool>) {
+      auto const d_str = d_column.element<bool>(row) ? d_true : d_false;
+      if (d_buffer) { cudf::strings::detail::copy_string(d_buffer, d_str); }
+      return d_str.size_bytes();
+    } else if constexpr (std::is_integral_v<Element>) {
+      auto const value = d_column.element<Element>(row);
+      if (d_buffer) { return cudf::strings::detail::integer_to_string(value, d_buffer); }
+      return cudf::strings::detail::count_digits(value);
+    } else if constexpr (cudf::is_fixed_point<Element>()) {
+      auto const value = static_cast<__int128_t>(d_column.element<Element>(row).value());
+      auto const scale = d_column.type().scale();
+      if (d_buffer) { cudf::strings::detail::fixed_point_to_string(value, scale, d_buffer); }
+      return cudf::strings::detail::fixed_point_string_size(value, scale);
+    } else if constexpr (std::is_same_v<Element, string_view>) {
+      auto const d_str = d_column.element<string_view>(row);
+      if (d_buffer) { cudf::strings::detail::copy_string(d_buffer, d_str); }
+      return d_str.size_bytes();
+    } else {
+      (void)d_column;
+      (void)row;
+      (void)d_buffer;
+      CUDF_UNREACHABLE("Unsupported column type.");
+    }
+  }
+};
+
+/**
+ * @brief Functor to write the rows of a table to CSV format.
+ *
+ * Each row is written as its delimited values followed by the line terminator.
+ * Integral and fixed point values are formatted in place; all other columns
+ * must already be converted to strings.
+ */
+struct csv_row_fn {
+  table_device_view const d_table;
+  format_element_fn const format_fn;
+  string_view const d_delimiter;   // between the values of a row
+  string_view const d_narep;       // for null values
+  string_view const d_terminator;  // after each row
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type row)
+  {
+    char* d_buffer  = d_chars ? d_chars + d_offsets[row] : nullptr;
+    size_type bytes = 0;
+
+    auto write_string = [&](string_view d_str) {
+      if (d_buffer) { d_buffer = cudf::strings::detail::copy_string(d_buffer, d_str); }
+      bytes += d_str.size_bytes();
+    };
+
+    for (size_type col = 0; col < d_table.num_columns(); ++col) {
+      if (col > 0) { write_string(d_delimiter); }
+      auto const& d_column = d_table.column(col);
+      if (d_column.is_null(row)) {
+        write_string(d_narep);
+        continue;
+      }
+      auto const size = cudf::type_dispatcher(d_column.type(), format_fn, d_column, row, d_buffer);
+      if (d_buffer) { d_buffer += size; }
+      bytes += size;
+    }
+    write_string(d_terminator);
+
+    if (!d_chars) { d_sizes[row] = bytes; }
+  }
+};
 }  // unnamed namespace
 
 // write the header: column names:
@@ -352,58 +422,34 @@ void write_chunked_begin(data_sink* out_sink,
   }
 }
 
-void write_chunked(data_sink* out_sink,
-                   strings_column_view const& str_column_view,
-                   csv_writer_options const& options,
-                   rmm::cuda_stream_view stream,
-                   rmm::device_async_resource_ref mr)
+/**
+ * @brief Writes a chunk of formatted rows to the sink
+ *
+ * @return A future that completes once `chars` is no longer read by a device write
+ */
+std::future<void> write_chunked(data_sink* out_sink,
+                                device_span<char const> chars,
+                                rmm::cuda_stream_view stream)
 {
-  // algorithm outline:
-  //
-  //  for_each(strings_column.begin(), strings_column.end(),
-  //           [sink = out_sink](auto str_row) mutable {
-  //               auto host_buffer = str_row.host_buffer();
-  //               sink->host_write(host_buffer_.data(), host_buffer_.size());
-  //           });//or...sink->device_write(device_buffer,...);
-  //
-  // added line_terminator functionality
-  //
-
-  CUDF_EXPECTS(str_column_view.size() > 0, "Unexpected empty strings column.");
-
-  cudf::string_scalar newline{options.get_line_terminator(), true, stream};
-  auto p_str_col_w_nl = cudf::strings::detail::join_strings(str_column_view,
-                                                            newline,
-                                                            string_scalar{"", false, stream},
-                                                            stream,
-                                                            rmm::mr::get_current_device_resource());
-  strings_column_view strings_column{p_str_col_w_nl->view()};
-
-  auto total_num_bytes      = strings_column.chars_size(stream);
-  char const* ptr_all_bytes = strings_column.chars_begin(stream);
+  if (chars.empty()) {
+    return std::async(std::launch::deferred, [] {});
+  }
 
-  if (out_sink->is_device_write_preferred(total_num_bytes)) {
+  if (out_sink->is_device_write_preferred(chars.size())) {
     // Direct write from device memory
-    out_sink->device_write(ptr_all_bytes, total_num_bytes, stream);
+    return out_sink->device_write_async(chars.data(), chars.size(), stream);
   } else {
     // copy the bytes to host to write them out
-    thrust::host_vector<char> h_bytes(total_num_bytes);
+    thrust::host_vector<char> h_bytes(chars.size());
     CUDF_CUDA_TRY(cudaMemcpyAsync(h_bytes.data(),
-                                  ptr_all_bytes,
-                                  total_num_bytes * sizeof(char),
+                                  chars.data(),
+                                  chars.size() * sizeof(char),
                                   cudaMemcpyDefault,
                                   stream.value()));
     stream.synchronize();
 
-    out_sink->host_write(h_bytes.data(), total_num_bytes);
-  }
-
-  // Needs newline at the end, to separate from next chunk
-  if (out_sink->is_device_write_preferred(newline.size())) {
-    out_sink->device_write(newline.data(), newline.size(), stream);
-  } else {
-    out_sink->host_write(options.get_line_terminator().data(),
-                         options.get_line_terminator().size());
+    out_sink->host_write(h_bytes.data(), h_bytes.size());
+    return std::async(std::launch::deferred, [] {});
   }
 }
 
@@ -449,50 +495,55 @@ void write_csv(data_sink* out_sink,
       vector_views = cudf::detail::split(table, splits, stream);
     }
 
+    cudf::string_scalar delimiter{std::string{options.get_inter_column_delimiter()}, true, stream};
+    cudf::string_scalar narep{options.get_na_rep(), true, stream};
+    cudf::string_scalar terminator{options.get_line_terminator(), true, stream};
+    cudf::string_scalar true_value{options.get_true_value(), true, stream};
+    cudf::string_scalar false_value{options.get_false_value(), true, stream};
+
     // convert each chunk to CSV:
     //
     column_to_strings_fn converter{options, stream, rmm::mr::get_current_device_resource()};
+    // the rows of a chunk are formatted while the previous chunk is still being written
+    rmm::device_uvector<char> pending_chars(0, stream);
+    std::future<void> pending_write;
     for (auto&& sub_view : vector_views) {
       // Skip if the table has no rows
       if (sub_view.num_rows() == 0) continue;
-      std::vector<std::unique_ptr<column>> str_column_vec;
 
-      // populate vector of string-converted columns:
+      // integral and fixed point columns are formatted directly into the output rows;
+      // only the remaining columns are converted to strings columns first
       //
+      std::vector<std::unique_ptr<column>> str_column_vec;
+      std::vector<column_view> row_columns;
       std::transform(
         sub_view.begin(),
         sub_view.end(),
-        std::back_inserter(str_column_vec),
-        [&converter = std::as_const(converter)](auto const& current_col) {
-          return cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
-            current_col.type(), converter, current_col);
+        std::back_inserter(row_columns),
+        [&converter = std::as_const(converter), &str_column_vec](auto const& current_col) {
+          if (is_formatted_directly(current_col.type())) { return current_col; }
+          str_column_vec.push_back(
+            cudf::type_dispatcher<cudf::id_to_type_impl, column_to_strings_fn const&>(
+              current_col.type(), converter, current_col));
+          return str_column_vec.back()->view();
         });
 
-      // create string table view from str_column_vec:
-      //
-      auto str_table_ptr  = std::make_unique<cudf::table>(std::move(str_column_vec));
-      auto str_table_view = str_table_ptr->view();
-
-      // concatenate columns in each row into one big string column
-      // (using null representation and delimiter):
+      // write the delimited values and the terminator of each row into one buffer
       //
-      auto str_concat_col = [&] {
-        cudf::string_scalar delimiter_str{
-          std::string{options.get_inter_column_delimiter()}, true, stream};
-        cudf::string_scalar options_narep{options.get_na_rep(), true, stream};
-        if (str_table_view.num_columns() > 1)
-          return cudf::strings::detail::concatenate(str_table_view,
-                                                    delimiter_str,
-                                                    options_narep,
-                                                    strings::separator_on_nulls::YES,
-                                                    stream,
-                                                    rmm::mr::get_current_device_resource());
-        return cudf::strings::detail::replace_nulls(
-          str_table_view.column(0), options_narep, stream, rmm::mr::get_current_device_resource());
-      }();
-
-      write_chunked(out_sink, str_concat_col->view(), options, stream, mr);
+      auto const d_table = table_device_view::create(table_view{row_columns}, stream);
+      csv_row_fn row_fn{*d_table,
+                        format_element_fn{true_value.value(stream), false_value.value(stream)},
+                        delimiter.value(stream),
+                        narep.value(stream),
+                        terminator.value(stream)};
+      auto [offsets, chars] = cudf::strings::detail::make_strings_children(
+        row_fn, sub_view.num_rows(), stream, rmm::mr::get_current_device_resource());
+
+      if (pending_write.valid()) { pending_write.get(); }
+      pending_write = write_chunked(out_sink, chars, stream);
+      pending_chars = std::move(chars);
     }
+    if (pending_write.valid()) { pending_write.get(); }
   }
 }
 
@@ -15,13 +15,16 @@
  */
 
 #include "io/orc/orc.hpp"
+#include "io/parquet/footer_cache.hpp"
 
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/io/arrow_ipc.hpp>
 #include <cudf/io/avro.hpp>
 #include <cudf/io/csv.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/arrow_ipc.hpp>
 #include <cudf/io/detail/avro.hpp>
 #include <cudf/io/detail/csv.hpp>
 #include <cudf/io/detail/json.hpp>
@@ -35,10 +38,15 @@
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/thread_pool.hpp>
 
 #include <rmm/resource_ref.hpp>
 
 #include <algorithm>
+#include <future>
+#include <numeric>
+#include <string>
+#include <vector>
 
 namespace cudf::io {
 // Returns builder for csv_reader_options
@@ -118,6 +126,26 @@ chunked_parquet_writer_options_builder chunked_parquet_writer_options::builder(
   return chunked_parquet_writer_options_builder(sink);
 }
 
+// Returns builder for arrow_ipc_reader_options
+arrow_ipc_reader_options_builder arrow_ipc_reader_options::builder(source_info src)
+{
+  return arrow_ipc_reader_options_builder{std::move(src)};
+}
+
+// Returns builder for arrow_ipc_writer_options
+arrow_ipc_writer_options_builder arrow_ipc_writer_options::builder(sink_info const& sink,
+                                                                   table_view const& table)
+{
+  return arrow_ipc_writer_options_builder{sink, table};
+}
+
+// Returns builder for chunked_arrow_ipc_writer_options
+chunked_arrow_ipc_writer_options_builder chunked_arrow_ipc_writer_options::builder(
+  sink_info const& sink)
+{
+  return chunked_arrow_ipc_writer_options_builder{sink};
+}
+
 namespace {
 
 std::vector<std::unique_ptr<cudf::io::datasource>> make_datasources(source_info const& info,
@@ -166,9 +194,44 @@ table_with_metadata read_avro(avro_reader_options const& options, rmm::device_as
 
   auto datasources = make_datasources(options.get_source());
 
-  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+  return avro::read_avro(std::move(datasources), options, cudf::get_default_stream(), mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::chunked_avro_reader
+ */
+chunked_avro_reader::chunked_avro_reader(std::size_t chunk_read_limit,
+                                         avro_reader_options const& options,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+  : reader{std::make_unique<cudf::io::detail::avro::chunked_reader>(
+      chunk_read_limit, make_datasources(options.get_source()), options, stream, mr)}
+{
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::~chunked_avro_reader
+ */
+chunked_avro_reader::~chunked_avro_reader() = default;
 
-  return avro::read_avro(std::move(datasources[0]), options, cudf::get_default_stream(), mr);
+/**
+ * @copydoc cudf::io::chunked_avro_reader::has_next
+ */
+bool chunked_avro_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_avro_reader::read_chunk
+ */
+table_with_metadata chunked_avro_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
 }
 
 compression_type infer_compression_type(compression_type compression, source_info const& info)
@@ -215,6 +278,73 @@ table_with_metadata read_json(json_reader_options options,
   return json::detail::read_json(datasources, options, stream, mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_json_reader::chunked_json_reader
+ */
+chunked_json_reader::chunked_json_reader(std::size_t chunk_read_limit,
+                                         json_reader_options const& options,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  auto reader_options = options;
+  reader_options.set_compression(
+    infer_compression_type(options.get_compression(), options.get_source()));
+  reader = std::make_unique<json::detail::chunked_reader>(
+    chunk_read_limit, make_datasources(options.get_source()), reader_options, stream, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::~chunked_json_reader
+ */
+chunked_json_reader::~chunked_json_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::has_next
+ */
+bool chunked_json_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_json_reader::read_chunk
+ */
+table_with_metadata chunked_json_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+std::vector<text::byte_range_info> plan_json_byte_ranges(json_reader_options const& options,
+                                                         size_t num_ranges)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(options.is_enabled_lines(), "Byte ranges are supported only for JSON Lines");
+  CUDF_EXPECTS(infer_compression_type(options.get_compression(), options.get_source()) ==
+                 compression_type::NONE,
+               "Byte ranges cannot be planned for compressed inputs");
+
+  auto datasources = make_datasources(options.get_source());
+  return json::detail::plan_byte_ranges(datasources, num_ranges);
+}
+
+std::map<std::string, schema_element> extract_json_schema(table_with_metadata const& table)
+{
+  CUDF_FUNC_RANGE();
+  return json::detail::extract_schema(table);
+}
+
+std::map<std::string, schema_element> merge_json_schemas(
+  host_span<table_with_metadata const> tables)
+{
+  CUDF_FUNC_RANGE();
+  return json::detail::merge_schemas(tables);
+}
+
 void write_json(json_writer_options const& options,
                 rmm::cuda_stream_view stream,
                 rmm::device_async_resource_ref mr)
@@ -251,6 +381,153 @@ table_with_metadata read_csv(csv_reader_options options,
     mr);
 }
 
+/**
+ * @copydoc cudf::io::chunked_csv_reader::chunked_csv_reader
+ */
+chunked_csv_reader::chunked_csv_reader(std::size_t chunk_read_limit,
+                                       csv_reader_options const& options,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  auto reader_options = options;
+  reader_options.set_compression(
+    infer_compression_type(options.get_compression(), options.get_source()));
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  reader = std::make_unique<cudf::io::detail::csv::chunked_reader>(
+    chunk_read_limit, std::move(datasources[0]), reader_options, stream, mr);
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::~chunked_csv_reader
+ */
+chunked_csv_reader::~chunked_csv_reader() = default;
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::has_next
+ */
+bool chunked_csv_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+/**
+ * @copydoc cudf::io::chunked_csv_reader::read_chunk
+ */
+table_with_metadata chunked_csv_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+std::vector<text::byte_range_info> plan_csv_byte_ranges(csv_reader_options const& options,
+                                                        std::size_t num_ranges)
+{
+  CUDF_FUNC_RANGE();
+
+  CUDF_EXPECTS(infer_compression_type(options.get_compression(), options.get_source()) ==
+                 compression_type::NONE,
+               "Byte ranges cannot be planned for compressed inputs");
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is currently supported.");
+
+  return cudf::io::detail::csv::plan_byte_ranges(*datasources[0], options, num_ranges);
+}
+
+std::vector<table_with_metadata> read_csv_byte_ranges(
+  csv_reader_options const& options,
+  host_span<text::byte_range_info const> ranges,
+  host_span<rmm::cuda_stream_view const> streams,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(not streams.empty(), "At least one stream is required");
+
+  std::vector<table_with_metadata> parts(ranges.size());
+  if (ranges.empty()) { return parts; }
+
+  auto const range_options = [&](csv_reader_options opts, std::size_t range_idx) {
+    opts.set_byte_range_offset(ranges[range_idx].offset());
+    opts.set_byte_range_size(ranges[range_idx].size());
+    return opts;
+  };
+
+  // Reads the given ranges with one host thread per stream
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  auto const read_ranges = [&](std::vector<std::size_t> const& range_indices,
+                               auto const& get_options) {
+    if (range_indices.empty()) { return; }
+    auto const num_threads = std::min(streams.size(), range_indices.size());
+    cudf::detail::thread_pool pool(num_threads);
+    std::vector<std::future<void>> tasks;
+    for (std::size_t thread_idx = 0; thread_idx < num_threads; ++thread_idx) {
+      tasks.emplace_back(pool.submit([&, thread_idx] {
+        CUDF_CUDA_TRY(cudaSetDevice(device));
+        for (auto i = thread_idx; i < range_indices.size(); i += num_threads) {
+          auto const range_idx = range_indices[i];
+          parts[range_idx] =
+            read_csv(range_options(get_options(range_idx), range_idx), streams[thread_idx], mr);
+        }
+      }));
+    }
+    for (auto& task : tasks) {
+      task.get();
+    }
+  };
+
+  // The header is only in the first range, so the other ranges use the names read from it
+  auto other_options = options;
+  std::vector<std::size_t> pending(ranges.size());
+  std::iota(pending.begin(), pending.end(), 0);
+  if (options.get_header() >= 0) {
+    if (options.get_names().empty() and ranges.size() > 1) {
+      CUDF_EXPECTS(
+        options.get_use_cols_names().empty() and options.get_use_cols_indexes().empty(),
+        "Selecting columns requires the column names when reading byte ranges with a header");
+      parts[0] = read_csv(range_options(options, 0), streams[0], mr);
+      std::vector<std::string> names;
+      for (auto const& col_info : parts[0].metadata.schema_info) {
+        names.push_back(col_info.name);
+      }
+      other_options.set_names(std::move(names));
+      pending.erase(pending.begin());
+    }
+    other_options.set_header(-1);
+  }
+  auto const get_options = [&](std::size_t range_idx) {
+    return range_idx == 0 ? options : other_options;
+  };
+  read_ranges(pending, get_options);
+
+  // Read the ranges again whose inferred column types differ from the merged types
+  auto const dtypes = cudf::io::detail::csv::merge_dtypes(parts);
+  std::vector<std::size_t> mismatched;
+  for (std::size_t range_idx = 0; range_idx < parts.size(); ++range_idx) {
+    auto const& tbl = *parts[range_idx].tbl;
+    if (tbl.num_columns() != static_cast<size_type>(dtypes.size())) { continue; }
+    for (size_type col_idx = 0; col_idx < tbl.num_columns(); ++col_idx) {
+      if (tbl.get_column(col_idx).type() != dtypes[col_idx]) {
+        mismatched.push_back(range_idx);
+        break;
+      }
+    }
+  }
+  read_ranges(mismatched, [&](std::size_t range_idx) {
+    auto opts = get_options(range_idx);
+    opts.set_dtypes(dtypes);
+    return opts;
+  });
+
+  return parts;
+}
+
 // Freeform API wraps the detail writer class API
 void write_csv(csv_writer_options const& options,
                rmm::cuda_stream_view stream,
@@ -535,6 +812,106 @@ void orc_chunked_writer::close()
   writer->close();
 }
 
+/**
+ * @copydoc cudf::io::read_arrow_ipc
+ */
+table_with_metadata read_arrow_ipc(arrow_ipc_reader_options const& options,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is supported for Arrow IPC reading");
+
+  return detail::arrow_ipc::read_arrow_ipc(std::move(datasources[0]), options, stream, mr);
+}
+
+chunked_arrow_ipc_reader::chunked_arrow_ipc_reader(std::size_t chunk_read_limit,
+                                                   arrow_ipc_reader_options const& options,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto datasources = make_datasources(options.get_source());
+  CUDF_EXPECTS(datasources.size() == 1, "Only a single source is supported for Arrow IPC reading");
+
+  reader = std::make_unique<detail::arrow_ipc::chunked_reader>(
+    chunk_read_limit, std::move(datasources[0]), options, stream, mr);
+}
+
+// This destructor destroys the internal reader instance.
+// Since the declaration of the internal `reader` object does not exist in the header, this
+// destructor needs to be defined in a separate source file which can access to that object's
+// declaration.
+chunked_arrow_ipc_reader::~chunked_arrow_ipc_reader() = default;
+
+bool chunked_arrow_ipc_reader::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->has_next();
+}
+
+table_with_metadata chunked_arrow_ipc_reader::read_chunk() const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(reader != nullptr, "Reader has not been constructed properly.");
+  return reader->read_chunk();
+}
+
+/**
+ * @copydoc cudf::io::write_arrow_ipc
+ */
+void write_arrow_ipc(arrow_ipc_writer_options const& options, rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+
+  auto sinks = make_datasinks(options.get_sink());
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for Arrow IPC writing");
+
+  auto writer = std::make_unique<detail::arrow_ipc::writer>(std::move(sinks[0]), options, stream);
+  writer->write(options.get_table());
+  writer->close();
+}
+
+arrow_ipc_chunked_writer::arrow_ipc_chunked_writer() = default;
+
+/**
+ * @copydoc cudf::io::arrow_ipc_chunked_writer::arrow_ipc_chunked_writer
+ */
+arrow_ipc_chunked_writer::arrow_ipc_chunked_writer(chunked_arrow_ipc_writer_options const& options,
+                                                   rmm::cuda_stream_view stream)
+{
+  auto sinks = make_datasinks(options.get_sink());
+  CUDF_EXPECTS(sinks.size() == 1, "Multiple sinks not supported for Arrow IPC writing");
+
+  writer = std::make_unique<detail::arrow_ipc::writer>(std::move(sinks[0]), options, stream);
+}
+
+arrow_ipc_chunked_writer::~arrow_ipc_chunked_writer() = default;
+
+/**
+ * @copydoc cudf::io::arrow_ipc_chunked_writer::write
+ */
+arrow_ipc_chunked_writer& arrow_ipc_chunked_writer::write(table_view const& table)
+{
+  CUDF_FUNC_RANGE();
+
+  writer->write(table);
+
+  return *this;
+}
+
+/**
+ * @copydoc cudf::io::arrow_ipc_chunked_writer::close
+ */
+void arrow_ipc_chunked_writer::close()
+{
+  CUDF_FUNC_RANGE();
+
+  writer->close();
+}
+
 using namespace cudf::io::parquet::detail;
 namespace detail_parquet = cudf::io::parquet::detail;
 
@@ -551,6 +928,16 @@ table_with_metadata read_parquet(parquet_reader_options const& options,
   return reader->read();
 }
 
+void set_parquet_footer_cache_capacity(std::size_t capacity_bytes)
+{
+  detail_parquet::get_footer_cache().set_capacity(capacity_bytes);
+}
+
+std::size_t get_parquet_footer_cache_capacity()
+{
+  return detail_parquet::get_footer_cache().capacity();
+}
+
 parquet_metadata read_parquet_metadata(source_info const& src_info)
 {
   CUDF_FUNC_RANGE();
@@ -720,6 +1107,8 @@ void parquet_reader_options::set_row_groups(std::vector<std::vector<size_type>>
   if ((!row_groups.empty()) and ((_skip_rows != 0) or _num_rows.has_value())) {
     CUDF_FAIL("row_groups can't be set along with skip_rows and num_rows");
   }
+  CUDF_EXPECTS(row_groups.empty() or _row_ranges.empty(),
+               "row_groups can't be set along with row_ranges");
 
   _row_groups = std::move(row_groups);
 }
@@ -728,6 +1117,7 @@ void parquet_reader_options::set_skip_rows(int64_t val)
 {
   CUDF_EXPECTS(val >= 0, "skip_rows cannot be negative");
   CUDF_EXPECTS(_row_groups.empty(), "skip_rows can't be set along with a non-empty row_groups");
+  CUDF_EXPECTS(_row_ranges.empty(), "skip_rows can't be set along with a non-empty row_ranges");
 
   _skip_rows = val;
 }
@@ -736,10 +1126,26 @@ void parquet_reader_options::set_num_rows(size_type val)
 {
   CUDF_EXPECTS(val >= 0, "num_rows cannot be negative");
   CUDF_EXPECTS(_row_groups.empty(), "num_rows can't be set along with a non-empty row_groups");
+  CUDF_EXPECTS(_row_ranges.empty(), "num_rows can't be set along with a non-empty row_ranges");
 
   _num_rows = val;
 }
 
+void parquet_reader_options::set_row_ranges(std::vector<std::pair<int64_t, int64_t>> row_ranges)
+{
+  CUDF_EXPECTS(row_ranges.empty() or (_row_groups.empty() and _skip_rows == 0 and
+                                      not _num_rows.has_value()),
+               "row_ranges can't be set along with row_groups, skip_rows or num_rows");
+  CUDF_EXPECTS(std::all_of(row_ranges.cbegin(),
+                           row_ranges.cend(),
+                           [](auto const& range) {
+                             return range.first >= 0 and range.first <= range.second;
+                           }),
+               "row_ranges must be non-negative [start, end) pairs");
+
+  _row_ranges = std::move(row_ranges);
+}
+
 void parquet_writer_options::set_partitions(std::vector<partition_info> partitions)
 {
   CUDF_EXPECTS(partitions.size() == _sink.num_sinks(),
@@ -808,12 +1214,25 @@ void parquet_writer_options::set_max_dictionary_size(size_t size_bytes)
   _max_dictionary_size = size_bytes;
 }
 
+void parquet_writer_options::set_bloom_filter_fpp(double fpp)
+{
+  CUDF_EXPECTS(fpp > 0.0 and fpp < 1.0,
+               "The Bloom filter false positive probability must be in the range (0, 1).");
+  _bloom_filter_fpp = fpp;
+}
+
 void parquet_writer_options::set_max_page_fragment_size(size_type size_rows)
 {
   CUDF_EXPECTS(size_rows > 0, "Page fragment size must be a positive integer.");
   _max_page_fragment_size = size_rows;
 }
 
+void parquet_writer_options::set_max_encode_buffer_bytes(size_t size_bytes)
+{
+  CUDF_EXPECTS(size_bytes > 0, "The encode buffer size must be a positive integer.");
+  _max_encode_buffer_bytes = size_bytes;
+}
+
 parquet_writer_options_builder& parquet_writer_options_builder::partitions(
   std::vector<partition_info> partitions)
 {
@@ -848,6 +1267,12 @@ parquet_writer_options_builder& parquet_writer_options_builder::max_dictionary_s
   return *this;
 }
 
+parquet_writer_options_builder& parquet_writer_options_builder::bloom_filter_fpp(double val)
+{
+  options.set_bloom_filter_fpp(val);
+  return *this;
+}
+
 parquet_writer_options_builder& parquet_writer_options_builder::max_page_fragment_size(
   size_type val)
 {
@@ -855,12 +1280,24 @@ parquet_writer_options_builder& parquet_writer_options_builder::max_page_fragmen
   return *this;
 }
 
+parquet_writer_options_builder& parquet_writer_options_builder::max_encode_buffer_bytes(size_t val)
+{
+  options.set_max_encode_buffer_bytes(val);
+  return *this;
+}
+
 parquet_writer_options_builder& parquet_writer_options_builder::write_v2_headers(bool enabled)
 {
   options.enable_write_v2_headers(enabled);
   return *this;
 }
 
+parquet_writer_options_builder& parquet_writer_options_builder::adaptive_encoding(bool enabled)
+{
+  options.enable_adaptive_encoding(enabled);
+  return *this;
+}
+
 parquet_writer_options_builder& parquet_writer_options_builder::sorting_columns(
   std::vector<sorting_column> sorting_columns)
 {
@@ -922,12 +1359,25 @@ void chunked_parquet_writer_options::set_max_dictionary_size(size_t size_bytes)
   _max_dictionary_size = size_bytes;
 }
 
+void chunked_parquet_writer_options::set_bloom_filter_fpp(double fpp)
+{
+  CUDF_EXPECTS(fpp > 0.0 and fpp < 1.0,
+               "The Bloom filter false positive probability must be in the range (0, 1).");
+  _bloom_filter_fpp = fpp;
+}
+
 void chunked_parquet_writer_options::set_max_page_fragment_size(size_type size_rows)
 {
   CUDF_EXPECTS(size_rows > 0, "Page fragment size must be a positive integer.");
   _max_page_fragment_size = size_rows;
 }
 
+void chunked_parquet_writer_options::set_max_encode_buffer_bytes(size_t size_bytes)
+{
+  CUDF_EXPECTS(size_bytes > 0, "The encode buffer size must be a positive integer.");
+  _max_encode_buffer_bytes = size_bytes;
+}
+
 chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::key_value_metadata(
   std::vector<std::map<std::string, std::string>> metadata)
 {
@@ -949,6 +1399,13 @@ chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::
   return *this;
 }
 
+chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::bloom_filter_fpp(
+  double val)
+{
+  options.set_bloom_filter_fpp(val);
+  return *this;
+}
+
 chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::write_v2_headers(
   bool enabled)
 {
@@ -956,6 +1413,13 @@ chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::
   return *this;
 }
 
+chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::adaptive_encoding(
+  bool enabled)
+{
+  options.enable_adaptive_encoding(enabled);
+  return *this;
+}
+
 chunked_parquet_writer_options_builder& chunked_parquet_writer_options_builder::sorting_columns(
   std::vector<sorting_column> sorting_columns)
 {
@@ -970,4 +1434,11 @@ chunked_parquet_writer_options_builder::max_page_fragment_size(size_type val)
   return *this;
 }
 
+chunked_parquet_writer_options_builder&
+chunked_parquet_writer_options_builder::max_encode_buffer_bytes(size_t val)
+{
+  options.set_max_encode_buffer_bytes(val);
+  return *this;
+}
+
 }  // namespace cudf::io
@@ -14,7 +14,11 @@
  * limitations under the License.
  */
 
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -22,6 +26,10 @@
 
 #include <thrust/find.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace cudf::io::json::detail {
 
 // Extract the first character position in the string.
@@ -34,4 +42,57 @@ size_type find_first_delimiter(device_span<char const> d_data,
   return first_delimiter_position != d_data.end() ? first_delimiter_position - d_data.begin() : -1;
 }
 
+std::vector<text::byte_range_info> plan_byte_ranges(host_span<std::unique_ptr<datasource>> sources,
+                                                    size_t num_ranges)
+{
+  CUDF_EXPECTS(num_ranges > 0, "The number of byte ranges must be positive");
+  std::vector<size_t> source_ends(sources.size());
+  std::transform_inclusive_scan(sources.begin(),
+                                sources.end(),
+                                source_ends.begin(),
+                                std::plus<size_t>{},
+                                [](std::unique_ptr<datasource> const& s) { return s->size(); });
+  auto const total_size = source_ends.empty() ? size_t{0} : source_ends.back();
+  if (total_size == 0) { return {}; }
+
+  // Position of the first line delimiter at or after `pos`, or `total_size` if there is none.
+  // Only small windows of the sources around the split points are read.
+  auto const find_next_delimiter = [&](size_t pos) {
+    constexpr size_t window_size = 64 * 1024;
+    auto src_idx = static_cast<size_t>(std::distance(
+      source_ends.begin(), std::upper_bound(source_ends.begin(), source_ends.end(), pos)));
+    while (src_idx < sources.size()) {
+      auto const src_start = src_idx == 0 ? 0 : source_ends[src_idx - 1];
+      auto const read_size = std::min(window_size, source_ends[src_idx] - pos);
+      auto const buffer    = sources[src_idx]->host_read(pos - src_start, read_size);
+      if (buffer->size() == 0) { break; }
+      auto const data  = reinterpret_cast<char const*>(buffer->data());
+      auto const delim = std::find(data, data + buffer->size(), '\n');
+      if (delim != data + buffer->size()) { return pos + (delim - data); }
+      pos += buffer->size();
+      if (pos == source_ends[src_idx]) { ++src_idx; }
+    }
+    return total_size;
+  };
+
+  // Each range after the first starts at a line delimiter, so the reader skips only that
+  // delimiter and ends the range at the delimiter that starts the next one.
+  std::vector<size_t> range_starts{0};
+  for (size_t i = 1; i < num_ranges; ++i) {
+    auto const target = std::max(total_size / num_ranges * i, range_starts.back() + 1);
+    if (target >= total_size) { break; }
+    auto const delim_pos = find_next_delimiter(target);
+    // Skip the split if no record starts after the delimiter
+    if (delim_pos + 1 >= total_size) { break; }
+    range_starts.push_back(delim_pos);
+  }
+
+  std::vector<text::byte_range_info> ranges;
+  for (size_t i = 0; i < range_starts.size(); ++i) {
+    auto const end = i + 1 < range_starts.size() ? range_starts[i + 1] : total_size;
+    ranges.emplace_back(range_starts[i], end - range_starts[i]);
+  }
+  return ranges;
+}
+
 }  // namespace cudf::io::json::detail
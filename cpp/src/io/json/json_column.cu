@@ -651,18 +651,23 @@ void make_device_json_column(device_span<SymbolT const> input,
     return std::pair{name, parent_col_id};
   };
 
-  // Prune columns that are not required to be parsed.
-  if (options.is_enabled_prune_columns()) {
+  // Prune columns that are not required to be parsed, either the ones not selected by the
+  // column paths or, if those are not set, the ones without a dtype in the options.
+  auto const is_projected   = options.get_columns().has_value();
+  auto const selected_paths = is_projected ? split_column_paths(options.get_columns().value())
+                                           : std::vector<std::vector<std::string>>{};
+  if (is_projected or options.is_enabled_prune_columns()) {
     for (auto const this_col_id : unique_col_ids) {
       if (column_categories[this_col_id] == NC_ERR || column_categories[this_col_id] == NC_FN) {
         continue;
       }
       // Struct, List, String, Value
       auto [name, parent_col_id] = name_and_parent_index(this_col_id);
-      // get path of this column, and get its dtype if present in options
-      auto const nt                             = tree_path.get_path(this_col_id);
-      std::optional<data_type> const user_dtype = get_path_data_type(nt, options);
-      if (!user_dtype.has_value() and parent_col_id != parent_node_sentinel) {
+      // get path of this column, and check whether it is selected in options
+      auto const nt          = tree_path.get_path(this_col_id);
+      auto const is_selected = is_projected ? is_path_selected(nt, selected_paths)
+                                            : get_path_data_type(nt, options).has_value();
+      if (!is_selected and parent_col_id != parent_node_sentinel) {
         is_pruned[this_col_id] = 1;
         continue;
       } else {
@@ -1180,6 +1185,9 @@ table_with_metadata device_parse_nested_json(device_span<SymbolT const> d_input,
   std::vector<std::unique_ptr<column>> out_columns;
   std::vector<column_name_info> out_column_names;
   auto parse_opt = parsing_options(options, stream);
+  // The selected column paths have already been pruned from the column tree
+  auto const prune_by_dtypes =
+    options.is_enabled_prune_columns() and not options.get_columns().has_value();
 
   // Iterate over the struct's child columns and convert to cudf column
   size_type column_index = 0;
@@ -1227,13 +1235,13 @@ table_with_metadata device_parse_nested_json(device_span<SymbolT const> d_input,
     debug_schema_print(child_schema_element);
 #endif
 
-    if (!options.is_enabled_prune_columns() or child_schema_element.has_value()) {
+    if (!prune_by_dtypes or child_schema_element.has_value()) {
       // Get this JSON column's cudf column and schema info, (modifies json_col)
       auto [cudf_col, col_name_info] =
         device_json_column_to_cudf_column(json_col,
                                           d_input,
                                           parse_opt,
-                                          options.is_enabled_prune_columns(),
+                                          prune_by_dtypes,
                                           child_schema_element,
                                           stream,
                                           mr);
@@ -44,8 +44,10 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/transform_output_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
+#include <thrust/logical.h>
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
 #include <thrust/scan.h>
@@ -279,6 +281,9 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
 
   // Node levels: transform_exclusive_scan, copy_if.
   rmm::device_uvector<TreeDepthT> node_levels(num_nodes, stream, mr);
+  // Whether the tokens are flat records, i.e., JSON lines whose rows hold no nested values.
+  // Their parent node ids are derived from the node levels, without the logical stack algorithm.
+  bool is_flat_records = false;
   {
     rmm::device_uvector<TreeDepthT> token_levels(num_tokens, stream);
     auto const push_pop_it = thrust::make_transform_iterator(
@@ -298,6 +303,16 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
                                                             stream);
     CUDF_EXPECTS(thrust::distance(node_levels.begin(), node_levels_end) == num_nodes,
                  "node level count mismatch");
+
+    // Lists and structs below the row level are nested values
+    auto const is_nested_value = [] __device__(auto const token_level) -> bool {
+      auto const token = thrust::get<0>(token_level);
+      return token == token_t::ListBegin or
+             (token == token_t::StructBegin and thrust::get<1>(token_level) > 0);
+    };
+    auto const token_level_it = thrust::make_zip_iterator(tokens.begin(), token_levels.begin());
+    is_flat_records           = thrust::none_of(
+      rmm::exec_policy(stream), token_level_it, token_level_it + num_tokens, is_nested_value);
   }
 
   // Node parent ids:
@@ -335,26 +350,56 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
       }
     };
 
-    thrust::transform(
-      rmm::exec_policy(stream),
-      node_token_ids.begin(),
-      node_token_ids.end(),
-      parent_node_ids.begin(),
-      [node_ids_gpu = node_token_ids.begin(), num_nodes, first_childs_parent_token_id] __device__(
-        NodeIndexT const tid) -> NodeIndexT {
-        auto const pid = first_childs_parent_token_id(tid);
-        return pid < 0
-                 ? parent_node_sentinel
-                 : thrust::lower_bound(thrust::seq, node_ids_gpu, node_ids_gpu + num_nodes, pid) -
-                     node_ids_gpu;
-        // parent_node_sentinel is -1, useful for segmented max operation below
-      });
+    if (is_flat_records) {
+      // Rows are at level 0, their field names at level 1, and the field values at level 2.
+      // The parent of a field name is the last row before it, and the parent of a field value is
+      // the field name right before it.
+      auto const node_ids = thrust::make_counting_iterator<NodeIndexT>(0);
+      thrust::transform_inclusive_scan(
+        rmm::exec_policy(stream),
+        node_ids,
+        node_ids + num_nodes,
+        parent_node_ids.begin(),
+        [node_levels = node_levels.begin()] __device__(NodeIndexT const node_id) -> NodeIndexT {
+          return node_levels[node_id] == 0 ? node_id : parent_node_sentinel;
+        },
+        thrust::maximum<NodeIndexT>{});
+      thrust::transform(
+        rmm::exec_policy(stream),
+        node_ids,
+        node_ids + num_nodes,
+        parent_node_ids.begin(),
+        parent_node_ids.begin(),
+        [node_levels = node_levels.begin()] __device__(NodeIndexT const node_id,
+                                                       NodeIndexT const last_row_id) -> NodeIndexT {
+          switch (node_levels[node_id]) {
+            case 0: return parent_node_sentinel;
+            case 1: return last_row_id;
+            default: return node_id - 1;
+          }
+        });
+    } else {
+      thrust::transform(
+        rmm::exec_policy(stream),
+        node_token_ids.begin(),
+        node_token_ids.end(),
+        parent_node_ids.begin(),
+        [node_ids_gpu = node_token_ids.begin(), num_nodes, first_childs_parent_token_id] __device__(
+          NodeIndexT const tid) -> NodeIndexT {
+          auto const pid = first_childs_parent_token_id(tid);
+          return pid < 0 ? parent_node_sentinel
+                         : thrust::lower_bound(
+                             thrust::seq, node_ids_gpu, node_ids_gpu + num_nodes, pid) -
+                             node_ids_gpu;
+          // parent_node_sentinel is -1, useful for segmented max operation below
+        });
+      // Propagate parent node to siblings from first sibling - inplace.
+      propagate_first_sibling_to_other(
+        cudf::device_span<TreeDepthT const>{node_levels.data(), node_levels.size()},
+        parent_node_ids,
+        stream);
+    }
   }
-  // Propagate parent node to siblings from first sibling - inplace.
-  propagate_first_sibling_to_other(
-    cudf::device_span<TreeDepthT const>{node_levels.data(), node_levels.size()},
-    parent_node_ids,
-    stream);
 
   // Node categories: copy_if with transform.
   rmm::device_uvector<NodeT> node_categories(num_nodes, stream, mr);
@@ -463,10 +508,13 @@ tree_meta_t get_tree_representation(device_span<PdaTokenT const> tokens,
       });
 
     // propagate parent node from first sibling to other siblings - inplace.
-    propagate_first_sibling_to_other(
-      cudf::device_span<TreeDepthT const>{token_levels.data(), token_levels.size()},
-      parent_node_ids,
-      stream);
+    // Flat records alternate between struct begin and end, so every end already has its parent.
+    if (not is_flat_records) {
+      propagate_first_sibling_to_other(
+        cudf::device_span<TreeDepthT const>{token_levels.data(), token_levels.size()},
+        parent_node_ids,
+        stream);
+    }
 
     // scatter to node_range_end for only nested end tokens.
     auto token_indices_it =
@@ -824,6 +872,28 @@ std::pair<rmm::device_uvector<NodeIndexT>, rmm::device_uvector<NodeIndexT>> gene
   return {std::move(col_id), std::move(parent_col_id)};
 }
 
+/**
+ * @brief Checks whether the tree holds flat records, i.e., JSON lines whose rows hold no nested
+ * struct or list values.
+ *
+ * @param d_tree Tree representation of the JSON string
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return true if the tree holds flat records
+ */
+bool is_flat_records(tree_meta_t const& d_tree, rmm::cuda_stream_view stream)
+{
+  auto const node_it =
+    thrust::make_zip_iterator(d_tree.node_categories.begin(), d_tree.node_levels.begin());
+  return thrust::none_of(rmm::exec_policy(stream),
+                         node_it,
+                         node_it + d_tree.node_categories.size(),
+                         [] __device__(auto const node) {
+                           auto const category = thrust::get<0>(node);
+                           return category == NC_LIST or
+                                  (category == NC_STRUCT and thrust::get<1>(node) > 0);
+                         });
+}
+
 /**
  * @brief Computes row indices of each node in the hierarchy.
  * 2. Generate row_offset.
@@ -854,6 +924,21 @@ rmm::device_uvector<size_type> compute_row_offsets(rmm::device_uvector<NodeIndex
   CUDF_FUNC_RANGE();
   auto const num_nodes = d_tree.node_categories.size();
 
+  // Flat records: every node belongs to the row of the last root node before it
+  if (is_enabled_lines and not is_array_of_arrays and is_flat_records(d_tree, stream)) {
+    rmm::device_uvector<size_type> row_offsets(num_nodes, stream, mr);
+    auto const is_row_it = thrust::make_transform_iterator(
+      d_tree.parent_node_ids.begin(),
+      cuda::proclaim_return_type<size_type>([] __device__(NodeIndexT const pnid) -> size_type {
+        return pnid == parent_node_sentinel;
+      }));
+    auto const row_offsets_it = thrust::make_transform_output_iterator(
+      row_offsets.begin(), [] __device__(size_type const num_rows) { return num_rows - 1; });
+    thrust::inclusive_scan(
+      rmm::exec_policy(stream), is_row_it, is_row_it + num_nodes, row_offsets_it);
+    return row_offsets;
+  }
+
   rmm::device_uvector<size_type> scatter_indices(num_nodes, stream);
   thrust::sequence(rmm::exec_policy(stream), scatter_indices.begin(), scatter_indices.end());
 
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/io/detail/json.hpp>
+#include <cudf/io/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <algorithm>
+#include <map>
+#include <optional>
+#include <string>
+
+namespace cudf::io::json::detail {
+
+namespace {
+
+/**
+ * @brief Type of a column merged across the tables read from parts of the input.
+ */
+struct merged_type {
+  std::optional<data_type> type;                // unset while all values seen are null
+  std::map<std::string, merged_type> children;  // child types of struct and list columns
+};
+
+bool is_number(data_type type)
+{
+  return cudf::is_integral_not_bool(type) or cudf::is_floating_point(type);
+}
+
+void merge_column(merged_type& merged, column_view const& col, column_name_info const& info)
+{
+  // All null parts carry no type information
+  if (col.size() == col.null_count()) { return; }
+
+  if (not merged.type.has_value()) {
+    merged.type = col.type();
+  } else if (merged.type.value() != col.type()) {
+    // Mixed numbers are read as floating point, any other mix of types is read as strings
+    merged.type = is_number(merged.type.value()) and is_number(col.type())
+                    ? data_type{type_id::FLOAT64}
+                    : data_type{type_id::STRING};
+    merged.children.clear();
+  }
+
+  if (merged.type->id() == type_id::STRUCT) {
+    auto const num_children = std::min<size_t>(col.num_children(), info.children.size());
+    for (size_t i = 0; i < num_children; ++i) {
+      merge_column(merged.children[info.children[i].name], col.child(i), info.children[i]);
+    }
+  } else if (merged.type->id() == type_id::LIST) {
+    auto const child_idx = lists_column_view::child_column_index;
+    CUDF_EXPECTS(info.children.size() > static_cast<size_t>(child_idx),
+                 "Missing list child column metadata");
+    merge_column(merged.children[info.children[child_idx].name],
+                 col.child(child_idx),
+                 info.children[child_idx]);
+  }
+}
+
+schema_element to_schema_element(merged_type const& merged)
+{
+  // Columns that are null in all parts are read as strings
+  schema_element schema{merged.type.value_or(data_type{type_id::STRING}), {}};
+  for (auto const& [name, child] : merged.children) {
+    schema.child_types.emplace(name, to_schema_element(child));
+  }
+  return schema;
+}
+
+schema_element to_schema_element(column_view const& col, column_name_info const& info)
+{
+  schema_element schema{col.type(), {}};
+  if (col.type().id() == type_id::STRUCT or col.type().id() == type_id::LIST) {
+    // The offsets child of list columns has no schema
+    auto const first_child =
+      col.type().id() == type_id::LIST ? lists_column_view::child_column_index : 0;
+    auto const num_children = std::min<size_type>(col.num_children(), info.children.size());
+    for (size_type i = first_child; i < num_children; ++i) {
+      schema.child_types.emplace(info.children[i].name,
+                                 to_schema_element(col.child(i), info.children[i]));
+    }
+  }
+  return schema;
+}
+
+}  // namespace
+
+std::map<std::string, schema_element> extract_schema(table_with_metadata const& table)
+{
+  auto const& schema_info = table.metadata.schema_info;
+  CUDF_EXPECTS(static_cast<size_type>(schema_info.size()) == table.tbl->num_columns(),
+               "Table metadata does not match the number of columns");
+
+  std::map<std::string, schema_element> schema;
+  for (size_type col_idx = 0; col_idx < table.tbl->num_columns(); ++col_idx) {
+    schema.emplace(schema_info[col_idx].name,
+                   to_schema_element(table.tbl->get_column(col_idx).view(), schema_info[col_idx]));
+  }
+  return schema;
+}
+
+std::map<std::string, schema_element> merge_schemas(host_span<table_with_metadata const> tables)
+{
+  std::map<std::string, merged_type> merged;
+  for (auto const& table : tables) {
+    auto const& schema_info = table.metadata.schema_info;
+    CUDF_EXPECTS(static_cast<size_type>(schema_info.size()) == table.tbl->num_columns(),
+                 "Table metadata does not match the number of columns");
+    for (size_type col_idx = 0; col_idx < table.tbl->num_columns(); ++col_idx) {
+      auto const& info = schema_info[col_idx];
+      merge_column(merged[info.name], table.tbl->get_column(col_idx).view(), info);
+    }
+  }
+
+  std::map<std::string, schema_element> schema;
+  for (auto const& [name, column_type] : merged) {
+    schema.emplace(name, to_schema_element(column_type));
+  }
+  return schema;
+}
+
+}  // namespace cudf::io::json::detail
@@ -331,6 +331,27 @@ std::optional<data_type> get_path_data_type(
   host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
   cudf::io::json_reader_options const& options);
 
+/**
+ * @brief Splits `.` separated column paths into their field names
+ *
+ * @param col_names column paths to split
+ * @return field names of each column path
+ */
+std::vector<std::vector<std::string>> split_column_paths(std::vector<std::string> const& col_names);
+
+/**
+ * @brief Checks whether a column is selected by one of the given column paths
+ *
+ * List levels in the column path are skipped, so that a field of a list of structs is selected
+ * by the same path as a field of a struct.
+ *
+ * @param path path of the column
+ * @param selected_paths field names of the selected column paths
+ * @return true if one of the selected paths is a prefix of the column path
+ */
+bool is_path_selected(host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
+                      host_span<std::vector<std::string> const> selected_paths);
+
 /**
  * @brief Helper class to get path of a column by column id from reduced column tree
  *
@@ -18,6 +18,7 @@
 
 #include <cudf/detail/utilities/visitor_overload.hpp>
 
+#include <algorithm>
 #include <optional>
 #include <string>
 #include <vector>
@@ -101,6 +102,43 @@ std::optional<data_type> get_path_data_type(
   }
 }
 
+std::vector<std::vector<std::string>> split_column_paths(std::vector<std::string> const& col_names)
+{
+  std::vector<std::vector<std::string>> paths;
+  paths.reserve(col_names.size());
+  for (auto const& col_name : col_names) {
+    std::vector<std::string> fields;
+    std::size_t start = 0;
+    while (true) {
+      auto const end = col_name.find('.', start);
+      fields.emplace_back(col_name.substr(start, end - start));
+      if (end == std::string::npos) break;
+      start = end + 1;
+    }
+    paths.emplace_back(std::move(fields));
+  }
+  return paths;
+}
+
+bool is_path_selected(host_span<std::pair<std::string, cudf::io::json::NodeT> const> path,
+                      host_span<std::vector<std::string> const> selected_paths)
+{
+  if (path.empty()) return false;
+  // field names from root to leaf, skipping the children of lists
+  std::vector<std::string const*> fields;
+  fields.reserve(path.size());
+  for (auto i = path.size(); i > 0; --i) {
+    auto const is_list_child = i < path.size() && path[i].second == NC_LIST;
+    if (!is_list_child) { fields.push_back(&path[i - 1].first); }
+  }
+  return std::any_of(selected_paths.begin(), selected_paths.end(), [&](auto const& selected) {
+    return selected.size() <= fields.size() &&
+           std::equal(selected.begin(), selected.end(), fields.begin(), [](auto const& a, auto b) {
+             return a == *b;
+           });
+  });
+}
+
 // idea: write a memoizer using template and lambda?, then call recursively.
 std::vector<path_from_tree::path_rep> path_from_tree::get_path(NodeIndexT this_col_id)
 {
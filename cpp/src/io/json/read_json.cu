@@ -16,13 +16,17 @@
 
 #include "io/comp/io_uncomp.hpp"
 #include "io/json/nested_json.hpp"
+#include "io/utilities/column_filter.hpp"
 #include "read_json.hpp"
 
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/detail/json.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/integer_utils.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <rmm/device_uvector.hpp>
@@ -32,7 +36,12 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/scatter.h>
 
+#include <algorithm>
+#include <iterator>
 #include <numeric>
+#include <string>
+#include <variant>
+#include <vector>
 
 namespace cudf::io::json::detail {
 
@@ -84,7 +93,7 @@ device_span<char> ingest_raw_input(device_span<char> buffer,
     std::transform_inclusive_scan(sources.begin(),
                                   sources.end(),
                                   prefsum_source_sizes.begin(),
-                                  std::plus<int>{},
+                                  std::plus<size_t>{},
                                   [](const std::unique_ptr<datasource>& s) { return s->size(); });
     auto upper =
       std::upper_bound(prefsum_source_sizes.begin(), prefsum_source_sizes.end(), range_offset);
@@ -296,7 +305,78 @@ table_with_metadata read_json(host_span<std::unique_ptr<datasource>> sources,
   auto buffer =
     cudf::device_span<char const>(reinterpret_cast<char const*>(bufview.data()), bufview.size());
   stream.synchronize();
-  return device_parse_nested_json(buffer, reader_opts, stream, mr);
+  if (not reader_opts.get_filter().has_value()) {
+    return device_parse_nested_json(buffer, reader_opts, stream, mr);
+  }
+
+  // The parsed table is temporary, only the rows that pass the filter are copied to the output
+  auto parsed = device_parse_nested_json(
+    buffer, reader_opts, stream, rmm::mr::get_current_device_resource());
+  std::vector<std::string> column_names;
+  std::transform(parsed.metadata.schema_info.cbegin(),
+                 parsed.metadata.schema_info.cend(),
+                 std::back_inserter(column_names),
+                 [](auto const& info) { return info.name; });
+  auto const converter = cudf::io::detail::column_filter_converter{
+    reader_opts.get_filter()->get(), column_names};
+  auto const predicate = cudf::io::detail::evaluate_filter(
+    parsed.tbl->select(converter.get_referenced_columns()), converter, stream);
+  return {cudf::detail::apply_boolean_mask(parsed.tbl->view(), predicate->view(), stream, mr),
+          std::move(parsed.metadata)};
+}
+
+chunked_reader::chunked_reader(std::size_t chunk_read_limit,
+                               std::vector<std::unique_ptr<datasource>>&& sources,
+                               json_reader_options const& options,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _sources{std::move(sources)}, _options{options}, _stream{stream}, _mr{mr}
+{
+  CUDF_EXPECTS(_options.is_enabled_lines(), "Chunked reading is supported only for JSON Lines");
+  CUDF_EXPECTS(_options.get_compression() == compression_type::NONE,
+               "Chunked reading of compressed inputs is not supported");
+  CUDF_EXPECTS(_options.get_byte_range_offset() == 0 and _options.get_byte_range_size() == 0,
+               "Byte range options cannot be used with the chunked reader");
+
+  auto const total_size = sources_size(_sources, 0, 0);
+  auto const num_ranges =
+    chunk_read_limit == 0
+      ? 1
+      : std::max<size_t>(1, cudf::util::div_rounding_up_safe(total_size, chunk_read_limit));
+  _ranges = plan_byte_ranges(_sources, num_ranges);
+
+  // Types inferred from the first chunks are carried to the following chunks, unless the types
+  // are specified in the options
+  auto const has_dtypes =
+    std::visit([](auto const& dtypes) { return not dtypes.empty(); }, _options.get_dtypes());
+  if (not has_dtypes) { _schema.emplace(); }
+}
+
+bool chunked_reader::has_next() const { return _next_range < _ranges.size(); }
+
+table_with_metadata chunked_reader::read_chunk()
+{
+  if (not has_next()) { return table_with_metadata{std::make_unique<table>(), {}}; }
+
+  auto range         = _ranges[_next_range++];
+  auto chunk_options = _options;
+  chunk_options.set_byte_range_offset(range.offset());
+  chunk_options.set_byte_range_size(range.size());
+  if (_schema.has_value() and not _schema->empty()) { chunk_options.set_dtypes(*_schema); }
+  auto result = read_json(_sources, chunk_options, _stream, _mr);
+
+  if (_schema.has_value()) {
+    // Columns already in the schema were read with its types. Add the columns seen for the first
+    // time, unless all their values are null and their type is not known yet.
+    auto const chunk_schema = merge_schemas(host_span<table_with_metadata const>{&result, 1});
+    for (size_type col_idx = 0; col_idx < result.tbl->num_columns(); ++col_idx) {
+      auto const& col  = result.tbl->get_column(col_idx);
+      auto const& name = result.metadata.schema_info[col_idx].name;
+      if (col.null_count() == col.size() or _schema->count(name) != 0) { continue; }
+      _schema->emplace(name, chunk_schema.at(name));
+    }
+  }
+  return result;
 }
 
 }  // namespace cudf::io::json::detail
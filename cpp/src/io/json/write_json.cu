@@ -37,6 +37,7 @@
 #include <cudf/strings/detail/combine.hpp>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utilities.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/structs/structs_column_view.hpp>
 #include <cudf/table/table.hpp>
@@ -45,17 +46,12 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
-#include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
-#include <cuda/functional>
-#include <thrust/for_each.h>
-#include <thrust/gather.h>
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
-#include <thrust/scan.h>
 #include <thrust/tabulate.h>
 
 #include <algorithm>
@@ -182,55 +178,56 @@ struct escape_strings_fn {
   }
 };
 
-// Struct - scatter string_views of each element in a struct column
-struct struct_scatter_strings_fn {
+/**
+ * @brief Appends a string to the output row, or adds its size in the sizing pass
+ */
+__device__ inline void write_string(string_view const d_str, char*& d_buffer, size_type& bytes)
+{
+  if (d_buffer) {
+    d_buffer = cudf::strings::detail::copy_string(d_buffer, d_str);
+  } else {
+    bytes += d_str.size_bytes();
+  }
+}
+
+/**
+ * @brief Functor to write each row of a table of strings columns as a JSON struct.
+ *
+ * The row is sized in the first pass and written directly into the output buffer in the second
+ * pass of `make_strings_children`.
+ */
+struct struct_row_fn {
   table_device_view const tbl;
   column_device_view const col_names;
-  size_type const strviews_per_column;
-  size_type const num_strviews_per_row;
   string_view const row_prefix;       // "{"
   string_view const row_suffix;       // "}" or "}\n" for json-lines
   string_view const value_separator;  // ","
   string_view const narep;            // null entry replacement
   bool const include_nulls;
-  string_view* d_strviews;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
 
-  /**
-   * @brief Scatters string_views for each element in a struct column
-   *
-   * @param idx Column-major index of the element to scatter
-   */
-  __device__ void operator()(size_type idx)
+  __device__ void operator()(size_type row)
   {
-    auto const row        = idx / tbl.num_columns();
-    auto const col        = idx % tbl.num_columns();
-    auto const d_str_null = tbl.column(col).is_null(row);
-    auto const this_index = row * num_strviews_per_row + col * strviews_per_column + 1;
-    // prefix
-    if (col == 0) d_strviews[this_index - 1] = row_prefix;
-    if (col != 0) d_strviews[this_index - 1] = include_nulls ? value_separator : string_view{};
-    if (!include_nulls && d_str_null) {
-      d_strviews[this_index]     = string_view{};
-      d_strviews[this_index + 1] = string_view{};
-    } else {
-      auto const d_col_name = col_names.element<string_view>(col);
-      auto const d_str = d_str_null ? narep : tbl.column(col).template element<string_view>(row);
+    char* d_buffer  = d_chars ? d_chars + d_offsets[row] : nullptr;
+    size_type bytes = 0;
+
+    write_string(row_prefix, d_buffer, bytes);
+    bool is_first_value = true;
+    for (size_type col = 0; col < tbl.num_columns(); ++col) {
+      auto const d_str_null = tbl.column(col).is_null(row);
+      // skip the null entries, along with their separators
+      if (!include_nulls && d_str_null) { continue; }
+      if (!is_first_value) { write_string(value_separator, d_buffer, bytes); }
       // column_name: value
-      d_strviews[this_index]     = d_col_name;
-      d_strviews[this_index + 1] = d_str;
+      write_string(col_names.element<string_view>(col), d_buffer, bytes);
+      write_string(d_str_null ? narep : tbl.column(col).element<string_view>(row), d_buffer, bytes);
+      is_first_value = false;
     }
-    // suffix
-    if (col == tbl.num_columns() - 1) { d_strviews[this_index + 2] = row_suffix; }
-  }
-};
+    write_string(row_suffix, d_buffer, bytes);
 
-struct validity_fn {
-  table_device_view const tbl;
-  __device__ bool operator()(size_type idx) const
-  {
-    auto const row = idx / tbl.num_columns();
-    auto const col = idx % tbl.num_columns();
-    return tbl.column(col).is_valid(row);
+    if (!d_chars) { d_sizes[row] = bytes; }
   }
 };
 
@@ -273,90 +270,68 @@ std::unique_ptr<column> struct_to_strings(table_view const& strings_columns,
                            strings_columns.end(),
                            [](auto const& c) { return c.type().id() == type_id::STRING; }),
                "All columns must be of type string");
-  auto constexpr strviews_per_column = 3;  // (for each "column_name:", "value",  "separator")
-  auto const num_strviews_per_row    = strings_columns.num_columns() * strviews_per_column + 1;
-  // e.g. {col1: value, col2: value, col3: value} = 1 + 3 + 3 + (3-1) + 1 = 10
 
   auto tbl_device_view = cudf::table_device_view::create(strings_columns, stream);
   auto d_column_names  = column_device_view::create(column_names, stream);
 
-  // Note for future: chunk it but maximize parallelism, if memory usage is high.
-  auto const total_strings = num_strviews_per_row * strings_columns.num_rows();
-  auto const total_rows    = strings_columns.num_rows() * strings_columns.num_columns();
-  rmm::device_uvector<string_view> d_strviews(total_strings, stream);
-  struct_scatter_strings_fn scatter_fn{*tbl_device_view,
-                                       *d_column_names,
-                                       strviews_per_column,
-                                       num_strviews_per_row,
-                                       row_prefix,
-                                       row_suffix,
-                                       value_separator,
-                                       narep.value(stream),
-                                       include_nulls,
-                                       d_strviews.begin()};
-  // scatter row_prefix, row_suffix, column_name:, value, value_separator as string_views
-  thrust::for_each(rmm::exec_policy(stream),
-                   thrust::make_counting_iterator<size_type>(0),
-                   thrust::make_counting_iterator<size_type>(total_rows),
-                   scatter_fn);
-  if (!include_nulls) {
-    // if previous column was null, then we skip the value separator
-    rmm::device_uvector<bool> d_str_separator(total_rows, stream);
-    auto row_num = cudf::detail::make_counting_transform_iterator(
-      0,
-      cuda::proclaim_return_type<size_type>([tbl = *tbl_device_view] __device__(auto idx)
-                                              -> size_type { return idx / tbl.num_columns(); }));
-    auto validity_iterator =
-      cudf::detail::make_counting_transform_iterator(0, validity_fn{*tbl_device_view});
-    thrust::exclusive_scan_by_key(rmm::exec_policy(stream),
-                                  row_num,
-                                  row_num + total_rows,
-                                  validity_iterator,
-                                  d_str_separator.begin(),
-                                  false,
-                                  thrust::equal_to<size_type>{},
-                                  thrust::logical_or<bool>{});
-    thrust::for_each(rmm::exec_policy(stream),
-                     thrust::make_counting_iterator<size_type>(0),
-                     thrust::make_counting_iterator<size_type>(total_rows),
-                     [write_separator = d_str_separator.begin(),
-                      d_strviews      = d_strviews.begin(),
-                      value_separator,
-                      tbl = *tbl_device_view,
-                      strviews_per_column,
-                      num_strviews_per_row] __device__(auto idx) {
-                       auto const row = idx / tbl.num_columns();
-                       auto const col = idx % tbl.num_columns();
-                       auto const this_index =
-                         row * num_strviews_per_row + col * strviews_per_column + 1;
-                       if (write_separator[idx] && tbl.column(col).is_valid(row)) {
-                         d_strviews[this_index - 1] = value_separator;
-                       }
-                     });
-  }
-  auto joined_col = make_strings_column(d_strviews, string_view{nullptr, 0}, stream, mr);
-
-  // gather from offset and create a new string column
-  auto old_offsets = strings_column_view(joined_col->view()).offsets();
-  rmm::device_uvector<size_type> row_string_offsets(strings_columns.num_rows() + 1, stream, mr);
-  auto const d_strview_offsets = cudf::detail::make_counting_transform_iterator(
-    0, cuda::proclaim_return_type<size_type>([num_strviews_per_row] __device__(size_type const i) {
-      return i * num_strviews_per_row;
-    }));
-  thrust::gather(rmm::exec_policy(stream),
-                 d_strview_offsets,
-                 d_strview_offsets + row_string_offsets.size(),
-                 old_offsets.begin<size_type>(),
-                 row_string_offsets.begin());
-  auto chars_data = joined_col->release().data;
-  return make_strings_column(
-    strings_columns.num_rows(),
-    std::make_unique<cudf::column>(std::move(row_string_offsets), rmm::device_buffer{}, 0),
-    std::move(chars_data.release()[0]),
-    0,
-    {});
+  // size and write each row directly into the output chars
+  auto [offsets_column, chars] =
+    cudf::strings::detail::make_strings_children(struct_row_fn{*tbl_device_view,
+                                                               *d_column_names,
+                                                               row_prefix,
+                                                               row_suffix,
+                                                               value_separator,
+                                                               narep.value(stream),
+                                                               include_nulls},
+                                                 strings_count,
+                                                 stream,
+                                                 mr);
+  return make_strings_column(strings_count, std::move(offsets_column), chars.release(), 0, {});
 }
 
+/**
+ * @brief Functor to write each row of a lists of strings column as a JSON list.
+ *
+ * The elements of each row are found through the list offsets, so the row is sized in the first
+ * pass and written directly into the output buffer in the second pass of `make_strings_children`.
+ */
+struct list_row_fn {
+  column_device_view const d_lists;
+  column_device_view const d_strings;  // child of the lists column
+  size_type const* list_offsets;
+  string_view const list_prefix;        // "["
+  string_view const list_suffix;        // "]"
+  string_view const element_separator;  // ","
+  string_view const element_narep;      // null element replacement
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  __device__ void operator()(size_type row)
+  {
+    if (d_lists.is_null(row)) {
+      if (!d_chars) { d_sizes[row] = 0; }
+      return;
+    }
+
+    char* d_buffer  = d_chars ? d_chars + d_offsets[row] : nullptr;
+    size_type bytes = 0;
+
+    write_string(list_prefix, d_buffer, bytes);
+    for (auto idx = list_offsets[row]; idx < list_offsets[row + 1]; ++idx) {
+      if (idx != list_offsets[row]) { write_string(element_separator, d_buffer, bytes); }
+      // value or na_rep
+      write_string(
+        d_strings.is_null(idx) ? element_narep : d_strings.element<string_view>(idx),
+        d_buffer,
+        bytes);
+    }
+    write_string(list_suffix, d_buffer, bytes);
+
+    if (!d_chars) { d_sizes[row] = bytes; }
+  }
+};
+
 /**
  * @brief Concatenates a list of strings columns into a single strings column.
  *
@@ -378,106 +353,29 @@ std::unique_ptr<column> join_list_of_strings(lists_column_view const& lists_stri
                                              rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE();
-
-  /*
-  create string_views of the list elements, and the list separators and list prefix/suffix.
-  then concatenates them all together.
-  gather offset of first string_view of each row as offsets for output string column.
-  Algorithm:
-    calculate #strviews per list using null mask, and list_offsets.
-    scan #strviews to get strviews_offset
-    create label segments.
-    sublist_index = index - offsets[label]
-    strviews_offset[label] + sublist_index = string_view index +1, +2
-    use above 2 to scatter element, element_seperator
-    scatter list_prefix, list_suffix to the right place using list_offsets
-    make_strings_column() and gather offsets, based on strviews_offset.
-  */
-  auto const offsets          = lists_strings.offsets();
-  auto const strings_children = lists_strings.get_sliced_child(stream);
-  auto const num_lists        = lists_strings.size();
-  auto const num_strings      = strings_children.size();
-  auto const num_offsets      = offsets.size();
-
-  rmm::device_uvector<size_type> d_strview_offsets(num_offsets, stream);
-  auto num_strings_per_list = cudf::detail::make_counting_transform_iterator(
-    0,
-    cuda::proclaim_return_type<size_type>(
-      [offsets = offsets.begin<size_type>(), num_offsets] __device__(size_type idx) {
-        if (idx + 1 >= num_offsets) return 0;
-        auto const length = offsets[idx + 1] - offsets[idx];
-        return length == 0 ? 2 : (2 + length + length - 1);
-      }));
-  thrust::exclusive_scan(rmm::exec_policy(stream),
-                         num_strings_per_list,
-                         num_strings_per_list + num_offsets,
-                         d_strview_offsets.begin());
-  auto const total_strings = d_strview_offsets.back_element(stream);
-
-  rmm::device_uvector<string_view> d_strviews(total_strings, stream);
-  // scatter null_list and list_prefix, list_suffix
-  auto col_device_view = cudf::column_device_view::create(lists_strings.parent(), stream);
-  thrust::for_each(rmm::exec_policy(stream),
-                   thrust::make_counting_iterator<size_type>(0),
-                   thrust::make_counting_iterator<size_type>(num_lists),
-                   [col = *col_device_view,
-                    list_prefix,
-                    list_suffix,
-                    d_strview_offsets = d_strview_offsets.begin(),
-                    d_strviews        = d_strviews.begin()] __device__(auto idx) {
-                     if (col.is_null(idx)) {
-                       d_strviews[d_strview_offsets[idx]]     = string_view{};
-                       d_strviews[d_strview_offsets[idx] + 1] = string_view{};
-                     } else {
-                       // [ ]
-                       d_strviews[d_strview_offsets[idx]]         = list_prefix;
-                       d_strviews[d_strview_offsets[idx + 1] - 1] = list_suffix;
-                     }
-                   });
-
-  // scatter string and separator
-  auto labels = cudf::lists::detail::generate_labels(
-    lists_strings, num_strings, stream, rmm::mr::get_current_device_resource());
-  auto d_strings_children = cudf::column_device_view::create(strings_children, stream);
-  thrust::for_each(rmm::exec_policy(stream),
-                   thrust::make_counting_iterator<size_type>(0),
-                   thrust::make_counting_iterator<size_type>(num_strings),
-                   [col                = *col_device_view,
-                    d_strview_offsets  = d_strview_offsets.begin(),
-                    d_strviews         = d_strviews.begin(),
-                    labels             = labels->view().begin<size_type>(),
-                    list_offsets       = offsets.begin<size_type>(),
-                    d_strings_children = *d_strings_children,
-                    element_separator,
-                    element_narep] __device__(auto idx) {
-                     auto const label         = labels[idx];
-                     auto const sublist_index = idx - list_offsets[label];
-                     auto const strview_index = d_strview_offsets[label] + sublist_index * 2 + 1;
-                     // value or na_rep
-                     auto const strview = d_strings_children.element<cudf::string_view>(idx);
-                     d_strviews[strview_index] =
-                       d_strings_children.is_null(idx) ? element_narep : strview;
-                     // separator
-                     if (sublist_index != 0) { d_strviews[strview_index - 1] = element_separator; }
-                   });
-
-  auto joined_col = make_strings_column(d_strviews, string_view{nullptr, 0}, stream, mr);
-
-  // gather from offset and create a new string column
-  auto old_offsets = strings_column_view(joined_col->view()).offsets();
-  rmm::device_uvector<size_type> row_string_offsets(num_offsets, stream, mr);
-  thrust::gather(rmm::exec_policy(stream),
-                 d_strview_offsets.begin(),
-                 d_strview_offsets.end(),
-                 old_offsets.begin<size_type>(),
-                 row_string_offsets.begin());
-  auto chars_data = joined_col->release().data;
-  return make_strings_column(
-    num_lists,
-    std::make_unique<cudf::column>(std::move(row_string_offsets), rmm::device_buffer{}, 0),
-    std::move(chars_data.release()[0]),
-    lists_strings.null_count(),
-    cudf::detail::copy_bitmask(lists_strings.parent(), stream, mr));
+  auto const num_lists = lists_strings.size();
+  if (num_lists == 0) { return make_empty_column(type_id::STRING); }
+
+  auto d_lists   = column_device_view::create(lists_strings.parent(), stream);
+  auto d_strings = column_device_view::create(lists_strings.child(), stream);
+
+  // size and write each list row directly into the output chars
+  auto [offsets_column, chars] =
+    cudf::strings::detail::make_strings_children(list_row_fn{*d_lists,
+                                                             *d_strings,
+                                                             lists_strings.offsets_begin(),
+                                                             list_prefix,
+                                                             list_suffix,
+                                                             element_separator,
+                                                             element_narep},
+                                                 num_lists,
+                                                 stream,
+                                                 mr);
+  return make_strings_column(num_lists,
+                             std::move(offsets_column),
+                             chars.release(),
+                             lists_strings.null_count(),
+                             cudf::detail::copy_bitmask(lists_strings.parent(), stream, mr));
 }
 
 /**
@@ -18,6 +18,9 @@
 
 #include "orc.hpp"
 
+#include <cudf/ast/expressions.hpp>
+
+#include <functional>
 #include <map>
 #include <optional>
 #include <vector>
@@ -129,6 +132,27 @@ class aggregate_orc_metadata {
     std::optional<size_type> const& num_read_rows,
     rmm::cuda_stream_view stream);
 
+  /**
+   * @brief Filters the stripes based on predicate filter
+   *
+   * The min/max values in the stripe statistics of the columns referenced by the filter are used
+   * to rule out the stripes in which no row can satisfy the filter.
+   *
+   * @param stripe_indices Lists of stripes to filter, one per source, or empty to filter all
+   * stripes
+   * @param output_column_ids ORC column IDs of the output columns
+   * @param output_dtypes Datatypes of the output columns
+   * @param filter AST expression to filter stripes based on their statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Filtered stripe indices, if any is filtered
+   */
+  [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_stripes(
+    std::vector<std::vector<size_type>> const& stripe_indices,
+    host_span<size_type const> output_column_ids,
+    host_span<data_type const> output_dtypes,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
   /**
    * @brief Filters ORC file to a selection of columns, based on their paths in the file.
    *
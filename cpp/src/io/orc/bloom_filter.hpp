@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file bloom_filter.hpp
+ * @brief ORC Bloom filter primitives, compatible with the filters written by the ORC and Hive
+ * writers.
+ *
+ * Integral values are hashed as 64-bit integers with Thomas Wang's hash, floating point values
+ * are widened to double and hashed through their bit representation, and strings are hashed
+ * with the 64-bit Murmur3 hash of their UTF-8 bytes. The functions here are usable from both host
+ * and device code.
+ */
+
+namespace cudf::io::orc::detail {
+
+// Seed of the Murmur3 hash used for strings
+constexpr uint64_t bloom_filter_murmur3_seed = 104729;
+
+namespace bloom {
+
+constexpr uint64_t c1 = 0x87c3'7b91'1142'53d5ul;
+constexpr uint64_t c2 = 0x4cf5'ad43'2745'937ful;
+constexpr uint64_t n1 = 0x52dc'e729ul;
+
+CUDF_HOST_DEVICE inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+CUDF_HOST_DEVICE inline uint64_t mix_k(uint64_t k)
+{
+  k *= c1;
+  k = rotl(k, 31);
+  return k * c2;
+}
+
+}  // namespace bloom
+
+/**
+ * @brief Hashes a 64-bit integer the way the ORC Bloom filters do
+ *
+ * @param key Value to hash; floating point values are passed as the bits of the double value
+ * @return The hash value
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_long_hash(uint64_t key)
+{
+  key = (~key) + (key << 21);
+  key ^= key >> 24;
+  key = (key + (key << 3)) + (key << 8);
+  key ^= key >> 14;
+  key = (key + (key << 2)) + (key << 4);
+  key ^= key >> 28;
+  key += key << 31;
+  return key;
+}
+
+/**
+ * @brief Computes the 64-bit Murmur3 hash of a byte sequence, as used by the ORC Bloom filters
+ *
+ * @param data Pointer to the bytes to hash
+ * @param len Number of bytes to hash
+ * @param seed Hash seed
+ * @return The hash value
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_bytes_hash(uint8_t const* data,
+                                                         size_t len,
+                                                         uint64_t seed = bloom_filter_murmur3_seed)
+{
+  using namespace bloom;
+  uint64_t h    = seed;
+  size_t offset = 0;
+  for (; offset + 8 <= len; offset += 8) {
+    uint64_t k = 0;
+    for (int i = 0; i < 8; ++i) {
+      k |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+    }
+    h ^= mix_k(k);
+    h = rotl(h, 27) * 5 + n1;
+  }
+  if (offset < len) {
+    uint64_t k = 0;
+    for (size_t i = 0; offset + i < len; ++i) {
+      k |= static_cast<uint64_t>(data[offset + i]) << (8 * i);
+    }
+    h ^= mix_k(k);
+  }
+
+  h ^= len;
+  h ^= h >> 33;
+  h *= 0xff51'afd7'ed55'8ccdul;
+  h ^= h >> 33;
+  h *= 0xc4ce'b9fe'1a85'ec53ul;
+  h ^= h >> 33;
+  return h;
+}
+
+/**
+ * @brief Returns the position of the bit that the given hash function sets for a hash value
+ *
+ * @param hash Hash value
+ * @param function Index of the hash function, starting at 1
+ * @param num_bits Number of bits in the filter
+ * @return Bit position
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_bit_position(uint64_t hash,
+                                                           uint32_t function,
+                                                           uint32_t num_bits)
+{
+  auto const hash1 = static_cast<uint32_t>(hash);
+  auto const hash2 = static_cast<uint32_t>(hash >> 32);
+  auto combined    = static_cast<int32_t>(hash1 + function * hash2);
+  if (combined < 0) { combined = ~combined; }
+  return static_cast<uint32_t>(combined) % num_bits;
+}
+
+/**
+ * @brief Checks whether an ORC Bloom filter may contain a hash value
+ *
+ * @param bitset Filter bitset, as little-endian 64-bit words
+ * @param num_bytes Size of the bitset in bytes, a multiple of 8
+ * @param num_hash_functions Number of hash functions of the filter
+ * @param hash Hash value to check
+ * @return `false` if the value is definitely not in the filter
+ */
+CUDF_HOST_DEVICE inline bool bloom_filter_contains(uint8_t const* bitset,
+                                                   size_t num_bytes,
+                                                   uint32_t num_hash_functions,
+                                                   uint64_t hash)
+{
+  auto const num_bits = static_cast<uint32_t>((num_bytes / 8) * 64);
+  if (num_bits == 0) { return true; }
+  for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+    auto const pos = bloom_filter_bit_position(hash, i, num_bits);
+    // bit `pos % 64` of the little-endian word `pos / 64` is byte `pos / 8`, bit `pos % 8`
+    if ((bitset[pos / 8] & (1u << (pos % 8))) == 0) { return false; }
+  }
+  return true;
+}
+
+}  // namespace cudf::io::orc::detail
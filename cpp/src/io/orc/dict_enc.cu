@@ -117,6 +117,9 @@ CUDF_KERNEL void __launch_bounds__(block_size)
   auto& dict            = dictionaries[col_idx][stripe_idx];
   auto const& col       = columns[dict.column_idx];
 
+  // No hash map is allocated for the stripes that are known to be encoded directly
+  if (dict.map_slots.empty()) { return; }
+
   // Make a view of the hash map
   auto hash_map_mutable  = map_type::device_mutable_view(dict.map_slots.data(),
                                                         dict.map_slots.size(),
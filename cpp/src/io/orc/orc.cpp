@@ -23,7 +23,10 @@
 
 #include <thrust/tabulate.h>
 
+#include <cstring>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf::io::orc {
 
@@ -227,6 +230,19 @@ void ProtobufReader::read(Metadata& s, size_t maxlen)
   function_builder(s, maxlen, op);
 }
 
+void ProtobufReader::read(BloomFilter& s, size_t maxlen)
+{
+  // The deprecated `bitset` field (2) is skipped, only the `utf8bitset` is used
+  auto op = std::tuple(field_reader(1, s.numHashFunctions), field_reader(3, s.utf8bitset));
+  function_builder(s, maxlen, op);
+}
+
+void ProtobufReader::read(BloomFilterIndex& s, size_t maxlen)
+{
+  auto op = std::tuple(field_reader(1, s.bloomFilter));
+  function_builder(s, maxlen, op);
+}
+
 /**
  * @brief Add a single rowIndexEntry, negative input values treated as not present
  */
@@ -447,8 +463,14 @@ host_span<uint8_t const> OrcDecompressor::decompress_blocks(host_span<uint8_t co
   // Check if we have a single uncompressed block, or no blocks
   if (max_dst_length < m_blockSize) { return src.subspan(header_size, src.size() - header_size); }
 
+  // Each block is written to its own slot of the worst-case size, so the compressed blocks can be
+  // decompressed in parallel; the outputs are compacted afterwards
   m_buf.resize(max_dst_length);
-  size_t dst_length = 0;
+  std::vector<std::pair<size_t, size_t>> block_slots;  // slot offset and uncompressed block size
+  std::vector<host_span<uint8_t const>> comp_blocks;
+  std::vector<host_span<uint8_t>> comp_block_slots;
+  std::vector<size_t> comp_block_indices;
+  size_t slot_offset = 0;
   for (size_t i = 0; i + header_size < src.size();) {
     uint32_t block_len         = src[i] | (src[i + 1] << 8) | (src[i + 2] << 16);
     auto const is_uncompressed = static_cast<bool>(block_len & 1);
@@ -456,16 +478,33 @@ host_span<uint8_t const> OrcDecompressor::decompress_blocks(host_span<uint8_t co
     block_len >>= 1;
     if (is_uncompressed) {
       // Uncompressed block
-      memcpy(m_buf.data() + dst_length, src.data() + i, block_len);
-      dst_length += block_len;
+      memcpy(m_buf.data() + slot_offset, src.data() + i, block_len);
+      block_slots.emplace_back(slot_offset, block_len);
+      slot_offset += block_len;
     } else {
       // Compressed block
-      dst_length += decompress(
-        _compression, src.subspan(i, block_len), {m_buf.data() + dst_length, m_blockSize}, stream);
+      comp_block_indices.push_back(block_slots.size());
+      comp_blocks.push_back(src.subspan(i, block_len));
+      comp_block_slots.emplace_back(m_buf.data() + slot_offset, m_blockSize);
+      block_slots.emplace_back(slot_offset, 0);
+      slot_offset += m_blockSize;
     }
     i += block_len;
   }
 
+  auto const comp_block_sizes = decompress(_compression, comp_blocks, comp_block_slots, stream);
+  for (size_t i = 0; i < comp_block_sizes.size(); ++i) {
+    block_slots[comp_block_indices[i]].second = comp_block_sizes[i];
+  }
+
+  // Compacting moves each block towards the start of the buffer, so it never overwrites a block
+  // that has not been moved yet
+  size_t dst_length = 0;
+  for (auto const& [offset, size] : block_slots) {
+    std::memmove(m_buf.data() + dst_length, m_buf.data() + offset, size);
+    dst_length += size;
+  }
+
   m_buf.resize(dst_length);
   return m_buf;
 }
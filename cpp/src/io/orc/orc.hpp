@@ -168,6 +168,15 @@ struct Metadata {
   std::vector<StripeStatistics> stripeStats;
 };
 
+struct BloomFilter {
+  uint32_t numHashFunctions = 0;  // the number of hash functions of the filter
+  std::string utf8bitset;         // little-endian 64-bit words of the bitset
+};
+
+struct BloomFilterIndex {
+  std::vector<BloomFilter> bloomFilter;  // one filter per row group
+};
+
 int inline constexpr encode_field_number(int field_number, ProtofType field_type) noexcept
 {
   return (field_number * 8) + static_cast<int>(field_type);
@@ -255,6 +264,8 @@ class ProtobufReader {
   void read(column_statistics&, size_t maxlen);
   void read(StripeStatistics&, size_t maxlen);
   void read(Metadata&, size_t maxlen);
+  void read(BloomFilter&, size_t maxlen);
+  void read(BloomFilterIndex&, size_t maxlen);
 
  private:
   template <int index>
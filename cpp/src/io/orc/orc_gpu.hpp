@@ -211,6 +211,8 @@ void initialize_dictionary_hash_maps(device_2dspan<stripe_dictionary> dictionari
 /**
  * @brief Populates the hash maps with unique values from the stripe.
  *
+ * Dictionaries without hash map storage are skipped.
+ *
  * @param dictionaries Dictionary descriptors
  * @param columns  Pre-order flattened device array of ORC column views
  * @param stream CUDA stream used for device memory operations and kernel launches
@@ -0,0 +1,439 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/orc/aggregate_orc_metadata.hpp"
+#include "io/orc/bloom_filter.hpp"
+#include "io/orc/orc.hpp"
+#include "io/utilities/stats_expression_converter.hpp"
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/string_view.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <numeric>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf::io::orc::detail {
+
+namespace {
+
+/**
+ * @brief Creates an all-null statistics column, used for the columns whose statistics cannot be
+ * compared with the filter.
+ */
+std::unique_ptr<column> make_null_stats_column(data_type dtype,
+                                               size_type size,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  if (cudf::is_fixed_width(dtype)) {
+    return make_fixed_width_column(dtype, size, mask_state::ALL_NULL, stream, mr);
+  }
+  // placeholder only for types that cannot be compared
+  return make_numeric_column(data_type{type_id::BOOL8}, size, mask_state::ALL_NULL, stream, mr);
+}
+
+/**
+ * @brief Returns the minimum and maximum of the typed ORC statistics, if both are present.
+ */
+template <typename T, typename Stats>
+std::optional<std::pair<T, T>> stats_minmax(std::optional<Stats> const& stats)
+{
+  if (not stats.has_value() or not stats->minimum.has_value() or not stats->maximum.has_value()) {
+    return std::nullopt;
+  }
+  if constexpr (cudf::is_timestamp<T>()) {
+    using rep = typename T::rep;
+    return std::pair{T{typename T::duration{static_cast<rep>(stats->minimum.value())}},
+                     T{typename T::duration{static_cast<rep>(stats->maximum.value())}}};
+  } else {
+    return std::pair{static_cast<T>(stats->minimum.value()),
+                     static_cast<T>(stats->maximum.value())};
+  }
+}
+
+/**
+ * @brief Converts stripe statistics of a column to 2 device columns - min, max values.
+ *
+ * Integral, floating point, string and date columns are supported; the statistics of other
+ * columns are all null, so they never prune a stripe.
+ */
+struct stats_caster {
+  host_span<orc::column_statistics const> stripe_stats;
+
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    data_type dtype, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+  {
+    auto const num_stripes = static_cast<size_type>(stripe_stats.size());
+    std::vector<bitmask_type> null_mask(num_bitmask_words(num_stripes), ~bitmask_type{0});
+    size_type null_count = 0;
+    auto const set_null  = [&](size_type idx) {
+      clear_bit_unsafe(null_mask.data(), idx);
+      ++null_count;
+    };
+    auto const make_null_mask = [&]() {
+      return rmm::device_buffer{
+        null_mask.data(), cudf::bitmask_allocation_size_bytes(num_stripes), stream, mr};
+    };
+
+    if constexpr (std::is_same_v<T, string_view>) {
+      std::vector<std::string> min(num_stripes);
+      std::vector<std::string> max(num_stripes);
+      for (size_type idx = 0; idx < num_stripes; ++idx) {
+        auto const& stats = stripe_stats[idx].string_stats;
+        if (stats.has_value() and stats->minimum.has_value() and stats->maximum.has_value()) {
+          min[idx] = stats->minimum.value();
+          max[idx] = stats->maximum.value();
+        } else {
+          set_null(idx);
+        }
+      }
+      auto const to_device = [&](std::vector<std::string> const& strings) {
+        std::vector<char> chars;
+        std::vector<size_type> offsets(1, 0);
+        for (auto const& str : strings) {
+          chars.insert(chars.end(), str.cbegin(), str.cend());
+          offsets.push_back(offsets.back() + static_cast<size_type>(str.size()));
+        }
+        auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+        auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+        return make_strings_column(
+          num_stripes,
+          std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+          d_chars.release(),
+          null_count,
+          make_null_mask());
+      };
+      return {to_device(min), to_device(max)};
+    } else if constexpr ((cudf::is_integral<T>() and not cudf::is_boolean<T>()) or
+                         cudf::is_floating_point<T>() or std::is_same_v<T, timestamp_D>) {
+      std::vector<T> min(num_stripes);
+      std::vector<T> max(num_stripes);
+      for (size_type idx = 0; idx < num_stripes; ++idx) {
+        auto const minmax = [&] {
+          if constexpr (cudf::is_integral<T>()) {
+            return stats_minmax<T>(stripe_stats[idx].int_stats);
+          } else if constexpr (cudf::is_floating_point<T>()) {
+            return stats_minmax<T>(stripe_stats[idx].double_stats);
+          } else {
+            return stats_minmax<T>(stripe_stats[idx].date_stats);
+          }
+        }();
+        if (minmax.has_value()) {
+          min[idx] = minmax->first;
+          max[idx] = minmax->second;
+        } else {
+          set_null(idx);
+        }
+      }
+      auto const to_device = [&](std::vector<T> const& values) {
+        return std::make_unique<column>(
+          dtype,
+          num_stripes,
+          cudf::detail::make_device_uvector_async(values, stream, mr).release(),
+          make_null_mask(),
+          null_count);
+      };
+      return {to_device(min), to_device(max)};
+    } else {
+      return {make_null_stats_column(dtype, num_stripes, stream, mr),
+              make_null_stats_column(dtype, num_stripes, stream, mr)};
+    }
+  }
+};
+
+/**
+ * @brief Hashes a literal the way the ORC Bloom filters hash the values of a column
+ *
+ * @param literal Literal to hash
+ * @param column_type Datatype of the column the literal is compared with
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The hash, or `std::nullopt` if the literal cannot be looked up in the filter
+ */
+std::optional<uint64_t> bloom_filter_literal_hash(ast::literal const& literal,
+                                                  data_type column_type,
+                                                  rmm::cuda_stream_view stream)
+{
+  if (literal.get_data_type() != column_type) { return std::nullopt; }
+  auto const& scalar = literal.get_scalar();
+  if (not scalar.is_valid(stream)) { return std::nullopt; }
+
+  auto const numeric_value = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    return static_cast<cudf::numeric_scalar<T> const&>(scalar).value(stream);
+  };
+  auto const long_hash = [](int64_t value) {
+    return bloom_filter_long_hash(static_cast<uint64_t>(value));
+  };
+  auto const double_hash = [](double value) {
+    uint64_t bits;
+    std::memcpy(&bits, &value, sizeof(bits));
+    return bloom_filter_long_hash(bits);
+  };
+
+  switch (column_type.id()) {
+    case type_id::INT8: return long_hash(numeric_value(int8_t{}));
+    case type_id::INT16: return long_hash(numeric_value(int16_t{}));
+    case type_id::INT32: return long_hash(numeric_value(int32_t{}));
+    case type_id::INT64: return long_hash(numeric_value(int64_t{}));
+    case type_id::FLOAT32: return double_hash(numeric_value(float{}));
+    case type_id::FLOAT64: return double_hash(numeric_value(double{}));
+    case type_id::STRING: {
+      auto const value = static_cast<cudf::string_scalar const&>(scalar).to_string(stream);
+      return bloom_filter_bytes_hash(reinterpret_cast<uint8_t const*>(value.data()), value.size());
+    }
+    default: break;
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Reads the UTF-8 Bloom filter indexes of the given columns in a stripe
+ *
+ * @param file_meta Metadata of the file that contains the stripe
+ * @param stripe Location of the stripe in the file
+ * @param column_ids ORC column ids of the columns whose indexes are read
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Map of ORC column id to the Bloom filters of its row groups; columns without a filter
+ * are not included
+ */
+std::unordered_map<size_type, BloomFilterIndex> read_bloom_filter_indexes(
+  metadata const& file_meta,
+  StripeInformation const& stripe,
+  host_span<size_type const> column_ids,
+  rmm::cuda_stream_view stream)
+{
+  std::unordered_map<size_type, BloomFilterIndex> indexes;
+  auto const& source  = *file_meta.source;
+  auto const sf_offset = stripe.offset + stripe.indexLength + stripe.dataLength;
+  auto const index_end = stripe.offset + stripe.indexLength;
+  if (stripe.indexLength == 0 or sf_offset + stripe.footerLength > source.size()) {
+    return indexes;
+  }
+
+  StripeFooter footer;
+  auto const sf_buffer = source.host_read(sf_offset, stripe.footerLength);
+  auto const sf_data =
+    file_meta.decompressor->decompress_blocks({sf_buffer->data(), sf_buffer->size()}, stream);
+  ProtobufReader(sf_data.data(), sf_data.size()).read(footer);
+
+  // Index streams are stored before the data streams, in the order of the footer entries
+  auto stream_offset = stripe.offset;
+  for (auto const& strm : footer.streams) {
+    if (stream_offset + strm.length > index_end) { break; }
+    // Stream of the 'column 0' is never requested
+    auto const column_id = static_cast<size_type>(strm.column_id.value_or(0));
+    if (strm.kind == BLOOM_FILTER_UTF8 and
+        std::find(column_ids.begin(), column_ids.end(), column_id) != column_ids.end()) {
+      auto const buffer = source.host_read(stream_offset, strm.length);
+      auto const data =
+        file_meta.decompressor->decompress_blocks({buffer->data(), buffer->size()}, stream);
+      ProtobufReader(data.data(), data.size()).read(indexes[column_id]);
+    }
+    stream_offset += strm.length;
+  }
+  return indexes;
+}
+
+}  // namespace
+
+std::optional<std::vector<std::vector<size_type>>> aggregate_orc_metadata::filter_stripes(
+  std::vector<std::vector<size_type>> const& stripe_indices,
+  host_span<size_type const> output_column_ids,
+  host_span<data_type const> output_dtypes,
+  std::reference_wrapper<ast::expression const> filter,
+  rmm::cuda_stream_view stream) const
+{
+  auto mr = rmm::mr::get_current_device_resource();
+  // Create stripe indices.
+  std::vector<std::vector<size_type>> all_stripe_indices;
+  if (stripe_indices.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(all_stripe_indices),
+                   [](auto const& file_meta) {
+                     std::vector<size_type> stripe_idx(file_meta.ff.stripes.size());
+                     std::iota(stripe_idx.begin(), stripe_idx.end(), 0);
+                     return stripe_idx;
+                   });
+  }
+  auto const& input_stripe_indices = stripe_indices.empty() ? all_stripe_indices : stripe_indices;
+  auto const total_stripes         = std::accumulate(
+    input_stripe_indices.cbegin(),
+    input_stripe_indices.cend(),
+    size_type{0},
+    [](size_type sum, auto const& per_file_stripes) { return sum + per_file_stripes.size(); });
+  if (total_stripes == 0) { return std::nullopt; }
+
+  // Converts AST to StatsAST with reference to min, max columns in below `stats_table`, and to
+  // the Bloom filter results of the equality comparisons.
+  cudf::io::detail::stats_expression_converter const stats_expr{
+    filter.get(), static_cast<size_type>(output_dtypes.size()), true};
+  auto const referenced_columns = stats_expr.get_referenced_columns();
+
+  // Checks the literal of each equality comparison against the Bloom filters of the row groups
+  // in each stripe. The result is false only if the filters of all row groups rule out the literal.
+  auto const& equality_terms = stats_expr.get_equality_terms();
+  std::vector<std::vector<uint8_t>> bloom_results(equality_terms.size(),
+                                                  std::vector<uint8_t>(total_stripes, uint8_t{1}));
+  std::vector<std::optional<uint64_t>> literal_hashes;
+  std::transform(equality_terms.cbegin(),
+                 equality_terms.cend(),
+                 std::back_inserter(literal_hashes),
+                 [&](auto const& term) {
+                   auto const& [col_idx, literal] = term;
+                   return bloom_filter_literal_hash(*literal, output_dtypes[col_idx], stream);
+                 });
+  std::vector<size_type> bloom_column_ids;
+  for (size_t term_idx = 0; term_idx < equality_terms.size(); ++term_idx) {
+    if (literal_hashes[term_idx].has_value()) {
+      bloom_column_ids.push_back(output_column_ids[equality_terms[term_idx].first]);
+    }
+  }
+  if (not bloom_column_ids.empty()) {
+    size_type stripe_pos = 0;
+    for (size_t src_idx = 0; src_idx < input_stripe_indices.size(); ++src_idx) {
+      auto const& file_meta = per_file_metadata[src_idx];
+      for (auto const stripe_idx : input_stripe_indices[src_idx]) {
+        auto const indexes = read_bloom_filter_indexes(
+          file_meta, file_meta.ff.stripes[stripe_idx], bloom_column_ids, stream);
+        for (size_t term_idx = 0; term_idx < equality_terms.size(); ++term_idx) {
+          auto const& hash = literal_hashes[term_idx];
+          if (not hash.has_value()) { continue; }
+          auto const index = indexes.find(output_column_ids[equality_terms[term_idx].first]);
+          if (index == indexes.end() or index->second.bloomFilter.empty()) { continue; }
+          auto const& row_group_filters      = index->second.bloomFilter;
+          bloom_results[term_idx][stripe_pos] = std::any_of(
+            row_group_filters.cbegin(), row_group_filters.cend(), [&](BloomFilter const& bf) {
+              return bloom_filter_contains(reinterpret_cast<uint8_t const*>(bf.utf8bitset.data()),
+                                           bf.utf8bitset.size(),
+                                           bf.numHashFunctions,
+                                           hash.value());
+            });
+        }
+        ++stripe_pos;
+      }
+    }
+  }
+
+  // Converts the stripe statistics to a table
+  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  // Statistics are only parsed for the columns referenced by the filter.
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype = output_dtypes[col_idx];
+    auto const is_referenced = std::binary_search(
+      referenced_columns.cbegin(), referenced_columns.cend(), static_cast<size_type>(col_idx));
+    if (not is_referenced) {
+      columns.push_back(make_null_stats_column(dtype, total_stripes, stream, mr));
+      columns.push_back(make_null_stats_column(dtype, total_stripes, stream, mr));
+      continue;
+    }
+
+    auto const column_id = output_column_ids[col_idx];
+    // Missing statistics are left empty, which marks them as unavailable
+    std::vector<orc::column_statistics> stripe_stats(total_stripes);
+    size_type stats_idx = 0;
+    for (size_t src_idx = 0; src_idx < input_stripe_indices.size(); ++src_idx) {
+      auto const& file_stats = per_file_metadata[src_idx].md.stripeStats;
+      for (auto const stripe_idx : input_stripe_indices[src_idx]) {
+        if (static_cast<size_t>(stripe_idx) < file_stats.size() and
+            static_cast<size_t>(column_id) < file_stats[stripe_idx].colStats.size()) {
+          auto const& blob = file_stats[stripe_idx].colStats[column_id];
+          ProtobufReader(blob.data(), blob.size()).read(stripe_stats[stats_idx]);
+        }
+        ++stats_idx;
+      }
+    }
+    auto [min_col, max_col] =
+      cudf::type_dispatcher(dtype, stats_caster{stripe_stats}, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  // Bloom filter results follow the min, max columns
+  for (auto const& bloom_result : bloom_results) {
+    columns.push_back(std::make_unique<column>(
+      data_type{cudf::type_id::BOOL8},
+      total_stripes,
+      cudf::detail::make_device_uvector_async(bloom_result, stream, mr).release(),
+      rmm::device_buffer{},
+      0));
+  }
+  auto stats_table = cudf::table(std::move(columns));
+
+  auto stats_ast     = stats_expr.get_stats_expr();
+  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
+  auto predicate     = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto num_bitmasks = num_bitmask_words(predicate.size());
+  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
+  if (predicate.nullable()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
+                                  predicate.null_mask(),
+                                  num_bitmasks * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+  auto validity_it = cudf::detail::make_counting_transform_iterator(
+    0, [bitmask = host_bitmask.data()](auto bit_index) { return bit_is_set(bitmask, bit_index); });
+
+  auto const is_stripe_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  // Return only filtered stripes based on predicate
+  // if all are required or all are nulls, return.
+  if (std::all_of(is_stripe_required.cbegin(),
+                  is_stripe_required.cend(),
+                  [](auto i) { return bool(i); }) or
+      predicate.null_count() == predicate.size()) {
+    return std::nullopt;
+  }
+  std::vector<std::vector<size_type>> filtered_stripe_indices;
+  size_type is_required_idx = 0;
+  for (auto const& file_stripes : input_stripe_indices) {
+    std::vector<size_type> filtered_stripes;
+    for (auto const stripe_idx : file_stripes) {
+      if ((!validity_it[is_required_idx]) || is_stripe_required[is_required_idx]) {
+        filtered_stripes.push_back(stripe_idx);
+      }
+      ++is_required_idx;
+    }
+    filtered_stripe_indices.push_back(std::move(filtered_stripes));
+  }
+  return {std::move(filtered_stripe_indices)};
+}
+
+}  // namespace cudf::io::orc::detail
@@ -19,6 +19,11 @@
 #include "io/orc/reader_impl_helpers.hpp"
 
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
 #include <algorithm>
 
@@ -64,13 +69,20 @@ table_with_metadata reader_impl::make_output_chunk()
                    std::back_inserter(out_columns),
                    [&](auto const& col_meta) {
                      out_metadata.schema_info.emplace_back("");
-                     return create_empty_column(col_meta.id,
-                                                _metadata,
-                                                _options.decimal128_columns,
-                                                _options.use_np_dtypes,
-                                                _options.timestamp_type,
-                                                out_metadata.schema_info.back(),
-                                                _stream);
+                     auto col = create_empty_column(col_meta.id,
+                                                    _metadata,
+                                                    _options.decimal128_columns,
+                                                    _options.use_np_dtypes,
+                                                    _options.timestamp_type,
+                                                    out_metadata.schema_info.back(),
+                                                    _stream);
+                     auto const is_dictionary = is_dictionary_column(
+                       _options.dictionary_columns, _metadata, col_meta.id);
+                     if (col->type().id() == type_id::STRING and is_dictionary) {
+                       return cudf::dictionary::detail::encode(
+                         col->view(), data_type{type_id::UINT32}, _stream, _mr);
+                     }
+                     return col;
                    });
     return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
   }
@@ -102,7 +114,18 @@ table_with_metadata reader_impl::make_output_chunk()
     return output;
   };
 
-  return {make_output_table(), table_metadata{_out_metadata} /*copy cached metadata*/};
+  auto output = make_output_table();
+
+  // The stripes that are read may still contain rows that do not satisfy the filter
+  if (_options.filter.has_value()) {
+    auto const predicate = cudf::detail::compute_column(
+      *output, _options.filter->get(), _stream, rmm::mr::get_current_device_resource());
+    CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+                 "Predicate filter should return a boolean");
+    output = cudf::detail::apply_boolean_mask(*output, *predicate, _stream, _mr);
+  }
+
+  return {std::move(output), table_metadata{_out_metadata} /*copy cached metadata*/};
 }
 
 table_metadata reader_impl::get_meta_with_user_data()
@@ -171,9 +194,13 @@ reader_impl::reader_impl(std::size_t chunk_read_limit,
              options.is_enabled_use_index(),
              options.is_enabled_use_np_dtypes(),
              options.get_decimal128_columns(),
+             options.get_dictionary_columns(),
              options.get_skip_rows(),
              options.get_num_rows(),
-             options.get_stripes()},
+             options.get_stripes(),
+             options.get_filter(),
+             options.is_enabled_prefetch_next_stripes()},
+    _statistics{options.get_statistics()},
     _col_meta{std::make_unique<reader_column_meta>()},
     _sources(std::move(sources)),
     _metadata{_sources, stream},
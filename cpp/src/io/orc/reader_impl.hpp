@@ -18,6 +18,7 @@
 
 #include "io/orc/aggregate_orc_metadata.hpp"
 #include "io/orc/reader_impl_chunking.hpp"
+#include "io/utilities/reader_statistics.hpp"
 
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/orc.hpp>
@@ -139,6 +140,40 @@ class reader_impl {
    */
   void load_next_stripe_data(read_mode mode);
 
+  /**
+   * @brief Allocate the buffers to load the data of a range of stripes into.
+   *
+   * @param load_stripe_range The range of stripes to load
+   * @param stream CUDA stream used to allocate the buffers
+   * @return The buffers of the stripes at each nested level
+   */
+  std::vector<std::vector<rmm::device_buffer>> allocate_stripe_data(range const& load_stripe_range,
+                                                                    rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Read the data of a range of stripes from the input data sources into device memory.
+   *
+   * Each data source is read on a separate thread and copied on a separate stream forked from
+   * `stream`, so the reads from multiple sources overlap. The function returns once all the reads
+   * have completed and `stream` is ordered after their copies.
+   *
+   * @param load_stripe_range The range of stripes to load
+   * @param lvl_stripe_data The buffers of the stripes, from `allocate_stripe_data()`
+   * @param stream CUDA stream the copies to device memory are ordered with
+   */
+  void read_stripe_data(range const& load_stripe_range,
+                        std::vector<std::vector<rmm::device_buffer>>& lvl_stripe_data,
+                        rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Start loading the next range of stripes, if prefetching is enabled.
+   *
+   * The data is read on a separate thread and stream while the stripes loaded by the last call to
+   * `load_next_stripe_data()` are decompressed and decoded, and it is picked up by the next call
+   * to `load_next_stripe_data()`.
+   */
+  void prefetch_next_stripe_data();
+
   /**
    * @brief Decompress and decode stripe data in the internal buffers, and store the result into
    * an intermediate table.
@@ -173,13 +208,23 @@ class reader_impl {
     bool use_index;            // enable or disable attempt to use row index for parsing
     bool use_np_dtypes;        // enable or disable the conversion to numpy-compatible dtypes
     std::vector<std::string> decimal128_columns;  // control decimals conversion
+    std::vector<std::string> dictionary_columns;  // string columns output as dictionaries
 
     // User specified reading rows/stripes selection.
     int64_t const skip_rows;
     std::optional<int64_t> num_read_rows;
     std::vector<std::vector<size_type>> const selected_stripes;
+
+    // Predicate filter, used to prune stripes and to filter the output rows.
+    std::optional<std::reference_wrapper<ast::expression const>> const filter;
+
+    // Whether to load the next stripes while decoding the current ones.
+    bool prefetch_next_stripes;
   } const _options;
 
+  // Statistics of the read, if requested.
+  std::shared_ptr<reader_statistics> const _statistics;
+
   // Intermediate data for reading.
   std::unique_ptr<reader_column_meta> const _col_meta;  // Track of orc mapping and child details
   std::vector<std::unique_ptr<datasource>> const _sources;  // Unused but owns data for `_metadata`
@@ -187,6 +232,9 @@ class reader_impl {
   column_hierarchy const _selected_columns;  // Construct from `_metadata` thus declare after it
   file_intermediate_data _file_itm_data;
   chunk_read_data _chunk_read_data;
+  // Stripe data loaded ahead of time. Its read uses the sources and metadata, so declare it after
+  // them to have it finish first on destruction.
+  std::unique_ptr<prefetch_stripe_data> _prefetched_stripes;
 
   // Intermediate data for output.
   std::unique_ptr<table_metadata> _meta_with_user_data;
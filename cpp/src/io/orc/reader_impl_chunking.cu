@@ -21,7 +21,9 @@
 #include "io/utilities/hostdevice_span.hpp"
 
 #include <cudf/detail/timezone.hpp>
+#include <cudf/detail/utilities/host_worker_pool.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/device_buffer.hpp>
@@ -32,6 +34,10 @@
 #include <thrust/scan.h>
 
 #include <algorithm>
+#include <future>
+#include <map>
+#include <numeric>
+#include <optional>
 #include <tuple>
 
 namespace cudf::io::orc::detail {
@@ -229,13 +235,61 @@ void reader_impl::preprocess_file(read_mode mode)
   if (_file_itm_data.global_preprocessed) { return; }
   _file_itm_data.global_preprocessed = true;
 
+  cudf::io::detail::scoped_phase_timer const timer{_statistics.get(),
+                                                   &reader_statistics::metadata_time};
+
+  //
+  // Prune the stripes in which no row can satisfy the filter, based on the stripe statistics.
+  // Stripes are not pruned when rows are selected by position, as that would shift the rows.
+  //
+  auto const filtered_stripes = [&]() -> std::optional<std::vector<std::vector<size_type>>> {
+    if (not _options.filter.has_value() or _options.skip_rows != 0 or
+        _options.num_read_rows.has_value() or _selected_columns.num_levels() == 0) {
+      return std::nullopt;
+    }
+    std::vector<size_type> column_ids;
+    std::vector<data_type> column_types;
+    for (auto const& col : _selected_columns.levels[0]) {
+      auto const col_type =
+        to_cudf_type(_metadata.get_col_type(col.id).kind,
+                     _options.use_np_dtypes,
+                     _options.timestamp_type.id(),
+                     to_cudf_decimal_type(_options.decimal128_columns, _metadata, col.id));
+      column_ids.push_back(col.id);
+      if (col_type == type_id::DECIMAL32 or col_type == type_id::DECIMAL64 or
+          col_type == type_id::DECIMAL128) {
+        auto const scale =
+          -static_cast<size_type>(_metadata.get_col_type(col.id).scale.value_or(0));
+        column_types.emplace_back(col_type, scale);
+      } else {
+        column_types.emplace_back(col_type);
+      }
+    }
+    return _metadata.filter_stripes(
+      _options.selected_stripes, column_ids, column_types, _options.filter.value(), _stream);
+  }();
+
   //
   // Load stripes' metadata:
   //
   std::tie(
     _file_itm_data.rows_to_skip, _file_itm_data.rows_to_read, _file_itm_data.selected_stripes) =
-    _metadata.select_stripes(
-      _options.selected_stripes, _options.skip_rows, _options.num_read_rows, _stream);
+    _metadata.select_stripes(filtered_stripes.value_or(_options.selected_stripes),
+                             _options.skip_rows,
+                             _options.num_read_rows,
+                             _stream);
+
+  if (_statistics != nullptr) {
+    auto const num_stripes =
+      _options.selected_stripes.empty()
+        ? static_cast<std::size_t>(_metadata.get_num_stripes())
+        : std::accumulate(_options.selected_stripes.begin(),
+                          _options.selected_stripes.end(),
+                          std::size_t{0},
+                          [](auto sum, auto const& stripes) { return sum + stripes.size(); });
+    _statistics->num_row_groups_total += num_stripes;
+    _statistics->num_row_groups_pruned += num_stripes - _file_itm_data.selected_stripes.size();
+  }
   if (!_file_itm_data.has_data()) { return; }
 
   CUDF_EXPECTS(
@@ -443,8 +497,12 @@ void reader_impl::preprocess_file(read_mode mode)
   total_stripe_sizes.device_to_host_sync(_stream);
 
   auto const load_limit = [&] {
-    auto const tmp = static_cast<std::size_t>(_chunk_read_data.pass_read_limit *
-                                              chunk_read_data::load_limit_ratio);
+    // When prefetching, the data of two stripe ranges is loaded at the same time.
+    auto const load_limit_ratio = _options.prefetch_next_stripes
+                                    ? chunk_read_data::load_limit_ratio / 2
+                                    : chunk_read_data::load_limit_ratio;
+    auto const tmp =
+      static_cast<std::size_t>(_chunk_read_data.pass_read_limit * load_limit_ratio);
     // Make sure not to pass 0 byte limit (due to round-off) to `find_splits`.
     return std::max(tmp, 1UL);
   }();
@@ -453,6 +511,131 @@ void reader_impl::preprocess_file(read_mode mode)
     find_splits<cumulative_size>(total_stripe_sizes, num_total_stripes, load_limit);
 }
 
+std::vector<std::vector<rmm::device_buffer>> reader_impl::allocate_stripe_data(
+  range const& load_stripe_range, rmm::cuda_stream_view stream)
+{
+  auto const stripe_start = load_stripe_range.begin;
+  auto const stripe_count = load_stripe_range.size();
+  auto const num_levels   = _selected_columns.num_levels();
+
+  std::vector<std::vector<rmm::device_buffer>> lvl_stripe_data(num_levels);
+  for (std::size_t level = 0; level < num_levels; ++level) {
+    auto& stripe_data = lvl_stripe_data[level];
+    stripe_data.reserve(stripe_count);
+
+    for (std::size_t idx = 0; idx < stripe_count; ++idx) {
+      auto const stripe_size = _file_itm_data.lvl_stripe_sizes[level][idx + stripe_start];
+      stripe_data.emplace_back(cudf::util::round_up_safe(stripe_size, BUFFER_PADDING_MULTIPLE),
+                               stream);
+    }
+  }
+  return lvl_stripe_data;
+}
+
+void reader_impl::read_stripe_data(range const& load_stripe_range,
+                                   std::vector<std::vector<rmm::device_buffer>>& lvl_stripe_data,
+                                   rmm::cuda_stream_view stream)
+{
+  auto const stripe_start = load_stripe_range.begin;
+
+  // Range of the read info (offset, length) to read for the current being loaded stripes.
+  auto const [read_begin, read_end] =
+    merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
+
+  // Group the reads by data source, so that the sources are read concurrently.
+  std::map<std::size_t, std::vector<std::size_t>> source_reads;
+  for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
+    source_reads[_file_itm_data.data_read_info[read_idx].source_idx].push_back(read_idx);
+  }
+  if (source_reads.empty()) { return; }
+
+  // Each source copies its data to device memory on its own stream.
+  auto const streams = cudf::detail::fork_streams(stream, source_reads.size());
+
+  // Reads from sources into device memory are async, reads into host memory are done on the
+  // worker threads. Each task returns the number of bytes it read, to check against the expected.
+  std::vector<std::pair<std::future<std::size_t>, std::size_t>> read_tasks;
+
+  auto stream_it = streams.begin();
+  for (auto const& [source_idx, read_indices] : source_reads) {
+    auto const read_stream = *stream_it++;
+    auto const source_ptr  = _metadata.per_file_metadata[source_idx].source;
+
+    std::vector<std::tuple<uint64_t, std::size_t, uint8_t*>> host_reads;
+    std::size_t host_read_length = 0;
+    for (auto const read_idx : read_indices) {
+      auto const& read_info = _file_itm_data.data_read_info[read_idx];
+      auto const dst =
+        static_cast<uint8_t*>(
+          lvl_stripe_data[read_info.level][read_info.stripe_idx - stripe_start].data()) +
+        read_info.dst_pos;
+
+      if (source_ptr->is_device_read_preferred(read_info.length)) {
+        read_tasks.emplace_back(
+          source_ptr->device_read_async(read_info.offset, read_info.length, dst, read_stream),
+          read_info.length);
+      } else {
+        host_reads.emplace_back(read_info.offset, read_info.length, dst);
+        host_read_length += read_info.length;
+      }
+    }
+
+    if (not host_reads.empty()) {
+      read_tasks.emplace_back(
+        cudf::detail::host_worker_pool().submit(
+          [source_ptr, host_reads = std::move(host_reads), read_stream]() {
+            // The host buffers must be kept alive until their data is copied to device memory.
+            std::vector<std::unique_ptr<cudf::io::datasource::buffer>> host_read_buffers;
+            std::size_t total_read = 0;
+            for (auto const& [offset, length, dst] : host_reads) {
+              auto buffer = source_ptr->host_read(offset, length);
+              CUDF_CUDA_TRY(cudaMemcpyAsync(
+                dst, buffer->data(), buffer->size(), cudaMemcpyDefault, read_stream.value()));
+              total_read += buffer->size();
+              host_read_buffers.emplace_back(std::move(buffer));
+            }
+            read_stream.synchronize();
+            return total_read;
+          }),
+        host_read_length);
+    }
+  }
+
+  for (auto& task : read_tasks) {
+    task.first.wait();
+  }
+  // Rethrow any read error once none of the reads is still writing to the buffers.
+  for (auto& task : read_tasks) {
+    CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
+  }
+  cudf::detail::join_streams(streams, stream);
+}
+
+void reader_impl::prefetch_next_stripe_data()
+{
+  auto const next_range = _chunk_read_data.curr_load_stripe_range;
+  if (not _options.prefetch_next_stripes or
+      next_range >= _chunk_read_data.load_stripe_ranges.size()) {
+    return;
+  }
+
+  auto const load_stripe_range = _chunk_read_data.load_stripe_ranges[next_range];
+
+  auto prefetched              = std::make_unique<prefetch_stripe_data>();
+  prefetched->load_range_index = next_range;
+  // The stream waits on all the work submitted so far, so the buffers freed by the previously
+  // loaded stripes can be safely reused for the prefetched data.
+  prefetched->stream          = cudf::detail::fork_streams(_stream, 1).front();
+  prefetched->lvl_stripe_data = allocate_stripe_data(load_stripe_range, prefetched->stream);
+
+  // Host reads are synchronous, so read on a separate thread to overlap with the decode.
+  prefetched->read_task =
+    std::async(std::launch::async, [this, &p = *prefetched, load_stripe_range]() {
+      read_stripe_data(load_stripe_range, p.lvl_stripe_data, p.stream);
+    });
+  _prefetched_stripes = std::move(prefetched);
+}
+
 // If there is a data read limit, only a subset of stripes are read at a time such that
 // their total data size does not exceed a fixed size limit. Then, the data is probed to
 // estimate its uncompressed sizes, which are in turn used to split that stripe subset into
@@ -471,65 +654,37 @@ void reader_impl::load_next_stripe_data(read_mode mode)
   auto& lvl_stripe_data = _file_itm_data.lvl_stripe_data;
   auto const num_levels = _selected_columns.num_levels();
 
-  // Prepare the buffer to read raw data onto.
-  for (std::size_t level = 0; level < num_levels; ++level) {
-    auto& stripe_data = lvl_stripe_data[level];
-    stripe_data.resize(stripe_count);
-
-    for (std::size_t idx = 0; idx < stripe_count; ++idx) {
-      auto const stripe_size = _file_itm_data.lvl_stripe_sizes[level][idx + stripe_start];
-      stripe_data[idx]       = rmm::device_buffer(
-        cudf::util::round_up_safe(stripe_size, BUFFER_PADDING_MULTIPLE), _stream);
-    }
-  }
-
   //
   // Load stripe data into memory:
   //
 
-  // If we load data from sources into host buffers, we need to transfer (async) data to device
-  // memory. Such host buffers need to be kept alive until we sync the transfers.
-  std::vector<std::unique_ptr<cudf::io::datasource::buffer>> host_read_buffers;
-
-  // If we load data directly from sources into device memory, the loads are also async.
-  // Thus, we need to make sure to sync all them at the end.
-  std::vector<std::pair<std::future<std::size_t>, std::size_t>> device_read_tasks;
-
-  // Range of the read info (offset, length) to read for the current being loaded stripes.
-  auto const [read_begin, read_end] =
-    merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
+  std::optional<cudf::io::detail::scoped_phase_timer> io_timer{
+    std::in_place, _statistics.get(), &reader_statistics::io_time};
+
+  auto const load_range_index = _chunk_read_data.curr_load_stripe_range - 1;
+  if (_prefetched_stripes and _prefetched_stripes->load_range_index == load_range_index) {
+    auto& prefetched = *_prefetched_stripes;
+    prefetched.read_task.get();
+    cudf::detail::join_streams(host_span<rmm::cuda_stream_view const>{&prefetched.stream, 1},
+                               _stream);
+    lvl_stripe_data = std::move(prefetched.lvl_stripe_data);
+    _prefetched_stripes.reset();
+  } else {
+    lvl_stripe_data = allocate_stripe_data(load_stripe_range, _stream);
+    read_stripe_data(load_stripe_range, lvl_stripe_data, _stream);
+  }
 
-  for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
-    auto const& read_info = _file_itm_data.data_read_info[read_idx];
-    auto const source_ptr = _metadata.per_file_metadata[read_info.source_idx].source;
-    auto const dst_base   = static_cast<uint8_t*>(
-      lvl_stripe_data[read_info.level][read_info.stripe_idx - stripe_start].data());
-
-    if (source_ptr->is_device_read_preferred(read_info.length)) {
-      device_read_tasks.push_back(
-        std::pair(source_ptr->device_read_async(
-                    read_info.offset, read_info.length, dst_base + read_info.dst_pos, _stream),
-                  read_info.length));
-
-    } else {
-      auto buffer = source_ptr->host_read(read_info.offset, read_info.length);
-      CUDF_EXPECTS(buffer->size() == read_info.length, "Unexpected discrepancy in bytes read.");
-      CUDF_CUDA_TRY(cudaMemcpyAsync(dst_base + read_info.dst_pos,
-                                    buffer->data(),
-                                    read_info.length,
-                                    cudaMemcpyDefault,
-                                    _stream.value()));
-      host_read_buffers.emplace_back(std::move(buffer));
+  io_timer.reset();
+  if (_statistics != nullptr) {
+    auto const [read_begin, read_end] =
+      merge_selected_ranges(_file_itm_data.stripe_data_read_ranges, load_stripe_range);
+    for (auto read_idx = read_begin; read_idx < read_end; ++read_idx) {
+      _statistics->num_bytes_read += _file_itm_data.data_read_info[read_idx].length;
     }
   }
 
-  if (host_read_buffers.size() > 0) {  // if there was host read
-    _stream.synchronize();
-    host_read_buffers.clear();  // its data was copied to device memory after stream sync
-  }
-  for (auto& task : device_read_tasks) {  // if there was device read
-    CUDF_EXPECTS(task.first.get() == task.second, "Unexpected discrepancy in bytes read.");
-  }
+  // Start reading the next stripes while these ones are decompressed and decoded.
+  prefetch_next_stripe_data();
 
   // Compute number of rows in the loading stripes.
   auto const num_loading_rows = std::accumulate(
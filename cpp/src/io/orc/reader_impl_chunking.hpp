@@ -22,8 +22,10 @@
 #include <cudf/types.hpp>
 
 #include <rmm/device_buffer.hpp>
+#include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
 
+#include <future>
 #include <unordered_map>
 
 namespace cudf::io::orc::detail {
@@ -230,6 +232,26 @@ struct chunk_read_data {
   }
 };
 
+/**
+ * @brief Struct storing the raw data of the stripes loaded ahead of time by the chunked reader.
+ *
+ * The stripe data is read on a separate thread and copied to device memory on a separate stream
+ * while the previously loaded stripes are decompressed and decoded.
+ */
+struct prefetch_stripe_data {
+  // index of the prefetched range in `chunk_read_data::load_stripe_ranges`
+  std::size_t load_range_index{0};
+  // stream on which the stripe data is copied to device memory
+  rmm::cuda_stream_view stream;
+
+  // buffers of the prefetched stripes at each nested level
+  std::vector<std::vector<rmm::device_buffer>> lvl_stripe_data;
+
+  // result of the read. declared last so that it is destroyed (waiting for the read to finish)
+  // before the buffers it writes to.
+  std::future<void> read_task;
+};
+
 /**
  * @brief Struct to accumulate counts and sizes of some types such as stripes or rows.
  */
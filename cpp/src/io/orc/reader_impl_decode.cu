@@ -22,10 +22,13 @@
 #include "io/utilities/config_utils.hpp"
 #include "io/utilities/hostdevice_span.hpp"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/strings/string_view.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -42,6 +45,9 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sequence.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
 #include <algorithm>
@@ -69,6 +75,7 @@ namespace {
  * @param row_groups Vector of list of row index descriptors
  * @param row_index_stride Distance between each row index
  * @param use_base_stride Whether to use base stride obtained from meta or use the computed value
+ * @param statistics Reader statistics to update, or `nullptr` if they are not collected
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @return Device buffer to decompressed data
  */
@@ -85,8 +92,12 @@ rmm::device_buffer decompress_stripe_data(
   cudf::detail::hostdevice_2dvector<gpu::RowGroup>& row_groups,
   size_type row_index_stride,
   bool use_base_stride,
+  reader_statistics* statistics,
   rmm::cuda_stream_view stream)
 {
+  cudf::io::detail::scoped_phase_timer const timer{statistics,
+                                                   &reader_statistics::decompression_time};
+
   // Whether we have the comppression info precomputed.
   auto const compinfo_ready = not compinfo_map.empty();
 
@@ -137,6 +148,13 @@ rmm::device_buffer decompress_stripe_data(
     not((num_uncompressed_blocks + num_compressed_blocks > 0) and (total_decomp_size == 0)),
     "Inconsistent info on compression blocks");
 
+  if (statistics != nullptr) {
+    for (auto stream_idx = stream_range.begin; stream_idx < stream_range.end; ++stream_idx) {
+      statistics->num_compressed_bytes += stream_info[stream_idx].length;
+    }
+    statistics->num_decompressed_bytes += total_decomp_size;
+  }
+
   // Buffer needs to be padded.This is required by `gpuDecodeOrcColumnData`.
   rmm::device_buffer decomp_data(
     cudf::util::round_up_safe(total_decomp_size, BUFFER_PADDING_MULTIPLE), stream);
@@ -645,6 +663,147 @@ void generate_offsets_for_list(host_span<list_buffer_data> buff_data, rmm::cuda_
   }
 }
 
+/**
+ * @brief Create a dictionary column from the decoded strings of a column buffer.
+ *
+ * The decoded rows of a dictionary-encoded ORC stripe point into the dictionary data of that
+ * stripe, so rows sharing a dictionary entry are first grouped by their string pointer. Only the
+ * entries are then compared by value, which merges the dictionaries of all the decoded stripes.
+ * The strings of the rows are never materialized, only the distinct strings are copied into the
+ * keys of the output column.
+ *
+ * @param buffer Column buffer of a decoded string column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource to use for device memory allocation
+ * @return A DICTIONARY32 column with sorted string keys
+ */
+std::unique_ptr<column> make_dictionary_column(column_buffer& buffer,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  auto const num_rows  = static_cast<size_type>(buffer.size);
+  auto const d_strings = static_cast<string_index_pair const*>(buffer.data());
+  auto const d_mask    = buffer.null_mask<bitmask_type const>();
+
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const policy  = rmm::exec_policy_nosync(stream, temp_mr);
+
+  auto const to_string = [d_strings] __device__(size_type row) {
+    return cudf::string_view{d_strings[row].first, d_strings[row].second};
+  };
+
+  // Rows with a value, sorted by their string pointer and length. Equal pairs are the same
+  // dictionary entry.
+  rmm::device_uvector<size_type> sorted_rows(num_rows - buffer.null_count(), stream, temp_mr);
+  thrust::copy_if(policy,
+                  thrust::make_counting_iterator(0),
+                  thrust::make_counting_iterator(num_rows),
+                  sorted_rows.begin(),
+                  [d_mask] __device__(size_type row) {
+                    return d_mask == nullptr or cudf::bit_is_set(d_mask, row);
+                  });
+  thrust::sort(policy,
+               sorted_rows.begin(),
+               sorted_rows.end(),
+               [d_strings] __device__(size_type lhs, size_type rhs) {
+                 return d_strings[lhs] < d_strings[rhs];
+               });
+
+  // Entry id of each sorted row.
+  rmm::device_uvector<size_type> row_entries(sorted_rows.size(), stream, temp_mr);
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(sorted_rows.size()),
+                    row_entries.begin(),
+                    [d_strings, rows = sorted_rows.data()] __device__(size_type idx) {
+                      return idx > 0 and d_strings[rows[idx]] != d_strings[rows[idx - 1]];
+                    });
+  thrust::inclusive_scan(policy, row_entries.begin(), row_entries.end(), row_entries.begin());
+  auto const num_entries = sorted_rows.is_empty() ? 0 : row_entries.back_element(stream) + 1;
+
+  // One row of each entry, with the entries sorted by their string.
+  rmm::device_uvector<size_type> entry_rows(num_entries, stream, temp_mr);
+  thrust::copy_if(policy,
+                  sorted_rows.begin(),
+                  sorted_rows.end(),
+                  thrust::make_counting_iterator<size_type>(0),
+                  entry_rows.begin(),
+                  [rows = sorted_rows.data(), d_strings] __device__(size_type idx) {
+                    return idx == 0 or d_strings[rows[idx]] != d_strings[rows[idx - 1]];
+                  });
+  rmm::device_uvector<size_type> sorted_entries(num_entries, stream, temp_mr);
+  thrust::sequence(policy, sorted_entries.begin(), sorted_entries.end());
+  thrust::sort(
+    policy,
+    sorted_entries.begin(),
+    sorted_entries.end(),
+    [to_string, entry_rows = entry_rows.data()] __device__(size_type lhs, size_type rhs) {
+      return to_string(entry_rows[lhs]) < to_string(entry_rows[rhs]);
+    });
+
+  // Key of each entry: the entries with equal strings share the same key.
+  auto const is_new_key = [to_string,
+                           entry_rows     = entry_rows.data(),
+                           sorted_entries = sorted_entries.data()] __device__(size_type idx) {
+    return idx == 0 or to_string(entry_rows[sorted_entries[idx]]) !=
+                         to_string(entry_rows[sorted_entries[idx - 1]]);
+  };
+  rmm::device_uvector<uint32_t> sorted_entry_keys(num_entries, stream, temp_mr);
+  thrust::transform(policy,
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_entries),
+                    sorted_entry_keys.begin(),
+                    [is_new_key] __device__(size_type idx) { return idx > 0 and is_new_key(idx); });
+  thrust::inclusive_scan(
+    policy, sorted_entry_keys.begin(), sorted_entry_keys.end(), sorted_entry_keys.begin());
+  rmm::device_uvector<uint32_t> entry_keys(num_entries, stream, temp_mr);
+  thrust::scatter(policy,
+                  sorted_entry_keys.begin(),
+                  sorted_entry_keys.end(),
+                  sorted_entries.begin(),
+                  entry_keys.begin());
+
+  // The keys are the strings of the first entry of each key, in order.
+  auto const num_keys =
+    num_entries == 0 ? 0 : static_cast<size_type>(sorted_entry_keys.back_element(stream) + 1);
+  rmm::device_uvector<string_index_pair> key_strings(num_keys, stream, temp_mr);
+  thrust::for_each_n(policy,
+                     thrust::make_counting_iterator<size_type>(0),
+                     num_entries,
+                     [is_new_key,
+                      d_strings,
+                      entry_rows        = entry_rows.data(),
+                      sorted_entries    = sorted_entries.data(),
+                      sorted_entry_keys = sorted_entry_keys.data(),
+                      key_strings       = key_strings.data()] __device__(size_type idx) {
+                       if (is_new_key(idx)) {
+                         key_strings[sorted_entry_keys[idx]] =
+                           d_strings[entry_rows[sorted_entries[idx]]];
+                       }
+                     });
+  auto keys = cudf::make_strings_column(key_strings, stream, mr);
+
+  // The index of each row is the key of its entry. Null rows keep index 0.
+  auto indices = cudf::detail::make_zeroed_device_uvector_async<uint32_t>(num_rows, stream, mr);
+  thrust::for_each_n(policy,
+                     thrust::make_counting_iterator<size_type>(0),
+                     sorted_rows.size(),
+                     [rows        = sorted_rows.data(),
+                      row_entries = row_entries.data(),
+                      entry_keys  = entry_keys.data(),
+                      indices     = indices.data()] __device__(size_type idx) {
+                       indices[rows[idx]] = entry_keys[row_entries[idx]];
+                     });
+
+  auto indices_column = std::make_unique<column>(
+    data_type{type_id::UINT32}, num_rows, indices.release(), rmm::device_buffer{}, 0);
+  return cudf::make_dictionary_column(
+    std::move(keys),
+    std::move(indices_column),
+    rmm::device_buffer{buffer.null_mask(), buffer.null_mask_size(), stream, mr},
+    buffer.null_count());
+}
+
 /**
  * @brief Find the splits of the input table such that each split range of rows has data size less
  * than a given `size_limit`.
@@ -716,6 +875,11 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
 
   CUDF_EXPECTS(_chunk_read_data.curr_load_stripe_range > 0, "There is not any stripe loaded.");
 
+  // The decompression time is collected separately and subtracted from the decode time.
+  auto const decode_start = std::chrono::steady_clock::now();
+  auto const decompression_time_start =
+    _statistics != nullptr ? _statistics->decompression_time : std::chrono::nanoseconds{};
+
   auto const stripe_range =
     _chunk_read_data.decode_stripe_ranges[_chunk_read_data.curr_decode_stripe_range++];
   auto const stripe_start = stripe_range.begin;
@@ -959,6 +1123,7 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
                                                 row_groups,
                                                 _metadata.get_row_index_stride(),
                                                 level == 0,
+                                                _statistics.get(),
                                                 _stream);
 
       // Just save the decompressed data and clear out the raw data to free up memory.
@@ -1049,6 +1214,12 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
       _out_metadata.schema_info.emplace_back("");
       auto col_buffer = assemble_buffer(
         orc_col_meta.id, 0, *_col_meta, _metadata, _selected_columns, _out_buffers, _stream, _mr);
+      if (col_buffer.type.id() == type_id::STRING and
+          is_dictionary_column(_options.dictionary_columns, _metadata, orc_col_meta.id)) {
+        _out_metadata.schema_info.back().name        = col_buffer.name;
+        _out_metadata.schema_info.back().is_nullable = col_buffer.is_nullable;
+        return make_dictionary_column(col_buffer, _stream, _mr);
+      }
       return make_column(col_buffer, &_out_metadata.schema_info.back(), std::nullopt, _stream);
     });
   _chunk_read_data.decoded_table = std::make_unique<table>(std::move(out_columns));
@@ -1076,6 +1247,13 @@ void reader_impl::decompress_and_decode_stripes(read_mode mode)
                                                            _chunk_read_data.output_row_granularity,
                                                            _chunk_read_data.chunk_read_limit,
                                                            _stream);
+
+  if (_statistics != nullptr) {
+    _statistics->decode_time +=
+      std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() -
+                                                           decode_start) -
+      (_statistics->decompression_time - decompression_time_start);
+  }
 }
 
 }  // namespace cudf::io::orc::detail
@@ -122,6 +122,18 @@ inline type_id to_cudf_decimal_type(host_span<std::string const> decimal128_colu
   return type_id::DECIMAL128;
 }
 
+/**
+ * @brief Determines whether a top-level column is listed to be read as a dictionary column.
+ */
+inline bool is_dictionary_column(host_span<std::string const> dictionary_columns,
+                                 aggregate_orc_metadata const& metadata,
+                                 int column_index)
+{
+  return std::find(dictionary_columns.begin(),
+                   dictionary_columns.end(),
+                   metadata.column_path(0, column_index)) != dictionary_columns.end();
+}
+
 inline std::string get_map_child_col_name(std::size_t const idx)
 {
   return (idx == 0) ? "key" : "value";
@@ -61,6 +61,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <limits>
 #include <numeric>
 #include <tuple>
 #include <utility>
@@ -2097,21 +2098,87 @@ struct string_rows_less {
   }
 };
 
+/**
+ * @brief Finds the stripes of string columns that are too diverse for dictionary encoding.
+ *
+ * The dictionary of the first rowgroup in each multi-rowgroup stripe is built with a hash map
+ * sized for that rowgroup only. When all strings in the rowgroup are distinct and the dictionary
+ * would not reduce its size, the whole stripe is assumed to have a high cardinality. Such stripes
+ * are encoded directly without building the full stripe dictionary.
+ *
+ * @param orc_table Non-owning view of a cuDF table that includes ORC-related information
+ * @param segmentation Boundaries of rowgroups and stripes
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Flags for each string column and stripe, true if the stripe is encoded directly
+ */
+std::vector<std::vector<bool>> find_high_cardinality_stripes(orc_table_view const& orc_table,
+                                                             file_segmentation const& segmentation,
+                                                             rmm::cuda_stream_view stream)
+{
+  std::vector<std::vector<bool>> is_high_cardinality(
+    orc_table.num_string_columns(), std::vector<bool>(segmentation.num_stripes(), false));
+  hostdevice_2dvector<gpu::stripe_dictionary> sample_dicts(
+    orc_table.num_string_columns(), segmentation.num_stripes(), stream);
+  if (sample_dicts.count() == 0) { return is_high_cardinality; }
+
+  std::vector<rmm::device_uvector<gpu::slot_type>> hash_maps_storage;
+  for (auto col_idx : orc_table.string_column_indices) {
+    auto const& str_column = orc_table.column(col_idx);
+    for (auto const& stripe : segmentation.stripes) {
+      auto& sd = sample_dicts[str_column.str_index()][stripe.id];
+      // Single rowgroup stripes are not sampled, the full dictionary is as cheap to build
+      auto const num_sample_rows =
+        stripe.size > 1 ? segmentation.rowgroups[stripe.first][col_idx].size() : 0;
+      hash_maps_storage.emplace_back(num_sample_rows * 1.43, stream);
+      sd.map_slots   = hash_maps_storage.back();
+      sd.column_idx  = col_idx;
+      sd.start_row   = segmentation.rowgroups[stripe.first][col_idx].begin;
+      sd.num_rows    = num_sample_rows;
+      sd.entry_count = 0;
+      sd.char_count  = 0;
+    }
+  }
+  sample_dicts.host_to_device_async(stream);
+
+  gpu::initialize_dictionary_hash_maps(sample_dicts, stream);
+  gpu::populate_dictionary_hash_maps(sample_dicts, orc_table.d_columns, stream);
+  sample_dicts.device_to_host_sync(stream);
+
+  for (auto col_idx : orc_table.string_column_indices) {
+    auto const& str_column = orc_table.column(col_idx);
+    for (auto const& stripe : segmentation.stripes) {
+      auto const& sd = sample_dicts[str_column.str_index()][stripe.id];
+      if (sd.num_rows == 0) { continue; }
+      auto const direct_char_count = str_column.rowgroup_char_count(stripe.first);
+      auto const dict_index_size   = varint_size(sd.entry_count);
+      // Equal char counts mean that no non-empty string is repeated in the rowgroup
+      is_high_cardinality[str_column.str_index()][stripe.id] =
+        sd.char_count == direct_char_count and
+        sd.char_count + dict_index_size * sd.entry_count >= direct_char_count;
+    }
+  }
+  return is_high_cardinality;
+}
+
 // Build stripe dictionaries for string columns
 stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
                                        file_segmentation const& segmentation,
                                        bool sort_dictionaries,
                                        rmm::cuda_stream_view stream)
 {
+  // Skip the full hash maps of the stripes that are not going to use dictionary encoding
+  auto const is_high_cardinality = find_high_cardinality_stripes(orc_table, segmentation, stream);
+
   std::vector<std::vector<rmm::device_uvector<gpu::slot_type>>> hash_maps_storage(
     orc_table.string_column_indices.size());
   for (auto col_idx : orc_table.string_column_indices) {
     auto& str_column = orc_table.column(col_idx);
     for (auto const& stripe : segmentation.stripes) {
       auto const stripe_num_rows =
-        stripe.size == 0 ? 0
-                         : segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end -
-                             segmentation.rowgroups[stripe.first][col_idx].begin;
+        stripe.size == 0 or is_high_cardinality[str_column.str_index()][stripe.id]
+          ? 0
+          : segmentation.rowgroups[stripe.first + stripe.size - 1][col_idx].end -
+              segmentation.rowgroups[stripe.first][col_idx].begin;
       hash_maps_storage[str_column.str_index()].emplace_back(stripe_num_rows * 1.43, stream);
     }
   }
@@ -2168,6 +2235,7 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
       // Enable dictionary encoding if the dictionary size is smaller than the direct encode size
       // The estimate excludes the LENGTH stream size, which is present in both cases
       sd.is_enabled = [&]() {
+        if (is_high_cardinality[str_col_idx][stripe_idx]) { return false; }
         auto const dict_index_size = varint_size(sd.entry_count);
         return sd.char_count + dict_index_size * sd.entry_count < direct_char_count;
       }();
@@ -2252,9 +2320,18 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
           std::move(dict_order_owner)};
 }
 
+/**
+ * @brief Range of stripes that are compressed and written to the sink together.
+ */
+struct stripe_batch {
+  size_type first_stripe;
+  size_type num_stripes;
+  size_t num_compressed_blocks;
+};
+
 /**
  * @brief Perform the processing steps needed to convert the input table into the output ORC data
- * for writing, such as compression and ORC encoding.
+ * for writing, such as ORC encoding and grouping the stripes into compression batches.
  *
  * @param input The input table
  * @param table_meta The table metadata
@@ -2265,9 +2342,8 @@ stripe_dictionaries build_dictionaries(orc_table_view& orc_table,
  * @param compression_kind The compression kind
  * @param compression_blocksize The block size used for compression
  * @param stats_freq Column statistics granularity type for parquet/orc writers
- * @param collect_compression_stats Flag to indicate if compression statistics should be collected
  * @param write_mode Flag to indicate if there is only a single table write
- * @param out_sink Sink for writing data
+ * @param max_encode_buffer_bytes Optional limit on the compressed output of a batch of stripes
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @return A tuple of the intermediate results containing the processed data
  */
@@ -2280,9 +2356,8 @@ auto convert_table_to_orc_data(table_view const& input,
                                CompressionKind compression_kind,
                                size_t compression_blocksize,
                                statistics_freq stats_freq,
-                               bool collect_compression_stats,
                                single_write_mode write_mode,
-                               data_sink const& out_sink,
+                               std::optional<size_t> max_encode_buffer_bytes,
                                rmm::cuda_stream_view stream)
 {
   auto const input_tview = table_device_view::create(input, stream);
@@ -2335,17 +2410,12 @@ auto convert_table_to_orc_data(table_view const& input,
                       cudf::detail::hostdevice_vector<compression_result>{},  // comp_results
                       std::move(strm_descs),
                       intermediate_statistics{orc_table, stream},
-                      std::optional<writer_compression_statistics>{},
                       std::move(streams),
                       std::move(stripes),
                       std::move(stripe_dicts.views),
-                      cudf::detail::pinned_host_vector<uint8_t>()};
+                      std::vector<stripe_batch>{}};
   }
 
-  // Allocate intermediate output stream buffer
-  size_t compressed_bfr_size   = 0;
-  size_t num_compressed_blocks = 0;
-
   auto const max_compressed_block_size =
     max_compression_output_size(compression_kind, compression_blocksize);
   auto const padded_max_compressed_block_size =
@@ -2353,61 +2423,56 @@ auto convert_table_to_orc_data(table_view const& input,
   auto const padded_block_header_size =
     util::round_up_unsafe<size_t>(block_header_size, compressed_block_align);
 
-  for (auto& ss : strm_descs.host_view().flat_view()) {
-    size_t stream_size = ss.stream_size;
+  auto const num_blocks = [&](gpu::StripeStream const& ss) {
+    return std::max<size_t>((ss.stream_size + compression_blocksize - 1) / compression_blocksize,
+                            1);
+  };
+  auto const buffer_size = [&](gpu::StripeStream const& ss) -> size_t {
+    if (compression_kind == NONE) { return ss.stream_size; }
+    return (padded_block_header_size + padded_max_compressed_block_size) * num_blocks(ss);
+  };
+
+  // Group the stripes into batches that are compressed and written together; the output of a
+  // batch must fit in the encode buffer limit, if there is one. Block and buffer offsets of the
+  // streams are relative to the start of their batch, so the intermediate output buffers only
+  // need to hold the largest batch.
+  auto const buffer_limit = max_encode_buffer_bytes.value_or(std::numeric_limits<size_t>::max());
+  std::vector<stripe_batch> stripe_batches;
+  size_t compressed_bfr_size   = 0;
+  size_t num_compressed_blocks = 0;
+  size_t batch_size            = 0;
+  for (size_type stripe_id = 0; stripe_id < static_cast<size_type>(segmentation.num_stripes());
+       ++stripe_id) {
+    auto stripe_streams    = strm_descs.host_view()[stripe_id];
+    auto const stripe_size = std::accumulate(
+      stripe_streams.begin(), stripe_streams.end(), size_t{0}, [&](auto sum, auto const& ss) {
+        return sum + buffer_size(ss);
+      });
+    if (stripe_batches.empty() or batch_size + stripe_size > buffer_limit) {
+      stripe_batches.push_back({stripe_id, 0, 0});
+      batch_size = 0;
+    }
+
+    auto& batch = stripe_batches.back();
+    for (auto& ss : stripe_streams) {
+      if (compression_kind != NONE) {
+        ss.first_block = batch.num_compressed_blocks;
+        ss.bfr_offset  = batch_size;
+        batch.num_compressed_blocks += num_blocks(ss);
+      }
+      batch_size += buffer_size(ss);
+    }
+    batch.num_stripes++;
+
     if (compression_kind != NONE) {
-      ss.first_block = num_compressed_blocks;
-      ss.bfr_offset  = compressed_bfr_size;
-
-      auto num_blocks =
-        std::max<uint32_t>((stream_size + compression_blocksize - 1) / compression_blocksize, 1);
-      stream_size += num_blocks * block_header_size;
-      num_compressed_blocks += num_blocks;
-      compressed_bfr_size +=
-        (padded_block_header_size + padded_max_compressed_block_size) * num_blocks;
+      compressed_bfr_size   = std::max(compressed_bfr_size, batch_size);
+      num_compressed_blocks = std::max(num_compressed_blocks, batch.num_compressed_blocks);
     }
   }
 
-  // Compress the data streams
+  // Allocate intermediate output stream buffers, shared by all batches
   rmm::device_uvector<uint8_t> compressed_data(compressed_bfr_size, stream);
   cudf::detail::hostdevice_vector<compression_result> comp_results(num_compressed_blocks, stream);
-  std::optional<writer_compression_statistics> compression_stats;
-  thrust::fill(rmm::exec_policy(stream),
-               comp_results.d_begin(),
-               comp_results.d_end(),
-               compression_result{0, compression_status::FAILURE});
-  if (compression_kind != NONE) {
-    strm_descs.host_to_device_async(stream);
-    compression_stats = gpu::CompressOrcDataStreams(compressed_data,
-                                                    num_compressed_blocks,
-                                                    compression_kind,
-                                                    compression_blocksize,
-                                                    max_compressed_block_size,
-                                                    compressed_block_align,
-                                                    collect_compression_stats,
-                                                    strm_descs,
-                                                    enc_data.streams,
-                                                    comp_results,
-                                                    stream);
-
-    // deallocate encoded data as it is not needed anymore
-    enc_data.data.clear();
-
-    strm_descs.device_to_host_async(stream);
-    comp_results.device_to_host_sync(stream);
-  }
-
-  auto const max_out_stream_size = [&]() {
-    uint32_t max_stream_size = 0;
-    for (auto const& ss : strm_descs.host_view().flat_view()) {
-      if (!out_sink.is_device_write_preferred(ss.stream_size)) {
-        max_stream_size = std::max(max_stream_size, ss.stream_size);
-      }
-    }
-    return max_stream_size;
-  }();
-
-  cudf::detail::pinned_host_vector<uint8_t> bounce_buffer(max_out_stream_size);
 
   auto intermediate_stats = gather_statistic_blobs(stats_freq, orc_table, segmentation, stream);
 
@@ -2418,11 +2483,69 @@ auto convert_table_to_orc_data(table_view const& input,
                     std::move(comp_results),
                     std::move(strm_descs),
                     std::move(intermediate_stats),
-                    std::move(compression_stats),
                     std::move(streams),
                     std::move(stripes),
                     std::move(stripe_dicts.views),
-                    std::move(bounce_buffer)};
+                    std::move(stripe_batches)};
+}
+
+/**
+ * @brief Compresses the data streams of a batch of stripes.
+ *
+ * The encoded data of the stripes in the batch is released once it has been compressed.
+ *
+ * @param batch The batch of stripes to compress
+ * @param compression_kind The compression kind
+ * @param compression_blocksize The block size used for compression
+ * @param collect_compression_stats Whether to collect compression statistics
+ * @param compressed_data Compression output buffer, large enough to hold the batch
+ * @param comp_results Per-block compression results, large enough to hold the batch
+ * @param strm_descs List of stream descriptors [stripe][data_stream]
+ * @param enc_data ORC per-chunk streams of encoded data
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Compression statistics of the batch, if requested
+ */
+std::optional<writer_compression_statistics> compress_stripe_batch(
+  stripe_batch const& batch,
+  CompressionKind compression_kind,
+  size_t compression_blocksize,
+  bool collect_compression_stats,
+  device_span<uint8_t> compressed_data,
+  cudf::detail::hostdevice_vector<compression_result>& comp_results,
+  hostdevice_2dvector<gpu::StripeStream>& strm_descs,
+  encoded_data& enc_data,
+  rmm::cuda_stream_view stream)
+{
+  std::optional<writer_compression_statistics> compression_stats;
+  thrust::fill(rmm::exec_policy(stream),
+               comp_results.d_begin(),
+               comp_results.d_end(),
+               compression_result{0, compression_status::FAILURE});
+  if (compression_kind != NONE) {
+    strm_descs.host_to_device_async(stream);
+    compression_stats = gpu::CompressOrcDataStreams(
+      compressed_data,
+      batch.num_compressed_blocks,
+      compression_kind,
+      compression_blocksize,
+      max_compression_output_size(compression_kind, compression_blocksize),
+      comp_block_alignment(compression_kind),
+      collect_compression_stats,
+      strm_descs.device_view().subspan(batch.first_stripe, batch.num_stripes),
+      enc_data.streams,
+      device_span<compression_result>{comp_results.device_ptr(), batch.num_compressed_blocks},
+      stream);
+
+    // deallocate encoded data of the batch as it is not needed anymore
+    for (auto stripe_id = batch.first_stripe; stripe_id < batch.first_stripe + batch.num_stripes;
+         ++stripe_id) {
+      enc_data.data[stripe_id].clear();
+    }
+
+    strm_descs.device_to_host_async(stream);
+    comp_results.device_to_host_sync(stream);
+  }
+  return compression_stats;
 }
 
 }  // namespace
@@ -2439,6 +2562,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     _compression_statistics(options.get_compression_statistics()),
     _stats_freq(options.get_statistics_freq()),
     _sort_dictionaries{options.get_enable_dictionary_sort()},
+    _max_encode_buffer_bytes{options.get_max_encode_buffer_bytes()},
     _single_write_mode(mode),
     _kv_meta(options.get_key_value_metadata()),
     _out_sink(std::move(sink))
@@ -2460,6 +2584,7 @@ writer::impl::impl(std::unique_ptr<data_sink> sink,
     _compression_statistics(options.get_compression_statistics()),
     _stats_freq(options.get_statistics_freq()),
     _sort_dictionaries{options.get_enable_dictionary_sort()},
+    _max_encode_buffer_bytes{options.get_max_encode_buffer_bytes()},
     _single_write_mode(mode),
     _kv_meta(options.get_key_value_metadata()),
     _out_sink(std::move(sink))
@@ -2477,11 +2602,9 @@ void writer::impl::write(table_view const& input)
 
   if (not _table_meta) { _table_meta = make_table_meta(input); }
 
-  // All kinds of memory allocation and data compressions/encoding are performed here.
+  // All kinds of memory allocation and data encoding are performed here.
   // If any error occurs, such as out-of-memory exception, the internal state of the current writer
   // is still intact.
-  // Note that `out_sink_` is intentionally passed by const reference to prevent accidentally
-  // writing anything to it.
   [[maybe_unused]] auto [enc_data,
                          segmentation,
                          orc_table,
@@ -2489,11 +2612,10 @@ void writer::impl::write(table_view const& input)
                          comp_results,
                          strm_descs,
                          intermediate_stats,
-                         compression_stats,
                          streams,
                          stripes,
                          stripe_dicts, /* unused, but its data will be accessed via pointer later */
-                         bounce_buffer] = [&] {
+                         stripe_batches] = [&] {
     try {
       return convert_table_to_orc_data(input,
                                        *_table_meta,
@@ -2504,9 +2626,8 @@ void writer::impl::write(table_view const& input)
                                        _compression_kind,
                                        _compression_blocksize,
                                        _stats_freq,
-                                       _compression_statistics != nullptr,
                                        _single_write_mode,
-                                       *_out_sink,
+                                       _max_encode_buffer_bytes,
                                        _stream);
     } catch (...) {  // catch any exception type
       CUDF_LOG_ERROR(
@@ -2521,17 +2642,73 @@ void writer::impl::write(table_view const& input)
     _out_sink->host_write(MAGIC, std::strlen(MAGIC));
   }
 
-  // Compression/encoding were all successful. Now write the intermediate results.
-  write_orc_data_to_sink(enc_data,
-                         segmentation,
-                         orc_table,
-                         compressed_data,
-                         comp_results,
-                         strm_descs,
-                         intermediate_stats.rowgroup_blobs,
-                         streams,
-                         stripes,
-                         bounce_buffer);
+  // Compress and write the stripes one batch at a time; without an encode buffer limit, all
+  // stripes are in a single batch.
+  std::optional<writer_compression_statistics> compression_stats;
+  cudf::detail::pinned_host_vector<uint8_t> bounce_buffer;
+  for (auto const& batch : stripe_batches) {
+    std::optional<writer_compression_statistics> batch_stats;
+    try {
+      batch_stats = compress_stripe_batch(batch,
+                                          _compression_kind,
+                                          _compression_blocksize,
+                                          _compression_statistics != nullptr,
+                                          compressed_data,
+                                          comp_results,
+                                          strm_descs,
+                                          enc_data,
+                                          _stream);
+    } catch (...) {  // catch any exception type
+      if (batch.first_stripe != 0) {
+        CUDF_LOG_ERROR(
+          "ORC writer encountered exception during processing. "
+          "Part of the data has been written to the sink.");
+      } else {
+        CUDF_LOG_ERROR(
+          "ORC writer encountered exception during processing. "
+          "No data has been written to the sink.");
+      }
+      throw;  // this throws the same exception
+    }
+    if (batch_stats.has_value()) {
+      if (not compression_stats.has_value()) { compression_stats.emplace(); }
+      *compression_stats += *batch_stats;
+    }
+
+    auto batch_strm_descs = strm_descs.host_view().subspan(batch.first_stripe, batch.num_stripes);
+    auto const max_out_stream_size = [&]() {
+      uint32_t max_stream_size = 0;
+      for (auto const& ss : batch_strm_descs.flat_view()) {
+        if (!_out_sink->is_device_write_preferred(ss.stream_size)) {
+          max_stream_size = std::max(max_stream_size, ss.stream_size);
+        }
+      }
+      return max_stream_size;
+    }();
+    if (bounce_buffer.size() < max_out_stream_size) {
+      bounce_buffer = cudf::detail::pinned_host_vector<uint8_t>(max_out_stream_size);
+    }
+
+    // Compression/encoding were all successful. Now write the intermediate results.
+    write_orc_data_to_sink(enc_data,
+                           segmentation,
+                           orc_table,
+                           compressed_data,
+                           comp_results,
+                           strm_descs,
+                           intermediate_stats.rowgroup_blobs,
+                           streams,
+                           stripes,
+                           batch.first_stripe,
+                           batch.num_stripes,
+                           bounce_buffer);
+
+    // deallocate the encoded data of the batch, if it was not released during compression
+    for (auto stripe_id = batch.first_stripe; stripe_id < batch.first_stripe + batch.num_stripes;
+         ++stripe_id) {
+      enc_data.data[stripe_id].clear();
+    }
+  }
 
   // Update data into the footer. This needs to be called even when num_rows==0.
   add_table_to_footer_data(orc_table, stripes);
@@ -2564,13 +2741,15 @@ void writer::impl::write_orc_data_to_sink(encoded_data const& enc_data,
                                           host_span<ColStatsBlob const> rg_stats,
                                           orc_streams& streams,
                                           host_span<StripeInformation> stripes,
+                                          size_type first_stripe,
+                                          size_type num_stripes,
                                           host_span<uint8_t> bounce_buffer)
 {
   if (orc_table.num_rows() == 0) { return; }
 
   // Write stripes
   std::vector<std::future<void>> write_tasks;
-  for (size_t stripe_id = 0; stripe_id < stripes.size(); ++stripe_id) {
+  for (auto stripe_id = first_stripe; stripe_id < first_stripe + num_stripes; ++stripe_id) {
     auto& stripe = stripes[stripe_id];
 
     stripe.offset = _out_sink->bytes_written();
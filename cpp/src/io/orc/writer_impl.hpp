@@ -288,7 +288,7 @@ class writer::impl {
 
  private:
   /**
-   * @brief Write the intermediate ORC data into the data sink.
+   * @brief Write the intermediate ORC data of a range of stripes into the data sink.
    *
    * The intermediate data is generated from processing (compressing/encoding) an cuDF input table
    * by `convert_table_to_orc_data` called in the `write()` function.
@@ -302,6 +302,8 @@ class writer::impl {
    * @param[in] rg_stats row group level statistics
    * @param[in,out] streams List of stream descriptors
    * @param[in,out] stripes List of stripe description
+   * @param[in] first_stripe Index of the first stripe to write
+   * @param[in] num_stripes Number of stripes to write
    * @param[out] bounce_buffer Temporary host output buffer
    */
   void write_orc_data_to_sink(encoded_data const& enc_data,
@@ -313,6 +315,8 @@ class writer::impl {
                               host_span<ColStatsBlob const> rg_stats,
                               orc_streams& streams,
                               host_span<StripeInformation> stripes,
+                              size_type first_stripe,
+                              size_type num_stripes,
                               host_span<uint8_t> bounce_buffer);
 
   /**
@@ -347,6 +351,7 @@ class writer::impl {
   std::shared_ptr<writer_compression_statistics> _compression_statistics;  // Optional output
   statistics_freq const _stats_freq;
   bool const _sort_dictionaries;
+  std::optional<size_t> const _max_encode_buffer_bytes;
   single_write_mode const _single_write_mode;  // Special parameter only used by `write()` to
                                                // indicate that we are guaranteeing a single table
                                                // write. This enables some internal optimizations.
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/types.hpp>
+
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * @file bloom_filter.hpp
+ * @brief Split block Bloom filter primitives shared by the Parquet reader and writer.
+ *
+ * See https://github.com/apache/parquet-format/blob/master/BloomFilter.md. Values are hashed with
+ * 64-bit xxHash (seed 0) over their PLAIN encoding, without the length prefix for byte arrays.
+ * The functions here are usable from both host and device code.
+ */
+
+namespace cudf::io::parquet::detail {
+
+// Number of bytes in a block of the split block Bloom filter
+constexpr int32_t bloom_filter_block_bytes = 32;
+// Number of 32-bit words in a block of the split block Bloom filter
+constexpr int32_t bloom_filter_block_words = bloom_filter_block_bytes / sizeof(uint32_t);
+// Bitset size bounds used by parquet-mr, in bytes
+constexpr int32_t bloom_filter_min_bytes = 32;
+constexpr int32_t bloom_filter_max_bytes = 128 * 1024 * 1024;
+
+namespace bloom {
+
+constexpr uint64_t prime1 = 0x9e3779b185ebca87ul;
+constexpr uint64_t prime2 = 0xc2b2ae3d27d4eb4ful;
+constexpr uint64_t prime3 = 0x165667b19e3779f9ul;
+constexpr uint64_t prime4 = 0x85ebca77c2b2ae63ul;
+constexpr uint64_t prime5 = 0x27d4eb2f165667c5ul;
+
+CUDF_HOST_DEVICE inline uint64_t rotl(uint64_t x, int r) { return (x << r) | (x >> (64 - r)); }
+
+CUDF_HOST_DEVICE inline uint32_t read32(uint8_t const* p)
+{
+  // byte-wise for safe unaligned access
+  return p[0] | (p[1] << 8) | (p[2] << 16) | (static_cast<uint32_t>(p[3]) << 24);
+}
+
+CUDF_HOST_DEVICE inline uint64_t read64(uint8_t const* p)
+{
+  return static_cast<uint64_t>(read32(p)) | (static_cast<uint64_t>(read32(p + 4)) << 32);
+}
+
+CUDF_HOST_DEVICE inline uint64_t xxh_round(uint64_t acc, uint64_t input)
+{
+  acc += input * prime2;
+  acc = rotl(acc, 31);
+  return acc * prime1;
+}
+
+CUDF_HOST_DEVICE inline uint64_t merge_round(uint64_t acc, uint64_t val)
+{
+  acc ^= xxh_round(0, val);
+  return acc * prime1 + prime4;
+}
+
+// Salt values defined by the specification, used to derive the bit set in each block word
+CUDF_HOST_DEVICE inline uint32_t salt(int i)
+{
+  constexpr uint32_t salts[bloom_filter_block_words] = {0x47b6137bU,
+                                                        0x44974d91U,
+                                                        0x8824ad5bU,
+                                                        0xa2b7289dU,
+                                                        0x705495c7U,
+                                                        0x2df1424bU,
+                                                        0x9efc4947U,
+                                                        0x5c6bfb31U};
+  return salts[i];
+}
+
+}  // namespace bloom
+
+/**
+ * @brief Computes the 64-bit xxHash of a byte sequence
+ *
+ * @param data Pointer to the bytes to hash
+ * @param len Number of bytes to hash
+ * @param seed Hash seed, 0 for Parquet Bloom filters
+ * @return The hash value
+ */
+CUDF_HOST_DEVICE inline uint64_t bloom_filter_hash(uint8_t const* data,
+                                                   size_t len,
+                                                   uint64_t seed = 0)
+{
+  using namespace bloom;
+  size_t offset = 0;
+  uint64_t h64;
+  if (len >= 32) {
+    uint64_t v1 = seed + prime1 + prime2;
+    uint64_t v2 = seed + prime2;
+    uint64_t v3 = seed;
+    uint64_t v4 = seed - prime1;
+    for (; offset + 32 <= len; offset += 32) {
+      v1 = xxh_round(v1, read64(data + offset));
+      v2 = xxh_round(v2, read64(data + offset + 8));
+      v3 = xxh_round(v3, read64(data + offset + 16));
+      v4 = xxh_round(v4, read64(data + offset + 24));
+    }
+    h64 = rotl(v1, 1) + rotl(v2, 7) + rotl(v3, 12) + rotl(v4, 18);
+    h64 = merge_round(h64, v1);
+    h64 = merge_round(h64, v2);
+    h64 = merge_round(h64, v3);
+    h64 = merge_round(h64, v4);
+  } else {
+    h64 = seed + prime5;
+  }
+  h64 += len;
+
+  for (; offset + 8 <= len; offset += 8) {
+    h64 ^= xxh_round(0, read64(data + offset));
+    h64 = rotl(h64, 27) * prime1 + prime4;
+  }
+  if (offset + 4 <= len) {
+    h64 ^= static_cast<uint64_t>(read32(data + offset)) * prime1;
+    h64 = rotl(h64, 23) * prime2 + prime3;
+    offset += 4;
+  }
+  for (; offset < len; ++offset) {
+    h64 ^= static_cast<uint64_t>(data[offset]) * prime5;
+    h64 = rotl(h64, 11) * prime1;
+  }
+
+  h64 ^= h64 >> 33;
+  h64 *= prime2;
+  h64 ^= h64 >> 29;
+  h64 *= prime3;
+  h64 ^= h64 >> 32;
+  return h64;
+}
+
+/**
+ * @brief Returns the index of the block of the filter that a hash value maps to
+ *
+ * @param hash Hash value
+ * @param num_blocks Number of blocks in the filter
+ * @return Block index
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_block_index(uint64_t hash, uint32_t num_blocks)
+{
+  return static_cast<uint32_t>(((hash >> 32) * num_blocks) >> 32);
+}
+
+/**
+ * @brief Returns the bit to set or check in the given word of a block for a hash value
+ *
+ * @param hash Hash value
+ * @param word Index of the 32-bit word in the block
+ * @return Mask with the single bit for this word set
+ */
+CUDF_HOST_DEVICE inline uint32_t bloom_filter_word_mask(uint64_t hash, int word)
+{
+  auto const key = static_cast<uint32_t>(hash);
+  return uint32_t{1} << ((key * bloom::salt(word)) >> 27);
+}
+
+/**
+ * @brief Checks whether a split block Bloom filter may contain a hash value
+ *
+ * @param bitset Filter bitset, in the little-endian layout used by Parquet
+ * @param num_bytes Size of the bitset in bytes, a multiple of `bloom_filter_block_bytes`
+ * @param hash Hash value to check
+ * @return `false` if the value is definitely not in the filter
+ */
+CUDF_HOST_DEVICE inline bool bloom_filter_contains(uint8_t const* bitset,
+                                                   size_t num_bytes,
+                                                   uint64_t hash)
+{
+  auto const num_blocks = static_cast<uint32_t>(num_bytes / bloom_filter_block_bytes);
+  auto const block =
+    bitset + bloom_filter_block_index(hash, num_blocks) * size_t{bloom_filter_block_bytes};
+  for (int i = 0; i < bloom_filter_block_words; ++i) {
+    if ((bloom::read32(block + i * sizeof(uint32_t)) & bloom_filter_word_mask(hash, i)) == 0) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace cudf::io::parquet::detail
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "bloom_filter.hpp"
 #include "parquet_gpu.cuh"
 
 #include <cudf/detail/iterator.cuh>
@@ -24,6 +25,8 @@
 
 #include <cuda/atomic>
 
+#include <limits>
+
 namespace cudf::io::parquet::detail {
 
 namespace {
@@ -182,7 +185,7 @@ CUDF_KERNEL void __launch_bounds__(block_size)
     __syncthreads();
 
     // Check if the num unique values in chunk has already exceeded max dict size and early exit
-    if (total_num_dict_entries > MAX_DICT_SIZE) { return; }
+    if (total_num_dict_entries > chunk->max_dict_entries) { return; }
 
     val_idx += block_size;
   }  // while
@@ -267,6 +270,177 @@ CUDF_KERNEL void __launch_bounds__(block_size)
   }
 }
 
+/**
+ * @brief Returns an INT32 or INT64 leaf value as it is written with the PLAIN encoding
+ */
+inline __device__ int64_t plain_int_value(parquet_column_device_view const& col,
+                                          column_device_view const& data_col,
+                                          size_type val_idx)
+{
+  if (col.physical_type == Type::INT32) {
+    int32_t const scale = col.ts_scale == 0 ? 1 : col.ts_scale;
+    switch (data_col.type().id()) {
+      case type_id::INT8: return data_col.element<int8_t>(val_idx);
+      case type_id::UINT8: return data_col.element<uint8_t>(val_idx);
+      case type_id::INT16: return data_col.element<int16_t>(val_idx);
+      case type_id::UINT16: return data_col.element<uint16_t>(val_idx);
+      case type_id::DURATION_SECONDS:
+      case type_id::DURATION_MILLISECONDS:
+        return static_cast<int32_t>(data_col.element<int64_t>(val_idx) * scale);
+      default: return static_cast<int32_t>(data_col.element<int32_t>(val_idx) * scale);
+    }
+  }
+  auto v = data_col.element<int64_t>(val_idx);
+  if (col.ts_scale < 0) {
+    v /= -col.ts_scale;
+  } else if (col.ts_scale > 0) {
+    v *= col.ts_scale;
+  }
+  return v;
+}
+
+/**
+ * @brief Computes the Bloom filter hash of a leaf value, as written with the PLAIN encoding
+ */
+inline __device__ uint64_t bloom_filter_value_hash(parquet_column_device_view const& col,
+                                                   column_device_view const& data_col,
+                                                   size_type val_idx)
+{
+  auto const hash_bytes = [](void const* data, size_t size) {
+    return bloom_filter_hash(static_cast<uint8_t const*>(data), size);
+  };
+  auto const hash_value = [&](auto const value) { return hash_bytes(&value, sizeof(value)); };
+  auto const col_type   = data_col.type().id();
+
+  switch (col.physical_type) {
+    case Type::INT32:
+      return hash_value(static_cast<int32_t>(plain_int_value(col, data_col, val_idx)));
+    case Type::INT64: return hash_value(plain_int_value(col, data_col, val_idx));
+    case Type::FLOAT: return hash_value(data_col.element<float>(val_idx));
+    case Type::DOUBLE: return hash_value(data_col.element<double>(val_idx));
+    case Type::BYTE_ARRAY: {
+      if (col_type == type_id::STRING) {
+        auto const str = data_col.element<string_view>(val_idx);
+        return hash_bytes(str.data(), str.size_bytes());
+      }
+      auto const bytes = get_element<statistics::byte_array_view>(data_col, val_idx);
+      return hash_bytes(bytes.data(), bytes.size_bytes());
+    }
+    case Type::FIXED_LEN_BYTE_ARRAY: {
+      if (col_type == type_id::DECIMAL128) {
+        // decimals are written big-endian
+        auto const v     = data_col.element<numeric::decimal128>(val_idx).value();
+        auto const v_ptr = reinterpret_cast<uint8_t const*>(&v);
+        uint8_t be_bytes[sizeof(v)];
+        for (size_t i = 0; i < sizeof(v); ++i) {
+          be_bytes[i] = v_ptr[sizeof(v) - 1 - i];
+        }
+        return hash_bytes(be_bytes, sizeof(v));
+      }
+      auto const bytes = get_element<statistics::byte_array_view>(data_col, val_idx);
+      return hash_bytes(bytes.data(), bytes.size_bytes());
+    }
+    default: CUDF_UNREACHABLE("Unsupported type for Bloom filter");
+  }
+}
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  populate_chunk_bloom_filters_kernel(cudf::detail::device_2dspan<PageFragment const> frags)
+{
+  auto const col_idx = blockIdx.y;
+  auto const block_x = blockIdx.x;
+  auto const t       = threadIdx.x;
+  auto const frag    = frags[col_idx][block_x];
+  auto const chunk   = frag.chunk;
+  auto const col     = chunk->col_desc;
+
+  if (chunk->bloom_filter_data == nullptr) { return; }
+
+  size_type const start_row = frag.start_row;
+  size_type const end_row   = frag.start_row + frag.num_rows;
+
+  // Find the bounds of values in leaf column to be inserted into the filter for current chunk
+  size_type const start_value_idx = row_to_value_idx(start_row, *col);
+  size_type const end_value_idx   = row_to_value_idx(end_row, *col);
+
+  column_device_view const& data_col = *col->leaf_column;
+  auto const num_blocks              = chunk->bloom_filter_size / bloom_filter_block_bytes;
+
+  for (thread_index_type val_idx = start_value_idx + t; val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (not data_col.is_valid(val_idx)) { continue; }
+    auto const hash  = bloom_filter_value_hash(*col, data_col, val_idx);
+    auto const block = chunk->bloom_filter_data +
+                       bloom_filter_block_index(hash, num_blocks) * bloom_filter_block_words;
+    for (int i = 0; i < bloom_filter_block_words; ++i) {
+      atomicOr(block + i, bloom_filter_word_mask(hash, i));
+    }
+  }
+}
+
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  gather_chunk_delta_ranges_kernel(cudf::detail::device_2dspan<PageFragment const> frags)
+{
+  auto const col_idx = blockIdx.y;
+  auto const block_x = blockIdx.x;
+  auto const t       = threadIdx.x;
+  auto const frag    = frags[col_idx][block_x];
+  auto const chunk   = frag.chunk;
+  auto const col     = chunk->col_desc;
+
+  if (not chunk->use_adaptive_encoding) { return; }
+
+  size_type const start_row = frag.start_row;
+  size_type const end_row   = frag.start_row + frag.num_rows;
+
+  // Find the bounds of values in leaf column to be sampled for current chunk
+  size_type const start_value_idx = row_to_value_idx(start_row, *col);
+  size_type const end_value_idx   = row_to_value_idx(end_row, *col);
+
+  column_device_view const& data_col = *col->leaf_column;
+
+  // string values are delta encoded by their lengths
+  auto const encoded_value = [&](size_type val_idx) -> int64_t {
+    if (col->physical_type == Type::BYTE_ARRAY) {
+      return data_col.element<string_view>(val_idx).size_bytes();
+    }
+    return plain_int_value(*col, data_col, val_idx);
+  };
+
+  auto min_delta      = std::numeric_limits<int64_t>::max();
+  auto max_delta      = std::numeric_limits<int64_t>::min();
+  size_type num_valid = 0;
+  for (thread_index_type val_idx = start_value_idx + t; val_idx < end_value_idx;
+       val_idx += block_size) {
+    if (not data_col.is_valid(val_idx)) { continue; }
+    ++num_valid;
+    if (val_idx == start_value_idx or not data_col.is_valid(val_idx - 1)) { continue; }
+    // differences wrap around, as they do in the DELTA_BINARY_PACKED encoder
+    auto const delta = static_cast<int64_t>(static_cast<uint64_t>(encoded_value(val_idx)) -
+                                            static_cast<uint64_t>(encoded_value(val_idx - 1)));
+    min_delta = std::min(min_delta, delta);
+    max_delta = std::max(max_delta, delta);
+  }
+
+  using block_reduce = cub::BlockReduce<int64_t, block_size>;
+  __shared__ typename block_reduce::TempStorage reduce_storage;
+
+  auto const block_min_delta = block_reduce(reduce_storage).Reduce(min_delta, cub::Min());
+  __syncthreads();
+  auto const block_max_delta = block_reduce(reduce_storage).Reduce(max_delta, cub::Max());
+  __syncthreads();
+  auto const block_num_valid = block_reduce(reduce_storage).Sum(num_valid);
+  if (t == 0) {
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{chunk->min_delta}.fetch_min(
+      block_min_delta, cuda::std::memory_order_relaxed);
+    cuda::atomic_ref<int64_t, cuda::thread_scope_device>{chunk->max_delta}.fetch_max(
+      block_max_delta, cuda::std::memory_order_relaxed);
+    atomicAdd(&chunk->num_delta_values, static_cast<size_type>(block_num_valid));
+  }
+}
+
 void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
 {
   constexpr int block_size = 1024;
@@ -278,8 +452,8 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<PageFragment const> fr
                               rmm::cuda_stream_view stream)
 {
   dim3 const dim_grid(frags.size().second, frags.size().first);
-  populate_chunk_hash_maps_kernel<DEFAULT_BLOCK_SIZE>
-    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+  populate_chunk_hash_maps_kernel<DICT_INSERT_BLOCK_SIZE>
+    <<<dim_grid, DICT_INSERT_BLOCK_SIZE, 0, stream.value()>>>(frags);
 }
 
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream)
@@ -288,6 +462,22 @@ void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_vi
   collect_map_entries_kernel<block_size><<<chunks.size(), block_size, 0, stream.value()>>>(chunks);
 }
 
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<PageFragment const> frags,
+                                  rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  populate_chunk_bloom_filters_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
+void gather_chunk_delta_ranges(cudf::detail::device_2dspan<PageFragment const> frags,
+                               rmm::cuda_stream_view stream)
+{
+  dim3 const dim_grid(frags.size().second, frags.size().first);
+  gather_chunk_delta_ranges_kernel<DEFAULT_BLOCK_SIZE>
+    <<<dim_grid, DEFAULT_BLOCK_SIZE, 0, stream.value()>>>(frags);
+}
+
 void get_dictionary_indices(cudf::detail::device_2dspan<PageFragment const> frags,
                             rmm::cuda_stream_view stream)
 {
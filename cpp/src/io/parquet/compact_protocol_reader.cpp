@@ -19,11 +19,17 @@
 #include "parquet.hpp"
 #include "parquet_common.hpp"
 
+#include "io/utilities/config_utils.hpp"
+
 #include <cudf/utilities/error.hpp>
 
 #include <algorithm>
+#include <atomic>
 #include <cstddef>
 #include <functional>
+#include <future>
+#include <limits>
+#include <thread>
 #include <tuple>
 
 namespace cudf::io::parquet::detail {
@@ -361,6 +367,172 @@ struct parquet_field_struct_list : public parquet_field_list<T, FieldType::STRUC
   }
 };
 
+/**
+ * @brief Functor to read the column chunks of a row group from CompactProtocolReader
+ *
+ * Only the location of the column chunks of leaf columns that are not selected is decoded.
+ *
+ * @return True if field types mismatch or if the process of reading a
+ * struct fails
+ */
+class parquet_field_column_chunk_list : public parquet_field_list<ColumnChunk, FieldType::STRUCT> {
+ public:
+  parquet_field_column_chunk_list(int f, std::vector<ColumnChunk>& v)
+    : parquet_field_list<ColumnChunk, FieldType::STRUCT>(f, v)
+  {
+    auto const read_value = [this](uint32_t i, CompactProtocolReader* cpr) {
+      if (i >= cpr->m_selected_leaves.size() or cpr->m_selected_leaves[i]) {
+        cpr->read(&this->val[i]);
+      } else {
+        cpr->read_location(&this->val[i]);
+      }
+    };
+    this->bind_read_func(read_value);
+  }
+};
+
+namespace {
+
+/**
+ * @brief Returns the number of threads that may still be started to parse footers.
+ *
+ * The budget is shared by all the footers parsed at the same time, e.g. on the host worker pool,
+ * so that their parallel parses add at most one thread per core on top of the calling threads.
+ */
+std::atomic<int>& available_parse_threads()
+{
+  static std::atomic<int> available{
+    static_cast<int>(std::max(1u, std::thread::hardware_concurrency())) - 1};
+  return available;
+}
+
+/**
+ * @brief Takes up to `count` threads from the footer parse budget.
+ *
+ * @return The number of threads taken, which must be given back with a `parse_threads_guard`
+ */
+int acquire_parse_threads(int count)
+{
+  auto& available = available_parse_threads();
+  auto current    = available.load();
+  int taken       = 0;
+  do {
+    taken = std::min(count, current);
+    if (taken <= 0) { return 0; }
+  } while (not available.compare_exchange_weak(current, current - taken));
+  return taken;
+}
+
+/**
+ * @brief Gives the threads taken from the footer parse budget back when destroyed.
+ */
+struct parse_threads_guard {
+  int count;
+  ~parse_threads_guard() { available_parse_threads() += count; }
+};
+
+}  // namespace
+
+/**
+ * @brief Functor to read the row groups of a file from CompactProtocolReader, decoding the
+ * column chunk metadata of the leaf columns of the selected top-level fields only
+ *
+ * The schema precedes the row groups in the footer, so the leaf columns of the selected fields
+ * are known by the time the row groups are read. The row groups of large footers are decoded
+ * concurrently by the calling thread and by helper threads taken from a process-wide budget, after
+ * a cheap sequential pass that finds where each row group starts.
+ *
+ * @return True if field types mismatch or if the process of reading a
+ * struct fails
+ */
+class parquet_field_row_group_list : public parquet_field {
+  FileMetaData& md;
+  host_span<std::string const> selected_fields;
+
+ public:
+  parquet_field_row_group_list(int f, FileMetaData& m, host_span<std::string const> fields)
+    : parquet_field(f), md(m), selected_fields(fields)
+  {
+  }
+
+  inline void operator()(CompactProtocolReader* cpr, int field_type)
+  {
+    auto& selected = cpr->m_selected_leaves;
+    if (not selected_fields.empty() and not md.schema.empty()) {
+      // Walk the subtree of each top-level field, marking its leaves as selected if the field is
+      std::size_t idx = 1;
+      for (int32_t child = 0; child < md.schema[0].num_children and idx < md.schema.size();
+           ++child) {
+        auto const is_selected = std::find(selected_fields.begin(),
+                                           selected_fields.end(),
+                                           md.schema[idx].name) != selected_fields.end();
+        int64_t remaining      = 1;
+        while (remaining > 0 and idx < md.schema.size()) {
+          auto const& elem = md.schema[idx++];
+          remaining += elem.num_children - 1;
+          if (elem.num_children == 0) { selected.push_back(is_selected); }
+        }
+      }
+    }
+
+    assert_field_type(field_type, FieldType::LIST);
+    auto const [t, n] = cpr->get_listh();
+    assert_field_type(t, FieldType::STRUCT);
+    md.row_groups.resize(n);
+
+    // Read for every footer, so that the threshold can be changed at run time
+    auto const parallel_parse_size = cudf::io::detail::getenv_or(
+      "LIBCUDF_PARQUET_PARALLEL_FOOTER_PARSE_SIZE", default_parallel_parse_size);
+    auto const is_large =
+      n > 1 and static_cast<std::size_t>(cpr->m_end - cpr->m_cur) >= parallel_parse_size;
+    // The calling thread decodes its share of the row groups along with the helper threads
+    auto const max_helpers = std::min<std::size_t>(n - 1, std::numeric_limits<int>::max());
+    auto const num_helpers = is_large ? acquire_parse_threads(static_cast<int>(max_helpers)) : 0;
+    if (num_helpers == 0) {
+      for (auto& row_group : md.row_groups) {
+        cpr->read(&row_group);
+      }
+    } else {
+      // Declared first so that the threads are given back once the helpers are joined
+      parse_threads_guard const budget_guard{num_helpers};
+
+      std::vector<uint8_t const*> row_group_starts(n + 1);
+      for (uint32_t i = 0; i < n; ++i) {
+        row_group_starts[i] = cpr->m_cur;
+        cpr->skip_struct_field(static_cast<int>(FieldType::STRUCT));
+      }
+      row_group_starts[n] = cpr->m_cur;
+
+      // Each task decodes a contiguous range of row groups with its own reader. Plain threads are
+      // used since the footers of multiple files may already be parsed on the host worker pool.
+      auto const read_row_groups = [&](std::size_t begin, std::size_t end) {
+        CompactProtocolReader task_cpr(row_group_starts[begin],
+                                       row_group_starts[end] - row_group_starts[begin]);
+        task_cpr.m_selected_leaves = selected;
+        for (auto i = begin; i < end; ++i) {
+          task_cpr.read(&md.row_groups[i]);
+        }
+      };
+      // The futures of std::async join their threads when destroyed, also if a task throws
+      auto const num_tasks = static_cast<std::size_t>(num_helpers) + 1;
+      std::vector<std::future<void>> tasks;
+      for (std::size_t task = 1; task < num_tasks; ++task) {
+        tasks.emplace_back(std::async(
+          std::launch::async, read_row_groups, task * n / num_tasks, (task + 1) * n / num_tasks));
+      }
+      read_row_groups(0, n / num_tasks);
+      for (auto& task : tasks) {
+        task.get();
+      }
+    }
+    selected.clear();
+  }
+
+ private:
+  // Row groups are decoded in parallel if at least this many bytes of the footer remain
+  static constexpr std::size_t default_parallel_parse_size = 8 * 1024 * 1024;
+};
+
 /**
  * @brief Functor to read a binary from CompactProtocolReader
  *
@@ -535,14 +707,16 @@ inline void function_builder(CompactProtocolReader* cpr, std::tuple<Operator...>
   }
 }
 
-void CompactProtocolReader::read(FileMetaData* f)
+void CompactProtocolReader::read(FileMetaData* f) { read(f, {}); }
+
+void CompactProtocolReader::read(FileMetaData* f, host_span<std::string const> selected_fields)
 {
   using optional_list_column_order =
     parquet_field_optional<std::vector<ColumnOrder>, parquet_field_struct_list<ColumnOrder>>;
   auto op = std::make_tuple(parquet_field_int32(1, f->version),
                             parquet_field_struct_list(2, f->schema),
                             parquet_field_int64(3, f->num_rows),
-                            parquet_field_struct_list(4, f->row_groups),
+                            parquet_field_row_group_list(4, *f, selected_fields),
                             parquet_field_struct_list(5, f->key_value_metadata),
                             parquet_field_string(6, f->created_by),
                             optional_list_column_order(7, f->column_orders));
@@ -627,7 +801,7 @@ void CompactProtocolReader::read(RowGroup* r)
   using optional_list_sorting_column =
     parquet_field_optional<std::vector<SortingColumn>, parquet_field_struct_list<SortingColumn>>;
 
-  auto op = std::make_tuple(parquet_field_struct_list(1, r->columns),
+  auto op = std::make_tuple(parquet_field_column_chunk_list(1, r->columns),
                             parquet_field_int64(2, r->total_byte_size),
                             parquet_field_int64(3, r->num_rows),
                             optional_list_sorting_column(4, r->sorting_columns),
@@ -649,8 +823,30 @@ void CompactProtocolReader::read(ColumnChunk* c)
   function_builder(this, op);
 }
 
+/**
+ * @brief Reads a column chunk without decoding its metadata
+ *
+ * The file offset and the locations of the page indexes are still decoded, but the column chunk
+ * metadata is skipped, leaving `c->meta_data` default initialized.
+ *
+ * @param[out] c Column chunk
+ */
+void CompactProtocolReader::read_location(ColumnChunk* c)
+{
+  auto op = std::make_tuple(parquet_field_string(1, c->file_path),
+                            parquet_field_int64(2, c->file_offset),
+                            parquet_field_int64(4, c->offset_index_offset),
+                            parquet_field_int32(5, c->offset_index_length),
+                            parquet_field_int64(6, c->column_index_offset),
+                            parquet_field_int32(7, c->column_index_length));
+  function_builder(this, op);
+  c->has_metadata = false;
+}
+
 void CompactProtocolReader::read(ColumnChunkMetaData* c)
 {
+  using optional_i32 = parquet_field_optional<int32_t, parquet_field_int32>;
+  using optional_i64 = parquet_field_optional<int64_t, parquet_field_int64>;
   using optional_size_statistics =
     parquet_field_optional<SizeStatistics, parquet_field_struct<SizeStatistics>>;
   using optional_list_enc_stats =
@@ -668,6 +864,8 @@ void CompactProtocolReader::read(ColumnChunkMetaData* c)
                             parquet_field_int64(11, c->dictionary_page_offset),
                             parquet_field_struct(12, c->statistics),
                             optional_list_enc_stats(13, c->encoding_stats),
+                            optional_i64(14, c->bloom_filter_offset),
+                            optional_i32(15, c->bloom_filter_length),
                             optional_size_statistics(16, c->size_statistics));
   function_builder(this, op);
 }
@@ -798,6 +996,33 @@ void CompactProtocolReader::read(SortingColumn* s)
   function_builder(this, op);
 }
 
+void CompactProtocolReader::read(BloomFilterAlgorithm* a)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, a->algorithm));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterHash* h)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, h->hash));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterCompression* c)
+{
+  auto op = std::make_tuple(parquet_field_union_enumerator(1, c->compression));
+  function_builder(this, op);
+}
+
+void CompactProtocolReader::read(BloomFilterHeader* b)
+{
+  auto op = std::make_tuple(parquet_field_int32(1, b->num_bytes),
+                            parquet_field_struct(2, b->algorithm),
+                            parquet_field_struct(3, b->hash),
+                            parquet_field_struct(4, b->compression));
+  function_builder(this, op);
+}
+
 /**
  * @brief Constructs the schema from the file-level metadata
  *
@@ -813,11 +1038,24 @@ bool CompactProtocolReader::InitSchema(FileMetaData* md)
    * a std::vector of ColumnChunks. Each ColumnChunk has a member ColumnMetaData, which contains
    * a std::vector of std::strings representing paths. The purpose of the code below is to set the
    * schema_idx of each column of each row to it corresponding row_group. This is effectively
-   * mapping the columns to the schema.
+   * mapping the columns to the schema. Columns whose metadata was not decoded have no path, so
+   * they are mapped to the leaf at the same position, as column chunks are stored in the order of
+   * the leaves in the schema.
    */
+  std::vector<int> leaf_schema_indices;
+  for (std::size_t idx = 1; idx < md->schema.size(); ++idx) {
+    if (md->schema[idx].num_children == 0) { leaf_schema_indices.push_back(idx); }
+  }
   for (auto& row_group : md->row_groups) {
     int current_schema_index = 0;
-    for (auto& column : row_group.columns) {
+    for (std::size_t col_idx = 0; col_idx < row_group.columns.size(); ++col_idx) {
+      auto& column = row_group.columns[col_idx];
+      if (not column.has_metadata) {
+        if (col_idx >= leaf_schema_indices.size()) { return false; }
+        current_schema_index = leaf_schema_indices[col_idx];
+        column.schema_idx    = current_schema_index;
+        continue;
+      }
       int parent = 0;  // root of schema
       for (auto const& path : column.meta_data.path_in_schema) {
         auto const it = [&] {
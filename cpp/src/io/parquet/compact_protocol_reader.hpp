@@ -18,6 +18,8 @@
 
 #include "parquet.hpp"
 
+#include <cudf/utilities/span.hpp>
+
 #include <algorithm>
 #include <cstddef>
 #include <optional>
@@ -99,6 +101,7 @@ class CompactProtocolReader {
  public:
   // Generate Thrift structure parsing routines
   void read(FileMetaData* f);
+  void read(FileMetaData* f, host_span<std::string const> selected_fields);
   void read(SchemaElement* s);
   void read(LogicalType* l);
   void read(DecimalType* d);
@@ -122,6 +125,10 @@ class CompactProtocolReader {
   void read(ColumnOrder* c);
   void read(PageEncodingStats* s);
   void read(SortingColumn* s);
+  void read(BloomFilterAlgorithm* a);
+  void read(BloomFilterHash* h);
+  void read(BloomFilterCompression* c);
+  void read(BloomFilterHeader* b);
 
  public:
   static int NumRequiredBits(uint32_t max_level) noexcept
@@ -137,16 +144,24 @@ class CompactProtocolReader {
                  int max_def_level = 0,
                  int max_rep_level = 0);
 
+  void read_location(ColumnChunk* c);
+
  protected:
   uint8_t const* m_base = nullptr;
   uint8_t const* m_cur  = nullptr;
   uint8_t const* m_end  = nullptr;
 
+  // Leaf columns whose column chunk metadata is decoded when reading the row groups; all leaves
+  // are decoded if empty
+  std::vector<bool> m_selected_leaves;
+
   friend class parquet_field_string;
   friend class parquet_field_string_list;
   friend class parquet_field_binary;
   friend class parquet_field_binary_list;
   friend class parquet_field_struct_blob;
+  friend class parquet_field_column_chunk_list;
+  friend class parquet_field_row_group_list;
 };
 
 }  // namespace cudf::io::parquet::detail
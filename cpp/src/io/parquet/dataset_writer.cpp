@@ -0,0 +1,372 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/groupby/sort_helper.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/logger.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/data_sink.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_dataset.hpp>
+#include <cudf/null_mask.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/strings/convert/convert_booleans.hpp>
+#include <cudf/strings/convert/convert_datetime.hpp>
+#include <cudf/strings/convert/convert_fixed_point.hpp>
+#include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/convert/convert_integers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <list>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace cudf::io {
+
+void parquet_dataset_writer_options::set_max_file_size(size_t size_bytes)
+{
+  CUDF_EXPECTS(size_bytes > 0, "The maximum file size must be positive.");
+  _max_file_size = size_bytes;
+}
+
+void parquet_dataset_writer_options::set_max_open_files(size_type max_open_files)
+{
+  CUDF_EXPECTS(max_open_files > 0, "The maximum number of open files must be positive.");
+  _max_open_files = max_open_files;
+}
+
+parquet_dataset_writer_options_builder parquet_dataset_writer_options::builder(
+  std::string base_path, std::vector<size_type> partition_columns)
+{
+  return parquet_dataset_writer_options_builder{std::move(base_path),
+                                                std::move(partition_columns)};
+}
+
+namespace {
+
+// Directory name used by Hive for rows whose partition key is null
+constexpr std::string_view null_partition_value = "__HIVE_DEFAULT_PARTITION__";
+
+/**
+ * @brief Percent-encodes the characters that Hive escapes in partition directory names
+ */
+std::string escape_path_name(std::string_view name)
+{
+  constexpr std::string_view special_chars = "\"#%'*/:=?\\{}[]^";
+  std::string escaped;
+  escaped.reserve(name.size());
+  for (auto const c : name) {
+    auto const byte = static_cast<unsigned char>(c);
+    if (byte < 0x20 or byte == 0x7f or special_chars.find(c) != std::string_view::npos) {
+      char encoded[4];
+      std::snprintf(encoded, sizeof(encoded), "%%%02X", byte);
+      escaped.append(encoded);
+    } else {
+      escaped.push_back(c);
+    }
+  }
+  return escaped;
+}
+
+/**
+ * @brief Formats partition key values the way they appear in Hive directory names
+ */
+std::unique_ptr<column> to_strings(column_view const& keys, rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+  auto const id = keys.type().id();
+  if (id == type_id::BOOL8) {
+    return strings::from_booleans(
+      keys, string_scalar{"true", true, stream}, string_scalar{"false", true, stream}, stream, mr);
+  }
+  if (is_timestamp(keys.type())) {
+    auto const format   = id == type_id::TIMESTAMP_DAYS ? "%Y-%m-%d" : "%Y-%m-%d %H:%M:%S";
+    auto const no_names = column_view{data_type{type_id::STRING}, 0, nullptr, nullptr, 0};
+    return strings::from_timestamps(keys, format, strings_column_view{no_names}, stream, mr);
+  }
+  if (is_integral(keys.type())) { return strings::from_integers(keys, stream, mr); }
+  if (is_floating_point(keys.type())) { return strings::from_floats(keys, stream, mr); }
+  if (is_fixed_point(keys.type())) { return strings::from_fixed_point(keys, stream, mr); }
+  CUDF_FAIL("Unsupported partition column type");
+}
+
+/**
+ * @brief Copies a strings column to the host, with `std::nullopt` for null rows
+ */
+std::vector<std::optional<std::string>> to_host(strings_column_view const& input,
+                                                rmm::cuda_stream_view stream)
+{
+  if (input.size() == 0) { return {}; }
+  CUDF_EXPECTS(input.offsets().type().id() == type_id::INT32,
+               "Partition key strings must fit in a column with 32-bit offsets");
+  auto const offsets = cudf::detail::make_std_vector_sync(
+    device_span<size_type const>(input.offsets().data<size_type>() + input.offset(),
+                                 input.size() + 1),
+    stream);
+  auto const chars = cudf::detail::make_std_vector_sync(
+    device_span<char const>(input.chars_begin(stream), offsets.back()), stream);
+  auto const mask =
+    input.has_nulls()
+      ? cudf::detail::make_std_vector_sync(
+          device_span<bitmask_type const>(input.null_mask(),
+                                          num_bitmask_words(input.offset() + input.size())),
+          stream)
+      : std::vector<bitmask_type>{};
+
+  std::vector<std::optional<std::string>> result(input.size());
+  for (size_type row = 0; row < input.size(); ++row) {
+    if (mask.empty() or bit_is_set(mask.data(), input.offset() + row)) {
+      result[row].emplace(chars.data() + offsets[row], offsets[row + 1] - offsets[row]);
+    }
+  }
+  return result;
+}
+
+}  // namespace
+
+class parquet_dataset_writer::impl {
+ public:
+  impl(parquet_dataset_writer_options const& options, rmm::cuda_stream_view stream)
+    : _options{options}, _stream{stream}
+  {
+    CUDF_EXPECTS(not _options.get_base_path().empty(), "The dataset path cannot be empty.");
+    CUDF_EXPECTS(not _options.get_partition_columns().empty(),
+                 "At least one partition column is required.");
+  }
+
+  ~impl()
+  {
+    if (_closed) { return; }
+    try {
+      close();
+    } catch (std::exception const& e) {
+      CUDF_LOG_ERROR("Parquet dataset writer failed to close its files: {}", e.what());
+    }
+  }
+
+  void write(table_view const& table)
+  {
+    CUDF_EXPECTS(not _closed, "The dataset writer has been closed.");
+    if (_partition_names.empty()) { init_schema(table); }
+    CUDF_EXPECTS(table.num_columns() == _num_columns,
+                 "The table does not have the same columns as the previous tables.");
+    if (table.num_rows() == 0) { return; }
+
+    auto const mr     = rmm::mr::get_current_device_resource();
+    auto const keys   = table.select(_options.get_partition_columns());
+    auto const values = table.select(_data_columns);
+
+    // sort-based grouping; each group holds the rows of one partition
+    groupby::detail::sort::sort_groupby_helper helper(keys, null_policy::INCLUDE, sorted::NO, {});
+    auto const offsets = cudf::detail::make_std_vector_sync(helper.group_offsets(_stream), _stream);
+    auto const grouped = cudf::detail::gather(values,
+                                              helper.key_sort_order(_stream),
+                                              out_of_bounds_policy::DONT_CHECK,
+                                              cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                              _stream,
+                                              mr);
+    auto const directories = partition_directories(helper.unique_keys(_stream, mr)->view());
+
+    std::vector<size_type> slice_indices;
+    for (size_t group = 0; group + 1 < offsets.size(); ++group) {
+      slice_indices.push_back(offsets[group]);
+      slice_indices.push_back(offsets[group + 1]);
+    }
+    auto const partitions = cudf::detail::slice(grouped->view(), slice_indices, _stream);
+    for (size_t group = 0; group < partitions.size(); ++group) {
+      write_partition(directories[group], partitions[group]);
+    }
+  }
+
+  std::vector<std::string> close()
+  {
+    CUDF_EXPECTS(not _closed, "The dataset writer has been closed.");
+    _closed = true;
+    while (not _open.empty()) {
+      close_file(*_open.back());
+    }
+    return std::move(_files);
+  }
+
+ private:
+  struct open_file {
+    std::unique_ptr<data_sink> sink;
+    std::unique_ptr<parquet_chunked_writer> writer;
+  };
+
+  struct partition {
+    std::string directory;
+    int next_file{0};
+    std::optional<open_file> file;
+    std::list<partition*>::iterator lru_position;
+  };
+
+  void init_schema(table_view const& table)
+  {
+    _num_columns            = table.num_columns();
+    auto const& part_cols   = _options.get_partition_columns();
+    auto const is_partition = [&](size_type col) {
+      return std::find(part_cols.begin(), part_cols.end(), col) != part_cols.end();
+    };
+    for (auto const col : part_cols) {
+      CUDF_EXPECTS(col >= 0 and col < _num_columns, "Partition column index out of range.");
+      CUDF_EXPECTS(std::count(part_cols.begin(), part_cols.end(), col) == 1,
+                   "Partition columns must be distinct.");
+    }
+    CUDF_EXPECTS(static_cast<size_type>(part_cols.size()) < _num_columns,
+                 "The table must have at least one column that is not a partition column.");
+
+    auto const& metadata = _options.get_metadata();
+    if (metadata.has_value()) {
+      CUDF_EXPECTS(static_cast<size_type>(metadata->column_metadata.size()) == _num_columns,
+                   "Metadata must describe every column of the table.");
+    }
+    _data_metadata.emplace();
+    for (size_type col = 0; col < _num_columns; ++col) {
+      auto name = metadata.has_value() ? metadata->column_metadata[col].get_name() : std::string{};
+      if (name.empty()) { name = "_col" + std::to_string(col); }
+      if (not is_partition(col)) {
+        _data_columns.push_back(col);
+        _data_metadata->column_metadata.push_back(
+          metadata.has_value() ? metadata->column_metadata[col] : column_in_metadata{name});
+      }
+    }
+    for (auto const col : part_cols) {
+      auto const name =
+        metadata.has_value() ? metadata->column_metadata[col].get_name() : std::string{};
+      _partition_names.push_back(escape_path_name(name.empty() ? "_col" + std::to_string(col)
+                                                               : name));
+    }
+  }
+
+  /**
+   * @brief Returns the relative directory of each partition, `name1=value1/name2=value2`
+   */
+  std::vector<std::string> partition_directories(table_view const& unique_keys)
+  {
+    std::vector<std::string> directories(unique_keys.num_rows());
+    for (size_type col = 0; col < unique_keys.num_columns(); ++col) {
+      auto const& keys = unique_keys.column(col);
+      CUDF_EXPECTS(not is_nested(keys.type()), "Partition columns cannot be nested.");
+      auto const strings =
+        keys.type().id() == type_id::STRING ? nullptr : to_strings(keys, _stream);
+      auto const values =
+        to_host(strings_column_view{strings != nullptr ? strings->view() : keys}, _stream);
+      for (size_type row = 0; row < unique_keys.num_rows(); ++row) {
+        if (col > 0) { directories[row].push_back('/'); }
+        directories[row] += _partition_names[col] + "=" +
+                            (values[row].has_value() ? escape_path_name(*values[row])
+                                                     : std::string{null_partition_value});
+      }
+    }
+    return directories;
+  }
+
+  void write_partition(std::string const& directory, table_view const& rows)
+  {
+    auto& part = _partitions[directory];
+    if (part.file.has_value()) {
+      _open.splice(_open.begin(), _open, part.lru_position);
+    } else {
+      part.directory = directory;
+      open_next_file(part);
+    }
+    part.file->writer->write(rows);
+    if (part.file->sink->bytes_written() >= _options.get_max_file_size()) { close_file(part); }
+  }
+
+  void open_next_file(partition& part)
+  {
+    if (static_cast<size_type>(_open.size()) >= _options.get_max_open_files()) {
+      close_file(*_open.back());
+    }
+    auto const directory = std::filesystem::path{_options.get_base_path()} / part.directory;
+    std::filesystem::create_directories(directory);
+    char name[32];
+    std::snprintf(name, sizeof(name), "part-%05d.parquet", part.next_file++);
+    auto const path = (directory / name).string();
+
+    auto sink = data_sink::create(path);
+    auto const options =
+      chunked_parquet_writer_options::builder(sink_info{sink.get()})
+        .metadata(*_data_metadata)
+        .compression(_options.get_compression())
+        .stats_level(_options.get_stats_level())
+        .build();
+    part.file.emplace(
+      open_file{std::move(sink), std::make_unique<parquet_chunked_writer>(options, _stream)});
+    _files.push_back(path);
+    _open.push_front(&part);
+    part.lru_position = _open.begin();
+  }
+
+  void close_file(partition& part)
+  {
+    _open.erase(part.lru_position);
+    auto file = std::move(*part.file);
+    part.file.reset();
+    file.writer->close();
+    file.sink->flush();
+  }
+
+  parquet_dataset_writer_options _options;
+  rmm::cuda_stream_view _stream;
+  size_type _num_columns{0};
+  std::vector<size_type> _data_columns;
+  std::vector<std::string> _partition_names;
+  std::optional<table_input_metadata> _data_metadata;
+  // std::map keeps the partitions at stable addresses for the list of open files
+  std::map<std::string, partition> _partitions;
+  std::list<partition*> _open;  // most recently written first
+  std::vector<std::string> _files;
+  bool _closed{false};
+};
+
+parquet_dataset_writer::parquet_dataset_writer(parquet_dataset_writer_options const& options,
+                                               rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl>(options, stream)}
+{
+}
+
+parquet_dataset_writer::~parquet_dataset_writer() = default;
+
+parquet_dataset_writer& parquet_dataset_writer::write(table_view const& table)
+{
+  CUDF_FUNC_RANGE();
+  _impl->write(table);
+  return *this;
+}
+
+std::vector<std::string> parquet_dataset_writer::close()
+{
+  CUDF_FUNC_RANGE();
+  return _impl->close();
+}
+
+}  // namespace cudf::io
@@ -149,6 +149,162 @@ static __device__ int gpuUpdateValidityOffsetsAndRowIndicesFlat(
   return valid_count;
 }
 
+/**
+ * @brief Block-wide counterpart of `gpuUpdateValidityOffsetsAndRowIndices` for schemas with lists.
+ *
+ * Processes the repetition and definition levels in `[s->input_value_count, target_value_count)`
+ * with the whole block, generating list offsets and validity for every nesting level and the
+ * decode indices of the leaf values.
+ *
+ * @return The number of valid leaf values produced by the page so far
+ */
+template <typename level_t, typename state_buf>
+static __device__ int gpuUpdateValidityOffsetsAndRowIndicesLists(int32_t target_value_count,
+                                                                 page_state_s* s,
+                                                                 state_buf* sb,
+                                                                 level_t const* const rep,
+                                                                 level_t const* const def,
+                                                                 int t)
+{
+  constexpr int num_warps      = decode_block_size / cudf::detail::warp_size;
+  constexpr int max_batch_size = num_warps * cudf::detail::warp_size;
+
+  using block_scan = cub::BlockScan<int, decode_block_size>;
+  __shared__ typename block_scan::TempStorage scan_storage;
+
+  int const max_depth                      = s->col.max_nesting_depth;
+  PageNestingDecodeInfo* nesting_info_base = s->nesting_info;
+
+  // how many (input) values and rows we've processed in the page so far
+  int value_count = s->input_value_count;
+  int row_count   = s->input_row_count;
+  // how many leaf values we've emitted decode indices for
+  int leaf_valid_count = nesting_info_base[max_depth - 1].valid_count;
+
+  int const last_row              = s->first_row + s->num_rows;
+  int const row_index_lower_bound = s->row_index_lower_bound;
+  int const warp_lane             = t % cudf::detail::warp_size;
+
+  __syncthreads();
+
+  while (value_count < target_value_count) {
+    int const batch_size = min(max_batch_size, target_value_count - value_count);
+
+    // the range of nesting depths this value adds entries to
+    int start_depth = -1;
+    int end_depth   = -1;
+    int d           = -1;
+    if (t < batch_size) {
+      int const index = rolling_index<state_buf::nz_buf_size>(value_count + t);
+      d               = static_cast<int>(def[index]);
+      start_depth     = nesting_info_base[rep[index]].start_depth;
+      end_depth       = nesting_info_base[d].end_depth;
+    }
+
+    // page-relative row index of this value, and whether it's within the rows we are reading
+    int const is_new_row = start_depth == 0 ? 1 : 0;
+    int thread_row_count, block_row_count;
+    block_scan(scan_storage).InclusiveSum(is_new_row, thread_row_count, block_row_count);
+    __syncthreads();
+    int const row_index     = row_count + thread_row_count - 1;
+    int const in_row_bounds = row_index >= row_index_lower_bound && row_index < last_row;
+    row_count += block_row_count;
+
+    // output position of this value at the current nesting level
+    int thread_value_count, block_value_count;
+    block_scan(scan_storage)
+      .ExclusiveSum((0 >= start_depth && 0 <= end_depth && in_row_bounds) ? 1 : 0,
+                    thread_value_count,
+                    block_value_count);
+    __syncthreads();
+
+    for (int s_idx = 0; s_idx < max_depth; s_idx++) {
+      PageNestingDecodeInfo* nesting_info = &nesting_info_base[s_idx];
+      int const ni_value_count            = nesting_info->value_count;
+      int const ni_valid_count            = nesting_info->valid_count;
+      int const ni_valid_map_offset       = nesting_info->valid_map_offset;
+
+      int const in_nesting_bounds = (s_idx >= start_depth && s_idx <= end_depth) && in_row_bounds;
+      // everything up to the max_def_level is a non-null value
+      int const is_valid = d >= nesting_info->max_def_level && in_nesting_bounds ? 1 : 0;
+
+      int thread_valid_count, block_valid_count;
+      block_scan(scan_storage).ExclusiveSum(is_valid, thread_valid_count, block_valid_count);
+      __syncthreads();
+
+      // if this is the value column emit an index for value decoding
+      if (is_valid && s_idx == max_depth - 1) {
+        int const src_pos = ni_valid_count + thread_valid_count;
+        int const dst_pos = ni_value_count + thread_value_count;
+        sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)] = dst_pos;
+      }
+
+      // the offset for a list level is the current length of the next nesting level
+      int next_thread_value_count = 0;
+      int next_block_value_count  = 0;
+      if (s_idx < max_depth - 1) {
+        int const in_next_nesting_bounds =
+          (s_idx + 1 >= start_depth && s_idx + 1 <= end_depth) && in_row_bounds;
+        block_scan(scan_storage)
+          .ExclusiveSum(in_next_nesting_bounds, next_thread_value_count, next_block_value_count);
+        __syncthreads();
+
+        // anything above the leaf with a valid data pointer is a list
+        if (in_nesting_bounds && nesting_info->data_out != nullptr) {
+          auto const& next_info     = nesting_info_base[s_idx + 1];
+          int const idx             = ni_value_count + thread_value_count;
+          cudf::size_type const ofs = next_info.value_count + next_thread_value_count +
+                                      next_info.page_start_value;
+          (reinterpret_cast<cudf::size_type*>(nesting_info->data_out))[idx] = ofs;
+        }
+      }
+
+      // the values a warp adds to this level are contiguous in the output, so each warp gathers
+      // its validity bits at their output positions and stores them with one write
+      if (nesting_info->valid_map != nullptr) {
+        uint32_t const warp_count_mask = ballot(in_nesting_bounds);
+        int const warp_value_start     = shuffle(thread_value_count);
+        int const warp_value_index     = thread_value_count - warp_value_start;
+        uint32_t const warp_valid_mask = WarpReduceOr32(static_cast<uint32_t>(is_valid)
+                                                        << warp_value_index);
+        if (warp_lane == 0 && warp_count_mask != 0) {
+          store_validity(ni_valid_map_offset + warp_value_start,
+                         nesting_info->valid_map,
+                         warp_valid_mask,
+                         __popc(warp_count_mask));
+        }
+      }
+
+      __syncthreads();
+      if (t == 0) {
+        if (nesting_info->valid_map != nullptr) {
+          nesting_info->valid_map_offset += block_value_count;
+          nesting_info->null_count += block_value_count - block_valid_count;
+        }
+        nesting_info->valid_count += block_valid_count;
+        nesting_info->value_count += block_value_count;
+      }
+      if (s_idx == max_depth - 1) { leaf_valid_count += block_valid_count; }
+
+      // propagate value counts for the next level
+      thread_value_count = next_thread_value_count;
+      block_value_count  = next_block_value_count;
+    }
+
+    value_count += batch_size;
+    __syncthreads();
+  }
+
+  if (t == 0) {
+    // update valid value count for decoding and total # of values we've processed
+    s->nz_count          = leaf_valid_count;
+    s->input_value_count = value_count;
+    s->input_row_count   = row_count;
+  }
+
+  return leaf_valid_count;
+}
+
 template <typename state_buf>
 __device__ inline void gpuDecodeValues(
   page_state_s* s, state_buf* const sb, int start, int end, int t)
@@ -158,6 +314,9 @@ __device__ inline void gpuDecodeValues(
 
   PageNestingDecodeInfo* nesting_info_base = s->nesting_info;
   int const dtype                          = s->col.physical_type;
+  bool const has_repetition                = s->col.max_level[level_type::REPETITION] > 0;
+  // skipped_leaf_values will always be 0 for flat hierarchies.
+  int const skipped_leaf_values = s->page.skipped_leaf_values;
 
   // decode values
   int pos = start;
@@ -167,49 +326,53 @@ __device__ inline void gpuDecodeValues(
     int const target_pos = pos + batch_size;
     int const src_pos    = pos + t;
 
-    // the position in the output column/buffer
-    int dst_pos = sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)] - s->first_row;
+    // the position in the output column/buffer. list pages start writing at the first value of
+    // the page's first row, flat pages start reading at the beginning of the page.
+    int dst_pos = sb->nz_idx[rolling_index<state_buf::nz_buf_size>(src_pos)];
+    if (!has_repetition) { dst_pos -= s->first_row; }
 
     // target_pos will always be properly bounded by num_rows, but dst_pos may be negative (values
     // before first_row) in the flat hierarchy case.
     if (src_pos < target_pos && dst_pos >= 0) {
       // nesting level that is storing actual leaf values
       int const leaf_level_index = s->col.max_nesting_depth - 1;
+      // the value in the page data; list pages may skip values that precede the first row
+      int const val_src_pos = src_pos + skipped_leaf_values;
 
       uint32_t dtype_len = s->dtype_len;
       void* dst =
         nesting_info_base[leaf_level_index].data_out + static_cast<size_t>(dst_pos) * dtype_len;
       if (s->col.logical_type.has_value() && s->col.logical_type->type == LogicalType::DECIMAL) {
         switch (dtype) {
-          case INT32: gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst)); break;
-          case INT64: gpuOutputFast(s, sb, src_pos, static_cast<uint2*>(dst)); break;
+          case INT32: gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst)); break;
+          case INT64: gpuOutputFast(s, sb, val_src_pos, static_cast<uint2*>(dst)); break;
           default:
             if (s->dtype_len_in <= sizeof(int32_t)) {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int32_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int32_t*>(dst));
             } else if (s->dtype_len_in <= sizeof(int64_t)) {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<int64_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<int64_t*>(dst));
             } else {
-              gpuOutputFixedLenByteArrayAsInt(s, sb, src_pos, static_cast<__int128_t*>(dst));
+              gpuOutputFixedLenByteArrayAsInt(s, sb, val_src_pos, static_cast<__int128_t*>(dst));
             }
             break;
         }
       } else if (dtype == INT96) {
-        gpuOutputInt96Timestamp(s, sb, src_pos, static_cast<int64_t*>(dst));
+        gpuOutputInt96Timestamp(s, sb, val_src_pos, static_cast<int64_t*>(dst));
       } else if (dtype_len == 8) {
         if (s->dtype_len_in == 4) {
           // Reading INT32 TIME_MILLIS into 64-bit DURATION_MILLISECONDS
           // TIME_MILLIS is the only duration type stored as int32:
           // https://github.com/apache/parquet-format/blob/master/LogicalTypes.md#deprecated-time-convertedtype
-          gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst));
+          gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst));
         } else if (s->ts_scale) {
-          gpuOutputInt64Timestamp(s, sb, src_pos, static_cast<int64_t*>(dst));
+          gpuOutputInt64Timestamp(s, sb, val_src_pos, static_cast<int64_t*>(dst));
         } else {
-          gpuOutputFast(s, sb, src_pos, static_cast<uint2*>(dst));
+          gpuOutputFast(s, sb, val_src_pos, static_cast<uint2*>(dst));
         }
       } else if (dtype_len == 4) {
-        gpuOutputFast(s, sb, src_pos, static_cast<uint32_t*>(dst));
+        gpuOutputFast(s, sb, val_src_pos, static_cast<uint32_t*>(dst));
       } else {
-        gpuOutputGeneric(s, sb, src_pos, static_cast<uint8_t*>(dst), dtype_len);
+        gpuOutputGeneric(s, sb, val_src_pos, static_cast<uint8_t*>(dst), dtype_len);
       }
     }
 
@@ -569,6 +732,135 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
   if (t == 0 and s->error != 0) { set_error(s->error, error_code); }
 }
 
+/**
+ * @brief Kernel for computing fixed width column data stored in the pages of list columns
+ *
+ * Handles both plain and dictionary encoded pages of lists (of any depth) whose leaf values are
+ * fixed width. The repetition and definition levels are decoded with the whole block, instead of
+ * the single warp used by the catch-all kernel.
+ *
+ * @param pages List of pages
+ * @param chunks List of column chunks
+ * @param min_row Row index to start reading at
+ * @param num_rows Maximum number of rows to read
+ * @param error_code Error code to set if an error is encountered
+ * @tparam has_dict Whether the pages are dictionary encoded
+ */
+template <typename level_t, bool has_dict>
+CUDF_KERNEL void __launch_bounds__(decode_block_size)
+  gpuDecodePageDataFixedList(PageInfo* pages,
+                             device_span<ColumnChunkDesc const> chunks,
+                             size_t min_row,
+                             size_t num_rows,
+                             kernel_error::pointer error_code)
+{
+  __shared__ __align__(16) page_state_s state_g;
+  __shared__ __align__(16)
+    page_state_buffers_s<rolling_buf_size,                  // size of nz_idx buffer
+                         has_dict ? rolling_buf_size : 1,  // dictionary
+                         1>                                 // unused in this kernel
+      state_buffers;
+
+  page_state_s* const s = &state_g;
+  auto* const sb        = &state_buffers;
+  int const page_idx    = blockIdx.x;
+  int const t           = threadIdx.x;
+  PageInfo* pp          = &pages[page_idx];
+
+  auto constexpr mask = has_dict ? decode_kernel_mask::FIXED_WIDTH_DICT_LIST
+                                 : decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST;
+  if (!(BitAnd(pages[page_idx].kernel_mask, mask))) { return; }
+
+  // must come after the kernel mask check
+  [[maybe_unused]] null_count_back_copier _{s, t};
+
+  if (!setupLocalPageInfo(
+        s, pp, chunks, min_row, num_rows, mask_filter{mask}, page_processing_stage::DECODE)) {
+    return;
+  }
+
+  // the level stream decoders
+  __shared__ rle_run<level_t> rep_runs[rle_run_buffer_size];
+  rle_stream<level_t, decode_block_size, rolling_buf_size> rep_decoder{rep_runs};
+  __shared__ rle_run<level_t> def_runs[rle_run_buffer_size];
+  rle_stream<level_t, decode_block_size, rolling_buf_size> def_decoder{def_runs};
+
+  __shared__ rle_run<uint32_t> dict_runs[has_dict ? rle_run_buffer_size : 1];
+  rle_stream<uint32_t, decode_block_size, rolling_buf_size> dict_stream{dict_runs};
+
+  // if we have no work to do (eg, in a skip_rows/num_rows case) in this page.
+  if (s->num_rows == 0) { return; }
+
+  // initialize the stream decoders (requires values computed in setupLocalPageInfo)
+  level_t* const rep = reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::REPETITION]);
+  level_t* const def = reinterpret_cast<level_t*>(pp->lvl_decode_buf[level_type::DEFINITION]);
+  rep_decoder.init(s->col.level_bits[level_type::REPETITION],
+                   s->abs_lvl_start[level_type::REPETITION],
+                   s->abs_lvl_end[level_type::REPETITION],
+                   rep,
+                   s->page.num_input_values);
+  def_decoder.init(s->col.level_bits[level_type::DEFINITION],
+                   s->abs_lvl_start[level_type::DEFINITION],
+                   s->abs_lvl_end[level_type::DEFINITION],
+                   def,
+                   s->page.num_input_values);
+  if constexpr (has_dict) {
+    dict_stream.init(
+      s->dict_bits, s->data_start, s->data_end, sb->dict_idx, s->page.num_input_values);
+  }
+  __syncthreads();
+
+  // values preceding the first row were found during preprocessing. the level streams cannot
+  // seek, so their levels are decoded and discarded below, but the dictionary indices of the
+  // skipped leaf values can be dropped up front.
+  if constexpr (has_dict) {
+    int const skipped_leaf_values = s->page.skipped_leaf_values;
+    int skipped_count             = 0;
+    while (skipped_count < skipped_leaf_values) {
+      skipped_count +=
+        dict_stream.decode_next(t, min(rolling_buf_size, skipped_leaf_values - skipped_count));
+      __syncthreads();
+    }
+  }
+
+  // We use two counters in the loop below: processed_count and valid_count.
+  // - processed_count: number of level values out of num_input_values that we have decoded so
+  //   far. levels before s->input_value_count (the skipped values) are decoded but ignored.
+  // - valid_count: number of non-null leaf values we have decoded so far.
+  int const last_row  = s->first_row + s->num_rows;
+  int processed_count = 0;
+  int valid_count     = 0;
+  while (s->error == 0 && processed_count < s->page.num_input_values) {
+    int const batch_size = min(rolling_buf_size, s->page.num_input_values - processed_count);
+    // the two decoders share state in shared memory, so they cannot overlap. the # of rep/def
+    // levels decoded will always be the same.
+    rep_decoder.decode_next(t, batch_size);
+    __syncthreads();
+    processed_count += def_decoder.decode_next(t, batch_size);
+    __syncthreads();
+
+    int const next_valid_count =
+      gpuUpdateValidityOffsetsAndRowIndicesLists<level_t>(processed_count, s, sb, rep, def, t);
+    __syncthreads();
+
+    if constexpr (has_dict) {
+      // only decode the dictionary indices of the valid leaf values of this batch
+      dict_stream.decode_next(t, next_valid_count - valid_count);
+      __syncthreads();
+    }
+
+    // decode the values themselves
+    gpuDecodeValues(s, sb, valid_count, next_valid_count, t);
+    __syncthreads();
+
+    valid_count = next_valid_count;
+
+    // every value left in the page belongs to rows past the ones we are reading
+    if (s->input_row_count > last_row) { break; }
+  }
+  if (t == 0 and s->error != 0) { set_error(s->error, error_code); }
+}
+
 /**
  * @brief Kernel for computing fixed width non dictionary column data stored in the pages
  *
@@ -726,6 +1018,37 @@ void __host__ DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pa
   }
 }
 
+void __host__ DecodePageDataFixedList(cudf::detail::hostdevice_span<PageInfo> pages,
+                                      cudf::detail::hostdevice_span<ColumnChunkDesc const> chunks,
+                                      size_t num_rows,
+                                      size_t min_row,
+                                      int level_type_size,
+                                      bool has_dict,
+                                      kernel_error::pointer error_code,
+                                      rmm::cuda_stream_view stream)
+{
+  dim3 dim_block(decode_block_size, 1);  // decode_block_size = 128 threads per block
+  dim3 dim_grid(pages.size(), 1);        // 1 thread block per page => # blocks
+
+  if (level_type_size == 1) {
+    if (has_dict) {
+      gpuDecodePageDataFixedList<uint8_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixedList<uint8_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
+  } else {
+    if (has_dict) {
+      gpuDecodePageDataFixedList<uint16_t, true><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    } else {
+      gpuDecodePageDataFixedList<uint16_t, false><<<dim_grid, dim_block, 0, stream.value()>>>(
+        pages.device_ptr(), chunks, min_row, num_rows, error_code);
+    }
+  }
+}
+
 void __host__ DecodeSplitPageDataFlat(cudf::detail::hostdevice_span<PageInfo> pages,
                                       cudf::detail::hostdevice_span<ColumnChunkDesc const> chunks,
                                       size_t num_rows,
@@ -16,6 +16,7 @@
 
 #pragma once
 
+#include "io/utilities/block_utils.cuh"
 #include "parquet_gpu.hpp"
 
 #include <cudf/detail/utilities/cuda.cuh>
@@ -42,6 +43,24 @@ inline __device__ void put_zz128(uint8_t*& p, zigzag128_t v)
   put_uleb128(p, (v ^ -s) * 2 + s);
 }
 
+// Number of bytes put_uleb128() writes for `v`.
+inline __device__ uint32_t uleb128_size(uleb128_t v)
+{
+  uint32_t size = 1;
+  while (v > 0x7f) {
+    v >>= 7;
+    size++;
+  }
+  return size;
+}
+
+// Number of bytes put_zz128() writes for `v`.
+inline __device__ uint32_t zz128_size(zigzag128_t v)
+{
+  zigzag128_t s = (v < 0);
+  return uleb128_size((v ^ -s) * 2 + s);
+}
+
 // A block size of 128, with 4 mini-blocks of 32 values each fits nicely without consuming
 // too much shared memory.
 // The parquet spec requires block_size to be a multiple of 128, and values_per_mini_block
@@ -51,14 +70,14 @@ inline __device__ void put_zz128(uint8_t*& p, zigzag128_t v)
 constexpr int block_size            = 128;
 constexpr int num_mini_blocks       = 4;
 constexpr int values_per_mini_block = block_size / num_mini_blocks;
-constexpr int buffer_size           = 2 * block_size;
+
+// Number of values buffered by a packer run by `num_threads` threads.
+constexpr int buffer_size(int num_threads) { return 2 * num_threads; }
 
 // An extra sanity checks to enforce compliance with the parquet specification.
 static_assert(block_size % 128 == 0);
 static_assert(values_per_mini_block % 32 == 0);
 
-constexpr int rolling_idx(int index) { return rolling_index<buffer_size>(index); }
-
 // Version of bit packer that can handle up to 64 bits values.
 // T is the type to use for processing. if nbits <= 32 use uint32_t, otherwise unsigned long long
 // (not uint64_t because of atomicOr's typing). allowing this to be selectable since there's a
@@ -121,33 +140,47 @@ inline __device__ void bitpack_mini_block(
 
 }  // namespace delta
 
+
 // Object used to turn a stream of integers into a DELTA_BINARY_PACKED stream. This takes as input
-// 128 values with validity at a time, saving them until there are enough values for a block
-// to be written.
+// `num_threads` values with validity at a time, saving them until there are enough values for
+// `num_threads / delta::block_size` blocks to be written at once.
 // T is the input data type (either int32_t or int64_t).
-template <typename T>
+template <typename T, int num_threads = delta::block_size>
 class delta_binary_packer {
  public:
-  using U            = std::make_unsigned_t<T>;
-  using block_reduce = cub::BlockReduce<T, delta::block_size>;
-  using warp_reduce  = cub::WarpReduce<U>;
-  using index_scan   = cub::BlockScan<size_type, delta::block_size>;
+  using U           = std::make_unsigned_t<T>;
+  using warp_reduce = cub::WarpReduce<U>;
+  using warp_scan   = cub::WarpScan<uint32_t>;
+  using index_scan  = cub::BlockScan<size_type, num_threads>;
+
+  // number of delta blocks encoded by each call to flush()
+  static constexpr int blocks_per_flush = num_threads / delta::block_size;
+  // one warp per mini-block
+  static constexpr int num_warps = num_threads / cudf::detail::warp_size;
+
+  static_assert(num_threads % delta::block_size == 0);
+  static_assert(delta::values_per_mini_block == cudf::detail::warp_size);
+  static_assert(num_warps <= cudf::detail::warp_size);
 
  private:
-  uint8_t* _dst;                             // sink to dump encoded values to
-  T* _buffer;                                // buffer to store values to be encoded
-  size_type _current_idx;                    // index of first value in buffer
-  uint32_t _num_values;                      // total number of values to encode
-  size_type _values_in_buffer;               // current number of values stored in _buffer
-  uint8_t _mb_bits[delta::num_mini_blocks];  // bitwidth for each mini-block
+  uint8_t* _dst;                // sink to dump encoded values to
+  T* _buffer;                   // buffer to store values to be encoded
+  size_type _current_idx;       // index of first value in buffer
+  uint32_t _num_values;         // total number of values to encode
+  size_type _values_in_buffer;  // current number of values stored in _buffer
+  uint8_t _mb_bits[num_warps];  // bitwidth for each mini-block
 
   // pointers to shared scratch memory for the warp and block scans/reduces
-  index_scan::TempStorage* _scan_tmp;
+  typename index_scan::TempStorage* _scan_tmp;
   typename warp_reduce::TempStorage* _warp_tmp;
-  typename block_reduce::TempStorage* _block_tmp;
 
   void* _bitpack_tmp;  // pointer to shared scratch memory used in bitpacking
 
+  static constexpr int rolling_idx(int index)
+  {
+    return rolling_index<delta::buffer_size(num_threads)>(index);
+  }
+
   // Write the delta binary header. Only call from thread 0.
   inline __device__ void write_header()
   {
@@ -157,12 +190,11 @@ class delta_binary_packer {
     delta::put_zz128(_dst, _buffer[0]);
   }
 
-  // Write the block header. Only call from thread 0.
-  inline __device__ void write_block_header(zigzag128_t block_min)
+  // Write the header of the delta block starting with mini-block `mb_id` to `dst`.
+  inline __device__ void write_block_header(uint8_t* dst, zigzag128_t block_min, int mb_id)
   {
-    delta::put_zz128(_dst, block_min);
-    memcpy(_dst, _mb_bits, 4);
-    _dst += 4;
+    delta::put_zz128(dst, block_min);
+    memcpy(dst, _mb_bits + mb_id, delta::num_mini_blocks);
   }
 
   // Signed subtraction with defined wrapping behavior.
@@ -180,10 +212,9 @@ class delta_binary_packer {
     _dst              = dest;
     _num_values       = num_values;
     _buffer           = buffer;
-    _scan_tmp         = reinterpret_cast<index_scan::TempStorage*>(temp_storage);
+    _scan_tmp         = reinterpret_cast<typename index_scan::TempStorage*>(temp_storage);
     _warp_tmp         = reinterpret_cast<typename warp_reduce::TempStorage*>(temp_storage);
-    _block_tmp        = reinterpret_cast<typename block_reduce::TempStorage*>(temp_storage);
-    _bitpack_tmp      = _buffer + delta::buffer_size;
+    _bitpack_tmp      = _buffer + delta::buffer_size(num_threads);
     _current_idx      = 0;
     _values_in_buffer = 0;
     _buffer[0]        = 0;
@@ -198,7 +229,7 @@ class delta_binary_packer {
     size_type num_valid;
     index_scan(*_scan_tmp).ExclusiveSum(valid, pos, num_valid);
 
-    if (is_valid) { _buffer[delta::rolling_idx(pos + _current_idx + _values_in_buffer)] = value; }
+    if (is_valid) { _buffer[rolling_idx(pos + _current_idx + _values_in_buffer)] = value; }
     __syncthreads();
 
     if (num_valid > 0 && threadIdx.x == 0) {
@@ -212,14 +243,17 @@ class delta_binary_packer {
     }
     __syncthreads();
 
-    if (_values_in_buffer >= delta::block_size) { flush(); }
+    if (_values_in_buffer >= num_threads) { flush(); }
   }
 
   // Called by each thread to flush data to the sink.
   inline __device__ uint8_t* flush()
   {
     using cudf::detail::warp_size;
-    __shared__ T block_min;
+    __shared__ T warp_min[num_warps];
+    __shared__ uint32_t mb_offset[num_warps];
+    __shared__ uint32_t flush_size;
+    __shared__ typename warp_scan::TempStorage offset_scan_tmp;
 
     int const t       = threadIdx.x;
     int const warp_id = t / warp_size;
@@ -233,18 +267,29 @@ class delta_binary_packer {
 
     // Calculate delta for this thread.
     size_type const idx = _current_idx + t;
-    T const delta       = idx < _num_values ? subtract(_buffer[delta::rolling_idx(idx)],
-                                                 _buffer[delta::rolling_idx(idx - 1)])
-                                            : std::numeric_limits<T>::max();
-
-    // Find min delta for the block.
-    auto const min_delta = block_reduce(*_block_tmp).Reduce(delta, cub::Min());
-
-    if (t == 0) { block_min = min_delta; }
+    T const delta       = idx < _num_values
+                            ? subtract(_buffer[rolling_idx(idx)], _buffer[rolling_idx(idx - 1)])
+                            : std::numeric_limits<T>::max();
+
+    // Find min delta for each warp, then for each delta block from the warps it spans.
+    T min_delta = delta;
+    for (int i = warp_size / 2; i > 0; i /= 2) {
+      min_delta = cub::Min()(min_delta, shuffle_xor(min_delta, i));
+    }
+    if (lane_id == 0) { warp_min[warp_id] = min_delta; }
     __syncthreads();
 
+    auto const block_min_of = [](int mb_id) {
+      auto const first_mb = mb_id - mb_id % delta::num_mini_blocks;
+      T block_min         = warp_min[first_mb];
+      for (int i = 1; i < delta::num_mini_blocks; i++) {
+        block_min = cub::Min()(block_min, warp_min[first_mb + i]);
+      }
+      return block_min;
+    };
+
     // Compute frame of reference for the block.
-    U const norm_delta = idx < _num_values ? subtract(delta, block_min) : 0;
+    U const norm_delta = idx < _num_values ? subtract(delta, block_min_of(warp_id)) : 0;
 
     // Get max normalized delta for each warp, and use that to determine how many bits to use
     // for the bitpacking of this warp.
@@ -254,24 +299,34 @@ class delta_binary_packer {
     if (lane_id == 0) { _mb_bits[warp_id] = sizeof(long long) * 8 - __clzll(warp_max); }
     __syncthreads();
 
-    // write block header
-    if (t == 0) { write_block_header(block_min); }
-    __syncthreads();
+    // The delta blocks are laid out back to back, each a header followed by its mini-blocks.
+    // An exclusive prefix sum of the mini-block sizes (with the block header counted in the
+    // first mini-block of each block) gives every warp the offset of its data, so all the
+    // blocks can be written at once.
+    if (warp_id == 0) {
+      uint32_t hdr_size = 0;
+      uint32_t mb_size  = 0;
+      if (lane_id < num_warps) {
+        auto const block_idx = _current_idx + lane_id * delta::values_per_mini_block;
+        if (lane_id % delta::num_mini_blocks == 0 && block_idx < _num_values) {
+          hdr_size = delta::zz128_size(block_min_of(lane_id)) + delta::num_mini_blocks;
+        }
+        mb_size = _mb_bits[lane_id] * delta::values_per_mini_block / 8;
+      }
+      uint32_t offset;
+      uint32_t total_size;
+      warp_scan(offset_scan_tmp).ExclusiveSum(hdr_size + mb_size, offset, total_size);
 
-    // Now each warp encodes its data...can calculate starting offset with _mb_bits.
-    // NOTE: using a switch here rather than a loop because the compiler produces code that
-    // uses fewer registers.
-    int cumulative_bits = 0;
-    switch (warp_id) {
-      case 3: cumulative_bits += _mb_bits[2]; [[fallthrough]];
-      case 2: cumulative_bits += _mb_bits[1]; [[fallthrough]];
-      case 1: cumulative_bits += _mb_bits[0];
+      if (hdr_size > 0) { write_block_header(_dst + offset, block_min_of(lane_id), lane_id); }
+      if (lane_id < num_warps) { mb_offset[lane_id] = offset + hdr_size; }
+      if (lane_id == 0) { flush_size = total_size; }
     }
-    uint8_t* const mb_ptr = _dst + cumulative_bits * delta::values_per_mini_block / 8;
+    __syncthreads();
 
     // encoding happens here
     auto const warp_idx = _current_idx + warp_id * delta::values_per_mini_block;
     if (warp_idx < _num_values) {
+      auto const mb_ptr  = _dst + mb_offset[warp_id];
       auto const num_enc = min(delta::values_per_mini_block, _num_values - warp_idx);
       if (_mb_bits[warp_id] > 32) {
         delta::bitpack_mini_block<unsigned long long>(
@@ -283,11 +338,11 @@ class delta_binary_packer {
     }
     __syncthreads();
 
-    // Last warp updates global delta ptr.
-    if (warp_id == delta::num_mini_blocks - 1 && lane_id == 0) {
-      _dst              = mb_ptr + _mb_bits[warp_id] * delta::values_per_mini_block / 8;
-      _current_idx      = min(warp_idx + delta::values_per_mini_block, _num_values);
-      _values_in_buffer = max(_values_in_buffer - delta::block_size, 0U);
+    // Update global delta ptr.
+    if (t == 0) {
+      _dst              = _dst + flush_size;
+      _current_idx      = min(_current_idx + num_threads, static_cast<size_type>(_num_values));
+      _values_in_buffer = max(_values_in_buffer - num_threads, 0);
     }
     __syncthreads();
 
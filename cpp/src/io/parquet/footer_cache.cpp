@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "footer_cache.hpp"
+
+#include "reader_impl_helpers.hpp"
+
+#include <sys/stat.h>
+
+#include <functional>
+
+namespace cudf::io::parquet::detail {
+
+std::size_t footer_cache::key_hash::operator()(key const& k) const
+{
+  auto seed = std::hash<std::string>{}(k.path);
+  // combine the hashes as in boost::hash_combine
+  auto const combine = [&seed](std::size_t h) {
+    seed ^= h + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+  };
+  combine(std::hash<uint64_t>{}(k.device));
+  combine(std::hash<uint64_t>{}(k.inode));
+  combine(std::hash<std::size_t>{}(k.file_size));
+  combine(std::hash<int64_t>{}(k.modification_time_ns));
+  combine(std::hash<int64_t>{}(k.change_time_ns));
+  combine(std::hash<bool>{}(k.has_page_indexes));
+  return seed;
+}
+
+std::optional<footer_cache::key> footer_cache::make_key(std::string const& path,
+                                                        std::size_t file_size,
+                                                        bool read_page_indexes) const
+{
+  if (capacity() == 0) { return std::nullopt; }
+
+  struct stat st;
+  if (stat(path.c_str(), &st) != 0) { return std::nullopt; }
+  auto const nanoseconds = [](timespec const& ts) {
+    return static_cast<int64_t>(ts.tv_sec) * 1'000'000'000 + ts.tv_nsec;
+  };
+  return key{path,
+             static_cast<uint64_t>(st.st_dev),
+             static_cast<uint64_t>(st.st_ino),
+             file_size,
+             nanoseconds(st.st_mtim),
+             nanoseconds(st.st_ctim),
+             read_page_indexes};
+}
+
+std::shared_ptr<metadata const> footer_cache::get(key const& k)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  auto const it = _index.find(k);
+  if (it == _index.end()) { return nullptr; }
+  _entries.splice(_entries.begin(), _entries, it->second);
+  ++_num_hits;
+  return it->second->footer;
+}
+
+void footer_cache::put(key k, std::shared_ptr<metadata const> footer, std::size_t encoded_size)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  if (encoded_size > _capacity or _index.count(k) != 0) { return; }
+
+  evict(_capacity - encoded_size);
+  _entries.push_front(entry{k, std::move(footer), encoded_size});
+  _index.emplace(std::move(k), _entries.begin());
+  _total_size += encoded_size;
+}
+
+void footer_cache::set_capacity(std::size_t capacity_bytes)
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  _capacity = capacity_bytes;
+  evict(_capacity);
+}
+
+std::size_t footer_cache::capacity() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _capacity;
+}
+
+std::size_t footer_cache::num_hits() const
+{
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _num_hits;
+}
+
+void footer_cache::evict(std::size_t capacity_bytes)
+{
+  while (_total_size > capacity_bytes) {
+    auto const& lru = _entries.back();
+    _total_size -= lru.encoded_size;
+    _index.erase(lru.k);
+    _entries.pop_back();
+  }
+}
+
+footer_cache& get_footer_cache()
+{
+  static footer_cache cache;
+  return cache;
+}
+
+}  // namespace cudf::io::parquet::detail
@@ -0,0 +1,141 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+
+namespace cudf::io::parquet::detail {
+
+struct metadata;
+
+/**
+ * @brief Process-wide, size-bounded LRU cache of parsed Parquet footers.
+ *
+ * The footers are keyed by the path, device, inode and size of the file and by its modification
+ * and status change times in nanoseconds, so a file that is rewritten or replaced is parsed again.
+ * The size of an entry is the encoded size of its footer and page indexes. The cache is disabled
+ * while its capacity is zero.
+ *
+ * All member functions are thread safe.
+ */
+class footer_cache {
+ public:
+  /**
+   * @brief Identifies the footer of a specific version of a file.
+   */
+  struct key {
+    std::string path;
+    uint64_t device;
+    uint64_t inode;
+    std::size_t file_size;
+    int64_t modification_time_ns;
+    int64_t change_time_ns;
+    bool has_page_indexes;  // whether the page indexes were read along with the footer
+
+    bool operator==(key const& other) const
+    {
+      return path == other.path and device == other.device and inode == other.inode and
+             file_size == other.file_size and
+             modification_time_ns == other.modification_time_ns and
+             change_time_ns == other.change_time_ns and
+             has_page_indexes == other.has_page_indexes;
+    }
+  };
+
+  /**
+   * @brief Builds the cache key of a file, if the cache is enabled and the file can be inspected.
+   *
+   * @param path Path of the file
+   * @param file_size Size of the file in bytes
+   * @param read_page_indexes Whether the page indexes are read along with the footer
+   * @return The key, or `std::nullopt` if the footer of the file is not to be cached
+   */
+  [[nodiscard]] std::optional<key> make_key(std::string const& path,
+                                            std::size_t file_size,
+                                            bool read_page_indexes) const;
+
+  /**
+   * @brief Returns the cached footer for the key, if present, and marks it as recently used.
+   *
+   * @param k Key of the file
+   * @return The parsed footer, or `nullptr` if not cached
+   */
+  [[nodiscard]] std::shared_ptr<metadata const> get(key const& k);
+
+  /**
+   * @brief Adds a parsed footer to the cache, evicting the least recently used footers as needed.
+   *
+   * Footers larger than the capacity are not cached.
+   *
+   * @param k Key of the file
+   * @param footer Parsed footer
+   * @param encoded_size Size of the encoded footer and page indexes in bytes
+   */
+  void put(key k, std::shared_ptr<metadata const> footer, std::size_t encoded_size);
+
+  /**
+   * @brief Sets the capacity of the cache, evicting footers as needed.
+   *
+   * @param capacity_bytes Maximum total encoded size of the cached footers, 0 disables the cache
+   */
+  void set_capacity(std::size_t capacity_bytes);
+
+  /**
+   * @brief Returns the capacity of the cache in bytes.
+   */
+  [[nodiscard]] std::size_t capacity() const;
+
+  /**
+   * @brief Returns the number of footers served from the cache since the process started.
+   */
+  [[nodiscard]] std::size_t num_hits() const;
+
+ private:
+  struct key_hash {
+    std::size_t operator()(key const& k) const;
+  };
+
+  struct entry {
+    key k;
+    std::shared_ptr<metadata const> footer;
+    std::size_t encoded_size;
+  };
+
+  void evict(std::size_t capacity_bytes);
+
+  mutable std::mutex _mutex;
+  std::size_t _capacity{0};
+  std::size_t _total_size{0};
+  std::size_t _num_hits{0};
+  // most recently used entries first
+  std::list<entry> _entries;
+  std::unordered_map<key, std::list<entry>::iterator, key_hash> _index;
+};
+
+/**
+ * @brief Returns the process-wide footer cache.
+ */
+footer_cache& get_footer_cache();
+
+}  // namespace cudf::io::parquet::detail
@@ -28,11 +28,20 @@ namespace cudf::io::parquet::detail {
  * @param[in,out] s Page state input/output
  * @param[out] sb Page state buffer output
  * @param[in] src_pos Source position
- * @param[in] dstv Pointer to row output data (string descriptor or 32-bit hash)
+ * @param[in] dstv Pointer to row output data (string descriptor, 32-bit hash or dictionary
+ * position)
  */
 template <typename state_buf>
 inline __device__ void gpuOutputString(page_state_s* s, state_buf* sb, int src_pos, void* dstv)
 {
+  if (s->col.is_strings_to_dict and s->col.physical_type == BYTE_ARRAY) {
+    // Output the position of the string in the string dictionary index of the pass. The strings
+    // are gathered from the dictionary pages when the dictionary column is built.
+    uint32_t const dict_idx =
+      (s->dict_bits > 0) ? sb->dict_idx[rolling_index<state_buf::dict_buf_size>(src_pos)] : 0;
+    *static_cast<uint32_t*>(dstv) = static_cast<uint32_t>(s->col.str_dict_index_offset) + dict_idx;
+    return;
+  }
   auto [ptr, len] = gpuGetStringData(s, sb, src_pos);
   if (s->col.is_strings_to_cat and s->col.physical_type == BYTE_ARRAY) {
     // Output hash. This hash value is used if the option to convert strings to
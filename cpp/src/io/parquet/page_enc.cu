@@ -55,6 +55,10 @@ constexpr int encode_block_size = 128;
 constexpr int rle_buffer_size   = 2 * encode_block_size;
 constexpr int num_encode_warps  = encode_block_size / cudf::detail::warp_size;
 
+// The delta encoders pack several DELTA_BINARY_PACKED blocks of a page at once, so they use wider
+// thread blocks to keep the GPU busy when only a few pages are being encoded.
+constexpr int delta_encode_block_size = 4 * delta::block_size;
+
 constexpr int rolling_idx(int pos) { return rolling_index<rle_buffer_size>(pos); }
 
 // max V1 header size
@@ -350,11 +354,11 @@ struct BitwiseOr {
 
 // PT is the parquet physical type (INT32 or INT64).
 // I is the column type from the input table.
-template <Type PT, typename I>
+template <int block_size, Type PT, typename I>
 __device__ uint8_t const* delta_encode(page_enc_state_s<0>* s, uint64_t* buffer, void* temp_space)
 {
   using output_type = std::conditional_t<PT == INT32, int32_t, int64_t>;
-  __shared__ delta_binary_packer<output_type> packer;
+  __shared__ delta_binary_packer<output_type, block_size> packer;
 
   auto const t = threadIdx.x;
   if (t == 0) {
@@ -366,7 +370,7 @@ __device__ uint8_t const* delta_encode(page_enc_state_s<0>* s, uint64_t* buffer,
   // might need to modify this if there's a big performance hit in the 32-bit case.
   int32_t const scale = s->col.ts_scale == 0 ? 1 : s->col.ts_scale;
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
-    uint32_t const nvals = min(s->page.num_leaf_values - cur_val_idx, delta::block_size);
+    uint32_t const nvals = min(s->page.num_leaf_values - cur_val_idx, block_size);
 
     size_type const val_idx_in_block = cur_val_idx + t;
     size_type const val_idx          = s->page_start_val + val_idx_in_block;
@@ -521,6 +525,9 @@ __device__ encode_kernel_mask data_encoding_for_col(EncColumnChunk const* chunk,
     }
   }
 
+  // then for the encoding estimated to be the smallest, if one was chosen
+  if (chunk->use_adaptive_encoding) { return chunk->adaptive_encoding; }
+
   // Select a fallback encoding. For V1, we always choose PLAIN. For V2 we'll use
   // DELTA_BINARY_PACKED for INT32 and INT64, and DELTA_LENGTH_BYTE_ARRAY for
   // BYTE_ARRAY. Everything else will still fall back to PLAIN.
@@ -1993,22 +2000,21 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
 }
 
 // DELTA_BINARY_PACKED page data encoder
-// blockDim(128, 1, 1)
+// blockDim(512, 1, 1)
 template <int block_size>
-CUDF_KERNEL void __launch_bounds__(block_size, 8)
+CUDF_KERNEL void __launch_bounds__(block_size, 2)
   gpuEncodeDeltaBinaryPages(device_span<EncPage> pages,
                             device_span<device_span<uint8_t const>> comp_in,
                             device_span<device_span<uint8_t>> comp_out,
                             device_span<compression_result> comp_results)
 {
   // block of shared memory for value storage and bit packing
-  __shared__ uleb128_t delta_shared[delta::buffer_size + delta::block_size];
+  __shared__ uleb128_t delta_shared[delta::buffer_size(block_size) + block_size];
   __shared__ __align__(8) page_enc_state_s<0> state_g;
   __shared__ union {
-    typename delta_binary_packer<uleb128_t>::index_scan::TempStorage delta_index_tmp;
-    typename delta_binary_packer<uleb128_t>::block_reduce::TempStorage delta_reduce_tmp;
-    typename delta_binary_packer<uleb128_t>::warp_reduce::TempStorage
-      delta_warp_red_tmp[delta::num_mini_blocks];
+    typename delta_binary_packer<uleb128_t, block_size>::index_scan::TempStorage delta_index_tmp;
+    typename delta_binary_packer<uleb128_t, block_size>::warp_reduce::TempStorage
+      delta_warp_red_tmp[block_size / cudf::detail::warp_size];
   } temp_storage;
 
   auto* const s = &state_g;
@@ -2055,30 +2061,30 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
     switch (dtype_len_in) {
       case 8: {
         // only DURATIONS map to 8 bytes, so safe to just use signed here?
-        delta_ptr = delta_encode<INT32, int64_t>(s, delta_shared, &temp_storage);
+        delta_ptr = delta_encode<block_size, INT32, int64_t>(s, delta_shared, &temp_storage);
         break;
       }
       case 4: {
         if (type_id == type_id::UINT32) {
-          delta_ptr = delta_encode<INT32, uint32_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, uint32_t>(s, delta_shared, &temp_storage);
         } else {
-          delta_ptr = delta_encode<INT32, int32_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, int32_t>(s, delta_shared, &temp_storage);
         }
         break;
       }
       case 2: {
         if (type_id == type_id::UINT16) {
-          delta_ptr = delta_encode<INT32, uint16_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, uint16_t>(s, delta_shared, &temp_storage);
         } else {
-          delta_ptr = delta_encode<INT32, int16_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, int16_t>(s, delta_shared, &temp_storage);
         }
         break;
       }
       case 1: {
         if (type_id == type_id::UINT8) {
-          delta_ptr = delta_encode<INT32, uint8_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, uint8_t>(s, delta_shared, &temp_storage);
         } else {
-          delta_ptr = delta_encode<INT32, int8_t>(s, delta_shared, &temp_storage);
+          delta_ptr = delta_encode<block_size, INT32, int8_t>(s, delta_shared, &temp_storage);
         }
         break;
       }
@@ -2086,9 +2092,9 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
     }
   } else {
     if (type_id == type_id::UINT64) {
-      delta_ptr = delta_encode<INT64, uint64_t>(s, delta_shared, &temp_storage);
+      delta_ptr = delta_encode<block_size, INT64, uint64_t>(s, delta_shared, &temp_storage);
     } else {
-      delta_ptr = delta_encode<INT64, int64_t>(s, delta_shared, &temp_storage);
+      delta_ptr = delta_encode<block_size, INT64, int64_t>(s, delta_shared, &temp_storage);
     }
   }
 
@@ -2096,27 +2102,26 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
 }
 
 // DELTA_LENGTH_BYTE_ARRAY page data encoder
-// blockDim(128, 1, 1)
+// blockDim(512, 1, 1)
 template <int block_size>
-CUDF_KERNEL void __launch_bounds__(block_size, 8)
+CUDF_KERNEL void __launch_bounds__(block_size, 2)
   gpuEncodeDeltaLengthByteArrayPages(device_span<EncPage> pages,
                                      device_span<device_span<uint8_t const>> comp_in,
                                      device_span<device_span<uint8_t>> comp_out,
                                      device_span<compression_result> comp_results)
 {
   // block of shared memory for value storage and bit packing
-  __shared__ uleb128_t delta_shared[delta::buffer_size + delta::block_size];
+  __shared__ uleb128_t delta_shared[delta::buffer_size(block_size) + block_size];
   __shared__ __align__(8) page_enc_state_s<0> state_g;
-  __shared__ delta_binary_packer<int32_t> packer;
+  __shared__ delta_binary_packer<int32_t, block_size> packer;
   __shared__ uint8_t const* first_string;
   __shared__ size_type string_data_len;
   using block_reduce = cub::BlockReduce<uint32_t, block_size>;
   __shared__ union {
     typename block_reduce::TempStorage reduce_storage;
-    typename delta_binary_packer<uleb128_t>::index_scan::TempStorage delta_index_tmp;
-    typename delta_binary_packer<uleb128_t>::block_reduce::TempStorage delta_reduce_tmp;
-    typename delta_binary_packer<uleb128_t>::warp_reduce::TempStorage
-      delta_warp_red_tmp[delta::num_mini_blocks];
+    typename delta_binary_packer<uleb128_t, block_size>::index_scan::TempStorage delta_index_tmp;
+    typename delta_binary_packer<uleb128_t, block_size>::warp_reduce::TempStorage
+      delta_warp_red_tmp[block_size / cudf::detail::warp_size];
   } temp_storage;
 
   auto* const s = &state_g;
@@ -2176,7 +2181,7 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
 
   uint32_t len = 0;
   for (uint32_t cur_val_idx = 0; cur_val_idx < s->page.num_leaf_values;) {
-    uint32_t const nvals = min(s->page.num_leaf_values - cur_val_idx, delta::block_size);
+    uint32_t const nvals = min(s->page.num_leaf_values - cur_val_idx, block_size);
 
     size_type const val_idx_in_block = cur_val_idx + t;
     size_type const val_idx          = s->page_start_val + val_idx_in_block;
@@ -2239,9 +2244,9 @@ struct byte_array {
 };
 
 // DELTA_BYTE_ARRAY page data encoder
-// blockDim(128, 1, 1)
+// blockDim(512, 1, 1)
 template <int block_size>
-CUDF_KERNEL void __launch_bounds__(block_size, 8)
+CUDF_KERNEL void __launch_bounds__(block_size, 2)
   gpuEncodeDeltaByteArrayPages(device_span<EncPage> pages,
                                device_span<device_span<uint8_t const>> comp_in,
                                device_span<device_span<uint8_t>> comp_out,
@@ -2249,9 +2254,9 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
 {
   using cudf::detail::warp_size;
   // block of shared memory for value storage and bit packing
-  __shared__ uleb128_t delta_shared[delta::buffer_size + delta::block_size];
+  __shared__ uleb128_t delta_shared[delta::buffer_size(block_size) + block_size];
   __shared__ __align__(8) page_enc_state_s<0> state_g;
-  __shared__ delta_binary_packer<int32_t> packer;
+  __shared__ delta_binary_packer<int32_t, block_size> packer;
   __shared__ uint8_t* scratch_data;
   __shared__ size_t avg_suffix_len;
   using block_scan   = cub::BlockScan<size_type, block_size>;
@@ -2259,10 +2264,9 @@ CUDF_KERNEL void __launch_bounds__(block_size, 8)
   __shared__ union {
     typename block_scan::TempStorage scan_storage;
     typename block_reduce::TempStorage reduce_storage;
-    typename delta_binary_packer<uleb128_t>::index_scan::TempStorage delta_index_tmp;
-    typename delta_binary_packer<uleb128_t>::block_reduce::TempStorage delta_reduce_tmp;
-    typename delta_binary_packer<uleb128_t>::warp_reduce::TempStorage
-      delta_warp_red_tmp[delta::num_mini_blocks];
+    typename delta_binary_packer<uleb128_t, block_size>::index_scan::TempStorage delta_index_tmp;
+    typename delta_binary_packer<uleb128_t, block_size>::warp_reduce::TempStorage
+      delta_warp_red_tmp[block_size / cudf::detail::warp_size];
   } temp_storage;
 
   auto* const s = &state_g;
@@ -3461,22 +3465,25 @@ void EncodePages(device_span<EncPage> pages,
     auto const strm = streams[s_idx++];
     gpuEncodePageLevels<encode_block_size><<<num_pages, encode_block_size, 0, strm.value()>>>(
       pages, write_v2_headers, encode_kernel_mask::DELTA_BINARY);
-    gpuEncodeDeltaBinaryPages<encode_block_size>
-      <<<num_pages, encode_block_size, 0, strm.value()>>>(pages, comp_in, comp_out, comp_results);
+    gpuEncodeDeltaBinaryPages<delta_encode_block_size>
+      <<<num_pages, delta_encode_block_size, 0, strm.value()>>>(
+        pages, comp_in, comp_out, comp_results);
   }
   if (BitAnd(kernel_mask, encode_kernel_mask::DELTA_LENGTH_BA) != 0) {
     auto const strm = streams[s_idx++];
     gpuEncodePageLevels<encode_block_size><<<num_pages, encode_block_size, 0, strm.value()>>>(
       pages, write_v2_headers, encode_kernel_mask::DELTA_LENGTH_BA);
-    gpuEncodeDeltaLengthByteArrayPages<encode_block_size>
-      <<<num_pages, encode_block_size, 0, strm.value()>>>(pages, comp_in, comp_out, comp_results);
+    gpuEncodeDeltaLengthByteArrayPages<delta_encode_block_size>
+      <<<num_pages, delta_encode_block_size, 0, strm.value()>>>(
+        pages, comp_in, comp_out, comp_results);
   }
   if (BitAnd(kernel_mask, encode_kernel_mask::DELTA_BYTE_ARRAY) != 0) {
     auto const strm = streams[s_idx++];
     gpuEncodePageLevels<encode_block_size><<<num_pages, encode_block_size, 0, strm.value()>>>(
       pages, write_v2_headers, encode_kernel_mask::DELTA_BYTE_ARRAY);
-    gpuEncodeDeltaByteArrayPages<encode_block_size>
-      <<<num_pages, encode_block_size, 0, strm.value()>>>(pages, comp_in, comp_out, comp_results);
+    gpuEncodeDeltaByteArrayPages<delta_encode_block_size>
+      <<<num_pages, delta_encode_block_size, 0, strm.value()>>>(
+        pages, comp_in, comp_out, comp_results);
   }
   if (BitAnd(kernel_mask, encode_kernel_mask::DICTIONARY) != 0) {
     auto const strm = streams[s_idx++];
@@ -145,6 +145,11 @@ __device__ inline bool is_nested(ColumnChunkDesc const& chunk)
   return chunk.max_nesting_depth > 1;
 }
 
+__device__ inline bool is_list(ColumnChunkDesc const& chunk)
+{
+  return chunk.max_level[level_type::REPETITION] > 0;
+}
+
 __device__ inline bool is_byte_array(ColumnChunkDesc const& chunk)
 {
   return chunk.physical_type == BYTE_ARRAY;
@@ -189,6 +194,15 @@ __device__ decode_kernel_mask kernel_mask_for_page(PageInfo const& page,
     }
   }
 
+  if (is_list(chunk) && !is_byte_array(chunk) && !is_boolean(chunk)) {
+    if (page.encoding == Encoding::PLAIN) {
+      return decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST;
+    } else if (page.encoding == Encoding::PLAIN_DICTIONARY ||
+               page.encoding == Encoding::RLE_DICTIONARY) {
+      return decode_kernel_mask::FIXED_WIDTH_DICT_LIST;
+    }
+  }
+
   if (page.encoding == Encoding::BYTE_STREAM_SPLIT) {
     return decode_kernel_mask::BYTE_STREAM_SPLIT;
   }
@@ -481,6 +495,11 @@ void __launch_bounds__(128) gpuDecodePageHeaders(ColumnChunkDesc* chunks,
           }
           bs->page.page_data = const_cast<uint8_t*>(bs->cur);
           bs->cur += bs->page.compressed_page_size;
+          // skip over the leading data pages dropped using the page index
+          if (bs->page_type == PageType::DICTIONARY_PAGE and
+              bs->cur < bs->base + bs->ck.data_page_offset) {
+            bs->cur = bs->base + bs->ck.data_page_offset;
+          }
           if (bs->cur > bs->end) {
             error[warp_id] |=
               static_cast<kernel_error::value_type>(decode_error::DATA_STREAM_OVERRUN);
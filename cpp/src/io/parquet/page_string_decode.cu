@@ -937,7 +937,8 @@ CUDF_KERNEL void __launch_bounds__(preprocess_block_size) gpuComputePageStringSi
  * This function will write the page data and the page data's validity to the
  * output specified in the page's column chunk.
  *
- * This version uses a single warp to do the string copies.
+ * This version uses a single warp to do the string copies. Strings longer than a warp are copied
+ * cooperatively by the whole warp, the others by the thread that decoded them.
  *
  * @param pages List of pages
  * @param chunks List of column chunks
@@ -1050,7 +1051,8 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
           dst_pos = sb->nz_idx[rolling_index<rolling_buf_size>(src_pos + i)];
           if (!has_repetition) { dst_pos -= s->first_row; }
 
-          auto [ptr, len] = src_pos + i < target_pos && dst_pos >= 0
+          bool const is_output_value = src_pos + i < target_pos && dst_pos >= 0;
+          auto [ptr, len] = is_output_value
                               ? gpuGetStringData(s, sb, src_pos + skipped_leaf_values + i)
                               : cuda::std::pair<char const*, size_t>{nullptr, 0};
 
@@ -1059,11 +1061,8 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
           cub::WarpScan<size_t>(temp_storage).ExclusiveSum(len, offset, warp_total);
           offset += last_offset;
 
-          // choose a character parallel string copy when the average string is longer than a warp
-          auto const use_char_ll = warp_total / warp_size >= warp_size;
-
           if (s->page.encoding == Encoding::BYTE_STREAM_SPLIT) {
-            if (src_pos + i < target_pos && dst_pos >= 0) {
+            if (is_output_value) {
               auto const stride = s->page.str_bytes / s->dtype_len_in;
               auto offptr =
                 reinterpret_cast<int32_t*>(nesting_info_base[leaf_level_index].data_out) + dst_pos;
@@ -1074,36 +1073,27 @@ CUDF_KERNEL void __launch_bounds__(decode_block_size)
               }
             }
             __syncwarp();
-          } else if (use_char_ll) {
-            __shared__ uint8_t const* pointers[warp_size];
-            __shared__ size_t offsets[warp_size];
-            __shared__ int dsts[warp_size];
-            __shared__ int lengths[warp_size];
-
-            offsets[me]  = offset;
-            pointers[me] = reinterpret_cast<uint8_t const*>(ptr);
-            dsts[me]     = dst_pos;
-            lengths[me]  = len;
-            __syncwarp();
-
-            for (int ss = 0; ss < warp_size && ss + i + s->src_pos < target_pos; ss++) {
-              if (dsts[ss] >= 0) {
-                auto offptr =
-                  reinterpret_cast<int32_t*>(nesting_info_base[leaf_level_index].data_out) +
-                  dsts[ss];
-                *offptr      = lengths[ss];
-                auto str_ptr = nesting_info_base[leaf_level_index].string_out + offsets[ss];
-                ll_strcpy(str_ptr, pointers[ss], lengths[ss], me);
-              }
-            }
-
           } else {
-            if (src_pos + i < target_pos && dst_pos >= 0) {
+            // the offsets of the whole batch are known, so short strings are copied by their own
+            // thread while long ones (e.g. dictionary entries holding URLs) are copied one at a
+            // time by the whole warp with 16B stores instead of serializing on a single thread.
+            bool const is_long = is_output_value && len > warp_size;
+            if (is_output_value) {
               auto offptr =
                 reinterpret_cast<int32_t*>(nesting_info_base[leaf_level_index].data_out) + dst_pos;
-              *offptr      = len;
-              auto str_ptr = nesting_info_base[leaf_level_index].string_out + offset;
-              memcpy(str_ptr, ptr, len);
+              *offptr = len;
+              if (!is_long) {
+                memcpy(nesting_info_base[leaf_level_index].string_out + offset, ptr, len);
+              }
+            }
+            for (uint32_t long_mask = ballot(is_long); long_mask != 0;
+                 long_mask &= long_mask - 1) {
+              int const src_lane = __ffs(long_mask) - 1;
+              auto const src_ptr = shuffle(reinterpret_cast<std::uintptr_t>(ptr), src_lane);
+              auto const str_ptr =
+                nesting_info_base[leaf_level_index].string_out + shuffle(offset, src_lane);
+              ll_strcpy(
+                str_ptr, reinterpret_cast<uint8_t const*>(src_ptr), shuffle(len, src_lane), me);
             }
             __syncwarp();
           }
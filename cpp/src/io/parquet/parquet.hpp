@@ -377,6 +377,10 @@ struct ColumnChunkMetaData {
   // Set of all encodings used for pages in this column chunk. This information can be used to
   // determine if all data pages are dictionary encoded for example.
   thrust::optional<std::vector<PageEncodingStats>> encoding_stats;
+  // Byte offset from beginning of file to the Bloom filter header
+  thrust::optional<int64_t> bloom_filter_offset;
+  // Size of the Bloom filter header and bitset, in bytes
+  thrust::optional<int32_t> bloom_filter_length;
   // Optional statistics to help estimate total memory when converted to in-memory representations.
   // The histograms contained in these statistics can also be useful in some cases for more
   // fine-grained nullability/list length filter pushdown.
@@ -402,6 +406,8 @@ struct ColumnChunk {
 
   // Following fields are derived from other fields
   int schema_idx = -1;  // Index in flattened schema (derived from path_in_schema)
+  // False if meta_data was not decoded because the column was not selected
+  bool has_metadata = true;
   // The indexes don't really live here, but it's a convenient place to hang them.
   std::optional<OffsetIndex> offset_index;
   std::optional<ColumnIndex> column_index;
@@ -507,6 +513,44 @@ struct PageHeader {
   DataPageHeaderV2 data_page_header_v2;
 };
 
+/**
+ * @brief Thrift-derived union describing the Bloom filter algorithm
+ */
+struct BloomFilterAlgorithm {
+  // Block-based Bloom filter, the only algorithm defined by the specification
+  enum Algorithm { UNDEFINED, SPLIT_BLOCK };
+  Algorithm algorithm{Algorithm::SPLIT_BLOCK};
+};
+
+/**
+ * @brief Thrift-derived union describing the hash function used by the Bloom filter
+ */
+struct BloomFilterHash {
+  // xxHash strategy, the only hash function defined by the specification
+  enum Hash { UNDEFINED, XXHASH };
+  Hash hash{Hash::XXHASH};
+};
+
+/**
+ * @brief Thrift-derived union describing the compression of the Bloom filter bitset
+ */
+struct BloomFilterCompression {
+  enum Compression { UNDEFINED, UNCOMPRESSED };
+  Compression compression{Compression::UNCOMPRESSED};
+};
+
+/**
+ * @brief Thrift-derived struct describing the Bloom filter header
+ *
+ * The header is immediately followed by the bitset of the filter.
+ */
+struct BloomFilterHeader {
+  int32_t num_bytes = 0;  // Size of the bitset in bytes
+  BloomFilterAlgorithm algorithm;
+  BloomFilterHash hash;
+  BloomFilterCompression compression;
+};
+
 // bit space we are reserving in column_buffer::user_data
 constexpr uint32_t PARQUET_COLUMN_BUFFER_SCHEMA_MASK          = (0xff'ffffu);
 constexpr uint32_t PARQUET_COLUMN_BUFFER_FLAG_LIST_TERMINATED = (1 << 24);
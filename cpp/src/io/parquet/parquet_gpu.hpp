@@ -48,6 +48,9 @@ constexpr int MAX_DICT_BITS = 24;
 // Total number of unsigned 24 bit values
 constexpr size_type MAX_DICT_SIZE = (1 << MAX_DICT_BITS) - 1;
 
+// Number of threads of each block inserting the values of a fragment into a dictionary hash map
+constexpr int DICT_INSERT_BLOCK_SIZE = 256;
+
 // level decode buffer size.
 constexpr int LEVEL_DECODE_BUF_SIZE = 2048;
 
@@ -206,16 +209,18 @@ enum level_type {
  * Used to control which decode kernels to run.
  */
 enum class decode_kernel_mask {
-  NONE                   = 0,
-  GENERAL                = (1 << 0),  // Run catch-all decode kernel
-  STRING                 = (1 << 1),  // Run decode kernel for string data
-  DELTA_BINARY           = (1 << 2),  // Run decode kernel for DELTA_BINARY_PACKED data
-  DELTA_BYTE_ARRAY       = (1 << 3),  // Run decode kernel for DELTA_BYTE_ARRAY encoded data
-  DELTA_LENGTH_BA        = (1 << 4),  // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY encoded data
-  FIXED_WIDTH_NO_DICT    = (1 << 5),  // Run decode kernel for fixed width non-dictionary pages
-  FIXED_WIDTH_DICT       = (1 << 6),  // Run decode kernel for fixed width dictionary pages
-  BYTE_STREAM_SPLIT      = (1 << 7),  // Run decode kernel for BYTE_STREAM_SPLIT encoded data
-  BYTE_STREAM_SPLIT_FLAT = (1 << 8),  // Same as above but with a flat schema
+  NONE                     = 0,
+  GENERAL                  = (1 << 0),   // Run catch-all decode kernel
+  STRING                   = (1 << 1),   // Run decode kernel for string data
+  DELTA_BINARY             = (1 << 2),   // Run decode kernel for DELTA_BINARY_PACKED data
+  DELTA_BYTE_ARRAY         = (1 << 3),   // Run decode kernel for DELTA_BYTE_ARRAY encoded data
+  DELTA_LENGTH_BA          = (1 << 4),   // Run decode kernel for DELTA_LENGTH_BYTE_ARRAY data
+  FIXED_WIDTH_NO_DICT      = (1 << 5),   // Run decode kernel for fixed width non-dictionary pages
+  FIXED_WIDTH_DICT         = (1 << 6),   // Run decode kernel for fixed width dictionary pages
+  BYTE_STREAM_SPLIT        = (1 << 7),   // Run decode kernel for BYTE_STREAM_SPLIT encoded data
+  BYTE_STREAM_SPLIT_FLAT   = (1 << 8),   // Same as above but with a flat schema
+  FIXED_WIDTH_NO_DICT_LIST = (1 << 9),   // Same as FIXED_WIDTH_NO_DICT but with lists
+  FIXED_WIDTH_DICT_LIST    = (1 << 10),  // Same as FIXED_WIDTH_DICT but with lists
 };
 
 // mask representing all the ways in which a string can be encoded
@@ -395,7 +400,8 @@ struct ColumnChunkDesc {
                            int32_t src_col_schema_,
                            column_chunk_info const* chunk_info_,
                            float list_bytes_per_row_est_,
-                           bool strings_to_categorical_)
+                           bool strings_to_categorical_,
+                           bool strings_to_dictionary_)
     : compressed_data(compressed_data_),
       compressed_size(compressed_size_),
       num_values(num_values_),
@@ -420,7 +426,8 @@ struct ColumnChunkDesc {
       src_col_schema(src_col_schema_),
       h_chunk_info(chunk_info_),
       list_bytes_per_row_est(list_bytes_per_row_est_),
-      is_strings_to_cat(strings_to_categorical_),
+      is_strings_to_cat(strings_to_categorical_ or strings_to_dictionary_),
+      is_strings_to_dict(strings_to_dictionary_),
       is_large_string_col(false)
   {
   }
@@ -430,6 +437,8 @@ struct ColumnChunkDesc {
   size_t num_values{};               // total number of values in this column
   size_t start_row{};                // file-wide, absolute starting row of this chunk
   uint32_t num_rows{};               // number of rows in this chunk
+  size_t data_page_offset{};         // offset of the first data page within compressed_data
+  uint32_t num_dropped_rows{};       // rows in the pages dropped using the page index
   int16_t max_level[level_type::NUM_LEVEL_TYPES]{};  // max definition/repetition level
   int16_t max_nesting_depth{};                       // max nesting depth of the output
   int32_t type_length{};                             // type length from schema (for FLBA only)
@@ -440,6 +449,7 @@ struct ColumnChunkDesc {
   int32_t num_dict_pages{};                     // number of dictionary pages
   PageInfo const* dict_page{};
   string_index_pair* str_dict_index{};           // index for string dictionary
+  size_t str_dict_index_offset{};                // offset of str_dict_index in the pass index
   bitmask_type** valid_map_base{};               // base pointers of valid bit map for this column
   void** column_data_base{};                     // base pointers of column data
   void** column_string_base{};                   // base pointers of column string data
@@ -456,6 +466,7 @@ struct ColumnChunkDesc {
   float list_bytes_per_row_est{};  // for LIST columns, an estimate on number of bytes per row
 
   bool is_strings_to_cat{};    // convert strings to hashes
+  bool is_strings_to_dict{};   // convert strings to positions in the string dictionary index
   bool is_large_string_col{};  // `true` if string data uses 64-bit offsets
 };
 
@@ -488,6 +499,7 @@ struct parquet_column_device_view : stats_column_desc {
                                //!< col.nullable() in case of chunked writing.
   bool output_as_byte_array;   //!< Indicates this list column is being written as a byte array
   bool skip_compression;       //!< Skip compression for this column
+  bool write_bloom_filter;     //!< Write a Bloom filter for this column
   column_encoding requested_encoding;  //!< User specified encoding for this column.
 };
 
@@ -564,6 +576,7 @@ struct EncColumnChunk {
   slot_type* dict_map_slots;   //!< Hash map storage for calculating dict encoding for this chunk
   size_type dict_map_size;     //!< Size of dict_map_slots
   size_type num_dict_entries;  //!< Total number of entries in dictionary
+  size_type max_dict_entries;  //!< Number of entries after which inserting into the map stops
   size_type
     uniq_data_size;  //!< Size of dictionary page (set of all unique values) if dict enc is used
   size_type plain_data_size;  //!< Size of data in this chunk if plain encoding is used
@@ -577,6 +590,14 @@ struct EncColumnChunk {
   uint32_t* def_histogram_data;  //!< Buffers for size histograms. One for chunk and one per page.
   uint32_t* rep_histogram_data;  //!< Size is (max(level) + 1) * (num_data_pages + 1).
   size_t var_bytes_size;         //!< Sum of var_bytes_size from the pages (byte arrays only)
+  uint32_t* bloom_filter_data;   //!< Bloom filter bitset, nullptr if no filter is written
+  uint32_t bloom_filter_size;    //!< Size of the Bloom filter bitset in bytes
+  int64_t min_delta;             //!< Smallest difference between adjacent non-null values
+  int64_t max_delta;             //!< Largest difference between adjacent non-null values
+  size_type num_delta_values;    //!< Number of non-null values sampled for the deltas
+  bool use_adaptive_encoding;    //!< True if `adaptive_encoding` overrides the default encoding
+  encode_kernel_mask
+    adaptive_encoding;  //!< Data encoding estimated to be the smallest, if use_adaptive_encoding
 
   constexpr uint32_t num_dict_pages() const { return use_dictionary ? 1 : 0; }
 
@@ -926,6 +947,30 @@ void DecodePageDataFixedDict(cudf::detail::hostdevice_span<PageInfo> pages,
                              kernel_error::pointer error_code,
                              rmm::cuda_stream_view stream);
 
+/**
+ * @brief Launches kernel for reading fixed width column data stored in the pages of list columns
+ *
+ * The page data will be written to the output pointed to in the page's
+ * associated column chunk.
+ *
+ * @param[in,out] pages All pages to be decoded
+ * @param[in] chunks All chunks to be decoded
+ * @param[in] num_rows Total number of rows to read
+ * @param[in] min_row Minimum number of rows to read
+ * @param[in] level_type_size Size in bytes of the type for level decoding
+ * @param[in] has_dict Whether to decode the dictionary encoded pages rather than the plain ones
+ * @param[out] error_code Error code for kernel failures
+ * @param[in] stream CUDA stream to use
+ */
+void DecodePageDataFixedList(cudf::detail::hostdevice_span<PageInfo> pages,
+                             cudf::detail::hostdevice_span<ColumnChunkDesc const> chunks,
+                             std::size_t num_rows,
+                             size_t min_row,
+                             int level_type_size,
+                             bool has_dict,
+                             kernel_error::pointer error_code,
+                             rmm::cuda_stream_view stream);
+
 /**
  * @brief Launches kernel for reading dictionary fixed width column data stored in the pages
  *
@@ -1007,6 +1052,9 @@ void initialize_chunk_hash_maps(device_span<EncColumnChunk> chunks, rmm::cuda_st
 /**
  * @brief Insert chunk values into their respective hash maps
  *
+ * Insertion into a chunk's map stops once it holds more than `max_dict_entries` entries, after
+ * each fragment's block has inserted at most `DICT_INSERT_BLOCK_SIZE` more values.
+ *
  * @param frags Column fragments
  * @param stream CUDA stream to use
  */
@@ -1021,6 +1069,32 @@ void populate_chunk_hash_maps(cudf::detail::device_2dspan<PageFragment const> fr
  */
 void collect_map_entries(device_span<EncColumnChunk> chunks, rmm::cuda_stream_view stream);
 
+/**
+ * @brief Insert chunk values into their respective Bloom filters
+ *
+ * Values are hashed in their PLAIN encoded form. Only chunks with a non-null
+ * `bloom_filter_data` are processed, and their bitsets must be zero-initialized.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void populate_chunk_bloom_filters(cudf::detail::device_2dspan<PageFragment const> frags,
+                                  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Gather the range of the differences between adjacent chunk values
+ *
+ * For INT32 and INT64 columns the differences are taken between the values, and for string
+ * columns between the value lengths. Only chunks with `use_adaptive_encoding` set are processed,
+ * and their `min_delta`, `max_delta` and `num_delta_values` must be initialized to the identities
+ * of min, max and sum respectively. Differences across fragment boundaries are not sampled.
+ *
+ * @param frags Column fragments
+ * @param stream CUDA stream to use
+ */
+void gather_chunk_delta_ranges(cudf::detail::device_2dspan<PageFragment const> frags,
+                               rmm::cuda_stream_view stream);
+
 /**
  * @brief Get the Dictionary Indices for each row
  *
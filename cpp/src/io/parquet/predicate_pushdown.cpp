@@ -13,8 +13,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "bloom_filter.hpp"
+#include "compact_protocol_reader.hpp"
 #include "reader_impl_helpers.hpp"
 
+#include "io/utilities/stats_expression_converter.hpp"
+
 #include <cudf/ast/detail/expression_transformer.hpp>
 #include <cudf/ast/detail/operators.hpp>
 #include <cudf/ast/expressions.hpp>
@@ -23,6 +27,7 @@
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -34,20 +39,26 @@
 #include <thrust/iterator/counting_iterator.h>
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <numeric>
 #include <optional>
+#include <set>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace cudf::io::parquet::detail {
 
 namespace {
+using cudf::io::detail::stats_expression_converter;
+
 /**
  * @brief Converts statistics in column chunks to 2 device columns - min, max values.
  *
  */
 struct stats_caster {
   size_type total_row_groups;
-  std::vector<metadata> const& per_file_metadata;
+  std::vector<std::shared_ptr<metadata const>> const& per_file_metadata;
   host_span<std::vector<size_type> const> row_group_indices;
 
   template <typename ToType, typename FromType>
@@ -126,6 +137,81 @@ struct stats_caster {
     }
   }
 
+  // Local struct to hold host columns
+  template <typename T>
+  struct host_column {
+    // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
+    thrust::host_vector<T> val;
+    std::vector<bitmask_type> null_mask;
+    cudf::size_type null_count = 0;
+    host_column(size_type total_row_groups)
+      : val(total_row_groups),
+        null_mask(
+          cudf::util::div_rounding_up_safe<size_type>(
+            cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
+          ~bitmask_type{0})
+    {
+    }
+
+    void set_index(size_type index,
+                   thrust::optional<std::vector<uint8_t>> const& binary_value,
+                   Type const type)
+    {
+      set_index(index, binary_value.has_value() ? &binary_value.value() : nullptr, type);
+    }
+
+    // a null `binary_value` marks the statistic as unavailable
+    void set_index(size_type index, std::vector<uint8_t> const* binary_value, Type const type)
+    {
+      if (binary_value != nullptr) {
+        val[index] = convert<T>(binary_value->data(), binary_value->size(), type);
+      } else {
+        clear_bit_unsafe(null_mask.data(), index);
+        null_count++;
+      }
+    }
+
+    static auto make_strings_children(host_span<string_view> host_strings,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+    {
+      std::vector<char> chars{};
+      std::vector<cudf::size_type> offsets(1, 0);
+      for (auto const& str : host_strings) {
+        auto tmp =
+          str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
+        chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
+        offsets.push_back(offsets.back() + tmp.length());
+      }
+      auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
+      auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
+      return std::tuple{std::move(d_chars), std::move(d_offsets)};
+    }
+
+    auto to_device(cudf::data_type dtype,
+                   rmm::cuda_stream_view stream,
+                   rmm::device_async_resource_ref mr)
+    {
+      if constexpr (std::is_same_v<T, string_view>) {
+        auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
+        return cudf::make_strings_column(
+          val.size(),
+          std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
+          d_chars.release(),
+          null_count,
+          rmm::device_buffer{
+            null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
+      }
+      return std::make_unique<column>(
+        dtype,
+        val.size(),
+        cudf::detail::make_device_uvector_async(val, stream, mr).release(),
+        rmm::device_buffer{
+          null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
+        null_count);
+    }
+  };  // local struct host_column
+
   // Creates device columns from column statistics (min, max)
   template <typename T>
   std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
@@ -138,80 +224,12 @@ struct stats_caster {
     if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
       CUDF_FAIL("Compound types do not have statistics");
     } else {
-      // Local struct to hold host columns
-      struct host_column {
-        // using thrust::host_vector because std::vector<bool> uses bitmap instead of byte per bool.
-        thrust::host_vector<T> val;
-        std::vector<bitmask_type> null_mask;
-        cudf::size_type null_count = 0;
-        host_column(size_type total_row_groups)
-          : val(total_row_groups),
-            null_mask(
-              cudf::util::div_rounding_up_safe<size_type>(
-                cudf::bitmask_allocation_size_bytes(total_row_groups), sizeof(bitmask_type)),
-              ~bitmask_type{0})
-        {
-        }
-
-        void set_index(size_type index,
-                       thrust::optional<std::vector<uint8_t>> const& binary_value,
-                       Type const type)
-        {
-          if (binary_value.has_value()) {
-            val[index] = convert<T>(binary_value.value().data(), binary_value.value().size(), type);
-          }
-          if (not binary_value.has_value()) {
-            clear_bit_unsafe(null_mask.data(), index);
-            null_count++;
-          }
-        }
-
-        static auto make_strings_children(host_span<string_view> host_strings,
-                                          rmm::cuda_stream_view stream,
-                                          rmm::device_async_resource_ref mr)
-        {
-          std::vector<char> chars{};
-          std::vector<cudf::size_type> offsets(1, 0);
-          for (auto const& str : host_strings) {
-            auto tmp =
-              str.empty() ? std::string_view{} : std::string_view(str.data(), str.size_bytes());
-            chars.insert(chars.end(), std::cbegin(tmp), std::cend(tmp));
-            offsets.push_back(offsets.back() + tmp.length());
-          }
-          auto d_chars   = cudf::detail::make_device_uvector_async(chars, stream, mr);
-          auto d_offsets = cudf::detail::make_device_uvector_sync(offsets, stream, mr);
-          return std::tuple{std::move(d_chars), std::move(d_offsets)};
-        }
-
-        auto to_device(cudf::data_type dtype,
-                       rmm::cuda_stream_view stream,
-                       rmm::device_async_resource_ref mr)
-        {
-          if constexpr (std::is_same_v<T, string_view>) {
-            auto [d_chars, d_offsets] = make_strings_children(val, stream, mr);
-            return cudf::make_strings_column(
-              val.size(),
-              std::make_unique<column>(std::move(d_offsets), rmm::device_buffer{}, 0),
-              d_chars.release(),
-              null_count,
-              rmm::device_buffer{
-                null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr});
-          }
-          return std::make_unique<column>(
-            dtype,
-            val.size(),
-            cudf::detail::make_device_uvector_async(val, stream, mr).release(),
-            rmm::device_buffer{
-              null_mask.data(), cudf::bitmask_allocation_size_bytes(val.size()), stream, mr},
-            null_count);
-        }
-      };  // local struct host_column
-      host_column min(total_row_groups);
-      host_column max(total_row_groups);
+      host_column<T> min(total_row_groups);
+      host_column<T> max(total_row_groups);
       size_type stats_idx = 0;
       for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
         for (auto const rg_idx : row_group_indices[src_idx]) {
-          auto const& row_group = per_file_metadata[src_idx].row_groups[rg_idx];
+          auto const& row_group = per_file_metadata[src_idx]->row_groups[rg_idx];
           auto col              = std::find_if(
             row_group.columns.begin(),
             row_group.columns.end(),
@@ -242,151 +260,179 @@ struct stats_caster {
 };
 
 /**
- * @brief Converts AST expression to StatsAST for comparing with column statistics
- * This is used in row group filtering based on predicate.
- * statistics min value of a column is referenced by column_index*2
- * statistics max value of a column is referenced by column_index*2+1
+ * @brief Min and max statistics of a single column for a row fragment
  *
+ * A null pointer indicates the statistic is not available.
  */
-class stats_expression_converter : public ast::detail::expression_transformer {
- public:
-  stats_expression_converter(ast::expression const& expr, size_type const& num_columns)
-    : _num_columns{num_columns}
-  {
-    expr.accept(*this);
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
-  {
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
-
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
-  {
-    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
-                 "Statistics AST supports only left table");
-    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
-                 "Column index cannot be more than number of columns in the table");
-    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
-    return expr;
-  }
+struct fragment_stats {
+  std::vector<uint8_t> const* min_value;
+  std::vector<uint8_t> const* max_value;
+  Type type;
+};
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(
-    ast::column_name_reference const& expr) override
-  {
-    CUDF_FAIL("Column name reference is not supported in statistics AST");
-  }
+/**
+ * @brief Converts page-level statistics of row fragments to 2 device columns - min, max values.
+ *
+ */
+struct page_stats_caster {
+  host_span<fragment_stats const> fragments;
 
-  /**
-   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
-   */
-  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  // Creates device columns from page statistics (min, max)
+  template <typename T>
+  std::pair<std::unique_ptr<column>, std::unique_ptr<column>> operator()(
+    cudf::data_type dtype, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
   {
-    using cudf::ast::ast_operator;
-    auto const operands = expr.get_operands();
-    auto const op       = expr.get_operator();
-
-    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
-      // First operand should be column reference, second should be literal.
-      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
-                   "Only binary operations are supported on column reference");
-      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
-                   "Second operand of binary operation with column reference must be a literal");
-      v->accept(*this);
-      auto const col_index = v->get_column_index();
-      switch (op) {
-        /* transform to stats conditions. op(col, literal)
-        col1 == val --> vmin <= val && vmax >= val
-        col1 != val --> !(vmin == val && vmax == val)
-        col1 >  val --> vmax > val
-        col1 <  val --> vmin < val
-        col1 >= val --> vmax >= val
-        col1 <= val --> vmin <= val
-        */
-        case ast_operator::EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1 =
-            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
-          break;
-        }
-        case ast_operator::NOT_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
-          auto const& op2 =
-            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
-          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
-          break;
-        }
-        case ast_operator::LESS: [[fallthrough]];
-        case ast_operator::LESS_EQUAL: {
-          auto const& vmin = _col_ref.emplace_back(col_index * 2);
-          _operators.emplace_back(op, vmin, operands[1].get());
-          break;
-        }
-        case ast_operator::GREATER: [[fallthrough]];
-        case ast_operator::GREATER_EQUAL: {
-          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
-          _operators.emplace_back(op, vmax, operands[1].get());
-          break;
-        }
-        default: CUDF_FAIL("Unsupported operation in Statistics AST");
-      };
+    // List, Struct, Dictionary types are not supported
+    if constexpr (cudf::is_compound<T>() && !std::is_same_v<T, string_view>) {
+      CUDF_FAIL("Compound types do not have statistics");
     } else {
-      auto new_operands = visit_operands(operands);
-      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
-        _operators.emplace_back(op, new_operands.front(), new_operands.back());
-      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
-        _operators.emplace_back(op, new_operands.front());
+      auto const num_fragments = static_cast<size_type>(fragments.size());
+      stats_caster::host_column<T> min(num_fragments);
+      stats_caster::host_column<T> max(num_fragments);
+      for (size_type idx = 0; idx < num_fragments; ++idx) {
+        min.set_index(idx, fragments[idx].min_value, fragments[idx].type);
+        max.set_index(idx, fragments[idx].max_value, fragments[idx].type);
       }
+      return {min.to_device(dtype, stream, mr), max.to_device(dtype, stream, mr)};
+    }
+  }
+};
+
+/**
+ * @brief Encodes a literal with the PLAIN encoding of a Parquet physical type, as hashed by the
+ * Bloom filters
+ *
+ * @param literal Literal to encode
+ * @param column_type Datatype of the column the literal is compared with
+ * @param physical_type Parquet physical type of the column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The encoded bytes, or `std::nullopt` if the literal cannot be looked up in the filter,
+ * including float zeros and NaNs whose equal values have other bits
+ */
+std::optional<std::vector<uint8_t>> plain_encode_literal(ast::literal const& literal,
+                                                         data_type column_type,
+                                                         Type physical_type,
+                                                         rmm::cuda_stream_view stream)
+{
+  if (literal.get_data_type() != column_type) { return std::nullopt; }
+  auto const& scalar = literal.get_scalar();
+  if (not scalar.is_valid(stream)) { return std::nullopt; }
+
+  auto const to_bytes = [](auto const value) {
+    std::vector<uint8_t> bytes(sizeof(value));
+    std::memcpy(bytes.data(), &value, sizeof(value));
+    return bytes;
+  };
+  auto const numeric_value = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    return static_cast<cudf::numeric_scalar<T> const&>(scalar).value(stream);
+  };
+  auto const fixed_point_value = [&](auto type_tag) {
+    using T = decltype(type_tag);
+    return static_cast<cudf::fixed_point_scalar<T> const&>(scalar).value(stream);
+  };
+  // The filters hash the bits of floats, but 0.0 and -0.0 compare equal with different bits, and
+  // NaNs with different bits exist, so those literals are not looked up
+  auto const float_bytes = [&](auto type_tag) -> std::optional<std::vector<uint8_t>> {
+    auto const value = numeric_value(type_tag);
+    if (value == 0 or std::isnan(value)) { return std::nullopt; }
+    return to_bytes(value);
+  };
+
+  switch (column_type.id()) {
+    case type_id::INT8:
+      if (physical_type != INT32) { break; }
+      return to_bytes(static_cast<int32_t>(numeric_value(int8_t{})));
+    case type_id::INT16:
+      if (physical_type != INT32) { break; }
+      return to_bytes(static_cast<int32_t>(numeric_value(int16_t{})));
+    case type_id::INT32:
+      if (physical_type != INT32) { break; }
+      return to_bytes(numeric_value(int32_t{}));
+    case type_id::UINT8:
+      if (physical_type != INT32) { break; }
+      return to_bytes(static_cast<int32_t>(numeric_value(uint8_t{})));
+    case type_id::UINT16:
+      if (physical_type != INT32) { break; }
+      return to_bytes(static_cast<int32_t>(numeric_value(uint16_t{})));
+    case type_id::UINT32:
+      if (physical_type != INT32) { break; }
+      return to_bytes(static_cast<int32_t>(numeric_value(uint32_t{})));
+    case type_id::INT64:
+      if (physical_type != INT64) { break; }
+      return to_bytes(numeric_value(int64_t{}));
+    case type_id::UINT64:
+      if (physical_type != INT64) { break; }
+      return to_bytes(static_cast<int64_t>(numeric_value(uint64_t{})));
+    case type_id::FLOAT32:
+      if (physical_type != FLOAT) { break; }
+      return float_bytes(float{});
+    case type_id::FLOAT64:
+      if (physical_type != DOUBLE) { break; }
+      return float_bytes(double{});
+    case type_id::DECIMAL32:
+      if (physical_type != INT32) { break; }
+      return to_bytes(fixed_point_value(numeric::decimal32{}));
+    case type_id::DECIMAL64:
+      if (physical_type != INT64) { break; }
+      return to_bytes(fixed_point_value(numeric::decimal64{}));
+    case type_id::STRING: {
+      if (physical_type != BYTE_ARRAY) { break; }
+      auto const value = static_cast<cudf::string_scalar const&>(scalar).to_string(stream);
+      return std::vector<uint8_t>(value.begin(), value.end());
     }
-    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
-    return std::reference_wrapper<ast::expression const>(_operators.back());
+    default: break;
   }
+  return std::nullopt;
+}
 
-  /**
-   * @brief Returns the AST to apply on Column chunk statistics.
-   *
-   * @return AST operation expression
-   */
-  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
-  {
-    return _stats_expr.value().get();
+/**
+ * @brief Reads the bitset of the split block Bloom filter of a column chunk
+ *
+ * @param source Source of the column chunk
+ * @param col_meta Metadata of the column chunk
+ * @return The bitset, or an empty vector if the column chunk has no supported Bloom filter
+ */
+std::vector<uint8_t> read_bloom_filter_bitset(datasource& source,
+                                              ColumnChunkMetaData const& col_meta)
+{
+  if (not col_meta.bloom_filter_offset.has_value()) { return {}; }
+  auto const offset = col_meta.bloom_filter_offset.value();
+  if (offset <= 0 or static_cast<size_t>(offset) >= source.size()) { return {}; }
+
+  // The length is optional, so without it read enough bytes to hold the header and read the bitset
+  // separately if needed.
+  constexpr size_t header_size_estimate = 256;
+  auto const read_size = std::min(col_meta.bloom_filter_length.has_value()
+                                    ? static_cast<size_t>(col_meta.bloom_filter_length.value())
+                                    : header_size_estimate,
+                                  source.size() - offset);
+  auto const buffer    = source.host_read(offset, read_size);
+
+  CompactProtocolReader cp(buffer->data(), buffer->size());
+  BloomFilterHeader header;
+  cp.read(&header);
+  auto const header_size = static_cast<size_t>(cp.bytecount());
+  auto const num_bytes   = static_cast<size_t>(header.num_bytes);
+  if (header.algorithm.algorithm != BloomFilterAlgorithm::SPLIT_BLOCK or
+      header.hash.hash != BloomFilterHash::XXHASH or
+      header.compression.compression != BloomFilterCompression::UNCOMPRESSED or
+      header.num_bytes < bloom_filter_min_bytes or header.num_bytes > bloom_filter_max_bytes or
+      num_bytes % bloom_filter_block_bytes != 0 or
+      offset + header_size + num_bytes > source.size()) {
+    return {};
   }
 
- private:
-  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
-    std::vector<std::reference_wrapper<ast::expression const>> operands)
-  {
-    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
-    for (auto const& operand : operands) {
-      auto const new_operand = operand.get().accept(*this);
-      transformed_operands.push_back(new_operand);
-    }
-    return transformed_operands;
+  if (header_size + num_bytes <= buffer->size()) {
+    return {buffer->data() + header_size, buffer->data() + header_size + num_bytes};
   }
-  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
-  size_type _num_columns;
-  std::list<ast::column_reference> _col_ref;
-  std::list<ast::operation> _operators;
-};
+  auto const bitset = source.host_read(offset + header_size, num_bytes);
+  return {bitset->data(), bitset->data() + bitset->size()};
+}
 }  // namespace
 
 std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::filter_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   host_span<data_type const> output_dtypes,
   host_span<int const> output_column_schemas,
@@ -403,7 +449,7 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
                    per_file_metadata.cend(),
                    std::back_inserter(all_row_group_indices),
                    [](auto const& file_meta) {
-                     std::vector<size_type> rg_idx(file_meta.row_groups.size());
+                     std::vector<size_type> rg_idx(file_meta->row_groups.size());
                      std::iota(rg_idx.begin(), rg_idx.end(), 0);
                      return rg_idx;
                    });
@@ -418,6 +464,60 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
                                                   return sum + per_file_row_groups.size();
                                                 });
 
+  // Converts AST to StatsAST with reference to min, max columns in below `stats_table`, and to
+  // the Bloom filter results of the equality comparisons if the sources are available.
+  stats_expression_converter stats_expr{
+    filter.get(), static_cast<size_type>(output_dtypes.size()), not sources.empty()};
+
+  // Checks the literal of each equality comparison against the Bloom filters of the column
+  // chunks. The result is false only if the filter rules out the literal.
+  auto const& equality_terms = stats_expr.get_equality_terms();
+  std::vector<std::vector<uint8_t>> bloom_results(
+    equality_terms.size(), std::vector<uint8_t>(total_row_groups, uint8_t{1}));
+  if (not equality_terms.empty()) {
+    std::vector<std::optional<std::vector<uint8_t>>> encoded_literals;
+    std::transform(equality_terms.cbegin(),
+                   equality_terms.cend(),
+                   std::back_inserter(encoded_literals),
+                   [&](auto const& term) {
+                     auto const [col_idx, literal] = term;
+                     auto const& schema = get_schema(output_column_schemas[col_idx]);
+                     return plain_encode_literal(
+                       *literal, output_dtypes[col_idx], schema.type, stream);
+                   });
+    size_type rg_pos = 0;
+    for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+      for (auto const rg_idx : input_row_group_indices[src_idx]) {
+        auto const& row_group = per_file_metadata[src_idx]->row_groups[rg_idx];
+        // bitsets read for this row group, so each filter is read at most once
+        std::unordered_map<size_type, std::vector<uint8_t>> bitsets;
+        for (size_t term_idx = 0; term_idx < equality_terms.size(); ++term_idx) {
+          auto const& encoded = encoded_literals[term_idx];
+          if (not encoded.has_value()) { continue; }
+          auto const col_idx    = equality_terms[term_idx].first;
+          auto const schema_idx = output_column_schemas[col_idx];
+          auto col              = std::find_if(
+            row_group.columns.begin(),
+            row_group.columns.end(),
+            [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx; });
+          if (col == std::end(row_group.columns)) { continue; }
+          auto bitset = bitsets.find(col_idx);
+          if (bitset == bitsets.end()) {
+            bitset =
+              bitsets.emplace(col_idx, read_bloom_filter_bitset(*sources[src_idx], col->meta_data))
+                .first;
+          }
+          if (bitset->second.empty()) { continue; }
+          bloom_results[term_idx][rg_pos] =
+            bloom_filter_contains(bitset->second.data(),
+                                  bitset->second.size(),
+                                  bloom_filter_hash(encoded->data(), encoded->size()));
+        }
+        ++rg_pos;
+      }
+    }
+  }
+
   // Converts Column chunk statistics to a table
   // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
   // For each column, it contains #sources * #column_chunks_per_src rows.
@@ -440,10 +540,17 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
     columns.push_back(std::move(min_col));
     columns.push_back(std::move(max_col));
   }
+  // Bloom filter results follow the min, max columns
+  for (auto const& bloom_result : bloom_results) {
+    columns.push_back(std::make_unique<column>(
+      data_type{cudf::type_id::BOOL8},
+      total_row_groups,
+      cudf::detail::make_device_uvector_async(bloom_result, stream, mr).release(),
+      rmm::device_buffer{},
+      0));
+  }
   auto stats_table = cudf::table(std::move(columns));
 
-  // Converts AST to StatsAST with reference to min, max columns in above `stats_table`.
-  stats_expression_converter stats_expr{filter.get(), static_cast<size_type>(output_dtypes.size())};
   auto stats_ast     = stats_expr.get_stats_expr();
   auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
   auto predicate     = predicate_col->view();
@@ -487,6 +594,216 @@ std::optional<std::vector<std::vector<size_type>>> aggregate_reader_metadata::fi
   return {std::move(filtered_row_group_indices)};
 }
 
+std::optional<std::vector<std::pair<int64_t, int64_t>>>
+aggregate_reader_metadata::filter_pages(host_span<std::vector<size_type> const> row_group_indices,
+                                        host_span<data_type const> output_dtypes,
+                                        host_span<int const> output_column_schemas,
+                                        std::reference_wrapper<ast::expression const> filter,
+                                        rmm::cuda_stream_view stream) const
+{
+  auto mr = rmm::mr::get_current_device_resource();
+  // Create row group indices.
+  std::vector<std::vector<size_type>> all_row_group_indices;
+  host_span<std::vector<size_type> const> input_row_group_indices;
+  if (row_group_indices.empty()) {
+    std::transform(per_file_metadata.cbegin(),
+                   per_file_metadata.cend(),
+                   std::back_inserter(all_row_group_indices),
+                   [](auto const& file_meta) {
+                     std::vector<size_type> rg_idx(file_meta->row_groups.size());
+                     std::iota(rg_idx.begin(), rg_idx.end(), 0);
+                     return rg_idx;
+                   });
+    input_row_group_indices = host_span<std::vector<size_type> const>(all_row_group_indices);
+  } else {
+    input_row_group_indices = row_group_indices;
+  }
+
+  // Converts AST to StatsAST with reference to min, max columns in the fragment stats table.
+  stats_expression_converter stats_expr{filter.get(), static_cast<size_type>(output_dtypes.size())};
+  auto const referenced_columns = stats_expr.get_referenced_columns();
+  if (referenced_columns.empty()) { return std::nullopt; }
+
+  auto const find_column_chunk = [](RowGroup const& row_group,
+                                    int schema_idx) -> ColumnChunk const* {
+    auto col = std::find_if(
+      row_group.columns.begin(), row_group.columns.end(), [schema_idx](ColumnChunk const& col) {
+        return col.schema_idx == schema_idx;
+      });
+    return col != row_group.columns.end() ? &(*col) : nullptr;
+  };
+  // both indexes must be present and describe the same pages to be usable
+  auto const has_page_stats = [](ColumnChunk const* colchunk) {
+    if (colchunk == nullptr or not colchunk->column_index.has_value() or
+        not colchunk->offset_index.has_value()) {
+      return false;
+    }
+    auto const num_pages = colchunk->offset_index->page_locations.size();
+    return num_pages > 0 and colchunk->column_index->min_values.size() == num_pages and
+           colchunk->column_index->max_values.size() == num_pages and
+           colchunk->column_index->null_pages.size() == num_pages;
+  };
+
+  // Split each row group into row fragments at the page boundaries of all referenced columns.
+  // Within a fragment every referenced column has a single page, and therefore a single set of
+  // min/max values. Columns without page indexes fall back to the column chunk statistics.
+  std::vector<int64_t> fragment_start_rows;
+  std::vector<size_type> row_group_fragment_offsets{0};
+  std::vector<std::vector<fragment_stats>> column_stats(referenced_columns.size());
+  bool any_page_stats = false;
+  for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+    for (auto const rg_idx : input_row_group_indices[src_idx]) {
+      auto const& row_group = per_file_metadata[src_idx]->row_groups[rg_idx];
+
+      std::vector<int64_t> bounds{0};
+      for (auto const col_idx : referenced_columns) {
+        auto const colchunk = find_column_chunk(row_group, output_column_schemas[col_idx]);
+        if (not has_page_stats(colchunk)) { continue; }
+        any_page_stats = true;
+        for (auto const& page_loc : colchunk->offset_index->page_locations) {
+          if (page_loc.first_row_index > 0 and page_loc.first_row_index < row_group.num_rows) {
+            bounds.push_back(page_loc.first_row_index);
+          }
+        }
+      }
+      std::sort(bounds.begin(), bounds.end());
+      bounds.erase(std::unique(bounds.begin(), bounds.end()), bounds.end());
+
+      for (size_t ref_idx = 0; ref_idx < referenced_columns.size(); ++ref_idx) {
+        auto const colchunk =
+          find_column_chunk(row_group, output_column_schemas[referenced_columns[ref_idx]]);
+        auto& stats = column_stats[ref_idx];
+        if (colchunk == nullptr) {
+          // Marking it null, if column present in row group
+          stats.insert(stats.end(), bounds.size(), fragment_stats{nullptr, nullptr, {}});
+        } else if (has_page_stats(colchunk)) {
+          auto const& page_locations = colchunk->offset_index->page_locations;
+          auto const& column_index   = colchunk->column_index.value();
+          for (auto const start_row : bounds) {
+            // last page starting at or before the first row of the fragment
+            auto const page_it =
+              std::upper_bound(page_locations.begin(),
+                               page_locations.end(),
+                               start_row,
+                               [](int64_t row, PageLocation const& page_loc) {
+                                 return row < page_loc.first_row_index;
+                               });
+            auto const page_idx = std::distance(page_locations.begin(), page_it) - 1;
+            if (page_idx < 0 or column_index.null_pages[page_idx]) {
+              stats.push_back({nullptr, nullptr, {}});
+            } else {
+              stats.push_back({&column_index.min_values[page_idx],
+                               &column_index.max_values[page_idx],
+                               colchunk->meta_data.type});
+            }
+          }
+        } else {
+          // To support deprecated min, max fields.
+          auto const& chunk_stats = colchunk->meta_data.statistics;
+          auto const& min_value =
+            chunk_stats.min_value.has_value() ? chunk_stats.min_value : chunk_stats.min;
+          auto const& max_value =
+            chunk_stats.max_value.has_value() ? chunk_stats.max_value : chunk_stats.max;
+          stats.insert(stats.end(),
+                       bounds.size(),
+                       fragment_stats{min_value.has_value() ? &min_value.value() : nullptr,
+                                      max_value.has_value() ? &max_value.value() : nullptr,
+                                      colchunk->meta_data.type});
+        }
+      }
+      fragment_start_rows.insert(fragment_start_rows.end(), bounds.begin(), bounds.end());
+      row_group_fragment_offsets.push_back(fragment_start_rows.size());
+    }
+  }
+  if (not any_page_stats) { return std::nullopt; }
+  auto const num_fragments = static_cast<size_type>(fragment_start_rows.size());
+
+  // Converts page statistics of the fragments to a table
+  // where min(col[i]) = columns[i*2], max(col[i])=columns[i*2+1]
+  std::vector<std::unique_ptr<column>> columns;
+  for (size_t col_idx = 0; col_idx < output_dtypes.size(); col_idx++) {
+    auto const& dtype  = output_dtypes[col_idx];
+    auto const ref_pos = std::lower_bound(
+      referenced_columns.begin(), referenced_columns.end(), static_cast<size_type>(col_idx));
+    auto const is_referenced =
+      ref_pos != referenced_columns.end() and *ref_pos == static_cast<size_type>(col_idx);
+    // Only comparable types except fixed point are supported.
+    if (not is_referenced or (cudf::is_compound(dtype) && dtype.id() != cudf::type_id::STRING)) {
+      // placeholder only for unsupported types and columns not present in the filter.
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_fragments, rmm::device_buffer{}, 0, stream, mr));
+      columns.push_back(cudf::make_numeric_column(
+        data_type{cudf::type_id::BOOL8}, num_fragments, rmm::device_buffer{}, 0, stream, mr));
+      continue;
+    }
+    page_stats_caster stats_col{column_stats[std::distance(referenced_columns.begin(), ref_pos)]};
+    auto [min_col, max_col] =
+      cudf::type_dispatcher<dispatch_storage_type>(dtype, stats_col, dtype, stream, mr);
+    columns.push_back(std::move(min_col));
+    columns.push_back(std::move(max_col));
+  }
+  auto stats_table = cudf::table(std::move(columns));
+
+  auto stats_ast     = stats_expr.get_stats_expr();
+  auto predicate_col = cudf::detail::compute_column(stats_table, stats_ast.get(), stream, mr);
+  auto predicate     = predicate_col->view();
+  CUDF_EXPECTS(predicate.type().id() == cudf::type_id::BOOL8,
+               "Filter expression must return a boolean column");
+
+  auto num_bitmasks = num_bitmask_words(predicate.size());
+  std::vector<bitmask_type> host_bitmask(num_bitmasks, ~bitmask_type{0});
+  if (predicate.nullable()) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(host_bitmask.data(),
+                                  predicate.null_mask(),
+                                  num_bitmasks * sizeof(bitmask_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+  }
+  auto validity_it = cudf::detail::make_counting_transform_iterator(
+    0, [bitmask = host_bitmask.data()](auto bit_index) { return bit_is_set(bitmask, bit_index); });
+
+  auto is_fragment_required = cudf::detail::make_std_vector_sync(
+    device_span<uint8_t const>(predicate.data<uint8_t>(), predicate.size()), stream);
+
+  // Collect the possibly-matching fragments as ranges of rows across all sources
+  std::vector<std::pair<int64_t, int64_t>> filtered_row_ranges;
+  bool is_pruned           = false;
+  size_type rg_offset      = 0;
+  int64_t source_start_row = 0;
+  for (size_t src_idx = 0; src_idx < input_row_group_indices.size(); ++src_idx) {
+    auto const& row_groups = per_file_metadata[src_idx]->row_groups;
+    std::vector<int64_t> rg_start_rows{0};
+    for (auto const& row_group : row_groups) {
+      rg_start_rows.push_back(rg_start_rows.back() + row_group.num_rows);
+    }
+    for (auto const rg_idx : input_row_group_indices[src_idx]) {
+      auto const rg_start_row = source_start_row + rg_start_rows[rg_idx];
+      auto const num_rows     = row_groups[rg_idx].num_rows;
+      auto const frag_begin   = row_group_fragment_offsets[rg_offset];
+      auto const frag_end     = row_group_fragment_offsets[rg_offset + 1];
+      for (auto frag_idx = frag_begin; frag_idx < frag_end; ++frag_idx) {
+        if (validity_it[frag_idx] and not is_fragment_required[frag_idx]) {
+          is_pruned = true;
+          continue;
+        }
+        auto const start_row = rg_start_row + fragment_start_rows[frag_idx];
+        auto const end_row =
+          rg_start_row + (frag_idx + 1 < frag_end ? fragment_start_rows[frag_idx + 1] : num_rows);
+        if (start_row == end_row) { continue; }
+        if (not filtered_row_ranges.empty() and filtered_row_ranges.back().second == start_row) {
+          filtered_row_ranges.back().second = end_row;
+        } else {
+          filtered_row_ranges.emplace_back(start_row, end_row);
+        }
+      }
+      ++rg_offset;
+    }
+    source_start_row += rg_start_rows.back();
+  }
+  if (not is_pruned) { return std::nullopt; }
+  return {std::move(filtered_row_ranges)};
+}
+
 // convert column named expression to column index reference expression
 named_to_reference_converter::named_to_reference_converter(
   std::optional<std::reference_wrapper<ast::expression const>> expr, table_metadata const& metadata)
@@ -583,6 +900,8 @@ class names_from_expression : public ast::detail::expression_transformer {
    */
   std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
   {
+    // collect column indices
+    _column_indices.insert(expr.get_column_index());
     return expr;
   }
   /**
@@ -616,6 +935,16 @@ class names_from_expression : public ast::detail::expression_transformer {
             std::make_move_iterator(_column_names.end())};
   }
 
+  /**
+   * @brief Returns the column indices in AST, in increasing order.
+   *
+   * @return Indices of the columns referenced by index
+   */
+  [[nodiscard]] std::vector<size_type> column_indices() const
+  {
+    return {_column_indices.cbegin(), _column_indices.cend()};
+  }
+
  private:
   void visit_operands(std::vector<std::reference_wrapper<ast::expression const>> operands)
   {
@@ -626,6 +955,7 @@ class names_from_expression : public ast::detail::expression_transformer {
 
   std::unordered_set<std::string> _column_names;
   std::unordered_set<std::string> _skip_names;
+  std::set<size_type> _column_indices;
 };
 
 [[nodiscard]] std::vector<std::string> get_column_names_in_expression(
@@ -635,4 +965,10 @@ class names_from_expression : public ast::detail::expression_transformer {
   return names_from_expression(expr, skip_names).to_vector();
 }
 
+[[nodiscard]] std::vector<size_type> get_column_indices_in_expression(
+  std::optional<std::reference_wrapper<ast::expression const>> expr)
+{
+  return names_from_expression(expr, {}).column_indices();
+}
+
 }  // namespace cudf::io::parquet::detail
@@ -16,8 +16,12 @@
 
 #include "reader_impl.hpp"
 
+#include <cudf/utilities/error.hpp>
+
 #include <rmm/resource_ref.hpp>
 
+#include <stdexcept>
+
 namespace cudf::io::parquet::detail {
 
 reader::reader() = default;
@@ -41,6 +45,9 @@ chunked_reader::chunked_reader(std::size_t chunk_read_limit,
                                rmm::cuda_stream_view stream,
                                rmm::device_async_resource_ref mr)
 {
+  CUDF_EXPECTS(not options.is_enabled_late_materialization(),
+               "Late materialization is not supported by the chunked reader",
+               std::invalid_argument);
   _impl = std::make_unique<impl>(
     chunk_read_limit, pass_read_limit, std::move(sources), options, stream, mr);
 }
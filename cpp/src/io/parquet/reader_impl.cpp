@@ -18,16 +18,21 @@
 
 #include "error.hpp"
 
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
 
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
 #include <bitset>
 #include <numeric>
 
@@ -48,6 +53,9 @@ inline bool is_treat_fixed_length_as_string(thrust::optional<LogicalType> const&
 
 void reader::impl::decode_page_data(read_mode mode, size_t skip_rows, size_t num_rows)
 {
+  cudf::io::detail::scoped_phase_timer const timer{_statistics.get(),
+                                                   &reader_statistics::decode_time};
+
   auto& pass    = *_pass_itm_data;
   auto& subpass = *pass.subpass;
 
@@ -308,6 +316,28 @@ void reader::impl::decode_page_data(read_mode mode, size_t skip_rows, size_t num
                             streams[s_idx++]);
   }
 
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_NO_DICT_LIST) != 0) {
+    DecodePageDataFixedList(subpass.pages,
+                            pass.chunks,
+                            num_rows,
+                            skip_rows,
+                            level_type_size,
+                            false,
+                            error_code.data(),
+                            streams[s_idx++]);
+  }
+
+  if (BitAnd(kernel_mask, decode_kernel_mask::FIXED_WIDTH_DICT_LIST) != 0) {
+    DecodePageDataFixedList(subpass.pages,
+                            pass.chunks,
+                            num_rows,
+                            skip_rows,
+                            level_type_size,
+                            true,
+                            error_code.data(),
+                            streams[s_idx++]);
+  }
+
   // launch the catch-all page decoder
   if (BitAnd(kernel_mask, decode_kernel_mask::GENERAL) != 0) {
     DecodePageData(subpass.pages,
@@ -409,6 +439,9 @@ reader::impl::impl(std::vector<std::unique_ptr<datasource>>&& sources,
          stream,
          mr)
 {
+  if (options.is_enabled_late_materialization() and options.get_filter().has_value()) {
+    _late_materialization_options = options;
+  }
 }
 
 reader::impl::impl(std::size_t chunk_read_limit,
@@ -422,18 +455,70 @@ reader::impl::impl(std::size_t chunk_read_limit,
     _options{options.get_timestamp_type(),
              options.get_skip_rows(),
              options.get_num_rows(),
-             options.get_row_groups()},
+             options.get_row_groups(),
+             options.get_row_ranges()},
+    _statistics{options.get_statistics()},
     _sources{std::move(sources)},
     _output_chunk_read_limit{chunk_read_limit},
     _input_pass_read_limit{pass_read_limit}
 {
-  // Open and parse the source dataset metadata
-  _metadata =
-    std::make_unique<aggregate_reader_metadata>(_sources, options.is_enabled_use_arrow_schema());
+  cudf::io::detail::scoped_phase_timer const timer{_statistics.get(),
+                                                   &reader_statistics::metadata_time};
+
+  // Prefetching only applies when the input is read in more than one pass
+  _prefetch_next_pass = options.is_enabled_prefetch_next_pass() and pass_read_limit != 0;
+
+  // When a subset of columns is selected, only the column chunk metadata of the selected and
+  // filter columns is decoded, which dominates the footer parse time of very wide files. Every
+  // prefix of a selected path is a candidate top-level field, as field names may contain dots.
+  std::vector<std::string> selected_fields;
+  if (options.get_columns().has_value()) {
+    for (auto const& path : options.get_columns().value()) {
+      for (auto pos = path.find('.'); pos != std::string::npos; pos = path.find('.', pos + 1)) {
+        selected_fields.push_back(path.substr(0, pos));
+      }
+      selected_fields.push_back(path);
+    }
+    auto const filter_names = get_column_names_in_expression(options.get_filter(), {});
+    selected_fields.insert(selected_fields.end(), filter_names.begin(), filter_names.end());
+  }
+
+  // Open and parse the source dataset metadata. The page indexes are needed for page-level
+  // predicate pushdown when a filter is present, and to skip the leading pages of the first row
+  // group when rows are skipped or row ranges are selected. The paths of file sources are used to
+  // look up previously parsed footers in the footer cache.
+  auto const parse_metadata = [&] {
+    return std::make_unique<aggregate_reader_metadata>(_sources,
+                                                       options.is_enabled_use_arrow_schema(),
+                                                       options.get_filter().has_value() or
+                                                         options.get_skip_rows() > 0 or
+                                                         not options.get_row_ranges().empty(),
+                                                       options.get_source().filepaths(),
+                                                       selected_fields);
+  };
+  _metadata = parse_metadata();
+
+  // The pandas index columns are read even if not selected, so parse the footers again if the
+  // metadata of any of them was skipped
+  if (options.is_enabled_use_pandas_metadata() and not selected_fields.empty()) {
+    auto const index_names = _metadata->get_pandas_index_names();
+    auto const is_skipped  = [&](auto const& name) {
+      return std::find(selected_fields.begin(), selected_fields.end(), name) ==
+             selected_fields.end();
+    };
+    if (std::any_of(index_names.begin(), index_names.end(), is_skipped)) {
+      selected_fields.insert(selected_fields.end(), index_names.begin(), index_names.end());
+      _metadata = parse_metadata();
+    }
+  }
 
   // Strings may be returned as either string or categorical columns
   _strings_to_categorical = options.is_enabled_convert_strings_to_categories();
 
+  // Top-level string columns may be read as dictionary columns instead
+  _strings_to_dictionary =
+    options.is_enabled_convert_strings_to_dictionaries() and not _strings_to_categorical;
+
   // Binary columns can be read as binary or strings
   _reader_column_schema = options.get_column_schema();
 
@@ -451,6 +536,7 @@ reader::impl::impl(std::size_t chunk_read_limit,
                               filter_columns_names,
                               options.is_enabled_use_pandas_metadata(),
                               _strings_to_categorical,
+                              _strings_to_dictionary,
                               _options.timestamp_type.id());
 
   // Save the states of the output buffers for reuse in `chunk_read()`.
@@ -542,12 +628,57 @@ table_with_metadata reader::impl::read_chunk_internal(read_mode mode)
     } else {
       out_columns.emplace_back(make_column(_output_buffers[i], nullptr, metadata, _stream));
     }
+    // Columns read as dictionary columns were decoded as positions in the string dictionaries
+    if (is_dictionary_output(schema, _strings_to_dictionary)) {
+      auto const input_col = std::find_if(
+        _input_columns.begin(), _input_columns.end(), [&](input_column_info const& col) {
+          return col.schema_idx == _output_column_schemas[i];
+        });
+      out_columns.back() = make_dictionary_output(out_columns.back()->view(),
+                                                  std::distance(_input_columns.begin(), input_col));
+    }
+  }
+
+  // Drop the rows decoded between the requested row ranges
+  if (not _file_itm_data.row_ranges.empty()) {
+    out_columns =
+      select_row_ranges(std::move(out_columns), read_info.skip_rows, read_info.num_rows);
   }
 
   // Add empty columns if needed. Filter output columns based on filter.
   return finalize_output(out_metadata, out_columns);
 }
 
+std::vector<std::unique_ptr<column>> reader::impl::select_row_ranges(
+  std::vector<std::unique_ptr<column>>&& columns, size_t skip_rows, size_t num_rows)
+{
+  auto const chunk_start = static_cast<int64_t>(skip_rows);
+  auto const chunk_end   = chunk_start + static_cast<int64_t>(num_rows);
+  auto const& ranges     = _file_itm_data.row_ranges;
+
+  // slice boundaries of the ranges overlapping the chunk, relative to the chunk
+  std::vector<size_type> indices;
+  for (auto it = std::upper_bound(
+         ranges.cbegin(),
+         ranges.cend(),
+         chunk_start,
+         [](int64_t row, std::pair<int64_t, int64_t> const& range) { return row < range.second; });
+       it != ranges.cend() and it->first < chunk_end;
+       ++it) {
+    indices.push_back(static_cast<size_type>(std::max(it->first, chunk_start) - chunk_start));
+    indices.push_back(static_cast<size_type>(std::min(it->second, chunk_end) - chunk_start));
+  }
+  if (indices.size() == 2 and indices.front() == 0 and
+      indices.back() == static_cast<size_type>(num_rows)) {
+    return std::move(columns);
+  }
+  if (indices.empty()) { indices = {0, 0}; }
+
+  auto const decoded = table{std::move(columns)};
+  auto const slices  = cudf::detail::slice(decoded.view(), indices, _stream);
+  return cudf::detail::concatenate(slices, _stream, _mr)->release();
+}
+
 table_with_metadata reader::impl::finalize_output(table_metadata& out_metadata,
                                                   std::vector<std::unique_ptr<column>>& out_columns)
 {
@@ -559,6 +690,13 @@ table_with_metadata reader::impl::finalize_output(table_metadata& out_metadata,
     } else {
       out_columns.emplace_back(io::detail::empty_like(_output_buffers[i], nullptr, _stream, _mr));
     }
+    if (is_dictionary_output(_metadata->get_schema(_output_column_schemas[i]),
+                             _strings_to_dictionary)) {
+      out_columns.back() = cudf::make_dictionary_column(make_empty_column(type_id::STRING),
+                                                        make_empty_column(type_id::UINT32),
+                                                        rmm::device_buffer{},
+                                                        0);
+    }
   }
 
   if (!_output_metadata) {
@@ -602,8 +740,287 @@ table_with_metadata reader::impl::read()
   CUDF_EXPECTS(_output_chunk_read_limit == 0,
                "Reading the whole file must not have non-zero byte_limit.");
 
+  if (_late_materialization_options.has_value()) { return read_late_materialized(); }
+
+  prepare_data(read_mode::READ_ALL);
+  return read_all_subpasses();
+}
+
+table_with_metadata reader::impl::read_all_subpasses()
+{
+  auto result = read_chunk_internal(read_mode::READ_ALL);
   prepare_data(read_mode::READ_ALL);
-  return read_chunk_internal(read_mode::READ_ALL);
+  if (not has_more_work()) { return result; }
+
+  std::vector<std::unique_ptr<table>> tables;
+  tables.push_back(std::move(result.tbl));
+  while (has_more_work()) {
+    _output_buffers.resize(0);
+    for (auto const& buff : _output_buffers_template) {
+      _output_buffers.emplace_back(cudf::io::detail::inline_column_buffer::empty_like(buff));
+    }
+    tables.push_back(std::move(read_chunk_internal(read_mode::READ_ALL).tbl));
+    prepare_data(read_mode::READ_ALL);
+  }
+
+  std::vector<table_view> views;
+  std::transform(tables.cbegin(), tables.cend(), std::back_inserter(views), [](auto const& tbl) {
+    return tbl->view();
+  });
+  result.tbl = cudf::detail::concatenate(views, _stream, _mr);
+  return result;
+}
+
+namespace {
+
+/**
+ * @brief Translates runs of decoded rows to the rows they were decoded from.
+ *
+ * @param runs Sorted, disjoint [start, end) ranges of decoded rows
+ * @param row_ranges Sorted, disjoint [start, end) ranges of the rows decoded back to back
+ * @return The rows of the runs, as [start, end) ranges in the row space of `row_ranges`
+ */
+std::vector<std::pair<int64_t, int64_t>> map_decoded_rows(
+  host_span<std::pair<int64_t, int64_t> const> runs,
+  host_span<std::pair<int64_t, int64_t> const> row_ranges)
+{
+  std::vector<std::pair<int64_t, int64_t>> mapped;
+  auto range_it         = row_ranges.begin();
+  int64_t range_decoded = 0;  // decoded row of the start of `range_it`
+  for (auto const& run : runs) {
+    auto start = run.first;
+    while (start < run.second) {
+      auto const range_size = range_it->second - range_it->first;
+      if (start >= range_decoded + range_size) {
+        range_decoded += range_size;
+        ++range_it;
+        continue;
+      }
+      auto const end = std::min(run.second, range_decoded + range_size);
+      mapped.emplace_back(range_it->first + start - range_decoded,
+                          range_it->first + end - range_decoded);
+      start = end;
+    }
+  }
+  return mapped;
+}
+
+}  // namespace
+
+table_with_metadata reader::impl::read_late_materialized()
+{
+  auto const& options = _late_materialization_options.value();
+
+  // Run the predicate pushdown to find the rows that may match the filter
+  preprocess_file(read_mode::READ_ALL);
+  auto const selected_ranges =
+    _file_itm_data.row_ranges.empty()
+      ? std::vector<std::pair<int64_t, int64_t>>{{_file_itm_data.global_skip_rows,
+                                                  _file_itm_data.global_skip_rows +
+                                                    _file_itm_data.global_num_rows}}
+      : _file_itm_data.row_ranges;
+  auto const candidate_ranges =
+    _metadata->to_global_row_ranges(_file_itm_data.row_groups, selected_ranges);
+
+  // Output columns referenced by the filter. The filter-only columns are the last ones.
+  auto const filter_indices     = get_column_indices_in_expression(_expr_conv.get_converted_expr());
+  auto const num_output_columns = _output_buffers.size() - _num_filter_only_columns;
+  auto const is_filter_column   = [&](size_t idx) {
+    return std::binary_search(
+      filter_indices.cbegin(), filter_indices.cend(), static_cast<size_type>(idx));
+  };
+  table_metadata metadata;
+  populate_metadata(metadata);
+
+  // The remaining columns are read by name, with the requested paths to keep nested selections
+  std::vector<std::string> remaining_columns;
+  if (options.get_columns().has_value()) {
+    std::copy_if(options.get_columns()->cbegin(),
+                 options.get_columns()->cend(),
+                 std::back_inserter(remaining_columns),
+                 [&](auto const& path) {
+                   return std::none_of(
+                     filter_indices.cbegin(), filter_indices.cend(), [&](auto idx) {
+                       return metadata.schema_info[idx].name == path;
+                     });
+                 });
+  } else {
+    for (size_t i = 0; i < num_output_columns; ++i) {
+      if (not is_filter_column(i)) { remaining_columns.push_back(metadata.schema_info[i].name); }
+    }
+  }
+
+  // Fall back to a regular read when there is nothing to defer, or when the selected row groups
+  // are out of file order and can not be read as row ranges
+  if (filter_indices.empty() or remaining_columns.empty() or not candidate_ranges.has_value() or
+      candidate_ranges->empty()) {
+    prepare_data(read_mode::READ_ALL);
+    return read_all_subpasses();
+  }
+
+  // The column schemas are given by output column, so they are split between the two reads
+  auto const column_schema = options.get_column_schema();
+  auto const split_schema  = [&](bool for_filter) {
+    std::optional<std::vector<reader_column_schema>> schema;
+    if (not column_schema.has_value()) { return schema; }
+    schema.emplace();
+    for (size_t i = 0; i < _output_buffers.size(); ++i) {
+      if (is_filter_column(i) == for_filter and (for_filter or i < num_output_columns)) {
+        schema->push_back(i < column_schema->size() ? (*column_schema)[i] : reader_column_schema{});
+      }
+    }
+    return schema;
+  };
+  auto const phase_options = [&](std::vector<std::string> columns,
+                                 std::vector<std::pair<int64_t, int64_t>> row_ranges,
+                                 bool for_filter,
+                                 std::shared_ptr<reader_statistics> statistics) {
+    // The pandas index columns added to the requested columns are read with the remaining
+    // columns. Without requested columns, all of the columns are listed already.
+    auto const use_pandas_metadata = not for_filter and options.get_columns().has_value() and
+                                     options.is_enabled_use_pandas_metadata();
+    auto builder =
+      parquet_reader_options::builder(options.get_source())
+        .columns(std::move(columns))
+        .row_ranges(std::move(row_ranges))
+        .convert_strings_to_categories(options.is_enabled_convert_strings_to_categories())
+        .convert_strings_to_dictionaries(options.is_enabled_convert_strings_to_dictionaries())
+        .use_pandas_metadata(use_pandas_metadata)
+        .use_arrow_schema(options.is_enabled_use_arrow_schema())
+        .timestamp_type(options.get_timestamp_type())
+        .statistics(std::move(statistics));
+    auto schema = split_schema(for_filter);
+    if (schema.has_value()) { builder.set_column_schema(std::move(schema).value()); }
+    return parquet_reader_options{builder.build()};
+  };
+  auto const phase_sources = [&] {
+    std::vector<std::unique_ptr<datasource>> sources;
+    std::transform(_sources.cbegin(),
+                   _sources.cend(),
+                   std::back_inserter(sources),
+                   [](auto const& source) { return datasource::create(source.get()); });
+    return sources;
+  };
+  // The row groups are counted by the predicate pushdown above only
+  auto const phase_statistics = [&] {
+    return _statistics != nullptr ? std::make_shared<reader_statistics>()
+                                  : std::shared_ptr<reader_statistics>{};
+  };
+  auto const add_statistics = [&](std::shared_ptr<reader_statistics> const& statistics) {
+    if (statistics == nullptr) { return; }
+    statistics->num_row_groups_total  = 0;
+    statistics->num_row_groups_pruned = 0;
+    *_statistics += *statistics;
+  };
+  auto const find_column = [&](impl const& reader, size_t idx) {
+    auto const& schemas = reader._output_column_schemas;
+    auto const it       = std::find(schemas.cbegin(), schemas.cend(), _output_column_schemas[idx]);
+    CUDF_EXPECTS(it != schemas.cend(), "Column missing from a late materialization read");
+    return static_cast<size_t>(std::distance(schemas.cbegin(), it));
+  };
+
+  // Read the filter columns for the rows that may match, and evaluate the filter over them. The
+  // filter references the output columns of this reader, so the filter columns are laid out at
+  // their positions and any of them stands in for the other columns.
+  std::vector<std::string> filter_columns;
+  std::transform(filter_indices.cbegin(),
+                 filter_indices.cend(),
+                 std::back_inserter(filter_columns),
+                 [&](auto idx) { return metadata.schema_info[idx].name; });
+  auto const filter_statistics = phase_statistics();
+  impl filter_reader(
+    phase_sources(),
+    phase_options(std::move(filter_columns), candidate_ranges.value(), true, filter_statistics),
+    _stream,
+    _mr);
+  auto filter_result = filter_reader.read();
+  add_statistics(filter_statistics);
+  CUDF_EXPECTS(filter_result.tbl->num_rows() ==
+                 std::accumulate(candidate_ranges->cbegin(),
+                                 candidate_ranges->cend(),
+                                 int64_t{0},
+                                 [](auto rows, auto const& range) {
+                                   return rows + range.second - range.first;
+                                 }),
+               "Unexpected number of rows read from the filter columns");
+
+  std::vector<column_view> filter_table_columns(_output_buffers.size(),
+                                                filter_result.tbl->get_column(0).view());
+  for (auto const idx : filter_indices) {
+    filter_table_columns[idx] = filter_result.tbl->get_column(find_column(filter_reader, idx));
+  }
+  auto const predicate = cudf::detail::compute_column(table_view{filter_table_columns},
+                                                      _expr_conv.get_converted_expr().value().get(),
+                                                      _stream,
+                                                      rmm::mr::get_current_device_resource());
+  CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+               "Predicate filter should return a boolean");
+
+  // Read the remaining columns for the runs of matching rows only, so that their pages without
+  // matching rows are skipped. Every row range is read in a subpass of its own, so runs separated
+  // by fewer rows than a page holds by default are read together, and the rows between them are
+  // dropped with the predicate afterwards.
+  auto const matching_runs = find_true_runs(predicate->view(), _stream);
+  std::vector<std::pair<int64_t, int64_t>> read_runs;
+  for (auto const& run : matching_runs) {
+    if (not read_runs.empty() and
+        run.first - read_runs.back().second < default_max_page_size_rows) {
+      read_runs.back().second = run.second;
+    } else {
+      read_runs.push_back(run);
+    }
+  }
+  // An empty range reads no rows
+  auto read_ranges = map_decoded_rows(read_runs, candidate_ranges.value());
+  if (read_ranges.empty()) { read_ranges.emplace_back(0, 0); }
+
+  auto const remaining_statistics = phase_statistics();
+  impl remaining_reader(
+    phase_sources(),
+    phase_options(remaining_columns, std::move(read_ranges), false, remaining_statistics),
+    _stream,
+    _mr);
+  auto remaining_result = remaining_reader.read();
+  add_statistics(remaining_statistics);
+
+  if (read_runs.size() != matching_runs.size()) {
+    std::vector<size_type> slice_indices;
+    for (auto const& run : read_runs) {
+      slice_indices.push_back(static_cast<size_type>(run.first));
+      slice_indices.push_back(static_cast<size_type>(run.second));
+    }
+    auto const read_predicate =
+      cudf::detail::concatenate(cudf::detail::slice(predicate->view(), slice_indices, _stream),
+                                _stream,
+                                rmm::mr::get_current_device_resource());
+    remaining_result.tbl = cudf::detail::apply_boolean_mask(
+      remaining_result.tbl->view(), read_predicate->view(), _stream, _mr);
+  }
+
+  auto const filter_table =
+    cudf::detail::apply_boolean_mask(filter_result.tbl->view(), *predicate, _stream, _mr);
+  CUDF_EXPECTS(filter_table->num_rows() == remaining_result.tbl->num_rows(),
+               "Unexpected number of rows read from the remaining columns");
+  auto filter_output    = filter_table->release();
+  auto remaining_output = remaining_result.tbl->release();
+
+  // Assemble the output columns in the order of a regular read
+  std::vector<std::unique_ptr<column>> out_columns;
+  auto& out_metadata = remaining_result.metadata;
+  std::vector<column_name_info> schema_info;
+  for (size_t i = 0; i < num_output_columns; ++i) {
+    if (is_filter_column(i)) {
+      auto const idx = find_column(filter_reader, i);
+      out_columns.push_back(std::move(filter_output[idx]));
+      schema_info.push_back(filter_result.metadata.schema_info[idx]);
+    } else {
+      auto const idx = find_column(remaining_reader, i);
+      out_columns.push_back(std::move(remaining_output[idx]));
+      schema_info.push_back(out_metadata.schema_info[idx]);
+    }
+  }
+  out_metadata.schema_info = std::move(schema_info);
+  return {std::make_unique<table>(std::move(out_columns)), std::move(out_metadata)};
 }
 
 table_with_metadata reader::impl::read_chunk()
@@ -25,6 +25,8 @@
 #include "reader_impl_chunking.hpp"
 #include "reader_impl_helpers.hpp"
 
+#include "io/utilities/reader_statistics.hpp"
+
 #include <cudf/io/datasource.hpp>
 #include <cudf/io/detail/parquet.hpp>
 #include <cudf/io/parquet.hpp>
@@ -172,6 +174,23 @@ class reader::impl {
    */
   void setup_next_subpass(read_mode mode);
 
+  /**
+   * @brief Advances the current pass to the first selected row at or after its next row.
+   *
+   * When reading row ranges, subpasses start at the selected rows so that pages holding only rows
+   * between the ranges are neither decompressed nor decoded. Does nothing unless the pass skips
+   * rows between the ranges.
+   */
+  void skip_unselected_rows();
+
+  /**
+   * @brief Returns the end of the selected rows starting at the next row of the current pass.
+   *
+   * @return The end of the row range holding the next row, or the end of the pass if the pass does
+   * not skip rows between the ranges
+   */
+  [[nodiscard]] size_t selected_rows_end() const;
+
   /**
    * @brief Read a chunk of data and return an output table.
    *
@@ -182,23 +201,63 @@ class reader::impl {
    */
   table_with_metadata read_chunk_internal(read_mode mode);
 
+  /**
+   * @brief Read all remaining subpasses at once and return an output table.
+   *
+   * Reading all data at once takes more than one subpass when the rows between row ranges are
+   * skipped. Expects all preprocessing steps have already been done.
+   *
+   * @return The output table along with columns' metadata
+   */
+  table_with_metadata read_all_subpasses();
+
+  /**
+   * @brief Read the filter columns first, then the remaining columns only for the matching rows.
+   *
+   * The filter columns are read for the rows left after the predicate pushdown and the filter is
+   * evaluated over them. The runs of matching rows are then read from the remaining columns as
+   * row ranges, so that their pages without matching rows are skipped, and the filter columns
+   * are compacted to the same rows. Falls back to a regular read when the remaining columns can
+   * not be read separately. Expects no preprocessing step has been done.
+   *
+   * @return The output table along with columns' metadata
+   */
+  table_with_metadata read_late_materialized();
+
   // utility functions
  private:
   /**
-   * @brief Read the set of column chunks to be processed for this pass.
+   * @brief Read the set of column chunks of the given row groups.
    *
    * Does not decompress the chunk data.
    *
+   * @param row_groups_info Row groups to read the chunks of
+   * @param chunks Column chunk descriptors of the row groups, updated to point to the read data
+   * @param raw_page_data Buffers holding the read data
+   * @param stream CUDA stream used for the copies to device memory
    * @return pair of boolean indicating if compressed chunks were found and a vector of futures for
    * read completion
    */
-  std::pair<bool, std::vector<std::future<void>>> read_column_chunks();
+  std::pair<bool, std::vector<std::future<void>>> read_column_chunks(
+    host_span<row_group_info const> row_groups_info,
+    cudf::detail::hostdevice_vector<ColumnChunkDesc>& chunks,
+    std::vector<std::unique_ptr<datasource::buffer>>& raw_page_data,
+    rmm::cuda_stream_view stream);
 
   /**
    * @brief Read compressed data and page information for the current pass.
+   *
+   * Uses the prefetched chunk data if the current pass has been prefetched.
    */
   void read_compressed_data();
 
+  /**
+   * @brief Start reading the column chunks of the next pass in the background, if enabled.
+   *
+   * The prefetched data is counted in the base memory size of the current pass.
+   */
+  void prefetch_next_pass();
+
   /**
    * @brief Build string dictionary indices for a pass.
    *
@@ -258,6 +317,31 @@ class reader::impl {
    */
   void populate_metadata(table_metadata& out_metadata);
 
+  /**
+   * @brief Build a dictionary column from the rows of a column read as a dictionary column.
+   *
+   * The rows hold the positions of their strings in the string dictionary index of the current
+   * pass. The keys are built from the dictionary entries of the column's chunks only, so the
+   * characters of each row are never materialized.
+   *
+   * @param positions Decoded positions in the string dictionary index of the pass
+   * @param input_col_index Index of the input column
+   * @return The dictionary column
+   */
+  std::unique_ptr<column> make_dictionary_output(column_view const& positions,
+                                                 size_t input_col_index);
+
+  /**
+   * @brief Keep only the rows of an output chunk that fall within the requested row ranges.
+   *
+   * @param columns The decoded columns of the output chunk
+   * @param skip_rows The first row of the output chunk
+   * @param num_rows The number of rows in the output chunk
+   * @return The columns with the rows between the requested row ranges removed
+   */
+  std::vector<std::unique_ptr<column>> select_row_ranges(
+    std::vector<std::unique_ptr<column>>&& columns, size_t skip_rows, size_t num_rows);
+
   /**
    * @brief Finalize the output table by adding empty columns for the non-selected columns in
    * schema.
@@ -332,7 +416,8 @@ class reader::impl {
     // TODO: `read_mode` is hardcoded to `true` when `read_mode::CHUNKED_READ` to enforce
     // `ComputePageSizes()` computation for all remaining chunks.
     return (mode == read_mode::READ_ALL)
-             ? (_options.num_rows.has_value() or _options.skip_rows != 0)
+             ? (_options.num_rows.has_value() or _options.skip_rows != 0 or
+                not _options.row_ranges.empty() or not _file_itm_data.row_ranges.empty())
              : true;
   }
 
@@ -352,8 +437,16 @@ class reader::impl {
     int64_t const skip_rows;
     std::optional<int64_t> num_rows;
     std::vector<std::vector<size_type>> row_group_indices;
+    std::vector<std::pair<int64_t, int64_t>> row_ranges;
   } const _options;
 
+  // statistics of the read, if requested
+  std::shared_ptr<reader_statistics> const _statistics;
+
+  // options to read the filter and the remaining columns separately, if late materialization is
+  // enabled
+  std::optional<parquet_reader_options> _late_materialization_options;
+
   // name to reference converter to extract AST output filter
   named_to_reference_converter _expr_conv{std::nullopt, table_metadata{}};
 
@@ -379,6 +472,7 @@ class reader::impl {
   std::size_t _num_filter_only_columns{0};
 
   bool _strings_to_categorical = false;
+  bool _strings_to_dictionary  = false;
 
   // are there usable page indexes available
   bool _has_page_index = false;
@@ -399,6 +493,11 @@ class reader::impl {
 
   std::unique_ptr<pass_intermediate_data> _pass_itm_data;
 
+  // whether to read the next pass while decoding the current one, and its data if in flight.
+  // declared after the sources and metadata, which are used by the prefetch thread.
+  bool _prefetch_next_pass{false};
+  std::unique_ptr<prefetch_pass_data> _prefetched_pass;
+
   std::size_t _output_chunk_read_limit{0};  // output chunk size limit in bytes
   std::size_t _input_pass_read_limit{0};    // input pass memory usage limit in bytes
 };
@@ -24,7 +24,9 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/exec_policy.hpp>
 
@@ -37,6 +39,9 @@
 #include <thrust/transform_scan.h>
 #include <thrust/unique.h>
 
+#include <algorithm>
+#include <future>
+#include <limits>
 #include <numeric>
 
 namespace cudf::io::parquet::detail {
@@ -326,6 +331,19 @@ size_t find_start_index(cudf::host_span<cumulative_page_info const> aggregated_i
          start;
 }
 
+/**
+ * @brief Find the first of a set of sorted, disjoint row ranges that ends after the specified row
+ *
+ */
+std::pair<int64_t, int64_t> const* find_row_range(
+  cudf::host_span<std::pair<int64_t, int64_t> const> ranges, size_t row)
+{
+  return std::upper_bound(
+    ranges.begin(), ranges.end(), row, [](size_t row_index, std::pair<int64_t, int64_t> const& r) {
+      return row_index < static_cast<size_t>(r.second);
+    });
+}
+
 /**
  * @brief Given a current position and row index, find the next split based on the
  * specified size limit
@@ -625,6 +643,7 @@ struct copy_subpass_page {
  * @param chunks All of the chunks in the pass
  * @param page_offsets Offsets into the pages array representing the first page for each column
  * @param start_row The row to start the subpass at
+ * @param max_end_row The row the subpass ends at or before
  * @param size_limit The size limit in bytes of the subpass
  * @param num_columns The number of columns
  * @param stream The stream to execute cuda operations on
@@ -639,6 +658,7 @@ std::tuple<rmm::device_uvector<page_span>, size_t, size_t> compute_next_subpass(
   device_span<ColumnChunkDesc const> chunks,
   device_span<size_type const> page_offsets,
   size_t start_row,
+  size_t max_end_row,
   size_t size_limit,
   size_t num_columns,
   rmm::cuda_stream_view stream)
@@ -649,17 +669,13 @@ std::tuple<rmm::device_uvector<page_span>, size_t, size_t> compute_next_subpass(
   auto const h_aggregated_info = cudf::detail::make_std_vector_sync(aggregated_info, stream);
   // print_cumulative_row_info(h_aggregated_info, "adjusted");
 
-  // TODO: if the user has explicitly specified skip_rows/num_rows we could be more intelligent
-  // about skipping subpasses/pages that do not fall within the range of values, but only if the
-  // data does not contain lists (because our row counts are only estimates in that case)
-
   // find the next split
   auto const start_index = find_start_index(h_aggregated_info, start_row);
   auto const cumulative_size =
     start_row == 0 || start_index == 0 ? 0 : h_aggregated_info[start_index - 1].size_bytes;
   auto const end_index =
     find_next_split(start_index, start_row, cumulative_size, h_aggregated_info, size_limit);
-  auto const end_row = h_aggregated_info[end_index].end_row_index;
+  auto const end_row = std::min(h_aggregated_info[end_index].end_row_index, max_end_row);
 
   // for each column, collect the set of pages that spans start_row / end_row
   rmm::device_uvector<page_span> page_bounds(num_columns, stream);
@@ -727,6 +743,7 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
  * @param pages List of page information
  * @param dict_pages If true, decompress dictionary pages only. Otherwise decompress non-dictionary
  * pages only.
+ * @param statistics Reader statistics to update, or `nullptr` if they are not collected
  * @param stream CUDA stream used for device memory operations and kernel launches
  *
  * @return Device buffer to decompressed page data
@@ -735,8 +752,12 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
   cudf::detail::hostdevice_span<ColumnChunkDesc const> chunks,
   cudf::detail::hostdevice_span<PageInfo> pages,
   bool dict_pages,
+  reader_statistics* statistics,
   rmm::cuda_stream_view stream)
 {
+  cudf::io::detail::scoped_phase_timer const timer{statistics,
+                                                   &reader_statistics::decompression_time};
+
   CUDF_FUNC_RANGE();
 
   auto for_each_codec_page = [&](Compression codec, std::function<void(size_t)> const& f) {
@@ -749,6 +770,9 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
     }
   };
 
+  // Decompression buffers never outlive the read, so they come from the temporary IO resource
+  auto const scratch_mr = get_temporary_memory_resource(temporary_allocation::IO_SCRATCH);
+
   // Brotli scratch memory for decompressing
   rmm::device_buffer debrotli_scratch;
 
@@ -785,6 +809,10 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
   for (auto& codec : codecs) {
     for_each_codec_page(codec.compression_type, [&](size_t page) {
       auto page_uncomp_size = pages[page].uncompressed_page_size;
+      if (statistics != nullptr) {
+        statistics->num_compressed_bytes += pages[page].compressed_page_size;
+        statistics->num_decompressed_bytes += page_uncomp_size;
+      }
       total_decomp_size += page_uncomp_size;
       codec.total_decomp_size += page_uncomp_size;
       codec.max_decompressed_size = std::max(codec.max_decompressed_size, page_uncomp_size);
@@ -792,14 +820,15 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
       num_comp_pages++;
     });
     if (codec.compression_type == BROTLI && codec.num_pages > 0) {
-      debrotli_scratch.resize(get_gpu_debrotli_scratch_size(codec.num_pages), stream);
+      debrotli_scratch = rmm::device_buffer(
+        get_gpu_debrotli_scratch_size(codec.num_pages), stream, scratch_mr);
     }
   }
 
   // Dispatch batches of pages to decompress for each codec.
   // Buffer needs to be padded, required by `gpuDecodePageData`.
   rmm::device_buffer decomp_pages(
-    cudf::util::round_up_safe(total_decomp_size, BUFFER_PADDING_MULTIPLE), stream);
+    cudf::util::round_up_safe(total_decomp_size, BUFFER_PADDING_MULTIPLE), stream, scratch_mr);
 
   std::vector<device_span<uint8_t const>> comp_in;
   comp_in.reserve(num_comp_pages);
@@ -928,16 +957,22 @@ std::vector<row_range> compute_page_splits_by_row(device_span<cumulative_page_in
 }
 
 struct flat_column_num_rows {
+  PageInfo const* pages;
   ColumnChunkDesc const* chunks;
 
-  __device__ size_type operator()(PageInfo const& page) const
+  __device__ size_type operator()(size_t i) const
   {
+    auto const& page  = pages[i];
+    auto const& chunk = chunks[page.chunk_idx];
     // ignore dictionary pages and pages belonging to any column containing repetition (lists)
     if ((page.flags & PAGEINFO_FLAGS_DICTIONARY) ||
-        (chunks[page.chunk_idx].max_level[level_type::REPETITION] > 0)) {
+        (chunk.max_level[level_type::REPETITION] > 0)) {
       return 0;
     }
-    return page.num_rows;
+    // the first data page of a chunk also accounts for the pages dropped using the page index
+    auto const is_first_data_page = i == 0 or pages[i - 1].chunk_idx != page.chunk_idx or
+                                    (pages[i - 1].flags & PAGEINFO_FLAGS_DICTIONARY);
+    return page.num_rows + (is_first_data_page ? chunk.num_dropped_rows : 0);
   }
 };
 
@@ -975,8 +1010,8 @@ void detect_malformed_pages(device_span<PageInfo const> pages,
   // sum row counts for all non-dictionary, non-list columns. other columns will be indicated as 0
   rmm::device_uvector<size_type> row_counts(pages.size(),
                                             stream);  // worst case:  num keys == num pages
-  auto const size_iter =
-    thrust::make_transform_iterator(pages.begin(), flat_column_num_rows{chunks.data()});
+  auto const size_iter = cudf::detail::make_counting_transform_iterator(
+    0, flat_column_num_rows{pages.data(), chunks.data()});
   auto const row_counts_begin = row_counts.begin();
   auto page_keys              = make_page_key_iterator(pages);
   auto const row_counts_end   = thrust::reduce_by_key(rmm::exec_policy(stream),
@@ -1146,6 +1181,49 @@ void include_decompression_scratch_size(device_span<ColumnChunkDesc const> chunk
   stream.synchronize();
 }
 
+/**
+ * @brief Drop the leading data pages of a column chunk that end before a given row.
+ *
+ * The pages are located using the offset index. If the chunk has no dictionary page, the dropped
+ * pages are trimmed from the front of the chunk so they are never read. Otherwise the dictionary
+ * page still has to be read, and `data_page_offset` tells the page header decoder where the first
+ * remaining data page starts.
+ *
+ * @param chunk The chunk descriptor to update
+ * @param chunk_info Page index information for the chunk
+ * @param col_meta Metadata of the column chunk
+ * @param skip_rows Number of rows to skip, relative to the start of the chunk
+ * @return The number of data pages dropped
+ */
+size_t drop_leading_pages(ColumnChunkDesc& chunk,
+                          column_chunk_info const& chunk_info,
+                          ColumnChunkMetaData const& col_meta,
+                          size_t skip_rows)
+{
+  auto const first_page = chunk_info.first_page_ending_after(skip_rows);
+  if (first_page >= chunk_info.pages.size()) { return 0; }
+
+  // nothing to drop if the page holding the first row starts the chunk
+  auto const& page_loc = chunk_info.pages[first_page].location;
+  if (page_loc.first_row_index == 0) { return 0; }
+
+  auto const chunk_offset =
+    (col_meta.dictionary_page_offset != 0)
+      ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+      : col_meta.data_page_offset;
+  auto const dropped_size = static_cast<size_t>(page_loc.offset - chunk_offset);
+  CUDF_EXPECTS(page_loc.offset > chunk_offset and dropped_size < chunk.compressed_size,
+               "Encountered invalid page location in the offset index");
+
+  chunk.num_dropped_rows = page_loc.first_row_index;
+  if (chunk_info.has_dictionary()) {
+    chunk.data_page_offset = dropped_size;
+  } else {
+    chunk.compressed_size -= dropped_size;
+  }
+  return first_page;
+}
+
 }  // anonymous namespace
 
 void reader::impl::handle_chunking(read_mode mode)
@@ -1165,8 +1243,9 @@ void reader::impl::handle_chunking(read_mode mode)
       return;
     }
 
-    // increment rows processed
+    // increment rows processed, skipping the rows up to the next selected row
     pass.processed_rows += pass.subpass->num_rows;
+    skip_unselected_rows();
 
     // release the old subpass (will free memory)
     pass.subpass.reset();
@@ -1265,7 +1344,8 @@ void reader::impl::setup_next_pass(read_mode mode)
 
     // decompress dictionary data if applicable.
     if (pass.has_compressed_data) {
-      pass.decomp_dict_data = decompress_page_data(pass.chunks, pass.pages, true, _stream);
+      pass.decomp_dict_data =
+        decompress_page_data(pass.chunks, pass.pages, true, _statistics.get(), _stream);
     }
 
     // store off how much memory we've used so far. This includes the compressed page data and the
@@ -1281,12 +1361,25 @@ void reader::impl::setup_next_pass(read_mode mode)
     // pass level.
     build_string_dict_indices();
 
+    // the rows between the file's row ranges can only be skipped if the page row counts are
+    // exact, which they are not for lists until the pages are decoded
+    pass.skip_between_row_ranges =
+      not _file_itm_data.row_ranges.empty() and
+      std::none_of(pass.chunks.begin(), pass.chunks.end(), [](ColumnChunkDesc const& chunk) {
+        return chunk.max_level[level_type::REPETITION] > 0;
+      });
+
     // if we are doing subpass reading, generate more accurate num_row estimates for list columns.
-    // this helps us to generate more accurate subpass splits.
-    if (pass.has_compressed_data && _input_pass_read_limit != 0) {
+    // this helps us to generate more accurate subpass splits. this also computes the page row
+    // indices needed to select pages by row when skipping rows.
+    if ((pass.has_compressed_data && _input_pass_read_limit != 0) ||
+        pass.skip_between_row_ranges) {
       generate_list_column_row_count_estimates();
     }
 
+    // start at the first selected row of the pass
+    skip_unselected_rows();
+
 #if defined(PARQUET_CHUNK_LOGGING)
     printf("Pass: row_groups(%'lu), chunks(%'lu), pages(%'lu)\n",
            pass.row_groups.size(),
@@ -1306,9 +1399,53 @@ void reader::impl::setup_next_pass(read_mode mode)
 #endif
 
     _stream.synchronize();
+
+    // start reading the next pass while this one is decompressed and decoded
+    prefetch_next_pass();
   }
 }
 
+void reader::impl::prefetch_next_pass()
+{
+  auto const next_pass = _file_itm_data._current_input_pass + 1;
+  if (not _prefetch_next_pass or next_pass >= _file_itm_data.num_passes()) { return; }
+
+  auto const row_group_start     = _file_itm_data.input_pass_row_group_offsets[next_pass];
+  auto const row_group_end       = _file_itm_data.input_pass_row_group_offsets[next_pass + 1];
+  auto const chunks_per_rowgroup = _input_columns.size();
+
+  auto const chunk_start = _file_itm_data.chunks.begin() + (row_group_start * chunks_per_rowgroup);
+  auto const chunk_end   = _file_itm_data.chunks.begin() + (row_group_end * chunks_per_rowgroup);
+
+  auto prefetched        = std::make_unique<prefetch_pass_data>();
+  prefetched->pass_index = next_pass;
+  // the stream waits on all the work submitted so far, so the buffers freed by the previous
+  // passes can be safely reused for the prefetched data.
+  prefetched->stream = cudf::detail::fork_streams(_stream, 1).front();
+  prefetched->row_groups.assign(_file_itm_data.row_groups.begin() + row_group_start,
+                                _file_itm_data.row_groups.begin() + row_group_end);
+  prefetched->chunks = cudf::detail::hostdevice_vector<ColumnChunkDesc>(
+    std::distance(chunk_start, chunk_end), prefetched->stream);
+  std::copy(chunk_start, chunk_end, prefetched->chunks.begin());
+
+  // the prefetched chunk data counts toward the memory budget of the current pass
+  _pass_itm_data->base_mem_size +=
+    std::transform_reduce(chunk_start, chunk_end, std::size_t{0}, std::plus<>{}, [](auto const& c) {
+      return c.compressed_size;
+    });
+
+  // host reads are synchronous, so read on a separate thread to overlap with the decode
+  prefetched->read_task = std::async(std::launch::async, [this, &p = *prefetched]() {
+    auto [has_compressed_data, read_tasks] =
+      read_column_chunks(p.row_groups, p.chunks, p.raw_page_data, p.stream);
+    for (auto& task : read_tasks) {
+      task.wait();
+    }
+    return has_compressed_data;
+  });
+  _prefetched_pass = std::move(prefetched);
+}
+
 void reader::impl::setup_next_subpass(read_mode mode)
 {
   auto& pass    = *_pass_itm_data;
@@ -1337,7 +1474,8 @@ void reader::impl::setup_next_subpass(read_mode mode)
   // for column N to use for the subpass.
   auto [page_indices, total_pages, total_expected_size] =
     [&]() -> std::tuple<rmm::device_uvector<page_span>, size_t, size_t> {
-    if (!pass.has_compressed_data || _input_pass_read_limit == 0) {
+    if ((!pass.has_compressed_data || _input_pass_read_limit == 0) &&
+        !pass.skip_between_row_ranges) {
       rmm::device_uvector<page_span> page_indices(
         num_columns, _stream, rmm::mr::get_current_device_resource());
       auto iter = thrust::make_counting_iterator(0);
@@ -1376,15 +1514,17 @@ void reader::impl::setup_next_subpass(read_mode mode)
                      set_row_index{pass.chunks, pass.pages, c_info, pass_max_row});
     // print_cumulative_page_info(pass.pages, pass.chunks, c_info, _stream);
 
-    // get the next batch of pages
-    return compute_next_subpass(c_info,
-                                pass.pages,
-                                pass.chunks,
-                                pass.page_offsets,
-                                pass.processed_rows + pass.skip_rows,
-                                remaining_read_limit,
-                                num_columns,
-                                _stream);
+    // get the next batch of pages, up to the end of the selected rows
+    return compute_next_subpass(
+      c_info,
+      pass.pages,
+      pass.chunks,
+      pass.page_offsets,
+      pass.processed_rows + pass.skip_rows,
+      selected_rows_end(),
+      _input_pass_read_limit == 0 ? std::numeric_limits<size_t>::max() : remaining_read_limit,
+      num_columns,
+      _stream);
   }();
 
   // check to see if we are processing the entire pass (enabling us to skip a bunch of work)
@@ -1428,7 +1568,8 @@ void reader::impl::setup_next_subpass(read_mode mode)
 
   // decompress the data for the pages in this subpass.
   if (pass.has_compressed_data) {
-    subpass.decomp_page_data = decompress_page_data(pass.chunks, subpass.pages, false, _stream);
+    subpass.decomp_page_data =
+      decompress_page_data(pass.chunks, subpass.pages, false, _statistics.get(), _stream);
   }
 
   // buffers needed by the decode kernels
@@ -1472,6 +1613,34 @@ void reader::impl::setup_next_subpass(read_mode mode)
 #endif
 }
 
+void reader::impl::skip_unselected_rows()
+{
+  auto& pass = *_pass_itm_data;
+  if (not pass.skip_between_row_ranges) { return; }
+
+  auto const& ranges  = _file_itm_data.row_ranges;
+  auto const row      = pass.skip_rows + pass.processed_rows;
+  auto const pass_end = pass.skip_rows + pass.num_rows;
+  auto const range    = find_row_range(ranges, row);
+  auto const next_row = range == ranges.data() + ranges.size()
+                          ? pass_end
+                          : std::clamp(static_cast<size_t>(range->first), row, pass_end);
+  pass.processed_rows = next_row - pass.skip_rows;
+}
+
+size_t reader::impl::selected_rows_end() const
+{
+  auto const& pass    = *_pass_itm_data;
+  auto const pass_end = pass.skip_rows + pass.num_rows;
+  if (not pass.skip_between_row_ranges) { return pass_end; }
+
+  auto const& ranges = _file_itm_data.row_ranges;
+  auto const range   = find_row_range(ranges, pass.skip_rows + pass.processed_rows);
+  return range == ranges.data() + ranges.size()
+           ? pass_end
+           : std::min(static_cast<size_t>(range->second), pass_end);
+}
+
 void reader::impl::create_global_chunk_info()
 {
   auto const num_rows         = _file_itm_data.global_num_rows;
@@ -1518,11 +1687,11 @@ void reader::impl::create_global_chunk_info()
       auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
       auto& schema   = _metadata->get_schema(col.schema_idx);
 
-      auto [clock_rate, logical_type] =
-        conversion_info(to_type_id(schema, _strings_to_categorical, _options.timestamp_type.id()),
-                        _options.timestamp_type.id(),
-                        schema.type,
-                        schema.logical_type);
+      auto const is_dictionary = is_dictionary_output(schema, _strings_to_dictionary);
+      auto const column_type_id =
+        to_type_id(schema, _strings_to_categorical or is_dictionary, _options.timestamp_type.id());
+      auto [clock_rate, logical_type] = conversion_info(
+        column_type_id, _options.timestamp_type.id(), schema.type, schema.logical_type);
 
       // for lists, estimate the number of bytes per row. this is used by the subpass reader to
       // determine where to split the decompression boundaries
@@ -1555,7 +1724,16 @@ void reader::impl::create_global_chunk_info()
                                        col.schema_idx,
                                        chunk_info,
                                        list_bytes_per_row_est,
-                                       schema.type == BYTE_ARRAY and _strings_to_categorical));
+                                       schema.type == BYTE_ARRAY and _strings_to_categorical,
+                                       is_dictionary));
+
+      // use the offset index to drop the leading data pages that end before the first row to be
+      // read, so that neither their headers nor their data are ever decoded
+      if (chunk_info != nullptr and _file_itm_data.global_skip_rows > row_group_start) {
+        auto const num_dropped = drop_leading_pages(
+          chunks.back(), *chunk_info, col_meta, _file_itm_data.global_skip_rows - row_group_start);
+        if (_statistics != nullptr) { _statistics->num_pages_skipped += num_dropped; }
+      }
     }
 
     remaining_rows -= row_group_rows;
@@ -1585,9 +1763,11 @@ void reader::impl::compute_input_passes()
 
   // generate passes. make sure to account for the case where a single row group doesn't fit within
   //
+  // when prefetching, the compressed data of two passes is resident at the same time.
   std::size_t const comp_read_limit =
     _input_pass_read_limit > 0
-      ? static_cast<size_t>(_input_pass_read_limit * input_limit_compression_reserve)
+      ? static_cast<size_t>(_input_pass_read_limit * input_limit_compression_reserve) /
+          (_prefetch_next_pass ? 2 : 1)
       : std::numeric_limits<std::size_t>::max();
   std::size_t cur_pass_byte_size = 0;
   std::size_t cur_rg_start       = 0;
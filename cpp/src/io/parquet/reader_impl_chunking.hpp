@@ -20,6 +20,8 @@
 
 #include <cudf/types.hpp>
 
+#include <future>
+
 namespace cudf::io::parquet::detail {
 
 /**
@@ -48,6 +50,11 @@ struct file_intermediate_data {
   size_t global_skip_rows;
   size_t global_num_rows;
 
+  // [start, end) ranges of rows to output, in the same row space as global_skip_rows. Rows
+  // between the ranges are skipped, or decoded and dropped from the output if the pass has list
+  // columns. Empty if all rows are output.
+  std::vector<std::pair<int64_t, int64_t>> row_ranges{};
+
   [[nodiscard]] size_t num_passes() const
   {
     return input_pass_row_group_offsets.size() == 0 ? 0 : input_pass_row_group_offsets.size() - 1;
@@ -135,8 +142,33 @@ struct pass_intermediate_data {
   // subpass. it does not get updated as a subpass iterates through output chunks.
   size_t processed_rows{0};
 
+  // whether the subpasses skip the rows between the file's row ranges. list row counts are only
+  // estimated before decoding, so rows are never skipped in passes with list columns.
+  bool skip_between_row_ranges{false};
+
   // currently active subpass
   std::unique_ptr<subpass_intermediate_data> subpass{};
 };
 
+/**
+ * @brief Struct to store the column chunk data of a pass that is read ahead of time.
+ *
+ * The chunks are read on a separate thread and copied to device memory on a separate stream
+ * while the previous pass is being decoded.
+ */
+struct prefetch_pass_data {
+  // index of the pass being prefetched
+  size_t pass_index{0};
+  // stream on which the chunk data is copied to device memory
+  rmm::cuda_stream_view stream;
+
+  std::vector<row_group_info> row_groups{};
+  cudf::detail::hostdevice_vector<ColumnChunkDesc> chunks{};
+  std::vector<std::unique_ptr<datasource::buffer>> raw_page_data;
+
+  // result of the read, indicating if compressed chunks were found. declared last so that it
+  // is destroyed (waiting for the read to finish) before the buffers it writes to.
+  std::future<bool> read_task;
+};
+
 }  // namespace cudf::io::parquet::detail
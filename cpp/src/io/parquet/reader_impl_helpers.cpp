@@ -17,16 +17,20 @@
 #include "reader_impl_helpers.hpp"
 
 #include "compact_protocol_reader.hpp"
+#include "footer_cache.hpp"
 #include "io/parquet/parquet.hpp"
 #include "io/utilities/base64_utilities.hpp"
 #include "io/utilities/row_selection.hpp"
 #include "ipc/Message_generated.h"
 #include "ipc/Schema_generated.h"
 
+#include <cudf/detail/utilities/host_worker_pool.hpp>
+
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 
 #include <functional>
+#include <future>
 #include <numeric>
 #include <regex>
 
@@ -67,6 +71,52 @@ thrust::optional<LogicalType> converted_to_logical_type(SchemaElement const& sch
   return thrust::nullopt;
 }
 
+/**
+ * @brief Sorts [start, end) row ranges and merges the overlapping ones, dropping empty ranges
+ */
+std::vector<std::pair<int64_t, int64_t>> merge_row_ranges(
+  host_span<std::pair<int64_t, int64_t> const> row_ranges)
+{
+  std::vector<std::pair<int64_t, int64_t>> ranges;
+  std::copy_if(row_ranges.begin(),
+               row_ranges.end(),
+               std::back_inserter(ranges),
+               [](auto const& range) { return range.first < range.second; });
+  std::sort(ranges.begin(), ranges.end());
+  std::vector<std::pair<int64_t, int64_t>> merged;
+  for (auto const& range : ranges) {
+    if (not merged.empty() and range.first <= merged.back().second) {
+      merged.back().second = std::max(merged.back().second, range.second);
+    } else {
+      merged.push_back(range);
+    }
+  }
+  return merged;
+}
+
+/**
+ * @brief Returns the rows in both of two lists of sorted, disjoint [start, end) row ranges
+ */
+std::vector<std::pair<int64_t, int64_t>> intersect_row_ranges(
+  host_span<std::pair<int64_t, int64_t> const> lhs,
+  host_span<std::pair<int64_t, int64_t> const> rhs)
+{
+  std::vector<std::pair<int64_t, int64_t>> intersection;
+  auto lhs_it = lhs.begin();
+  auto rhs_it = rhs.begin();
+  while (lhs_it != lhs.end() and rhs_it != rhs.end()) {
+    auto const start = std::max(lhs_it->first, rhs_it->first);
+    auto const end   = std::min(lhs_it->second, rhs_it->second);
+    if (start < end) { intersection.emplace_back(start, end); }
+    if (lhs_it->second < rhs_it->second) {
+      ++lhs_it;
+    } else {
+      ++rhs_it;
+    }
+  }
+  return intersection;
+}
+
 }  // namespace
 
 /**
@@ -279,7 +329,9 @@ void metadata::sanitize_schema()
   process(0);
 }
 
-metadata::metadata(datasource* source)
+metadata::metadata(datasource* source,
+                   bool read_page_indexes,
+                   host_span<std::string const> selected_fields)
 {
   constexpr auto header_len = sizeof(file_header_s);
   constexpr auto ender_len  = sizeof(file_ender_s);
@@ -297,11 +349,13 @@ metadata::metadata(datasource* source)
 
   auto const buffer = source->host_read(len - ender->footer_len - ender_len, ender->footer_len);
   CompactProtocolReader cp(buffer->data(), ender->footer_len);
-  cp.read(this);
+  cp.read(this, selected_fields);
   CUDF_EXPECTS(cp.InitSchema(this), "Cannot initialize schema");
+  encoded_size = ender->footer_len;
 
-  // Reading the page indexes is somewhat expensive, so skip if there are no byte array columns.
-  // Currently the indexes are only used for the string size calculations.
+  // Reading the page indexes is somewhat expensive, so skip if there are no byte array columns
+  // and the caller has not asked for them. The indexes are used for the string size calculations
+  // and for page-level predicate pushdown.
   // Could also just read indexes for string columns, but that would require changes elsewhere
   // where we're trying to determine if we have the indexes or not.
   // Note: This will have to be modified if there are other uses in the future (e.g. calculating
@@ -309,7 +363,8 @@ metadata::metadata(datasource* source)
   auto const has_strings = std::any_of(
     schema.begin(), schema.end(), [](auto const& elem) { return elem.type == BYTE_ARRAY; });
 
-  if (has_strings and not row_groups.empty() and not row_groups.front().columns.empty()) {
+  if ((has_strings or read_page_indexes) and not row_groups.empty() and
+      not row_groups.front().columns.empty()) {
     // column index and offset index are encoded back to back.
     // the first column of the first row group will have the first column index, the last
     // column of the last row group will have the final offset index.
@@ -320,10 +375,13 @@ metadata::metadata(datasource* source)
     if (max_offset > 0) {
       int64_t const length = max_offset - min_offset;
       auto const idx_buf   = source->host_read(min_offset, length);
+      encoded_size += length;
 
       // now loop over row groups
       for (auto& rg : row_groups) {
         for (auto& col : rg.columns) {
+          // skip the indexes of the columns that were not selected
+          if (not col.has_metadata) { continue; }
           if (col.column_index_length > 0 && col.column_index_offset > 0) {
             int64_t const offset = col.column_index_offset - min_offset;
             cp.init(idx_buf->data() + offset, col.column_index_length);
@@ -346,14 +404,51 @@ metadata::metadata(datasource* source)
   sanitize_schema();
 }
 
-std::vector<metadata> aggregate_reader_metadata::metadatas_from_sources(
-  host_span<std::unique_ptr<datasource> const> sources)
+std::vector<std::shared_ptr<metadata const>> aggregate_reader_metadata::metadatas_from_sources(
+  host_span<std::unique_ptr<datasource> const> sources,
+  host_span<std::string const> filepaths,
+  bool read_page_indexes,
+  host_span<std::string const> selected_fields)
 {
-  std::vector<metadata> metadatas;
-  std::transform(
-    sources.begin(), sources.end(), std::back_inserter(metadatas), [](auto const& source) {
-      return metadata(source.get());
-    });
+  // Parse the footer of a source, or reuse the cached footer if the source is a file whose
+  // footer has already been parsed. Partially decoded footers are not cached.
+  auto const read_metadata = [read_page_indexes, selected_fields](datasource* source,
+                                                                  std::string const* filepath) {
+    auto& cache    = get_footer_cache();
+    auto const key = filepath != nullptr
+                       ? cache.make_key(*filepath, source->size(), read_page_indexes)
+                       : std::nullopt;
+    if (key.has_value()) {
+      if (auto cached = cache.get(key.value()); cached != nullptr) { return cached; }
+    }
+    auto md = std::make_shared<metadata const>(source, read_page_indexes, selected_fields);
+    if (key.has_value() and selected_fields.empty()) {
+      cache.put(key.value(), md, md->encoded_size);
+    }
+    return md;
+  };
+  auto const filepath_of = [&](std::size_t src_idx) {
+    return filepaths.size() == sources.size() ? &filepaths[src_idx] : nullptr;
+  };
+
+  std::vector<std::shared_ptr<metadata const>> metadatas;
+  if (sources.size() <= 1) {
+    for (std::size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+      metadatas.push_back(read_metadata(sources[src_idx].get(), filepath_of(src_idx)));
+    }
+    return metadatas;
+  }
+
+  // Read and parse the footers of multiple sources in parallel
+  std::vector<std::future<std::shared_ptr<metadata const>>> metadata_tasks;
+  for (std::size_t src_idx = 0; src_idx < sources.size(); ++src_idx) {
+    metadata_tasks.push_back(cudf::detail::host_worker_pool().submit(
+      read_metadata, sources[src_idx].get(), filepath_of(src_idx)));
+  }
+  std::transform(metadata_tasks.begin(),
+                 metadata_tasks.end(),
+                 std::back_inserter(metadatas),
+                 [](auto& task) { return task.get(); });
   return metadatas;
 }
 
@@ -366,8 +461,8 @@ aggregate_reader_metadata::collect_keyval_metadata() const
                  std::back_inserter(kv_maps),
                  [](auto const& pfm) {
                    std::unordered_map<std::string, std::string> kv_map;
-                   std::transform(pfm.key_value_metadata.cbegin(),
-                                  pfm.key_value_metadata.cend(),
+                   std::transform(pfm->key_value_metadata.cbegin(),
+                                  pfm->key_value_metadata.cend(),
                                   std::inserter(kv_map, kv_map.end()),
                                   [](auto const& kv) {
                                     return std::pair{kv.key, kv.value};
@@ -383,12 +478,12 @@ int64_t aggregate_reader_metadata::calc_num_rows() const
   return std::accumulate(
     per_file_metadata.cbegin(), per_file_metadata.cend(), 0l, [](auto& sum, auto& pfm) {
       auto const rowgroup_rows = std::accumulate(
-        pfm.row_groups.cbegin(), pfm.row_groups.cend(), 0l, [](auto& rg_sum, auto& rg) {
+        pfm->row_groups.cbegin(), pfm->row_groups.cend(), 0l, [](auto& rg_sum, auto& rg) {
           return rg_sum + rg.num_rows;
         });
-      CUDF_EXPECTS(pfm.num_rows == 0 || pfm.num_rows == rowgroup_rows,
+      CUDF_EXPECTS(pfm->num_rows == 0 || pfm->num_rows == rowgroup_rows,
                    "Header and row groups disagree about number of rows in file!");
-      return sum + (pfm.num_rows == 0 && rowgroup_rows > 0 ? rowgroup_rows : pfm.num_rows);
+      return sum + (pfm->num_rows == 0 && rowgroup_rows > 0 ? rowgroup_rows : pfm->num_rows);
     });
 }
 
@@ -396,7 +491,7 @@ size_type aggregate_reader_metadata::calc_num_row_groups() const
 {
   return std::accumulate(
     per_file_metadata.cbegin(), per_file_metadata.cend(), 0, [](auto& sum, auto& pfm) {
-      return sum + pfm.row_groups.size();
+      return sum + pfm->row_groups.size();
     });
 }
 
@@ -404,13 +499,16 @@ size_type aggregate_reader_metadata::calc_num_row_groups() const
 void aggregate_reader_metadata::column_info_for_row_group(row_group_info& rg_info,
                                                           size_type chunk_start_row) const
 {
-  auto const& fmd = per_file_metadata[rg_info.source_index];
+  auto const& fmd = *per_file_metadata[rg_info.source_index];
   auto const& rg  = fmd.row_groups[rg_info.index];
 
   std::vector<column_chunk_info> chunks(rg.columns.size());
 
   for (size_t col_idx = 0; col_idx < rg.columns.size(); col_idx++) {
-    auto const& col_chunk    = rg.columns[col_idx];
+    auto const& col_chunk = rg.columns[col_idx];
+    // The page indexes of the columns that were not selected are not read
+    if (not col_chunk.has_metadata) { continue; }
+
     auto& schema             = get_schema(col_chunk.schema_idx);
     auto const max_def_level = schema.max_definition_level;
     auto const max_rep_level = schema.max_repetition_level;
@@ -537,25 +635,30 @@ void aggregate_reader_metadata::column_info_for_row_group(row_group_info& rg_inf
 }
 
 aggregate_reader_metadata::aggregate_reader_metadata(
-  host_span<std::unique_ptr<datasource> const> sources, bool use_arrow_schema)
-  : per_file_metadata(metadatas_from_sources(sources)),
+  host_span<std::unique_ptr<datasource> const> sources,
+  bool use_arrow_schema,
+  bool read_page_indexes,
+  host_span<std::string const> filepaths,
+  host_span<std::string const> selected_fields)
+  : per_file_metadata(
+      metadatas_from_sources(sources, filepaths, read_page_indexes, selected_fields)),
     keyval_maps(collect_keyval_metadata()),
     num_rows(calc_num_rows()),
     num_row_groups(calc_num_row_groups())
 {
   if (per_file_metadata.size() > 0) {
-    auto const& first_meta = per_file_metadata.front();
+    auto const& first_meta = *per_file_metadata.front();
     auto const num_cols =
       first_meta.row_groups.size() > 0 ? first_meta.row_groups.front().columns.size() : 0;
     auto const& schema = first_meta.schema;
 
     // Verify that the input files have matching numbers of columns and schema.
     for (auto const& pfm : per_file_metadata) {
-      if (pfm.row_groups.size() > 0) {
-        CUDF_EXPECTS(num_cols == pfm.row_groups.front().columns.size(),
+      if (pfm->row_groups.size() > 0) {
+        CUDF_EXPECTS(num_cols == pfm->row_groups.front().columns.size(),
                      "All sources must have the same number of columns");
       }
-      CUDF_EXPECTS(schema == pfm.schema, "All sources must have the same schema");
+      CUDF_EXPECTS(schema == pfm->schema, "All sources must have the same schema");
     }
   }
 
@@ -720,7 +823,7 @@ void aggregate_reader_metadata::apply_arrow_schema()
   // Function to verify equal num_children at each level in Parquet and arrow schemas.
   std::function<bool(arrow_schema_data_types const&, int const)> validate_schemas =
     [&](arrow_schema_data_types const& arrow_schema, int const schema_idx) {
-      auto& pq_schema_elem = per_file_metadata[0].schema[schema_idx];
+      auto const& pq_schema_elem = per_file_metadata[0]->schema[schema_idx];
 
       // ensure equal number of children first to avoid any segfaults in children
       if (pq_schema_elem.num_children == static_cast<int32_t>(arrow_schema.children.size())) {
@@ -737,10 +840,11 @@ void aggregate_reader_metadata::apply_arrow_schema()
       }
     };
 
-  // Function to co-walk arrow and parquet schemas
+  // Function to co-walk arrow and parquet schemas, collecting the arrow types to apply
+  std::vector<std::pair<int, type_id>> arrow_types;
   std::function<void(arrow_schema_data_types const&, int const)> co_walk_schemas =
     [&](arrow_schema_data_types const& arrow_schema, int const schema_idx) {
-      auto& pq_schema_elem = per_file_metadata[0].schema[schema_idx];
+      auto const& pq_schema_elem = per_file_metadata[0]->schema[schema_idx];
       std::for_each(
         thrust::make_zip_iterator(
           thrust::make_tuple(arrow_schema.children.begin(), pq_schema_elem.children_idx.begin())),
@@ -750,7 +854,7 @@ void aggregate_reader_metadata::apply_arrow_schema()
 
       // true for DurationType columns only for now.
       if (arrow_schema.type.id() != type_id::EMPTY) {
-        pq_schema_elem.arrow_type = arrow_schema.type.id();
+        arrow_types.emplace_back(schema_idx, arrow_schema.type.id());
       }
     };
 
@@ -781,6 +885,14 @@ void aggregate_reader_metadata::apply_arrow_schema()
   std::for_each(schemas, schemas + pq_schema_root.num_children, [&](auto const& elem) {
     co_walk_schemas(thrust::get<0>(elem), thrust::get<1>(elem));
   });
+  if (arrow_types.empty()) { return; }
+
+  // The parsed footers may be shared with the footer cache, so the types are applied to a copy
+  auto first_meta = std::make_shared<metadata>(*per_file_metadata[0]);
+  for (auto const& [schema_idx, arrow_type] : arrow_types) {
+    first_meta->schema[schema_idx].arrow_type = arrow_type;
+  }
+  per_file_metadata[0] = std::move(first_meta);
 }
 
 std::optional<std::string_view> aggregate_reader_metadata::decode_ipc_message(
@@ -866,7 +978,7 @@ RowGroup const& aggregate_reader_metadata::get_row_group(size_type row_group_ind
 {
   CUDF_EXPECTS(src_idx >= 0 && src_idx < static_cast<size_type>(per_file_metadata.size()),
                "invalid source index");
-  return per_file_metadata[src_idx].row_groups[row_group_index];
+  return per_file_metadata[src_idx]->row_groups[row_group_index];
 }
 
 ColumnChunkMetaData const& aggregate_reader_metadata::get_column_metadata(size_type row_group_index,
@@ -874,10 +986,10 @@ ColumnChunkMetaData const& aggregate_reader_metadata::get_column_metadata(size_t
                                                                           int schema_idx) const
 {
   auto col =
-    std::find_if(per_file_metadata[src_idx].row_groups[row_group_index].columns.begin(),
-                 per_file_metadata[src_idx].row_groups[row_group_index].columns.end(),
+    std::find_if(per_file_metadata[src_idx]->row_groups[row_group_index].columns.begin(),
+                 per_file_metadata[src_idx]->row_groups[row_group_index].columns.end(),
                  [schema_idx](ColumnChunk const& col) { return col.schema_idx == schema_idx; });
-  CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx].row_groups[row_group_index].columns),
+  CUDF_EXPECTS(col != std::end(per_file_metadata[src_idx]->row_groups[row_group_index].columns),
                "Found no metadata for schema index");
   return col->meta_data;
 }
@@ -889,8 +1001,8 @@ aggregate_reader_metadata::get_rowgroup_metadata() const
 
   std::for_each(
     per_file_metadata.cbegin(), per_file_metadata.cend(), [&rg_metadata](auto const& pfm) {
-      std::transform(pfm.row_groups.cbegin(),
-                     pfm.row_groups.cend(),
+      std::transform(pfm->row_groups.cbegin(),
+                     pfm->row_groups.cend(),
                      std::back_inserter(rg_metadata),
                      [](auto const& rg) {
                        std::unordered_map<std::string, int64_t> rg_meta_map;
@@ -950,27 +1062,140 @@ std::vector<std::string> aggregate_reader_metadata::get_pandas_index_names() con
   return names;
 }
 
-std::tuple<int64_t, size_type, std::vector<row_group_info>>
+std::tuple<int64_t,
+           size_type,
+           std::vector<row_group_info>,
+           std::vector<std::pair<int64_t, int64_t>>>
 aggregate_reader_metadata::select_row_groups(
+  host_span<std::unique_ptr<datasource> const> sources,
   host_span<std::vector<size_type> const> row_group_indices,
   int64_t skip_rows_opt,
   std::optional<size_type> const& num_rows_opt,
+  host_span<std::pair<int64_t, int64_t> const> row_ranges,
   host_span<data_type const> output_dtypes,
   host_span<int const> output_column_schemas,
   std::optional<std::reference_wrapper<ast::expression const>> filter,
   rmm::cuda_stream_view stream) const
 {
   std::optional<std::vector<std::vector<size_type>>> filtered_row_group_indices;
+  std::vector<std::pair<int64_t, int64_t>> filtered_row_ranges;
   // if filter is not empty, then gather row groups to read after predicate pushdown
   if (filter.has_value()) {
-    filtered_row_group_indices = filter_row_groups(
-      row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
+    auto const has_row_group_indices = not row_group_indices.empty();
+    filtered_row_group_indices       = filter_row_groups(
+      sources, row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
     if (filtered_row_group_indices.has_value()) {
       row_group_indices =
         host_span<std::vector<size_type> const>(filtered_row_group_indices.value());
     }
+    // Unless specific row groups were requested, the rows that may satisfy the filter are read as
+    // row ranges, so that the pages holding only rows between them are skipped. The ranges are
+    // limited to the rows requested with skip_rows/num_rows or with row ranges.
+    auto const has_row_bounds =
+      skip_rows_opt != 0 or num_rows_opt.has_value() or not row_ranges.empty();
+    std::optional<std::vector<std::pair<int64_t, int64_t>>> page_ranges;
+    if (not has_row_group_indices) {
+      page_ranges = filter_pages(
+        row_group_indices, output_dtypes, output_column_schemas, filter.value(), stream);
+    }
+    if (page_ranges.has_value() or
+        (not has_row_group_indices and filtered_row_group_indices.has_value() and
+         has_row_bounds)) {
+      if (not page_ranges.has_value()) {
+        // rows of the row groups left after filtering
+        page_ranges.emplace();
+        int64_t source_start_row = 0;
+        for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+          auto const& row_groups = per_file_metadata[src_idx]->row_groups;
+          std::vector<int64_t> rg_start_rows{0};
+          for (auto const& row_group : row_groups) {
+            rg_start_rows.push_back(rg_start_rows.back() + row_group.num_rows);
+          }
+          for (auto const rg_idx : row_group_indices[src_idx]) {
+            page_ranges->emplace_back(source_start_row + rg_start_rows[rg_idx],
+                                      source_start_row + rg_start_rows[rg_idx + 1]);
+          }
+          source_start_row += rg_start_rows.back();
+        }
+      }
+      auto const requested_ranges = [&]() {
+        if (not row_ranges.empty()) { return merge_row_ranges(row_ranges); }
+        auto const [skip_rows, num_rows] = cudf::io::detail::skip_rows_num_rows_from_options(
+          skip_rows_opt, num_rows_opt, get_num_rows());
+        return std::vector<std::pair<int64_t, int64_t>>{{skip_rows, skip_rows + num_rows}};
+      }();
+      filtered_row_ranges = intersect_row_ranges(requested_ranges, page_ranges.value());
+      if (filtered_row_ranges.empty()) {
+        return {0, 0, std::vector<row_group_info>{}, std::vector<std::pair<int64_t, int64_t>>{}};
+      }
+      row_ranges = filtered_row_ranges;
+    }
   }
   std::vector<row_group_info> selection;
+
+  if (not row_ranges.empty()) {
+    auto const merged = merge_row_ranges(row_ranges);
+
+    // row groups left after filtering, sorted for lookup
+    std::vector<std::vector<size_type>> sorted_indices(row_group_indices.begin(),
+                                                       row_group_indices.end());
+    for (auto& indices : sorted_indices) {
+      std::sort(indices.begin(), indices.end());
+    }
+
+    // Select every row group overlapping a range. The selected row groups are laid out back to
+    // back, so the ranges are translated to that row space.
+    std::vector<std::pair<int64_t, int64_t>> selected_ranges;
+    int64_t file_row    = 0;
+    int64_t rows_so_far = 0;
+    auto range_it       = merged.cbegin();
+    for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+      auto const& fmd = *per_file_metadata[src_idx];
+      for (size_t rg_idx = 0; rg_idx < fmd.row_groups.size(); ++rg_idx) {
+        auto const rg_start = file_row;
+        auto const rg_end   = rg_start + fmd.row_groups[rg_idx].num_rows;
+        file_row            = rg_end;
+        while (range_it != merged.cend() and range_it->second <= rg_start) {
+          ++range_it;
+        }
+        if (range_it == merged.cend() or range_it->first >= rg_end) { continue; }
+        if (not sorted_indices.empty() and
+            not std::binary_search(sorted_indices[src_idx].cbegin(),
+                                   sorted_indices[src_idx].cend(),
+                                   static_cast<size_type>(rg_idx))) {
+          continue;
+        }
+
+        selection.emplace_back(rg_idx, rows_so_far, src_idx);
+        // if page-level indexes are present, then collect extra chunk and page info.
+        column_info_for_row_group(selection.back(), rows_so_far);
+        for (auto it = range_it; it != merged.cend() and it->first < rg_end; ++it) {
+          auto const start = std::max(it->first, rg_start) - rg_start + rows_so_far;
+          auto const end   = std::min(it->second, rg_end) - rg_start + rows_so_far;
+          if (not selected_ranges.empty() and selected_ranges.back().second == start) {
+            selected_ranges.back().second = end;
+          } else {
+            selected_ranges.emplace_back(start, end);
+          }
+        }
+        rows_so_far += rg_end - rg_start;
+      }
+    }
+
+    if (selected_ranges.empty()) {
+      return {0, 0, std::vector<row_group_info>{}, std::vector<std::pair<int64_t, int64_t>>{}};
+    }
+    // The rows before and between the ranges are skipped by the subpasses, or decoded and dropped
+    // when they cannot be skipped, so the read starts at the first selected row group.
+    auto const rows_to_read = selected_ranges.back().second;
+    CUDF_EXPECTS(rows_to_read <= static_cast<int64_t>(std::numeric_limits<size_type>::max()),
+                 "Number of reading rows exceeds cudf's column size limit.");
+    return {0,
+            static_cast<size_type>(rows_to_read),
+            std::move(selection),
+            std::move(selected_ranges)};
+  }
+
   auto [rows_to_skip, rows_to_read] = [&]() {
     if (not row_group_indices.empty()) { return std::pair<int64_t, size_type>{}; }
     auto const from_opts = cudf::io::detail::skip_rows_num_rows_from_options(
@@ -986,7 +1211,7 @@ aggregate_reader_metadata::select_row_groups(
                  "Must specify row groups for each source");
 
     for (size_t src_idx = 0; src_idx < row_group_indices.size(); ++src_idx) {
-      auto const& fmd = per_file_metadata[src_idx];
+      auto const& fmd = *per_file_metadata[src_idx];
       for (auto const& rowgroup_idx : row_group_indices[src_idx]) {
         CUDF_EXPECTS(
           rowgroup_idx >= 0 && rowgroup_idx < static_cast<size_type>(fmd.row_groups.size()),
@@ -1000,7 +1225,7 @@ aggregate_reader_metadata::select_row_groups(
   } else {
     size_type count = 0;
     for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
-      auto const& fmd = per_file_metadata[src_idx];
+      auto const& fmd = *per_file_metadata[src_idx];
       for (size_t rg_idx = 0; rg_idx < fmd.row_groups.size(); ++rg_idx) {
         auto const& rg             = fmd.row_groups[rg_idx];
         auto const chunk_start_row = count;
@@ -1015,7 +1240,50 @@ aggregate_reader_metadata::select_row_groups(
     }
   }
 
-  return {rows_to_skip, rows_to_read, std::move(selection)};
+  return {rows_to_skip,
+          rows_to_read,
+          std::move(selection),
+          std::vector<std::pair<int64_t, int64_t>>{}};
+}
+
+std::optional<std::vector<std::pair<int64_t, int64_t>>>
+aggregate_reader_metadata::to_global_row_ranges(
+  host_span<row_group_info const> row_groups,
+  host_span<std::pair<int64_t, int64_t> const> row_ranges) const
+{
+  // first row of every row group across all sources
+  std::vector<std::vector<int64_t>> rg_start_rows(per_file_metadata.size());
+  int64_t source_start_row = 0;
+  for (size_t src_idx = 0; src_idx < per_file_metadata.size(); ++src_idx) {
+    for (auto const& row_group : per_file_metadata[src_idx]->row_groups) {
+      rg_start_rows[src_idx].push_back(source_start_row);
+      source_start_row += row_group.num_rows;
+    }
+  }
+
+  std::vector<std::pair<int64_t, int64_t>> global_ranges;
+  auto range_it = row_ranges.begin();
+  for (auto const& rg : row_groups) {
+    auto const rg_start = static_cast<int64_t>(rg.start_row);
+    auto const rg_end   = rg_start + get_row_group(rg.index, rg.source_index).num_rows;
+    auto const offset   = rg_start_rows[rg.source_index][rg.index] - rg_start;
+    while (range_it != row_ranges.end() and range_it->second <= rg_start) {
+      ++range_it;
+    }
+    for (auto it = range_it; it != row_ranges.end() and it->first < rg_end; ++it) {
+      auto const start = std::max(it->first, rg_start) + offset;
+      auto const end   = std::min(it->second, rg_end) + offset;
+      if (not global_ranges.empty() and global_ranges.back().second > start) {
+        return std::nullopt;
+      }
+      if (not global_ranges.empty() and global_ranges.back().second == start) {
+        global_ranges.back().second = end;
+      } else {
+        global_ranges.emplace_back(start, end);
+      }
+    }
+  }
+  return {std::move(global_ranges)};
 }
 
 std::tuple<std::vector<input_column_info>,
@@ -1026,6 +1294,7 @@ aggregate_reader_metadata::select_columns(
   std::optional<std::vector<std::string>> const& filter_columns_names,
   bool include_index,
   bool strings_to_categorical,
+  bool strings_to_dictionary,
   type_id timestamp_type_id) const
 {
   auto find_schema_child = [&](SchemaElement const& schema_elem, std::string const& name) {
@@ -1067,9 +1336,12 @@ aggregate_reader_metadata::select_columns(
       auto const one_level_list = schema_elem.is_one_level_list(get_schema(schema_elem.parent_idx));
 
       // if we're at the root, this is a new output column
-      auto const col_type = one_level_list
-                              ? type_id::LIST
-                              : to_type_id(schema_elem, strings_to_categorical, timestamp_type_id);
+      auto const col_type =
+        one_level_list ? type_id::LIST
+                       : to_type_id(schema_elem,
+                                    strings_to_categorical or
+                                      is_dictionary_output(schema_elem, strings_to_dictionary),
+                                    timestamp_type_id);
       auto const dtype    = to_data_type(col_type, schema_elem);
 
       cudf::io::detail::inline_column_buffer output_col(dtype,
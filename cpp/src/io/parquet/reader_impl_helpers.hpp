@@ -20,11 +20,14 @@
 
 #include <cudf/ast/detail/expression_transformer.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/column/column_view.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/datasource.hpp>
 #include <cudf/types.hpp>
 
+#include <algorithm>
 #include <list>
+#include <memory>
 #include <tuple>
 #include <vector>
 
@@ -65,6 +68,20 @@ struct column_chunk_info {
   {
     return dictionary_offset.has_value() && dictionary_size.has_value();
   }
+
+  /**
+   * @brief Find the first data page that ends after the given row.
+   *
+   * @param row Row index relative to the start of the column chunk
+   * @return Index of the first page containing rows at or after `row`
+   */
+  [[nodiscard]] size_t first_page_ending_after(int64_t row) const
+  {
+    auto const it = std::find_if(pages.begin(), pages.end(), [row](page_info const& page) {
+      return page.location.first_row_index + page.num_rows > row;
+    });
+    return std::distance(pages.begin(), it);
+  }
 };
 
 /**
@@ -99,6 +116,24 @@ struct row_group_info {
                                  bool strings_to_categorical,
                                  type_id timestamp_type_id);
 
+/**
+ * @brief Returns true if the column is read as a dictionary column
+ *
+ * When strings are read as dictionary columns, the rows of top-level string columns are decoded
+ * as positions in the string dictionaries of the pass, which are converted to dictionary columns.
+ *
+ * @param schema Schema element of the column
+ * @param strings_to_dictionary Whether strings are read as dictionary columns
+ */
+[[nodiscard]] inline bool is_dictionary_output(SchemaElement const& schema,
+                                               bool strings_to_dictionary)
+{
+  auto const is_decimal =
+    schema.logical_type.has_value() and schema.logical_type->type == LogicalType::DECIMAL;
+  return strings_to_dictionary and schema.type == BYTE_ARRAY and not is_decimal and
+         schema.parent_idx == 0 and schema.num_children == 0 and schema.max_repetition_level == 0;
+}
+
 /**
  * @brief Converts cuDF type enum to column logical type
  */
@@ -113,8 +148,22 @@ struct row_group_info {
  * @brief Class for parsing dataset metadata
  */
 struct metadata : public FileMetaData {
-  explicit metadata(datasource* source);
+  /**
+   * @brief Parses the footer of the given source
+   *
+   * @param source Dataset source
+   * @param read_page_indexes Whether to read the column and offset indexes even if there are no
+   * byte array columns in the schema
+   * @param selected_fields Names of the top-level fields whose column chunk metadata and page
+   * indexes are decoded. The metadata of all column chunks is decoded if empty.
+   */
+  explicit metadata(datasource* source,
+                    bool read_page_indexes                       = false,
+                    host_span<std::string const> selected_fields = {});
   void sanitize_schema();
+
+  // size in bytes of the encoded footer and page indexes that were parsed
+  std::size_t encoded_size{0};
 };
 
 struct arrow_schema_data_types {
@@ -123,7 +172,7 @@ struct arrow_schema_data_types {
 };
 
 class aggregate_reader_metadata {
-  std::vector<metadata> per_file_metadata;
+  std::vector<std::shared_ptr<metadata const>> per_file_metadata;
   std::vector<std::unordered_map<std::string, std::string>> keyval_maps;
 
   int64_t num_rows;
@@ -132,8 +181,11 @@ class aggregate_reader_metadata {
   /**
    * @brief Create a metadata object from each element in the source vector
    */
-  static std::vector<metadata> metadatas_from_sources(
-    host_span<std::unique_ptr<datasource> const> sources);
+  static std::vector<std::shared_ptr<metadata const>> metadatas_from_sources(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::string const> filepaths,
+    bool read_page_indexes,
+    host_span<std::string const> selected_fields);
 
   /**
    * @brief Collect the keyvalue maps from each per-file metadata object into a vector of maps.
@@ -179,8 +231,22 @@ class aggregate_reader_metadata {
   void column_info_for_row_group(row_group_info& rg_info, size_type chunk_start_row) const;
 
  public:
+  /**
+   * @brief Parses the footers of the given sources
+   *
+   * @param sources Dataset sources
+   * @param use_arrow_schema Whether to read and use the arrow schema
+   * @param read_page_indexes Whether to read the column and offset indexes
+   * @param filepaths Paths of the sources, used to look up the footers in the footer cache. Empty
+   * if the sources are not files.
+   * @param selected_fields Names of the top-level fields whose column chunk metadata is decoded.
+   * The metadata of all column chunks is decoded if empty.
+   */
   aggregate_reader_metadata(host_span<std::unique_ptr<datasource> const> sources,
-                            bool use_arrow_schema);
+                            bool use_arrow_schema,
+                            bool read_page_indexes                       = false,
+                            host_span<std::string const> filepaths       = {},
+                            host_span<std::string const> selected_fields = {});
 
   [[nodiscard]] RowGroup const& get_row_group(size_type row_group_index, size_type src_idx) const;
 
@@ -201,7 +267,7 @@ class aggregate_reader_metadata {
 
   [[nodiscard]] auto const& get_schema(int schema_idx) const
   {
-    return per_file_metadata[0].schema[schema_idx];
+    return per_file_metadata[0]->schema[schema_idx];
   }
 
   [[nodiscard]] auto const& get_key_value_metadata() const& { return keyval_maps; }
@@ -216,7 +282,7 @@ class aggregate_reader_metadata {
    */
   [[nodiscard]] inline int get_output_nesting_depth(int schema_index) const
   {
-    auto& pfm = per_file_metadata[0];
+    auto& pfm = *per_file_metadata[0];
     int depth = 0;
 
     // walk upwards, skipping repeated fields
@@ -252,6 +318,10 @@ class aggregate_reader_metadata {
   /**
    * @brief Filters the row groups based on predicate filter
    *
+   * Equality comparisons in the filter are also checked against the split block Bloom filters of
+   * the column chunks, if present, which are read from `sources`.
+   *
+   * @param sources Dataset sources, or an empty span to skip the Bloom filters
    * @param row_group_indices Lists of row groups to read, one per source
    * @param output_dtypes Datatypes of of output columns
    * @param output_column_schemas schema indices of output columns
@@ -260,6 +330,31 @@ class aggregate_reader_metadata {
    * @return Filtered row group indices, if any is filtered.
    */
   [[nodiscard]] std::optional<std::vector<std::vector<size_type>>> filter_row_groups(
+    host_span<std::unique_ptr<datasource> const> sources,
+    host_span<std::vector<size_type> const> row_group_indices,
+    host_span<data_type const> output_dtypes,
+    host_span<int const> output_column_schemas,
+    std::reference_wrapper<ast::expression const> filter,
+    rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Filters the row groups and the rows within them based on page-level statistics
+   *
+   * The min/max values stored in the ColumnIndex of each column chunk referenced by the filter
+   * are evaluated against the predicate. Each row group is split into row fragments at every page
+   * boundary of the referenced columns, so that each fragment has a single set of min/max values
+   * per column. The possibly-matching fragments are returned as ranges of rows across all
+   * sources, in the same row space as the row ranges of the reader options.
+   *
+   * @param row_group_indices Lists of row groups to read, one per source, in file order
+   * @param output_dtypes Datatypes of of output columns
+   * @param output_column_schemas schema indices of output columns
+   * @param filter AST expression to filter pages based on ColumnIndex statistics
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return Sorted, disjoint [start, end) ranges of the rows that may satisfy the filter, if the
+   *         page indexes allow any rows to be pruned
+   */
+  [[nodiscard]] std::optional<std::vector<std::pair<int64_t, int64_t>>> filter_pages(
     host_span<std::vector<size_type> const> row_group_indices,
     host_span<data_type const> output_dtypes,
     host_span<int const> output_column_schemas,
@@ -272,24 +367,45 @@ class aggregate_reader_metadata {
    * The input `row_start` and `row_count` parameters will be recomputed and output as the valid
    * values based on the input row group list.
    *
+   * @param sources Dataset sources, used to read the Bloom filters
    * @param row_group_indices Lists of row groups to read, one per source
    * @param row_start Starting row of the selection
    * @param row_count Total number of rows selected
+   * @param row_ranges [start, end) ranges of rows to read across all sources; all rows if empty
    * @param output_dtypes Datatypes of of output columns
    * @param output_column_schemas schema indices of output columns
    * @param filter Optional AST expression to filter row groups based on Column chunk statistics
    * @param stream CUDA stream used for device memory operations and kernel launches
-   * @return A tuple of corrected row_start, row_count and list of row group indexes and its
-   *         starting row
+   * @return A tuple of corrected row_start, row_count, list of row group indexes and its
+   *         starting row, and the requested row ranges translated to the rows of the selected
+   *         row groups (empty if no row ranges were requested)
    */
-  [[nodiscard]] std::tuple<int64_t, size_type, std::vector<row_group_info>> select_row_groups(
-    host_span<std::vector<size_type> const> row_group_indices,
-    int64_t row_start,
-    std::optional<size_type> const& row_count,
-    host_span<data_type const> output_dtypes,
-    host_span<int const> output_column_schemas,
-    std::optional<std::reference_wrapper<ast::expression const>> filter,
-    rmm::cuda_stream_view stream) const;
+  [[nodiscard]] std::tuple<int64_t,
+                           size_type,
+                           std::vector<row_group_info>,
+                           std::vector<std::pair<int64_t, int64_t>>>
+  select_row_groups(host_span<std::unique_ptr<datasource> const> sources,
+                    host_span<std::vector<size_type> const> row_group_indices,
+                    int64_t row_start,
+                    std::optional<size_type> const& row_count,
+                    host_span<std::pair<int64_t, int64_t> const> row_ranges,
+                    host_span<data_type const> output_dtypes,
+                    host_span<int const> output_column_schemas,
+                    std::optional<std::reference_wrapper<ast::expression const>> filter,
+                    rmm::cuda_stream_view stream) const;
+
+  /**
+   * @brief Translates the rows selected by `select_row_groups` to row ranges across all sources
+   *
+   * @param row_groups Selected row groups with their starting rows
+   * @param row_ranges Sorted, disjoint [start, end) ranges of the rows to read, in the row space
+   *        of `row_groups`
+   * @return The same rows as [start, end) ranges across all sources, or `std::nullopt` if the
+   *         row groups are not in file order
+   */
+  [[nodiscard]] std::optional<std::vector<std::pair<int64_t, int64_t>>> to_global_row_ranges(
+    host_span<row_group_info const> row_groups,
+    host_span<std::pair<int64_t, int64_t> const> row_ranges) const;
 
   /**
    * @brief Filters and reduces down to a selection of columns
@@ -299,6 +415,7 @@ class aggregate_reader_metadata {
    * @param filter_columns_names List of paths of column names that are present only in filter
    * @param include_index Whether to always include the PANDAS index column(s)
    * @param strings_to_categorical Type conversion parameter
+   * @param strings_to_dictionary Type conversion parameter
    * @param timestamp_type_id Type conversion parameter
    *
    * @return input column information, output column information, list of output column schema
@@ -311,6 +428,7 @@ class aggregate_reader_metadata {
                  std::optional<std::vector<std::string>> const& filter_columns_names,
                  bool include_index,
                  bool strings_to_categorical,
+                 bool strings_to_dictionary,
                  type_id timestamp_type_id) const;
 };
 
@@ -374,4 +492,25 @@ class named_to_reference_converter : public ast::detail::expression_transformer
   std::optional<std::reference_wrapper<ast::expression const>> expr,
   std::vector<std::string> const& skip_names);
 
+/**
+ * @brief Get the indices of the columns referenced by index in expression object
+ *
+ * @param expr The optional expression object to get the column indices from
+ * @return The column indices present in expression object, in increasing order
+ */
+[[nodiscard]] std::vector<size_type> get_column_indices_in_expression(
+  std::optional<std::reference_wrapper<ast::expression const>> expr);
+
+/**
+ * @brief Finds the runs of consecutive rows for which a boolean column is true.
+ *
+ * Null rows are not part of any run.
+ *
+ * @param predicate Boolean column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return [start, end) row ranges of the runs, in increasing order
+ */
+[[nodiscard]] std::vector<std::pair<int64_t, int64_t>> find_true_runs(
+  column_view const& predicate, rmm::cuda_stream_view stream);
+
 }  // namespace cudf::io::parquet::detail
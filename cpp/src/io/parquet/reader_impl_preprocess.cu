@@ -15,26 +15,42 @@
  */
 
 #include "error.hpp"
+#include "io/utilities/coalescing_datasource.hpp"
+#include "io/utilities/config_utils.hpp"
 #include "reader_impl.hpp"
 
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/host_worker_pool.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/dictionary/detail/encode.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/dictionary_factories.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/utilities/memory_resource.hpp>
 
 #include <rmm/exec_policy.hpp>
 
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/fill.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/iterator_categories.h>
+#include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/logical.h>
 #include <thrust/reduce.h>
 #include <thrust/scan.h>
+#include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 #include <thrust/transform.h>
@@ -42,6 +58,7 @@
 #include <thrust/unique.h>
 
 #include <bitset>
+#include <map>
 #include <numeric>
 
 namespace cudf::io::parquet::detail {
@@ -218,6 +235,13 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
 {
   // Transfer chunk data, coalescing adjacent chunks
   std::vector<std::future<size_t>> read_tasks;
+  // Host reads, grouped by source so that multiple sources are read concurrently while each
+  // source is only accessed by a single thread at a time. Each read is {offset, size, dst}.
+  std::map<size_type, std::vector<std::tuple<size_t, size_t, uint8_t*>>> host_reads;
+  // With read coalescing enabled, the reads of each source are merged across small gaps. Each
+  // read is {first chunk, end chunk, offset, size}.
+  auto const max_gap = cudf::io::detail::read_coalescing::max_gap();
+  std::map<size_type, std::vector<std::tuple<size_t, size_t, size_t, size_t>>> coalesced_reads;
   for (size_t chunk = begin_chunk; chunk < end_chunk;) {
     size_t const io_offset   = column_chunk_offsets[chunk];
     size_t io_size           = chunks[chunk].compressed_size;
@@ -236,25 +260,31 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
       io_size += chunks[next_chunk].compressed_size;
       next_chunk++;
     }
-    if (io_size != 0) {
+    if (io_size != 0 and max_gap > 0) {
+      coalesced_reads[chunk_source_map[chunk]].emplace_back(chunk, next_chunk, io_offset, io_size);
+      chunk = next_chunk;
+    } else if (io_size != 0) {
       auto& source = sources[chunk_source_map[chunk]];
       if (source->is_device_read_preferred(io_size)) {
         // Buffer needs to be padded.
         // Required by `gpuDecodePageData`.
         auto buffer =
-          rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE), stream);
+          rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE),
+                             stream,
+                             get_temporary_memory_resource(temporary_allocation::IO_SCRATCH));
         auto fut_read_size = source->device_read_async(
           io_offset, io_size, static_cast<uint8_t*>(buffer.data()), stream);
         read_tasks.emplace_back(std::move(fut_read_size));
         page_data[chunk] = datasource::buffer::create(std::move(buffer));
       } else {
-        auto const read_buffer = source->host_read(io_offset, io_size);
         // Buffer needs to be padded.
         // Required by `gpuDecodePageData`.
-        auto tmp_buffer = rmm::device_buffer(
-          cudf::util::round_up_safe(read_buffer->size(), BUFFER_PADDING_MULTIPLE), stream);
-        CUDF_CUDA_TRY(cudaMemcpyAsync(
-          tmp_buffer.data(), read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream));
+        auto tmp_buffer =
+          rmm::device_buffer(cudf::util::round_up_safe(io_size, BUFFER_PADDING_MULTIPLE),
+                             stream,
+                             get_temporary_memory_resource(temporary_allocation::IO_SCRATCH));
+        host_reads[chunk_source_map[chunk]].emplace_back(
+          io_offset, io_size, static_cast<uint8_t*>(tmp_buffer.data()));
         page_data[chunk] = datasource::buffer::create(std::move(tmp_buffer));
       }
       auto d_compdata = page_data[chunk]->data();
@@ -266,10 +296,48 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
       chunk = next_chunk;
     }
   }
+  for (auto& [source_idx, reads] : coalesced_reads) {
+    std::vector<cudf::io::detail::read_range> ranges;
+    for (auto const& read : reads) {
+      ranges.push_back({std::get<2>(read), std::get<3>(read)});
+    }
+    cudf::io::detail::coalescing_datasource coalescer(*sources[source_idx], max_gap);
+    // Buffers need to be padded. Required by `gpuDecodePageData`.
+    read_tasks.emplace_back(coalescer.prefetch_to_device(
+      ranges,
+      BUFFER_PADDING_MULTIPLE,
+      stream,
+      get_temporary_memory_resource(temporary_allocation::IO_SCRATCH)));
+    for (auto const& [first_chunk, end, offset, size] : reads) {
+      page_data[first_chunk] = coalescer.device_read(offset, size, stream);
+      auto d_compdata        = page_data[first_chunk]->data();
+      for (auto chunk = first_chunk; chunk != end; ++chunk) {
+        chunks[chunk].compressed_data = d_compdata;
+        d_compdata += chunks[chunk].compressed_size;
+      }
+    }
+  }
+  for (auto& [source_idx, reads] : host_reads) {
+    read_tasks.emplace_back(cudf::detail::host_worker_pool().submit(
+      [source = sources[source_idx].get(), reads = std::move(reads), stream]() {
+        size_t total_read = 0;
+        for (auto const& [offset, size, dst] : reads) {
+          auto const read_buffer = source->host_read(offset, size);
+          CUDF_CUDA_TRY(cudaMemcpyAsync(
+            dst, read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream.value()));
+          total_read += read_buffer->size();
+        }
+        return total_read;
+      }));
+  }
   auto sync_fn = [](decltype(read_tasks) read_tasks) {
     for (auto& task : read_tasks) {
       task.wait();
     }
+    // rethrow any read error once none of the reads is still writing to the buffers
+    for (auto& task : read_tasks) {
+      task.get();
+    }
   };
   return std::async(std::launch::deferred, sync_fn, std::move(read_tasks));
 }
@@ -309,6 +377,18 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
   return total_pages;
 }
 
+/**
+ * @brief Return the index in the page index of the first data page of a chunk that is decoded.
+ *
+ * Leading pages that end before the first row to be read may have been dropped from the chunk.
+ */
+[[nodiscard]] size_t first_decoded_page(ColumnChunkDesc const& chunk)
+{
+  return chunk.num_dropped_rows > 0
+           ? chunk.h_chunk_info->first_page_ending_after(chunk.num_dropped_rows)
+           : 0;
+}
+
 /**
  * @brief Count the total number of pages using page index information.
  */
@@ -320,7 +400,7 @@ void generate_depth_remappings(std::map<int, std::pair<std::vector<int>, std::ve
     CUDF_EXPECTS(chunk.h_chunk_info != nullptr, "Expected non-null column info struct");
     auto const& chunk_info = *chunk.h_chunk_info;
     chunk.num_dict_pages   = chunk_info.has_dictionary() ? 1 : 0;
-    chunk.num_data_pages   = chunk_info.pages.size();
+    chunk.num_data_pages   = chunk_info.pages.size() - first_decoded_page(chunk);
     total_pages += chunk.num_data_pages + chunk.num_dict_pages;
   }
 
@@ -376,9 +456,9 @@ void fill_in_page_info(host_span<ColumnChunkDesc> chunks,
     auto const& chunk = chunks[c];
     CUDF_EXPECTS(chunk.h_chunk_info != nullptr, "Expected non-null column info struct");
     auto const& chunk_info = *chunk.h_chunk_info;
-    size_t start_row       = 0;
+    size_t start_row       = chunk.num_dropped_rows;
     page_count += chunk.num_dict_pages;
-    for (size_t p = 0; p < chunk_info.pages.size(); p++, page_count++) {
+    for (size_t p = first_decoded_page(chunk); p < chunk_info.pages.size(); p++, page_count++) {
       auto& page      = page_indexes[page_count];
       page.num_rows   = chunk_info.pages[p].num_rows;
       page.chunk_row  = start_row;
@@ -669,11 +749,28 @@ struct set_str_dict_index_ptr {
   {
     auto& chunk = chunks[i];
     if (chunk.num_dict_pages > 0 and is_string_chunk(chunk)) {
-      chunk.str_dict_index = base + str_dict_index_offsets[i];
+      chunk.str_dict_index        = base + str_dict_index_offsets[i];
+      chunk.str_dict_index_offset = str_dict_index_offsets[i];
     }
   }
 };
 
+/**
+ * @brief Functor which returns true for data pages of columns read as dictionary columns that are
+ * not dictionary encoded.
+ */
+struct is_non_dictionary_page {
+  device_span<const ColumnChunkDesc> chunks;
+
+  __device__ bool operator()(PageInfo const& page) const
+  {
+    auto const is_dictionary_encoded =
+      page.encoding == Encoding::PLAIN_DICTIONARY or page.encoding == Encoding::RLE_DICTIONARY;
+    return chunks[page.chunk_idx].is_strings_to_dict and
+           (page.flags & PAGEINFO_FLAGS_DICTIONARY) == 0 and not is_dictionary_encoded;
+  }
+};
+
 /**
  * @brief Functor which computes an estimated row count for list pages.
  *
@@ -730,6 +827,15 @@ void reader::impl::build_string_dict_indices()
 
   auto& pass = *_pass_itm_data;
 
+  // the rows of columns read as dictionary columns are decoded as positions in the dictionaries
+  if (_strings_to_dictionary) {
+    CUDF_EXPECTS(thrust::none_of(rmm::exec_policy(_stream),
+                                 pass.pages.d_begin(),
+                                 pass.pages.d_end(),
+                                 is_non_dictionary_page{pass.chunks}),
+                 "Reading strings as dictionary columns requires dictionary encoded pages");
+  }
+
   // compute number of indices per chunk and a summed total
   rmm::device_uvector<size_t> str_dict_index_count(pass.chunks.size() + 1, _stream);
   thrust::fill(
@@ -767,6 +873,83 @@ void reader::impl::build_string_dict_indices()
   pass.chunks.device_to_host_sync(_stream);
 }
 
+std::unique_ptr<column> reader::impl::make_dictionary_output(column_view const& positions,
+                                                             size_t input_col_index)
+{
+  CUDF_FUNC_RANGE();
+
+  auto& pass             = *_pass_itm_data;
+  auto const num_entries = pass.str_dict_index.size();
+
+  // Collect the positions of the dictionary entries of the column's chunks. The dictionaries are
+  // stored back to back in chunk order, so each one extends to the start of the next one.
+  std::vector<std::pair<size_t, size_t>> entry_ranges;
+  size_t next_start = num_entries;
+  for (auto c = pass.chunks.size(); c-- > 0;) {
+    auto const& chunk = pass.chunks[c];
+    if (chunk.str_dict_index == nullptr) { continue; }
+    if (chunk.src_col_index == static_cast<int32_t>(input_col_index)) {
+      entry_ranges.emplace_back(chunk.str_dict_index_offset, next_start);
+    }
+    next_start = chunk.str_dict_index_offset;
+  }
+  std::vector<size_type> h_entry_positions;
+  std::for_each(entry_ranges.rbegin(), entry_ranges.rend(), [&](auto const& range) {
+    for (auto pos = range.first; pos < range.second; ++pos) {
+      h_entry_positions.push_back(static_cast<size_type>(pos));
+    }
+  });
+  auto const num_column_entries = static_cast<size_type>(h_entry_positions.size());
+  auto const entry_positions    = cudf::detail::make_device_uvector_async(
+    h_entry_positions, _stream, rmm::mr::get_current_device_resource());
+
+  // Sort and deduplicate the dictionary entries of the chunks to build the keys
+  auto const entries =
+    thrust::make_permutation_iterator(pass.str_dict_index.begin(), entry_positions.begin());
+  auto const entry_strings = cudf::strings::detail::make_strings_column(
+    entries, entries + num_column_entries, _stream, rmm::mr::get_current_device_resource());
+
+  auto encoded_contents = cudf::dictionary::detail::encode(
+                            entry_strings->view(), data_type{type_id::UINT32}, _stream, _mr)
+                            ->release();
+  auto& entry_indices = encoded_contents.children[dictionary_column_view::indices_column_index];
+  auto& keys          = encoded_contents.children[dictionary_column_view::keys_column_index];
+
+  // Map each position in the string dictionary index of the pass to the entry of the column
+  rmm::device_uvector<size_type> position_entries(num_entries, _stream);
+  thrust::fill(
+    rmm::exec_policy_nosync(_stream), position_entries.begin(), position_entries.end(), 0);
+  thrust::scatter(rmm::exec_policy_nosync(_stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_column_entries),
+                  entry_positions.begin(),
+                  position_entries.begin());
+
+  auto indices = make_numeric_column(
+    data_type{type_id::UINT32}, positions.size(), mask_state::UNALLOCATED, _stream, _mr);
+  thrust::transform(
+    rmm::exec_policy_nosync(_stream),
+    positions.begin<size_type>(),
+    positions.end<size_type>(),
+    indices->mutable_view().begin<uint32_t>(),
+    cuda::proclaim_return_type<uint32_t>(
+      [num_entries,
+       num_column_entries,
+       position_entries = position_entries.data(),
+       entry_indices    = entry_indices->view().data<uint32_t>()] __device__(size_type position) {
+        // the positions of null rows are not decoded
+        auto const is_valid = position >= 0 and static_cast<size_t>(position) < num_entries;
+        return is_valid and num_column_entries > 0
+                 ? entry_indices[position_entries[position]]
+                 : 0u;
+      }));
+
+  return cudf::make_dictionary_column(std::move(keys),
+                                      std::move(indices),
+                                      cudf::detail::copy_bitmask(positions, _stream, _mr),
+                                      positions.null_count());
+}
+
 void reader::impl::allocate_nesting_info()
 {
   auto& pass    = *_pass_itm_data;
@@ -873,7 +1056,10 @@ void reader::impl::allocate_nesting_info()
           nesting_info[cur_depth].max_def_level = cur_schema.max_definition_level;
           pni[cur_depth].size                   = 0;
           pni[cur_depth].type =
-            to_type_id(cur_schema, _strings_to_categorical, _options.timestamp_type.id());
+            to_type_id(cur_schema,
+                       _strings_to_categorical or
+                         is_dictionary_output(cur_schema, _strings_to_dictionary),
+                       _options.timestamp_type.id());
           pni[cur_depth].nullable = cur_schema.repetition_type == OPTIONAL;
         }
 
@@ -920,13 +1106,12 @@ void reader::impl::allocate_level_decode_space()
   }
 }
 
-std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks()
+std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks(
+  host_span<row_group_info const> row_groups_info,
+  cudf::detail::hostdevice_vector<ColumnChunkDesc>& chunks,
+  std::vector<std::unique_ptr<datasource::buffer>>& raw_page_data,
+  rmm::cuda_stream_view stream)
 {
-  auto const& row_groups_info = _pass_itm_data->row_groups;
-
-  auto& raw_page_data = _pass_itm_data->raw_page_data;
-  auto& chunks        = _pass_itm_data->chunks;
-
   // Descriptors for all the chunks that make up the selected columns
   auto const num_input_columns = _input_columns.size();
   auto const num_chunks        = row_groups_info.size() * num_input_columns;
@@ -957,10 +1142,12 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
       // look up metadata
       auto& col_meta = _metadata->get_column_metadata(rg.index, rg.source_index, col.schema_idx);
 
+      // data pages dropped from the front of the chunk using the page index are not read
       column_chunk_offsets[chunk_count] =
-        (col_meta.dictionary_page_offset != 0)
-          ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
-          : col_meta.data_page_offset;
+        ((col_meta.dictionary_page_offset != 0)
+           ? std::min(col_meta.data_page_offset, col_meta.dictionary_page_offset)
+           : col_meta.data_page_offset) +
+        (col_meta.total_compressed_size - chunks[chunk_count].compressed_size);
 
       // Map each column chunk to its column index and its source index
       chunk_source_map[chunk_count] = row_group_source;
@@ -981,7 +1168,7 @@ std::pair<bool, std::vector<std::future<void>>> reader::impl::read_column_chunks
                                                       chunks.size(),
                                                       column_chunk_offsets,
                                                       chunk_source_map,
-                                                      _stream));
+                                                      stream));
 
   return {total_decompressed_size > 0, std::move(read_chunk_tasks)};
 }
@@ -995,11 +1182,36 @@ void reader::impl::read_compressed_data()
 
   auto& chunks = pass.chunks;
 
-  auto const [has_compressed_data, read_chunks_tasks] = read_column_chunks();
-  pass.has_compressed_data                            = has_compressed_data;
+  {
+    cudf::io::detail::scoped_phase_timer const timer{_statistics.get(),
+                                                     &reader_statistics::io_time};
+    if (_prefetched_pass and _prefetched_pass->pass_index == _file_itm_data._current_input_pass) {
+      // the chunk data has been read ahead of time; wait for the read and take ownership of it.
+      auto& prefetched         = *_prefetched_pass;
+      pass.has_compressed_data = prefetched.read_task.get();
+      cudf::detail::join_streams(host_span<rmm::cuda_stream_view const>{&prefetched.stream, 1},
+                                 _stream);
+      for (size_t c = 0; c < chunks.size(); c++) {
+        chunks[c].compressed_data = prefetched.chunks[c].compressed_data;
+      }
+      pass.raw_page_data = std::move(prefetched.raw_page_data);
+      _prefetched_pass.reset();
+    } else {
+      auto const [has_compressed_data, read_chunks_tasks] =
+        read_column_chunks(pass.row_groups, chunks, pass.raw_page_data, _stream);
+      pass.has_compressed_data = has_compressed_data;
 
-  for (auto& task : read_chunks_tasks) {
-    task.wait();
+      for (auto& task : read_chunks_tasks) {
+        task.wait();
+      }
+    }
+  }
+  if (_statistics != nullptr) {
+    _statistics->num_bytes_read +=
+      std::accumulate(chunks.begin(),
+                      chunks.end(),
+                      std::size_t{0},
+                      [](auto sum, auto const& chunk) { return sum + chunk.compressed_size; });
   }
 
   // Process dataset chunk pages into output columns
@@ -1106,6 +1318,19 @@ struct chunk_row_output_iter {
   __device__ reference operator*() { return p->chunk_row; }
 };
 
+/**
+ * @brief Offsets the chunk_row field of a page by the rows of the pages dropped from the front of
+ * its chunk.
+ */
+struct add_dropped_rows {
+  device_span<ColumnChunkDesc const> chunks;
+
+  __device__ void operator()(PageInfo& page) const
+  {
+    page.chunk_row += chunks[page.chunk_idx].num_dropped_rows;
+  }
+};
+
 /**
  * @brief Writes to the page_start_value field of the PageNestingInfo struct, keyed by schema.
  */
@@ -1225,6 +1450,9 @@ void reader::impl::preprocess_file(read_mode mode)
 {
   CUDF_EXPECTS(!_file_preprocessed, "Attempted to preprocess file more than once");
 
+  cudf::io::detail::scoped_phase_timer const timer{_statistics.get(),
+                                                   &reader_statistics::metadata_time};
+
   // if filter is not empty, then create output types as vector and pass for filtering.
 
   std::vector<data_type> output_dtypes;
@@ -1235,16 +1463,32 @@ void reader::impl::preprocess_file(read_mode mode)
                    [](auto const& col) { return col.type; });
   }
 
-  std::tie(
-    _file_itm_data.global_skip_rows, _file_itm_data.global_num_rows, _file_itm_data.row_groups) =
-    _metadata->select_row_groups(_options.row_group_indices,
+  std::tie(_file_itm_data.global_skip_rows,
+           _file_itm_data.global_num_rows,
+           _file_itm_data.row_groups,
+           _file_itm_data.row_ranges) =
+    _metadata->select_row_groups(_sources,
+                                 _options.row_group_indices,
                                  _options.skip_rows,
                                  _options.num_rows,
+                                 _options.row_ranges,
                                  output_dtypes,
                                  _output_column_schemas,
                                  _expr_conv.get_converted_expr(),
                                  _stream);
 
+  if (_statistics != nullptr) {
+    auto const num_row_groups =
+      _options.row_group_indices.empty()
+        ? static_cast<std::size_t>(_metadata->get_num_row_groups())
+        : std::accumulate(_options.row_group_indices.begin(),
+                          _options.row_group_indices.end(),
+                          std::size_t{0},
+                          [](auto sum, auto const& indices) { return sum + indices.size(); });
+    _statistics->num_row_groups_total += num_row_groups;
+    _statistics->num_row_groups_pruned += num_row_groups - _file_itm_data.row_groups.size();
+  }
+
   // check for page indexes
   _has_page_index = std::all_of(_file_itm_data.row_groups.begin(),
                                 _file_itm_data.row_groups.end(),
@@ -1273,7 +1517,10 @@ void reader::impl::preprocess_file(read_mode mode)
   printf("# Input columns: %'lu\n", _input_columns.size());
   for (size_t idx = 0; idx < _input_columns.size(); idx++) {
     auto const& schema = _metadata->get_schema(_input_columns[idx].schema_idx);
-    auto const type_id = to_type_id(schema, _strings_to_categorical, _options.timestamp_type.id());
+    auto const type_id =
+      to_type_id(schema,
+                 _strings_to_categorical or is_dictionary_output(schema, _strings_to_dictionary),
+                 _options.timestamp_type.id());
     printf("\tC(%'lu, %s): %s\n",
            idx,
            _input_columns[idx].name.c_str(),
@@ -1401,6 +1648,13 @@ void reader::impl::preprocess_subpass_pages(read_mode mode, size_t chunk_read_li
                                 key_input + pass.pages.size(),
                                 page_input,
                                 chunk_row_output_iter{pass.pages.device_ptr()});
+  // the rows of the pages dropped using the page index precede the first page of the chunk
+  if (_has_page_index) {
+    thrust::for_each(rmm::exec_policy_nosync(_stream),
+                     pass.pages.d_begin(),
+                     pass.pages.d_end(),
+                     add_dropped_rows{pass.chunks});
+  }
 
   // copy chunk row into the subpass pages
   // only need to do this if we are not processing the whole pass in one subpass
@@ -1445,10 +1699,10 @@ void reader::impl::preprocess_subpass_pages(read_mode mode, size_t chunk_read_li
 
     page_index += subpass.column_page_count[idx];
   }
-  subpass.skip_rows   = pass.skip_rows + pass.processed_rows;
-  auto const pass_end = pass.skip_rows + pass.num_rows;
-  max_row             = min(max_row, pass_end);
-  subpass.num_rows    = max_row - subpass.skip_rows;
+  // the subpass ends with the selected rows it starts in, or with the pass
+  subpass.skip_rows = pass.skip_rows + pass.processed_rows;
+  max_row           = min(max_row, selected_rows_end());
+  subpass.num_rows  = max_row - subpass.skip_rows;
 
   // now split up the output into chunks as necessary
   compute_output_chunks_for_subpass();
@@ -1628,4 +1882,36 @@ std::vector<size_t> reader::impl::calculate_page_string_offsets()
   return col_sizes;
 }
 
+std::vector<std::pair<int64_t, int64_t>> find_true_runs(column_view const& predicate,
+                                                        rmm::cuda_stream_view stream)
+{
+  auto const num_rows    = predicate.size();
+  auto const d_predicate = column_device_view::create(predicate, stream);
+
+  // The runs start and end at the rows where the value differs from the previous row, counting
+  // the rows before the first and after the last one as false
+  auto const is_run_boundary = cuda::proclaim_return_type<bool>(
+    [values = *d_predicate, num_rows] __device__(size_type row) {
+      auto const is_true = [&](size_type idx) {
+        return values.is_valid(idx) and values.element<bool>(idx);
+      };
+      return (row > 0 and is_true(row - 1)) != (row < num_rows and is_true(row));
+    });
+  rmm::device_uvector<size_type> boundaries(num_rows + 1, stream);
+  auto const boundaries_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                              thrust::make_counting_iterator<size_type>(0),
+                                              thrust::make_counting_iterator(num_rows + 1),
+                                              boundaries.begin(),
+                                              is_run_boundary);
+  boundaries.resize(thrust::distance(boundaries.begin(), boundaries_end), stream);
+  auto const h_boundaries = cudf::detail::make_host_vector_sync(boundaries, stream);
+
+  std::vector<std::pair<int64_t, int64_t>> runs;
+  runs.reserve(h_boundaries.size() / 2);
+  for (size_t i = 0; i + 1 < h_boundaries.size(); i += 2) {
+    runs.emplace_back(h_boundaries[i], h_boundaries[i + 1]);
+  }
+  return runs;
+}
+
 }  // namespace cudf::io::parquet::detail
@@ -19,8 +19,10 @@
  * @brief cuDF-IO parquet writer class implementation
  */
 
+#include "bloom_filter.hpp"
 #include "compact_protocol_reader.hpp"
 #include "compact_protocol_writer.hpp"
+#include "delta_enc.cuh"
 #include "io/comp/nvcomp_adapter.hpp"
 #include "io/parquet/parquet.hpp"
 #include "io/parquet/parquet_gpu.hpp"
@@ -53,9 +55,13 @@
 #include <thrust/for_each.h>
 
 #include <algorithm>
+#include <cmath>
 #include <cstring>
+#include <functional>
 #include <iterator>
+#include <limits>
 #include <numeric>
+#include <optional>
 #include <utility>
 
 #ifndef CUDF_VERSION
@@ -176,6 +182,7 @@ struct aggregate_writer_metadata {
     std::vector<KeyValue> key_value_metadata;
     std::vector<OffsetIndex> offset_indexes;
     std::vector<std::vector<uint8_t>> column_indexes;
+    std::vector<std::vector<uint8_t>> bloom_filters;  // bitset per column chunk, empty if none
   };
   std::vector<per_file_metadata> files;
   thrust::optional<std::vector<ColumnOrder>> column_orders = thrust::nullopt;
@@ -320,6 +327,8 @@ bool is_col_fixed_width(column_view const& column)
  * 3. ts_scale: scale to multiply or divide timestamp by in order to convert timestamp to parquet
  *    supported types
  * 4. requested_encoding: A user provided encoding to use for the column.
+ * 5. skip_compression: Whether to skip compression of the column.
+ * 6. write_bloom_filter: Whether to write a Bloom filter for the column.
  */
 struct schema_tree_node : public SchemaElement {
   cudf::detail::LinkedColPtr leaf_column;
@@ -327,6 +336,7 @@ struct schema_tree_node : public SchemaElement {
   int32_t ts_scale;
   column_encoding requested_encoding;
   bool skip_compression;
+  bool write_bloom_filter;
 
   // TODO(fut): Think about making schema a class that holds a vector of schema_tree_nodes. The
   // function construct_schema_tree could be its constructor. It can have method to get the per
@@ -773,6 +783,7 @@ std::vector<schema_tree_node> construct_schema_tree(
         set_encoding(col_schema, col_meta);
         col_schema.output_as_byte_array = col_meta.is_enabled_output_as_binary();
         col_schema.skip_compression     = col_meta.is_enabled_skip_compression();
+        col_schema.write_bloom_filter   = col_meta.is_enabled_bloom_filter();
         schema.push_back(col_schema);
       } else if (col->type().id() == type_id::STRUCT) {
         // if struct, add current and recursively call for all children
@@ -908,7 +919,8 @@ std::vector<schema_tree_node> construct_schema_tree(
         col_schema.leaf_column = col;
         set_field_id(col_schema, col_meta);
         set_encoding(col_schema, col_meta);
-        col_schema.skip_compression = col_meta.is_enabled_skip_compression();
+        col_schema.skip_compression   = col_meta.is_enabled_skip_compression();
+        col_schema.write_bloom_filter = col_meta.is_enabled_bloom_filter();
         schema.push_back(col_schema);
       }
     };
@@ -953,6 +965,20 @@ struct parquet_column_view {
   [[nodiscard]] uint8_t max_def_level() const noexcept { return _max_def_level; }
   [[nodiscard]] uint8_t max_rep_level() const noexcept { return _max_rep_level; }
   [[nodiscard]] bool is_list() const noexcept { return _is_list; }
+  [[nodiscard]] bool needs_dremel_data() const noexcept
+  {
+    return _is_list and not cudf_col.is_empty();
+  }
+  [[nodiscard]] bool output_as_byte_array() const noexcept
+  {
+    return schema_node.output_as_byte_array;
+  }
+  [[nodiscard]] std::vector<uint8_t> const& nullability() const noexcept { return _nullability; }
+
+  /**
+   * @brief Sets the dremel offsets and repetition and definition levels of this list column.
+   */
+  void set_dremel_data(cudf::detail::dremel_data&& dremel);
 
  private:
   // Schema related members
@@ -1056,25 +1082,53 @@ parquet_column_view::parquet_column_view(schema_tree_node const& schema_node,
 
   _is_list = (_max_rep_level > 0);
 
-  if (cudf_col.is_empty()) { return; }
-
-  if (_is_list) {
-    // Top level column's offsets are not applied to all children. Get the effective offset and
-    // size of the leaf column
-    // Calculate row offset into dremel data (repetition/definition values) and the respective
-    // definition and repetition levels
-    cudf::detail::dremel_data dremel =
-      get_dremel_data(cudf_col, _nullability, schema_node.output_as_byte_array, stream);
-    _dremel_offsets = std::move(dremel.dremel_offsets);
-    _rep_level      = std::move(dremel.rep_level);
-    _def_level      = std::move(dremel.def_level);
-    _data_count     = dremel.leaf_data_size;  // Needed for knowing what size dictionary to allocate
-
-    stream.synchronize();
-  } else {
-    // For non-list struct, the size of the root column is the same as the size of the leaf column
-    _data_count = cudf_col.size();
+  // The dremel data of list columns is set by `compute_dremel_data`, which shares it between
+  // sibling leaves. For non-list struct, the size of the root column is the same as the size of the
+  // leaf column
+  if (not _is_list) { _data_count = cudf_col.size(); }
+}
+
+void parquet_column_view::set_dremel_data(cudf::detail::dremel_data&& dremel)
+{
+  _dremel_offsets = std::move(dremel.dremel_offsets);
+  _rep_level      = std::move(dremel.rep_level);
+  _def_level      = std::move(dremel.def_level);
+  _data_count     = dremel.leaf_data_size;  // Needed for knowing what size dictionary to allocate
+}
+
+/**
+ * @brief Computes the dremel data of the list columns.
+ *
+ * The columns that are not written as byte arrays are encoded together, so that the sibling leaves
+ * of a struct column share one traversal of their list and struct ancestors.
+ *
+ * @param parquet_columns The columns to write
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compute_dremel_data(host_span<parquet_column_view> parquet_columns,
+                         rmm::cuda_stream_view stream)
+{
+  std::vector<std::size_t> shared_indices;
+  std::vector<column_view> shared_columns;
+  std::vector<std::vector<uint8_t>> shared_nullability;
+  for (std::size_t i = 0; i < parquet_columns.size(); ++i) {
+    auto& col = parquet_columns[i];
+    if (not col.needs_dremel_data()) { continue; }
+    if (col.output_as_byte_array()) {
+      col.set_dremel_data(
+        cudf::detail::get_dremel_data(col.cudf_column_view(), col.nullability(), true, stream));
+    } else {
+      shared_indices.push_back(i);
+      shared_columns.push_back(col.cudf_column_view());
+      shared_nullability.push_back(col.nullability());
+    }
+  }
+
+  auto dremel = cudf::detail::get_dremel_data(shared_columns, shared_nullability, stream);
+  for (std::size_t i = 0; i < shared_indices.size(); ++i) {
+    parquet_columns[shared_indices[i]].set_dremel_data(std::move(dremel[i]));
   }
+  stream.synchronize();
 }
 
 parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_stream_view) const
@@ -1101,6 +1155,7 @@ parquet_column_device_view parquet_column_view::get_device_view(rmm::cuda_stream
   desc.max_rep_level      = _max_rep_level;
   desc.requested_encoding = schema_node.requested_encoding;
   desc.skip_compression   = schema_node.skip_compression;
+  desc.write_bloom_filter = schema_node.write_bloom_filter;
   return desc;
 }
 
@@ -1297,6 +1352,8 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
                          Compression compression,
                          dictionary_policy dict_policy,
                          size_t max_dict_size,
+                         size_type max_page_fragment_size,
+                         std::vector<size_type>& dict_size_hints,
                          rmm::cuda_stream_view stream)
 {
   // At this point, we know all chunks and their sizes. We want to allocate dictionaries for each
@@ -1330,10 +1387,31 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
     if (is_type_non_dict || is_requested_non_dict) {
       chunk.use_dictionary = false;
     } else {
-      chunk.use_dictionary = true;
+      chunk.use_dictionary   = true;
+      chunk.max_dict_entries = MAX_DICT_SIZE;
       // cuCollections suggests using a hash map of size N * (1/0.7) = num_values * 1.43
       // https://github.com/NVIDIA/cuCollections/blob/3a49fc71/include/cuco/static_map.cuh#L190-L193
-      auto& inserted_map   = hash_maps_storage.emplace_back(chunk.num_values * 1.43, stream);
+      auto map_size = static_cast<size_t>(chunk.num_values * 1.43);
+
+      // A column whose dictionaries were small in the previous write of a chunked writer only
+      // gets room for twice as many entries. The map must also hold the values inserted by every
+      // fragment's block after the limit is crossed, so that it never fills up.
+      auto const hint = chunk.col_desc_id < static_cast<size_type>(dict_size_hints.size())
+                          ? dict_size_hints[chunk.col_desc_id]
+                          : 0;
+      if (hint > 0) {
+        auto const max_entries = std::min<size_type>(2 * hint, MAX_DICT_SIZE);
+        auto const num_frags   = util::div_rounding_up_unsafe<size_t>(chunk.num_rows,
+                                                                    max_page_fragment_size);
+        auto const hinted_size = static_cast<size_t>(max_entries * 1.43) +
+                                 num_frags * DICT_INSERT_BLOCK_SIZE + 1;
+        if (hinted_size < map_size) {
+          map_size               = hinted_size;
+          chunk.max_dict_entries = max_entries;
+        }
+      }
+
+      auto& inserted_map   = hash_maps_storage.emplace_back(map_size, stream);
       chunk.dict_map_slots = inserted_map.data();
       chunk.dict_map_size  = inserted_map.size();
     }
@@ -1346,6 +1424,48 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
 
   chunks.device_to_host_sync(stream);
 
+  // Chunks whose dictionaries outgrew the hinted limit are rebuilt with a map sized for all of
+  // their values, while the maps of the other chunks are left as they are
+  auto const is_outgrown = [](EncColumnChunk const& ck) {
+    return ck.use_dictionary and ck.max_dict_entries < MAX_DICT_SIZE and
+           ck.num_dict_entries > ck.max_dict_entries;
+  };
+  if (std::any_of(h_chunks.begin(), h_chunks.end(), is_outgrown)) {
+    std::vector<EncColumnChunk> const hinted_chunks(h_chunks.begin(), h_chunks.end());
+    for (auto& ck : h_chunks) {
+      if (is_outgrown(ck)) {
+        auto& inserted_map  = hash_maps_storage.emplace_back(ck.num_values * 1.43, stream);
+        ck.dict_map_slots   = inserted_map.data();
+        ck.dict_map_size    = inserted_map.size();
+        ck.max_dict_entries = MAX_DICT_SIZE;
+        ck.num_dict_entries = 0;
+        ck.uniq_data_size   = 0;
+      } else {
+        ck.use_dictionary = false;
+        ck.dict_map_size  = 0;
+      }
+    }
+    chunks.host_to_device_async(stream);
+    initialize_chunk_hash_maps(chunks.device_view().flat_view(), stream);
+    populate_chunk_hash_maps(frags, stream);
+    chunks.device_to_host_sync(stream);
+    for (size_t i = 0; i < h_chunks.size(); ++i) {
+      if (not is_outgrown(hinted_chunks[i])) { h_chunks[i] = hinted_chunks[i]; }
+    }
+  }
+
+  // The largest dictionary of each column hints the map sizes of the next write. Columns without
+  // a dictionary, or with one too large to be used, get no hint.
+  dict_size_hints.assign(col_desc.size(), 0);
+  for (auto const& ck : h_chunks) {
+    if (not ck.use_dictionary) { continue; }
+    auto& hint = dict_size_hints[ck.col_desc_id];
+    hint       = std::max(hint, ck.num_dict_entries);
+  }
+  for (auto& hint : dict_size_hints) {
+    if (hint > MAX_DICT_SIZE) { hint = 0; }
+  }
+
   // Make decision about which chunks have dictionary
   bool cannot_honor_request = false;
   for (auto& ck : h_chunks) {
@@ -1409,6 +1529,150 @@ build_chunk_dictionaries(hostdevice_2dvector<EncColumnChunk>& chunks,
   return std::pair(std::move(dict_data), std::move(dict_index));
 }
 
+/**
+ * @brief Computes the size of a split block Bloom filter.
+ *
+ * @param num_distinct Number of distinct values inserted into the filter
+ * @param fpp Target false positive probability
+ * @return Size of the bitset in bytes, a power of two between the minimum and maximum filter sizes
+ */
+uint32_t bloom_filter_num_bytes(size_type num_distinct, double fpp)
+{
+  // optimal number of bits for the split block filter with 8 bits set per value
+  auto const num_bits  = -8.0 * num_distinct / std::log(1.0 - std::pow(fpp, 1.0 / 8));
+  auto const min_bytes = static_cast<size_t>(std::ceil(num_bits / 8));
+  size_t num_bytes     = bloom_filter_min_bytes;
+  while (num_bytes < min_bytes and num_bytes < bloom_filter_max_bytes) {
+    num_bytes *= 2;
+  }
+  return static_cast<uint32_t>(num_bytes);
+}
+
+/**
+ * @brief Allocates and populates the Bloom filters of the column chunks that request one.
+ *
+ * Each filter is sized for the number of distinct values of its chunk, as counted while building
+ * the chunk dictionaries. Chunks without an exact count are sized for their number of values.
+ *
+ * @param chunks Column chunks, with dictionaries already built
+ * @param col_desc Column description array
+ * @param frags Column fragments
+ * @param fpp Target false positive probability
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Device storage of the Bloom filter bitsets
+ */
+rmm::device_uvector<uint32_t> build_chunk_bloom_filters(
+  hostdevice_2dvector<EncColumnChunk>& chunks,
+  host_span<parquet_column_device_view const> col_desc,
+  device_2dspan<PageFragment const> frags,
+  double fpp,
+  rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+
+  size_t total_words = 0;
+  for (auto& ck : h_chunks) {
+    auto const& col = col_desc[ck.col_desc_id];
+    // hashing booleans is pointless, and INT96 is deprecated
+    auto const is_type_supported =
+      col.physical_type != Type::BOOLEAN and col.physical_type != Type::INT96;
+    if (not col.write_bloom_filter or not is_type_supported) { continue; }
+
+    // the dictionary count is partial if building the dictionary bailed out early
+    auto const has_distinct_count =
+      ck.dict_map_slots != nullptr and ck.num_dict_entries <= MAX_DICT_SIZE;
+    ck.bloom_filter_size =
+      bloom_filter_num_bytes(has_distinct_count ? ck.num_dict_entries : ck.num_values, fpp);
+    total_words += ck.bloom_filter_size / sizeof(uint32_t);
+  }
+
+  rmm::device_uvector<uint32_t> bitsets(total_words, stream);
+  if (total_words == 0) { return bitsets; }
+
+  thrust::uninitialized_fill(rmm::exec_policy_nosync(stream), bitsets.begin(), bitsets.end(), 0);
+  auto bitset = bitsets.data();
+  for (auto& ck : h_chunks) {
+    if (ck.bloom_filter_size == 0) { continue; }
+    ck.bloom_filter_data = bitset;
+    bitset += ck.bloom_filter_size / sizeof(uint32_t);
+  }
+  chunks.host_to_device_async(stream);
+  populate_chunk_bloom_filters(frags, stream);
+
+  return bitsets;
+}
+
+/**
+ * @brief Chooses the data encoding of the column chunks that are neither dictionary encoded nor
+ * have a requested encoding, by comparing the estimated sizes of the candidate encodings.
+ *
+ * INT32 and INT64 chunks choose between PLAIN and DELTA_BINARY_PACKED, and string chunks between
+ * PLAIN and DELTA_LENGTH_BYTE_ARRAY, based on the range of the differences between adjacent
+ * values.
+ *
+ * @param chunks Column chunks, with dictionaries already built
+ * @param col_desc Column description array
+ * @param frags Column fragments
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void select_chunk_encodings(hostdevice_2dvector<EncColumnChunk>& chunks,
+                            host_span<parquet_column_device_view const> col_desc,
+                            device_2dspan<PageFragment const> frags,
+                            rmm::cuda_stream_view stream)
+{
+  auto h_chunks = chunks.host_view().flat_view();
+
+  bool has_candidates = false;
+  for (auto& ck : h_chunks) {
+    auto const& col = col_desc[ck.col_desc_id];
+    auto const is_type_supported =
+      col.physical_type == Type::INT32 or col.physical_type == Type::INT64 or
+      (col.physical_type == Type::BYTE_ARRAY and not col.output_as_byte_array);
+    ck.use_adaptive_encoding = is_type_supported and not ck.use_dictionary and
+                               col.requested_encoding == column_encoding::USE_DEFAULT;
+    if (not ck.use_adaptive_encoding) { continue; }
+
+    ck.min_delta        = std::numeric_limits<int64_t>::max();
+    ck.max_delta        = std::numeric_limits<int64_t>::min();
+    ck.num_delta_values = 0;
+    has_candidates      = true;
+  }
+  if (not has_candidates) { return; }
+
+  chunks.host_to_device_async(stream);
+  gather_chunk_delta_ranges(frags, stream);
+  chunks.device_to_host_sync(stream);
+
+  for (auto& ck : h_chunks) {
+    if (not ck.use_adaptive_encoding) { continue; }
+    auto const& col = col_desc[ck.col_desc_id];
+
+    // string lengths take 4 bytes each with PLAIN, and their data is the same with both encodings
+    size_t const value_size = col.physical_type == Type::INT64 ? sizeof(int64_t) : sizeof(int32_t);
+    size_t const num_values = ck.num_delta_values;
+    auto const plain_size   = num_values * value_size;
+
+    // deltas are stored relative to the smallest delta of their block, so the range of all the
+    // deltas bounds the bit width of every mini block
+    uint64_t const delta_range =
+      ck.max_delta < ck.min_delta
+        ? 0
+        : static_cast<uint64_t>(ck.max_delta) - static_cast<uint64_t>(ck.min_delta);
+    size_t const delta_bits = delta_range == 0 ? 0 : 64 - __builtin_clzll(delta_range);
+    // each block has a min delta of up to value_size + 1 bytes and a bit width per mini block
+    auto const num_blocks = util::div_rounding_up_unsafe(num_values, size_t{delta::block_size});
+    auto const delta_size = num_blocks * (value_size + 1 + delta::num_mini_blocks +
+                                          delta::block_size * delta_bits / 8);
+
+    ck.adaptive_encoding = [&]() {
+      if (delta_size >= plain_size) { return encode_kernel_mask::PLAIN; }
+      return col.physical_type == Type::BYTE_ARRAY ? encode_kernel_mask::DELTA_LENGTH_BA
+                                                   : encode_kernel_mask::DELTA_BINARY;
+    }();
+  }
+  chunks.host_to_device_async(stream);
+}
+
 /**
  * @brief Initialize encoder pages.
  *
@@ -1479,7 +1743,8 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
  *
  * @param chunks column chunk array
  * @param pages encoder pages array
- * @param num_rowgroups number of rowgroups
+ * @param first_rowgroup first rowgroup to encode
+ * @param num_rowgroups number of rowgroups to encode
  * @param page_stats optional page-level statistics (nullptr if none)
  * @param chunk_stats optional chunk-level statistics (nullptr if none)
  * @param column_stats optional page-level statistics for column index (nullptr if none)
@@ -1491,6 +1756,8 @@ void init_encoder_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
  */
 void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                   device_span<EncPage> pages,
+                  size_type first_rowgroup,
+                  size_type num_rowgroups,
                   statistics_chunk const* page_stats,
                   statistics_chunk const* chunk_stats,
                   statistics_chunk const* column_stats,
@@ -1500,10 +1767,19 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                   bool write_v2_headers,
                   rmm::cuda_stream_view stream)
 {
-  auto const num_pages = pages.size();
-  auto pages_stats     = (page_stats != nullptr)
-                           ? device_span<statistics_chunk const>(page_stats, num_pages)
-                           : device_span<statistics_chunk const>();
+  auto h_batch_chunks = chunks.host_view().subspan(first_rowgroup, num_rowgroups);
+  auto d_batch_chunks = chunks.device_view().subspan(first_rowgroup, num_rowgroups);
+
+  // the pages of consecutive rowgroups are contiguous
+  auto const& last_chunk     = h_batch_chunks.flat_view().back();
+  auto const first_page      = h_batch_chunks[0][0].first_page;
+  auto const num_pages       = last_chunk.first_page + last_chunk.num_pages - first_page;
+  auto const num_total_pages = pages.size();
+  auto const batch_pages     = pages.subspan(first_page, num_pages);
+
+  auto pages_stats = (page_stats != nullptr)
+                       ? device_span<statistics_chunk const>(page_stats + first_page, num_pages)
+                       : device_span<statistics_chunk const>();
 
   uint32_t max_comp_pages = (compression != Compression::UNCOMPRESSED) ? num_pages : 0;
 
@@ -1515,7 +1791,7 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
                comp_res.end(),
                compression_result{0, compression_status::FAILURE});
 
-  EncodePages(pages, write_v2_headers, comp_in, comp_out, comp_res, stream);
+  EncodePages(batch_pages, write_v2_headers, comp_in, comp_out, comp_res, stream);
   switch (compression) {
     case Compression::SNAPPY:
       if (nvcomp::is_compression_disabled(nvcomp::compression_type::SNAPPY)) {
@@ -1548,23 +1824,22 @@ void encode_pages(hostdevice_2dvector<EncColumnChunk>& chunks,
   // TBD: Not clear if the official spec actually allows dynamically turning off compression at the
   // chunk-level
 
-  auto d_chunks = chunks.device_view();
-  DecideCompression(d_chunks.flat_view(), stream);
-  EncodePageHeaders(pages, comp_res, pages_stats, chunk_stats, stream);
-  GatherPages(d_chunks.flat_view(), pages, stream);
+  auto const d_chunks = d_batch_chunks.flat_view();
+  DecideCompression(d_chunks, stream);
+  EncodePageHeaders(batch_pages, comp_res, pages_stats, chunk_stats, stream);
+  GatherPages(d_chunks, batch_pages, stream);
 
   // By now, the var_bytes has been calculated in InitPages, and the histograms in EncodePages.
   // EncodeColumnIndexes can encode the histograms in the ColumnIndex, and also sum up var_bytes
   // and the histograms for inclusion in the chunk's SizeStats.
   if (column_stats != nullptr) {
     EncodeColumnIndexes(
-      d_chunks.flat_view(), {column_stats, pages.size()}, column_index_truncate_length, stream);
+      d_chunks, {column_stats, num_total_pages}, column_index_truncate_length, stream);
   }
 
-  auto h_chunks = chunks.host_view();
-  CUDF_CUDA_TRY(cudaMemcpyAsync(h_chunks.data(),
+  CUDF_CUDA_TRY(cudaMemcpyAsync(h_batch_chunks.data(),
                                 d_chunks.data(),
-                                d_chunks.flat_view().size_bytes(),
+                                d_chunks.size_bytes(),
                                 cudaMemcpyDefault,
                                 stream.value()));
 
@@ -1653,10 +1928,30 @@ void fill_table_meta(std::unique_ptr<table_input_metadata> const& table_meta)
   }
 }
 
+/**
+ * @brief Callback writing a batch of encoded rowgroups to the sinks.
+ *
+ * Receives the aggregate metadata being updated, all encoder pages and column chunks, the
+ * rowgroup to partition mappings, the first rowgroup and number of rowgroups in the batch, and
+ * the bounce buffer.
+ */
+using write_batch_fn = std::function<void(aggregate_writer_metadata&,
+                                          device_span<EncPage const>,
+                                          host_2dspan<EncColumnChunk const>,
+                                          host_span<size_t const>,
+                                          host_span<int const>,
+                                          host_span<int const>,
+                                          size_type,
+                                          size_type,
+                                          host_span<uint8_t>)>;
+
 /**
  * @brief Perform the processing steps needed to convert the input table into the output Parquet
  * data for writing, such as compression and encoding.
  *
+ * The rowgroups are encoded in batches that fit in `max_encode_buffer_bytes`, and each batch is
+ * passed to `write_batch` before the next one is encoded.
+ *
  * @param[in,out] table_meta The table metadata
  * @param input The input table
  * @param partitions Optional partitions to divide the table into, if specified then must be same
@@ -1674,14 +1969,20 @@ void fill_table_meta(std::unique_ptr<table_input_metadata> const& table_meta)
  * @param collect_statistics Flag to indicate if statistics should be collected
  * @param dict_policy Policy for dictionary use
  * @param max_dictionary_size Maximum dictionary size, in bytes
+ * @param[in,out] dict_size_hints Number of dictionary entries of each leaf column in the previous
+ *        write, used to size the dictionary hash maps and updated for the next write
+ * @param bloom_filter_fpp Target false positive probability of Bloom filters
  * @param single_write_mode Flag to indicate that we are guaranteeing a single table write
  * @param int96_timestamps Flag to indicate if timestamps will be written as INT96
  * @param utc_timestamps Flag to indicate if timestamps are UTC
  * @param write_v2_headers True if V2 page headers are to be written
+ * @param adaptive_encoding True if data encodings are to be chosen by estimated size
+ * @param max_encode_buffer_bytes Optional maximum size of the encoded page buffers, in bytes
  * @param out_sink Sink for checking if device write is supported, should not be used to write any
  *        data in this function
+ * @param write_batch Callback writing each batch of encoded rowgroups
  * @param stream CUDA stream used for device memory operations and kernel launches
- * @return A tuple of the intermediate results containing the processed data
+ * @return A tuple of the updated aggregate metadata and the compression statistics
  */
 auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                    table_view const& input,
@@ -1699,11 +2000,16 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                                    bool collect_compression_statistics,
                                    dictionary_policy dict_policy,
                                    size_t max_dictionary_size,
+                                   std::vector<size_type>& dict_size_hints,
+                                   double bloom_filter_fpp,
                                    single_write_mode write_mode,
                                    bool int96_timestamps,
                                    bool utc_timestamps,
                                    bool write_v2_headers,
+                                   bool adaptive_encoding,
+                                   std::optional<size_t> max_encode_buffer_bytes,
                                    host_span<std::unique_ptr<data_sink> const> out_sink,
+                                   write_batch_fn const& write_batch,
                                    rmm::cuda_stream_view stream)
 {
   auto vec = table_to_linked_columns(input);
@@ -1715,6 +2021,7 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   for (schema_tree_node const& schema_node : schema_tree) {
     if (schema_node.leaf_column) { parquet_columns.emplace_back(schema_node, schema_tree, stream); }
   }
+  compute_dremel_data(parquet_columns, stream);
 
   // Mass allocation of column_device_views for each parquet_column_view
   std::vector<column_view> cudf_cols;
@@ -1947,8 +2254,22 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   }
 
   row_group_fragments.host_to_device_async(stream);
-  [[maybe_unused]] auto dict_info_owner = build_chunk_dictionaries(
-    chunks, col_desc, row_group_fragments, compression, dict_policy, max_dictionary_size, stream);
+  [[maybe_unused]] auto dict_info_owner = build_chunk_dictionaries(chunks,
+                                                                  col_desc,
+                                                                  row_group_fragments,
+                                                                  compression,
+                                                                  dict_policy,
+                                                                  max_dictionary_size,
+                                                                  max_page_fragment_size,
+                                                                  dict_size_hints,
+                                                                  stream);
+
+  // Bloom filters are sized with the distinct value counts gathered for the dictionaries, and must
+  // be kept alive until the bitsets are copied to the host.
+  auto const bloom_filter_bitsets =
+    build_chunk_bloom_filters(chunks, col_desc, row_group_fragments, bloom_filter_fpp, stream);
+
+  if (adaptive_encoding) { select_chunk_encodings(chunks, col_desc, row_group_fragments, stream); }
 
   // The code preceding this used a uniform fragment size for all columns. Now recompute
   // fragments with a (potentially) varying number of fragments per column.
@@ -2025,53 +2346,62 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
     std::fill_n(std::back_inserter(rg_to_part), num_rg_in_part[p], p);
   }
 
-  // Initialize rowgroups to encode
+  // Initialize batches of rowgroups to encode. Each batch is encoded and written to the sinks
+  // before the next one, so the page buffers only need to hold the largest batch.
   size_type num_pages        = 0;
   size_t max_uncomp_bfr_size = 0;
   size_t max_comp_bfr_size   = 0;
-  size_t max_chunk_bfr_size  = 0;
+  std::vector<size_type> batch_list;
 
   size_t column_index_bfr_size  = 0;
   size_t def_histogram_bfr_size = 0;
   size_t rep_histogram_bfr_size = 0;
-  size_t rowgroup_size          = 0;
-  size_t comp_rowgroup_size     = 0;
-  for (size_type r = 0; r <= num_rowgroups; r++) {
-    if (r < num_rowgroups) {
-      for (int i = 0; i < num_columns; i++) {
-        EncColumnChunk* ck = &chunks[r][i];
-        ck->first_page     = num_pages;
-        num_pages += ck->num_pages;
-        rowgroup_size += ck->bfr_size;
-        comp_rowgroup_size += ck->compressed_size;
-        max_chunk_bfr_size =
-          std::max(max_chunk_bfr_size, (size_t)std::max(ck->bfr_size, ck->compressed_size));
-        if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
-          auto const& col = col_desc[ck->col_desc_id];
-          column_index_bfr_size += column_index_buffer_size(ck, col, column_index_truncate_length);
-
-          // SizeStatistics are on the ColumnIndex, so only need to allocate the histograms data
-          // if we're doing page-level indexes. add 1 to num_pages for per-chunk histograms.
-          auto const num_histograms = ck->num_data_pages() + 1;
-
-          if (col.max_def_level > DEF_LVL_HIST_CUTOFF) {
-            def_histogram_bfr_size += (col.max_def_level + 1) * num_histograms;
-          }
-          if (col.max_rep_level > REP_LVL_HIST_CUTOFF) {
-            rep_histogram_bfr_size += (col.max_rep_level + 1) * num_histograms;
-          }
+  size_t batch_size             = 0;
+  size_t comp_batch_size        = 0;
+  size_type groups_in_batch     = 0;
+  for (size_type r = 0; r < num_rowgroups; r++) {
+    size_t rowgroup_size      = 0;
+    size_t comp_rowgroup_size = 0;
+    for (int i = 0; i < num_columns; i++) {
+      EncColumnChunk* ck = &chunks[r][i];
+      ck->first_page     = num_pages;
+      num_pages += ck->num_pages;
+      rowgroup_size += ck->bfr_size;
+      comp_rowgroup_size += ck->compressed_size;
+      if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
+        auto const& col = col_desc[ck->col_desc_id];
+        column_index_bfr_size += column_index_buffer_size(ck, col, column_index_truncate_length);
+
+        // SizeStatistics are on the ColumnIndex, so only need to allocate the histograms data
+        // if we're doing page-level indexes. add 1 to num_pages for per-chunk histograms.
+        auto const num_histograms = ck->num_data_pages() + 1;
+
+        if (col.max_def_level > DEF_LVL_HIST_CUTOFF) {
+          def_histogram_bfr_size += (col.max_def_level + 1) * num_histograms;
+        }
+        if (col.max_rep_level > REP_LVL_HIST_CUTOFF) {
+          rep_histogram_bfr_size += (col.max_rep_level + 1) * num_histograms;
         }
       }
     }
-    // write bfr sizes if this is the last rowgroup
-    if (r == num_rowgroups) {
-      max_uncomp_bfr_size = rowgroup_size;
-      max_comp_bfr_size   = comp_rowgroup_size;
+
+    // start a new batch if this rowgroup would take the current one over the buffer limit
+    auto const comp_bfr_size = compression == Compression::UNCOMPRESSED ? 0 : comp_rowgroup_size;
+    if (groups_in_batch != 0 and max_encode_buffer_bytes.has_value() and
+        batch_size + comp_batch_size + rowgroup_size + comp_bfr_size >
+          max_encode_buffer_bytes.value()) {
+      batch_list.push_back(groups_in_batch);
+      groups_in_batch = 0;
+      batch_size      = 0;
+      comp_batch_size = 0;
     }
+    groups_in_batch++;
+    batch_size += rowgroup_size;
+    comp_batch_size += comp_bfr_size;
+    max_uncomp_bfr_size = std::max(max_uncomp_bfr_size, batch_size);
+    max_comp_bfr_size   = std::max(max_comp_bfr_size, comp_batch_size);
   }
-
-  // Clear compressed buffer size if compression has been turned off
-  if (compression == Compression::UNCOMPRESSED) { max_comp_bfr_size = 0; }
+  if (groups_in_batch != 0) { batch_list.push_back(groups_in_batch); }
 
   // Initialize data pointers
   uint32_t const num_stats_bfr =
@@ -2099,10 +2429,11 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
   auto bfr_i = static_cast<uint8_t*>(col_idx_bfr.data());
   auto bfr_r = rep_level_histogram.data();
   auto bfr_d = def_level_histogram.data();
-  if (num_rowgroups != 0) {
+  for (size_type b = 0, r = 0; b < static_cast<size_type>(batch_list.size()); b++) {
+    // the rowgroups of each batch reuse the same page buffers
     auto bfr   = static_cast<uint8_t*>(uncomp_bfr.data());
     auto bfr_c = static_cast<uint8_t*>(comp_bfr.data());
-    for (auto r = 0; r < num_rowgroups; r++) {
+    for (auto const rg_end = r + batch_list[b]; r < rg_end; r++) {
       for (auto i = 0; i < num_columns; i++) {
         EncColumnChunk& ck   = chunks[r][i];
         ck.uncompressed_bfr  = bfr;
@@ -2146,17 +2477,25 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
                        stream);
   }
 
-  // Check device write support for all chunks and initialize bounce_buffer.
-  bool all_device_write   = true;
-  uint32_t max_write_size = 0;
   std::optional<writer_compression_statistics> comp_stats;
   if (collect_compression_statistics) { comp_stats = writer_compression_statistics{}; }
 
-  // Encode row groups
-  if (num_rowgroups != 0) {
+  // Offsets of the next chunk histograms, carried across batches
+  size_t def_histogram_offset = 0;
+  size_t rep_histogram_offset = 0;
+
+  cudf::detail::pinned_host_vector<uint8_t> bounce_buffer;
+
+  // Encode and write the rowgroups batch by batch
+  for (size_type b = 0, first_rg = 0; b < static_cast<size_type>(batch_list.size()); b++) {
+    auto const rowgroups_in_batch = batch_list[b];
+    auto const rg_end             = first_rg + rowgroups_in_batch;
+
     encode_pages(
       chunks,
       {pages.data(), pages.size()},
+      first_rg,
+      rowgroups_in_batch,
       (stats_granularity == statistics_freq::STATISTICS_PAGE) ? page_stats.data() : nullptr,
       (stats_granularity != statistics_freq::STATISTICS_NONE) ? page_stats.data() + num_pages
                                                               : nullptr,
@@ -2185,7 +2524,11 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
       }
     }
 
-    for (int r = 0; r < num_rowgroups; r++) {
+    // Check device write support for all chunks of the batch
+    bool all_device_write   = true;
+    uint32_t max_write_size = 0;
+
+    for (int r = first_rg; r < rg_end; r++) {
       int p           = rg_to_part[r];
       int global_r    = global_rowgroup_base[p] + r - first_rg_in_part[p];
       auto& row_group = agg_meta->file(p).row_groups[global_r];
@@ -2204,6 +2547,16 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
         update_chunk_encodings(column_chunk_meta.encodings, ck.encodings);
         update_chunk_encoding_stats(column_chunk_meta, ck, write_v2_headers);
 
+        if (ck.bloom_filter_data != nullptr) {
+          agg_meta->file(p).bloom_filters.push_back(cudf::detail::make_std_vector_async(
+            device_span<uint8_t const>(reinterpret_cast<uint8_t const*>(ck.bloom_filter_data),
+                                       ck.bloom_filter_size),
+            stream));
+          need_sync = true;
+        } else {
+          agg_meta->file(p).bloom_filters.emplace_back();
+        }
+
         if (ck.ck_stat_size != 0) {
           std::vector<uint8_t> const stats_blob = cudf::detail::make_std_vector_sync(
             device_span<uint8_t const>(dev_bfr, ck.ck_stat_size), stream);
@@ -2225,10 +2578,10 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
 
     // now add to the column chunk SizeStatistics if necessary
     if (stats_granularity == statistics_freq::STATISTICS_COLUMN) {
-      auto h_def_ptr = h_def_histogram.data();
-      auto h_rep_ptr = h_rep_histogram.data();
+      auto h_def_ptr = h_def_histogram.data() + def_histogram_offset;
+      auto h_rep_ptr = h_rep_histogram.data() + rep_histogram_offset;
 
-      for (int r = 0; r < num_rowgroups; r++) {
+      for (int r = first_rg; r < rg_end; r++) {
         int const p        = rg_to_part[r];
         int const global_r = global_rowgroup_base[p] + r - first_rg_in_part[p];
         auto& row_group    = agg_meta->file(p).row_groups[global_r];
@@ -2274,23 +2627,32 @@ auto convert_table_to_parquet_data(table_input_metadata& table_meta,
           }
         }
       }
+      def_histogram_offset = h_def_ptr - h_def_histogram.data();
+      rep_histogram_offset = h_rep_ptr - h_rep_histogram.data();
+    }
+
+    // The bounce buffer holds two chunks, so that the copy of a chunk overlaps with the host write
+    // of the previous one
+    auto const bounce_buffer_size = all_device_write ? 0 : 2 * size_t{max_write_size};
+    if (bounce_buffer.size() < bounce_buffer_size) {
+      bounce_buffer = cudf::detail::pinned_host_vector<uint8_t>(bounce_buffer_size);
     }
+
+    // The page buffers are reused by the next batch, so the batch is written out now
+    write_batch(*agg_meta,
+                {pages.data(), pages.size()},
+                chunks.host_view(),
+                global_rowgroup_base,
+                first_rg_in_part,
+                rg_to_part,
+                first_rg,
+                rowgroups_in_batch,
+                bounce_buffer);
+
+    first_rg = rg_end;
   }
 
-  auto bounce_buffer =
-    cudf::detail::pinned_host_vector<uint8_t>(all_device_write ? 0 : max_write_size);
-
-  return std::tuple{std::move(agg_meta),
-                    std::move(pages),
-                    std::move(chunks),
-                    std::move(global_rowgroup_base),
-                    std::move(first_rg_in_part),
-                    std::move(rg_to_part),
-                    std::move(comp_stats),
-                    std::move(uncomp_bfr),
-                    std::move(comp_bfr),
-                    std::move(col_idx_bfr),
-                    std::move(bounce_buffer)};
+  return std::tuple{std::move(agg_meta), std::move(comp_stats)};
 }
 
 }  // namespace
@@ -2308,10 +2670,13 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _stats_granularity(options.get_stats_level()),
     _dict_policy(options.get_dictionary_policy()),
     _max_dictionary_size(options.get_max_dictionary_size()),
+    _bloom_filter_fpp(options.get_bloom_filter_fpp()),
     _max_page_fragment_size(options.get_max_page_fragment_size()),
+    _max_encode_buffer_bytes(options.get_max_encode_buffer_bytes()),
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
     _write_v2_headers(options.is_enabled_write_v2_headers()),
+    _adaptive_encoding(options.is_enabled_adaptive_encoding()),
     _sorting_columns(options.get_sorting_columns()),
     _column_index_truncate_length(options.get_column_index_truncate_length()),
     _kv_meta(options.get_key_value_metadata()),
@@ -2338,10 +2703,13 @@ writer::impl::impl(std::vector<std::unique_ptr<data_sink>> sinks,
     _stats_granularity(options.get_stats_level()),
     _dict_policy(options.get_dictionary_policy()),
     _max_dictionary_size(options.get_max_dictionary_size()),
+    _bloom_filter_fpp(options.get_bloom_filter_fpp()),
     _max_page_fragment_size(options.get_max_page_fragment_size()),
+    _max_encode_buffer_bytes(options.get_max_encode_buffer_bytes()),
     _int96_timestamps(options.is_enabled_int96_timestamps()),
     _utc_timestamps(options.is_enabled_utc_timestamps()),
     _write_v2_headers(options.is_enabled_write_v2_headers()),
+    _adaptive_encoding(options.is_enabled_adaptive_encoding()),
     _sorting_columns(options.get_sorting_columns()),
     _column_index_truncate_length(options.get_column_index_truncate_length()),
     _kv_meta(options.get_key_value_metadata()),
@@ -2385,20 +2753,34 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
   if (not _table_meta) { _table_meta = std::make_unique<table_input_metadata>(input); }
   fill_table_meta(_table_meta);
 
-  // All kinds of memory allocation and data compressions/encoding are performed here.
-  // If any error occurs, such as out-of-memory exception, the internal state of the current
-  // writer is still intact.
-  [[maybe_unused]] auto [updated_agg_meta,
-                         pages,
-                         chunks,
-                         global_rowgroup_base,
-                         first_rg_in_part,
-                         rg_to_part,
-                         comp_stats,
-                         uncomp_bfr,   // unused, but contains data for later write to sink
-                         comp_bfr,     // unused, but contains data for later write to sink
-                         col_idx_bfr,  // unused, but contains data for later write to sink
-                         bounce_buffer] = [&] {
+  // All kinds of memory allocation and data compressions/encoding are performed here. The
+  // encoded rowgroups are written to the sinks in batches as they are ready. If any error occurs
+  // before the first batch is written, such as out-of-memory exception, the internal state of the
+  // current writer is still intact.
+  bool has_written_data = false;
+
+  auto const write_batch = [&](aggregate_writer_metadata& updated_agg_meta,
+                               device_span<EncPage const> pages,
+                               host_2dspan<EncColumnChunk const> chunks,
+                               host_span<size_t const> global_rowgroup_base,
+                               host_span<int const> first_rg_in_part,
+                               host_span<int const> rg_to_part,
+                               size_type first_rowgroup,
+                               size_type num_rowgroups,
+                               host_span<uint8_t> bounce_buffer) {
+    has_written_data = true;
+    write_parquet_data_to_sink(updated_agg_meta,
+                               pages,
+                               chunks,
+                               global_rowgroup_base,
+                               first_rg_in_part,
+                               rg_to_part,
+                               first_rowgroup,
+                               num_rowgroups,
+                               bounce_buffer);
+  };
+
+  auto [updated_agg_meta, comp_stats] = [&] {
     try {
       return convert_table_to_parquet_data(*_table_meta,
                                            input,
@@ -2416,74 +2798,99 @@ void writer::impl::write(table_view const& input, std::vector<partition_info> co
                                            _compression_statistics != nullptr,
                                            _dict_policy,
                                            _max_dictionary_size,
+                                           _dict_size_hints,
+                                           _bloom_filter_fpp,
                                            _single_write_mode,
                                            _int96_timestamps,
                                            _utc_timestamps,
                                            _write_v2_headers,
+                                           _adaptive_encoding,
+                                           _max_encode_buffer_bytes,
                                            _out_sink,
+                                           write_batch,
                                            _stream);
     } catch (...) {  // catch any exception type
-      CUDF_LOG_ERROR(
-        "Parquet writer encountered exception during processing. "
-        "No data has been written to the sink.");
+      if (has_written_data) {
+        CUDF_LOG_ERROR(
+          "Parquet writer encountered exception during processing. "
+          "Part of the data has been written to the sink.");
+      } else {
+        CUDF_LOG_ERROR(
+          "Parquet writer encountered exception during processing. "
+          "No data has been written to the sink.");
+      }
       throw;  // this throws the same exception
     }
   }();
-
-  // Compression/encoding were all successful. Now write the intermediate results.
-  write_parquet_data_to_sink(updated_agg_meta,
-                             pages,
-                             chunks,
-                             global_rowgroup_base,
-                             first_rg_in_part,
-                             rg_to_part,
-                             bounce_buffer);
+  _agg_meta = std::move(updated_agg_meta);
 
   update_compression_statistics(comp_stats);
 
   _last_write_successful = true;
 }
 
-void writer::impl::write_parquet_data_to_sink(
-  std::unique_ptr<aggregate_writer_metadata>& updated_agg_meta,
-  device_span<EncPage const> pages,
-  host_2dspan<EncColumnChunk const> chunks,
-  host_span<size_t const> global_rowgroup_base,
-  host_span<int const> first_rg_in_part,
-  host_span<int const> rg_to_part,
-  host_span<uint8_t> bounce_buffer)
+void writer::impl::write_parquet_data_to_sink(aggregate_writer_metadata& updated_agg_meta,
+                                              device_span<EncPage const> pages,
+                                              host_2dspan<EncColumnChunk const> chunks,
+                                              host_span<size_t const> global_rowgroup_base,
+                                              host_span<int const> first_rg_in_part,
+                                              host_span<int const> rg_to_part,
+                                              size_type first_rowgroup,
+                                              size_type num_rowgroups,
+                                              host_span<uint8_t> bounce_buffer)
 {
-  _agg_meta                = std::move(updated_agg_meta);
-  auto const num_rowgroups = chunks.size().first;
-  auto const num_columns   = chunks.size().second;
+  auto const num_columns = chunks.size().second;
+  auto const rg_end      = first_rowgroup + num_rowgroups;
 
   if (num_rowgroups != 0) {
     std::vector<std::future<void>> write_tasks;
 
-    for (auto r = 0; r < static_cast<int>(num_rowgroups); r++) {
+    // Chunks written from host memory alternate between the two halves of the bounce buffer. The
+    // copy of a chunk to one half runs on the device while the previous chunk is written to its
+    // sink from the other half. The sinks are only called from this thread, in order.
+    auto const bounce_half_size = bounce_buffer.size() / 2;
+    int bounce_half             = 0;
+    struct host_write_args {
+      data_sink* sink;
+      uint8_t const* data;
+      size_t size;
+    };
+    std::optional<host_write_args> pending_host_write;
+    auto const write_pending_chunk = [&] {
+      if (pending_host_write.has_value()) {
+        pending_host_write->sink->host_write(pending_host_write->data, pending_host_write->size);
+        pending_host_write.reset();
+      }
+    };
+
+    for (auto r = first_rowgroup; r < rg_end; r++) {
       int const p        = rg_to_part[r];
       int const global_r = global_rowgroup_base[p] + r - first_rg_in_part[p];
-      auto& row_group    = _agg_meta->file(p).row_groups[global_r];
+      auto& row_group    = updated_agg_meta.file(p).row_groups[global_r];
 
       for (std::size_t i = 0; i < num_columns; i++) {
         auto const& ck     = chunks[r][i];
         auto const dev_bfr = ck.is_compressed ? ck.compressed_bfr : ck.uncompressed_bfr;
 
         // Skip the range [0, ck.ck_stat_size) since it has already been copied to host
-        // and stored in _agg_meta before.
+        // and stored in updated_agg_meta before.
         if (_out_sink[p]->is_device_write_preferred(ck.compressed_size)) {
+          write_pending_chunk();
           write_tasks.push_back(_out_sink[p]->device_write_async(
             dev_bfr + ck.ck_stat_size, ck.compressed_size, _stream));
         } else {
-          CUDF_EXPECTS(bounce_buffer.size() >= ck.compressed_size,
+          CUDF_EXPECTS(bounce_half_size >= ck.compressed_size,
                        "Bounce buffer was not properly initialized.");
-          CUDF_CUDA_TRY(cudaMemcpyAsync(bounce_buffer.data(),
+          auto const bounce_data = bounce_buffer.data() + bounce_half * bounce_half_size;
+          CUDF_CUDA_TRY(cudaMemcpyAsync(bounce_data,
                                         dev_bfr + ck.ck_stat_size,
                                         ck.compressed_size,
                                         cudaMemcpyDefault,
                                         _stream.value()));
+          write_pending_chunk();
           _stream.synchronize();
-          _out_sink[p]->host_write(bounce_buffer.data(), ck.compressed_size);
+          pending_host_write = host_write_args{_out_sink[p].get(), bounce_data, ck.compressed_size};
+          bounce_half        = 1 - bounce_half;
         }
 
         auto const chunk_offset = _current_chunk_offset[p];
@@ -2497,22 +2904,27 @@ void writer::impl::write_parquet_data_to_sink(
         if (i == 0) { row_group.file_offset = chunk_offset; }
       }
     }
+    write_pending_chunk();
     for (auto const& task : write_tasks) {
       task.wait();
     }
   }
 
   if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
-    // need pages on host to create offset_indexes
-    auto const h_pages = cudf::detail::make_host_vector_sync(pages, _stream);
-
     // add column and offset indexes to metadata
     if (num_rowgroups != 0) {
-      auto curr_page_idx = chunks[0][0].first_page;
-      for (auto r = 0; r < static_cast<int>(num_rowgroups); r++) {
+      // need the pages of the batch on host to create offset_indexes
+      auto const& last_chunk = chunks[rg_end - 1][num_columns - 1];
+      auto const first_page  = chunks[first_rowgroup][0].first_page;
+      auto const h_pages     = cudf::detail::make_host_vector_sync(
+        pages.subspan(first_page, last_chunk.first_page + last_chunk.num_pages - first_page),
+        _stream);
+
+      size_t curr_page_idx = 0;
+      for (auto r = first_rowgroup; r < rg_end; r++) {
         int const p           = rg_to_part[r];
         int const global_r    = global_rowgroup_base[p] + r - first_rg_in_part[p];
-        auto const& row_group = _agg_meta->file(p).row_groups[global_r];
+        auto const& row_group = updated_agg_meta.file(p).row_groups[global_r];
         for (std::size_t i = 0; i < num_columns; i++) {
           EncColumnChunk const& ck      = chunks[r][i];
           auto const& column_chunk_meta = row_group.columns[i].meta_data;
@@ -2551,8 +2963,8 @@ void writer::impl::write_parquet_data_to_sink(
           if (is_byte_arr) { offset_idx.unencoded_byte_array_data_bytes = std::move(var_bytes); }
 
           _stream.synchronize();
-          _agg_meta->file(p).offset_indexes.emplace_back(std::move(offset_idx));
-          _agg_meta->file(p).column_indexes.emplace_back(std::move(column_idx));
+          updated_agg_meta.file(p).offset_indexes.emplace_back(std::move(offset_idx));
+          updated_agg_meta.file(p).column_indexes.emplace_back(std::move(column_idx));
         }
       }
     }
@@ -2571,9 +2983,26 @@ std::unique_ptr<std::vector<uint8_t>> writer::impl::close(
     file_ender_s fendr;
     auto& fmd = _agg_meta->file(p);
 
+    // write Bloom filters, updating column metadata along the way
+    int chunkidx = 0;
+    for (auto& r : fmd.row_groups) {
+      for (auto& c : r.columns) {
+        auto const& bitset = fmd.bloom_filters[chunkidx++];
+        if (bitset.empty()) { continue; }
+        BloomFilterHeader header;
+        header.num_bytes = bitset.size();
+        buffer.resize(0);
+        int32_t const len               = cpw.write(header);
+        c.meta_data.bloom_filter_offset = _out_sink[p]->bytes_written();
+        c.meta_data.bloom_filter_length = len + header.num_bytes;
+        _out_sink[p]->host_write(buffer.data(), buffer.size());
+        _out_sink[p]->host_write(bitset.data(), bitset.size());
+      }
+    }
+
     if (_stats_granularity == statistics_freq::STATISTICS_COLUMN) {
       // write column indices, updating column metadata along the way
-      int chunkidx = 0;
+      chunkidx = 0;
       for (auto& r : fmd.row_groups) {
         for (auto& c : r.columns) {
           auto const& index     = fmd.column_indexes[chunkidx++];
@@ -119,25 +119,30 @@ class writer::impl {
 
  private:
   /**
-   * @brief Write the intermediate Parquet data into the data sink.
+   * @brief Write a batch of the intermediate Parquet data into the data sink.
    *
    * The intermediate data is generated from processing (compressing/encoding) a cuDF input table
-   * by `convert_table_to_parquet_data` called in the `write()` function.
+   * by `convert_table_to_parquet_data` called in the `write()` function, which passes each batch
+   * of encoded rowgroups here before encoding the next one.
    *
-   * @param updated_agg_meta The updated aggregate data after processing the input
+   * @param[in,out] updated_agg_meta The aggregate data being updated with the processed input
    * @param pages Encoded pages
    * @param chunks Column chunks
    * @param global_rowgroup_base Numbers of rowgroups in each file/partition
    * @param first_rg_in_part The first rowgroup in each partition
    * @param rg_to_part A map from rowgroup to partition
+   * @param first_rowgroup The first rowgroup of the batch
+   * @param num_rowgroups The number of rowgroups in the batch
    * @param[out] bounce_buffer Temporary host output buffer
    */
-  void write_parquet_data_to_sink(std::unique_ptr<aggregate_writer_metadata>& updated_agg_meta,
+  void write_parquet_data_to_sink(aggregate_writer_metadata& updated_agg_meta,
                                   device_span<EncPage const> pages,
                                   host_2dspan<EncColumnChunk const> chunks,
                                   host_span<size_t const> global_rowgroup_base,
                                   host_span<int const> first_rg_in_part,
                                   host_span<int const> rg_to_part,
+                                  size_type first_rowgroup,
+                                  size_type num_rowgroups,
                                   host_span<uint8_t> bounce_buffer);
 
   // Cuda stream to be used
@@ -152,10 +157,13 @@ class writer::impl {
   statistics_freq const _stats_granularity;
   dictionary_policy const _dict_policy;
   size_t const _max_dictionary_size;
+  double const _bloom_filter_fpp;
   std::optional<size_type> const _max_page_fragment_size;
+  std::optional<size_t> const _max_encode_buffer_bytes;
   bool const _int96_timestamps;
   bool const _utc_timestamps;
   bool const _write_v2_headers;
+  bool const _adaptive_encoding;
   std::optional<std::vector<sorting_column>> _sorting_columns;
   int32_t const _column_index_truncate_length;
   std::vector<std::map<std::string, std::string>> const _kv_meta;  // Optional user metadata.
@@ -172,6 +180,8 @@ class writer::impl {
                                                    // completed successfully current write
                                                    // position for rowgroups/chunks.
   std::shared_ptr<writer_compression_statistics> _compression_statistics;  // Optional output
+  std::vector<size_type> _dict_size_hints;  // Dictionary entries of each leaf column in the last
+                                            // write, used to size the next write's hash maps
   bool _last_write_successful = false;
   bool _closed                = false;  // To track if the output has been written to sink.
 };
@@ -0,0 +1,508 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/comp/nvcomp_adapter.hpp"
+#include "io/text/device_data_chunks.hpp"
+#include "io/utilities/hostdevice_vector.hpp"
+
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/io/text/data_chunk_source_factories.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <fstream>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cudf::io::text {
+namespace {
+
+// Target size of the data decompressed at once
+constexpr std::size_t block_size = 1 << 24;
+
+/**
+ * @brief Decompresses the contents of a file block by block into device memory.
+ */
+class block_decompressor {
+ public:
+  virtual ~block_decompressor() = default;
+
+  /**
+   * @brief Decompresses the next block of the input.
+   *
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The decompressed block, or an empty buffer if the end of the input has been reached
+   */
+  virtual rmm::device_uvector<char> decompress_next_block(rmm::cuda_stream_view stream) = 0;
+};
+
+/**
+ * @brief Decompresses a GZIP file on the host with zlib.
+ *
+ * DEFLATE streams can only be decompressed sequentially. Files consisting of multiple GZIP
+ * members, like BGZIP files, are decompressed one member after another.
+ */
+class gzip_block_decompressor : public block_decompressor {
+  constexpr static std::size_t input_buffer_size = 1 << 20;
+
+ public:
+  gzip_block_decompressor(std::string const& filename)
+    : _input(filename, std::ifstream::in | std::ifstream::binary), _input_buffer(input_buffer_size)
+  {
+    CUDF_EXPECTS(_input.is_open(), "Cannot open the input file");
+    // 16 + MAX_WBITS only accepts streams with GZIP headers
+    CUDF_EXPECTS(inflateInit2(&_strm, 16 + MAX_WBITS) == Z_OK,
+                 "Failed to initialize GZIP decompression");
+  }
+
+  ~gzip_block_decompressor() override { inflateEnd(&_strm); }
+
+  rmm::device_uvector<char> decompress_next_block(rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+    _output_buffer.resize(block_size);
+    _strm.next_out  = reinterpret_cast<Bytef*>(_output_buffer.data());
+    _strm.avail_out = block_size;
+
+    while (_strm.avail_out > 0) {
+      if (_strm.avail_in == 0) {
+        _input.read(_input_buffer.data(), _input_buffer.size());
+        auto const read_size = _input.gcount();
+        if (read_size == 0) {
+          CUDF_EXPECTS(not _is_in_member, "Unexpected end of GZIP stream");
+          break;
+        }
+        _strm.next_in  = reinterpret_cast<Bytef*>(_input_buffer.data());
+        _strm.avail_in = static_cast<uInt>(read_size);
+      }
+      _is_in_member   = true;
+      auto const zerr = inflate(&_strm, Z_NO_FLUSH);
+      if (zerr == Z_STREAM_END) {
+        // continue with the next member, if there is any
+        CUDF_EXPECTS(inflateReset(&_strm) == Z_OK, "Failed to reset GZIP decompression");
+        _is_in_member = false;
+      } else {
+        CUDF_EXPECTS(zerr == Z_OK, "Error in GZIP stream");
+      }
+    }
+
+    auto const size = block_size - _strm.avail_out;
+    auto block      = rmm::device_uvector<char>(size, stream);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(
+      block.data(), _output_buffer.data(), size, cudaMemcpyDefault, stream.value()));
+    // the output buffer is reused for the next block
+    stream.synchronize();
+    return block;
+  }
+
+ private:
+  std::ifstream _input;
+  std::vector<char> _input_buffer;
+  cudf::detail::pinned_host_vector<char> _output_buffer;
+  z_stream _strm{};
+  bool _is_in_member = false;
+};
+
+/**
+ * @brief Decompresses a ZSTD file on the device with nvCOMP.
+ *
+ * The frames of the file are located on the host and decompressed in batches, so files with
+ * multiple frames are decompressed in parallel.
+ */
+class zstd_block_decompressor : public block_decompressor {
+  constexpr static uint32_t frame_magic             = 0xFD2FB528u;
+  constexpr static uint32_t skippable_frame_magic   = 0x184D2A50u;
+  constexpr static uint32_t skippable_frame_mask    = 0xFFFFFFF0u;
+  constexpr static std::size_t max_block_decompress = 1 << 17;  // 128KB
+
+  struct frame_info {
+    std::size_t offset;            // offset of the frame in the compressed batch
+    std::size_t size;              // compressed size of the frame
+    std::size_t max_decompressed;  // upper bound of the decompressed size of the frame
+  };
+
+ public:
+  zstd_block_decompressor(std::string const& filename)
+    : _input(filename, std::ifstream::in | std::ifstream::binary)
+  {
+    CUDF_EXPECTS(_input.is_open(), "Cannot open the input file");
+    CUDF_EXPECTS(not nvcomp::is_decompression_disabled(nvcomp::compression_type::ZSTD),
+                 "ZSTD decompression is not available");
+  }
+
+  rmm::device_uvector<char> decompress_next_block(rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+    // read whole frames until the batch reaches the block size
+    _compressed.clear();
+    std::vector<frame_info> frames;
+    while (_compressed.size() < block_size) {
+      auto frame = read_frame();
+      if (not frame.has_value()) { break; }
+      frames.push_back(frame.value());
+    }
+    if (frames.empty()) { return rmm::device_uvector<char>(0, stream); }
+    auto const num_frames = frames.size();
+
+    auto const d_compressed = cudf::detail::make_device_uvector_async(
+      host_span<uint8_t const>{_compressed.data(), _compressed.size()},
+      stream,
+      rmm::mr::get_current_device_resource());
+
+    std::size_t total_max_decompressed = 0;
+    std::size_t max_frame_decompressed = 0;
+    for (auto const& frame : frames) {
+      total_max_decompressed += frame.max_decompressed;
+      max_frame_decompressed = std::max(max_frame_decompressed, frame.max_decompressed);
+    }
+    auto d_decompressed = rmm::device_uvector<uint8_t>(total_max_decompressed, stream);
+
+    auto inputs  = cudf::detail::hostdevice_vector<device_span<uint8_t const>>(num_frames, stream);
+    auto outputs = cudf::detail::hostdevice_vector<device_span<uint8_t>>(num_frames, stream);
+    auto results = cudf::detail::hostdevice_vector<compression_result>(num_frames, stream);
+
+    std::size_t output_offset = 0;
+    for (std::size_t i = 0; i < num_frames; ++i) {
+      inputs[i]  = device_span<uint8_t const>{d_compressed.data() + frames[i].offset,
+                                             frames[i].size};
+      outputs[i] = device_span<uint8_t>{d_decompressed.data() + output_offset,
+                                        frames[i].max_decompressed};
+      results[i] = compression_result{0, compression_status::FAILURE};
+      output_offset += frames[i].max_decompressed;
+    }
+    inputs.host_to_device_async(stream);
+    outputs.host_to_device_async(stream);
+    results.host_to_device_async(stream);
+
+    nvcomp::batched_decompress(nvcomp::compression_type::ZSTD,
+                               inputs,
+                               outputs,
+                               results,
+                               max_frame_decompressed,
+                               total_max_decompressed,
+                               stream);
+    results.device_to_host_sync(stream);
+
+    // compact the decompressed frames into a contiguous block
+    std::size_t size = 0;
+    for (auto const& result : results) {
+      CUDF_EXPECTS(result.status == compression_status::SUCCESS, "ZSTD decompression failed");
+      size += result.bytes_written;
+    }
+    auto block = rmm::device_uvector<char>(size, stream);
+    size       = 0;
+    for (std::size_t i = 0; i < num_frames; ++i) {
+      CUDF_CUDA_TRY(cudaMemcpyAsync(block.data() + size,
+                                    outputs[i].data(),
+                                    results[i].bytes_written,
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      size += results[i].bytes_written;
+    }
+    return block;
+  }
+
+ private:
+  /**
+   * @brief Appends the given number of bytes of the input to the compressed batch.
+   */
+  void read_bytes(std::size_t size)
+  {
+    auto const offset = _compressed.size();
+    _compressed.resize(offset + size);
+    _input.read(reinterpret_cast<char*>(_compressed.data() + offset), size);
+    CUDF_EXPECTS(static_cast<std::size_t>(_input.gcount()) == size,
+                 "Unexpected end of ZSTD stream");
+  }
+
+  [[nodiscard]] uint32_t read_le(std::size_t offset, std::size_t size) const
+  {
+    uint32_t value = 0;
+    for (std::size_t i = 0; i < size; ++i) {
+      value |= static_cast<uint32_t>(_compressed[offset + i]) << (8 * i);
+    }
+    return value;
+  }
+
+  /**
+   * @brief Appends the next frame of the input to the compressed batch, skipping skippable
+   * frames.
+   *
+   * @return The location of the frame, or `std::nullopt` at the end of the input
+   */
+  std::optional<frame_info> read_frame()
+  {
+    while (true) {
+      auto const offset = _compressed.size();
+      if (_input.peek() == std::ifstream::traits_type::eof()) { return std::nullopt; }
+      read_bytes(4);
+      auto const magic = read_le(offset, 4);
+      if ((magic & skippable_frame_mask) == skippable_frame_magic) {
+        read_bytes(4);
+        auto const skip_size = read_le(offset + 4, 4);
+        _input.ignore(skip_size);
+        CUDF_EXPECTS(static_cast<std::size_t>(_input.gcount()) == skip_size,
+                     "Unexpected end of ZSTD stream");
+        _compressed.resize(offset);
+        continue;
+      }
+      CUDF_EXPECTS(magic == frame_magic, "Invalid ZSTD frame");
+
+      // frame header: descriptor, window descriptor, dictionary id, frame content size
+      read_bytes(1);
+      constexpr std::size_t dictionary_id_sizes[] = {0, 1, 2, 4};
+      constexpr std::size_t content_size_sizes[]  = {0, 2, 4, 8};
+      auto const descriptor         = _compressed[offset + 4];
+      auto const content_size_flag  = descriptor >> 6;
+      auto const is_single_segment  = ((descriptor >> 5) & 1) != 0;
+      auto const has_checksum       = ((descriptor >> 2) & 1) != 0;
+      auto const dictionary_id_flag = descriptor & 3;
+      auto const content_size_size =
+        content_size_flag == 0 and is_single_segment ? 1 : content_size_sizes[content_size_flag];
+      auto const window_size = is_single_segment ? 0 : 1;
+      read_bytes(window_size + dictionary_id_sizes[dictionary_id_flag] + content_size_size);
+
+      // blocks: a 3-byte header followed by the block content
+      std::size_t max_decompressed = 0;
+      bool is_last_block           = false;
+      while (not is_last_block) {
+        auto const header_offset = _compressed.size();
+        read_bytes(3);
+        auto const header     = read_le(header_offset, 3);
+        is_last_block         = (header & 1) != 0;
+        auto const block_type = (header >> 1) & 3;
+        auto const size       = static_cast<std::size_t>(header >> 3);
+        switch (block_type) {
+          case 0:  // raw
+            read_bytes(size);
+            max_decompressed += size;
+            break;
+          case 1:  // RLE
+            read_bytes(1);
+            max_decompressed += size;
+            break;
+          case 2:  // compressed
+            read_bytes(size);
+            max_decompressed += max_block_decompress;
+            break;
+          default: CUDF_FAIL("Invalid ZSTD block type");
+        }
+      }
+      if (has_checksum) { read_bytes(4); }
+      return frame_info{offset, _compressed.size() - offset, max_decompressed};
+    }
+  }
+
+  std::ifstream _input;
+  cudf::detail::pinned_host_vector<uint8_t> _compressed;
+};
+
+/**
+ * @brief A reader which produces owning chunks of device memory which contain the decompressed
+ * data of a file.
+ *
+ * The blocks are decompressed on a background thread, which stays up to `num_prefetch_blocks`
+ * blocks ahead of the reader, so decompression overlaps with the processing of the chunks.
+ */
+class decompressing_data_chunk_reader : public data_chunk_reader {
+  constexpr static std::size_t num_prefetch_blocks = 2;
+
+ public:
+  decompressing_data_chunk_reader(std::unique_ptr<block_decompressor> decompressor)
+    : _decompressor(std::move(decompressor))
+  {
+    int device;
+    CUDF_CUDA_TRY(cudaGetDevice(&device));
+    _worker = std::thread([this, device] { decompress_blocks(device); });
+  }
+
+  ~decompressing_data_chunk_reader() override
+  {
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _is_stopped = true;
+    }
+    _condition.notify_all();
+    _worker.join();
+  }
+
+  void skip_bytes(std::size_t size) override
+  {
+    while (size > 0) {
+      if (_position == _current.size() and not load_next_block()) { break; }
+      auto const skip_size = std::min(size, _current.size() - _position);
+      _position += skip_size;
+      size -= skip_size;
+    }
+  }
+
+  std::unique_ptr<device_data_chunk> get_next_chunk(std::size_t read_size,
+                                                    rmm::cuda_stream_view stream) override
+  {
+    CUDF_FUNC_RANGE();
+    _read_stream = stream;
+
+    auto chunk         = rmm::device_uvector<char>(read_size, stream);
+    std::size_t copied = 0;
+    while (copied < read_size) {
+      if (_position == _current.size() and not load_next_block()) { break; }
+      auto const copy_size = std::min(read_size - copied, _current.size() - _position);
+      CUDF_CUDA_TRY(cudaMemcpyAsync(chunk.data() + copied,
+                                    _current.data() + _position,
+                                    copy_size,
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      _position += copy_size;
+      copied += copy_size;
+    }
+    // shrinking doesn't allocate/free
+    chunk.resize(copied, stream);
+
+    return std::make_unique<device_uvector_data_chunk>(std::move(chunk));
+  }
+
+ private:
+  /**
+   * @brief Decompresses the blocks of the input until it ends or the reader is destroyed.
+   */
+  void decompress_blocks(int device)
+  {
+    try {
+      CUDF_CUDA_TRY(cudaSetDevice(device));
+      while (true) {
+        {
+          std::unique_lock<std::mutex> lock(_mutex);
+          _condition.wait(lock,
+                          [this] { return _is_stopped or _blocks.size() < num_prefetch_blocks; });
+          if (_is_stopped) { return; }
+        }
+        auto block = _decompressor->decompress_next_block(_stream.view());
+        _stream.synchronize();
+        auto const is_input_end = block.is_empty();
+        {
+          std::lock_guard<std::mutex> lock(_mutex);
+          if (is_input_end) {
+            _is_input_end = true;
+          } else {
+            _blocks.push_back(std::move(block));
+          }
+        }
+        _condition.notify_all();
+        if (is_input_end) { return; }
+      }
+    } catch (...) {
+      {
+        std::lock_guard<std::mutex> lock(_mutex);
+        _error = std::current_exception();
+      }
+      _condition.notify_all();
+    }
+  }
+
+  /**
+   * @brief Replaces the current block with the next decompressed block.
+   *
+   * @return Whether there was another block
+   */
+  bool load_next_block()
+  {
+    std::unique_lock<std::mutex> lock(_mutex);
+    _condition.wait(lock, [this] { return not _blocks.empty() or _is_input_end or _error; });
+    if (_blocks.empty()) {
+      if (_error) { std::rethrow_exception(_error); }
+      return false;
+    }
+    // the copies out of the current block must complete before its memory is released
+    _read_stream.synchronize();
+    _current  = std::move(_blocks.front());
+    _position = 0;
+    _blocks.pop_front();
+    lock.unlock();
+    _condition.notify_all();
+    return true;
+  }
+
+  std::unique_ptr<block_decompressor> _decompressor;
+  rmm::cuda_stream _stream;
+  rmm::cuda_stream_view _read_stream = cudf::get_default_stream();
+  // here we can use the default stream because we only initialize an empty device_uvector
+  rmm::device_uvector<char> _current{0, cudf::get_default_stream()};
+  std::size_t _position = 0;
+
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  std::deque<rmm::device_uvector<char>> _blocks;
+  bool _is_input_end = false;
+  bool _is_stopped   = false;
+  std::exception_ptr _error;
+  std::thread _worker;
+};
+
+/**
+ * @brief A compressed file data source which creates a decompressing_data_chunk_reader.
+ */
+class compressed_file_data_chunk_source : public data_chunk_source {
+ public:
+  compressed_file_data_chunk_source(std::string_view filename, compression_type compression)
+    : _filename(filename), _compression(compression)
+  {
+  }
+
+  [[nodiscard]] std::unique_ptr<data_chunk_reader> create_reader() const override
+  {
+    std::unique_ptr<block_decompressor> decompressor;
+    if (_compression == compression_type::GZIP) {
+      decompressor = std::make_unique<gzip_block_decompressor>(_filename);
+    } else {
+      decompressor = std::make_unique<zstd_block_decompressor>(_filename);
+    }
+    return std::make_unique<decompressing_data_chunk_reader>(std::move(decompressor));
+  }
+
+ private:
+  std::string _filename;
+  compression_type _compression;
+};
+
+}  // namespace
+
+std::unique_ptr<data_chunk_source> make_source_from_compressed_file(std::string_view filename,
+                                                                    compression_type compression)
+{
+  CUDF_EXPECTS(compression == compression_type::GZIP or compression == compression_type::ZSTD,
+               "Unsupported compression type",
+               std::invalid_argument);
+  return std::make_unique<compressed_file_data_chunk_source>(filename, compression);
+}
+
+}  // namespace cudf::io::text
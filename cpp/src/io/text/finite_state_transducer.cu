@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/fst/lookup_tables.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/labeling/label_segments.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/io/text/finite_state_transducer.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace io {
+namespace text {
+
+finite_state_transducer::finite_state_transducer(
+  std::vector<std::string> symbol_groups,
+  std::vector<std::vector<int32_t>> transition_table,
+  std::vector<std::vector<std::string>> translation_table,
+  int32_t start_state)
+  : _symbol_groups(std::move(symbol_groups)),
+    _transition_table(std::move(transition_table)),
+    _translation_table(std::move(translation_table)),
+    _start_state(start_state)
+{
+  auto const num_states = static_cast<int32_t>(_transition_table.size());
+  auto const num_groups = _symbol_groups.size() + 1;
+  CUDF_EXPECTS(num_states > 0 and num_states <= max_num_states, "Unsupported number of states");
+  CUDF_EXPECTS(_symbol_groups.size() <= static_cast<std::size_t>(max_num_symbol_groups),
+               "Unsupported number of symbol groups");
+  CUDF_EXPECTS(_translation_table.size() == _transition_table.size(),
+               "The transition and translation tables must have the same number of states");
+  CUDF_EXPECTS(_start_state >= 0 and _start_state < num_states, "Invalid start state");
+
+  std::array<bool, 256> is_grouped{};
+  for (auto const& group : _symbol_groups) {
+    for (auto const symbol : group) {
+      auto const byte = static_cast<uint8_t>(symbol);
+      CUDF_EXPECTS(not is_grouped[byte], "A symbol can only be part of one symbol group");
+      is_grouped[byte] = true;
+    }
+  }
+
+  std::size_t translation_size = 0;
+  for (int32_t state = 0; state < num_states; ++state) {
+    CUDF_EXPECTS(_transition_table[state].size() == num_groups and
+                   _translation_table[state].size() == num_groups,
+                 "Each state needs one entry per symbol group, including the other symbols");
+    CUDF_EXPECTS(std::all_of(_transition_table[state].begin(),
+                             _transition_table[state].end(),
+                             [&](auto next) { return next >= 0 and next < num_states; }),
+                 "Invalid state in the transition table");
+    for (auto const& out : _translation_table[state]) {
+      translation_size += out.size();
+    }
+  }
+  CUDF_EXPECTS(translation_size <= static_cast<std::size_t>(max_translation_size),
+               "Unsupported translation table size");
+}
+
+namespace detail {
+namespace {
+
+// Symbol groups of the device transducer: the user-defined groups, the group of the other bytes,
+// and the group of the end-of-row marker that resets the transducer between strings
+constexpr int32_t num_device_symbol_groups = finite_state_transducer::max_num_symbol_groups + 2;
+constexpr int32_t row_end_symbol_group     = num_device_symbol_groups - 1;
+constexpr int32_t num_device_states        = finite_state_transducer::max_num_states;
+
+// Input symbols are bytes widened to 16 bits, so that the end-of-row marker can be told apart
+using symbol_t                    = int16_t;
+constexpr symbol_t row_end_symbol = -1;
+
+struct to_symbol {
+  __device__ symbol_t operator()(char c) const { return static_cast<uint8_t>(c); }
+};
+
+/**
+ * @brief Maps an input symbol to its symbol group.
+ */
+struct symbol_group_lookup {
+  uint8_t symbol_groups[256];
+
+  CUDF_HOST_DEVICE int32_t operator()(symbol_t const symbol) const
+  {
+    return symbol == row_end_symbol ? row_end_symbol_group : symbol_groups[symbol];
+  }
+};
+
+/**
+ * @brief Creates the device transducer of the given definition.
+ *
+ * The tables are padded to their compile-time size. Padding states are never reached, and the
+ * end-of-row marker moves every state back to the start state without any output.
+ */
+auto make_device_fst(finite_state_transducer const& fst, rmm::cuda_stream_view stream)
+{
+  auto const& symbol_groups = fst.symbol_groups();
+  auto const other_group    = static_cast<uint8_t>(symbol_groups.size());
+
+  symbol_group_lookup sgid_lookup{};
+  std::fill(
+    std::begin(sgid_lookup.symbol_groups), std::end(sgid_lookup.symbol_groups), other_group);
+  for (std::size_t group = 0; group < symbol_groups.size(); ++group) {
+    for (auto const symbol : symbol_groups[group]) {
+      sgid_lookup.symbol_groups[static_cast<uint8_t>(symbol)] = static_cast<uint8_t>(group);
+    }
+  }
+
+  std::array<std::array<int32_t, num_device_symbol_groups>, num_device_states> transitions{};
+  std::array<std::array<std::vector<char>, num_device_symbol_groups>, num_device_states>
+    translations{};
+  for (int32_t state = 0; state < num_device_states; ++state) {
+    transitions[state].fill(fst.start_state());
+    if (state >= static_cast<int32_t>(fst.transition_table().size())) { continue; }
+    auto const& state_transitions  = fst.transition_table()[state];
+    auto const& state_translations = fst.translation_table()[state];
+    std::copy(state_transitions.begin(), state_transitions.end(), transitions[state].begin());
+    std::transform(state_translations.begin(),
+                   state_translations.end(),
+                   translations[state].begin(),
+                   [](auto const& out) { return std::vector<char>(out.begin(), out.end()); });
+  }
+
+  return cudf::io::fst::detail::make_fst(
+    cudf::io::fst::detail::make_symbol_group_lookup_op(sgid_lookup),
+    cudf::io::fst::detail::make_transition_table(transitions),
+    cudf::io::fst::detail::make_translation_table<finite_state_transducer::max_translation_size>(
+      translations),
+    stream);
+}
+
+/**
+ * @brief Returns the maximum number of bytes output by a single transition.
+ */
+std::size_t max_output_per_symbol(finite_state_transducer const& fst)
+{
+  std::size_t max_output = 0;
+  for (auto const& state_translations : fst.translation_table()) {
+    for (auto const& out : state_translations) {
+      max_output = std::max(max_output, out.size());
+    }
+  }
+  return max_output;
+}
+
+/**
+ * @brief Runs the transducer over the given symbols, returning the output bytes and the index of
+ * the input symbol of each of them.
+ */
+template <typename SymbolItT>
+std::pair<rmm::device_uvector<char>, rmm::device_uvector<int64_t>> transduce_symbols(
+  SymbolItT symbols,
+  int64_t num_symbols,
+  finite_state_transducer const& fst,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const max_num_out = num_symbols * static_cast<int64_t>(max_output_per_symbol(fst));
+  rmm::device_uvector<char> out_symbols(max_num_out, stream, mr);
+  rmm::device_uvector<int64_t> out_indices(max_num_out, stream, mr);
+  if (max_num_out == 0) { return {std::move(out_symbols), std::move(out_indices)}; }
+
+  auto device_fst = make_device_fst(fst, stream);
+  rmm::device_scalar<int64_t> num_out(stream);
+  device_fst.Transduce(symbols,
+                       num_symbols,
+                       out_symbols.data(),
+                       out_indices.data(),
+                       num_out.data(),
+                       fst.start_state(),
+                       stream);
+
+  auto const num_out_symbols = num_out.value(stream);
+  out_symbols.resize(num_out_symbols, stream);
+  out_indices.resize(num_out_symbols, stream);
+  return {std::move(out_symbols), std::move(out_indices)};
+}
+
+}  // namespace
+
+transduce_result transduce(cudf::device_span<char const> input,
+                           finite_state_transducer const& fst,
+                           rmm::cuda_stream_view stream,
+                           rmm::device_async_resource_ref mr)
+{
+  auto [out_symbols, out_indices] = transduce_symbols(
+    thrust::make_transform_iterator(input.begin(), to_symbol{}), input.size(), fst, stream, mr);
+
+  auto const num_out = static_cast<size_type>(out_symbols.size());
+  return {std::make_unique<column>(
+            data_type{type_id::INT8}, num_out, out_symbols.release(), rmm::device_buffer{}, 0),
+          std::make_unique<column>(
+            data_type{type_id::INT64}, num_out, out_indices.release(), rmm::device_buffer{}, 0)};
+}
+
+std::unique_ptr<cudf::column> transduce(cudf::strings_column_view const& input,
+                                        finite_state_transducer const& fst,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.size();
+  if (num_rows == 0) { return make_empty_column(type_id::STRING); }
+
+  auto const d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+  auto const d_chars = input.chars_begin(stream);
+
+  // Every row is followed by an end-of-row marker, which resets the transducer to its start
+  // state. The virtual offsets are the offsets of the rows in this sequence of symbols.
+  rmm::device_uvector<int64_t> virtual_offsets(num_rows + 1, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows + 1),
+                    virtual_offsets.begin(),
+                    [d_offsets] __device__(size_type row) {
+                      return static_cast<int64_t>(d_offsets[row] - d_offsets[0]) + row;
+                    });
+  auto const num_symbols = virtual_offsets.back_element(stream);
+
+  rmm::device_uvector<symbol_t> symbols(num_symbols, stream);
+  {
+    rmm::device_uvector<size_type> symbol_rows(num_symbols, stream);
+    cudf::detail::label_segments(virtual_offsets.begin(),
+                                 virtual_offsets.end(),
+                                 symbol_rows.begin(),
+                                 symbol_rows.end(),
+                                 stream);
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<int64_t>(0),
+      thrust::make_counting_iterator<int64_t>(num_symbols),
+      symbols.begin(),
+      [d_offsets,
+       d_chars,
+       virtual_offsets = virtual_offsets.data(),
+       symbol_rows     = symbol_rows.data()] __device__(int64_t idx) -> symbol_t {
+        auto const row = symbol_rows[idx];
+        if (idx == virtual_offsets[row + 1] - 1) { return row_end_symbol; }
+        return static_cast<uint8_t>(d_chars[d_offsets[0] + idx - row]);
+      });
+  }
+
+  auto [out_chars, out_indices] =
+    transduce_symbols(symbols.begin(), num_symbols, fst, stream, mr);
+  CUDF_EXPECTS(out_chars.size() <= static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  // The output indices are sorted, so the output of a row starts at the first output of a symbol
+  // of the row.
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      out_indices.begin(),
+                      out_indices.end(),
+                      virtual_offsets.begin(),
+                      virtual_offsets.end(),
+                      offsets->mutable_view().begin<size_type>());
+
+  return make_strings_column(num_rows,
+                             std::move(offsets),
+                             out_chars.release(),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr));
+}
+
+}  // namespace detail
+
+transduce_result transduce(cudf::device_span<char const> input,
+                           finite_state_transducer const& fst,
+                           rmm::cuda_stream_view stream,
+                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transduce(input, fst, stream, mr);
+}
+
+std::unique_ptr<cudf::column> transduce(cudf::strings_column_view const& input,
+                                        finite_state_transducer const& fst,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::transduce(input, fst, stream, mr);
+}
+
+}  // namespace text
+}  // namespace io
+}  // namespace cudf
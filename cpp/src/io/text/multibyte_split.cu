@@ -23,10 +23,12 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/text/byte_range_info.hpp>
 #include <cudf/io/text/data_chunk_source.hpp>
 #include <cudf/io/text/detail/multistate.hpp>
 #include <cudf/io/text/detail/tile_state.hpp>
+#include <cudf/io/text/detail/trie.hpp>
 #include <cudf/io/text/multibyte_split.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/strings_column_factories.cuh>
@@ -43,6 +45,8 @@
 #include <cub/block/block_scan.cuh>
 #include <cuda/functional>
 #include <thrust/copy.h>
+#include <thrust/equal.h>
+#include <thrust/execution_policy.h>
 #include <thrust/find.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
@@ -52,10 +56,13 @@
 #include <memory>
 #include <numeric>
 #include <optional>
+#include <string>
+#include <vector>
 
 namespace {
 
 using cudf::io::text::detail::multistate;
+using cudf::io::text::detail::trie_device_view;
 
 int32_t constexpr ITEMS_PER_THREAD = 64;
 int32_t constexpr THREADS_PER_TILE = 128;
@@ -90,6 +97,79 @@ constexpr multistate transition(char c, multistate state, cudf::device_span<char
   return result;
 }
 
+/**
+ * @brief Finds the matches of a single delimiter, tracking the partial matches by their length.
+ */
+struct delimiter_matcher {
+  cudf::device_span<char const> delim;
+
+  [[nodiscard]] constexpr multistate transition_init(char c) const
+  {
+    return ::transition_init(c, delim);
+  }
+
+  [[nodiscard]] constexpr multistate transition(char c, multistate const& state) const
+  {
+    return ::transition(c, state, delim);
+  }
+
+  [[nodiscard]] constexpr bool is_match(multistate const& state) const
+  {
+    return state.max_tail() == delim.size();
+  }
+};
+
+/**
+ * @brief Finds the matches of any of multiple delimiters, tracking the partial matches by their
+ * node in a trie of the delimiters.
+ */
+struct trie_matcher {
+  trie_device_view trie;
+
+  [[nodiscard]] constexpr multistate transition_init(char c) const
+  {
+    return trie.transition_init(c);
+  }
+
+  [[nodiscard]] constexpr multistate transition(char c, multistate const& state) const
+  {
+    return trie.transition(c, state);
+  }
+
+  [[nodiscard]] constexpr bool is_match(multistate const& state) const
+  {
+    return trie.is_match(state);
+  }
+};
+
+/**
+ * @brief Computes the size of the delimiter at the end of a row.
+ *
+ * With multiple delimiters, this is the size of the longest delimiter the row ends with.
+ */
+struct delimiter_size_fn {
+  cudf::device_span<char const> delim_chars;       // concatenated delimiters
+  cudf::device_span<int32_t const> delim_offsets;  // offsets of the delimiters in `delim_chars`
+
+  __device__ int32_t operator()(char const* row_chars, int32_t row_size) const
+  {
+    auto const num_delims = delim_offsets.size() - 1;
+    if (num_delims == 1) { return delim_offsets[1]; }
+    int32_t result = 0;
+    for (std::size_t i = 0; i < num_delims; i++) {
+      auto const delim_size = delim_offsets[i + 1] - delim_offsets[i];
+      if (delim_size > result and delim_size <= row_size and
+          thrust::equal(thrust::seq,
+                        row_chars + row_size - delim_size,
+                        row_chars + row_size,
+                        delim_chars.begin() + delim_offsets[i])) {
+        result = delim_size;
+      }
+    }
+    return result;
+  }
+};
+
 struct PatternScan {
   using BlockScan         = cub::BlockScan<multistate, THREADS_PER_TILE>;
   using BlockScanCallback = cudf::io::text::detail::scan_tile_state_callback<multistate>;
@@ -104,16 +184,17 @@ struct PatternScan {
 
   __device__ inline PatternScan(TempStorage& temp_storage) : _temp_storage(temp_storage.Alias()) {}
 
+  template <typename Matcher>
   __device__ inline void Scan(cudf::size_type tile_idx,
                               cudf::io::text::detail::scan_tile_state_view<multistate> tile_state,
-                              cudf::device_span<char const> delim,
+                              Matcher const& matcher,
                               char (&thread_data)[ITEMS_PER_THREAD],
                               multistate& thread_multistate)
   {
-    thread_multistate = transition_init(thread_data[0], delim);
+    thread_multistate = matcher.transition_init(thread_data[0]);
 
     for (uint32_t i = 1; i < ITEMS_PER_THREAD; i++) {
-      thread_multistate = transition(thread_data[i], thread_multistate, delim);
+      thread_multistate = matcher.transition(thread_data[i], thread_multistate);
     }
 
     auto prefix_callback = BlockScanCallback(tile_state, tile_idx);
@@ -153,13 +234,14 @@ CUDF_KERNEL void multibyte_split_init_kernel(
   }
 }
 
+template <typename Matcher>
 CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   cudf::size_type base_tile_idx,
   byte_offset base_input_offset,
   output_offset base_output_offset,
   cudf::io::text::detail::scan_tile_state_view<multistate> tile_multistates,
   cudf::io::text::detail::scan_tile_state_view<output_offset> tile_output_offsets,
-  cudf::device_span<char const> delim,
+  Matcher matcher,
   cudf::device_span<char const> chunk_input_chars,
   cudf::split_device_span<byte_offset> row_offsets)
 {
@@ -196,7 +278,7 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
 
   __syncthreads();  // required before temp_memory re-use
   PatternScan(temp_storage.pattern_scan)
-    .Scan(tile_idx, tile_multistates, delim, thread_chars, thread_multistate);
+    .Scan(tile_idx, tile_multistates, matcher, thread_chars, thread_multistate);
 
   // STEP 3: Flag matches
 
@@ -204,9 +286,8 @@ CUDF_KERNEL __launch_bounds__(THREADS_PER_TILE) void multibyte_split_kernel(
   uint32_t thread_match_mask[(ITEMS_PER_THREAD + 31) / 32]{};
 
   for (int32_t i = 0; i < ITEMS_PER_THREAD; i++) {
-    thread_multistate       = transition(thread_chars[i], thread_multistate, delim);
-    auto const thread_state = thread_multistate.max_tail();
-    auto const is_match     = i < thread_input_size and thread_state == delim.size();
+    thread_multistate   = matcher.transition(thread_chars[i], thread_multistate);
+    auto const is_match = i < thread_input_size and matcher.is_match(thread_multistate);
     thread_match_mask[i / 32] |= uint32_t{is_match} << (i % 32);
     thread_offset += output_offset{is_match};
   }
@@ -303,7 +384,7 @@ namespace text {
 namespace detail {
 
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
-                                              std::string const& delimiter,
+                                              std::vector<std::string> const& delimiters,
                                               byte_range_info byte_range,
                                               bool strip_delimiters,
                                               rmm::cuda_stream_view stream,
@@ -311,28 +392,62 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 {
   CUDF_FUNC_RANGE();
 
+  CUDF_EXPECTS(not delimiters.empty(), "at least one delimiter is required.");
+
   if (byte_range.empty()) { return make_empty_column(type_id::STRING); }
 
-  auto device_delim = cudf::string_scalar(delimiter, true, stream, mr);
+  // the delimiters are stored on the device concatenated, along with their offsets
+  std::string delimiter_chars;
+  std::vector<int32_t> delimiter_offsets{0};
+  for (auto const& delimiter : delimiters) {
+    delimiter_chars += delimiter;
+    delimiter_offsets.push_back(static_cast<int32_t>(delimiter_chars.size()));
+  }
+  auto const d_delimiter_chars = cudf::detail::make_device_uvector_async(
+    delimiter_chars, stream, rmm::mr::get_current_device_resource());
+  auto const d_delimiter_offsets = cudf::detail::make_device_uvector_async(
+    delimiter_offsets, stream, rmm::mr::get_current_device_resource());
+  auto const max_delimiter_size =
+    std::max_element(delimiters.begin(), delimiters.end(), [](auto const& lhs, auto const& rhs) {
+      return lhs.size() < rhs.size();
+    })->size();
+
+  // multiple delimiters are matched using a trie, which is only needed with multiple delimiters
+  std::optional<trie> delimiter_trie;
+  if (delimiters.size() == 1) {
+    auto sorted_delim = delimiters.front();
+    std::sort(sorted_delim.begin(), sorted_delim.end());
+    auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
+      sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
+        if (std::get<0>(acc) != c) {
+          std::get<0>(acc) = c;
+          std::get<1>(acc) = 0;
+        }
+        std::get<1>(acc)++;
+        std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
+        return acc;
+      });
+
+    CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
+                 "delimiter contains too many duplicate tokens to produce a deterministic result.");
+
+    CUDF_EXPECTS(max_delimiter_size < multistate::max_segment_value,
+                 "delimiter contains too many total tokens to produce a deterministic result.");
+  } else {
+    CUDF_EXPECTS(std::none_of(delimiters.begin(),
+                              delimiters.end(),
+                              [](auto const& delimiter) { return delimiter.empty(); }),
+                 "delimiters must not be empty.");
 
-  auto sorted_delim = delimiter;
-  std::sort(sorted_delim.begin(), sorted_delim.end());
-  auto [_last_char, _last_char_count, max_duplicate_tokens] = std::accumulate(
-    sorted_delim.begin(), sorted_delim.end(), std::make_tuple('\0', 0, 0), [](auto acc, char c) {
-      if (std::get<0>(acc) != c) {
-        std::get<0>(acc) = c;
-        std::get<1>(acc) = 0;
-      }
-      std::get<1>(acc)++;
-      std::get<2>(acc) = std::max(std::get<1>(acc), std::get<2>(acc));
-      return acc;
-    });
+    delimiter_trie = trie::create(delimiters, stream, rmm::mr::get_current_device_resource());
 
-  CUDF_EXPECTS(max_duplicate_tokens < multistate::max_segment_count,
-               "delimiter contains too many duplicate tokens to produce a deterministic result.");
+    CUDF_EXPECTS(delimiter_trie->max_duplicate_tokens() < multistate::max_segment_count,
+                 "delimiters contain too many duplicate tokens to produce a deterministic result.");
 
-  CUDF_EXPECTS(delimiter.size() < multistate::max_segment_value,
-               "delimiter contains too many total tokens to produce a deterministic result.");
+    // node indices are stored as multistate heads and tails, excluding the trailing sentinel node
+    CUDF_EXPECTS(delimiter_trie->size() - 2 <= multistate::max_segment_value,
+                 "delimiters contain too many total tokens to produce a deterministic result.");
+  }
 
   auto const concurrency = 2;
 
@@ -371,7 +486,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
     stream);
 
   auto reader               = source.create_reader();
-  auto chunk_offset         = std::max<byte_offset>(0, byte_range.offset() - delimiter.size());
+  auto chunk_offset = std::max<byte_offset>(0, byte_range.offset() - max_delimiter_size);
   auto const byte_range_end = byte_range.offset() + byte_range.size();
   reader->skip_bytes(chunk_offset);
   // amortize output chunk allocations over 8 worst-case outputs. This limits the overallocation
@@ -418,7 +533,20 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 
     CUDF_CUDA_TRY(cudaStreamWaitEvent(scan_stream.value(), last_launch_event));
 
-    if (delimiter.size() == 1) {
+    if (delimiter_trie.has_value()) {
+      multibyte_split_kernel<<<tiles_in_launch,
+                               THREADS_PER_TILE,
+                               0,
+                               scan_stream.value()>>>(  //
+        base_tile_idx,
+        chunk_offset,
+        row_offset_storage.size(),
+        tile_multistates,
+        tile_offsets,
+        trie_matcher{delimiter_trie->view()},
+        *chunk,
+        row_offsets);
+    } else if (max_delimiter_size == 1) {
       // the single-byte case allows for a much more efficient kernel, so we special-case it
       byte_split_kernel<<<tiles_in_launch,
                           THREADS_PER_TILE,
@@ -428,7 +556,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
         chunk_offset,
         row_offset_storage.size(),
         tile_offsets,
-        delimiter[0],
+        delimiter_chars[0],
         *chunk,
         row_offsets);
     } else {
@@ -441,7 +569,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
         row_offset_storage.size(),
         tile_multistates,
         tile_offsets,
-        {device_delim.data(), static_cast<std::size_t>(device_delim.size())},
+        delimiter_matcher{d_delimiter_chars},
         *chunk,
         row_offsets);
     }
@@ -539,7 +667,7 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
       cuda::proclaim_return_type<thrust::pair<char*, int32_t>>(
         [ofs        = offsets.data(),
          chars      = chars.data(),
-         delim_size = static_cast<size_type>(delimiter.size()),
+         delim_size = delimiter_size_fn{d_delimiter_chars, d_delimiter_offsets},
          last_row   = static_cast<size_type>(string_count) - 1,
          insert_end] __device__(size_type row) {
           auto const begin = ofs[row];
@@ -547,7 +675,8 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
           if (row == last_row && insert_end) {
             return thrust::make_pair(chars + begin, len);
           } else {
-            return thrust::make_pair(chars + begin, std::max<size_type>(0, len - delim_size));
+            return thrust::make_pair(chars + begin,
+                                     std::max<size_type>(0, len - delim_size(chars + begin, len)));
           };
         }));
     return cudf::strings::detail::make_strings_column(it, it + string_count, stream, mr);
@@ -579,12 +708,29 @@ std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source
 {
   auto stream = cudf::get_default_stream();
 
-  auto result = detail::multibyte_split(
-    source, delimiter, options.byte_range, options.strip_delimiters, stream, mr);
+  auto result = detail::multibyte_split(source,
+                                        std::vector<std::string>{delimiter},
+                                        options.byte_range,
+                                        options.strip_delimiters,
+                                        stream,
+                                        mr);
 
   return result;
 }
 
+std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
+                                              std::vector<std::string> const& delimiters,
+                                              parse_options options,
+                                              rmm::device_async_resource_ref mr)
+{
+  return detail::multibyte_split(source,
+                                 delimiters,
+                                 options.byte_range,
+                                 options.strip_delimiters,
+                                 cudf::get_default_stream(),
+                                 mr);
+}
+
 std::unique_ptr<cudf::column> multibyte_split(cudf::io::text::data_chunk_source const& source,
                                               std::string const& delimiter,
                                               rmm::device_async_resource_ref mr)
@@ -0,0 +1,321 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/io/caching_datasource.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/aligned.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <list>
+#include <map>
+#include <mutex>
+
+namespace cudf::io {
+
+namespace {
+
+/**
+ * @brief A cached byte range of the wrapped source
+ *
+ * The host copy is always present; the device copy is added once the range is promoted.
+ */
+struct cache_entry {
+  explicit cache_entry(size_t offset, size_t size)
+    : offset{offset},
+      size{size},
+      host{static_cast<uint8_t*>(
+        get_host_memory_resource().allocate(size, rmm::RMM_DEFAULT_HOST_ALIGNMENT))}
+  {
+  }
+
+  cache_entry(cache_entry const&)            = delete;
+  cache_entry& operator=(cache_entry const&) = delete;
+
+  ~cache_entry()
+  {
+    get_host_memory_resource().deallocate(host, size, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+  }
+
+  size_t offset;
+  size_t size;
+  uint8_t* host;
+  std::shared_ptr<rmm::device_buffer> device;
+  size_t hits{0};
+};
+
+using entry_ptr = std::shared_ptr<cache_entry>;
+
+/**
+ * @brief Buffer that views part of a cached copy and keeps that copy alive
+ */
+class cached_buffer : public datasource::buffer {
+ public:
+  cached_buffer(std::shared_ptr<void const> owner, uint8_t const* data, size_t size)
+    : _owner{std::move(owner)}, _data{data}, _size{size}
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _data; }
+
+ private:
+  std::shared_ptr<void const> _owner;
+  uint8_t const* _data;
+  size_t _size;
+};
+
+}  // namespace
+
+class caching_datasource::impl {
+ public:
+  impl(std::unique_ptr<datasource> source, datasource_cache_options options)
+    : _source{std::move(source)}, _options{options}
+  {
+    CUDF_EXPECTS(_source != nullptr, "Cannot cache a null datasource");
+  }
+
+  /**
+   * @brief Returns the entry that holds the host copy of a range, reading it on a miss
+   *
+   * `stream` is only used when the wrapped source prefers device reads, in which case the range
+   * is read to the device and copied back to the cache. A hit on a device resident entry is
+   * counted as a device hit when `for_device` is set.
+   */
+  entry_ptr host_entry(size_t offset, size_t size, bool for_device, rmm::cuda_stream_view stream)
+  {
+    if (auto entry = find(offset, size); entry != nullptr) {
+      std::lock_guard lock{_mutex};
+      ++entry->hits;
+      ++(for_device and entry->device != nullptr ? _stats.device_hits : _stats.host_hits);
+      return entry;
+    }
+
+    auto entry = std::make_shared<cache_entry>(offset, size);
+    if (_source->is_device_read_preferred(size)) {
+      rmm::device_buffer staging(size, stream);
+      auto const read =
+        _source->device_read(offset, size, static_cast<uint8_t*>(staging.data()), stream);
+      CUDF_EXPECTS(read == size, "Unexpected short read from the cached datasource");
+      CUDF_CUDA_TRY(cudaMemcpyAsync(
+        entry->host, staging.data(), size, cudaMemcpyDeviceToHost, stream.value()));
+      stream.synchronize();
+    } else {
+      auto const read = _source->host_read(offset, size, entry->host);
+      CUDF_EXPECTS(read == size, "Unexpected short read from the cached datasource");
+    }
+    insert(entry);
+    return entry;
+  }
+
+  /**
+   * @brief Returns the device copy of a cached range if it has been (or is now due to be) promoted
+   *
+   * The returned buffer stays valid after the entry is evicted from the device cache.
+   */
+  std::shared_ptr<rmm::device_buffer> device_copy(entry_ptr const& entry,
+                                                  rmm::cuda_stream_view stream)
+  {
+    if (_options.device_capacity == 0 or entry->size > _options.device_capacity) {
+      return nullptr;
+    }
+    std::lock_guard lock{_mutex};
+    if (entry->device == nullptr) {
+      if (entry->hits < _options.promotion_hits) { return nullptr; }
+      entry->device = std::make_shared<rmm::device_buffer>(
+        entry->host, entry->size, stream, rmm::mr::get_current_device_resource());
+      _stats.device_bytes += entry->size;
+      _device_lru.push_front(entry);
+      evict_device();
+    } else {
+      touch(_device_lru, entry);
+    }
+    return entry->device;
+  }
+
+  [[nodiscard]] datasource& source() const { return *_source; }
+
+  [[nodiscard]] datasource_cache_options const& options() const { return _options; }
+
+  [[nodiscard]] datasource_cache_statistics statistics() const
+  {
+    std::lock_guard lock{_mutex};
+    return _stats;
+  }
+
+ private:
+  static void touch(std::list<entry_ptr>& lru, entry_ptr const& entry)
+  {
+    auto const it = std::find(lru.begin(), lru.end(), entry);
+    if (it != lru.end()) { lru.splice(lru.begin(), lru, it); }
+  }
+
+  /**
+   * @brief Looks up an entry that contains the whole range and marks it as recently used
+   */
+  entry_ptr find(size_t offset, size_t size)
+  {
+    std::lock_guard lock{_mutex};
+    auto it = _entries.upper_bound(offset);
+    if (it == _entries.begin()) { return nullptr; }
+    auto const& entry = std::prev(it)->second;
+    if (offset + size > entry->offset + entry->size) { return nullptr; }
+    touch(_host_lru, entry);
+    return entry;
+  }
+
+  void insert(entry_ptr const& entry)
+  {
+    std::lock_guard lock{_mutex};
+    ++_stats.misses;
+    if (entry->size > _options.host_capacity) { return; }
+    // A range read concurrently by another thread, or a larger one at the same offset, wins
+    auto [it, inserted] = _entries.try_emplace(entry->offset, entry);
+    if (not inserted) {
+      if (it->second->size >= entry->size) { return; }
+      erase(it->second);
+      it = _entries.emplace(entry->offset, entry).first;
+    }
+    _stats.host_bytes += entry->size;
+    _host_lru.push_front(entry);
+    while (_stats.host_bytes > _options.host_capacity) {
+      erase(_host_lru.back());
+    }
+  }
+
+  // Caller holds `_mutex`; outstanding buffers keep the evicted memory alive until released
+  void erase(entry_ptr entry)
+  {
+    _entries.erase(entry->offset);
+    _host_lru.remove(entry);
+    _stats.host_bytes -= entry->size;
+    if (entry->device != nullptr) {
+      _device_lru.remove(entry);
+      _stats.device_bytes -= entry->size;
+    }
+  }
+
+  void evict_device()
+  {
+    while (_stats.device_bytes > _options.device_capacity) {
+      auto const victim = _device_lru.back();
+      _device_lru.pop_back();
+      _stats.device_bytes -= victim->size;
+      victim->device.reset();
+      victim->hits = 0;
+    }
+  }
+
+  std::unique_ptr<datasource> _source;
+  datasource_cache_options _options;
+  mutable std::mutex _mutex;
+  std::map<size_t, entry_ptr> _entries;
+  std::list<entry_ptr> _host_lru;
+  std::list<entry_ptr> _device_lru;
+  datasource_cache_statistics _stats;
+};
+
+caching_datasource::caching_datasource(std::unique_ptr<datasource> source,
+                                       datasource_cache_options options)
+  : _impl{std::make_unique<impl>(std::move(source), options)}
+{
+}
+
+caching_datasource::~caching_datasource() = default;
+
+std::unique_ptr<datasource::buffer> caching_datasource::host_read(size_t offset, size_t size)
+{
+  auto const count = std::min(size, this->size() - std::min(offset, this->size()));
+  if (count == 0) { return std::make_unique<non_owning_buffer>(); }
+  auto entry      = _impl->host_entry(offset, count, false, cudf::get_default_stream());
+  auto const data = entry->host + (offset - entry->offset);
+  return std::make_unique<cached_buffer>(std::move(entry), data, count);
+}
+
+size_t caching_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  auto const buffer = host_read(offset, size);
+  std::memcpy(dst, buffer->data(), buffer->size());
+  return buffer->size();
+}
+
+bool caching_datasource::is_device_read_preferred(size_t size) const
+{
+  return _impl->options().device_capacity > 0 or _impl->source().is_device_read_preferred(size);
+}
+
+std::unique_ptr<datasource::buffer> caching_datasource::device_read(size_t offset,
+                                                                      size_t size,
+                                                                      rmm::cuda_stream_view stream)
+{
+  auto const count = std::min(size, this->size() - std::min(offset, this->size()));
+  if (count == 0) { return std::make_unique<non_owning_buffer>(); }
+  auto const entry = _impl->host_entry(offset, count, true, stream);
+  auto const index = offset - entry->offset;
+  if (auto device = _impl->device_copy(entry, stream); device != nullptr) {
+    auto const data = static_cast<uint8_t const*>(device->data()) + index;
+    return std::make_unique<cached_buffer>(std::move(device), data, count);
+  }
+  auto out_data = rmm::device_buffer(entry->host + index, count, stream);
+  stream.synchronize();
+  return datasource::buffer::create(std::move(out_data));
+}
+
+size_t caching_datasource::device_read(size_t offset,
+                                       size_t size,
+                                       uint8_t* dst,
+                                       rmm::cuda_stream_view stream)
+{
+  return device_read_async(offset, size, dst, stream).get();
+}
+
+std::future<size_t> caching_datasource::device_read_async(size_t offset,
+                                                          size_t size,
+                                                          uint8_t* dst,
+                                                          rmm::cuda_stream_view stream)
+{
+  auto const count = std::min(size, this->size() - std::min(offset, this->size()));
+  if (count == 0) {
+    return std::async(std::launch::deferred, [] { return size_t{0}; });
+  }
+  auto entry       = _impl->host_entry(offset, count, true, stream);
+  auto device      = _impl->device_copy(entry, stream);
+  auto const* base = device != nullptr ? static_cast<uint8_t const*>(device->data()) : entry->host;
+  auto const* src  = base + (offset - entry->offset);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(dst, src, count, cudaMemcpyDefault, stream.value()));
+  // The future owns both copies so that eviction cannot release the source of the copy early
+  return std::async(
+    std::launch::deferred,
+    [entry = std::move(entry), device = std::move(device), count, stream] {
+      stream.synchronize();
+      return count;
+    });
+}
+
+size_t caching_datasource::size() const { return _impl->source().size(); }
+
+datasource_cache_statistics caching_datasource::statistics() const
+{
+  return _impl->statistics();
+}
+
+}  // namespace cudf::io
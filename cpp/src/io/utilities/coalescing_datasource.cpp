@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "coalescing_datasource.hpp"
+
+#include <cudf/detail/utilities/host_worker_pool.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+
+namespace cudf::io::detail {
+
+namespace {
+
+/**
+ * @brief Device buffer that views part of a merged read and keeps it alive
+ */
+class merged_sub_buffer : public datasource::buffer {
+ public:
+  merged_sub_buffer(std::shared_ptr<rmm::device_buffer> owner, uint8_t const* data, size_t size)
+    : _owner{std::move(owner)}, _data{data}, _size{size}
+  {
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+  [[nodiscard]] uint8_t const* data() const override { return _data; }
+
+ private:
+  std::shared_ptr<rmm::device_buffer> _owner;
+  uint8_t const* _data;
+  size_t _size;
+};
+
+}  // namespace
+
+coalescing_datasource::coalescing_datasource(datasource& source, std::size_t max_gap)
+  : _source{source}, _max_gap{max_gap}
+{
+}
+
+std::future<size_t> coalescing_datasource::prefetch_to_device(
+  cudf::host_span<read_range const> ranges,
+  std::size_t padding_multiple,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  std::vector<read_range> sorted(ranges.begin(), ranges.end());
+  std::sort(sorted.begin(), sorted.end(), [](auto const& lhs, auto const& rhs) {
+    return lhs.offset < rhs.offset;
+  });
+
+  _merged.clear();
+  for (auto const& range : sorted) {
+    if (range.size == 0) { continue; }
+    auto const is_close = not _merged.empty() and
+                          range.offset <= _merged.back().offset + _merged.back().size + _max_gap;
+    if (is_close) {
+      auto& last = _merged.back();
+      last.size  = std::max(last.offset + last.size, range.offset + range.size) - last.offset;
+    } else {
+      _merged.push_back({range.offset, range.size, nullptr});
+    }
+  }
+
+  std::vector<std::future<size_t>> read_tasks;
+  // Host reads as {offset, size, dst}, all performed by one task
+  std::vector<std::tuple<size_t, size_t, uint8_t*>> host_reads;
+  for (auto& merged : _merged) {
+    merged.data = std::make_shared<rmm::device_buffer>(
+      cudf::util::round_up_safe(merged.size, std::max<std::size_t>(padding_multiple, 1)),
+      stream,
+      mr);
+    auto const dst = static_cast<uint8_t*>(merged.data->data());
+    if (_source.is_device_read_preferred(merged.size)) {
+      read_tasks.emplace_back(_source.device_read_async(merged.offset, merged.size, dst, stream));
+    } else {
+      host_reads.emplace_back(merged.offset, merged.size, dst);
+    }
+  }
+  if (not host_reads.empty()) {
+    read_tasks.emplace_back(cudf::detail::host_worker_pool().submit(
+      [source = &_source, reads = std::move(host_reads), stream]() {
+        size_t total_read = 0;
+        for (auto const& [offset, size, dst] : reads) {
+          auto const read_buffer = source->host_read(offset, size);
+          CUDF_CUDA_TRY(cudaMemcpyAsync(
+            dst, read_buffer->data(), read_buffer->size(), cudaMemcpyDefault, stream.value()));
+          total_read += read_buffer->size();
+        }
+        return total_read;
+      }));
+  }
+
+  auto sync_fn = [](decltype(read_tasks) read_tasks) {
+    for (auto& task : read_tasks) {
+      task.wait();
+    }
+    // rethrow any read error once none of the reads is still writing to the buffers
+    size_t total_read = 0;
+    for (auto& task : read_tasks) {
+      total_read += task.get();
+    }
+    return total_read;
+  };
+  _prefetch = std::async(std::launch::deferred, sync_fn, std::move(read_tasks)).share();
+  return std::async(std::launch::deferred, [prefetch = _prefetch] { return prefetch.get(); });
+}
+
+coalescing_datasource::merged_range const* coalescing_datasource::find(std::size_t offset,
+                                                                       std::size_t size) const
+{
+  auto const it = std::upper_bound(
+    _merged.begin(), _merged.end(), offset, [](auto value, auto const& range) {
+      return value < range.offset;
+    });
+  if (it == _merged.begin()) { return nullptr; }
+  auto const& range = *std::prev(it);
+  return offset + size <= range.offset + range.size ? &range : nullptr;
+}
+
+std::unique_ptr<datasource::buffer> coalescing_datasource::host_read(size_t offset, size_t size)
+{
+  return _source.host_read(offset, size);
+}
+
+size_t coalescing_datasource::host_read(size_t offset, size_t size, uint8_t* dst)
+{
+  return _source.host_read(offset, size, dst);
+}
+
+std::unique_ptr<datasource::buffer> coalescing_datasource::device_read(
+  size_t offset, size_t size, rmm::cuda_stream_view stream)
+{
+  if (auto const range = find(offset, size); range != nullptr) {
+    auto const data = static_cast<uint8_t const*>(range->data->data()) + (offset - range->offset);
+    return std::make_unique<merged_sub_buffer>(range->data, data, size);
+  }
+  if (_source.supports_device_read()) { return _source.device_read(offset, size, stream); }
+
+  auto const host_buffer = _source.host_read(offset, size);
+  rmm::device_buffer data(host_buffer->data(), host_buffer->size(), stream);
+  stream.synchronize();
+  return datasource::buffer::create(std::move(data));
+}
+
+size_t coalescing_datasource::device_read(size_t offset,
+                                          size_t size,
+                                          uint8_t* dst,
+                                          rmm::cuda_stream_view stream)
+{
+  return device_read_async(offset, size, dst, stream).get();
+}
+
+std::future<size_t> coalescing_datasource::device_read_async(size_t offset,
+                                                             size_t size,
+                                                             uint8_t* dst,
+                                                             rmm::cuda_stream_view stream)
+{
+  if (auto const range = find(offset, size); range != nullptr) {
+    auto const src = static_cast<uint8_t const*>(range->data->data()) + (offset - range->offset);
+    return std::async(std::launch::deferred,
+                      [prefetch = _prefetch, owner = range->data, src, size, dst, stream] {
+                        prefetch.wait();
+                        CUDF_CUDA_TRY(
+                          cudaMemcpyAsync(dst, src, size, cudaMemcpyDefault, stream.value()));
+                        stream.synchronize();
+                        return size;
+                      });
+  }
+  if (_source.supports_device_read()) {
+    return _source.device_read_async(offset, size, dst, stream);
+  }
+
+  auto const host_buffer = _source.host_read(offset, size);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    dst, host_buffer->data(), host_buffer->size(), cudaMemcpyDefault, stream.value()));
+  stream.synchronize();
+  std::promise<size_t> result;
+  result.set_value(host_buffer->size());
+  return result.get_future();
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <future>
+#include <memory>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Byte range of a datasource
+ */
+struct read_range {
+  std::size_t offset;  ///< Bytes from the start of the source
+  std::size_t size;    ///< Number of bytes
+};
+
+/**
+ * @brief Datasource wrapper that merges a batch of requested ranges into fewer, larger reads.
+ *
+ * A reader announces the ranges it is about to read with `prefetch_to_device`. Ranges that are at
+ * most `max_gap` bytes apart are merged, the merged ranges are read into shared device buffers,
+ * and subsequent `device_read` calls for any sub-range are served from those buffers without
+ * copying. Reads of ranges that were not prefetched are forwarded to the wrapped source.
+ *
+ * Like the wrapped source, the wrapper is meant to be accessed from one thread at a time.
+ */
+class coalescing_datasource final : public datasource {
+ public:
+  /**
+   * @brief Wrap a datasource
+   *
+   * @param source The source to read from; must outlive the wrapper
+   * @param max_gap Largest number of bytes between two ranges that are read as one
+   */
+  coalescing_datasource(datasource& source, std::size_t max_gap);
+
+  /**
+   * @brief Read the given ranges to device memory, merging the ones that are close together
+   *
+   * Device reads are issued asynchronously to the source; host reads are performed in a single
+   * host worker task so that the source is only accessed by one thread at a time.
+   *
+   * @param ranges Ranges that will be read with `device_read`
+   * @param padding_multiple Each merged buffer is padded to a multiple of this many bytes
+   * @param stream CUDA stream to use
+   * @param mr Device memory resource used to allocate the merged buffers
+   * @return Future holding the number of bytes read; the data of the buffers returned by
+   * `device_read` is valid once it completes
+   */
+  std::future<size_t> prefetch_to_device(cudf::host_span<read_range const> ranges,
+                                         std::size_t padding_multiple,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr);
+
+  /**
+   * @brief Number of reads that the last `prefetch_to_device` call issued to the source
+   *
+   * @return The number of merged ranges
+   */
+  [[nodiscard]] std::size_t num_merged_reads() const { return _merged.size(); }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override;
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override;
+
+  [[nodiscard]] bool supports_device_read() const override { return true; }
+
+  [[nodiscard]] bool is_device_read_preferred(size_t size) const override { return true; }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override;
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override;
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override;
+
+  [[nodiscard]] size_t size() const override { return _source.size(); }
+
+ private:
+  struct merged_range {
+    std::size_t offset;
+    std::size_t size;
+    std::shared_ptr<rmm::device_buffer> data;
+  };
+
+  /**
+   * @brief Find the merged range containing [offset, offset + size), if any
+   */
+  [[nodiscard]] merged_range const* find(std::size_t offset, std::size_t size) const;
+
+  datasource& _source;
+  std::size_t const _max_gap;
+  std::vector<merged_range> _merged;  // sorted by offset
+  std::shared_future<size_t> _prefetch;
+};
+
+}  // namespace cudf::io::detail
@@ -24,8 +24,8 @@
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/memory_resource.hpp>
 
-#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <iomanip>
@@ -40,11 +40,11 @@ void gather_column_buffer::allocate_strings_data(rmm::cuda_stream_view stream)
   // Due to the fact that make_strings_column copies the input data to
   // produce its outputs, _strings is actually a temporary. As a result, we
   // do not pass the provided mr to the call to
-  // make_zeroed_device_uvector_async here and instead let it use the
-  // default rmm memory resource.
+  // make_zeroed_device_uvector_async here and instead use the resource for
+  // temporary IO column buffers.
   _strings = std::make_unique<rmm::device_uvector<string_index_pair>>(
     cudf::detail::make_zeroed_device_uvector_async<string_index_pair>(
-      size, stream, rmm::mr::get_current_device_resource()));
+      size, stream, get_temporary_memory_resource(temporary_allocation::IO_COLUMN_BUFFER)));
 }
 
 std::unique_ptr<column> gather_column_buffer::make_string_column_impl(rmm::cuda_stream_view stream)
@@ -0,0 +1,136 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "column_filter.hpp"
+
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+#include <iterator>
+
+namespace cudf::io::detail {
+
+column_filter_converter::column_filter_converter(ast::expression const& expr,
+                                                 host_span<std::string const> column_names)
+  : _num_columns{static_cast<size_type>(column_names.size())}
+{
+  for (size_type i = 0; i < _num_columns; ++i) {
+    _column_name_to_index.emplace(column_names[i], i);
+  }
+
+  // The first traversal collects the referenced columns, which the second one needs to number
+  // the references of the converted filter
+  expr.accept(*this);
+  std::sort(_referenced_columns.begin(), _referenced_columns.end());
+  _referenced_columns.erase(std::unique(_referenced_columns.begin(), _referenced_columns.end()),
+                            _referenced_columns.end());
+  CUDF_EXPECTS(not _referenced_columns.empty(), "Filter must reference at least one column");
+  _is_converting = true;
+  expr.accept(*this);
+}
+
+size_type column_filter_converter::column_index(ast::column_reference const& expr) const
+{
+  CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
+               "Filter can only reference the columns of the table being read");
+  CUDF_EXPECTS(expr.get_column_index() < _num_columns,
+               "Column index cannot be more than number of columns in the table");
+  return expr.get_column_index();
+}
+
+size_type column_filter_converter::column_index(ast::column_name_reference const& expr) const
+{
+  auto const it = _column_name_to_index.find(expr.get_column_name());
+  CUDF_EXPECTS(it != _column_name_to_index.end(), "Column name not found in the table");
+  return it->second;
+}
+
+std::reference_wrapper<ast::expression const> column_filter_converter::visit(
+  ast::literal const& expr)
+{
+  _converted_expr = std::reference_wrapper<ast::expression const>(expr);
+  return expr;
+}
+
+std::reference_wrapper<ast::expression const> column_filter_converter::visit(
+  ast::column_reference const& expr)
+{
+  return reference_column(column_index(expr), expr);
+}
+
+std::reference_wrapper<ast::expression const> column_filter_converter::visit(
+  ast::column_name_reference const& expr)
+{
+  return reference_column(column_index(expr), expr);
+}
+
+std::reference_wrapper<ast::expression const> column_filter_converter::reference_column(
+  size_type index, ast::expression const& expr)
+{
+  if (not _is_converting) {
+    _referenced_columns.push_back(index);
+    return expr;
+  }
+  auto const it = std::lower_bound(_referenced_columns.cbegin(), _referenced_columns.cend(), index);
+  _col_ref.emplace_back(static_cast<size_type>(std::distance(_referenced_columns.cbegin(), it)));
+  _converted_expr = std::reference_wrapper<ast::expression const>(_col_ref.back());
+  return std::reference_wrapper<ast::expression const>(_col_ref.back());
+}
+
+std::reference_wrapper<ast::expression const> column_filter_converter::visit(
+  ast::operation const& expr)
+{
+  auto const operands     = expr.get_operands();
+  auto const op           = expr.get_operator();
+  auto const new_operands = visit_operands(operands);
+  if (not _is_converting) { return expr; }
+  if (cudf::ast::detail::ast_operator_arity(op) == 2) {
+    _operators.emplace_back(op, new_operands.front(), new_operands.back());
+  } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
+    _operators.emplace_back(op, new_operands.front());
+  }
+  _converted_expr = std::reference_wrapper<ast::expression const>(_operators.back());
+  return std::reference_wrapper<ast::expression const>(_operators.back());
+}
+
+std::vector<std::reference_wrapper<ast::expression const>> column_filter_converter::visit_operands(
+  std::vector<std::reference_wrapper<ast::expression const>> operands)
+{
+  std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
+  for (auto const& operand : operands) {
+    transformed_operands.push_back(operand.get().accept(*this));
+  }
+  return transformed_operands;
+}
+
+std::unique_ptr<column> evaluate_filter(table_view const& referenced_columns,
+                                        column_filter_converter const& converter,
+                                        rmm::cuda_stream_view stream)
+{
+  auto predicate = cudf::detail::compute_column(referenced_columns,
+                                                converter.get_converted_expr(),
+                                                stream,
+                                                rmm::mr::get_current_device_resource());
+  CUDF_EXPECTS(predicate->view().type().id() == type_id::BOOL8,
+               "Predicate filter should return a boolean");
+  return predicate;
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,131 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <functional>
+#include <list>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Converts a filter on the columns of a table to a filter on only the columns it references.
+ *
+ * The filter can reference a column by its index with `ast::column_reference` or by its name with
+ * `ast::column_name_reference`. Readers use the converted filter to parse and evaluate the
+ * referenced columns before the other columns.
+ */
+class column_filter_converter : public ast::detail::expression_transformer {
+ public:
+  /**
+   * @brief Converts the filter `expr` on a table with the given column names.
+   *
+   * @throws cudf::logic_error if the filter references a column that is not in the table, or does
+   * not reference any column
+   *
+   * @param expr Filter on the columns of the table
+   * @param column_names Names of the columns of the table
+   */
+  column_filter_converter(ast::expression const& expr, host_span<std::string const> column_names);
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override;
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override;
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override;
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override;
+
+  /**
+   * @brief Returns the indices of the columns referenced by the filter, in increasing order.
+   *
+   * @return Indices of the referenced columns
+   */
+  [[nodiscard]] std::vector<size_type> const& get_referenced_columns() const
+  {
+    return _referenced_columns;
+  }
+
+  /**
+   * @brief Returns the filter on a table of only the referenced columns, in the order of
+   * `get_referenced_columns()`.
+   *
+   * @return The converted filter
+   */
+  [[nodiscard]] ast::expression const& get_converted_expr() const
+  {
+    return _converted_expr.value().get();
+  }
+
+ private:
+  size_type column_index(ast::column_reference const& expr) const;
+  size_type column_index(ast::column_name_reference const& expr) const;
+  std::reference_wrapper<ast::expression const> reference_column(size_type index,
+                                                                 ast::expression const& expr);
+
+  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
+    std::vector<std::reference_wrapper<ast::expression const>> operands);
+
+  size_type _num_columns;
+  std::unordered_map<std::string, size_type> _column_name_to_index;
+  std::vector<size_type> _referenced_columns;
+  // Whether the referenced columns are known and the references can be converted
+  bool _is_converting = false;
+  std::optional<std::reference_wrapper<ast::expression const>> _converted_expr;
+  // Using std::list to avoid reference invalidation
+  std::list<ast::column_reference> _col_ref;
+  std::list<ast::operation> _operators;
+};
+
+/**
+ * @brief Evaluates a filter converted by `column_filter_converter`.
+ *
+ * @throws cudf::logic_error if the filter does not produce a boolean column
+ *
+ * @param referenced_columns Table of the columns referenced by the filter
+ * @param converter The converted filter
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Boolean column that is true for the rows that pass the filter
+ */
+std::unique_ptr<column> evaluate_filter(table_view const& referenced_columns,
+                                        column_filter_converter const& converter,
+                                        rmm::cuda_stream_view stream);
+
+}  // namespace cudf::io::detail
@@ -16,6 +16,7 @@
 
 #include "config_utils.hpp"
 
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/io/memory_resource.hpp>
 #include <cudf/utilities/error.hpp>
@@ -26,8 +27,16 @@
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <algorithm>
+#include <atomic>
 #include <cstdlib>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <shared_mutex>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace cudf::io {
 
@@ -90,6 +99,45 @@ bool is_stable_enabled() { return is_all_enabled() or get_env_policy() == usage_
 
 }  // namespace nvcomp_integration
 
+namespace read_coalescing {
+
+std::size_t max_gap()
+{
+  static auto const env_val = getenv_or<std::size_t>("LIBCUDF_IO_COALESCE_GAP", 0);
+  return env_val;
+}
+
+}  // namespace read_coalescing
+
+namespace io_uring_integration {
+
+bool is_enabled()
+{
+  static auto const env_val = getenv_or<std::string>("LIBCUDF_IO_URING", "OFF");
+  if (env_val == "OFF") return false;
+  if (env_val == "ON") return true;
+  CUDF_FAIL("Invalid LIBCUDF_IO_URING value: " + env_val);
+}
+
+std::size_t queue_depth()
+{
+  static auto const env_val = getenv_or<std::size_t>("LIBCUDF_IO_URING_QUEUE_DEPTH", 32);
+  CUDF_EXPECTS(env_val > 0, "LIBCUDF_IO_URING_QUEUE_DEPTH must be positive");
+  return env_val;
+}
+
+}  // namespace io_uring_integration
+
+namespace parallel_sink {
+
+std::size_t num_threads()
+{
+  static auto const env_val = getenv_or<std::size_t>("LIBCUDF_IO_SINK_THREADS", 0);
+  return env_val;
+}
+
+}  // namespace parallel_sink
+
 }  // namespace detail
 
 namespace {
@@ -207,6 +255,271 @@ static_assert(cuda::mr::resource_with<fixed_pinned_pool_memory_resource,
                                       cuda::mr::host_accessible>,
               "");
 
+/**
+ * @brief Pool of large host blocks grouped into size classes.
+ *
+ * Freed blocks are cached by size class for reuse. Once `capacity` bytes are cached, blocks of
+ * the least recently requested size classes are returned to the upstream resource first.
+ */
+class size_class_pool {
+ public:
+  size_class_pool(rmm::host_async_resource_ref upstream, std::size_t capacity)
+    : upstream_{upstream}, capacity_{capacity}
+  {
+  }
+
+  /**
+   * @brief Round `bytes` up to its size class; there are four size classes per power of two
+   */
+  static std::size_t size_class(std::size_t bytes)
+  {
+    std::size_t octave = 1;
+    while (octave <= bytes / 2) {
+      octave <<= 1;
+    }
+    return cudf::util::round_up_safe(bytes, std::max<std::size_t>(octave / 4, 1));
+  }
+
+  void* allocate_async(std::size_t block_size, cuda::stream_ref stream, bool& is_cached)
+  {
+    {
+      std::scoped_lock lock{mutex_};
+      auto& size_class = free_blocks_[block_size];
+      size_class.last_use = ++clock_;
+      if (not size_class.blocks.empty()) {
+        auto const ptr = size_class.blocks.back();
+        size_class.blocks.pop_back();
+        cached_bytes_ -= block_size;
+        is_cached = true;
+        return ptr;
+      }
+    }
+    is_cached = false;
+    return upstream_.allocate_async(block_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+  }
+
+  void deallocate_async(void* ptr, std::size_t block_size, cuda::stream_ref stream) noexcept
+  {
+    std::vector<std::pair<void*, std::size_t>> evicted;
+    {
+      std::scoped_lock lock{mutex_};
+      if (block_size > capacity_) {
+        evicted.emplace_back(ptr, block_size);
+      } else {
+        while (cached_bytes_ + block_size > capacity_) {
+          auto victim = std::min_element(
+            free_blocks_.begin(), free_blocks_.end(), [](auto const& lhs, auto const& rhs) {
+              if (lhs.second.blocks.empty() != rhs.second.blocks.empty()) {
+                return rhs.second.blocks.empty();
+              }
+              return lhs.second.last_use < rhs.second.last_use;
+            });
+          evicted.emplace_back(victim->second.blocks.back(), victim->first);
+          victim->second.blocks.pop_back();
+          cached_bytes_ -= victim->first;
+        }
+        free_blocks_[block_size].blocks.push_back(ptr);
+        cached_bytes_ += block_size;
+      }
+    }
+    for (auto const& [evicted_ptr, evicted_size] : evicted) {
+      upstream_.deallocate_async(
+        evicted_ptr, evicted_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+    }
+  }
+
+ private:
+  struct size_class_blocks {
+    std::vector<void*> blocks;
+    std::size_t last_use{0};
+  };
+
+  rmm::host_async_resource_ref upstream_;
+  std::size_t const capacity_;
+  std::mutex mutex_;
+  std::map<std::size_t, size_class_blocks> free_blocks_;
+  std::size_t cached_bytes_{0};
+  std::size_t clock_{0};
+};
+
+// Per-thread counters reported by get_pinned_staging_statistics
+pinned_staging_statistics& thread_staging_statistics()
+{
+  thread_local pinned_staging_statistics statistics{};
+  return statistics;
+}
+
+/**
+ * @brief Host resource that bump-allocates small buffers from per-thread arenas and sends large
+ * buffers to a size-class pool, all layered over an upstream host resource.
+ *
+ * All arenas are carved out of a single upstream allocation so that finding the arena that owns
+ * a pointer is a range check. An arena is rewound when its last allocation is freed, and its
+ * top allocation is reclaimed immediately when freed in LIFO order.
+ */
+class pinned_staging_memory_resource {
+ private:
+  struct arena {
+    std::mutex mutex;
+    std::size_t top{0};
+    std::size_t num_outstanding{0};
+  };
+
+  rmm::host_async_resource_ref upstream_;
+  std::size_t arena_size_;
+  std::size_t num_arenas_;
+  std::size_t large_threshold_;
+  uint8_t* arenas_begin_;
+  std::unique_ptr<arena[]> arenas_;
+  std::atomic<std::size_t> next_arena_{0};
+  size_class_pool large_pool_;
+  cuda::stream_ref stream_{cudf::detail::global_cuda_stream_pool().get_stream().value()};
+
+  [[nodiscard]] bool is_large(std::size_t bytes, std::size_t alignment) const
+  {
+    return bytes >= large_threshold_ and alignment <= rmm::RMM_DEFAULT_HOST_ALIGNMENT;
+  }
+
+  [[nodiscard]] bool is_arena_pointer(void* ptr) const
+  {
+    auto const p = static_cast<uint8_t*>(ptr);
+    return p >= arenas_begin_ and p < arenas_begin_ + arena_size_ * num_arenas_;
+  }
+
+  std::size_t thread_arena()
+  {
+    thread_local std::size_t const index = next_arena_.fetch_add(1) % num_arenas_;
+    return index;
+  }
+
+ public:
+  pinned_staging_memory_resource(rmm::host_async_resource_ref upstream,
+                                 pinned_staging_options const& opts)
+    : upstream_{upstream},
+      arena_size_{cudf::util::round_up_safe(opts.arena_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT)},
+      num_arenas_{opts.num_arenas},
+      large_threshold_{opts.large_allocation_threshold},
+      arenas_begin_{static_cast<uint8_t*>(upstream_.allocate(
+        arena_size_ * num_arenas_, rmm::RMM_DEFAULT_HOST_ALIGNMENT))},
+      arenas_{std::make_unique<arena[]>(num_arenas_)},
+      large_pool_{upstream, opts.large_pool_size}
+  {
+  }
+
+  void* do_allocate_async(std::size_t bytes, std::size_t alignment, cuda::stream_ref stream)
+  {
+    auto& statistics = thread_staging_statistics();
+    ++statistics.num_allocations;
+
+    if (is_large(bytes, alignment)) {
+      auto is_cached = false;
+      auto const ptr =
+        large_pool_.allocate_async(size_class_pool::size_class(bytes), stream, is_cached);
+      (is_cached ? statistics.large_pool_bytes : statistics.upstream_bytes) += bytes;
+      return ptr;
+    }
+
+    if (bytes <= arena_size_) {
+      auto const index = thread_arena();
+      auto& local      = arenas_[index];
+      std::scoped_lock lock{local.mutex};
+      auto const offset = cudf::util::round_up_safe(local.top, alignment);
+      if (offset + bytes <= arena_size_) {
+        local.top = offset + bytes;
+        ++local.num_outstanding;
+        statistics.arena_bytes += bytes;
+        return arenas_begin_ + index * arena_size_ + offset;
+      }
+    }
+
+    // The arena is full, fall back to the shared upstream resource
+    statistics.upstream_bytes += bytes;
+    return upstream_.allocate_async(bytes, alignment, stream);
+  }
+
+  void do_deallocate_async(void* ptr,
+                           std::size_t bytes,
+                           std::size_t alignment,
+                           cuda::stream_ref stream) noexcept
+  {
+    if (is_large(bytes, alignment)) {
+      large_pool_.deallocate_async(ptr, size_class_pool::size_class(bytes), stream);
+    } else if (is_arena_pointer(ptr)) {
+      auto const distance = static_cast<std::size_t>(static_cast<uint8_t*>(ptr) - arenas_begin_);
+      auto& owner         = arenas_[distance / arena_size_];
+      std::scoped_lock lock{owner.mutex};
+      auto const offset = distance % arena_size_;
+      if (--owner.num_outstanding == 0) {
+        owner.top = 0;
+      } else if (offset + bytes == owner.top) {
+        owner.top = offset;
+      }
+    } else {
+      upstream_.deallocate_async(ptr, bytes, alignment, stream);
+    }
+  }
+
+  void* allocate_async(std::size_t bytes, cuda::stream_ref stream)
+  {
+    return do_allocate_async(bytes, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+  }
+
+  void* allocate_async(std::size_t bytes, std::size_t alignment, cuda::stream_ref stream)
+  {
+    return do_allocate_async(bytes, alignment, stream);
+  }
+
+  void* allocate(std::size_t bytes, std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT)
+  {
+    auto const result = do_allocate_async(bytes, alignment, stream_);
+    stream_.wait();
+    return result;
+  }
+
+  void deallocate_async(void* ptr, std::size_t bytes, cuda::stream_ref stream) noexcept
+  {
+    return do_deallocate_async(ptr, bytes, rmm::RMM_DEFAULT_HOST_ALIGNMENT, stream);
+  }
+
+  void deallocate_async(void* ptr,
+                        std::size_t bytes,
+                        std::size_t alignment,
+                        cuda::stream_ref stream) noexcept
+  {
+    return do_deallocate_async(ptr, bytes, alignment, stream);
+  }
+
+  void deallocate(void* ptr,
+                  std::size_t bytes,
+                  std::size_t alignment = rmm::RMM_DEFAULT_HOST_ALIGNMENT) noexcept
+  {
+    deallocate_async(ptr, bytes, alignment, stream_);
+    stream_.wait();
+  }
+
+  bool operator==(pinned_staging_memory_resource const& other) const { return this == &other; }
+
+  bool operator!=(pinned_staging_memory_resource const& other) const
+  {
+    return !operator==(other);
+  }
+
+  [[maybe_unused]] friend void get_property(pinned_staging_memory_resource const&,
+                                            cuda::mr::device_accessible) noexcept
+  {
+  }
+
+  [[maybe_unused]] friend void get_property(pinned_staging_memory_resource const&,
+                                            cuda::mr::host_accessible) noexcept
+  {
+  }
+};
+
+static_assert(cuda::mr::resource_with<pinned_staging_memory_resource,
+                                      cuda::mr::device_accessible,
+                                      cuda::mr::host_accessible>,
+              "");
+
 }  // namespace
 
 CUDF_EXPORT rmm::host_async_resource_ref& make_default_pinned_mr(std::optional<size_t> config_size)
@@ -237,9 +550,11 @@ CUDF_EXPORT rmm::host_async_resource_ref& make_default_pinned_mr(std::optional<s
   return mr_ref;
 }
 
-CUDF_EXPORT std::mutex& host_mr_mutex()
+// Shared for reads of the resource, which happen on every pinned host allocation, so that
+// concurrent readers do not serialize on it; exclusive for (re)configuration
+CUDF_EXPORT std::shared_mutex& host_mr_mutex()
 {
-  static std::mutex map_lock;
+  static std::shared_mutex map_lock;
   return map_lock;
 }
 
@@ -278,7 +593,7 @@ rmm::host_async_resource_ref set_host_memory_resource(rmm::host_async_resource_r
 
 rmm::host_async_resource_ref get_host_memory_resource()
 {
-  std::scoped_lock lock{host_mr_mutex()};
+  std::shared_lock lock{host_mr_mutex()};
   return host_mr();
 }
 
@@ -290,4 +605,21 @@ bool config_default_host_memory_resource(host_mr_options const& opts)
   return did_configure;
 }
 
+bool config_pinned_staging_arenas(pinned_staging_options const& opts)
+{
+  CUDF_EXPECTS(opts.num_arenas > 0 and opts.arena_size > 0,
+               "Pinned staging arenas must have a non-zero count and size");
+  std::scoped_lock lock{host_mr_mutex()};
+  // Raw pointer to avoid a segfault when the arenas are destroyed on exit
+  static pinned_staging_memory_resource* staging_mr = nullptr;
+  if (staging_mr != nullptr) { return false; }
+  staging_mr = new pinned_staging_memory_resource(host_mr(), opts);
+  host_mr()  = *staging_mr;
+  return true;
+}
+
+pinned_staging_statistics get_pinned_staging_statistics() { return thread_staging_statistics(); }
+
+void reset_pinned_staging_statistics() { thread_staging_statistics() = {}; }
+
 }  // namespace cudf::io
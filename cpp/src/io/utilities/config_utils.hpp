@@ -17,6 +17,7 @@
 
 #include <cudf/detail/utilities/logger.hpp>
 
+#include <cstddef>
 #include <sstream>
 #include <string>
 
@@ -78,4 +79,40 @@ bool is_stable_enabled();
 
 }  // namespace nvcomp_integration
 
+namespace read_coalescing {
+
+/**
+ * @brief Returns the largest gap, in bytes, between two ranges of a source that are merged into a
+ * single read. Zero (the default) disables merging of non-adjacent ranges.
+ */
+std::size_t max_gap();
+
+}  // namespace read_coalescing
+
+namespace io_uring_integration {
+
+/**
+ * @brief Returns true if file sources should read through io_uring when GDS is not in use.
+ * Controlled by `LIBCUDF_IO_URING`, `OFF` (default) or `ON`.
+ */
+bool is_enabled();
+
+/**
+ * @brief Returns the number of reads an io_uring source keeps in flight.
+ * Controlled by `LIBCUDF_IO_URING_QUEUE_DEPTH`, 32 by default.
+ */
+std::size_t queue_depth();
+
+}  // namespace io_uring_integration
+
+namespace parallel_sink {
+
+/**
+ * @brief Returns the number of threads that write the parts of a file sink concurrently.
+ * Controlled by `LIBCUDF_IO_SINK_THREADS`; zero (the default) keeps the serial file sink.
+ */
+std::size_t num_threads();
+
+}  // namespace parallel_sink
+
 }  // namespace cudf::io::detail
@@ -16,6 +16,7 @@
 
 #include "file_io_utilities.hpp"
 #include "io/utilities/config_utils.hpp"
+#include "parallel_sink.hpp"
 
 #include <cudf/io/data_sink.hpp>
 #include <cudf/utilities/error.hpp>
@@ -209,6 +210,10 @@ class user_sink_wrapper : public data_sink {
 
 std::unique_ptr<data_sink> data_sink::create(std::string const& filepath)
 {
+  if (auto const num_threads = detail::parallel_sink::num_threads();
+      num_threads > 0 and not detail::cufile_integration::is_gds_enabled()) {
+    return detail::make_parallel_file_sink(filepath, num_threads);
+  }
   return std::make_unique<file_sink>(filepath);
 }
 
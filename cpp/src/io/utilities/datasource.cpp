@@ -16,6 +16,8 @@
 
 #include "file_io_utilities.hpp"
 #include "io/utilities/config_utils.hpp"
+#include "remote_source.hpp"
+#include "uring_source.hpp"
 
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/io/datasource.hpp>
@@ -30,6 +32,7 @@
 #include <sys/mman.h>
 #include <unistd.h>
 
+#include <shared_mutex>
 #include <unordered_map>
 
 namespace cudf {
@@ -113,20 +116,27 @@ class file_source : public datasource {
  */
 [[nodiscard]] bool pageableMemoryAccessUsesHostPageTables()
 {
+  static std::shared_mutex result_cache_mutex{};
   static std::unordered_map<int, bool> result_cache{};
 
   int deviceId{};
   CUDF_CUDA_TRY(cudaGetDevice(&deviceId));
 
-  if (result_cache.find(deviceId) == result_cache.end()) {
-    cudaDeviceProp props{};
-    CUDF_CUDA_TRY(cudaGetDeviceProperties(&props, deviceId));
-    result_cache[deviceId] = (props.pageableMemoryAccessUsesHostPageTables == 1);
-    CUDF_LOG_INFO(
-      "Device {} pageableMemoryAccessUsesHostPageTables: {}", deviceId, result_cache[deviceId]);
+  {
+    std::shared_lock<std::shared_mutex> lock(result_cache_mutex);
+    auto const cached = result_cache.find(deviceId);
+    if (cached != result_cache.end()) { return cached->second; }
   }
 
-  return result_cache[deviceId];
+  cudaDeviceProp props{};
+  CUDF_CUDA_TRY(cudaGetDeviceProperties(&props, deviceId));
+  auto const result = props.pageableMemoryAccessUsesHostPageTables == 1;
+
+  std::unique_lock<std::shared_mutex> lock(result_cache_mutex);
+  if (result_cache.insert({deviceId, result}).second) {
+    CUDF_LOG_INFO("Device {} pageableMemoryAccessUsesHostPageTables: {}", deviceId, result);
+  }
+  return result;
 }
 
 /**
@@ -432,12 +442,17 @@ std::unique_ptr<datasource> datasource::create(std::string const& filepath,
                                                size_t offset,
                                                size_t size)
 {
+  if (detail::is_remote_url(filepath)) { return detail::make_remote_source(filepath); }
 #ifdef CUFILE_FOUND
   if (detail::cufile_integration::is_always_enabled()) {
     // avoid mmap as GDS is expected to be used for most reads
     return std::make_unique<direct_read_source>(filepath.c_str());
   }
 #endif
+  if (detail::io_uring_integration::is_enabled() and
+      not detail::cufile_integration::is_gds_enabled()) {
+    if (auto source = detail::make_uring_source(filepath); source != nullptr) { return source; }
+  }
   // Use our own memory mapping implementation for direct file reads
   return std::make_unique<memory_mapped_source>(filepath.c_str(), offset, size);
 }
@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parallel_sink.hpp"
+
+#include "file_io_utilities.hpp"
+
+#include <cudf/detail/utilities/logger.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/thread_pool.hpp>
+
+#include <rmm/aligned.hpp>
+#include <rmm/cuda_stream_view.hpp>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <vector>
+
+namespace cudf::io::detail {
+
+namespace {
+
+// Small writes are gathered into parts of this size, and larger parts are written in pieces of
+// this size so that a single large write is also spread over the threads
+constexpr std::size_t part_size = 8 << 20;
+// Writes block once this many staged bytes are waiting to be written
+constexpr std::size_t max_pending_bytes = 256 << 20;
+
+/**
+ * @brief Pinned host buffer that holds the data of one part until it is written
+ */
+struct staged_part {
+  explicit staged_part(std::size_t capacity)
+    : data{static_cast<uint8_t*>(
+        get_host_memory_resource().allocate(capacity, rmm::RMM_DEFAULT_HOST_ALIGNMENT))},
+      capacity{capacity}
+  {
+  }
+
+  staged_part(staged_part const&)            = delete;
+  staged_part& operator=(staged_part const&) = delete;
+
+  ~staged_part()
+  {
+    get_host_memory_resource().deallocate(data, capacity, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+  }
+
+  uint8_t* data;
+  std::size_t capacity;
+  std::size_t size{0};
+  std::size_t file_offset{0};
+};
+
+void write_fully(int fd, uint8_t const* data, std::size_t size, std::size_t offset)
+{
+  while (size > 0) {
+    auto const written = pwrite(fd, data, size, offset);
+    if (written < 0 and errno == EINTR) { continue; }
+    CUDF_EXPECTS(written >= 0, "Cannot write to file: " + std::string{std::strerror(errno)});
+    data += written;
+    size -= written;
+    offset += written;
+  }
+}
+
+/**
+ * @brief Implementation class for writing a file as parts staged in host memory
+ *
+ * The sink owns its thread pool, since `host_write` may be called from a task of the host worker
+ * pool and waits on the part writes when too many of them are pending.
+ */
+class parallel_file_sink final : public data_sink {
+ public:
+  parallel_file_sink(std::string const& filepath, std::size_t num_threads)
+    : _file{filepath, O_CREAT | O_WRONLY | O_TRUNC, 0644}, _pool{static_cast<int>(num_threads)}
+  {
+    force_init_cuda_context();
+  }
+
+  ~parallel_file_sink() override
+  {
+    try {
+      flush();
+    } catch (std::exception const& e) {
+      CUDF_LOG_ERROR("Parallel file sink failed to write its data: {}", e.what());
+    }
+  }
+
+  void host_write(void const* data, size_t size) override
+  {
+    std::lock_guard lock{_mutex};
+    if (size >= part_size) {
+      submit_open_part();
+      auto part = new_part(size);
+      std::memcpy(part->data, data, size);
+      part->size = size;
+      submit(std::move(part), nullptr);
+      return;
+    }
+    if (_open_part != nullptr and _open_part->size + size > _open_part->capacity) {
+      submit_open_part();
+    }
+    if (_open_part == nullptr) { _open_part = new_part(part_size); }
+    std::memcpy(_open_part->data + _open_part->size, data, size);
+    _open_part->size += size;
+    _bytes_written += size;
+  }
+
+  [[nodiscard]] bool supports_device_write() const override { return true; }
+
+  // Device data is staged with an asynchronous copy, which never blocks the writer
+  [[nodiscard]] bool is_device_write_preferred(size_t) const override { return true; }
+
+  std::future<void> device_write_async(void const* gpu_data,
+                                       size_t size,
+                                       rmm::cuda_stream_view stream) override
+  {
+    std::lock_guard lock{_mutex};
+    submit_open_part();
+    if (size == 0) {
+      return std::async(std::launch::deferred, [] {});
+    }
+    auto part = new_part(size);
+    CUDF_CUDA_TRY(cudaMemcpyAsync(part->data, gpu_data, size, cudaMemcpyDefault, stream.value()));
+    part->size = size;
+    cudaEvent_t event;
+    CUDF_CUDA_TRY(cudaEventCreateWithFlags(&event, cudaEventDisableTiming));
+    auto copied = std::shared_ptr<CUevent_st>(event, [](cudaEvent_t e) { cudaEventDestroy(e); });
+    CUDF_CUDA_TRY(cudaEventRecord(event, stream.value()));
+    auto written = submit(std::move(part), std::move(copied));
+    return std::async(std::launch::deferred, [written] { written.get(); });
+  }
+
+  void device_write(void const* gpu_data, size_t size, rmm::cuda_stream_view stream) override
+  {
+    device_write_async(gpu_data, size, stream).get();
+  }
+
+  void flush() override
+  {
+    std::lock_guard lock{_mutex};
+    submit_open_part();
+    while (not _pending.empty()) {
+      wait_oldest();
+    }
+  }
+
+  size_t bytes_written() override { return _bytes_written; }
+
+ private:
+  std::shared_ptr<staged_part> new_part(std::size_t capacity)
+  {
+    auto part         = std::make_shared<staged_part>(capacity);
+    part->file_offset = _bytes_written;
+    return part;
+  }
+
+  void submit_open_part()
+  {
+    if (_open_part == nullptr) { return; }
+    // the bytes of the open part were counted as they were added
+    _bytes_written -= _open_part->size;
+    submit(std::move(_open_part), nullptr);
+  }
+
+  /**
+   * @brief Writes a staged part in pieces on the pool, once `copied` has completed if set
+   *
+   * Advances `_bytes_written` past the part and blocks while too many bytes are pending.
+   */
+  std::shared_future<void> submit(std::shared_ptr<staged_part> part,
+                                  std::shared_ptr<CUevent_st> copied)
+  {
+    auto const size = part->size;
+    std::vector<std::future<void>> pieces;
+    for (std::size_t begin = 0; begin < size; begin += part_size) {
+      pieces.push_back(_pool.submit([fd = _file.desc(), part, copied, begin, size] {
+        if (copied != nullptr) { CUDF_CUDA_TRY(cudaEventSynchronize(copied.get())); }
+        auto const count = std::min(part_size, size - begin);
+        write_fully(fd, part->data + begin, count, part->file_offset + begin);
+      }));
+    }
+    _bytes_written += size;
+
+    auto written = std::async(std::launch::deferred, [pieces = std::move(pieces)]() mutable {
+                     for (auto& piece : pieces) {
+                       piece.wait();
+                     }
+                     for (auto& piece : pieces) {
+                       piece.get();
+                     }
+                   }).share();
+    _pending.emplace_back(written, size);
+    _pending_bytes += size;
+    while (_pending_bytes > max_pending_bytes and _pending.size() > 1) {
+      wait_oldest();
+    }
+    return written;
+  }
+
+  void wait_oldest()
+  {
+    auto const [written, size] = _pending.front();
+    _pending.pop_front();
+    _pending_bytes -= size;
+    written.get();
+  }
+
+  file_wrapper _file;
+  cudf::detail::thread_pool _pool;
+  std::mutex _mutex;
+  std::shared_ptr<staged_part> _open_part;
+  std::deque<std::pair<std::shared_future<void>, std::size_t>> _pending;
+  std::size_t _pending_bytes{0};
+  std::size_t _bytes_written{0};
+};
+
+}  // namespace
+
+std::unique_ptr<data_sink> make_parallel_file_sink(std::string const& filepath,
+                                                   std::size_t num_threads)
+{
+  CUDF_EXPECTS(num_threads > 0, "A parallel sink needs at least one thread");
+  return std::make_unique<parallel_file_sink>(filepath, num_threads);
+}
+
+}  // namespace cudf::io::detail
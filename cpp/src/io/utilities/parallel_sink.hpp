@@ -0,0 +1,43 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/data_sink.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Create a file sink that writes the output as independent parts in parallel
+ *
+ * Every write reserves the next range of the file and returns once its data has been staged in
+ * pinned host memory; the staged part is then written at its offset by one of `num_threads`
+ * threads. Small host writes are gathered into parts of a few megabytes, and device writes are
+ * copied to the host asynchronously, so writers are not blocked by the latency of each storage
+ * write. `flush` waits until all parts are written and rethrows the first write error.
+ *
+ * @param filepath Path of the file to write
+ * @param num_threads Number of parts written concurrently
+ * @return The parallel file sink
+ */
+std::unique_ptr<data_sink> make_parallel_file_sink(std::string const& filepath,
+                                                   std::size_t num_threads);
+
+}  // namespace cudf::io::detail
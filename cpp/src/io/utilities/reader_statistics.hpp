@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/io/types.hpp>
+
+#include <chrono>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Adds the wall-clock time of its lifetime to one phase time of the reader statistics.
+ *
+ * Does nothing if no statistics are collected.
+ */
+class scoped_phase_timer {
+ public:
+  /**
+   * @brief Start timing the phase `phase` of `statistics`.
+   *
+   * @param statistics Statistics to update, or `nullptr` if they are not collected
+   * @param phase Member of `reader_statistics` holding the time of the phase
+   */
+  scoped_phase_timer(reader_statistics* statistics,
+                     std::chrono::nanoseconds reader_statistics::*phase)
+    : _statistics{statistics},
+      _phase{phase},
+      _start{statistics != nullptr ? std::chrono::steady_clock::now()
+                                   : std::chrono::steady_clock::time_point{}}
+  {
+  }
+
+  ~scoped_phase_timer()
+  {
+    if (_statistics == nullptr) { return; }
+    _statistics->*_phase += std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::steady_clock::now() - _start);
+  }
+
+  scoped_phase_timer(scoped_phase_timer const&)            = delete;
+  scoped_phase_timer& operator=(scoped_phase_timer const&) = delete;
+
+ private:
+  reader_statistics* _statistics;
+  std::chrono::nanoseconds reader_statistics::*_phase;
+  std::chrono::steady_clock::time_point _start;
+};
+
+}  // namespace cudf::io::detail
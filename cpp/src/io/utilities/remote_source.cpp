@@ -0,0 +1,365 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "remote_source.hpp"
+
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <netdb.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf::io::detail {
+
+namespace {
+
+// Reads are split into parts of at least this size that are fetched concurrently
+constexpr std::size_t min_part_size = 4 * 1024 * 1024;
+// Upper bound on the number of concurrent range requests issued for a single read
+constexpr std::size_t max_parallel_requests = 16;
+// Size of the range prefetched after a sequential read
+constexpr std::size_t readahead_size = 32 * 1024 * 1024;
+// Reads that start at most this far past the previous read are considered sequential
+constexpr std::size_t max_sequential_gap = 1024 * 1024;
+
+std::string const http_scheme = "http://";
+
+struct parsed_url {
+  std::string host;
+  std::string port;
+  std::string path;
+};
+
+parsed_url parse_url(std::string const& url)
+{
+  CUDF_EXPECTS(is_remote_url(url), "Unsupported remote URL: " + url);
+  auto const rest      = url.substr(http_scheme.size());
+  auto const slash     = rest.find('/');
+  auto const authority = rest.substr(0, slash);
+  auto const colon     = authority.find(':');
+
+  parsed_url result;
+  result.host = authority.substr(0, colon);
+  result.port = colon == std::string::npos ? "80" : authority.substr(colon + 1);
+  result.path = slash == std::string::npos ? "/" : rest.substr(slash);
+  CUDF_EXPECTS(not result.host.empty() and not result.port.empty(), "Invalid URL: " + url);
+  return result;
+}
+
+/**
+ * @brief Class that provides RAII for a connected TCP socket.
+ */
+class connection {
+  int fd = -1;
+
+ public:
+  connection(std::string const& host, std::string const& port)
+  {
+    addrinfo hints{};
+    hints.ai_family   = AF_UNSPEC;
+    hints.ai_socktype = SOCK_STREAM;
+    addrinfo* addresses{};
+    CUDF_EXPECTS(getaddrinfo(host.c_str(), port.c_str(), &hints, &addresses) == 0,
+                 "Cannot resolve host " + host);
+    for (auto address = addresses; address != nullptr; address = address->ai_next) {
+      fd = socket(address->ai_family, address->ai_socktype, address->ai_protocol);
+      if (fd == -1) { continue; }
+      if (connect(fd, address->ai_addr, address->ai_addrlen) == 0) { break; }
+      ::close(fd);
+      fd = -1;
+    }
+    freeaddrinfo(addresses);
+    CUDF_EXPECTS(fd != -1, "Cannot connect to " + host + ":" + port);
+  }
+
+  ~connection() { ::close(fd); }
+
+  connection(connection const&)            = delete;
+  connection& operator=(connection const&) = delete;
+
+  void send_all(std::string const& data)
+  {
+    std::size_t sent = 0;
+    while (sent < data.size()) {
+      auto const result = ::send(fd, data.data() + sent, data.size() - sent, MSG_NOSIGNAL);
+      if (result == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(result > 0, "Failed to send HTTP request");
+      sent += result;
+    }
+  }
+
+  /**
+   * @brief Receives up to `size` bytes; returns 0 once the peer closed the connection
+   */
+  std::size_t receive(void* dst, std::size_t size)
+  {
+    while (true) {
+      auto const result = ::recv(fd, dst, size, 0);
+      if (result == -1 and errno == EINTR) { continue; }
+      CUDF_EXPECTS(result >= 0, "Failed to receive HTTP response");
+      return result;
+    }
+  }
+};
+
+struct http_response {
+  int status{0};
+  std::map<std::string, std::string> headers;  // keys are lower case
+  std::size_t body_size{0};                    // number of body bytes written to the destination
+};
+
+/**
+ * @brief Issue one HTTP request and write up to `dst_size` bytes of the body to `dst`
+ */
+http_response http_request(parsed_url const& url,
+                           std::string const& method,
+                           std::optional<std::pair<std::size_t, std::size_t>> range,
+                           uint8_t* dst,
+                           std::size_t dst_size)
+{
+  connection conn(url.host, url.port);
+  std::string request = method + " " + url.path + " HTTP/1.1\r\nHost: " + url.host +
+                        "\r\nAccept-Encoding: identity\r\nConnection: close\r\n";
+  if (range.has_value()) {
+    request += "Range: bytes=" + std::to_string(range->first) + "-" +
+               std::to_string(range->first + range->second - 1) + "\r\n";
+  }
+  request += "\r\n";
+  conn.send_all(request);
+
+  // Read until the end of the headers; any body bytes received with them are kept
+  std::string head;
+  std::size_t header_end = std::string::npos;
+  std::vector<char> chunk(64 * 1024);
+  while (header_end == std::string::npos) {
+    auto const received = conn.receive(chunk.data(), chunk.size());
+    CUDF_EXPECTS(received > 0, "Connection closed before the HTTP response headers");
+    head.append(chunk.data(), received);
+    header_end = head.find("\r\n\r\n");
+  }
+
+  http_response response;
+  auto const status_begin = head.find(' ');
+  CUDF_EXPECTS(head.rfind("HTTP/", 0) == 0 and status_begin != std::string::npos,
+               "Malformed HTTP response");
+  response.status = std::stoi(head.substr(status_begin + 1, 3));
+
+  auto line_begin = head.find("\r\n") + 2;
+  while (line_begin < header_end) {
+    auto const line_end = head.find("\r\n", line_begin);
+    auto const line     = head.substr(line_begin, line_end - line_begin);
+    auto const colon    = line.find(':');
+    if (colon != std::string::npos) {
+      auto key = line.substr(0, colon);
+      std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) {
+        return std::tolower(c);
+      });
+      auto const value_begin = line.find_first_not_of(' ', colon + 1);
+      response.headers[key]  = value_begin == std::string::npos ? "" : line.substr(value_begin);
+    }
+    line_begin = line_end + 2;
+  }
+  if (method == "HEAD" or dst_size == 0) { return response; }
+
+  CUDF_EXPECTS(response.headers.count("transfer-encoding") == 0 or
+                 response.headers["transfer-encoding"] == "identity",
+               "Chunked HTTP responses are not supported");
+
+  auto const body_prefix = head.size() - (header_end + 4);
+  auto const copied      = std::min(body_prefix, dst_size);
+  std::memcpy(dst, head.data() + header_end + 4, copied);
+  response.body_size = copied;
+  while (response.body_size < dst_size) {
+    auto const received = conn.receive(dst + response.body_size, dst_size - response.body_size);
+    if (received == 0) { break; }
+    response.body_size += received;
+  }
+  return response;
+}
+
+/**
+ * @brief Implementation class for reading a remote object with HTTP range requests
+ */
+class remote_source final : public datasource {
+ public:
+  explicit remote_source(std::string const& url) : _url{parse_url(url)}, _size{fetch_size()} {}
+
+  ~remote_source() override
+  {
+    // Wait for the readahead so that it does not outlive the source
+    if (_readahead.has_value() and _readahead->ready.valid()) { _readahead->ready.wait(); }
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    auto const read_size = offset < _size ? std::min(size, _size - offset) : 0;
+    std::vector<uint8_t> data(read_size);
+    host_read(offset, read_size, data.data());
+    return buffer::create(std::move(data));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    if (offset >= _size) { return 0; }
+    auto const read_size = std::min(size, _size - offset);
+    if (read_size == 0) { return 0; }
+
+    auto const served = copy_from_readahead(offset, read_size, dst);
+    if (served < read_size) { fetch(offset + served, read_size - served, dst + served); }
+    schedule_readahead(offset, read_size);
+    return read_size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _size; }
+
+ private:
+  struct readahead {
+    std::size_t offset;
+    std::shared_ptr<std::vector<uint8_t>> data;
+    std::shared_future<void> ready;
+  };
+
+  std::size_t fetch_size() const
+  {
+    auto response = http_request(_url, "HEAD", std::nullopt, nullptr, 0);
+    if (response.status == 200 and response.headers.count("content-length") != 0) {
+      return std::stoull(response.headers["content-length"]);
+    }
+
+    // Some object stores reject HEAD requests; the total size is also part of a range response
+    uint8_t first_byte{};
+    response = http_request(_url, "GET", std::pair{std::size_t{0}, std::size_t{1}}, &first_byte, 1);
+    CUDF_EXPECTS(response.status == 206 and response.headers.count("content-range") != 0,
+                 "Remote object size is unavailable: server does not support range requests");
+    auto const& content_range = response.headers["content-range"];
+    return std::stoull(content_range.substr(content_range.find('/') + 1));
+  }
+
+  void fetch_range(std::size_t offset, std::size_t size, uint8_t* dst) const
+  {
+    auto const response = http_request(_url, "GET", std::pair{offset, size}, dst, size);
+    // A server that ignores the range returns the whole object, which is only usable from the start
+    CUDF_EXPECTS(response.status == 206 or (response.status == 200 and offset == 0),
+                 "HTTP range request failed with status " + std::to_string(response.status));
+    CUDF_EXPECTS(response.body_size == size, "HTTP range request returned too few bytes");
+  }
+
+  /**
+   * @brief Fetch a range by splitting it into parts that are requested concurrently
+   */
+  void fetch(std::size_t offset, std::size_t size, uint8_t* dst) const
+  {
+    auto const num_parts = std::clamp<std::size_t>(
+      cudf::util::div_rounding_up_safe(size, min_part_size), 1, max_parallel_requests);
+    if (num_parts == 1) { return fetch_range(offset, size, dst); }
+
+    auto const part_size = cudf::util::div_rounding_up_safe(size, num_parts);
+    std::vector<std::future<void>> parts;
+    for (std::size_t part_offset = 0; part_offset < size; part_offset += part_size) {
+      auto const this_part = std::min(part_size, size - part_offset);
+      parts.push_back(std::async(std::launch::async, [=] {
+        fetch_range(offset + part_offset, this_part, dst + part_offset);
+      }));
+    }
+    for (auto& part : parts) {
+      part.get();
+    }
+  }
+
+  /**
+   * @brief Copy the head of the requested range from the readahead buffer
+   *
+   * @return Number of bytes copied, which is zero unless the readahead covers `offset`
+   */
+  std::size_t copy_from_readahead(std::size_t offset, std::size_t size, uint8_t* dst)
+  {
+    std::optional<readahead> current;
+    {
+      std::scoped_lock lock{_mutex};
+      current = _readahead;
+    }
+    if (not current.has_value() or offset < current->offset or
+        offset >= current->offset + current->data->size()) {
+      return 0;
+    }
+    try {
+      current->ready.get();
+    } catch (...) {
+      // A failed readahead is not fatal, the range is fetched directly instead
+      return 0;
+    }
+    auto const begin  = offset - current->offset;
+    auto const copied = std::min(size, current->data->size() - begin);
+    std::memcpy(dst, current->data->data() + begin, copied);
+    return copied;
+  }
+
+  /**
+   * @brief Prefetch the range following a read if reads are sequential
+   */
+  void schedule_readahead(std::size_t offset, std::size_t size)
+  {
+    // Destroyed after the lock is released since it may wait for the previous readahead
+    std::optional<readahead> previous;
+    std::scoped_lock lock{_mutex};
+    auto const is_sequential = _last_read_end.has_value() and offset >= *_last_read_end and
+                               offset - *_last_read_end <= max_sequential_gap;
+    auto const next = offset + size;
+    _last_read_end  = next;
+    if (not is_sequential or next >= _size) { return; }
+    if (_readahead.has_value() and next >= _readahead->offset and
+        next < _readahead->offset + _readahead->data->size()) {
+      return;
+    }
+
+    auto const prefetch_size = std::min(readahead_size, _size - next);
+    auto data                = std::make_shared<std::vector<uint8_t>>(prefetch_size);
+    auto fetch_next          = [this, next, data] { fetch(next, data->size(), data->data()); };
+    auto ready               = std::async(std::launch::async, std::move(fetch_next)).share();
+
+    previous = std::exchange(_readahead, readahead{next, std::move(data), std::move(ready)});
+  }
+
+  parsed_url const _url;
+  std::size_t const _size;
+  std::mutex _mutex;
+  std::optional<readahead> _readahead;
+  std::optional<std::size_t> _last_read_end;
+};
+
+}  // namespace
+
+bool is_remote_url(std::string const& path) { return path.rfind(http_scheme, 0) == 0; }
+
+std::unique_ptr<datasource> make_remote_source(std::string const& url)
+{
+  return std::make_unique<remote_source>(url);
+}
+
+}  // namespace cudf::io::detail
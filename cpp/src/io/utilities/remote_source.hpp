@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Whether `path` names a remote object that should be read with `make_remote_source`
+ *
+ * @param path Path passed to `datasource::create`
+ * @return True if `path` starts with `http://`
+ */
+[[nodiscard]] bool is_remote_url(std::string const& path);
+
+/**
+ * @brief Create a datasource that reads a remote object with HTTP range requests
+ *
+ * Each read is split into parts that are fetched in parallel over separate connections.
+ * Sequential access is detected and the range following the last read is prefetched, so that
+ * the column chunks or stripes the readers request one after another are served from memory.
+ *
+ * @throws cudf::logic_error if the URL is malformed or the server cannot report the object size
+ *
+ * @param url URL of the object
+ * @return The remote datasource
+ */
+std::unique_ptr<datasource> make_remote_source(std::string const& url);
+
+}  // namespace cudf::io::detail
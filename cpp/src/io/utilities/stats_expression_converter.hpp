@@ -0,0 +1,257 @@
+/*
+ * Copyright (c) 2023-2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <functional>
+#include <list>
+#include <optional>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Converts AST expression to StatsAST for comparing with column statistics
+ * This is used in row group filtering based on predicate.
+ * statistics min value of a column is referenced by column_index*2
+ * statistics max value of a column is referenced by column_index*2+1
+ *
+ */
+class stats_expression_converter : public ast::detail::expression_transformer {
+ public:
+  stats_expression_converter(ast::expression const& expr,
+                             size_type const& num_columns,
+                             bool use_bloom_filters = false)
+    : _num_columns{num_columns}, _use_bloom_filters{use_bloom_filters}
+  {
+    expr.accept(*this);
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    CUDF_EXPECTS(expr.get_table_source() == ast::table_reference::LEFT,
+                 "Statistics AST supports only left table");
+    CUDF_EXPECTS(expr.get_column_index() < _num_columns,
+                 "Column index cannot be more than number of columns in the table");
+    _referenced_columns.insert(expr.get_column_index());
+    _stats_expr = std::reference_wrapper<ast::expression const>(expr);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    CUDF_FAIL("Column name reference is not supported in statistics AST");
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    if (is_string_operator(op)) { return visit_string_operation(expr); }
+
+    if (auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get())) {
+      // First operand should be column reference, second should be literal.
+      CUDF_EXPECTS(cudf::ast::detail::ast_operator_arity(op) == 2,
+                   "Only binary operations are supported on column reference");
+      CUDF_EXPECTS(dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr,
+                   "Second operand of binary operation with column reference must be a literal");
+      v->accept(*this);
+      auto const col_index = v->get_column_index();
+      switch (op) {
+        /* transform to stats conditions. op(col, literal)
+        col1 == val --> vmin <= val && vmax >= val
+        col1 != val --> !(vmin == val && vmax == val)
+        col1 >  val --> vmax > val
+        col1 <  val --> vmin < val
+        col1 >= val --> vmax >= val
+        col1 <= val --> vmin <= val
+        */
+        case ast_operator::EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          auto const& op1 =
+            _operators.emplace_back(ast_operator::LESS_EQUAL, vmin, operands[1].get());
+          auto const& op2 =
+            _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
+          auto const& minmax = _operators.emplace_back(ast::ast_operator::LOGICAL_AND, op1, op2);
+          if (_use_bloom_filters) {
+            // bloom filter membership of the literal is referenced by num_columns*2+term_index
+            auto const& bloom =
+              _col_ref.emplace_back(_num_columns * 2 + _equality_terms.size());
+            _equality_terms.emplace_back(
+              col_index, &dynamic_cast<ast::literal const&>(operands[1].get()));
+            _operators.emplace_back(ast::ast_operator::LOGICAL_AND, minmax, bloom);
+          }
+          break;
+        }
+        case ast_operator::NOT_EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          auto const& op1  = _operators.emplace_back(ast_operator::NOT_EQUAL, vmin, vmax);
+          auto const& op2 =
+            _operators.emplace_back(ast_operator::NOT_EQUAL, vmax, operands[1].get());
+          _operators.emplace_back(ast_operator::LOGICAL_OR, op1, op2);
+          break;
+        }
+        case ast_operator::LESS: [[fallthrough]];
+        case ast_operator::LESS_EQUAL: {
+          auto const& vmin = _col_ref.emplace_back(col_index * 2);
+          _operators.emplace_back(op, vmin, operands[1].get());
+          break;
+        }
+        case ast_operator::GREATER: [[fallthrough]];
+        case ast_operator::GREATER_EQUAL: {
+          auto const& vmax = _col_ref.emplace_back(col_index * 2 + 1);
+          _operators.emplace_back(op, vmax, operands[1].get());
+          break;
+        }
+        default: CUDF_FAIL("Unsupported operation in Statistics AST");
+      };
+    } else {
+      auto new_operands = visit_operands(operands);
+      if (cudf::ast::detail::ast_operator_arity(op) == 2) {
+        _operators.emplace_back(op, new_operands.front(), new_operands.back());
+      } else if (cudf::ast::detail::ast_operator_arity(op) == 1) {
+        _operators.emplace_back(op, new_operands.front());
+      }
+    }
+    _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
+    return std::reference_wrapper<ast::expression const>(_operators.back());
+  }
+
+  /**
+   * @brief Returns the AST to apply on Column chunk statistics.
+   *
+   * @return AST operation expression
+   */
+  [[nodiscard]] std::reference_wrapper<ast::expression const> get_stats_expr() const
+  {
+    return _stats_expr.value().get();
+  }
+
+  /**
+   * @brief Returns the indices of the columns referenced in the AST.
+   *
+   * @return Sorted column indices
+   */
+  [[nodiscard]] std::vector<size_type> get_referenced_columns() const
+  {
+    return {_referenced_columns.cbegin(), _referenced_columns.cend()};
+  }
+
+  /**
+   * @brief Returns the equality comparisons of the AST which are checked against Bloom filters.
+   *
+   * The result of the i-th term is referenced in the AST as column `num_columns*2+i`.
+   *
+   * @return Pairs of column index and literal
+   */
+  [[nodiscard]] std::vector<std::pair<size_type, ast::literal const*>> const& get_equality_terms()
+    const
+  {
+    return _equality_terms;
+  }
+
+ private:
+  static bool is_string_operator(ast::ast_operator op)
+  {
+    using cudf::ast::ast_operator;
+    return op == ast_operator::STARTS_WITH || op == ast_operator::CONTAINS ||
+           op == ast_operator::LIKE || op == ast_operator::LENGTH;
+  }
+
+  /**
+   * @brief Transforms a string operator to a stats condition
+   *
+   * STARTS_WITH(col, literal) becomes vmax >= literal since every string beginning with the
+   * literal compares greater than or equal to it. The other string operators cannot be
+   * evaluated on the min and max values so they become a null literal which never excludes
+   * a row group.
+   */
+  std::reference_wrapper<ast::expression const> visit_string_operation(ast::operation const& expr)
+  {
+    using cudf::ast::ast_operator;
+    auto const operands = expr.get_operands();
+    auto const op       = expr.get_operator();
+
+    auto* v = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+    if (op == ast_operator::STARTS_WITH && v != nullptr &&
+        dynamic_cast<ast::literal const*>(&operands[1].get()) != nullptr) {
+      v->accept(*this);
+      auto const& vmax = _col_ref.emplace_back(v->get_column_index() * 2 + 1);
+      _operators.emplace_back(ast_operator::GREATER_EQUAL, vmax, operands[1].get());
+      _stats_expr = std::reference_wrapper<ast::expression const>(_operators.back());
+      return std::reference_wrapper<ast::expression const>(_operators.back());
+    }
+
+    auto const& unknown = op == ast_operator::LENGTH ? _literals.emplace_back(_null_length)
+                                                     : _literals.emplace_back(_null_bool);
+    _stats_expr = std::reference_wrapper<ast::expression const>(unknown);
+    return std::reference_wrapper<ast::expression const>(unknown);
+  }
+
+  std::vector<std::reference_wrapper<ast::expression const>> visit_operands(
+    std::vector<std::reference_wrapper<ast::expression const>> operands)
+  {
+    std::vector<std::reference_wrapper<ast::expression const>> transformed_operands;
+    for (auto const& operand : operands) {
+      auto const new_operand = operand.get().accept(*this);
+      transformed_operands.push_back(new_operand);
+    }
+    return transformed_operands;
+  }
+  std::optional<std::reference_wrapper<ast::expression const>> _stats_expr;
+  size_type _num_columns;
+  bool _use_bloom_filters;
+  std::set<size_type> _referenced_columns;
+  std::vector<std::pair<size_type, ast::literal const*>> _equality_terms;
+  std::list<ast::column_reference> _col_ref;
+  std::list<ast::operation> _operators;
+  cudf::numeric_scalar<bool> _null_bool{false, false};
+  cudf::numeric_scalar<size_type> _null_length{0, false};
+  std::list<ast::literal> _literals;
+};
+
+}  // namespace cudf::io::detail
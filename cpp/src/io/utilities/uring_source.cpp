@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "uring_source.hpp"
+
+#include "config_utils.hpp"
+#include "file_io_utilities.hpp"
+
+#include <cudf/detail/utilities/host_worker_pool.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/logger.hpp>
+#include <cudf/io/memory_resource.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/aligned.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <future>
+#include <mutex>
+#include <numeric>
+#include <vector>
+
+namespace cudf::io::detail {
+
+namespace {
+
+// Alignment of the offsets, sizes and buffers of O_DIRECT reads
+constexpr std::size_t direct_io_alignment = 4096;
+// Size of each registered staging buffer, which is also the largest read submitted to the ring
+constexpr std::size_t slot_size = 1 << 20;
+
+std::string error_string(int error) { return std::string{std::strerror(error)}; }
+
+/**
+ * @brief A minimal io_uring instance that submits reads and reaps their completions
+ *
+ * Uses the raw system calls so that the library does not depend on liburing. Not thread safe.
+ */
+class uring {
+ public:
+  explicit uring(unsigned entries)
+  {
+    io_uring_params params{};
+    _fd = static_cast<int>(syscall(__NR_io_uring_setup, entries, &params));
+    CUDF_EXPECTS(_fd >= 0, "io_uring_setup failed: " + error_string(errno));
+    try {
+      map_rings(params);
+    } catch (...) {
+      release();
+      throw;
+    }
+  }
+
+  uring(uring const&)            = delete;
+  uring& operator=(uring const&) = delete;
+
+  ~uring() { release(); }
+
+  /**
+   * @brief Registers buffers for `IORING_OP_READ_FIXED`; returns false if the kernel refuses
+   */
+  bool register_buffers(std::vector<iovec> const& buffers)
+  {
+    return syscall(__NR_io_uring_register,
+                   _fd,
+                   IORING_REGISTER_BUFFERS,
+                   buffers.data(),
+                   static_cast<unsigned>(buffers.size())) == 0;
+  }
+
+  /**
+   * @brief Queues a read; it is submitted with the next call to `wait`
+   *
+   * @param buffer_index Index of the registered buffer that contains `dst`, or -1
+   */
+  void queue_read(
+    int file, uint8_t* dst, size_t size, size_t offset, int buffer_index, uint64_t user_data)
+  {
+    auto const tail  = *_sq_tail;  // only this thread advances the tail
+    auto const index = tail & *_sq_mask;
+    auto& sqe        = _sqes[index];
+    std::memset(&sqe, 0, sizeof(sqe));
+    sqe.opcode    = buffer_index >= 0 ? IORING_OP_READ_FIXED : IORING_OP_READ;
+    sqe.fd        = file;
+    sqe.addr      = reinterpret_cast<uint64_t>(dst);
+    sqe.len       = static_cast<uint32_t>(size);
+    sqe.off       = offset;
+    sqe.buf_index = static_cast<uint16_t>(std::max(buffer_index, 0));
+    sqe.user_data = user_data;
+    _sq_array[index] = index;
+    __atomic_store_n(_sq_tail, tail + 1, __ATOMIC_RELEASE);
+    ++_queued;
+  }
+
+  /**
+   * @brief Submits the queued reads, waits for at least one completion and passes every
+   * available completion to `on_complete(user_data, result)`
+   *
+   * `on_complete` may queue further reads but must not throw.
+   */
+  template <typename Callback>
+  void wait(Callback&& on_complete)
+  {
+    while (true) {
+      auto const submitted = syscall(
+        __NR_io_uring_enter, _fd, _queued, 1, IORING_ENTER_GETEVENTS, nullptr, size_t{0});
+      if (submitted >= 0) {
+        _queued -= static_cast<unsigned>(submitted);
+        break;
+      }
+      CUDF_EXPECTS(errno == EINTR, "io_uring_enter failed: " + error_string(errno));
+    }
+    auto head       = *_cq_head;
+    auto const tail = __atomic_load_n(_cq_tail, __ATOMIC_ACQUIRE);
+    for (; head != tail; ++head) {
+      auto const& cqe = _cqes[head & *_cq_mask];
+      on_complete(cqe.user_data, cqe.res);
+    }
+    __atomic_store_n(_cq_head, head, __ATOMIC_RELEASE);
+  }
+
+ private:
+  void* map(size_t size, off_t offset)
+  {
+    auto const ptr =
+      mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, _fd, offset);
+    CUDF_EXPECTS(ptr != MAP_FAILED, "Cannot map the io_uring queues: " + error_string(errno));
+    return ptr;
+  }
+
+  void map_rings(io_uring_params const& params)
+  {
+    _sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    _cq_size = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    auto const single_mmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (single_mmap) { _sq_size = _cq_size = std::max(_sq_size, _cq_size); }
+
+    _sq_ring = static_cast<uint8_t*>(map(_sq_size, IORING_OFF_SQ_RING));
+    _cq_ring = single_mmap ? _sq_ring : static_cast<uint8_t*>(map(_cq_size, IORING_OFF_CQ_RING));
+    _sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+    _sqes      = static_cast<io_uring_sqe*>(map(_sqes_size, IORING_OFF_SQES));
+
+    _sq_tail  = reinterpret_cast<unsigned*>(_sq_ring + params.sq_off.tail);
+    _sq_mask  = reinterpret_cast<unsigned*>(_sq_ring + params.sq_off.ring_mask);
+    _sq_array = reinterpret_cast<unsigned*>(_sq_ring + params.sq_off.array);
+    _cq_head  = reinterpret_cast<unsigned*>(_cq_ring + params.cq_off.head);
+    _cq_tail  = reinterpret_cast<unsigned*>(_cq_ring + params.cq_off.tail);
+    _cq_mask  = reinterpret_cast<unsigned*>(_cq_ring + params.cq_off.ring_mask);
+    _cqes     = reinterpret_cast<io_uring_cqe*>(_cq_ring + params.cq_off.cqes);
+  }
+
+  void release()
+  {
+    if (_sqes != nullptr) { munmap(_sqes, _sqes_size); }
+    if (_cq_ring != nullptr and _cq_ring != _sq_ring) { munmap(_cq_ring, _cq_size); }
+    if (_sq_ring != nullptr) { munmap(_sq_ring, _sq_size); }
+    if (_fd >= 0) { close(_fd); }
+  }
+
+  int _fd{-1};
+  size_t _sq_size{0};
+  size_t _cq_size{0};
+  size_t _sqes_size{0};
+  uint8_t* _sq_ring{nullptr};
+  uint8_t* _cq_ring{nullptr};
+  io_uring_sqe* _sqes{nullptr};
+  unsigned* _sq_tail{nullptr};
+  unsigned* _sq_mask{nullptr};
+  unsigned* _sq_array{nullptr};
+  unsigned* _cq_head{nullptr};
+  unsigned* _cq_tail{nullptr};
+  unsigned* _cq_mask{nullptr};
+  io_uring_cqe* _cqes{nullptr};
+  unsigned _queued{0};
+};
+
+/**
+ * @brief Implementation class for reading from a file through io_uring
+ *
+ * Each read is split into slot-sized pieces that are read into pinned staging buffers, with one
+ * piece in flight per buffer. Completed pieces are copied to the destination, on the stream for
+ * device reads, and the buffer is reused once that copy has finished. Reads are serialized on the
+ * ring; `device_read_async` runs them on the host worker pool so that callers can issue several
+ * reads without waiting.
+ */
+class uring_source final : public datasource {
+ public:
+  explicit uring_source(std::string const& filepath)
+    : _num_slots{io_uring_integration::queue_depth()}, _ring{static_cast<unsigned>(_num_slots)}
+  {
+    force_init_cuda_context();
+    try {
+      _file = std::make_unique<file_wrapper>(filepath, O_RDONLY | O_DIRECT);
+    } catch (cudf::logic_error const&) {
+      // Some file systems, e.g. tmpfs, do not support direct IO
+      _file   = std::make_unique<file_wrapper>(filepath, O_RDONLY);
+      _direct = false;
+    }
+
+    _staging_size = _num_slots * slot_size + direct_io_alignment;
+    _staging      = static_cast<uint8_t*>(
+      get_host_memory_resource().allocate(_staging_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT));
+    _slots = reinterpret_cast<uint8_t*>(
+      rmm::align_up(reinterpret_cast<std::size_t>(_staging), direct_io_alignment));
+
+    std::vector<iovec> buffers(_num_slots);
+    _events.resize(_num_slots);
+    for (size_t slot = 0; slot < _num_slots; ++slot) {
+      buffers[slot] = {slot_data(slot), slot_size};
+      CUDF_CUDA_TRY(cudaEventCreateWithFlags(&_events[slot], cudaEventDisableTiming));
+    }
+    _registered = _ring.register_buffers(buffers);
+    CUDF_LOG_INFO("Reading {} through io_uring with {} slots, direct IO {}, registered buffers {}",
+                  filepath,
+                  _num_slots,
+                  _direct ? "on" : "off",
+                  _registered ? "on" : "off");
+  }
+
+  ~uring_source() override
+  {
+    for (auto event : _events) {
+      if (event != nullptr) {
+        cudaEventSynchronize(event);
+        cudaEventDestroy(event);
+      }
+    }
+    get_host_memory_resource().deallocate(
+      _staging, _staging_size, rmm::RMM_DEFAULT_HOST_ALIGNMENT);
+  }
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    std::vector<uint8_t> v(std::min(size, _file->size() - std::min(offset, _file->size())));
+    v.resize(read(offset, size, v.data(), false, cudf::get_default_stream()));
+    return buffer::create(std::move(v));
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    return read(offset, size, dst, false, cudf::get_default_stream());
+  }
+
+  [[nodiscard]] bool supports_device_read() const override { return true; }
+
+  // Pieces are staged in pinned memory, so device reads are never slower than host reads
+  [[nodiscard]] bool is_device_read_preferred(size_t) const override { return true; }
+
+  std::future<size_t> device_read_async(size_t offset,
+                                        size_t size,
+                                        uint8_t* dst,
+                                        rmm::cuda_stream_view stream) override
+  {
+    return cudf::detail::host_worker_pool().submit(
+      [this, offset, size, dst, stream] { return read(offset, size, dst, true, stream); });
+  }
+
+  size_t device_read(size_t offset,
+                     size_t size,
+                     uint8_t* dst,
+                     rmm::cuda_stream_view stream) override
+  {
+    return read(offset, size, dst, true, stream);
+  }
+
+  std::unique_ptr<buffer> device_read(size_t offset,
+                                      size_t size,
+                                      rmm::cuda_stream_view stream) override
+  {
+    rmm::device_buffer out_data(size, stream);
+    size_t read = device_read(offset, size, reinterpret_cast<uint8_t*>(out_data.data()), stream);
+    out_data.resize(read, stream);
+    return datasource::buffer::create(std::move(out_data));
+  }
+
+  [[nodiscard]] size_t size() const override { return _file->size(); }
+
+ private:
+  /**
+   * @brief A piece of a read that occupies one staging buffer
+   */
+  struct piece {
+    size_t file_offset;  ///< Offset of the piece in the file
+    size_t length;       ///< Bytes requested from the file
+    size_t filled;       ///< Bytes read so far
+  };
+
+  [[nodiscard]] uint8_t* slot_data(size_t slot) const { return _slots + slot * slot_size; }
+
+  void queue_piece(size_t slot, piece const& p)
+  {
+    _ring.queue_read(_file->desc(),
+                     slot_data(slot) + p.filled,
+                     p.length - p.filled,
+                     p.file_offset + p.filled,
+                     _registered ? static_cast<int>(slot) : -1,
+                     slot);
+  }
+
+  /**
+   * @brief Reads `[offset, offset + size)`, clamped to the file size, into host or device memory
+   *
+   * @return The number of bytes read
+   */
+  size_t read(
+    size_t offset, size_t size, uint8_t* dst, bool to_device, rmm::cuda_stream_view stream)
+  {
+    auto const end = std::min(offset + size, _file->size());
+    if (offset >= end) { return 0; }
+    auto const alignment   = _direct ? direct_io_alignment : 1;
+    auto const aligned_end = std::min(cudf::util::round_up_safe(end, alignment),
+                                      cudf::util::round_up_safe(_file->size(), alignment));
+    auto next              = offset / alignment * alignment;
+
+    std::lock_guard lock{_mutex};
+    std::vector<piece> pieces(_num_slots);
+    std::vector<size_t> free_slots(_num_slots);
+    std::iota(free_slots.rbegin(), free_slots.rend(), 0);
+    size_t in_flight = 0;
+    std::string error;
+
+    auto on_complete = [&](uint64_t slot, int result) {
+      --in_flight;
+      auto& p = pieces[slot];
+      if (result == -EINTR or result == -EAGAIN) {
+        queue_piece(slot, p);
+        ++in_flight;
+        return;
+      }
+      if (result < 0 or (result == 0 and p.file_offset + p.filled < _file->size())) {
+        if (error.empty()) {
+          error = result < 0 ? error_string(-result) : "unexpected end of file";
+        }
+        free_slots.push_back(slot);
+        return;
+      }
+      p.filled += result;
+      if (p.filled < p.length and p.file_offset + p.filled < _file->size()) {
+        // short read, request the rest of the piece
+        queue_piece(slot, p);
+        ++in_flight;
+        return;
+      }
+      auto const begin = std::max(p.file_offset, offset);
+      auto const count = std::min(p.file_offset + p.filled, end) - begin;
+      auto const src   = slot_data(slot) + (begin - p.file_offset);
+      if (to_device) {
+        auto const status =
+          cudaMemcpyAsync(dst + (begin - offset), src, count, cudaMemcpyDefault, stream.value());
+        if (status == cudaSuccess) { cudaEventRecord(_events[slot], stream.value()); }
+        if (status != cudaSuccess and error.empty()) { error = cudaGetErrorString(status); }
+      } else {
+        std::memcpy(dst + (begin - offset), src, count);
+      }
+      free_slots.push_back(slot);
+    };
+
+    while (in_flight > 0 or (next < aligned_end and error.empty())) {
+      while (next < aligned_end and error.empty() and not free_slots.empty()) {
+        auto const slot = free_slots.back();
+        free_slots.pop_back();
+        // the previous device copy out of this buffer must finish before it is overwritten
+        CUDF_CUDA_TRY(cudaEventSynchronize(_events[slot]));
+        pieces[slot] = {next, std::min(slot_size, aligned_end - next), 0};
+        next += pieces[slot].length;
+        queue_piece(slot, pieces[slot]);
+        ++in_flight;
+      }
+      _ring.wait(on_complete);
+    }
+    CUDF_EXPECTS(error.empty(), "io_uring read failed: " + error);
+    return end - offset;
+  }
+
+  std::unique_ptr<file_wrapper> _file;
+  bool _direct{true};
+  bool _registered{false};
+  size_t _num_slots;
+  uring _ring;
+  std::mutex _mutex;
+  uint8_t* _staging{nullptr};
+  size_t _staging_size{0};
+  uint8_t* _slots{nullptr};
+  std::vector<cudaEvent_t> _events;
+};
+
+}  // namespace
+
+std::unique_ptr<datasource> make_uring_source(std::string const& filepath)
+{
+  try {
+    return std::make_unique<uring_source>(filepath);
+  } catch (cudf::logic_error const& e) {
+    CUDF_LOG_WARN("Cannot read {} through io_uring: {}", filepath, e.what());
+    return nullptr;
+  }
+}
+
+}  // namespace cudf::io::detail
@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/io/datasource.hpp>
+
+#include <memory>
+#include <string>
+
+namespace cudf::io::detail {
+
+/**
+ * @brief Create a datasource that reads a file through io_uring
+ *
+ * The file is opened with `O_DIRECT` when the file system allows it. Reads are split into
+ * pieces that land in pinned staging buffers registered with the ring, and up to
+ * `io_uring_integration::queue_depth()` pieces are kept in flight. Device reads copy each piece
+ * to the device as soon as it completes, so the transfers overlap the remaining file reads.
+ *
+ * @param filepath Path to the file
+ * @return The datasource, or `nullptr` if io_uring is not available on this system
+ */
+std::unique_ptr<datasource> make_uring_source(std::string const& filepath);
+
+}  // namespace cudf::io::detail
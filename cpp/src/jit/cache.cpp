@@ -14,14 +14,34 @@
  * limitations under the License.
  */
 
+#include "jit/cache.hpp"
+
+#include <cudf/detail/binaryop.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/jit_cache.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <cuda.h>
 
 #include <jitify2.hpp>
 
+#include <algorithm>
+#include <cctype>
+#include <atomic>
+#include <chrono>
 #include <cstddef>
+#include <exception>
 #include <filesystem>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <shared_mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
 
 namespace cudf {
 namespace jit {
@@ -46,6 +66,19 @@ std::filesystem::path get_user_home_cache_dir()
 #define LIBCUDF_KERNEL_CACHE_PATH get_user_home_cache_dir()
 #endif
 
+/**
+ * @brief Get the path under which each libcudf version stores its kernel cache directory.
+ *
+ * The environment variable always overrides the default/compile-time value of
+ * `LIBCUDF_KERNEL_CACHE_PATH`.
+ */
+std::filesystem::path get_cache_base_dir()
+{
+  auto kernel_cache_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_PATH");
+  return std::filesystem::path(kernel_cache_path_env != nullptr ? kernel_cache_path_env
+                                                                : LIBCUDF_KERNEL_CACHE_PATH);
+}
+
 /**
  * @brief Get the string path to the JITIFY kernel cache directory.
  *
@@ -62,11 +95,7 @@ std::filesystem::path get_user_home_cache_dir()
  */
 std::filesystem::path get_cache_dir()
 {
-  // The environment variable always overrides the
-  // default/compile-time value of `LIBCUDF_KERNEL_CACHE_PATH`
-  auto kernel_cache_path_env = std::getenv("LIBCUDF_KERNEL_CACHE_PATH");
-  auto kernel_cache_path     = std::filesystem::path(
-    kernel_cache_path_env != nullptr ? kernel_cache_path_env : LIBCUDF_KERNEL_CACHE_PATH);
+  auto kernel_cache_path = get_cache_base_dir();
 
   // Cache path could be empty when env HOME is unset or LIBCUDF_KERNEL_CACHE_PATH is defined to be
   // empty, to disallow use of file cache at runtime.
@@ -111,24 +140,41 @@ std::size_t try_parse_numeric_env_var(char const* const env_name, std::size_t de
   return value != nullptr ? std::stoull(value) : default_val;
 }
 
+std::size_t get_kernel_limit_disk()
+{
+  return try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+}
+
+// Returns the disk cache directory or an empty string if disk caching is disabled
+std::string get_disk_cache_dir(std::size_t kernel_limit_disk)
+{
+  // if kernel_limit_disk is zero, jitify will assign it the value of kernel_limit_proc.
+  // to avoid this, we treat zero as "disable disk caching" by not providing the cache dir.
+  return kernel_limit_disk == 0 ? std::string{} : get_program_cache_dir();
+}
+
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog)
 {
-  static std::mutex caches_mutex{};
+  static std::shared_mutex caches_mutex{};
   static std::unordered_map<std::string, std::unique_ptr<jitify2::ProgramCache<>>> caches{};
 
-  std::lock_guard<std::mutex> caches_lock(caches_mutex);
+  // the caches are never removed, so the common case of an existing cache only needs a shared lock
+  {
+    std::shared_lock<std::shared_mutex> caches_lock(caches_mutex);
+    auto const existing_cache = caches.find(preprog.name());
+    if (existing_cache != caches.end()) { return *(existing_cache->second); }
+  }
+
+  std::unique_lock<std::shared_mutex> caches_lock(caches_mutex);
 
   auto existing_cache = caches.find(preprog.name());
 
   if (existing_cache == caches.end()) {
     auto const kernel_limit_proc =
       try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_PER_PROCESS", 10'000);
-    auto const kernel_limit_disk =
-      try_parse_numeric_env_var("LIBCUDF_KERNEL_CACHE_LIMIT_DISK", 100'000);
+    auto const kernel_limit_disk = get_kernel_limit_disk();
 
-    // if kernel_limit_disk is zero, jitify will assign it the value of kernel_limit_proc.
-    // to avoid this, we treat zero as "disable disk caching" by not providing the cache dir.
-    auto const cache_dir = kernel_limit_disk == 0 ? std::string{} : get_program_cache_dir();
+    auto const cache_dir = get_disk_cache_dir(kernel_limit_disk);
 
     auto const res =
       caches.insert({preprog.name(),
@@ -140,5 +186,177 @@ jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData prep
   return *(existing_cache->second);
 }
 
+namespace {
+
+/**
+ * @brief Kernels requested by this process
+ *
+ * A kernel is identified by the hash of its program, name and header source.
+ */
+struct kernel_statistics {
+  std::mutex mutex;
+  std::unordered_set<std::size_t> loaded;
+  std::size_t requests{0};
+  double load_seconds{0};
+};
+
+kernel_statistics& get_kernel_statistics()
+{
+  static kernel_statistics stats{};
+  return stats;
+}
+
+void precompile(jit_kernel_spec const& spec)
+{
+  switch (spec.kind) {
+    case jit_kernel_kind::TRANSFORM:
+      CUDF_EXPECTS(spec.input_types.size() == 1, "TRANSFORM kernels require one input type");
+      cudf::detail::precompile_transform(
+        spec.input_types.front(), spec.udf, spec.output_type, spec.is_ptx);
+      break;
+    case jit_kernel_kind::BINARY_OPERATION:
+      CUDF_EXPECTS(spec.input_types.size() == 2,
+                   "BINARY_OPERATION kernels require lhs and rhs input types");
+      CUDF_EXPECTS(spec.is_ptx, "BINARY_OPERATION kernels require a PTX function");
+      cudf::detail::precompile_binary_operation(
+        spec.input_types.front(), spec.input_types.back(), spec.udf, spec.output_type);
+      break;
+    default: CUDF_FAIL("Unsupported JIT kernel kind");
+  }
+}
+
+}  // namespace
+
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           std::string const& header_name,
+                           std::string const& header_source)
+{
+  auto& stats = get_kernel_statistics();
+  auto const key = std::hash<std::string>{}(preprog.name() + kernel_name + header_source);
+  auto const first_request = [&] {
+    std::lock_guard<std::mutex> stats_lock(stats.mutex);
+    ++stats.requests;
+    return stats.loaded.insert(key).second;
+  }();
+
+  auto const start = std::chrono::steady_clock::now();
+  auto kernel      = get_program_cache(preprog).get_kernel(
+    kernel_name, {}, {{header_name, header_source}}, {"-arch=sm_."});
+  if (first_request) {
+    std::chrono::duration<double> const elapsed = std::chrono::steady_clock::now() - start;
+    std::lock_guard<std::mutex> stats_lock(stats.mutex);
+    stats.load_seconds += elapsed.count();
+  }
+  return kernel;
+}
+
 }  // namespace jit
+
+std::future<void> precompile_jit_kernels(std::vector<jit_kernel_spec> specs,
+                                         std::size_t num_threads)
+{
+  CUDF_FUNC_RANGE();
+  int device;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  auto const threads_used = std::max(std::min(num_threads, specs.size()), std::size_t{1});
+
+  return std::async(std::launch::async, [specs = std::move(specs), threads_used, device] {
+    std::atomic<std::size_t> next_spec{0};
+    std::mutex error_mutex;
+    std::exception_ptr error;
+
+    // each thread compiles the next spec until all are taken; the first error is rethrown
+    auto compile_specs = [&] {
+      try {
+        CUDF_CUDA_TRY(cudaSetDevice(device));
+        for (auto idx = next_spec++; idx < specs.size(); idx = next_spec++) {
+          jit::precompile(specs[idx]);
+        }
+      } catch (...) {
+        std::lock_guard<std::mutex> error_lock(error_mutex);
+        if (!error) { error = std::current_exception(); }
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < threads_used; ++i) {
+      threads.emplace_back(compile_specs);
+    }
+    for (auto& thread : threads) {
+      thread.join();
+    }
+    if (error) { std::rethrow_exception(error); }
+  });
+}
+
+jit_cache_statistics get_jit_cache_statistics()
+{
+  auto result = jit_cache_statistics{};
+  {
+    auto& stats = jit::get_kernel_statistics();
+    std::lock_guard<std::mutex> stats_lock(stats.mutex);
+    result.kernel_requests = stats.requests;
+    result.kernels_loaded  = stats.loaded.size();
+    result.load_seconds    = stats.load_seconds;
+  }
+
+  result.cache_dir = jit::get_disk_cache_dir(jit::get_kernel_limit_disk());
+  if (result.cache_dir.empty()) { return result; }
+
+  // files may be added or removed by other processes while iterating so errors are skipped
+  std::error_code ec;
+  auto itr = std::filesystem::recursive_directory_iterator(result.cache_dir, ec);
+  for (; !ec && itr != std::filesystem::recursive_directory_iterator{}; itr.increment(ec)) {
+    std::error_code entry_ec;
+    if (!itr->is_regular_file(entry_ec)) { continue; }
+    auto const size = itr->file_size(entry_ec);
+    if (entry_ec) { continue; }
+    ++result.disk_files;
+    result.disk_bytes += size;
+  }
+  return result;
+}
+
+std::size_t evict_stale_jit_cache_versions()
+{
+  CUDF_FUNC_RANGE();
+#if defined(JITIFY_USE_CACHE)
+  auto const base_dir = jit::get_cache_base_dir();
+  if (base_dir.empty()) { return 0; }
+  auto const current_version = std::string{CUDF_STRINGIFY(CUDF_VERSION)};
+
+  // only directories named like a version are removed since the base directory can be
+  // any path given by LIBCUDF_KERNEL_CACHE_PATH
+  auto const is_version = [](std::string const& name) {
+    return !name.empty() && std::isdigit(static_cast<unsigned char>(name.front())) &&
+           std::count(name.begin(), name.end(), '.') == 2 &&
+           std::all_of(name.begin(), name.end(), [](char c) {
+             return c == '.' || std::isdigit(static_cast<unsigned char>(c));
+           });
+  };
+
+  std::vector<std::filesystem::path> stale_dirs;
+  std::error_code ec;
+  auto itr = std::filesystem::directory_iterator(base_dir, ec);
+  for (; !ec && itr != std::filesystem::directory_iterator{}; itr.increment(ec)) {
+    std::error_code entry_ec;
+    auto const name = itr->path().filename().string();
+    if (itr->is_directory(entry_ec) && name != current_version && is_version(name)) {
+      stale_dirs.push_back(itr->path());
+    }
+  }
+
+  std::size_t removed = 0;
+  for (auto const& dir : stale_dirs) {
+    std::error_code remove_ec;
+    std::filesystem::remove_all(dir, remove_ec);
+    if (!remove_ec) { ++removed; }
+  }
+  return removed;
+#else
+  return 0;
+#endif
+}
+
 }  // namespace cudf
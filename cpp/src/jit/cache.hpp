@@ -18,12 +18,41 @@
 
 #include <jitify2.hpp>
 
+#include <filesystem>
 #include <memory>
+#include <string>
 
 namespace cudf {
 namespace jit {
 
 jitify2::ProgramCache<>& get_program_cache(jitify2::PreprocessedProgramData preprog);
 
+/**
+ * @brief Returns the kernel cache directory of the current device, creating it if needed
+ *
+ * The directory is specific to the libcudf version and to the compute capability of the device.
+ * An empty path is returned when file caching is disabled.
+ *
+ * @return The cache directory
+ */
+std::filesystem::path get_cache_dir();
+
+/**
+ * @brief Returns a kernel of a preprocessed program compiled with the given header source
+ *
+ * The kernel is compiled, or loaded from the disk cache, the first time the process requests
+ * it. The requests are recorded in the statistics returned by `cudf::get_jit_cache_statistics`.
+ *
+ * @param preprog Preprocessed program containing the kernel
+ * @param kernel_name Name of the kernel template instantiation
+ * @param header_name Name of the header of the program overridden by `header_source`
+ * @param header_source Source of the overridden header
+ * @return The loaded kernel
+ */
+jitify2::Kernel get_kernel(jitify2::PreprocessedProgramData preprog,
+                           std::string const& kernel_name,
+                           std::string const& header_name,
+                           std::string const& header_source);
+
 }  // namespace jit
 }  // namespace cudf
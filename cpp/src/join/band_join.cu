@@ -0,0 +1,300 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join/band_join.hpp"
+#include "join/join_common_utils.cuh"
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/reduce.h>
+
+#include <memory>
+#include <optional>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief A comparison `left.column op right.column` of a left and a right column reference.
+ */
+struct column_comparison {
+  size_type left_column;
+  ast::ast_operator op;
+  size_type right_column;
+};
+
+/**
+ * @brief Returns the operator of the comparison with swapped operands.
+ */
+ast::ast_operator swap_operands(ast::ast_operator op)
+{
+  switch (op) {
+    case ast::ast_operator::LESS: return ast::ast_operator::GREATER;
+    case ast::ast_operator::LESS_EQUAL: return ast::ast_operator::GREATER_EQUAL;
+    case ast::ast_operator::GREATER: return ast::ast_operator::LESS;
+    case ast::ast_operator::GREATER_EQUAL: return ast::ast_operator::LESS_EQUAL;
+    default: return op;
+  }
+}
+
+/**
+ * @brief Returns the comparison expressed by `expr`, if it is an ordering comparison of a left
+ * and a right column reference.
+ */
+std::optional<column_comparison> find_column_comparison(ast::expression const& expr)
+{
+  auto const op = dynamic_cast<ast::operation const*>(&expr);
+  if (op == nullptr or op->get_operands().size() != 2) { return std::nullopt; }
+  switch (op->get_operator()) {
+    case ast::ast_operator::LESS:
+    case ast::ast_operator::LESS_EQUAL:
+    case ast::ast_operator::GREATER:
+    case ast::ast_operator::GREATER_EQUAL: break;
+    default: return std::nullopt;
+  }
+  auto const operands = op->get_operands();
+  auto const lhs      = dynamic_cast<ast::column_reference const*>(&operands[0].get());
+  auto const rhs      = dynamic_cast<ast::column_reference const*>(&operands[1].get());
+  if (lhs == nullptr or rhs == nullptr or lhs->get_table_source() == rhs->get_table_source()) {
+    return std::nullopt;
+  }
+  if (lhs->get_table_source() == ast::table_reference::LEFT) {
+    return column_comparison{lhs->get_column_index(), op->get_operator(), rhs->get_column_index()};
+  }
+  return column_comparison{
+    rhs->get_column_index(), swap_operands(op->get_operator()), lhs->get_column_index()};
+}
+
+/**
+ * @brief Adds the bound of `comparison` to the band predicate whose key side is already set.
+ *
+ * @return false if the band predicate already has a bound in the same direction
+ */
+bool add_bound(band_predicate& band, column_comparison const& comparison)
+{
+  auto const key_is_left  = band.key_side == ast::table_reference::LEFT;
+  auto const op           = key_is_left ? comparison.op : swap_operands(comparison.op);
+  auto const bound_column = key_is_left ? comparison.right_column : comparison.left_column;
+  auto const inclusive =
+    op == ast::ast_operator::LESS_EQUAL or op == ast::ast_operator::GREATER_EQUAL;
+  auto& bound = (op == ast::ast_operator::GREATER or op == ast::ast_operator::GREATER_EQUAL)
+                  ? band.lower
+                  : band.upper;
+  if (bound.has_value()) { return false; }
+  bound = band_bound{bound_column, inclusive};
+  return true;
+}
+
+/**
+ * @brief Returns true if the band join supports columns of the given type.
+ *
+ * Floating point keys are not supported since NaNs are sorted after all values but compare false
+ * with all of them.
+ */
+bool is_supported_band_type(data_type type)
+{
+  return is_integral_not_bool(type) or is_timestamp(type) or is_duration(type);
+}
+
+/**
+ * @brief The range of sorted keys matching each row of the bound table.
+ */
+struct band_ranges {
+  std::unique_ptr<column> order;          ///< sorted order of the key column
+  rmm::device_uvector<size_type> begins;  ///< first sorted key matching each bound row
+  rmm::device_uvector<size_type> counts;  ///< number of keys matching each bound row
+};
+
+band_ranges compute_band_ranges(table_view const& left,
+                                table_view const& right,
+                                band_predicate const& band,
+                                rmm::cuda_stream_view stream)
+{
+  auto const temp_mr     = rmm::mr::get_current_device_resource();
+  auto const key_is_left = band.key_side == ast::table_reference::LEFT;
+  auto const& keys_table = key_is_left ? left : right;
+  auto const& bounds     = key_is_left ? right : left;
+  auto const keys        = keys_table.select({band.key_column});
+
+  // Null keys never match and are sorted after all other keys
+  auto const column_order    = std::vector<order>{order::ASCENDING};
+  auto const null_precedence = std::vector<null_order>{null_order::AFTER};
+  auto key_order =
+    cudf::detail::sorted_order(keys, column_order, null_precedence, stream, temp_mr);
+  auto const sorted_keys = cudf::detail::gather(keys,
+                                                key_order->view(),
+                                                out_of_bounds_policy::DONT_CHECK,
+                                                negative_index_policy::NOT_ALLOWED,
+                                                stream,
+                                                temp_mr);
+  auto const num_valid_keys = keys.num_rows() - keys.column(0).null_count();
+
+  // The first key greater than (or equal to) a bound is its upper (lower) bound in the sorted
+  // keys, and the first key not less than (or equal to) a bound is its lower (upper) bound
+  auto const search = [&](std::optional<band_bound> const& bound, bool is_lower) {
+    if (not bound.has_value()) { return std::unique_ptr<column>{}; }
+    auto const needles = bounds.select({bound->column});
+    return is_lower == bound->inclusive
+             ? cudf::detail::lower_bound(
+                 sorted_keys->view(), needles, column_order, null_precedence, stream, temp_mr)
+             : cudf::detail::upper_bound(
+                 sorted_keys->view(), needles, column_order, null_precedence, stream, temp_mr);
+  };
+  auto const lower = search(band.lower, true);
+  auto const upper = search(band.upper, false);
+
+  // Null bounds never match
+  std::vector<size_type> bound_columns;
+  if (band.lower.has_value()) { bound_columns.push_back(band.lower->column); }
+  if (band.upper.has_value()) { bound_columns.push_back(band.upper->column); }
+  auto const bound_table = bounds.select(bound_columns);
+  auto const row_bitmask = cudf::has_nulls(bound_table)
+                             ? cudf::detail::bitmask_and(bound_table, stream, temp_mr).first
+                             : rmm::device_buffer{0, stream};
+
+  rmm::device_uvector<size_type> begins(bounds.num_rows(), stream);
+  rmm::device_uvector<size_type> counts(bounds.num_rows(), stream);
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    bounds.num_rows(),
+    [lower       = lower ? lower->view().begin<size_type>() : nullptr,
+     upper       = upper ? upper->view().begin<size_type>() : nullptr,
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data()),
+     num_valid_keys,
+     begins = begins.data(),
+     counts = counts.data()] __device__(size_type row) {
+      auto const begin = lower != nullptr ? lower[row] : size_type{0};
+      auto const end   = upper != nullptr ? upper[row] : num_valid_keys;
+      auto const valid = row_bitmask == nullptr or bit_is_set(row_bitmask, row);
+      begins[row]      = begin;
+      counts[row]      = valid and end > begin ? end - begin : size_type{0};
+    });
+  return band_ranges{std::move(key_order), std::move(begins), std::move(counts)};
+}
+
+}  // namespace
+
+std::optional<band_predicate> find_band_predicate(ast::expression const& binary_predicate,
+                                                  table_view const& left,
+                                                  table_view const& right)
+{
+  std::vector<column_comparison> comparisons;
+  if (auto const comparison = find_column_comparison(binary_predicate); comparison.has_value()) {
+    comparisons.push_back(*comparison);
+  } else if (auto const op = dynamic_cast<ast::operation const*>(&binary_predicate);
+             op != nullptr and op->get_operator() == ast::ast_operator::LOGICAL_AND) {
+    for (auto const& operand : op->get_operands()) {
+      auto const operand_comparison = find_column_comparison(operand.get());
+      if (not operand_comparison.has_value()) { return std::nullopt; }
+      comparisons.push_back(*operand_comparison);
+    }
+  } else {
+    return std::nullopt;
+  }
+
+  // The key is the column shared by both comparisons
+  auto band = band_predicate{ast::table_reference::LEFT, comparisons.front().left_column, {}, {}};
+  if (comparisons.size() == 2 and comparisons[0].left_column != comparisons[1].left_column) {
+    if (comparisons[0].right_column != comparisons[1].right_column) { return std::nullopt; }
+    band = band_predicate{ast::table_reference::RIGHT, comparisons.front().right_column, {}, {}};
+  }
+  for (auto const& comparison : comparisons) {
+    if (comparison.left_column < 0 or comparison.left_column >= left.num_columns() or
+        comparison.right_column < 0 or comparison.right_column >= right.num_columns()) {
+      return std::nullopt;
+    }
+    auto const type = left.column(comparison.left_column).type();
+    if (type != right.column(comparison.right_column).type() or not is_supported_band_type(type)) {
+      return std::nullopt;
+    }
+    if (not add_bound(band, comparison)) { return std::nullopt; }
+  }
+  return band;
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+band_inner_join(table_view const& left,
+                table_view const& right,
+                band_predicate const& band,
+                rmm::cuda_stream_view stream,
+                rmm::device_async_resource_ref mr)
+{
+  auto const ranges = compute_band_ranges(left, right, band, stream);
+
+  // The range of keys of each bound row is split evenly over the threads, so that wide bands do
+  // not leave the other threads idle
+  auto [bound_indices, offsets] = assign_pairs_to_runs(ranges.counts, stream, mr);
+  auto key_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(bound_indices->size(), stream, mr);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<size_type>(0),
+                     static_cast<size_type>(bound_indices->size()),
+                     [offsets       = offsets.data(),
+                      begins        = ranges.begins.data(),
+                      order         = ranges.order->view().begin<size_type>(),
+                      bound_indices = bound_indices->data(),
+                      key_indices   = key_indices->data()] __device__(size_type idx) {
+                       auto const row = bound_indices[idx];
+                       key_indices[idx] =
+                         order[begins[row] + static_cast<size_type>(idx - offsets[row])];
+                     });
+
+  if (band.key_side == ast::table_reference::LEFT) {
+    return std::pair(std::move(key_indices), std::move(bound_indices));
+  }
+  return std::pair(std::move(bound_indices), std::move(key_indices));
+}
+
+std::size_t band_inner_join_size(table_view const& left,
+                                 table_view const& right,
+                                 band_predicate const& band,
+                                 rmm::cuda_stream_view stream)
+{
+  auto const ranges = compute_band_ranges(left, right, band, stream);
+  auto const sizes  = thrust::make_transform_iterator(
+    ranges.counts.begin(), cuda::proclaim_return_type<std::size_t>([] __device__(size_type count) {
+      return static_cast<std::size_t>(count);
+    }));
+  return thrust::reduce(
+    rmm::exec_policy(stream), sizes, sizes + ranges.counts.size(), std::size_t{0});
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/ast/expressions.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief A bound of a band predicate, i.e. a column of the bound table compared with the key.
+ */
+struct band_bound {
+  size_type column;  ///< index of the bound column in the bound table
+  bool inclusive;    ///< true if keys equal to the bound match
+};
+
+/**
+ * @brief A band or range predicate between a key column of one table and bound columns of the
+ * other table, e.g. `left.ts >= right.start and left.ts <= right.end`.
+ *
+ * The keys matching a row of the bound table are a contiguous range of the sorted keys.
+ */
+struct band_predicate {
+  ast::table_reference key_side;    ///< table of the key column
+  size_type key_column;             ///< index of the key column in its table
+  std::optional<band_bound> lower;  ///< bound the keys must be greater than
+  std::optional<band_bound> upper;  ///< bound the keys must be less than
+};
+
+/**
+ * @brief Returns the band predicate expressed by `binary_predicate`, if any.
+ *
+ * Band predicates are a comparison of a left and a right column reference, or the logical and of
+ * a lower and an upper bound comparison of the same key column. The columns must be of the same
+ * integral, timestamp or duration type.
+ *
+ * @param binary_predicate The condition on which to join
+ * @param left The left table
+ * @param right The right table
+ * @return The band predicate, or an empty optional for general predicates
+ */
+std::optional<band_predicate> find_band_predicate(ast::expression const& binary_predicate,
+                                                  table_view const& left,
+                                                  table_view const& right);
+
+/**
+ * @brief Computes the inner join of two tables on a band predicate by sorting the key column and
+ * searching the range of matching keys of each bound row.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param band The band predicate returned by `find_band_predicate`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ * @return The [left, right] row index vectors of the join
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+band_inner_join(table_view const& left,
+                table_view const& right,
+                band_predicate const& band,
+                rmm::cuda_stream_view stream,
+                rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Computes the size of the inner join of two tables on a band predicate.
+ *
+ * @param left The left table
+ * @param right The right table
+ * @param band The band predicate returned by `find_band_predicate`
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The number of rows of the join
+ */
+std::size_t band_inner_join_size(table_view const& left,
+                                 table_view const& right,
+                                 band_predicate const& band,
+                                 rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
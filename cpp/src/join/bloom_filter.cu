@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/atomic>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <cmath>
+
+namespace cudf {
+namespace {
+
+constexpr int32_t max_num_hashes = 16;
+constexpr size_type word_bits    = 32;
+
+/**
+ * @brief Returns the filter bit of the `i`-th hash of a key with the given 64-bit hash.
+ *
+ * The hashes of a key are derived from the two halves of its 64-bit hash by double hashing.
+ */
+__device__ uint64_t filter_bit(uint64_t hash, int32_t i, uint64_t num_bits)
+{
+  auto const h1 = static_cast<uint32_t>(hash);
+  auto const h2 = static_cast<uint32_t>(hash >> 32) | 1u;
+  return (h1 + static_cast<uint64_t>(i) * h2) % num_bits;
+}
+
+/**
+ * @brief Returns the null mask of the rows with any null key when nulls are unequal, or nullptr.
+ */
+rmm::device_buffer key_row_bitmask(table_view const& keys,
+                                   null_equality compare_nulls,
+                                   rmm::cuda_stream_view stream)
+{
+  if (compare_nulls == null_equality::EQUAL or not has_nulls(keys)) { return {}; }
+  return cudf::detail::bitmask_and(keys, stream, rmm::mr::get_current_device_resource()).first;
+}
+
+}  // namespace
+
+bloom_filter::bloom_filter(table_view const& keys,
+                           null_equality compare_nulls,
+                           size_type bits_per_key,
+                           rmm::cuda_stream_view stream)
+  : _num_columns{keys.num_columns()},
+    _nulls_equal{compare_nulls},
+    // The false positive rate is lowest with ln(2) hashes per filter bit per key
+    _num_hashes{std::clamp(static_cast<int32_t>(std::round(bits_per_key * std::log(2.0))),
+                           int32_t{1},
+                           max_num_hashes)},
+    _bits{0, stream}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(0 != keys.num_columns(), "Bloom filter key table is empty");
+  CUDF_EXPECTS(bits_per_key > 0, "Number of bits per key must be positive", std::invalid_argument);
+
+  auto const num_bits = std::max(int64_t{word_bits}, int64_t{keys.num_rows()} * bits_per_key);
+  _bits.resize(util::div_rounding_up_safe(num_bits, int64_t{word_bits}), stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(_bits.data(), 0, _bits.size() * sizeof(uint32_t), stream.value()));
+  if (keys.num_rows() == 0) { return; }
+
+  auto const hashes = cudf::hashing::detail::xxhash_64(
+    keys, DEFAULT_HASH_SEED, stream, rmm::mr::get_current_device_resource());
+  auto const row_bitmask = key_row_bitmask(keys, compare_nulls, stream);
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    keys.num_rows(),
+    [hashes      = hashes->view().begin<uint64_t>(),
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data()),
+     bits        = _bits.data(),
+     num_bits    = static_cast<uint64_t>(_bits.size()) * word_bits,
+     num_hashes  = _num_hashes] __device__(size_type row) {
+      // Rows with null keys never match when nulls are unequal
+      if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return; }
+      for (int32_t i = 0; i < num_hashes; ++i) {
+        auto const bit = filter_bit(hashes[row], i, num_bits);
+        cuda::atomic_ref<uint32_t, cuda::thread_scope_device> word{bits[bit / word_bits]};
+        word.fetch_or(1u << (bit % word_bits), cuda::std::memory_order_relaxed);
+      }
+    });
+}
+
+std::unique_ptr<column> bloom_filter::contains(table_view const& probe,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(probe.num_columns() == _num_columns,
+               "Mismatch in number of columns of the probe table and the Bloom filter keys");
+
+  auto result = make_numeric_column(
+    data_type{type_id::BOOL8}, probe.num_rows(), mask_state::UNALLOCATED, stream, mr);
+  if (probe.num_rows() == 0) { return result; }
+
+  auto const hashes = cudf::hashing::detail::xxhash_64(
+    probe, DEFAULT_HASH_SEED, stream, rmm::mr::get_current_device_resource());
+  auto const row_bitmask = key_row_bitmask(probe, _nulls_equal, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(probe.num_rows()),
+    result->mutable_view().begin<bool>(),
+    [hashes      = hashes->view().begin<uint64_t>(),
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data()),
+     bits        = _bits.data(),
+     num_bits    = static_cast<uint64_t>(_bits.size()) * word_bits,
+     num_hashes  = _num_hashes] __device__(size_type row) {
+      if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return false; }
+      for (int32_t i = 0; i < num_hashes; ++i) {
+        auto const bit = filter_bit(hashes[row], i, num_bits);
+        if ((bits[bit / word_bits] & (1u << (bit % word_bits))) == 0) { return false; }
+      }
+      return true;
+    });
+  return result;
+}
+
+}  // namespace cudf
@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include "join/band_join.hpp"
 #include "join/conditional_join.hpp"
 #include "join/conditional_join_kernels.cuh"
 #include "join/join_common_utils.cuh"
@@ -30,8 +31,11 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <algorithm>
 #include <optional>
 
 namespace cudf {
@@ -76,31 +80,11 @@ std::unique_ptr<rmm::device_uvector<size_type>> conditional_join_anti_semi(
   detail::grid_1d const config(left.num_rows(), DEFAULT_JOIN_BLOCK_SIZE);
   auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
 
-  // TODO: Remove the output_size parameter. It is not needed because the
-  // output size is bounded by the size of the left table.
-  std::size_t join_size;
-  if (output_size.has_value()) {
-    join_size = *output_size;
-  } else {
-    // Allocate storage for the counter used to get the size of the join output
-    rmm::device_scalar<std::size_t> size(0, stream, mr);
-    if (has_nulls) {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table, *right_table, join_type, parser.device_expression_data, false, size.data());
-    } else {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
-        <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-          *left_table, *right_table, join_type, parser.device_expression_data, false, size.data());
-    }
-    join_size = size.value(stream);
-  }
-
-  if (left.num_rows() == 0) {
-    return std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
-  }
+  // Each left row is written at most once, so the left table bounds the output and the kernel
+  // can write it in a single pass without computing its size first.
+  auto const join_size = output_size.value_or(static_cast<std::size_t>(left.num_rows()));
 
-  rmm::device_scalar<size_type> write_index(0, stream);
+  rmm::device_scalar<std::size_t> write_index(0, stream);
 
   auto left_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
 
@@ -127,6 +111,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> conditional_join_anti_semi(
         parser.device_expression_data,
         join_size);
   }
+  left_indices->resize(std::min(join_size, write_index.value(stream)), stream);
   return left_indices;
 }
 
@@ -177,6 +162,15 @@ conditional_join(table_view const& left,
     }
   }
 
+  // Inner joins on band and range predicates are computed by sorting the key
+  // column and searching the matching range of each row of the other table
+  // rather than evaluating the predicate for all pairs of rows.
+  if (join_type == join_kind::INNER_JOIN) {
+    if (auto const band = find_band_predicate(binary_predicate, left, right); band.has_value()) {
+      return band_inner_join(left, right, *band, stream, mr);
+    }
+  }
+
   // If evaluating the expression may produce null outputs we create a nullable
   // output column and follow the null-supporting expression evaluation code
   // path.
@@ -199,77 +193,62 @@ conditional_join(table_view const& left,
   join_kind const kernel_join_type =
     join_type == join_kind::FULL_JOIN ? join_kind::LEFT_JOIN : join_type;
 
-  // If the join size was not provided as an input, compute it here.
-  std::size_t join_size;
-  if (output_size.has_value()) {
-    join_size = *output_size;
-  } else {
-    // Allocate storage for the counter used to get the size of the join output
-    rmm::device_scalar<std::size_t> size(0, stream, mr);
+  if (output_size.has_value() and *output_size == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  rmm::device_scalar<std::size_t> write_index(0, stream);
+
+  auto const write_join = [&](rmm::device_uvector<size_type>& left_indices,
+                              rmm::device_uvector<size_type>& right_indices) {
     if (has_nulls) {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, true>
+      conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
         <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
           *left_table,
           *right_table,
           kernel_join_type,
+          left_indices.data(),
+          right_indices.data(),
+          write_index.data(),
           parser.device_expression_data,
-          swap_tables,
-          size.data());
+          left_indices.size(),
+          swap_tables);
     } else {
-      compute_conditional_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, false>
+      conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
         <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
           *left_table,
           *right_table,
           kernel_join_type,
+          left_indices.data(),
+          right_indices.data(),
+          write_index.data(),
           parser.device_expression_data,
-          swap_tables,
-          size.data());
+          left_indices.size(),
+          swap_tables);
     }
-    join_size = size.value(stream);
-  }
-
-  // The initial early exit clauses guarantee that we will not reach this point
-  // unless both the left and right tables are non-empty. Under that
-  // constraint, neither left nor full joins can return an empty result since
-  // at minimum we are guaranteed null matches for all non-matching rows. In
-  // all other cases (inner, left semi, and left anti joins) if we reach this
-  // point we can safely return an empty result.
-  if (join_size == 0) {
-    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
-                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
-  }
-
-  rmm::device_scalar<size_type> write_index(0, stream);
-
-  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
-
-  auto const& join_output_l = left_indices->data();
-  auto const& join_output_r = right_indices->data();
-  if (has_nulls) {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, true>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size,
-        swap_tables);
+  };
+
+  // Without a size hint, the join is written in a single pass to buffers sized for one match per
+  // row of the larger table, rather than evaluating the expression once to size the output and
+  // again to write it. The write cursor counts the pairs that did not fit, so if the buffers
+  // overflow they are reallocated to the exact size and the join is written once more.
+  auto const capacity = output_size.value_or(
+    static_cast<std::size_t>(std::max(left.num_rows(), right.num_rows())));
+
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(capacity, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(capacity, stream, mr);
+  write_join(*left_indices, *right_indices);
+
+  auto const join_size = write_index.value(stream);
+  if (join_size > capacity) {
+    left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    write_index.set_value_to_zero_async(stream);
+    write_join(*left_indices, *right_indices);
   } else {
-    conditional_join<DEFAULT_JOIN_BLOCK_SIZE, DEFAULT_JOIN_CACHE_SIZE, false>
-      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
-        *left_table,
-        *right_table,
-        kernel_join_type,
-        join_output_l,
-        join_output_r,
-        write_index.data(),
-        parser.device_expression_data,
-        join_size,
-        swap_tables);
+    left_indices->resize(join_size, stream);
+    right_indices->resize(join_size, stream);
   }
 
   auto join_indices = std::pair(std::move(left_indices), std::move(right_indices));
@@ -326,6 +305,12 @@ std::size_t compute_conditional_join_output_size(table_view const& left,
     }
   }
 
+  if (join_type == join_kind::INNER_JOIN) {
+    if (auto const band = find_band_predicate(binary_predicate, left, right); band.has_value()) {
+      return band_inner_join_size(left, right, *band, stream);
+    }
+  }
+
   // Prepare output column. Whether or not the output column is nullable is
   // determined by whether any of the columns in the input table are nullable.
   // If none of the input columns actually contain nulls, we can still use the
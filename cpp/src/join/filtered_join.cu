@@ -0,0 +1,282 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join_common_utils.cuh"
+#include "join_common_utils.hpp"
+
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/join.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using cudf::experimental::row::lhs_index_type;
+using cudf::experimental::row::rhs_index_type;
+
+/**
+ * @brief Device functor to create a pair of hash value and index for a given row.
+ */
+struct make_pair_function_semi {
+  __device__ __forceinline__ cudf::detail::pair_type operator()(size_type i) const noexcept
+  {
+    // The value is irrelevant since we only ever use the hash map to check for
+    // membership of a particular row index.
+    return cuco::make_pair(static_cast<hash_value_type>(i), 0);
+  }
+};
+
+/**
+ * @brief Equality comparator of two rows of the build table, used to insert the build rows.
+ */
+template <typename Equal>
+struct build_row_equality {
+  Equal _equal;
+
+  __device__ bool operator()(size_type lhs_row_index, size_type rhs_row_index) const noexcept
+  {
+    return _equal(lhs_index_type{lhs_row_index}, rhs_index_type{rhs_row_index});
+  }
+};
+
+/**
+ * @brief Equality comparator of a build row and a probe row, used to probe the hash map.
+ *
+ * The comparator compares the rows of a two table comparator built with the probe table on the
+ * left and the build table on the right.
+ */
+template <typename Equal>
+struct probe_row_equality {
+  Equal _equal;
+
+  // The parameters are build/probe because the operator is called by cuco's kernels with
+  // parameters in this order
+  __device__ bool operator()(hash_value_type build_row_index,
+                             hash_value_type probe_row_index) const noexcept
+  {
+    return _equal(lhs_index_type{static_cast<size_type>(probe_row_index)},
+                  rhs_index_type{static_cast<size_type>(build_row_index)});
+  }
+};
+
+}  // namespace
+
+/**
+ * @brief Implementation of `cudf::filtered_join`.
+ *
+ * The hash map holds the indices of the distinct rows of the build table. The row comparators
+ * are passed to the map for each operation, so the map can be probed with any probe table.
+ */
+class filtered_join {
+ public:
+  filtered_join()                                = delete;
+  ~filtered_join()                               = default;
+  filtered_join(filtered_join const&)            = delete;
+  filtered_join(filtered_join&&)                 = delete;
+  filtered_join& operator=(filtered_join const&) = delete;
+  filtered_join& operator=(filtered_join&&)      = delete;
+
+  /**
+   * @copydoc cudf::filtered_join::filtered_join
+   */
+  filtered_join(table_view const& build,
+                null_equality compare_nulls,
+                rmm::cuda_stream_view stream)
+    : _has_nested{has_nested_columns(build)},
+      _build_has_nulls{has_nested_nulls(build)},
+      _nulls_equal{compare_nulls},
+      _build{build},
+      _preprocessed_build{
+        cudf::experimental::row::equality::preprocessed_table::create(build, stream)},
+      _hash_table{compute_hash_table_size(std::max(build.num_rows(), size_type{1})),
+                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                  cuco::empty_value{cudf::detail::JoinNoneValue},
+                  cudf::detail::cuco_allocator{stream},
+                  stream.value()}
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(0 != build.num_columns(), "Filtered join build table is empty");
+    if (build.num_rows() == 0) { return; }
+
+    auto const build_nulls = nullate::DYNAMIC{_build_has_nulls};
+    auto const row_hash    = cudf::experimental::row::hash::row_hasher{_preprocessed_build};
+    auto const hash_build  = row_hash.device_hasher(build_nulls);
+    auto const self_equal =
+      cudf::experimental::row::equality::two_table_comparator{_preprocessed_build,
+                                                              _preprocessed_build};
+    auto const iter = cudf::detail::make_counting_transform_iterator(0, make_pair_function_semi{});
+
+    auto const insert_rows = [&](auto const& d_equal) {
+      auto const equality = build_row_equality<std::decay_t<decltype(d_equal)>>{d_equal};
+      // Rows with null keys never match when nulls are unequal, so they are not inserted
+      if (compare_nulls == null_equality::EQUAL or not cudf::has_nulls(build)) {
+        _hash_table.insert(iter, iter + build.num_rows(), hash_build, equality, stream.value());
+      } else {
+        thrust::counting_iterator<cudf::size_type> stencil(0);
+        auto const [row_bitmask, _] =
+          cudf::detail::bitmask_and(build, stream, rmm::mr::get_current_device_resource());
+        row_is_valid pred{static_cast<bitmask_type const*>(row_bitmask.data())};
+        _hash_table.insert_if(iter,
+                              iter + build.num_rows(),
+                              stencil,
+                              pred,
+                              hash_build,
+                              equality,
+                              stream.value());
+      }
+    };
+
+    if (_has_nested) {
+      insert_rows(self_equal.equal_to<true>(build_nulls, compare_nulls));
+    } else {
+      insert_rows(self_equal.equal_to<false>(build_nulls, compare_nulls));
+    }
+  }
+
+  /**
+   * @brief Returns the indices of the probe rows that have (semi join) or do not have (anti join)
+   * a match in the build table.
+   *
+   * @param probe The probe table
+   * @param kind Either LEFT_SEMI_JOIN or LEFT_ANTI_JOIN
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vector
+   * @return The probe row indices
+   */
+  std::unique_ptr<rmm::device_uvector<size_type>> compute_filtered_join(
+    table_view const& probe,
+    join_kind kind,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(probe.num_columns() == _build.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(cudf::have_same_types(_build, probe),
+                 "Mismatch in joining column data types",
+                 cudf::data_type_error);
+
+    if (probe.num_rows() == 0 or
+        (kind == join_kind::LEFT_SEMI_JOIN and _build.num_rows() == 0)) {
+      return std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr);
+    }
+    if (kind == join_kind::LEFT_ANTI_JOIN and _build.num_rows() == 0) {
+      auto result =
+        std::make_unique<rmm::device_uvector<size_type>>(probe.num_rows(), stream, mr);
+      thrust::sequence(rmm::exec_policy(stream), result->begin(), result->end());
+      return result;
+    }
+
+    auto const has_nulls = nullate::DYNAMIC{_build_has_nulls or has_nested_nulls(probe)};
+    auto const preprocessed_probe =
+      cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+    auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+    auto const hash_probe = row_hash.device_hasher(has_nulls);
+    auto const row_comparator =
+      cudf::experimental::row::equality::two_table_comparator{preprocessed_probe,
+                                                              _preprocessed_build};
+
+    auto contained = rmm::device_uvector<bool>(probe.num_rows(), stream);
+    auto const contains_rows = [&](auto const& d_equal) {
+      thrust::transform(
+        rmm::exec_policy_nosync(stream),
+        thrust::counting_iterator<size_type>(0),
+        thrust::counting_iterator<size_type>(probe.num_rows()),
+        contained.begin(),
+        [hash_table_view = _hash_table.get_device_view(),
+         hash_probe,
+         equality = probe_row_equality<std::decay_t<decltype(d_equal)>>{d_equal}] __device__(
+          size_type row) { return hash_table_view.contains(row, hash_probe, equality); });
+    };
+    if (_has_nested) {
+      contains_rows(row_comparator.equal_to<true>(has_nulls, _nulls_equal));
+    } else {
+      contains_rows(row_comparator.equal_to<false>(has_nulls, _nulls_equal));
+    }
+
+    auto gather_map =
+      std::make_unique<rmm::device_uvector<size_type>>(probe.num_rows(), stream, mr);
+    auto const gather_map_end =
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(probe.num_rows()),
+                      contained.begin(),
+                      gather_map->begin(),
+                      [kind] __device__(bool keep_row) {
+                        return keep_row == (kind == join_kind::LEFT_SEMI_JOIN);
+                      });
+    gather_map->resize(thrust::distance(gather_map->begin(), gather_map_end), stream);
+    return gather_map;
+  }
+
+ private:
+  bool const _has_nested;       ///< true if the build table has nested columns
+  bool const _build_has_nulls;  ///< true if the build table has nulls at any nested level
+  cudf::null_equality const _nulls_equal;  ///< whether to consider nulls as equal
+  cudf::table_view _build;                 ///< input table to build the hash map
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
+    _preprocessed_build;      ///< input table preprocessed for row operators
+  semi_map_type _hash_table;  ///< hash map of the distinct rows of `_build`
+};
+
+}  // namespace detail
+
+filtered_join::~filtered_join() = default;
+
+filtered_join::filtered_join(table_view const& build,
+                             null_equality compare_nulls,
+                             rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl_type const>(build, compare_nulls, stream)}
+{
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> filtered_join::semi_join(
+  table_view const& probe, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  return _impl->compute_filtered_join(probe, detail::join_kind::LEFT_SEMI_JOIN, stream, mr);
+}
+
+std::unique_ptr<rmm::device_uvector<size_type>> filtered_join::anti_join(
+  table_view const& probe, rmm::cuda_stream_view stream, rmm::device_async_resource_ref mr) const
+{
+  return _impl->compute_filtered_join(probe, detail::join_kind::LEFT_ANTI_JOIN, stream, mr);
+}
+
+}  // namespace cudf
@@ -36,9 +36,11 @@
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
 #include <thrust/scatter.h>
+#include <thrust/sequence.h>
 #include <thrust/tuple.h>
 #include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
 #include <cstddef>
 #include <iostream>
 #include <numeric>
@@ -241,6 +243,119 @@ probe_join_hash_table(
   return std::pair(std::move(left_indices), std::move(right_indices));
 }
 
+/**
+ * @brief Probes the `hash_table` built from `build_table` for a batch of the tuples in
+ * `probe_table`, and returns the output indices of `build_table` and `probe_table` as a combined
+ * table.
+ *
+ * The batch starts at probe row `probe_row_offset` and is the longest run of probe rows found whose
+ * output fits in `max_output_size` index pairs. A batch always takes at least one probe row, so it
+ * exceeds `max_output_size` if that single row does.
+ *
+ * @param build_table Table of build side columns to join
+ * @param probe_table Table of probe side columns to join
+ * @param preprocessed_build shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           build_table
+ * @param preprocessed_probe shared_ptr to cudf::experimental::row::equality::preprocessed_table for
+ *                           probe_table
+ * @param hash_table Hash table built from `build_table`
+ * @param join The type of join to be performed, either INNER_JOIN or LEFT_JOIN
+ * @param has_nulls Flag to denote if build or probe tables have nested nulls
+ * @param compare_nulls Controls whether null join-key values should match or not
+ * @param probe_row_offset The first probe row of the batch
+ * @param max_output_size Maximum number of index pairs of the batch
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vectors
+ *
+ * @return Join output indices vector pair, and the probe row after the last row of the batch
+ */
+std::pair<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                    std::unique_ptr<rmm::device_uvector<size_type>>>,
+          size_type>
+probe_join_hash_table_batch(
+  cudf::table_view const& build_table,
+  cudf::table_view const& probe_table,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_build,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_probe,
+  cudf::detail::multimap_type const& hash_table,
+  join_kind join,
+  bool has_nulls,
+  null_equality compare_nulls,
+  size_type probe_row_offset,
+  std::size_t max_output_size,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const probe_nulls = cudf::nullate::DYNAMIC{has_nulls};
+
+  auto const row_hash           = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+  auto const hash_probe         = row_hash.device_hasher(probe_nulls);
+  auto const empty_key_sentinel = hash_table.get_empty_key_sentinel();
+  // The pairs carry the probe row indices, so the batch outputs the indices of the whole table
+  auto const iter = cudf::detail::make_counting_transform_iterator(
+    0, make_pair_function{hash_probe, empty_key_sentinel});
+
+  cudf::size_type const probe_table_num_rows = probe_table.num_rows();
+
+  auto const row_comparator =
+    cudf::experimental::row::equality::two_table_comparator{preprocessed_probe, preprocessed_build};
+  auto const comparator_helper = [&](auto device_comparator) {
+    pair_equality equality{device_comparator};
+    auto const is_outer_join = join == cudf::detail::join_kind::LEFT_JOIN;
+
+    auto const batch_output_size = [&](size_type batch_end) {
+      auto const begin = iter + probe_row_offset;
+      auto const end   = iter + batch_end;
+      return is_outer_join ? hash_table.pair_count_outer(begin, end, equality, stream.value())
+                           : hash_table.pair_count(begin, end, equality, stream.value());
+    };
+
+    // Shrink the batch in proportion to the excess of its output until the output fits
+    auto batch_end   = probe_table_num_rows;
+    auto output_size = batch_output_size(batch_end);
+    while (output_size > max_output_size and batch_end - probe_row_offset > 1) {
+      auto const num_rows = batch_end - probe_row_offset;
+      auto const estimated_num_rows =
+        static_cast<size_type>(static_cast<double>(num_rows) * max_output_size / output_size);
+      batch_end   = probe_row_offset + std::clamp(estimated_num_rows, 1, num_rows - 1);
+      output_size = batch_output_size(batch_end);
+    }
+
+    auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+    if (output_size > 0) {
+      auto const out1_zip_begin = thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_discard_iterator(), left_indices->begin()));
+      auto const out2_zip_begin = thrust::make_zip_iterator(
+        thrust::make_tuple(thrust::make_discard_iterator(), right_indices->begin()));
+      if (is_outer_join) {
+        hash_table.pair_retrieve_outer(iter + probe_row_offset,
+                                       iter + batch_end,
+                                       out1_zip_begin,
+                                       out2_zip_begin,
+                                       equality,
+                                       stream.value());
+      } else {
+        hash_table.pair_retrieve(iter + probe_row_offset,
+                                 iter + batch_end,
+                                 out1_zip_begin,
+                                 out2_zip_begin,
+                                 equality,
+                                 stream.value());
+      }
+    }
+    return std::pair(std::pair(std::move(left_indices), std::move(right_indices)), batch_end);
+  };
+
+  if (cudf::detail::has_nested_columns(probe_table)) {
+    auto const device_comparator = row_comparator.equal_to<true>(probe_nulls, compare_nulls);
+    return comparator_helper(device_comparator);
+  } else {
+    auto const device_comparator = row_comparator.equal_to<false>(probe_nulls, compare_nulls);
+    return comparator_helper(device_comparator);
+  }
+}
+
 /**
  * @brief Probes the `hash_table` built from `build_table` for tuples in `probe_table` twice,
  * and returns the output size of a full join operation between `build_table` and `probe_table`.
@@ -372,7 +487,7 @@ hash_join<Hasher>::hash_join(cudf::table_view const& build,
                 cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
                 cuco::empty_value{cudf::detail::JoinNoneValue},
                 stream.value(),
-                cudf::detail::cuco_allocator{stream}},
+                cudf::detail::make_join_hash_table_allocator(stream)},
     _build{build},
     _preprocessed_build{
       cudf::experimental::row::equality::preprocessed_table::create(_build, stream)}
@@ -429,6 +544,38 @@ hash_join<Hasher>::full_join(cudf::table_view const& probe,
   return compute_hash_join(probe, cudf::detail::join_kind::FULL_JOIN, output_size, stream, mr);
 }
 
+template <typename Hasher>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join<Hasher>::inner_join_batch(cudf::table_view const& probe,
+                                    size_type& probe_row_offset,
+                                    std::size_t max_output_size,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join_batch(probe,
+                                 cudf::detail::join_kind::INNER_JOIN,
+                                 probe_row_offset,
+                                 max_output_size,
+                                 stream,
+                                 mr);
+}
+
+template <typename Hasher>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join<Hasher>::left_join_batch(cudf::table_view const& probe,
+                                   size_type& probe_row_offset,
+                                   std::size_t max_output_size,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return compute_hash_join_batch(
+    probe, cudf::detail::join_kind::LEFT_JOIN, probe_row_offset, max_output_size, stream, mr);
+}
+
 template <typename Hasher>
 std::size_t hash_join<Hasher>::inner_join_size(cudf::table_view const& probe,
                                                rmm::cuda_stream_view stream) const
@@ -508,6 +655,13 @@ std::size_t hash_join<Hasher>::full_join_size(cudf::table_view const& probe,
                                           mr);
 }
 
+template <typename Hasher>
+cudf::bloom_filter hash_join<Hasher>::make_bloom_filter(size_type bits_per_key,
+                                                        rmm::cuda_stream_view stream) const
+{
+  return cudf::bloom_filter{_build, _nulls_equal, bits_per_key, stream};
+}
+
 template <typename Hasher>
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
           std::unique_ptr<rmm::device_uvector<size_type>>>
@@ -577,6 +731,73 @@ hash_join<Hasher>::compute_hash_join(cudf::table_view const& probe,
 
   return probe_join_indices(probe, join, output_size, stream, mr);
 }
+
+template <typename Hasher>
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join<Hasher>::compute_hash_join_batch(cudf::table_view const& probe,
+                                           cudf::detail::join_kind join,
+                                           size_type& probe_row_offset,
+                                           std::size_t max_output_size,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr) const
+{
+  CUDF_EXPECTS(0 != probe.num_columns(), "Hash join probe table is empty");
+
+  CUDF_EXPECTS(_build.num_columns() == probe.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  CUDF_EXPECTS(_has_nulls || !cudf::has_nested_nulls(probe),
+               "Probe table has nulls while build table was not hashed with null check.");
+
+  CUDF_EXPECTS(probe_row_offset >= 0 and probe_row_offset <= probe.num_rows(),
+               "Probe row offset is out of bounds",
+               std::out_of_range);
+  CUDF_EXPECTS(max_output_size > 0, "Maximum output size must be positive", std::invalid_argument);
+
+  auto const num_probe_rows = probe.num_rows();
+  if (probe_row_offset == num_probe_rows or
+      (_is_empty and join == cudf::detail::join_kind::INNER_JOIN)) {
+    probe_row_offset = num_probe_rows;
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // Trivial left join case, every probe row has a single output row
+  if (_is_empty) {
+    auto const batch_size = static_cast<size_type>(
+      std::min<std::size_t>(max_output_size, num_probe_rows - probe_row_offset));
+    auto left_indices = std::make_unique<rmm::device_uvector<size_type>>(batch_size, stream, mr);
+    thrust::sequence(
+      rmm::exec_policy(stream), left_indices->begin(), left_indices->end(), probe_row_offset);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(batch_size, stream, mr);
+    thrust::uninitialized_fill(
+      rmm::exec_policy(stream), right_indices->begin(), right_indices->end(), JoinNoneValue);
+    probe_row_offset += batch_size;
+    return std::pair(std::move(left_indices), std::move(right_indices));
+  }
+
+  CUDF_EXPECTS(cudf::have_same_types(_build, probe),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+
+  auto const preprocessed_probe =
+    cudf::experimental::row::equality::preprocessed_table::create(probe, stream);
+  auto [join_indices, batch_end] = cudf::detail::probe_join_hash_table_batch(_build,
+                                                                             probe,
+                                                                             _preprocessed_build,
+                                                                             preprocessed_probe,
+                                                                             _hash_table,
+                                                                             join,
+                                                                             _has_nulls,
+                                                                             _nulls_equal,
+                                                                             probe_row_offset,
+                                                                             max_output_size,
+                                                                             stream,
+                                                                             mr);
+  probe_row_offset = batch_end;
+  return std::move(join_indices);
+}
 }  // namespace detail
 
 hash_join::~hash_join() = default;
@@ -628,6 +849,28 @@ hash_join::full_join(cudf::table_view const& probe,
   return _impl->full_join(probe, output_size, stream, mr);
 }
 
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::inner_join_batch(cudf::table_view const& probe,
+                            size_type& probe_row_offset,
+                            std::size_t max_output_size,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr) const
+{
+  return _impl->inner_join_batch(probe, probe_row_offset, max_output_size, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+hash_join::left_join_batch(cudf::table_view const& probe,
+                           size_type& probe_row_offset,
+                           std::size_t max_output_size,
+                           rmm::cuda_stream_view stream,
+                           rmm::device_async_resource_ref mr) const
+{
+  return _impl->left_join_batch(probe, probe_row_offset, max_output_size, stream, mr);
+}
+
 std::size_t hash_join::inner_join_size(cudf::table_view const& probe,
                                        rmm::cuda_stream_view stream) const
 {
@@ -647,4 +890,10 @@ std::size_t hash_join::full_join_size(cudf::table_view const& probe,
   return _impl->full_join_size(probe, stream, mr);
 }
 
+bloom_filter hash_join::make_bloom_filter(size_type bits_per_key,
+                                          rmm::cuda_stream_view stream) const
+{
+  return _impl->make_bloom_filter(bits_per_key, stream);
+}
+
 }  // namespace cudf
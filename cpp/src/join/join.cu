@@ -43,9 +43,11 @@ inner_join(table_view const& left_input,
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
 
-  // now rebuild the table views with the updated ones
-  auto const left      = matched.second.front();
-  auto const right     = matched.second.back();
+  // now rebuild the table views with the updated ones, hashing dictionaries by their indices
+  auto const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  auto const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
   auto const has_nulls = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
                            ? cudf::nullable_join::YES
                            : cudf::nullable_join::NO;
@@ -77,12 +79,14 @@ left_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
-  auto const has_nulls   = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
-                             ? cudf::nullable_join::YES
-                             : cudf::nullable_join::NO;
+  // now rebuild the table views with the updated ones, hashing dictionaries by their indices
+  table_view const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  table_view const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
+  auto const has_nulls = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
+                           ? cudf::nullable_join::YES
+                           : cudf::nullable_join::NO;
 
   cudf::hash_join hj_obj(right, has_nulls, compare_nulls, stream);
   return hj_obj.left_join(left, std::nullopt, stream, mr);
@@ -102,12 +106,14 @@ full_join(table_view const& left_input,
     {left_input, right_input},  // these should match
     stream,
     rmm::mr::get_current_device_resource());  // temporary objects returned
-  // now rebuild the table views with the updated ones
-  table_view const left  = matched.second.front();
-  table_view const right = matched.second.back();
-  auto const has_nulls   = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
-                             ? cudf::nullable_join::YES
-                             : cudf::nullable_join::NO;
+  // now rebuild the table views with the updated ones, hashing dictionaries by their indices
+  table_view const left =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.front());
+  table_view const right =
+    cudf::dictionary::detail::replace_dictionaries_with_indices(matched.second.back());
+  auto const has_nulls = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
+                           ? cudf::nullable_join::YES
+                           : cudf::nullable_join::NO;
 
   cudf::hash_join hj_obj(right, has_nulls, compare_nulls, stream);
   return hj_obj.full_join(left, std::nullopt, stream, mr);
@@ -27,6 +27,7 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/atomic>
 #include <thrust/iterator/counting_iterator.h>
 
 namespace cudf {
@@ -248,6 +249,26 @@ get_left_join_indices_complement(std::unique_ptr<rmm::device_uvector<size_type>>
                                  rmm::cuda_stream_view stream,
                                  rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Assigns the output pairs of runs of matches to their runs.
+ *
+ * Run `i` produces `run_sizes[i]` consecutive output pairs. Each output pair finds its run with a
+ * binary search of the run offsets, which balances the work over the output pairs rather than the
+ * runs, so that runs with many matches are split evenly over the threads.
+ *
+ * @throw std::overflow_error if the number of output pairs exceeds the column size limit
+ *
+ * @param run_sizes Number of output pairs of each run
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned run indices
+ *
+ * @return The run of each output pair, and the offset of the first output pair of each run
+ */
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>, rmm::device_uvector<int64_t>>
+assign_pairs_to_runs(device_span<size_type const> run_sizes,
+                     rmm::cuda_stream_view stream,
+                     rmm::device_async_resource_ref mr);
+
 /**
  * @brief Device functor to determine if an index is contained in a range.
  */
@@ -298,10 +319,10 @@ __inline__ __device__ void add_left_to_cache(size_type const first,
 
 template <int num_warps, cudf::size_type output_cache_size>
 __device__ void flush_output_cache(unsigned int const activemask,
-                                   cudf::size_type const max_size,
+                                   std::size_t const max_size,
                                    int const warp_id,
                                    int const lane_id,
-                                   cudf::size_type* current_idx,
+                                   std::size_t* current_idx,
                                    cudf::size_type current_idx_shared[num_warps],
                                    size_type join_shared_l[num_warps][output_cache_size],
                                    size_type join_shared_r[num_warps][output_cache_size],
@@ -309,10 +330,15 @@ __device__ void flush_output_cache(unsigned int const activemask,
                                    size_type* join_output_r)
 {
   // count how many active threads participating here which could be less than warp_size
-  int const num_threads         = __popc(activemask);
-  cudf::size_type output_offset = 0;
-
-  if (0 == lane_id) { output_offset = atomicAdd(current_idx, current_idx_shared[warp_id]); }
+  int const num_threads     = __popc(activemask);
+  std::size_t output_offset = 0;
+
+  // The cursor counts every pair, including those beyond max_size that are dropped, so that the
+  // caller can learn the full size of the output from it
+  if (0 == lane_id) {
+    cuda::atomic_ref<std::size_t, cuda::thread_scope_device> ref{*current_idx};
+    output_offset = ref.fetch_add(current_idx_shared[warp_id], cuda::std::memory_order_relaxed);
+  }
 
   // No warp sync is necessary here because we are assuming that ShuffleIndex
   // is internally using post-CUDA 9.0 synchronization-safe primitives
@@ -323,7 +349,7 @@ __device__ void flush_output_cache(unsigned int const activemask,
 
   for (int shared_out_idx = lane_id; shared_out_idx < current_idx_shared[warp_id];
        shared_out_idx += num_threads) {
-    cudf::size_type thread_offset = output_offset + shared_out_idx;
+    auto const thread_offset = output_offset + shared_out_idx;
     if (thread_offset < max_size) {
       join_output_l[thread_offset] = join_shared_l[warp_id][shared_out_idx];
       join_output_r[thread_offset] = join_shared_r[warp_id][shared_out_idx];
@@ -333,24 +359,27 @@ __device__ void flush_output_cache(unsigned int const activemask,
 
 template <int num_warps, cudf::size_type output_cache_size>
 __device__ void flush_output_cache(unsigned int const activemask,
-                                   cudf::size_type const max_size,
+                                   std::size_t const max_size,
                                    int const warp_id,
                                    int const lane_id,
-                                   cudf::size_type* current_idx,
+                                   std::size_t* current_idx,
                                    cudf::size_type current_idx_shared[num_warps],
                                    size_type join_shared_l[num_warps][output_cache_size],
                                    size_type* join_output_l)
 {
-  int const num_threads         = __popc(activemask);
-  cudf::size_type output_offset = 0;
+  int const num_threads     = __popc(activemask);
+  std::size_t output_offset = 0;
 
-  if (0 == lane_id) { output_offset = atomicAdd(current_idx, current_idx_shared[warp_id]); }
+  if (0 == lane_id) {
+    cuda::atomic_ref<std::size_t, cuda::thread_scope_device> ref{*current_idx};
+    output_offset = ref.fetch_add(current_idx_shared[warp_id], cuda::std::memory_order_relaxed);
+  }
 
   output_offset = cub::ShuffleIndex<detail::warp_size>(output_offset, 0, activemask);
 
   for (int shared_out_idx = lane_id; shared_out_idx < current_idx_shared[warp_id];
        shared_out_idx += num_threads) {
-    cudf::size_type thread_offset = output_offset + shared_out_idx;
+    auto const thread_offset = output_offset + shared_out_idx;
     if (thread_offset < max_size) {
       join_output_l[thread_offset] = join_shared_l[warp_id][shared_out_idx];
     }
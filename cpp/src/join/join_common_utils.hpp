@@ -21,6 +21,9 @@
 #include <cudf/join.hpp>
 #include <cudf/table/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
 
 #include <cuco/static_map.cuh>
 #include <cuco/static_multimap.cuh>
@@ -59,6 +62,16 @@ using row_hash_legacy =
 
 using row_equality_legacy = cudf::row_equality_comparator<cudf::nullate::DYNAMIC>;
 
+/**
+ * @brief Returns the allocator for join hash tables, which allocates from the
+ * temporary memory resource for `temporary_allocation::JOIN_HASH_TABLE`.
+ */
+inline cuco_allocator make_join_hash_table_allocator(rmm::cuda_stream_view stream)
+{
+  return cuco_allocator{get_temporary_memory_resource(temporary_allocation::JOIN_HASH_TABLE),
+                        stream};
+}
+
 bool is_trivial_join(table_view const& left, table_view const& right, join_kind join_type);
 }  // namespace detail
 }  // namespace cudf
@@ -19,14 +19,21 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/scan.h>
 #include <thrust/scatter.h>
 #include <thrust/sequence.h>
 #include <thrust/uninitialized_fill.h>
 
+#include <limits>
+#include <stdexcept>
+
 namespace cudf {
 namespace detail {
 
@@ -155,5 +162,33 @@ get_left_join_indices_complement(std::unique_ptr<rmm::device_uvector<size_type>>
   return std::pair(std::move(left_invalid_indices), std::move(right_indices_complement));
 }
 
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>, rmm::device_uvector<int64_t>>
+assign_pairs_to_runs(device_span<size_type const> run_sizes,
+                     rmm::cuda_stream_view stream,
+                     rmm::device_async_resource_ref mr)
+{
+  // The offsets are accumulated in 64 bits to detect outputs exceeding the column size limit
+  auto const sizes = thrust::make_transform_iterator(
+    run_sizes.begin(),
+    cuda::proclaim_return_type<int64_t>([] __device__(size_type size) -> int64_t { return size; }));
+  rmm::device_uvector<int64_t> offsets(run_sizes.size() + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy_nosync(stream), sizes, sizes + run_sizes.size(), offsets.begin() + 1);
+  auto const num_pairs = offsets.back_element(stream);
+  CUDF_EXPECTS(num_pairs <= std::numeric_limits<size_type>::max(),
+               "The join output size exceeds the column size limit",
+               std::overflow_error);
+
+  auto runs = std::make_unique<rmm::device_uvector<size_type>>(num_pairs, stream, mr);
+  thrust::upper_bound(rmm::exec_policy_nosync(stream),
+                      offsets.begin() + 1,
+                      offsets.end(),
+                      thrust::counting_iterator<int64_t>(0),
+                      thrust::counting_iterator<int64_t>(num_pairs),
+                      runs->begin());
+  return std::pair(std::move(runs), std::move(offsets));
+}
+
 }  // namespace detail
 }  // namespace cudf
@@ -20,6 +20,7 @@
 
 #include <cudf/ast/detail/expression_parser.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/hashing/detail/helper_functions.cuh>
 #include <cudf/join.hpp>
@@ -29,14 +30,19 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/span.hpp>
+#include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_scalar.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/fill.h>
 #include <thrust/scan.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <optional>
 #include <utility>
 
@@ -133,7 +139,7 @@ mixed_join(
                                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
                                  cuco::empty_value{cudf::detail::JoinNoneValue},
                                  stream.value(),
-                                 cudf::detail::cuco_allocator{stream}};
+                                 cudf::detail::make_join_hash_table_allocator(stream)};
 
   // TODO: To add support for nested columns we will need to flatten in many
   // places. However, this probably isn't worth adding any time soon since we
@@ -398,7 +404,7 @@ compute_mixed_join_output_size(table_view const& left_equality,
                                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
                                  cuco::empty_value{cudf::detail::JoinNoneValue},
                                  stream.value(),
-                                 cudf::detail::cuco_allocator{stream}};
+                                 cudf::detail::make_join_hash_table_allocator(stream)};
 
   // TODO: To add support for nested columns we will need to flatten in many
   // places. However, this probably isn't worth adding any time soon since we
@@ -472,6 +478,221 @@ compute_mixed_join_output_size(table_view const& left_equality,
   return {size.value(stream), std::move(matches_per_row)};
 }
 
+/**
+ * @brief Implementation of `cudf::mixed_join`.
+ *
+ * The hash table of the build equality table and the plans of the expression are created once.
+ * The kernels are always launched with one thread per probe row, so the tables are never swapped.
+ */
+class mixed_join_impl {
+ public:
+  mixed_join_impl()                                  = delete;
+  ~mixed_join_impl()                                 = default;
+  mixed_join_impl(mixed_join_impl const&)            = delete;
+  mixed_join_impl(mixed_join_impl&&)                 = delete;
+  mixed_join_impl& operator=(mixed_join_impl const&) = delete;
+  mixed_join_impl& operator=(mixed_join_impl&&)      = delete;
+
+  /**
+   * @copydoc cudf::mixed_join::mixed_join
+   */
+  mixed_join_impl(table_view const& build_equality,
+                  table_view const& build_conditional,
+                  table_view const& probe_conditional,
+                  ast::expression const& binary_predicate,
+                  null_equality compare_nulls,
+                  rmm::cuda_stream_view stream)
+    : _build_has_nulls{cudf::has_nulls(build_equality)},
+      _nulls_equal{compare_nulls},
+      _build_equality{build_equality},
+      _build_conditional{build_conditional},
+      _probe_conditional_schema{cudf::empty_like(probe_conditional)},
+      _binary_predicate{binary_predicate},
+      _preprocessed_build{
+        experimental::row::equality::preprocessed_table::create(build_equality, stream)},
+      _hash_table{compute_hash_table_size(std::max(build_equality.num_rows(), size_type{1})),
+                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                  cuco::empty_value{cudf::detail::JoinNoneValue},
+                  stream.value(),
+                  cudf::detail::make_join_hash_table_allocator(stream)}
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(build_conditional.num_rows() == build_equality.num_rows(),
+                 "The build conditional and equality tables must have the same number of rows.");
+
+    // The plans only depend on the column types of the conditional tables, so they are valid for
+    // every probe table with the schema of `probe_conditional`. The plan for nullable inputs needs
+    // more intermediate storage, which is why both plans are kept.
+    auto const make_plan = [&](bool has_nulls) {
+      return std::make_unique<ast::detail::expression_parser>(
+        binary_predicate,
+        _probe_conditional_schema->view(),
+        build_conditional,
+        has_nulls,
+        stream,
+        rmm::mr::get_current_device_resource());
+    };
+    _plan          = make_plan(false);
+    _nullable_plan = make_plan(true);
+    CUDF_EXPECTS(_plan->output_type().id() == type_id::BOOL8,
+                 "The expression must produce a boolean output.");
+
+    if (build_equality.num_rows() == 0) { return; }
+    auto const row_bitmask =
+      cudf::detail::bitmask_and(build_equality, stream, rmm::mr::get_current_device_resource())
+        .first;
+    build_join_hash_table(build_equality,
+                          _preprocessed_build,
+                          _hash_table,
+                          _build_has_nulls,
+                          compare_nulls,
+                          static_cast<bitmask_type const*>(row_bitmask.data()),
+                          stream);
+  }
+
+  /**
+   * @brief Returns the row index vectors of the inner or left join of the probe tables with the
+   * build tables.
+   *
+   * @param probe_equality The probe table used for the equality join
+   * @param probe_conditional The probe table used for the conditional join
+   * @param join_type Either INNER_JOIN or LEFT_JOIN
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @param mr Device memory resource used to allocate the returned vectors
+   * @return The [probe, build] row index vectors
+   */
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  compute_join(table_view const& probe_equality,
+               table_view const& probe_conditional,
+               join_kind join_type,
+               rmm::cuda_stream_view stream,
+               rmm::device_async_resource_ref mr) const
+  {
+    CUDF_FUNC_RANGE();
+    CUDF_EXPECTS(probe_conditional.num_rows() == probe_equality.num_rows(),
+                 "The probe conditional and equality tables must have the same number of rows.");
+    CUDF_EXPECTS(probe_equality.num_columns() == _build_equality.num_columns(),
+                 "Mismatch in number of columns to be joined on");
+    CUDF_EXPECTS(cudf::have_same_types(probe_equality, _build_equality),
+                 "Mismatch in joining column data types",
+                 cudf::data_type_error);
+    CUDF_EXPECTS(cudf::have_same_types(probe_conditional, _probe_conditional_schema->view()),
+                 "The probe conditional table does not match the schema of the mixed join",
+                 cudf::data_type_error);
+
+    auto const probe_num_rows = probe_equality.num_rows();
+    if (probe_num_rows == 0 or (join_type == join_kind::INNER_JOIN and
+                                _build_equality.num_rows() == 0)) {
+      return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                       std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+    }
+    if (_build_equality.num_rows() == 0) {
+      return get_trivial_left_join_indices(probe_equality, stream, mr);
+    }
+
+    auto const has_nulls = cudf::nullate::DYNAMIC{
+      _build_has_nulls || cudf::has_nulls(probe_equality) ||
+      _binary_predicate.may_evaluate_null(probe_conditional, _build_conditional, stream)};
+    if (has_nulls) {
+      return probe<true>(probe_equality, probe_conditional, join_type, stream, mr);
+    }
+    return probe<false>(probe_equality, probe_conditional, join_type, stream, mr);
+  }
+
+ private:
+  template <bool has_nulls>
+  std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+            std::unique_ptr<rmm::device_uvector<size_type>>>
+  probe(table_view const& probe_equality,
+        table_view const& probe_conditional,
+        join_kind join_type,
+        rmm::cuda_stream_view stream,
+        rmm::device_async_resource_ref mr) const
+  {
+    auto const& parser   = has_nulls ? *_nullable_plan : *_plan;
+    auto const nullate   = cudf::nullate::DYNAMIC{has_nulls};
+    auto probe_view      = table_device_view::create(probe_equality, stream);
+    auto build_view      = table_device_view::create(_build_equality, stream);
+    auto left_cond_view  = table_device_view::create(probe_conditional, stream);
+    auto right_cond_view = table_device_view::create(_build_conditional, stream);
+
+    auto const preprocessed_probe =
+      experimental::row::equality::preprocessed_table::create(probe_equality, stream);
+    auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed_probe};
+    auto const hash_probe = row_hash.device_hasher(nullate);
+    auto const row_comparator =
+      cudf::experimental::row::equality::two_table_comparator{preprocessed_probe,
+                                                              _preprocessed_build};
+    auto const equality_probe  = row_comparator.equal_to<false>(nullate, _nulls_equal);
+    auto const hash_table_view = _hash_table.get_device_view();
+
+    auto const probe_num_rows = probe_equality.num_rows();
+    detail::grid_1d const config(probe_num_rows, DEFAULT_JOIN_BLOCK_SIZE);
+    auto const shmem_size_per_block = parser.shmem_per_thread * config.num_threads_per_block;
+
+    rmm::device_scalar<std::size_t> size(0, stream);
+    rmm::device_uvector<size_type> matches_per_row(probe_num_rows, stream);
+    compute_mixed_join_output_size<DEFAULT_JOIN_BLOCK_SIZE, has_nulls>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_cond_view,
+        *right_cond_view,
+        *probe_view,
+        *build_view,
+        hash_probe,
+        equality_probe,
+        join_type,
+        hash_table_view,
+        parser.device_expression_data,
+        false,
+        size.data(),
+        cudf::device_span<size_type>{matches_per_row});
+    auto const join_size = size.value(stream);
+    if (join_size == 0) {
+      return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                       std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+    }
+
+    // The matches of each probe row are written from the exclusive prefix sum of the counts
+    auto join_result_offsets = rmm::device_uvector<size_type>{matches_per_row.size(), stream};
+    thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                           matches_per_row.begin(),
+                           matches_per_row.end(),
+                           join_result_offsets.begin());
+
+    auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(join_size, stream, mr);
+    mixed_join<DEFAULT_JOIN_BLOCK_SIZE, has_nulls>
+      <<<config.num_blocks, config.num_threads_per_block, shmem_size_per_block, stream.value()>>>(
+        *left_cond_view,
+        *right_cond_view,
+        *probe_view,
+        *build_view,
+        hash_probe,
+        equality_probe,
+        join_type,
+        hash_table_view,
+        left_indices->data(),
+        right_indices->data(),
+        parser.device_expression_data,
+        join_result_offsets.data(),
+        false);
+    return std::pair(std::move(left_indices), std::move(right_indices));
+  }
+
+  bool const _build_has_nulls;             ///< true if the build equality table has nulls
+  cudf::null_equality const _nulls_equal;  ///< whether to consider nulls as equal
+  cudf::table_view _build_equality;        ///< build table used for the equality join
+  cudf::table_view _build_conditional;     ///< build table used for the conditional join
+  std::unique_ptr<table> _probe_conditional_schema;  ///< empty table with the probe schema
+  ast::expression const& _binary_predicate;          ///< condition on which to join
+  std::shared_ptr<experimental::row::equality::preprocessed_table>
+    _preprocessed_build;  ///< build equality table preprocessed for row operators
+  mixed_multimap_type _hash_table;  ///< hash table built on `_build_equality`
+  std::unique_ptr<ast::detail::expression_parser> _plan;  ///< expression plan without nulls
+  std::unique_ptr<ast::detail::expression_parser> _nullable_plan;  ///< plan with nulls
+};
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
@@ -591,4 +812,43 @@ mixed_full_join(
                             mr);
 }
 
+mixed_join::~mixed_join() = default;
+
+mixed_join::mixed_join(table_view const& build_equality,
+                       table_view const& build_conditional,
+                       table_view const& probe_conditional,
+                       ast::expression const& binary_predicate,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream)
+  : _impl{std::make_unique<impl_type const>(build_equality,
+                                            build_conditional,
+                                            probe_conditional,
+                                            binary_predicate,
+                                            compare_nulls,
+                                            stream)}
+{
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::inner_join(table_view const& probe_equality,
+                       table_view const& probe_conditional,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr) const
+{
+  return _impl->compute_join(
+    probe_equality, probe_conditional, detail::join_kind::INNER_JOIN, stream, mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+mixed_join::left_join(table_view const& probe_equality,
+                      table_view const& probe_conditional,
+                      rmm::cuda_stream_view stream,
+                      rmm::device_async_resource_ref mr) const
+{
+  return _impl->compute_join(
+    probe_equality, probe_conditional, detail::join_kind::LEFT_JOIN, stream, mr);
+}
+
 }  // namespace cudf
@@ -168,7 +168,7 @@ std::unique_ptr<rmm::device_uvector<size_type>> mixed_join_semi(
   semi_map_type hash_table{compute_hash_table_size(build.num_rows()),
                            cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
                            cuco::empty_value{cudf::detail::JoinNoneValue},
-                           cudf::detail::cuco_allocator{stream},
+                           cudf::detail::make_join_hash_table_allocator(stream),
                            stream.value()};
 
   // Create hash table containing all keys found in right table
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "join_common_utils.hpp"
+#include "partitioning/spill_partitions.hpp"
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/transform.h>
+
+#include <numeric>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// The partitions are chosen with a different seed than the hash tables built for the partitions,
+// otherwise all keys of a partition would share the low bits of the hash table's hash values
+constexpr uint32_t partition_seed = DEFAULT_HASH_SEED + 1;
+
+/**
+ * @brief Maps the row indices of a partition to the row indices of the input table.
+ *
+ * Indices outside of the partition, i.e. the right indices of unmatched left rows, are set to
+ * `JoinNoneValue`.
+ */
+void map_to_input_rows(rmm::device_uvector<size_type>& indices,
+                       column_view const& row_indices,
+                       rmm::cuda_stream_view stream)
+{
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    indices.begin(),
+    indices.end(),
+    indices.begin(),
+    [rows = row_indices.begin<size_type>(), num_rows = row_indices.size()] __device__(auto idx) {
+      return idx >= 0 && idx < num_rows ? rows[idx] : JoinNoneValue;
+    });
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_join(table_view const& left_input,
+                 table_view const& right_input,
+                 size_type num_partitions,
+                 join_kind kind,
+                 null_equality compare_nulls,
+                 rmm::cuda_stream_view stream,
+                 rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(num_partitions > 0, "Number of partitions must be positive", std::invalid_argument);
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  // Make sure any dictionary columns have matched key sets.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input}, stream, rmm::mr::get_current_device_resource());
+  auto const left      = matched.second.front();
+  auto const right     = matched.second.back();
+  auto const has_nulls = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
+                           ? cudf::nullable_join::YES
+                           : cudf::nullable_join::NO;
+
+  std::vector<size_type> key_indices(left.num_columns());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  // A column of the original row indices is appended to the keys so that the join results of the
+  // partitions can be mapped back to the input rows
+  auto const left_partitions =
+    spill_hash_partitions(left, key_indices, num_partitions, true, partition_seed, stream);
+  auto const right_partitions =
+    spill_hash_partitions(right, key_indices, num_partitions, true, partition_seed, stream);
+  auto const num_keys = left.num_columns();
+
+  // Rows of different partitions never match, so each pair of partitions is joined on its own
+  std::vector<std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+                        std::unique_ptr<rmm::device_uvector<size_type>>>>
+    partition_results;
+  for (size_type p = 0; p < num_partitions; ++p) {
+    if (left_partitions[p].empty()) { continue; }
+    if (kind == join_kind::INNER_JOIN && right_partitions[p].empty()) { continue; }
+
+    auto const left_part  = unspill_partition(left_partitions[p], stream);
+    auto const left_view  = left_part->view();
+    auto const left_rows  = left_view.column(num_keys);
+    auto const left_keys  = left_view.select(key_indices);
+    auto const right_part = right_partitions[p].empty()
+                              ? empty_like(right)
+                              : unspill_partition(right_partitions[p], stream);
+    auto const right_keys = right_part->view().select(key_indices);
+
+    cudf::hash_join hj_obj(right_keys, has_nulls, compare_nulls, stream);
+    auto result = kind == join_kind::INNER_JOIN
+                    ? hj_obj.inner_join(left_keys, std::nullopt, stream)
+                    : hj_obj.left_join(left_keys, std::nullopt, stream);
+
+    map_to_input_rows(*result.first, left_rows, stream);
+    if (not right_partitions[p].empty()) {
+      map_to_input_rows(*result.second, right_part->view().column(num_keys), stream);
+    }
+    partition_results.push_back(std::move(result));
+  }
+
+  auto const output_size = std::accumulate(partition_results.begin(),
+                                           partition_results.end(),
+                                           std::size_t{0},
+                                           [](auto sum, auto const& result) {
+                                             return sum + result.first->size();
+                                           });
+  auto left_indices  = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  auto right_indices = std::make_unique<rmm::device_uvector<size_type>>(output_size, stream, mr);
+  std::size_t offset = 0;
+  for (auto const& [left_result, right_result] : partition_results) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(left_indices->data() + offset,
+                                  left_result->data(),
+                                  left_result->size() * sizeof(size_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    CUDF_CUDA_TRY(cudaMemcpyAsync(right_indices->data() + offset,
+                                  right_result->data(),
+                                  right_result->size() * sizeof(size_type),
+                                  cudaMemcpyDefault,
+                                  stream.value()));
+    offset += left_result->size();
+  }
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_inner_join(table_view const& left_keys,
+                       table_view const& right_keys,
+                       size_type num_partitions,
+                       null_equality compare_nulls,
+                       rmm::cuda_stream_view stream,
+                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(left_keys,
+                                  right_keys,
+                                  num_partitions,
+                                  detail::join_kind::INNER_JOIN,
+                                  compare_nulls,
+                                  stream,
+                                  mr);
+}
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+partitioned_left_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      size_type num_partitions,
+                      null_equality compare_nulls,
+                      rmm::cuda_stream_view stream,
+                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::partitioned_join(left_keys,
+                                  right_keys,
+                                  num_partitions,
+                                  detail::join_kind::LEFT_JOIN,
+                                  compare_nulls,
+                                  stream,
+                                  mr);
+}
+
+}  // namespace cudf
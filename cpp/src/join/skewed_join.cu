@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join_common_utils.cuh"
+
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/join.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the indices of the rows for which `predicate` is true.
+ */
+template <typename Predicate>
+rmm::device_uvector<size_type> select_rows(size_type num_rows,
+                                           Predicate predicate,
+                                           rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<size_type> rows(num_rows, stream);
+  auto const end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                   thrust::counting_iterator<size_type>(0),
+                                   thrust::counting_iterator<size_type>(num_rows),
+                                   rows.begin(),
+                                   predicate);
+  rows.resize(thrust::distance(rows.begin(), end), stream);
+  return rows;
+}
+
+/**
+ * @brief Gathers the rows of `input` at `rows`.
+ */
+std::unique_ptr<table> gather_rows(table_view const& input,
+                                   device_span<size_type const> rows,
+                                   rmm::cuda_stream_view stream)
+{
+  return cudf::detail::gather(input,
+                              rows,
+                              out_of_bounds_policy::DONT_CHECK,
+                              negative_index_policy::NOT_ALLOWED,
+                              stream,
+                              rmm::mr::get_current_device_resource());
+}
+
+}  // namespace
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_inner_join(table_view const& left_input,
+                  table_view const& right_input,
+                  null_equality compare_nulls,
+                  size_type heavy_hitter_threshold,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(heavy_hitter_threshold > 0,
+               "The heavy hitter threshold must be positive",
+               std::invalid_argument);
+  CUDF_EXPECTS(left_input.num_columns() == right_input.num_columns(),
+               "Mismatch in number of columns to be joined on");
+
+  // Make sure any dictionary columns have matched key sets.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    {left_input, right_input}, stream, rmm::mr::get_current_device_resource());
+  auto const left      = matched.second.front();
+  auto const right     = matched.second.back();
+  auto const has_nulls = cudf::has_nested_nulls(left) || cudf::has_nested_nulls(right)
+                           ? cudf::nullable_join::YES
+                           : cudf::nullable_join::NO;
+
+  if (left.num_rows() == 0 || right.num_rows() == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // Equal right rows are adjacent in sorted order, and the size of their run is the number of
+  // matches of each left row with the same key
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const right_order  = cudf::detail::sorted_order(right, {}, {}, stream, temp_mr);
+  auto const order        = right_order->view().begin<size_type>();
+  auto const sorted_right = cudf::detail::gather(right,
+                                                 right_order->view(),
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 temp_mr);
+  auto const run_begins =
+    cudf::detail::lower_bound(sorted_right->view(), sorted_right->view(), {}, {}, stream, temp_mr);
+  auto const run_ends =
+    cudf::detail::upper_bound(sorted_right->view(), sorted_right->view(), {}, {}, stream, temp_mr);
+  auto const is_heavy = [begins    = run_begins->view().begin<size_type>(),
+                         ends      = run_ends->view().begin<size_type>(),
+                         threshold = heavy_hitter_threshold] __device__(size_type row) {
+    return ends[row] - begins[row] >= threshold;
+  };
+
+  // The light right rows are joined with a regular hash join
+  auto light_rows = select_rows(
+    right.num_rows(), [is_heavy] __device__(size_type row) { return not is_heavy(row); }, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    light_rows.begin(),
+                    light_rows.end(),
+                    light_rows.begin(),
+                    [order] __device__(size_type row) { return order[row]; });
+  VectorPair light_result{std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr)};
+  if (not light_rows.is_empty()) {
+    auto const light_right = gather_rows(right, light_rows, stream);
+    cudf::hash_join hj_obj(light_right->view(), has_nulls, compare_nulls, stream);
+    light_result = hj_obj.inner_join(left, std::nullopt, stream, mr);
+    // Map the build indices of the light rows back to the rows of the right table
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      light_result.second->begin(),
+                      light_result.second->end(),
+                      light_result.second->begin(),
+                      [light_rows = light_rows.data()] __device__(size_type row) {
+                        return light_rows[row];
+                      });
+  }
+
+  // The heavy hitters are joined through a table of their distinct keys. Each matching left row
+  // then produces the whole run of the key, which is split evenly over the threads.
+  auto const heavy_run_begins = select_rows(
+    right.num_rows(),
+    [is_heavy, begins = run_begins->view().begin<size_type>()] __device__(size_type row) {
+      return is_heavy(row) and begins[row] == row;
+    },
+    stream);
+  VectorPair heavy_result{std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                          std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr)};
+  if (not heavy_run_begins.is_empty()) {
+    auto const heavy_keys = gather_rows(sorted_right->view(), heavy_run_begins, stream);
+    cudf::hash_join hj_obj(heavy_keys->view(), has_nulls, compare_nulls, stream);
+    auto const [left_rows, heavy_keys_rows] = hj_obj.inner_join(left, std::nullopt, stream);
+
+    rmm::device_uvector<size_type> run_sizes(heavy_keys_rows->size(), stream);
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      heavy_keys_rows->begin(),
+      heavy_keys_rows->end(),
+      run_sizes.begin(),
+      [run_begins = heavy_run_begins.data(),
+       ends       = run_ends->view().begin<size_type>()] __device__(size_type key) {
+        return ends[run_begins[key]] - run_begins[key];
+      });
+    // The output pairs are first assigned to their runs, i.e. to the heavy join pairs
+    auto [left_indices, offsets] = assign_pairs_to_runs(run_sizes, stream, mr);
+    auto right_indices =
+      std::make_unique<rmm::device_uvector<size_type>>(left_indices->size(), stream, mr);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       static_cast<size_type>(left_indices->size()),
+                       [offsets       = offsets.data(),
+                        left_rows     = left_rows->data(),
+                        keys          = heavy_keys_rows->data(),
+                        run_begins    = heavy_run_begins.data(),
+                        order,
+                        left_indices  = left_indices->data(),
+                        right_indices = right_indices->data()] __device__(size_type idx) {
+                         auto const run      = left_indices[idx];
+                         auto const position = run_begins[keys[run]] + (idx - offsets[run]);
+                         left_indices[idx]   = left_rows[run];
+                         right_indices[idx]  = order[position];
+                       });
+    heavy_result = VectorPair{std::move(left_indices), std::move(right_indices)};
+  }
+
+  return concatenate_vector_pairs(light_result, heavy_result, stream);
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+skewed_inner_join(table_view const& left_keys,
+                  table_view const& right_keys,
+                  null_equality compare_nulls,
+                  size_type heavy_hitter_threshold,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::skewed_inner_join(
+    left_keys, right_keys, compare_nulls, heavy_hitter_threshold, stream, mr);
+}
+
+}  // namespace cudf
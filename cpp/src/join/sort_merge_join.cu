@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "join_common_utils.cuh"
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/join.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+
+#include <memory>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      bool check_sorted,
+                      rmm::cuda_stream_view stream,
+                      rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(0 != left_keys.num_columns(), "Left table is empty");
+  CUDF_EXPECTS(left_keys.num_columns() == right_keys.num_columns(),
+               "Mismatch in number of columns to be joined on");
+  CUDF_EXPECTS(cudf::have_same_types(left_keys, right_keys),
+               "Mismatch in joining column data types",
+               cudf::data_type_error);
+  if (check_sorted) {
+    CUDF_EXPECTS(cudf::is_sorted(left_keys, column_order, null_precedence, stream) and
+                   cudf::is_sorted(right_keys, column_order, null_precedence, stream),
+                 "The join keys must be sorted in the given order",
+                 std::invalid_argument);
+  }
+
+  if (left_keys.num_rows() == 0 or right_keys.num_rows() == 0) {
+    return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                     std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+  }
+
+  // The matches of each left row are the run of equal rows in the sorted right table, which is
+  // bounded by the lower and upper bounds of the left row in the right table
+  auto const temp_mr = rmm::mr::get_current_device_resource();
+  auto const lower   = cudf::detail::lower_bound(
+    right_keys, left_keys, column_order, null_precedence, stream, temp_mr);
+  auto const upper = cudf::detail::upper_bound(
+    right_keys, left_keys, column_order, null_precedence, stream, temp_mr);
+
+  // Rows with null keys never match when nulls are unequal
+  auto const row_bitmask =
+    compare_nulls == null_equality::UNEQUAL and cudf::has_nulls(left_keys)
+      ? cudf::detail::bitmask_and(left_keys, stream, temp_mr).first
+      : rmm::device_buffer{0, stream};
+
+  auto const num_left_rows = left_keys.num_rows();
+  rmm::device_uvector<size_type> match_counts(num_left_rows, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_left_rows),
+    match_counts.begin(),
+    [lower       = lower->view().begin<size_type>(),
+     upper       = upper->view().begin<size_type>(),
+     row_bitmask = static_cast<bitmask_type const*>(row_bitmask.data())] __device__(size_type row) {
+      if (row_bitmask != nullptr and not bit_is_set(row_bitmask, row)) { return size_type{0}; }
+      return upper[row] - lower[row];
+    });
+
+  // The run of matches of each left row is split evenly over the threads, so that keys with many
+  // matches do not leave the other threads idle
+  auto [left_indices, offsets] = assign_pairs_to_runs(match_counts, stream, mr);
+  auto right_indices =
+    std::make_unique<rmm::device_uvector<size_type>>(left_indices->size(), stream, mr);
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    static_cast<size_type>(left_indices->size()),
+    [offsets       = offsets.data(),
+     lower         = lower->view().begin<size_type>(),
+     left_indices  = left_indices->data(),
+     right_indices = right_indices->data()] __device__(size_type idx) {
+      auto const left_row = left_indices[idx];
+      right_indices[idx]  = lower[left_row] + static_cast<size_type>(idx - offsets[left_row]);
+    });
+
+  return std::pair(std::move(left_indices), std::move(right_indices));
+}
+
+}  // namespace detail
+
+std::pair<std::unique_ptr<rmm::device_uvector<size_type>>,
+          std::unique_ptr<rmm::device_uvector<size_type>>>
+sort_merge_inner_join(table_view const& left_keys,
+                      table_view const& right_keys,
+                      std::vector<order> const& column_order,
+                      std::vector<null_order> const& null_precedence,
+                      null_equality compare_nulls,
+                      bool check_sorted,
+                      rmm::cuda_stream_view stream,
+                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::sort_merge_inner_join(left_keys,
+                                       right_keys,
+                                       column_order,
+                                       null_precedence,
+                                       compare_nulls,
+                                       check_sorted,
+                                       stream,
+                                       mr);
+}
+
+}  // namespace cudf
@@ -20,30 +20,49 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/io/detail/tokenize_json.hpp>
+#include <cudf/io/json.hpp>
 #include <cudf/json/json.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/host_vector.h>
+#include <thrust/iterator/counting_iterator.h>
 #include <thrust/optional.h>
 #include <thrust/pair.h>
 #include <thrust/scan.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <string>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 
@@ -305,6 +324,14 @@ class json_state : private parser {
   // skip the next element
   __device__ parse_result skip_element() { return extract_element(nullptr, false); }
 
+  // make the element starting at `start` the current element, for elements that were
+  // located without walking through the json (e.g. from a token stream)
+  __device__ void set_current_element(char const* start, json_element_type type)
+  {
+    cur_el_start = start;
+    cur_el_type  = type;
+  }
+
   // advance to the next element
   __device__ parse_result next_element() { return next_element_internal(false); }
 
@@ -900,78 +927,480 @@ __device__ thrust::pair<parse_result, json_output> get_json_object_single(
 }
 
 /**
- * @brief Kernel for running the JSONPath query.
+ * @brief Result of locating the value addressed by a JSONPath in the token stream of a row.
+ */
+enum class token_match_result {
+  FOUND,          // the value was found
+  NOT_FOUND,      // the path does not address anything, the result is null
+  MISSING_FIELD,  // the last field is missing and `missing_fields_as_nulls` is set
+  FALLBACK,       // the token stream cannot answer the query; use the character parser
+};
+
+struct token_match {
+  token_match_result result;
+  char const* start{nullptr};    // first character of the value, if found
+  json_element_type type{NONE};  // type of the value, if found
+};
+
+/**
+ * @brief Token stream of the input column produced by the JSON lines tokenizer.
+ *
+ * Used to locate the value addressed by a path without any character-level parsing. Only
+ * paths without wildcards are evaluated this way. Rows whose tokens do not describe a
+ * complete object or array (including rows with errors) fall back to the character parser.
+ */
+struct json_row_tokens {
+  cudf::io::json::PdaTokenT const* tokens{nullptr};  ///< Token types; nullptr when disabled
+  cudf::io::json::SymbolOffsetT const* token_offsets{nullptr};  ///< Offset of each token
+  int64_t const* row_tokens{nullptr};  ///< Index of the first token of each row
+  cudf::detail::input_offsetalator row_offsets;  ///< Offsets of the rows in the input column
+
+  // rows are tokenized with a delimiter appended to each of them
+  __device__ int64_t row_start(size_type row) const
+  {
+    return row_offsets[row] - row_offsets[0] + row;
+  }
+
+  __device__ static bool is_value_begin(cudf::io::json::PdaTokenT token)
+  {
+    return token == cudf::io::json::token_t::StructBegin ||
+           token == cudf::io::json::token_t::ListBegin ||
+           token == cudf::io::json::token_t::StringBegin ||
+           token == cudf::io::json::token_t::ValueBegin;
+  }
+
+  __device__ static bool is_value_end(cudf::io::json::PdaTokenT token)
+  {
+    return token == cudf::io::json::token_t::StructEnd ||
+           token == cudf::io::json::token_t::ListEnd ||
+           token == cudf::io::json::token_t::StringEnd ||
+           token == cudf::io::json::token_t::ValueEnd;
+  }
+
+  /**
+   * @brief Returns the index of the token following the value starting at token `idx`,
+   * or `end` if the value is not complete within `[idx, end)`.
+   */
+  __device__ int64_t skip_value(int64_t idx, int64_t end) const
+  {
+    int depth = 0;
+    for (; idx < end; ++idx) {
+      auto const token = tokens[idx];
+      if (token == cudf::io::json::token_t::ErrorBegin) { return end; }
+      if (is_value_begin(token)) { ++depth; }
+      if (is_value_end(token) && --depth == 0) { return idx + 1; }
+    }
+    return end;
+  }
+
+  /**
+   * @brief Locate the value addressed by `commands` in the row `str`.
+   *
+   * Mirrors the results of `parse_json_path` for paths made of CHILD and CHILD_INDEX
+   * operators.
+   */
+  __device__ token_match match(string_view const& str,
+                               size_type row,
+                               path_operator const* commands,
+                               get_json_object_options const& options) const
+  {
+    using cudf::io::json::token_t;
+    auto const fallback  = token_match{token_match_result::FALLBACK};
+    auto const row_begin = row_start(row);
+    auto const end       = row_tokens[row + 1];
+    auto idx             = row_tokens[row];
+    // position of the character of a token within the row
+    auto const token_data = [&](int64_t token) {
+      return str.data() + (token_offsets[token] - row_begin);
+    };
+
+    // the character parser treats scalar roots differently, so leave those to it
+    if (idx >= end || (tokens[idx] != token_t::StructBegin && tokens[idx] != token_t::ListBegin)) {
+      return fallback;
+    }
+
+    // the first command is always the root
+    for (auto op = commands + 1; op->type != path_operator_type::END; ++op) {
+      if (op->type == path_operator_type::CHILD) {
+        if (tokens[idx] != token_t::StructBegin) { return {token_match_result::NOT_FOUND}; }
+        bool found  = false;
+        bool empty  = true;
+        auto member = idx + 1;
+        while (!found) {
+          while (member < end && (tokens[member] == token_t::StructMemberBegin ||
+                                  tokens[member] == token_t::StructMemberEnd)) {
+            ++member;
+          }
+          if (member >= end) { return fallback; }
+          if (tokens[member] == token_t::StructEnd) {
+            return {options.get_missing_fields_as_nulls() && !empty
+                      ? token_match_result::MISSING_FIELD
+                      : token_match_result::NOT_FOUND};
+          }
+          if (member + 2 >= end || tokens[member] != token_t::FieldNameBegin ||
+              tokens[member + 1] != token_t::FieldNameEnd || !is_value_begin(tokens[member + 2])) {
+            return fallback;
+          }
+          auto const name_begin = token_data(member) + 1;
+          auto const name_size  = static_cast<size_type>(token_data(member + 1) - name_begin);
+          empty                 = false;
+          found                 = string_view(name_begin, name_size) == op->name;
+          member                = found ? member + 2 : skip_value(member + 2, end);
+        }
+        idx = member;
+      } else if (op->type == path_operator_type::CHILD_INDEX) {
+        if (tokens[idx] != token_t::ListBegin) { return {token_match_result::NOT_FOUND}; }
+        auto element = idx + 1;
+        for (int count = 0;; ++count) {
+          if (element >= end) { return fallback; }
+          if (tokens[element] == token_t::ListEnd) { return {token_match_result::NOT_FOUND}; }
+          if (!is_value_begin(tokens[element])) { return fallback; }
+          if (count == op->index) { break; }
+          element = skip_value(element, end);
+        }
+        idx = element;
+      } else {
+        return fallback;
+      }
+    }
+
+    auto const type = tokens[idx] == token_t::StructBegin ? OBJECT
+                      : tokens[idx] == token_t::ListBegin ? ARRAY
+                                                          : VALUE;
+    return {token_match_result::FOUND, token_data(idx), type};
+  }
+};
+
+/**
+ * @brief Device views of the per-path buffers of a multi-path query.
+ *
+ * The sizes and validity are stored path-major: the entry of row `r` for path `p` is at
+ * `p * num_rows + r`.
+ */
+struct json_paths_buffers {
+  path_operator const* const* commands;  ///< Command buffer per path; nullptr for empty queries
+  size_type num_paths;                   ///< Number of paths
+  size_type* sizes;                      ///< Output sizes (filled in the size computation step)
+  cudf::detail::input_offsetalator const* output_offsets;  ///< Output offsets per path
+  char* const* out_bufs;  ///< Output chars per path (nullptr in the size computation step)
+  bool* out_validity;     ///< Output validity (filled in the output step)
+  json_row_tokens row_tokens;  ///< Token stream of the input, if tokenized
+  bool const* token_paths;      ///< Whether each path can be evaluated on the token stream
+};
+
+/**
+ * @brief Apply one path of a multi-path query to one row.
+ *
+ * @param str The json string of the row
+ * @param row Index of the row
+ * @param num_rows Number of rows in the input
+ * @param path Index of the path to apply
+ * @param buffers Per-path buffers
+ * @param options Options controlling behavior
+ */
+__device__ void get_json_object_path(string_view const& str,
+                                     size_type row,
+                                     size_type num_rows,
+                                     size_type path,
+                                     json_paths_buffers const& buffers,
+                                     get_json_object_options options)
+{
+  auto const commands   = buffers.commands[path];
+  bool is_valid         = false;
+  size_type output_size = 0;
+  if (str.size_bytes() > 0 && commands != nullptr) {
+    auto const has_output = buffers.out_bufs != nullptr;
+    char* dst = has_output ? buffers.out_bufs[path] + buffers.output_offsets[path][row] : nullptr;
+    size_t const dst_size =
+      has_output ? buffers.output_offsets[path][row + 1] - buffers.output_offsets[path][row] : 0;
+
+    auto const match = buffers.row_tokens.tokens != nullptr && buffers.token_paths[path]
+                         ? buffers.row_tokens.match(str, row, commands, options)
+                         : token_match{token_match_result::FALLBACK};
+
+    parse_result result = parse_result::SUCCESS;
+    json_output out{dst_size, dst};
+    if (match.result == token_match_result::FOUND) {
+      json_state j_state(str.data(), str.size_bytes(), options);
+      j_state.set_current_element(match.start, match.type);
+      result = j_state.extract_element(&out, false);
+    } else if (match.result == token_match_result::MISSING_FIELD) {
+      out.add_output({"null", 4});
+    } else if (match.result == token_match_result::FALLBACK) {
+      thrust::tie(result, out) =
+        get_json_object_single(str.data(), str.size_bytes(), commands, dst, dst_size, options);
+    }
+    output_size = out.output_len.value_or(0);
+    if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+  }
+
+  auto const idx = static_cast<int64_t>(path) * num_rows + row;
+  // filled in only during the precompute step. during the compute step, the offsets
+  // are fed back in so we do -not- want to write them out
+  if (buffers.out_bufs == nullptr) {
+    buffers.sizes[idx] = output_size;
+  } else {
+    buffers.out_validity[idx] = is_valid;
+  }
+}
+
+/**
+ * @brief Kernel for running a multi-path JSONPath query with one thread per row.
+ *
+ * Each thread applies every path to its row, so the row is read from global memory once
+ * and stays in cache for the remaining paths.
  *
  * This kernel operates in a 2-pass way.  On the first pass, it computes
  * output sizes.  On the second pass it fills in the provided output buffers
  * (chars and validity)
  *
  * @param col Device view of the incoming string
- * @param commands JSONPath command buffer
- * @param output_offsets Buffer used to store the string offsets for the results of the query
- * @param out_buf Buffer used to store the results of the query
- * @param out_validity Output validity buffer
- * @param out_valid_count Output count of # of valid bits
+ * @param buffers Per-path buffers
  * @param options Options controlling behavior
  */
 template <int block_size>
 __launch_bounds__(block_size) CUDF_KERNEL
   void get_json_object_kernel(column_device_view col,
-                              path_operator const* const commands,
-                              size_type* d_sizes,
-                              cudf::detail::input_offsetalator output_offsets,
-                              thrust::optional<char*> out_buf,
-                              thrust::optional<bitmask_type*> out_validity,
-                              thrust::optional<size_type*> out_valid_count,
+                              json_paths_buffers buffers,
                               get_json_object_options options)
 {
-  auto tid          = cudf::detail::grid_1d::global_thread_id();
-  auto const stride = cudf::thread_index_type{blockDim.x} * cudf::thread_index_type{gridDim.x};
-
-  size_type warp_valid_count{0};
-
-  auto active_threads = __ballot_sync(0xffff'ffffu, tid < col.size());
-  while (tid < col.size()) {
-    bool is_valid         = false;
-    string_view const str = col.element<string_view>(tid);
-    size_type output_size = 0;
-    if (str.size_bytes() > 0) {
-      char* dst = out_buf.has_value() ? out_buf.value() + output_offsets[tid] : nullptr;
-      size_t const dst_size =
-        out_buf.has_value() ? output_offsets[tid + 1] - output_offsets[tid] : 0;
-
-      parse_result result;
-      json_output out;
-      thrust::tie(result, out) =
-        get_json_object_single(str.data(), str.size_bytes(), commands, dst, dst_size, options);
-      output_size = out.output_len.value_or(0);
-      if (out.output_len.has_value() && result == parse_result::SUCCESS) { is_valid = true; }
+  auto const stride = cudf::detail::grid_1d::grid_stride();
+  for (auto tid = cudf::detail::grid_1d::global_thread_id(); tid < col.size(); tid += stride) {
+    auto const row        = static_cast<size_type>(tid);
+    string_view const str = col.element<string_view>(row);
+    for (size_type path = 0; path < buffers.num_paths; ++path) {
+      get_json_object_path(str, row, col.size(), path, buffers, options);
     }
+  }
+}
 
-    // filled in only during the precompute step. during the compute step, the offsets
-    // are fed back in so we do -not- want to write them out
-    if (!out_buf.has_value()) { d_sizes[tid] = output_size; }
-
-    // validity filled in only during the output step
-    if (out_validity.has_value()) {
-      uint32_t mask = __ballot_sync(active_threads, is_valid);
-      // 0th lane of the warp writes the validity
-      if (!(tid % cudf::detail::warp_size)) {
-        out_validity.value()[cudf::word_index(tid)] = mask;
-        warp_valid_count += __popc(mask);
-      }
+/**
+ * @brief Kernel for running a multi-path JSONPath query with one warp per row.
+ *
+ * The lanes of a warp apply different paths to the same row. This is used for long
+ * documents where a single thread evaluating every path would serialize too much work
+ * on one row.
+ *
+ * @param col Device view of the incoming string
+ * @param buffers Per-path buffers
+ * @param options Options controlling behavior
+ */
+template <int block_size>
+__launch_bounds__(block_size) CUDF_KERNEL
+  void get_json_object_warp_kernel(column_device_view col,
+                                   json_paths_buffers buffers,
+                                   get_json_object_options options)
+{
+  auto const tid     = cudf::detail::grid_1d::global_thread_id();
+  auto const stride  = cudf::detail::grid_1d::grid_stride() / cudf::detail::warp_size;
+  auto const lane_id = static_cast<size_type>(tid % cudf::detail::warp_size);
+  for (auto warp_id = tid / cudf::detail::warp_size; warp_id < col.size(); warp_id += stride) {
+    auto const row        = static_cast<size_type>(warp_id);
+    string_view const str = col.element<string_view>(row);
+    for (auto path = lane_id; path < buffers.num_paths; path += cudf::detail::warp_size) {
+      get_json_object_path(str, row, col.size(), path, buffers, options);
+    }
+  }
+}
+
+/**
+ * @brief Owns the token stream of an input column and the row boundaries within it.
+ */
+struct tokenized_rows {
+  rmm::device_uvector<cudf::io::json::PdaTokenT> tokens;
+  rmm::device_uvector<cudf::io::json::SymbolOffsetT> token_offsets;
+  rmm::device_uvector<int64_t> row_tokens;
+};
+
+/**
+ * @brief Tokenize all rows of the input as a single JSON lines input.
+ *
+ * A line delimiter is appended to each row. Delimiters nested inside an incomplete row are
+ * treated as whitespace by the tokenizer, so such rows may produce tokens that run into
+ * the following rows; `json_row_tokens::match` falls back for those rows.
+ *
+ * @param col The input strings column
+ * @param input_size Number of chars of the rows plus one delimiter per row
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The token stream and the index of the first token of each row
+ */
+tokenized_rows tokenize_rows(cudf::strings_column_view const& col,
+                             int64_t input_size,
+                             rmm::cuda_stream_view stream)
+{
+  auto const d_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(col.offsets(), col.offset());
+  auto d_input = rmm::device_uvector<char>(input_size, stream);
+  auto const d_chars = col.chars_begin(stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<size_type>(0),
+                     col.size(),
+                     [d_offsets, d_chars, d_input = d_input.data()] __device__(size_type row) {
+                       auto const begin = d_offsets[row];
+                       auto const size  = d_offsets[row + 1] - begin;
+                       auto const dst   = d_input + (begin - d_offsets[0]) + row;
+                       memcpy(dst, d_chars + begin, size);
+                       dst[size] = '\n';
+                     });
+
+  cudf::io::json_reader_options options{};
+  options.enable_lines(true);
+  auto [tokens, token_offsets] = cudf::io::json::detail::get_token_stream(
+    d_input, options, stream, rmm::mr::get_current_device_resource());
+
+  // the first token of each row is the first token at or after the start of the row
+  auto const row_starts = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<cudf::io::json::SymbolOffsetT>(
+      [d_offsets] __device__(size_type row) {
+        return static_cast<cudf::io::json::SymbolOffsetT>(d_offsets[row] - d_offsets[0] + row);
+      }));
+  auto row_tokens = rmm::device_uvector<int64_t>(col.size() + 1, stream);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      token_offsets.begin(),
+                      token_offsets.end(),
+                      row_starts,
+                      row_starts + col.size() + 1,
+                      row_tokens.begin());
+  return {std::move(tokens), std::move(token_offsets), std::move(row_tokens)};
+}
+
+// average row size in bytes above which paths without wildcards are evaluated on the token
+// stream instead of parsing every row character by character for every path
+constexpr int64_t token_stream_threshold = 4096;
+
+// average row size in bytes above which multi-path queries run with a warp per row
+constexpr int64_t warp_per_row_threshold = 1024;
+
+std::unique_ptr<cudf::table> get_json_object(
+  cudf::strings_column_view const& col,
+  host_span<std::reference_wrapper<cudf::string_scalar const> const> json_paths,
+  get_json_object_options options,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  // preprocess each json_path into a command buffer
+  std::vector<thrust::optional<rmm::device_uvector<path_operator>>> command_buffers;
+  std::vector<path_operator const*> h_commands;
+  thrust::host_vector<bool> h_token_paths;
+  for (auto const& json_path : json_paths) {
+    auto [commands, max_stack_depth] = build_command_buffer(json_path.get(), stream);
+    CUDF_EXPECTS(max_stack_depth <= max_command_stack_depth,
+                 "Encountered JSONPath string that is too complex");
+    // an empty query produces a column containing all nulls
+    h_commands.push_back(commands.has_value() ? commands.value().data() : nullptr);
+    // the token stream is only used for paths without wildcards
+    h_token_paths.push_back(commands.has_value() && max_stack_depth == 1);
+    command_buffers.push_back(std::move(commands));
+  }
+
+  auto const num_paths = static_cast<size_type>(json_paths.size());
+  auto const num_rows  = col.size();
+  std::vector<std::unique_ptr<column>> results;
+  if (col.is_empty()) {
+    for (size_type path = 0; path < num_paths; ++path) {
+      results.push_back(make_empty_column(type_id::STRING));
     }
+    return std::make_unique<table>(std::move(results));
+  }
+
+  auto const d_commands = cudf::detail::make_device_uvector_async(
+    h_commands, stream, rmm::mr::get_current_device_resource());
+  auto sizes = rmm::device_uvector<size_type>(
+    static_cast<std::size_t>(num_paths) * num_rows, stream, rmm::mr::get_current_device_resource());
+  json_paths_buffers buffers{
+    d_commands.data(), num_paths, sizes.data(), nullptr, nullptr, nullptr, {}, nullptr};
+
+  auto const chars_size =
+    cudf::strings::detail::get_offset_value(col.offsets(), col.offset() + num_rows, stream) -
+    cudf::strings::detail::get_offset_value(col.offsets(), col.offset(), stream);
+  auto const avg_row_size = chars_size / num_rows;
+
+  // long documents are tokenized once for all paths; the tokenizer does not handle single
+  // quotes and addresses its input with 32-bit offsets
+  auto const tokenized_size = chars_size + num_rows;
+  auto const use_tokens =
+    avg_row_size >= token_stream_threshold && !options.get_allow_single_quotes() &&
+    tokenized_size < std::numeric_limits<cudf::io::json::SymbolOffsetT>::max() &&
+    std::any_of(h_token_paths.begin(), h_token_paths.end(), [](bool v) { return v; });
+  auto const d_token_paths = cudf::detail::make_device_uvector_async(
+    h_token_paths, stream, rmm::mr::get_current_device_resource());
+  auto const row_tokens =
+    use_tokens ? std::make_optional(tokenize_rows(col, tokenized_size, stream)) : std::nullopt;
+  if (row_tokens.has_value()) {
+    buffers.row_tokens = json_row_tokens{
+      row_tokens->tokens.data(),
+      row_tokens->token_offsets.data(),
+      row_tokens->row_tokens.data(),
+      cudf::detail::offsetalator_factory::make_input_iterator(col.offsets(), col.offset())};
+    buffers.token_paths = d_token_paths.data();
+  }
+
+  constexpr int block_size = 512;
+  auto cdv                 = column_device_view::create(col.parent(), stream);
+  // lanes of a warp only help when there are several paths to spread across them
+  auto const warp_per_row = num_paths > 1 && avg_row_size >= warp_per_row_threshold;
+  auto const launch_kernel = [&] {
+    if (warp_per_row) {
+      // one block per `warps_per_block` rows
+      constexpr auto warps_per_block = block_size / cudf::detail::warp_size;
+      cudf::detail::grid_1d const grid{num_rows, warps_per_block};
+      get_json_object_warp_kernel<block_size>
+        <<<grid.num_blocks, block_size, 0, stream.value()>>>(*cdv, buffers, options);
+    } else {
+      cudf::detail::grid_1d const grid{num_rows, block_size};
+      get_json_object_kernel<block_size>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          *cdv, buffers, options);
+    }
+  };
 
-    tid += stride;
-    active_threads = __ballot_sync(active_threads, tid < col.size());
+  // compute output sizes
+  launch_kernel();
+
+  // convert sizes to offsets and allocate the output chars of each path
+  std::vector<std::unique_ptr<column>> offsets;
+  std::vector<rmm::device_uvector<char>> chars;
+  std::vector<cudf::detail::input_offsetalator> h_offsets;
+  std::vector<char*> h_out_bufs;
+  for (size_type path = 0; path < num_paths; ++path) {
+    auto const path_sizes = sizes.begin() + static_cast<std::size_t>(path) * num_rows;
+    auto [path_offsets, output_size] = cudf::strings::detail::make_offsets_child_column(
+      path_sizes, path_sizes + num_rows, stream, mr);
+    h_offsets.push_back(
+      cudf::detail::offsetalator_factory::make_input_iterator(path_offsets->view()));
+    chars.emplace_back(output_size, stream, mr);
+    h_out_bufs.push_back(chars.back().data());
+    offsets.push_back(std::move(path_offsets));
   }
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    h_offsets, stream, rmm::mr::get_current_device_resource());
+  auto const d_out_bufs = cudf::detail::make_device_uvector_async(
+    h_out_bufs, stream, rmm::mr::get_current_device_resource());
+  auto validity = rmm::device_uvector<bool>(sizes.size(), stream);
 
-  // sum the valid counts across the whole block
-  if (out_valid_count) {
-    size_type block_valid_count =
-      cudf::detail::single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
-    if (threadIdx.x == 0) { atomicAdd(out_valid_count.value(), block_valid_count); }
+  // compute results
+  buffers.output_offsets = d_offsets.data();
+  buffers.out_bufs       = d_out_bufs.data();
+  buffers.out_validity   = validity.data();
+  launch_kernel();
+
+  for (size_type path = 0; path < num_paths; ++path) {
+    auto const path_validity = validity.begin() + static_cast<std::size_t>(path) * num_rows;
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      path_validity, path_validity + num_rows, thrust::identity{}, stream, mr);
+    auto result = make_strings_column(num_rows,
+                                      std::move(offsets[path]),
+                                      chars[path].release(),
+                                      null_count,
+                                      std::move(null_mask));
+    // unmatched array query may result in unsanitized '[' value in the result
+    if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
+      result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+    }
+    results.push_back(std::move(result));
   }
+  return std::make_unique<table>(std::move(results));
 }
 
 std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& col,
@@ -980,80 +1409,24 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
                                               rmm::cuda_stream_view stream,
                                               rmm::device_async_resource_ref mr)
 {
-  // preprocess the json_path into a command buffer
-  auto preprocess = build_command_buffer(json_path, stream);
-  CUDF_EXPECTS(std::get<1>(preprocess) <= max_command_stack_depth,
-               "Encountered JSONPath string that is too complex");
-
-  if (col.is_empty()) return make_empty_column(type_id::STRING);
-
-  // if the query is empty, return a string column containing all nulls
-  if (!std::get<0>(preprocess).has_value()) {
-    return std::make_unique<column>(
-      data_type{type_id::STRING},
-      col.size(),
-      rmm::device_buffer{0, stream, mr},  // no data
-      cudf::detail::create_null_mask(col.size(), mask_state::ALL_NULL, stream, mr),
-      col.size());  // null count
-  }
-
-  // compute output sizes
-  auto sizes =
-    rmm::device_uvector<size_type>(col.size(), stream, rmm::mr::get_current_device_resource());
-  auto d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(col.offsets());
-
-  constexpr int block_size = 512;
-  cudf::detail::grid_1d const grid{col.size(), block_size};
-  auto cdv = column_device_view::create(col.parent(), stream);
-  // preprocess sizes (returned in the offsets buffer)
-  get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      thrust::nullopt,
-      thrust::nullopt,
-      thrust::nullopt,
-      options);
-
-  // convert sizes to offsets
-  auto [offsets, output_size] =
-    cudf::strings::detail::make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
-  d_offsets = cudf::detail::offsetalator_factory::make_input_iterator(offsets->view());
-
-  // allocate output string column
-  rmm::device_uvector<char> chars(output_size, stream, mr);
-
-  // potential optimization : if we know that all outputs are valid, we could skip creating
-  // the validity mask altogether
-  rmm::device_buffer validity =
-    cudf::detail::create_null_mask(col.size(), mask_state::UNINITIALIZED, stream, mr);
+  std::vector<std::reference_wrapper<cudf::string_scalar const>> const json_paths{json_path};
+  return std::move(get_json_object(col, json_paths, options, stream, mr)->release().front());
+}
 
-  // compute results
-  rmm::device_scalar<size_type> d_valid_count{0, stream};
-
-  get_json_object_kernel<block_size>
-    <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-      *cdv,
-      std::get<0>(preprocess).value().data(),
-      sizes.data(),
-      d_offsets,
-      chars.data(),
-      static_cast<bitmask_type*>(validity.data()),
-      d_valid_count.data(),
-      options);
-
-  auto result = make_strings_column(col.size(),
-                                    std::move(offsets),
-                                    chars.release(),
-                                    col.size() - d_valid_count.value(stream),
-                                    std::move(validity));
-  // unmatched array query may result in unsanitized '[' value in the result
-  if (cudf::detail::has_nonempty_nulls(result->view(), stream)) {
-    result = cudf::detail::purge_nonempty_nulls(result->view(), stream, mr);
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             host_span<std::string const> json_paths,
+                                             get_json_object_options options,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  std::vector<cudf::string_scalar> scalars;
+  scalars.reserve(json_paths.size());
+  for (auto const& json_path : json_paths) {
+    scalars.emplace_back(json_path, true, stream);
   }
-  return result;
+  std::vector<std::reference_wrapper<cudf::string_scalar const>> const refs(scalars.begin(),
+                                                                            scalars.end());
+  return get_json_object(col, refs, options, stream, mr);
 }
 
 }  // namespace
@@ -1069,4 +1442,14 @@ std::unique_ptr<cudf::column> get_json_object(cudf::strings_column_view const& c
   return detail::get_json_object(col, json_path, options, stream, mr);
 }
 
+std::unique_ptr<cudf::table> get_json_object(cudf::strings_column_view const& col,
+                                             host_span<std::string const> json_paths,
+                                             get_json_object_options options,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_json_object(col, json_paths, options, stream, mr);
+}
+
 }  // namespace cudf
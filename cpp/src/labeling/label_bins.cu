@@ -19,8 +19,11 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/label_bins.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/labeling/label_bins.hpp>
+#include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -36,9 +39,11 @@
 
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 
@@ -103,7 +108,7 @@ struct bin_finder {
 // Functor to identify rows that should be filtered out based on the sentinel set by
 // bin_finder::operator().
 struct filter_null_sentinel {
-  __device__ bool operator()(size_type i) { return i != NULL_VALUE; }
+  __device__ bool operator()(size_type i) const { return i != NULL_VALUE; }
 };
 
 // Bin the input by the edges in left_edges and right_edges.
@@ -156,12 +161,58 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return output;
 }
 
+// Size of the one-hot encoded row of a label: one index if the value is in a bin, none otherwise.
+struct labeled_size {
+  __device__ size_type operator()(size_type i) const { return i != NULL_VALUE; }
+};
+
+// One-hot encode the bins of the input as LIST<INT32> rows of at most one bin index, without
+// materializing the labels.
+template <typename T, typename LeftComparator, typename RightComparator>
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            column_view const& right_edges,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  auto input_device_view       = column_device_view::create(input, stream);
+  auto left_edges_device_view  = column_device_view::create(left_edges, stream);
+  auto right_edges_device_view = column_device_view::create(right_edges, stream);
+
+  using RandomAccessIterator = decltype(left_edges_device_view->begin<T>());
+
+  auto const finder = bin_finder<T, RandomAccessIterator, LeftComparator, RightComparator>(
+    left_edges_device_view->begin<T>(),
+    left_edges_device_view->end<T>(),
+    right_edges_device_view->begin<T>());
+
+  auto const encode = [&](auto pair_begin) {
+    auto const bins  = thrust::make_transform_iterator(pair_begin, finder);
+    auto const sizes = thrust::make_transform_iterator(bins, labeled_size{});
+    auto [offsets, num_labeled] =
+      make_offsets_child_column(sizes, sizes + input.size(), stream, mr);
+    auto indices = make_numeric_column(
+      data_type(type_to_id<size_type>()), num_labeled, mask_state::UNALLOCATED, stream, mr);
+    thrust::copy_if(rmm::exec_policy(stream),
+                    bins,
+                    bins + input.size(),
+                    indices->mutable_view().begin<size_type>(),
+                    filter_null_sentinel());
+    return make_lists_column(
+      input.size(), std::move(offsets), std::move(indices), 0, rmm::device_buffer{}, stream, mr);
+  };
+
+  return input.has_nulls() ? encode(input_device_view->pair_begin<T, true>())
+                           : encode(input_device_view->pair_begin<T, false>());
+}
+
 template <typename T>
 constexpr auto is_supported_bin_type()
 {
   return cudf::is_relationally_comparable<T, T>() && cudf::is_equality_comparable<T, T>();
 }
 
+template <bool one_hot>
 struct bin_type_dispatcher {
   template <typename T, typename... Args>
   std::enable_if_t<not detail::is_supported_bin_type<T>(), std::unique_ptr<column>> operator()(
@@ -181,22 +232,52 @@ struct bin_type_dispatcher {
     rmm::device_async_resource_ref mr)
   {
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less_equal<T>, thrust::less_equal<T>>(
+      return bin<T, thrust::less_equal<T>, thrust::less_equal<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::YES) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less_equal<T>, thrust::less<T>>(
+      return bin<T, thrust::less_equal<T>, thrust::less<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::YES))
-      return label_bins<T, thrust::less<T>, thrust::less_equal<T>>(
+      return bin<T, thrust::less<T>, thrust::less_equal<T>>(
         input, left_edges, right_edges, stream, mr);
     if ((left_inclusive == inclusive::NO) && (right_inclusive == inclusive::NO))
-      return label_bins<T, thrust::less<T>, thrust::less<T>>(
-        input, left_edges, right_edges, stream, mr);
+      return bin<T, thrust::less<T>, thrust::less<T>>(input, left_edges, right_edges, stream, mr);
 
     CUDF_FAIL("Undefined inclusive setting.");
   }
+
+ private:
+  template <typename T, typename LeftComparator, typename RightComparator>
+  std::unique_ptr<column> bin(column_view const& input,
+                              column_view const& left_edges,
+                              column_view const& right_edges,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+  {
+    if constexpr (one_hot) {
+      return one_hot_encode_bins<T, LeftComparator, RightComparator>(
+        input, left_edges, right_edges, stream, mr);
+    } else {
+      return label_bins<T, LeftComparator, RightComparator>(
+        input, left_edges, right_edges, stream, mr);
+    }
+  }
 };
 
+void validate_bins(column_view const& input,
+                   column_view const& left_edges,
+                   column_view const& right_edges)
+{
+  CUDF_EXPECTS(
+    cudf::have_same_types(input, left_edges) && cudf::have_same_types(input, right_edges),
+    "The input and edge columns must have the same types.",
+    cudf::data_type_error);
+  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
+               "The left and right edge columns must be of the same length.");
+  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
+               "The left and right edge columns cannot contain nulls.");
+}
+
 }  // anonymous namespace
 
 /// Bin the input by the edges in left_edges and right_edges.
@@ -209,20 +290,44 @@ std::unique_ptr<column> label_bins(column_view const& input,
                                    rmm::device_async_resource_ref mr)
 {
   CUDF_FUNC_RANGE()
-  CUDF_EXPECTS(
-    cudf::have_same_types(input, left_edges) && cudf::have_same_types(input, right_edges),
-    "The input and edge columns must have the same types.",
-    cudf::data_type_error);
-  CUDF_EXPECTS(left_edges.size() == right_edges.size(),
-               "The left and right edge columns must be of the same length.");
-  CUDF_EXPECTS(!left_edges.has_nulls() && !right_edges.has_nulls(),
-               "The left and right edge columns cannot contain nulls.");
+  validate_bins(input, left_edges, right_edges);
 
   // Handle empty inputs.
   if (input.is_empty()) { return make_empty_column(type_to_id<size_type>()); }
 
   return type_dispatcher<dispatch_storage_type>(input.type(),
-                                                detail::bin_type_dispatcher{},
+                                                detail::bin_type_dispatcher<false>{},
+                                                input,
+                                                left_edges,
+                                                left_inclusive,
+                                                right_edges,
+                                                right_inclusive,
+                                                stream,
+                                                mr);
+}
+
+/// Size of the one-hot encoded row of a label: one index if the value is in a bin, none otherwise.
+struct labeled_size {
+  __device__ size_type operator()(size_type i) const { return i != NULL_VALUE; }
+};
+
+// One-hot encode the bins of the input by the edges in left_edges and right_edges.
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            inclusive left_inclusive,
+                                            column_view const& right_edges,
+                                            inclusive right_inclusive,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  validate_bins(input, left_edges, right_edges);
+
+  if (input.is_empty()) {
+    return lists::detail::make_empty_lists_column(data_type(type_to_id<size_type>()), stream, mr);
+  }
+
+  return type_dispatcher<dispatch_storage_type>(input.type(),
+                                                detail::bin_type_dispatcher<true>{},
                                                 input,
                                                 left_edges,
                                                 left_inclusive,
@@ -247,4 +352,23 @@ std::unique_ptr<column> label_bins(column_view const& input,
   return detail::label_bins(
     input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
 }
+
+/// Size of the one-hot encoded row of a label: one index if the value is in a bin, none otherwise.
+struct labeled_size {
+  __device__ size_type operator()(size_type i) const { return i != NULL_VALUE; }
+};
+
+// One-hot encode the bins of the input by the edges in left_edges and right_edges.
+std::unique_ptr<column> one_hot_encode_bins(column_view const& input,
+                                            column_view const& left_edges,
+                                            inclusive left_inclusive,
+                                            column_view const& right_edges,
+                                            inclusive right_inclusive,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::one_hot_encode_bins(
+    input, left_edges, left_inclusive, right_edges, right_inclusive, stream, mr);
+}
 }  // namespace cudf
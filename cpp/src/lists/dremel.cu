@@ -22,6 +22,7 @@
 #include <cudf/lists/detail/dremel.hpp>
 #include <cudf/lists/lists_column_view.hpp>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/exec_policy.hpp>
 
@@ -34,6 +35,14 @@
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <stdexcept>
+#include <vector>
 
 namespace cudf::detail {
 namespace {
@@ -74,11 +83,56 @@ struct def_level_fn {
   }
 };
 
+/**
+ * @brief Functor to flag the repetition and definition level values that belong to a leaf element
+ * rather than to an empty or null list of some level above it.
+ */
+struct is_leaf_value_fn {
+  uint8_t const* def_levels;
+  uint8_t leaf_start_def_level;
+
+  __device__ size_type operator()(size_type i) const
+  {
+    return def_levels[i] >= leaf_start_def_level;
+  }
+};
+
+/**
+ * @brief Functor to add the contribution of a nullable leaf to the definition levels computed with
+ * the leaf treated as non-nullable.
+ */
+struct leaf_def_level_fn {
+  uint8_t const* base_def_levels;
+  size_type const* leaf_ranks;
+  bitmask_type const* leaf_null_mask;
+  size_type leaf_begin;
+  uint8_t max_base_def_level;
+
+  __device__ uint8_t operator()(size_type i) const
+  {
+    auto const def = base_def_levels[i];
+    // Only a leaf element whose ancestors are all valid reaches the leaf level
+    if (def != max_base_def_level) { return def; }
+    auto const is_valid =
+      leaf_null_mask == nullptr or bit_is_set(leaf_null_mask, leaf_begin + leaf_ranks[i]);
+    return def + (is_valid ? 1 : 0);
+  }
+};
+
+/**
+ * @brief Position of the leaf level in the dremel data of a column
+ */
+struct leaf_level_info {
+  size_type begin;          ///< Index of the first element of the leaf column
+  uint8_t start_def_level;  ///< Definition level reached by every element of the leaf column
+};
+
 dremel_data get_encoding(column_view h_col,
                          std::vector<uint8_t> nullability,
                          bool output_as_byte_array,
                          bool always_nullable,
-                         rmm::cuda_stream_view stream)
+                         rmm::cuda_stream_view stream,
+                         leaf_level_info* leaf_info = nullptr)
 {
   auto get_list_level = [](column_view col) {
     while (col.type().id() == type_id::STRUCT) {
@@ -465,6 +519,9 @@ dremel_data get_encoding(column_view h_col,
   stream.synchronize();
 
   size_type leaf_data_size = column_ends.back() - column_offsets.back();
+  if (leaf_info != nullptr) {
+    *leaf_info = leaf_level_info{column_offsets.back(), def_at_level.back()};
+  }
 
   return dremel_data{std::move(new_offsets),
                      std::move(rep_level),
@@ -472,6 +529,103 @@ dremel_data get_encoding(column_view h_col,
                      leaf_data_size,
                      max_def_level};
 }
+
+/**
+ * @brief Identifies the nesting levels of a column above its leaf.
+ *
+ * Columns with equal keys only differ in their leaves, so they have the same dremel offsets and
+ * repetition levels, and the same definition levels up to the contribution of their leaves.
+ */
+std::vector<std::intptr_t> nesting_levels_key(column_view col,
+                                              std::vector<uint8_t> const& nullability)
+{
+  std::vector<std::intptr_t> key{static_cast<std::intptr_t>(nullability.size())};
+  key.insert(key.end(), nullability.begin(), nullability.end() - 1);
+  while (is_nested(col.type())) {
+    key.insert(key.end(),
+               {static_cast<std::intptr_t>(col.type().id()),
+                col.size(),
+                col.offset(),
+                reinterpret_cast<std::intptr_t>(col.null_mask())});
+    if (col.type().id() == type_id::LIST) {
+      auto const offsets = col.child(lists_column_view::offsets_column_index);
+      key.insert(
+        key.end(),
+        {reinterpret_cast<std::intptr_t>(offsets.head()), offsets.offset(), offsets.size()});
+      col = col.child(lists_column_view::child_column_index);
+    } else {
+      col = col.child(0);
+    }
+  }
+  key.push_back(col.size());
+  return key;
+}
+
+column_view get_leaf(column_view col)
+{
+  while (is_nested(col.type())) {
+    col = col.type().id() == type_id::LIST ? col.child(lists_column_view::child_column_index)
+                                           : col.child(0);
+  }
+  return col;
+}
+
+/**
+ * @brief Computes the dremel data of columns that share all their nesting levels but the leaf.
+ *
+ * The levels above the leaves are traversed once, with the leaves treated as non-nullable. The
+ * definition levels of each column then add the contribution of its own leaf.
+ */
+std::vector<dremel_data> get_shared_encoding(host_span<column_view const> inputs,
+                                             host_span<std::vector<uint8_t> const> nullability,
+                                             rmm::cuda_stream_view stream)
+{
+  auto base_nullability   = nullability.front();
+  base_nullability.back() = 0;
+  leaf_level_info leaf_info{};
+  auto base = get_encoding(inputs.front(), base_nullability, false, false, stream, &leaf_info);
+
+  auto const num_values = static_cast<size_type>(base.def_level.size());
+  // Rank of each leaf element among the leaf elements, to index the null masks of the leaves
+  rmm::device_uvector<size_type> leaf_ranks(num_values, stream);
+  auto const is_leaf_value_it = cudf::detail::make_counting_transform_iterator(
+    0, is_leaf_value_fn{base.def_level.data(), leaf_info.start_def_level});
+  thrust::exclusive_scan(rmm::exec_policy_nosync(stream),
+                         is_leaf_value_it,
+                         is_leaf_value_it + num_values,
+                         leaf_ranks.begin());
+
+  std::vector<dremel_data> results;
+  results.reserve(inputs.size());
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    auto const leaf          = get_leaf(inputs[i]);
+    auto const leaf_nullable = nullability[i].back() != 0;
+
+    auto def_level = rmm::device_uvector<uint8_t>(base.def_level, stream);
+    if (leaf_nullable) {
+      thrust::transform(rmm::exec_policy_nosync(stream),
+                        thrust::make_counting_iterator(0),
+                        thrust::make_counting_iterator(num_values),
+                        def_level.begin(),
+                        leaf_def_level_fn{base.def_level.data(),
+                                          leaf_ranks.data(),
+                                          leaf.nullable() ? leaf.null_mask() : nullptr,
+                                          leaf_info.begin,
+                                          base.max_def_level});
+    }
+    // The last column takes over the shared buffers, the others copy them
+    auto const is_last = i + 1 == inputs.size();
+    results.push_back(dremel_data{
+      is_last ? std::move(base.dremel_offsets)
+              : rmm::device_uvector<size_type>(base.dremel_offsets, stream),
+      is_last ? std::move(base.rep_level) : rmm::device_uvector<uint8_t>(base.rep_level, stream),
+      std::move(def_level),
+      base.leaf_data_size,
+      static_cast<uint8_t>(base.max_def_level + (leaf_nullable ? 1 : 0))});
+  }
+  stream.synchronize();
+  return results;
+}
 }  // namespace
 
 dremel_data get_dremel_data(column_view h_col,
@@ -482,6 +636,51 @@ dremel_data get_dremel_data(column_view h_col,
   return get_encoding(h_col, nullability, output_as_byte_array, false, stream);
 }
 
+std::vector<dremel_data> get_dremel_data(host_span<column_view const> inputs,
+                                         host_span<std::vector<uint8_t> const> nullability,
+                                         rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(inputs.size() == nullability.size(),
+               "Each input column must have its nullability",
+               std::invalid_argument);
+
+  // Group the columns that share their nesting levels, in the order of their first column
+  std::map<std::vector<std::intptr_t>, std::vector<std::size_t>> groups;
+  for (std::size_t i = 0; i < inputs.size(); ++i) {
+    CUDF_EXPECTS(not nullability[i].empty(),
+                 "The nullability of each level must be given",
+                 std::invalid_argument);
+    groups[nesting_levels_key(inputs[i], nullability[i])].push_back(i);
+  }
+
+  std::vector<std::optional<dremel_data>> results(inputs.size());
+  for (auto const& [key, indices] : groups) {
+    if (indices.size() == 1 or inputs[indices.front()].is_empty()) {
+      for (auto const i : indices) {
+        results[i].emplace(get_encoding(inputs[i], nullability[i], false, false, stream));
+      }
+      continue;
+    }
+    std::vector<column_view> group_inputs;
+    std::vector<std::vector<uint8_t>> group_nullability;
+    for (auto const i : indices) {
+      group_inputs.push_back(inputs[i]);
+      group_nullability.push_back(nullability[i]);
+    }
+    auto group_results = get_shared_encoding(group_inputs, group_nullability, stream);
+    for (std::size_t j = 0; j < indices.size(); ++j) {
+      results[indices[j]].emplace(std::move(group_results[j]));
+    }
+  }
+
+  std::vector<dremel_data> dremel;
+  dremel.reserve(inputs.size());
+  for (auto& result : results) {
+    dremel.push_back(std::move(result.value()));
+  }
+  return dremel;
+}
+
 dremel_data get_comparator_data(column_view h_col,
                                 std::vector<uint8_t> nullability,
                                 bool output_as_byte_array,
@@ -42,6 +42,7 @@
 
 #include <memory>
 #include <type_traits>
+#include <utility>
 
 namespace cudf {
 namespace detail {
@@ -109,16 +110,16 @@ std::unique_ptr<table> build_table(
 
   return std::make_unique<table>(std::move(columns));
 }
-}  // namespace
 
-std::unique_ptr<table> explode(table_view const& input_table,
-                               size_type const explode_column_idx,
-                               rmm::cuda_stream_view stream,
-                               rmm::device_async_resource_ref mr)
+/**
+ * @brief Build the map from each element of the sliced child to the row of its parent list.
+ */
+rmm::device_uvector<size_type> make_explode_gather_map(lists_column_view const& explode_col,
+                                                       size_type num_elements,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
 {
-  lists_column_view explode_col{input_table.column(explode_column_idx)};
-  auto sliced_child = explode_col.get_sliced_child(stream);
-  rmm::device_uvector<size_type> gather_map(sliced_child.size(), stream);
+  rmm::device_uvector<size_type> gather_map(num_elements, stream, mr);
 
   // Sliced columns may require rebasing of the offsets.
   auto offsets = explode_col.offsets_begin();
@@ -139,6 +140,20 @@ std::unique_ptr<table> explode(table_view const& input_table,
                       counting_iter + gather_map.size(),
                       gather_map.begin());
 
+  return gather_map;
+}
+}  // namespace
+
+std::unique_ptr<table> explode(table_view const& input_table,
+                               size_type const explode_column_idx,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  lists_column_view explode_col{input_table.column(explode_column_idx)};
+  auto sliced_child = explode_col.get_sliced_child(stream);
+  auto const gather_map = make_explode_gather_map(
+    explode_col, sliced_child.size(), stream, rmm::mr::get_current_device_resource());
+
   return build_table(input_table,
                      explode_column_idx,
                      sliced_child,
@@ -297,6 +312,24 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
     mr);
 }
 
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_gather_map(
+  column_view const& explode_column,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  lists_column_view explode_col{explode_column};
+  auto sliced_child       = explode_col.get_sliced_child(stream);
+  auto const num_elements = sliced_child.size();
+  auto gather_map         = make_explode_gather_map(explode_col, num_elements, stream, mr);
+
+  return {std::make_unique<column>(data_type{type_to_id<size_type>()},
+                                   num_elements,
+                                   gather_map.release(),
+                                   rmm::device_buffer{},
+                                   0),
+          std::make_unique<column>(sliced_child, stream, mr)};
+}
+
 }  // namespace detail
 
 /**
@@ -339,6 +372,17 @@ std::unique_ptr<table> explode_outer(table_view const& input_table,
     input_table, explode_column_idx, false, cudf::get_default_stream(), mr);
 }
 
+/**
+ * @copydoc cudf::explode_gather_map(column_view const&, rmm::device_async_resource_ref)
+ */
+std::pair<std::unique_ptr<column>, std::unique_ptr<column>> explode_gather_map(
+  column_view const& explode_column, rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(explode_column.type().id() == type_id::LIST, "Unsupported non-list column");
+  return detail::explode_gather_map(explode_column, cudf::get_default_stream(), mr);
+}
+
 /**
  * @copydoc cudf::explode_outer_position(table_view const&, size_type,
  * rmm::device_async_resource_ref)
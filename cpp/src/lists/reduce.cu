@@ -0,0 +1,75 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/lists/reduce.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+namespace cudf {
+namespace lists {
+namespace detail {
+/**
+ * @copydoc cudf::lists::reduce
+ */
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               segmented_reduce_aggregation const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  if (input.is_empty()) { return make_empty_column(output_dtype); }
+
+  // The offsets of a (possibly sliced) lists column index directly into its unsliced child,
+  // so the child can be reduced in place with the list offsets as segment boundaries.
+  auto const offsets = device_span<size_type const>(input.offsets_begin(), input.size() + 1);
+  auto result        = cudf::reduction::detail::segmented_reduce(
+    input.child(), offsets, agg, output_dtype, null_handling, std::nullopt, stream, mr);
+
+  // Null list rows may still span a non-empty range of the child
+  if (input.has_nulls()) {
+    auto [null_mask, null_count] =
+      cudf::detail::bitmask_and(table_view{{result->view(), input.parent()}}, stream, mr);
+    result->set_null_mask(std::move(null_mask), null_count);
+  }
+  return result;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> reduce(lists_column_view const& input,
+                               segmented_reduce_aggregation const& agg,
+                               data_type output_dtype,
+                               null_policy null_handling,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::reduce(input, agg, output_dtype, null_handling, stream, mr);
+}
+
+}  // namespace lists
+}  // namespace cudf
@@ -56,6 +56,60 @@ void check_compatibility(lists_column_view const& lhs, lists_column_view const&
                "The input lists columns must have children having the same type structure");
 }
 
+/**
+ * @brief Build the output of a set operation from the elements selected from each list row.
+ *
+ * Duplicate elements are removed within each row, and an output row is null if either of the
+ * corresponding input rows is null.
+ *
+ * @param selected The table {labels, child} of the selected elements
+ * @param lhs The left lists column
+ * @param rhs The right lists column
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether floating-point NaNs should be considered as equal
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned object
+ * @return The output lists column
+ */
+std::unique_ptr<column> make_distinct_output(std::unique_ptr<table>&& selected,
+                                             lists_column_view const& lhs,
+                                             lists_column_view const& rhs,
+                                             null_equality nulls_equal,
+                                             nan_equality nans_equal,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = lhs.size();
+  auto selected_offsets = reconstruct_offsets(
+    selected->get_column(0).view(), num_rows, stream, rmm::mr::get_current_device_resource());
+  auto const selected_lists = make_lists_column(num_rows,
+                                                std::move(selected_offsets),
+                                                std::move(selected->release().back()),
+                                                0,
+                                                rmm::device_buffer{},
+                                                stream,
+                                                rmm::mr::get_current_device_resource());
+
+  auto out_lists =
+    distinct(lists_column_view{selected_lists->view()}, nulls_equal, nans_equal, stream, mr)
+      ->release();
+  auto [null_mask, null_count] =
+    cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
+  auto output =
+    make_lists_column(num_rows,
+                      std::move(out_lists.children[lists_column_view::offsets_column_index]),
+                      std::move(out_lists.children[lists_column_view::child_column_index]),
+                      null_count,
+                      std::move(null_mask),
+                      stream,
+                      mr);
+
+  if (auto const output_cv = output->view(); cudf::detail::has_nonempty_nulls(output_cv, stream)) {
+    return cudf::detail::purge_nonempty_nulls(output_cv, stream, mr);
+  }
+  return output;
+}
+
 }  // namespace
 
 std::unique_ptr<column> have_overlap(lists_column_view const& lhs,
@@ -142,7 +196,7 @@ std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
   // - Check existence for rows of the table {rhs_labels, rhs_child} in the table
   //   {lhs_labels, lhs_child}.
   // - Extract rows of the rhs table using the existence results computed in the previous step.
-  // - Remove duplicate rows, and build the output lists.
+  // - Remove duplicate elements within each row, and build the output lists.
 
   auto const lhs_child = lhs.get_sliced_child(stream);
   auto const rhs_child = rhs.get_sliced_child(stream);
@@ -156,37 +210,14 @@ std::unique_ptr<column> intersect_distinct(lists_column_view const& lhs,
   auto const contained = cudf::detail::contains(
     lhs_table, rhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
 
-  auto const intersect_table = cudf::detail::copy_if(
+  auto intersect_table = cudf::detail::copy_if(
     rhs_table,
     [contained = contained.begin()] __device__(auto const idx) { return contained[idx]; },
     stream,
     rmm::mr::get_current_device_resource());
 
-  // A stable algorithm is required to ensure that list labels remain contiguous.
-  auto out_table = cudf::detail::stable_distinct(intersect_table->view(),
-                                                 {0, 1},  // indices of key columns
-                                                 duplicate_keep_option::KEEP_ANY,
-                                                 nulls_equal,
-                                                 nans_equal,
-                                                 stream,
-                                                 mr);
-
-  auto const num_rows = lhs.size();
-  auto out_offsets    = reconstruct_offsets(out_table->get_column(0).view(), num_rows, stream, mr);
-  auto [null_mask, null_count] =
-    cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
-  auto output = make_lists_column(num_rows,
-                                  std::move(out_offsets),
-                                  std::move(out_table->release().back()),
-                                  null_count,
-                                  std::move(null_mask),
-                                  stream,
-                                  mr);
-
-  if (auto const output_cv = output->view(); cudf::detail::has_nonempty_nulls(output_cv, stream)) {
-    return cudf::detail::purge_nonempty_nulls(output_cv, stream, mr);
-  }
-  return output;
+  return make_distinct_output(
+    std::move(intersect_table), lhs, rhs, nulls_equal, nans_equal, stream, mr);
 }
 
 std::unique_ptr<column> union_distinct(lists_column_view const& lhs,
@@ -225,7 +256,7 @@ std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
   //   {rhs_labels, rhs_child}.
   // - Invert the existence results computed in the previous step, resulting in difference results.
   // - Extract rows of the lhs table using that difference results.
-  // - Remove duplicate rows, and build the output lists.
+  // - Remove duplicate elements within each row, and build the output lists.
 
   auto const lhs_child = lhs.get_sliced_child(stream);
   auto const rhs_child = rhs.get_sliced_child(stream);
@@ -239,38 +270,14 @@ std::unique_ptr<column> difference_distinct(lists_column_view const& lhs,
   auto const contained = cudf::detail::contains(
     rhs_table, lhs_table, nulls_equal, nans_equal, stream, rmm::mr::get_current_device_resource());
 
-  auto const difference_table = cudf::detail::copy_if(
+  auto difference_table = cudf::detail::copy_if(
     lhs_table,
     [contained = contained.begin()] __device__(auto const idx) { return !contained[idx]; },
     stream,
     rmm::mr::get_current_device_resource());
 
-  // A stable algorithm is required to ensure that list labels remain contiguous.
-  auto out_table = cudf::detail::stable_distinct(difference_table->view(),
-                                                 {0, 1},  // indices of key columns
-                                                 duplicate_keep_option::KEEP_ANY,
-                                                 nulls_equal,
-                                                 nans_equal,
-                                                 stream,
-                                                 mr);
-
-  auto const num_rows = lhs.size();
-  auto out_offsets    = reconstruct_offsets(out_table->get_column(0).view(), num_rows, stream, mr);
-  auto [null_mask, null_count] =
-    cudf::detail::bitmask_and(table_view{{lhs.parent(), rhs.parent()}}, stream, mr);
-
-  auto output = make_lists_column(num_rows,
-                                  std::move(out_offsets),
-                                  std::move(out_table->release().back()),
-                                  null_count,
-                                  std::move(null_mask),
-                                  stream,
-                                  mr);
-
-  if (auto const output_cv = output->view(); cudf::detail::has_nonempty_nulls(output_cv, stream)) {
-    return cudf::detail::purge_nonempty_nulls(output_cv, stream, mr);
-  }
-  return output;
+  return make_distinct_output(
+    std::move(difference_table), lhs, rhs, nulls_equal, nans_equal, stream, mr);
 }
 
 }  // namespace detail
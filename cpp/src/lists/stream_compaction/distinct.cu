@@ -18,22 +18,181 @@
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
 #include <memory>
 #include <utility>
 
 namespace cudf::lists {
 namespace detail {
 
+namespace {
+
+constexpr int block_size                  = 256;
+constexpr int warps_per_block             = block_size / cudf::detail::warp_size;
+constexpr size_type max_short_list_size   = 128;
+constexpr size_type hash_slots_per_warp   = 2 * max_short_list_size;
+constexpr size_type max_elements_per_lane = max_short_list_size / cudf::detail::warp_size;
+constexpr size_type empty_slot            = -1;
+
+/**
+ * @brief Flag the first occurrence of each distinct element within every list row.
+ *
+ * Each warp handles one list row using a small open-addressing hash set in shared memory,
+ * so no global hash table or sort is needed. Every slot holds the smallest child index of the
+ * equal elements inserted there, which makes the kept element the first one in its row.
+ *
+ * @param offsets The list offsets, which may not start from zero
+ * @param num_rows The number of list rows
+ * @param hasher Row hasher over the sliced child column
+ * @param key_equal Row equality comparator over the sliced child column
+ * @param keep Output flags, one per element of the sliced child column
+ */
+template <typename Hasher, typename KeyEqual>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  mark_distinct_elements_kernel(size_type const* offsets,
+                                size_type num_rows,
+                                Hasher hasher,
+                                KeyEqual key_equal,
+                                bool* keep)
+{
+  __shared__ size_type hash_slots[warps_per_block][hash_slots_per_warp];
+
+  auto const warp_id = static_cast<size_type>(threadIdx.x) / cudf::detail::warp_size;
+  auto const lane_id = static_cast<size_type>(threadIdx.x) % cudf::detail::warp_size;
+  auto const row     = static_cast<size_type>(blockIdx.x) * warps_per_block + warp_id;
+  if (row >= num_rows) { return; }
+
+  auto const slots = hash_slots[warp_id];
+  for (auto i = lane_id; i < hash_slots_per_warp; i += cudf::detail::warp_size) {
+    slots[i] = empty_slot;
+  }
+  __syncwarp();
+
+  auto const begin = offsets[row] - offsets[0];
+  auto const end   = offsets[row + 1] - offsets[0];
+
+  size_type inserted_slots[max_elements_per_lane];
+  for (auto idx = begin + lane_id, k = 0; idx < end; idx += cudf::detail::warp_size, ++k) {
+    auto slot = static_cast<size_type>(hasher(idx) % hash_slots_per_warp);
+    while (true) {
+      auto const existing = atomicCAS(&slots[slot], empty_slot, idx);
+      if (existing == empty_slot) { break; }
+      if (key_equal(existing, idx)) {
+        atomicMin(&slots[slot], idx);
+        break;
+      }
+      slot = (slot + 1) % hash_slots_per_warp;
+    }
+    inserted_slots[k] = slot;
+  }
+  __syncwarp();
+
+  for (auto idx = begin + lane_id, k = 0; idx < end; idx += cudf::detail::warp_size, ++k) {
+    keep[idx] = slots[inserted_slots[k]] == idx;
+  }
+}
+
+/**
+ * @brief Return the size of the longest list row in the input lists column.
+ */
+size_type max_list_size(lists_column_view const& input, rmm::cuda_stream_view stream)
+{
+  auto const offsets = input.offsets_begin();
+  return thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(input.size()),
+    cuda::proclaim_return_type<size_type>(
+      [offsets] __device__(size_type idx) { return offsets[idx + 1] - offsets[idx]; }),
+    size_type{0},
+    thrust::maximum<size_type>{});
+}
+
+/**
+ * @brief Distinct for lists columns whose rows all fit in a per-warp shared-memory hash set.
+ *
+ * Unlike the generic path, this keeps the first occurrence of each element in its row.
+ */
+std::unique_ptr<column> short_lists_distinct(lists_column_view const& input,
+                                             null_equality nulls_equal,
+                                             nan_equality nans_equal,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  auto const child       = input.get_sliced_child(stream);
+  auto const child_table = table_view{{child}};
+  auto keep              = rmm::device_uvector<bool>(child.size(), stream);
+
+  auto const preprocessed_child =
+    cudf::experimental::row::hash::preprocessed_table::create(child_table, stream);
+  auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(child_table)};
+  auto const has_nested_columns = cudf::detail::has_nested_columns(child_table);
+
+  auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_child);
+  auto const hasher     = row_hasher.device_hasher(has_nulls);
+  auto const row_comp   = cudf::experimental::row::equality::self_comparator(preprocessed_child);
+
+  auto const num_blocks    = cudf::util::div_rounding_up_safe(input.size(), warps_per_block);
+  auto const mark_distinct = [&](auto const value_comp) {
+    if (has_nested_columns) {
+      auto const key_equal = row_comp.equal_to<true>(has_nulls, nulls_equal, value_comp);
+      mark_distinct_elements_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+        input.offsets_begin(), input.size(), hasher, key_equal, keep.data());
+    } else {
+      auto const key_equal = row_comp.equal_to<false>(has_nulls, nulls_equal, value_comp);
+      mark_distinct_elements_kernel<<<num_blocks, block_size, 0, stream.value()>>>(
+        input.offsets_begin(), input.size(), hasher, key_equal, keep.data());
+    }
+  };
+
+  if (nans_equal == nan_equality::ALL_EQUAL) {
+    mark_distinct(cudf::experimental::row::equality::nan_equal_physical_equality_comparator{});
+  } else {
+    mark_distinct(cudf::experimental::row::equality::physical_equality_comparator{});
+  }
+
+  auto const labels =
+    generate_labels(input, child.size(), stream, rmm::mr::get_current_device_resource());
+  auto distinct_table = cudf::detail::copy_if(
+    table_view{{labels->view(), child}},
+    [keep = keep.begin()] __device__(auto const idx) { return keep[idx]; },
+    stream,
+    mr);
+
+  auto out_offsets =
+    reconstruct_offsets(distinct_table->get_column(0).view(), input.size(), stream, mr);
+
+  return make_lists_column(input.size(),
+                           std::move(out_offsets),
+                           std::move(distinct_table->release().back()),
+                           input.null_count(),
+                           cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+}  // namespace
+
 std::unique_ptr<column> distinct(lists_column_view const& input,
                                  null_equality nulls_equal,
                                  nan_equality nans_equal,
@@ -47,6 +206,11 @@ std::unique_ptr<column> distinct(lists_column_view const& input,
 
   if (input.is_empty()) { return empty_like(input.parent()); }
 
+  // Rows short enough to be deduplicated by a single warp skip the table-wide hashing below.
+  if (max_list_size(input, stream) <= max_short_list_size) {
+    return short_lists_distinct(input, nulls_equal, nans_equal, stream, mr);
+  }
+
   auto const child = input.get_sliced_child(stream);
   auto const labels =
     generate_labels(input, child.size(), stream, rmm::mr::get_current_device_resource());
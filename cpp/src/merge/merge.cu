@@ -15,6 +15,7 @@
  */
 
 #include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
@@ -22,6 +23,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/search.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/merge.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
@@ -41,8 +43,11 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/atomic>
 #include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
@@ -51,9 +56,14 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <cmath>
+#include <cstring>
 #include <limits>
 #include <numeric>
 #include <queue>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace cudf {
@@ -605,17 +615,10 @@ T top_and_pop(std::priority_queue<T>& q)
   return moved;
 }
 
-}  // anonymous namespace
-
-table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
-                     std::vector<cudf::size_type> const& key_cols,
-                     std::vector<cudf::order> const& column_order,
-                     std::vector<cudf::null_order> const& null_precedence,
-                     rmm::cuda_stream_view stream,
-                     rmm::device_async_resource_ref mr)
+void validate_merge_inputs(std::vector<table_view> const& tables_to_merge,
+                           std::vector<cudf::size_type> const& key_cols,
+                           std::vector<cudf::order> const& column_order)
 {
-  if (tables_to_merge.empty()) { return std::make_unique<cudf::table>(); }
-
   auto const& first_table = tables_to_merge.front();
   auto const n_cols       = first_table.num_columns();
 
@@ -642,13 +645,20 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
                       return running_sum + static_cast<std::size_t>(tbl.num_rows());
                     }) <= static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
     "Total number of merged rows exceeds row limit");
+}
 
-  // This utility will ensure all corresponding dictionary columns have matching keys.
-  // It will return any new dictionary columns created as well as updated table_views.
-  auto matched = cudf::dictionary::detail::match_dictionaries(
-    tables_to_merge, stream, rmm::mr::get_current_device_resource());
-  auto merge_tables = matched.second;
-
+/**
+ * @brief Merges tables by repeatedly merging the two smallest tables.
+ *
+ * The dictionary columns of `merge_tables` must have matching keys.
+ */
+table_ptr_type pairwise_merge(std::vector<table_view> const& merge_tables,
+                              std::vector<cudf::size_type> const& key_cols,
+                              std::vector<cudf::order> const& column_order,
+                              std::vector<cudf::null_order> const& null_precedence,
+                              rmm::cuda_stream_view stream,
+                              rmm::device_async_resource_ref mr)
+{
   // A queue of (table view, table) pairs
   std::priority_queue<merge_queue_item> merge_queue;
   // The table pointer is null if we do not own the table (input tables)
@@ -661,7 +671,7 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
     return std::make_unique<cudf::table>(merge_queue.top().view, stream, mr);
   }
   // No inputs have rows, return a table with same columns as the first one
-  if (merge_queue.empty()) { return empty_like(first_table); }
+  if (merge_queue.empty()) { return empty_like(merge_tables.front()); }
 
   // Pick the two smallest tables and merge them
   // Until there is only one table left in the queue
@@ -688,6 +698,388 @@ table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
   return std::move(top_and_pop(merge_queue).table);
 }
 
+/**
+ * @brief Returns the index of the table a row belongs to, given the first row of each table.
+ */
+__device__ size_type table_of_row(size_type const* table_offsets,
+                                  std::size_t num_tables,
+                                  size_type row)
+{
+  auto const it = thrust::upper_bound(thrust::seq, table_offsets, table_offsets + num_tables, row);
+  return static_cast<size_type>(thrust::distance(table_offsets, it)) - 1;
+}
+
+/**
+ * @brief Returns the bits of a fixed-width key in an unsigned integer whose order matches the
+ * order of the keys.
+ *
+ * As in the row comparators, NaNs are equal and larger than all other values, and `-0.0` is
+ * equal to `0.0`.
+ */
+template <typename T>
+__device__ uint64_t ordered_key_bits(T value)
+{
+  if constexpr (cudf::is_timestamp<T>()) {
+    return ordered_key_bits(value.time_since_epoch().count());
+  } else if constexpr (cudf::is_duration<T>()) {
+    return ordered_key_bits(value.count());
+  } else if constexpr (std::is_floating_point_v<T>) {
+    if (std::isnan(value)) { value = std::numeric_limits<T>::quiet_NaN(); }
+    if (value == T{0}) { value = T{0}; }
+    using bits_type = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    auto constexpr sign_bit = bits_type{1} << (sizeof(bits_type) * 8 - 1);
+    bits_type bits;
+    memcpy(&bits, &value, sizeof(T));
+    return (bits & sign_bit) ? static_cast<bits_type>(~bits) : (bits | sign_bit);
+  } else if constexpr (std::is_signed_v<T>) {
+    using bits_type         = std::make_unsigned_t<T>;
+    auto constexpr sign_bit = bits_type{1} << (sizeof(bits_type) * 8 - 1);
+    return static_cast<bits_type>(value) ^ sign_bit;
+  } else {
+    return static_cast<uint64_t>(value);
+  }
+}
+
+/**
+ * @brief Returns whether a key type is merged on encoded keys by `radix_merged_order`.
+ */
+template <typename T>
+constexpr bool is_radix_merge_key()
+{
+  return (std::is_arithmetic_v<T> or cudf::is_chrono<T>()) and sizeof(T) <= sizeof(uint64_t);
+}
+
+struct radix_merge_key_fn {
+  template <typename T>
+  bool operator()() const
+  {
+    return is_radix_merge_key<T>();
+  }
+};
+
+bool is_radix_merge_key(data_type type)
+{
+  return type_dispatcher<dispatch_storage_type>(type, radix_merge_key_fn{});
+}
+
+/**
+ * @brief Encodes keys into unsigned 128-bit values whose order matches the order of the keys.
+ *
+ * The upper 64 bits order nulls before or after the valid keys, and the lower 64 bits hold
+ * `ordered_key_bits()` of the valid keys. Descending keys are encoded with all bits inverted.
+ */
+struct radix_key_encoder {
+  template <typename T, CUDF_ENABLE_IF(is_radix_merge_key<T>())>
+  void operator()(column_view const& keys,
+                  order column_order,
+                  null_order null_precedence,
+                  __uint128_t* encoded_keys,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_keys     = column_device_view::create(keys, stream);
+    auto const null_class = null_precedence == null_order::BEFORE ? 0 : 2;
+    auto const descending = column_order == order::DESCENDING;
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(keys.size()),
+      encoded_keys,
+      cuda::proclaim_return_type<__uint128_t>(
+        [d_keys = *d_keys, null_class, descending] __device__(size_type i) {
+          auto const encoded =
+            d_keys.is_null(i)
+              ? static_cast<__uint128_t>(null_class) << 64
+              : (__uint128_t{1} << 64) | ordered_key_bits(d_keys.element<T>(i));
+          return descending ? ~encoded : encoded;
+        }));
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not is_radix_merge_key<T>())>
+  void operator()(column_view const&,
+                  order,
+                  null_order,
+                  __uint128_t*,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported radix merge key type");
+  }
+};
+
+/**
+ * @brief Computes the merged order of the rows of several tables on a single fixed-width key.
+ *
+ * The keys are encoded into unsigned integers and adjacent runs of encoded keys are merged until
+ * a single run remains, so that rows with equal keys are ordered by table.
+ *
+ * @return The index of each row offset by the first row of its table, in merged order
+ */
+rmm::device_uvector<size_type> radix_merged_order(std::vector<table_view> const& tables,
+                                                  std::vector<size_type> const& table_offsets,
+                                                  size_type key_col,
+                                                  order column_order,
+                                                  null_order null_precedence,
+                                                  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = table_offsets.back();
+  auto keys           = rmm::device_uvector<__uint128_t>(num_rows, stream);
+  auto merged_keys    = rmm::device_uvector<__uint128_t>(num_rows, stream);
+  auto rows           = rmm::device_uvector<size_type>(num_rows, stream);
+  auto merged_rows    = rmm::device_uvector<size_type>(num_rows, stream);
+
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    auto const& keys_col = tables[i].column(key_col);
+    type_dispatcher<dispatch_storage_type>(keys_col.type(),
+                                           radix_key_encoder{},
+                                           keys_col,
+                                           column_order,
+                                           null_precedence,
+                                           keys.data() + table_offsets[i],
+                                           stream);
+  }
+  thrust::sequence(rmm::exec_policy_nosync(stream), rows.begin(), rows.end());
+
+  // merge adjacent runs; thrust::merge_by_key takes equal keys from the first run first
+  auto runs = table_offsets;
+  while (runs.size() > 2) {
+    std::vector<size_type> merged_runs;
+    for (std::size_t r = 0; r + 1 < runs.size(); r += 2) {
+      auto const begin = runs[r];
+      auto const mid   = runs[r + 1];
+      auto const end   = r + 2 < runs.size() ? runs[r + 2] : mid;
+      thrust::merge_by_key(rmm::exec_policy_nosync(stream),
+                           keys.begin() + begin,
+                           keys.begin() + mid,
+                           keys.begin() + mid,
+                           keys.begin() + end,
+                           rows.begin() + begin,
+                           rows.begin() + mid,
+                           merged_keys.begin() + begin,
+                           merged_rows.begin() + begin);
+      merged_runs.push_back(begin);
+    }
+    merged_runs.push_back(runs.back());
+    std::swap(keys, merged_keys);
+    std::swap(rows, merged_rows);
+    runs = std::move(merged_runs);
+  }
+  return rows;
+}
+
+/**
+ * @brief Computes the merged order of the rows of several tables by merging their key columns
+ * along with the row indices.
+ *
+ * @return The index of each row offset by the first row of its table, in merged order
+ */
+rmm::device_uvector<size_type> keys_merged_order(
+  std::vector<table_view> const& tables,
+  std::vector<size_type> const& table_offsets,
+  std::vector<cudf::size_type> const& key_cols,
+  std::vector<cudf::order> const& column_order,
+  std::vector<cudf::null_order> const& null_precedence,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows = table_offsets.back();
+  auto rows           = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), rows.begin(), rows.end());
+
+  std::vector<table_view> key_tables;
+  for (std::size_t i = 0; i < tables.size(); ++i) {
+    auto const keys = tables[i].select(key_cols);
+    std::vector<column_view> columns(keys.begin(), keys.end());
+    columns.emplace_back(data_type{type_to_id<size_type>()},
+                         tables[i].num_rows(),
+                         rows.data() + table_offsets[i],
+                         nullptr,
+                         0);
+    key_tables.emplace_back(columns);
+  }
+  std::vector<size_type> key_indices(key_cols.size());
+  std::iota(key_indices.begin(), key_indices.end(), 0);
+
+  auto const merged = pairwise_merge(key_tables,
+                                     key_indices,
+                                     column_order,
+                                     null_precedence,
+                                     stream,
+                                     rmm::mr::get_current_device_resource());
+  auto const merged_rows = merged->get_column(key_indices.size()).view();
+  return cudf::detail::make_device_uvector_async(
+    device_span<size_type const>(merged_rows.data<size_type>(), num_rows),
+    stream,
+    rmm::mr::get_current_device_resource());
+}
+
+/**
+ * @brief Computes the range of rows of each table in each chunk of merged rows.
+ *
+ * @return The first row and the number of rows of each table in each chunk, indexed by
+ * `chunk * tables + table`
+ */
+std::pair<std::vector<size_type>, std::vector<size_type>> chunk_table_ranges(
+  device_span<size_type const> row_order,
+  std::vector<size_type> const& table_offsets,
+  size_type chunk_rows,
+  rmm::cuda_stream_view stream)
+{
+  auto const num_rows   = static_cast<size_type>(row_order.size());
+  auto const num_tables = table_offsets.size() - 1;
+  auto const num_chunks = util::div_rounding_up_safe(num_rows, chunk_rows);
+  auto const temp_mr    = rmm::mr::get_current_device_resource();
+
+  auto const d_offsets = cudf::detail::make_device_uvector_async(table_offsets, stream, temp_mr);
+  auto d_counts        = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_chunks * num_tables, stream, temp_mr);
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    num_rows,
+    [row_order, offsets = d_offsets.data(), counts = d_counts.data(), num_tables, chunk_rows]
+    __device__(size_type i) {
+      auto const table = table_of_row(offsets, num_tables, row_order[i]);
+      cuda::atomic_ref<size_type, cuda::thread_scope_device> count{
+        counts[(i / chunk_rows) * num_tables + table]};
+      count.fetch_add(1, cuda::std::memory_order_relaxed);
+    });
+
+  auto counts = cudf::detail::make_std_vector_sync(d_counts, stream);
+  std::vector<size_type> begins(counts.size(), 0);
+  for (std::size_t i = num_tables; i < counts.size(); ++i) {
+    begins[i] = begins[i - num_tables] + counts[i - num_tables];
+  }
+  return {std::move(begins), std::move(counts)};
+}
+
+}  // anonymous namespace
+
+table_ptr_type merge(std::vector<table_view> const& tables_to_merge,
+                     std::vector<cudf::size_type> const& key_cols,
+                     std::vector<cudf::order> const& column_order,
+                     std::vector<cudf::null_order> const& null_precedence,
+                     rmm::cuda_stream_view stream,
+                     rmm::device_async_resource_ref mr)
+{
+  if (tables_to_merge.empty()) { return std::make_unique<cudf::table>(); }
+
+  validate_merge_inputs(tables_to_merge, key_cols, column_order);
+
+  // Merging many tables pairwise copies every row several times, so compute the merged order
+  // from the keys and copy the rows once instead
+  auto const num_tables = std::count_if(tables_to_merge.cbegin(),
+                                        tables_to_merge.cend(),
+                                        [](auto const& tbl) { return tbl.num_rows() > 0; });
+  if (static_cast<std::size_t>(num_tables) >= kway_merge_min_tables) {
+    auto const num_rows = std::accumulate(
+      tables_to_merge.cbegin(),
+      tables_to_merge.cend(),
+      size_type{0},
+      [](auto const& running_sum, auto const& tbl) { return running_sum + tbl.num_rows(); });
+    chunked_merger merger(
+      tables_to_merge, key_cols, column_order, null_precedence, num_rows, stream, mr);
+    return merger.next_chunk();
+  }
+
+  // This utility will ensure all corresponding dictionary columns have matching keys.
+  // It will return any new dictionary columns created as well as updated table_views.
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    tables_to_merge, stream, rmm::mr::get_current_device_resource());
+  return pairwise_merge(matched.second, key_cols, column_order, null_precedence, stream, mr);
+}
+
+chunked_merger::chunked_merger(std::vector<table_view> const& tables_to_merge,
+                               std::vector<size_type> const& key_cols,
+                               std::vector<order> const& column_order,
+                               std::vector<null_order> const& null_precedence,
+                               size_type chunk_rows,
+                               rmm::cuda_stream_view stream,
+                               rmm::device_async_resource_ref mr)
+  : _row_order{0, stream}, _chunk_rows{chunk_rows}, _stream{stream}, _mr{mr}
+{
+  CUDF_EXPECTS(!tables_to_merge.empty(), "No tables to merge", std::invalid_argument);
+  CUDF_EXPECTS(chunk_rows > 0, "Chunk size must be positive", std::invalid_argument);
+  validate_merge_inputs(tables_to_merge, key_cols, column_order);
+
+  auto matched = cudf::dictionary::detail::match_dictionaries(
+    tables_to_merge, stream, rmm::mr::get_current_device_resource());
+  _matched_dictionaries = std::move(matched.first);
+  _tables               = std::move(matched.second);
+
+  _table_offsets.push_back(0);
+  for (auto const& tbl : _tables) {
+    _table_offsets.push_back(_table_offsets.back() + tbl.num_rows());
+  }
+
+  _row_order = [&] {
+    auto const& key_col = _tables.front().column(key_cols.front());
+    if (key_cols.size() == 1 and is_radix_merge_key(key_col.type())) {
+      auto const precedence =
+        null_precedence.empty() ? null_order::BEFORE : null_precedence.front();
+      return radix_merged_order(
+        _tables, _table_offsets, key_cols.front(), column_order.front(), precedence, stream);
+    }
+    return keys_merged_order(
+      _tables, _table_offsets, key_cols, column_order, null_precedence, stream);
+  }();
+
+  std::tie(_chunk_begins, _chunk_counts) =
+    chunk_table_ranges(_row_order, _table_offsets, chunk_rows, stream);
+}
+
+bool chunked_merger::has_next() const
+{
+  auto const num_chunks = static_cast<size_type>(_chunk_counts.size() / _tables.size());
+  return _next_chunk < num_chunks;
+}
+
+std::unique_ptr<table> chunked_merger::next_chunk()
+{
+  if (not has_next()) { return empty_like(_tables.front()); }
+
+  auto const chunk      = _next_chunk++;
+  auto const num_tables = _tables.size();
+  auto const first_row  = chunk * _chunk_rows;
+  auto const end_row    = std::min(_table_offsets.back() - first_row, _chunk_rows) + first_row;
+
+  // the rows of each table in the chunk are contiguous, so gather them from one concatenation
+  // of the ranges of each table
+  std::vector<table_view> ranges;
+  std::vector<size_type> shifts(num_tables, 0);
+  size_type range_offset = 0;
+  for (std::size_t i = 0; i < num_tables; ++i) {
+    auto const begin = _chunk_begins[chunk * num_tables + i];
+    auto const count = _chunk_counts[chunk * num_tables + i];
+    if (count == 0) { continue; }
+    ranges.push_back(cudf::detail::slice(_tables[i], {begin, begin + count}, _stream).front());
+    shifts[i] = _table_offsets[i] + begin - range_offset;
+    range_offset += count;
+  }
+
+  auto const temp_mr      = rmm::mr::get_current_device_resource();
+  auto const concatenated = ranges.size() > 1
+                              ? cudf::detail::concatenate(ranges, _stream, temp_mr)
+                              : std::unique_ptr<table>{};
+  auto const source       = concatenated ? concatenated->view() : ranges.front();
+
+  auto const d_offsets = cudf::detail::make_device_uvector_async(_table_offsets, _stream, temp_mr);
+  auto const d_shifts  = cudf::detail::make_device_uvector_async(shifts, _stream, temp_mr);
+  auto gather_map      = rmm::device_uvector<size_type>(end_row - first_row, _stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(_stream),
+    _row_order.begin() + first_row,
+    _row_order.begin() + end_row,
+    gather_map.begin(),
+    cuda::proclaim_return_type<size_type>(
+      [offsets = d_offsets.data(), shifts = d_shifts.data(), num_tables] __device__(
+        size_type row) { return row - shifts[table_of_row(offsets, num_tables, row)]; }));
+
+  return detail::gather(source,
+                        gather_map.begin(),
+                        gather_map.end(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        _stream,
+                        _mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merge,
@@ -701,4 +1093,31 @@ std::unique_ptr<cudf::table> merge(std::vector<table_view> const& tables_to_merg
     tables_to_merge, key_cols, column_order, null_precedence, cudf::get_default_stream(), mr);
 }
 
+chunked_merge::chunked_merge(std::vector<table_view> const& tables_to_merge,
+                             std::vector<cudf::size_type> const& key_cols,
+                             std::vector<cudf::order> const& column_order,
+                             std::vector<cudf::null_order> const& null_precedence,
+                             cudf::size_type chunk_rows,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  merger = std::make_unique<detail::chunked_merger>(
+    tables_to_merge, key_cols, column_order, null_precedence, chunk_rows, stream, mr);
+}
+
+chunked_merge::~chunked_merge() = default;
+
+bool chunked_merge::has_next() const
+{
+  CUDF_FUNC_RANGE();
+  return merger->has_next();
+}
+
+std::unique_ptr<cudf::table> chunked_merge::next_chunk()
+{
+  CUDF_FUNC_RANGE();
+  return merger->next_chunk();
+}
+
 }  // namespace cudf
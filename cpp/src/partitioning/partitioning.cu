@@ -14,19 +14,29 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/contiguous_split.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/contiguous_split.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/gather.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/scatter.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/null_mask.hpp>
 #include <cudf/partitioning.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -35,10 +45,20 @@
 
 #include <cub/block/block_scan.cuh>
 #include <cub/device/device_histogram.cuh>
+#include <cub/device/device_radix_sort.cuh>
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
+#include <thrust/sequence.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+#include <type_traits>
+
 namespace cudf {
 namespace {
 // Launch configuration for optimized hash partition
@@ -51,6 +71,9 @@ constexpr size_type THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL = 1024;
 constexpr size_type FALLBACK_BLOCK_SIZE      = 256;
 constexpr size_type FALLBACK_ROWS_PER_THREAD = 1;
 
+// Largest partition count handled by the radix sort based hash partition
+constexpr size_type THRESHOLD_FOR_RADIX_PARTITION = 65536;
+
 /**
  * @brief  Functor to map a hash value to a particular 'bin' or partition number
  * that uses the modulo operation.
@@ -464,15 +487,35 @@ struct copy_block_partitions_dispatcher {
   }
 };
 
-// NOTE hash_has_nulls must be true if table_to_hash has nulls
+/**
+ * @brief The partition of every row of a table along with the per-block
+ * histograms needed to move each row to its location in the output.
+ */
+struct row_partitions {
+  size_type grid_size;   ///< Number of blocks used to compute the partitions
+  size_type block_size;  ///< Number of threads per block used to compute the partitions
+  /// Partition number of each row
+  rmm::device_uvector<size_type> row_partition_numbers;
+  /// Offset of each row in its partition of the thread block
+  rmm::device_uvector<size_type> row_partition_offset;
+  /// Size of each partition for each block, partition-major
+  rmm::device_uvector<size_type> block_partition_sizes;
+  /// Exclusive scan of `block_partition_sizes`
+  rmm::device_uvector<size_type> scanned_block_partition_sizes;
+  /// Offset of the first row of each partition in the output
+  rmm::device_uvector<size_type> partition_offsets;
+};
+
+/**
+ * @brief Hashes each row of `table_to_hash` to compute its partition number.
+ *
+ * NOTE hash_has_nulls must be true if table_to_hash has nulls
+ */
 template <template <typename> class hash_function, bool hash_has_nulls>
-std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
-  table_view const& input,
-  table_view const& table_to_hash,
-  size_type num_partitions,
-  uint32_t seed,
-  rmm::cuda_stream_view stream,
-  rmm::device_async_resource_ref mr)
+row_partitions compute_row_partitions(table_view const& table_to_hash,
+                                      size_type num_partitions,
+                                      uint32_t seed,
+                                      rmm::cuda_stream_view stream)
 {
   auto const num_rows = table_to_hash.num_rows();
 
@@ -569,10 +612,163 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
                          global_partition_sizes.end(),
                          global_partition_sizes.begin());
 
+  return row_partitions{grid_size,
+                        block_size,
+                        std::move(row_partition_numbers),
+                        std::move(row_partition_offset),
+                        std::move(block_partition_sizes),
+                        std::move(scanned_block_partition_sizes),
+                        std::move(global_partition_sizes)};
+}
+
+/**
+ * @brief Functor that computes the partition number of a row from its hash value.
+ */
+template <typename row_hasher_t, typename partitioner_type>
+struct row_partition_number_fn {
+  row_hasher_t hasher;
+  partitioner_type partitioner;
+
+  __device__ size_type operator()(size_type row_number) const
+  {
+    return partitioner(hasher(row_number));
+  }
+};
+
+/**
+ * @brief Hash partitions a table for large partition counts by radix sorting the
+ * row indices on the bits of their partition numbers.
+ *
+ * The per-block shared memory histograms of the single pass kernels grow with the
+ * number of partitions, and scattering rows into thousands of partitions leaves the
+ * writes poorly coalesced. Instead, the partition number of each row is computed
+ * without a histogram, a stable LSD radix sort over only the `log2(num_partitions)`
+ * significant bits orders the row indices by partition in a couple of cache-friendly
+ * passes, and the rows are gathered so that the output is written sequentially. Rows
+ * keep their input order within each partition.
+ *
+ * NOTE hash_has_nulls must be true if table_to_hash has nulls
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> radix_hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  auto const row_hasher = experimental::row::hash::row_hasher(table_to_hash, stream);
+  auto const hasher =
+    row_hasher.device_hasher<hash_function>(nullate::DYNAMIC{hash_has_nulls}, seed);
+
+  rmm::device_uvector<size_type> partition_numbers(num_rows, stream);
+  rmm::device_uvector<size_type> partition_numbers_alt(num_rows, stream);
+  rmm::device_uvector<size_type> gather_map(num_rows, stream);
+  rmm::device_uvector<size_type> gather_map_alt(num_rows, stream);
+
+  auto const compute_partition_numbers = [&](auto partitioner) {
+    using partitioner_type = decltype(partitioner);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(num_rows),
+                      partition_numbers.begin(),
+                      row_partition_number_fn<std::remove_cv_t<decltype(hasher)>, partitioner_type>{
+                        hasher, partitioner});
+  };
+  if (is_power_two(num_partitions)) {
+    compute_partition_numbers(bitwise_partitioner<hash_value_type>(num_partitions));
+  } else {
+    compute_partition_numbers(modulo_partitioner<hash_value_type>(num_partitions));
+  }
+  thrust::sequence(rmm::exec_policy_nosync(stream), gather_map.begin(), gather_map.end());
+
+  // Only the bits that can differ between partition numbers need to be sorted
+  int end_bit = 0;
+  while ((size_type{1} << end_bit) < num_partitions) {
+    ++end_bit;
+  }
+
+  cub::DoubleBuffer<size_type> keys_buffer(partition_numbers.data(),
+                                           partition_numbers_alt.data());
+  cub::DoubleBuffer<size_type> gather_map_buffer(gather_map.data(), gather_map_alt.data());
+  std::size_t temp_storage_bytes = 0;
+  cub::DeviceRadixSort::SortPairs(nullptr,
+                                  temp_storage_bytes,
+                                  keys_buffer,
+                                  gather_map_buffer,
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream.value());
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  cub::DeviceRadixSort::SortPairs(d_temp_storage.data(),
+                                  temp_storage_bytes,
+                                  keys_buffer,
+                                  gather_map_buffer,
+                                  num_rows,
+                                  0,
+                                  end_bit,
+                                  stream.value());
+
+  // The start of each partition is the first sorted row with that partition number
+  rmm::device_uvector<size_type> d_partition_offsets(num_partitions, stream);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      keys_buffer.Current(),
+                      keys_buffer.Current() + num_rows,
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(num_partitions),
+                      d_partition_offsets.begin());
+  auto const partition_offsets = cudf::detail::make_std_vector_async(d_partition_offsets, stream);
+
+  auto output = detail::gather(input,
+                               device_span<size_type const>{gather_map_buffer.Current(),
+                                                            static_cast<std::size_t>(num_rows)},
+                               out_of_bounds_policy::DONT_CHECK,
+                               detail::negative_index_policy::NOT_ALLOWED,
+                               stream,
+                               mr);
+
+  stream.synchronize();  // Async D2H copy must finish before returning host vec
+  return std::pair(std::move(output), std::move(partition_offsets));
+}
+
+// NOTE hash_has_nulls must be true if table_to_hash has nulls
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
+  table_view const& input,
+  table_view const& table_to_hash,
+  size_type num_partitions,
+  uint32_t seed,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = table_to_hash.num_rows();
+
+  bool const use_optimization{num_partitions <= THRESHOLD_FOR_OPTIMIZED_PARTITION_KERNEL};
+
+  if (not use_optimization && num_partitions <= THRESHOLD_FOR_RADIX_PARTITION) {
+    return radix_hash_partition_table<hash_function, hash_has_nulls>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  }
+
+  auto partitions = compute_row_partitions<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, seed, stream);
+
+  // NOTE grid_size is non-const to workaround lambda capture bug in gcc 5.4
+  auto grid_size                      = partitions.grid_size;
+  auto const block_size               = partitions.block_size;
+  auto& row_partition_numbers         = partitions.row_partition_numbers;
+  auto& row_partition_offset          = partitions.row_partition_offset;
+  auto& block_partition_sizes         = partitions.block_partition_sizes;
+  auto& scanned_block_partition_sizes = partitions.scanned_block_partition_sizes;
+
   // Copy the result of the exclusive scan to the output offsets array
   // to indicate the starting point for each partition in the output
   auto const partition_offsets =
-    cudf::detail::make_std_vector_async(global_partition_sizes, stream);
+    cudf::detail::make_std_vector_async(partitions.partition_offsets, stream);
 
   // When the number of partitions is less than a threshold, we can apply an
   // optimization using shared memory to copy values to the output buffer.
@@ -632,6 +828,191 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition_table(
   }
 }
 
+// Alignment of each buffer within a packed partition, matching contiguous_split
+constexpr std::size_t PACKED_BUFFER_ALIGNMENT = 64;
+
+/**
+ * @brief Scatters one fixed-width column into the per-partition packed buffers.
+ *
+ * Row `i` is written to row `row_destinations[i]` of partition
+ * `row_partition_numbers[i]`. Validity bits are set with atomics, so the
+ * destination null masks must be zero-initialized.
+ */
+struct scatter_to_partitions_dispatcher {
+  template <typename DataType, CUDF_ENABLE_IF(is_fixed_width<DataType>())>
+  void operator()(column_view const& input,
+                  size_type const* row_partition_numbers,
+                  size_type const* row_destinations,
+                  void* const* partition_data,
+                  bitmask_type* const* partition_null_masks,
+                  size_type* partition_null_counts,
+                  rmm::cuda_stream_view stream)
+  {
+    auto const d_input = column_device_view::create(input, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       input.size(),
+                       [d_input = *d_input,
+                        row_partition_numbers,
+                        row_destinations,
+                        partition_data,
+                        partition_null_masks,
+                        partition_null_counts] __device__(size_type row) {
+                         auto const partition   = row_partition_numbers[row];
+                         auto const destination = row_destinations[row];
+                         static_cast<DataType*>(partition_data[partition])[destination] =
+                           d_input.element<DataType>(row);
+                         if (not d_input.nullable()) { return; }
+                         if (d_input.is_valid_nocheck(row)) {
+                           set_bit(partition_null_masks[partition], destination);
+                         } else {
+                           atomicAdd(&partition_null_counts[partition], size_type{1});
+                         }
+                       });
+  }
+
+  template <typename DataType, typename... Args>
+  std::enable_if_t<not is_fixed_width<DataType>()> operator()(Args&&...)
+  {
+    CUDF_FAIL("Unsupported type for fused partition and pack.");
+  }
+};
+
+/**
+ * @brief Hash partitions a table of fixed-width columns directly into one
+ * packed buffer per partition.
+ *
+ * Each partition's buffer holds the data of every column followed by the null
+ * masks of the nullable columns, each aligned to `PACKED_BUFFER_ALIGNMENT`,
+ * and is described by `pack_metadata` so that `unpack` can read it.
+ *
+ * NOTE hash_has_nulls must be true if table_to_hash has nulls
+ */
+template <template <typename> class hash_function, bool hash_has_nulls>
+std::vector<packed_columns> hash_partition_and_pack_table(table_view const& input,
+                                                          table_view const& table_to_hash,
+                                                          size_type num_partitions,
+                                                          uint32_t seed,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr)
+{
+  auto const num_rows    = input.num_rows();
+  auto const num_columns = input.num_columns();
+
+  auto const partitions = compute_row_partitions<hash_function, hash_has_nulls>(
+    table_to_hash, num_partitions, seed, stream);
+
+  // Compute the row of each input row within its partition from the block
+  // histograms, the same location the shared memory copy kernels would use
+  rmm::device_uvector<size_type> row_destinations(num_rows, stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    row_destinations.begin(),
+    [row_partition_numbers         = partitions.row_partition_numbers.data(),
+     row_partition_offset          = partitions.row_partition_offset.data(),
+     scanned_block_partition_sizes = partitions.scanned_block_partition_sizes.data(),
+     partition_offsets             = partitions.partition_offsets.data(),
+     grid_size                     = partitions.grid_size,
+     block_size                    = partitions.block_size] __device__(size_type row) {
+      auto const partition = row_partition_numbers[row];
+      auto const block     = (row % (grid_size * block_size)) / block_size;
+      return scanned_block_partition_sizes[partition * grid_size + block] +
+             row_partition_offset[row] - partition_offsets[partition];
+    });
+
+  auto partition_offsets = cudf::detail::make_std_vector_sync(partitions.partition_offsets, stream);
+  partition_offsets.push_back(num_rows);
+
+  // Lay out each partition's buffer: column data first, then the null masks
+  // so that all masks of a partition can be cleared with a single memset
+  std::vector<std::size_t> data_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> mask_offsets(num_columns * num_partitions);
+  std::vector<std::size_t> masks_begin(num_partitions);
+  std::vector<std::size_t> buffer_sizes(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_rows = partition_offsets[p + 1] - partition_offsets[p];
+    std::size_t size          = 0;
+    for (size_type c = 0; c < num_columns; ++c) {
+      data_offsets[c * num_partitions + p] = size;
+      size += util::round_up_safe(partition_rows * size_of(input.column(c).type()),
+                                  PACKED_BUFFER_ALIGNMENT);
+    }
+    masks_begin[p] = size;
+    for (size_type c = 0; c < num_columns; ++c) {
+      if (not input.column(c).nullable()) { continue; }
+      mask_offsets[c * num_partitions + p] = size;
+      size += bitmask_allocation_size_bytes(partition_rows);
+    }
+    buffer_sizes[p] = size;
+  }
+
+  std::vector<std::unique_ptr<rmm::device_buffer>> buffers(num_partitions);
+  std::vector<void*> h_partition_data(num_columns * num_partitions);
+  std::vector<bitmask_type*> h_partition_null_masks(num_columns * num_partitions, nullptr);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    buffers[p] = std::make_unique<rmm::device_buffer>(buffer_sizes[p], stream, mr);
+    auto const base = static_cast<uint8_t*>(buffers[p]->data());
+    if (buffer_sizes[p] > masks_begin[p]) {
+      CUDF_CUDA_TRY(cudaMemsetAsync(
+        base + masks_begin[p], 0, buffer_sizes[p] - masks_begin[p], stream.value()));
+    }
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const idx        = c * num_partitions + p;
+      h_partition_data[idx] = base + data_offsets[idx];
+      if (input.column(c).nullable()) {
+        h_partition_null_masks[idx] = reinterpret_cast<bitmask_type*>(base + mask_offsets[idx]);
+      }
+    }
+  }
+
+  auto const partition_data = cudf::detail::make_device_uvector_async(
+    h_partition_data, stream, rmm::mr::get_current_device_resource());
+  auto const partition_null_masks = cudf::detail::make_device_uvector_async(
+    h_partition_null_masks, stream, rmm::mr::get_current_device_resource());
+  auto partition_null_counts = cudf::detail::make_zeroed_device_uvector_async<size_type>(
+    num_columns * num_partitions, stream, rmm::mr::get_current_device_resource());
+
+  // Scatter every column straight into its slot of each partition's buffer
+  for (size_type c = 0; c < num_columns; ++c) {
+    auto const idx = c * num_partitions;
+    cudf::type_dispatcher<dispatch_storage_type>(input.column(c).type(),
+                                                 scatter_to_partitions_dispatcher{},
+                                                 input.column(c),
+                                                 partitions.row_partition_numbers.data(),
+                                                 row_destinations.data(),
+                                                 partition_data.data() + idx,
+                                                 partition_null_masks.data() + idx,
+                                                 partition_null_counts.data() + idx,
+                                                 stream);
+  }
+
+  auto const null_counts = cudf::detail::make_std_vector_sync(partition_null_counts, stream);
+
+  std::vector<packed_columns> result;
+  result.reserve(num_partitions);
+  for (size_type p = 0; p < num_partitions; ++p) {
+    auto const partition_rows = partition_offsets[p + 1] - partition_offsets[p];
+    std::vector<column_view> columns;
+    columns.reserve(num_columns);
+    for (size_type c = 0; c < num_columns; ++c) {
+      auto const idx = c * num_partitions + p;
+      columns.emplace_back(input.column(c).type(),
+                           partition_rows,
+                           partition_rows > 0 ? h_partition_data[idx] : nullptr,
+                           partition_rows > 0 ? h_partition_null_masks[idx] : nullptr,
+                           null_counts[idx]);
+    }
+    auto metadata = std::make_unique<std::vector<uint8_t>>(
+      pack_metadata(table_view{columns},
+                    static_cast<uint8_t const*>(buffers[p]->data()),
+                    buffers[p]->size()));
+    result.emplace_back(std::move(metadata), std::move(buffers[p]));
+  }
+  return result;
+}
+
 struct dispatch_map_type {
   /**
    * @brief Partitions the table `t` according to the `partition_map`.
@@ -779,6 +1160,48 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
       input, table_to_hash, num_partitions, seed, stream, mr);
   }
 }
+
+template <template <typename> class hash_function>
+std::vector<packed_columns> partition_and_pack(table_view const& input,
+                                               std::vector<size_type> const& columns_to_hash,
+                                               int num_partitions,
+                                               uint32_t seed,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  auto table_to_hash = input.select(columns_to_hash);
+
+  if (num_partitions <= 0) { return {}; }
+
+  // The fused path writes each row once; tables it cannot handle (and trivial
+  // inputs) are partitioned and then split into packed partitions
+  auto const is_fused_supported =
+    input.num_rows() > 0 && table_to_hash.num_columns() > 0 &&
+    std::all_of(input.begin(), input.end(), [](auto const& col) {
+      return is_fixed_width(col.type());
+    });
+  if (not is_fused_supported) {
+    auto [partitioned, offsets] = hash_partition<hash_function>(
+      input, columns_to_hash, num_partitions, seed, stream, rmm::mr::get_current_device_resource());
+    auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+    auto packed_tables = cudf::detail::contiguous_split(partitioned->view(), splits, stream, mr);
+    std::vector<packed_columns> result;
+    result.reserve(packed_tables.size());
+    std::transform(packed_tables.begin(),
+                   packed_tables.end(),
+                   std::back_inserter(result),
+                   [](auto& packed) { return std::move(packed.data); });
+    return result;
+  }
+
+  if (has_nested_nulls(table_to_hash)) {
+    return hash_partition_and_pack_table<hash_function, true>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  } else {
+    return hash_partition_and_pack_table<hash_function, false>(
+      input, table_to_hash, num_partitions, seed, stream, mr);
+  }
+}
 }  // namespace
 
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
@@ -800,6 +1223,63 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   return cudf::type_dispatcher(
     partition_map.type(), dispatch_map_type{}, t, partition_map, num_partitions, stream, mr);
 }
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& sorted_boundaries,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  auto const keys = input.select(key_columns);
+  CUDF_EXPECTS(keys.num_columns() == sorted_boundaries.num_columns(),
+               "Mismatch in number of columns between the keys and the boundaries.",
+               std::invalid_argument);
+
+  // The partition of a row is the number of boundaries that are not greater than its keys, which
+  // are all found with one batched search
+  auto const partition_map = detail::upper_bound(sorted_boundaries,
+                                                 keys,
+                                                 column_order,
+                                                 null_precedence,
+                                                 stream,
+                                                 rmm::mr::get_current_device_resource());
+  return detail::partition(
+    input, partition_map->view(), sorted_boundaries.num_rows() + 1, stream, mr);
+}
+
+std::unique_ptr<table> range_partition_boundaries(table_view const& sample,
+                                                  size_type num_partitions,
+                                                  std::vector<order> const& column_order,
+                                                  std::vector<null_order> const& null_precedence,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(
+    num_partitions > 0, "The number of partitions must be positive.", std::invalid_argument);
+
+  auto const num_rows = sample.num_rows();
+  if (num_partitions == 1 or num_rows == 0) { return empty_like(sample); }
+
+  // Boundary `i` is the row of rank `(i + 1) * num_rows / num_partitions` of the sorted sample, so
+  // only the boundaries are gathered rather than the whole sorted sample
+  auto const sorted_indices = detail::sorted_order(
+    sample, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  auto const boundary_map = cudf::detail::make_counting_transform_iterator(
+    1,
+    cuda::proclaim_return_type<size_type>([sorted = sorted_indices->view().begin<size_type>(),
+                                           num_rows,
+                                           num_partitions] __device__(size_type i) {
+      return sorted[static_cast<int64_t>(i) * num_rows / num_partitions];
+    }));
+  return detail::gather(sample,
+                        boundary_map,
+                        boundary_map + (num_partitions - 1),
+                        out_of_bounds_policy::DONT_CHECK,
+                        stream,
+                        mr);
+}
 }  // namespace detail
 
 // Partition based on hash values
@@ -829,6 +1309,59 @@ std::pair<std::unique_ptr<table>, std::vector<size_type>> hash_partition(
   }
 }
 
+// Partition based on hash values directly into packed partitions
+std::vector<packed_columns> partition_and_pack(table_view const& input,
+                                               std::vector<size_type> const& columns_to_hash,
+                                               int num_partitions,
+                                               hash_id hash_function,
+                                               uint32_t seed,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  switch (hash_function) {
+    case (hash_id::HASH_IDENTITY):
+      for (size_type const& column_id : columns_to_hash) {
+        if (!is_numeric(input.column(column_id).type()))
+          CUDF_FAIL("IdentityHash does not support this data type");
+      }
+      return detail::partition_and_pack<cudf::detail::IdentityHash>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    case (hash_id::HASH_MURMUR3):
+      return detail::partition_and_pack<cudf::hashing::detail::MurmurHash3_x86_32>(
+        input, columns_to_hash, num_partitions, seed, stream, mr);
+    default: CUDF_FAIL("Unsupported hash function in partition_and_pack");
+  }
+}
+
+// Partition based on ranges of key values
+std::pair<std::unique_ptr<table>, std::vector<size_type>> range_partition(
+  table_view const& input,
+  std::vector<size_type> const& key_columns,
+  table_view const& sorted_boundaries,
+  std::vector<order> const& column_order,
+  std::vector<null_order> const& null_precedence,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition(
+    input, key_columns, sorted_boundaries, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> range_partition_boundaries(table_view const& sample,
+                                                  size_type num_partitions,
+                                                  std::vector<order> const& column_order,
+                                                  std::vector<null_order> const& null_precedence,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::range_partition_boundaries(
+    sample, num_partitions, column_order, null_precedence, stream, mr);
+}
+
 // Partition based on an explicit partition map
 std::pair<std::unique_ptr<table>, std::vector<size_type>> partition(
   table_view const& t,
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "partitioning/spill_partitions.hpp"
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/partitioning.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <algorithm>
+
+namespace cudf {
+namespace detail {
+
+std::vector<std::vector<spilled_table>> spill_hash_partitions(
+  table_view const& input,
+  std::vector<size_type> const& key_indices,
+  size_type num_partitions,
+  bool append_row_indices,
+  uint32_t seed,
+  rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+
+  std::vector<std::vector<spilled_table>> partitions(num_partitions);
+  auto const num_rows   = input.num_rows();
+  auto const slice_size =
+    std::max(size_type{1}, util::div_rounding_up_safe(num_rows, num_partitions));
+  for (size_type begin = 0; begin < num_rows; begin += std::min(slice_size, num_rows - begin)) {
+    auto const end   = begin + std::min(slice_size, num_rows - begin);
+    auto const slice = cudf::detail::slice(input, {begin, end}, stream).front();
+
+    std::vector<column_view> columns(slice.begin(), slice.end());
+    std::unique_ptr<column> row_indices;
+    if (append_row_indices) {
+      row_indices = cudf::detail::sequence(
+        end - begin, numeric_scalar<size_type>(begin, true, stream), stream, mr);
+      columns.push_back(row_indices->view());
+    }
+    auto const [partitioned, offsets] = cudf::hash_partition(
+      table_view{columns}, key_indices, num_partitions, hash_id::HASH_MURMUR3, seed, stream, mr);
+
+    auto const splits = std::vector<size_type>(offsets.begin() + 1, offsets.end());
+    auto packed       = cudf::detail::contiguous_split(partitioned->view(), splits, stream, mr);
+    for (size_type p = 0; p < num_partitions; ++p) {
+      if (packed[p].table.num_rows() == 0) { continue; }
+      auto const& gpu_data = *packed[p].data.gpu_data;
+      spilled_table part{std::move(*packed[p].data.metadata),
+                         std::vector<uint8_t>(gpu_data.size())};
+      CUDF_CUDA_TRY(cudaMemcpyAsync(part.data.data(),
+                                    gpu_data.data(),
+                                    gpu_data.size(),
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      partitions[p].push_back(std::move(part));
+    }
+    // The device copies of the slice are released once the spilled parts have been copied
+    stream.synchronize();
+  }
+  return partitions;
+}
+
+std::unique_ptr<table> unspill_partition(host_span<spilled_table const> parts,
+                                         rmm::cuda_stream_view stream)
+{
+  auto const mr = rmm::mr::get_current_device_resource();
+  std::vector<rmm::device_buffer> buffers;
+  buffers.reserve(parts.size());
+  std::vector<table_view> views;
+  for (auto const& part : parts) {
+    auto const& buffer = buffers.emplace_back(part.data.data(), part.data.size(), stream, mr);
+    views.push_back(
+      cudf::unpack(part.metadata.data(), static_cast<uint8_t const*>(buffer.data())));
+  }
+  return cudf::detail::concatenate(views, stream, mr);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Part of a partition that has been spilled to host memory.
+ */
+struct spilled_table {
+  std::vector<uint8_t> metadata;  ///< Metadata of the packed table
+  std::vector<uint8_t> data;      ///< Host copy of the packed device data
+};
+
+/**
+ * @brief Hash-partitions a table in slices of rows and spills the partitions to host memory.
+ *
+ * Only one slice of the input is in device memory at a time, so the input may be larger than
+ * the free device memory if it is in host-accessible memory.
+ *
+ * @param input The table to partition
+ * @param key_indices The indices of the columns of `input` to hash
+ * @param num_partitions The number of partitions
+ * @param append_row_indices If true, a column of the row indices of `input` is appended to the
+ * columns of the spilled partitions
+ * @param seed The seed of the partitioning hash
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The spilled parts of each partition
+ */
+std::vector<std::vector<spilled_table>> spill_hash_partitions(
+  table_view const& input,
+  std::vector<size_type> const& key_indices,
+  size_type num_partitions,
+  bool append_row_indices,
+  uint32_t seed,
+  rmm::cuda_stream_view stream);
+
+/**
+ * @brief Copies the parts of a spilled partition back to device memory as a single table.
+ *
+ * @param parts The spilled parts of the partition
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The partition
+ */
+std::unique_ptr<table> unspill_partition(host_span<spilled_table const> parts,
+                                         rmm::cuda_stream_view stream);
+
+}  // namespace detail
+}  // namespace cudf
@@ -20,6 +20,8 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/detail/valid_if.cuh>
@@ -36,12 +38,21 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
+#include <thrust/distance.h>
+#include <thrust/gather.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/permutation_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace cudf {
@@ -187,6 +198,262 @@ std::unique_ptr<column> quantile(column_view const& input,
   }
 }
 
+namespace {
+
+// Columns up to this size are simply sorted; selection only pays off on larger inputs
+constexpr size_type full_sort_threshold = 1 << 16;
+// Number of evenly spaced values sampled to estimate the value at each requested rank
+constexpr size_type num_samples = 1 << 14;
+// Samples kept on either side of a rank's estimated position to bracket its value
+constexpr size_type sample_margin = 256;
+// Selecting more ranks than this costs more passes over the data than one sort
+constexpr std::size_t max_selected_ranks = 16;
+
+// Orders NaN after every other value, matching `sorted_order`
+template <typename T>
+struct nan_last_less {
+  __device__ bool operator()(T lhs, T rhs) const
+  {
+    if constexpr (std::is_floating_point_v<T>) {
+      if (std::isnan(rhs)) { return !std::isnan(lhs); }
+      if (std::isnan(lhs)) { return false; }
+    }
+    return lhs < rhs;
+  }
+};
+
+template <typename T>
+struct less_than_fn {
+  T bound;
+  __device__ bool operator()(T value) const { return nan_last_less<T>{}(value, bound); }
+};
+
+template <typename T>
+struct in_bucket_fn {
+  T lower;
+  T upper;
+  bool has_lower;
+  bool has_upper;
+  __device__ bool operator()(T value) const
+  {
+    auto const less = nan_last_less<T>{};
+    return not(has_lower and less(value, lower)) and not(has_upper and less(upper, value));
+  }
+};
+
+// Position in the data of each evenly spaced sample
+struct sample_index_fn {
+  size_type size;
+  __device__ size_type operator()(size_type i) const
+  {
+    return static_cast<size_type>(static_cast<int64_t>(i) * size / num_samples);
+  }
+};
+
+// Value of each selected rank, looked up from the sorted list of selected ranks
+template <typename T>
+struct ranked_value_fn {
+  size_type const* ranks;
+  T const* values;
+  size_type num_ranks;
+  __device__ T operator()(size_type rank) const
+  {
+    auto const it = thrust::lower_bound(thrust::seq, ranks, ranks + num_ranks, rank);
+    return values[thrust::distance(ranks, it)];
+  }
+};
+
+/**
+ * @brief Finds the values at the given ranks of the sorted data without sorting all of it.
+ *
+ * An evenly spaced sample of the data is sorted to bracket the value of each rank between two
+ * sampled values. The data in that bucket is then sorted to find the exact value, after counting
+ * how many values come before the bucket. A rank whose bucket turns out to miss it, which can
+ * happen with skewed data, falls back to sorting all the data.
+ *
+ * @param data The values to select from
+ * @param size The number of values
+ * @param ranks Sorted, unique ranks to select
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The value of each rank
+ */
+template <typename T>
+rmm::device_uvector<T> select_ranks(T const* data,
+                                    size_type size,
+                                    std::vector<size_type> const& ranks,
+                                    rmm::cuda_stream_view stream)
+{
+  auto const policy = rmm::exec_policy(stream);
+  auto const less   = nan_last_less<T>{};
+  auto result       = rmm::device_uvector<T>(ranks.size(), stream);
+  auto resolved     = std::vector<bool>(ranks.size(), false);
+
+  if (size > full_sort_threshold and ranks.size() <= max_selected_ranks) {
+    auto samples = rmm::device_uvector<T>(num_samples, stream);
+    auto const sample_map =
+      cudf::detail::make_counting_transform_iterator(0, sample_index_fn{size});
+    thrust::gather(policy, sample_map, sample_map + num_samples, data, samples.begin());
+    thrust::sort(policy, samples.begin(), samples.end(), less);
+    auto const h_samples = cudf::detail::make_std_vector_sync(samples, stream);
+
+    for (std::size_t r = 0; r < ranks.size(); ++r) {
+      if (resolved[r]) { continue; }
+      auto const estimate =
+        static_cast<size_type>(static_cast<double>(ranks[r]) / size * num_samples);
+      auto const lower_idx = std::max(estimate - sample_margin, 0);
+      auto const upper_idx = std::min(estimate + sample_margin, num_samples - 1);
+      auto const in_bucket = in_bucket_fn<T>{
+        h_samples[lower_idx], h_samples[upper_idx], lower_idx > 0, upper_idx < num_samples - 1};
+
+      auto const num_before =
+        in_bucket.has_lower
+          ? static_cast<size_type>(
+              thrust::count_if(policy, data, data + size, less_than_fn<T>{in_bucket.lower}))
+          : 0;
+      if (ranks[r] < num_before) { continue; }
+      auto const bucket_size =
+        static_cast<size_type>(thrust::count_if(policy, data, data + size, in_bucket));
+      if (ranks[r] >= num_before + bucket_size) { continue; }
+
+      auto bucket = rmm::device_uvector<T>(bucket_size, stream);
+      thrust::copy_if(policy, data, data + size, bucket.begin(), in_bucket);
+      thrust::sort(policy, bucket.begin(), bucket.end(), less);
+
+      // the bucket may also hold the values of other requested ranks
+      for (auto other = r; other < ranks.size() and ranks[other] < num_before + bucket_size;
+           ++other) {
+        if (resolved[other]) { continue; }
+        CUDF_CUDA_TRY(cudaMemcpyAsync(result.data() + other,
+                                      bucket.data() + (ranks[other] - num_before),
+                                      sizeof(T),
+                                      cudaMemcpyDefault,
+                                      stream.value()));
+        resolved[other] = true;
+      }
+    }
+  }
+
+  if (std::all_of(resolved.begin(), resolved.end(), [](bool r) { return r; })) { return result; }
+
+  auto sorted = rmm::device_uvector<T>(size, stream);
+  thrust::copy(policy, data, data + size, sorted.begin());
+  thrust::sort(policy, sorted.begin(), sorted.end(), less);
+  auto const d_ranks =
+    cudf::detail::make_device_uvector_async(ranks, stream, rmm::mr::get_current_device_resource());
+  thrust::gather(policy, d_ranks.begin(), d_ranks.end(), sorted.begin(), result.begin());
+  return result;
+}
+
+template <bool exact>
+struct quantile_selection_functor {
+  std::vector<double> const& q;
+  interpolation interp;
+  rmm::cuda_stream_view stream;
+  rmm::device_async_resource_ref mr;
+
+  template <typename T>
+  std::enable_if_t<not std::is_arithmetic_v<T> and not cudf::is_fixed_point<T>(),
+                   std::unique_ptr<column>>
+  operator()(column_view const& input)
+  {
+    CUDF_FAIL("quantile does not support non-numeric types");
+  }
+
+  template <typename T>
+  std::enable_if_t<std::is_arithmetic_v<T> or cudf::is_fixed_point<T>(), std::unique_ptr<column>>
+  operator()(column_view const& input)
+  {
+    using StorageType   = cudf::device_storage_type_t<T>;
+    using ExactResult   = std::conditional_t<exact and not cudf::is_fixed_point<T>(), double, T>;
+    using StorageResult = cudf::device_storage_type_t<ExactResult>;
+
+    auto const type =
+      is_fixed_point(input.type()) ? input.type() : data_type{type_to_id<StorageResult>()};
+    auto output = make_fixed_width_column(type, q.size(), mask_state::UNALLOCATED, stream, mr);
+    if (output->size() == 0) { return output; }
+
+    auto const size = input.size() - input.null_count();
+    if (size == 0) {
+      auto mask = cudf::detail::create_null_mask(output->size(), mask_state::ALL_NULL, stream, mr);
+      output->set_null_mask(std::move(mask), output->size());
+      return output;
+    }
+
+    // the quantiles only depend on the valid values
+    auto valid_values = rmm::device_uvector<StorageType>(0, stream);
+    auto data         = input.data<StorageType>();
+    if (input.has_nulls()) {
+      auto const d_input = column_device_view::create(input, stream);
+      valid_values.resize(size, stream);
+      thrust::copy_if(rmm::exec_policy(stream),
+                      data,
+                      data + input.size(),
+                      thrust::make_counting_iterator<size_type>(0),
+                      valid_values.begin(),
+                      cuda::proclaim_return_type<bool>([d_input = *d_input] __device__(
+                                                         size_type idx) {
+                        return d_input.is_valid_nocheck(idx);
+                      }));
+      data = valid_values.data();
+    }
+
+    // the ranks whose values are needed to interpolate the quantiles
+    std::vector<size_type> ranks;
+    for (auto const value : q) {
+      auto const idx = quantile_index(size, value);
+      ranks.insert(ranks.end(), {idx.lower, idx.higher, idx.nearest});
+    }
+    std::sort(ranks.begin(), ranks.end());
+    ranks.erase(std::unique(ranks.begin(), ranks.end()), ranks.end());
+
+    auto const values  = select_ranks(data, size, ranks, stream);
+    auto const d_ranks = cudf::detail::make_device_uvector_async(
+      ranks, stream, rmm::mr::get_current_device_resource());
+    auto const q_device =
+      cudf::detail::make_device_uvector_sync(q, stream, rmm::mr::get_current_device_resource());
+
+    auto const sorted_data = cudf::detail::make_counting_transform_iterator(
+      0,
+      ranked_value_fn<StorageType>{
+        d_ranks.data(), values.data(), static_cast<size_type>(ranks.size())});
+    thrust::transform(rmm::exec_policy(stream),
+                      q_device.begin(),
+                      q_device.end(),
+                      output->mutable_view().template begin<StorageResult>(),
+                      cuda::proclaim_return_type<StorageResult>(
+                        [sorted_data, interp = interp, size] __device__(double q) {
+                          return select_quantile_data<StorageResult>(sorted_data, size, q, interp);
+                        }));
+    return output;
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> quantile_unsorted(column_view const& input,
+                                          std::vector<double> const& q,
+                                          interpolation interp,
+                                          bool exact,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  if (cudf::is_dictionary(input.type())) {
+    // dictionary keys are already sorted, so sorting the indices is as cheap as selecting
+    auto const sorted_indices = cudf::detail::sorted_order(
+      table_view{{input}}, {}, {null_order::AFTER}, stream, rmm::mr::get_current_device_resource());
+    auto const valid_sorted_indices =
+      cudf::detail::slice(*sorted_indices, {0, input.size() - input.null_count()}, stream)[0];
+    return quantile(input, q, interp, valid_sorted_indices, exact, stream, mr);
+  }
+
+  if (exact) {
+    return type_dispatcher(
+      input.type(), quantile_selection_functor<true>{q, interp, stream, mr}, input);
+  }
+  return type_dispatcher(
+    input.type(), quantile_selection_functor<false>{q, interp, stream, mr}, input);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> quantile(column_view const& input,
@@ -23,11 +23,12 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/get_value.cuh>
 #include <cudf/detail/iterator.cuh>
-#include <cudf/detail/merge.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/scalar/scalar.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -38,15 +39,16 @@
 #include <cuda/functional>
 #include <thrust/advance.h>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/iterator/zip_iterator.h>
-#include <thrust/merge.h>
 #include <thrust/pair.h>
 #include <thrust/reduce.h>
 #include <thrust/remove.h>
@@ -55,6 +57,10 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 namespace cudf {
 namespace tdigest {
 namespace detail {
@@ -1021,6 +1027,143 @@ struct group_key_func {
   }
 };
 
+// utility for merge_sorted_centroids: position of each run within its group.
+template <typename GroupOffsetsIter, typename GroupLabelsIter>
+struct run_local_index_func {
+  GroupOffsetsIter outer_offsets;
+  GroupLabelsIter group_labels;
+
+  __device__ size_type operator()(size_type run_index) const
+  {
+    return run_index - outer_offsets[group_labels[run_index]];
+  }
+};
+
+// utility for merge_sorted_centroids: moves each centroid to its position in the merge of its run
+// with the neighboring run of the same group. Runs at even positions within a group merge with
+// the following run; ties keep the centroids of the earlier run first.
+struct merge_adjacent_runs_func {
+  size_type const* run_offsets;
+  size_type const* run_local_index;
+  size_type num_runs;
+  double const* in_means;
+  double const* in_weights;
+  double* out_means;
+  double* out_weights;
+
+  __device__ void operator()(size_type index) const
+  {
+    auto const run_end =
+      thrust::upper_bound(thrust::seq, run_offsets, run_offsets + num_runs, index);
+    auto const run = static_cast<size_type>(thrust::distance(run_offsets, run_end) - 1);
+    auto const local = run_local_index[run];
+    auto const mean  = in_means[index];
+    auto const rank  = index - run_offsets[run];
+
+    auto const position = [&] {
+      if (local % 2 == 1) {
+        auto const other_begin = in_means + run_offsets[run - 1];
+        auto const other_end   = in_means + run_offsets[run];
+        auto const preceding   = thrust::upper_bound(thrust::seq, other_begin, other_end, mean);
+        return run_offsets[run - 1] + rank + static_cast<size_type>(preceding - other_begin);
+      }
+      auto const has_partner = run + 1 < num_runs && run_local_index[run + 1] == local + 1;
+      if (!has_partner) { return index; }
+      auto const other_begin = in_means + run_offsets[run + 1];
+      auto const other_end   = in_means + run_offsets[run + 2];
+      auto const preceding   = thrust::lower_bound(thrust::seq, other_begin, other_end, mean);
+      return index + static_cast<size_type>(preceding - other_begin);
+    }();
+
+    out_means[position]   = mean;
+    out_weights[position] = in_weights[index];
+  }
+};
+
+/**
+ * @brief Merges the centroids of the tdigests of each group into a single run sorted by mean.
+ *
+ * The centroids of each tdigest are already sorted, so rather than sorting them again, adjacent
+ * tdigests of a group are merged pairwise in rounds. In each round every centroid finds its output
+ * position with a binary search of the run it merges with, for all groups at once. The number of
+ * rounds is the log of the largest number of tdigests in a group.
+ */
+template <typename GroupOffsetIter, typename GroupLabelIter>
+std::pair<rmm::device_uvector<double>, rmm::device_uvector<double>> merge_sorted_centroids(
+  tdigest_column_view const& tdv,
+  GroupOffsetIter group_offsets,
+  GroupLabelIter group_labels,
+  size_type max_tdigests_per_group,
+  rmm::cuda_stream_view stream)
+{
+  auto const tdigest_offsets = tdv.centroids().offsets();
+  auto const num_centroids   = tdv.means().size();
+
+  auto means   = cudf::detail::make_device_uvector_async(
+    device_span<double const>{tdv.means().begin<double>(), static_cast<size_t>(num_centroids)},
+    stream,
+    rmm::mr::get_current_device_resource());
+  auto weights = cudf::detail::make_device_uvector_async(
+    device_span<double const>{tdv.weights().begin<double>(), static_cast<size_t>(num_centroids)},
+    stream,
+    rmm::mr::get_current_device_resource());
+  if (max_tdigests_per_group <= 1) { return {std::move(means), std::move(weights)}; }
+
+  auto num_runs    = tdigest_offsets.size() - 1;
+  auto run_offsets = rmm::device_uvector<size_type>(tdigest_offsets.size(), stream);
+  thrust::copy(rmm::exec_policy(stream),
+               tdigest_offsets.begin<size_type>(),
+               tdigest_offsets.end<size_type>(),
+               run_offsets.begin());
+  auto run_local_index = rmm::device_uvector<size_type>(num_runs, stream);
+  thrust::transform(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator(0),
+    thrust::make_counting_iterator(num_runs),
+    run_local_index.begin(),
+    run_local_index_func<GroupOffsetIter, GroupLabelIter>{group_offsets, group_labels});
+
+  auto merged_means   = rmm::device_uvector<double>(num_centroids, stream);
+  auto merged_weights = rmm::device_uvector<double>(num_centroids, stream);
+  for (auto runs_per_group = max_tdigests_per_group; runs_per_group > 1;
+       runs_per_group      = (runs_per_group + 1) / 2) {
+    thrust::for_each_n(rmm::exec_policy(stream),
+                       thrust::make_counting_iterator(0),
+                       num_centroids,
+                       merge_adjacent_runs_func{run_offsets.data(),
+                                                run_local_index.data(),
+                                                num_runs,
+                                                means.data(),
+                                                weights.data(),
+                                                merged_means.data(),
+                                                merged_weights.data()});
+    std::swap(means, merged_means);
+    std::swap(weights, merged_weights);
+
+    // each run at an even position now holds its merge with the following run
+    auto next_run_offsets     = rmm::device_uvector<size_type>(num_runs + 1, stream);
+    auto next_run_local_index = rmm::device_uvector<size_type>(num_runs, stream);
+    auto const merged_local   = thrust::make_transform_iterator(
+      run_local_index.begin(),
+      cuda::proclaim_return_type<size_type>([] __device__(size_type local) { return local / 2; }));
+    auto const input_runs  = thrust::make_zip_iterator(run_offsets.begin(), merged_local);
+    auto const output_runs =
+      thrust::make_zip_iterator(next_run_offsets.begin(), next_run_local_index.begin());
+    auto const output_runs_end =
+      thrust::copy_if(rmm::exec_policy(stream),
+                      input_runs,
+                      input_runs + num_runs,
+                      run_local_index.begin(),
+                      output_runs,
+                      [] __device__(size_type local) { return local % 2 == 0; });
+    num_runs = static_cast<size_type>(thrust::distance(output_runs, output_runs_end));
+    next_run_offsets.set_element(num_runs, num_centroids, stream);
+    run_offsets     = std::move(next_run_offsets);
+    run_local_index = std::move(next_run_local_index);
+  }
+  return {std::move(means), std::move(weights)};
+}
+
 template <typename HGroupOffsetIter, typename GroupOffsetIter, typename GroupLabelIter>
 std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
                                        HGroupOffsetIter h_outer_offsets,
@@ -1032,58 +1175,18 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
 {
-  // thrust::merge and thrust::merge_by_key don't provide what we need.  What we would need is an
-  // algorithm like a super-merge that takes two layers of keys: one which identifies the outer
-  // grouping of tdigests, and one which identifies the inner groupings of the tdigests within the
-  // outer groups.
-  // TODO: investigate replacing the iterative merge with a single stable_sort_by_key.
-
-  // bring tdigest offsets back to the host
-  auto tdigest_offsets = tdv.centroids().offsets();
-  std::vector<size_type> h_inner_offsets(tdigest_offsets.size());
-  cudaMemcpyAsync(h_inner_offsets.data(),
-                  tdigest_offsets.begin<size_type>(),
-                  sizeof(size_type) * tdigest_offsets.size(),
-                  cudaMemcpyDefault,
-                  stream);
-
-  stream.synchronize();
-
-  // extract all means and weights into a table
-  cudf::table_view tdigests_unsliced({tdv.means(), tdv.weights()});
+  // the largest number of tdigests in a group bounds the number of merge rounds
+  size_type max_tdigests_per_group = 0;
+  for (size_type group = 0; group < num_groups; ++group) {
+    max_tdigests_per_group =
+      std::max(max_tdigests_per_group,
+               static_cast<size_type>(h_outer_offsets[group + 1] - h_outer_offsets[group]));
+  }
 
   // generate the merged (but not yet compressed) tdigests for each group.
-  std::vector<std::unique_ptr<table>> tdigests;
-  tdigests.reserve(num_groups);
-  std::transform(h_outer_offsets,
-                 h_outer_offsets + num_groups,
-                 std::next(h_outer_offsets),
-                 std::back_inserter(tdigests),
-                 [&](auto tdigest_start, auto tdigest_end) {
-                   // the range of tdigests in this group
-                   auto const num_tdigests = tdigest_end - tdigest_start;
-
-                   // slice each tdigest from the input
-                   std::vector<table_view> unmerged_tdigests;
-                   unmerged_tdigests.reserve(num_tdigests);
-                   auto offset_iter = std::next(h_inner_offsets.begin(), tdigest_start);
-                   std::transform(
-                     offset_iter,
-                     offset_iter + num_tdigests,
-                     std::next(offset_iter),
-                     std::back_inserter(unmerged_tdigests),
-                     [&](size_type start, size_type end) {
-                       return cudf::detail::slice(tdigests_unsliced, {start, end}, stream);
-                     });
-
-                   // merge
-                   return cudf::detail::merge(unmerged_tdigests,
-                                              {0},
-                                              {order::ASCENDING},
-                                              {},
-                                              stream,
-                                              rmm::mr::get_current_device_resource());
-                 });
+  auto [merged_means, merged_weights] =
+    merge_sorted_centroids(tdv, group_offsets, group_labels, max_tdigests_per_group, stream);
+  auto tdigest_offsets = tdv.centroids().offsets();
 
   // generate min and max values
   auto merged_min_col = cudf::make_numeric_column(
@@ -1135,18 +1238,7 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
                      group_is_empty{},
                      0);
 
-  // concatenate all the merged tdigests back into one table.
-  std::vector<table_view> tdigest_views;
-  tdigest_views.reserve(num_groups);
-  std::transform(tdigests.begin(),
-                 tdigests.end(),
-                 std::back_inserter(tdigest_views),
-                 [](std::unique_ptr<table> const& t) { return t->view(); });
-  auto merged =
-    cudf::detail::concatenate(tdigest_views, stream, rmm::mr::get_current_device_resource());
-
   // generate cumulative weights
-  auto merged_weights     = merged->get_column(1).view();
   auto cumulative_weights = cudf::make_numeric_column(
     data_type{type_id::FLOAT64}, merged_weights.size(), mask_state::UNALLOCATED, stream);
   auto keys = cudf::detail::make_counting_transform_iterator(
@@ -1156,7 +1248,7 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
   thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
                                 keys,
                                 keys + cumulative_weights->size(),
-                                merged_weights.begin<double>(),
+                                merged_weights.begin(),
                                 cumulative_weights->mutable_view().begin<double>());
 
   auto const delta = max_centroids;
@@ -1184,14 +1276,13 @@ std::unique_ptr<column> merge_tdigests(tdigest_column_view const& tdv,
   // input centroid values
   auto centroids = cudf::detail::make_counting_transform_iterator(
     0,
-    make_weighted_centroid{merged->get_column(0).view().begin<double>(),
-                           merged_weights.begin<double>()});
+    make_weighted_centroid{merged_means.begin(), merged_weights.begin()});
 
   // compute the tdigest
   return compute_tdigests(
     delta,
     centroids,
-    centroids + merged->num_rows(),
+    centroids + merged_means.size(),
     cumulative_centroid_weight<decltype(group_labels), decltype(group_offsets)>{
       cumulative_weights->view().begin<double>(),
       group_labels,
@@ -1258,6 +1349,33 @@ std::unique_ptr<scalar> reduce_merge_tdigest(column_view const& input,
                            mr);
 }
 
+std::unique_ptr<column> update_tdigest(column_view const& tdigest,
+                                       column_view const& values,
+                                       int max_centroids,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  tdigest_column_view tdv(tdigest);
+  CUDF_EXPECTS(tdigest.size() == 1, "Only a single tdigest can be updated", std::invalid_argument);
+
+  // single row column holding the tdigest of a scalar
+  auto to_column = [stream](scalar const& digest, rmm::device_async_resource_ref mr) {
+    auto const tbl = static_cast<struct_scalar const&>(digest).view();
+    std::vector<std::unique_ptr<column>> children;
+    std::transform(
+      tbl.begin(), tbl.end(), std::back_inserter(children), [&](column_view const& col) {
+        return std::make_unique<column>(col, stream, mr);
+      });
+    return cudf::make_structs_column(1, std::move(children), 0, {}, stream, mr);
+  };
+
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+  auto const batch    = to_column(*reduce_tdigest(values, max_centroids, stream, temp_mr), temp_mr);
+  auto const combined =
+    cudf::detail::concatenate(std::vector<column_view>{tdigest, batch->view()}, stream, temp_mr);
+  return to_column(*reduce_merge_tdigest(*combined, max_centroids, stream, mr), mr);
+}
+
 std::unique_ptr<column> group_tdigest(column_view const& col,
                                       cudf::device_span<size_type const> group_offsets,
                                       cudf::device_span<size_type const> group_labels,
@@ -1297,12 +1415,7 @@ std::unique_ptr<column> group_merge_tdigest(column_view const& input,
   }
 
   // bring group offsets back to the host
-  std::vector<size_type> h_group_offsets(group_offsets.size());
-  cudaMemcpyAsync(h_group_offsets.data(),
-                  group_offsets.begin(),
-                  sizeof(size_type) * group_offsets.size(),
-                  cudaMemcpyDefault,
-                  stream);
+  auto const h_group_offsets = cudf::detail::make_std_vector_sync(group_offsets, stream);
 
   return merge_tdigests(tdv,
                         h_group_offsets.begin(),
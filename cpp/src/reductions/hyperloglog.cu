@@ -0,0 +1,367 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/hashing/detail/hashing.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/reduction/detail/hyperloglog.hpp>
+#include <cudf/reduction/detail/reduction_functions.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/atomic>
+#include <cuda/functional>
+#include <thrust/for_each.h>
+#include <thrust/iterator/constant_iterator.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
+#include <thrust/sequence.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
+
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace cudf::reduction::detail {
+
+namespace {
+
+// Registers are accumulated as 32-bit values, which have atomic support, and stored as 8-bit
+// values in the sketches: a register never exceeds 64 - precision + 1.
+using register_type         = int8_t;
+using accumulator_type      = int32_t;
+constexpr int min_precision = 4;
+constexpr int max_precision = 18;
+
+void validate_precision(int precision)
+{
+  CUDF_EXPECTS(precision >= min_precision and precision <= max_precision,
+               "HyperLogLog precision must be in the range [4, 18]",
+               std::invalid_argument);
+}
+
+void validate_sketches(column_view const& sketches)
+{
+  CUDF_EXPECTS(sketches.type().id() == type_id::LIST and
+                 lists_column_view{sketches}.child().type().id() == type_id::INT8,
+               "HyperLogLog sketches must be a LIST<INT8> column",
+               std::invalid_argument);
+}
+
+/**
+ * @brief Updates the register selected by the hash of each valid value with the position of the
+ * first set bit in the remaining bits of the hash
+ */
+template <typename LabelIterator>
+struct update_registers_fn {
+  uint64_t const* hashes;
+  column_device_view values;
+  LabelIterator group_labels;
+  size_type num_groups;
+  int precision;
+  accumulator_type* registers;
+
+  __device__ void operator()(size_type idx) const
+  {
+    auto const label = group_labels[idx];
+    if (label >= num_groups or values.is_null(idx)) { return; }
+    auto const hash     = hashes[idx];
+    auto const reg      = hash >> (64 - precision);
+    // The sentinel bit bounds the rank of a hash whose remaining bits are all zero
+    auto const rest     = (hash << precision) | (uint64_t{1} << (precision - 1));
+    auto const rank     = static_cast<accumulator_type>(__clzll(rest) + 1);
+    auto const num_regs = int64_t{1} << precision;
+    cuda::atomic_ref<accumulator_type, cuda::thread_scope_device> ref{
+      registers[label * num_regs + reg]};
+    ref.fetch_max(rank, cuda::std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @brief Takes the maximum of each register over the sketches of each group
+ */
+template <typename LabelIterator>
+struct merge_registers_fn {
+  column_device_view sketches;
+  size_type const* offsets;
+  register_type const* input_registers;
+  LabelIterator group_labels;
+  size_type num_groups;
+  int precision;
+  accumulator_type* registers;
+
+  __device__ void operator()(int64_t idx) const
+  {
+    auto const num_regs = int64_t{1} << precision;
+    auto const row      = static_cast<size_type>(idx / num_regs);
+    auto const reg      = idx % num_regs;
+    auto const label    = group_labels[row];
+    if (label >= num_groups or sketches.is_null(row)) { return; }
+    auto const value = static_cast<accumulator_type>(input_registers[offsets[row] + reg]);
+    if (value == 0) { return; }
+    cuda::atomic_ref<accumulator_type, cuda::thread_scope_device> ref{
+      registers[label * num_regs + reg]};
+    ref.fetch_max(value, cuda::std::memory_order_relaxed);
+  }
+};
+
+/**
+ * @brief Estimates the number of distinct values summarized by each sketch
+ */
+struct estimate_fn {
+  size_type const* offsets;
+  register_type const* registers;
+
+  __device__ int64_t operator()(size_type row) const
+  {
+    auto const begin    = offsets[row];
+    auto const num_regs = offsets[row + 1] - begin;
+    if (num_regs == 0) { return 0; }
+
+    double sum           = 0.0;
+    size_type num_zeroes = 0;
+    for (auto i = 0; i < num_regs; ++i) {
+      auto const value = registers[begin + i];
+      sum += exp2(-static_cast<double>(value));
+      num_zeroes += (value == 0);
+    }
+
+    auto const m     = static_cast<double>(num_regs);
+    auto const alpha = num_regs == 16   ? 0.673
+                       : num_regs == 32 ? 0.697
+                       : num_regs == 64 ? 0.709
+                                        : 0.7213 / (1.0 + 1.079 / m);
+    auto const raw   = alpha * m * m / sum;
+    // Linear counting is more accurate while many registers are still empty. No large range
+    // correction is needed with 64-bit hashes.
+    auto const estimate = (raw <= 2.5 * m and num_zeroes > 0) ? m * log(m / num_zeroes) : raw;
+    return llround(estimate);
+  }
+};
+
+/**
+ * @brief Stores the accumulated registers of each group as a `LIST<INT8>` column of sketches
+ */
+std::unique_ptr<column> make_sketches_column(rmm::device_uvector<accumulator_type> const& registers,
+                                             size_type num_groups,
+                                             int precision,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  auto const num_regs = size_type{1} << precision;
+  auto offsets        = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_groups + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::sequence(rmm::exec_policy_nosync(stream),
+                   offsets->mutable_view().begin<size_type>(),
+                   offsets->mutable_view().end<size_type>(),
+                   size_type{0},
+                   num_regs);
+
+  auto child = make_numeric_column(data_type{type_to_id<register_type>()},
+                                   static_cast<size_type>(registers.size()),
+                                   mask_state::UNALLOCATED,
+                                   stream,
+                                   mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    registers.begin(),
+                    registers.end(),
+                    child->mutable_view().begin<register_type>(),
+                    cuda::proclaim_return_type<register_type>([] __device__(accumulator_type v) {
+                      return static_cast<register_type>(v);
+                    }));
+
+  return make_lists_column(
+    num_groups, std::move(offsets), std::move(child), 0, rmm::device_buffer{}, stream, mr);
+}
+
+rmm::device_uvector<accumulator_type> make_registers(size_type num_groups,
+                                                     int precision,
+                                                     rmm::cuda_stream_view stream)
+{
+  auto const num_registers = static_cast<int64_t>(num_groups) << precision;
+  CUDF_EXPECTS(num_registers <= std::numeric_limits<size_type>::max(),
+               "Too many groups for the HyperLogLog sketches of this precision",
+               std::overflow_error);
+  rmm::device_uvector<accumulator_type> registers(num_registers, stream);
+  thrust::uninitialized_fill(
+    rmm::exec_policy_nosync(stream), registers.begin(), registers.end(), accumulator_type{0});
+  return registers;
+}
+
+template <typename LabelIterator>
+std::unique_ptr<column> compute_hyperloglog(column_view const& values,
+                                            LabelIterator group_labels,
+                                            size_type num_groups,
+                                            int precision,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  validate_precision(precision);
+  auto registers = make_registers(num_groups, precision, stream);
+  if (values.size() > 0) {
+    auto const hashes = cudf::hashing::detail::xxhash_64(
+      table_view{{values}}, 0, stream, rmm::mr::get_current_device_resource());
+    auto const d_values = column_device_view::create(values, stream);
+    thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                       thrust::counting_iterator<size_type>(0),
+                       values.size(),
+                       update_registers_fn<LabelIterator>{hashes->view().begin<uint64_t>(),
+                                                          *d_values,
+                                                          group_labels,
+                                                          num_groups,
+                                                          precision,
+                                                          registers.data()});
+  }
+  return make_sketches_column(registers, num_groups, precision, stream, mr);
+}
+
+template <typename LabelIterator>
+std::unique_ptr<column> compute_merge_hyperloglog(column_view const& sketches,
+                                                  LabelIterator group_labels,
+                                                  size_type num_groups,
+                                                  int precision,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  validate_precision(precision);
+  validate_sketches(sketches);
+  auto registers = make_registers(num_groups, precision, stream);
+  if (sketches.size() > 0) {
+    auto const lcv        = lists_column_view{sketches};
+    auto const d_sketches = column_device_view::create(sketches, stream);
+    auto const num_regs   = size_type{1} << precision;
+    CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                                thrust::counting_iterator<size_type>(0),
+                                thrust::counting_iterator<size_type>(sketches.size()),
+                                cuda::proclaim_return_type<bool>(
+                                  [d_sketches = *d_sketches,
+                                   offsets    = lcv.offsets_begin(),
+                                   num_regs] __device__(size_type row) {
+                                    return d_sketches.is_null(row) or
+                                           offsets[row + 1] - offsets[row] == num_regs;
+                                  })),
+                 "HyperLogLog sketches must have 2^precision registers",
+                 std::invalid_argument);
+    thrust::for_each_n(
+      rmm::exec_policy_nosync(stream),
+      thrust::counting_iterator<int64_t>(0),
+      static_cast<int64_t>(sketches.size()) << precision,
+      merge_registers_fn<LabelIterator>{*d_sketches,
+                                        lcv.offsets_begin(),
+                                        lcv.child().begin<register_type>(),
+                                        group_labels,
+                                        num_groups,
+                                        precision,
+                                        registers.data()});
+  }
+  return make_sketches_column(registers, num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<scalar> make_sketch_scalar(std::unique_ptr<column>&& sketches,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto registers = std::move(sketches->release().children[lists_column_view::child_column_index]);
+  return std::make_unique<list_scalar>(std::move(*registers), true, stream, mr);
+}
+
+}  // namespace
+
+std::unique_ptr<column> group_hyperloglog(column_view const& values,
+                                          device_span<size_type const> group_labels,
+                                          size_type num_groups,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  return compute_hyperloglog(values, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<column> group_merge_hyperloglog(column_view const& sketches,
+                                                device_span<size_type const> group_labels,
+                                                size_type num_groups,
+                                                int precision,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  return compute_merge_hyperloglog(
+    sketches, group_labels.begin(), num_groups, precision, stream, mr);
+}
+
+std::unique_ptr<scalar> hyperloglog(column_view const& input,
+                                    int precision,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  auto sketches = compute_hyperloglog(
+    input, thrust::make_constant_iterator(size_type{0}), 1, precision, stream, mr);
+  return make_sketch_scalar(std::move(sketches), stream, mr);
+}
+
+std::unique_ptr<scalar> merge_hyperloglog(column_view const& input,
+                                          int precision,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto sketches = compute_merge_hyperloglog(
+    input, thrust::make_constant_iterator(size_type{0}), 1, precision, stream, mr);
+  return make_sketch_scalar(std::move(sketches), stream, mr);
+}
+
+std::unique_ptr<column> approx_distinct_count(column_view const& sketches,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  validate_sketches(sketches);
+  auto result = make_numeric_column(data_type{type_id::INT64},
+                                    sketches.size(),
+                                    cudf::detail::copy_bitmask(sketches, stream, mr),
+                                    sketches.null_count(),
+                                    stream,
+                                    mr);
+  if (sketches.is_empty()) { return result; }
+
+  auto const lcv = lists_column_view{sketches};
+  thrust::tabulate(rmm::exec_policy_nosync(stream),
+                   result->mutable_view().begin<int64_t>(),
+                   result->mutable_view().end<int64_t>(),
+                   estimate_fn{lcv.offsets_begin(), lcv.child().begin<register_type>()});
+  return result;
+}
+
+}  // namespace cudf::reduction::detail
+
+namespace cudf {
+
+std::unique_ptr<column> approx_distinct_count(column_view const& sketches,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::approx_distinct_count(sketches, stream, mr);
+}
+
+}  // namespace cudf
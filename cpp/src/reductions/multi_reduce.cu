@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/reduction/detail/reduction_operators.cuh>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+/**
+ * @brief Partial results of all the fused reductions over a range of rows.
+ *
+ * `moments` holds the sum and the sum of squares of the values cast to double, from which the
+ * FLOAT64 `sum`, `sum_of_squares`, `mean`, `variance` and `std` reductions are computed. `sum`
+ * holds the sum of the values cast to `int64_t` for the integral `sum` reductions of an integral
+ * column.
+ */
+template <typename T>
+struct fused_partial {
+  T min;
+  T max;
+  int64_t sum;
+  var_std<double> moments;
+};
+
+template <typename T>
+CUDF_HOST_DEVICE inline fused_partial<T> fused_identity()
+{
+  return {DeviceMin::identity<T>(), DeviceMax::identity<T>(), 0, var_std<double>{}};
+}
+
+/**
+ * @brief Returns the partial results of a single row, or the identity if the row is null.
+ */
+template <typename T>
+struct fused_transformer {
+  column_device_view d_col;
+  bool has_nulls;
+
+  __device__ fused_partial<T> operator()(size_type idx) const
+  {
+    if (has_nulls and d_col.is_null_nocheck(idx)) { return fused_identity<T>(); }
+    auto const value = d_col.element<T>(idx);
+    auto const sum   = [&] {
+      if constexpr (std::is_integral_v<T>) { return static_cast<int64_t>(value); }
+      return int64_t{0};
+    }();
+    return {value, value, sum, transformer_var_std<double>{}(static_cast<double>(value))};
+  }
+};
+
+template <typename T>
+struct fused_binop {
+  __device__ fused_partial<T> operator()(fused_partial<T> const& lhs,
+                                         fused_partial<T> const& rhs) const
+  {
+    return {DeviceMin{}(lhs.min, rhs.min),
+            DeviceMax{}(lhs.max, rhs.max),
+            lhs.sum + rhs.sum,
+            lhs.moments + rhs.moments};
+  }
+};
+
+/**
+ * @brief Returns whether the reduction `agg` into `output_dtype` of a column of type `input_type`
+ * can be computed from the partial results of `fused_partial`.
+ */
+bool is_fusable(reduce_aggregation const& agg, data_type input_type, data_type output_dtype)
+{
+  if (not is_numeric(input_type) or input_type.id() == type_id::BOOL8) { return false; }
+  auto const float64_output = output_dtype.id() == type_id::FLOAT64;
+  switch (agg.kind) {
+    case aggregation::MIN:
+    case aggregation::MAX: return output_dtype == input_type;
+    case aggregation::SUM:
+      return float64_output or (is_integral(input_type) and is_integral(output_dtype) and
+                                output_dtype.id() != type_id::BOOL8);
+    case aggregation::SUM_OF_SQUARES:
+    case aggregation::MEAN:
+    case aggregation::VARIANCE:
+    case aggregation::STD: return float64_output;
+    default: return false;
+  }
+}
+
+/**
+ * @brief Creates a numeric scalar of type `output_dtype` holding `value`.
+ */
+struct make_numeric_result_fn {
+  template <typename OutputType, typename Value, CUDF_ENABLE_IF(is_numeric<OutputType>())>
+  std::unique_ptr<scalar> operator()(Value value,
+                                     bool is_valid,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    return std::make_unique<numeric_scalar<OutputType>>(
+      static_cast<OutputType>(value), is_valid, stream, mr);
+  }
+
+  template <typename OutputType, typename... Args>
+  std::enable_if_t<not is_numeric<OutputType>(), std::unique_ptr<scalar>> operator()(
+    Args&&...) const
+  {
+    CUDF_FAIL("Unsupported output data type");
+  }
+};
+
+/**
+ * @brief Computes the fusable reductions of a numeric column in a single pass.
+ */
+struct fused_reduce_fn {
+  template <typename T, CUDF_ENABLE_IF(is_numeric<T>() and not std::is_same_v<T, bool>)>
+  void operator()(column_view const& col,
+                  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+                  host_span<data_type const> output_dtypes,
+                  std::vector<bool> const& fused,
+                  std::vector<std::unique_ptr<scalar>>& results,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr) const
+  {
+    auto const d_col   = column_device_view::create(col, stream);
+    auto const partial = thrust::transform_reduce(rmm::exec_policy(stream),
+                                                  thrust::counting_iterator<size_type>(0),
+                                                  thrust::counting_iterator<size_type>(col.size()),
+                                                  fused_transformer<T>{*d_col, col.has_nulls()},
+                                                  fused_identity<T>(),
+                                                  fused_binop<T>{});
+
+    auto const valid_count = col.size() - col.null_count();
+    auto const is_valid    = valid_count > 0;
+    for (std::size_t i = 0; i < aggs.size(); ++i) {
+      if (not fused[i]) { continue; }
+      auto const& agg   = *aggs[i];
+      auto const result = [&](auto value) {
+        return type_dispatcher(
+          output_dtypes[i], make_numeric_result_fn{}, value, is_valid, stream, mr);
+      };
+      switch (agg.kind) {
+        case aggregation::MIN: results[i] = result(partial.min); break;
+        case aggregation::MAX: results[i] = result(partial.max); break;
+        case aggregation::SUM:
+          results[i] = output_dtypes[i].id() == type_id::FLOAT64 ? result(partial.moments.value)
+                                                                 : result(partial.sum);
+          break;
+        case aggregation::SUM_OF_SQUARES: results[i] = result(partial.moments.value_squared); break;
+        case aggregation::MEAN:
+          results[i] = result(op::mean::intermediate<double>::compute_result(
+            partial.moments.value, valid_count, 0));
+          break;
+        case aggregation::VARIANCE: {
+          auto const ddof = static_cast<cudf::detail::var_aggregation const&>(agg)._ddof;
+          results[i]      = result(op::variance::intermediate<double>::compute_result(
+            partial.moments, valid_count, ddof));
+          break;
+        }
+        case aggregation::STD: {
+          auto const ddof = static_cast<cudf::detail::std_aggregation const&>(agg)._ddof;
+          results[i]      = result(op::standard_deviation::intermediate<double>::compute_result(
+            partial.moments, valid_count, ddof));
+          break;
+        }
+        default: CUDF_FAIL("Unsupported fused reduction");
+      }
+    }
+  }
+
+  template <typename T, typename... Args>
+  std::enable_if_t<not(is_numeric<T>() and not std::is_same_v<T, bool>)> operator()(Args&&...) const
+  {
+    CUDF_FAIL("Fused reductions require a numeric column");
+  }
+};
+
+}  // namespace
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(aggs.size() == output_dtypes.size(),
+               "Each aggregation must have an output type",
+               std::invalid_argument);
+
+  std::vector<bool> fused(aggs.size());
+  std::transform(aggs.begin(),
+                 aggs.end(),
+                 output_dtypes.begin(),
+                 fused.begin(),
+                 [&](auto const& agg, auto const& output_dtype) {
+                   return is_fusable(*agg, col.type(), output_dtype);
+                 });
+
+  std::vector<std::unique_ptr<scalar>> results(aggs.size());
+  // A single fusable reduction is as fast on its own
+  if (std::count(fused.begin(), fused.end(), true) > 1) {
+    type_dispatcher(
+      col.type(), fused_reduce_fn{}, col, aggs, output_dtypes, fused, results, stream, mr);
+  } else {
+    std::fill(fused.begin(), fused.end(), false);
+  }
+
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    if (not fused[i]) {
+      results[i] = reduce(col, *aggs[i], output_dtypes[i], std::nullopt, stream, mr);
+    }
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace reduction
+}  // namespace cudf
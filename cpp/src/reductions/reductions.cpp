@@ -24,6 +24,7 @@
 #include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/reduction/detail/histogram.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
 #include <cudf/reduction/detail/reduction_functions.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/structs/structs_column_view.hpp>
@@ -76,32 +77,22 @@ struct reduce_dispatch_functor {
         return standard_deviation(col, output_dtype, var_agg._ddof, stream, mr);
       }
       case aggregation::MEDIAN: {
-        auto current_mr     = rmm::mr::get_current_device_resource();
-        auto sorted_indices = cudf::detail::sorted_order(
-          table_view{{col}}, {}, {null_order::AFTER}, stream, current_mr);
-        auto valid_sorted_indices =
-          cudf::detail::split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
-        auto col_ptr = cudf::detail::quantile(
-          col, {0.5}, interpolation::LINEAR, valid_sorted_indices, true, stream, current_mr);
+        auto current_mr = rmm::mr::get_current_device_resource();
+        auto col_ptr    = cudf::detail::quantile_unsorted(
+          col, {0.5}, interpolation::LINEAR, true, stream, current_mr);
         return cudf::detail::get_element(*col_ptr, 0, stream, mr);
       }
       case aggregation::QUANTILE: {
         auto quantile_agg = static_cast<cudf::detail::quantile_aggregation const&>(agg);
         CUDF_EXPECTS(quantile_agg._quantiles.size() == 1,
                      "Reduction quantile accepts only one quantile value");
-        auto current_mr     = rmm::mr::get_current_device_resource();
-        auto sorted_indices = cudf::detail::sorted_order(
-          table_view{{col}}, {}, {null_order::AFTER}, stream, current_mr);
-        auto valid_sorted_indices =
-          cudf::detail::split(*sorted_indices, {col.size() - col.null_count()}, stream)[0];
-
-        auto col_ptr = cudf::detail::quantile(col,
-                                              quantile_agg._quantiles,
-                                              quantile_agg._interpolation,
-                                              valid_sorted_indices,
-                                              true,
-                                              stream,
-                                              current_mr);
+        auto current_mr = rmm::mr::get_current_device_resource();
+        auto col_ptr    = cudf::detail::quantile_unsorted(col,
+                                                       quantile_agg._quantiles,
+                                                       quantile_agg._interpolation,
+                                                       true,
+                                                       stream,
+                                                       current_mr);
         return cudf::detail::get_element(*col_ptr, 0, stream, mr);
       }
       case aggregation::NUNIQUE: {
@@ -144,6 +135,14 @@ struct reduce_dispatch_functor {
         auto td_agg = static_cast<cudf::detail::merge_tdigest_aggregation const&>(agg);
         return tdigest::detail::reduce_merge_tdigest(col, td_agg.max_centroids, stream, mr);
       }
+      case aggregation::HYPERLOGLOG: {
+        auto hll_agg = static_cast<cudf::detail::hyperloglog_aggregation const&>(agg);
+        return hyperloglog(col, hll_agg.precision, stream, mr);
+      }
+      case aggregation::MERGE_HYPERLOGLOG: {
+        auto hll_agg = static_cast<cudf::detail::merge_hyperloglog_aggregation const&>(agg);
+        return merge_hyperloglog(col, hll_agg.precision, stream, mr);
+      }
       default: CUDF_FAIL("Unsupported reduction operator");
     }
   }
@@ -166,8 +165,10 @@ std::unique_ptr<scalar> reduce(column_view const& col,
       "Initial value is only supported for SUM, PRODUCT, MIN, MAX, ANY, and ALL aggregation types");
   }
 
-  // Returns default scalar if input column is empty or all null
-  if (col.size() <= col.null_count()) {
+  // Returns default scalar if input column is empty or all null. The sketch of no values is a
+  // sketch of empty registers.
+  if (col.size() <= col.null_count() and agg.kind != aggregation::HYPERLOGLOG and
+      agg.kind != aggregation::MERGE_HYPERLOGLOG) {
     if (agg.kind == aggregation::TDIGEST || agg.kind == aggregation::MERGE_TDIGEST) {
       return tdigest::detail::make_empty_tdigest_scalar(stream, mr);
     }
@@ -225,4 +226,15 @@ std::unique_ptr<scalar> reduce(column_view const& col,
   CUDF_FUNC_RANGE();
   return reduction::detail::reduce(col, agg, output_dtype, init, stream, mr);
 }
+
+std::vector<std::unique_ptr<scalar>> reduce(
+  column_view const& col,
+  host_span<std::unique_ptr<reduce_aggregation> const> aggs,
+  host_span<data_type const> output_dtypes,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::reduce(col, aggs, output_dtypes, stream, mr);
+}
 }  // namespace cudf
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "io/statistics/column_statistics.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/reduction/detail/hyperloglog.hpp>
+#include <cudf/reduction/detail/reduction.hpp>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/execution_policy.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/tabulate.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+namespace cudf {
+namespace reduction {
+namespace detail {
+namespace {
+
+using io::statistics_chunk;
+
+constexpr int statistics_block_size = 256;
+
+/**
+ * @brief Functor reducing the rows of one segment of a column into a statistics chunk.
+ *
+ * This is the reduction of `io::calculate_group_statistics_functor` without the conversion of
+ * timestamps and durations to the units of a file format, so the extrema keep the column's units.
+ */
+template <int block_size>
+struct segment_statistics_functor {
+  io::block_reduce_storage<block_size>& temp_storage;
+
+  template <typename T, CUDF_ENABLE_IF(not io::detail::extrema_type<T>::is_supported)>
+  __device__ void operator()(column_device_view const&, size_type, size_type, statistics_chunk&)
+  {
+    CUDF_UNREACHABLE("Unsupported type for column statistics");
+  }
+
+  template <typename T, CUDF_ENABLE_IF(io::detail::extrema_type<T>::is_supported)>
+  __device__ void operator()(column_device_view const& col,
+                             size_type begin,
+                             size_type end,
+                             statistics_chunk& output)
+  {
+    io::detail::storage_wrapper<block_size> storage(temp_storage);
+    io::typed_statistics_chunk<T, io::detail::aggregation_type<T>::is_supported> chunk;
+
+    for (auto i = static_cast<thread_index_type>(begin) + threadIdx.x; i < end; i += block_size) {
+      auto const row = static_cast<size_type>(i);
+      if (col.is_valid(row)) {
+        chunk.reduce(col.element<T>(row));
+      } else {
+        chunk.null_count++;
+      }
+    }
+
+    chunk = io::block_reduce(chunk, storage);
+    if (threadIdx.x == 0) { output = io::get_untyped_chunk(chunk); }
+  }
+};
+
+/**
+ * @brief Kernel computing the statistics chunk of each segment of each column.
+ *
+ * Block `i` reduces segment `i % num_segments` of column `i / num_segments`.
+ */
+template <int block_size>
+CUDF_KERNEL void __launch_bounds__(block_size)
+  segment_statistics_kernel(table_device_view input,
+                            size_type const* offsets,
+                            size_type num_segments,
+                            statistics_chunk* chunks)
+{
+  __shared__ io::block_reduce_storage<block_size> storage;
+
+  auto const group   = static_cast<size_type>(blockIdx.x);
+  auto const segment = group % num_segments;
+  auto const& col    = input.column(group / num_segments);
+  type_dispatcher(col.type(),
+                  segment_statistics_functor<block_size>{storage},
+                  col,
+                  offsets[segment],
+                  offsets[segment + 1],
+                  chunks[group]);
+}
+
+/**
+ * @brief Converts an extremum of a statistics chunk back to the storage of the column type.
+ */
+template <typename T>
+__device__ device_storage_type_t<T> from_extrema(typename io::detail::extrema_type<T>::type value)
+{
+  if constexpr (cudf::is_fixed_point<T>()) {
+    return static_cast<device_storage_type_t<T>>(value);
+  } else if constexpr (cudf::is_timestamp<T>()) {
+    return T{typename T::duration{static_cast<typename T::rep>(value)}};
+  } else if constexpr (cudf::is_duration<T>()) {
+    return T{static_cast<typename T::rep>(value)};
+  } else {
+    return static_cast<T>(value);
+  }
+}
+
+template <typename T, bool is_min>
+struct extremum_fn {
+  __device__ device_storage_type_t<T> operator()(statistics_chunk const& chunk) const
+  {
+    using E = typename io::detail::extrema_type<T>::type;
+    return from_extrema<T>(io::union_member::get<E>(is_min ? chunk.min_value : chunk.max_value));
+  }
+};
+
+template <bool is_min>
+struct string_extremum_fn {
+  __device__ strings::detail::string_index_pair operator()(statistics_chunk const& chunk) const
+  {
+    if (not chunk.has_minmax) { return {nullptr, 0}; }
+    auto const value = static_cast<string_view>(is_min ? chunk.min_value.str_val
+                                                       : chunk.max_value.str_val);
+    return {value.data(), value.size_bytes()};
+  }
+};
+
+/**
+ * @brief Storage of the sum of a column of type `T`.
+ */
+template <typename T>
+using sum_storage_type =
+  std::conditional_t<cudf::is_duration<T>(), T, typename io::detail::aggregation_type<T>::type>;
+
+template <typename T>
+struct sum_fn {
+  __device__ sum_storage_type<T> operator()(statistics_chunk const& chunk) const
+  {
+    using A = typename io::detail::aggregation_type<T>::type;
+    if constexpr (cudf::is_duration<T>()) {
+      return T{static_cast<typename T::rep>(io::union_member::get<A>(chunk.sum))};
+    } else {
+      return io::union_member::get<A>(chunk.sum);
+    }
+  }
+};
+
+struct has_minmax_fn {
+  __device__ bool operator()(statistics_chunk const& chunk) const { return chunk.has_minmax; }
+};
+
+struct has_sum_fn {
+  __device__ bool operator()(statistics_chunk const& chunk) const
+  {
+    return chunk.has_minmax and chunk.has_sum;
+  }
+};
+
+/**
+ * @brief Makes a fixed-width column of `chunks.size()` rows from the chunks.
+ */
+template <typename Storage, typename ValueFn, typename ValidityFn>
+std::unique_ptr<column> make_chunk_column(data_type type,
+                                          device_span<statistics_chunk const> chunks,
+                                          ValueFn value_fn,
+                                          ValidityFn validity_fn,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto const size = static_cast<size_type>(chunks.size());
+  auto result     = make_fixed_width_column(type, size, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    chunks.begin(),
+                    chunks.end(),
+                    result->mutable_view().template data<Storage>(),
+                    value_fn);
+  auto [null_mask, null_count] =
+    cudf::detail::valid_if(chunks.begin(), chunks.end(), validity_fn, stream, mr);
+  if (null_count > 0) { result->set_null_mask(std::move(null_mask), null_count); }
+  return result;
+}
+
+/**
+ * @brief Functor making the `min`, `max` and `sum` columns of a column from its chunks.
+ */
+struct make_statistics_fn {
+  template <typename T, CUDF_ENABLE_IF(std::is_same_v<T, string_view>)>
+  void operator()(data_type,
+                  device_span<statistics_chunk const> chunks,
+                  segment_statistics& result,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+  {
+    result.min = strings::detail::make_strings_column(
+      thrust::make_transform_iterator(chunks.begin(), string_extremum_fn<true>{}),
+      thrust::make_transform_iterator(chunks.end(), string_extremum_fn<true>{}),
+      stream,
+      mr);
+    result.max = strings::detail::make_strings_column(
+      thrust::make_transform_iterator(chunks.begin(), string_extremum_fn<false>{}),
+      thrust::make_transform_iterator(chunks.end(), string_extremum_fn<false>{}),
+      stream,
+      mr);
+  }
+
+  template <typename T, CUDF_ENABLE_IF(cudf::is_fixed_width<T>())>
+  void operator()(data_type type,
+                  device_span<statistics_chunk const> chunks,
+                  segment_statistics& result,
+                  rmm::cuda_stream_view stream,
+                  rmm::device_async_resource_ref mr)
+  {
+    using Storage = device_storage_type_t<T>;
+    result.min =
+      make_chunk_column<Storage>(type, chunks, extremum_fn<T, true>{}, has_minmax_fn{}, stream, mr);
+    result.max = make_chunk_column<Storage>(
+      type, chunks, extremum_fn<T, false>{}, has_minmax_fn{}, stream, mr);
+
+    if constexpr (not cudf::is_timestamp<T>()) {
+      using A             = typename io::detail::aggregation_type<T>::type;
+      auto const sum_type = [&] {
+        if constexpr (cudf::is_fixed_point<T>()) {
+          return data_type{type_to_id<numeric::fixed_point<A, numeric::Radix::BASE_10>>(),
+                           type.scale()};
+        } else if constexpr (cudf::is_duration<T>()) {
+          return type;
+        } else {
+          return data_type{type_to_id<A>()};
+        }
+      }();
+      result.sum = make_chunk_column<sum_storage_type<T>>(
+        sum_type, chunks, sum_fn<T>{}, has_sum_fn{}, stream, mr);
+    }
+  }
+
+  template <typename T,
+            CUDF_ENABLE_IF(not cudf::is_fixed_width<T>() and not std::is_same_v<T, string_view>)>
+  void operator()(data_type,
+                  device_span<statistics_chunk const>,
+                  segment_statistics&,
+                  rmm::cuda_stream_view,
+                  rmm::device_async_resource_ref)
+  {
+    CUDF_FAIL("Unsupported type for column statistics", std::invalid_argument);
+  }
+};
+
+/**
+ * @brief Returns the segment of each row, or `num_segments` for rows outside of all segments.
+ */
+rmm::device_uvector<size_type> make_segment_labels(device_span<size_type const> offsets,
+                                                   size_type num_rows,
+                                                   rmm::cuda_stream_view stream)
+{
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+  rmm::device_uvector<size_type> labels(num_rows, stream);
+  thrust::tabulate(rmm::exec_policy_nosync(stream),
+                   labels.begin(),
+                   labels.end(),
+                   [offsets = offsets.begin(), num_segments] __device__(size_type row) {
+                     auto const segment =
+                       thrust::upper_bound(thrust::seq, offsets, offsets + num_segments + 1, row) -
+                       offsets;
+                     return segment == 0 or segment > num_segments
+                              ? num_segments
+                              : static_cast<size_type>(segment - 1);
+                   });
+  return labels;
+}
+
+}  // namespace
+
+std::vector<segment_statistics> compute_statistics(table_view const& input,
+                                                   device_span<size_type const> offsets,
+                                                   std::optional<int> sketch_precision,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(std::all_of(input.begin(),
+                           input.end(),
+                           [](auto const& col) {
+                             return cudf::is_fixed_width(col.type()) or
+                                    col.type().id() == type_id::STRING;
+                           }),
+               "Column statistics are only supported for fixed-width and strings columns",
+               std::invalid_argument);
+
+  // Without offsets each column is a single segment
+  auto const whole_columns = std::vector<size_type>{0, input.num_rows()};
+  auto const d_whole_columns =
+    offsets.empty() ? cudf::detail::make_device_uvector_async(
+                        whole_columns, stream, rmm::mr::get_current_device_resource())
+                    : rmm::device_uvector<size_type>(0, stream);
+  auto const d_offsets = offsets.empty() ? device_span<size_type const>{d_whole_columns} : offsets;
+  auto const num_segments = static_cast<size_type>(d_offsets.size()) - 1;
+
+  auto const num_groups = static_cast<int64_t>(num_segments) * input.num_columns();
+  CUDF_EXPECTS(num_groups <= std::numeric_limits<size_type>::max(),
+               "Too many segments for the column statistics",
+               std::overflow_error);
+
+  rmm::device_uvector<statistics_chunk> chunks(num_groups, stream);
+  if (num_groups > 0) {
+    auto const d_input = table_device_view::create(input, stream);
+    segment_statistics_kernel<statistics_block_size>
+      <<<static_cast<size_type>(num_groups), statistics_block_size, 0, stream.value()>>>(
+        *d_input, d_offsets.data(), num_segments, chunks.data());
+  }
+
+  auto const labels = sketch_precision.has_value() ? make_segment_labels(d_offsets,
+                                                                         input.num_rows(),
+                                                                         stream)
+                                                   : rmm::device_uvector<size_type>(0, stream);
+
+  std::vector<segment_statistics> results(input.num_columns());
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const col        = input.column(i);
+    auto const col_chunks = device_span<statistics_chunk const>{
+      chunks.data() + static_cast<std::size_t>(i) * num_segments,
+      static_cast<std::size_t>(num_segments)};
+    auto& result = results[i];
+
+    type_dispatcher(col.type(), make_statistics_fn{}, col.type(), col_chunks, result, stream, mr);
+    result.null_count = make_numeric_column(
+      data_type{type_to_id<size_type>()}, num_segments, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      col_chunks.begin(),
+                      col_chunks.end(),
+                      result.null_count->mutable_view().begin<size_type>(),
+                      cuda::proclaim_return_type<size_type>(
+                        [] __device__(statistics_chunk const& chunk) {
+                          return static_cast<size_type>(chunk.null_count);
+                        }));
+
+    if (sketch_precision.has_value()) {
+      result.sketch =
+        group_hyperloglog(col, labels, num_segments, sketch_precision.value(), stream, mr);
+    }
+  }
+  return results;
+}
+
+}  // namespace detail
+}  // namespace reduction
+
+std::vector<segment_statistics> compute_statistics(table_view const& input,
+                                                   device_span<size_type const> offsets,
+                                                   std::optional<int> sketch_precision,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return reduction::detail::compute_statistics(input, offsets, sketch_precision, stream, mr);
+}
+
+}  // namespace cudf
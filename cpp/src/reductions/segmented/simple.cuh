@@ -17,6 +17,7 @@
 #pragma once
 
 #include "counts.hpp"
+#include "reductions/nested_type_minmax_util.cuh"
 #include "update_validity.hpp"
 
 #include <cudf/detail/aggregation/aggregation.hpp>
@@ -207,6 +208,75 @@ std::unique_ptr<column> string_segmented_reduction(column_view const& col,
   CUDF_FAIL("Segmented reduction on string column only supports min and max reduction.");
 }
 
+/**
+ * @brief Nested-type (lists, structs) segmented reduction for 'min', 'max'.
+ *
+ * Like the strings case, this computes a gather map from an argmin/argmax reduction over
+ * each segment, using a lexicographic row comparator, then gathers the output rows.
+ *
+ * @tparam Op           the operator of cudf::reduction::op::
+
+ * @param col Input column of data to reduce
+ * @param offsets Indices to segment boundaries
+ * @param null_handling How null entries are processed within each segment
+ * @param stream Used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return Output column in device memory
+ */
+template <typename Op,
+          CUDF_ENABLE_IF(std::is_same_v<Op, cudf::reduction::detail::op::min> ||
+                         std::is_same_v<Op, cudf::reduction::detail::op::max>)>
+std::unique_ptr<column> nested_segmented_reduction(column_view const& col,
+                                                   device_span<size_type const> offsets,
+                                                   null_policy null_handling,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto it                 = thrust::make_counting_iterator(0);
+  auto const num_segments = static_cast<size_type>(offsets.size()) - 1;
+
+  auto const binop_generator =
+    cudf::reduction::detail::comparison_binop_generator::create<Op>(col, stream);
+  auto const binop        = binop_generator.binop();
+  auto constexpr identity = std::is_same_v<Op, cudf::reduction::detail::op::min>
+                              ? cudf::detail::ARGMIN_SENTINEL
+                              : cudf::detail::ARGMAX_SENTINEL;
+
+  auto gather_map = make_fixed_width_column(
+    data_type{type_to_id<size_type>()}, num_segments, mask_state::UNALLOCATED, stream, mr);
+
+  auto gather_map_it = gather_map->mutable_view().begin<size_type>();
+
+  cudf::reduction::detail::segmented_reduce(
+    it, offsets.begin(), offsets.end(), gather_map_it, binop, identity, stream);
+
+  auto result = std::move(cudf::detail::gather(table_view{{col}},
+                                               *gather_map,
+                                               cudf::out_of_bounds_policy::NULLIFY,
+                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               stream,
+                                               mr)
+                            ->release()[0]);
+
+  // Compute the output null mask
+  cudf::reduction::detail::segmented_update_validity(
+    *result, col, offsets, null_handling, std::nullopt, stream, mr);
+
+  return result;
+}
+
+template <typename Op,
+          CUDF_ENABLE_IF(!std::is_same_v<Op, cudf::reduction::detail::op::min>() &&
+                         !std::is_same_v<Op, cudf::reduction::detail::op::max>())>
+std::unique_ptr<column> nested_segmented_reduction(column_view const&,
+                                                   device_span<size_type const>,
+                                                   null_policy,
+                                                   rmm::cuda_stream_view,
+                                                   rmm::device_async_resource_ref)
+{
+  CUDF_FAIL("Segmented reduction on nested column only supports min and max reduction.");
+}
+
 /**
  * @brief Specialization for fixed-point segmented reduction
  *
@@ -328,15 +398,15 @@ struct same_column_type_dispatcher {
   template <typename ElementType>
   static constexpr bool is_supported()
   {
-    return !(cudf::is_dictionary<ElementType>() || std::is_same_v<ElementType, cudf::list_view> ||
-             std::is_same_v<ElementType, cudf::struct_view>);
+    return !cudf::is_dictionary<ElementType>();
   }
 
  public:
   template <typename ElementType,
             CUDF_ENABLE_IF(is_supported<ElementType>() &&
                            !std::is_same_v<ElementType, string_view> &&
-                           !cudf::is_fixed_point<ElementType>())>
+                           !cudf::is_fixed_point<ElementType>() &&
+                           !cudf::is_nested<ElementType>())>
   std::unique_ptr<column> operator()(column_view const& col,
                                      device_span<size_type const> offsets,
                                      null_policy null_handling,
@@ -362,6 +432,20 @@ struct same_column_type_dispatcher {
     return string_segmented_reduction<ElementType, Op>(col, offsets, null_handling, stream, mr);
   }
 
+  template <typename ElementType,
+            CUDF_ENABLE_IF(is_supported<ElementType>() && cudf::is_nested<ElementType>())>
+  std::unique_ptr<column> operator()(column_view const& col,
+                                     device_span<size_type const> offsets,
+                                     null_policy null_handling,
+                                     std::optional<std::reference_wrapper<scalar const>> init,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+  {
+    if (init.has_value()) { CUDF_FAIL("Initial value not supported for nested types"); }
+
+    return nested_segmented_reduction<Op>(col, offsets, null_handling, stream, mr);
+  }
+
   template <typename ElementType,
             CUDF_ENABLE_IF(is_supported<ElementType>() && cudf::is_fixed_point<ElementType>())>
   std::unique_ptr<column> operator()(column_view const& col,
@@ -34,6 +34,8 @@
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/detail/copy_if_else.cuh>
 #include <cudf/strings/detail/replace.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -43,6 +45,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/functional.h>
@@ -54,6 +57,12 @@
 #include <thrust/transform.h>
 #include <thrust/tuple.h>
 
+#include <algorithm>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
 namespace {  // anonymous
 
 static constexpr int BLOCK_SIZE = 256;
@@ -311,6 +320,75 @@ std::unique_ptr<cudf::column> replace_nulls_policy_impl(cudf::column_view const&
   return std::move(output->release()[0]);
 }
 
+// Number of gather map rows computed by one scan of `replace_nulls(table_view)`
+constexpr cudf::size_type replace_nulls_batch_size = 1 << 26;
+
+/**
+ * @brief Functor returning the column of row `i` of the columns of a batch laid end to end.
+ */
+struct batch_column_fn {
+  cudf::size_type num_rows;
+
+  __device__ cudf::size_type operator()(cudf::size_type i) const { return i / num_rows; }
+};
+
+/**
+ * @brief Functor returning the index and validity of row `i` of the columns of a batch laid end
+ * to end.
+ */
+struct batch_row_validity_fn {
+  cudf::table_device_view batch;
+  cudf::size_type num_rows;
+
+  __device__ cudf::detail::idx_valid_pair_t operator()(cudf::size_type i) const
+  {
+    auto const row = i % num_rows;
+    return {row, batch.column(i / num_rows).is_valid(row)};
+  }
+};
+
+/**
+ * @brief Computes the `replace_nulls(replace_policy)` gather map of each column of `batch` with a
+ * single scan segmented by column.
+ *
+ * @return The gather maps of the columns laid end to end
+ */
+rmm::device_uvector<cudf::size_type> replace_nulls_gather_maps(
+  cudf::table_view const& batch, cudf::replace_policy replace_policy, rmm::cuda_stream_view stream)
+{
+  auto const num_rows = batch.num_rows();
+  auto const size     = num_rows * batch.num_columns();
+  auto const d_batch  = cudf::table_device_view::create(batch, stream);
+
+  rmm::device_uvector<cudf::size_type> gather_maps(size, stream);
+  auto const keys   = cudf::detail::make_counting_transform_iterator(0, batch_column_fn{num_rows});
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, batch_row_validity_fn{*d_batch, num_rows});
+  auto const gm_begin = thrust::make_zip_iterator(
+    thrust::make_tuple(gather_maps.begin(), thrust::make_discard_iterator()));
+
+  auto func = cudf::detail::replace_policy_functor();
+  if (replace_policy == cudf::replace_policy::PRECEDING) {
+    thrust::inclusive_scan_by_key(rmm::exec_policy_nosync(stream),
+                                  keys,
+                                  keys + size,
+                                  values,
+                                  gm_begin,
+                                  thrust::equal_to<cudf::size_type>{},
+                                  func);
+  } else {
+    auto keys_rbegin = thrust::make_reverse_iterator(keys + size);
+    thrust::inclusive_scan_by_key(rmm::exec_policy_nosync(stream),
+                                  keys_rbegin,
+                                  keys_rbegin + size,
+                                  thrust::make_reverse_iterator(values + size),
+                                  thrust::make_reverse_iterator(gm_begin + size),
+                                  thrust::equal_to<cudf::size_type>{},
+                                  func);
+  }
+  return gather_maps;
+}
+
 }  // end anonymous namespace
 
 namespace cudf {
@@ -357,6 +435,65 @@ std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
   return replace_nulls_policy_impl(input, replace_policy, stream, mr);
 }
 
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy const& replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.num_rows();
+  std::vector<std::unique_ptr<column>> columns(input.num_columns());
+
+  // Columns sharing a null mask share their gather map: group them by mask and offset
+  std::vector<std::vector<size_type>> groups;
+  std::map<std::pair<bitmask_type const*, size_type>, std::size_t> group_of_mask;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const& col = input.column(i);
+    if (!col.has_nulls()) {
+      columns[i] = std::make_unique<column>(col, stream, mr);
+      continue;
+    }
+    auto const [it, inserted] =
+      group_of_mask.try_emplace({col.null_mask(), col.offset()}, groups.size());
+    if (inserted) { groups.emplace_back(); }
+    groups[it->second].push_back(i);
+  }
+  if (groups.empty()) { return std::make_unique<table>(std::move(columns)); }
+
+  auto const batch_groups =
+    std::max<std::size_t>(1, static_cast<std::size_t>(replace_nulls_batch_size / num_rows));
+  for (std::size_t begin = 0; begin < groups.size(); begin += batch_groups) {
+    auto const end = std::min(begin + batch_groups, groups.size());
+
+    // The first column of each group is enough to compute the group's gather map
+    std::vector<column_view> batch;
+    std::transform(groups.begin() + begin,
+                   groups.begin() + end,
+                   std::back_inserter(batch),
+                   [&input](auto const& group) { return input.column(group.front()); });
+    auto const gather_maps = replace_nulls_gather_maps(table_view{batch}, replace_policy, stream);
+
+    for (auto g = begin; g < end; ++g) {
+      auto const gather_map = column_view{data_type{type_to_id<size_type>()},
+                                          num_rows,
+                                          gather_maps.data() + (g - begin) * num_rows,
+                                          nullptr,
+                                          0};
+      auto const& group     = groups[g];
+      auto output           = detail::gather(input.select(group),
+                                   gather_map,
+                                   out_of_bounds_policy::DONT_CHECK,
+                                   negative_index_policy::NOT_ALLOWED,
+                                   stream,
+                                   mr)
+                      ->release();
+      for (std::size_t j = 0; j < group.size(); ++j) {
+        columns[group[j]] = std::move(output[j]);
+      }
+    }
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> replace_nulls(cudf::column_view const& input,
@@ -386,4 +523,13 @@ std::unique_ptr<cudf::column> replace_nulls(column_view const& input,
   return detail::replace_nulls(input, replace_policy, stream, mr);
 }
 
+std::unique_ptr<table> replace_nulls(table_view const& input,
+                                     replace_policy const& replace_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::replace_nulls(input, replace_policy, stream, mr);
+}
+
 }  // namespace cudf
@@ -19,6 +19,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/valid_if.cuh>
 #include <cudf/lists/detail/interleave_columns.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
@@ -28,6 +29,7 @@
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
@@ -39,6 +41,10 @@
 #include <thrust/iterator/transform_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
 namespace cudf {
 namespace detail {
 namespace {
@@ -191,6 +197,117 @@ struct interleave_columns_impl<T, std::enable_if_t<std::is_same_v<T, cudf::strin
   }
 };
 
+constexpr size_type tile_dim        = 32;       ///< Rows and columns of a tile
+constexpr size_type tile_block_rows = 8;        ///< Threads along the second block dimension
+constexpr int64_t max_tile_blocks   = 1 << 16;  ///< Largest grid used for the tiled interleave
+
+/**
+ * @brief Interleaves the columns of the table one `tile_dim x tile_dim` tile at a time.
+ *
+ * Each tile is read column by column and written row by row through shared memory so that
+ * both the reads from the input columns and the writes to the output are coalesced.
+ *
+ * @tparam T Integer type with the size of the table's element type
+ * @param input Table to interleave
+ * @param output Elements of the interleaved columns, one input row after another
+ */
+template <typename T>
+CUDF_KERNEL void interleave_tiles_kernel(table_device_view input, T* output)
+{
+  // padded by one element so the column-wise reads of the tile hit different banks
+  __shared__ T tile[tile_dim][tile_dim + 1];
+
+  auto const num_cols  = input.num_columns();
+  auto const num_rows  = input.num_rows();
+  auto const col_tiles = util::div_rounding_up_unsafe(num_cols, tile_dim);
+  auto const num_tiles =
+    static_cast<int64_t>(col_tiles) * util::div_rounding_up_unsafe(num_rows, tile_dim);
+  auto const x = static_cast<size_type>(threadIdx.x);
+
+  for (auto t = static_cast<int64_t>(blockIdx.x); t < num_tiles; t += gridDim.x) {
+    auto const tile_col = static_cast<size_type>(t % col_tiles) * tile_dim;
+    auto const tile_row = static_cast<size_type>(t / col_tiles) * tile_dim;
+
+    for (auto y = static_cast<size_type>(threadIdx.y); y < tile_dim; y += tile_block_rows) {
+      auto const col = tile_col + y;
+      auto const row = tile_row + x;
+      if (col < num_cols && row < num_rows) {
+        auto const column = input.column(col);
+        tile[y][x]        = column.head<T>()[column.offset() + row];
+      }
+    }
+    __syncthreads();
+
+    for (auto y = static_cast<size_type>(threadIdx.y); y < tile_dim; y += tile_block_rows) {
+      auto const row = tile_row + y;
+      auto const col = tile_col + x;
+      if (col < num_cols && row < num_rows) {
+        output[static_cast<int64_t>(row) * num_cols + col] = tile[x][y];
+      }
+    }
+    __syncthreads();
+  }
+}
+
+template <typename T>
+void launch_interleave_tiles(table_device_view const& input,
+                             mutable_column_view output,
+                             rmm::cuda_stream_view stream)
+{
+  auto const num_tiles =
+    static_cast<int64_t>(util::div_rounding_up_safe(input.num_columns(), tile_dim)) *
+    util::div_rounding_up_safe(input.num_rows(), tile_dim);
+  auto const num_blocks = static_cast<int>(std::min(num_tiles, max_tile_blocks));
+  interleave_tiles_kernel<T><<<num_blocks, dim3(tile_dim, tile_block_rows), 0, stream.value()>>>(
+    input, output.data<T>());
+}
+
+/**
+ * @brief Interleaves a table of fixed-width columns of a single type with the tiled kernel.
+ *
+ * Elements are moved as integers of the same size, so the kernel is instantiated once per
+ * element size rather than once per type.
+ */
+std::unique_ptr<column> interleave_fixed_width_tiles(table_view const& input,
+                                                     bool create_mask,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  auto const output_size = static_cast<int64_t>(input.num_columns()) * input.num_rows();
+  CUDF_EXPECTS(output_size <= std::numeric_limits<size_type>::max(),
+               "Size of the interleaved columns exceeds the column size limit",
+               std::overflow_error);
+
+  auto output = detail::allocate_like(input.column(0),
+                                      static_cast<size_type>(output_size),
+                                      mask_allocation_policy::NEVER,
+                                      stream,
+                                      mr);
+  auto const d_input = table_device_view::create(input, stream);
+
+  switch (size_of(output->type())) {
+    case 1: launch_interleave_tiles<int8_t>(*d_input, output->mutable_view(), stream); break;
+    case 2: launch_interleave_tiles<int16_t>(*d_input, output->mutable_view(), stream); break;
+    case 4: launch_interleave_tiles<int32_t>(*d_input, output->mutable_view(), stream); break;
+    case 8: launch_interleave_tiles<int64_t>(*d_input, output->mutable_view(), stream); break;
+    case 16: launch_interleave_tiles<__int128_t>(*d_input, output->mutable_view(), stream); break;
+    default: CUDF_FAIL("Unsupported element size for interleave_columns");
+  }
+
+  if (create_mask) {
+    auto [mask, null_count] = valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(output->size()),
+      [input = *d_input, divisor = input.num_columns()] __device__(size_type idx) {
+        return input.column(idx % divisor).is_valid(idx / divisor);
+      },
+      stream,
+      mr);
+    output->set_null_mask(std::move(mask), null_count);
+  }
+  return output;
+}
+
 template <typename T>
 struct interleave_columns_impl<T, std::enable_if_t<cudf::is_fixed_width<T>()>> {
   std::unique_ptr<cudf::column> operator()(table_view const& input,
@@ -198,6 +315,11 @@ struct interleave_columns_impl<T, std::enable_if_t<cudf::is_fixed_width<T>()>> {
                                            rmm::cuda_stream_view stream,
                                            rmm::device_async_resource_ref mr)
   {
+    // Tables with fewer columns than a tile are faster to gather element by element
+    if (input.num_columns() >= tile_dim) {
+      return interleave_fixed_width_tiles(input, create_mask, stream, mr);
+    }
+
     auto arch_column = input.column(0);
     auto output_size = input.num_columns() * input.num_rows();
     auto output =
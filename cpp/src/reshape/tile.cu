@@ -14,23 +14,35 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/copying.hpp>
+#include <cudf/detail/copy.hpp>
 #include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/reshape.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <algorithm>
+#include <limits>
 #include <memory>
+#include <stdexcept>
+#include <vector>
 
 namespace cudf {
 namespace {
@@ -39,9 +51,170 @@ struct tile_functor {
   size_type __device__ operator()(size_type i) { return i % count; }
 };
 
+/**
+ * @brief Copies an element of `width` bytes.
+ */
+__device__ void copy_element(
+  void* output, size_type output_index, void const* input, size_type input_index, int32_t width)
+{
+  switch (width) {
+    case 1:
+      static_cast<uint8_t*>(output)[output_index] =
+        static_cast<uint8_t const*>(input)[input_index];
+      break;
+    case 2:
+      static_cast<uint16_t*>(output)[output_index] =
+        static_cast<uint16_t const*>(input)[input_index];
+      break;
+    case 4:
+      static_cast<uint32_t*>(output)[output_index] =
+        static_cast<uint32_t const*>(input)[input_index];
+      break;
+    case 8:
+      static_cast<uint64_t*>(output)[output_index] =
+        static_cast<uint64_t const*>(input)[input_index];
+      break;
+    default:
+      static_cast<__int128_t*>(output)[output_index] =
+        static_cast<__int128_t const*>(input)[input_index];
+      break;
+  }
+}
+
+/**
+ * @brief Tiles several fixed-width columns with a single kernel.
+ *
+ * Each row of blocks of the grid handles one column at a time. Output row `i` of a column is
+ * input row `i % num_rows`, so consecutive threads read consecutive input rows, and the null
+ * mask words of the output are written a warp at a time.
+ *
+ * @param input_views Views of the input columns
+ * @param element_widths Size in bytes of the elements of each column
+ * @param output_views Views of the output columns
+ * @param num_columns Number of columns
+ * @param out_valid_counts To hold the number of valid rows of each output column
+ */
+template <size_type block_size>
+CUDF_KERNEL void batched_tile_kernel(column_device_view const* input_views,
+                                     int32_t const* element_widths,
+                                     mutable_column_device_view const* output_views,
+                                     size_type num_columns,
+                                     size_type* out_valid_counts)
+{
+  for (auto col_idx = static_cast<size_type>(blockIdx.y); col_idx < num_columns;
+       col_idx += gridDim.y) {
+    auto const& input_view  = input_views[col_idx];
+    auto const& output_view = output_views[col_idx];
+    auto const width        = element_widths[col_idx];
+    auto const nullable     = output_view.nullable();
+    auto const input_size   = input_view.size();
+    auto const output_size  = output_view.size();
+    auto const input_data =
+      input_view.head<char>() + static_cast<std::size_t>(input_view.offset()) * width;
+
+    auto output_index          = cudf::detail::grid_1d::global_thread_id<block_size>();
+    auto const stride          = cudf::detail::grid_1d::grid_stride<block_size>();
+    size_type warp_valid_count = 0;
+
+    auto active_mask = __ballot_sync(0xFFFF'FFFFu, output_index < output_size);
+    while (output_index < output_size) {
+      auto const input_index = static_cast<size_type>(output_index % input_size);
+      copy_element(
+        output_view.head(), static_cast<size_type>(output_index), input_data, input_index, width);
+
+      if (nullable) {
+        bitmask_type const new_word =
+          __ballot_sync(active_mask, input_view.is_valid(input_index));
+        if (threadIdx.x % detail::warp_size == 0) {
+          output_view.null_mask()[word_index(output_index)] = new_word;
+        }
+        warp_valid_count += __popc(new_word);
+      }
+
+      output_index += stride;
+      active_mask = __ballot_sync(active_mask, output_index < output_size);
+    }
+
+    if (nullable) {
+      using detail::single_lane_block_sum_reduce;
+      auto block_valid_count = single_lane_block_sum_reduce<block_size, 0>(warp_valid_count);
+      if (threadIdx.x == 0) { atomicAdd(out_valid_counts + col_idx, block_valid_count); }
+      // Keep the block-wide reduction storage from being reused by the next column too early
+      __syncthreads();
+    }
+  }
+}
+
 }  // anonymous namespace
 
 namespace detail {
+namespace {
+
+/**
+ * @brief Tiles the given fixed-width columns of the table with a single kernel.
+ *
+ * @param in Table to tile
+ * @param column_indices Indices of the fixed-width columns to tile
+ * @param output_size Number of rows of the output columns
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned columns' device memory
+ * @return The tiled columns, in the order of `column_indices`
+ */
+std::vector<std::unique_ptr<column>> batched_tile(table_view const& in,
+                                                  host_span<size_type const> column_indices,
+                                                  size_type output_size,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  using mask_policy      = cudf::mask_allocation_policy;
+  auto const num_columns = column_indices.size();
+
+  std::vector<std::unique_ptr<column>> out_columns;
+  out_columns.reserve(num_columns);
+  auto input_views  = thrust::host_vector<column_device_view>();
+  auto output_views = thrust::host_vector<mutable_column_device_view>();
+  auto widths       = thrust::host_vector<int32_t>();
+  input_views.reserve(num_columns);
+  output_views.reserve(num_columns);
+  widths.reserve(num_columns);
+  for (auto const col_idx : column_indices) {
+    auto const& input = in.column(col_idx);
+    out_columns.push_back(detail::allocate_like(
+      input, output_size, input.nullable() ? mask_policy::ALWAYS : mask_policy::NEVER, stream, mr));
+    // Fixed-width columns have no children, so their device views need no device storage
+    output_views.push_back(
+      *mutable_column_device_view::create(out_columns.back()->mutable_view(), stream));
+    input_views.push_back(*column_device_view::create(input, stream));
+    widths.push_back(static_cast<int32_t>(cudf::size_of(input.type())));
+  }
+
+  auto const temp_mr  = rmm::mr::get_current_device_resource();
+  auto d_input_views  = make_device_uvector_async(input_views, stream, temp_mr);
+  auto d_output_views = make_device_uvector_async(output_views, stream, temp_mr);
+  auto d_widths       = make_device_uvector_async(widths, stream, temp_mr);
+  auto d_valid_counts = make_zeroed_device_uvector_async<size_type>(num_columns, stream, temp_mr);
+
+  constexpr size_type block_size{256};
+  constexpr size_type max_grid_columns{65535};
+  cudf::detail::grid_1d config(output_size, block_size);
+  dim3 const grid(config.num_blocks, std::min<size_type>(num_columns, max_grid_columns));
+  batched_tile_kernel<block_size><<<grid, block_size, 0, stream.value()>>>(
+    d_input_views.data(),
+    d_widths.data(),
+    d_output_views.data(),
+    static_cast<size_type>(num_columns),
+    d_valid_counts.data());
+
+  auto const valid_counts = make_std_vector_sync(d_valid_counts, stream);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    auto& col = out_columns[i];
+    if (col->nullable()) { col->set_null_count(output_size - valid_counts[i]); }
+  }
+  return out_columns;
+}
+
+}  // namespace
+
 std::unique_ptr<table> tile(table_view const& in,
                             size_type count,
                             rmm::cuda_stream_view stream,
@@ -53,11 +226,43 @@ std::unique_ptr<table> tile(table_view const& in,
 
   if (count == 0 or in_num_rows == 0) { return empty_like(in); }
 
-  auto out_num_rows = in_num_rows * count;
-  auto tiled_it     = cudf::detail::make_counting_transform_iterator(0, tile_functor{in_num_rows});
+  CUDF_EXPECTS(static_cast<int64_t>(in_num_rows) * count <= std::numeric_limits<size_type>::max(),
+               "Size of the tiled table exceeds the column size limit",
+               std::overflow_error);
+  auto const out_num_rows = in_num_rows * count;
+
+  // The fixed-width columns are tiled together by one kernel, the others are gathered
+  std::vector<size_type> batched_indices;
+  std::vector<size_type> gathered_indices;
+  for (size_type i = 0; i < in.num_columns(); ++i) {
+    if (is_fixed_width(in.column(i).type())) {
+      batched_indices.push_back(i);
+    } else {
+      gathered_indices.push_back(i);
+    }
+  }
 
-  return detail::gather(
-    in, tiled_it, tiled_it + out_num_rows, out_of_bounds_policy::DONT_CHECK, stream, mr);
+  std::vector<std::unique_ptr<column>> out_columns(in.num_columns());
+  if (!batched_indices.empty()) {
+    auto batched_columns = batched_tile(in, batched_indices, out_num_rows, stream, mr);
+    for (std::size_t i = 0; i < batched_indices.size(); ++i) {
+      out_columns[batched_indices[i]] = std::move(batched_columns[i]);
+    }
+  }
+  if (!gathered_indices.empty()) {
+    auto tiled_it = cudf::detail::make_counting_transform_iterator(0, tile_functor{in_num_rows});
+    auto gathered = detail::gather(in.select(gathered_indices),
+                                   tiled_it,
+                                   tiled_it + out_num_rows,
+                                   out_of_bounds_policy::DONT_CHECK,
+                                   stream,
+                                   mr)
+                      ->release();
+    for (std::size_t i = 0; i < gathered_indices.size(); ++i) {
+      out_columns[gathered_indices[i]] = std::move(gathered[i]);
+    }
+  }
+  return std::make_unique<table>(std::move(out_columns));
 }
 }  // namespace detail
 
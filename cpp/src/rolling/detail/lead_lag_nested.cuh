@@ -18,88 +18,110 @@
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column.hpp>
-#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
-#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/gather.hpp>
-#include <cudf/detail/scatter.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
 #include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_checks.hpp>
 
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
-#include <cuda/functional>
-#include <thrust/binary_search.h>
-#include <thrust/copy.h>
-#include <thrust/distance.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace cudf::detail {
 namespace {
 
 /**
- * @brief Predicate to find indices at which LEAD/LAG evaluated to null.
+ * @brief Computes the gather maps of several LEAD/LAG offsets at once.
+ *
+ * Element `idx` is the gather index of row `idx % input_size` for the offset
+ * `idx / input_size`. Rows whose LEAD/LAG crosses the column/group boundary
+ * gather `null_index`, or their own row of the defaults when there are defaults.
  */
-template <typename GatherMapIter>
-class is_null_index_predicate_impl {
- public:
-  is_null_index_predicate_impl(size_type input_size, GatherMapIter gather_)
-    : _null_index{input_size}, _gather{gather_}
+template <typename PrecedingIter, typename FollowingIter>
+struct lead_lag_gather_map_fn {
+  PrecedingIter preceding;
+  FollowingIter following;
+  aggregation::Kind const* ops;
+  size_type const* row_offsets;
+  size_type input_size;
+  bool has_defaults;
+
+  __device__ size_type operator()(std::size_t idx) const
   {
+    auto const offset_idx = idx / input_size;
+    auto const i          = static_cast<size_type>(idx % input_size);
+    auto const row_offset = row_offsets[offset_idx];
+    // the defaults are gathered from after the input rows
+    auto const null_index = has_defaults ? input_size + i : input_size;
+
+    // Note: grouped_*rolling_window() trims preceding/following to
+    // the beginning/end of the group. `rolling_window()` does not.
+    // Must trim them so as not to go past the column start/end.
+    if (ops[offset_idx] == aggregation::LEAD) {
+      auto _following = min(following[i], input_size - i - 1);
+      return (row_offset > _following) ? null_index : (i + row_offset);
+    }
+    auto _preceding = min(preceding[i], i + 1);
+    return (row_offset > (_preceding - 1)) ? null_index : (i - row_offset);
   }
-
-  bool __device__ operator()(size_type i) const { return _gather[i] == _null_index; }
-
- private:
-  size_type const _null_index;  // Index value to use to output NULL for LEAD/LAG calculation.
-  GatherMapIter _gather;        // Iterator for gather-map entries.
 };
 
-/**
- * @brief Helper to construct is_null_index_predicate_impl
- */
-template <typename GatherMapIter>
-is_null_index_predicate_impl<GatherMapIter> is_null_index_predicate(size_type input_size,
-                                                                    GatherMapIter gather)
-{
-  return is_null_index_predicate_impl<GatherMapIter>{input_size, gather};
-}
-
 }  // namespace
 
 /**
- * @brief Helper function to calculate LEAD/LAG for nested-type input columns.
+ * @brief Helper function to calculate several LEAD/LAG aggregations of the same
+ * nested-type input column.
+ *
+ * The gather maps of all the offsets are computed by a single kernel. When there are
+ * default outputs, the input and the defaults are concatenated once and every output
+ * is a single gather from the concatenation, instead of a gather followed by a scatter
+ * of the defaults.
  *
  * @tparam PrecedingIterator Iterator-type that returns the preceding bounds
  * @tparam FollowingIterator Iterator-type that returns the following bounds
- * @param[in] op Aggregation kind.
+ * @param[in] ops Aggregation kind of each output, LEAD or LAG
+ * @param[in] row_offsets Lead/Lag offset of each output, indicating which row
+ *                        after/before the current row is to be returned
  * @param[in] input Nested-type input column for LEAD/LAG calculation
  * @param[in] default_outputs Default values to use as outputs, if LEAD/LAG
  *                            offset crosses column/group boundaries
  * @param[in] preceding Iterator to retrieve preceding window bounds
  * @param[in] following Iterator to retrieve following window bounds
- * @param[in] row_offset Lead/Lag offset, indicating which row after/before
- *                       the current row is to be returned
  * @param[in] stream CUDA stream for device memory operations/allocations
  * @param[in] mr device_memory_resource for device memory allocations
+ * @return One output column for each of `ops`
  */
 template <typename PrecedingIter, typename FollowingIter>
-std::unique_ptr<column> compute_lead_lag_for_nested(aggregation::Kind op,
-                                                    column_view const& input,
-                                                    column_view const& default_outputs,
-                                                    PrecedingIter preceding,
-                                                    FollowingIter following,
-                                                    size_type row_offset,
-                                                    rmm::cuda_stream_view stream,
-                                                    rmm::device_async_resource_ref mr)
+std::vector<std::unique_ptr<column>> compute_lead_lag_for_nested(
+  host_span<aggregation::Kind const> ops,
+  host_span<size_type const> row_offsets,
+  column_view const& input,
+  column_view const& default_outputs,
+  PrecedingIter preceding,
+  FollowingIter following,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
 {
-  CUDF_EXPECTS(op == aggregation::LEAD || op == aggregation::LAG,
+  CUDF_EXPECTS(ops.size() == row_offsets.size(),
+               "Each LEAD/LAG aggregation must have one offset.");
+  CUDF_EXPECTS(std::all_of(ops.begin(),
+                           ops.end(),
+                           [](auto op) {
+                             return op == aggregation::LEAD || op == aggregation::LAG;
+                           }),
                "Unexpected aggregation type in compute_lead_lag_for_nested");
   CUDF_EXPECTS(cudf::have_same_types(input, default_outputs),
                "Defaults column type must match input column.",
@@ -108,13 +130,10 @@ std::unique_ptr<column> compute_lead_lag_for_nested(aggregation::Kind op,
   CUDF_EXPECTS(default_outputs.is_empty() || (input.size() == default_outputs.size()),
                "Number of defaults must match input column.");
 
-  // For LEAD(0)/LAG(0), no computation need be performed.
-  // Return copy of input.
-  if (row_offset == 0) { return std::make_unique<column>(input, stream, mr); }
-
   // Algorithm:
   //
-  // 1. Construct gather_map with the LEAD/LAG offset applied to the indices.
+  // 1. Construct the gather_maps of all the offsets with the LEAD/LAG offset
+  //    applied to the indices.
   //    E.g. A gather_map of:
   //        {0, 1, 2, 3, ..., N-3, N-2, N-1}
   //    would select the input column, unchanged.
@@ -126,90 +145,99 @@ std::unique_ptr<column> compute_lead_lag_for_nested(aggregation::Kind op,
   //    Similarly, LAG(2) is implemented using the following gather_map:
   //        {NULL_INDEX, NULL_INDEX, 0, 1, 2...}
   //
-  // 2. Gather input column based on the gather_map.
-  // 3. If default outputs are available, scatter contents of `default_outputs`
-  //    to all positions where nulls where gathered in step 2.
+  //    If default outputs are available, the `NULL_INDEX` of row `i` is `N+i`
+  //    instead, which selects row `i` of the defaults appended to the input.
   //
-  // Note: Step 3 can be switched to use `copy_if_else()`, once it supports
-  //       nested types.
-
-  auto static constexpr size_data_type = data_type{type_to_id<size_type>()};
-
-  auto gather_map_column =
-    make_numeric_column(size_data_type, input.size(), mask_state::UNALLOCATED, stream);
-  auto gather_map = gather_map_column->mutable_view();
-
-  auto const input_size = input.size();
-  auto const null_index = input.size();
-  if (op == aggregation::LEAD) {
-    thrust::transform(rmm::exec_policy(stream),
-                      thrust::make_counting_iterator(size_type{0}),
-                      thrust::make_counting_iterator(size_type{input.size()}),
-                      gather_map.begin<size_type>(),
-                      cuda::proclaim_return_type<size_type>(
-                        [following, input_size, null_index, row_offset] __device__(size_type i) {
-                          // Note: grouped_*rolling_window() trims preceding/following to
-                          // the beginning/end of the group. `rolling_window()` does not.
-                          // Must trim _following[i] so as not to go past the column end.
-                          auto _following = min(following[i], input_size - i - 1);
-                          return (row_offset > _following) ? null_index : (i + row_offset);
-                        }));
-  } else {
-    thrust::transform(rmm::exec_policy(stream),
-                      thrust::make_counting_iterator(size_type{0}),
-                      thrust::make_counting_iterator(size_type{input.size()}),
-                      gather_map.begin<size_type>(),
-                      cuda::proclaim_return_type<size_type>(
-                        [preceding, input_size, null_index, row_offset] __device__(size_type i) {
-                          // Note: grouped_*rolling_window() trims preceding/following to
-                          // the beginning/end of the group. `rolling_window()` does not.
-                          // Must trim _preceding[i] so as not to go past the column start.
-                          auto _preceding = min(preceding[i], i + 1);
-                          return (row_offset > (_preceding - 1)) ? null_index : (i - row_offset);
-                        }));
+  // 2. Gather each output from the input (with defaults) based on its gather_map.
+
+  auto const input_size   = input.size();
+  auto const num_outputs  = ops.size();
+  auto const has_defaults = !default_outputs.is_empty();
+
+  auto const d_ops =
+    cudf::detail::make_device_uvector_async(ops, stream, rmm::mr::get_current_device_resource());
+  auto const d_row_offsets = cudf::detail::make_device_uvector_async(
+    row_offsets, stream, rmm::mr::get_current_device_resource());
+
+  auto gather_maps =
+    rmm::device_uvector<size_type>(num_outputs * static_cast<std::size_t>(input_size), stream);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator(std::size_t{0}),
+                    thrust::make_counting_iterator(gather_maps.size()),
+                    gather_maps.begin(),
+                    lead_lag_gather_map_fn<PrecedingIter, FollowingIter>{preceding,
+                                                                         following,
+                                                                         d_ops.data(),
+                                                                         d_row_offsets.data(),
+                                                                         input_size,
+                                                                         has_defaults});
+
+  // Shared by all the outputs, so that the defaults are materialized only once.
+  auto const input_with_defaults =
+    has_defaults ? cudf::detail::concatenate(std::vector<column_view>{input, default_outputs},
+                                             stream,
+                                             rmm::mr::get_current_device_resource())
+                 : std::unique_ptr<column>{};
+  auto const source = has_defaults ? input_with_defaults->view() : input;
+
+  std::vector<std::unique_ptr<column>> results;
+  results.reserve(num_outputs);
+  for (std::size_t o = 0; o < num_outputs; ++o) {
+    // For LEAD(0)/LAG(0), no computation need be performed.
+    // Return copy of input.
+    if (row_offsets[o] == 0) {
+      results.push_back(std::make_unique<column>(input, stream, mr));
+      continue;
+    }
+    auto const gather_map = device_span<size_type const>{
+      gather_maps.data() + o * static_cast<std::size_t>(input_size),
+      static_cast<std::size_t>(input_size)};
+    auto output = cudf::detail::gather(table_view{std::vector<column_view>{source}},
+                                       gather_map,
+                                       out_of_bounds_policy::NULLIFY,
+                                       cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                       stream,
+                                       mr);
+    results.push_back(std::move(output->release()[0]));
   }
+  return results;
+}
 
-  auto output_with_nulls = cudf::detail::gather(table_view{std::vector<column_view>{input}},
-                                                gather_map_column->view(),
-                                                out_of_bounds_policy::NULLIFY,
-                                                cudf::detail::negative_index_policy::NOT_ALLOWED,
-                                                stream,
-                                                mr);
-
-  if (default_outputs.is_empty()) { return std::move(output_with_nulls->release()[0]); }
-
-  // Must scatter defaults.
-  auto scatter_map = rmm::device_uvector<size_type>(input.size(), stream);
-
-  // Find all indices at which LEAD/LAG computed nulls previously.
-  auto scatter_map_end =
-    thrust::copy_if(rmm::exec_policy(stream),
-                    thrust::make_counting_iterator(size_type{0}),
-                    thrust::make_counting_iterator(size_type{input.size()}),
-                    scatter_map.begin(),
-                    is_null_index_predicate(input.size(), gather_map.begin<size_type>()));
-
-  scatter_map.resize(thrust::distance(scatter_map.begin(), scatter_map_end), stream);
-  // Bail early, if all LEAD/LAG computations succeeded. No defaults need be substituted.
-  if (scatter_map.is_empty()) { return std::move(output_with_nulls->release()[0]); }
-
-  // Gather only those default values that are to be substituted.
-  auto gathered_defaults =
-    cudf::detail::gather(table_view{std::vector<column_view>{default_outputs}},
-                         scatter_map,
-                         out_of_bounds_policy::DONT_CHECK,
-                         cudf::detail::negative_index_policy::NOT_ALLOWED,
-                         stream,
-                         rmm::mr::get_current_device_resource());
-
-  // Scatter defaults into locations where LEAD/LAG computed nulls.
-  auto scattered_results = cudf::detail::scatter(
-    table_view{std::vector<column_view>{gathered_defaults->release()[0]->view()}},
-    scatter_map,
-    table_view{std::vector<column_view>{output_with_nulls->release()[0]->view()}},
-    stream,
-    mr);
-  return std::move(scattered_results->release()[0]);
+/**
+ * @brief Helper function to calculate LEAD/LAG for nested-type input columns.
+ *
+ * @tparam PrecedingIterator Iterator-type that returns the preceding bounds
+ * @tparam FollowingIterator Iterator-type that returns the following bounds
+ * @param[in] op Aggregation kind.
+ * @param[in] input Nested-type input column for LEAD/LAG calculation
+ * @param[in] default_outputs Default values to use as outputs, if LEAD/LAG
+ *                            offset crosses column/group boundaries
+ * @param[in] preceding Iterator to retrieve preceding window bounds
+ * @param[in] following Iterator to retrieve following window bounds
+ * @param[in] row_offset Lead/Lag offset, indicating which row after/before
+ *                       the current row is to be returned
+ * @param[in] stream CUDA stream for device memory operations/allocations
+ * @param[in] mr device_memory_resource for device memory allocations
+ */
+template <typename PrecedingIter, typename FollowingIter>
+std::unique_ptr<column> compute_lead_lag_for_nested(aggregation::Kind op,
+                                                    column_view const& input,
+                                                    column_view const& default_outputs,
+                                                    PrecedingIter preceding,
+                                                    FollowingIter following,
+                                                    size_type row_offset,
+                                                    rmm::cuda_stream_view stream,
+                                                    rmm::device_async_resource_ref mr)
+{
+  auto results = compute_lead_lag_for_nested(host_span<aggregation::Kind const>{&op, 1},
+                                             host_span<size_type const>{&row_offset, 1},
+                                             input,
+                                             default_outputs,
+                                             preceding,
+                                             following,
+                                             stream,
+                                             mr);
+  return std::move(results.front());
 }
 
 }  // namespace cudf::detail
@@ -25,6 +25,7 @@
 #include "rolling.hpp"
 #include "rolling_collect_list.cuh"
 #include "rolling_jit.hpp"
+#include "rolling_sliding.cuh"
 
 #include <cudf/aggregation.hpp>
 #include <cudf/column/column_device_view.cuh>
@@ -54,6 +55,7 @@
 
 #include <cuda/std/climits>
 #include <cuda/std/limits>
+#include <thrust/copy.h>
 #include <thrust/count.h>
 #include <thrust/execution_policy.h>
 #include <thrust/find.h>
@@ -1098,6 +1100,20 @@ struct rolling_window_launcher {
              rmm::cuda_stream_view stream,
              rmm::device_async_resource_ref mr)
   {
+    // Large windows are aggregated from precomputed prefix structures instead of row by row
+    if constexpr (is_sliding_window_supported<InputType, op>()) {
+      if (use_sliding_window(
+            input.size(), preceding_window_begin, following_window_begin, stream)) {
+        return sliding_rolling_window<InputType, op>(input,
+                                                     preceding_window_begin,
+                                                     following_window_begin,
+                                                     min_periods,
+                                                     agg,
+                                                     stream,
+                                                     mr);
+      }
+    }
+
     auto const do_rolling = [&](auto const& device_op) {
       auto output = make_fixed_width_column(
         target_type(input.type(), op), input.size(), mask_state::UNINITIALIZED, stream, mr);
@@ -1281,10 +1297,9 @@ std::unique_ptr<column> rolling_window_udf(column_view const& input,
                    preceding_window_str.c_str(),
                    following_window_str.c_str());
 
-  cudf::jit::get_program_cache(*rolling_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"rolling/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                 //
+  cudf::jit::get_kernel(
+    *rolling_jit_kernel_cu_jit, kernel_name, "rolling/jit/operation-udf.hpp", cuda_source)  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
     ->launch(input.size(),
              cudf::jit::get_data_ptr(input),
              input.null_mask(),
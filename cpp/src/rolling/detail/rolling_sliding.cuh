@@ -0,0 +1,455 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include "rolling.hpp"
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/column/column_view.hpp>
+#include <cudf/detail/aggregation/aggregation.cuh>
+#include <cudf/detail/aggregation/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/utilities/device_operators.cuh>
+#include <cudf/detail/valid_if.cuh>
+#include <cudf/types.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <cuda/std/limits>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/reverse_iterator.h>
+#include <thrust/pair.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <cmath>
+#include <memory>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * Sliding window implementations of rolling aggregations.
+ *
+ * The generic rolling kernel aggregates every window from scratch, which costs O(W) per row for
+ * windows of W rows. The aggregations below instead precompute a structure over the whole column
+ * from which any window is answered in constant time:
+ *
+ * - SUM, MEAN and COUNT_VALID take the difference of two prefix sums.
+ * - MIN and MAX combine the prefix and suffix extrema within blocks of rows with a sparse table
+ *   over the extrema of whole blocks.
+ * - VARIANCE takes the differences of two exact 128-bit prefix sums of the values and of their
+ *   squares. Values wider than 32 bits are aggregated by the rolling kernel, since the sums of
+ *   their squares could overflow.
+ *
+ * Floating point inputs are always aggregated by the rolling kernel, since neither rounding errors
+ * nor infinities and NaNs cancel out of differences of prefixes.
+ */
+
+// Windows are aggregated by the sliding implementations when their average size is at least this
+constexpr size_type sliding_window_min_average_size = 64;
+// Number of rows of the blocks of the MIN/MAX sparse table
+constexpr size_type sliding_minmax_block_size = 32;
+
+/**
+ * @brief Checks if the `op` rolling aggregation of `InputType` values has a sliding implementation
+ */
+template <typename InputType, aggregation::Kind op>
+constexpr bool is_sliding_window_supported()
+{
+  if constexpr (op == aggregation::SUM) {
+    // Differences of prefix sums are only exact for integers
+    return (cudf::is_integral_not_bool<InputType>() or cudf::is_fixed_point<InputType>()) and
+           cudf::detail::is_valid_aggregation<InputType, op>();
+  } else if constexpr (op == aggregation::MEAN) {
+    // Integer means are floating point, so the sums they are computed from must not overflow
+    return ((cudf::is_integral_not_bool<InputType>() and sizeof(InputType) <= sizeof(int32_t)) or
+            cudf::is_fixed_point<InputType>()) and
+           cudf::detail::is_valid_aggregation<InputType, op>();
+  } else if constexpr (op == aggregation::MIN or op == aggregation::MAX) {
+    // Floating point extrema depend on the order NaNs are combined in
+    return cudf::is_fixed_width<InputType>() and not cudf::is_floating_point<InputType>() and
+           cudf::detail::is_valid_aggregation<InputType, op>();
+  } else if constexpr (op == aggregation::VARIANCE) {
+    // The sums of squares are only exact in 128 bits for values of up to 32 bits
+    if constexpr (cudf::is_fixed_point<InputType>()) {
+      return sizeof(device_storage_type_t<InputType>) <= sizeof(int32_t);
+    } else {
+      return cudf::is_integral_not_bool<InputType>() and sizeof(InputType) <= sizeof(int32_t);
+    }
+  } else {
+    return op == aggregation::COUNT_VALID;
+  }
+}
+
+/**
+ * @brief Computes the rows `[start, end)` of the window of a row, as the rolling kernel does
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+struct window_bounds_fn {
+  size_type num_rows;
+  PrecedingWindowIterator preceding_window_begin;
+  FollowingWindowIterator following_window_begin;
+
+  __device__ thrust::pair<size_type, size_type> operator()(size_type i) const
+  {
+    // to prevent overflow issues when computing bounds use int64_t
+    int64_t const preceding_window = preceding_window_begin[i];
+    int64_t const following_window = following_window_begin[i];
+
+    auto const start = static_cast<size_type>(
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, i - preceding_window + 1)));
+    auto const end = static_cast<size_type>(
+      min(static_cast<int64_t>(num_rows), max(int64_t{0}, i + following_window + 1)));
+    return {min(start, end), max(start, end)};
+  }
+};
+
+/**
+ * @brief Checks if the windows are large enough for the sliding implementations to be faster
+ */
+template <typename PrecedingWindowIterator, typename FollowingWindowIterator>
+bool use_sliding_window(size_type num_rows,
+                        PrecedingWindowIterator preceding_window_begin,
+                        FollowingWindowIterator following_window_begin,
+                        rmm::cuda_stream_view stream)
+{
+  auto const bounds = window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+    num_rows, preceding_window_begin, following_window_begin};
+  auto const total_size = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(num_rows),
+    cuda::proclaim_return_type<int64_t>([bounds] __device__(size_type i) {
+      auto const [start, end] = bounds(i);
+      return static_cast<int64_t>(end - start);
+    }),
+    int64_t{0},
+    thrust::plus<int64_t>{});
+  return total_size >= static_cast<int64_t>(num_rows) * sliding_window_min_average_size;
+}
+
+/**
+ * @brief Computes the `num_rows + 1` exclusive prefix sums of `value_fn(i)`
+ */
+template <typename T, typename ValueFn>
+rmm::device_uvector<T> exclusive_prefix_sums(size_type num_rows,
+                                             ValueFn value_fn,
+                                             rmm::cuda_stream_view stream)
+{
+  rmm::device_uvector<T> sums(num_rows + 1, stream);
+  auto const values = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<T>([value_fn, num_rows] __device__(size_type i) {
+      return i < num_rows ? value_fn(i) : T{0};
+    }));
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), values, values + num_rows + 1, sums.begin(), T{0});
+  return sums;
+}
+
+/**
+ * @brief Combines two values with the MIN or MAX device operator
+ */
+template <typename T, typename AggOp>
+struct minmax_combine_fn {
+  __device__ T operator()(T const& lhs, T const& rhs) const { return AggOp{}(lhs, rhs); }
+};
+
+/**
+ * @brief Answers MIN or MAX queries over any range of rows in constant time
+ *
+ * The rows are split into blocks of `sliding_minmax_block_size` rows. A range spanning several
+ * blocks combines the suffix extremum of its first block, the prefix extremum of its last block,
+ * and two overlapping power-of-two spans of a sparse table over the extrema of the blocks in
+ * between. A range within a single block is scanned directly.
+ */
+template <typename T, typename AggOp>
+struct minmax_range_fn {
+  T const* values;
+  T const* block_prefix;
+  T const* block_suffix;
+  T const* table;  ///< level `k` holds the extrema of the `2^k` blocks starting at each block
+  size_type num_blocks;
+
+  __device__ T operator()(size_type start, size_type end) const
+  {
+    auto const combine = minmax_combine_fn<T, AggOp>{};
+    if (start >= end) { return AggOp::template identity<T>(); }
+    auto const first_block = start / sliding_minmax_block_size;
+    auto const last_block  = (end - 1) / sliding_minmax_block_size;
+    if (first_block == last_block) {
+      auto result = AggOp::template identity<T>();
+      for (auto i = start; i < end; ++i) {
+        result = combine(result, values[i]);
+      }
+      return result;
+    }
+    auto result = combine(block_suffix[start], block_prefix[end - 1]);
+    if (last_block - first_block > 1) {
+      auto const lo    = first_block + 1;
+      auto const hi    = last_block - 1;
+      auto const level = 31 - __clz(hi - lo + 1);
+      auto const row   = table + static_cast<int64_t>(level) * num_blocks;
+      result = combine(result, combine(row[lo], row[hi - (size_type{1} << level) + 1]));
+    }
+    return result;
+  }
+};
+
+/**
+ * @brief Computes a rolling SUM, MEAN, MIN, MAX, COUNT_VALID or VARIANCE aggregation with its
+ * sliding implementation
+ *
+ * The results are the same as those of the rolling kernel, except for the rounding of variances.
+ *
+ * Precondition: `is_sliding_window_supported<InputType, op>()` is true.
+ */
+template <typename InputType,
+          aggregation::Kind op,
+          typename PrecedingWindowIterator,
+          typename FollowingWindowIterator>
+std::unique_ptr<column> sliding_rolling_window(column_view const& input,
+                                               PrecedingWindowIterator preceding_window_begin,
+                                               FollowingWindowIterator following_window_begin,
+                                               size_type min_periods,
+                                               rolling_aggregation const& agg,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  using OutType         = device_storage_type_t<target_type_t<InputType, op>>;
+  using DeviceInputType = device_storage_type_t<InputType>;
+
+  auto const num_rows = input.size();
+  auto const bounds   = window_bounds_fn<PrecedingWindowIterator, FollowingWindowIterator>{
+    num_rows, preceding_window_begin, following_window_begin};
+  auto const d_input_ptr = column_device_view::create(input, stream);
+  auto const d_input     = *d_input_ptr;
+  auto const has_nulls   = input.has_nulls();
+
+  // Valid counts of the windows
+  auto const valid_counts = has_nulls ? exclusive_prefix_sums<size_type>(
+                                          num_rows,
+                                          [d_input] __device__(size_type i) {
+                                            return static_cast<size_type>(d_input.is_valid(i));
+                                          },
+                                          stream)
+                                      : rmm::device_uvector<size_type>(0, stream);
+  auto const window_count = cuda::proclaim_return_type<size_type>(
+    [bounds, has_nulls, d_counts = valid_counts.data()] __device__(size_type i) {
+      auto const [start, end] = bounds(i);
+      return has_nulls ? d_counts[end] - d_counts[start] : end - start;
+    });
+
+  auto output = make_fixed_width_column(
+    target_type(input.type(), op), num_rows, mask_state::UNALLOCATED, stream, mr);
+  auto const d_output = output->mutable_view().template begin<OutType>();
+  auto const rows     = thrust::counting_iterator<size_type>(0);
+
+  auto const set_validity = [&](auto const is_valid_fn) {
+    auto [null_mask, null_count] =
+      cudf::detail::valid_if(rows, rows + num_rows, is_valid_fn, stream, mr);
+    if (null_count > 0) { output->set_null_mask(std::move(null_mask), null_count); }
+  };
+
+  if constexpr (op == aggregation::COUNT_VALID) {
+    // COUNT_VALID is valid when the whole window meets min_periods
+    thrust::transform(rmm::exec_policy(stream), rows, rows + num_rows, d_output, window_count);
+    set_validity([bounds, min_periods] __device__(size_type i) {
+      auto const [start, end] = bounds(i);
+      return end - start >= min_periods;
+    });
+  } else if constexpr (op == aggregation::SUM or op == aggregation::MEAN) {
+    // Sums wrap around like those of the rolling kernel. The means of 32-bit integers are computed
+    // from 64-bit sums, which hold the sum of any number of rows exactly.
+    using SumType = std::conditional_t<std::is_floating_point_v<OutType>, int64_t, OutType>;
+    auto const sums = exclusive_prefix_sums<SumType>(
+      num_rows,
+      [d_input, has_nulls] __device__(size_type i) {
+        return has_nulls and d_input.is_null(i)
+                 ? SumType{0}
+                 : static_cast<SumType>(d_input.element<DeviceInputType>(i));
+      },
+      stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      d_output,
+                      cuda::proclaim_return_type<OutType>(
+                        [bounds, window_count, d_sums = sums.data()] __device__(size_type i) {
+                          auto const [start, end] = bounds(i);
+                          OutType val = static_cast<OutType>(d_sums[end] - d_sums[start]);
+                          OutType out{};
+                          cudf::detail::rolling_store_output_functor<OutType,
+                                                                     op == aggregation::MEAN>{}(
+                            out, val, window_count(i));
+                          return out;
+                        }));
+    set_validity([window_count, min_periods] __device__(size_type i) {
+      return window_count(i) >= min_periods;
+    });
+  } else if constexpr (op == aggregation::MIN or op == aggregation::MAX) {
+    using AggOp        = typename corresponding_operator<op>::type;
+    auto const combine = minmax_combine_fn<OutType, AggOp>{};
+
+    rmm::device_uvector<OutType> values(num_rows, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      values.begin(),
+                      cuda::proclaim_return_type<OutType>([d_input, has_nulls] __device__(
+                                                            size_type i) {
+                        return has_nulls and d_input.is_null(i)
+                                 ? AggOp::template identity<OutType>()
+                                 : static_cast<OutType>(d_input.element<DeviceInputType>(i));
+                      }));
+
+    // Extrema of the rows of each block up to, and from, each row
+    auto const block_ids = cudf::detail::make_counting_transform_iterator(
+      0, cuda::proclaim_return_type<size_type>([] __device__(size_type i) {
+        return i / sliding_minmax_block_size;
+      }));
+    rmm::device_uvector<OutType> block_prefix(num_rows, stream);
+    rmm::device_uvector<OutType> block_suffix(num_rows, stream);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  block_ids,
+                                  block_ids + num_rows,
+                                  values.begin(),
+                                  block_prefix.begin(),
+                                  thrust::equal_to<size_type>{},
+                                  combine);
+    thrust::inclusive_scan_by_key(rmm::exec_policy(stream),
+                                  thrust::make_reverse_iterator(block_ids + num_rows),
+                                  thrust::make_reverse_iterator(block_ids),
+                                  thrust::make_reverse_iterator(values.end()),
+                                  thrust::make_reverse_iterator(block_suffix.end()),
+                                  thrust::equal_to<size_type>{},
+                                  combine);
+
+    // Sparse table over the extrema of the blocks
+    auto const num_blocks =
+      (num_rows + sliding_minmax_block_size - 1) / sliding_minmax_block_size;
+    auto num_levels = 1;
+    while ((size_type{1} << num_levels) <= num_blocks) {
+      ++num_levels;
+    }
+    rmm::device_uvector<OutType> table(static_cast<std::size_t>(num_levels) * num_blocks, stream);
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_blocks,
+                      table.begin(),
+                      cuda::proclaim_return_type<OutType>(
+                        [d_suffix = block_suffix.data()] __device__(size_type block) {
+                          return d_suffix[block * sliding_minmax_block_size];
+                        }));
+    for (auto level = 1; level < num_levels; ++level) {
+      auto const half = size_type{1} << (level - 1);
+      auto const prev = table.data() + static_cast<int64_t>(level - 1) * num_blocks;
+      thrust::transform(
+        rmm::exec_policy(stream),
+        rows,
+        rows + num_blocks,
+        table.begin() + static_cast<int64_t>(level) * num_blocks,
+        cuda::proclaim_return_type<OutType>(
+          [prev, half, num_blocks, combine] __device__(size_type block) {
+            return block + half < num_blocks ? combine(prev[block], prev[block + half])
+                                             : prev[block];
+          }));
+    }
+
+    auto const range_fn = minmax_range_fn<OutType, AggOp>{
+      values.data(), block_prefix.data(), block_suffix.data(), table.data(), num_blocks};
+    thrust::transform(rmm::exec_policy(stream),
+                      rows,
+                      rows + num_rows,
+                      d_output,
+                      cuda::proclaim_return_type<OutType>([bounds, range_fn] __device__(size_type i) {
+                        auto const [start, end] = bounds(i);
+                        return range_fn(start, end);
+                      }));
+    set_validity([window_count, min_periods] __device__(size_type i) {
+      return window_count(i) >= min_periods;
+    });
+  } else if constexpr (op == aggregation::VARIANCE) {
+    auto const ddof = dynamic_cast<cudf::detail::var_aggregation const&>(agg)._ddof;
+    // fixed_point values are aggregated unscaled; the variance is scaled by the square of the scale
+    auto const scale_by = [&] {
+      if constexpr (is_fixed_point<InputType>()) {
+        auto const scale = std::pow(10.0, static_cast<double>(input.type().scale()));
+        return scale * scale;
+      } else {
+        return 1.0;
+      }
+    }();
+
+    // Sums of up to 2^31 values of 32 bits and of their squares fit in 128 bits, so the
+    // differences of their prefix sums are exact. Since `count * sum_of_squares - sum * sum`
+    // is also computed exactly, large values do not cancel out of the variances of windows.
+    auto const value_fn = [d_input, has_nulls] __device__(size_type i) {
+      return has_nulls and d_input.is_null(i)
+               ? __int128_t{0}
+               : static_cast<__int128_t>(d_input.element<DeviceInputType>(i));
+    };
+    auto const sums    = exclusive_prefix_sums<__int128_t>(num_rows, value_fn, stream);
+    auto const squares = exclusive_prefix_sums<__int128_t>(
+      num_rows,
+      [value_fn] __device__(size_type i) {
+        auto const value = value_fn(i);
+        return value * value;
+      },
+      stream);
+    thrust::transform(
+      rmm::exec_policy(stream),
+      rows,
+      rows + num_rows,
+      d_output,
+      cuda::proclaim_return_type<OutType>([bounds,
+                                           window_count,
+                                           ddof,
+                                           scale_by,
+                                           d_sums    = sums.data(),
+                                           d_squares = squares.data()] __device__(size_type i) {
+        auto const [start, end] = bounds(i);
+        auto const count        = window_count(i);
+        if (count < ddof) { return cuda::std::numeric_limits<OutType>::signaling_NaN(); }
+        auto const sum = d_sums[end] - d_sums[start];
+        // count^2 times the population variance
+        auto const scaled_m2 = count * (d_squares[end] - d_squares[start]) - sum * sum;
+        return static_cast<OutType>(static_cast<double>(scaled_m2) / count / (count - ddof) *
+                                    scale_by);
+      }));
+    // Result will be null if all inputs are null or fewer than min_periods are valid
+    set_validity([window_count, min_periods] __device__(size_type i) {
+      auto const count = window_count(i);
+      return count > 0 and count >= min_periods;
+    });
+  }
+
+  return output;
+}
+
+}  // namespace detail
+}  // namespace cudf
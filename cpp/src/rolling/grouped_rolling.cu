@@ -28,6 +28,7 @@
 #include <cudf/types.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -36,6 +37,7 @@
 #include <thrust/execution_policy.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/partition.h>
 
@@ -297,6 +299,142 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
   }
 }
 
+std::vector<rolling_result> grouped_rolling_window(table_view const& group_keys,
+                                                   window_bounds preceding_window_bounds,
+                                                   window_bounds following_window_bounds,
+                                                   host_span<rolling_request const> requests,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+
+  for (auto const& request : requests) {
+    CUDF_EXPECTS((group_keys.num_columns() == 0 || group_keys.num_rows() == request.values.size()),
+                 "Size mismatch between group_keys and request values.");
+    CUDF_EXPECTS((request.min_periods >= 0), "min_periods must be non-negative");
+  }
+
+  auto const preceding_window = preceding_window_bounds.value();
+  auto const following_window = following_window_bounds.value();
+
+  CUDF_EXPECTS(-(preceding_window - 1) <= following_window,
+               "Preceding window bounds must precede the following window bounds.");
+
+  // The group-bounded windows are computed once here, instead of for every aggregation
+  auto const has_groups = group_keys.num_columns() > 0 && group_keys.num_rows() > 0;
+  using sort_groupby_helper = cudf::groupby::detail::sort::sort_groupby_helper;
+  std::unique_ptr<sort_groupby_helper> helper;
+  std::unique_ptr<column> preceding_column;
+  std::unique_ptr<column> following_column;
+  if (has_groups) {
+    helper = std::make_unique<sort_groupby_helper>(
+      group_keys, cudf::null_policy::INCLUDE, cudf::sorted::YES, std::vector<null_order>{});
+    auto const& group_offsets{helper->group_offsets(stream)};
+    auto const& group_labels{helper->group_labels(stream)};
+    preceding_column = make_preceding_column(
+      group_offsets, group_labels, preceding_window, group_keys.num_rows(), stream);
+    following_column = make_following_column(
+      group_offsets, group_labels, following_window, group_keys.num_rows(), stream);
+  }
+
+  std::vector<rolling_result> results(requests.size());
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    auto const& input          = requests[i].values;
+    auto const min_periods     = requests[i].min_periods;
+    auto const default_outputs = empty_like(input);
+    auto const& aggregations   = requests[i].aggregations;
+    auto& request_results      = results[i].results;
+    request_results.resize(aggregations.size());
+
+    // The LEAD/LAG aggregations of nested values share one gather map computation
+    auto const is_nested_lead_lag = [&](rolling_aggregation const& aggr) {
+      return (aggr.kind == aggregation::LEAD || aggr.kind == aggregation::LAG) &&
+             !input.is_empty() && !cudf::is_fixed_width(input.type()) &&
+             !cudf::is_dictionary(input.type());
+    };
+    std::vector<std::size_t> lead_lag_indices;
+    std::vector<aggregation::Kind> lead_lag_ops;
+    std::vector<size_type> lead_lag_offsets;
+    for (std::size_t j = 0; j < aggregations.size(); ++j) {
+      if (is_nested_lead_lag(*aggregations[j])) {
+        lead_lag_indices.push_back(j);
+        lead_lag_ops.push_back(aggregations[j]->kind);
+        lead_lag_offsets.push_back(
+          dynamic_cast<cudf::detail::lead_lag_aggregation const&>(*aggregations[j]).row_offset);
+      }
+    }
+    if (!lead_lag_indices.empty()) {
+      auto lead_lags =
+        has_groups
+          ? compute_lead_lag_for_nested(lead_lag_ops,
+                                        lead_lag_offsets,
+                                        input,
+                                        default_outputs->view(),
+                                        preceding_column->view().begin<cudf::size_type>(),
+                                        following_column->view().begin<cudf::size_type>(),
+                                        stream,
+                                        mr)
+          : compute_lead_lag_for_nested(lead_lag_ops,
+                                        lead_lag_offsets,
+                                        input,
+                                        default_outputs->view(),
+                                        thrust::make_constant_iterator(preceding_window),
+                                        thrust::make_constant_iterator(following_window),
+                                        stream,
+                                        mr);
+      for (std::size_t k = 0; k < lead_lag_indices.size(); ++k) {
+        request_results[lead_lag_indices[k]] = std::move(lead_lags[k]);
+      }
+    }
+
+    for (std::size_t j = 0; j < aggregations.size(); ++j) {
+      if (request_results[j]) { continue; }
+      auto const& aggr = aggregations[j];
+      if (!has_groups || input.is_empty() ||
+          can_optimize_unbounded_window(preceding_window_bounds.is_unbounded(),
+                                        following_window_bounds.is_unbounded(),
+                                        min_periods,
+                                        *aggr)) {
+        request_results[j] = grouped_rolling_window(group_keys,
+                                                    input,
+                                                    default_outputs->view(),
+                                                    preceding_window_bounds,
+                                                    following_window_bounds,
+                                                    min_periods,
+                                                    *aggr,
+                                                    stream,
+                                                    mr);
+      } else if (aggr->kind == aggregation::CUDA || aggr->kind == aggregation::PTX) {
+        auto const& group_offsets{helper->group_offsets(stream)};
+        auto const& group_labels{helper->group_labels(stream)};
+        request_results[j] = cudf::detail::rolling_window_udf(
+          input,
+          cudf::detail::preceding_window_wrapper{
+            group_offsets.data(), group_labels.data(), preceding_window},
+          "cudf::detail::preceding_window_wrapper",
+          cudf::detail::following_window_wrapper{
+            group_offsets.data(), group_labels.data(), following_window},
+          "cudf::detail::following_window_wrapper",
+          min_periods,
+          *aggr,
+          stream,
+          mr);
+      } else {
+        request_results[j] =
+          cudf::detail::rolling_window(input,
+                                       default_outputs->view(),
+                                       preceding_column->view().begin<cudf::size_type>(),
+                                       following_column->view().begin<cudf::size_type>(),
+                                       min_periods,
+                                       *aggr,
+                                       stream,
+                                       mr);
+      }
+    }
+  }
+  return results;
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
@@ -319,6 +457,16 @@ std::unique_ptr<column> grouped_rolling_window(table_view const& group_keys,
                                         mr);
 }
 
+std::vector<rolling_result> grouped_rolling_window(table_view const& group_keys,
+                                                   window_bounds preceding_window,
+                                                   window_bounds following_window,
+                                                   host_span<rolling_request const> requests,
+                                                   rmm::device_async_resource_ref mr)
+{
+  return detail::grouped_rolling_window(
+    group_keys, preceding_window, following_window, requests, cudf::get_default_stream(), mr);
+}
+
 namespace {
 
 /**
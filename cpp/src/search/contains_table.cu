@@ -16,9 +16,13 @@
 
 #include "join/join_common_utils.cuh"
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/hashing/detail/helper_functions.cuh>
+#include <cudf/search.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
@@ -26,12 +30,18 @@
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <cuco/static_set.cuh>
 #include <cuda/functional>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
+#include <thrust/uninitialized_fill.h>
 
+#include <algorithm>
+#include <limits>
+#include <memory>
 #include <type_traits>
 
 namespace cudf::detail {
@@ -292,4 +302,236 @@ rmm::device_uvector<bool> contains(table_view const& haystack,
   return contained;
 }
 
+namespace {
+
+/**
+ * @brief Equality comparator of two haystack rows, used to insert the haystack rows.
+ */
+template <typename Equal>
+struct haystack_row_equality {
+  Equal _equal;
+
+  __device__ bool operator()(hash_value_type lhs_row_index,
+                             hash_value_type rhs_row_index) const noexcept
+  {
+    return _equal(lhs_index_type{static_cast<size_type>(lhs_row_index)},
+                  rhs_index_type{static_cast<size_type>(rhs_row_index)});
+  }
+};
+
+/**
+ * @brief Equality comparator of a haystack row and a needle row, used to probe the hash map.
+ *
+ * The comparator compares the rows of a two table comparator built with the haystack on the
+ * left and the needles on the right.
+ */
+template <typename Equal>
+struct needle_row_equality {
+  Equal _equal;
+
+  // cuco's kernels call the operator with the stored haystack key first
+  __device__ bool operator()(hash_value_type haystack_row_index,
+                             hash_value_type needle_row_index) const noexcept
+  {
+    return _equal(lhs_index_type{static_cast<size_type>(haystack_row_index)},
+                  rhs_index_type{static_cast<size_type>(needle_row_index)});
+  }
+};
+
+/**
+ * @brief Device functor to create the hash map pair of a row index.
+ */
+struct make_row_index_pair {
+  __device__ __forceinline__ pair_type operator()(size_type i) const noexcept
+  {
+    // The value is irrelevant since the hash map is only used to check for membership
+    return cuco::make_pair(static_cast<hash_value_type>(i), 0);
+  }
+};
+
+/**
+ * @brief Invokes `func` with the device equality comparator of `comparator` selected by the
+ * nested columns, null and NaN parameters.
+ */
+template <typename Comparator, typename Func>
+void dispatch_equal_to(Comparator const& comparator,
+                       bool has_nested,
+                       bool has_nulls,
+                       null_equality compare_nulls,
+                       nan_equality compare_nans,
+                       Func&& func)
+{
+  using nan_equal_comparator =
+    cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+  using nan_unequal_comparator = cudf::experimental::row::equality::physical_equality_comparator;
+  auto const nulls             = nullate::DYNAMIC{has_nulls};
+  auto const dispatch_nans     = [&](auto const& nan_comparator) {
+    if (has_nested) {
+      func(comparator.template equal_to<true>(nulls, compare_nulls, nan_comparator));
+    } else {
+      func(comparator.template equal_to<false>(nulls, compare_nulls, nan_comparator));
+    }
+  };
+  if (compare_nans == nan_equality::ALL_EQUAL) {
+    dispatch_nans(nan_equal_comparator{});
+  } else {
+    dispatch_nans(nan_unequal_comparator{});
+  }
+}
+
+}  // namespace
+
+/**
+ * @brief Implementation of `cudf::hash_set`.
+ *
+ * The hash map holds the indices of the distinct rows of the haystack. The row comparators are
+ * passed to the map for each operation, so the map can be probed with any needles table.
+ */
+class hash_set {
+ public:
+  hash_set()                           = delete;
+  ~hash_set()                          = default;
+  hash_set(hash_set const&)            = delete;
+  hash_set(hash_set&&)                 = delete;
+  hash_set& operator=(hash_set const&) = delete;
+  hash_set& operator=(hash_set&&)      = delete;
+
+  /**
+   * @copydoc cudf::hash_set::hash_set
+   */
+  hash_set(table_view const& haystack,
+           null_equality compare_nulls,
+           nan_equality compare_nans,
+           rmm::cuda_stream_view stream)
+    : _has_nested{has_nested_columns(haystack)},
+      _haystack_has_nulls{has_nested_nulls(haystack)},
+      _compare_nulls{compare_nulls},
+      _compare_nans{compare_nans},
+      _haystack{haystack},
+      _preprocessed_haystack{
+        cudf::experimental::row::equality::preprocessed_table::create(haystack, stream)},
+      _hash_table{compute_hash_table_size(std::max(haystack.num_rows(), size_type{1})),
+                  cuco::empty_key{std::numeric_limits<hash_value_type>::max()},
+                  cuco::empty_value{cudf::detail::JoinNoneValue},
+                  cudf::detail::cuco_allocator{stream},
+                  stream.value()}
+  {
+    CUDF_EXPECTS(
+      haystack.num_columns() > 0, "The haystack must have columns", std::invalid_argument);
+    if (haystack.num_rows() == 0) { return; }
+
+    auto const row_hash = cudf::experimental::row::hash::row_hasher{_preprocessed_haystack};
+    auto const d_hasher = row_hash.device_hasher(nullate::DYNAMIC{_haystack_has_nulls});
+    auto const self_equal =
+      cudf::experimental::row::equality::two_table_comparator{_preprocessed_haystack,
+                                                              _preprocessed_haystack};
+    auto const iter = cudf::detail::make_counting_transform_iterator(0, make_row_index_pair{});
+
+    auto const insert_rows = [&](auto const& d_equal) {
+      auto const equality = haystack_row_equality<std::decay_t<decltype(d_equal)>>{d_equal};
+      // If the haystack has nulls but they are compared unequal, don't insert them
+      if (compare_nulls == null_equality::EQUAL or not _haystack_has_nulls) {
+        _hash_table.insert(iter, iter + haystack.num_rows(), d_hasher, equality, stream.value());
+      } else {
+        auto const bitmask_buffer_and_ptr = build_row_bitmask(haystack, stream);
+        _hash_table.insert_if(iter,
+                              iter + haystack.num_rows(),
+                              thrust::counting_iterator<size_type>(0),  // stencil
+                              row_is_valid{bitmask_buffer_and_ptr.second},
+                              d_hasher,
+                              equality,
+                              stream.value());
+      }
+    };
+    dispatch_equal_to(self_equal,
+                      _has_nested,
+                      _haystack_has_nulls,
+                      compare_nulls,
+                      compare_nans,
+                      insert_rows);
+  }
+
+  /**
+   * @copydoc cudf::hash_set::contains
+   */
+  std::unique_ptr<column> contains(table_view const& needles,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr) const
+  {
+    CUDF_EXPECTS(cudf::have_same_types(_haystack, needles),
+                 "Column types mismatch",
+                 cudf::data_type_error);
+
+    auto result = make_numeric_column(
+      data_type{type_id::BOOL8}, needles.num_rows(), mask_state::UNALLOCATED, stream, mr);
+    auto const contained = result->mutable_view().begin<bool>();
+    if (needles.num_rows() == 0) { return result; }
+    if (_haystack.num_rows() == 0) {
+      thrust::uninitialized_fill(
+        rmm::exec_policy_nosync(stream), contained, contained + needles.num_rows(), false);
+      return result;
+    }
+
+    auto const has_any_nulls = _haystack_has_nulls or has_nested_nulls(needles);
+    auto const preprocessed_needles =
+      cudf::experimental::row::equality::preprocessed_table::create(needles, stream);
+    auto const row_hash = cudf::experimental::row::hash::row_hasher{preprocessed_needles};
+    auto const d_hasher = row_hash.device_hasher(nullate::DYNAMIC{has_any_nulls});
+    auto const two_table_equal = cudf::experimental::row::equality::two_table_comparator{
+      _preprocessed_haystack, preprocessed_needles};
+
+    auto const contains_rows = [&](auto const& d_equal) {
+      thrust::transform(
+        rmm::exec_policy_nosync(stream),
+        thrust::counting_iterator<size_type>(0),
+        thrust::counting_iterator<size_type>(needles.num_rows()),
+        contained,
+        [hash_table_view = _hash_table.get_device_view(),
+         d_hasher,
+         equality = needle_row_equality<std::decay_t<decltype(d_equal)>>{d_equal}] __device__(
+          size_type row) { return hash_table_view.contains(row, d_hasher, equality); });
+    };
+    dispatch_equal_to(two_table_equal,
+                      _has_nested or has_nested_columns(needles),
+                      has_any_nulls,
+                      _compare_nulls,
+                      _compare_nans,
+                      contains_rows);
+    return result;
+  }
+
+ private:
+  bool const _has_nested;          ///< true if the haystack has nested columns
+  bool const _haystack_has_nulls;  ///< true if the haystack has nulls at any nested level
+  null_equality const _compare_nulls;  ///< whether to consider nulls as equal
+  nan_equality const _compare_nans;    ///< whether to consider NaNs as equal
+  table_view _haystack;                ///< the haystack the hash map is built from
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table>
+    _preprocessed_haystack;   ///< haystack preprocessed for row operators
+  semi_map_type _hash_table;  ///< hash map of the distinct rows of `_haystack`
+};
+
 }  // namespace cudf::detail
+
+namespace cudf {
+
+hash_set::~hash_set() = default;
+
+hash_set::hash_set(table_view const& haystack,
+                   null_equality compare_nulls,
+                   nan_equality compare_nans,
+                   rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  _impl = std::make_unique<impl_type const>(haystack, compare_nulls, compare_nans, stream);
+}
+
+std::unique_ptr<column> hash_set::contains(table_view const& needles,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return _impl->contains(needles, stream, mr);
+}
+
+}  // namespace cudf
@@ -15,9 +15,14 @@
  */
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/gather.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/detail/update_keys.hpp>
+#include <cudf/search.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_device_view.cuh>
 #include <cudf/table/table_view.hpp>
@@ -27,17 +32,163 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
+#include <cuda/std/functional>
 #include <thrust/binary_search.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/transform.h>
 
 namespace cudf {
 namespace detail {
 namespace {
 
+constexpr int search_block_size = 256;
+/// Number of merged haystack and needle rows each thread steps through in a merge-path search
+constexpr int merge_path_items_per_thread = 8;
+
+/**
+ * @brief Returns whether haystack row `haystack_index` comes before needle `needle_index` in the
+ * merged order, where equal needles come first for `lower_bound` and last for `upper_bound`.
+ */
+template <bool find_first, typename Comparator>
+__device__ bool precedes_needle(Comparator const& comparator,
+                                size_type haystack_index,
+                                size_type needle_index)
+{
+  using cudf::experimental::row::lhs_index_type;
+  using cudf::experimental::row::rhs_index_type;
+  if constexpr (find_first) {
+    return comparator(static_cast<lhs_index_type>(haystack_index),
+                      static_cast<rhs_index_type>(needle_index));
+  } else {
+    return not comparator(static_cast<rhs_index_type>(needle_index),
+                          static_cast<lhs_index_type>(haystack_index));
+  }
+}
+
+/**
+ * @brief Searches sorted needles by walking the merge path of the haystack and the needles.
+ *
+ * Each thread finds where its diagonal of the merged rows crosses the merge path with a binary
+ * search, then steps along the path for `merge_path_items_per_thread` rows. The insertion point
+ * of a needle is the number of haystack rows before it on the path.
+ */
+template <bool find_first, typename Comparator>
+CUDF_KERNEL void merge_path_search_kernel(Comparator comparator,
+                                          size_type haystack_size,
+                                          size_type needles_size,
+                                          size_type* results)
+{
+  auto const num_items = static_cast<thread_index_type>(haystack_size) + needles_size;
+  auto const stride    = grid_1d::grid_stride();
+  for (auto tid = grid_1d::global_thread_id(); tid * merge_path_items_per_thread < num_items;
+       tid += stride) {
+    auto const diagonal = tid * merge_path_items_per_thread;
+    auto lo = static_cast<size_type>(cuda::std::max(thread_index_type{0}, diagonal - needles_size));
+    auto hi = static_cast<size_type>(
+      cuda::std::min(diagonal, static_cast<thread_index_type>(haystack_size)));
+    while (lo < hi) {
+      auto const mid = lo + (hi - lo) / 2;
+      if (precedes_needle<find_first>(
+            comparator, mid, static_cast<size_type>(diagonal - 1 - mid))) {
+        lo = mid + 1;
+      } else {
+        hi = mid;
+      }
+    }
+
+    auto i = lo;
+    auto j = static_cast<size_type>(diagonal - lo);
+    for (int item = 0;
+         item < merge_path_items_per_thread and static_cast<thread_index_type>(i) + j < num_items;
+         ++item) {
+      if (j < needles_size and
+          (i >= haystack_size or not precedes_needle<find_first>(comparator, i, j))) {
+        results[j++] = i;
+      } else {
+        ++i;
+      }
+    }
+  }
+}
+
+/**
+ * @brief Searches a haystack whose rows are in Eytzinger order.
+ *
+ * @param sorted_indices Index in the sorted haystack of each row of the haystack
+ */
+template <bool find_first, typename Comparator>
+CUDF_KERNEL void eytzinger_search_kernel(Comparator comparator,
+                                         size_type const* sorted_indices,
+                                         size_type haystack_size,
+                                         size_type needles_size,
+                                         size_type* results)
+{
+  auto const stride = grid_1d::grid_stride();
+  for (auto tid = grid_1d::global_thread_id(); tid < needles_size; tid += stride) {
+    auto const needle = static_cast<size_type>(tid);
+    // descend from the root, node k (1-based) being haystack row k - 1
+    int64_t node = 1;
+    while (node <= haystack_size) {
+      node = 2 * node + precedes_needle<find_first>(comparator, node - 1, needle);
+    }
+    // the result is the last node where the search went left
+    node >>= __ffsll(~node);
+    results[needle] = node == 0 ? haystack_size : sorted_indices[node - 1];
+  }
+}
+
+/**
+ * @brief Returns the number of nodes in the subtree of `node` in an Eytzinger tree of `n` nodes.
+ */
+__device__ int64_t eytzinger_subtree_size(int64_t node, int64_t n)
+{
+  int64_t size = 0;
+  for (int64_t first = node, last = node; first <= n; first = 2 * first, last = 2 * last + 1) {
+    size += cuda::std::min(last, n) - first + 1;
+  }
+  return size;
+}
+
+/**
+ * @brief Returns the in-order rank of `node` (1-based) in an Eytzinger tree of `n` nodes.
+ */
+__device__ size_type eytzinger_sorted_index(int64_t node, int64_t n)
+{
+  auto rank = eytzinger_subtree_size(2 * node, n);
+  for (; node > 1; node /= 2) {
+    // a right child follows its parent and its parent's left subtree
+    if (node % 2 == 1) { rank += eytzinger_subtree_size(node - 1, n) + 1; }
+  }
+  return static_cast<size_type>(rank);
+}
+
+/**
+ * @brief Returns the index in sorted order of each row of an Eytzinger layout of `num_rows` rows.
+ */
+std::unique_ptr<column> make_eytzinger_sorted_indices(size_type num_rows,
+                                                      rmm::cuda_stream_view stream,
+                                                      rmm::device_async_resource_ref mr)
+{
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::make_counting_iterator<int64_t>(1),
+                    thrust::make_counting_iterator<int64_t>(int64_t{num_rows} + 1),
+                    result->mutable_view().begin<size_type>(),
+                    cuda::proclaim_return_type<size_type>([num_rows] __device__(int64_t node) {
+                      return eytzinger_sorted_index(node, num_rows);
+                    }));
+  return result;
+}
+
 std::unique_ptr<column> search_ordered(table_view const& haystack,
                                        table_view const& needles,
                                        bool find_first,
                                        std::vector<order> const& column_order,
                                        std::vector<null_order> const& null_precedence,
+                                       needles_order needles_are_sorted,
+                                       size_type const* eytzinger_sorted_indices,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
 {
@@ -59,6 +210,7 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
       cudaMemsetAsync(out_it, 0, needles.num_rows() * sizeof(size_type), stream.value()));
     return result;
   }
+  if (needles.num_rows() == 0) { return result; }
 
   // This utility will ensure all corresponding dictionary columns have matching keys.
   // It will return any new dictionary columns created as well as updated table_views.
@@ -74,9 +226,26 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
   auto const haystack_it = cudf::experimental::row::lhs_iterator(0);
   auto const needles_it  = cudf::experimental::row::rhs_iterator(0);
 
-  if (cudf::detail::has_nested_columns(haystack) || cudf::detail::has_nested_columns(needles)) {
-    auto const d_comparator = comparator.less<true>(nullate::DYNAMIC{has_nulls});
-    if (find_first) {
+  auto const search = [&](auto const& d_comparator) {
+    if (eytzinger_sorted_indices != nullptr) {
+      cudf::detail::grid_1d const config(needles.num_rows(), search_block_size);
+      auto const kernel = find_first ? eytzinger_search_kernel<true, decltype(d_comparator)>
+                                     : eytzinger_search_kernel<false, decltype(d_comparator)>;
+      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_comparator, eytzinger_sorted_indices, haystack.num_rows(), needles.num_rows(), out_it);
+      CUDF_CHECK_CUDA(stream.value());
+    } else if (needles_are_sorted == needles_order::SORTED) {
+      auto const num_items = static_cast<int64_t>(haystack.num_rows()) + needles.num_rows();
+      cudf::detail::grid_1d const config(
+        static_cast<size_type>(
+          util::div_rounding_up_safe<int64_t>(num_items, merge_path_items_per_thread)),
+        search_block_size);
+      auto const kernel = find_first ? merge_path_search_kernel<true, decltype(d_comparator)>
+                                     : merge_path_search_kernel<false, decltype(d_comparator)>;
+      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_comparator, haystack.num_rows(), needles.num_rows(), out_it);
+      CUDF_CHECK_CUDA(stream.value());
+    } else if (find_first) {
       thrust::lower_bound(rmm::exec_policy(stream),
                           haystack_it,
                           haystack_it + haystack.num_rows(),
@@ -93,25 +262,12 @@ std::unique_ptr<column> search_ordered(table_view const& haystack,
                           out_it,
                           d_comparator);
     }
+  };
+
+  if (cudf::detail::has_nested_columns(haystack) || cudf::detail::has_nested_columns(needles)) {
+    search(comparator.less<true>(nullate::DYNAMIC{has_nulls}));
   } else {
-    auto const d_comparator = comparator.less<false>(nullate::DYNAMIC{has_nulls});
-    if (find_first) {
-      thrust::lower_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    } else {
-      thrust::upper_bound(rmm::exec_policy(stream),
-                          haystack_it,
-                          haystack_it + haystack.num_rows(),
-                          needles_it,
-                          needles_it + needles.num_rows(),
-                          out_it,
-                          d_comparator);
-    }
+    search(comparator.less<false>(nullate::DYNAMIC{has_nulls}));
   }
   return result;
 }
@@ -124,7 +280,8 @@ std::unique_ptr<column> lower_bound(table_view const& haystack,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr)
 {
-  return search_ordered(haystack, needles, true, column_order, null_precedence, stream, mr);
+  return lower_bound(
+    haystack, needles, column_order, null_precedence, needles_order::UNSORTED, stream, mr);
 }
 
 std::unique_ptr<column> upper_bound(table_view const& haystack,
@@ -134,7 +291,46 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
                                     rmm::cuda_stream_view stream,
                                     rmm::device_async_resource_ref mr)
 {
-  return search_ordered(haystack, needles, false, column_order, null_precedence, stream, mr);
+  return upper_bound(
+    haystack, needles, column_order, null_precedence, needles_order::UNSORTED, stream, mr);
+}
+
+std::unique_ptr<column> lower_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  return search_ordered(haystack,
+                        needles,
+                        true,
+                        column_order,
+                        null_precedence,
+                        needles_are_sorted,
+                        nullptr,
+                        stream,
+                        mr);
+}
+
+std::unique_ptr<column> upper_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  return search_ordered(haystack,
+                        needles,
+                        false,
+                        column_order,
+                        null_precedence,
+                        needles_are_sorted,
+                        nullptr,
+                        stream,
+                        mr);
 }
 
 }  // namespace detail
@@ -163,4 +359,86 @@ std::unique_ptr<column> upper_bound(table_view const& haystack,
   return detail::upper_bound(haystack, needles, column_order, null_precedence, stream, mr);
 }
 
+std::unique_ptr<column> lower_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::lower_bound(
+    haystack, needles, column_order, null_precedence, needles_are_sorted, stream, mr);
+}
+
+std::unique_ptr<column> upper_bound(table_view const& haystack,
+                                    table_view const& needles,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    needles_order needles_are_sorted,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::upper_bound(
+    haystack, needles, column_order, null_precedence, needles_are_sorted, stream, mr);
+}
+
+ordered_search_index::ordered_search_index(table_view const& haystack,
+                                           std::vector<order> const& column_order,
+                                           std::vector<null_order> const& null_precedence,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+  : _column_order{column_order}, _null_precedence{null_precedence}
+{
+  CUDF_FUNC_RANGE();
+  CUDF_EXPECTS(
+    column_order.empty() or static_cast<std::size_t>(haystack.num_columns()) == column_order.size(),
+    "Mismatch between number of columns and column order.");
+  CUDF_EXPECTS(null_precedence.empty() or
+                 static_cast<std::size_t>(haystack.num_columns()) == null_precedence.size(),
+               "Mismatch between number of columns and null precedence.");
+
+  _sorted_indices = detail::make_eytzinger_sorted_indices(haystack.num_rows(), stream, mr);
+  _haystack = detail::gather(haystack,
+                             _sorted_indices->view(),
+                             out_of_bounds_policy::DONT_CHECK,
+                             detail::negative_index_policy::NOT_ALLOWED,
+                             stream,
+                             mr);
+}
+
+std::unique_ptr<column> ordered_search_index::lower_bound(table_view const& needles,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::search_ordered(_haystack->view(),
+                                needles,
+                                true,
+                                _column_order,
+                                _null_precedence,
+                                needles_order::UNSORTED,
+                                _sorted_indices->view().data<size_type>(),
+                                stream,
+                                mr);
+}
+
+std::unique_ptr<column> ordered_search_index::upper_bound(table_view const& needles,
+                                                          rmm::cuda_stream_view stream,
+                                                          rmm::device_async_resource_ref mr) const
+{
+  CUDF_FUNC_RANGE();
+  return detail::search_ordered(_haystack->view(),
+                                needles,
+                                false,
+                                _column_order,
+                                _null_precedence,
+                                needles_order::UNSORTED,
+                                _sorted_indices->view().data<size_type>(),
+                                stream,
+                                mr);
+}
+
 }  // namespace cudf
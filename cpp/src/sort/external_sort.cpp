@@ -0,0 +1,404 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/concatenate.hpp>
+#include <cudf/detail/contiguous_split.hpp>
+#include <cudf/detail/merge.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/search.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/detail/utilities/pinned_host_vector.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/type_checks.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <algorithm>
+#include <deque>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Fraction of the memory limit used by the rows of a run, leaving room for the sort temporaries
+constexpr std::size_t run_fraction = 4;
+// Maximum number of runs merged at once; more runs are first merged into fewer, longer runs
+constexpr std::size_t merge_fanin = 16;
+
+/**
+ * @brief Part of a sorted run spilled to pinned host memory
+ */
+struct spilled_block {
+  std::vector<uint8_t> metadata;     ///< metadata returned by `contiguous_split`
+  pinned_host_vector<uint8_t> data;  ///< packed device data
+  size_type num_rows;                ///< number of rows of the block
+};
+
+using spilled_run = std::deque<spilled_block>;
+
+/**
+ * @brief Next rows of a run to merge, with the block holding them copied back to device
+ */
+struct merge_cursor {
+  spilled_run* run;                                ///< blocks of the run not copied back yet
+  std::unique_ptr<std::vector<uint8_t>> metadata;  ///< metadata of the resident block
+  std::unique_ptr<rmm::device_buffer> data;        ///< data of the resident block
+  table_view rows;                                 ///< rows of the resident block not merged yet
+  std::size_t bytes_per_row;  ///< average size of the rows of the resident block
+};
+
+}  // namespace
+
+struct external_sort_state {
+  external_sort_state(std::vector<size_type>&& key_columns,
+                      std::vector<order>&& column_order,
+                      std::vector<null_order>&& null_precedence,
+                      std::size_t memory_limit,
+                      rmm::cuda_stream_view stream,
+                      rmm::device_async_resource_ref mr)
+    : key_columns{std::move(key_columns)},
+      column_order{std::move(column_order)},
+      null_precedence{std::move(null_precedence)},
+      run_bytes{memory_limit / run_fraction},
+      block_bytes{std::max<std::size_t>(memory_limit / (run_fraction * merge_fanin), 1)},
+      stream{stream},
+      mr{mr}
+  {
+    CUDF_EXPECTS(
+      not this->key_columns.empty(), "At least one key column is required", std::invalid_argument);
+    CUDF_EXPECTS(memory_limit > 0, "The memory limit must not be 0", std::invalid_argument);
+    CUDF_EXPECTS(this->column_order.empty() or
+                   this->column_order.size() == this->key_columns.size(),
+                 "Mismatch between number of key columns and column order",
+                 std::invalid_argument);
+    CUDF_EXPECTS(this->null_precedence.empty() or
+                   this->null_precedence.size() == this->key_columns.size(),
+                 "Mismatch between number of key columns and null precedence",
+                 std::invalid_argument);
+    // cudf::merge requires an order and a null precedence for every key
+    if (this->column_order.empty()) {
+      this->column_order.assign(this->key_columns.size(), order::ASCENDING);
+    }
+    if (this->null_precedence.empty()) {
+      this->null_precedence.assign(this->key_columns.size(), null_order::BEFORE);
+    }
+  }
+
+  void push(table_view const& input)
+  {
+    CUDF_EXPECTS(not pushing_done, "Cannot push rows after the sorted rows are read");
+    CUDF_EXPECTS(std::all_of(key_columns.begin(),
+                             key_columns.end(),
+                             [&](auto idx) { return idx >= 0 and idx < input.num_columns(); }),
+                 "Key column index out of range",
+                 std::out_of_range);
+    if (schema) {
+      CUDF_EXPECTS(cudf::have_same_types(schema->view(), input),
+                   "The pushed tables must have the same column types",
+                   std::invalid_argument);
+    } else {
+      schema = empty_like(input);
+    }
+    if (input.num_rows() == 0) { return; }
+
+    auto packed      = detail::pack(input, stream, rmm::mr::get_current_device_resource());
+    auto const bytes = packed.gpu_data->size();
+    if (not buffered.empty() and buffered_bytes + bytes > run_bytes) { spill_buffered(); }
+    buffered_bytes += bytes;
+    buffered.push_back(std::move(packed));
+  }
+
+  bool has_next()
+  {
+    finish_pushing();
+    if (not next_chunk) { next_chunk = merge_step(cursors).first; }
+    return next_chunk != nullptr;
+  }
+
+  std::unique_ptr<table> get_next()
+  {
+    CUDF_EXPECTS(has_next(), "There are no sorted chunks left");
+    return std::move(next_chunk);
+  }
+
+ private:
+  /**
+   * @brief Sorts the buffered rows, releasing the buffered batches
+   */
+  std::unique_ptr<table> sort_buffered(rmm::device_async_resource_ref sort_mr)
+  {
+    std::vector<table_view> views;
+    std::transform(buffered.begin(), buffered.end(), std::back_inserter(views), [](auto const& p) {
+      return cudf::unpack(p);
+    });
+    auto const concatenated =
+      views.size() == 1
+        ? nullptr
+        : detail::concatenate(views, stream, rmm::mr::get_current_device_resource());
+    auto const input = concatenated ? concatenated->view() : views.front();
+    auto sorted      = detail::sort_by_key(
+      input, input.select(key_columns), column_order, null_precedence, stream, sort_mr);
+    buffered.clear();
+    buffered_bytes = 0;
+    return sorted;
+  }
+
+  /**
+   * @brief Copies `input` to pinned host memory as blocks of about `block_bytes` bytes
+   */
+  void spill(table_view const& input, std::size_t input_bytes, spilled_run& run)
+  {
+    auto const num_blocks = std::max<std::size_t>(input_bytes / block_bytes, 1);
+    auto const block_rows =
+      std::max<size_type>(static_cast<size_type>(input.num_rows() / num_blocks), 1);
+    std::vector<size_type> splits;
+    for (auto row = block_rows; row < input.num_rows(); row += block_rows) {
+      splits.push_back(row);
+    }
+
+    auto blocks =
+      detail::contiguous_split(input, splits, stream, rmm::mr::get_current_device_resource());
+    for (auto& block : blocks) {
+      auto const& gpu_data = *block.data.gpu_data;
+      spilled_block spilled{std::move(*block.data.metadata),
+                            pinned_host_vector<uint8_t>(gpu_data.size()),
+                            block.table.num_rows()};
+      CUDF_CUDA_TRY(cudaMemcpyAsync(spilled.data.data(),
+                                    gpu_data.data(),
+                                    gpu_data.size(),
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      run.push_back(std::move(spilled));
+    }
+    // The device blocks are freed in stream order after the copies
+  }
+
+  void spill_buffered()
+  {
+    auto const bytes  = buffered_bytes;
+    auto const sorted = sort_buffered(rmm::mr::get_current_device_resource());
+    runs.emplace_back();
+    spill(sorted->view(), bytes, runs.back());
+  }
+
+  /**
+   * @brief Copies the next block of the run of each cursor without unmerged rows back to device
+   */
+  void load_blocks(std::vector<merge_cursor>& merge_cursors)
+  {
+    std::vector<merge_cursor*> loaded;
+    for (auto& cursor : merge_cursors) {
+      if (cursor.rows.num_rows() > 0 or cursor.run->empty()) { continue; }
+      auto& block     = cursor.run->front();
+      cursor.metadata = std::make_unique<std::vector<uint8_t>>(std::move(block.metadata));
+      cursor.data     = std::make_unique<rmm::device_buffer>(
+        block.data.size(), stream, rmm::mr::get_current_device_resource());
+      CUDF_CUDA_TRY(cudaMemcpyAsync(cursor.data->data(),
+                                    block.data.data(),
+                                    block.data.size(),
+                                    cudaMemcpyDefault,
+                                    stream.value()));
+      cursor.rows =
+        cudf::unpack(cursor.metadata->data(), static_cast<uint8_t const*>(cursor.data->data()));
+      cursor.bytes_per_row = block.data.size() / std::max<std::size_t>(block.num_rows, 1);
+      loaded.push_back(&cursor);
+    }
+    if (loaded.empty()) { return; }
+    // The pinned blocks may only be freed once copied
+    stream.synchronize();
+    for (auto cursor : loaded) {
+      cursor->run->pop_front();
+    }
+  }
+
+  /**
+   * @brief Merges the rows of the cursors that are ordered before any row not on device yet
+   *
+   * Every run is ordered, so no row after the resident rows of a run is ordered before the last
+   * resident row of that run. The rows up to the smallest of these last rows can then be merged
+   * and returned. The run holding the smallest last row merges all of its resident rows, so each
+   * step makes progress.
+   *
+   * @return The merged rows and an estimate of their size, or nullptr once all rows are merged
+   */
+  std::pair<std::unique_ptr<table>, std::size_t> merge_step(
+    std::vector<merge_cursor>& merge_cursors)
+  {
+    if (single_run) { return {std::move(single_run), 0}; }
+    load_blocks(merge_cursors);
+
+    std::vector<merge_cursor*> active;
+    for (auto& cursor : merge_cursors) {
+      if (cursor.rows.num_rows() > 0) { active.push_back(&cursor); }
+    }
+    if (active.empty()) { return {nullptr, 0}; }
+
+    // Find the smallest of the last resident rows
+    std::vector<table_view> last_rows;
+    std::transform(active.begin(), active.end(), std::back_inserter(last_rows), [&](auto c) {
+      auto const n = c->rows.num_rows();
+      return cudf::slice(c->rows.select(key_columns), {n - 1, n}, stream).front();
+    });
+    auto const cutoff = [&] {
+      if (active.size() == 1) { return last_rows.front(); }
+      auto const candidates =
+        detail::concatenate(last_rows, stream, rmm::mr::get_current_device_resource());
+      auto const sorted = detail::sorted_order(candidates->view(),
+                                               column_order,
+                                               null_precedence,
+                                               stream,
+                                               rmm::mr::get_current_device_resource());
+      auto const first  = cudf::detail::make_std_vector_sync(
+        device_span<size_type const>{sorted->view().data<size_type>(), 1}, stream);
+      return last_rows[first.front()];
+    }();
+
+    std::vector<table_view> to_merge;
+    std::size_t bytes = 0;
+    for (auto c : active) {
+      auto const bound = detail::upper_bound(c->rows.select(key_columns),
+                                             cutoff,
+                                             column_order,
+                                             null_precedence,
+                                             stream,
+                                             rmm::mr::get_current_device_resource());
+      auto const end   = cudf::detail::make_std_vector_sync(
+                         device_span<size_type const>{bound->view().data<size_type>(), 1}, stream)
+                         .front();
+      if (end == 0) { continue; }
+      auto const parts = cudf::slice(c->rows, {0, end, end, c->rows.num_rows()}, stream);
+      to_merge.push_back(parts[0]);
+      c->rows = parts[1];
+      bytes += c->bytes_per_row * end;
+    }
+
+    auto merged =
+      to_merge.size() == 1
+        ? std::make_unique<table>(to_merge.front(), stream, mr)
+        : detail::merge(to_merge, key_columns, column_order, null_precedence, stream, mr);
+
+    // Release the blocks whose rows are all merged
+    for (auto c : active) {
+      if (c->rows.num_rows() == 0) {
+        c->metadata.reset();
+        c->data.reset();
+      }
+    }
+    return {std::move(merged), bytes};
+  }
+
+  std::vector<merge_cursor> make_cursors(std::size_t begin, std::size_t end)
+  {
+    std::vector<merge_cursor> result;
+    for (auto i = begin; i < end; ++i) {
+      result.push_back(merge_cursor{&runs[i], nullptr, nullptr, table_view{}, 0});
+    }
+    return result;
+  }
+
+  void finish_pushing()
+  {
+    if (pushing_done) { return; }
+    pushing_done = true;
+
+    // Rows that all fit in one run need no spilling
+    if (runs.empty()) {
+      if (not buffered.empty()) { single_run = sort_buffered(mr); }
+      return;
+    }
+    if (not buffered.empty()) { spill_buffered(); }
+
+    // Merge the runs into at most `merge_fanin` runs so that their resident blocks fit in memory
+    while (runs.size() > merge_fanin) {
+      auto const count = std::min(merge_fanin, runs.size() - merge_fanin + 1);
+      auto merge_cursors = make_cursors(0, count);
+      spilled_run merged;
+      while (true) {
+        auto [chunk, bytes] = merge_step(merge_cursors);
+        if (not chunk) { break; }
+        spill(chunk->view(), bytes, merged);
+      }
+      runs.erase(runs.begin(), runs.begin() + count);
+      runs.push_back(std::move(merged));
+    }
+    cursors = make_cursors(0, runs.size());
+  }
+
+  std::vector<size_type> const key_columns;
+  std::vector<order> column_order;
+  std::vector<null_order> null_precedence;
+  std::size_t const run_bytes;    ///< size of the buffered rows above which they are spilled
+  std::size_t const block_bytes;  ///< size of the spilled blocks
+  rmm::cuda_stream_view stream;
+  rmm::device_async_resource_ref mr;
+
+  std::unique_ptr<table> schema;          ///< empty table with the pushed column types
+  std::vector<packed_columns> buffered;  ///< batches not sorted yet
+  std::size_t buffered_bytes = 0;
+  std::deque<spilled_run> runs;  ///< sorted runs in pinned host memory
+  bool pushing_done = false;
+  std::unique_ptr<table> single_run;  ///< sorted rows when all the rows fit in one run
+  std::vector<merge_cursor> cursors;  ///< cursors of the final merge
+  std::unique_ptr<table> next_chunk;  ///< chunk computed by `has_next`
+};
+
+}  // namespace detail
+
+external_sort::external_sort(std::vector<size_type> key_columns,
+                             std::vector<order> column_order,
+                             std::vector<null_order> null_precedence,
+                             std::size_t memory_limit,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+  : state{std::make_unique<detail::external_sort_state>(std::move(key_columns),
+                                                        std::move(column_order),
+                                                        std::move(null_precedence),
+                                                        memory_limit,
+                                                        stream,
+                                                        mr)}
+{
+}
+
+external_sort::~external_sort() = default;
+
+void external_sort::push(table_view const& input)
+{
+  CUDF_FUNC_RANGE();
+  state->push(input);
+}
+
+bool external_sort::has_next() { return state->has_next(); }
+
+std::unique_ptr<table> external_sort::get_next()
+{
+  CUDF_FUNC_RANGE();
+  return state->get_next();
+}
+
+}  // namespace cudf
@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "normalized_sort.hpp"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sequence.h>
+#include <thrust/transform.h>
+
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using normalized_key_type = uint64_t;
+
+constexpr int max_normalized_key_bits = sizeof(normalized_key_type) * 8;
+
+/**
+ * @brief Returns the number of bits a valid value of a column of type `type` takes in a key, or 0
+ * if the type cannot be normalized
+ */
+int value_bits(data_type type)
+{
+  switch (type.id()) {
+    case type_id::BOOL8: return 1;
+    case type_id::DECIMAL128: return 0;
+    default:
+      return cudf::is_integral(type) or cudf::is_chrono(type) or cudf::is_fixed_point(type)
+               ? static_cast<int>(cudf::size_of(type) * 8)
+               : 0;
+  }
+}
+
+int key_bits(column_view const& col)
+{
+  return value_bits(col.type()) + (col.has_nulls() ? 1 : 0);
+}
+
+/**
+ * @brief Returns the integer representation of a value of a fixed-width type
+ */
+template <typename T>
+__device__ auto to_integer(T value)
+{
+  if constexpr (cudf::is_timestamp<T>()) {
+    return value.time_since_epoch().count();
+  } else if constexpr (cudf::is_duration<T>()) {
+    return value.count();
+  } else if constexpr (std::is_same_v<T, bool>) {
+    return static_cast<uint8_t>(value);
+  } else {
+    return value;
+  }
+}
+
+/**
+ * @brief Functor appending the field of one column to the packed key of each row
+ */
+template <typename T>
+struct append_field_fn {
+  column_device_view d_col;
+  int value_bits;
+  bool has_nulls;
+  bool ascending;
+  bool nulls_first;
+
+  __device__ normalized_key_type operator()(size_type idx, normalized_key_type key) const
+  {
+    using integer_type  = decltype(to_integer(T{}));
+    using unsigned_type = std::make_unsigned_t<integer_type>;
+
+    auto const value_mask = value_bits == max_normalized_key_bits
+                              ? ~normalized_key_type{0}
+                              : (normalized_key_type{1} << value_bits) - 1;
+
+    normalized_key_type field = 0;
+    if (not has_nulls or d_col.is_valid_nocheck(idx)) {
+      auto value = static_cast<unsigned_type>(to_integer(d_col.element<T>(idx)));
+      // Flip the sign bit so that negative values are ordered before positive ones
+      if constexpr (std::is_signed_v<integer_type>) {
+        value ^= unsigned_type{1} << (sizeof(unsigned_type) * 8 - 1);
+      }
+      field = static_cast<normalized_key_type>(value);
+      if (not ascending) { field = ~field; }
+      field &= value_mask;
+      if (has_nulls and nulls_first) { field |= normalized_key_type{1} << value_bits; }
+    } else if (not nulls_first) {
+      field = normalized_key_type{1} << value_bits;
+    }
+
+    auto const field_bits = value_bits + (has_nulls ? 1 : 0);
+    return field_bits == max_normalized_key_bits ? field : (key << field_bits) | field;
+  }
+};
+
+struct append_field_dispatch_fn {
+  template <typename T, CUDF_ENABLE_IF(cudf::is_integral<T>() or cudf::is_chrono<T>())>
+  void operator()(column_view const& col,
+                  bool ascending,
+                  bool nulls_first,
+                  normalized_key_type* d_keys,
+                  rmm::cuda_stream_view stream) const
+  {
+    auto const d_col = column_device_view::create(col, stream);
+    thrust::transform(
+      rmm::exec_policy_nosync(stream),
+      thrust::counting_iterator<size_type>(0),
+      thrust::counting_iterator<size_type>(col.size()),
+      d_keys,
+      d_keys,
+      append_field_fn<T>{*d_col, value_bits(col.type()), col.has_nulls(), ascending, nulls_first});
+  }
+
+  template <typename T, CUDF_ENABLE_IF(not cudf::is_integral<T>() and not cudf::is_chrono<T>())>
+  void operator()(column_view const&,
+                  bool,
+                  bool,
+                  normalized_key_type*,
+                  rmm::cuda_stream_view) const
+  {
+    CUDF_FAIL("Unsupported type for normalized sort keys");
+  }
+};
+
+}  // namespace
+
+bool is_normalized_sort_supported(table_view const& input)
+{
+  if (input.num_columns() == 0) { return false; }
+  auto total_bits = 0;
+  for (auto const& col : input) {
+    if (value_bits(col.type()) == 0) { return false; }
+    total_bits += key_bits(col);
+  }
+  return total_bits <= max_normalized_key_bits;
+}
+
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  auto const num_rows = input.num_rows();
+  rmm::device_uvector<normalized_key_type> keys(num_rows, stream);
+  CUDF_CUDA_TRY(
+    cudaMemsetAsync(keys.data(), 0, keys.size() * sizeof(normalized_key_type), stream.value()));
+
+  auto total_bits = 0;
+  for (size_type i = 0; i < input.num_columns(); ++i) {
+    auto const ascending = column_order.empty() or column_order[i] == order::ASCENDING;
+    auto const null_prec = null_precedence.empty() ? null_order::BEFORE : null_precedence[i];
+    // Descending order also reverses the order of nulls
+    auto const nulls_first = ascending == (null_prec == null_order::BEFORE);
+    auto const& col        = input.column(i);
+    type_dispatcher<dispatch_storage_type>(
+      col.type(), append_field_dispatch_fn{}, col, ascending, nulls_first, keys.data(), stream);
+    total_bits += key_bits(col);
+  }
+
+  rmm::device_uvector<normalized_key_type> sorted_keys(num_rows, stream);
+  rmm::device_uvector<size_type> indices(num_rows, stream);
+  thrust::sequence(rmm::exec_policy_nosync(stream), indices.begin(), indices.end(), 0);
+  auto result = make_numeric_column(
+    data_type(type_to_id<size_type>()), num_rows, mask_state::UNALLOCATED, stream, mr);
+
+  // Radix sort is stable, and only needs a pass per digit of the bits used by the keys
+  auto const radix_sort = [&](void* d_temp_storage, std::size_t& temp_storage_bytes) {
+    cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                    temp_storage_bytes,
+                                    keys.data(),
+                                    sorted_keys.data(),
+                                    indices.data(),
+                                    result->mutable_view().data<size_type>(),
+                                    num_rows,
+                                    0,
+                                    total_bits,
+                                    stream.value());
+  };
+  std::size_t temp_storage_bytes = 0;
+  radix_sort(nullptr, temp_storage_bytes);
+  rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+  radix_sort(d_temp_storage.data(), temp_storage_bytes);
+
+  return result;
+}
+
+}  // namespace detail
+}  // namespace cudf
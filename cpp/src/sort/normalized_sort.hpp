@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+
+/**
+ * @brief Checks if the rows of `input` can be sorted by `normalized_sorted_order`
+ *
+ * This is the case when every column is an integral, timestamp, duration or 32/64-bit decimal
+ * column and the values and null flags of a row fit in 64 bits.
+ *
+ * @param input Table to check
+ * @return true if `normalized_sorted_order` can sort `input`
+ */
+bool is_normalized_sort_supported(table_view const& input);
+
+/**
+ * @brief Computes the stable sorted order of `input` by packing each row into an unsigned
+ * integer and radix sorting the integers
+ *
+ * The fields of a row are packed from the first column in the most significant bits. Each field
+ * holds the value, with its sign bit flipped for signed types and all its bits inverted for
+ * descending columns, preceded by a null flag when the column has nulls. The unsigned order of
+ * the packed integers is then the lexicographic order of the rows.
+ *
+ * Precondition: `is_normalized_sort_supported(input)` returned true and `column_order` and
+ * `null_precedence` are empty or have one entry per column.
+ *
+ * @param input Table to sort
+ * @param column_order The sort order of each column
+ * @param null_precedence The order of nulls of each column
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned column's device memory
+ * @return The stable sorted order of the rows of `input`
+ */
+std::unique_ptr<column> normalized_sorted_order(table_view const& input,
+                                                std::vector<order> const& column_order,
+                                                std::vector<null_order> const& null_precedence,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
+}  // namespace detail
+}  // namespace cudf
@@ -30,6 +30,8 @@
 #include <thrust/sequence.h>
 #include <thrust/sort.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace detail {
 
@@ -55,6 +57,24 @@ std::unique_ptr<column> sorted_order(column_view const& input,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Stable sort of the indices of a strings column.
+ *
+ * The rows are radix sorted by the first 8 bytes of their strings, then only the rows with equal
+ * prefixes are sorted by comparing their full strings.
+ *
+ * @param input Strings column to sort
+ * @param indices Indices to sort, initially the sequence of the rows of `input`
+ * @param ascending True if sort order is ascending
+ * @param null_precedence How null rows are to be ordered
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void sorted_strings_order(column_view const& input,
+                          mutable_column_view& indices,
+                          bool ascending,
+                          null_order null_precedence,
+                          rmm::cuda_stream_view stream);
+
 /**
  * @brief Comparator functor needed for single column sort.
  *
@@ -184,7 +204,9 @@ struct column_sorted_order_fn {
                   null_order null_precedence,
                   rmm::cuda_stream_view stream)
   {
-    if constexpr (is_faster_sort_supported<T>()) {
+    if constexpr (std::is_same_v<T, string_view>) {
+      sorted_strings_order(input, indices, ascending, null_precedence, stream);
+    } else if constexpr (is_faster_sort_supported<T>()) {
       if (input.has_nulls()) {
         sorted_order<T>(input, indices, ascending, null_precedence, stream);
       } else {
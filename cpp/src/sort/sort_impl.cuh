@@ -17,9 +17,11 @@
 #pragma once
 
 #include "common_sort_impl.cuh"
+#include "normalized_sort.hpp"
 #include "sort_column_impl.cuh"
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/dictionary/detail/update_keys.hpp>
 
 #include <rmm/resource_ref.hpp>
 
@@ -56,6 +58,16 @@ std::unique_ptr<column> sorted_order(table_view input,
                  "Mismatch between number of columns and null_precedence size.");
   }
 
+  // dictionary keys are sorted, so dictionaries are ordered by their integer indices
+  input = cudf::dictionary::detail::replace_dictionaries_with_indices(input);
+
+  // fast-path for integer-like keys that pack into a single radix-sortable integer,
+  // unless a single column without nulls can be radix sorted directly
+  if ((input.num_columns() > 1 or input.column(0).has_nulls()) and
+      is_normalized_sort_supported(input)) {
+    return normalized_sorted_order(input, column_order, null_precedence, stream, mr);
+  }
+
   // fast-path for single column sort
   if (input.num_columns() == 1 and not cudf::is_nested(input.column(0).type())) {
     auto const single_col = input.column(0);
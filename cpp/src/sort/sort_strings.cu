@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "sort_column_impl.cuh"
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+
+#include <cub/device/device_radix_sort.cuh>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/partition.h>
+#include <thrust/scan.h>
+#include <thrust/scatter.h>
+#include <thrust/sort.h>
+#include <thrust/transform.h>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using prefix_key_type = uint64_t;
+
+/**
+ * @brief Packs the first bytes of each string into an integer ordered like the strings
+ *
+ * Strings whose keys differ are ordered by their keys. Strings with equal keys must still be
+ * compared, since they may differ after the prefix or by trailing zero bytes.
+ */
+struct prefix_key_fn {
+  column_device_view d_strings;
+  bool ascending;
+
+  __device__ prefix_key_type operator()(size_type idx) const
+  {
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const bytes = reinterpret_cast<uint8_t const*>(d_str.data());
+    auto const size  = d_str.size_bytes() < static_cast<size_type>(sizeof(prefix_key_type))
+                         ? d_str.size_bytes()
+                         : static_cast<size_type>(sizeof(prefix_key_type));
+    prefix_key_type key = 0;
+    for (size_type i = 0; i < size; ++i) {
+      key |= static_cast<prefix_key_type>(bytes[i]) << (8 * (sizeof(prefix_key_type) - 1 - i));
+    }
+    return ascending ? key : ~key;
+  }
+};
+
+/**
+ * @brief Identifies the positions of the sorted keys equal to a neighboring key
+ */
+struct is_tied_fn {
+  prefix_key_type const* d_keys;
+  size_type num_keys;
+
+  __device__ bool operator()(size_type pos) const
+  {
+    return (pos > 0 and d_keys[pos] == d_keys[pos - 1]) or
+           (pos + 1 < num_keys and d_keys[pos] == d_keys[pos + 1]);
+  }
+};
+
+/**
+ * @brief Orders positions of the sorted keys by their segment of equal keys, then by the full
+ * strings at those positions
+ */
+struct tied_strings_comparator {
+  column_device_view d_strings;
+  size_type const* d_segments;
+  size_type const* d_indices;
+  bool ascending;
+
+  __device__ bool operator()(size_type lhs, size_type rhs) const
+  {
+    if (d_segments[lhs] != d_segments[rhs]) { return d_segments[lhs] < d_segments[rhs]; }
+    auto const result = d_strings.element<string_view>(d_indices[lhs])
+                          .compare(d_strings.element<string_view>(d_indices[rhs]));
+    return ascending ? result < 0 : result > 0;
+  }
+};
+
+}  // namespace
+
+void sorted_strings_order(column_view const& input,
+                          mutable_column_view& indices,
+                          bool ascending,
+                          null_order null_precedence,
+                          rmm::cuda_stream_view stream)
+{
+  auto const d_strings = column_device_view::create(input, stream);
+  auto const d_input   = *d_strings;
+
+  // Move the nulls to their end of the order; only the valid rows are sorted after that
+  auto begin = indices.begin<size_type>();
+  auto end   = indices.end<size_type>();
+  if (input.has_nulls()) {
+    // Descending order also reverses the order of nulls
+    auto const nulls_first = ascending == (null_precedence == null_order::BEFORE);
+    auto const middle      = thrust::stable_partition(
+      rmm::exec_policy(stream), begin, end, [d_input, nulls_first] __device__(size_type idx) {
+        return d_input.is_null_nocheck(idx) == nulls_first;
+      });
+    if (nulls_first) {
+      begin = middle;
+    } else {
+      end = middle;
+    }
+  }
+  auto const num_rows = static_cast<size_type>(thrust::distance(begin, end));
+  if (num_rows < 2) { return; }
+
+  // Radix sort the rows by the prefixes of their strings
+  rmm::device_uvector<prefix_key_type> sorted_keys(num_rows, stream);
+  {
+    rmm::device_uvector<prefix_key_type> keys(num_rows, stream);
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      begin,
+                      end,
+                      keys.begin(),
+                      prefix_key_fn{d_input, ascending});
+    rmm::device_uvector<size_type> unsorted_indices(num_rows, stream);
+    thrust::copy(rmm::exec_policy_nosync(stream), begin, end, unsorted_indices.begin());
+
+    auto const radix_sort = [&](void* d_temp_storage, std::size_t& temp_storage_bytes) {
+      cub::DeviceRadixSort::SortPairs(d_temp_storage,
+                                      temp_storage_bytes,
+                                      keys.data(),
+                                      sorted_keys.data(),
+                                      unsorted_indices.data(),
+                                      begin,
+                                      num_rows,
+                                      0,
+                                      static_cast<int>(sizeof(prefix_key_type) * 8),
+                                      stream.value());
+    };
+    std::size_t temp_storage_bytes = 0;
+    radix_sort(nullptr, temp_storage_bytes);
+    rmm::device_buffer d_temp_storage(temp_storage_bytes, stream);
+    radix_sort(d_temp_storage.data(), temp_storage_bytes);
+  }
+
+  // Refine the segments of equal prefixes by comparing their full strings
+  rmm::device_uvector<size_type> tied(num_rows, stream);
+  auto const tied_end = thrust::copy_if(rmm::exec_policy(stream),
+                                        thrust::counting_iterator<size_type>(0),
+                                        thrust::counting_iterator<size_type>(num_rows),
+                                        tied.begin(),
+                                        is_tied_fn{sorted_keys.data(), num_rows});
+  auto const num_tied   = static_cast<size_type>(thrust::distance(tied.begin(), tied_end));
+  if (num_tied == 0) { return; }
+
+  // Label each position with its segment of equal keys
+  rmm::device_uvector<size_type> segments(num_rows, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(num_rows),
+                    segments.begin(),
+                    [d_keys = sorted_keys.data()] __device__(size_type pos) {
+                      return static_cast<size_type>(pos > 0 and d_keys[pos] != d_keys[pos - 1]);
+                    });
+  thrust::inclusive_scan(
+    rmm::exec_policy_nosync(stream), segments.begin(), segments.end(), segments.begin());
+
+  // The tied positions of a segment are contiguous and the segments are in position order, so
+  // sorting the positions and scattering the rows back to the tied positions refines each
+  // segment in place. The stable sort keeps rows with equal strings in their radix order.
+  rmm::device_uvector<size_type> refined(num_tied, stream);
+  thrust::copy(rmm::exec_policy_nosync(stream), tied.begin(), tied_end, refined.begin());
+  thrust::stable_sort(rmm::exec_policy(stream),
+                      refined.begin(),
+                      refined.end(),
+                      tied_strings_comparator{d_input, segments.data(), begin, ascending});
+  rmm::device_uvector<size_type> refined_rows(num_tied, stream);
+  thrust::gather(
+    rmm::exec_policy_nosync(stream), refined.begin(), refined.end(), begin, refined_rows.begin());
+  thrust::scatter(rmm::exec_policy(stream),
+                  refined_rows.begin(),
+                  refined_rows.end(),
+                  tied.begin(),
+                  begin);
+}
+
+}  // namespace detail
+}  // namespace cudf
@@ -0,0 +1,262 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/copy.hpp>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/gather.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sorting.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/experimental/row_operators.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <type_traits>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// Number of rows sampled to choose the threshold row
+constexpr size_type top_k_sample_size = 1 << 16;
+// Above this fraction of the rows the candidates would not be much fewer than the rows
+constexpr double top_k_max_fraction = 0.125;
+
+std::unique_ptr<column> make_order_column(device_span<size_type const> indices,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  auto result = make_numeric_column(data_type{type_to_id<size_type>()},
+                                    static_cast<size_type>(indices.size()),
+                                    mask_state::UNALLOCATED,
+                                    stream,
+                                    mr);
+  thrust::copy(rmm::exec_policy_nosync(stream),
+               indices.begin(),
+               indices.end(),
+               result->mutable_view().begin<size_type>());
+  return result;
+}
+
+/**
+ * @brief Returns the first `k` rows of the stable sorted order of all the `keys`
+ */
+std::unique_ptr<column> sorted_top_k_order(table_view const& keys,
+                                           size_type k,
+                                           std::vector<order> const& column_order,
+                                           std::vector<null_order> const& null_precedence,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto const sorted = stable_sorted_order(
+    keys, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  return make_order_column(
+    {sorted->view().begin<size_type>(), static_cast<std::size_t>(k)}, stream, mr);
+}
+
+/**
+ * @brief Functor to identify the rows of the left table not ordered after the single row of the
+ * right table
+ */
+template <typename Comparator>
+struct not_after_threshold_fn {
+  Comparator less;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    using cudf::experimental::row::lhs_index_type;
+    using cudf::experimental::row::rhs_index_type;
+    return not less(rhs_index_type{0}, lhs_index_type{idx});
+  }
+};
+
+/**
+ * @brief Computes the indices of the rows of `keys` ordered before or equal to the single row of
+ * `threshold`
+ */
+rmm::device_uvector<size_type> rows_up_to_threshold(table_view const& keys,
+                                                    table_view const& threshold,
+                                                    std::vector<order> const& column_order,
+                                                    std::vector<null_order> const& null_precedence,
+                                                    rmm::cuda_stream_view stream)
+{
+  auto const comparator = cudf::experimental::row::lexicographic::two_table_comparator(
+    keys, threshold, column_order, null_precedence, stream);
+  auto const has_nulls = nullate::DYNAMIC{has_nested_nulls(keys) or has_nested_nulls(threshold)};
+
+  rmm::device_uvector<size_type> candidates(keys.num_rows(), stream);
+  auto const copy_candidates = [&](auto const& d_comparator) {
+    auto const end =
+      thrust::copy_if(rmm::exec_policy(stream),
+                      thrust::counting_iterator<size_type>(0),
+                      thrust::counting_iterator<size_type>(keys.num_rows()),
+                      candidates.begin(),
+                      not_after_threshold_fn<std::decay_t<decltype(d_comparator)>>{d_comparator});
+    candidates.resize(thrust::distance(candidates.begin(), end), stream);
+  };
+
+  if (cudf::detail::has_nested_columns(keys)) {
+    copy_candidates(comparator.less<true>(has_nulls));
+  } else {
+    copy_candidates(comparator.less<false>(has_nulls));
+  }
+  return candidates;
+}
+
+}  // namespace
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(k >= 0, "k must not be negative", std::invalid_argument);
+  auto const num_rows = keys.num_rows();
+  k                   = std::min(k, num_rows);
+  if (k == 0) { return make_empty_column(type_to_id<size_type>()); }
+
+  auto const has_dictionary = std::any_of(
+    keys.begin(), keys.end(), [](auto const& col) { return is_dictionary(col.type()); });
+  if (has_dictionary or k > static_cast<size_type>(num_rows * top_k_max_fraction)) {
+    return sorted_top_k_order(keys, k, column_order, null_precedence, stream, mr);
+  }
+
+  // Sort an evenly strided sample of the keys and pick a threshold row in the sample so that
+  // about twice as many rows as needed are expected to be ordered before it
+  auto const sample_size = std::min(num_rows, top_k_sample_size);
+  auto const sample_map  = thrust::make_transform_iterator(
+    thrust::counting_iterator<int64_t>(0),
+    cuda::proclaim_return_type<size_type>([num_rows, sample_size] __device__(int64_t i) {
+      return static_cast<size_type>(i * num_rows / sample_size);
+    }));
+  auto const sample = gather(keys,
+                             sample_map,
+                             sample_map + sample_size,
+                             out_of_bounds_policy::DONT_CHECK,
+                             stream,
+                             rmm::mr::get_current_device_resource());
+  auto const sample_order = stable_sorted_order(
+    sample->view(), column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  auto const threshold_index = static_cast<size_type>(
+    std::min<int64_t>(sample_size - 1, 2 * static_cast<int64_t>(k) * sample_size / num_rows + 8));
+  auto const threshold_map =
+    cudf::detail::slice(sample_order->view(), threshold_index, threshold_index + 1, stream);
+  auto const threshold = gather(sample->view(),
+                                threshold_map,
+                                out_of_bounds_policy::DONT_CHECK,
+                                negative_index_policy::NOT_ALLOWED,
+                                stream,
+                                rmm::mr::get_current_device_resource());
+
+  // The first k rows are all ordered before or equal to the threshold as long as at least k rows
+  // are. The candidates keep their original order so that sorting them stably gives ties in the
+  // same order as a stable sort of all the rows.
+  auto const candidates =
+    rows_up_to_threshold(keys, threshold->view(), column_order, null_precedence, stream);
+  if (static_cast<size_type>(candidates.size()) < k) {
+    return sorted_top_k_order(keys, k, column_order, null_precedence, stream, mr);
+  }
+
+  auto const candidate_keys = gather(keys,
+                                     candidates.begin(),
+                                     candidates.end(),
+                                     out_of_bounds_policy::DONT_CHECK,
+                                     stream,
+                                     rmm::mr::get_current_device_resource());
+  auto const candidate_order = stable_sorted_order(candidate_keys->view(),
+                                                   column_order,
+                                                   null_precedence,
+                                                   stream,
+                                                   rmm::mr::get_current_device_resource());
+
+  auto result = make_numeric_column(
+    data_type{type_to_id<size_type>()}, k, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy_nosync(stream),
+                 candidate_order->view().begin<size_type>(),
+                 candidate_order->view().begin<size_type>() + k,
+                 candidates.begin(),
+                 result->mutable_view().begin<size_type>());
+  return result;
+}
+
+std::unique_ptr<table> top_k(table_view const& values,
+                             table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(values.num_rows() == keys.num_rows(),
+               "Mismatch in number of rows for values and keys");
+
+  auto const order = detail::top_k_order(
+    keys, k, column_order, null_precedence, stream, rmm::mr::get_current_device_resource());
+  return detail::gather(values,
+                        order->view(),
+                        out_of_bounds_policy::DONT_CHECK,
+                        detail::negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> top_k_order(table_view const& keys,
+                                    size_type k,
+                                    std::vector<order> const& column_order,
+                                    std::vector<null_order> const& null_precedence,
+                                    rmm::cuda_stream_view stream,
+                                    rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k_order(keys, k, column_order, null_precedence, stream, mr);
+}
+
+std::unique_ptr<table> top_k(table_view const& values,
+                             table_view const& keys,
+                             size_type k,
+                             std::vector<order> const& column_order,
+                             std::vector<null_order> const& null_precedence,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::top_k(values, keys, k, column_order, null_precedence, stream, mr);
+}
+
+}  // namespace cudf
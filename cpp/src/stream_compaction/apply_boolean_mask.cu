@@ -17,19 +17,35 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/copy_if.cuh>
+#include <cudf/detail/gather.cuh>
+#include <cudf/detail/indexalator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
 #include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/device/device_select.cuh>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
 
 namespace {
 // Returns true if the mask is true and valid (non-null) for index i
@@ -54,6 +70,76 @@ struct boolean_mask_filter {
   cudf::column_device_view boolean_mask;
 };
 
+// Maps an index into the filtered rows to the index of that row in the unfiltered input.
+// Negative indices count from the end of the filtered rows, as in gather(), and indices outside
+// the filtered rows map to `out_of_bounds`.
+struct filtered_index_fn {
+  cudf::size_type const* filtered_indices;
+  cudf::size_type num_filtered;
+  cudf::size_type out_of_bounds;
+  bool allow_negative;
+
+  __device__ cudf::size_type operator()(cudf::size_type index) const
+  {
+    if (allow_negative && index < 0) { index += num_filtered; }
+    return index >= 0 && index < num_filtered ? filtered_indices[index] : out_of_bounds;
+  }
+};
+
+// Returns true if the mask is true and valid (non-null) for index i, without a device view of the
+// mask so that the fixed-capacity apply_boolean_mask does not allocate
+struct mask_flag_fn {
+  bool const* values;
+  cudf::bitmask_type const* null_mask;
+  cudf::size_type offset;
+
+  __device__ bool operator()(cudf::size_type i) const
+  {
+    return (null_mask == nullptr || cudf::bit_is_set(null_mask, i + offset)) && values[i];
+  }
+};
+
+// Calls `f` with a value of the integer type as wide as the elements of `type`, since filtering
+// only moves the elements
+template <typename Functor>
+decltype(auto) dispatch_element_width(cudf::data_type type, Functor&& f)
+{
+  CUDF_EXPECTS(cudf::is_fixed_width(type), "Input must be a fixed-width column");
+  switch (cudf::size_of(type)) {
+    case 1: return f(int8_t{});
+    case 2: return f(int16_t{});
+    case 4: return f(int32_t{});
+    case 8: return f(int64_t{});
+    case 16: return f(__int128_t{});
+    default: CUDF_FAIL("Unsupported element width");
+  }
+}
+
+// Runs cub::DeviceSelect::Flagged, or only computes its temporary storage size if `temp_storage`
+// is null
+template <typename T>
+std::size_t select_flagged(void* temp_storage,
+                           std::size_t temp_storage_bytes,
+                           T const* input,
+                           mask_flag_fn flags,
+                           T* output,
+                           cudf::size_type* output_size,
+                           cudf::size_type num_rows,
+                           rmm::cuda_stream_view stream)
+{
+  auto const flags_begin =
+    thrust::make_transform_iterator(thrust::make_counting_iterator<cudf::size_type>(0), flags);
+  CUDF_CUDA_TRY(cub::DeviceSelect::Flagged(temp_storage,
+                                           temp_storage_bytes,
+                                           input,
+                                           flags_begin,
+                                           output,
+                                           output_size,
+                                           num_rows,
+                                           stream.value()));
+  return temp_storage_bytes;
+}
+
 }  // namespace
 
 namespace cudf {
@@ -84,6 +170,89 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   }
 }
 
+/*
+ * Gathers from the rows of a table_view selected by a boolean mask.
+ *
+ * The indices of the selected rows are computed with copy_if() and composed with the gather map
+ * through a transform iterator, so only the output table is materialized.
+ */
+std::unique_ptr<table> filter_gather(table_view const& input,
+                                     column_view const& gather_map,
+                                     column_view const& boolean_mask,
+                                     out_of_bounds_policy bounds_policy,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  CUDF_EXPECTS(input.num_rows() == boolean_mask.size(), "Column size mismatch");
+  CUDF_EXPECTS(is_index_type(gather_map.type()), "Gather map must be an integral type.");
+  CUDF_EXPECTS(not gather_map.has_nulls(), "Gather map contains nulls");
+
+  auto const device_boolean_mask = cudf::column_device_view::create(boolean_mask, stream);
+  auto filtered_indices = rmm::device_uvector<size_type>(boolean_mask.size(), stream);
+  auto const rows       = thrust::make_counting_iterator<size_type>(0);
+  auto const filtered_end =
+    boolean_mask.has_nulls()
+      ? thrust::copy_if(rmm::exec_policy_nosync(stream),
+                        rows,
+                        rows + boolean_mask.size(),
+                        filtered_indices.begin(),
+                        boolean_mask_filter<true>{*device_boolean_mask})
+      : thrust::copy_if(rmm::exec_policy_nosync(stream),
+                        rows,
+                        rows + boolean_mask.size(),
+                        filtered_indices.begin(),
+                        boolean_mask_filter<false>{*device_boolean_mask});
+  auto const num_filtered =
+    static_cast<size_type>(thrust::distance(filtered_indices.begin(), filtered_end));
+
+  auto const map_begin = thrust::make_transform_iterator(
+    indexalator_factory::make_input_iterator(gather_map),
+    filtered_index_fn{
+      filtered_indices.data(), num_filtered, input.num_rows(), not is_unsigned(gather_map.type())});
+  return detail::gather(input, map_begin, map_begin + gather_map.size(), bounds_policy, stream, mr);
+}
+
+/*
+ * Filters a fixed-width column into a preallocated column with cub::DeviceSelect::Flagged, which
+ * writes the number of rows kept to device memory.
+ */
+void apply_boolean_mask(column_view const& input,
+                        column_view const& boolean_mask,
+                        mutable_column_view const& output,
+                        size_type* output_size,
+                        device_span<std::byte> temp_storage,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_EXPECTS(not input.nullable(), "Input must not have a null mask");
+  CUDF_EXPECTS(boolean_mask.type().id() == type_id::BOOL8, "Mask must be Boolean type");
+  CUDF_EXPECTS(input.size() == boolean_mask.size(), "Column size mismatch");
+  CUDF_EXPECTS(output.type() == input.type(), "Output must have the type of the input");
+  CUDF_EXPECTS(output.size() >= input.size(), "Output must have a row for each input row");
+  CUDF_EXPECTS(not output.nullable(), "Output must not have a null mask");
+  CUDF_EXPECTS(
+    temp_storage.size() >= apply_boolean_mask_temp_storage_size(input.type(), input.size()),
+    "Temporary storage is too small");
+
+  if (input.is_empty()) {
+    CUDF_CUDA_TRY(cudaMemsetAsync(output_size, 0, sizeof(size_type), stream.value()));
+    return;
+  }
+  auto const flags =
+    mask_flag_fn{boolean_mask.data<bool>(), boolean_mask.null_mask(), boolean_mask.offset()};
+  dispatch_element_width(input.type(), [&](auto element) {
+    using T = decltype(element);
+    select_flagged(temp_storage.data(),
+                   temp_storage.size(),
+                   static_cast<T const*>(input.head()) + input.offset(),
+                   flags,
+                   static_cast<T*>(output.head()) + output.offset(),
+                   output_size,
+                   input.size(),
+                   stream);
+  });
+}
+
 }  // namespace detail
 
 /*
@@ -96,4 +265,35 @@ std::unique_ptr<table> apply_boolean_mask(table_view const& input,
   CUDF_FUNC_RANGE();
   return detail::apply_boolean_mask(input, boolean_mask, cudf::get_default_stream(), mr);
 }
+
+std::size_t apply_boolean_mask_temp_storage_size(data_type type, size_type num_rows)
+{
+  return dispatch_element_width(type, [&](auto element) {
+    using T = decltype(element);
+    return select_flagged<T>(
+      nullptr, 0, nullptr, mask_flag_fn{}, nullptr, nullptr, num_rows, cudf::get_default_stream());
+  });
+}
+
+void apply_boolean_mask(column_view const& input,
+                        column_view const& boolean_mask,
+                        mutable_column_view const& output,
+                        size_type* output_size,
+                        device_span<std::byte> temp_storage,
+                        rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  detail::apply_boolean_mask(input, boolean_mask, output, output_size, temp_storage, stream);
+}
+
+std::unique_ptr<table> filter_gather(table_view const& input,
+                                     column_view const& gather_map,
+                                     column_view const& boolean_mask,
+                                     out_of_bounds_policy bounds_policy,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::filter_gather(
+    input, gather_map, boolean_mask, bounds_policy, cudf::get_default_stream(), mr);
+}
 }  // namespace cudf
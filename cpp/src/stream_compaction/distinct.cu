@@ -40,28 +40,24 @@
 namespace cudf {
 namespace detail {
 
-rmm::device_uvector<size_type> distinct_indices(table_view const& input,
-                                                duplicate_keep_option keep,
-                                                null_equality nulls_equal,
-                                                nan_equality nans_equal,
-                                                rmm::cuda_stream_view stream,
-                                                rmm::device_async_resource_ref mr)
-{
-  if (input.num_rows() == 0 or input.num_columns() == 0) {
-    return rmm::device_uvector<size_type>(0, stream, mr);
-  }
-
-  auto map = hash_map_type{compute_hash_table_size(input.num_rows()),
-                           cuco::empty_key{-1},
-                           cuco::empty_value{std::numeric_limits<size_type>::min()},
-                           cudf::detail::cuco_allocator{stream},
-                           stream.value()};
-
-  auto const preprocessed_input =
-    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
-  auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
-  auto const has_nested_columns = cudf::detail::has_nested_columns(input);
+namespace {
 
+/**
+ * @brief Insert the index of every row of `input` into `map`, keyed by row equality.
+ *
+ * @param row_hashes Hash of each row, or empty to hash the rows of `preprocessed_input`
+ */
+void insert_rows(
+  hash_map_type& map,
+  size_type num_rows,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const& preprocessed_input,
+  nullate::DYNAMIC has_nulls,
+  bool has_nested_columns,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  device_span<hash_value_type const> row_hashes,
+  rmm::cuda_stream_view stream)
+{
   auto const row_hasher = cudf::experimental::row::hash::row_hasher(preprocessed_input);
   auto const key_hasher = row_hasher.device_hasher(has_nulls);
 
@@ -72,13 +68,22 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
     cuda::proclaim_return_type<cuco::pair<size_type, size_type>>(
       [] __device__(size_type const i) { return cuco::make_pair(i, i); }));
 
-  auto const insert_keys = [&](auto const value_comp) {
+  auto const insert_with = [&](auto const hasher, auto const value_comp) {
     if (has_nested_columns) {
       auto const key_equal = row_comp.equal_to<true>(has_nulls, nulls_equal, value_comp);
-      map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
+      map.insert(pair_iter, pair_iter + num_rows, hasher, key_equal, stream.value());
     } else {
       auto const key_equal = row_comp.equal_to<false>(has_nulls, nulls_equal, value_comp);
-      map.insert(pair_iter, pair_iter + input.num_rows(), key_hasher, key_equal, stream.value());
+      map.insert(pair_iter, pair_iter + num_rows, hasher, key_equal, stream.value());
+    }
+  };
+
+  // Precomputed hashes save hashing every key column of every row
+  auto const insert_keys = [&](auto const value_comp) {
+    if (row_hashes.empty()) {
+      insert_with(key_hasher, value_comp);
+    } else {
+      insert_with(precomputed_row_hasher{row_hashes.data()}, value_comp);
     }
   };
 
@@ -90,6 +95,98 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
     using nan_unequal_comparator = cudf::experimental::row::equality::physical_equality_comparator;
     insert_keys(nan_unequal_comparator{});
   }
+}
+
+/**
+ * @brief Returns the indices of the rows of `input` kept by `distinct_by_extremum`.
+ */
+rmm::device_uvector<size_type> distinct_by_extremum_indices(table_view const& input,
+                                                            column_view const& order_by,
+                                                            keep_extremum keep,
+                                                            null_equality nulls_equal,
+                                                            nan_equality nans_equal,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::device_async_resource_ref mr)
+{
+  auto map = hash_map_type{compute_hash_table_size(input.num_rows()),
+                           cuco::empty_key{-1},
+                           cuco::empty_value{std::numeric_limits<size_type>::min()},
+                           cudf::detail::cuco_allocator{stream},
+                           stream.value()};
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const has_nested_columns = cudf::detail::has_nested_columns(input);
+
+  insert_rows(map,
+              input.num_rows(),
+              preprocessed_input,
+              has_nulls,
+              has_nested_columns,
+              nulls_equal,
+              nans_equal,
+              {},
+              stream);
+
+  auto const reduction_results = reduce_by_row_extremum(map,
+                                                        std::move(preprocessed_input),
+                                                        input.num_rows(),
+                                                        has_nulls,
+                                                        has_nested_columns,
+                                                        order_by,
+                                                        keep,
+                                                        nulls_equal,
+                                                        nans_equal,
+                                                        stream,
+                                                        rmm::mr::get_current_device_resource());
+
+  // Each group of equal rows leaves the index of its selected row in exactly one slot
+  auto output_indices = rmm::device_uvector<size_type>(map.get_size(), stream, mr);
+  auto const map_end  = thrust::copy_if(
+    rmm::exec_policy(stream),
+    reduction_results.begin(),
+    reduction_results.end(),
+    output_indices.begin(),
+    [] __device__(auto const idx) { return idx >= 0; });
+  output_indices.resize(thrust::distance(output_indices.begin(), map_end), stream);
+  return output_indices;
+}
+
+}  // namespace
+
+rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                nan_equality nans_equal,
+                                                device_span<hash_value_type const> row_hashes,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  if (input.num_rows() == 0 or input.num_columns() == 0) {
+    return rmm::device_uvector<size_type>(0, stream, mr);
+  }
+
+  auto map = hash_map_type{compute_hash_table_size(input.num_rows()),
+                           cuco::empty_key{-1},
+                           cuco::empty_value{std::numeric_limits<size_type>::min()},
+                           cudf::detail::cuco_allocator{stream},
+                           stream.value()};
+
+  auto const preprocessed_input =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const has_nulls          = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+  auto const has_nested_columns = cudf::detail::has_nested_columns(input);
+
+  insert_rows(map,
+              input.num_rows(),
+              preprocessed_input,
+              has_nulls,
+              has_nested_columns,
+              nulls_equal,
+              nans_equal,
+              row_hashes,
+              stream);
 
   auto output_indices = rmm::device_uvector<size_type>(map.get_size(), stream, mr);
 
@@ -108,6 +205,7 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
                                                keep,
                                                nulls_equal,
                                                nans_equal,
+                                               row_hashes,
                                                stream,
                                                rmm::mr::get_current_device_resource());
 
@@ -140,8 +238,31 @@ rmm::device_uvector<size_type> distinct_indices(table_view const& input,
   return output_indices;
 }
 
+rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                nan_equality nans_equal,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  return distinct_indices(input, keep, nulls_equal, nans_equal, {}, stream, mr);
+}
+
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+{
+  return detail::distinct(
+    input, keys, distinct_options{}, keep, nulls_equal, nans_equal, stream, mr);
+}
+
 std::unique_ptr<table> distinct(table_view const& input,
                                 std::vector<size_type> const& keys,
+                                distinct_options const& options,
                                 duplicate_keep_option keep,
                                 null_equality nulls_equal,
                                 nan_equality nans_equal,
@@ -152,10 +273,17 @@ std::unique_ptr<table> distinct(table_view const& input,
     return empty_like(input);
   }
 
+  // Duplicates of sorted keys are adjacent, so comparing neighbors finds all of them.
+  // `unique` always compares NaNs as equal.
+  if (options.get_keys_are_sorted() and nans_equal == nan_equality::ALL_EQUAL) {
+    return detail::unique(input, keys, keep, nulls_equal, stream, mr);
+  }
+
   auto const gather_map = detail::distinct_indices(input.select(keys),
                                                    keep,
                                                    nulls_equal,
                                                    nans_equal,
+                                                   row_hashes_of(options, input.num_rows()),
                                                    stream,
                                                    rmm::mr::get_current_device_resource());
   return detail::gather(input,
@@ -166,6 +294,37 @@ std::unique_ptr<table> distinct(table_view const& input,
                         mr);
 }
 
+std::unique_ptr<table> distinct_by_extremum(table_view const& input,
+                                            std::vector<size_type> const& keys,
+                                            column_view const& order_by,
+                                            keep_extremum keep,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(order_by.size() == input.num_rows(),
+               "The ordering column must have one row per input row",
+               std::invalid_argument);
+  if (input.num_rows() == 0 or input.num_columns() == 0 or keys.empty()) {
+    return empty_like(input);
+  }
+
+  auto const gather_map = distinct_by_extremum_indices(input.select(keys),
+                                                       order_by,
+                                                       keep,
+                                                       nulls_equal,
+                                                       nans_equal,
+                                                       stream,
+                                                       rmm::mr::get_current_device_resource());
+  return detail::gather(input,
+                        gather_map,
+                        out_of_bounds_policy::DONT_CHECK,
+                        negative_index_policy::NOT_ALLOWED,
+                        stream,
+                        mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<table> distinct(table_view const& input,
@@ -180,6 +339,32 @@ std::unique_ptr<table> distinct(table_view const& input,
     input, keys, keep, nulls_equal, nans_equal, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<table> distinct(table_view const& input,
+                                std::vector<size_type> const& keys,
+                                distinct_options const& options,
+                                duplicate_keep_option keep,
+                                null_equality nulls_equal,
+                                nan_equality nans_equal,
+                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct(
+    input, keys, options, keep, nulls_equal, nans_equal, cudf::get_default_stream(), mr);
+}
+
+std::unique_ptr<table> distinct_by_extremum(table_view const& input,
+                                            std::vector<size_type> const& keys,
+                                            column_view const& order_by,
+                                            keep_extremum keep,
+                                            null_equality nulls_equal,
+                                            nan_equality nans_equal,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::distinct_by_extremum(
+    input, keys, order_by, keep, nulls_equal, nans_equal, cudf::get_default_stream(), mr);
+}
+
 std::unique_ptr<column> distinct_indices(table_view const& input,
                                          duplicate_keep_option keep,
                                          null_equality nulls_equal,
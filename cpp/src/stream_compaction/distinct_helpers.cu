@@ -16,10 +16,17 @@
 
 #include "distinct_helpers.hpp"
 
+#include <cudf/column/column_device_view.cuh>
 #include <cudf/detail/hash_reduce_by_row.cuh>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
 
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/atomic>
+#include <cuda/std/type_traits>
+
 namespace cudf::detail {
 
 namespace {
@@ -77,6 +84,135 @@ struct reduce_func_builder {
   }
 };
 
+/// Reduction result of a row that is not the selected slot of any group
+constexpr size_type extremum_init_value = -1;
+
+/**
+ * @brief The functor to find the row with the smallest or largest value of an ordering column
+ * among rows that compared equal.
+ *
+ * The index of the selected row is updated with a compare-and-swap loop, so the result does not
+ * depend on the order in which rows are visited.
+ */
+template <typename T, typename MapView, typename KeyHasher, typename KeyEqual>
+struct extremum_reduce_fn : reduce_by_row_fn_base<MapView, KeyHasher, KeyEqual, size_type> {
+  column_device_view const order_by;
+  keep_extremum const keep;
+
+  extremum_reduce_fn(MapView const& d_map,
+                     KeyHasher const& d_hasher,
+                     KeyEqual const& d_equal,
+                     column_device_view const& order_by,
+                     keep_extremum const keep,
+                     size_type* const d_output)
+    : reduce_by_row_fn_base<MapView, KeyHasher, KeyEqual, size_type>{d_map,
+                                                                     d_hasher,
+                                                                     d_equal,
+                                                                     d_output},
+      order_by{order_by},
+      keep{keep}
+  {
+  }
+
+  // NaNs are ordered after all other values, as in sorting
+  __device__ static bool is_less(T const lhs, T const rhs)
+  {
+    if constexpr (cuda::std::is_floating_point_v<T>) {
+      if (isnan(rhs)) { return !isnan(lhs); }
+      if (isnan(lhs)) { return false; }
+    }
+    return lhs < rhs;
+  }
+
+  // Whether row `lhs` is to be kept over row `rhs`
+  __device__ bool is_preferred(size_type const lhs, size_type const rhs) const
+  {
+    auto const lhs_valid = order_by.is_valid(lhs);
+    if (lhs_valid != order_by.is_valid(rhs)) { return lhs_valid; }
+    if (lhs_valid) {
+      auto const lhs_value = order_by.element<T>(lhs);
+      auto const rhs_value = order_by.element<T>(rhs);
+      if (is_less(lhs_value, rhs_value)) { return keep == keep_extremum::MIN; }
+      if (is_less(rhs_value, lhs_value)) { return keep == keep_extremum::MAX; }
+    }
+    return lhs < rhs;
+  }
+
+  __device__ void operator()(size_type const idx) const
+  {
+    auto const out_ptr = this->get_output_ptr(idx);
+    auto selected      = cuda::atomic_ref<size_type, cuda::thread_scope_device>{*out_ptr};
+    auto current       = selected.load(cuda::std::memory_order_relaxed);
+    while (current == extremum_init_value || is_preferred(idx, current)) {
+      if (selected.compare_exchange_weak(current, idx, cuda::std::memory_order_relaxed)) { break; }
+    }
+  }
+};
+
+/**
+ * @brief The builder to construct an instance of `extremum_reduce_fn` for the type of the
+ * ordering column.
+ */
+template <typename T>
+struct extremum_reduce_func_builder {
+  column_device_view const order_by;
+  keep_extremum const keep;
+
+  template <typename MapView, typename KeyHasher, typename KeyEqual>
+  auto build(MapView const& d_map,
+             KeyHasher const& d_hasher,
+             KeyEqual const& d_equal,
+             size_type* const d_output)
+  {
+    return extremum_reduce_fn<T, MapView, KeyHasher, KeyEqual>{
+      d_map, d_hasher, d_equal, order_by, keep, d_output};
+  }
+};
+
+template <typename T>
+constexpr bool is_supported_order_type()
+{
+  return cudf::is_fixed_width<T>() && !cudf::is_boolean<T>() &&
+         cudf::is_relationally_comparable<T, T>();
+}
+
+struct reduce_by_row_extremum_fn {
+  template <typename T, CUDF_ENABLE_IF(is_supported_order_type<T>())>
+  rmm::device_uvector<size_type> operator()(
+    hash_map_type const& map,
+    std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const preprocessed_input,
+    size_type num_rows,
+    cudf::nullate::DYNAMIC has_nulls,
+    bool has_nested_columns,
+    column_view const& order_by,
+    keep_extremum keep,
+    null_equality nulls_equal,
+    nan_equality nans_equal,
+    rmm::cuda_stream_view stream,
+    rmm::device_async_resource_ref mr) const
+  {
+    auto const d_order_by = column_device_view::create(order_by, stream);
+    return hash_reduce_by_row(map,
+                              preprocessed_input,
+                              num_rows,
+                              has_nulls,
+                              has_nested_columns,
+                              nulls_equal,
+                              nans_equal,
+                              extremum_reduce_func_builder<T>{*d_order_by, keep},
+                              extremum_init_value,
+                              stream,
+                              mr);
+  }
+
+  template <typename T, typename... Args, CUDF_ENABLE_IF(!is_supported_order_type<T>())>
+  rmm::device_uvector<size_type> operator()(Args&&...) const
+  {
+    CUDF_FAIL("The ordering column must be a fixed-width column that can be ordered",
+              cudf::data_type_error);
+  }
+};
+
 }  // namespace
 
 // This function is split from `distinct.cu` to improve compile time.
@@ -89,12 +225,27 @@ rmm::device_uvector<size_type> reduce_by_row(
   duplicate_keep_option keep,
   null_equality nulls_equal,
   nan_equality nans_equal,
+  device_span<hash_value_type const> row_hashes,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr)
 {
   CUDF_EXPECTS(keep != duplicate_keep_option::KEEP_ANY,
                "This function should not be called with KEEP_ANY");
 
+  if (!row_hashes.empty()) {
+    return hash_reduce_by_row(map,
+                              preprocessed_input,
+                              precomputed_row_hasher{row_hashes.data()},
+                              num_rows,
+                              has_nulls,
+                              has_nested_columns,
+                              nulls_equal,
+                              nans_equal,
+                              reduce_func_builder{keep},
+                              reduction_init_value(keep),
+                              stream,
+                              mr);
+  }
   return hash_reduce_by_row(map,
                             preprocessed_input,
                             num_rows,
@@ -108,4 +259,43 @@ rmm::device_uvector<size_type> reduce_by_row(
                             mr);
 }
 
+rmm::device_uvector<size_type> reduce_by_row_extremum(
+  hash_map_type const& map,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const preprocessed_input,
+  size_type num_rows,
+  cudf::nullate::DYNAMIC has_nulls,
+  bool has_nested_columns,
+  column_view const& order_by,
+  keep_extremum keep,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  return type_dispatcher<dispatch_storage_type>(order_by.type(),
+                                                reduce_by_row_extremum_fn{},
+                                                map,
+                                                preprocessed_input,
+                                                num_rows,
+                                                has_nulls,
+                                                has_nested_columns,
+                                                order_by,
+                                                keep,
+                                                nulls_equal,
+                                                nans_equal,
+                                                stream,
+                                                mr);
+}
+
+device_span<hash_value_type const> row_hashes_of(distinct_options const& options,
+                                                 size_type num_rows)
+{
+  auto const& hashes = options.get_row_hashes();
+  if (!hashes.has_value()) { return {}; }
+  CUDF_EXPECTS(hashes->size() == num_rows,
+               "Row hashes must have one hash per input row",
+               std::invalid_argument);
+  return {hashes->data<hash_value_type>(), static_cast<std::size_t>(hashes->size())};
+}
+
 }  // namespace cudf::detail
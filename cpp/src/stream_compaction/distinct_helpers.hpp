@@ -16,9 +16,11 @@
 
 #include "stream_compaction_common.hpp"
 
+#include <cudf/hashing.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/device_uvector.hpp>
@@ -42,6 +44,15 @@ auto constexpr reduction_init_value(duplicate_keep_option keep)
   }
 }
 
+/**
+ * @brief Row hasher returning hashes computed ahead of time, one per row.
+ */
+struct precomputed_row_hasher {
+  hash_value_type const* hashes;  ///< Hash of each row
+
+  __device__ hash_value_type operator()(size_type idx) const noexcept { return hashes[idx]; }
+};
+
 /**
  * @brief Perform a reduction on groups of rows that are compared equal.
  *
@@ -69,6 +80,8 @@ auto constexpr reduction_init_value(duplicate_keep_option keep)
  * @param nulls_equal Flag to specify whether null elements should be considered as equal
  * @param nans_equal Flag to specify whether NaN values in floating point column should be
  *        considered equal.
+ * @param row_hashes Hashes of the rows used to build `map`, or empty if the rows were hashed
+ *        with the row hasher of `preprocessed_input`
  * @param stream CUDA stream used for device memory operations and kernel launches
  * @param mr Device memory resource used to allocate the returned vector
  * @return A device_uvector containing the reduction results
@@ -82,7 +95,70 @@ rmm::device_uvector<size_type> reduce_by_row(
   duplicate_keep_option keep,
   null_equality nulls_equal,
   nan_equality nans_equal,
+  device_span<hash_value_type const> row_hashes,
   rmm::cuda_stream_view stream,
   rmm::device_async_resource_ref mr);
 
+/**
+ * @brief Find the row with the smallest or largest value of `order_by` in each group of rows that
+ * compare equal.
+ *
+ * The output array is filled with `-1`. Then, for each row group, the index of the selected row
+ * is written at the index of an unspecified row in the group.
+ *
+ * @throw cudf::data_type_error if `order_by` is not a fixed-width column that can be ordered
+ *
+ * @param map The auxiliary map built from the input rows
+ * @param preprocessed_input The preprocessed of the input rows for computing row hashing and row
+ *        comparisons
+ * @param num_rows The number of all input rows
+ * @param has_nulls Indicate whether the input rows has any nulls at any nested levels
+ * @param has_nested_columns Indicates whether the input table has any nested columns
+ * @param order_by Column whose extremum selects the row of each group
+ * @param keep Whether the smallest or the largest value of `order_by` is selected
+ * @param nulls_equal Flag to specify whether null elements should be considered as equal
+ * @param nans_equal Flag to specify whether NaN values in floating point column should be
+ *        considered equal.
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the returned vector
+ * @return A device_uvector containing the reduction results
+ */
+rmm::device_uvector<size_type> reduce_by_row_extremum(
+  hash_map_type const& map,
+  std::shared_ptr<cudf::experimental::row::equality::preprocessed_table> const preprocessed_input,
+  size_type num_rows,
+  cudf::nullate::DYNAMIC has_nulls,
+  bool has_nested_columns,
+  column_view const& order_by,
+  keep_extremum keep,
+  null_equality nulls_equal,
+  nan_equality nans_equal,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr);
+
+/**
+ * @copydoc cudf::detail::distinct_indices
+ *
+ * @param row_hashes Hash of each input row, or empty to hash the rows of `input`
+ */
+rmm::device_uvector<size_type> distinct_indices(table_view const& input,
+                                                duplicate_keep_option keep,
+                                                null_equality nulls_equal,
+                                                nan_equality nans_equal,
+                                                device_span<hash_value_type const> row_hashes,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr);
+
+/**
+ * @brief Returns the precomputed row hashes of `options` as a span, checking their size.
+ *
+ * @throw std::invalid_argument if the hashes do not have one entry per row
+ *
+ * @param options Hints about the input rows
+ * @param num_rows Number of input rows
+ * @return Span of the row hashes, or an empty span if there are none
+ */
+device_span<hash_value_type const> row_hashes_of(distinct_options const& options,
+                                                 size_type num_rows);
+
 }  // namespace cudf::detail
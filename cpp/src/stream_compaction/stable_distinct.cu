@@ -14,6 +14,8 @@
  * limitations under the License.
  */
 
+#include "distinct_helpers.hpp"
+
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
@@ -37,15 +39,34 @@ std::unique_ptr<table> stable_distinct(table_view const& input,
                                        nan_equality nans_equal,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
+{
+  return detail::stable_distinct(
+    input, keys, distinct_options{}, keep, nulls_equal, nans_equal, stream, mr);
+}
+
+std::unique_ptr<table> stable_distinct(table_view const& input,
+                                       std::vector<size_type> const& keys,
+                                       distinct_options const& options,
+                                       duplicate_keep_option keep,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
 {
   if (input.num_rows() == 0 or input.num_columns() == 0 or keys.empty()) {
     return empty_like(input);
   }
 
+  // `unique` keeps the input order, so it is already the stable result for sorted keys
+  if (options.get_keys_are_sorted() and nans_equal == nan_equality::ALL_EQUAL) {
+    return detail::unique(input, keys, keep, nulls_equal, stream, mr);
+  }
+
   auto const distinct_indices = detail::distinct_indices(input.select(keys),
                                                          keep,
                                                          nulls_equal,
                                                          nans_equal,
+                                                         row_hashes_of(options, input.num_rows()),
                                                          stream,
                                                          rmm::mr::get_current_device_resource());
 
@@ -86,4 +107,17 @@ std::unique_ptr<table> stable_distinct(table_view const& input,
     input, keys, keep, nulls_equal, nans_equal, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<table> stable_distinct(table_view const& input,
+                                       std::vector<size_type> const& keys,
+                                       distinct_options const& options,
+                                       duplicate_keep_option keep,
+                                       null_equality nulls_equal,
+                                       nan_equality nans_equal,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::stable_distinct(
+    input, keys, options, keep, nulls_equal, nans_equal, cudf::get_default_stream(), mr);
+}
+
 }  // namespace cudf
@@ -22,6 +22,7 @@
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/strings/attributes.hpp>
 #include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -168,9 +169,7 @@ std::unique_ptr<column> count_characters(strings_column_view const& input,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
 {
-  if ((input.size() == input.null_count()) ||
-      ((input.chars_size(stream) / (input.size() - input.null_count())) <
-       AVG_CHAR_BYTES_THRESHOLD)) {
+  if (average_bytes_per_row(input, stream) < AVG_CHAR_BYTES_THRESHOLD) {
     auto ufn = cuda::proclaim_return_type<size_type>(
       [] __device__(string_view const& d_str) { return d_str.length(); });
     return counts_fn(input, ufn, stream, mr);
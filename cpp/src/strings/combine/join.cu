@@ -25,6 +25,7 @@
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/strings_column_factories.cuh>
 #include <cudf/strings/detail/utilities.cuh>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -147,9 +148,7 @@ std::unique_ptr<column> join_strings(strings_column_view const& input,
 
   auto chars = [&] {
     // build the strings column and commandeer the chars column
-    if ((input.size() == input.null_count()) ||
-        ((input.chars_size(stream) / (input.size() - input.null_count())) <=
-         AVG_CHAR_BYTES_THRESHOLD)) {
+    if (average_bytes_per_row(input, stream) <= AVG_CHAR_BYTES_THRESHOLD) {
       return std::get<1>(make_strings_children(
                            join_fn{*d_strings, d_separator, d_narep}, input.size(), stream, mr))
         .release();
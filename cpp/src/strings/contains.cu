@@ -29,8 +29,15 @@
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -57,6 +64,46 @@ struct contains_fn {
   }
 };
 
+/**
+ * @brief Regex-matches the pattern to each string with the automaton of the program
+ *
+ * Rows the automaton cannot resolve because of non-ASCII characters are marked
+ * in `d_unresolved` so they can be matched by the regex program instead.
+ */
+struct contains_dfa_fn {
+  column_device_view const d_strings;
+  bool const beginning_only;
+  bool* d_results;
+  bool* d_unresolved;
+
+  __device__ void operator()(size_type const idx, dfa_device const dfa)
+  {
+    auto result = thrust::optional<bool>{false};
+    if (d_strings.is_valid(idx)) {
+      result = dfa.is_match(d_strings.element<string_view>(idx), beginning_only);
+    }
+    d_results[idx]    = result.value_or(false);
+    d_unresolved[idx] = !result.has_value();
+  }
+};
+
+/**
+ * @brief Regex-matches the pattern to the given subset of rows
+ */
+struct contains_rows_fn {
+  contains_fn match_fn;
+  size_type const* d_rows;
+  bool* d_results;
+
+  __device__ void operator()(size_type const idx,
+                             reprog_device const prog,
+                             int32_t const thread_idx)
+  {
+    auto const row  = d_rows[idx];
+    d_results[row] = match_fn(row, prog, thread_idx);
+  }
+};
+
 std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                       regex_program const& prog,
                                       bool const beginning_only,
@@ -71,13 +118,41 @@ std::unique_ptr<column> contains_impl(strings_column_view const& input,
                                      mr);
   if (input.is_empty()) { return results; }
 
-  auto d_prog = regex_device_builder::create_prog_device(prog, stream);
-
   auto d_results       = results->mutable_view().data<bool>();
   auto const d_strings = column_device_view::create(input.parent(), stream);
 
-  launch_transform_kernel(
-    contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
+  auto d_dfa = regex_device_builder::create_dfa_device(prog, stream);
+  if (d_dfa) {
+    auto unresolved = rmm::device_uvector<bool>(input.size(), stream);
+    launch_dfa_for_each_kernel(
+      contains_dfa_fn{*d_strings, beginning_only, d_results, unresolved.data()},
+      *d_dfa,
+      input.size(),
+      stream);
+
+    // rows with non-ASCII characters are matched using the regex program
+    auto rows           = rmm::device_uvector<size_type>(input.size(), stream);
+    auto const rows_end = thrust::copy_if(rmm::exec_policy_nosync(stream),
+                                          thrust::counting_iterator<size_type>(0),
+                                          thrust::counting_iterator<size_type>(input.size()),
+                                          unresolved.begin(),
+                                          rows.begin(),
+                                          thrust::identity<bool>{});
+
+    auto const rows_count = static_cast<size_type>(thrust::distance(rows.begin(), rows_end));
+    if (rows_count > 0) {
+      auto d_prog = regex_device_builder::create_prog_device(prog, stream);
+      launch_for_each_kernel(
+        contains_rows_fn{contains_fn{*d_strings, beginning_only}, rows.data(), d_results},
+        *d_prog,
+        rows_count,
+        stream);
+    }
+  } else {
+    auto d_prog = regex_device_builder::create_prog_device(prog, stream);
+    launch_transform_kernel(
+      contains_fn{*d_strings, beginning_only}, *d_prog, d_results, input.size(), stream);
+  }
 
   results->set_null_count(input.null_count());
 
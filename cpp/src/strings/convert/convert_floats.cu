@@ -18,7 +18,9 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_floats.hpp>
+#include <cudf/strings/detail/convert/is_float.cuh>
 #include <cudf/strings/detail/convert/string_to_float.cuh>
 #include <cudf/strings/detail/converters.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
@@ -128,6 +130,88 @@ std::unique_ptr<column> to_floats(strings_column_view const& input,
   return detail::to_floats(input, output_type, stream, mr);
 }
 
+namespace detail {
+namespace {
+
+/**
+ * @brief Converts a string to a float and returns whether it is valid
+ *
+ * This is called by valid_if so the validation, the conversion, and the null mask
+ * are computed in one pass.
+ */
+template <typename FloatType>
+struct try_string_to_float_fn {
+  column_device_view const d_strings;
+  FloatType* d_results;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    d_results[idx] = FloatType{0};
+    if (d_strings.is_null(idx)) { return false; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    if (!is_float(d_str)) { return false; }
+    d_results[idx] = static_cast<FloatType>(stod(d_str));
+    return true;
+  }
+};
+
+struct dispatch_try_to_floats_fn {
+  template <typename FloatType, std::enable_if_t<std::is_floating_point_v<FloatType>>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto const d_strings = column_device_view::create(input.parent(), stream);
+    auto results         = make_numeric_column(data_type{type_to_id<FloatType>()},
+                                       input.size(),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      try_string_to_float_fn<FloatType>{*d_strings, results->mutable_view().data<FloatType>()},
+      stream,
+      mr);
+    if (null_count > 0) { results->set_null_mask(std::move(null_mask), null_count); }
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not std::is_floating_point_v<T>>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref) const
+  {
+    CUDF_FAIL("Output for try_to_floats must be a float type.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> try_to_floats(strings_column_view const& input,
+                                      data_type output_type,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  if (input.is_empty()) {
+    CUDF_EXPECTS(cudf::is_floating_point(output_type),
+                 "Output for try_to_floats must be a float type.");
+    return make_numeric_column(output_type, 0, mask_state::UNALLOCATED, stream);
+  }
+  return type_dispatcher(output_type, dispatch_try_to_floats_fn{}, input, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> try_to_floats(strings_column_view const& input,
+                                      data_type output_type,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::try_to_floats(input, output_type, stream, mr);
+}
+
 namespace detail {
 namespace {
 /**
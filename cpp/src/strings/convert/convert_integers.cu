@@ -19,6 +19,7 @@
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/valid_if.cuh>
 #include <cudf/strings/convert/convert_integers.hpp>
 #include <cudf/strings/detail/convert/int_to_string.cuh>
 #include <cudf/strings/detail/convert/string_to_int.cuh>
@@ -36,6 +37,7 @@
 #include <thrust/execution_policy.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/logical.h>
+#include <thrust/optional.h>
 #include <thrust/pair.h>
 #include <thrust/transform.h>
 
@@ -307,6 +309,151 @@ std::unique_ptr<column> to_integers(strings_column_view const& input,
   return detail::to_integers(input, output_type, stream, mr);
 }
 
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns true if each of the 8 bytes of `chunk` is an ASCII digit
+ */
+__device__ inline bool is_eight_digits(uint64_t chunk)
+{
+  return ((chunk & 0xF0F0'F0F0'F0F0'F0F0UL) == 0x3030'3030'3030'3030UL) &&
+         (((chunk + 0x0606'0606'0606'0606UL) & 0xF0F0'F0F0'F0F0'F0F0UL) ==
+          0x3030'3030'3030'3030UL);
+}
+
+/**
+ * @brief Returns the value of the 8 ASCII digits in `chunk`
+ *
+ * The first digit is in the lowest byte and is the most significant.
+ */
+__device__ inline uint64_t parse_eight_digits(uint64_t chunk)
+{
+  constexpr uint64_t mask = 0x0000'00FF'0000'00FFUL;
+  constexpr uint64_t mul1 = 0x000F'4240'0000'0064UL;  // 100 + (1000000 << 32)
+  constexpr uint64_t mul2 = 0x0000'2710'0000'0001UL;  // 1 + (10000 << 32)
+  chunk -= 0x3030'3030'3030'3030UL;
+  chunk = (chunk * 10) + (chunk >> 8);
+  return (((chunk & mask) * mul1) + (((chunk >> 16) & mask) * mul2)) >> 32;
+}
+
+/**
+ * @brief Parses a string into an integer if it is valid for the IntegerType
+ *
+ * The string is valid under the same rules as `string_to_integer_check_fn`.
+ * Runs of 8 digits are parsed together while the value cannot overflow 64 bits.
+ *
+ * @return The value or nothing if the string is not valid
+ */
+template <typename IntegerType>
+__device__ thrust::optional<IntegerType> parse_integer(string_view const d_str)
+{
+  auto ptr        = d_str.data();
+  auto const end  = ptr + d_str.size_bytes();
+  auto const sign = (ptr < end) && (*ptr == '-' || *ptr == '+') ? *ptr++ : '+';
+  if (ptr == end || (sign == '-' && std::is_unsigned_v<IntegerType>)) { return thrust::nullopt; }
+
+  auto const max_value = static_cast<uint64_t>(std::numeric_limits<IntegerType>::max());
+  auto const limit     = sign == '-' ? max_value + 1 : max_value;
+  uint64_t value = 0;
+  // each chunk adds 8 digits so the value must stay below 10^10 to not overflow
+  while ((end - ptr) >= 8 && value < 10'000'000'000UL) {
+    uint64_t chunk;
+    memcpy(&chunk, ptr, sizeof(chunk));
+    if (!is_eight_digits(chunk)) { break; }
+    value = value * 100'000'000UL + parse_eight_digits(chunk);
+    ptr += 8;
+  }
+  for (; ptr < end; ++ptr) {
+    auto const chr = *ptr;
+    if (chr < '0' || chr > '9') { return thrust::nullopt; }
+    auto const digit = static_cast<uint64_t>(chr - '0');
+    if (value > (limit - digit) / 10) { return thrust::nullopt; }
+    value = value * 10 + digit;
+  }
+  if (value > limit) { return thrust::nullopt; }
+  return static_cast<IntegerType>(sign == '-' ? (~value + 1) : value);
+}
+
+/**
+ * @brief Converts a string to an integer and returns whether it is valid
+ *
+ * This is called by valid_if so the conversion and the null mask are computed in one pass.
+ */
+template <typename IntegerType>
+struct try_string_to_integer_fn {
+  column_device_view const d_strings;
+  IntegerType* d_results;
+
+  __device__ bool operator()(size_type idx) const
+  {
+    auto const value = d_strings.is_null(idx)
+                         ? thrust::nullopt
+                         : parse_integer<IntegerType>(d_strings.element<string_view>(idx));
+    d_results[idx]   = value.value_or(IntegerType{0});
+    return value.has_value();
+  }
+};
+
+struct dispatch_try_to_integers_fn {
+  template <typename IntegerType,
+            std::enable_if_t<cudf::is_integral_not_bool<IntegerType>()>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const& input,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr) const
+  {
+    auto const d_strings = column_device_view::create(input.parent(), stream);
+    auto results         = make_numeric_column(data_type{type_to_id<IntegerType>()},
+                                       input.size(),
+                                       mask_state::UNALLOCATED,
+                                       stream,
+                                       mr);
+    auto [null_mask, null_count] = cudf::detail::valid_if(
+      thrust::make_counting_iterator<size_type>(0),
+      thrust::make_counting_iterator<size_type>(input.size()),
+      try_string_to_integer_fn<IntegerType>{*d_strings,
+                                            results->mutable_view().data<IntegerType>()},
+      stream,
+      mr);
+    if (null_count > 0) { results->set_null_mask(std::move(null_mask), null_count); }
+    return results;
+  }
+
+  template <typename T, std::enable_if_t<not cudf::is_integral_not_bool<T>()>* = nullptr>
+  std::unique_ptr<column> operator()(strings_column_view const&,
+                                     rmm::cuda_stream_view,
+                                     rmm::device_async_resource_ref) const
+  {
+    CUDF_FAIL("Output for try_to_integers must be an integer type.");
+  }
+};
+
+}  // namespace
+
+std::unique_ptr<column> try_to_integers(strings_column_view const& input,
+                                        data_type output_type,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  if (input.is_empty()) {
+    CUDF_EXPECTS(cudf::is_integral_not_bool(output_type),
+                 "Output for try_to_integers must be an integer type.");
+    return make_numeric_column(output_type, 0, mask_state::UNALLOCATED, stream);
+  }
+  return type_dispatcher(output_type, dispatch_try_to_integers_fn{}, input, stream, mr);
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> try_to_integers(strings_column_view const& input,
+                                        data_type output_type,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::try_to_integers(input, output_type, stream, mr);
+}
+
 namespace detail {
 namespace {
 template <typename IntegerType>
@@ -38,6 +38,8 @@
 #include <thrust/transform.h>
 #include <thrust/transform_scan.h>
 
+#include <type_traits>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -112,14 +114,14 @@ auto create_strings_device_views(host_span<column_view const> views, rmm::cuda_s
                          output_chars_size);
 }
 
-template <size_type block_size, bool Nullable>
+template <size_type block_size, bool Nullable, typename OffsetType>
 CUDF_KERNEL void fused_concatenate_string_offset_kernel(
   column_device_view const* input_views,
   size_t const* input_offsets,
   size_t const* partition_offsets,
   size_type const num_input_views,
   size_type const output_size,
-  cudf::detail::output_offsetalator output_data,
+  OffsetType* output_data,
   bitmask_type* output_mask,
   size_type* out_valid_count)
 {
@@ -139,10 +141,10 @@ CUDF_KERNEL void fused_concatenate_string_offset_kernel(
     auto const offsets_child = input_view.child(strings_column_view::offsets_column_index);
     auto const input_data =
       cudf::detail::input_offsetalator(offsets_child.head(), offsets_child.type());
-    output_data[output_index] =
+    output_data[output_index] = static_cast<OffsetType>(
       input_data[offset_index + input_view.offset()]  // handle parent offset
       - input_data[input_view.offset()]               // subtract first offset if non-zero
-      + partition_offsets[partition_index];           // add offset of source column
+      + partition_offsets[partition_index]);          // add offset of source column
 
     if (Nullable) {
       bool const bit_is_set       = input_view.is_valid(offset_index);
@@ -162,7 +164,7 @@ CUDF_KERNEL void fused_concatenate_string_offset_kernel(
 
   // Fill final offsets index with total size of char data
   if (output_index == output_size) {
-    output_data[output_size] = partition_offsets[num_input_views];
+    output_data[output_size] = static_cast<OffsetType>(partition_offsets[num_input_views]);
   }
 
   if (Nullable) {
@@ -175,7 +177,7 @@ CUDF_KERNEL void fused_concatenate_string_offset_kernel(
 CUDF_KERNEL void fused_concatenate_string_chars_kernel(column_device_view const* input_views,
                                                        size_t const* partition_offsets,
                                                        size_type const num_input_views,
-                                                       size_type const output_size,
+                                                       int64_t const output_size,
                                                        char* output_data)
 {
   cudf::thread_index_type output_index = threadIdx.x + blockIdx.x * blockDim.x;
@@ -231,8 +233,6 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
 
   // create output offsets column
   auto offsets_column = create_offsets_child_column(total_bytes, offsets_count, stream, mr);
-  auto itr_new_offsets =
-    cudf::detail::offsetalator_factory::make_output_iterator(offsets_column->mutable_view());
 
   rmm::device_buffer null_mask{0, stream, mr};
   size_type null_count{};
@@ -246,17 +246,28 @@ std::unique_ptr<column> concatenate(host_span<column_view const> columns,
 
     constexpr size_type block_size{256};
     cudf::detail::grid_1d config(offsets_count, block_size);
-    auto const kernel = has_nulls ? fused_concatenate_string_offset_kernel<block_size, true>
-                                  : fused_concatenate_string_offset_kernel<block_size, false>;
-    kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
-      d_views,
-      d_input_offsets.data(),
-      d_partition_offsets.data(),
-      static_cast<size_type>(columns.size()),
-      strings_count,
-      itr_new_offsets,
-      reinterpret_cast<bitmask_type*>(null_mask.data()),
-      d_valid_count.data());
+    // the kernel is instantiated for the output offsets type to write them directly
+    auto const launch = [&](auto* output_offsets) {
+      using OffsetType  = std::remove_pointer_t<decltype(output_offsets)>;
+      auto const kernel = has_nulls
+                            ? fused_concatenate_string_offset_kernel<block_size, true, OffsetType>
+                            : fused_concatenate_string_offset_kernel<block_size, false, OffsetType>;
+      kernel<<<config.num_blocks, config.num_threads_per_block, 0, stream.value()>>>(
+        d_views,
+        d_input_offsets.data(),
+        d_partition_offsets.data(),
+        static_cast<size_type>(columns.size()),
+        strings_count,
+        output_offsets,
+        reinterpret_cast<bitmask_type*>(null_mask.data()),
+        d_valid_count.data());
+    };
+    auto offsets_view = offsets_column->mutable_view();
+    if (offsets_view.type().id() == type_id::INT64) {
+      launch(offsets_view.data<int64_t>());
+    } else {
+      launch(offsets_view.data<int32_t>());
+    }
 
     if (has_nulls) { null_count = strings_count - d_valid_count.value(stream); }
   }
@@ -18,18 +18,31 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/strings/contains.hpp>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/span.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/warp/warp_reduce.cuh>
 #include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <iterator>
+#include <string>
+#include <type_traits>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -39,6 +52,244 @@ namespace {
 constexpr char multi_wildcard  = '%';
 constexpr char single_wildcard = '_';
 
+/**
+ * @brief Threshold to decide on using string or warp parallel functions.
+ *
+ * If the average byte length of a string in a column exceeds this value then
+ * a warp-parallel function is used.
+ */
+constexpr size_type AVG_CHAR_BYTES_THRESHOLD = 64;
+
+/**
+ * @brief Shapes of patterns that are matched without the generic wildcard matcher
+ */
+enum class like_kind {
+  GENERIC,              ///< Pattern with `_` or several `%`-separated pieces
+  ANY,                  ///< `%`: matches every string
+  EQUALS,               ///< `abc`
+  STARTS_WITH,          ///< `abc%`
+  ENDS_WITH,            ///< `%abc`
+  CONTAINS,             ///< `%abc%`
+  STARTS_AND_ENDS_WITH  ///< `abc%def`
+};
+
+/**
+ * @brief A pattern classified by its shape along with its unescaped literal pieces
+ */
+struct pattern_shape {
+  like_kind kind;
+  std::string first;  ///< Piece at the start, or the whole piece for EQUALS and CONTAINS
+  std::string last;   ///< Piece at the end for ENDS_WITH and STARTS_AND_ENDS_WITH
+};
+
+/**
+ * @brief Classifies the pattern on the host so common shapes can skip the generic matcher
+ *
+ * Escaped characters become literal bytes of the pieces. Any unescaped `_` makes the pattern
+ * GENERIC since matching it requires walking the string by characters.
+ *
+ * @param pattern Pattern to classify
+ * @param escape_character Escape character of the pattern; only its first character is used
+ * @return The shape of the pattern
+ */
+pattern_shape classify_pattern(std::string const& pattern, std::string const& escape_character)
+{
+  // like_fn treats a null character as the escape when no escape character is given
+  auto const escape =
+    escape_character.empty()
+      ? std::string(1, '\0')
+      : escape_character.substr(0, bytes_in_utf8_byte(static_cast<uint8_t>(escape_character[0])));
+
+  // pieces of the pattern separated by `%`
+  std::vector<std::string> pieces(1);
+  std::size_t pos = 0;
+  while (pos < pattern.size()) {
+    auto width = static_cast<std::size_t>(bytes_in_utf8_byte(static_cast<uint8_t>(pattern[pos])));
+    if (pattern.compare(pos, escape.size(), escape) == 0) {
+      // the escaped character is literal while a trailing escape character matches itself
+      if (pos + width < pattern.size()) {
+        pos += width;
+        width = bytes_in_utf8_byte(static_cast<uint8_t>(pattern[pos]));
+      }
+      pieces.back().append(pattern, pos, width);
+    } else if (pattern[pos] == multi_wildcard) {
+      pieces.emplace_back();
+    } else if (pattern[pos] == single_wildcard) {
+      return {like_kind::GENERIC, {}, {}};
+    } else {
+      pieces.back().append(pattern, pos, width);
+    }
+    pos += width;
+  }
+
+  auto const& first = pieces.front();
+  auto const& last  = pieces.back();
+  if (pieces.size() == 1) { return {like_kind::EQUALS, first, {}}; }
+
+  std::vector<std::string> middle;
+  std::copy_if(pieces.begin() + 1, pieces.end() - 1, std::back_inserter(middle), [](auto const& p) {
+    return not p.empty();
+  });
+  if (middle.empty()) {
+    if (first.empty() and last.empty()) { return {like_kind::ANY, {}, {}}; }
+    if (last.empty()) { return {like_kind::STARTS_WITH, first, {}}; }
+    if (first.empty()) { return {like_kind::ENDS_WITH, {}, last}; }
+    return {like_kind::STARTS_AND_ENDS_WITH, first, last};
+  }
+  if (middle.size() == 1 and first.empty() and last.empty()) {
+    return {like_kind::CONTAINS, middle.front(), {}};
+  }
+  return {like_kind::GENERIC, {}, {}};
+}
+
+/**
+ * @brief Matches each string against a pattern of the given shape by comparing bytes
+ *
+ * @tparam Kind Shape of the pattern, other than GENERIC
+ */
+template <like_kind Kind>
+struct like_shape_fn {
+  column_device_view const d_strings;
+  string_view const d_first;
+  string_view const d_last;
+
+  __device__ static bool matches_at(string_view d_str, size_type pos, string_view d_target)
+  {
+    return (pos + d_target.size_bytes() <= d_str.size_bytes()) &&
+           d_target.compare(d_str.data() + pos, d_target.size_bytes()) == 0;
+  }
+
+  __device__ bool operator()(size_type const idx) const
+  {
+    if (d_strings.is_null(idx)) { return false; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const size  = d_str.size_bytes();
+
+    if constexpr (Kind == like_kind::ANY) {
+      return true;
+    } else if constexpr (Kind == like_kind::EQUALS) {
+      return size == d_first.size_bytes() && matches_at(d_str, 0, d_first);
+    } else if constexpr (Kind == like_kind::STARTS_WITH) {
+      return matches_at(d_str, 0, d_first);
+    } else if constexpr (Kind == like_kind::ENDS_WITH) {
+      return size >= d_last.size_bytes() && matches_at(d_str, size - d_last.size_bytes(), d_last);
+    } else if constexpr (Kind == like_kind::STARTS_AND_ENDS_WITH) {
+      // the two pieces must not overlap
+      return size >= d_first.size_bytes() + d_last.size_bytes() && matches_at(d_str, 0, d_first) &&
+             matches_at(d_str, size - d_last.size_bytes(), d_last);
+    } else {
+      for (size_type pos = 0; pos + d_first.size_bytes() <= size; ++pos) {
+        if (matches_at(d_str, pos, d_first)) { return true; }
+      }
+      return false;
+    }
+  }
+};
+
+/**
+ * @brief Check if `d_target` appears in a row in `d_strings`.
+ *
+ * This executes as a warp per string/row and performs well for longer strings.
+ * @see AVG_CHAR_BYTES_THRESHOLD
+ *
+ * @param d_strings Column of input strings
+ * @param d_target String to search for in each row of `d_strings`
+ * @param d_results Indicates which rows contain `d_target`
+ */
+CUDF_KERNEL void like_contains_warp_parallel_fn(column_device_view const d_strings,
+                                                string_view const d_target,
+                                                bool* d_results)
+{
+  auto const idx    = cudf::detail::grid_1d::global_thread_id();
+  using warp_reduce = cub::WarpReduce<bool>;
+  __shared__ typename warp_reduce::TempStorage temp_storage;
+
+  if (idx >= (static_cast<int64_t>(d_strings.size()) * cudf::detail::warp_size)) { return; }
+
+  auto const str_idx  = static_cast<size_type>(idx / cudf::detail::warp_size);
+  auto const lane_idx = static_cast<size_type>(idx % cudf::detail::warp_size);
+  if (d_strings.is_null(str_idx)) { return; }
+  auto const d_str = d_strings.element<string_view>(str_idx);
+
+  // each lane checks every warp_size-th starting byte
+  auto found = false;
+  for (auto pos = lane_idx; !found && (pos + d_target.size_bytes() <= d_str.size_bytes());
+       pos += cudf::detail::warp_size) {
+    found = d_target.compare(d_str.data() + pos, d_target.size_bytes()) == 0;
+  }
+
+  auto const result = warp_reduce(temp_storage).Reduce(found, cub::Max());
+  if (lane_idx == 0) { d_results[str_idx] = result; }
+}
+
+/**
+ * @brief Matches the strings against a pattern that is not GENERIC
+ */
+std::unique_ptr<column> like_shape(strings_column_view const& input,
+                                   pattern_shape const& shape,
+                                   rmm::cuda_stream_view stream,
+                                   rmm::device_async_resource_ref mr)
+{
+  auto results = make_numeric_column(data_type{type_id::BOOL8},
+                                     input.size(),
+                                     cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                     input.null_count(),
+                                     stream,
+                                     mr);
+  if (input.is_empty()) { return results; }
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const h_pieces  = shape.first + shape.last;
+  auto const pieces    = cudf::detail::make_device_uvector_async(
+    host_span<char const>{h_pieces.data(), h_pieces.size()},
+    stream,
+    rmm::mr::get_current_device_resource());
+  auto const d_first = string_view(pieces.data(), static_cast<size_type>(shape.first.size()));
+  auto const d_last  = string_view(pieces.data() + shape.first.size(),
+                                  static_cast<size_type>(shape.last.size()));
+  auto d_results     = results->mutable_view().data<bool>();
+
+  auto match = [&](auto kind) {
+    using fn_type = like_shape_fn<decltype(kind)::value>;
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(input.size()),
+                      d_results,
+                      fn_type{*d_strings, d_first, d_last});
+  };
+
+  switch (shape.kind) {
+    case like_kind::ANY: match(std::integral_constant<like_kind, like_kind::ANY>{}); break;
+    case like_kind::EQUALS: match(std::integral_constant<like_kind, like_kind::EQUALS>{}); break;
+    case like_kind::STARTS_WITH:
+      match(std::integral_constant<like_kind, like_kind::STARTS_WITH>{});
+      break;
+    case like_kind::ENDS_WITH:
+      match(std::integral_constant<like_kind, like_kind::ENDS_WITH>{});
+      break;
+    case like_kind::STARTS_AND_ENDS_WITH:
+      match(std::integral_constant<like_kind, like_kind::STARTS_AND_ENDS_WITH>{});
+      break;
+    case like_kind::CONTAINS:
+      if (average_bytes_per_row(input, stream) > AVG_CHAR_BYTES_THRESHOLD) {
+        // warp-per-string runs faster for longer strings (but not shorter ones)
+        constexpr int block_size = 256;
+        cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
+        like_contains_warp_parallel_fn<<<grid.num_blocks,
+                                         grid.num_threads_per_block,
+                                         0,
+                                         stream.value()>>>(*d_strings, d_first, d_results);
+      } else {
+        match(std::integral_constant<like_kind, like_kind::CONTAINS>{});
+      }
+      break;
+    default: CUDF_FAIL("Generic patterns are matched by like_fn");
+  }
+
+  results->set_null_count(input.null_count());
+  return results;
+}
+
 template <typename PatternIterator>
 struct like_fn {
   column_device_view const d_strings;
@@ -157,6 +408,10 @@ std::unique_ptr<column> like(strings_column_view const& input,
   CUDF_EXPECTS(pattern.is_valid(stream), "Parameter pattern must be valid");
   CUDF_EXPECTS(escape_character.is_valid(stream), "Parameter escape_character must be valid");
 
+  auto const shape =
+    classify_pattern(pattern.to_string(stream), escape_character.to_string(stream));
+  if (shape.kind != like_kind::GENERIC) { return like_shape(input, shape, stream, mr); }
+
   auto const d_pattern    = pattern.value(stream);
   auto const patterns_itr = thrust::make_constant_iterator(d_pattern);
 
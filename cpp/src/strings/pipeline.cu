@@ -0,0 +1,447 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/strings/detail/char_tables.hpp>
+#include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/detail/utf8.hpp>
+#include <cudf/strings/pipeline.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/optional.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+
+transform_pipeline& transform_pipeline::add_step(step&& new_step)
+{
+  CUDF_EXPECTS(static_cast<size_type>(_steps.size()) < max_steps,
+               "Too many operations in the pipeline");
+  _steps.emplace_back(std::move(new_step));
+  return *this;
+}
+
+transform_pipeline& transform_pipeline::to_lower()
+{
+  return add_step(step{step_kind::LOWER, side_type::BOTH, {}, {}, {}});
+}
+
+transform_pipeline& transform_pipeline::to_upper()
+{
+  return add_step(step{step_kind::UPPER, side_type::BOTH, {}, {}, {}});
+}
+
+transform_pipeline& transform_pipeline::strip(side_type side, std::string to_strip)
+{
+  return add_step(step{step_kind::STRIP, side, std::move(to_strip), {}, {}});
+}
+
+transform_pipeline& transform_pipeline::replace(std::vector<std::string> targets,
+                                                std::vector<std::string> repls)
+{
+  CUDF_EXPECTS(!targets.empty(), "Parameters targets must not be empty");
+  CUDF_EXPECTS(std::none_of(targets.begin(), targets.end(), [](auto& t) { return t.empty(); }),
+               "Parameters targets must not contain empty strings");
+  CUDF_EXPECTS(repls.size() == 1 || repls.size() == targets.size(),
+               "Sizes for targets and repls must match");
+  return add_step(
+    step{step_kind::REPLACE, side_type::BOTH, {}, std::move(targets), std::move(repls)});
+}
+
+std::vector<transform_pipeline::step> const& transform_pipeline::steps() const { return _steps; }
+
+namespace detail {
+namespace {
+
+using step_kind = transform_pipeline::step_kind;
+
+/**
+ * @brief Operation of a pipeline in device memory
+ *
+ * The strings of the operation are referenced by their position in the
+ * `pipeline_context::d_views` array. The replacements follow the targets.
+ */
+struct device_step {
+  step_kind kind;
+  side_type side;
+  size_type first;        // strip characters or first target
+  size_type count;        // number of targets
+  size_type repls_count;  // number of replacements
+};
+
+/**
+ * @brief Data shared by all the rows for evaluating a pipeline
+ */
+struct pipeline_context {
+  device_step const* d_steps;
+  string_view const* d_views;
+  character_flags_table_type const* d_flags;
+  character_cases_table_type const* d_cases;
+  special_case_mapping const* d_special;
+};
+
+/**
+ * @brief Progress of a single operation within a string
+ *
+ * Stage 0 is the input string and stage `i` produces the characters of the
+ * operation `i-1`. Each stage pulls its characters from the previous stage
+ * so the state of a stage and its predecessors can be copied to look ahead.
+ */
+struct stage_state {
+  size_type position{};      // byte position in the input string or replacement
+  size_type repl_index{-1};  // replacement being produced
+  size_type safe_count{};    // characters known not to be trailing strip characters
+  bool started{};            // leading strip characters were removed
+  bool finished{};           // only trailing strip characters remain
+  int8_t buffer_size{};      // number of converted characters
+  int8_t buffer_index{};     // next converted character to produce
+  char_utf8 buffer[3];       // converted characters of a special case mapping
+};
+
+template <int Stage>
+__device__ thrust::optional<char_utf8> next_char(pipeline_context const& ctx,
+                                                 string_view const d_str,
+                                                 stage_state* states);
+
+template <>
+__device__ thrust::optional<char_utf8> next_char<0>(pipeline_context const&,
+                                                    string_view const d_str,
+                                                    stage_state* states)
+{
+  auto& state = states[0];
+  if (state.position >= d_str.size_bytes()) { return thrust::nullopt; }
+  char_utf8 chr = 0;
+  state.position += to_char_utf8(d_str.data() + state.position, chr);
+  return chr;
+}
+
+template <int Stage>
+__device__ void copy_states(stage_state const* src, stage_state* dst)
+{
+  for (int idx = 0; idx < Stage; ++idx) {
+    dst[idx] = src[idx];
+  }
+}
+
+/**
+ * @brief Produces the next character of a case conversion
+ *
+ * This matches the logic of `to_lower` and `to_upper` including the
+ * special case mappings that produce more than one character.
+ */
+template <int Stage>
+__device__ thrust::optional<char_utf8> next_case_char(pipeline_context const& ctx,
+                                                      device_step const& step,
+                                                      string_view const d_str,
+                                                      stage_state* states)
+{
+  auto& state          = states[Stage];
+  auto const case_flag = step.kind == step_kind::LOWER ? IS_UPPER(0xFF) : IS_LOWER(0xFF);
+  while (state.buffer_index >= state.buffer_size) {
+    auto const chr = next_char<Stage - 1>(ctx, d_str, states);
+    if (!chr) { return chr; }
+    auto const code_point = utf8_to_codepoint(*chr);
+    character_flags_table_type const flag = code_point <= 0x00'FFFF ? ctx.d_flags[code_point] : 0;
+    if (!IS_SPECIAL(flag) || (!(flag & case_flag) && IS_UPPER_OR_LOWER(flag))) {
+      return (flag & case_flag) ? codepoint_to_utf8(ctx.d_cases[code_point]) : *chr;
+    }
+    auto const mapping = ctx.d_special[get_special_case_hash_index(code_point)];
+    auto const count   = IS_LOWER(case_flag) ? mapping.num_upper_chars : mapping.num_lower_chars;
+    auto const* chars  = IS_LOWER(case_flag) ? mapping.upper : mapping.lower;
+    for (uint16_t idx = 0; idx < count; ++idx) {
+      state.buffer[idx] = codepoint_to_utf8(chars[idx]);
+    }
+    state.buffer_size  = static_cast<int8_t>(count);
+    state.buffer_index = 0;
+  }
+  return state.buffer[state.buffer_index++];
+}
+
+/**
+ * @brief Produces the next character of a strip operation
+ *
+ * When a strip character is found while stripping the end of the string, the
+ * previous stages are copied to look ahead for a character that is kept.
+ * The characters of the run are then produced without looking ahead again.
+ */
+template <int Stage>
+__device__ thrust::optional<char_utf8> next_strip_char(pipeline_context const& ctx,
+                                                       device_step const& step,
+                                                       string_view const d_str,
+                                                       stage_state* states)
+{
+  auto& state = states[Stage];
+  if (state.finished) { return thrust::nullopt; }
+
+  auto const d_to_strip         = ctx.d_views[step.first];
+  auto const is_strip_character = [d_to_strip](char_utf8 chr) -> bool {
+    if (d_to_strip.empty()) return chr <= ' ';  // whitespace check
+    for (auto c : d_to_strip) {
+      if (c == chr) return true;
+    }
+    return false;
+  };
+  auto const left  = step.side == side_type::LEFT || step.side == side_type::BOTH;
+  auto const right = step.side == side_type::RIGHT || step.side == side_type::BOTH;
+
+  while (true) {
+    auto const chr = next_char<Stage - 1>(ctx, d_str, states);
+    if (!chr) { return chr; }
+    if (left && !state.started) {
+      if (is_strip_character(*chr)) { continue; }
+      state.started = true;
+      return chr;
+    }
+    if (!right || !is_strip_character(*chr)) { return chr; }
+    if (state.safe_count > 0) {
+      --state.safe_count;
+      return chr;
+    }
+    // count the strip characters that follow unless they end the string
+    stage_state lookahead[Stage];
+    copy_states<Stage>(states, lookahead);
+    size_type count = 0;
+    while (true) {
+      auto const ahead = next_char<Stage - 1>(ctx, d_str, lookahead);
+      if (!ahead) {
+        state.finished = true;
+        return thrust::nullopt;
+      }
+      if (!is_strip_character(*ahead)) { break; }
+      ++count;
+    }
+    state.safe_count = count;
+    return chr;
+  }
+}
+
+/**
+ * @brief Produces the next character of a replace operation
+ *
+ * The targets are compared with the upcoming characters of the previous
+ * stage using a copy of the previous stages so only targets matching the
+ * first character require looking further ahead.
+ */
+template <int Stage>
+__device__ thrust::optional<char_utf8> next_replace_char(pipeline_context const& ctx,
+                                                         device_step const& step,
+                                                         string_view const d_str,
+                                                         stage_state* states)
+{
+  auto& state = states[Stage];
+  while (true) {
+    if (state.repl_index >= 0) {
+      auto const d_repl = ctx.d_views[state.repl_index];
+      if (state.position < d_repl.size_bytes()) {
+        char_utf8 chr = 0;
+        state.position += to_char_utf8(d_repl.data() + state.position, chr);
+        return chr;
+      }
+      state.repl_index = -1;
+    }
+
+    stage_state next[Stage];
+    copy_states<Stage>(states, next);
+    auto const chr = next_char<Stage - 1>(ctx, d_str, next);
+    if (!chr) { return chr; }
+
+    bool matched = false;
+    for (size_type tgt_idx = 0; (tgt_idx < step.count) && !matched; ++tgt_idx) {
+      auto const d_tgt  = ctx.d_views[step.first + tgt_idx];
+      char_utf8 tgt_chr = 0;
+      size_type tgt_pos = to_char_utf8(d_tgt.data(), tgt_chr);
+      if (tgt_chr != *chr) { continue; }
+      stage_state lookahead[Stage];
+      copy_states<Stage>(next, lookahead);
+      matched = true;
+      while (matched && (tgt_pos < d_tgt.size_bytes())) {
+        auto const ahead = next_char<Stage - 1>(ctx, d_str, lookahead);
+        tgt_pos += to_char_utf8(d_tgt.data() + tgt_pos, tgt_chr);
+        matched = ahead.has_value() && (*ahead == tgt_chr);
+      }
+      if (matched) {
+        copy_states<Stage>(lookahead, states);
+        state.repl_index = step.first + step.count + (step.repls_count == 1 ? 0 : tgt_idx);
+        state.position   = 0;
+      }
+    }
+    if (!matched) {
+      copy_states<Stage>(next, states);
+      return chr;
+    }
+  }
+}
+
+template <int Stage>
+__device__ thrust::optional<char_utf8> next_char(pipeline_context const& ctx,
+                                                 string_view const d_str,
+                                                 stage_state* states)
+{
+  auto const& step = ctx.d_steps[Stage - 1];
+  switch (step.kind) {
+    case step_kind::STRIP: return next_strip_char<Stage>(ctx, step, d_str, states);
+    case step_kind::REPLACE: return next_replace_char<Stage>(ctx, step, d_str, states);
+    default: return next_case_char<Stage>(ctx, step, d_str, states);
+  }
+}
+
+/**
+ * @brief Applies the pipeline to each string
+ *
+ * This can be used in calls to make_strings_children.
+ */
+struct pipeline_fn {
+  column_device_view const d_strings;
+  pipeline_context const ctx;
+  size_type const steps_count;
+  size_type* d_sizes{};
+  char* d_chars{};
+  cudf::detail::input_offsetalator d_offsets;
+
+  template <int Stages>
+  __device__ size_type process_string(string_view const d_str, char* d_output) const
+  {
+    stage_state states[Stages + 1]{};
+    size_type bytes = 0;
+    while (true) {
+      auto const chr = next_char<Stages>(ctx, d_str, states);
+      if (!chr) { break; }
+      if (d_output) {
+        d_output += from_char_utf8(*chr, d_output);
+      } else {
+        bytes += bytes_in_char_utf8(*chr);
+      }
+    }
+    return bytes;
+  }
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) {
+      if (!d_chars) { d_sizes[idx] = 0; }
+      return;
+    }
+    auto const d_str    = d_strings.element<string_view>(idx);
+    auto const d_output = d_chars ? d_chars + d_offsets[idx] : nullptr;
+    auto const bytes    = [&] {
+      switch (steps_count) {
+        case 1: return process_string<1>(d_str, d_output);
+        case 2: return process_string<2>(d_str, d_output);
+        case 3: return process_string<3>(d_str, d_output);
+        case 4: return process_string<4>(d_str, d_output);
+        case 5: return process_string<5>(d_str, d_output);
+        case 6: return process_string<6>(d_str, d_output);
+        case 7: return process_string<7>(d_str, d_output);
+        default: return process_string<8>(d_str, d_output);
+      }
+    }();
+    if (!d_chars) { d_sizes[idx] = bytes; }
+  }
+};
+
+static_assert(transform_pipeline::max_steps == 8, "pipeline_fn handles up to 8 operations");
+
+}  // namespace
+
+std::unique_ptr<column> apply_pipeline(strings_column_view const& input,
+                                       transform_pipeline const& pipeline,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  auto const& steps = pipeline.steps();
+  if (input.size() == input.null_count() || steps.empty()) {
+    return std::make_unique<column>(input.parent(), stream, mr);
+  }
+
+  // gather the strings of all the operations into a single device buffer
+  std::string h_pool;
+  std::vector<std::pair<size_type, size_type>> h_positions;
+  auto add_string = [&](std::string const& str) {
+    h_positions.emplace_back(static_cast<size_type>(h_pool.size()),
+                             static_cast<size_type>(str.size()));
+    h_pool.append(str);
+  };
+  std::vector<device_step> h_steps;
+  for (auto const& s : steps) {
+    auto const first = static_cast<size_type>(h_positions.size());
+    h_steps.push_back(device_step{s.kind,
+                                  s.side,
+                                  first,
+                                  static_cast<size_type>(s.targets.size()),
+                                  static_cast<size_type>(s.repls.size())});
+    if (s.kind == step_kind::STRIP) { add_string(s.to_strip); }
+    std::for_each(s.targets.begin(), s.targets.end(), add_string);
+    std::for_each(s.repls.begin(), s.repls.end(), add_string);
+  }
+
+  auto const d_pool = cudf::detail::make_device_uvector_async(
+    host_span<char const>(h_pool.data(), h_pool.size()),
+    stream,
+    rmm::mr::get_current_device_resource());
+  std::vector<string_view> h_views;
+  for (auto const& [offset, size] : h_positions) {
+    h_views.emplace_back(d_pool.data() + offset, size);
+  }
+  auto const d_views = cudf::detail::make_device_uvector_async(
+    h_views, stream, rmm::mr::get_current_device_resource());
+  auto const d_steps = cudf::detail::make_device_uvector_async(
+    h_steps, stream, rmm::mr::get_current_device_resource());
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const ctx       = pipeline_context{d_steps.data(),
+                                          d_views.data(),
+                                          get_character_flags_table(),
+                                          get_character_cases_table(),
+                                          get_special_case_mapping_table()};
+
+  auto [offsets, chars] = make_strings_children(
+    pipeline_fn{*d_strings, ctx, static_cast<size_type>(steps.size())}, input.size(), stream, mr);
+
+  return make_strings_column(input.size(),
+                             std::move(offsets),
+                             chars.release(),
+                             input.null_count(),
+                             cudf::detail::copy_bitmask(input.parent(), stream, mr));
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> apply_pipeline(strings_column_view const& input,
+                                       transform_pipeline const& pipeline,
+                                       rmm::cuda_stream_view stream,
+                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::apply_pipeline(input, pipeline, stream, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
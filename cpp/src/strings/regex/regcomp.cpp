@@ -145,6 +145,8 @@ int32_t const* reprog::starts_data() const { return _startinst_ids.data(); }
 
 int32_t reprog::starts_count() const { return static_cast<int>(_startinst_ids.size()); }
 
+std::string const& reprog::prefilter_literal() const { return _prefilter; }
+
 static constexpr auto MAX_REGEX_CHAR = std::numeric_limits<char32_t>::max();
 
 /**
@@ -1031,7 +1033,11 @@ reprog reprog::create_from(std::string_view pattern,
 
 void reprog::optimize() { collapse_nops(); }
 
-void reprog::finalize() { build_start_ids(); }
+void reprog::finalize()
+{
+  build_start_ids();
+  build_prefilter();
+}
 
 void reprog::collapse_nops()
 {
@@ -1106,6 +1112,75 @@ void reprog::build_start_ids()
   _startinst_ids.push_back(-1);  // terminator mark
 }
 
+/**
+ * @brief Find the longest literal that must appear in every match of the pattern
+ *
+ * A CHAR instruction is required if the END instruction cannot be reached from the
+ * start instruction without going through it. The literal is made of a required CHAR
+ * and the CHAR instructions that necessarily follow it: those reached through
+ * instructions that consume no character and have a single next instruction.
+ *
+ * For example, `user_id=(\d+)` requires `user_id=` and `ERROR.*timeout` requires
+ * both `ERROR` and `timeout` of which `timeout` is kept.
+ */
+void reprog::build_prefilter()
+{
+  _prefilter.clear();
+  // the check below is quadratic in the number of instructions
+  constexpr int32_t max_prefilter_insts    = 1024;
+  constexpr std::size_t max_prefilter_size = 64;
+  if (insts_count() > max_prefilter_insts) { return; }
+
+  // only characters that round-trip through UTF-8 can be searched for as bytes
+  auto const to_utf8 = [](char32_t const chr) {
+    std::string result(4, 0);
+    auto const width = from_char_utf8(chr, result.data());
+    result.resize(width);
+    char_utf8 decoded = 0;
+    return (chr != 0 && to_char_utf8(result.data(), decoded) == width && decoded == chr)
+             ? result
+             : std::string{};
+  };
+
+  // returns true if END can be reached from the start without visiting `skip_id`
+  std::vector<bool> visited(insts_count());
+  auto const is_end_reachable = [&](int32_t const skip_id) {
+    std::fill(visited.begin(), visited.end(), false);
+    std::stack<int32_t> ids;
+    ids.push(_startinst_id);
+    while (!ids.empty()) {
+      auto const id = ids.top();
+      ids.pop();
+      if ((id == skip_id) || visited[id]) { continue; }
+      visited[id]      = true;
+      auto const& inst = _insts[id];
+      if (inst.type == END) { return true; }
+      if (inst.type == OR) { ids.push(inst.u1.right_id); }
+      ids.push(inst.u2.next_id);
+    }
+    return false;
+  };
+
+  for (int32_t id = 0; id < insts_count(); ++id) {
+    if ((_insts[id].type != CHAR) || is_end_reachable(id)) { continue; }
+    std::string literal;
+    auto next_id = id;
+    for (auto steps = 0; steps < insts_count() && literal.size() < max_prefilter_size; ++steps) {
+      auto const& inst = _insts[next_id];
+      if (inst.type == CHAR) {
+        auto const bytes = to_utf8(inst.u1.c);
+        if (bytes.empty()) { break; }
+        literal.append(bytes);
+      } else if (inst.type != LBRA && inst.type != RBRA && inst.type != BOL && inst.type != EOL &&
+                 inst.type != BOW && inst.type != NBOW) {
+        break;
+      }
+      next_id = inst.u2.next_id;
+    }
+    if (literal.size() > _prefilter.size()) { _prefilter = std::move(literal); }
+  }
+}
+
 /**
  * @brief Check a specific instruction for errors.
  *
@@ -0,0 +1,343 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "strings/regex/regdfa.h"
+
+#include "strings/char_types/char_flags.h"
+#include "strings/regex/regcomp.h"
+#include "strings/regex/regex_dfa.cuh"
+
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/strings/detail/char_tables.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <queue>
+#include <stack>
+#include <utility>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+namespace {
+
+// Bits describing the position of the automaton in the string
+constexpr uint8_t ANCHORED      = 1 << 0;  // start instructions are only activated at the beginning
+constexpr uint8_t AT_BEGIN      = 1 << 1;  // no character has been read
+constexpr uint8_t PREV_NEW_LINE = 1 << 2;  // the previous character is a new-line
+constexpr uint8_t PREV_WORD     = 1 << 3;  // the previous character is a word character
+
+/**
+ * @brief The input read by a transition: a character or the end of the string
+ */
+struct dfa_symbol {
+  char32_t chr{};
+  bool is_last{};  // the character is the last one of the string
+  bool is_end{};   // the end of the string, after the last character
+};
+
+bool is_word_character(char32_t const chr)
+{
+  return (chr == '_') || IS_ALPHANUM(g_character_codepoint_flags[chr]);
+}
+
+/**
+ * @brief Host version of `reclass_device::is_match` for ASCII characters
+ */
+bool is_class_match(reclass const& cls, char32_t const chr)
+{
+  auto const in_literals = std::any_of(cls.literals.begin(), cls.literals.end(), [chr](auto r) {
+    return (chr >= r.first) && (chr <= r.last);
+  });
+  if (in_literals) { return true; }
+
+  auto const fl = g_character_codepoint_flags[chr];
+  return ((cls.builtins & CCLASS_W) && is_word_character(chr)) ||
+         ((cls.builtins & CCLASS_S) && IS_SPACE(fl)) ||
+         ((cls.builtins & CCLASS_D) && IS_DIGIT(fl)) ||
+         ((cls.builtins & NCCLASS_W) && (chr != '\n') && !is_word_character(chr)) ||
+         ((cls.builtins & NCCLASS_S) && !IS_SPACE(fl)) ||
+         ((cls.builtins & NCCLASS_D) && (chr != '\n') && !IS_DIGIT(fl));
+}
+
+class dfa_builder {
+ public:
+  explicit dfa_builder(reprog const& prog) : _prog(prog), _insts(prog.insts_data())
+  {
+    for (auto ids = prog.starts_data(); *ids >= 0; ++ids) {
+      _start_ids.push_back(*ids);
+    }
+    for (int32_t id = 0; id < prog.insts_count(); ++id) {
+      auto const& inst = _insts[id];
+      if (inst.type == BOL && inst.u1.c == '^') { _track_new_line = true; }
+      if (inst.type == BOW || inst.type == NBOW) { _track_word = true; }
+      if (is_consuming(inst.type)) { _consuming_ids.push_back(id); }
+    }
+  }
+
+  /**
+   * @brief Returns true if every instruction of the program can be evaluated by the automaton
+   */
+  [[nodiscard]] bool is_supported() const
+  {
+    if (_prog.insts_count() == 0) { return false; }
+    return std::all_of(_insts, _insts + _prog.insts_count(), [](auto const& inst) {
+      switch (inst.type) {
+        case CHAR:
+        case RBRA:
+        case LBRA:
+        case OR:
+        case ANY:
+        case ANYNL:
+        case BOL:
+        case EOL:
+        case CCLASS:
+        case NCCLASS:
+        case BOW:
+        case NBOW:
+        case END: return true;
+        default: return false;
+      }
+    });
+  }
+
+  /**
+   * @brief Groups the ASCII characters that every instruction treats the same way
+   *
+   * @return The class of each character and the representative character of each class
+   */
+  [[nodiscard]] std::pair<std::vector<uint8_t>, std::vector<dfa_symbol>> build_classes() const
+  {
+    std::vector<uint8_t> char_classes(DFA_CLASS_MAP_SIZE);
+    std::vector<dfa_symbol> symbols;
+    std::map<std::vector<bool>, uint8_t> signatures;
+    for (char32_t chr = 0; chr < DFA_ASCII_COUNT; ++chr) {
+      std::vector<bool> signature;
+      signature.push_back(chr == '\n');
+      signature.push_back(is_word_character(chr));
+      for (auto const id : _consuming_ids) {
+        signature.push_back(is_inst_match(_insts[id], chr));
+      }
+      auto const [itr, inserted] =
+        signatures.emplace(std::move(signature), static_cast<uint8_t>(symbols.size()));
+      if (inserted) { symbols.push_back(dfa_symbol{chr, false, false}); }
+      char_classes[chr] = itr->second;
+    }
+    char_classes[DFA_NEWLINE_LAST] = static_cast<uint8_t>(symbols.size());
+    symbols.push_back(dfa_symbol{'\n', true, false});
+    char_classes[DFA_END_OF_STRING] = static_cast<uint8_t>(symbols.size());
+    symbols.push_back(dfa_symbol{0, false, true});
+    return {std::move(char_classes), std::move(symbols)};
+  }
+
+  /**
+   * @brief Computes the state reached from the given state by reading the given symbol
+   *
+   * @return The active instructions and the position bits of the next state,
+   *         or nothing if the next state is the accept or the reject state
+   */
+  [[nodiscard]] std::pair<int32_t, std::pair<std::vector<int32_t>, uint8_t>> next_state(
+    std::vector<int32_t> const& ids, uint8_t const bits, dfa_symbol const symbol) const
+  {
+    // activate the start instructions as regexec does at each position
+    auto active = ids;
+    if (!(bits & ANCHORED) || (bits & AT_BEGIN)) {
+      active.insert(active.end(), _start_ids.begin(), _start_ids.end());
+    }
+
+    // expand the non-character instructions for the current position
+    std::vector<bool> visited(_prog.insts_count(), false);
+    std::stack<int32_t> pending;
+    for (auto const id : active) {
+      pending.push(id);
+    }
+    std::vector<int32_t> next_ids;
+    while (!pending.empty()) {
+      auto const id = pending.top();
+      pending.pop();
+      if (visited[id]) { continue; }
+      visited[id]      = true;
+      auto const& inst = _insts[id];
+      switch (inst.type) {
+        case END: return {DFA_ACCEPT_STATE, {}};
+        case LBRA:
+        case RBRA: pending.push(inst.u2.next_id); break;
+        case OR:
+          pending.push(inst.u1.right_id);
+          pending.push(inst.u2.left_id);
+          break;
+        case BOL:
+          if ((bits & AT_BEGIN) || ((inst.u1.c == '^') && (bits & PREV_NEW_LINE))) {
+            pending.push(inst.u2.next_id);
+          }
+          break;
+        case EOL:
+          if (symbol.is_end || ((symbol.chr == '\n') && (inst.u1.c != 'Z') &&
+                                ((inst.u1.c == '$') || symbol.is_last))) {
+            pending.push(inst.u2.next_id);
+          }
+          break;
+        case BOW:
+        case NBOW: {
+          bool const curr_is_word = !symbol.is_end && is_word_character(symbol.chr);
+          bool const prev_is_word = bits & PREV_WORD;
+          if ((curr_is_word == prev_is_word) != (inst.type == BOW)) {
+            pending.push(inst.u2.next_id);
+          }
+          break;
+        }
+        default:
+          if (!symbol.is_end && is_inst_match(inst, symbol.chr)) {
+            next_ids.push_back(inst.u2.next_id);
+          }
+          break;
+      }
+    }
+    if (symbol.is_end) { return {DFA_REJECT_STATE, {}}; }
+    if ((bits & ANCHORED) && next_ids.empty()) { return {DFA_REJECT_STATE, {}}; }
+
+    std::sort(next_ids.begin(), next_ids.end());
+    next_ids.erase(std::unique(next_ids.begin(), next_ids.end()), next_ids.end());
+    uint8_t const next_bits = (bits & ANCHORED) |
+                              ((_track_new_line && symbol.chr == '\n') ? PREV_NEW_LINE : 0) |
+                              ((_track_word && is_word_character(symbol.chr)) ? PREV_WORD : 0);
+    return {-1, {std::move(next_ids), next_bits}};
+  }
+
+ private:
+  reprog const& _prog;
+  reinst const* _insts;
+  std::vector<int32_t> _start_ids;
+  std::vector<int32_t> _consuming_ids;
+  bool _track_new_line{false};
+  bool _track_word{false};
+
+  static bool is_consuming(int32_t type)
+  {
+    return type == CHAR || type == ANY || type == ANYNL || type == CCLASS || type == NCCLASS;
+  }
+
+  [[nodiscard]] bool is_inst_match(reinst const& inst, char32_t const chr) const
+  {
+    switch (inst.type) {
+      case CHAR: return inst.u1.c == chr;
+      case ANY: return chr != '\n';
+      case ANYNL: return true;
+      case CCLASS:
+      case NCCLASS:
+        return is_class_match(_prog.class_at(inst.u1.cls_id), chr) == (inst.type == CCLASS);
+      default: return false;
+    }
+  }
+};
+
+}  // namespace
+
+std::optional<redfa> redfa::create_from(reprog const& prog)
+{
+  dfa_builder builder(prog);
+  if (!builder.is_supported()) { return std::nullopt; }
+
+  redfa dfa;
+  auto [char_classes, symbols] = builder.build_classes();
+  dfa._char_classes            = std::move(char_classes);
+  dfa._classes_count           = static_cast<int32_t>(symbols.size());
+
+  // the accept and the reject states only lead to themselves
+  dfa._transitions.resize(2 * dfa._classes_count);
+  std::fill_n(dfa._transitions.begin(), dfa._classes_count, DFA_ACCEPT_STATE);
+  std::fill_n(dfa._transitions.begin() + dfa._classes_count, dfa._classes_count, DFA_REJECT_STATE);
+
+  // build the states reachable from the start states in breadth-first order
+  using state_key = std::pair<std::vector<int32_t>, uint8_t>;
+  std::map<state_key, int32_t> state_ids;
+  std::queue<state_key> pending;
+  auto const get_state_id = [&](state_key&& key) {
+    auto const [itr, inserted] =
+      state_ids.emplace(std::move(key), static_cast<int32_t>(state_ids.size()) + 2);
+    if (inserted) { pending.push(itr->first); }
+    return itr->second;
+  };
+  dfa._start_states[0] = get_state_id({{}, AT_BEGIN});
+  dfa._start_states[1] = get_state_id({{}, ANCHORED | AT_BEGIN});
+
+  while (!pending.empty()) {
+    if (static_cast<int32_t>(state_ids.size()) + 2 > DFA_MAX_STATES) { return std::nullopt; }
+    auto const [ids, bits] = pending.front();
+    std::vector<uint16_t> row(dfa._classes_count);
+    for (int32_t cls = 0; cls < dfa._classes_count; ++cls) {
+      auto [state, key] = builder.next_state(ids, bits, symbols[cls]);
+      row[cls]          = static_cast<uint16_t>(state >= 0 ? state : get_state_id(std::move(key)));
+    }
+    dfa._transitions.insert(dfa._transitions.end(), row.begin(), row.end());
+    pending.pop();
+  }
+  return dfa;
+}
+
+// Copy redfa primitive values
+dfa_device::dfa_device(redfa const& dfa)
+  : _classes_count{dfa.classes_count()},
+    _start_states{dfa.start_state(false), dfa.start_state(true)}
+{
+}
+
+std::unique_ptr<dfa_device, std::function<void(dfa_device*)>> dfa_device::create(
+  redfa const& h_dfa, rmm::cuda_stream_view stream)
+{
+  // the transitions are followed by the character classes in one buffer
+  auto const transitions_size =
+    static_cast<std::size_t>(h_dfa.states_count()) * h_dfa.classes_count() * sizeof(uint16_t);
+  auto const memsize = cudf::util::round_up_safe(transitions_size + DFA_CLASS_MAP_SIZE,
+                                                 sizeof(uint32_t));
+
+  std::vector<uint8_t> h_buffer(memsize);
+  std::memcpy(h_buffer.data(), h_dfa.transitions_data(), transitions_size);
+  std::memcpy(h_buffer.data() + transitions_size, h_dfa.classes_data(), DFA_CLASS_MAP_SIZE);
+
+  auto d_buffer = new rmm::device_buffer(memsize, stream);
+  auto d_ptr    = static_cast<uint8_t*>(d_buffer->data());
+
+  dfa_device* d_dfa     = new dfa_device(h_dfa);
+  d_dfa->_transitions    = reinterpret_cast<uint16_t const*>(d_ptr);
+  d_dfa->_char_classes   = d_ptr + transitions_size;
+  d_dfa->_classes_offset = transitions_size;
+  d_dfa->_size           = memsize;
+
+  CUDF_CUDA_TRY(
+    cudaMemcpyAsync(d_buffer->data(), h_buffer.data(), memsize, cudaMemcpyDefault, stream.value()));
+  // the host buffer is released on return
+  stream.synchronize();
+
+  // build deleter to cleanup device memory
+  auto deleter = [d_buffer](dfa_device* t) {
+    t->destroy();
+    delete d_buffer;
+  };
+
+  return std::unique_ptr<dfa_device, std::function<void(dfa_device*)>>(d_dfa, deleter);
+}
+
+void dfa_device::destroy() { delete this; }
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
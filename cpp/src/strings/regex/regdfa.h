@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+class reprog;
+
+constexpr int32_t DFA_MAX_STATES     = 1024;  ///< Patterns needing more states are not compiled
+constexpr int32_t DFA_ACCEPT_STATE   = 0;     ///< A match was found
+constexpr int32_t DFA_REJECT_STATE   = 1;     ///< No match can be found
+constexpr int32_t DFA_ASCII_COUNT    = 128;   ///< Characters with their own entry in the class map
+constexpr int32_t DFA_NEWLINE_LAST   = 128;   ///< Class map entry of a new-line ending the string
+constexpr int32_t DFA_END_OF_STRING  = 129;   ///< Class map entry of the end of the string
+constexpr int32_t DFA_CLASS_MAP_SIZE = 130;   ///< Number of entries in the class map
+
+/**
+ * @brief Deterministic automaton for evaluating whether a regex pattern matches a string.
+ *
+ * The automaton is built from the instructions of a `reprog` by subset construction and
+ * answers the same question as `reprog_device::find(...).has_value()` for strings made only
+ * of ASCII characters, in a single table lookup per character.
+ *
+ * The ASCII characters are mapped to classes of characters that no instruction distinguishes.
+ * A new-line that is the last character of a string and the end of the string have their own
+ * classes since the EOL instruction treats them differently.
+ *
+ * Each state corresponds to a set of active instructions together with what is known of the
+ * previous character. The matching is unanchored from one start state and anchored at the
+ * beginning of the string from the other.
+ */
+class redfa {
+ public:
+  /**
+   * @brief Builds the automaton of the given regex program
+   *
+   * @param prog Compiled regex program
+   * @return The automaton or nothing if it would need more than `DFA_MAX_STATES` states
+   */
+  static std::optional<redfa> create_from(reprog const& prog);
+
+  [[nodiscard]] int32_t classes_count() const { return _classes_count; }
+  [[nodiscard]] int32_t states_count() const
+  {
+    return static_cast<int32_t>(_transitions.size() / _classes_count);
+  }
+
+  /**
+   * @brief Returns the class of each ASCII character, of a final new-line and of the end of the
+   * string, `DFA_CLASS_MAP_SIZE` entries in all
+   */
+  [[nodiscard]] uint8_t const* classes_data() const { return _char_classes.data(); }
+
+  /**
+   * @brief Returns the next state of each state for each class, `classes_count()` per state
+   */
+  [[nodiscard]] uint16_t const* transitions_data() const { return _transitions.data(); }
+
+  /**
+   * @brief Returns the state to begin with
+   *
+   * @param anchored True to only match at the beginning of the string
+   */
+  [[nodiscard]] int32_t start_state(bool anchored) const { return _start_states[anchored]; }
+
+ private:
+  std::vector<uint8_t> _char_classes;
+  std::vector<uint16_t> _transitions;
+  int32_t _classes_count{};
+  int32_t _start_states[2]{};
+
+  redfa() = default;
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
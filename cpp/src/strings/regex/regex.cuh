@@ -222,6 +222,15 @@ class reprog_device {
     __device__ inline void swaplist();
   };
 
+  /**
+   * @brief Returns true if the prefilter literal is found in the string at or after `begin`.
+   *
+   * Strings without the literal cannot match the pattern and so the instructions
+   * do not need to be evaluated.
+   */
+  __device__ inline bool is_prefilter_match(string_view const d_str,
+                                            string_view::const_iterator begin) const;
+
   /**
    * @brief Returns the regex instruction object for a given id.
    */
@@ -258,11 +267,13 @@ class reprog_device {
   int32_t _starts_count;          // number of start-insts ids
   int32_t _classes_count;         // number of classes
   int32_t _max_insts;             // for partitioning working memory
+  int32_t _prefilter_size;        // number of bytes in the prefilter literal
 
   uint8_t const* _codepoint_flags{};  // table of character types
   reinst const* _insts{};             // array of regex instructions
   int32_t const* _startinst_ids{};    // array of start instruction ids
   reclass_device const* _classes{};   // array of regex classes
+  char const* _prefilter{};           // literal required by every match
 
   std::size_t _prog_size{};  // total size of this instance
   void* _buffer{};           // working memory buffer
@@ -209,6 +209,12 @@ __device__ __forceinline__ void reprog_device::store(void* buffer) const
     for (int jdx = 0; jdx < _classes[idx].count; ++jdx)
       *d_ptr++ = _classes[idx].literals[jdx];
   }
+
+  // add the prefilter literal
+  auto prefilter     = reinterpret_cast<char*>(d_ptr);
+  result->_prefilter = prefilter;
+  for (int idx = 0; idx < _prefilter_size; ++idx)
+    prefilter[idx] = _prefilter[idx];
 }
 
 __device__ __forceinline__ reprog_device reprog_device::load(reprog_device const prog, void* buffer)
@@ -400,11 +406,29 @@ __device__ __forceinline__ match_result reprog_device::regexec(string_view const
   return match ? match_result({begin, end}) : thrust::nullopt;
 }
 
+__device__ __forceinline__ bool reprog_device::is_prefilter_match(
+  string_view const d_str, string_view::const_iterator begin) const
+{
+  if (_prefilter_size == 0) { return true; }
+  auto const data = d_str.data();
+  auto const last = d_str.size_bytes() - _prefilter_size;
+  for (auto pos = begin.byte_offset(); pos <= last; ++pos) {
+    if (data[pos] != _prefilter[0]) { continue; }
+    auto idx = 1;
+    while (idx < _prefilter_size && data[pos + idx] == _prefilter[idx]) {
+      ++idx;
+    }
+    if (idx == _prefilter_size) { return true; }
+  }
+  return false;
+}
+
 __device__ __forceinline__ match_result reprog_device::find(int32_t const thread_idx,
                                                             string_view const dstr,
                                                             string_view::const_iterator begin,
                                                             cudf::size_type end) const
 {
+  if (!is_prefilter_match(dstr, begin)) { return thrust::nullopt; }
   return call_regexec(thread_idx, dstr, begin, end);
 }
 
@@ -0,0 +1,153 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.  All rights reserved.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include "strings/regex/regdfa.h"
+
+#include <cudf/strings/string_view.cuh>
+#include <cudf/types.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+
+#include <cuda_runtime.h>
+#include <thrust/optional.h>
+
+#include <functional>
+#include <memory>
+
+namespace cudf {
+namespace strings {
+namespace detail {
+
+constexpr std::size_t MAX_DFA_SHARED_MEM = 16 * 1024;  ///< Memory size for storing the DFA tables
+
+/**
+ * @brief Regex automaton stored on the device.
+ *
+ * Evaluates whether a regex pattern matches a string with the tables of a `redfa`.
+ * No working memory is needed, and the tables are small enough to be loaded into
+ * shared memory in most cases.
+ */
+class dfa_device {
+ public:
+  dfa_device()                             = delete;
+  ~dfa_device()                            = default;
+  dfa_device(dfa_device const&)            = default;
+  dfa_device(dfa_device&&)                 = default;
+  dfa_device& operator=(dfa_device const&) = default;
+  dfa_device& operator=(dfa_device&&)      = default;
+
+  /**
+   * @brief Create device automaton instance from a host automaton
+   *
+   * @param dfa The automaton to create from
+   * @param stream CUDA stream used for device memory operations and kernel launches
+   * @return The automaton device object
+   */
+  static std::unique_ptr<dfa_device, std::function<void(dfa_device*)>> create(
+    redfa const& dfa, rmm::cuda_stream_view stream);
+
+  /**
+   * @brief Called automatically by the unique_ptr returned from create().
+   */
+  void destroy();
+
+  /**
+   * @brief Returns the size of shared memory required to hold the tables.
+   *
+   * This returns 0 if the MAX_DFA_SHARED_MEM value is exceeded.
+   */
+  [[nodiscard]] int32_t compute_shared_memory_size() const
+  {
+    return _size <= MAX_DFA_SHARED_MEM ? static_cast<int32_t>(_size) : 0;
+  }
+
+  /**
+   * @brief Store the tables into the given device buffer (e.g. shared memory).
+   *
+   * Each of the `num_threads` threads copies a part of the tables. No data is stored if
+   * MAX_DFA_SHARED_MEM is exceeded.
+   *
+   * @param buffer Device memory of at least `compute_shared_memory_size()` bytes
+   * @param thread_idx Index of the calling thread among the copying threads
+   * @param num_threads Number of copying threads
+   */
+  __device__ inline void store(void* buffer, int32_t thread_idx, int32_t num_threads) const
+  {
+    if (_size > MAX_DFA_SHARED_MEM) { return; }
+    auto const src = reinterpret_cast<uint32_t const*>(_transitions);
+    auto const dst = static_cast<uint32_t*>(buffer);
+    for (auto idx = static_cast<std::size_t>(thread_idx); idx < _size / sizeof(uint32_t);
+         idx += num_threads) {
+      dst[idx] = src[idx];
+    }
+  }
+
+  /**
+   * @brief Load an instance of this class from a device buffer (e.g. shared memory).
+   *
+   * The tables are used from the given buffer if MAX_DFA_SHARED_MEM is not exceeded.
+   * Otherwise, a copy of the object is returned.
+   */
+  [[nodiscard]] __device__ static inline dfa_device load(dfa_device const dfa, void* buffer)
+  {
+    if (dfa._size > MAX_DFA_SHARED_MEM) { return dfa; }
+    auto const tables    = static_cast<uint8_t const*>(buffer);
+    auto result          = dfa;
+    result._transitions  = reinterpret_cast<uint16_t const*>(tables);
+    result._char_classes = tables + dfa._classes_offset;
+    return result;
+  }
+
+  /**
+   * @brief Evaluates whether the pattern matches the given string.
+   *
+   * @param d_str The string to search
+   * @param anchored True to only match at the beginning of the string
+   * @return Whether a match is found or nothing if the string contains non-ASCII characters
+   *         before the result is known
+   */
+  __device__ inline thrust::optional<bool> is_match(string_view const d_str, bool anchored) const
+  {
+    auto const data = reinterpret_cast<uint8_t const*>(d_str.data());
+    auto const size = d_str.size_bytes();
+    int32_t state   = _start_states[anchored];
+    for (size_type idx = 0; idx < size; ++idx) {
+      auto const chr = data[idx];
+      if (chr >= DFA_ASCII_COUNT) { return thrust::nullopt; }
+      auto const cls = _char_classes[(chr == '\n' && idx + 1 == size) ? DFA_NEWLINE_LAST : chr];
+      state          = _transitions[state * _classes_count + cls];
+      if (state <= DFA_REJECT_STATE) { return state == DFA_ACCEPT_STATE; }
+    }
+    state = _transitions[state * _classes_count + _char_classes[DFA_END_OF_STRING]];
+    return state == DFA_ACCEPT_STATE;
+  }
+
+ private:
+  dfa_device(redfa const&);
+
+  int32_t _classes_count;    // number of character classes
+  int32_t _start_states[2];  // unanchored and anchored start states
+
+  uint16_t const* _transitions{};  // next state for each state and class
+  uint8_t const* _char_classes{};  // class of each ASCII character, final new-line, and end
+  std::size_t _classes_offset{};   // byte offset of the classes after the transitions
+  std::size_t _size{};             // total size of the tables
+};
+
+}  // namespace detail
+}  // namespace strings
+}  // namespace cudf
@@ -16,12 +16,18 @@
 #pragma once
 
 #include "regcomp.h"
+#include "regdfa.h"
 #include "regex.cuh"
+#include "regex_dfa.cuh"
 
 #include <cudf/strings/regex/regex_program.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <functional>
+#include <memory>
+#include <optional>
+
 namespace cudf {
 namespace strings {
 
@@ -32,9 +38,10 @@ namespace strings {
  */
 struct regex_program::regex_program_impl {
   detail::reprog prog;
+  std::optional<detail::redfa> dfa;  // only built for patterns the automaton supports
 
-  regex_program_impl(detail::reprog const& p) : prog(p) {}
-  regex_program_impl(detail::reprog&& p) : prog(p) {}
+  regex_program_impl(detail::reprog const& p) : prog(p), dfa(detail::redfa::create_from(prog)) {}
+  regex_program_impl(detail::reprog&& p) : prog(p), dfa(detail::redfa::create_from(prog)) {}
 
   // TODO: There will be other options added here in the future to handle issues
   // 10852 and possibly others like 11979
@@ -45,6 +52,16 @@ struct regex_device_builder {
   {
     return detail::reprog_device::create(p._impl->prog, stream);
   }
+
+  /**
+   * @brief Returns the device automaton of the program or null if it has none
+   */
+  static std::unique_ptr<detail::dfa_device, std::function<void(detail::dfa_device*)>>
+  create_dfa_device(regex_program const& p, rmm::cuda_stream_view stream)
+  {
+    if (!p._impl->dfa.has_value()) { return nullptr; }
+    return detail::dfa_device::create(p._impl->dfa.value(), stream);
+  }
 };
 
 }  // namespace strings
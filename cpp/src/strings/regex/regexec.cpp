@@ -40,6 +40,7 @@ reprog_device::reprog_device(reprog const& prog)
     _starts_count{prog.starts_count()},
     _classes_count{prog.classes_count()},
     _max_insts{prog.insts_count()},
+    _prefilter_size{static_cast<int32_t>(prog.prefilter_literal().size())},
     _codepoint_flags{get_character_flags_table()}
 {
 }
@@ -61,10 +62,11 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     classes_count * sizeof(_classes[0]),
     std::plus<std::size_t>{},
     [&h_prog](auto& cls) { return cls.literals.size() * sizeof(reclass_range); });
+  auto const prefilter_size = h_prog.prefilter_literal().size();
   // make sure each section is aligned for the subsequent section's data type
   auto const memsize = cudf::util::round_up_safe(insts_size, sizeof(_startinst_ids[0])) +
                        cudf::util::round_up_safe(startids_size, sizeof(_classes[0])) +
-                       cudf::util::round_up_safe(classes_size, sizeof(char32_t));
+                       cudf::util::round_up_safe(classes_size, sizeof(char32_t)) + prefilter_size;
 
   // allocate memory to store all the prog data in a flat contiguous buffer
   std::vector<u_char> h_buffer(memsize);                        // copy everything into here;
@@ -109,6 +111,10 @@ std::unique_ptr<reprog_device, std::function<void(reprog_device*)>> reprog_devic
     d_end += h_class.literals.size() * sizeof(reclass_range);
   }
 
+  // the prefilter literal follows the classes data
+  memcpy(h_end, h_prog.prefilter_literal().data(), prefilter_size);
+  d_prog->_prefilter = reinterpret_cast<char const*>(d_end);
+
   // initialize the rest of the elements
   d_prog->_max_insts = insts_count;
   d_prog->_prog_size = memsize + sizeof(reprog_device);
@@ -17,6 +17,7 @@
 #pragma once
 
 #include "strings/regex/regex.cuh"
+#include "strings/regex/regex_dfa.cuh"
 
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
@@ -111,6 +112,35 @@ void launch_transform_kernel(TransformFunction fn,
     fn, d_prog, d_output, size);
 }
 
+template <typename ForEachFunction>
+CUDF_KERNEL void dfa_for_each_kernel(ForEachFunction fn, dfa_device const d_dfa, size_type size)
+{
+  extern __shared__ u_char shmem[];
+  d_dfa.store(shmem, threadIdx.x, blockDim.x);
+  __syncthreads();
+  auto const s_dfa = dfa_device::load(d_dfa, shmem);
+
+  auto const idx = cudf::detail::grid_1d::global_thread_id();
+  if (idx < size) { fn(static_cast<size_type>(idx), s_dfa); }
+}
+
+/**
+ * @brief Calls `fn(idx, dfa)` for each row with the tables loaded into shared memory
+ *
+ * No working memory is required so each row is processed by its own thread.
+ */
+template <typename ForEachFunction>
+void launch_dfa_for_each_kernel(ForEachFunction fn,
+                                dfa_device const& d_dfa,
+                                size_type size,
+                                rmm::cuda_stream_view stream)
+{
+  auto const shmem_size = d_dfa.compute_shared_memory_size();
+  cudf::detail::grid_1d grid{size, regex_launch_kernel_block_size};
+  dfa_for_each_kernel<<<grid.num_blocks, grid.num_threads_per_block, shmem_size, stream.value()>>>(
+    fn, d_dfa, size);
+}
+
 template <typename SizeAndExecuteFunction>
 auto make_strings_children(SizeAndExecuteFunction size_and_exec_fn,
                            reprog_device& d_prog,
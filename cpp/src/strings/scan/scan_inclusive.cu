@@ -16,7 +16,7 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/utilities/device_operators.cuh>
@@ -28,7 +28,6 @@
 
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
-#include <thrust/scatter.h>
 
 namespace cudf {
 namespace strings {
@@ -72,9 +71,18 @@ struct min_max_scan_operator {
   }
 };
 
-struct null_iterator {
+/**
+ * @brief Maps each output row to the index of its scan result, or out of bounds if the output
+ * row is null so that the gather records it as null
+ */
+struct null_mapped_index {
+  size_type const* indices;
   bitmask_type const* mask;
-  __device__ bool operator()(size_type idx) const { return !bit_is_set(mask, idx); }
+  size_type size;
+  __device__ size_type operator()(size_type idx) const
+  {
+    return mask == nullptr || bit_is_set(mask, idx) ? indices[idx] : size;
+  }
 };
 
 }  // namespace
@@ -95,24 +103,14 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
                          result_map.begin(),
                          min_max_scan_operator<cudf::string_view, Op>{*d_input, input.has_nulls()});
 
-  if (input.has_nulls()) {
-    // fill the null rows with out-of-bounds values so gather records them as null;
-    // this prevents un-sanitized null entries in the output
-    auto null_itr = cudf::detail::make_counting_transform_iterator(0, null_iterator{mask});
-    auto oob_val  = thrust::constant_iterator<size_type>(input.size());
-    thrust::scatter_if(rmm::exec_policy(stream),
-                       oob_val,
-                       oob_val + input.size(),
-                       thrust::counting_iterator<size_type>(0),
-                       null_itr,
-                       result_map.data());
-  }
-
-  // call gather using the indices to build the output column
+  // null rows are mapped out of bounds while gathering rather than scattered into the map first;
+  // this prevents un-sanitized null entries in the output
+  auto const gather_map = cudf::detail::make_counting_transform_iterator(
+    0, null_mapped_index{result_map.data(), mask, input.size()});
   auto result_table = cudf::detail::gather(cudf::table_view({input}),
-                                           result_map,
+                                           gather_map,
+                                           gather_map + input.size(),
                                            cudf::out_of_bounds_policy::NULLIFY,
-                                           cudf::detail::negative_index_policy::NOT_ALLOWED,
                                            stream,
                                            mr);
   return std::move(result_table->release().front());
@@ -19,6 +19,7 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/utilities/autotune.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/scalar/scalar_factories.hpp>
 #include <cudf/strings/detail/utilities.hpp>
@@ -40,6 +41,8 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <string>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -186,21 +189,35 @@ void find_utility(strings_column_view const& input,
 {
   auto d_strings = column_device_view::create(input.parent(), stream);
   auto d_results = output.mutable_view().data<size_type>();
-  if ((input.chars_size(stream) / (input.size() - input.null_count())) > AVG_CHAR_BYTES_THRESHOLD) {
-    // warp-per-string runs faster for longer strings (but not shorter ones)
-    constexpr int block_size = 256;
-    cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
-    finder_warp_parallel_fn<TargetIterator, forward>
-      <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-        *d_strings, target_itr, start, stop, d_results);
-  } else {
-    // string-per-thread function
-    thrust::transform(rmm::exec_policy(stream),
-                      thrust::make_counting_iterator<size_type>(0),
-                      thrust::make_counting_iterator<size_type>(input.size()),
-                      d_results,
-                      finder_fn<TargetIterator, forward>{*d_strings, target_itr, start, stop});
+
+  auto const run_candidate = [&](std::size_t warp_parallel) {
+    if (warp_parallel == 1) {
+      // warp-per-string runs faster for longer strings (but not shorter ones)
+      constexpr int block_size = 256;
+      cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
+      finder_warp_parallel_fn<TargetIterator, forward>
+        <<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+          *d_strings, target_itr, start, stop, d_results);
+    } else {
+      // string-per-thread function
+      thrust::transform(rmm::exec_policy(stream),
+                        thrust::make_counting_iterator<size_type>(0),
+                        thrust::make_counting_iterator<size_type>(input.size()),
+                        d_results,
+                        finder_fn<TargetIterator, forward>{*d_strings, target_itr, start, stop});
+    }
+  };
+
+  auto const avg_bytes      = average_bytes_per_row(input, stream);
+  std::size_t warp_parallel = avg_bytes > AVG_CHAR_BYTES_THRESHOLD ? 1 : 0;
+  if (cudf::detail::is_autotuning_enabled()) {
+    // both candidates only overwrite the results, so the threshold can be tuned on the input
+    auto const key = std::string{"strings_find/"} + (forward ? "forward" : "reverse") + "/" +
+                     std::to_string(cudf::detail::autotune_bucket(avg_bytes)) + "/" +
+                     std::to_string(cudf::detail::autotune_bucket(input.size()));
+    warp_parallel = cudf::detail::autotuned_choice(key, 2, warp_parallel, run_candidate, stream);
   }
+  run_candidate(warp_parallel);
 }
 
 template <bool forward = true>
@@ -542,8 +559,7 @@ std::unique_ptr<column> contains(strings_column_view const& input,
                                  rmm::device_async_resource_ref mr)
 {
   // use warp parallel when the average string width is greater than the threshold
-  if ((input.null_count() < input.size()) &&
-      ((input.chars_size(stream) / input.size()) > AVG_CHAR_BYTES_THRESHOLD)) {
+  if (average_bytes_per_row(input, stream) > AVG_CHAR_BYTES_THRESHOLD) {
     return contains_warp_parallel(input, target, stream, mr);
   }
 
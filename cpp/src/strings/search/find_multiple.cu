@@ -16,8 +16,11 @@
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/find_multiple.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -26,12 +29,24 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/execution_policy.h>
+#include <thrust/extrema.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <limits>
+#include <map>
+#include <queue>
+#include <stdexcept>
+#include <vector>
+
 namespace cudf {
 namespace strings {
 namespace detail {
@@ -84,6 +99,230 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
                            mr);
 }
 
+namespace {
+
+constexpr size_type no_target = std::numeric_limits<size_type>::max();
+
+/**
+ * @brief Aho-Corasick automaton over the bytes of the targets
+ *
+ * Node 0 is the root. The children of each node are stored sorted by byte so each
+ * transition is a binary search. The failure link of a node points to the node of its
+ * longest proper suffix that is also a prefix of a target.
+ */
+struct targets_automaton_view {
+  size_type const* edge_offsets;  // first edge of each node
+  uint8_t const* edge_bytes;      // byte of each edge
+  size_type const* edge_nodes;    // child node of each edge
+  size_type const* failures;      // failure link of each node
+  size_type const* outputs;       // smallest target index ending at each node
+
+  [[nodiscard]] __device__ size_type next(size_type node, uint8_t const byte) const
+  {
+    while (true) {
+      auto const first = edge_bytes + edge_offsets[node];
+      auto const last  = edge_bytes + edge_offsets[node + 1];
+      auto const itr   = thrust::lower_bound(thrust::seq, first, last, byte);
+      if (itr != last && *itr == byte) { return edge_nodes[thrust::distance(edge_bytes, itr)]; }
+      if (node == 0) { return 0; }
+      node = failures[node];
+    }
+  }
+};
+
+class targets_automaton {
+ public:
+  targets_automaton(strings_column_view const& targets, rmm::cuda_stream_view stream)
+    : _edge_offsets(0, stream),
+      _edge_bytes(0, stream),
+      _edge_nodes(0, stream),
+      _failures(0, stream),
+      _outputs(0, stream)
+  {
+    auto const targets_count = targets.size();
+    auto const d_offsets =
+      cudf::detail::offsetalator_factory::make_input_iterator(targets.offsets(), targets.offset());
+    auto offsets = rmm::device_uvector<int64_t>(targets_count + 1, stream);
+    thrust::copy(
+      rmm::exec_policy_nosync(stream), d_offsets, d_offsets + targets_count + 1, offsets.begin());
+    auto const h_offsets   = cudf::detail::make_std_vector_sync(offsets, stream);
+    auto const chars_begin = h_offsets.front();
+    auto const chars_size  = h_offsets.back() - chars_begin;
+    CUDF_EXPECTS(chars_size < std::numeric_limits<size_type>::max(),
+                 "Size of the search targets exceeds the column size limit",
+                 std::overflow_error);
+    auto const h_chars = cudf::detail::make_std_vector_sync(
+      device_span<char const>(targets.chars_begin(stream) + chars_begin, chars_size), stream);
+
+    // build the trie of the targets
+    std::vector<std::map<uint8_t, size_type>> children(1);
+    std::vector<size_type> outputs(1, no_target);
+    for (size_type idx = 0; idx < targets_count; ++idx) {
+      size_type node = 0;
+      for (auto pos = h_offsets[idx]; pos < h_offsets[idx + 1]; ++pos) {
+        auto const byte = static_cast<uint8_t>(h_chars[pos - chars_begin]);
+        auto const [itr, inserted] =
+          children[node].try_emplace(byte, static_cast<size_type>(children.size()));
+        node = itr->second;
+        if (inserted) {
+          children.emplace_back();
+          outputs.push_back(no_target);
+        }
+      }
+      outputs[node] = std::min(outputs[node], idx);
+    }
+
+    // compute the failure links in breadth-first order so the outputs of each
+    // node can include the outputs of its failure node
+    auto const nodes_count = static_cast<size_type>(children.size());
+    std::vector<size_type> failures(nodes_count, 0);
+    std::queue<size_type> nodes;
+    for (auto const& [byte, child] : children[0]) {
+      nodes.push(child);
+    }
+    while (!nodes.empty()) {
+      auto const node = nodes.front();
+      nodes.pop();
+      outputs[node] = std::min(outputs[node], outputs[failures[node]]);
+      for (auto const& [byte, child] : children[node]) {
+        auto failure = failures[node];
+        while (failure != 0 && children[failure].count(byte) == 0) {
+          failure = failures[failure];
+        }
+        auto const itr  = children[failure].find(byte);
+        failures[child] = itr != children[failure].end() ? itr->second : 0;
+        nodes.push(child);
+      }
+    }
+
+    // flatten the children into sorted edges
+    std::vector<size_type> edge_offsets(nodes_count + 1, 0);
+    std::vector<uint8_t> edge_bytes;
+    std::vector<size_type> edge_nodes;
+    edge_bytes.reserve(nodes_count - 1);
+    edge_nodes.reserve(nodes_count - 1);
+    for (size_type node = 0; node < nodes_count; ++node) {
+      for (auto const& [byte, child] : children[node]) {
+        edge_bytes.push_back(byte);
+        edge_nodes.push_back(child);
+      }
+      edge_offsets[node + 1] = static_cast<size_type>(edge_bytes.size());
+    }
+
+    _edge_offsets = cudf::detail::make_device_uvector_async(
+      edge_offsets, stream, rmm::mr::get_current_device_resource());
+    _edge_bytes = cudf::detail::make_device_uvector_async(
+      edge_bytes, stream, rmm::mr::get_current_device_resource());
+    _edge_nodes = cudf::detail::make_device_uvector_async(
+      edge_nodes, stream, rmm::mr::get_current_device_resource());
+    _failures = cudf::detail::make_device_uvector_async(
+      failures, stream, rmm::mr::get_current_device_resource());
+    _outputs = cudf::detail::make_device_uvector_async(
+      outputs, stream, rmm::mr::get_current_device_resource());
+    // the host vectors are released on return
+    stream.synchronize();
+  }
+
+  [[nodiscard]] targets_automaton_view view() const
+  {
+    return targets_automaton_view{_edge_offsets.data(),
+                                  _edge_bytes.data(),
+                                  _edge_nodes.data(),
+                                  _failures.data(),
+                                  _outputs.data()};
+  }
+
+ private:
+  rmm::device_uvector<size_type> _edge_offsets;
+  rmm::device_uvector<uint8_t> _edge_bytes;
+  rmm::device_uvector<size_type> _edge_nodes;
+  rmm::device_uvector<size_type> _failures;
+  rmm::device_uvector<size_type> _outputs;
+};
+
+/**
+ * @brief Returns the smallest index of the targets found in each string
+ *
+ * When `any_target` is true, the search stops at the first target found and
+ * its index is not necessarily the smallest.
+ */
+template <bool any_target>
+struct find_any_fn {
+  column_device_view const d_strings;
+  targets_automaton_view const d_automaton;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return no_target; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    auto const data  = reinterpret_cast<uint8_t const*>(d_str.data());
+
+    size_type node   = 0;
+    size_type result = d_automaton.outputs[node];
+    for (size_type pos = 0; pos < d_str.size_bytes(); ++pos) {
+      if (result == 0 || (any_target && result != no_target)) { break; }
+      node   = d_automaton.next(node, data[pos]);
+      result = thrust::min(result, d_automaton.outputs[node]);
+    }
+    return result;
+  }
+};
+
+template <bool any_target, typename OutputType>
+std::unique_ptr<column> find_any_impl(strings_column_view const& input,
+                                      strings_column_view const& targets,
+                                      rmm::cuda_stream_view stream,
+                                      rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(targets.size() > 0, "Must include at least one search target");
+  CUDF_EXPECTS(!targets.has_nulls(), "Search targets cannot contain null strings");
+
+  auto results = make_numeric_column(data_type{type_to_id<OutputType>()},
+                                     input.size(),
+                                     cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                     input.null_count(),
+                                     stream,
+                                     mr);
+  if (input.is_empty()) { return results; }
+
+  auto const automaton = targets_automaton(targets, stream);
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+
+  auto const fn = find_any_fn<any_target>{*d_strings, automaton.view()};
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(input.size()),
+                    results->mutable_view().begin<OutputType>(),
+                    [fn] __device__(size_type idx) -> OutputType {
+                      auto const result = fn(idx);
+                      if constexpr (any_target) {
+                        return result != no_target;
+                      } else {
+                        return result != no_target ? result : -1;
+                      }
+                    });
+  results->set_null_count(input.null_count());
+  return results;
+}
+
+}  // namespace
+
+std::unique_ptr<column> contains_any(strings_column_view const& input,
+                                     strings_column_view const& targets,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  return find_any_impl<true, bool>(input, targets, stream, mr);
+}
+
+std::unique_ptr<column> find_any(strings_column_view const& input,
+                                 strings_column_view const& targets,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  return find_any_impl<false, size_type>(input, targets, stream, mr);
+}
+
 }  // namespace detail
 
 // external API
@@ -96,5 +335,23 @@ std::unique_ptr<column> find_multiple(strings_column_view const& input,
   return detail::find_multiple(input, targets, stream, mr);
 }
 
+std::unique_ptr<column> contains_any(strings_column_view const& input,
+                                     strings_column_view const& targets,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::contains_any(input, targets, stream, mr);
+}
+
+std::unique_ptr<column> find_any(strings_column_view const& input,
+                                 strings_column_view const& targets,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::find_any(input, targets, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -30,6 +30,8 @@
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <thrust/iterator/constant_iterator.h>
@@ -218,6 +220,25 @@ std::unique_ptr<column> slice_strings(strings_column_view const& strings,
                              cudf::detail::copy_bitmask(strings.parent(), stream, mr));
 }
 
+string_view_array slice_strings_view(strings_column_view const& input,
+                                     size_type start,
+                                     size_type stop,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  auto const d_column = column_device_view::create(input.parent(), stream);
+
+  auto result = rmm::device_uvector<string_view>(input.size(), stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(input.size()),
+                    result.begin(),
+                    substring_from_fn{*d_column,
+                                      thrust::constant_iterator<size_type>(start),
+                                      thrust::constant_iterator<size_type>(stop)});
+  return string_view_array(std::move(result), input.null_count());
+}
+
 std::unique_ptr<column> slice_strings(strings_column_view const& strings,
                                       column_view const& starts_column,
                                       column_view const& stops_column,
@@ -273,5 +294,15 @@ std::unique_ptr<column> slice_strings(strings_column_view const& strings,
   return detail::slice_strings(strings, starts_column, stops_column, stream, mr);
 }
 
+string_view_array slice_strings_view(strings_column_view const& input,
+                                     size_type start,
+                                     size_type stop,
+                                     rmm::cuda_stream_view stream,
+                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::slice_strings_view(input, start, stop, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
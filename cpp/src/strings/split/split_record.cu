@@ -33,9 +33,14 @@
 
 #include <cuda/functional>
 #include <thrust/for_each.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/constant_iterator.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
 #include <thrust/transform.h>
+#include <thrust/transform_reduce.h>
+
+#include <algorithm>
 
 namespace cudf {
 namespace strings {
@@ -138,12 +143,13 @@ struct whitespace_token_reader_fn {
 
 }  // namespace
 
-// The output is one list item per string
+// Returns the token offsets and the tokens for each string
 template <typename TokenReader>
-std::unique_ptr<column> whitespace_split_record_fn(strings_column_view const& input,
-                                                   TokenReader reader,
-                                                   rmm::cuda_stream_view stream,
-                                                   rmm::device_async_resource_ref mr)
+std::pair<std::unique_ptr<column>, rmm::device_uvector<string_index_pair>> whitespace_split_helper(
+  strings_column_view const& input,
+  TokenReader reader,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
 {
   // create offsets column by counting the number of tokens per string
   auto sizes_itr = cudf::detail::make_counting_transform_iterator(
@@ -160,6 +166,17 @@ std::unique_ptr<column> whitespace_split_record_fn(strings_column_view const& in
   reader.d_tokens        = tokens.data();
   thrust::for_each_n(
     rmm::exec_policy(stream), thrust::make_counting_iterator<size_type>(0), input.size(), reader);
+  return std::make_pair(std::move(offsets), std::move(tokens));
+}
+
+// The output is one list item per string
+template <typename TokenReader>
+std::unique_ptr<column> whitespace_split_record_fn(strings_column_view const& input,
+                                                   TokenReader reader,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  auto [offsets, tokens] = whitespace_split_helper(input, reader, stream, mr);
   // convert the index-pairs into one big strings column
   auto strings_output = make_strings_column(tokens.begin(), tokens.end(), stream, mr);
   // create a lists column using the offsets and the strings columns
@@ -203,6 +220,237 @@ std::unique_ptr<column> split_record(strings_column_view const& strings,
   }
 }
 
+namespace {
+
+/**
+ * @brief Stores the start and end byte positions of each token of a string
+ *
+ * The positions are relative to the start of the string.
+ */
+struct token_positions_fn {
+  column_device_view const d_strings;
+  cudf::detail::input_offsetalator const d_token_offsets;
+  string_index_pair const* d_tokens;
+  size_type* d_begins;
+  size_type* d_ends;
+
+  __device__ void operator()(size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto const str_begin = d_strings.element<string_view>(idx).data();
+    for (auto itr = d_token_offsets[idx]; itr < d_token_offsets[idx + 1]; ++itr) {
+      auto const token = d_tokens[itr];
+      d_begins[itr]    = static_cast<size_type>(thrust::distance(str_begin, token.first));
+      d_ends[itr]      = d_begins[itr] + token.second;
+    }
+  }
+};
+
+template <Direction direction>
+std::unique_ptr<column> split_token_index(strings_column_view const& input,
+                                          string_scalar const& delimiter,
+                                          size_type maxsplit,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  // makes consistent with Pandas
+  size_type max_tokens = maxsplit > 0 ? maxsplit + 1 : std::numeric_limits<size_type>::max();
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+
+  // identify the tokens the same way split_record does
+  auto [offsets, tokens] = [&] {
+    if (input.size() == input.null_count()) {
+      auto zeros = thrust::make_constant_iterator<size_type>(0);
+      auto result =
+        cudf::detail::make_offsets_child_column(zeros, zeros + input.size(), stream, mr).first;
+      return std::make_pair(std::move(result), rmm::device_uvector<string_index_pair>(0, stream));
+    }
+    if (delimiter.size() == 0) {
+      return whitespace_split_helper(
+        input, whitespace_token_reader_fn<direction>{*d_strings, max_tokens}, stream, mr);
+    }
+    auto const d_delimiter = string_view(delimiter.data(), delimiter.size());
+    if constexpr (direction == Direction::FORWARD) {
+      return split_helper(
+        input, split_tokenizer_fn{*d_strings, d_delimiter, max_tokens}, stream, mr);
+    } else {
+      return split_helper(
+        input, rsplit_tokenizer_fn{*d_strings, d_delimiter, max_tokens}, stream, mr);
+    }
+  }();
+  CUDF_EXPECTS(tokens.size() < static_cast<std::size_t>(std::numeric_limits<size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  // convert the token pointers into positions within each string
+  auto const total_tokens = static_cast<size_type>(tokens.size());
+  auto const int32_type   = data_type{type_id::INT32};
+  auto begins = make_numeric_column(int32_type, total_tokens, mask_state::UNALLOCATED, stream, mr);
+  auto ends   = make_numeric_column(int32_type, total_tokens, mask_state::UNALLOCATED, stream, mr);
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    input.size(),
+    token_positions_fn{*d_strings,
+                       cudf::detail::offsetalator_factory::make_input_iterator(offsets->view()),
+                       tokens.data(),
+                       begins->mutable_view().data<size_type>(),
+                       ends->mutable_view().data<size_type>()});
+
+  std::vector<std::unique_ptr<column>> children;
+  children.emplace_back(std::move(begins));
+  children.emplace_back(std::move(ends));
+  auto positions = make_structs_column(total_tokens, std::move(children), 0, {}, stream, mr);
+
+  return make_lists_column(input.size(),
+                           std::move(offsets),
+                           std::move(positions),
+                           input.null_count(),
+                           cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+/**
+ * @brief Returns the string for the token at `index` of a row
+ *
+ * Rows with `index` tokens or fewer return a null entry.
+ */
+struct token_from_index_fn {
+  column_device_view const d_strings;
+  size_type const* d_list_offsets;
+  size_type const* d_begins;
+  size_type const* d_ends;
+  size_type index;
+
+  __device__ string_index_pair operator()(size_type idx) const { return token(idx, index); }
+
+  __device__ string_index_pair token(size_type idx, size_type token_idx) const
+  {
+    auto const offset = d_list_offsets[idx];
+    if (d_strings.is_null(idx) || (token_idx >= (d_list_offsets[idx + 1] - offset))) {
+      return string_index_pair{nullptr, 0};
+    }
+    auto const pos = offset + token_idx;
+    return string_index_pair{d_strings.element<string_view>(idx).data() + d_begins[pos],
+                             d_ends[pos] - d_begins[pos]};
+  }
+};
+
+token_from_index_fn make_token_from_index_fn(column_device_view const& d_strings,
+                                             lists_column_view const& token_index,
+                                             size_type index)
+{
+  auto const positions = token_index.child();
+  return token_from_index_fn{d_strings,
+                             token_index.offsets_begin(),
+                             positions.child(0).data<size_type>(),
+                             positions.child(1).data<size_type>(),
+                             index};
+}
+
+void validate_token_index(strings_column_view const& input, lists_column_view const& token_index)
+{
+  CUDF_EXPECTS(token_index.size() == input.size(),
+               "token_index must have the same number of rows as the input");
+  auto const positions = token_index.child();
+  CUDF_EXPECTS(positions.type().id() == type_id::STRUCT && positions.num_children() == 2 &&
+                 positions.child(0).type().id() == type_id::INT32 &&
+                 positions.child(1).type().id() == type_id::INT32,
+               "token_index must be a lists column of token positions");
+}
+
+}  // namespace
+
+std::unique_ptr<column> split_record_with_index(strings_column_view const& input,
+                                                lists_column_view const& token_index,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  validate_token_index(input, token_index);
+  if (input.is_empty()) {
+    return cudf::lists::detail::make_empty_lists_column(data_type{type_id::STRING}, stream, mr);
+  }
+
+  // offsets for the output start at 0 even if token_index is sliced
+  auto const d_list_offsets = token_index.offsets_begin();
+  auto sizes_itr            = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<size_type>([d_list_offsets] __device__(size_type idx) {
+      return d_list_offsets[idx + 1] - d_list_offsets[idx];
+    }));
+  auto [offsets, total_tokens] =
+    cudf::detail::make_offsets_child_column(sizes_itr, sizes_itr + input.size(), stream, mr);
+  auto const d_offsets = offsets->view().template data<size_type>();
+
+  // build the tokens of each row directly from the stored positions
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const token_fn  = make_token_from_index_fn(*d_strings, token_index, 0);
+  auto tokens          = rmm::device_uvector<string_index_pair>(total_tokens, stream);
+  auto const d_tokens  = tokens.data();
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::make_counting_iterator<size_type>(0),
+                     input.size(),
+                     [token_fn, d_offsets, d_tokens] __device__(size_type idx) {
+                       for (auto itr = d_offsets[idx]; itr < d_offsets[idx + 1]; ++itr) {
+                         d_tokens[itr] = token_fn.token(idx, itr - d_offsets[idx]);
+                       }
+                     });
+  auto strings_child = make_strings_column(tokens.begin(), tokens.end(), stream, mr);
+
+  return make_lists_column(input.size(),
+                           std::move(offsets),
+                           std::move(strings_child),
+                           input.null_count(),
+                           cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
+std::unique_ptr<column> get_token_with_index(strings_column_view const& input,
+                                             lists_column_view const& token_index,
+                                             size_type index,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  validate_token_index(input, token_index);
+  CUDF_EXPECTS(index >= 0, "Parameter index must not be negative");
+  if (input.is_empty()) { return make_empty_column(type_id::STRING); }
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+  auto const itr       = cudf::detail::make_counting_transform_iterator(
+    0, make_token_from_index_fn(*d_strings, token_index, index));
+  return make_strings_column(itr, itr + input.size(), stream, mr);
+}
+
+std::unique_ptr<table> split_with_index(strings_column_view const& input,
+                                        lists_column_view const& token_index,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  validate_token_index(input, token_index);
+
+  // the number of columns is the maximum number of tokens in any row
+  auto const d_list_offsets = token_index.offsets_begin();
+  auto const columns_count  = thrust::transform_reduce(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<size_type>(0),
+    thrust::make_counting_iterator<size_type>(input.size()),
+    cuda::proclaim_return_type<size_type>([d_list_offsets] __device__(size_type idx) {
+      return d_list_offsets[idx + 1] - d_list_offsets[idx];
+    }),
+    0,
+    thrust::maximum{});
+
+  std::vector<std::unique_ptr<column>> results;
+  for (size_type col = 0; col < std::max(columns_count, 1); ++col) {
+    results.emplace_back(get_token_with_index(input, token_index, col, stream, mr));
+  }
+  return std::make_unique<table>(std::move(results));
+}
+
 }  // namespace detail
 
 // external APIs
@@ -228,5 +476,55 @@ std::unique_ptr<column> rsplit_record(strings_column_view const& strings,
     strings, delimiter, maxsplit, stream, mr);
 }
 
+std::unique_ptr<column> split_token_index(strings_column_view const& input,
+                                          string_scalar const& delimiter,
+                                          size_type maxsplit,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_token_index<detail::Direction::FORWARD>(
+    input, delimiter, maxsplit, stream, mr);
+}
+
+std::unique_ptr<column> rsplit_token_index(strings_column_view const& input,
+                                           string_scalar const& delimiter,
+                                           size_type maxsplit,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_token_index<detail::Direction::BACKWARD>(
+    input, delimiter, maxsplit, stream, mr);
+}
+
+std::unique_ptr<column> split_record_with_index(strings_column_view const& input,
+                                                lists_column_view const& token_index,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_record_with_index(input, token_index, stream, mr);
+}
+
+std::unique_ptr<table> split_with_index(strings_column_view const& input,
+                                        lists_column_view const& token_index,
+                                        rmm::cuda_stream_view stream,
+                                        rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::split_with_index(input, token_index, stream, mr);
+}
+
+std::unique_ptr<column> get_token_with_index(strings_column_view const& input,
+                                             lists_column_view const& token_index,
+                                             size_type index,
+                                             rmm::cuda_stream_view stream,
+                                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::get_token_with_index(input, token_index, index, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/strings/detail/string_headers.cuh>
+#include <cudf/strings/detail/strings_column_factories.cuh>
+#include <cudf/strings/string_headers.hpp>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+#include <thrust/transform.h>
+
+#include <limits>
+#include <stdexcept>
+
+namespace cudf {
+namespace strings {
+
+string_headers::string_headers(rmm::device_uvector<string_header>&& headers,
+                               rmm::device_buffer&& chars,
+                               rmm::device_buffer&& null_mask,
+                               size_type null_count)
+  : _headers(std::move(headers)),
+    _chars(std::move(chars)),
+    _null_mask(std::move(null_mask)),
+    _null_count(null_count)
+{
+}
+
+size_type string_headers::size() const { return static_cast<size_type>(_headers.size()); }
+
+size_type string_headers::null_count() const { return _null_count; }
+
+device_span<string_header const> string_headers::headers() const
+{
+  return device_span<string_header const>(_headers.data(), _headers.size());
+}
+
+char const* string_headers::chars() const { return static_cast<char const*>(_chars.data()); }
+
+bitmask_type const* string_headers::null_mask() const
+{
+  return _null_count > 0 ? static_cast<bitmask_type const*>(_null_mask.data()) : nullptr;
+}
+
+namespace detail {
+namespace {
+
+/**
+ * @brief Returns the number of bytes a row needs in the characters buffer
+ *
+ * Only strings which are not inline are stored in the buffer. The extra
+ * row at the end of the column returns 0 so the total can be computed.
+ */
+struct long_size_fn {
+  column_device_view const d_strings;
+
+  __device__ size_type operator()(size_type idx) const
+  {
+    if (idx >= d_strings.size() || d_strings.is_null(idx)) { return 0; }
+    auto const bytes = d_strings.element<string_view>(idx).size_bytes();
+    return bytes > string_header::inline_size ? bytes : 0;
+  }
+};
+
+/**
+ * @brief Builds the header of each row and copies the longer strings into the buffer
+ */
+struct to_header_fn {
+  column_device_view const d_strings;
+  int64_t const* d_offsets;
+  char* d_chars;
+
+  __device__ string_header operator()(size_type idx) const
+  {
+    string_header header{};
+    if (d_strings.is_null(idx)) { return header; }
+    auto const d_str = d_strings.element<string_view>(idx);
+    header.size      = d_str.size_bytes();
+    if (header.is_inline()) {
+      memcpy(header.data, d_str.data(), header.size);
+      return header;
+    }
+    int32_t const buffer_index = 0;
+    auto const offset          = static_cast<int32_t>(d_offsets[idx]);
+    memcpy(header.data, d_str.data(), string_header::prefix_size);
+    memcpy(header.data + string_header::prefix_size, &buffer_index, sizeof(int32_t));
+    memcpy(header.data + string_header::prefix_size + sizeof(int32_t), &offset, sizeof(int32_t));
+    memcpy(d_chars + offset, d_str.data(), header.size);
+    return header;
+  }
+};
+
+/**
+ * @brief Returns the string of each row for building a strings column
+ */
+struct from_header_fn {
+  string_header const* d_headers;
+  char const* d_chars;
+  bitmask_type const* d_null_mask;
+
+  __device__ string_index_pair operator()(size_type idx) const
+  {
+    if (d_null_mask && !bit_is_set(d_null_mask, idx)) { return string_index_pair{nullptr, 0}; }
+    auto const d_str = to_string_view(d_headers[idx], d_chars);
+    return string_index_pair{d_str.data(), d_str.size_bytes()};
+  }
+};
+
+}  // namespace
+
+string_headers to_string_headers(strings_column_view const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  auto const strings_count = input.size();
+  if (strings_count == 0) {
+    return string_headers(
+      rmm::device_uvector<string_header>(0, stream, mr), rmm::device_buffer{}, {}, 0);
+  }
+
+  auto const d_strings = column_device_view::create(input.parent(), stream);
+
+  // byte offset of each long string within the characters buffer
+  rmm::device_uvector<int64_t> offsets(strings_count + 1, stream);
+  auto const sizes_itr =
+    cudf::detail::make_counting_transform_iterator(0, long_size_fn{*d_strings});
+  auto const chars_size = cudf::detail::sizes_to_offsets(
+    sizes_itr, sizes_itr + strings_count + 1, offsets.begin(), stream);
+  CUDF_EXPECTS(chars_size <= static_cast<int64_t>(std::numeric_limits<int32_t>::max()),
+               "Size of the long strings exceeds the string_header offset limit",
+               std::overflow_error);
+
+  rmm::device_buffer chars(chars_size, stream, mr);
+  rmm::device_uvector<string_header> headers(strings_count, stream, mr);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<size_type>(0),
+    thrust::counting_iterator<size_type>(strings_count),
+    headers.begin(),
+    to_header_fn{*d_strings, offsets.data(), static_cast<char*>(chars.data())});
+
+  auto null_mask = input.has_nulls() ? cudf::detail::copy_bitmask(input.parent(), stream, mr)
+                                     : rmm::device_buffer{0, stream, mr};
+  return string_headers(
+    std::move(headers), std::move(chars), std::move(null_mask), input.null_count());
+}
+
+std::unique_ptr<column> from_string_headers(string_headers const& input,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  if (input.size() == 0) { return make_empty_column(type_id::STRING); }
+  auto const pairs = cudf::detail::make_counting_transform_iterator(
+    0, from_header_fn{input.headers().data(), input.chars(), input.null_mask()});
+  return make_strings_column(pairs, pairs + input.size(), stream, mr);
+}
+
+}  // namespace detail
+
+string_headers to_string_headers(strings_column_view const& input,
+                                 rmm::cuda_stream_view stream,
+                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::to_string_headers(input, stream, mr);
+}
+
+std::unique_ptr<column> from_string_headers(string_headers const& input,
+                                            rmm::cuda_stream_view stream,
+                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::from_string_headers(input, stream, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
@@ -0,0 +1,50 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column_factories.hpp>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/strings/string_view_array.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+namespace cudf {
+namespace strings {
+
+string_view_array::string_view_array(rmm::device_uvector<string_view>&& rows,
+                                     size_type null_count)
+  : _rows(std::move(rows)), _null_count(null_count)
+{
+}
+
+size_type string_view_array::size() const { return static_cast<size_type>(_rows.size()); }
+
+size_type string_view_array::null_count() const { return _null_count; }
+
+device_span<string_view const> string_view_array::rows() const
+{
+  return device_span<string_view const>(_rows.data(), _rows.size());
+}
+
+std::unique_ptr<column> string_view_array::materialize(rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr) const
+{
+  if (_rows.is_empty()) { return make_empty_column(type_id::STRING); }
+  return make_strings_column(rows(), string_view{nullptr, 0}, stream, mr);
+}
+
+}  // namespace strings
+}  // namespace cudf
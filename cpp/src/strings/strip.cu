@@ -25,6 +25,7 @@
 #include <cudf/utilities/error.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
@@ -55,6 +56,21 @@ struct strip_transform_fn {
   }
 };
 
+/**
+ * @brief Strip function returning the stripped string where null rows have a null data pointer
+ */
+struct strip_view_fn {
+  column_device_view const d_strings;
+  side_type const side;  // right, left, or both
+  string_view const d_to_strip;
+
+  __device__ string_view operator()(size_type idx)
+  {
+    if (d_strings.is_null(idx)) { return string_view{nullptr, 0}; }
+    return strip(d_strings.element<string_view>(idx), d_to_strip, side);
+  }
+};
+
 }  // namespace
 
 std::unique_ptr<column> strip(strings_column_view const& input,
@@ -80,6 +96,26 @@ std::unique_ptr<column> strip(strings_column_view const& input,
   return make_strings_column(result.begin(), result.end(), stream, mr);
 }
 
+string_view_array strip_view(strings_column_view const& input,
+                             side_type side,
+                             string_scalar const& to_strip,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(to_strip.is_valid(stream), "Parameter to_strip must be valid");
+  string_view const d_to_strip(to_strip.data(), to_strip.size());
+
+  auto const d_column = column_device_view::create(input.parent(), stream);
+
+  auto result = rmm::device_uvector<string_view>(input.size(), stream, mr);
+  thrust::transform(rmm::exec_policy(stream),
+                    thrust::counting_iterator<size_type>(0),
+                    thrust::counting_iterator<size_type>(input.size()),
+                    result.begin(),
+                    strip_view_fn{*d_column, side, d_to_strip});
+  return string_view_array(std::move(result), input.null_count());
+}
+
 }  // namespace detail
 
 // external APIs
@@ -94,5 +130,15 @@ std::unique_ptr<column> strip(strings_column_view const& input,
   return detail::strip(input, side, to_strip, stream, mr);
 }
 
+string_view_array strip_view(strings_column_view const& input,
+                             side_type side,
+                             string_scalar const& to_strip,
+                             rmm::cuda_stream_view stream,
+                             rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::strip_view(input, side, to_strip, stream, mr);
+}
+
 }  // namespace strings
 }  // namespace cudf
@@ -174,6 +174,16 @@ int64_t get_offset_value(cudf::column_view const& offsets,
                                 : cudf::detail::get_value<int32_t>(offsets, index, stream);
 }
 
+int64_t average_bytes_per_row(strings_column_view const& input, rmm::cuda_stream_view stream)
+{
+  auto const valid_count = input.size() - input.null_count();
+  if (valid_count == 0) { return 0; }
+  auto const first_offset =
+    (input.offset() == 0) ? 0L : get_offset_value(input.offsets(), input.offset(), stream);
+  auto const last_offset = get_offset_value(input.offsets(), input.offset() + input.size(), stream);
+  return (last_offset - first_offset) / valid_count;
+}
+
 }  // namespace detail
 }  // namespace strings
 }  // namespace cudf
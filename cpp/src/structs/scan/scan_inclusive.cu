@@ -17,7 +17,7 @@
 #include "reductions/nested_type_minmax_util.cuh"
 
 #include <cudf/column/column_factories.hpp>
-#include <cudf/detail/gather.hpp>
+#include <cudf/detail/gather.cuh>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/device_operators.cuh>
 
@@ -26,6 +26,7 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/scan.h>
 
@@ -34,12 +35,9 @@
 namespace cudf {
 namespace structs {
 namespace detail {
-namespace {
-
-}  // namespace
-
 template <typename Op>
 std::unique_ptr<column> scan_inclusive(column_view const& input,
+                                       bitmask_type const* mask,
                                        rmm::cuda_stream_view stream,
                                        rmm::device_async_resource_ref mr)
 {
@@ -63,11 +61,19 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
     return std::vector<column_view>(it, it + input.num_children());
   }();
 
-  // Gather the children elements of the prefix min/max struct elements for the output.
+  // Gather the children elements of the prefix min/max struct elements for the output. Null rows
+  // are mapped out of bounds so the gather nullifies them in the children, instead of pushing the
+  // null mask down into each child afterwards.
+  auto const map_begin = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<size_type>(
+      [indices = gather_map.data(), mask, size = input.size()] __device__(size_type idx) {
+        return mask == nullptr || bit_is_set(mask, idx) ? indices[idx] : size;
+      }));
   auto scanned_children = cudf::detail::gather(table_view{input_children},
-                                               gather_map,
-                                               cudf::out_of_bounds_policy::DONT_CHECK,
-                                               cudf::detail::negative_index_policy::NOT_ALLOWED,
+                                               map_begin,
+                                               map_begin + input.size(),
+                                               cudf::out_of_bounds_policy::NULLIFY,
                                                stream,
                                                mr)
                             ->release();
@@ -78,10 +84,12 @@ std::unique_ptr<column> scan_inclusive(column_view const& input,
 }
 
 template std::unique_ptr<column> scan_inclusive<DeviceMin>(column_view const& input_view,
+                                                           bitmask_type const* mask,
                                                            rmm::cuda_stream_view stream,
                                                            rmm::device_async_resource_ref mr);
 
 template std::unique_ptr<column> scan_inclusive<DeviceMax>(column_view const& input_view,
+                                                           bitmask_type const* mask,
                                                            rmm::cuda_stream_view stream,
                                                            rmm::device_async_resource_ref mr);
 
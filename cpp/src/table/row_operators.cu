@@ -20,6 +20,7 @@
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/concatenate.hpp>
 #include <cudf/detail/copy.hpp>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/sorting.hpp>
 #include <cudf/detail/structs/utilities.hpp>
 #include <cudf/detail/utilities/linked_column.hpp>
@@ -88,6 +89,23 @@ table_view remove_struct_child_offsets(table_view table)
   return table_view(cols);
 }
 
+/**
+ * @brief Removes the null masks of the non-nested columns of a table that have no nulls.
+ *
+ * Device comparators and hashers then skip the validity checks of those columns. Nested columns
+ * are unchanged since their null masks determine how they are preprocessed.
+ */
+table_view drop_all_valid_null_masks(table_view table)
+{
+  std::vector<column_view> cols;
+  cols.reserve(table.num_columns());
+  std::transform(table.begin(), table.end(), std::back_inserter(cols), [](column_view const& c) {
+    if (is_nested(c.type()) or c.has_nulls()) { return c; }
+    return detail::compact_null_masks(c);
+  });
+  return table_view(cols);
+}
+
 /**
  * @brief The enum to specify whether the `decompose_structs` function will process lists columns
  * (at any nested level) or will output them unchanged.
@@ -644,7 +662,7 @@ std::shared_ptr<preprocessed_table> preprocessed_table::create(
 {
   check_lex_compatibility(preprocessed_input);
 
-  auto d_table = table_device_view::create(preprocessed_input, stream);
+  auto d_table = table_device_view::create(drop_all_valid_null_masks(preprocessed_input), stream);
   auto d_column_order =
     detail::make_device_uvector_async(column_order, stream, rmm::mr::get_current_device_resource());
   auto d_null_precedence = detail::make_device_uvector_async(
@@ -856,7 +874,8 @@ std::shared_ptr<preprocessed_table> preprocessed_table::create(table_view const&
   auto verticalized_t =
     std::get<0>(decompose_structs(struct_offset_removed_table, decompose_lists_column::YES));
 
-  auto d_t = table_device_view_owner(table_device_view::create(verticalized_t, stream));
+  auto d_t = table_device_view_owner(
+    table_device_view::create(drop_all_valid_null_masks(verticalized_t), stream));
   return std::shared_ptr<preprocessed_table>(new preprocessed_table(
     std::move(d_t), std::move(nullable_data.new_null_masks), std::move(nullable_data.new_columns)));
 }
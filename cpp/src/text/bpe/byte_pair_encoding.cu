@@ -15,16 +15,19 @@
  */
 
 #include "text/bpe/byte_pair_encoding.cuh"
+#include "text/vocabulary_tokenize.cuh"
 
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/get_value.cuh>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/algorithm.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -36,16 +39,24 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/functional>
+#include <thrust/binary_search.h>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/discard_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
 #include <thrust/merge.h>
 #include <thrust/remove.h>
+#include <thrust/transform.h>
 #include <thrust/unique.h>
 
+#include <limits>
+#include <stdexcept>
+
 namespace nvtext {
 
 /**
@@ -118,9 +129,13 @@ struct bpe_unpairable_offsets_fn {
  * Once there are no more rankable pairs, the process finishes and the `d_spaces_data`
  * values identify the location to insert the separator.
  *
+ * Only the first occurrence of each distinct string in `d_strings` is encoded.
+ * The other occurrences are copied from it afterwards by `copy_cached_merges_fn`.
+ *
  * @tparam MapRefType The type of the map finder object
  * @param d_strings Input data
  * @param d_map For looking up individual string candidates
+ * @param d_cache Index of the string in `d_strings` which is encoded for each string
  * @param d_spaces_data Output the location where separator will be inserted
  * @param d_ranks_data Working memory to hold pair ranks
  * @param d_rerank_data Working memory to hold locations where reranking is required
@@ -129,6 +144,7 @@ template <typename MapRefType>
 CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
                                  char const* d_input_chars,
                                  MapRefType const d_map,
+                                 cudf::size_type const* d_cache,
                                  int8_t* d_spaces_data,          // working memory
                                  cudf::size_type* d_ranks_data,  // more working memory
                                  int8_t* d_rerank_data           // and one more working memory
@@ -138,6 +154,7 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
   auto const str_idx =
     static_cast<cudf::size_type>(cudf::detail::grid_1d::global_thread_id() / block_size);
   auto const lane_idx = static_cast<cudf::size_type>(threadIdx.x);
+  if (d_cache[str_idx] != str_idx) { return; }  // encoded by another block
 
   auto const d_str  = d_strings.element<cudf::string_view>(str_idx);
   auto const offset = thrust::distance(d_input_chars, d_str.data());
@@ -283,6 +300,73 @@ CUDF_KERNEL void bpe_parallel_fn(cudf::column_device_view const d_strings,
   }  // if no min ranks are found we are done, otherwise start again
 }
 
+/**
+ * @brief Copies the merge positions of each string from its cached occurrence
+ *
+ * Identical strings produce identical merges so the BPE kernel only encodes
+ * one occurrence of each distinct string.
+ */
+struct copy_cached_merges_fn {
+  cudf::column_device_view const d_strings;
+  char const* d_input_chars;
+  cudf::size_type const* d_cache;
+  int8_t* d_spaces;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const cached = d_cache[idx];
+    if (cached == idx) { return; }
+    auto const d_str    = d_strings.element<cudf::string_view>(idx);
+    auto const d_cached = d_strings.element<cudf::string_view>(cached);
+    thrust::copy_n(thrust::seq,
+                   d_spaces + thrust::distance(d_input_chars, d_cached.data()),
+                   d_str.size_bytes(),
+                   d_spaces + thrust::distance(d_input_chars, d_str.data()));
+  }
+};
+
+/**
+ * @brief Builds the cache index for `bpe_parallel_fn`
+ *
+ * Each string is mapped to the row index of one occurrence of the same string.
+ *
+ * @param d_strings Strings to be encoded
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Row index of the cached occurrence for each string
+ */
+rmm::device_uvector<cudf::size_type> build_merge_cache(cudf::column_device_view const& d_strings,
+                                                       rmm::cuda_stream_view stream)
+{
+  auto const size = d_strings.size();
+  auto words_map  = mp_table_map_type{static_cast<std::size_t>(size) * 2,
+                                     cuco::empty_key{-1},
+                                     cuco::empty_value{-1},
+                                     mp_equal{d_strings},
+                                     mp_probe_scheme{mp_hasher{d_strings}},
+                                     cuco::thread_scope_device,
+                                     cuco_storage{},
+                                     cudf::detail::cuco_allocator{stream},
+                                     stream.value()};
+  auto iter       = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<cuco::pair<cudf::size_type, cudf::size_type>>(
+      [] __device__(cudf::size_type idx) { return cuco::make_pair(idx, idx); }));
+  // only one of the identical strings is inserted
+  words_map.insert_async(iter, iter + size, stream.value());
+
+  auto cache         = rmm::device_uvector<cudf::size_type>(size, stream);
+  auto const map_ref = words_map.ref(cuco::op::find);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    thrust::counting_iterator<cudf::size_type>(0),
+                    thrust::counting_iterator<cudf::size_type>(size),
+                    cache.begin(),
+                    cuda::proclaim_return_type<cudf::size_type>(
+                      [map_ref] __device__(cudf::size_type idx) -> cudf::size_type {
+                        return map_ref.find(idx)->second;
+                      }));
+  return cache;
+}
+
 /**
  * @brief Computes the output size of each strings row
  *
@@ -336,6 +420,114 @@ CUDF_KERNEL void bpe_finalize(cudf::column_device_view const d_strings,
   if (lane_idx == 0) { d_sizes[str_idx] = total_bytes + d_str.size_bytes(); }
 }
 
+/**
+ * @brief Looks up the token id of each encoded token
+ *
+ * The tokens are identified by adjacent `d_boundaries` values.
+ *
+ * @tparam MapRefType The type of the vocabulary map finder object
+ */
+template <typename MapRefType>
+struct bpe_token_id_fn {
+  char const* d_input_chars;
+  int64_t const* d_boundaries;
+  MapRefType const d_map;
+  cudf::size_type const default_id;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    auto const begin = d_boundaries[idx];
+    auto const size  = static_cast<cudf::size_type>(d_boundaries[idx + 1] - begin);
+    auto const token = cudf::string_view(d_input_chars + begin, size);
+    auto const itr   = d_map.find(token);
+    return (itr != d_map.end()) ? itr->second : default_id;
+  }
+};
+
+/**
+ * @brief Computes the byte-pair-encoding merges of the input strings
+ *
+ * On return, `d_spaces` is 1 at the first byte of each encoded token
+ * and 0 for all the other bytes of the input characters.
+ *
+ * @param input Strings to encode
+ * @param merge_pairs Merge pairs table
+ * @param first_offset Offset of the first character of `input`
+ * @param chars_size Number of character bytes in `input`
+ * @param d_spaces Output of `chars_size` elements
+ * @param d_working Working memory of `chars_size` elements
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compute_merges(cudf::strings_column_view const& input,
+                    bpe_merge_pairs const& merge_pairs,
+                    int64_t first_offset,
+                    int64_t chars_size,
+                    int8_t* d_spaces,
+                    int64_t* d_working,
+                    rmm::cuda_stream_view stream)
+{
+  auto const d_input_chars = input.chars_begin(stream) + first_offset;
+  auto const chars_begin   = thrust::counting_iterator<int64_t>(0);
+  auto const chars_end     = thrust::counting_iterator<int64_t>(chars_size);
+
+  // this kernel locates unpairable sections of strings to create artificial string row
+  // boundaries; the boundary values are recorded as offsets in d_up_offsets
+  auto const d_up_offsets = d_working;  // store unpairable offsets here
+  auto const mp_map = get_bpe_merge_pairs_impl(merge_pairs)->get_mp_table_ref();  // lookup table
+  auto const d_chars_span = cudf::device_span<char const>(d_input_chars, chars_size);
+  auto up_fn = bpe_unpairable_offsets_fn<decltype(mp_map)>{d_chars_span, first_offset, mp_map};
+  thrust::transform(rmm::exec_policy_nosync(stream), chars_begin, chars_end, d_up_offsets, up_fn);
+  auto const up_end =  // remove all but the unpairable offsets
+    thrust::remove(rmm::exec_policy_nosync(stream), d_up_offsets, d_up_offsets + chars_size, 0L);
+  auto const unpairables = thrust::distance(d_up_offsets, up_end);  // number of unpairables
+
+  // new string boundaries created by combining unpairable offsets with the existing offsets
+  auto tmp_offsets = rmm::device_uvector<int64_t>(unpairables + input.size() + 1, stream);
+  auto input_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+  thrust::merge(rmm::exec_policy_nosync(stream),
+                input_offsets,
+                input_offsets + input.size() + 1,
+                d_up_offsets,
+                up_end,
+                tmp_offsets.begin());
+  // remove any adjacent duplicate offsets (i.e. empty or null rows)
+  auto const offsets_end =
+    thrust::unique(rmm::exec_policy_nosync(stream), tmp_offsets.begin(), tmp_offsets.end());
+  auto const offsets_total =
+    static_cast<cudf::size_type>(thrust::distance(tmp_offsets.begin(), offsets_end));
+  tmp_offsets.resize(offsets_total, stream);
+
+  // temp column created with the merged offsets and the original chars data
+  auto const col_offsets = cudf::column_view(cudf::device_span<int64_t const>(tmp_offsets));
+  auto const tmp_size    = offsets_total - 1;
+  auto const tmp_input   = cudf::column_view(
+    input.parent().type(), tmp_size, input.chars_begin(stream), nullptr, 0, 0, {col_offsets});
+  auto const d_tmp_strings = cudf::column_device_view::create(tmp_input, stream);
+
+  // each distinct substring is encoded once and copied to its other occurrences
+  auto const d_cache = build_merge_cache(*d_tmp_strings, stream);
+
+  // launch the byte-pair-encoding kernel on the temp column
+  rmm::device_uvector<int8_t> d_rerank(chars_size, stream);  // more working memory;
+  rmm::device_uvector<cudf::size_type> d_ranks(chars_size, stream);
+  auto const pair_map = get_bpe_merge_pairs_impl(merge_pairs)->get_merge_pairs_ref();
+  bpe_parallel_fn<decltype(pair_map)>
+    <<<tmp_size, block_size, 0, stream.value()>>>(*d_tmp_strings,
+                                                  d_input_chars,
+                                                  pair_map,
+                                                  d_cache.data(),
+                                                  d_spaces,
+                                                  d_ranks.data(),
+                                                  d_rerank.data());
+  auto const copy_fn =
+    copy_cached_merges_fn{*d_tmp_strings, d_input_chars, d_cache.data(), d_spaces};
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     tmp_size,
+                     copy_fn);
+}
+
 }  // namespace
 
 std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& input,
@@ -371,49 +563,8 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
   auto const chars_begin = thrust::counting_iterator<int64_t>(0);
   auto const chars_end   = thrust::counting_iterator<int64_t>(chars_size);
 
-  {
-    // this kernel locates unpairable sections of strings to create artificial string row
-    // boundaries; the boundary values are recorded as offsets in d_up_offsets
-    auto const d_up_offsets = d_working.data();  // store unpairable offsets here
-    auto const mp_map = get_bpe_merge_pairs_impl(merge_pairs)->get_mp_table_ref();  // lookup table
-    auto const d_chars_span = cudf::device_span<char const>(d_input_chars, chars_size);
-    auto up_fn = bpe_unpairable_offsets_fn<decltype(mp_map)>{d_chars_span, first_offset, mp_map};
-    thrust::transform(rmm::exec_policy_nosync(stream), chars_begin, chars_end, d_up_offsets, up_fn);
-    auto const up_end =  // remove all but the unpairable offsets
-      thrust::remove(rmm::exec_policy_nosync(stream), d_up_offsets, d_up_offsets + chars_size, 0L);
-    auto const unpairables = thrust::distance(d_up_offsets, up_end);  // number of unpairables
-
-    // new string boundaries created by combining unpairable offsets with the existing offsets
-    auto tmp_offsets = rmm::device_uvector<int64_t>(unpairables + input.size() + 1, stream);
-    auto input_offsets =
-      cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
-    thrust::merge(rmm::exec_policy_nosync(stream),
-                  input_offsets,
-                  input_offsets + input.size() + 1,
-                  d_up_offsets,
-                  up_end,
-                  tmp_offsets.begin());
-    // remove any adjacent duplicate offsets (i.e. empty or null rows)
-    auto const offsets_end =
-      thrust::unique(rmm::exec_policy_nosync(stream), tmp_offsets.begin(), tmp_offsets.end());
-    auto const offsets_total =
-      static_cast<cudf::size_type>(thrust::distance(tmp_offsets.begin(), offsets_end));
-    tmp_offsets.resize(offsets_total, stream);
-
-    // temp column created with the merged offsets and the original chars data
-    auto const col_offsets = cudf::column_view(cudf::device_span<int64_t const>(tmp_offsets));
-    auto const tmp_size    = offsets_total - 1;
-    auto const tmp_input   = cudf::column_view(
-      input.parent().type(), tmp_size, input.chars_begin(stream), nullptr, 0, 0, {col_offsets});
-    auto const d_tmp_strings = cudf::column_device_view::create(tmp_input, stream);
-
-    // launch the byte-pair-encoding kernel on the temp column
-    rmm::device_uvector<int8_t> d_rerank(chars_size, stream);  // more working memory;
-    rmm::device_uvector<cudf::size_type> d_ranks(chars_size, stream);
-    auto const pair_map = get_bpe_merge_pairs_impl(merge_pairs)->get_merge_pairs_ref();
-    bpe_parallel_fn<decltype(pair_map)><<<tmp_size, block_size, 0, stream.value()>>>(
-      *d_tmp_strings, d_input_chars, pair_map, d_spaces.data(), d_ranks.data(), d_rerank.data());
-  }
+  compute_merges(
+    input, merge_pairs, first_offset, chars_size, d_spaces.data(), d_working.data(), stream);
 
   // compute the output sizes
   auto output_sizes = rmm::device_uvector<cudf::size_type>(input.size(), stream);
@@ -454,6 +605,102 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
                                    cudf::detail::copy_bitmask(input.parent(), stream, mr));
 }
 
+std::unique_ptr<cudf::column> byte_pair_encoding_ids(cudf::strings_column_view const& input,
+                                                     bpe_merge_pairs const& merge_pairs,
+                                                     tokenize_vocabulary const& vocabulary,
+                                                     cudf::size_type default_id,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  if (input.is_empty()) {
+    return cudf::lists::detail::make_empty_lists_column(output_type, stream, mr);
+  }
+
+  auto const first_offset  = (input.offset() == 0) ? 0L
+                                                   : cudf::strings::detail::get_offset_value(
+                                                      input.offsets(), input.offset(), stream);
+  auto const last_offset   = (input.offset() == 0 && input.size() == input.offsets().size() - 1)
+                               ? static_cast<int64_t>(input.chars_size(stream))
+                               : cudf::strings::detail::get_offset_value(
+                                 input.offsets(), input.size() + input.offset(), stream);
+  auto const chars_size    = last_offset - first_offset;
+  auto const d_input_chars = input.chars_begin(stream) + first_offset;
+
+  rmm::device_uvector<int8_t> d_spaces(chars_size, stream);  // identifies the encoded tokens
+  rmm::device_uvector<int64_t> d_working(chars_size, stream);
+  if (chars_size > 0) {
+    compute_merges(
+      input, merge_pairs, first_offset, chars_size, d_spaces.data(), d_working.data(), stream);
+  }
+
+  // the first byte of each token is identified by a 1 in d_spaces
+  auto const chars_begin = thrust::counting_iterator<int64_t>(0);
+  auto const chars_end   = thrust::counting_iterator<int64_t>(chars_size);
+  auto const d_starts    = d_working.data();
+  auto const starts_end  = cudf::detail::copy_if_safe(
+    chars_begin,
+    chars_end,
+    d_starts,
+    [d_spaces = d_spaces.data()] __device__(auto idx) { return d_spaces[idx] == 1; },
+    stream);
+  auto const num_starts = thrust::distance(d_starts, starts_end);
+
+  // token boundaries are the token starts combined with the row boundaries
+  auto const input_offsets =
+    cudf::detail::offsetalator_factory::make_input_iterator(input.offsets(), input.offset());
+  auto const row_offsets = thrust::make_transform_iterator(
+    input_offsets,
+    cuda::proclaim_return_type<int64_t>(
+      [first_offset] __device__(int64_t offset) { return offset - first_offset; }));
+  auto boundaries = rmm::device_uvector<int64_t>(num_starts + input.size() + 1, stream);
+  thrust::merge(rmm::exec_policy_nosync(stream),
+                row_offsets,
+                row_offsets + input.size() + 1,
+                d_starts,
+                starts_end,
+                boundaries.begin());
+  // remove any adjacent duplicates (i.e. row starts and empty or null rows)
+  auto const boundaries_end =
+    thrust::unique(rmm::exec_policy_nosync(stream), boundaries.begin(), boundaries.end());
+  auto const total_tokens = thrust::distance(boundaries.begin(), boundaries_end) - 1;
+  CUDF_EXPECTS(total_tokens < static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "total number of tokens exceeds the column size limit",
+               std::overflow_error);
+
+  // the tokens of each row start at the row's first boundary
+  auto offsets = cudf::make_numeric_column(
+    output_type, input.size() + 1, cudf::mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy_nosync(stream),
+                      boundaries.begin(),
+                      boundaries_end,
+                      row_offsets,
+                      row_offsets + input.size() + 1,
+                      offsets->mutable_view().begin<cudf::size_type>());
+
+  auto tokens = cudf::make_numeric_column(output_type,
+                                          static_cast<cudf::size_type>(total_tokens),
+                                          cudf::mask_state::UNALLOCATED,
+                                          stream,
+                                          mr);
+  vocabulary._impl->visit_lookup([&](auto map_ref) {
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      thrust::counting_iterator<cudf::size_type>(0),
+                      thrust::counting_iterator<cudf::size_type>(total_tokens),
+                      tokens->mutable_view().begin<cudf::size_type>(),
+                      bpe_token_id_fn<decltype(map_ref)>{
+                        d_input_chars, boundaries.data(), map_ref, default_id});
+  });
+
+  return cudf::make_lists_column(input.size(),
+                                 std::move(offsets),
+                                 std::move(tokens),
+                                 input.null_count(),
+                                 cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const& input,
@@ -465,4 +712,15 @@ std::unique_ptr<cudf::column> byte_pair_encoding(cudf::strings_column_view const
   return detail::byte_pair_encoding(input, merges_table, separator, cudf::get_default_stream(), mr);
 }
 
+std::unique_ptr<cudf::column> byte_pair_encoding_ids(cudf::strings_column_view const& input,
+                                                     bpe_merge_pairs const& merge_pairs,
+                                                     tokenize_vocabulary const& vocabulary,
+                                                     cudf::size_type default_id,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::byte_pair_encoding_ids(input, merge_pairs, vocabulary, default_id, stream, mr);
+}
+
 }  // namespace nvtext
@@ -14,13 +14,17 @@
  * limitations under the License.
  */
 
+#include "text/utilities/tokenize_ops.cuh"
+
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/copy_if.cuh>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
+#include <cudf/hashing/detail/hashing.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/strings/detail/strings_children.cuh>
 #include <cudf/strings/detail/utilities.cuh>
@@ -33,15 +37,21 @@
 #include <nvtext/detail/generate_ngrams.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_buffer.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cub/device/device_segmented_sort.cuh>
 #include <cuda/functional>
+#include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/transform_scan.h>
 
 #include <stdexcept>
+#include <vector>
 
 namespace nvtext {
 namespace detail {
@@ -323,6 +333,302 @@ std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view co
     input.size(), std::move(offsets), std::move(hashes), 0, rmm::device_buffer{}, stream, mr);
 }
 
+namespace {
+/**
+ * @brief Hashes the character ngrams of a string
+ *
+ * The hashes are the same as the ones computed by `hash_character_ngrams`.
+ */
+struct character_ngram_hasher {
+  cudf::size_type ngrams;
+
+  __device__ cudf::size_type count(cudf::string_view const& d_str) const
+  {
+    return std::max(0, static_cast<cudf::size_type>(d_str.length() + 1 - ngrams));
+  }
+
+  template <typename HashConsumer>
+  __device__ void for_each(cudf::string_view const& d_str, HashConsumer consume) const
+  {
+    auto const hasher      = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>{0};
+    auto const ngram_count = count(d_str);
+    auto itr               = d_str.begin();
+    for (cudf::size_type n = 0; n < ngram_count; ++n, ++itr) {
+      auto const begin = itr.byte_offset();
+      auto const end   = (itr + ngrams).byte_offset();
+      consume(hasher(cudf::string_view(d_str.data() + begin, end - begin)));
+    }
+  }
+};
+
+/**
+ * @brief Hashes the word ngrams of a string
+ *
+ * The hash of an ngram combines the hashes of its tokens.
+ */
+struct word_ngram_hasher {
+  cudf::size_type ngrams;
+  cudf::string_view d_delimiter;
+
+  __device__ cudf::size_type count(cudf::string_view const& d_str) const
+  {
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    cudf::size_type num_tokens = 0;
+    while (tokenizer.next_token()) {
+      ++num_tokens;
+    }
+    return std::max(0, num_tokens + 1 - ngrams);
+  }
+
+  template <typename HashConsumer>
+  __device__ void for_each(cudf::string_view const& d_str, HashConsumer consume) const
+  {
+    auto const hasher     = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>{0};
+    auto const token_hash = [&](characters_tokenizer const& tokenizer) {
+      auto const pos = tokenizer.token_byte_positions();
+      return hasher(cudf::string_view(d_str.data() + pos.first, pos.second - pos.first));
+    };
+
+    characters_tokenizer tokenizer(d_str, d_delimiter);
+    while (tokenizer.next_token()) {
+      // a copy of the tokenizer walks the remaining tokens of the ngram
+      auto window                = tokenizer;
+      auto hash                  = token_hash(window);
+      cudf::size_type num_tokens = 1;
+      while (num_tokens < ngrams && window.next_token()) {
+        hash = cudf::hashing::detail::hash_combine(hash, token_hash(window));
+        ++num_tokens;
+      }
+      if (num_tokens < ngrams) { return; }
+      consume(hash);
+    }
+  }
+};
+
+template <typename NgramHasher>
+struct ngram_count_fn {
+  cudf::column_device_view const d_strings;
+  NgramHasher const hasher;
+
+  __device__ cudf::size_type operator()(cudf::size_type idx) const
+  {
+    return d_strings.is_null(idx) ? 0 : hasher.count(d_strings.element<cudf::string_view>(idx));
+  }
+};
+
+/**
+ * @brief Computes the feature index and sign of each ngram of each string
+ */
+template <typename NgramHasher>
+struct ngram_features_fn {
+  cudf::column_device_view const d_strings;
+  NgramHasher const hasher;
+  cudf::size_type const num_features;
+  bool const signed_hash;
+  cudf::size_type const* d_offsets;
+  cudf::size_type* d_indices;
+  cudf::size_type* d_signs;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    if (d_strings.is_null(idx)) { return; }
+    auto d_row_indices = d_indices + d_offsets[idx];
+    auto d_row_signs   = d_signs + d_offsets[idx];
+    hasher.for_each(d_strings.element<cudf::string_view>(idx), [&](cudf::hash_value_type hash) {
+      *d_row_indices++ = static_cast<cudf::size_type>(hash % num_features);
+      *d_row_signs++   = (signed_hash && (hash >> 31)) ? -1 : 1;
+    });
+  }
+};
+
+/**
+ * @brief Sums the signs of the equal indices within each row of sorted features
+ *
+ * Only the features with a non-zero sum are kept. This computes the number of features of each
+ * row in `d_sizes` when `d_out_indices` is null, and writes the features otherwise.
+ */
+struct sum_features_fn {
+  cudf::size_type const* d_offsets;
+  cudf::size_type const* d_indices;
+  cudf::size_type const* d_signs;
+  cudf::size_type* d_sizes;
+  cudf::size_type const* d_out_offsets;
+  cudf::size_type* d_out_indices;
+  cudf::size_type* d_out_counts;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const end      = d_offsets[idx + 1];
+    auto out_idx        = d_out_indices ? d_out_offsets[idx] : 0;
+    cudf::size_type num = 0;
+    for (auto i = d_offsets[idx]; i < end;) {
+      auto const index    = d_indices[i];
+      cudf::size_type sum = 0;
+      for (; i < end && d_indices[i] == index; ++i) {
+        sum += d_signs[i];
+      }
+      if (sum == 0) { continue; }
+      if (d_out_indices) {
+        d_out_indices[out_idx] = index;
+        d_out_counts[out_idx]  = sum;
+        ++out_idx;
+      }
+      ++num;
+    }
+    if (!d_out_indices) { d_sizes[idx] = num; }
+  }
+};
+
+/**
+ * @brief Hashes the ngrams of each string into a sparse feature vector
+ *
+ * The feature indices and signs of all ngrams are computed without materializing the ngrams,
+ * sorted within each row, and summed per index.
+ */
+template <typename NgramHasher>
+std::unique_ptr<cudf::column> hash_ngram_features(cudf::strings_column_view const& input,
+                                                  NgramHasher hasher,
+                                                  cudf::size_type num_features,
+                                                  bool signed_hash,
+                                                  rmm::cuda_stream_view stream,
+                                                  rmm::device_async_resource_ref mr)
+{
+  auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+
+  auto const counts_itr = cudf::detail::make_counting_transform_iterator(
+    0, ngram_count_fn<NgramHasher>{*d_strings, hasher});
+  auto [ngram_offsets, total_ngrams] = cudf::detail::make_offsets_child_column(
+    counts_itr, counts_itr + input.size(), stream, rmm::mr::get_current_device_resource());
+  auto const d_ngram_offsets = ngram_offsets->view().data<cudf::size_type>();
+
+  rmm::device_uvector<cudf::size_type> indices(total_ngrams, stream);
+  rmm::device_uvector<cudf::size_type> signs(total_ngrams, stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     input.size(),
+                     ngram_features_fn<NgramHasher>{*d_strings,
+                                                    hasher,
+                                                    num_features,
+                                                    signed_hash,
+                                                    d_ngram_offsets,
+                                                    indices.data(),
+                                                    signs.data()});
+
+  // sort the features of each row so equal indices are adjacent
+  rmm::device_uvector<cudf::size_type> sorted_indices(total_ngrams, stream);
+  rmm::device_uvector<cudf::size_type> sorted_signs(total_ngrams, stream);
+  if (total_ngrams > 0) {
+    rmm::device_buffer d_temp_storage;
+    size_t temp_storage_bytes = 0;
+    cub::DeviceSegmentedSort::SortPairs(d_temp_storage.data(),
+                                        temp_storage_bytes,
+                                        indices.data(),
+                                        sorted_indices.data(),
+                                        signs.data(),
+                                        sorted_signs.data(),
+                                        total_ngrams,
+                                        input.size(),
+                                        d_ngram_offsets,
+                                        d_ngram_offsets + 1,
+                                        stream.value());
+    d_temp_storage = rmm::device_buffer{temp_storage_bytes, stream};
+    cub::DeviceSegmentedSort::SortPairs(d_temp_storage.data(),
+                                        temp_storage_bytes,
+                                        indices.data(),
+                                        sorted_indices.data(),
+                                        signs.data(),
+                                        sorted_signs.data(),
+                                        total_ngrams,
+                                        input.size(),
+                                        d_ngram_offsets,
+                                        d_ngram_offsets + 1,
+                                        stream.value());
+  }
+
+  rmm::device_uvector<cudf::size_type> sizes(input.size(), stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     input.size(),
+                     sum_features_fn{d_ngram_offsets,
+                                     sorted_indices.data(),
+                                     sorted_signs.data(),
+                                     sizes.data(),
+                                     nullptr,
+                                     nullptr,
+                                     nullptr});
+  auto [offsets, total_features] =
+    cudf::detail::make_offsets_child_column(sizes.begin(), sizes.end(), stream, mr);
+
+  auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+
+  auto out_indices = cudf::make_numeric_column(
+    output_type, total_features, cudf::mask_state::UNALLOCATED, stream, mr);
+  auto out_counts  = cudf::make_numeric_column(
+    output_type, total_features, cudf::mask_state::UNALLOCATED, stream, mr);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     input.size(),
+                     sum_features_fn{d_ngram_offsets,
+                                     sorted_indices.data(),
+                                     sorted_signs.data(),
+                                     nullptr,
+                                     offsets->view().data<cudf::size_type>(),
+                                     out_indices->mutable_view().data<cudf::size_type>(),
+                                     out_counts->mutable_view().data<cudf::size_type>()});
+
+  std::vector<std::unique_ptr<cudf::column>> members;
+  members.emplace_back(std::move(out_indices));
+  members.emplace_back(std::move(out_counts));
+  auto features = cudf::make_structs_column(
+    total_features, std::move(members), 0, rmm::device_buffer{}, stream, mr);
+
+  return cudf::make_lists_column(input.size(),
+                                 std::move(offsets),
+                                 std::move(features),
+                                 input.null_count(),
+                                 cudf::detail::copy_bitmask(input.parent(), stream, mr),
+                                 stream,
+                                 mr);
+}
+}  // namespace
+
+std::unique_ptr<cudf::column> hash_character_ngram_features(cudf::strings_column_view const& input,
+                                                            cudf::size_type ngrams,
+                                                            cudf::size_type num_features,
+                                                            bool signed_hash,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(ngrams >= 1,
+               "Parameter ngrams should be an integer value of 1 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS(num_features >= 1,
+               "Parameter num_features should be an integer value of 1 or greater",
+               std::invalid_argument);
+  return hash_ngram_features(
+    input, character_ngram_hasher{ngrams}, num_features, signed_hash, stream, mr);
+}
+
+std::unique_ptr<cudf::column> hash_word_ngram_features(cudf::strings_column_view const& input,
+                                                       cudf::size_type ngrams,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type num_features,
+                                                       bool signed_hash,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(ngrams >= 1,
+               "Parameter ngrams should be an integer value of 1 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS(num_features >= 1,
+               "Parameter num_features should be an integer value of 1 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+  auto const d_delimiter = cudf::string_view(delimiter.data(), delimiter.size());
+  return hash_ngram_features(
+    input, word_ngram_hasher{ngrams, d_delimiter}, num_features, signed_hash, stream, mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> generate_character_ngrams(cudf::strings_column_view const& strings,
@@ -343,4 +649,29 @@ std::unique_ptr<cudf::column> hash_character_ngrams(cudf::strings_column_view co
   return detail::hash_character_ngrams(strings, ngrams, stream, mr);
 }
 
+std::unique_ptr<cudf::column> hash_character_ngram_features(cudf::strings_column_view const& input,
+                                                            cudf::size_type ngrams,
+                                                            cudf::size_type num_features,
+                                                            bool signed_hash,
+                                                            rmm::cuda_stream_view stream,
+                                                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_character_ngram_features(
+    input, ngrams, num_features, signed_hash, stream, mr);
+}
+
+std::unique_ptr<cudf::column> hash_word_ngram_features(cudf::strings_column_view const& input,
+                                                       cudf::size_type ngrams,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type num_features,
+                                                       bool signed_hash,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::hash_word_ngram_features(
+    input, ngrams, delimiter, num_features, signed_hash, stream, mr);
+}
+
 }  // namespace nvtext
@@ -18,9 +18,11 @@
 #include <cudf/column/column_device_view.cuh>
 #include <cudf/column/column_factories.hpp>
 #include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/lists/lists_column_view.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 #include <cudf/utilities/span.hpp>
@@ -33,10 +35,23 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cub/cub.cuh>
+#include <cuda/functional>
 #include <thrust/binary_search.h>
+#include <thrust/copy.h>
+#include <thrust/count.h>
 #include <thrust/execution_policy.h>
+#include <thrust/for_each.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
+#include <thrust/unique.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
 
 namespace nvtext {
 namespace detail {
@@ -242,6 +257,154 @@ std::unique_ptr<cudf::column> hash_substrings(cudf::strings_column_view const& c
     stream,
     rmm::mr::get_current_device_resource());
 }
+
+/**
+ * @brief Sorted unique substring hashes for each row of a strings column
+ */
+struct unique_hashes {
+  rmm::device_uvector<cudf::size_type> offsets;  // size + 1 offsets into values
+  rmm::device_uvector<uint32_t> values;          // sorted unique hashes of each row
+};
+
+/**
+ * @brief Builds the sorted unique substring hashes for each row
+ */
+unique_hashes build_unique_hashes(cudf::strings_column_view const& input,
+                                  cudf::size_type width,
+                                  rmm::cuda_stream_view stream)
+{
+  auto const hashes = hash_substrings(input, width, stream);
+  auto const counts = compute_unique_counts(hashes->view(), stream);
+
+  auto offsets = rmm::device_uvector<cudf::size_type>(input.size() + 1, stream);
+  offsets.set_element_to_zero_async(0, stream);
+  thrust::inclusive_scan(
+    rmm::exec_policy_nosync(stream), counts.begin(), counts.end(), offsets.begin() + 1);
+  auto const total = offsets.back_element(stream);
+
+  auto values          = rmm::device_uvector<uint32_t>(total, stream);
+  auto const lists     = cudf::lists_column_view(hashes->view());
+  auto const d_offsets = lists.offsets_begin();
+  auto const d_hashes  = lists.child().data<uint32_t>();
+  thrust::for_each_n(
+    rmm::exec_policy_nosync(stream),
+    thrust::counting_iterator<cudf::size_type>(0),
+    input.size(),
+    [d_offsets, d_hashes, d_unique_offsets = offsets.data(), d_values = values.data()] __device__(
+      cudf::size_type idx) {
+      auto out         = d_values + d_unique_offsets[idx];
+      auto const begin = d_hashes + d_offsets[idx];
+      auto const end   = d_hashes + d_offsets[idx + 1];
+      for (auto itr = begin; itr < end; ++itr) {
+        if (itr == begin || *itr != *(itr - 1)) { *out++ = *itr; }
+      }
+    });
+  return unique_hashes{std::move(offsets), std::move(values)};
+}
+
+/**
+ * @brief Returns the number of smallest hashes of a set that must be checked
+ *
+ * Two sets with a Jaccard index of at least `threshold` share at least
+ * `ceil(threshold * size)` values so at least one value must appear within
+ * the first `size - ceil(threshold * size) + 1` values of each sorted set.
+ * The tolerance keeps float rounding from shortening the prefix.
+ */
+__device__ cudf::size_type prefix_length(cudf::size_type size, double threshold)
+{
+  if (size == 0) { return 0; }
+  auto const overlap = static_cast<cudf::size_type>(ceil(threshold * size - 1e-6));
+  return std::min(size, size - overlap + 1);
+}
+
+/**
+ * @brief Returns true if the set sizes allow a Jaccard index of at least `threshold`
+ *
+ * The Jaccard index is at most `min(size1, size2) / max(size1, size2)`.
+ */
+__device__ bool sizes_qualify(cudf::size_type size1, cudf::size_type size2, double threshold)
+{
+  auto const min_size = std::min(size1, size2);
+  auto const max_size = std::max(size1, size2);
+  return (min_size > 0) && (static_cast<double>(min_size) >= threshold * max_size - 1e-6);
+}
+
+/**
+ * @brief Counts or stores the candidate pairs for a row of the first input
+ *
+ * Each prefix value of the row is located in the sorted prefix values of the
+ * second input and each matching row that passes the size filter is a candidate.
+ * When `d_candidates` is null only the number of candidates is returned.
+ */
+struct candidates_fn {
+  cudf::size_type const* d_offsets1;
+  uint32_t const* d_values1;
+  cudf::size_type const* d_offsets2;
+  uint32_t const* d_prefix_values;  // sorted prefix values of the second input
+  cudf::size_type const* d_prefix_rows;
+  int64_t prefix_count;
+  double threshold;
+  int64_t const* d_candidate_offsets;
+  uint64_t* d_candidates;
+
+  __device__ int64_t operator()(cudf::size_type idx) const
+  {
+    auto const size1  = d_offsets1[idx + 1] - d_offsets1[idx];
+    auto const prefix = prefix_length(size1, threshold);
+    auto const begin  = d_prefix_values;
+    auto const end    = d_prefix_values + prefix_count;
+
+    int64_t count        = 0;
+    auto out             = d_candidates ? d_candidates + d_candidate_offsets[idx] : nullptr;
+    auto const row_begin = d_values1 + d_offsets1[idx];
+    for (auto itr = row_begin; itr < row_begin + prefix; ++itr) {
+      auto const lb = thrust::lower_bound(thrust::seq, begin, end, *itr);
+      for (auto match = lb; match < end && *match == *itr; ++match) {
+        auto const row2  = d_prefix_rows[thrust::distance(begin, match)];
+        auto const size2 = d_offsets2[row2 + 1] - d_offsets2[row2];
+        if (!sizes_qualify(size1, size2, threshold)) { continue; }
+        if (out) { *out++ = (static_cast<uint64_t>(idx) << 32) | static_cast<uint32_t>(row2); }
+        ++count;
+      }
+    }
+    return count;
+  }
+};
+
+/**
+ * @brief Computes the Jaccard index of a candidate pair from their sorted unique hashes
+ */
+struct pair_jaccard_fn {
+  cudf::size_type const* d_offsets1;
+  uint32_t const* d_values1;
+  cudf::size_type const* d_offsets2;
+  uint32_t const* d_values2;
+
+  __device__ float operator()(uint64_t candidate) const
+  {
+    auto const row1 = static_cast<cudf::size_type>(candidate >> 32);
+    auto const row2 = static_cast<cudf::size_type>(candidate & 0xFFFF'FFFF);
+    auto itr1       = d_values1 + d_offsets1[row1];
+    auto const end1 = d_values1 + d_offsets1[row1 + 1];
+    auto itr2       = d_values2 + d_offsets2[row2];
+    auto const end2 = d_values2 + d_offsets2[row2 + 1];
+
+    auto const sizes = static_cast<cudf::size_type>((end1 - itr1) + (end2 - itr2));
+    cudf::size_type intersects = 0;
+    while (itr1 < end1 && itr2 < end2) {
+      if (*itr1 < *itr2) {
+        ++itr1;
+      } else if (*itr2 < *itr1) {
+        ++itr2;
+      } else {
+        ++intersects;
+        ++itr1;
+        ++itr2;
+      }
+    }
+    return static_cast<float>(intersects) / static_cast<float>(sizes - intersects);
+  }
+};
 }  // namespace
 
 std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& input1,
@@ -292,6 +455,148 @@ std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& inp
   return results;
 }
 
+std::unique_ptr<cudf::table> jaccard_join(cudf::strings_column_view const& input1,
+                                          cudf::strings_column_view const& input2,
+                                          cudf::size_type width,
+                                          float threshold,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(width >= 2,
+               "Parameter width should be an integer value of 2 or greater",
+               std::invalid_argument);
+  CUDF_EXPECTS(threshold > 0.f && threshold <= 1.f,
+               "Parameter threshold must be greater than 0 and not greater than 1",
+               std::invalid_argument);
+
+  auto make_result = [&](cudf::size_type size) {
+    std::vector<std::unique_ptr<cudf::column>> columns;
+    auto const index_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+    columns.emplace_back(
+      cudf::make_numeric_column(index_type, size, cudf::mask_state::UNALLOCATED, stream, mr));
+    columns.emplace_back(
+      cudf::make_numeric_column(index_type, size, cudf::mask_state::UNALLOCATED, stream, mr));
+    columns.emplace_back(cudf::make_numeric_column(
+      cudf::data_type{cudf::type_id::FLOAT32}, size, cudf::mask_state::UNALLOCATED, stream, mr));
+    return std::make_unique<cudf::table>(std::move(columns));
+  };
+  if (input1.is_empty() || input2.is_empty()) { return make_result(0); }
+
+  auto const hashes1    = build_unique_hashes(input1, width, stream);
+  auto const hashes2    = build_unique_hashes(input2, width, stream);
+  auto const d_offsets1 = hashes1.offsets.data();
+  auto const d_offsets2 = hashes2.offsets.data();
+  auto const t          = static_cast<double>(threshold);
+
+  // build a sorted index of the prefix values of each row in input2
+  auto prefix_offsets = rmm::device_uvector<cudf::size_type>(input2.size() + 1, stream);
+  prefix_offsets.set_element_to_zero_async(0, stream);
+  auto const prefix_sizes = cudf::detail::make_counting_transform_iterator(
+    0, cuda::proclaim_return_type<cudf::size_type>([d_offsets2, t] __device__(cudf::size_type idx) {
+      return prefix_length(d_offsets2[idx + 1] - d_offsets2[idx], t);
+    }));
+  thrust::inclusive_scan(rmm::exec_policy_nosync(stream),
+                         prefix_sizes,
+                         prefix_sizes + input2.size(),
+                         prefix_offsets.begin() + 1);
+  auto const prefix_count = prefix_offsets.back_element(stream);
+  auto prefix_values      = rmm::device_uvector<uint32_t>(prefix_count, stream);
+  auto prefix_rows        = rmm::device_uvector<cudf::size_type>(prefix_count, stream);
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     input2.size(),
+                     [d_offsets2,
+                      d_values2 = hashes2.values.data(),
+                      d_prefix_offsets = prefix_offsets.data(),
+                      d_prefix_values = prefix_values.data(),
+                      d_prefix_rows = prefix_rows.data()] __device__(cudf::size_type idx) {
+                       auto const offset = d_prefix_offsets[idx];
+                       auto const size   = d_prefix_offsets[idx + 1] - offset;
+                       for (cudf::size_type i = 0; i < size; ++i) {
+                         d_prefix_values[offset + i] = d_values2[d_offsets2[idx] + i];
+                         d_prefix_rows[offset + i]   = idx;
+                       }
+                     });
+  thrust::sort_by_key(rmm::exec_policy_nosync(stream),
+                      prefix_values.begin(),
+                      prefix_values.end(),
+                      prefix_rows.begin());
+
+  // count and then store the candidate pairs sharing a prefix value
+  auto fn = candidates_fn{d_offsets1,
+                          hashes1.values.data(),
+                          d_offsets2,
+                          prefix_values.data(),
+                          prefix_rows.data(),
+                          static_cast<int64_t>(prefix_count),
+                          t,
+                          nullptr,
+                          nullptr};
+  auto candidate_offsets = rmm::device_uvector<int64_t>(input1.size() + 1, stream);
+  candidate_offsets.set_element_to_zero_async(0, stream);
+  auto const counts_itr = cudf::detail::make_counting_transform_iterator(0, fn);
+  thrust::inclusive_scan(rmm::exec_policy_nosync(stream),
+                         counts_itr,
+                         counts_itr + input1.size(),
+                         candidate_offsets.begin() + 1);
+  auto const candidates_count = candidate_offsets.back_element(stream);
+  auto candidates             = rmm::device_uvector<uint64_t>(candidates_count, stream);
+  fn.d_candidate_offsets      = candidate_offsets.data();
+  fn.d_candidates             = candidates.data();
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     input1.size(),
+                     [fn] __device__(cudf::size_type idx) { fn(idx); });
+
+  // a pair may share more than one prefix value
+  thrust::sort(rmm::exec_policy_nosync(stream), candidates.begin(), candidates.end());
+  auto const unique_end =
+    thrust::unique(rmm::exec_policy_nosync(stream), candidates.begin(), candidates.end());
+  candidates.resize(thrust::distance(candidates.begin(), unique_end), stream);
+
+  // verify each candidate pair and keep only those meeting the threshold
+  auto similarities = rmm::device_uvector<float>(candidates.size(), stream);
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    candidates.begin(),
+    candidates.end(),
+    similarities.begin(),
+    pair_jaccard_fn{d_offsets1, hashes1.values.data(), d_offsets2, hashes2.values.data()});
+  auto const keep = [threshold] __device__(float similarity) { return similarity >= threshold; };
+  auto const output_count =
+    thrust::count_if(rmm::exec_policy(stream), similarities.begin(), similarities.end(), keep);
+  CUDF_EXPECTS(output_count < static_cast<int64_t>(std::numeric_limits<cudf::size_type>::max()),
+               "Size of output exceeds the column size limit",
+               std::overflow_error);
+
+  auto result = make_result(static_cast<cudf::size_type>(output_count));
+  auto pairs  = rmm::device_uvector<uint64_t>(output_count, stream);
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  candidates.begin(),
+                  candidates.end(),
+                  similarities.begin(),
+                  pairs.begin(),
+                  keep);
+  thrust::copy_if(rmm::exec_policy_nosync(stream),
+                  similarities.begin(),
+                  similarities.end(),
+                  result->get_column(2).mutable_view().data<float>(),
+                  keep);
+  // split each pair into the row indices of the two inputs
+  thrust::transform(
+    rmm::exec_policy_nosync(stream),
+    pairs.begin(),
+    pairs.end(),
+    thrust::make_zip_iterator(result->get_column(0).mutable_view().data<cudf::size_type>(),
+                              result->get_column(1).mutable_view().data<cudf::size_type>()),
+    cuda::proclaim_return_type<thrust::tuple<cudf::size_type, cudf::size_type>>(
+      [] __device__(uint64_t pair) {
+        return thrust::make_tuple(static_cast<cudf::size_type>(pair >> 32),
+                                  static_cast<cudf::size_type>(pair & 0xFFFF'FFFF));
+      }));
+  return result;
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& input1,
@@ -304,4 +609,15 @@ std::unique_ptr<cudf::column> jaccard_index(cudf::strings_column_view const& inp
   return detail::jaccard_index(input1, input2, width, stream, mr);
 }
 
+std::unique_ptr<cudf::table> jaccard_join(cudf::strings_column_view const& input1,
+                                          cudf::strings_column_view const& input2,
+                                          cudf::size_type width,
+                                          float threshold,
+                                          rmm::cuda_stream_view stream,
+                                          rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::jaccard_join(input1, input2, width, threshold, stream, mr);
+}
+
 }  // namespace nvtext
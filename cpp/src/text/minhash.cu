@@ -20,11 +20,14 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/detail/sequence.hpp>
+#include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
 #include <cudf/hashing/detail/hashing.hpp>
 #include <cudf/hashing/detail/murmurhash3_x64_128.cuh>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/strings/string_view.cuh>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -36,8 +39,12 @@
 #include <rmm/resource_ref.hpp>
 
 #include <cuda/atomic>
+#include <cuda/functional>
 #include <thrust/execution_policy.h>
 #include <thrust/fill.h>
+#include <thrust/for_each.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/logical.h>
 
 #include <limits>
 
@@ -46,24 +53,92 @@ namespace detail {
 namespace {
 
 /**
- * @brief Compute the minhash of each string for each seed
+ * @brief Computes the hash of a substring for each seed and stores the minimum values
+ *
+ * @tparam HashFunction hash function to use on each substring
+ */
+template <typename HashFunction, typename hash_value_type>
+struct seeded_hash_fn {
+  cudf::device_span<hash_value_type const> seeds;
+
+  __device__ std::size_t size() const { return seeds.size(); }
+
+  __device__ void operator()(cudf::string_view hash_str, hash_value_type* d_output) const
+  {
+    // hashing with each seed on the same section of the string is 10x faster than
+    // computing the substrings for each seed
+    for (std::size_t seed_idx = 0; seed_idx < seeds.size(); ++seed_idx) {
+      auto const hasher = HashFunction(seeds[seed_idx]);
+      // hash substring and store the min value
+      if constexpr (std::is_same_v<hash_value_type, uint32_t>) {
+        auto const hvalue = hasher(hash_str);
+        cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + seed_idx)};
+        ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
+      } else {
+        // This code path assumes the use of MurmurHash3_x64_128 which produces 2 uint64 values
+        // but only uses the first uint64 value as requested by the LLM team.
+        auto const hvalue = thrust::get<0>(hasher(hash_str));
+        cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + seed_idx)};
+        ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
+      }
+    }
+  }
+};
+
+/**
+ * @brief Hashes a substring once and stores the minimum of each permutation of the hash
+ *
+ * Each permutation is `(a * hash + b) % mersenne_prime` for a pair of
+ * parameter values so the substring is never rehashed.
+ *
+ * @tparam HashFunction hash function to use on each substring
+ */
+template <typename HashFunction, typename hash_value_type>
+struct permuted_hash_fn {
+  static constexpr uint64_t mersenne_prime = (1UL << 61) - 1;
+
+  hash_value_type seed;
+  cudf::device_span<hash_value_type const> parameter_a;
+  cudf::device_span<hash_value_type const> parameter_b;
+
+  __device__ std::size_t size() const { return parameter_a.size(); }
+
+  __device__ void operator()(cudf::string_view hash_str, hash_value_type* d_output) const
+  {
+    auto const hasher = HashFunction(seed);
+    uint64_t hash     = 0;
+    if constexpr (std::is_same_v<hash_value_type, uint32_t>) {
+      hash = static_cast<uint64_t>(hasher(hash_str));
+    } else {
+      hash = thrust::get<0>(hasher(hash_str));
+    }
+    for (std::size_t idx = 0; idx < parameter_a.size(); ++idx) {
+      // the 32-bit product cannot overflow; the 64-bit product wraps
+      auto const hvalue = static_cast<hash_value_type>(
+        ((static_cast<uint64_t>(parameter_a[idx]) * hash + parameter_b[idx]) % mersenne_prime) &
+        std::numeric_limits<hash_value_type>::max());
+      cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + idx)};
+      ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
+    }
+  }
+};
+
+/**
+ * @brief Compute the minhash of each string for each hash value
  *
  * This is a warp-per-string algorithm where parallel threads within a warp
  * work on substrings of a single string row.
  *
- * @tparam HashFunction hash function to use on each substring
+ * @tparam MinhashFunction computes the hash values of each substring
  *
  * @param d_strings Strings column to process
- * @param seeds Seeds for hashing each string
+ * @param hash_fn Stores the minimum hash values of each substring
  * @param width Substring window size in characters
  * @param d_hashes Minhash output values for each string
  */
-template <
-  typename HashFunction,
-  typename hash_value_type = std::
-    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
+template <typename MinhashFunction, typename hash_value_type>
 CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
-                                cudf::device_span<hash_value_type const> seeds,
+                                MinhashFunction const hash_fn,
                                 cudf::size_type width,
                                 hash_value_type* d_hashes)
 {
@@ -79,12 +154,12 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
   if (d_strings.is_null(str_idx)) { return; }
 
   auto const d_str    = d_strings.element<cudf::string_view>(str_idx);
-  auto const d_output = d_hashes + (str_idx * seeds.size());
+  auto const d_output = d_hashes + (str_idx * hash_fn.size());
 
   // initialize hashes output for this string
   if (lane_idx == 0) {
     auto const init = d_str.empty() ? 0 : std::numeric_limits<hash_value_type>::max();
-    thrust::fill(thrust::seq, d_output, d_output + seeds.size(), init);
+    thrust::fill(thrust::seq, d_output, d_output + hash_fn.size(), init);
   }
   __syncwarp();
 
@@ -99,42 +174,23 @@ CUDF_KERNEL void minhash_kernel(cudf::column_device_view const d_strings,
     auto const [bytes, left] = cudf::strings::detail::bytes_to_character_position(check_str, width);
     if ((itr != d_str.data()) && (left > 0)) { continue; }  // true if past the end of the string
 
-    auto const hash_str = cudf::string_view(itr, bytes);
-    // hashing with each seed on the same section of the string is 10x faster than
-    // computing the substrings for each seed
-    for (std::size_t seed_idx = 0; seed_idx < seeds.size(); ++seed_idx) {
-      auto const hasher = HashFunction(seeds[seed_idx]);
-      // hash substring and store the min value
-      if constexpr (std::is_same_v<hash_value_type, uint32_t>) {
-        auto const hvalue = hasher(hash_str);
-        cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + seed_idx)};
-        ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
-      } else {
-        // This code path assumes the use of MurmurHash3_x64_128 which produces 2 uint64 values
-        // but only uses the first uint64 value as requested by the LLM team.
-        auto const hvalue = thrust::get<0>(hasher(hash_str));
-        cuda::atomic_ref<hash_value_type, cuda::thread_scope_block> ref{*(d_output + seed_idx)};
-        ref.fetch_min(hvalue, cuda::std::memory_order_relaxed);
-      }
-    }
+    hash_fn(cudf::string_view(itr, bytes), d_output);
   }
 }
 
-template <
-  typename HashFunction,
-  typename hash_value_type = std::
-    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
-std::unique_ptr<cudf::column> minhash_fn(cudf::strings_column_view const& input,
-                                         cudf::device_span<hash_value_type const> seeds,
+template <typename hash_value_type, typename MinhashFunction>
+std::unique_ptr<cudf::column> compute_minhash(cudf::strings_column_view const& input,
+                                         MinhashFunction hash_fn,
+                                         std::size_t hashes_count,
                                          cudf::size_type width,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
 {
-  CUDF_EXPECTS(!seeds.empty(), "Parameter seeds cannot be empty", std::invalid_argument);
+  CUDF_EXPECTS(hashes_count > 0, "Parameter seeds cannot be empty", std::invalid_argument);
   CUDF_EXPECTS(width >= 2,
                "Parameter width should be an integer value of 2 or greater",
                std::invalid_argument);
-  CUDF_EXPECTS((static_cast<std::size_t>(input.size()) * seeds.size()) <
+  CUDF_EXPECTS((static_cast<std::size_t>(input.size()) * hashes_count) <
                  static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()),
                "The number of seeds times the number of input rows exceeds the column size limit",
                std::overflow_error);
@@ -145,7 +201,7 @@ std::unique_ptr<cudf::column> minhash_fn(cudf::strings_column_view const& input,
   auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
 
   auto hashes   = cudf::make_numeric_column(output_type,
-                                          input.size() * static_cast<cudf::size_type>(seeds.size()),
+                                          input.size() * static_cast<cudf::size_type>(hashes_count),
                                           cudf::mask_state::UNALLOCATED,
                                           stream,
                                           mr);
@@ -153,12 +209,56 @@ std::unique_ptr<cudf::column> minhash_fn(cudf::strings_column_view const& input,
 
   constexpr int block_size = 256;
   cudf::detail::grid_1d grid{input.size() * cudf::detail::warp_size, block_size};
-  minhash_kernel<HashFunction><<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
-    *d_strings, seeds, width, d_hashes);
+  minhash_kernel<<<grid.num_blocks, grid.num_threads_per_block, 0, stream.value()>>>(
+    *d_strings, hash_fn, width, d_hashes);
 
   return hashes;
 }
 
+template <
+  typename HashFunction,
+  typename hash_value_type = std::
+    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
+std::unique_ptr<cudf::column> minhash_fn(cudf::strings_column_view const& input,
+                                         cudf::device_span<hash_value_type const> seeds,
+                                         cudf::size_type width,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  return compute_minhash<hash_value_type>(input,
+                                          seeded_hash_fn<HashFunction, hash_value_type>{seeds},
+                                          seeds.size(),
+                                          width,
+                                          stream,
+                                          mr);
+}
+
+template <
+  typename HashFunction,
+  typename hash_value_type = std::
+    conditional_t<std::is_same_v<typename HashFunction::result_type, uint32_t>, uint32_t, uint64_t>>
+std::unique_ptr<cudf::column> permuted_minhash_fn(
+  cudf::strings_column_view const& input,
+  hash_value_type seed,
+  cudf::device_span<hash_value_type const> parameter_a,
+  cudf::device_span<hash_value_type const> parameter_b,
+  cudf::size_type width,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(!parameter_a.empty(), "Parameters A and B cannot be empty", std::invalid_argument);
+  CUDF_EXPECTS(parameter_a.size() == parameter_b.size(),
+               "Parameters A and B should have the same number of elements",
+               std::invalid_argument);
+  return compute_minhash<hash_value_type>(
+    input,
+    permuted_hash_fn<HashFunction, hash_value_type>{seed, parameter_a, parameter_b},
+    parameter_a.size(),
+    width,
+    stream,
+    mr);
+}
+
 std::unique_ptr<cudf::column> build_list_result(cudf::strings_column_view const& input,
                                                 std::unique_ptr<cudf::column>&& hashes,
                                                 cudf::size_type seeds_size,
@@ -185,6 +285,33 @@ std::unique_ptr<cudf::column> build_list_result(cudf::strings_column_view const&
   }
   return result;
 }
+
+/**
+ * @brief Hashes each band of minhash values of a row into a single value
+ *
+ * The band position is used as the seed so equal values in different
+ * band positions produce different band hashes.
+ */
+struct lsh_bands_fn {
+  char const* d_minhashes;  // minhash values as bytes
+  cudf::size_type const* d_list_offsets;
+  cudf::size_type const* d_band_offsets;
+  cudf::size_type value_size;  // bytes per minhash value
+  cudf::size_type rows_per_band;
+  uint64_t* d_bands;
+
+  __device__ void operator()(cudf::size_type idx) const
+  {
+    auto const band_bytes = value_size * rows_per_band;
+    auto d_values         = d_minhashes + (static_cast<int64_t>(d_list_offsets[idx]) * value_size);
+    for (auto band = d_band_offsets[idx]; band < d_band_offsets[idx + 1]; ++band) {
+      auto const position = static_cast<uint64_t>(band - d_band_offsets[idx]);
+      auto const hasher   = cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>(position);
+      d_bands[band]       = thrust::get<0>(hasher(cudf::string_view(d_values, band_bytes)));
+      d_values += band_bytes;
+    }
+  }
+};
 }  // namespace
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -234,6 +361,99 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   auto hashes        = detail::minhash_fn<HashFunction>(input, seeds, width, stream, mr);
   return build_list_result(input, std::move(hashes), seeds.size(), stream, mr);
 }
+std::unique_ptr<cudf::column> minhash_permuted(cudf::strings_column_view const& input,
+                                               uint32_t seed,
+                                               cudf::device_span<uint32_t const> parameter_a,
+                                               cudf::device_span<uint32_t const> parameter_b,
+                                               cudf::size_type width,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  using HashFunction = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>;
+  auto hashes        = detail::permuted_minhash_fn<HashFunction>(
+    input, seed, parameter_a, parameter_b, width, stream, mr);
+  return build_list_result(input, std::move(hashes), parameter_a.size(), stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash64_permuted(cudf::strings_column_view const& input,
+                                                 uint64_t seed,
+                                                 cudf::device_span<uint64_t const> parameter_a,
+                                                 cudf::device_span<uint64_t const> parameter_b,
+                                                 cudf::size_type width,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr)
+{
+  using HashFunction = cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>;
+  auto hashes        = detail::permuted_minhash_fn<HashFunction>(
+    input, seed, parameter_a, parameter_b, width, stream, mr);
+  return build_list_result(input, std::move(hashes), parameter_a.size(), stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_lsh_bands(cudf::lists_column_view const& minhashes,
+                                                cudf::size_type rows_per_band,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(rows_per_band > 0,
+               "Parameter rows_per_band should be an integer value of 1 or greater",
+               std::invalid_argument);
+  auto const values_type = minhashes.child().type();
+  CUDF_EXPECTS(values_type.id() == cudf::type_id::UINT32 ||
+                 values_type.id() == cudf::type_id::UINT64,
+               "Minhash values must be UINT32 or UINT64",
+               std::invalid_argument);
+
+  auto const output_type = cudf::data_type{cudf::type_id::UINT64};
+  if (minhashes.is_empty()) {
+    return cudf::lists::detail::make_empty_lists_column(output_type, stream, mr);
+  }
+
+  auto const d_list_offsets = minhashes.offsets_begin();
+  CUDF_EXPECTS(thrust::all_of(rmm::exec_policy(stream),
+                              thrust::counting_iterator<cudf::size_type>(0),
+                              thrust::counting_iterator<cudf::size_type>(minhashes.size()),
+                              [d_list_offsets, rows_per_band] __device__(cudf::size_type idx) {
+                                auto const size = d_list_offsets[idx + 1] - d_list_offsets[idx];
+                                return (size % rows_per_band) == 0;
+                              }),
+               "The size of each row must be a multiple of rows_per_band",
+               std::invalid_argument);
+
+  // each row produces one value per band
+  auto const sizes_itr = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<cudf::size_type>(
+      [d_list_offsets, rows_per_band] __device__(cudf::size_type idx) {
+        return (d_list_offsets[idx + 1] - d_list_offsets[idx]) / rows_per_band;
+      }));
+  auto [offsets, total_bands] =
+    cudf::detail::make_offsets_child_column(sizes_itr, sizes_itr + minhashes.size(), stream, mr);
+
+  auto bands = cudf::make_numeric_column(output_type,
+                                         static_cast<cudf::size_type>(total_bands),
+                                         cudf::mask_state::UNALLOCATED,
+                                         stream,
+                                         mr);
+  auto const value_size = static_cast<cudf::size_type>(cudf::size_of(values_type));
+  thrust::for_each_n(rmm::exec_policy_nosync(stream),
+                     thrust::counting_iterator<cudf::size_type>(0),
+                     minhashes.size(),
+                     lsh_bands_fn{minhashes.child().data<char>(),
+                                  d_list_offsets,
+                                  offsets->view().data<cudf::size_type>(),
+                                  value_size,
+                                  rows_per_band,
+                                  bands->mutable_view().data<uint64_t>()});
+
+  return make_lists_column(minhashes.size(),
+                           std::move(offsets),
+                           std::move(bands),
+                           minhashes.null_count(),
+                           cudf::detail::copy_bitmask(minhashes.parent(), stream, mr),
+                           stream,
+                           mr);
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> minhash(cudf::strings_column_view const& input,
@@ -276,4 +496,37 @@ std::unique_ptr<cudf::column> minhash64(cudf::strings_column_view const& input,
   return detail::minhash64(input, seeds, width, stream, mr);
 }
 
+std::unique_ptr<cudf::column> minhash_permuted(cudf::strings_column_view const& input,
+                                               uint32_t seed,
+                                               cudf::device_span<uint32_t const> parameter_a,
+                                               cudf::device_span<uint32_t const> parameter_b,
+                                               cudf::size_type width,
+                                               rmm::cuda_stream_view stream,
+                                               rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_permuted(input, seed, parameter_a, parameter_b, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash64_permuted(cudf::strings_column_view const& input,
+                                                 uint64_t seed,
+                                                 cudf::device_span<uint64_t const> parameter_a,
+                                                 cudf::device_span<uint64_t const> parameter_b,
+                                                 cudf::size_type width,
+                                                 rmm::cuda_stream_view stream,
+                                                 rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash64_permuted(input, seed, parameter_a, parameter_b, width, stream, mr);
+}
+
+std::unique_ptr<cudf::column> minhash_lsh_bands(cudf::lists_column_view const& minhashes,
+                                                cudf::size_type rows_per_band,
+                                                rmm::cuda_stream_view stream,
+                                                rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::minhash_lsh_bands(minhashes, rows_per_band, stream, mr);
+}
+
 }  // namespace nvtext
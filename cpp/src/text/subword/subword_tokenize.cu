@@ -22,6 +22,7 @@
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/sequence.hpp>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
@@ -33,12 +34,17 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/fill.h>
 #include <thrust/for_each.h>
 #include <thrust/functional.h>
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/tabulate.h>
 #include <thrust/transform_scan.h>
 
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
 namespace nvtext {
 namespace detail {
 namespace {
@@ -136,6 +142,140 @@ CUDF_KERNEL void kernel_compute_tensor_metadata(
   }
 }
 
+/**
+ * @brief Computes the number of output tensor rows for each string
+ *
+ * @param device_offsets Offsets to each string's token-ids
+ * @param strings_count Number of strings
+ * @param max_sequence_length Maximum number of tokens in a row
+ * @param stride Number of tokens in sub-rows
+ * @param do_truncate True if tokens should not spill into sub-rows in the output
+ * @param offsets_per_tensor Output offsets to each string's tensor rows
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return Total number of output tensor rows
+ */
+uint32_t compute_offsets_per_tensor(int64_t const* device_offsets,
+                                    cudf::size_type strings_count,
+                                    uint32_t max_sequence_length,
+                                    uint32_t stride,
+                                    bool do_truncate,
+                                    rmm::device_uvector<uint32_t>& offsets_per_tensor,
+                                    rmm::cuda_stream_view stream)
+{
+  // Each string can create 1 or more tensor entries.
+  // Compute the string-per-tensor offsets values by scanning
+  // over the number of tokens for each string.
+  thrust::transform_exclusive_scan(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<cudf::size_type>(0),
+    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
+    offsets_per_tensor.begin(),
+    [device_offsets, do_truncate, max_sequence_length, stride, strings_count] __device__(
+      cudf::size_type idx) {
+      uint32_t const num_tokens =
+        idx < strings_count ? device_offsets[idx + 1] - device_offsets[idx] : 0;
+      if (do_truncate || num_tokens <= max_sequence_length) return uint32_t{1};
+      return 1 + ((num_tokens - max_sequence_length + stride - 1) / stride);
+    },
+    uint32_t{0},
+    thrust::plus<uint32_t>());
+  // last element is the total number of output rows
+  return offsets_per_tensor.element(strings_count, stream);
+}
+
+/**
+ * @brief Builds the final tensor data from the tokenizer output
+ *
+ * @param device_token_ids Tokens from tokenizer
+ * @param device_offsets Offsets to each string's token-ids
+ * @param d_offsets_per_tensor Offsets to each string's tensor rows
+ * @param strings_count Number of strings
+ * @param nrows_tensor_token_ids Total number of output tensor rows
+ * @param max_sequence_length Maximum number of tokens in a row
+ * @param stride Number of tokens in sub-rows
+ * @param do_truncate True if tokens should not spill into sub-rows in the output
+ * @param d_row2tensor Working memory of `nrows_tensor_token_ids` elements
+ * @param d_row2row_within_tensor Working memory of `nrows_tensor_token_ids` elements
+ * @param d_token_ids Output token-ids
+ * @param d_attn_mask Output attention mask
+ * @param d_metadata Output metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void compute_tensor(uint32_t const* device_token_ids,
+                    int64_t const* device_offsets,
+                    uint32_t const* d_offsets_per_tensor,
+                    cudf::size_type strings_count,
+                    uint32_t nrows_tensor_token_ids,
+                    uint32_t max_sequence_length,
+                    uint32_t stride,
+                    bool do_truncate,
+                    uint32_t* d_row2tensor,
+                    uint32_t* d_row2row_within_tensor,
+                    uint32_t* d_token_ids,
+                    uint32_t* d_attn_mask,
+                    uint32_t* d_metadata,
+                    rmm::cuda_stream_view stream)
+{
+  // compute global_row to tensor, and global_row to within_tensor_row correspondence
+  thrust::for_each_n(
+    rmm::exec_policy(stream),
+    thrust::make_counting_iterator<uint32_t>(0),
+    strings_count,
+    [d_offsets_per_tensor, d_row2tensor, d_row2row_within_tensor] __device__(auto idx) {
+      uint32_t offset = d_offsets_per_tensor[idx];
+      uint32_t nrows  = d_offsets_per_tensor[idx + 1] - offset;
+      for (uint32_t jdx = 0; jdx < nrows; ++jdx) {
+        d_row2tensor[jdx + offset]            = idx;
+        d_row2row_within_tensor[jdx + offset] = jdx;
+      }
+    });
+
+  // compute final-tensor, mask, and metadata
+  constexpr int block_size = 256;
+  cudf::detail::grid_1d const grid{
+    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
+  kernel_compute_tensor_metadata<<<grid.num_blocks,
+                                   grid.num_threads_per_block,
+                                   0,
+                                   stream.value()>>>(device_token_ids,
+                                                     device_offsets,
+                                                     d_row2tensor,
+                                                     d_row2row_within_tensor,
+                                                     max_sequence_length,
+                                                     nrows_tensor_token_ids,
+                                                     stride,
+                                                     do_truncate,
+                                                     d_token_ids,
+                                                     d_attn_mask,
+                                                     d_metadata);
+}
+
+/**
+ * @brief Writes the output of a batch with no tokens
+ *
+ * @param size Number of output rows
+ * @param max_sequence_length Number of token-ids in each row
+ * @param d_token_ids Output token-ids
+ * @param d_attn_mask Output attention mask
+ * @param d_metadata Output metadata
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ */
+void fill_empty_tensor(cudf::size_type size,
+                       uint32_t max_sequence_length,
+                       uint32_t* d_token_ids,
+                       uint32_t* d_attn_mask,
+                       uint32_t* d_metadata,
+                       rmm::cuda_stream_view stream)
+{
+  auto const tensor_size = static_cast<std::size_t>(size) * max_sequence_length;
+  thrust::fill_n(rmm::exec_policy_nosync(stream), d_token_ids, tensor_size, 0u);
+  thrust::fill_n(rmm::exec_policy_nosync(stream), d_attn_mask, tensor_size, 0u);
+  thrust::tabulate(rmm::exec_policy(stream),
+                   d_metadata,
+                   d_metadata + size * 3,
+                   [] __device__(auto idx) { return ((idx % 3) == 0) ? idx : 0; });
+}
+
 // this happens if there are no tokens in the input
 tokenizer_result build_empty_result(cudf::size_type size,
                                     uint32_t max_sequence_length,
@@ -158,6 +298,18 @@ tokenizer_result build_empty_result(cudf::size_type size,
     0, max_sequence_length, std::move(ids), std::move(mask), std::move(metadata)};
 }
 
+void validate_parameters(uint32_t max_sequence_length, uint32_t stride, uint32_t max_rows_tensor)
+{
+  CUDF_EXPECTS(stride <= max_sequence_length,
+               "stride must be less than or equal to max_sequence_length");
+  if (max_rows_tensor == 0) { return; }
+  CUDF_EXPECTS(
+    max_sequence_length <=
+      (static_cast<std::size_t>(std::numeric_limits<cudf::size_type>::max()) / max_rows_tensor),
+    "max_sequence_length times number of input rows exceeds the column size limit",
+    std::overflow_error);
+}
+
 }  // namespace
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -195,50 +347,21 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
   auto device_offsets   = tokens.second->data();
 
   // Format output from tokenizer
-  // Each string can create 1 or more tensor entries.
-  // Compute the string-per-tensor offsets values by scanning
-  // over the number of tokens for each string.
   rmm::device_uvector<uint32_t> offsets_per_tensor(strings_count + 1, stream);
-  auto d_offsets_per_tensor = offsets_per_tensor.data();
-
-  thrust::transform_exclusive_scan(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<cudf::size_type>(0),
-    thrust::make_counting_iterator<cudf::size_type>(strings_count + 1),
-    offsets_per_tensor.begin(),
-    [device_offsets, do_truncate, max_sequence_length, stride, strings_count] __device__(
-      cudf::size_type idx) {
-      uint32_t const num_tokens =
-        idx < strings_count ? device_offsets[idx + 1] - device_offsets[idx] : 0;
-      if (do_truncate || num_tokens <= max_sequence_length) return uint32_t{1};
-      return 1 + ((num_tokens - max_sequence_length + stride - 1) / stride);
-    },
-    uint32_t{0},
-    thrust::plus<uint32_t>());
-  // last element is the total number of output rows
-  uint32_t const nrows_tensor_token_ids = offsets_per_tensor.element(strings_count, stream);
+  uint32_t const nrows_tensor_token_ids = compute_offsets_per_tensor(device_offsets,
+                                                                     strings_count,
+                                                                     max_sequence_length,
+                                                                     stride,
+                                                                     do_truncate,
+                                                                     offsets_per_tensor,
+                                                                     stream);
   // if there are no tokens at all, build a specific empty result
   if (nrows_tensor_token_ids == 0) {
     return build_empty_result(strings_count, max_sequence_length, stream, mr);
   }
 
-  // compute global_row to tensor, and global_row to within_tensor_row correspondence
   rmm::device_uvector<uint32_t> row2tensor(nrows_tensor_token_ids, stream);
-  auto d_row2tensor = row2tensor.data();
   rmm::device_uvector<uint32_t> row2row_within_tensor(nrows_tensor_token_ids, stream);
-  auto d_row2row_within_tensor = row2row_within_tensor.data();
-  thrust::for_each_n(
-    rmm::exec_policy(stream),
-    thrust::make_counting_iterator<uint32_t>(0),
-    strings_count,
-    [d_offsets_per_tensor, d_row2tensor, d_row2row_within_tensor] __device__(auto idx) {
-      uint32_t offset = d_offsets_per_tensor[idx];
-      uint32_t nrows  = d_offsets_per_tensor[idx + 1] - offset;
-      for (uint32_t jdx = 0; jdx < nrows; ++jdx) {
-        d_row2tensor[jdx + offset]            = idx;
-        d_row2row_within_tensor[jdx + offset] = jdx;
-      }
-    });
 
   // create output data columns
   auto tensor_token_ids = cudf::make_numeric_column(cudf::data_type{cudf::type_id::UINT32},
@@ -258,25 +381,20 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                                    stream,
                                                    mr);
 
-  // compute final-tensor, mask, and metadata
-  constexpr int block_size = 256;
-  cudf::detail::grid_1d const grid{
-    static_cast<cudf::size_type>(nrows_tensor_token_ids * max_sequence_length), block_size};
-  kernel_compute_tensor_metadata<<<grid.num_blocks,
-                                   grid.num_threads_per_block,
-                                   0,
-                                   stream.value()>>>(
-    device_token_ids,
-    device_offsets,
-    d_row2tensor,
-    d_row2row_within_tensor,
-    max_sequence_length,
-    nrows_tensor_token_ids,
-    stride,
-    do_truncate,
-    tensor_token_ids->mutable_view().data<uint32_t>(),
-    tensor_attention_mask->mutable_view().data<uint32_t>(),
-    tensor_metadata->mutable_view().data<uint32_t>());
+  compute_tensor(device_token_ids,
+                 device_offsets,
+                 offsets_per_tensor.data(),
+                 strings_count,
+                 nrows_tensor_token_ids,
+                 max_sequence_length,
+                 stride,
+                 do_truncate,
+                 row2tensor.data(),
+                 row2row_within_tensor.data(),
+                 tensor_token_ids->mutable_view().data<uint32_t>(),
+                 tensor_attention_mask->mutable_view().data<uint32_t>(),
+                 tensor_metadata->mutable_view().data<uint32_t>(),
+                 stream);
 
   return tokenizer_result{nrows_tensor_token_ids,
                           max_sequence_length,
@@ -285,6 +403,126 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                           std::move(tensor_metadata)};
 }
 
+/**
+ * @brief Working state of a subword_tokenizer_stream
+ *
+ * Two slots of working memory are used alternately by consecutive batches.
+ * Each slot is only used on its own stream so a batch never overwrites the
+ * working memory of the previous batch before that batch has finished.
+ */
+class subword_tokenizer_stream_impl {
+ public:
+  subword_tokenizer_stream_impl(hashed_vocabulary const& vocab_table,
+                                uint32_t max_sequence_length,
+                                uint32_t stride,
+                                bool do_lower_case,
+                                bool do_truncate,
+                                uint32_t max_rows_tensor,
+                                rmm::cuda_stream_view stream,
+                                rmm::device_async_resource_ref mr)
+    : _tokenizer(vocab_table, max_sequence_length, stride, do_truncate, do_lower_case),
+      _max_sequence_length{max_sequence_length},
+      _stride{stride},
+      _do_truncate{do_truncate},
+      _max_rows_tensor{max_rows_tensor},
+      _streams{cudf::detail::fork_streams(stream, num_slots)}
+  {
+    for (auto const slot_stream : _streams) {
+      _slots.push_back(slot{rmm::device_uvector<uint32_t>(max_rows_tensor + 1, slot_stream, mr),
+                            rmm::device_uvector<uint32_t>(max_rows_tensor, slot_stream, mr),
+                            rmm::device_uvector<uint32_t>(max_rows_tensor, slot_stream, mr)});
+    }
+  }
+
+  uint32_t tokenize(cudf::strings_column_view const& input,
+                    cudf::device_span<uint32_t> token_ids,
+                    cudf::device_span<uint32_t> attention_mask,
+                    cudf::device_span<uint32_t> metadata,
+                    rmm::cuda_stream_view stream)
+  {
+    auto const strings_count = input.size();
+    if (strings_count == input.null_count()) { return 0; }
+    // every string produces at least one output row
+    CUDF_EXPECTS(static_cast<std::size_t>(strings_count) <= _max_rows_tensor,
+                 "batch produces more than max_rows_tensor rows",
+                 std::invalid_argument);
+
+    auto& work             = _slots[_next];
+    auto const slot_stream = _streams[_next];
+    _next                  = (_next + 1) % num_slots;
+    // the batch starts after the work already submitted to the caller's stream
+    auto const wait_streams = std::vector<rmm::cuda_stream_view>{stream};
+    cudf::detail::join_streams(wait_streams, slot_stream);
+
+    auto const tokens      = _tokenizer.tokenize(input, slot_stream);
+    auto const d_token_ids = tokens.first->data();
+    auto const d_offsets   = tokens.second->data();
+    uint32_t const nrows   = compute_offsets_per_tensor(d_offsets,
+                                                      strings_count,
+                                                      _max_sequence_length,
+                                                      _stride,
+                                                      _do_truncate,
+                                                      work.offsets_per_tensor,
+                                                      slot_stream);
+    auto const output_rows = nrows == 0 ? static_cast<uint32_t>(strings_count) : nrows;
+    CUDF_EXPECTS(output_rows <= _max_rows_tensor,
+                 "batch produces more than max_rows_tensor rows",
+                 std::invalid_argument);
+    auto const tensor_size = static_cast<std::size_t>(output_rows) * _max_sequence_length;
+    CUDF_EXPECTS(token_ids.size() >= tensor_size && attention_mask.size() >= tensor_size &&
+                   metadata.size() >= static_cast<std::size_t>(output_rows) * 3,
+                 "output buffers are too small for the batch",
+                 std::invalid_argument);
+
+    // if there are no tokens at all, write the same output as subword_tokenize
+    if (nrows == 0) {
+      fill_empty_tensor(strings_count,
+                        _max_sequence_length,
+                        token_ids.data(),
+                        attention_mask.data(),
+                        metadata.data(),
+                        slot_stream);
+      return 0;
+    }
+
+    compute_tensor(d_token_ids,
+                   d_offsets,
+                   work.offsets_per_tensor.data(),
+                   strings_count,
+                   nrows,
+                   _max_sequence_length,
+                   _stride,
+                   _do_truncate,
+                   work.row2tensor.data(),
+                   work.row2row_within_tensor.data(),
+                   token_ids.data(),
+                   attention_mask.data(),
+                   metadata.data(),
+                   slot_stream);
+    return nrows;
+  }
+
+  void synchronize(rmm::cuda_stream_view stream) { cudf::detail::join_streams(_streams, stream); }
+
+ private:
+  static constexpr std::size_t num_slots = 2;
+
+  struct slot {
+    rmm::device_uvector<uint32_t> offsets_per_tensor;
+    rmm::device_uvector<uint32_t> row2tensor;
+    rmm::device_uvector<uint32_t> row2row_within_tensor;
+  };
+
+  wordpiece_tokenizer _tokenizer;
+  uint32_t const _max_sequence_length;
+  uint32_t const _stride;
+  bool const _do_truncate;
+  std::size_t const _max_rows_tensor;
+  std::vector<rmm::cuda_stream_view> const _streams;
+  std::vector<slot> _slots;
+  std::size_t _next{0};
+};
+
 }  // namespace detail
 
 tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
@@ -306,4 +544,46 @@ tokenizer_result subword_tokenize(cudf::strings_column_view const& strings,
                                   mr);
 }
 
+subword_tokenizer_stream::subword_tokenizer_stream(hashed_vocabulary const& vocabulary_table,
+                                                   uint32_t max_sequence_length,
+                                                   uint32_t stride,
+                                                   bool do_lower_case,
+                                                   bool do_truncate,
+                                                   uint32_t max_rows_tensor,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  detail::validate_parameters(max_sequence_length, stride, max_rows_tensor);
+  _impl = std::make_unique<detail::subword_tokenizer_stream_impl>(vocabulary_table,
+                                                                  max_sequence_length,
+                                                                  stride,
+                                                                  do_lower_case,
+                                                                  do_truncate,
+                                                                  max_rows_tensor,
+                                                                  stream,
+                                                                  mr);
+}
+
+subword_tokenizer_stream::~subword_tokenizer_stream() = default;
+subword_tokenizer_stream::subword_tokenizer_stream(subword_tokenizer_stream&&) noexcept = default;
+subword_tokenizer_stream& subword_tokenizer_stream::operator=(subword_tokenizer_stream&&) noexcept =
+  default;
+
+uint32_t subword_tokenizer_stream::tokenize(cudf::strings_column_view const& input,
+                                            cudf::device_span<uint32_t> token_ids,
+                                            cudf::device_span<uint32_t> attention_mask,
+                                            cudf::device_span<uint32_t> metadata,
+                                            rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  return _impl->tokenize(input, token_ids, attention_mask, metadata, stream);
+}
+
+void subword_tokenizer_stream::synchronize(rmm::cuda_stream_view stream)
+{
+  CUDF_FUNC_RANGE();
+  _impl->synchronize(stream);
+}
+
 }  // namespace nvtext
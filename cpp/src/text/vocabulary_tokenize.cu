@@ -15,6 +15,7 @@
  */
 
 #include "text/utilities/tokenize_ops.cuh"
+#include "text/vocabulary_tokenize.cuh"
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_device_view.cuh>
@@ -26,6 +27,7 @@
 #include <cudf/detail/offsets_iterator_factory.cuh>
 #include <cudf/detail/sizes_to_offsets_iterator.cuh>
 #include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
 #include <cudf/strings/detail/utilities.hpp>
 #include <cudf/strings/string_view.cuh>
@@ -40,6 +42,7 @@
 
 #include <cub/cub.cuh>
 #include <cuco/static_map.cuh>
+#include <cuda/functional>
 #include <thrust/copy.h>
 #include <thrust/distance.h>
 #include <thrust/execution_policy.h>
@@ -47,93 +50,142 @@
 #include <thrust/logical.h>
 #include <thrust/transform.h>
 
+#include <algorithm>
+#include <numeric>
+#include <vector>
+
 namespace nvtext {
+
+struct key_pair {
+  __device__ auto operator()(cudf::size_type idx) const noexcept
+  {
+    return cuco::make_pair(idx, idx);
+  }
+};
+
 namespace detail {
 namespace {
 
-using string_hasher_type = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>;
-using hash_value_type    = string_hasher_type::result_type;
+using perfect_hash_value = perfect_hasher_type::result_type;
 
 /**
- * @brief Hasher function used for building and using the cuco static-map
+ * @brief Finds a displacement pair for each bin so no two keys share a slot
+ *
+ * The bins are placed in decreasing size order. For each bin the displacements
+ * are tried in order until all of its keys land in free slots.
  *
- * This takes advantage of heterogeneous lookup feature in cuco static-map which
- * allows inserting with one type (index) and looking up with a different type (string).
+ * @param hashes Hash of each key
+ * @param fn Bin and slot functions for the table
+ * @param displacements Output two values per bin
+ * @param table Output key for each slot
+ * @return true if all the bins were placed
  */
-struct vocab_hasher {
-  cudf::column_device_view const d_strings;
-  string_hasher_type hasher{};
-  // used by insert
-  __device__ hash_value_type operator()(cudf::size_type index) const
-  {
-    return hasher(d_strings.element<cudf::string_view>(index));
+bool place_bins(std::vector<perfect_hash_value> const& hashes,
+                perfect_hash_fn const& fn,
+                std::vector<uint32_t>& displacements,
+                std::vector<perfect_hash_entry>& table)
+{
+  // number of d0 values tried for each bin before giving up
+  constexpr uint64_t max_d0 = 16;
+
+  std::vector<std::vector<cudf::size_type>> bins(fn.num_bins);
+  for (std::size_t idx = 0; idx < hashes.size(); ++idx) {
+    bins[fn.bin(hashes[idx])].push_back(static_cast<cudf::size_type>(idx));
   }
-  // used by find
-  __device__ hash_value_type operator()(cudf::string_view const& s) const { return hasher(s); }
-};
+  std::vector<std::size_t> order(fn.num_bins);
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&bins](auto lhs, auto rhs) {
+    return bins[lhs].size() > bins[rhs].size();
+  });
+
+  std::vector<bool> used(fn.table_size, false);
+  std::vector<uint64_t> slots;
+  for (auto const bin : order) {
+    auto const& keys = bins[bin];
+    if (keys.empty()) { break; }  // all the remaining bins are empty
+    auto placed = false;
+    for (uint64_t d0 = 0; d0 < max_d0 && !placed; ++d0) {
+      for (uint64_t d1 = 0; d1 < fn.table_size && !placed; ++d1) {
+        slots.clear();
+        for (auto const key : keys) {
+          auto const slot = fn.slot(hashes[key], d0, d1);
+          if (used[slot] || std::find(slots.begin(), slots.end(), slot) != slots.end()) { break; }
+          slots.push_back(slot);
+        }
+        if (slots.size() != keys.size()) { continue; }
+        for (std::size_t idx = 0; idx < keys.size(); ++idx) {
+          used[slots[idx]]  = true;
+          table[slots[idx]] = perfect_hash_entry{keys[idx], keys[idx]};
+        }
+        displacements[bin * 2]     = static_cast<uint32_t>(d0);
+        displacements[bin * 2 + 1] = static_cast<uint32_t>(d1);
+        placed                     = true;
+      }
+    }
+    if (!placed) { return false; }
+  }
+  return true;
+}
 
 /**
- * @brief Equal function used for building and using the cuco static-map
+ * @brief Builds a perfect hash table for the vocabulary
+ *
+ * The keys are hashed on the device and the displacements of the bins are
+ * found on the host. The table size starts at the number of keys (minimal)
+ * and is only grown if a bin cannot be placed.
  *
- * This takes advantage of heterogeneous lookup feature in cuco static-map which
- * allows inserting with one type (index) and looking up with a different type (string).
+ * @param d_vocabulary Vocabulary strings
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @param mr Device memory resource used to allocate the table
+ * @return The device table
  */
-struct vocab_equal {
-  cudf::column_device_view const d_strings;
-  // used by insert
-  __device__ bool operator()(cudf::size_type lhs, cudf::size_type rhs) const noexcept
-  {
-    return lhs == rhs;  // all rows are expected to be unique
-  }
-  // used by find
-  __device__ bool operator()(cudf::size_type lhs, cudf::string_view const& rhs) const noexcept
-  {
-    return d_strings.element<cudf::string_view>(lhs) == rhs;
+std::unique_ptr<perfect_hash_table> build_perfect_hash(cudf::column_device_view const& d_vocabulary,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
+{
+  auto const size = static_cast<uint64_t>(d_vocabulary.size());
+  auto d_hashes   = rmm::device_uvector<perfect_hash_value>(size, stream);
+  thrust::transform(rmm::exec_policy_nosync(stream),
+                    d_vocabulary.begin<cudf::string_view>(),
+                    d_vocabulary.end<cudf::string_view>(),
+                    d_hashes.begin(),
+                    cuda::proclaim_return_type<perfect_hash_value>(
+                      [] __device__(cudf::string_view d_str) -> perfect_hash_value {
+                        return perfect_hasher_type{}(d_str);
+                      }));
+  auto const hashes = cudf::detail::make_std_vector_sync(d_hashes, stream);
+
+  constexpr uint64_t keys_per_bin = 4;
+  constexpr int max_attempts      = 8;
+
+  auto table_size = size;
+  for (int attempt = 0; attempt < max_attempts; ++attempt) {
+    auto const fn      = perfect_hash_fn{(size + keys_per_bin - 1) / keys_per_bin, table_size};
+    auto displacements = std::vector<uint32_t>(fn.num_bins * 2, 0);
+    auto table         = std::vector<perfect_hash_entry>(table_size, perfect_hash_entry{-1, -1});
+    if (place_bins(hashes, fn, displacements, table)) {
+      return std::make_unique<perfect_hash_table>(
+        perfect_hash_table{fn,
+                           cudf::detail::make_device_uvector_sync(displacements, stream, mr),
+                           cudf::detail::make_device_uvector_sync(table, stream, mr)});
+    }
+    table_size += table_size / 8 + 1;  // more free slots make placement easier
   }
-};
+  CUDF_FAIL("unable to build a perfect hash for the vocabulary; entries must be unique");
+}
 
-using probe_scheme        = cuco::linear_probing<1, vocab_hasher>;
-using cuco_storage        = cuco::storage<1>;
-using vocabulary_map_type = cuco::static_map<cudf::size_type,
-                                             cudf::size_type,
-                                             cuco::extent<std::size_t>,
-                                             cuda::thread_scope_device,
-                                             vocab_equal,
-                                             probe_scheme,
-                                             cudf::detail::cuco_allocator,
-                                             cuco_storage>;
 }  // namespace
 }  // namespace detail
 
-// since column_device_view::create returns is a little more than
-// std::unique_ptr<column_device_view> this helper simplifies the return type in a maintainable way
-using col_device_view = std::invoke_result_t<decltype(&cudf::column_device_view::create),
-                                             cudf::column_view,
-                                             rmm::cuda_stream_view>;
-
-struct tokenize_vocabulary::tokenize_vocabulary_impl {
-  std::unique_ptr<cudf::column> const vocabulary;
-  col_device_view const d_vocabulary;
-  std::unique_ptr<detail::vocabulary_map_type> vocabulary_map;
-
-  auto get_map_ref() const { return vocabulary_map->ref(cuco::op::find); }
-
-  tokenize_vocabulary_impl(std::unique_ptr<cudf::column>&& vocab,
-                           col_device_view&& d_vocab,
-                           std::unique_ptr<detail::vocabulary_map_type>&& map)
-    : vocabulary(std::move(vocab)), d_vocabulary(std::move(d_vocab)), vocabulary_map(std::move(map))
-  {
-  }
-};
-
-struct key_pair {
-  __device__ auto operator()(cudf::size_type idx) const noexcept
-  {
-    return cuco::make_pair(idx, idx);
-  }
-};
+tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+  : tokenize_vocabulary(input, vocabulary_lookup::HASH_MAP, stream, mr)
+{
+}
 
 tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
+                                         vocabulary_lookup lookup,
                                          rmm::cuda_stream_view stream,
                                          rmm::device_async_resource_ref mr)
 {
@@ -144,14 +196,21 @@ tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
   auto vocabulary   = std::make_unique<cudf::column>(input.parent(), stream, mr);
   auto d_vocabulary = cudf::column_device_view::create(vocabulary->view(), stream);
 
+  if (lookup == vocabulary_lookup::PERFECT_HASH) {
+    auto table = detail::build_perfect_hash(*d_vocabulary, stream, mr);
+    _impl      = new tokenize_vocabulary_impl(
+      std::move(vocabulary), std::move(d_vocabulary), nullptr, std::move(table));
+    return;
+  }
+
   auto vocab_map = std::make_unique<detail::vocabulary_map_type>(
     static_cast<size_t>(vocabulary->size() * 2),
     cuco::empty_key{-1},
     cuco::empty_value{-1},
     detail::vocab_equal{*d_vocabulary},
-    detail::probe_scheme{detail::vocab_hasher{*d_vocabulary}},
+    detail::vocab_probe_scheme{detail::vocab_hasher{*d_vocabulary}},
     cuco::thread_scope_device,
-    detail::cuco_storage{},
+    detail::vocab_cuco_storage{},
     cudf::detail::cuco_allocator{stream},
     stream.value());
 
@@ -160,7 +219,7 @@ tokenize_vocabulary::tokenize_vocabulary(cudf::strings_column_view const& input,
   vocab_map->insert_async(iter, iter + vocabulary->size(), stream.value());
 
   _impl = new tokenize_vocabulary_impl(
-    std::move(vocabulary), std::move(d_vocabulary), std::move(vocab_map));
+    std::move(vocabulary), std::move(d_vocabulary), std::move(vocab_map), nullptr);
 }
 tokenize_vocabulary::~tokenize_vocabulary() { delete _impl; }
 
@@ -172,6 +231,15 @@ std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view c
   return std::make_unique<tokenize_vocabulary>(input, stream, mr);
 }
 
+std::unique_ptr<tokenize_vocabulary> load_vocabulary(cudf::strings_column_view const& input,
+                                                     vocabulary_lookup lookup,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return std::make_unique<tokenize_vocabulary>(input, lookup, stream, mr);
+}
+
 namespace detail {
 namespace {
 
@@ -352,25 +420,24 @@ struct transform_tokenizer_fn {
   }
 };
 
-}  // namespace
-
-std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
-                                                       tokenize_vocabulary const& vocabulary,
-                                                       cudf::string_scalar const& delimiter,
-                                                       cudf::size_type default_id,
-                                                       rmm::cuda_stream_view stream,
-                                                       rmm::device_async_resource_ref mr)
+/**
+ * @brief Tokenizes the input and looks up each token with the given lookup object
+ *
+ * @tparam MapRefType Type of the lookup object for calling find()
+ */
+template <typename MapRefType>
+std::unique_ptr<cudf::column> tokenize_with_lookup(cudf::strings_column_view const& input,
+                                                   MapRefType map_ref,
+                                                   cudf::string_view const d_delimiter,
+                                                   cudf::size_type default_id,
+                                                   rmm::cuda_stream_view stream,
+                                                   rmm::device_async_resource_ref mr)
 {
-  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
-
   auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
-  if (input.size() == input.null_count()) { return cudf::make_empty_column(output_type); }
 
   // count the tokens per string and build the offsets from the counts
-  auto const d_strings   = cudf::column_device_view::create(input.parent(), stream);
-  auto const d_delimiter = delimiter.value(stream);
-  auto map_ref           = vocabulary._impl->get_map_ref();
-  auto const zero_itr    = thrust::make_counting_iterator<cudf::size_type>(0);
+  auto const d_strings = cudf::column_device_view::create(input.parent(), stream);
+  auto const zero_itr  = thrust::make_counting_iterator<cudf::size_type>(0);
 
   if ((input.chars_size(stream) / (input.size() - input.null_count())) < AVG_CHAR_BYTES_THRESHOLD) {
     auto const sizes_itr =
@@ -461,6 +528,46 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
                                  mr);
 }
 
+}  // namespace
+
+std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
+                                                       tokenize_vocabulary const& vocabulary,
+                                                       cudf::string_scalar const& delimiter,
+                                                       cudf::size_type default_id,
+                                                       rmm::cuda_stream_view stream,
+                                                       rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+
+  auto const output_type = cudf::data_type{cudf::type_to_id<cudf::size_type>()};
+  if (input.size() == input.null_count()) { return cudf::make_empty_column(output_type); }
+
+  auto const d_delimiter = delimiter.value(stream);
+  return vocabulary._impl->visit_lookup([&](auto map_ref) {
+    return tokenize_with_lookup(input, map_ref, d_delimiter, default_id, stream, mr);
+  });
+}
+
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  std::vector<cudf::strings_column_view> const& inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(delimiter.is_valid(stream), "Parameter delimiter must be valid");
+  std::vector<std::unique_ptr<cudf::column>> results(inputs.size());
+  if (inputs.empty()) { return results; }
+
+  // the columns are tokenized on `stream` so the results are ordered with the caller's work
+  for (std::size_t idx = 0; idx < inputs.size(); ++idx) {
+    results[idx] =
+      tokenize_with_vocabulary(inputs[idx], vocabulary, delimiter, default_id, stream, mr);
+  }
+  return results;
+}
+
 }  // namespace detail
 
 std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view const& input,
@@ -474,4 +581,16 @@ std::unique_ptr<cudf::column> tokenize_with_vocabulary(cudf::strings_column_view
   return detail::tokenize_with_vocabulary(input, vocabulary, delimiter, default_id, stream, mr);
 }
 
+std::vector<std::unique_ptr<cudf::column>> tokenize_with_vocabulary(
+  std::vector<cudf::strings_column_view> const& inputs,
+  tokenize_vocabulary const& vocabulary,
+  cudf::string_scalar const& delimiter,
+  cudf::size_type default_id,
+  rmm::cuda_stream_view stream,
+  rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::tokenize_with_vocabulary(inputs, vocabulary, delimiter, default_id, stream, mr);
+}
+
 }  // namespace nvtext
@@ -0,0 +1,202 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#pragma once
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/detail/cuco_helpers.hpp>
+#include <cudf/hashing/detail/murmurhash3_x64_128.cuh>
+#include <cudf/hashing/detail/murmurhash3_x86_32.cuh>
+#include <cudf/strings/string_view.cuh>
+
+#include <nvtext/tokenize.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+
+#include <cuco/static_map.cuh>
+
+#include <memory>
+#include <type_traits>
+
+namespace nvtext {
+namespace detail {
+
+using vocab_hasher_type = cudf::hashing::detail::MurmurHash3_x86_32<cudf::string_view>;
+
+/**
+ * @brief Hasher function used for building and using the cuco static-map
+ *
+ * This takes advantage of heterogeneous lookup feature in cuco static-map which
+ * allows inserting with one type (index) and looking up with a different type (string).
+ */
+struct vocab_hasher {
+  cudf::column_device_view const d_strings;
+  vocab_hasher_type hasher{};
+  // used by insert
+  __device__ vocab_hasher_type::result_type operator()(cudf::size_type index) const
+  {
+    return hasher(d_strings.element<cudf::string_view>(index));
+  }
+  // used by find
+  __device__ vocab_hasher_type::result_type operator()(cudf::string_view const& s) const
+  {
+    return hasher(s);
+  }
+};
+
+/**
+ * @brief Equal function used for building and using the cuco static-map
+ *
+ * This takes advantage of heterogeneous lookup feature in cuco static-map which
+ * allows inserting with one type (index) and looking up with a different type (string).
+ */
+struct vocab_equal {
+  cudf::column_device_view const d_strings;
+  // used by insert
+  __device__ bool operator()(cudf::size_type lhs, cudf::size_type rhs) const noexcept
+  {
+    return lhs == rhs;  // all rows are expected to be unique
+  }
+  // used by find
+  __device__ bool operator()(cudf::size_type lhs, cudf::string_view const& rhs) const noexcept
+  {
+    return d_strings.element<cudf::string_view>(lhs) == rhs;
+  }
+};
+
+using vocab_probe_scheme  = cuco::linear_probing<1, vocab_hasher>;
+using vocab_cuco_storage  = cuco::storage<1>;
+using vocabulary_map_type = cuco::static_map<cudf::size_type,
+                                             cudf::size_type,
+                                             cuco::extent<std::size_t>,
+                                             cuda::thread_scope_device,
+                                             vocab_equal,
+                                             vocab_probe_scheme,
+                                             cudf::detail::cuco_allocator,
+                                             vocab_cuco_storage>;
+
+using perfect_hasher_type = cudf::hashing::detail::MurmurHash3_x64_128<cudf::string_view>;
+using perfect_hash_entry  = cuco::pair<cudf::size_type, cudf::size_type>;
+
+/**
+ * @brief Slot of a key within a perfect hash table
+ *
+ * The 128-bit hash of a key selects a bin and two values `f1` and `f2`.
+ * Each bin has a displacement pair `(d0, d1)` chosen when the table is built so
+ * the keys of the bin are placed at `(f1 + d0 * f2 + d1) % table_size`
+ * without colliding with any other key.
+ */
+struct perfect_hash_fn {
+  uint64_t const num_bins;
+  uint64_t const table_size;
+
+  __host__ __device__ uint64_t bin(perfect_hasher_type::result_type const& h) const
+  {
+    return (h.first >> 32) % num_bins;
+  }
+  __host__ __device__ uint64_t slot(perfect_hasher_type::result_type const& h,
+                                    uint64_t d0,
+                                    uint64_t d1) const
+  {
+    auto const f1 = (h.second & 0xFFFF'FFFFul) % table_size;
+    auto const f2 = (h.second >> 32) % table_size;
+    return (f1 + d0 * f2 + d1) % table_size;
+  }
+};
+
+/**
+ * @brief Lookup object for a vocabulary built with vocabulary_lookup::PERFECT_HASH
+ *
+ * This has the same `find()` and `end()` interface as the cuco static-map
+ * reference so it can be used by the same tokenizer functions.
+ * Each lookup hashes the key once and compares it to a single vocabulary entry.
+ */
+struct perfect_hash_ref {
+  cudf::column_device_view const d_vocabulary;
+  perfect_hash_fn const fn;
+  uint32_t const* d_displacements;  // two per bin
+  perfect_hash_entry const* d_table;
+
+  __device__ perfect_hash_entry const* find(cudf::string_view const& key) const
+  {
+    auto const h     = perfect_hasher_type{}(key);
+    auto const bin   = fn.bin(h);
+    auto const slot  = fn.slot(h, d_displacements[bin * 2], d_displacements[bin * 2 + 1]);
+    auto const entry = d_table + slot;
+    auto const found =
+      entry->first >= 0 && d_vocabulary.element<cudf::string_view>(entry->first) == key;
+    return found ? entry : end();
+  }
+  __device__ perfect_hash_entry const* end() const { return nullptr; }
+};
+
+/**
+ * @brief Device data for a perfect hash table
+ */
+struct perfect_hash_table {
+  perfect_hash_fn fn;
+  rmm::device_uvector<uint32_t> displacements;
+  rmm::device_uvector<perfect_hash_entry> table;
+};
+
+}  // namespace detail
+
+// since column_device_view::create returns is a little more than
+// std::unique_ptr<column_device_view> this helper simplifies the return type in a maintainable way
+using vocab_device_view = std::invoke_result_t<decltype(&cudf::column_device_view::create),
+                                               cudf::column_view,
+                                               rmm::cuda_stream_view>;
+
+struct tokenize_vocabulary::tokenize_vocabulary_impl {
+  std::unique_ptr<cudf::column> const vocabulary;
+  vocab_device_view const d_vocabulary;
+  std::unique_ptr<detail::vocabulary_map_type> vocabulary_map;  // for HASH_MAP
+  std::unique_ptr<detail::perfect_hash_table> perfect_hash;     // for PERFECT_HASH
+
+  auto get_map_ref() const { return vocabulary_map->ref(cuco::op::find); }
+  detail::perfect_hash_ref get_perfect_hash_ref() const
+  {
+    return detail::perfect_hash_ref{*d_vocabulary,
+                                    perfect_hash->fn,
+                                    perfect_hash->displacements.data(),
+                                    perfect_hash->table.data()};
+  }
+
+  /**
+   * @brief Calls `fn` with the lookup object of this vocabulary
+   *
+   * Both lookup objects support `find(string_view)` and `end()`.
+   */
+  template <typename Fn>
+  auto visit_lookup(Fn&& fn) const
+  {
+    return perfect_hash ? fn(get_perfect_hash_ref()) : fn(get_map_ref());
+  }
+
+  tokenize_vocabulary_impl(std::unique_ptr<cudf::column>&& vocab,
+                           vocab_device_view&& d_vocab,
+                           std::unique_ptr<detail::vocabulary_map_type>&& map,
+                           std::unique_ptr<detail::perfect_hash_table>&& table)
+    : vocabulary(std::move(vocab)),
+      d_vocabulary(std::move(d_vocab)),
+      vocabulary_map(std::move(map)),
+      perfect_hash(std::move(table))
+  {
+  }
+};
+
+}  // namespace nvtext
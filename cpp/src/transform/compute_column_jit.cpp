@@ -0,0 +1,373 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/cache.hpp"
+#include "jit/util.hpp"
+
+#include <cudf/ast/detail/expression_parser.hpp>
+#include <cudf/ast/detail/expression_transformer.hpp>
+#include <cudf/ast/detail/operators.hpp>
+#include <cudf/ast/expressions.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/transform.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/traits.hpp>
+#include <cudf/utilities/type_dispatcher.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <jit_preprocessed_files/transform/jit/expression_kernel.cu.jit.hpp>
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+using ast::ast_operator;
+
+/**
+ * @brief Returns the infix C++ operator matching an AST binary operator
+ */
+std::optional<std::string> infix_operator(ast_operator op)
+{
+  switch (op) {
+    case ast_operator::ADD: return "+";
+    case ast_operator::SUB: return "-";
+    case ast_operator::MUL: return "*";
+    case ast_operator::DIV: return "/";
+    case ast_operator::EQUAL: return "==";
+    case ast_operator::NOT_EQUAL: return "!=";
+    case ast_operator::LESS: return "<";
+    case ast_operator::GREATER: return ">";
+    case ast_operator::LESS_EQUAL: return "<=";
+    case ast_operator::GREATER_EQUAL: return ">=";
+    case ast_operator::BITWISE_AND: return "&";
+    case ast_operator::BITWISE_OR: return "|";
+    case ast_operator::BITWISE_XOR: return "^";
+    case ast_operator::LOGICAL_AND: return "&&";
+    case ast_operator::LOGICAL_OR: return "||";
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Returns the device math function matching an AST unary operator
+ *
+ * These are only generated for floating-point operands where the CUDA math
+ * functions match the `std::` functions used by the expression evaluator.
+ */
+std::optional<std::string> math_function(ast_operator op)
+{
+  switch (op) {
+    case ast_operator::SIN: return "sin";
+    case ast_operator::COS: return "cos";
+    case ast_operator::TAN: return "tan";
+    case ast_operator::ARCSIN: return "asin";
+    case ast_operator::ARCCOS: return "acos";
+    case ast_operator::ARCTAN: return "atan";
+    case ast_operator::SINH: return "sinh";
+    case ast_operator::COSH: return "cosh";
+    case ast_operator::TANH: return "tanh";
+    case ast_operator::ARCSINH: return "asinh";
+    case ast_operator::ARCCOSH: return "acosh";
+    case ast_operator::ARCTANH: return "atanh";
+    case ast_operator::EXP: return "exp";
+    case ast_operator::LOG: return "log";
+    case ast_operator::SQRT: return "sqrt";
+    case ast_operator::CBRT: return "cbrt";
+    case ast_operator::CEIL: return "ceil";
+    case ast_operator::FLOOR: return "floor";
+    case ast_operator::ABS: return "fabs";
+    case ast_operator::RINT: return "rint";
+    default: return std::nullopt;
+  }
+}
+
+/**
+ * @brief Returns the CUDA source evaluating an operator on the given operands
+ *
+ * The source matches the `operator_functor` specializations of the expression evaluator.
+ * Operators without a matching translation return `std::nullopt`.
+ */
+std::optional<std::string> operator_source(ast_operator op,
+                                           std::vector<std::string> const& args,
+                                           std::vector<data_type> const& types)
+{
+  if (args.size() == 2) {
+    auto const& lhs = args[0];
+    auto const& rhs = args[1];
+    if (auto const infix = infix_operator(op); infix.has_value()) {
+      return "(" + lhs + " " + *infix + " " + rhs + ")";
+    }
+    auto const common = type_to_name(types[0]);
+    auto const cast   = [](std::string const& type, std::string const& arg) {
+      return "static_cast<" + type + ">(" + arg + ")";
+    };
+    auto const is_float = is_floating_point(types[0]);
+    auto const fmod     = std::string{types[0].id() == type_id::FLOAT32 ? "fmodf" : "fmod"};
+    switch (op) {
+      case ast_operator::TRUE_DIV:
+        return "(" + cast("double", lhs) + " / " + cast("double", rhs) + ")";
+      case ast_operator::FLOOR_DIV:
+        return "floor(" + cast("double", lhs) + " / " + cast("double", rhs) + ")";
+      case ast_operator::MOD:
+        if (is_float) { return fmod + "(" + cast(common, lhs) + ", " + cast(common, rhs) + ")"; }
+        return "(" + cast(common, lhs) + " % " + cast(common, rhs) + ")";
+      case ast_operator::PYMOD:
+        if (is_float) {
+          return fmod + "(" + fmod + "(" + cast(common, lhs) + ", " + cast(common, rhs) + ") + " +
+                 cast(common, rhs) + ", " + cast(common, rhs) + ")";
+        }
+        return "(((" + cast(common, lhs) + " % " + cast(common, rhs) + ") + " + cast(common, rhs) +
+               ") % " + cast(common, rhs) + ")";
+      default: return std::nullopt;
+    }
+  }
+
+  auto const& arg = args[0];
+  switch (op) {
+    case ast_operator::IDENTITY: return "(" + arg + ")";
+    case ast_operator::NOT: return "(!" + arg + ")";
+    case ast_operator::BIT_INVERT: return "(~" + arg + ")";
+    case ast_operator::CAST_TO_INT64: return "static_cast<int64_t>(" + arg + ")";
+    case ast_operator::CAST_TO_UINT64: return "static_cast<uint64_t>(" + arg + ")";
+    case ast_operator::CAST_TO_FLOAT64: return "static_cast<double>(" + arg + ")";
+    default: break;
+  }
+  if (auto const fn = math_function(op); fn.has_value() && is_floating_point(types[0])) {
+    return *fn + "(" + arg + ")";
+  }
+  return std::nullopt;
+}
+
+/**
+ * @brief Only numeric and bool values are used in generated kernel source
+ */
+bool is_jit_type(data_type type) { return is_numeric(type); }
+
+/**
+ * @brief Generates the CUDA source of an expression tree
+ *
+ * Each column reference and literal becomes an element of the kernel's inputs array
+ * so the generated source only depends on the structure and types of the expression.
+ * Expression trees with operators or types that cannot be translated are marked
+ * unsupported and are evaluated with the expression interpreter instead.
+ */
+class expression_source_generator : public ast::detail::expression_transformer {
+ public:
+  expression_source_generator(table_view const& table, rmm::cuda_stream_view stream)
+    : _table{table}, _stream{stream}
+  {
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::literal const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::literal const& expr) override
+  {
+    auto const type = expr.get_data_type();
+    if (!is_jit_type(type) || !expr.get_scalar().is_valid(_stream)) { return unsupported(expr); }
+    auto const index = _literals.size();
+    _literals.push_back(jit::get_data_ptr(expr.get_scalar()));
+    push("(*static_cast<" + type_to_name(type) + " const*>(inputs[NUM_COLUMNS + " +
+           std::to_string(index) + "]))",
+         type);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::column_reference const& expr) override
+  {
+    auto const type = expr.get_data_type(_table);
+    if (!is_jit_type(type)) { return unsupported(expr); }
+    auto const col_index = expr.get_column_index();
+    auto [itr, inserted] = _column_slots.try_emplace(col_index, _columns.size());
+    if (inserted) { _columns.push_back(_table.column(col_index)); }
+    push("(static_cast<" + type_to_name(type) + " const*>(inputs[" +
+           std::to_string(itr->second) + "])[row])",
+         type);
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::operation const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(ast::operation const& expr) override
+  {
+    auto const operands = expr.get_operands();
+    for (auto const& operand : operands) {
+      operand.get().accept(*this);
+    }
+    if (!_supported) { return expr; }
+
+    std::vector<std::string> args(operands.size());
+    std::vector<data_type> types(operands.size());
+    for (auto idx = operands.size(); idx-- > 0;) {
+      args[idx]  = std::move(_code.back());
+      types[idx] = _types.back();
+      _code.pop_back();
+      _types.pop_back();
+    }
+    auto const source = operator_source(expr.get_operator(), args, types);
+    if (!source.has_value()) { return unsupported(expr); }
+    push(*source, ast::detail::ast_operator_return_type(expr.get_operator(), types));
+    return expr;
+  }
+
+  /**
+   * @copydoc ast::detail::expression_transformer::visit(ast::column_name_reference const& )
+   */
+  std::reference_wrapper<ast::expression const> visit(
+    ast::column_name_reference const& expr) override
+  {
+    return unsupported(expr);
+  }
+
+  [[nodiscard]] bool is_supported() const { return _supported; }
+
+  /**
+   * @brief Returns the source of the device function evaluating the expression
+   */
+  [[nodiscard]] std::string source() const
+  {
+    return "#pragma once\n"
+           "#define NUM_COLUMNS " +
+           std::to_string(_columns.size()) +
+           "\n"
+           "template <typename TypeOut>\n"
+           "__device__ inline void GENERIC_EXPRESSION_OP(TypeOut* out,\n"
+           "                                             void const* const* inputs,\n"
+           "                                             cudf::size_type row)\n"
+           "{\n"
+           "  *out = static_cast<TypeOut>(" +
+           _code.back() +
+           ");\n"
+           "}\n";
+  }
+
+  /**
+   * @brief Returns the data of the referenced columns followed by the data of the literals
+   */
+  [[nodiscard]] std::vector<void const*> inputs() const
+  {
+    std::vector<void const*> result;
+    for (auto const& col : _columns) {
+      result.push_back(jit::get_data_ptr(col));
+    }
+    result.insert(result.end(), _literals.begin(), _literals.end());
+    return result;
+  }
+
+  /**
+   * @brief Returns the columns referenced by the expression
+   */
+  [[nodiscard]] std::vector<column_view> const& columns() const { return _columns; }
+
+ private:
+  void push(std::string code, data_type type)
+  {
+    _code.push_back(std::move(code));
+    _types.push_back(type);
+  }
+
+  std::reference_wrapper<ast::expression const> unsupported(ast::expression const& expr)
+  {
+    _supported = false;
+    return expr;
+  }
+
+  table_view const& _table;
+  rmm::cuda_stream_view _stream;
+  bool _supported{true};
+  std::vector<std::string> _code;
+  std::vector<data_type> _types;
+  std::map<size_type, std::size_t> _column_slots;
+  std::vector<column_view> _columns;
+  std::vector<void const*> _literals;
+};
+
+}  // namespace
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::cuda_stream_view stream,
+                                           rmm::device_async_resource_ref mr)
+{
+  auto const has_nulls = expr.may_evaluate_null(table, stream);
+  // the parser validates the expression the same way as compute_column
+  auto const parser      = ast::detail::expression_parser{expr, table, has_nulls, stream, mr};
+  auto const output_type = parser.output_type();
+
+  auto generator = expression_source_generator{table, stream};
+  expr.accept(generator);
+  if (!generator.is_supported() || !is_jit_type(output_type)) {
+    return compute_column(table, expr, stream, mr);
+  }
+
+  // all the translated operators return null if any operand is null
+  auto [null_mask, null_count] =
+    has_nulls ? cudf::detail::bitmask_and(table_view{generator.columns()}, stream, mr)
+              : std::pair{rmm::device_buffer{0, stream, mr}, size_type{0}};
+  auto output = make_fixed_width_column(
+    output_type, table.num_rows(), std::move(null_mask), null_count, stream, mr);
+  if (table.num_rows() == 0) { return output; }
+
+  auto const inputs   = generator.inputs();
+  auto const d_inputs = cudf::detail::make_device_uvector_async(
+    inputs, stream, rmm::mr::get_current_device_resource());
+
+  auto const kernel_name = jitify2::reflection::Template(
+                             "cudf::transformation::jit::expression_kernel")  //
+                             .instantiate(type_to_name(output_type));
+
+  // the program cache is keyed by the generated source so an expression with the
+  // same structure and types reuses the compiled kernel
+  cudf::jit::get_kernel(*transform_jit_expression_kernel_cu_jit,
+                        kernel_name,
+                        "transform/jit/expression-udf.hpp",
+                        generator.source())                 //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(table.num_rows(),                              //
+             cudf::jit::get_data_ptr(output->mutable_view()),
+             d_inputs.data());
+
+  return output;
+}
+
+}  // namespace detail
+
+std::unique_ptr<column> compute_column_jit(table_view const& table,
+                                           ast::expression const& expr,
+                                           rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::compute_column_jit(table, expr, cudf::get_default_stream(), mr);
+}
+
+}  // namespace cudf
@@ -15,17 +15,17 @@
  */
 
 #include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
+#include <cudf/detail/cuco_helpers.hpp>
 #include <cudf/detail/gather.hpp>
-#include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
-#include <cudf/detail/search.hpp>
 #include <cudf/detail/sorting.hpp>
-#include <cudf/detail/stream_compaction.hpp>
 #include <cudf/detail/transform.hpp>
+#include <cudf/hashing/detail/default_hash.cuh>
+#include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/table/table_view.hpp>
-#include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
@@ -33,38 +33,158 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuco/static_set.cuh>
+#include <cuda/functional>
+#include <thrust/copy.h>
+#include <thrust/distance.h>
+#include <thrust/gather.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scatter.h>
+#include <thrust/transform.h>
+
 #include <memory>
-#include <numeric>
 #include <utility>
 #include <vector>
 
 namespace cudf {
 namespace detail {
+namespace {
+
+using probing_scheme_type = cuco::linear_probing<
+  1,  ///< Number of threads used to handle each input key
+  cudf::experimental::row::hash::device_row_hasher<cudf::hashing::detail::default_hash,
+                                                   cudf::nullate::DYNAMIC>>;
+
+/**
+ * @brief Map every row of the input table to a representative row among the rows equal to it
+ *
+ * @param input The table to map
+ * @param stream CUDA stream used for device memory operations and kernel launches
+ * @return The index of the representative row of each row
+ */
+rmm::device_uvector<size_type> representative_rows(table_view const& input,
+                                                   rmm::cuda_stream_view stream)
+{
+  auto const num_rows  = input.num_rows();
+  auto const has_nulls = nullate::DYNAMIC{cudf::has_nested_nulls(input)};
+
+  auto const preprocessed =
+    cudf::experimental::row::hash::preprocessed_table::create(input, stream);
+  auto const comparator = cudf::experimental::row::equality::self_comparator{preprocessed};
+  auto const row_hash   = cudf::experimental::row::hash::row_hasher{preprocessed};
+  auto const d_row_hash = row_hash.device_hasher(has_nulls);
+
+  auto representatives = rmm::device_uvector<size_type>(num_rows, stream);
+
+  auto const find_representatives = [&](auto const d_key_equal) {
+    auto set = cuco::static_set{num_rows,
+                                0.5,  // desired load factor
+                                cuco::empty_key{cudf::detail::CUDF_SIZE_TYPE_SENTINEL},
+                                d_key_equal,
+                                probing_scheme_type{d_row_hash},
+                                cuco::thread_scope_device,
+                                cuco::storage<1>{},
+                                cudf::detail::cuco_allocator{stream},
+                                stream.value()};
+    thrust::transform(rmm::exec_policy(stream),
+                      thrust::make_counting_iterator<size_type>(0),
+                      thrust::make_counting_iterator<size_type>(num_rows),
+                      representatives.begin(),
+                      cuda::proclaim_return_type<size_type>(
+                        [set = set.ref(cuco::insert_and_find)] __device__(size_type idx) mutable {
+                          return *set.insert_and_find(idx).first;
+                        }));
+  };
+
+  using nan_equal_comparator =
+    cudf::experimental::row::equality::nan_equal_physical_equality_comparator;
+  if (cudf::detail::has_nested_columns(input)) {
+    find_representatives(
+      comparator.equal_to<true>(has_nulls, null_equality::EQUAL, nan_equal_comparator{}));
+  } else {
+    find_representatives(
+      comparator.equal_to<false>(has_nulls, null_equality::EQUAL, nan_equal_comparator{}));
+  }
+  return representatives;
+}
+
+}  // namespace
 
 std::pair<std::unique_ptr<table>, std::unique_ptr<column>> encode(table_view const& input_table,
                                                                   rmm::cuda_stream_view stream,
                                                                   rmm::device_async_resource_ref mr)
 {
-  auto const num_cols = input_table.num_columns();
+  // Algorithm:
+  // - Map each row to a representative of its equal rows with a hash set.
+  // - Sort only the distinct representatives to order the keys.
+  // - Look up the rank of each row's representative to get its index.
+  // This avoids a binary search of every input row into the sorted keys.
+
+  auto const num_rows = input_table.num_rows();
+  if (num_rows == 0) {
+    return std::pair(empty_like(input_table), make_empty_column(type_to_id<size_type>()));
+  }
 
-  std::vector<size_type> drop_keys(num_cols);
-  std::iota(drop_keys.begin(), drop_keys.end(), 0);
+  auto const representatives = representative_rows(input_table, stream);
 
-  auto distinct_keys = cudf::detail::distinct(input_table,
-                                              drop_keys,
-                                              duplicate_keep_option::KEEP_ANY,
-                                              null_equality::EQUAL,
-                                              nan_equality::ALL_EQUAL,
-                                              stream,
-                                              mr);
+  auto key_rows = rmm::device_uvector<size_type>(num_rows, stream);
+  auto const key_rows_end =
+    thrust::copy_if(rmm::exec_policy(stream),
+                    thrust::make_counting_iterator<size_type>(0),
+                    thrust::make_counting_iterator<size_type>(num_rows),
+                    key_rows.begin(),
+                    [representatives = representatives.begin()] __device__(size_type idx) {
+                      return representatives[idx] == idx;
+                    });
+  key_rows.resize(thrust::distance(key_rows.begin(), key_rows_end), stream);
+  auto const num_keys = static_cast<size_type>(key_rows.size());
 
+  auto const num_cols = input_table.num_columns();
   std::vector<order> column_order(num_cols, order::ASCENDING);
   std::vector<null_order> null_precedence(num_cols, null_order::AFTER);
-  auto sorted_unique_keys =
-    cudf::detail::sort(distinct_keys->view(), column_order, null_precedence, stream, mr);
 
-  auto indices_column = cudf::detail::lower_bound(
-    sorted_unique_keys->view(), input_table, column_order, null_precedence, stream, mr);
+  // Sort the distinct rows and keep their positions in the input.
+  auto const unsorted_keys = cudf::detail::gather(input_table,
+                                                  key_rows,
+                                                  out_of_bounds_policy::DONT_CHECK,
+                                                  negative_index_policy::NOT_ALLOWED,
+                                                  stream,
+                                                  rmm::mr::get_current_device_resource());
+  auto const keys_order    = cudf::detail::sorted_order(unsorted_keys->view(),
+                                                     column_order,
+                                                     null_precedence,
+                                                     stream,
+                                                     rmm::mr::get_current_device_resource());
+  auto const d_keys_order  = keys_order->view().begin<size_type>();
+  auto sorted_key_rows     = rmm::device_uvector<size_type>(num_keys, stream);
+  thrust::gather(rmm::exec_policy(stream),
+                 d_keys_order,
+                 d_keys_order + num_keys,
+                 key_rows.begin(),
+                 sorted_key_rows.begin());
+
+  // Rank of each representative row in the sorted keys.
+  auto ranks = rmm::device_uvector<size_type>(num_rows, stream);
+  thrust::scatter(rmm::exec_policy(stream),
+                  thrust::make_counting_iterator<size_type>(0),
+                  thrust::make_counting_iterator<size_type>(num_keys),
+                  sorted_key_rows.begin(),
+                  ranks.begin());
+
+  auto indices_column = make_numeric_column(
+    data_type{type_to_id<size_type>()}, num_rows, mask_state::UNALLOCATED, stream, mr);
+  thrust::gather(rmm::exec_policy(stream),
+                 representatives.begin(),
+                 representatives.end(),
+                 ranks.begin(),
+                 indices_column->mutable_view().begin<size_type>());
+
+  auto sorted_unique_keys = cudf::detail::gather(input_table,
+                                                 sorted_key_rows,
+                                                 out_of_bounds_policy::DONT_CHECK,
+                                                 negative_index_policy::NOT_ALLOWED,
+                                                 stream,
+                                                 mr);
 
   return std::pair(std::move(sorted_unique_keys), std::move(indices_column));
 }
@@ -19,6 +19,8 @@
 #include <cudf/detail/copy.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/join.hpp>
+#include <cudf/lists/detail/lists_column_factories.hpp>
 #include <cudf/table/experimental/row_operators.cuh>
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -27,10 +29,14 @@
 #include <cudf/utilities/type_checks.hpp>
 
 #include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <thrust/binary_search.h>
 #include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/zip_iterator.h>
+#include <thrust/sort.h>
 #include <thrust/transform.h>
 
 #include <algorithm>
@@ -110,6 +116,54 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
   return {std::move(all_encodings), encodings_view};
 }
 
+std::unique_ptr<column> one_hot_encode_sparse(column_view const& input,
+                                              column_view const& categories,
+                                              rmm::cuda_stream_view stream,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(cudf::have_same_types(input, categories),
+               "Mismatch type between input and categories.",
+               cudf::data_type_error);
+
+  if (input.is_empty()) {
+    return lists::detail::make_empty_lists_column(data_type{type_to_id<size_type>()}, stream, mr);
+  }
+
+  // Every (row, category) pair of equal values is a non-zero of the encoding. The hash table is
+  // built from the categories, so the cost is linear in the sizes of the two columns instead of
+  // their product.
+  auto const t_input      = table_view{{input}};
+  auto const t_categories = table_view{{categories}};
+  auto const has_nulls    = has_nested_nulls(t_input) or has_nested_nulls(t_categories)
+                              ? nullable_join::YES
+                              : nullable_join::NO;
+  auto [rows, category_indices] = [&] {
+    if (categories.is_empty()) {
+      return std::pair(std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr),
+                       std::make_unique<rmm::device_uvector<size_type>>(0, stream, mr));
+    }
+    auto const hash_table = cudf::hash_join(t_categories, has_nulls, null_equality::EQUAL, stream);
+    return hash_table.inner_join(t_input, std::nullopt, stream, mr);
+  }();
+
+  // Sort the pairs by row, then by category, to lay out the indices of each row contiguously
+  auto pairs = thrust::make_zip_iterator(rows->begin(), category_indices->begin());
+  thrust::sort(rmm::exec_policy(stream), pairs, pairs + rows->size());
+
+  auto offsets = make_numeric_column(
+    data_type{type_to_id<size_type>()}, input.size() + 1, mask_state::UNALLOCATED, stream, mr);
+  thrust::lower_bound(rmm::exec_policy(stream),
+                      rows->begin(),
+                      rows->end(),
+                      thrust::make_counting_iterator(0),
+                      thrust::make_counting_iterator(input.size() + 1),
+                      offsets->mutable_view().begin<size_type>());
+
+  auto indices = std::make_unique<column>(std::move(*category_indices), rmm::device_buffer{}, 0);
+  return make_lists_column(
+    input.size(), std::move(offsets), std::move(indices), 0, rmm::device_buffer{}, stream, mr);
+}
+
 }  // namespace detail
 
 std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const& input,
@@ -119,4 +173,12 @@ std::pair<std::unique_ptr<column>, table_view> one_hot_encode(column_view const&
   CUDF_FUNC_RANGE();
   return detail::one_hot_encode(input, categories, cudf::get_default_stream(), mr);
 }
+
+std::unique_ptr<column> one_hot_encode_sparse(column_view const& input,
+                                              column_view const& categories,
+                                              rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::one_hot_encode_sparse(input, categories, cudf::get_default_stream(), mr);
+}
 }  // namespace cudf
@@ -36,17 +36,15 @@ namespace cudf {
 namespace transformation {
 namespace jit {
 
-void unary_operation(mutable_column_view output,
-                     column_view input,
-                     std::string const& udf,
-                     data_type output_type,
-                     bool is_ptx,
-                     rmm::cuda_stream_view stream)
+jitify2::Kernel get_unary_kernel(data_type output_type,
+                                 data_type input_type,
+                                 std::string const& udf,
+                                 bool is_ptx)
 {
   std::string kernel_name =
     jitify2::reflection::Template("cudf::transformation::jit::kernel")  //
-      .instantiate(cudf::type_to_name(output.type()),  // list of template arguments
-                   cudf::type_to_name(input.type()));
+      .instantiate(cudf::type_to_name(output_type),  // list of template arguments
+                   cudf::type_to_name(input_type));
 
   std::string cuda_source =
     is_ptx ? cudf::jit::parse_single_function_ptx(udf,  //
@@ -56,11 +54,20 @@ void unary_operation(mutable_column_view output,
            : cudf::jit::parse_single_function_cuda(udf,  //
                                                    "GENERIC_UNARY_OP");
 
-  cudf::jit::get_program_cache(*transform_jit_kernel_cu_jit)
-    .get_kernel(
-      kernel_name, {}, {{"transform/jit/operation-udf.hpp", cuda_source}}, {"-arch=sm_."})  //
-    ->configure_1d_max_occupancy(0, 0, 0, stream.value())                                   //
-    ->launch(output.size(),                                                                 //
+  return cudf::jit::get_kernel(
+    *transform_jit_kernel_cu_jit, kernel_name, "transform/jit/operation-udf.hpp", cuda_source);
+}
+
+void unary_operation(mutable_column_view output,
+                     column_view input,
+                     std::string const& udf,
+                     data_type output_type,
+                     bool is_ptx,
+                     rmm::cuda_stream_view stream)
+{
+  get_unary_kernel(output_type, input.type(), udf, is_ptx)  //
+    ->configure_1d_max_occupancy(0, 0, 0, stream.value())  //
+    ->launch(output.size(),                                 //
              cudf::jit::get_data_ptr(output),
              cudf::jit::get_data_ptr(input));
 }
@@ -91,6 +98,17 @@ std::unique_ptr<column> transform(column_view const& input,
   return output;
 }
 
+void precompile_transform(data_type input_type,
+                          std::string const& unary_udf,
+                          data_type output_type,
+                          bool is_ptx)
+{
+  CUDF_EXPECTS(is_fixed_width(input_type), "Unexpected non-fixed-width type.");
+  CUDF_EXPECTS(is_fixed_width(output_type), "Unexpected non-fixed-width type.");
+
+  transformation::jit::get_unary_kernel(output_type, input_type, unary_udf, is_ptx);
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> transform(column_view const& input,
@@ -0,0 +1,638 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_device_view.cuh>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/detail/null_mask.hpp>
+#include <cudf/detail/nvtx/ranges.hpp>
+#include <cudf/detail/offsets_iterator_factory.cuh>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/detail/utilities/cuda.cuh>
+#include <cudf/detail/utilities/integer_utils.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/strings/detail/strings_children.cuh>
+#include <cudf/strings/string_view.cuh>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_device_view.cuh>
+#include <cudf/utilities/bit.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/span.hpp>
+#include <cudf/utilities/traits.hpp>
+
+#include <rmm/cuda_stream_view.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/exec_policy.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <cuda/functional>
+#include <thrust/binary_search.h>
+#include <thrust/distance.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/scan.h>
+#include <thrust/transform.h>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <vector>
+
+namespace cudf {
+namespace detail {
+namespace {
+
+// every row starts and ends on this alignment
+constexpr size_type row_alignment = 8;
+// a string slot holds the offset and size of the string as two uint32_t values
+constexpr size_type string_slot_size = 2 * sizeof(uint32_t);
+constexpr size_type block_size       = 256;
+// largest dynamic shared memory allocation that does not need an opt-in
+constexpr size_type max_shared_memory_bytes = 48 * 1024;
+// rows per block when a tile of rows does not fit in shared memory
+constexpr size_type unstaged_rows_per_tile = 256;
+
+/**
+ * @brief Position of every column within a row
+ */
+struct row_layout {
+  std::vector<size_type> column_offsets;  ///< Offset of the slot of each column
+  std::vector<size_type> column_sizes;    ///< Size of the slot of each column
+  size_type validity_offset{0};           ///< First byte of the validity bits
+  size_type fixed_size{0};                ///< End of the validity bits and start of the strings
+  size_type fixed_stride{0};              ///< `fixed_size` rounded up to the row alignment
+  bool has_strings{false};                ///< Whether any column is a string column
+};
+
+row_layout make_row_layout(host_span<data_type const> types)
+{
+  CUDF_EXPECTS(!types.empty(), "Rows must contain at least one column", std::invalid_argument);
+  row_layout layout;
+  size_type offset = 0;
+  for (auto const type : types) {
+    auto const is_string = type.id() == type_id::STRING;
+    CUDF_EXPECTS(is_string || is_fixed_width(type),
+                 "Only fixed-width and string columns can be converted to rows",
+                 std::invalid_argument);
+    auto const size = is_string ? string_slot_size : static_cast<size_type>(size_of(type));
+    offset          = util::round_up_safe(offset, std::min(size, row_alignment));
+    layout.column_offsets.push_back(offset);
+    layout.column_sizes.push_back(size);
+    layout.has_strings |= is_string;
+    offset += size;
+  }
+  layout.validity_offset = offset;
+  layout.fixed_size =
+    offset + util::div_rounding_up_safe(static_cast<size_type>(types.size()), size_type{8});
+  layout.fixed_stride = util::round_up_safe(layout.fixed_size, row_alignment);
+  return layout;
+}
+
+/**
+ * @brief Device copy of a `row_layout`
+ */
+struct device_row_layout {
+  size_type const* column_offsets;
+  size_type const* column_sizes;
+  data_type const* types;
+  size_type num_columns;
+  size_type validity_offset;
+  size_type fixed_size;
+  size_type fixed_stride;
+};
+
+/**
+ * @brief Owns the device memory behind a `device_row_layout`
+ */
+struct device_row_layout_buffers {
+  rmm::device_uvector<size_type> column_offsets;
+  rmm::device_uvector<size_type> column_sizes;
+  rmm::device_uvector<data_type> types;
+
+  device_row_layout_buffers(row_layout const& layout,
+                            host_span<data_type const> h_types,
+                            rmm::cuda_stream_view stream)
+    : column_offsets(cudf::detail::make_device_uvector_async(
+        layout.column_offsets, stream, rmm::mr::get_current_device_resource())),
+      column_sizes(cudf::detail::make_device_uvector_async(
+        layout.column_sizes, stream, rmm::mr::get_current_device_resource())),
+      types(cudf::detail::make_device_uvector_async(
+        h_types, stream, rmm::mr::get_current_device_resource()))
+  {
+  }
+
+  [[nodiscard]] device_row_layout view(row_layout const& layout) const
+  {
+    return {column_offsets.data(),
+            column_sizes.data(),
+            types.data(),
+            static_cast<size_type>(types.size()),
+            layout.validity_offset,
+            layout.fixed_size,
+            layout.fixed_stride};
+  }
+};
+
+/**
+ * @brief Number of rows a block handles at a time, and whether they are staged in shared memory
+ *
+ * Tiles are a multiple of the warp size so that each tile covers whole words of a null mask.
+ */
+std::pair<size_type, bool> rows_per_tile(row_layout const& layout)
+{
+  auto const staged_rows =
+    util::round_down_safe(max_shared_memory_bytes / layout.fixed_stride, warp_size);
+  return staged_rows > 0 ? std::pair{staged_rows, true}
+                         : std::pair{unstaged_rows_per_tile, false};
+}
+
+/**
+ * @brief Copies a value between a column and a row slot, both aligned to `min(size, 8)`
+ */
+__device__ void copy_value(int8_t* dst, int8_t const* src, size_type size)
+{
+  switch (size) {
+    case 1: *dst = *src; break;
+    case 2: *reinterpret_cast<int16_t*>(dst) = *reinterpret_cast<int16_t const*>(src); break;
+    case 4: *reinterpret_cast<int32_t*>(dst) = *reinterpret_cast<int32_t const*>(src); break;
+    case 8: *reinterpret_cast<int64_t*>(dst) = *reinterpret_cast<int64_t const*>(src); break;
+    default:
+      for (size_type i = 0; i < size; i += sizeof(int64_t)) {
+        *reinterpret_cast<int64_t*>(dst + i) = *reinterpret_cast<int64_t const*>(src + i);
+      }
+  }
+}
+
+__device__ uint32_t string_size(column_device_view const& col, size_type row)
+{
+  return col.is_valid(row) ? col.element<string_view>(row).size_bytes() : 0;
+}
+
+/**
+ * @brief Copies the fixed-width slots and validity of rows `[row_begin, row_end)` into rows.
+ *
+ * Each block builds a tile of rows at a time. When the tile fits in shared memory it is
+ * assembled there from coalesced column reads and then written out with coalesced 8-byte
+ * stores, otherwise the rows are written in place.
+ *
+ * @param input The table to convert
+ * @param layout Layout of a row
+ * @param row_begin First row of the batch
+ * @param row_end End of the rows of the batch
+ * @param row_offsets Offset of each row from the first row of the table
+ * @param output Rows of the batch
+ * @param rows_per_tile Number of rows a block handles at a time
+ * @param use_shared_memory Whether the tile is assembled in shared memory
+ */
+CUDF_KERNEL void copy_to_rows_kernel(table_device_view input,
+                                     device_row_layout layout,
+                                     size_type row_begin,
+                                     size_type row_end,
+                                     int64_t const* row_offsets,
+                                     int8_t* output,
+                                     size_type rows_per_tile,
+                                     bool use_shared_memory)
+{
+  extern __shared__ __align__(row_alignment) int8_t shared_rows[];
+
+  auto const base           = row_offsets[row_begin];
+  auto const num_tiles      = util::div_rounding_up_unsafe(row_end - row_begin, rows_per_tile);
+  auto const validity_bytes = layout.fixed_size - layout.validity_offset;
+  auto const words_per_row  = layout.fixed_stride / static_cast<size_type>(sizeof(int64_t));
+  for (auto tile = static_cast<size_type>(blockIdx.x); tile < num_tiles; tile += gridDim.x) {
+    auto const tile_begin = row_begin + tile * rows_per_tile;
+    auto const tile_rows  = min(rows_per_tile, row_end - tile_begin);
+    auto const row_data   = [&](size_type row) {
+      return use_shared_memory ? shared_rows + static_cast<int64_t>(row) * layout.fixed_stride
+                                 : output + (row_offsets[tile_begin + row] - base);
+    };
+
+    if (use_shared_memory) {
+      auto const words = reinterpret_cast<int64_t*>(shared_rows);
+      for (auto idx = static_cast<int64_t>(threadIdx.x);
+           idx < static_cast<int64_t>(tile_rows) * words_per_row;
+           idx += blockDim.x) {
+        words[idx] = 0;
+      }
+      __syncthreads();
+    }
+
+    // consecutive threads handle consecutive rows of a column so the column reads coalesce
+    for (auto idx = static_cast<int64_t>(threadIdx.x);
+         idx < static_cast<int64_t>(tile_rows) * layout.num_columns;
+         idx += blockDim.x) {
+      auto const row    = static_cast<size_type>(idx % tile_rows);
+      auto const col    = static_cast<size_type>(idx / tile_rows);
+      auto const column = input.column(col);
+      auto const dst    = row_data(row) + layout.column_offsets[col];
+      if (layout.types[col].id() == type_id::STRING) {
+        auto offset = static_cast<uint32_t>(layout.fixed_size);
+        for (size_type prev = 0; prev < col; ++prev) {
+          if (layout.types[prev].id() == type_id::STRING) {
+            offset += string_size(input.column(prev), tile_begin + row);
+          }
+        }
+        reinterpret_cast<uint32_t*>(dst)[0] = offset;
+        reinterpret_cast<uint32_t*>(dst)[1] = string_size(column, tile_begin + row);
+      } else {
+        auto const size = layout.column_sizes[col];
+        copy_value(dst,
+                   column.head<int8_t>() +
+                     (static_cast<int64_t>(column.offset()) + tile_begin + row) * size,
+                   size);
+      }
+    }
+
+    for (auto idx = static_cast<int64_t>(threadIdx.x);
+         idx < static_cast<int64_t>(tile_rows) * validity_bytes;
+         idx += blockDim.x) {
+      auto const row  = static_cast<size_type>(idx % tile_rows);
+      auto const byte = static_cast<size_type>(idx / tile_rows);
+      uint8_t bits    = 0;
+      for (size_type bit = 0; bit < 8; ++bit) {
+        auto const col = byte * 8 + bit;
+        if (col < layout.num_columns && input.column(col).is_valid(tile_begin + row)) {
+          bits |= 1 << bit;
+        }
+      }
+      row_data(row)[layout.validity_offset + byte] = static_cast<int8_t>(bits);
+    }
+
+    if (use_shared_memory) {
+      __syncthreads();
+      for (auto idx = static_cast<int64_t>(threadIdx.x);
+           idx < static_cast<int64_t>(tile_rows) * words_per_row;
+           idx += blockDim.x) {
+        auto const row  = static_cast<size_type>(idx / words_per_row);
+        auto const word = static_cast<size_type>(idx % words_per_row);
+        reinterpret_cast<int64_t*>(output + (row_offsets[tile_begin + row] - base))[word] =
+          reinterpret_cast<int64_t const*>(shared_rows)[idx];
+      }
+      __syncthreads();
+    }
+  }
+}
+
+/**
+ * @brief Copies the bytes of the strings of rows `[row_begin, row_end)` into rows, with one
+ * warp per row, and zeroes the padding at the end of each row.
+ */
+CUDF_KERNEL void copy_strings_to_rows_kernel(table_device_view input,
+                                             device_row_layout layout,
+                                             size_type row_begin,
+                                             size_type row_end,
+                                             int64_t const* row_offsets,
+                                             int8_t* output)
+{
+  auto const tid     = grid_1d::global_thread_id();
+  auto const lane_id = static_cast<size_type>(tid % warp_size);
+  auto const stride  = grid_1d::grid_stride() / warp_size;
+  for (auto row = row_begin + tid / warp_size; row < row_end; row += stride) {
+    auto const dst = output + (row_offsets[row] - row_offsets[row_begin]);
+    int64_t offset = layout.fixed_size;
+    for (size_type col = 0; col < layout.num_columns; ++col) {
+      if (layout.types[col].id() != type_id::STRING) { continue; }
+      auto const column = input.column(col);
+      if (column.is_null(row)) { continue; }
+      auto const str = column.element<string_view>(row);
+      for (auto i = lane_id; i < str.size_bytes(); i += warp_size) {
+        dst[offset + i] = str.data()[i];
+      }
+      offset += str.size_bytes();
+    }
+    auto const row_size = row_offsets[row + 1] - row_offsets[row];
+    for (auto i = offset + lane_id; i < row_size; i += warp_size) {
+      dst[i] = 0;
+    }
+  }
+}
+
+/**
+ * @brief Copies the fixed-width slots and validity of rows into the output columns.
+ *
+ * The reverse of `copy_to_rows_kernel`: each tile of rows is staged in shared memory with
+ * coalesced 8-byte loads when it fits, and the columns are written from it with consecutive
+ * threads handling consecutive rows. String columns are skipped; only their validity is
+ * written here.
+ *
+ * @param rows Bytes of all rows
+ * @param row_offsets Offset of each row in `rows`
+ * @param num_rows Number of rows
+ * @param layout Layout of a row
+ * @param column_data Data of each output column; nullptr for string columns
+ * @param null_masks Null mask of each output column
+ * @param rows_per_tile Number of rows a block handles at a time
+ * @param use_shared_memory Whether the tile is staged in shared memory
+ */
+CUDF_KERNEL void copy_from_rows_kernel(int8_t const* rows,
+                                       size_type const* row_offsets,
+                                       size_type num_rows,
+                                       device_row_layout layout,
+                                       int8_t* const* column_data,
+                                       bitmask_type* const* null_masks,
+                                       size_type rows_per_tile,
+                                       bool use_shared_memory)
+{
+  extern __shared__ __align__(row_alignment) int8_t shared_rows[];
+
+  auto const num_tiles     = util::div_rounding_up_unsafe(num_rows, rows_per_tile);
+  auto const words_per_row = layout.fixed_stride / static_cast<size_type>(sizeof(int64_t));
+  for (auto tile = static_cast<size_type>(blockIdx.x); tile < num_tiles; tile += gridDim.x) {
+    auto const tile_begin = tile * rows_per_tile;
+    auto const tile_rows  = min(rows_per_tile, num_rows - tile_begin);
+    auto const row_data   = [&](size_type row) {
+      return use_shared_memory ? shared_rows + static_cast<int64_t>(row) * layout.fixed_stride
+                                 : rows + row_offsets[tile_begin + row];
+    };
+
+    if (use_shared_memory) {
+      for (auto idx = static_cast<int64_t>(threadIdx.x);
+           idx < static_cast<int64_t>(tile_rows) * words_per_row;
+           idx += blockDim.x) {
+        auto const row  = static_cast<size_type>(idx / words_per_row);
+        auto const word = static_cast<size_type>(idx % words_per_row);
+        reinterpret_cast<int64_t*>(shared_rows)[idx] =
+          reinterpret_cast<int64_t const*>(rows + row_offsets[tile_begin + row])[word];
+      }
+      __syncthreads();
+    }
+
+    for (auto idx = static_cast<int64_t>(threadIdx.x);
+         idx < static_cast<int64_t>(tile_rows) * layout.num_columns;
+         idx += blockDim.x) {
+      auto const row = static_cast<size_type>(idx % tile_rows);
+      auto const col = static_cast<size_type>(idx / tile_rows);
+      if (column_data[col] == nullptr) { continue; }
+      auto const size = layout.column_sizes[col];
+      copy_value(column_data[col] + static_cast<int64_t>(tile_begin + row) * size,
+                 row_data(row) + layout.column_offsets[col],
+                 size);
+    }
+
+    // tiles start on a word boundary of the null masks
+    auto const words_per_tile = util::div_rounding_up_unsafe(tile_rows, warp_size);
+    for (auto idx = static_cast<int64_t>(threadIdx.x);
+         idx < static_cast<int64_t>(words_per_tile) * layout.num_columns;
+         idx += blockDim.x) {
+      auto const word       = static_cast<size_type>(idx % words_per_tile);
+      auto const col        = static_cast<size_type>(idx / words_per_tile);
+      auto const byte       = layout.validity_offset + col / 8;
+      auto const bit        = 1 << (col % 8);
+      auto const first_row  = word * warp_size;
+      auto const word_rows  = min(warp_size, tile_rows - first_row);
+      bitmask_type validity = 0;
+      for (size_type i = 0; i < word_rows; ++i) {
+        if (row_data(first_row + i)[byte] & bit) { validity |= bitmask_type{1} << i; }
+      }
+      null_masks[col][word_index(tile_begin) + word] = validity;
+    }
+
+    if (use_shared_memory) { __syncthreads(); }
+  }
+}
+
+/**
+ * @brief Copies the bytes of the strings of one column out of the rows, with one warp per row.
+ */
+CUDF_KERNEL void copy_strings_from_rows_kernel(int8_t const* rows,
+                                               size_type const* row_offsets,
+                                               size_type num_rows,
+                                               size_type slot_offset,
+                                               cudf::detail::input_offsetalator output_offsets,
+                                               char* chars)
+{
+  auto const tid     = grid_1d::global_thread_id();
+  auto const lane_id = static_cast<size_type>(tid % warp_size);
+  auto const stride  = grid_1d::grid_stride() / warp_size;
+  for (auto row = tid / warp_size; row < num_rows; row += stride) {
+    auto const row_data = rows + row_offsets[row];
+    auto const slot     = reinterpret_cast<uint32_t const*>(row_data + slot_offset);
+    auto const src      = row_data + slot[0];
+    auto const dst      = chars + output_offsets[row];
+    for (auto i = static_cast<uint32_t>(lane_id); i < slot[1]; i += warp_size) {
+      dst[i] = src[i];
+    }
+  }
+}
+
+}  // namespace
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     int64_t max_batch_bytes,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  std::vector<data_type> types;
+  std::transform(input.begin(), input.end(), std::back_inserter(types), [](auto const& col) {
+    return col.type();
+  });
+  auto const layout       = make_row_layout(types);
+  auto const d_layout_buf = device_row_layout_buffers(layout, types, stream);
+  auto const d_layout     = d_layout_buf.view(layout);
+  auto const d_input      = table_device_view::create(input, stream);
+  auto const num_rows     = input.num_rows();
+
+  // offset of each row from the start of the first row
+  auto row_offsets = rmm::device_uvector<int64_t>(num_rows + 1, stream);
+  auto const row_sizes = cudf::detail::make_counting_transform_iterator(
+    0,
+    cuda::proclaim_return_type<int64_t>(
+      [input = *d_input, layout = d_layout, num_rows] __device__(size_type row) -> int64_t {
+        if (row == num_rows) { return 0; }
+        int64_t size = layout.fixed_size;
+        for (size_type col = 0; col < layout.num_columns; ++col) {
+          if (layout.types[col].id() == type_id::STRING) {
+            size += string_size(input.column(col), row);
+          }
+        }
+        return util::round_up_unsafe(size, static_cast<int64_t>(row_alignment));
+      }));
+  thrust::exclusive_scan(
+    rmm::exec_policy(stream), row_sizes, row_sizes + num_rows + 1, row_offsets.begin());
+
+  // split the rows into batches that fit the offsets of a column
+  std::vector<size_type> batch_bounds{0};
+  do {
+    auto const begin = batch_bounds.back();
+    auto const limit = row_offsets.element(begin, stream) + max_batch_bytes;
+    auto const end =
+      static_cast<size_type>(thrust::distance(
+        row_offsets.begin(),
+        thrust::upper_bound(
+          rmm::exec_policy(stream), row_offsets.begin() + begin, row_offsets.end(), limit))) -
+      1;
+    CUDF_EXPECTS(end > begin || num_rows == 0,
+                 "A row is larger than the size limit of a column",
+                 std::overflow_error);
+    batch_bounds.push_back(end);
+  } while (batch_bounds.back() < num_rows);
+
+  auto const [tile_rows, use_shared_memory] = rows_per_tile(layout);
+  auto const shared_memory_bytes = use_shared_memory ? tile_rows * layout.fixed_stride : 0;
+
+  std::vector<std::unique_ptr<column>> batches;
+  for (std::size_t batch = 0; batch + 1 < batch_bounds.size(); ++batch) {
+    auto const begin      = batch_bounds[batch];
+    auto const end        = batch_bounds[batch + 1];
+    auto const batch_rows = end - begin;
+
+    auto offsets = make_numeric_column(
+      data_type{type_id::INT32}, batch_rows + 1, mask_state::UNALLOCATED, stream, mr);
+    thrust::transform(rmm::exec_policy(stream),
+                      row_offsets.begin() + begin,
+                      row_offsets.begin() + end + 1,
+                      offsets->mutable_view().begin<size_type>(),
+                      cuda::proclaim_return_type<size_type>(
+                        [base = row_offsets.element(begin, stream)] __device__(int64_t offset) {
+                          return static_cast<size_type>(offset - base);
+                        }));
+    auto const batch_bytes =
+      static_cast<size_type>(row_offsets.element(end, stream) - row_offsets.element(begin, stream));
+    auto data = make_numeric_column(
+      data_type{type_id::INT8}, batch_bytes, mask_state::UNALLOCATED, stream, mr);
+    auto const d_output = data->mutable_view().data<int8_t>();
+
+    if (batch_rows > 0) {
+      // rows written in place rely on their padding being zeroed up front
+      if (!use_shared_memory) {
+        CUDF_CUDA_TRY(cudaMemsetAsync(d_output, 0, batch_bytes, stream.value()));
+      }
+      auto const num_tiles = util::div_rounding_up_safe(batch_rows, tile_rows);
+      copy_to_rows_kernel<<<num_tiles, block_size, shared_memory_bytes, stream.value()>>>(
+        *d_input, d_layout, begin, end, row_offsets.data(), d_output, tile_rows, use_shared_memory);
+      if (layout.has_strings) {
+        grid_1d const grid{batch_rows, block_size / warp_size};
+        copy_strings_to_rows_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+          *d_input, d_layout, begin, end, row_offsets.data(), d_output);
+      }
+    }
+
+    batches.push_back(make_lists_column(
+      batch_rows, std::move(offsets), std::move(data), 0, rmm::device_buffer{}, stream, mr));
+  }
+  return batches;
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         host_span<data_type const> schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(input.child().type().id() == type_id::INT8,
+               "Rows must be stored in a LIST<INT8> column",
+               std::invalid_argument);
+  auto const layout       = make_row_layout(schema);
+  auto const d_layout_buf = device_row_layout_buffers(layout, schema, stream);
+  auto const d_layout     = d_layout_buf.view(layout);
+  auto const num_rows     = input.size();
+  auto const num_columns  = static_cast<size_type>(schema.size());
+  auto const rows         = input.child().data<int8_t>();
+  auto const row_offsets  = input.offsets_begin();
+
+  std::vector<std::unique_ptr<column>> columns;
+  std::vector<rmm::device_buffer> string_masks(num_columns);
+  std::vector<int8_t*> h_column_data;
+  std::vector<bitmask_type*> h_null_masks;
+  for (size_type col = 0; col < num_columns; ++col) {
+    if (schema[col].id() == type_id::STRING) {
+      string_masks[col] = create_null_mask(num_rows, mask_state::UNINITIALIZED, stream, mr);
+      columns.push_back(nullptr);
+      h_column_data.push_back(nullptr);
+      h_null_masks.push_back(static_cast<bitmask_type*>(string_masks[col].data()));
+    } else {
+      columns.push_back(
+        make_fixed_width_column(schema[col], num_rows, mask_state::UNINITIALIZED, stream, mr));
+      h_column_data.push_back(columns.back()->mutable_view().head<int8_t>());
+      h_null_masks.push_back(columns.back()->mutable_view().null_mask());
+    }
+  }
+
+  if (num_rows > 0) {
+    auto const d_column_data = cudf::detail::make_device_uvector_async(
+      h_column_data, stream, rmm::mr::get_current_device_resource());
+    auto const d_null_masks = cudf::detail::make_device_uvector_async(
+      h_null_masks, stream, rmm::mr::get_current_device_resource());
+    auto const [tile_rows, use_shared_memory] = rows_per_tile(layout);
+    auto const shared_memory_bytes = use_shared_memory ? tile_rows * layout.fixed_stride : 0;
+    auto const num_tiles           = util::div_rounding_up_safe(num_rows, tile_rows);
+    copy_from_rows_kernel<<<num_tiles, block_size, shared_memory_bytes, stream.value()>>>(
+      rows,
+      row_offsets,
+      num_rows,
+      d_layout,
+      d_column_data.data(),
+      d_null_masks.data(),
+      tile_rows,
+      use_shared_memory);
+  }
+
+  for (size_type col = 0; col < num_columns; ++col) {
+    auto const nulls = null_count(h_null_masks[col], 0, num_rows, stream);
+    if (schema[col].id() != type_id::STRING) {
+      columns[col]->set_null_count(nulls);
+      continue;
+    }
+
+    auto const slot_offset = layout.column_offsets[col];
+    auto const sizes       = cudf::detail::make_counting_transform_iterator(
+      0, cuda::proclaim_return_type<size_type>([rows, row_offsets, slot_offset] __device__(
+                                                 size_type row) {
+        return static_cast<size_type>(
+          reinterpret_cast<uint32_t const*>(rows + row_offsets[row] + slot_offset)[1]);
+      }));
+    auto [offsets, bytes] =
+      cudf::strings::detail::make_offsets_child_column(sizes, sizes + num_rows, stream, mr);
+    auto chars = rmm::device_uvector<char>(bytes, stream, mr);
+    if (num_rows > 0) {
+      grid_1d const grid{num_rows, block_size / warp_size};
+      copy_strings_from_rows_kernel<<<grid.num_blocks, block_size, 0, stream.value()>>>(
+        rows,
+        row_offsets,
+        num_rows,
+        slot_offset,
+        cudf::detail::offsetalator_factory::make_input_iterator(offsets->view()),
+        chars.data());
+    }
+    columns[col] = make_strings_column(
+      num_rows, std::move(offsets), chars.release(), nulls, std::move(string_masks[col]));
+  }
+  return std::make_unique<table>(std::move(columns));
+}
+
+}  // namespace detail
+
+std::vector<std::unique_ptr<column>> convert_to_rows(table_view const& input,
+                                                     rmm::cuda_stream_view stream,
+                                                     rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_to_rows(input, std::numeric_limits<size_type>::max(), stream, mr);
+}
+
+std::unique_ptr<table> convert_from_rows(lists_column_view const& input,
+                                         host_span<data_type const> schema,
+                                         rmm::cuda_stream_view stream,
+                                         rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::convert_from_rows(input, schema, stream, mr);
+}
+
+}  // namespace cudf
@@ -15,14 +15,13 @@
  */
 
 #include <cudf/column/column.hpp>
-#include <cudf/detail/binaryop.hpp>
-#include <cudf/detail/fill.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/nvtx/ranges.hpp>
 #include <cudf/detail/unary.hpp>
+#include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/null_mask.hpp>
-#include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/traits.hpp>
@@ -31,8 +30,12 @@
 #include <rmm/exec_policy.hpp>
 #include <rmm/resource_ref.hpp>
 
+#include <cuda/std/limits>
 #include <thrust/transform.h>
 
+#include <stdexcept>
+#include <vector>
+
 namespace cudf {
 namespace detail {
 namespace {  // anonymous namespace
@@ -164,58 +167,31 @@ constexpr inline auto is_supported_cast()
   return is_supported_non_fixed_point_cast<From, To>() || is_supported_fixed_point_cast<From, To>();
 }
 
-template <typename From, typename To>
-struct device_cast {
-  __device__ To operator()(From element) { return static_cast<To>(element); }
-};
-
 /**
- * @brief Takes a `fixed_point` column_view as @p input and returns a `fixed_point` column with new
- * @p scale
- *
- * @tparam T     Type of the `fixed_point` column_view (`decimal32`, `decimal64` or `decimal128`)
- * @param input  Input `column_view`
- * @param scale  `scale` of the returned `column`
- * @param stream CUDA stream used for device memory operations and kernel launches
- * @param mr     Device memory resource used to allocate the returned column's device memory
+ * @brief Rescales a `fixed_point` value and converts it to another `fixed_point` type.
  *
- * @return std::unique_ptr<column> Returned column with new @p scale
+ * The value is shifted in the wider of the two representation types, so that it does not
+ * overflow whether the conversion narrows or widens it.
  */
-template <typename T, std::enable_if_t<is_fixed_point<T>()>* = nullptr>
-std::unique_ptr<column> rescale(column_view input,
-                                numeric::scale_type scale,
-                                rmm::cuda_stream_view stream,
-                                rmm::device_async_resource_ref mr)
-{
-  using namespace numeric;
-  using RepType = device_storage_type_t<T>;
-
-  auto const type = cudf::data_type{cudf::type_to_id<T>(), scale};
-  if (input.type().scale() >= scale) {
-    auto const scalar = make_fixed_point_scalar<T>(0, scale_type{scale}, stream);
-    return detail::binary_operation(input, *scalar, binary_operator::ADD, type, stream, mr);
-  } else {
-    auto const diff = input.type().scale() - scale;
-    // The value of fixed point scalar will overflow if the scale difference is larger than the
-    // max digits of underlying integral type. Under this condition, the output values can be
-    // nothing other than zero value. Therefore, we simply return a zero column.
-    if (-diff > cuda::std::numeric_limits<RepType>::digits10) {
-      auto const scalar  = make_fixed_point_scalar<T>(0, scale_type{scale}, stream);
-      auto output_column = make_column_from_scalar(*scalar, input.size(), stream, mr);
-      if (input.nullable()) {
-        auto null_mask = detail::copy_bitmask(input, stream, mr);
-        output_column->set_null_mask(std::move(null_mask), input.null_count());
-      }
-      return output_column;
-    }
+template <typename SourceT, typename TargetT>
+struct fixed_point_rescale_cast {
+  using SourceDeviceT = device_storage_type_t<SourceT>;
+  using TargetDeviceT = device_storage_type_t<TargetT>;
+  using WideDeviceT   = std::
+    conditional_t<(sizeof(SourceDeviceT) > sizeof(TargetDeviceT)), SourceDeviceT, TargetDeviceT>;
 
-    RepType scalar_value = 10;
-    for (int i = 1; i < -diff; ++i) {
-      scalar_value *= 10;
-    }
+  numeric::scale_type shift;  ///< Output scale minus input scale
 
-    auto const scalar = make_fixed_point_scalar<T>(scalar_value, scale_type{diff}, stream);
-    return detail::binary_operation(input, *scalar, binary_operator::DIV, type, stream, mr);
+  __device__ inline TargetDeviceT operator()(SourceDeviceT const element)
+  {
+    // The power of ten would overflow when dividing by more than `digits10` of them, in which
+    // case the output can be nothing other than zero.
+    if (static_cast<int32_t>(shift) > cuda::std::numeric_limits<WideDeviceT>::digits10) {
+      return TargetDeviceT{0};
+    }
+    auto const value = static_cast<WideDeviceT>(element);
+    return static_cast<TargetDeviceT>(
+      numeric::detail::shift<WideDeviceT, numeric::Radix::BASE_10>(value, shift));
   }
 };
 
@@ -242,7 +218,7 @@ struct dispatch_unary_cast_to {
 
     mutable_column_view output_mutable = *output;
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<SourceT>(),
                       input.end<SourceT>(),
                       output_mutable.begin<TargetT>(),
@@ -272,7 +248,7 @@ struct dispatch_unary_cast_to {
     using DeviceT    = device_storage_type_t<SourceT>;
     auto const scale = numeric::scale_type{input.type().scale()};
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<DeviceT>(),
                       input.end<DeviceT>(),
                       output_mutable.begin<TargetT>(),
@@ -302,7 +278,7 @@ struct dispatch_unary_cast_to {
     using DeviceT    = device_storage_type_t<TargetT>;
     auto const scale = numeric::scale_type{type.scale()};
 
-    thrust::transform(rmm::exec_policy(stream),
+    thrust::transform(rmm::exec_policy_nosync(stream),
                       input.begin<SourceT>(),
                       input.end<SourceT>(),
                       output_mutable.begin<DeviceT>(),
@@ -312,62 +288,36 @@ struct dispatch_unary_cast_to {
   }
 
   template <typename TargetT,
-            typename SourceT                                    = _SourceT,
-            std::enable_if_t<cudf::is_fixed_point<SourceT>() && cudf::is_fixed_point<TargetT>() &&
-                             std::is_same_v<SourceT, TargetT>>* = nullptr>
+            typename SourceT                                   = _SourceT,
+            std::enable_if_t<cudf::is_fixed_point<SourceT>() &&
+                             cudf::is_fixed_point<TargetT>()>* = nullptr>
   std::unique_ptr<column> operator()(data_type type,
                                      rmm::cuda_stream_view stream,
                                      rmm::device_async_resource_ref mr)
   {
-    if (input.type() == type) {
-      return std::make_unique<column>(input, stream, mr);  // TODO add test for this
-    }
+    if (input.type() == type) { return std::make_unique<column>(input, stream, mr); }
 
-    return detail::rescale<TargetT>(input, numeric::scale_type{type.scale()}, stream, mr);
-  }
+    auto const size = input.size();
+    auto output =
+      std::make_unique<column>(type,
+                               size,
+                               rmm::device_buffer{size * cudf::size_of(type), stream, mr},
+                               detail::copy_bitmask(input, stream, mr),
+                               input.null_count());
+
+    mutable_column_view output_mutable = *output;
 
-  template <typename TargetT,
-            typename SourceT                                        = _SourceT,
-            std::enable_if_t<cudf::is_fixed_point<SourceT>() && cudf::is_fixed_point<TargetT>() &&
-                             not std::is_same_v<SourceT, TargetT>>* = nullptr>
-  std::unique_ptr<column> operator()(data_type type,
-                                     rmm::cuda_stream_view stream,
-                                     rmm::device_async_resource_ref mr)
-  {
-    using namespace numeric;
     using SourceDeviceT = device_storage_type_t<SourceT>;
     using TargetDeviceT = device_storage_type_t<TargetT>;
+    auto const shift    = numeric::scale_type{type.scale() - input.type().scale()};
 
-    auto casted = [&]() {
-      auto const size = input.size();
-      auto output     = std::make_unique<column>(cudf::data_type{type.id(), input.type().scale()},
-                                             size,
-                                             rmm::device_buffer{size * cudf::size_of(type), stream},
-                                             detail::copy_bitmask(input, stream, mr),
-                                             input.null_count());
+    thrust::transform(rmm::exec_policy_nosync(stream),
+                      input.begin<SourceDeviceT>(),
+                      input.end<SourceDeviceT>(),
+                      output_mutable.begin<TargetDeviceT>(),
+                      fixed_point_rescale_cast<SourceT, TargetT>{shift});
 
-      mutable_column_view output_mutable = *output;
-
-      thrust::transform(rmm::exec_policy(stream),
-                        input.begin<SourceDeviceT>(),
-                        input.end<SourceDeviceT>(),
-                        output_mutable.begin<TargetDeviceT>(),
-                        device_cast<SourceDeviceT, TargetDeviceT>{});
-
-      return output;
-    };
-
-    if (input.type().scale() == type.scale()) return casted();
-
-    if constexpr (sizeof(SourceDeviceT) < sizeof(TargetDeviceT)) {
-      // device_cast BEFORE rescale when SourceDeviceT is < TargetDeviceT
-      auto temporary = casted();
-      return detail::rescale<TargetT>(*temporary, scale_type{type.scale()}, stream, mr);
-    } else {
-      // device_cast AFTER rescale when SourceDeviceT is > TargetDeviceT to avoid overflow
-      auto temporary = detail::rescale<SourceT>(input, scale_type{type.scale()}, stream, mr);
-      return detail::cast(*temporary, type, stream, mr);
-    }
+    return output;
   }
 
   template <typename TargetT,
@@ -420,6 +370,33 @@ std::unique_ptr<column> cast(column_view const& input,
   return type_dispatcher(input.type(), detail::dispatch_unary_cast_from{input}, type, stream, mr);
 }
 
+std::unique_ptr<table> cast(table_view const& input,
+                            host_span<data_type const> types,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr)
+{
+  CUDF_EXPECTS(static_cast<size_type>(types.size()) == input.num_columns(),
+               "Number of output types must match the number of input columns.",
+               std::invalid_argument);
+
+  // Each column is converted on its own stream so that the kernels of small columns run
+  // concurrently rather than one after the other. Their memory is handed over to `stream` when
+  // the streams are joined.
+  auto const num_columns = static_cast<std::size_t>(input.num_columns());
+  auto const streams     = num_columns > 1
+                             ? cudf::detail::fork_streams(stream, num_columns)
+                             : std::vector<rmm::cuda_stream_view>(num_columns, stream);
+  std::vector<std::unique_ptr<column>> columns;
+  columns.reserve(num_columns);
+  for (std::size_t i = 0; i < num_columns; ++i) {
+    auto const& col = input.column(i);
+    columns.push_back(col.type() == types[i] ? std::make_unique<column>(col, streams[i], mr)
+                                             : cast(col, types[i], streams[i], mr));
+  }
+  if (num_columns > 1) { cudf::detail::join_streams(streams, stream, columns); }
+  return std::make_unique<table>(std::move(columns));
+}
+
 }  // namespace detail
 
 std::unique_ptr<column> cast(column_view const& input,
@@ -431,4 +408,13 @@ std::unique_ptr<column> cast(column_view const& input,
   return detail::cast(input, type, stream, mr);
 }
 
+std::unique_ptr<table> cast(table_view const& input,
+                            host_span<data_type const> types,
+                            rmm::cuda_stream_view stream,
+                            rmm::device_async_resource_ref mr)
+{
+  CUDF_FUNC_RANGE();
+  return detail::cast(input, types, stream, mr);
+}
+
 }  // namespace cudf
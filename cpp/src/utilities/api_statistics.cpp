@@ -0,0 +1,220 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/api_statistics.hpp>
+#include <cudf/utilities/api_statistics.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/aligned.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+namespace cudf {
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+/**
+ * @brief Costs of the API call in flight on a thread.
+ */
+struct call_costs {
+  char const* name{};
+  clock_type::time_point start_time{};
+  std::int64_t current_bytes{};
+  std::int64_t peak_bytes{};
+  std::size_t allocated_bytes{};
+  std::size_t freed_bytes{};
+  rmm::cuda_stream_view stream{};
+  cudaEvent_t start_event{};  ///< Recorded on `stream` at the first allocation of the call
+};
+
+/**
+ * @brief Events bracketing the device work of a finished call, read lazily.
+ */
+struct pending_device_time {
+  std::string name;
+  cudaEvent_t start_event;
+  cudaEvent_t stop_event;
+};
+
+// The state touched by every API call is trivially initialized, so that the calls made with
+// statistics disabled access it directly rather than through the initialization guard of
+// `thread_statistics()`
+thread_local bool statistics_enabled = false;
+thread_local int call_depth          = 0;
+thread_local bool recording_call     = false;  ///< Whether the outermost call in flight is recorded
+
+struct thread_api_statistics {
+  call_costs call{};
+  std::map<std::string, api_statistics> statistics;
+  std::vector<pending_device_time> pending;
+
+  void clear_pending()
+  {
+    for (auto const& p : pending) {
+      cudaEventDestroy(p.start_event);
+      cudaEventDestroy(p.stop_event);
+    }
+    pending.clear();
+  }
+
+  ~thread_api_statistics() { clear_pending(); }
+};
+
+thread_api_statistics& thread_statistics()
+{
+  thread_local thread_api_statistics statistics;
+  return statistics;
+}
+
+/**
+ * @brief Return the costs of the call in flight on the calling thread, if it is being recorded.
+ */
+call_costs* recorded_call()
+{
+  return recording_call and call_depth > 0 ? &thread_statistics().call : nullptr;
+}
+
+void begin_call(char const* name)
+{
+  auto& state = thread_statistics();
+  state.call  = call_costs{name, clock_type::now()};
+}
+
+void end_call() noexcept
+{
+  auto& state      = thread_statistics();
+  auto const& call = state.call;
+  auto& stats      = state.statistics[call.name];
+
+  auto const temporary_bytes = std::min(call.allocated_bytes, call.freed_bytes);
+  stats.calls += 1;
+  stats.host_time += std::chrono::duration_cast<std::chrono::nanoseconds>(clock_type::now() -
+                                                                          call.start_time);
+  stats.allocated_bytes += call.allocated_bytes;
+  stats.temporary_bytes += temporary_bytes;
+  stats.output_bytes += call.allocated_bytes - temporary_bytes;
+  stats.peak_memory_bytes =
+    std::max(stats.peak_memory_bytes, static_cast<std::size_t>(call.peak_bytes));
+
+  if (call.start_event == nullptr) { return; }
+  cudaEvent_t stop_event{};
+  if (cudaEventCreate(&stop_event) == cudaSuccess and
+      cudaEventRecord(stop_event, call.stream.value()) == cudaSuccess) {
+    state.pending.push_back({call.name, call.start_event, stop_event});
+    return;
+  }
+  // the device time of the call is lost, but the call must not throw from a destructor
+  if (stop_event != nullptr) { cudaEventDestroy(stop_event); }
+  cudaEventDestroy(call.start_event);
+}
+
+}  // namespace
+
+namespace detail {
+
+api_statistics_scope::api_statistics_scope(char const* name)
+{
+  if (call_depth == 0) {
+    recording_call = statistics_enabled;
+    if (recording_call) { begin_call(name); }
+  }
+  ++call_depth;
+}
+
+api_statistics_scope::~api_statistics_scope()
+{
+  if (--call_depth == 0 and recording_call) { end_call(); }
+}
+
+}  // namespace detail
+
+api_statistics_resource_adaptor::api_statistics_resource_adaptor(
+  rmm::device_async_resource_ref upstream)
+  : upstream_{upstream}
+{
+}
+
+rmm::device_async_resource_ref api_statistics_resource_adaptor::get_upstream_resource()
+  const noexcept
+{
+  return upstream_;
+}
+
+void* api_statistics_resource_adaptor::do_allocate(std::size_t bytes, rmm::cuda_stream_view stream)
+{
+  auto ptr  = upstream_.allocate_async(bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+  auto call = recorded_call();
+  if (call == nullptr) { return ptr; }
+
+  call->allocated_bytes += bytes;
+  call->current_bytes += static_cast<std::int64_t>(bytes);
+  call->peak_bytes = std::max(call->peak_bytes, call->current_bytes);
+  if (call->start_event == nullptr) {
+    CUDF_CUDA_TRY(cudaEventCreate(&call->start_event));
+    CUDF_CUDA_TRY(cudaEventRecord(call->start_event, stream.value()));
+    call->stream = stream;
+  }
+  return ptr;
+}
+
+void api_statistics_resource_adaptor::do_deallocate(void* ptr,
+                                                    std::size_t bytes,
+                                                    rmm::cuda_stream_view stream)
+{
+  upstream_.deallocate_async(ptr, bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+  if (auto call = recorded_call(); call != nullptr) {
+    call->freed_bytes += bytes;
+    call->current_bytes -= static_cast<std::int64_t>(bytes);
+  }
+}
+
+bool api_statistics_resource_adaptor::do_is_equal(
+  device_memory_resource const& other) const noexcept
+{
+  return this == &other;
+}
+
+void enable_api_statistics() { statistics_enabled = true; }
+
+void disable_api_statistics() { statistics_enabled = false; }
+
+std::map<std::string, api_statistics> get_api_statistics()
+{
+  auto& state = thread_statistics();
+  for (auto const& p : state.pending) {
+    CUDF_CUDA_TRY(cudaEventSynchronize(p.stop_event));
+    float milliseconds{};
+    CUDF_CUDA_TRY(cudaEventElapsedTime(&milliseconds, p.start_event, p.stop_event));
+    state.statistics[p.name].device_time += std::chrono::duration_cast<std::chrono::nanoseconds>(
+      std::chrono::duration<float, std::milli>{milliseconds});
+  }
+  state.clear_pending();
+  return state.statistics;
+}
+
+void reset_api_statistics()
+{
+  auto& state = thread_statistics();
+  state.clear_pending();
+  state.statistics.clear();
+}
+
+}  // namespace cudf
@@ -0,0 +1,192 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "jit/cache.hpp"
+
+#include <cudf/detail/utilities/autotune.hpp>
+#include <cudf/detail/utilities/logger.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <cuda_runtime.h>
+
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <mutex>
+#include <set>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+namespace cudf::detail {
+namespace {
+
+// Number of timed runs of each candidate, after one untimed warmup run
+constexpr int autotune_repetitions = 3;
+
+/**
+ * @brief Tuned choices of the process, keyed by compute capability and decision key
+ */
+struct autotune_state {
+  std::shared_mutex mutex;
+  std::unordered_map<std::string, std::size_t> choices;
+  std::set<int> loaded_capabilities;
+};
+
+autotune_state& get_autotune_state()
+{
+  static autotune_state state{};
+  return state;
+}
+
+int current_compute_capability()
+{
+  int device;
+  int cc_major;
+  int cc_minor;
+  CUDF_CUDA_TRY(cudaGetDevice(&device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_major, cudaDevAttrComputeCapabilityMajor, device));
+  CUDF_CUDA_TRY(cudaDeviceGetAttribute(&cc_minor, cudaDevAttrComputeCapabilityMinor, device));
+  return cc_major * 10 + cc_minor;
+}
+
+// Returns the path of the file of the choices of the current device, or an empty path if the
+// kernel cache directory is disabled
+std::filesystem::path get_autotune_file()
+{
+  auto const cache_dir = cudf::jit::get_cache_dir();
+  return cache_dir.empty() ? cache_dir : cache_dir / "autotune.txt";
+}
+
+std::string make_state_key(int capability, std::string const& key)
+{
+  return std::to_string(capability) + "/" + key;
+}
+
+// Must be called with the state mutex held exclusively
+void load_choices(autotune_state& state, int capability)
+{
+  if (not state.loaded_capabilities.insert(capability).second) { return; }
+  auto const path = get_autotune_file();
+  if (path.empty()) { return; }
+  std::ifstream file(path);
+  std::string key;
+  std::size_t choice;
+  while (file >> key >> choice) {
+    state.choices[make_state_key(capability, key)] = choice;
+  }
+}
+
+/**
+ * @brief Owner of a CUDA event, destroyed even if a timed candidate throws
+ */
+class timing_event {
+ public:
+  timing_event() { CUDF_CUDA_TRY(cudaEventCreate(&_event)); }
+  ~timing_event() { cudaEventDestroy(_event); }
+  timing_event(timing_event const&)            = delete;
+  timing_event& operator=(timing_event const&) = delete;
+
+  [[nodiscard]] cudaEvent_t get() const { return _event; }
+
+ private:
+  cudaEvent_t _event{};
+};
+
+float time_candidate(std::function<void(std::size_t)> const& run_candidate,
+                     std::size_t candidate,
+                     rmm::cuda_stream_view stream)
+{
+  timing_event const start;
+  timing_event const stop;
+  run_candidate(candidate);
+  CUDF_CUDA_TRY(cudaEventRecord(start.get(), stream.value()));
+  for (int i = 0; i < autotune_repetitions; ++i) {
+    run_candidate(candidate);
+  }
+  CUDF_CUDA_TRY(cudaEventRecord(stop.get(), stream.value()));
+  CUDF_CUDA_TRY(cudaEventSynchronize(stop.get()));
+  float elapsed_ms;
+  CUDF_CUDA_TRY(cudaEventElapsedTime(&elapsed_ms, start.get(), stop.get()));
+  return elapsed_ms;
+}
+
+}  // namespace
+
+bool is_autotuning_enabled() { return std::getenv("LIBCUDF_AUTOTUNE") != nullptr; }
+
+void clear_autotuned_choices()
+{
+  auto& state = get_autotune_state();
+  std::unique_lock lock{state.mutex};
+  state.choices.clear();
+  state.loaded_capabilities.clear();
+}
+
+std::size_t autotuned_choice(std::string const& key,
+                             std::size_t num_candidates,
+                             std::size_t default_choice,
+                             std::function<void(std::size_t)> const& run_candidate,
+                             rmm::cuda_stream_view stream)
+{
+  if (not is_autotuning_enabled() or num_candidates < 2) { return default_choice; }
+
+  auto& state           = get_autotune_state();
+  auto const capability = current_compute_capability();
+  auto const state_key  = make_state_key(capability, key);
+  {
+    std::shared_lock lock{state.mutex};
+    if (auto const it = state.choices.find(state_key); it != state.choices.end()) {
+      return it->second < num_candidates ? it->second : default_choice;
+    }
+  }
+  {
+    std::unique_lock lock{state.mutex};
+    load_choices(state, capability);
+    if (auto const it = state.choices.find(state_key); it != state.choices.end()) {
+      return it->second < num_candidates ? it->second : default_choice;
+    }
+  }
+
+  // Benchmarked without holding the lock; concurrent first requests of a key may both tune it
+  auto best_choice = default_choice;
+  auto best_time   = std::numeric_limits<float>::max();
+  for (std::size_t candidate = 0; candidate < num_candidates; ++candidate) {
+    auto const elapsed = time_candidate(run_candidate, candidate, stream);
+    if (elapsed < best_time) {
+      best_time   = elapsed;
+      best_choice = candidate;
+    }
+  }
+  CUDF_LOG_INFO("Autotuned {} on compute capability {}: candidate {} of {}",
+                key,
+                capability,
+                best_choice,
+                num_candidates);
+
+  std::unique_lock lock{state.mutex};
+  if (state.choices.insert({state_key, best_choice}).second) {
+    // the file is only a cache, so failing to write it is not an error
+    if (auto const path = get_autotune_file(); not path.empty()) {
+      std::ofstream file(path, std::ios::app);
+      file << key << ' ' << best_choice << '\n';
+    }
+  }
+  return best_choice;
+}
+
+}  // namespace cudf::detail
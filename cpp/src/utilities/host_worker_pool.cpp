@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/detail/utilities/host_worker_pool.hpp>
+
+#include <algorithm>
+#include <thread>
+
+namespace cudf::detail {
+
+// the tasks are mostly I/O bound, so a modest number of threads is enough to saturate storage
+// without oversubscribing the host on machines with many cores.
+int constexpr MAX_HOST_WORKER_POOL_SIZE = 32;
+
+thread_pool& host_worker_pool()
+{
+  // hardware_concurrency() may return 0 if the value is not computable
+  static thread_pool pool(std::clamp(
+    static_cast<int>(std::thread::hardware_concurrency()), 1, MAX_HOST_WORKER_POOL_SIZE));
+  return pool;
+}
+
+}  // namespace cudf::detail
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf/utilities/error.hpp>
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/aligned.hpp>
+#include <rmm/error.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+#include <rmm/resource_ref.hpp>
+
+#include <array>
+#include <mutex>
+
+namespace cudf {
+namespace {
+
+constexpr std::size_t num_temporary_allocation_kinds = 3;
+
+std::mutex& temporary_mr_mutex()
+{
+  static std::mutex lock;
+  return lock;
+}
+
+// Must be called with the temporary_mr_mutex mutex held
+std::array<std::optional<rmm::device_async_resource_ref>, num_temporary_allocation_kinds>&
+temporary_upstreams()
+{
+  static std::array<std::optional<rmm::device_async_resource_ref>, num_temporary_allocation_kinds>
+    upstreams{};
+  return upstreams;
+}
+
+// Must be called with the temporary_mr_mutex mutex held
+std::optional<temporary_allocation_spill_callback>& spill_callback()
+{
+  static std::optional<temporary_allocation_spill_callback> callback{};
+  return callback;
+}
+
+std::size_t kind_index(temporary_allocation kind)
+{
+  auto const index = static_cast<std::size_t>(kind);
+  CUDF_EXPECTS(index < num_temporary_allocation_kinds, "Invalid temporary allocation kind");
+  return index;
+}
+
+/**
+ * @brief Resource that forwards temporary allocations of one category to the configured
+ * upstream and retries them through the spill callback when they run out of memory.
+ *
+ * The upstream is looked up on every call so that reconfiguring it does not invalidate
+ * references handed out by `get_temporary_memory_resource`.
+ */
+class temporary_memory_resource final : public rmm::mr::device_memory_resource {
+ public:
+  explicit temporary_memory_resource(temporary_allocation kind) : kind_{kind} {}
+
+ private:
+  [[nodiscard]] rmm::device_async_resource_ref upstream() const
+  {
+    std::scoped_lock lock{temporary_mr_mutex()};
+    auto const& configured = temporary_upstreams()[kind_index(kind_)];
+    return configured.value_or(rmm::mr::get_current_device_resource());
+  }
+
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    while (true) {
+      try {
+        return upstream().allocate_async(bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+      } catch (rmm::out_of_memory const&) {
+        // copy the callback so it runs without the lock held
+        auto const callback = [] {
+          std::scoped_lock lock{temporary_mr_mutex()};
+          return spill_callback();
+        }();
+        if (not callback.has_value() or not(*callback)(bytes, kind_)) { throw; }
+      }
+    }
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    upstream().deallocate_async(ptr, bytes, rmm::CUDA_ALLOCATION_ALIGNMENT, stream);
+  }
+
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+
+  temporary_allocation const kind_;
+};
+
+temporary_memory_resource& temporary_mr(temporary_allocation kind)
+{
+  static std::array<temporary_memory_resource, num_temporary_allocation_kinds> resources{
+    temporary_memory_resource{temporary_allocation::JOIN_HASH_TABLE},
+    temporary_memory_resource{temporary_allocation::IO_SCRATCH},
+    temporary_memory_resource{temporary_allocation::IO_COLUMN_BUFFER}};
+  return resources[kind_index(kind)];
+}
+
+}  // namespace
+
+std::optional<rmm::device_async_resource_ref> set_temporary_memory_resource(
+  temporary_allocation kind, std::optional<rmm::device_async_resource_ref> mr)
+{
+  auto const index = kind_index(kind);
+  std::scoped_lock lock{temporary_mr_mutex()};
+  auto last_mr                 = temporary_upstreams()[index];
+  temporary_upstreams()[index] = mr;
+  return last_mr;
+}
+
+rmm::device_async_resource_ref get_temporary_memory_resource(temporary_allocation kind)
+{
+  return temporary_mr(kind);
+}
+
+std::optional<temporary_allocation_spill_callback> set_temporary_allocation_spill_callback(
+  std::optional<temporary_allocation_spill_callback> callback)
+{
+  std::scoped_lock lock{temporary_mr_mutex()};
+  auto last_callback = std::move(spill_callback());
+  spill_callback()   = std::move(callback);
+  return last_callback;
+}
+
+}  // namespace cudf
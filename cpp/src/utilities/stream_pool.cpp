@@ -14,6 +14,7 @@
  * limitations under the License.
  */
 
+#include <cudf/column/column.hpp>
 #include <cudf/detail/utilities/logger.hpp>
 #include <cudf/detail/utilities/stream_pool.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -194,4 +195,38 @@ void join_streams(host_span<rmm::cuda_stream_view const> streams, rmm::cuda_stre
   });
 }
 
+namespace {
+
+std::unique_ptr<column> set_column_stream(std::unique_ptr<column>&& col,
+                                          rmm::cuda_stream_view stream)
+{
+  auto const type       = col->type();
+  auto const size       = col->size();
+  auto const null_count = col->null_count();
+  auto contents         = col->release();
+  contents.data->set_stream(stream);
+  contents.null_mask->set_stream(stream);
+  for (auto& child : contents.children) {
+    child = set_column_stream(std::move(child), stream);
+  }
+  return std::make_unique<column>(type,
+                                  size,
+                                  std::move(*contents.data),
+                                  std::move(*contents.null_mask),
+                                  null_count,
+                                  std::move(contents.children));
+}
+
+}  // namespace
+
+void join_streams(host_span<rmm::cuda_stream_view const> streams,
+                  rmm::cuda_stream_view stream,
+                  host_span<std::unique_ptr<column>> columns)
+{
+  join_streams(streams, stream);
+  for (auto& col : columns) {
+    if (col) { col = set_column_stream(std::move(col), stream); }
+  }
+}
+
 }  // namespace cudf::detail
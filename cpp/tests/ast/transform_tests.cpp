@@ -21,7 +21,9 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/testing_main.hpp>
 
+#include <cudf/ast/expression_builder.hpp>
 #include <cudf/ast/expressions.hpp>
+#include <cudf/binaryop.hpp>
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/detail/iterator.cuh>
@@ -41,6 +43,7 @@
 #include <limits>
 #include <list>
 #include <random>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -828,4 +831,234 @@ TEST_F(TransformTest, NullLogicalOr)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
 }
 
+TEST_F(TransformTest, StringStartsWithContains)
+{
+  auto c_0 = cudf::test::strings_column_wrapper(
+    {"abc", "ab", "xabc", "", "abcabc", "null", "Ab€c"}, {1, 1, 1, 1, 1, 0, 1});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0    = cudf::ast::column_reference(0);
+  auto target_value = cudf::string_scalar("abc");
+  auto target       = cudf::ast::literal(target_value);
+  auto euro_value   = cudf::string_scalar("€c");
+  auto euro         = cudf::ast::literal(euro_value);
+
+  auto starts_with = cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, target);
+  auto expected    = column_wrapper<bool>{{true, false, false, false, true, false, false},
+                                          {1, 1, 1, 1, 1, 0, 1}};
+  auto result      = cudf::compute_column(table, starts_with);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  auto contains = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, target);
+  expected      = column_wrapper<bool>{{true, false, true, false, true, false, false},
+                                       {1, 1, 1, 1, 1, 0, 1}};
+  result        = cudf::compute_column(table, contains);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  auto contains_euro = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, euro);
+  expected           = column_wrapper<bool>{{false, false, false, false, false, false, true},
+                                            {1, 1, 1, 1, 1, 0, 1}};
+  result             = cudf::compute_column(table, contains_euro);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLike)
+{
+  auto c_0 = cudf::test::strings_column_wrapper(
+    {"abc", "aXbYc", "ac", "abcd", "", "a€bc", "xyz", "abcbc"});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto like      = [&](std::string const& pattern) {
+    auto pattern_value = cudf::string_scalar(pattern);
+    auto literal       = cudf::ast::literal(pattern_value);
+    auto expression    = cudf::ast::operation(cudf::ast::ast_operator::LIKE, col_ref_0, literal);
+    return cudf::compute_column(table, expression);
+  };
+
+  auto expected = column_wrapper<bool>{true, true, false, false, false, true, false, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, like("a%b%c")->view(), verbosity);
+  expected = column_wrapper<bool>{true, false, false, false, false, false, true, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, like("___")->view(), verbosity);
+  expected = column_wrapper<bool>{false, false, false, false, false, true, false, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, like("a_bc")->view(), verbosity);
+  expected = column_wrapper<bool>{true, true, true, true, true, true, true, true};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, like("%")->view(), verbosity);
+  expected = column_wrapper<bool>{false, false, false, false, true, false, false, false};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, like("")->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringLength)
+{
+  auto c_0 =
+    cudf::test::strings_column_wrapper({"abc", "", "a€bc", "null", "xy"}, {1, 1, 1, 0, 1});
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto literal_value = cudf::numeric_scalar<int32_t>(2);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto length   = cudf::ast::operation(cudf::ast::ast_operator::LENGTH, col_ref_0);
+  auto expected = column_wrapper<int32_t>{{3, 0, 4, 0, 2}, {1, 1, 1, 0, 1}};
+  auto result   = cudf::compute_column(table, length);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view(), verbosity);
+
+  // the string operators are evaluated inline with the rest of the expression
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::GREATER, length, literal);
+  auto expected_greater = column_wrapper<bool>{{true, false, true, false, false}, {1, 1, 1, 0, 1}};
+  result                = cudf::compute_column(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_greater, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, StringOperatorTypeFailure)
+{
+  auto c_0   = column_wrapper<int32_t>{1, 2, 3};
+  auto table = cudf::table_view{{c_0}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto length    = cudf::ast::operation(cudf::ast::ast_operator::LENGTH, col_ref_0);
+  EXPECT_THROW(cudf::compute_column(table, length), cudf::logic_error);
+  auto contains = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_0, col_ref_0);
+  EXPECT_THROW(cudf::compute_column(table, contains), cudf::logic_error);
+}
+
+TEST_F(TransformTest, JitArithmeticWithLiterals)
+{
+  auto c_0   = column_wrapper<int32_t>{3, 20, 1, 50, -7};
+  auto c_1   = column_wrapper<int64_t>{10, 7, 20, 0, 4};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0     = cudf::ast::column_reference(0);
+  auto col_ref_1     = cudf::ast::column_reference(1);
+  auto literal_value = cudf::numeric_scalar<int64_t>(3);
+  auto literal       = cudf::ast::literal(literal_value);
+
+  auto cast_0     = cudf::ast::operation(cudf::ast::ast_operator::CAST_TO_INT64, col_ref_0);
+  auto mul        = cudf::ast::operation(cudf::ast::ast_operator::MUL, cast_0, literal);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::PYMOD, mul, col_ref_1);
+
+  // literal values are kernel inputs so a different value reuses the compiled kernel
+  auto result = cudf::compute_column_jit(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::compute_column(table, expression)->view(), result->view());
+
+  literal_value.set_value(5);
+  result = cudf::compute_column_jit(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::compute_column(table, expression)->view(), result->view());
+}
+
+TEST_F(TransformTest, JitNulls)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 1}};
+  auto c_1   = column_wrapper<int32_t>{{10, 7, 20, 0}, {1, 1, 0, 1}};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto add        = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, add, col_ref_0);
+
+  auto expected = column_wrapper<bool>{{false, false, false, false}, {1, 0, 0, 1}};
+  auto result   = cudf::compute_column_jit(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitFloatMath)
+{
+  auto c_0   = column_wrapper<double>{0.0, M_PI / 4, M_PI / 3, -2.5};
+  auto c_1   = column_wrapper<double>{1.0, 2.0, 0.5, 4.0};
+  auto table = cudf::table_view{{c_0, c_1}};
+
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(1);
+  auto sin        = cudf::ast::operation(cudf::ast::ast_operator::SIN, col_ref_0);
+  auto sqrt       = cudf::ast::operation(cudf::ast::ast_operator::SQRT, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::TRUE_DIV, sin, sqrt);
+
+  auto expected = cudf::compute_column(table, expression);
+  auto result   = cudf::compute_column_jit(table, expression);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, JitFallback)
+{
+  auto c_0   = column_wrapper<int32_t>{{3, 20, 1, 50}, {1, 0, 1, 0}};
+  auto c_1   = column_wrapper<int32_t>{{3, 7, 20, 0}, {1, 1, 0, 0}};
+  auto c_2   = cudf::test::strings_column_wrapper({"a", "b", "c", "d"});
+  auto table = cudf::table_view{{c_0, c_1, c_2}};
+
+  auto col_ref_0 = cudf::ast::column_reference(0);
+  auto col_ref_1 = cudf::ast::column_reference(1);
+  auto col_ref_2 = cudf::ast::column_reference(2);
+
+  // operators and types without a generated translation use the expression interpreter
+  auto null_equal = cudf::ast::operation(cudf::ast::ast_operator::NULL_EQUAL, col_ref_0, col_ref_1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::compute_column(table, null_equal)->view(),
+                                 cudf::compute_column_jit(table, null_equal)->view());
+
+  auto string_value   = cudf::string_scalar("b");
+  auto string_literal = cudf::ast::literal(string_value);
+  auto string_equal =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref_2, string_literal);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(cudf::compute_column(table, string_equal)->view(),
+                                 cudf::compute_column_jit(table, string_equal)->view());
+
+  auto mismatched = cudf::ast::operation(cudf::ast::ast_operator::ADD, col_ref_0, col_ref_2);
+  EXPECT_THROW(cudf::compute_column_jit(table, mismatched), cudf::logic_error);
+}
+
+TEST_F(TransformTest, ExpressionBuilderChain)
+{
+  auto a = column_wrapper<int32_t>{{3, 20, 1, 50, -7}, {1, 1, 0, 1, 1}};
+  auto b = column_wrapper<int64_t>{10, 7, 20, 0, 4};
+  auto c = column_wrapper<double>{0.5, -1.0, 2.0, 3.25, 8.0};
+  auto d = column_wrapper<double>{{2.0, 4.0, 1.0, 0.5, 3.0}, {1, 1, 1, 1, 0}};
+
+  auto builder = cudf::ast::expression_builder{};
+  auto mul     = builder.binary(cudf::binary_operator::MUL, builder.column(a), builder.column(b));
+  auto add     = builder.binary(cudf::binary_operator::ADD, mul, builder.column(c));
+  auto div     = builder.binary(cudf::binary_operator::DIV, add, builder.column(d));
+  EXPECT_EQ(mul.type(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(div.type(), cudf::data_type{cudf::type_id::FLOAT64});
+
+  auto const int64_type   = cudf::data_type{cudf::type_id::INT64};
+  auto const float64_type = cudf::data_type{cudf::type_id::FLOAT64};
+
+  auto expected_mul = cudf::binary_operation(a, b, cudf::binary_operator::MUL, int64_type);
+  auto expected_add =
+    cudf::binary_operation(expected_mul->view(), c, cudf::binary_operator::ADD, float64_type);
+  auto expected =
+    cudf::binary_operation(expected_add->view(), d, cudf::binary_operator::DIV, float64_type);
+
+  auto result = builder.evaluate(div);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected->view(), result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ExpressionBuilderLiteralAndUnary)
+{
+  auto a = column_wrapper<float>{1.0f, 4.0f, 9.0f, 16.0f};
+
+  auto builder = cudf::ast::expression_builder{};
+  auto sqrt    = builder.unary(cudf::unary_operator::SQRT, builder.column(a));
+  auto sum     = builder.binary(cudf::binary_operator::ADD, sqrt, builder.literal<int32_t>(2));
+  EXPECT_EQ(sum.type(), cudf::data_type{cudf::type_id::FLOAT64});
+
+  auto expected = column_wrapper<double>{3.0, 4.0, 5.0, 6.0};
+  auto result   = builder.evaluate(sum);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view(), verbosity);
+}
+
+TEST_F(TransformTest, ExpressionBuilderFailures)
+{
+  auto a = column_wrapper<int32_t>{1, 2, 3};
+  auto b = column_wrapper<int32_t>{1, 2};
+
+  auto builder = cudf::ast::expression_builder{};
+  auto a_node  = builder.column(a);
+  EXPECT_THROW(builder.column(b), cudf::logic_error);
+  EXPECT_THROW(builder.binary(cudf::binary_operator::FLOOR_DIV, a_node, a_node),
+               cudf::logic_error);
+  EXPECT_THROW(builder.unary(cudf::ast::ast_operator::ADD, a_node), cudf::logic_error);
+  EXPECT_THROW(builder.cast(a_node, cudf::data_type{cudf::type_id::INT8}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
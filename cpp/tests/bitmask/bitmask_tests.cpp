@@ -34,6 +34,7 @@
 #include <rmm/device_uvector.hpp>
 
 #include <stdexcept>
+#include <vector>
 
 struct BitmaskUtilitiesTest : public cudf::test::BaseFixture {};
 
@@ -754,4 +755,86 @@ TEST_F(MergeBitmaskTest, TestBitmaskOr)
   EXPECT_EQ(nullptr, result3_mask.data());
 }
 
+TEST_F(MergeBitmaskTest, TestBatchedBitmaskBinops)
+{
+  auto const num_rows = 1000;
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const every_third =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto const every_fifth =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> const col1(
+    sequence, sequence + num_rows, every_third);
+  cudf::test::fixed_width_column_wrapper<int32_t> const col2(
+    sequence, sequence + num_rows, every_fifth);
+  cudf::test::fixed_width_column_wrapper<int32_t> const col3(sequence, sequence + num_rows);
+
+  auto const full = cudf::table_view({col1, col2});
+  // the slices start at word-aligned, misaligned and partial word offsets
+  std::vector<cudf::table_view> const views{
+    full,
+    cudf::slice(full, {128, 900}).front(),
+    cudf::slice(full, {37, 999}).front(),
+    cudf::slice(full, {5, 20}).front(),
+    cudf::table_view({col1, col3}),
+    cudf::table_view({col3}),
+    cudf::slice(full, {10, 10}).front(),
+    cudf::table_view{}};
+
+  auto const check = [&](auto const& batched, auto binop) {
+    ASSERT_EQ(batched.size(), views.size());
+    for (std::size_t i = 0; i < views.size(); ++i) {
+      auto const [expected_mask, expected_null_count] = binop(views[i]);
+      EXPECT_EQ(batched[i].second, expected_null_count);
+      if (expected_mask.data() == nullptr) {
+        EXPECT_EQ(batched[i].first.data(), nullptr);
+      } else {
+        CUDF_TEST_EXPECT_EQUAL_BUFFERS(batched[i].first.data(),
+                                       expected_mask.data(),
+                                       cudf::num_bitmask_words(views[i].num_rows()));
+      }
+    }
+  };
+  check(cudf::bitmask_and(views), [](auto const& view) { return cudf::bitmask_and(view); });
+  check(cudf::bitmask_or(views), [](auto const& view) { return cudf::bitmask_or(view); });
+}
+
+struct CompactNullMasksTest : public cudf::test::BaseFixture {};
+
+TEST_F(CompactNullMasksTest, Views)
+{
+  auto const all_valid = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 1, 1});
+  auto const some_null = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 0, 1});
+  auto const strings   = cudf::test::strings_column_wrapper({"a", "b", "c"}, {1, 1, 1});
+  auto const input     = cudf::table_view({all_valid, some_null, strings});
+  ASSERT_TRUE(cudf::column_view(all_valid).nullable());
+
+  auto const result = cudf::compact_null_masks(input);
+  EXPECT_FALSE(result.column(0).nullable());
+  EXPECT_TRUE(result.column(1).nullable());
+  EXPECT_FALSE(result.column(2).nullable());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(input.column(0), result.column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(input.column(1), result.column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(input.column(2), result.column(2));
+
+  // a slice without nulls of a column with nulls
+  auto const sliced = cudf::slice(some_null, {2, 3}).front();
+  EXPECT_FALSE(cudf::compact_null_masks(sliced).nullable());
+}
+
+TEST_F(CompactNullMasksTest, Columns)
+{
+  auto all_valid = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 1, 1}).release();
+  cudf::compact_null_masks(*all_valid);
+  EXPECT_FALSE(all_valid->nullable());
+
+  // the parent null is pushed down to the child, so both keep their masks
+  auto child   = cudf::test::fixed_width_column_wrapper<int32_t>({1, 2, 3}, {1, 1, 1});
+  auto structs = cudf::test::structs_column_wrapper({child}, {1, 0, 1}).release();
+  cudf::compact_null_masks(*structs);
+  EXPECT_TRUE(structs->nullable());
+  EXPECT_EQ(structs->null_count(), 1);
+  EXPECT_TRUE(structs->child(0).nullable());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -36,9 +36,11 @@
 
 #include <thrust/iterator/constant_iterator.h>
 
+#include <memory>
 #include <numeric>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -342,6 +344,47 @@ TEST_F(TableTest, ConcatenateTablesWithOffsetsAndNulls)
   }
 }
 
+TEST_F(TableTest, ConcatenateManySmallTables)
+{
+  // Many slices of a table with fixed-width columns of every element size, with and without nulls
+  auto constexpr num_rows = 1000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  auto strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i); });
+
+  column_wrapper<int8_t> col0(sequence, sequence + num_rows, valids);
+  column_wrapper<int16_t> col1(sequence, sequence + num_rows);
+  column_wrapper<float> col2(sequence, sequence + num_rows, valids);
+  s_col_wrapper col3(strings, strings + num_rows, valids);
+  column_wrapper<int64_t> col4(sequence, sequence + num_rows);
+  cudf::test::fixed_point_column_wrapper<__int128_t> col5(
+    sequence, sequence + num_rows, valids, numeric::scale_type{2});
+  column_wrapper<bool> col6(sequence, sequence + num_rows);
+  TView input{{col0, col1, col2, col3, col4, col5, col6}};
+
+  std::vector<cudf::size_type> splits(num_rows / 3);
+  std::transform(splits.begin(), splits.end(), splits.begin(), [i = 0](auto) mutable {
+    i += 3;
+    return i;
+  });
+  auto const tables = cudf::split(input, splits);
+  auto result       = cudf::concatenate(tables);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), input);
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    EXPECT_EQ(result->get_column(i).null_count(), input.column(i).null_count());
+  }
+
+  // Slices that skip rows, and empty slices
+  std::vector<cudf::size_type> indices{1, 4, 10, 10, 500, 999};
+  auto const slices   = cudf::slice(input, indices);
+  result              = cudf::concatenate(slices);
+  auto const expected = cudf::concatenate(std::vector<TView>{
+    cudf::slice(input, {1, 4})[0], cudf::slice(input, {500, 999})[0]});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result->view(), expected->view());
+}
+
 struct OverflowTest : public cudf::test::BaseFixture {};
 
 TEST_F(OverflowTest, OverflowTest)
@@ -1658,3 +1701,30 @@ TEST_F(DictionaryConcatTest, ErrorsTest)
   std::vector<cudf::column_view> empty;
   EXPECT_THROW(cudf::concatenate(empty), cudf::logic_error);
 }
+
+struct ConcatenateManyColumnsTest : public cudf::test::BaseFixture {};
+
+TEST_F(ConcatenateManyColumnsTest, SmallStringAndListColumns)
+{
+  // Many small string and list columns, each of which is processed on its own stream
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 1; });
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int32_t i = 0; i < 32; ++i) {
+    auto const s = std::to_string(i);
+    columns.push_back(cudf::test::strings_column_wrapper({s, "", s + s, "x" + s, s + "yz"},
+                                                         validity + i)
+                        .release());
+    columns.push_back(cudf::test::lists_column_wrapper<int32_t>(
+                        {{i, i + 1}, {}, {i * 2}, {i, i, i}, {i + 3}}, validity + i + 1)
+                        .release());
+  }
+  auto const source = cudf::table(std::move(columns));
+
+  for (auto const& splits :
+       {std::vector<cudf::size_type>{2}, std::vector<cudf::size_type>{1, 1, 4}}) {
+    auto const pieces = cudf::split(source.view(), splits);
+    auto const result = cudf::concatenate(pieces);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(source.view(), result->view());
+  }
+}
@@ -25,9 +25,14 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <memory>
+#include <string>
+#include <vector>
+
 template <typename T>
 class GatherTest : public cudf::test::BaseFixture {};
 
@@ -243,3 +248,83 @@ TYPED_TEST(GatherTest, MultiColNulls)
     CUDF_TEST_EXPECT_COLUMNS_EQUAL(expect_column, result->view().column(i));
   }
 }
+
+struct GatherBatchedTest : public cudf::test::BaseFixture {};
+
+TEST_F(GatherBatchedTest, ManyFixedWidthColumns)
+{
+  // more columns than a single batch, of every element size, mixed with strings
+  constexpr cudf::size_type source_size{1000};
+  auto data     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i); });
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int i = 0; i < 30; ++i) {
+    columns.push_back(cudf::test::fixed_width_column_wrapper<int8_t>(
+                        data + i, data + i + source_size, validity + i)
+                        .release());
+    columns.push_back(
+      cudf::test::fixed_width_column_wrapper<int16_t>(data + i, data + i + source_size).release());
+    columns.push_back(cudf::test::fixed_width_column_wrapper<float>(
+                        data + i, data + i + source_size, validity + i)
+                        .release());
+    columns.push_back(
+      cudf::test::fixed_width_column_wrapper<double>(data + i, data + i + source_size).release());
+    columns.push_back(cudf::test::fixed_point_column_wrapper<__int128_t>(
+                        data + i, data + i + source_size, validity + i, numeric::scale_type{-2})
+                        .release());
+  }
+  columns.push_back(
+    cudf::test::strings_column_wrapper(strings, strings + source_size, validity).release());
+  auto const source = cudf::table(std::move(columns));
+
+  // reversed, with out-of-bounds entries
+  auto map_data =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 1099 - 2 * i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map(map_data, map_data + 600);
+
+  for (auto const policy : {cudf::out_of_bounds_policy::NULLIFY,
+                            cudf::out_of_bounds_policy::DONT_CHECK}) {
+    auto const map = policy == cudf::out_of_bounds_policy::NULLIFY
+                       ? cudf::column_view(gather_map)
+                       : cudf::slice(gather_map, {50, 550}).front();
+    auto const result = cudf::gather(source.view(), map, policy);
+    ASSERT_EQ(result->num_columns(), source.num_columns());
+    for (auto i = 0; i < source.num_columns(); ++i) {
+      // a single column is gathered on its own
+      auto const expected = cudf::gather(cudf::table_view({source.view().column(i)}), map, policy);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view().column(0), result->view().column(i));
+    }
+  }
+}
+
+struct GatherManyColumnsTest : public cudf::test::BaseFixture {};
+
+TEST_F(GatherManyColumnsTest, SmallStringAndListColumns)
+{
+  // Many small string and list columns, each of which is processed on its own stream
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 1; });
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int32_t i = 0; i < 32; ++i) {
+    auto const s = std::to_string(i);
+    columns.push_back(cudf::test::strings_column_wrapper({s, "", s + s, "x" + s, s + "yz"},
+                                                         validity + i)
+                        .release());
+    columns.push_back(cudf::test::lists_column_wrapper<int32_t>(
+                        {{i, i + 1}, {}, {i * 2}, {i, i, i}, {i + 3}}, validity + i + 1)
+                        .release());
+  }
+  auto const source = cudf::table(std::move(columns));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{4, 0, 2, 2, 1, 3};
+  auto const result = cudf::gather(source.view(), gather_map);
+  ASSERT_EQ(result->num_columns(), source.num_columns());
+  for (auto i = 0; i < source.num_columns(); ++i) {
+    // a single column is gathered on the caller's stream
+    auto const expected = cudf::gather(cudf::table_view({source.view().column(i)}), gather_map);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view().column(0), result->view().column(i));
+  }
+}
@@ -24,9 +24,13 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 
+#include <stdexcept>
+#include <vector>
+
 struct SampleTest : public cudf::test::BaseFixture {};
 
 TEST_F(SampleTest, FailCaseRowMultipleSampling)
@@ -110,3 +114,54 @@ INSTANTIATE_TEST_CASE_P(
                     std::make_tuple(1024, cudf::sample_with_replacement::TRUE),
                     std::make_tuple(1024, cudf::sample_with_replacement::FALSE),
                     std::make_tuple(2048, cudf::sample_with_replacement::TRUE)));
+
+TEST_F(SampleTest, SampleFraction)
+{
+  cudf::size_type const table_size = 10000;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col1(data, data + table_size);
+  cudf::table_view input({col1});
+
+  EXPECT_EQ(cudf::sample_fraction(input, 0.0, 1)->num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, cudf::sample_fraction(input, 1.0, 1)->view());
+
+  auto const out = cudf::sample_fraction(input, 0.1, 1);
+  EXPECT_GT(out->num_rows(), table_size / 20);
+  EXPECT_LT(out->num_rows(), table_size / 5);
+  // The sampled rows are kept in their original order
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), cudf::sort(out->view())->view());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(out->view(), cudf::sample_fraction(input, 0.1, 1)->view());
+
+  EXPECT_THROW(cudf::sample_fraction(input, 1.5), std::invalid_argument);
+}
+
+TEST_F(SampleTest, ReservoirSample)
+{
+  cudf::size_type const batch_size = 1000;
+  cudf::size_type const n_samples  = 100;
+  auto data = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1(data, data + batch_size);
+  cudf::test::fixed_width_column_wrapper<int32_t> batch2(data + batch_size, data + 2 * batch_size);
+
+  auto const [sample1, keys1] = cudf::reservoir_sample(cudf::table_view{{batch1}}, n_samples, 1);
+  auto const [sample2, keys2] = cudf::reservoir_sample(cudf::table_view{{batch2}}, n_samples, 2);
+  EXPECT_EQ(sample1->num_rows(), n_samples);
+  EXPECT_EQ(keys1->size(), n_samples);
+
+  std::vector<cudf::table_view> const samples{sample1->view(), sample2->view()};
+  std::vector<cudf::column_view> const keys{keys1->view(), keys2->view()};
+  auto const [merged, merged_keys] = cudf::merge_reservoir_samples(samples, keys, n_samples);
+  EXPECT_EQ(merged->num_rows(), n_samples);
+  EXPECT_EQ(merged_keys->size(), n_samples);
+  EXPECT_EQ(cudf::distinct_count(
+              merged->get_column(0), cudf::null_policy::INCLUDE, cudf::nan_policy::NAN_IS_VALID),
+            n_samples);
+
+  // All the rows are sampled when there are fewer than n
+  auto const [all, all_keys] = cudf::reservoir_sample(cudf::table_view{{batch1}}, 2 * batch_size);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{batch1}}, all->view());
+
+  EXPECT_THROW(cudf::reservoir_sample(cudf::table_view{{batch1}}, -1), std::invalid_argument);
+  std::vector<cudf::column_view> const bad_keys{batch1, batch2};
+  EXPECT_THROW(cudf::merge_reservoir_samples(samples, bad_keys, n_samples), cudf::data_type_error);
+}
@@ -31,6 +31,8 @@
 
 #include <rmm/device_buffer.hpp>
 
+#include <src/io/comp/nvcomp_adapter.hpp>
+
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/iterator/transform_iterator.h>
 
@@ -2530,3 +2532,164 @@ TEST_F(ContiguousSplitNestedTypesTest, ListOfStructChunked)
     },
     /*split*/ false);
 }
+
+struct ChunkedPackToHostTest : public cudf::test::BaseFixture,
+                               public ::testing::WithParamInterface<cudf::packed_compression> {};
+
+TEST_P(ChunkedPackToHostTest, RoundTrip)
+{
+  auto const compression = GetParam();
+  if (compression != cudf::packed_compression::NONE) {
+    auto const codec = compression == cudf::packed_compression::LZ4
+                         ? cudf::io::nvcomp::compression_type::LZ4
+                         : cudf::io::nvcomp::compression_type::ZSTD;
+    if (cudf::io::nvcomp::is_compression_disabled(codec).has_value() or
+        cudf::io::nvcomp::is_decompression_disabled(codec).has_value()) {
+      GTEST_SKIP() << "Codec is not available";
+    }
+  }
+
+  // about 12MB of data, so several chunks alternate between the two 1MB buffers
+  constexpr cudf::size_type num_rows = 1'000'000;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  auto const repeating               = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 100); });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 17 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(sequence, sequence + num_rows, valids);
+  cudf::test::fixed_width_column_wrapper<int64_t> compressible(repeating, repeating + num_rows);
+  cudf::test::strings_column_wrapper strings({"a", "bb", "", "dddd"}, {true, true, false, true});
+  auto const expected_ints = cudf::table_view{{ints, compressible}};
+
+  constexpr std::size_t buffer_size = 1024 * 1024;
+  for (auto const& expected : {expected_ints, cudf::table_view{{strings}}}) {
+    auto const host = cudf::chunked_pack_to_host(expected, buffer_size, compression);
+    EXPECT_EQ(host.chunks.size(), host.chunk_sizes.size());
+    for (std::size_t i = 0; i < host.chunks.size(); ++i) {
+      EXPECT_LE(host.chunks[i].size(), host.chunk_sizes[i]);
+    }
+
+    auto const packed = cudf::chunked_unpack(host);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf::unpack(packed));
+  }
+}
+
+TEST_F(ContiguousSplitTableCornerCases, ChunkedPackToHostEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  auto const expected = cudf::table_view{{ints}};
+
+  auto const host = cudf::chunked_pack_to_host(expected, 1024 * 1024);
+  EXPECT_TRUE(host.chunks.empty());
+  auto const packed = cudf::chunked_unpack(host);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, cudf::unpack(packed));
+}
+
+INSTANTIATE_TEST_CASE_P(ChunkedPack,
+                        ChunkedPackToHostTest,
+                        ::testing::Values(cudf::packed_compression::NONE,
+                                          cudf::packed_compression::LZ4,
+                                          cudf::packed_compression::ZSTD));
+
+TEST_F(ContiguousSplitTableCornerCases, BatchedManySplits)
+{
+  constexpr cudf::size_type num_rows = 20'000;
+  auto const sequence                = thrust::make_counting_iterator(0);
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int64_t> ints(sequence, sequence + num_rows, valids);
+  std::vector<std::string> words(num_rows);
+  std::transform(sequence, sequence + num_rows, words.begin(), [](auto i) {
+    return std::string(i % 5, 'a');
+  });
+  cudf::test::strings_column_wrapper strings(words.begin(), words.end(), valids);
+  auto const offsets = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return (i % 3) == 0 ? i : i + 1; });
+  auto list_offsets =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>(offsets, offsets + num_rows + 1);
+  auto list_values =
+    cudf::test::fixed_width_column_wrapper<int32_t>(sequence, sequence + num_rows + 1);
+  auto const lists = cudf::make_lists_column(
+    num_rows, list_offsets.release(), list_values.release(), 0, rmm::device_buffer{});
+  cudf::table_view const input{{ints, strings, *lists}};
+
+  // uneven splits, including empty ones
+  std::vector<cudf::size_type> splits;
+  for (cudf::size_type row = 0; row < num_rows; row += (splits.size() % 4)) {
+    splits.push_back(row);
+  }
+
+  auto const result   = cudf::contiguous_split_batched(input, splits);
+  auto const expected = cudf::split(input, splits);
+  ASSERT_EQ(expected.size() + 1, result.data_offsets.size());
+  EXPECT_EQ(result.data_offsets.back(), result.gpu_data->size());
+  for (std::size_t index = 0; index < expected.size(); index++) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected[index], cudf::unpack(result, index));
+  }
+  EXPECT_THROW(cudf::unpack(result, expected.size()), std::out_of_range);
+}
+
+TEST_F(ContiguousSplitTableCornerCases, BatchedEmpty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::test::strings_column_wrapper strings{};
+  cudf::table_view const input{{ints, strings}};
+
+  auto const result = cudf::contiguous_split_batched(input, {0, 0});
+  ASSERT_EQ(4, result.data_offsets.size());
+  for (std::size_t index = 0; index < 3; index++) {
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, cudf::unpack(result, index));
+  }
+
+  auto const no_columns = cudf::contiguous_split_batched(cudf::table_view{}, {});
+  EXPECT_TRUE(no_columns.data_offsets.empty());
+}
+
+struct SplitBySizeTest : public cudf::test::BaseFixture {};
+
+TEST_F(SplitBySizeTest, FixedWidth)
+{
+  // 4 bytes per row
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{0, 1, 2, 3, 4, 5, 6, 7, 8, 9};
+  cudf::table_view const input{{ints}};
+
+  auto const check = [&](std::size_t max_bytes, std::vector<cudf::size_type> const& splits) {
+    auto const expected = cudf::split(input, splits);
+    auto const result   = cudf::split_by_size(input, max_bytes);
+    ASSERT_EQ(expected.size(), result.size());
+    for (std::size_t index = 0; index < expected.size(); index++) {
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected[index], result[index]);
+    }
+    auto const packed = cudf::contiguous_split_by_size(input, max_bytes);
+    ASSERT_EQ(expected.size(), packed.size());
+    for (std::size_t index = 0; index < expected.size(); index++) {
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected[index], packed[index].table);
+    }
+  };
+
+  check(12, {3, 6, 9});
+  check(14, {3, 6, 9});
+  check(40, {});
+  // rows larger than the limit are split on their own
+  check(2, {1, 2, 3, 4, 5, 6, 7, 8, 9});
+}
+
+TEST_F(SplitBySizeTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{};
+  cudf::table_view const input{{ints}};
+
+  auto const result = cudf::split_by_size(input, 16);
+  ASSERT_EQ(1, result.size());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, result.front());
+
+  EXPECT_TRUE(cudf::split_by_size(cudf::table_view{}, 16).empty());
+}
+
+TEST_F(SplitBySizeTest, ZeroLimit)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{0, 1, 2};
+  cudf::table_view const input{{ints}};
+
+  EXPECT_THROW(cudf::split_by_size(input, 0), std::invalid_argument);
+}
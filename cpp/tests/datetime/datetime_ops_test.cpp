@@ -26,6 +26,8 @@
 #include <cudf/column/column_view.hpp>
 #include <cudf/datetime.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/timezone.hpp>
 #include <cudf/types.hpp>
 #include <cudf/wrappers/timestamps.hpp>
 
@@ -1052,4 +1054,68 @@ TYPED_TEST(TypedDatetimeOpsTest, TestRoundDatetime)
                                  expected_nanosecond);
 }
 
+TEST_F(BasicDatetimeOpsTest, TestExtractingDatetimeComponentsFused)
+{
+  using namespace cudf::test;
+  using namespace cudf::datetime;
+  using namespace cuda::std::chrono;
+
+  auto timestamps_ns =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ns, cudf::timestamp_ns::rep>{
+      {-1528935590000000000L,  // 1921-07-07 00:20:10
+       1530705600123456789L,   // 2018-07-04 12:00:00.123456789
+       0L},
+      {true, true, false}};
+
+  auto const components = std::vector<datetime_component>{datetime_component::NANOSECOND,
+                                                          datetime_component::YEAR,
+                                                          datetime_component::WEEKDAY,
+                                                          datetime_component::MILLISECOND,
+                                                          datetime_component::HOUR};
+
+  auto const result = extract_datetime_components(timestamps_ns, components);
+  ASSERT_EQ(result->num_columns(), static_cast<cudf::size_type>(components.size()));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(0),
+                                 *extract_nanosecond_fraction(timestamps_ns));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(1), *extract_year(timestamps_ns));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(2), *extract_weekday(timestamps_ns));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(3),
+                                 *extract_millisecond_fraction(timestamps_ns));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(4), *extract_hour(timestamps_ns));
+
+  EXPECT_THROW(extract_datetime_components(
+                 timestamps_ns, {datetime_component::DAY, datetime_component::DAY}),
+               std::invalid_argument);
+}
+
+TEST_F(BasicDatetimeOpsTest, TestConvertTimezone)
+{
+  using namespace cudf::test;
+  using namespace cuda::std::chrono;
+
+  // 2024-01-15 12:00:00 and 2024-07-15 12:00:00 UTC, one null
+  auto const utc = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {1705320000L, 1721044800L, 0L}, {true, true, false}};
+  // Pacific Standard Time is UTC-8, Pacific Daylight Time is UTC-7
+  auto const los_angeles = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {1705320000L - 8 * 3600, 1721044800L - 7 * 3600, 0L}, {true, true, false}};
+  // Central European Time is UTC+1, Central European Summer Time is UTC+2
+  auto const paris = fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+    {1705320000L + 3600, 1721044800L + 2 * 3600, 0L}, {true, true, false}};
+
+  auto const to_local = cudf::convert_timezone(utc, "UTC", "America/Los_Angeles");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*to_local, los_angeles);
+
+  auto const to_utc = cudf::convert_timezone(los_angeles, "America/Los_Angeles", "UTC");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*to_utc, utc);
+
+  // Repeated conversions reuse the cached transition tables
+  auto const to_paris = cudf::convert_timezone(los_angeles, "America/Los_Angeles", "Europe/Paris");
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*to_paris, paris);
+
+  EXPECT_THROW(cudf::convert_timezone(fixed_width_column_wrapper<int32_t>{1, 2}, "UTC", "UTC"),
+               cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -76,3 +76,18 @@ TEST_F(DictionaryEncodeTest, InvalidEncode)
   EXPECT_THROW(cudf::dictionary::encode(input, cudf::data_type{cudf::type_id::INT16}),
                cudf::logic_error);
 }
+
+TEST_F(DictionaryEncodeTest, LowCardinality)
+{
+  cudf::test::strings_column_wrapper low({"aa", "bb", "aa", "aa", "bb", "aa", "bb", "aa"});
+  EXPECT_TRUE(cudf::dictionary::is_low_cardinality(low));
+
+  cudf::test::strings_column_wrapper high({"aa", "bb", "cc", "dd", "ee", "ff", "gg", "hh"});
+  EXPECT_FALSE(cudf::dictionary::is_low_cardinality(high));
+  EXPECT_TRUE(cudf::dictionary::is_low_cardinality(high, 1.0));
+
+  cudf::test::fixed_width_column_wrapper<int32_t> nulls({1, 2, 3}, {0, 0, 0});
+  EXPECT_TRUE(cudf::dictionary::is_low_cardinality(nulls));
+
+  EXPECT_THROW(cudf::dictionary::is_low_cardinality(low, 1.5), std::invalid_argument);
+}
@@ -19,8 +19,10 @@
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/random.hpp>
+#include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/filling.hpp>
 #include <cudf/scalar/scalar.hpp>
@@ -34,6 +36,7 @@
 #include <algorithm>
 #include <numeric>
 #include <random>
+#include <stdexcept>
 
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
 
@@ -306,3 +309,53 @@ TEST_F(RepeatErrorTestFixture, NegativeCount)
   cudf::table_view input_table{{input}};
   EXPECT_THROW(cudf::repeat(input_table, -1), cudf::logic_error);
 }
+
+class GatherRepeatedTestFixture : public cudf::test::BaseFixture {};
+
+TEST_F(GatherRepeatedTestFixture, MatchesRepeat)
+{
+  auto input = cudf::test::fixed_width_column_wrapper<int32_t>({4, 5, 6, 7}, {1, 1, 0, 1});
+  auto names = cudf::test::strings_column_wrapper({"a", "b", "c", "d"});
+  auto count = cudf::test::fixed_width_column_wrapper<cudf::size_type>{1, 2, 3, 0};
+  cudf::table_view input_table{{input, names}};
+
+  auto gather_map = cudf::test::fixed_width_column_wrapper<int64_t>{5, 0, 2, 1, 3};
+  auto const p_ret = cudf::gather_repeated(input_table, count, gather_map);
+  auto const p_expected = cudf::gather(cudf::repeat(input_table, count)->view(), gather_map);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(p_expected->view(), p_ret->view());
+}
+
+TEST_F(GatherRepeatedTestFixture, ConstantColumn)
+{
+  // a constant column of a million rows is a single row repeated
+  auto input = cudf::test::strings_column_wrapper({"partition"});
+  auto count = cudf::test::fixed_width_column_wrapper<cudf::size_type>{1'000'000};
+  cudf::table_view input_table{{input}};
+
+  auto gather_map =
+    cudf::test::fixed_width_column_wrapper<cudf::size_type>{999'999, 0, 1'000'000, -1};
+  auto const p_ret =
+    cudf::gather_repeated(input_table, count, gather_map, cudf::out_of_bounds_policy::NULLIFY);
+
+  auto expected =
+    cudf::test::strings_column_wrapper({"partition", "partition", "", ""}, {1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, p_ret->get_column(0));
+}
+
+TEST_F(GatherRepeatedTestFixture, Errors)
+{
+  auto input = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto count = cudf::test::fixed_width_column_wrapper<cudf::size_type>{1, 1, 1};
+  cudf::table_view input_table{{input}};
+
+  auto float_map = cudf::test::fixed_width_column_wrapper<float>{0, 1};
+  EXPECT_THROW(cudf::gather_repeated(input_table, count, float_map), std::invalid_argument);
+
+  auto null_map = cudf::test::fixed_width_column_wrapper<cudf::size_type>({0, 1}, {1, 0});
+  EXPECT_THROW(cudf::gather_repeated(input_table, count, null_map), std::invalid_argument);
+
+  auto short_count = cudf::test::fixed_width_column_wrapper<cudf::size_type>{1, 1};
+  auto map         = cudf::test::fixed_width_column_wrapper<cudf::size_type>{0, 1};
+  EXPECT_THROW(cudf::gather_repeated(input_table, short_count, map), cudf::logic_error);
+}
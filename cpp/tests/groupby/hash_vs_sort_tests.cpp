@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <functional>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
+// NUNIQUE, COLLECT_LIST and COLLECT_SET are computed from the group labels of the rows by the
+// hash-based groupby; these tests check that it agrees with the sort-based groupby.
+
+namespace {
+
+using aggregations_factory =
+  std::function<std::vector<std::unique_ptr<cudf::groupby_aggregation>>()>;
+
+// Returns the keys and the results of the aggregations, sorted by the keys
+std::unique_ptr<cudf::table> aggregate(cudf::column_view const& keys,
+                                       cudf::column_view const& values,
+                                       aggregations_factory const& make_aggregations,
+                                       force_use_sort_impl use_sort,
+                                       cudf::null_policy include_null_keys)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values       = values;
+  requests[0].aggregations = make_aggregations();
+
+  auto const num_aggregations = requests[0].aggregations.size();
+  if (use_sort == force_use_sort_impl::YES) {
+    // WAR to force cudf::groupby to use sort implementation
+    requests[0].aggregations.push_back(
+      cudf::make_nth_element_aggregation<cudf::groupby_aggregation>(0));
+  }
+
+  cudf::groupby::groupby gb_obj(cudf::table_view({keys}), include_null_keys);
+  auto const result = gb_obj.aggregate(requests);
+
+  std::vector<cudf::column_view> columns{result.first->get_column(0).view()};
+  for (std::size_t i = 0; i < num_aggregations; ++i) {
+    columns.push_back(result.second[0].results[i]->view());
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, result.first->view());
+}
+
+void expect_hash_equals_sort(cudf::column_view const& keys,
+                             cudf::column_view const& values,
+                             aggregations_factory const& make_aggregations)
+{
+  for (auto const include_null_keys : {cudf::null_policy::INCLUDE, cudf::null_policy::EXCLUDE}) {
+    SCOPED_TRACE(include_null_keys == cudf::null_policy::INCLUDE ? "null keys included"
+                                                                 : "null keys excluded");
+    auto const hash_result =
+      aggregate(keys, values, make_aggregations, force_use_sort_impl::NO, include_null_keys);
+    auto const sort_result =
+      aggregate(keys, values, make_aggregations, force_use_sort_impl::YES, include_null_keys);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*hash_result, *sort_result);
+  }
+}
+
+// Keys 0 to 6 with every 11th key null, and values repeated within each group
+constexpr cudf::size_type num_rows = 100;
+
+auto make_keys()
+{
+  auto const keys     =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  return cudf::test::fixed_width_column_wrapper<int32_t>(keys, keys + num_rows, validity);
+}
+
+auto make_int_values()
+{
+  auto const values   =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 3) % 5; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 4 != 0; });
+  return cudf::test::fixed_width_column_wrapper<int32_t>(values, values + num_rows, validity);
+}
+
+auto make_string_values()
+{
+  auto const values   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(1 + (i * 3) % 5, static_cast<char>('a' + i % 3)); });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 6 != 0; });
+  return cudf::test::strings_column_wrapper(values, values + num_rows, validity);
+}
+
+auto label_aggregations(cudf::null_policy null_handling)
+{
+  return [null_handling] {
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+    aggs.push_back(cudf::make_nunique_aggregation<cudf::groupby_aggregation>(null_handling));
+    aggs.push_back(cudf::make_collect_list_aggregation<cudf::groupby_aggregation>(null_handling));
+    aggs.push_back(cudf::make_collect_set_aggregation<cudf::groupby_aggregation>(null_handling));
+    return aggs;
+  };
+}
+
+}  // namespace
+
+struct groupby_hash_vs_sort_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_hash_vs_sort_test, NullKeysAndValues)
+{
+  auto const keys       = make_keys();
+  auto const int_values = make_int_values();
+  auto const str_values = make_string_values();
+
+  for (auto const null_handling : {cudf::null_policy::INCLUDE, cudf::null_policy::EXCLUDE}) {
+    SCOPED_TRACE(null_handling == cudf::null_policy::INCLUDE ? "null values included"
+                                                             : "null values excluded");
+    expect_hash_equals_sort(keys, int_values, label_aggregations(null_handling));
+    expect_hash_equals_sort(keys, str_values, label_aggregations(null_handling));
+  }
+}
+
+TEST_F(groupby_hash_vs_sort_test, NuniqueNullsAndNaNsAreEqual)
+{
+  auto constexpr nan = std::numeric_limits<double>::quiet_NaN();
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1,   1,   1,   1,   2,   2,   2,   3};
+  cudf::test::fixed_width_column_wrapper<double>  vals({0.,  0.,  nan, nan, 1.,  2.,  1.,  0.},
+                                                       { 0,   0,   1,   1,   1,   1,   1,   0});
+  // clang-format on
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_include{2, 2, 1};
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_exclude{1, 2, 0};
+
+  for (auto const use_sort : {force_use_sort_impl::NO, force_use_sort_impl::YES}) {
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_include,
+                    cudf::make_nunique_aggregation<cudf::groupby_aggregation>(
+                      cudf::null_policy::INCLUDE),
+                    use_sort);
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_exclude,
+                    cudf::make_nunique_aggregation<cudf::groupby_aggregation>(
+                      cudf::null_policy::EXCLUDE),
+                    use_sort);
+  }
+
+  auto const nunique = [] {
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+    aggs.push_back(
+      cudf::make_nunique_aggregation<cudf::groupby_aggregation>(cudf::null_policy::INCLUDE));
+    aggs.push_back(
+      cudf::make_nunique_aggregation<cudf::groupby_aggregation>(cudf::null_policy::EXCLUDE));
+    return aggs;
+  };
+  expect_hash_equals_sort(keys, vals, nunique);
+}
+
+TEST_F(groupby_hash_vs_sort_test, CollectSetOrdering)
+{
+  // The values of each set are in the order of their first occurrence in the group
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 1, 2, 1, 1, 2, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{3, 5, 1, 5, 3, 2, 4, 1};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  cudf::test::lists_column_wrapper<int32_t> expect_vals{{3, 1, 2}, {5, 4}};
+
+  for (auto const use_sort : {force_use_sort_impl::NO, force_use_sort_impl::YES}) {
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_vals,
+                    cudf::make_collect_set_aggregation<cudf::groupby_aggregation>(),
+                    use_sort);
+  }
+
+  // Unequal nulls are each kept as separate elements, in order
+  auto const keys_with_nulls = make_keys();
+  auto const values          = make_int_values();
+
+  auto const collect_set_unequal = [] {
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+    aggs.push_back(cudf::make_collect_set_aggregation<cudf::groupby_aggregation>(
+      cudf::null_policy::INCLUDE, cudf::null_equality::UNEQUAL, cudf::nan_equality::UNEQUAL));
+    return aggs;
+  };
+  expect_hash_equals_sort(keys_with_nulls, values, collect_set_unequal);
+}
+
+TEST_F(groupby_hash_vs_sort_test, MixedWithSinglePassAggregations)
+{
+  auto const keys   = make_keys();
+  auto const values = make_int_values();
+
+  auto const mixed = [] {
+    std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+    aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_nunique_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_collect_list_aggregation<cudf::groupby_aggregation>());
+    aggs.push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+    return aggs;
+  };
+  expect_hash_equals_sort(keys, values, mixed);
+}
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/stream_compaction.hpp>
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64s_col = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+namespace {
+
+enum class use_sort_impl : bool { NO, YES };
+
+/**
+ * @brief Runs a HYPERLOGLOG or MERGE_HYPERLOGLOG aggregation and returns the keys and the
+ * sketches of the groups, sorted by key
+ */
+auto groupby_hyperloglog(cudf::column_view const& keys,
+                         cudf::column_view const& values,
+                         cudf::aggregation::Kind agg_kind,
+                         use_sort_impl use_sort              = use_sort_impl::NO,
+                         cudf::null_policy include_null_keys = cudf::null_policy::EXCLUDE)
+{
+  std::vector<cudf::groupby::aggregation_request> requests;
+  requests.emplace_back();
+  requests[0].values = values;
+  if (agg_kind == cudf::aggregation::HYPERLOGLOG) {
+    requests[0].aggregations.push_back(
+      cudf::make_hyperloglog_aggregation<cudf::groupby_aggregation>());
+  } else {
+    requests[0].aggregations.push_back(
+      cudf::make_merge_hyperloglog_aggregation<cudf::groupby_aggregation>());
+  }
+  if (use_sort == use_sort_impl::YES) {
+    // WAR to force cudf::groupby to use sort implementation
+    requests[0].aggregations.push_back(
+      cudf::make_nth_element_aggregation<cudf::groupby_aggregation>(0));
+  }
+
+  auto gb_obj      = cudf::groupby::groupby(cudf::table_view({keys}), include_null_keys);
+  auto agg_results = gb_obj.aggregate(requests, cudf::test::get_default_stream());
+  auto const order = cudf::sorted_order(agg_results.first->view());
+  auto sorted_keys = cudf::gather(agg_results.first->view(), *order);
+  auto sorted_sketches =
+    cudf::gather(cudf::table_view({agg_results.second[0].results[0]->view()}), *order);
+  return std::pair{std::move(sorted_keys->release().front()),
+                   std::move(sorted_sketches->release().front())};
+}
+
+}  // namespace
+
+struct HyperLogLogGroupbyTest : public cudf::test::BaseFixture {};
+
+TEST_F(HyperLogLogGroupbyTest, Basic)
+{
+  auto const keys   = int32s_col{1, 2, 3, 1, 2, 2, 1, 3, 3, 2};
+  auto const values = int32s_col{0, 1, 2, 3, 4, 5, 3, 2, 2, 9};
+
+  auto const expected_keys   = int32s_col{1, 2, 3};
+  auto const expected_counts = int64s_col{2, 4, 1};
+
+  for (auto const use_sort : {use_sort_impl::NO, use_sort_impl::YES}) {
+    auto const [result_keys, sketches] =
+      groupby_hyperloglog(keys, values, cudf::aggregation::HYPERLOGLOG, use_sort);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, *result_keys);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, *cudf::approx_distinct_count(*sketches));
+  }
+}
+
+TEST_F(HyperLogLogGroupbyTest, NullKeysAndValues)
+{
+  auto const keys   = int32s_col{{1, 2, 3, 1, 2, 2, 1, 3, 3, 2}, {1, 1, 1, 0, 1, 1, 1, 0, 1, 1}};
+  auto const values = int32s_col{{0, 1, 2, 3, 4, 5, 3, 2, 7, 9}, {1, 0, 1, 1, 1, 1, 1, 1, 1, 0}};
+
+  auto const expected_keys   = int32s_col{1, 2, 3};
+  auto const expected_counts = int64s_col{2, 2, 2};
+
+  for (auto const use_sort : {use_sort_impl::NO, use_sort_impl::YES}) {
+    auto const [result_keys, sketches] =
+      groupby_hyperloglog(keys, values, cudf::aggregation::HYPERLOGLOG, use_sort);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, *result_keys);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, *cudf::approx_distinct_count(*sketches));
+  }
+}
+
+TEST_F(HyperLogLogGroupbyTest, MergeSketches)
+{
+  auto const keys0   = int32s_col{1, 2, 1, 2, 3};
+  auto const values0 = int32s_col{0, 1, 2, 3, 4};
+  auto const keys1   = int32s_col{2, 1, 3, 3};
+  auto const values1 = int32s_col{1, 5, 4, 6};
+
+  auto const [partial_keys0, sketches0] =
+    groupby_hyperloglog(keys0, values0, cudf::aggregation::HYPERLOGLOG);
+  auto const [partial_keys1, sketches1] =
+    groupby_hyperloglog(keys1, values1, cudf::aggregation::HYPERLOGLOG);
+  auto const partial_keys =
+    cudf::concatenate(std::vector{partial_keys0->view(), partial_keys1->view()});
+  auto const sketches = cudf::concatenate(std::vector{sketches0->view(), sketches1->view()});
+
+  auto const [result_keys, merged] =
+    groupby_hyperloglog(*partial_keys, *sketches, cudf::aggregation::MERGE_HYPERLOGLOG);
+
+  auto const expected_keys   = int32s_col{1, 2, 3};
+  auto const expected_counts = int64s_col{3, 2, 2};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_keys, *result_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected_counts, *cudf::approx_distinct_count(*merged));
+}
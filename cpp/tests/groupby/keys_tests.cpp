@@ -24,6 +24,8 @@
 #include <cudf/aggregation.hpp>
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <limits>
+
 using namespace cudf::test::iterators;
 
 template <typename V>
@@ -313,6 +315,35 @@ TYPED_TEST(groupby_keys_test, lists)
   test_single_agg(keys, values, expected_keys, expected_values, std::move(agg));
 }
 
+struct groupby_float_keys_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_float_keys_test, pre_sorted_keys_with_nans)
+{
+  using K = double;
+  using V = int32_t;
+  using R = cudf::detail::target_type_t<V, cudf::aggregation::SUM>;
+
+  auto constexpr nan = std::numeric_limits<K>::quiet_NaN();
+
+  // clang-format off
+  cudf::test::fixed_width_column_wrapper<K> keys        { 1, 1, 2, 2, 2, nan, nan, nan};
+  cudf::test::fixed_width_column_wrapper<V> vals        { 0, 1, 2, 3, 4, 5,   6,   7};
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys { 1,    2,       nan};
+  cudf::test::fixed_width_column_wrapper<R> expect_vals { 1,    9,       18};
+  // clang-format on
+
+  auto agg = cudf::make_sum_aggregation<cudf::groupby_aggregation>();
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  std::move(agg),
+                  force_use_sort_impl::YES,
+                  cudf::null_policy::EXCLUDE,
+                  cudf::sorted::YES);
+}
+
 struct groupby_string_keys_test : public cudf::test::BaseFixture {};
 
 TEST_F(groupby_string_keys_test, basic)
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/groupby.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+struct groupby_partitioned_test : public cudf::test::BaseFixture {};
+
+namespace {
+
+std::vector<cudf::groupby::aggregation_request> make_requests(cudf::column_view const& values)
+{
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values = values;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  return requests;
+}
+
+// Returns the keys and the aggregation results in one table, sorted by the keys
+std::unique_ptr<cudf::table> sorted_result(
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>> const&
+    result)
+{
+  std::vector<cudf::column_view> columns;
+  for (auto const& results : result.second) {
+    for (auto const& column : results.results) {
+      columns.push_back(column->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, result.first->view());
+}
+
+}  // namespace
+
+TEST_F(groupby_partitioned_test, MatchesAggregate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys({1, 2, 3, 1, 2, 2, 1, 3, 3, 2, 5, 4, 3},
+                                                       nulls_at({12}));
+  cudf::test::fixed_width_column_wrapper<int64_t> vals({0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12},
+                                                       nulls_at({4}));
+
+  for (auto const include_null_keys : {cudf::null_policy::EXCLUDE, cudf::null_policy::INCLUDE}) {
+    cudf::groupby::groupby gb(cudf::table_view{{keys}}, include_null_keys);
+    auto const requests = make_requests(vals);
+    auto const expected = sorted_result(gb.aggregate(requests));
+    for (auto const spill_to_host : {false, true}) {
+      for (auto const num_partitions : {1, 2, 3, 16}) {
+        auto const requests = make_requests(vals);
+        auto const result =
+          sorted_result(gb.aggregate_partitioned(requests, num_partitions, spill_to_host));
+        CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *result);
+      }
+    }
+  }
+}
+
+TEST_F(groupby_partitioned_test, EmptyInput)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{};
+  cudf::test::fixed_width_column_wrapper<int64_t> vals{};
+
+  cudf::groupby::groupby gb(cudf::table_view{{keys}});
+  auto const requests = make_requests(vals);
+  auto const result   = gb.aggregate_partitioned(requests, 4, true);
+  EXPECT_EQ(result.first->num_rows(), 0);
+  EXPECT_EQ(result.second.front().results.size(), size_t{3});
+}
+
+TEST_F(groupby_partitioned_test, InvalidPartitions)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int64_t> vals{1, 2, 3};
+
+  cudf::groupby::groupby gb(cudf::table_view{{keys}});
+  auto const requests = make_requests(vals);
+  EXPECT_THROW(gb.aggregate_partitioned(requests, 0), std::invalid_argument);
+}
@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/groupby.hpp>
+#include <cudf/io/parquet.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace cudf::test::iterators;
+
+struct groupby_streaming_test : public cudf::test::BaseFixture {};
+
+namespace {
+
+using result_type =
+  std::pair<std::unique_ptr<cudf::table>, std::vector<cudf::groupby::aggregation_result>>;
+
+// Returns the keys and the aggregation results in one table, sorted by the keys
+std::unique_ptr<cudf::table> sorted_result(result_type const& result)
+{
+  std::vector<cudf::column_view> columns(result.first->view().begin(), result.first->view().end());
+  for (auto const& results : result.second) {
+    for (auto const& column : results.results) {
+      columns.push_back(column->view());
+    }
+  }
+  return cudf::sort_by_key(cudf::table_view{columns}, result.first->view());
+}
+
+std::vector<std::unique_ptr<cudf::groupby_aggregation>> make_aggregations()
+{
+  std::vector<std::unique_ptr<cudf::groupby_aggregation>> aggs;
+  aggs.push_back(cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_count_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(
+    cudf::make_count_aggregation<cudf::groupby_aggregation>(cudf::null_policy::INCLUDE));
+  aggs.push_back(cudf::make_min_aggregation<cudf::groupby_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<cudf::groupby_aggregation>());
+  return aggs;
+}
+
+}  // namespace
+
+TEST_F(groupby_streaming_test, MatchesAggregate)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0({1, 2, 1, 3, 5}, nulls_at({4}));
+  cudf::test::fixed_width_column_wrapper<int32_t> vals0({1, 2, 3, 4, 5}, nulls_at({1}));
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1({2, 3, 4, 1, 3, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> vals1({6, 7, 8, 9, 10, 11}, nulls_at({3}));
+
+  auto const keys = cudf::concatenate(std::vector<cudf::column_view>{keys0, keys1});
+  auto const vals = cudf::concatenate(std::vector<cudf::column_view>{vals0, vals1});
+
+  for (auto const include_null_keys : {cudf::null_policy::EXCLUDE, cudf::null_policy::INCLUDE}) {
+    std::vector<cudf::groupby::aggregation_request> requests(1);
+    requests[0].values       = vals->view();
+    requests[0].aggregations = make_aggregations();
+    cudf::groupby::groupby gb(cudf::table_view{{keys->view()}}, include_null_keys);
+    auto const expected = sorted_result(gb.aggregate(requests));
+
+    std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggregations;
+    aggregations.push_back(make_aggregations());
+    cudf::groupby::streaming_groupby streaming(aggregations, include_null_keys);
+    streaming.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+    streaming.aggregate(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *sorted_result(streaming.results()));
+
+    // The state is kept, so the results can be requested again after more batches
+    streaming.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+    auto const keys2 = cudf::concatenate(std::vector<cudf::column_view>{*keys, keys0});
+    auto const vals2 = cudf::concatenate(std::vector<cudf::column_view>{*vals, vals0});
+    requests[0].values = vals2->view();
+    cudf::groupby::groupby gb2(cudf::table_view{{keys2->view()}}, include_null_keys);
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_result(gb2.aggregate(requests)),
+                                       *sorted_result(streaming.results()));
+  }
+}
+
+TEST_F(groupby_streaming_test, M2AndCollectList)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0{1, 1, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals0{1, 3, 2};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1{1, 1};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals1{5, 7};
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggregations(1);
+  aggregations[0].push_back(cudf::make_m2_aggregation<cudf::groupby_aggregation>());
+  aggregations[0].push_back(cudf::make_collect_list_aggregation<cudf::groupby_aggregation>());
+  cudf::groupby::streaming_groupby streaming(aggregations);
+  streaming.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+  streaming.aggregate(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  cudf::test::fixed_width_column_wrapper<double> expect_m2{20.0, 0.0};
+  cudf::test::lists_column_wrapper<int32_t> expect_lists{{1, 3, 5, 7}, {2}};
+  auto const result = sorted_result(streaming.results());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->get_column(0), expect_keys);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->get_column(1), expect_m2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result->get_column(2), expect_lists);
+}
+
+TEST_F(groupby_streaming_test, Spill)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys0({1, 2, 1, 3, 5}, nulls_at({4}));
+  cudf::test::fixed_width_column_wrapper<int32_t> vals0({1, 2, 3, 4, 5}, nulls_at({1}));
+  cudf::test::fixed_width_column_wrapper<int32_t> keys1({2, 3, 4, 1, 3, 2});
+  cudf::test::fixed_width_column_wrapper<int32_t> vals1({6, 7, 8, 9, 10, 11}, nulls_at({3}));
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggregations;
+  aggregations.push_back(make_aggregations());
+
+  cudf::groupby::streaming_groupby expected(aggregations);
+  expected.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+  expected.aggregate(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+  expected.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+
+  cudf::groupby::streaming_groupby streaming(aggregations);
+  streaming.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+  EXPECT_EQ(streaming.num_groups(), 3);
+  streaming.spill();
+  EXPECT_EQ(streaming.num_groups(), 0);
+  streaming.aggregate(cudf::table_view{{keys1}}, std::vector<cudf::column_view>{vals1});
+  EXPECT_EQ(streaming.num_groups(), 4);
+  streaming.spill();
+  // The spilled states alone have results
+  streaming.results();
+  streaming.aggregate(cudf::table_view{{keys0}}, std::vector<cudf::column_view>{vals0});
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_result(expected.results()),
+                                     *sorted_result(streaming.results()));
+}
+
+TEST_F(groupby_streaming_test, ChunkedParquet)
+{
+  auto constexpr num_rows      = 100'000;
+  auto constexpr num_keys      = 1'000;
+  auto constexpr rows_per_page = 10'000;
+
+  auto const key_values = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return (i * 7) % num_keys; });
+  auto const key_validity = cudf::detail::make_counting_transform_iterator(
+    0, [](cudf::size_type i) { return i % 11 != 0; });
+  auto const values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> keys(
+    key_values, key_values + num_rows, key_validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> vals(values, values + num_rows);
+  auto const input = cudf::table_view{{vals, keys}};
+
+  std::vector<char> buffer;
+  auto const write_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, input)
+      .max_page_size_rows(rows_per_page)
+      .build();
+  cudf::io::write_parquet(write_opts);
+
+  std::vector<cudf::groupby::aggregation_request> requests(1);
+  requests[0].values       = vals;
+  requests[0].aggregations = make_aggregations();
+  auto const expected =
+    sorted_result(cudf::groupby::groupby(cudf::table_view{{keys}}).aggregate(requests));
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggregations;
+  aggregations.push_back(make_aggregations());
+  std::vector<cudf::size_type> const key_indices{1};
+  std::vector<cudf::size_type> const value_indices{0};
+  // Without spilling, and spilling after every chunk
+  for (auto const max_device_groups : {std::numeric_limits<cudf::size_type>::max(), num_keys / 2}) {
+    auto const read_opts = cudf::io::parquet_reader_options::builder(
+                             cudf::io::source_info{buffer.data(), buffer.size()})
+                             .build();
+    auto reader = cudf::io::chunked_parquet_reader(rows_per_page * 2 * sizeof(int32_t), read_opts);
+    auto const result = cudf::groupby::aggregate_chunked_parquet(reader,
+                                                                 key_indices,
+                                                                 value_indices,
+                                                                 aggregations,
+                                                                 cudf::null_policy::EXCLUDE,
+                                                                 max_device_groups);
+    EXPECT_FALSE(reader.has_next());
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*expected, *sorted_result(result));
+  }
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{buffer.data(), buffer.size()})
+      .build();
+  auto reader = cudf::io::chunked_parquet_reader(0, read_opts);
+  std::vector<cudf::size_type> const bad_indices{2};
+  EXPECT_THROW(
+    cudf::groupby::aggregate_chunked_parquet(reader, bad_indices, value_indices, aggregations),
+    std::out_of_range);
+}
+
+TEST_F(groupby_streaming_test, InvalidInputs)
+{
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> unsupported(1);
+  unsupported[0].push_back(cudf::make_mean_aggregation<cudf::groupby_aggregation>());
+  EXPECT_THROW(cudf::groupby::streaming_groupby{unsupported}, std::invalid_argument);
+
+  std::vector<std::vector<std::unique_ptr<cudf::groupby_aggregation>>> aggregations;
+  aggregations.push_back(make_aggregations());
+  cudf::groupby::streaming_groupby streaming(aggregations);
+  EXPECT_THROW(streaming.results(), cudf::logic_error);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{1, 2, 3};
+  cudf::test::fixed_width_column_wrapper<int32_t> vals{1, 2};
+  EXPECT_THROW(streaming.aggregate(cudf::table_view{{keys}}, std::vector<cudf::column_view>{vals}),
+               std::invalid_argument);
+  EXPECT_THROW(streaming.aggregate(cudf::table_view{{keys}}, std::vector<cudf::column_view>{}),
+               std::invalid_argument);
+}
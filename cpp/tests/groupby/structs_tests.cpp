@@ -317,3 +317,40 @@ TYPED_TEST(groupby_structs_test, lists_as_keys)
 
   test_sum_agg(keys, values, expected_keys, expected_values);
 }
+
+struct groupby_structs_reuse_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_structs_reuse_test, repeated_aggregations)
+{
+  // The preprocessed struct keys are kept by the groupby object across calls.
+  // clang-format off
+  auto values   = fwcw<int32_t>{  0,    1,    2,    3,    4,    5,    6,    7,    8,    9};
+  auto member_0 = fwcw<int32_t>{  1,    2,    3,    1,    2,    2,    1,    3,    3,    2};
+  auto member_1 = cudf::test::strings_column_wrapper {"11", "22", "33", "11", "22", "22", "11", "33", "33", "22"};
+  auto keys     = cudf::test::structs_column_wrapper{member_0, member_1};
+
+  auto expected_member_0 = fwcw<int32_t>{  1,    2,    3 };
+  auto expected_member_1 = cudf::test::strings_column_wrapper {"11", "22", "33"};
+  auto expected_keys     = cudf::test::structs_column_wrapper{expected_member_0, expected_member_1};
+  auto expected_sums     = fwcw<int64_t>{  9,   19,   17 };
+  auto expected_maxes    = fwcw<int32_t>{  6,    9,    8 };
+  // clang-format on
+
+  auto gby = cudf::groupby::groupby{cudf::table_view({keys})};
+
+  auto const check = [&](std::unique_ptr<cudf::groupby_aggregation>&& agg,
+                         cudf::column_view const& expected_values) {
+    auto requests = std::vector<cudf::groupby::aggregation_request>(1);
+    requests[0].values = values;
+    requests[0].aggregations.push_back(std::move(agg));
+    auto const [result_keys, results] = gby.aggregate(requests);
+    auto const sorted = cudf::sort_by_key(
+      cudf::table_view({result_keys->get_column(0).view(), results[0].results[0]->view()}),
+      result_keys->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(sorted->get_column(0), expected_keys);
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(sorted->get_column(1), expected_values);
+  };
+
+  check(cudf::make_sum_aggregation<cudf::groupby_aggregation>(), expected_sums);
+  check(cudf::make_max_aggregation<cudf::groupby_aggregation>(), expected_maxes);
+}
@@ -23,6 +23,9 @@
 
 #include <cudf/detail/aggregation/aggregation.hpp>
 
+#include <cstdint>
+#include <limits>
+
 using namespace cudf::test::iterators;
 
 template <typename V>
@@ -229,3 +232,73 @@ TYPED_TEST(GroupBySumFixedPointTest, GroupByHashSumDecimalAsValue)
     EXPECT_THROW(test_single_agg(keys, vals, expect_keys, {}, std::move(agg8)), cudf::logic_error);
   }
 }
+
+struct GroupBySumDecimal128Test : public cudf::test::BaseFixture {};
+
+TEST_F(GroupBySumDecimal128Test, HashSumCarries)
+{
+  using fp_wrapper = cudf::test::fixed_point_column_wrapper<__int128_t>;
+  using K          = int32_t;
+
+  // sums that carry into, borrow from and overflow the low 64 bits of the values
+  auto constexpr low_max = static_cast<__int128_t>(std::numeric_limits<uint64_t>::max());
+  auto constexpr large   = static_cast<__int128_t>(1) << 100;
+  auto const scale       = numeric::scale_type{-2};
+  auto const keys        = cudf::test::fixed_width_column_wrapper<K>{1, 2, 1, 3, 2, 3, 1};
+  auto const vals = fp_wrapper{{low_max, -1, 1, large, -low_max, -large - 5, low_max}, scale};
+
+  auto const expect_keys = cudf::test::fixed_width_column_wrapper<K>{1, 2, 3};
+  auto const expect_vals = fp_wrapper{{2 * low_max + 1, -low_max - 1, -5}, scale};
+
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_sum_aggregation<cudf::groupby_aggregation>(),
+                  force_use_sort_impl::NO);
+  test_single_agg(keys,
+                  vals,
+                  expect_keys,
+                  expect_vals,
+                  cudf::make_sum_aggregation<cudf::groupby_aggregation>(),
+                  force_use_sort_impl::YES);
+}
+
+struct groupby_sum_cardinality_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_sum_cardinality_test, low_and_high_cardinality)
+{
+  // Few groups are aggregated in shared memory, while many groups overflow the shared memory
+  // tables of the blocks and are partially aggregated in global memory
+  for (auto const num_groups : {10, 3000}) {
+    auto constexpr rows_per_group = 10;
+    auto const num_rows           = num_groups * rows_per_group;
+    auto const key_iter =
+      cudf::detail::make_counting_transform_iterator(0, [=](auto i) { return i % num_groups; });
+    auto const sum_iter = cudf::detail::make_counting_transform_iterator(0, [=](auto i) {
+      return int64_t{rows_per_group} * i + int64_t{num_groups} * 45;
+    });
+    auto const argmax_iter = cudf::detail::make_counting_transform_iterator(
+      0, [=](auto i) { return i + num_groups * (rows_per_group - 1); });
+
+    auto const iter = thrust::make_counting_iterator(0);
+
+    cudf::test::fixed_width_column_wrapper<K> keys(key_iter, key_iter + num_rows);
+    cudf::test::fixed_width_column_wrapper<int64_t> vals(iter, iter + num_rows);
+    cudf::test::fixed_width_column_wrapper<K> expect_keys(iter, iter + num_groups);
+    cudf::test::fixed_width_column_wrapper<int64_t> expect_sums(sum_iter, sum_iter + num_groups);
+    cudf::test::fixed_width_column_wrapper<cudf::size_type> expect_argmax(
+      argmax_iter, argmax_iter + num_groups);
+
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_sums,
+                    cudf::make_sum_aggregation<cudf::groupby_aggregation>());
+    test_single_agg(keys,
+                    vals,
+                    expect_keys,
+                    expect_argmax,
+                    cudf::make_argmax_aggregation<cudf::groupby_aggregation>());
+  }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tests/groupby/groupby_test_util.hpp>
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/aggregation.hpp>
+
+template <typename V>
+struct groupby_top_k_test : public cudf::test::BaseFixture {};
+
+using FixedWidthTypesNotBool = cudf::test::Concat<cudf::test::IntegralTypesNotBool,
+                                                  cudf::test::FloatingPointTypes,
+                                                  cudf::test::TimestampTypes>;
+TYPED_TEST_SUITE(groupby_top_k_test, FixedWidthTypesNotBool);
+
+TYPED_TEST(groupby_top_k_test, Descending)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<K> keys{1, 2, 1, 1, 2, 3, 1};
+  cudf::test::fixed_width_column_wrapper<V, int32_t> values{3, 8, 5, 4, 2, 7, 6};
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  cudf::test::lists_column_wrapper<V, int32_t> expect_vals{{6, 5}, {8, 2}, {7}};
+
+  auto agg = cudf::make_top_k_aggregation<cudf::groupby_aggregation>(2);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+TYPED_TEST(groupby_top_k_test, AscendingWithNulls)
+{
+  using K = int32_t;
+  using V = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<K> keys{1, 2, 1, 1, 2, 3, 1};
+  cudf::test::fixed_width_column_wrapper<V, int32_t> values{{3, 8, 5, 4, 2, 7, 6},
+                                                            {1, 1, 0, 1, 0, 0, 1}};
+
+  cudf::test::fixed_width_column_wrapper<K> expect_keys{1, 2, 3};
+  using LCW = cudf::test::lists_column_wrapper<V, int32_t>;
+  LCW expect_vals{{3, 4, 6}, {8}, LCW{}};
+
+  auto agg = cudf::make_top_k_aggregation<cudf::groupby_aggregation>(3, cudf::order::ASCENDING);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
+
+struct groupby_top_k_string_test : public cudf::test::BaseFixture {};
+
+TEST_F(groupby_top_k_string_test, Strings)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{2, 1, 2, 1, 2};
+  cudf::test::strings_column_wrapper values{"b", "zz", "c", "a", "a"};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expect_keys{1, 2};
+  cudf::test::lists_column_wrapper<cudf::string_view> expect_vals{{"zz"}, {"c"}};
+
+  auto agg = cudf::make_top_k_aggregation<cudf::groupby_aggregation>(1);
+  test_single_agg(keys, values, expect_keys, expect_vals, std::move(agg));
+}
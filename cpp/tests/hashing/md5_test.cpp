@@ -22,6 +22,8 @@
 
 #include <cudf/hashing.hpp>
 
+#include <string>
+
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
 
 class MD5HashTest : public cudf::test::BaseFixture {};
@@ -105,6 +107,36 @@ TEST_F(MD5HashTest, EmptyNullEquivalence)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(MD5HashTest, LongRows)
+{
+  // rows longer than the threshold are hashed in order of their size
+  auto make_string = [](std::size_t size) {
+    std::string const base = "The quick brown fox jumps over the lazy dog. ";
+    std::string result;
+    while (result.size() < size) {
+      result += base;
+    }
+    return result.substr(0, size);
+  };
+  cudf::test::strings_column_wrapper const strings_col({make_string(3),
+                                                        make_string(300),
+                                                        make_string(1000),
+                                                        make_string(64),
+                                                        make_string(2049),
+                                                        make_string(0)});
+
+  // Generated with: hashlib.md5(input_string.encode()).hexdigest()
+  cudf::test::strings_column_wrapper const expected({"a4704fd35f0308287f2937ba3eccf5fe",
+                                                     "41df22253dea82b385d535f19fc2c10e",
+                                                     "b8c4fefca1f35ad3ea05b6c717993e30",
+                                                     "3ec457cb6db1e6bcd662c3f3f4fe630c",
+                                                     "e4cbca41a7b683556e18e3d1e96a634b",
+                                                     "d41d8cd98f00b204e9800998ecf8427e"});
+
+  auto const output = cudf::hashing::md5(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(output->view(), expected, verbosity);
+}
+
 TEST_F(MD5HashTest, StringLists)
 {
   auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 0; });
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/hashing.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <string>
+
+using hash_id = cudf::hashing::hash_function_id;
+
+class MultiHashTest : public cudf::test::BaseFixture {};
+
+TEST_F(MultiHashTest, MatchesIndividualHashes)
+{
+  auto const long_string = std::string(100, 'x') + "tail";
+  auto strings           = cudf::test::strings_column_wrapper(
+    {"", "The quick brown fox", "jumps over the lazy dog.", long_string, "null", "é世界"},
+    {1, 1, 1, 1, 0, 1});
+  auto ints =
+    cudf::test::fixed_width_column_wrapper<int32_t>({0, 100, -100, 7, 8, 9}, {1, 0, 1, 1, 1, 1});
+  auto floats = cudf::test::fixed_width_column_wrapper<double>({0.0, -0.0, 1.5, -2.25, 8.0, 9.0});
+
+  auto const input = cudf::table_view({strings, ints, floats});
+
+  constexpr uint64_t seed = 17;
+  auto const results      = cudf::hashing::multi_hash(
+    input, {hash_id::XXHASH_64, hash_id::MD5, hash_id::MURMURHASH3_X86_32}, seed);
+  ASSERT_EQ(results->num_columns(), 3);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0).view(),
+                                 cudf::hashing::xxhash_64(input, seed)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1).view(), cudf::hashing::md5(input)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(2).view(),
+                                 cudf::hashing::murmurhash3_x86_32(input, seed)->view());
+}
+
+TEST_F(MultiHashTest, DuplicateAndSubset)
+{
+  auto strings     = cudf::test::strings_column_wrapper({"a", "bb", "ccc", ""});
+  auto ints        = cudf::test::fixed_width_column_wrapper<int64_t>({1, 2, 3, 4});
+  auto const input = cudf::table_view({ints, strings});
+
+  auto const results =
+    cudf::hashing::multi_hash(input, {hash_id::XXHASH_64, hash_id::XXHASH_64});
+  ASSERT_EQ(results->num_columns(), 2);
+  auto const expected = cudf::hashing::xxhash_64(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0).view(), expected->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1).view(), expected->view());
+}
+
+TEST_F(MultiHashTest, NestedFallback)
+{
+  auto lists       = cudf::test::lists_column_wrapper<int32_t>({{1, 2}, {}, {3}, {4, 5, 6}});
+  auto const input = cudf::table_view({lists});
+
+  auto const results =
+    cudf::hashing::multi_hash(input, {hash_id::MURMURHASH3_X86_32, hash_id::MD5});
+  ASSERT_EQ(results->num_columns(), 2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0).view(),
+                                 cudf::hashing::murmurhash3_x86_32(input)->view());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1).view(), cudf::hashing::md5(input)->view());
+}
+
+TEST_F(MultiHashTest, EmptyInput)
+{
+  auto strings     = cudf::test::strings_column_wrapper();
+  auto const input = cudf::table_view({strings});
+
+  auto results = cudf::hashing::multi_hash(input, {hash_id::MURMURHASH3_X86_32, hash_id::MD5});
+  ASSERT_EQ(results->num_columns(), 2);
+  EXPECT_EQ(results->get_column(0).size(), 0);
+  EXPECT_EQ(results->get_column(1).size(), 0);
+
+  results = cudf::hashing::multi_hash(input, {});
+  EXPECT_EQ(results->num_columns(), 0);
+}
+
+TEST_F(MultiHashTest, UnsupportedMD5Type)
+{
+  auto durations   = cudf::test::fixed_width_column_wrapper<cudf::duration_s, int64_t>({1, 2, 3});
+  auto const input = cudf::table_view({durations});
+
+  EXPECT_THROW(cudf::hashing::multi_hash(input, {hash_id::XXHASH_64, hash_id::MD5}),
+               cudf::logic_error);
+  auto const results = cudf::hashing::multi_hash(input, {hash_id::XXHASH_64});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0).view(),
+                                 cudf::hashing::xxhash_64(input)->view());
+}
@@ -23,6 +23,8 @@
 #include <cudf/hashing.hpp>
 #include <cudf/utilities/error.hpp>
 
+#include <string>
+
 constexpr cudf::test::debug_output_level verbosity{cudf::test::debug_output_level::ALL_ERRORS};
 
 class SHA256HashTest : public cudf::test::BaseFixture {};
@@ -128,6 +130,37 @@ TEST_F(SHA256HashTest, EmptyNullEquivalence)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(output1->view(), output2->view());
 }
 
+TEST_F(SHA256HashTest, LongRows)
+{
+  // rows longer than the threshold are hashed in order of their size
+  auto make_string = [](std::size_t size) {
+    std::string const base = "The quick brown fox jumps over the lazy dog. ";
+    std::string result;
+    while (result.size() < size) {
+      result += base;
+    }
+    return result.substr(0, size);
+  };
+  cudf::test::strings_column_wrapper const strings_col({make_string(3),
+                                                        make_string(300),
+                                                        make_string(1000),
+                                                        make_string(64),
+                                                        make_string(2049),
+                                                        make_string(0)});
+
+  // Generated with: hashlib.sha256(input_string.encode()).hexdigest()
+  cudf::test::strings_column_wrapper const expected(
+    {"b344d80e24a3679999fa964450b34bc24d1578a35509f934c1418b0a20d21a67",
+     "cb08865d47b89234cf83fb3d902f8a66236ccb3f890b130c589f1cc35805270c",
+     "ea5685e94f1438edcce8c1861e0cfb3e307c89d61a9492992aa675899e19d1a7",
+     "3e65a688760ada5cffafb936ef148f2399478da10c177369b4ff6931e0df2881",
+     "1ad98cd440b3c209d28b14782caf7be2fc2631b1456ae2877031718a73ff2eea",
+     "e3b0c44298fc1c149afbf4c8996fb92427ae41e4649b934ca495991b7852b855"});
+
+  auto const output = cudf::hashing::sha256(cudf::table_view({strings_col}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(output->view(), expected, verbosity);
+}
+
 TEST_F(SHA256HashTest, ListsUnsupported)
 {
   cudf::test::lists_column_wrapper<cudf::string_view> strings_list_col(
@@ -20,12 +20,15 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/interop.hpp>
+#include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
 #include <thrust/host_vector.h>
 
 #include <dlpack/dlpack.h>
 
+#include <vector>
+
 struct dlpack_deleter {
   void operator()(DLManagedTensor* tensor) { tensor->deleter(tensor); }
 };
@@ -496,3 +499,66 @@ TYPED_TEST(DLPackNumericTests, FromDlpackEmpty1D)
   EXPECT_EQ(nullptr, tensor.get());
   EXPECT_THROW(cudf::from_dlpack(tensor.get()), cudf::logic_error);
 }
+
+TEST_F(DLPackUntypedTests, RowMajorToDlpack)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<int32_t> col2({4, 5, 6});
+  cudf::table_view input({col1, col2});
+  unique_managed_tensor result(cudf::to_dlpack(input, cudf::dlpack_layout::ROW_MAJOR));
+
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(3, tensor.shape[0]);
+  EXPECT_EQ(2, tensor.shape[1]);
+  EXPECT_EQ(2, tensor.strides[0]);
+  EXPECT_EQ(1, tensor.strides[1]);
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1, 4, 2, 5, 3, 6});
+  cudf::column_view const result_view(
+    cudf::data_type{cudf::type_id::INT32}, 6, tensor.data, nullptr, 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_view);
+}
+
+TEST_F(DLPackUntypedTests, StridedTableToDlpack)
+{
+  cudf::test::fixed_width_column_wrapper<double> col1({1, 2, 3});
+  cudf::test::fixed_width_column_wrapper<double> col2({4, 5, 6});
+  cudf::table_view input({col1, col2});
+
+  auto strided = cudf::make_strided_table(cudf::data_type{cudf::type_id::FLOAT64}, 3, 2);
+  ASSERT_EQ(2, strided.table.num_columns());
+  for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+    CUDF_CUDA_TRY(cudaMemcpyAsync(strided.table.column(i).data<double>(),
+                                  input.column(i).data<double>(),
+                                  3 * sizeof(double),
+                                  cudaMemcpyDefault,
+                                  cudf::get_default_stream().value()));
+  }
+  auto const data = strided.data->data();
+  unique_managed_tensor result(cudf::to_dlpack(std::move(strided)));
+
+  // The tensor owns the buffer of the table
+  auto const& tensor = result->dl_tensor;
+  EXPECT_EQ(data, tensor.data);
+  EXPECT_EQ(2, tensor.ndim);
+  EXPECT_EQ(1, tensor.strides[0]);
+  EXPECT_GE(tensor.strides[1], tensor.shape[0]);
+
+  auto const round_trip = cudf::from_dlpack(result.get());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input, round_trip->view());
+}
+
+TEST_F(DLPackUntypedTests, InvalidStridedTableToDlpack)
+{
+  auto strided = cudf::make_strided_table(cudf::data_type{cudf::type_id::INT32}, 4, 2);
+
+  // Swapped columns are not laid out as the tensor expects
+  auto const columns = std::vector<cudf::mutable_column_view>{strided.table.column(1),
+                                                              strided.table.column(0)};
+  strided.table      = cudf::mutable_table_view{columns};
+  EXPECT_THROW(cudf::to_dlpack(std::move(strided)), cudf::logic_error);
+
+  EXPECT_THROW(cudf::make_strided_table(cudf::data_type{cudf::type_id::STRING}, 4, 2),
+               cudf::logic_error);
+}
@@ -36,6 +36,7 @@
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
+#include <cudf/unary.hpp>
 
 #include <thrust/iterator/counting_iterator.h>
 
@@ -252,6 +253,51 @@ TEST_F(FromArrowDeviceTest, NestedList)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*got_cudf_table_view, from_struct);
 }
 
+TEST_F(FromArrowDeviceTest, LargeStringColumn)
+{
+  auto col = cudf::test::strings_column_wrapper({"a", "", "bcd", "efgh", "ij"}, {1, 0, 1, 1, 1});
+
+  auto sview   = cudf::strings_column_view(col);
+  auto offsets = cudf::cast(sview.offsets(), cudf::data_type{cudf::type_id::INT64});
+
+  nanoarrow::UniqueSchema input_schema;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(input_schema.get(), NANOARROW_TYPE_LARGE_STRING));
+
+  nanoarrow::UniqueArray input_array;
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromSchema(input_array.get(), input_schema.get(), nullptr));
+  auto* arr       = input_array.get();
+  arr->length     = sview.size();
+  arr->null_count = sview.null_count();
+  NANOARROW_THROW_NOT_OK(ArrowBufferSetAllocator(ArrowArrayBuffer(arr, 0), noop_alloc));
+  ArrowArrayValidityBitmap(arr)->buffer.size_bytes =
+    cudf::bitmask_allocation_size_bytes(sview.size());
+  ArrowArrayValidityBitmap(arr)->buffer.data =
+    const_cast<uint8_t*>(reinterpret_cast<uint8_t const*>(sview.null_mask()));
+  NANOARROW_THROW_NOT_OK(ArrowBufferSetAllocator(ArrowArrayBuffer(arr, 1), noop_alloc));
+  ArrowArrayBuffer(arr, 1)->size_bytes = sizeof(int64_t) * offsets->size();
+  ArrowArrayBuffer(arr, 1)->data       = const_cast<uint8_t*>(offsets->view().data<uint8_t>());
+  NANOARROW_THROW_NOT_OK(ArrowBufferSetAllocator(ArrowArrayBuffer(arr, 2), noop_alloc));
+  ArrowArrayBuffer(arr, 2)->size_bytes = sview.chars_size(cudf::get_default_stream());
+  ArrowArrayBuffer(arr, 2)->data       = const_cast<uint8_t*>(sview.parent().data<uint8_t>());
+  NANOARROW_THROW_NOT_OK(ArrowArrayFinishBuilding(arr, NANOARROW_VALIDATION_LEVEL_NONE, nullptr));
+
+  ArrowDeviceArray input_device_array;
+  input_device_array.device_id   = rmm::get_current_cuda_device().value();
+  input_device_array.device_type = ARROW_DEVICE_CUDA;
+  input_device_array.sync_event  = nullptr;
+  memcpy(&input_device_array.array, input_array.get(), sizeof(ArrowArray));
+
+  auto got_cudf_col = cudf::from_arrow_device_column(input_schema.get(), &input_device_array);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(col, *got_cudf_col);
+
+  // the int64 offsets, chars and null mask are used without copying
+  auto got_sview = cudf::strings_column_view(*got_cudf_col);
+  EXPECT_EQ(got_sview.offsets().type(), cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(got_sview.offsets().head(), offsets->view().head());
+  EXPECT_EQ(got_cudf_col->head(), sview.parent().head());
+  EXPECT_EQ(got_cudf_col->null_mask(), sview.null_mask());
+}
+
 TEST_F(FromArrowDeviceTest, StructColumn)
 {
   using vector_of_columns = std::vector<std::unique_ptr<cudf::column>>;
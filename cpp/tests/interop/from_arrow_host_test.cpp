@@ -293,6 +293,41 @@ TEST_F(FromArrowHostDeviceTest, NestedList)
   CUDF_TEST_EXPECT_TABLES_EQUAL(got_cudf_table->view(), from_struct);
 }
 
+TEST_F(FromArrowHostDeviceTest, LargeStringColumn)
+{
+  auto const data     = std::vector<std::string>{"a", "", "bcd", "efgh", "ij"};
+  auto const validity = std::vector<uint8_t>{1, 0, 1, 1, 1};
+
+  auto expected = cudf::test::strings_column_wrapper(data.begin(), data.end(), validity.begin());
+
+  nanoarrow::UniqueSchema input_schema;
+  NANOARROW_THROW_NOT_OK(ArrowSchemaInitFromType(input_schema.get(), NANOARROW_TYPE_LARGE_STRING));
+
+  nanoarrow::UniqueArray input_array;
+  NANOARROW_THROW_NOT_OK(ArrowArrayInitFromType(input_array.get(), NANOARROW_TYPE_LARGE_STRING));
+  NANOARROW_THROW_NOT_OK(ArrowArrayStartAppending(input_array.get()));
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    if (validity[i] == 0) {
+      NANOARROW_THROW_NOT_OK(ArrowArrayAppendNull(input_array.get(), 1));
+    } else {
+      NANOARROW_THROW_NOT_OK(
+        ArrowArrayAppendString(input_array.get(), ArrowCharView(data[i].c_str())));
+    }
+  }
+  NANOARROW_THROW_NOT_OK(
+    ArrowArrayFinishBuilding(input_array.get(), NANOARROW_VALIDATION_LEVEL_MINIMAL, nullptr));
+
+  ArrowDeviceArray input;
+  memcpy(&input.array, input_array.get(), sizeof(ArrowArray));
+  input.device_id   = -1;
+  input.device_type = ARROW_DEVICE_CPU;
+
+  auto got_cudf_col = cudf::from_arrow_host_column(input_schema.get(), &input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, got_cudf_col->view());
+  EXPECT_EQ(cudf::strings_column_view(got_cudf_col->view()).offsets().type(),
+            cudf::data_type{cudf::type_id::INT64});
+}
+
 TEST_F(FromArrowHostDeviceTest, StructColumn)
 {
   // Create cudf table
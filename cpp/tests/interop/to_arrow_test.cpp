@@ -356,6 +356,36 @@ TEST_F(ToArrowTest, StructColumn)
 template <typename T>
 using fp_wrapper = cudf::test::fixed_point_column_wrapper<T>;
 
+TEST_F(ToArrowTest, SmallAndLargeBuffers)
+{
+  // the int8 columns and the null masks are staged together while the int64 data is large
+  // enough to be copied directly
+  auto constexpr num_small_columns = 16;
+  auto constexpr num_rows          = 200000;
+
+  auto odd_valid = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 2; });
+  auto values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 100; });
+
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  std::vector<cudf::column_metadata> metadata;
+  for (int i = 0; i < num_small_columns; ++i) {
+    columns.push_back(
+      cudf::test::fixed_width_column_wrapper<int8_t>(values + i, values + i + num_rows, odd_valid)
+        .release());
+    metadata.push_back({std::to_string(i)});
+  }
+  columns.push_back(
+    cudf::test::fixed_width_column_wrapper<int64_t>(values, values + num_rows, odd_valid)
+      .release());
+  metadata.push_back({"large"});
+
+  auto const input = cudf::table(std::move(columns));
+
+  auto got_arrow_table = cudf::to_arrow(input.view(), metadata);
+  auto got_cudf_table  = cudf::from_arrow(*got_arrow_table);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(input.view(), got_cudf_table->view());
+}
+
 TEST_F(ToArrowTest, FixedPoint64Table)
 {
   using namespace numeric;
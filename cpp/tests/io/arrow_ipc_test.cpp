@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/detail/iterator.cuh>
+#include <cudf/io/arrow_ipc.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <src/io/comp/nvcomp_adapter.hpp>
+
+#include <algorithm>
+#include <numeric>
+#include <string>
+#include <vector>
+
+using int32_col   = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64_col   = cudf::test::fixed_width_column_wrapper<int64_t>;
+using float64_col = cudf::test::fixed_width_column_wrapper<double>;
+using bool_col    = cudf::test::fixed_width_column_wrapper<bool>;
+using str_col     = cudf::test::strings_column_wrapper;
+using struct_col  = cudf::test::structs_column_wrapper;
+using list_col    = cudf::test::lists_column_wrapper<int32_t>;
+
+struct ArrowIpcTest : public cudf::test::BaseFixture {};
+
+struct ArrowIpcCompressionTest : public cudf::test::BaseFixture,
+                                 public ::testing::WithParamInterface<cudf::io::compression_type> {
+};
+
+namespace {
+
+std::vector<char> write_stream(
+  cudf::table_view const& table,
+  cudf::io::compression_type compression = cudf::io::compression_type::NONE)
+{
+  std::vector<char> out_buffer;
+  auto const options =
+    cudf::io::arrow_ipc_writer_options::builder(cudf::io::sink_info{&out_buffer}, table)
+      .compression(compression)
+      .build();
+  cudf::io::write_arrow_ipc(options);
+  return out_buffer;
+}
+
+cudf::io::table_with_metadata read_stream(std::vector<char> const& buffer,
+                                          std::vector<std::string> const& columns = {})
+{
+  auto options = cudf::io::arrow_ipc_reader_options::builder(
+                   cudf::io::source_info{buffer.data(), buffer.size()})
+                   .build();
+  if (not columns.empty()) { options.set_columns(columns); }
+  return cudf::io::read_arrow_ipc(options);
+}
+
+bool is_codec_enabled(cudf::io::compression_type compression)
+{
+  if (compression == cudf::io::compression_type::NONE) { return true; }
+  auto const codec = compression == cudf::io::compression_type::LZ4
+                       ? cudf::io::nvcomp::compression_type::LZ4
+                       : cudf::io::nvcomp::compression_type::ZSTD;
+  return not cudf::io::nvcomp::is_compression_disabled(codec).has_value() and
+         not cudf::io::nvcomp::is_decompression_disabled(codec).has_value();
+}
+
+}  // namespace
+
+TEST_F(ArrowIpcTest, NumericWithNulls)
+{
+  auto const valids = cudf::test::iterators::null_at(3);
+  int32_col col0{{1, 2, 3, 4, 5, 6}, valids};
+  float64_col col1{1.5, 2.5, 3.5, 4.5, 5.5, 6.5};
+  int64_col col2{{-1, -2, -3, -4, -5, -6}, cudf::test::iterators::nulls_at({0, 5})};
+  cudf::table_view const expected{{col0, col1, col2}};
+
+  auto const result = read_stream(write_stream(expected));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ArrowIpcTest, StringsAndBools)
+{
+  str_col strings{{"a", "", "ccc", "dddd", "eeeee"}, cudf::test::iterators::null_at(1)};
+  bool_col bools{{true, false, true, true, false}, cudf::test::iterators::null_at(4)};
+  cudf::table_view const expected{{strings, bools}};
+
+  auto const result = read_stream(write_stream(expected));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ArrowIpcTest, Nested)
+{
+  list_col lists{{1, 2}, {}, {3}, {4, 5, 6}};
+  int32_col ints{{10, 20, 30, 40}, cudf::test::iterators::null_at(2)};
+  str_col strings{"w", "x", "y", "z"};
+  struct_col structs{{ints, strings}, cudf::test::iterators::null_at(0)};
+  cudf::table_view const expected{{lists, structs}};
+
+  auto const result = read_stream(write_stream(expected));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result.tbl->view());
+}
+
+TEST_F(ArrowIpcTest, SlicedTable)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  int32_col ints(sequence, sequence + 100, cudf::test::iterators::null_at(17));
+  std::vector<std::string> words(100);
+  std::transform(sequence, sequence + 100, words.begin(), [](auto i) { return std::to_string(i); });
+  str_col strings(words.begin(), words.end());
+  cudf::table_view const input{{ints, strings}};
+
+  auto const expected = cudf::slice(input, {13, 71})[0];
+  auto const result   = read_stream(write_stream(expected));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+TEST_F(ArrowIpcTest, ColumnNamesAndSelection)
+{
+  int32_col col0{1, 2, 3};
+  str_col col1{"a", "b", "c"};
+  float64_col col2{1.0, 2.0, 3.0};
+  cudf::table_view const input{{col0, col1, col2}};
+
+  cudf::io::table_input_metadata metadata(input);
+  metadata.column_metadata[0].set_name("ints");
+  metadata.column_metadata[1].set_name("strings");
+  metadata.column_metadata[2].set_name("doubles");
+
+  std::vector<char> out_buffer;
+  auto const options =
+    cudf::io::arrow_ipc_writer_options::builder(cudf::io::sink_info{&out_buffer}, input)
+      .metadata(metadata)
+      .build();
+  cudf::io::write_arrow_ipc(options);
+
+  auto const result = read_stream(out_buffer, {"doubles", "ints"});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view({col2, col0}), result.tbl->view());
+  ASSERT_EQ(result.metadata.schema_info.size(), 2);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "doubles");
+  EXPECT_EQ(result.metadata.schema_info[1].name, "ints");
+
+  EXPECT_THROW(read_stream(out_buffer, {"missing"}), cudf::logic_error);
+}
+
+TEST_F(ArrowIpcTest, ChunkedWriteAndRead)
+{
+  std::vector<cudf::test::fixed_width_column_wrapper<int32_t>> columns;
+  std::vector<cudf::table_view> tables;
+  for (int i = 0; i < 4; ++i) {
+    auto const begin = thrust::make_counting_iterator(i * 1000);
+    columns.emplace_back(begin, begin + 1000, cudf::test::iterators::null_at(i));
+  }
+  for (auto const& col : columns) {
+    tables.push_back(cudf::table_view{{col}});
+  }
+  auto const expected = cudf::concatenate(tables);
+
+  std::vector<char> out_buffer;
+  auto const options =
+    cudf::io::chunked_arrow_ipc_writer_options::builder(cudf::io::sink_info{&out_buffer}).build();
+  cudf::io::arrow_ipc_chunked_writer writer(options);
+  for (auto const& table : tables) {
+    writer.write(table);
+  }
+  writer.close();
+
+  auto const full = read_stream(out_buffer);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), full.tbl->view());
+
+  // each record batch body holds a little over 4000 bytes, so two batches fit in each chunk
+  auto const read_options =
+    cudf::io::arrow_ipc_reader_options::builder(
+      cudf::io::source_info{out_buffer.data(), out_buffer.size()})
+      .build();
+  cudf::io::chunked_arrow_ipc_reader reader(10'000, read_options);
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (reader.has_next()) {
+    chunks.push_back(std::move(reader.read_chunk().tbl));
+  }
+  ASSERT_EQ(chunks.size(), 2);
+  std::vector<cudf::table_view> chunk_views;
+  for (auto const& chunk : chunks) {
+    EXPECT_EQ(chunk->num_rows(), 2000);
+    chunk_views.push_back(chunk->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), cudf::concatenate(chunk_views)->view());
+}
+
+TEST_F(ArrowIpcTest, ChunkedWriteSchemaMismatch)
+{
+  int32_col ints{1, 2, 3};
+  float64_col doubles{1.0, 2.0, 3.0};
+
+  std::vector<char> out_buffer;
+  auto const options =
+    cudf::io::chunked_arrow_ipc_writer_options::builder(cudf::io::sink_info{&out_buffer}).build();
+  cudf::io::arrow_ipc_chunked_writer writer(options);
+  writer.write(cudf::table_view{{ints}});
+  EXPECT_THROW(writer.write(cudf::table_view{{doubles}}), cudf::logic_error);
+}
+
+TEST_F(ArrowIpcTest, EmptyTable)
+{
+  int32_col ints{};
+  str_col strings{};
+  list_col lists{};
+  cudf::table_view const expected{{ints, strings, lists}};
+
+  auto const result = read_stream(write_stream(expected));
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected, result.tbl->view());
+}
+
+TEST_P(ArrowIpcCompressionTest, RoundTrip)
+{
+  auto const compression = GetParam();
+  if (not is_codec_enabled(compression)) { GTEST_SKIP() << "Codec is not available"; }
+
+  constexpr auto num_rows = 100'000;
+  auto const sequence     = thrust::make_counting_iterator(0);
+  auto const repeating    = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int64_t>(i % 7); });
+  int32_col ints(sequence, sequence + num_rows, cudf::test::iterators::null_at(11));
+  int64_col compressible(repeating, repeating + num_rows);
+  std::vector<std::string> words(num_rows);
+  std::transform(sequence, sequence + num_rows, words.begin(), [](auto i) {
+    return "word" + std::to_string(i % 9);
+  });
+  str_col strings(words.begin(), words.end());
+  cudf::table_view const expected{{ints, compressible, strings}};
+
+  auto const buffer = write_stream(expected, compression);
+  if (compression != cudf::io::compression_type::NONE) {
+    EXPECT_LT(buffer.size(), write_stream(expected).size());
+  }
+  auto const result = read_stream(buffer);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+INSTANTIATE_TEST_CASE_P(ArrowIpc,
+                        ArrowIpcCompressionTest,
+                        ::testing::Values(cudf::io::compression_type::NONE,
+                                          cudf::io::compression_type::LZ4,
+                                          cudf::io::compression_type::ZSTD));
+
+TEST_F(ArrowIpcTest, UnsupportedCompression)
+{
+  int32_col ints{1, 2, 3};
+  EXPECT_THROW(write_stream(cudf::table_view{{ints}}, cudf::io::compression_type::SNAPPY),
+               cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,281 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/io/avro.hpp>
+#include <cudf/io/datasource.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <numeric>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+void append_long(std::string& out, int64_t value)
+{
+  // Avro ints and longs are zigzag encoded variable-length integers
+  auto encoded = (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+  while (encoded >= 0x80) {
+    out.push_back(static_cast<char>((encoded & 0x7f) | 0x80));
+    encoded >>= 7;
+  }
+  out.push_back(static_cast<char>(encoded));
+}
+
+void append_string(std::string& out, std::string const& value)
+{
+  append_long(out, static_cast<int64_t>(value.size()));
+  out += value;
+}
+
+/**
+ * @brief Creates an uncompressed Avro file with a single column.
+ *
+ * @param blocks Values of the column, one vector per block of the file
+ * @param name Name of the column
+ * @param type Avro type of the column, either "int" or "long"
+ */
+std::string avro_file(std::vector<std::vector<int64_t>> const& blocks,
+                      std::string const& name = "a",
+                      std::string const& type = "long")
+{
+  std::string const sync_marker = "0123456789abcdef";
+
+  std::string out = "Obj\x01";
+  append_long(out, 2);
+  append_string(out, "avro.schema");
+  append_string(out,
+                R"({"type": "record", "name": "test", "fields": [{"name": ")" + name +
+                  R"(", "type": ")" + type + R"("}]})");
+  append_string(out, "avro.codec");
+  append_string(out, "null");
+  append_long(out, 0);
+  out += sync_marker;
+
+  for (auto const& block : blocks) {
+    std::string data;
+    for (auto const value : block) {
+      append_long(data, value);
+    }
+    append_long(out, static_cast<int64_t>(block.size()));
+    append_long(out, static_cast<int64_t>(data.size()));
+    out += data;
+    out += sync_marker;
+  }
+  return out;
+}
+
+/**
+ * @brief Source of an in-memory Avro file that counts how many times it is read.
+ */
+class counting_source : public cudf::io::datasource {
+ public:
+  explicit counting_source(std::string data) : _data{std::move(data)} {}
+
+  std::unique_ptr<buffer> host_read(size_t offset, size_t size) override
+  {
+    ++num_reads;
+    size = std::min(size, _data.size() - offset);
+    return std::make_unique<non_owning_buffer>(
+      reinterpret_cast<uint8_t const*>(_data.data()) + offset, size);
+  }
+
+  size_t host_read(size_t offset, size_t size, uint8_t* dst) override
+  {
+    ++num_reads;
+    size = std::min(size, _data.size() - offset);
+    std::memcpy(dst, _data.data() + offset, size);
+    return size;
+  }
+
+  [[nodiscard]] size_t size() const override { return _data.size(); }
+
+  int num_reads = 0;
+
+ private:
+  std::string _data;
+};
+
+std::vector<int64_t> sequence(int64_t begin, int64_t end)
+{
+  std::vector<int64_t> values(end - begin);
+  std::iota(values.begin(), values.end(), begin);
+  return values;
+}
+
+}  // namespace
+
+struct AvroReaderTest : public cudf::test::BaseFixture {
+  // Three files with 10, 5 and 15 rows, holding the values 0 to 29 in order
+  AvroReaderTest()
+  {
+    files.emplace_back(avro_file({sequence(0, 4), sequence(4, 8), sequence(8, 10)}));
+    files.emplace_back(avro_file({sequence(10, 15)}));
+    files.emplace_back(avro_file({sequence(15, 20), sequence(20, 25), sequence(25, 30)}));
+  }
+
+  cudf::io::avro_reader_options options(cudf::size_type skip_rows = 0,
+                                        cudf::size_type num_rows  = -1)
+  {
+    std::vector<cudf::io::datasource*> sources;
+    for (auto& file : files) {
+      sources.push_back(&file);
+    }
+    return cudf::io::avro_reader_options::builder(cudf::io::source_info{sources})
+      .skip_rows(skip_rows)
+      .num_rows(num_rows);
+  }
+
+  std::vector<counting_source> files;
+};
+
+TEST_F(AvroReaderTest, MultipleSources)
+{
+  auto const result = cudf::io::read_avro(options());
+
+  auto const values = sequence(0, 30);
+  auto const expected =
+    cudf::test::fixed_width_column_wrapper<int64_t>(values.begin(), values.end());
+  ASSERT_EQ(result.tbl->num_columns(), 1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected);
+  ASSERT_EQ(result.metadata.schema_info.size(), 1u);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "a");
+  EXPECT_EQ(result.metadata.per_file_user_data.size(), files.size());
+}
+
+TEST_F(AvroReaderTest, RowWindowsAcrossSources)
+{
+  // windows within a block, across blocks, across files, starting at file boundaries and
+  // reaching past the last row
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> const windows{
+    {0, -1}, {1, 2}, {3, 10}, {8, 4}, {10, 5}, {9, 7}, {12, -1}, {14, 2}, {2, 27}, {25, 10}};
+  for (auto const& [skip_rows, num_rows] : windows) {
+    SCOPED_TRACE("skip_rows " + std::to_string(skip_rows) + ", num_rows " +
+                 std::to_string(num_rows));
+    auto const result = cudf::io::read_avro(options(skip_rows, num_rows));
+
+    auto const end    = num_rows < 0 ? 30 : std::min(skip_rows + num_rows, 30);
+    auto const values = sequence(skip_rows, end);
+    auto const expected =
+      cudf::test::fixed_width_column_wrapper<int64_t>(values.begin(), values.end());
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected);
+  }
+}
+
+TEST_F(AvroReaderTest, SourcesPastNumRowsNotRead)
+{
+  // the window ends with the first file
+  {
+    auto const result = cudf::io::read_avro(options(3, 7));
+    EXPECT_EQ(result.tbl->num_rows(), 7);
+    EXPECT_GT(files[0].num_reads, 0);
+    EXPECT_EQ(files[1].num_reads, 0);
+    EXPECT_EQ(files[2].num_reads, 0);
+  }
+  // the window ends within the second file
+  {
+    auto const result = cudf::io::read_avro(options(8, 4));
+    EXPECT_EQ(result.tbl->num_rows(), 4);
+    EXPECT_GT(files[1].num_reads, 0);
+    EXPECT_EQ(files[2].num_reads, 0);
+    EXPECT_EQ(result.metadata.per_file_user_data.size(), 2u);
+  }
+}
+
+TEST_F(AvroReaderTest, MismatchedSchemas)
+{
+  files[1] = counting_source{avro_file({sequence(10, 15)}, "b")};
+  EXPECT_THROW(cudf::io::read_avro(options()), cudf::logic_error);
+
+  files[1] = counting_source{avro_file({sequence(10, 15)}, "a", "int")};
+  EXPECT_THROW(cudf::io::read_avro(options()), cudf::data_type_error);
+
+  // the mismatched file is not read when the rows to read end before it
+  EXPECT_NO_THROW(cudf::io::read_avro(options(0, 10)));
+}
+
+TEST_F(AvroReaderTest, ChunkedReadLimit)
+{
+  auto const read_chunks = [&](std::size_t chunk_read_limit, cudf::io::avro_reader_options opts) {
+    cudf::io::chunked_avro_reader reader(chunk_read_limit, opts);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    return chunks;
+  };
+  auto const num_rows = [](auto const& chunks) {
+    std::vector<cudf::size_type> rows;
+    for (auto const& chunk : chunks) {
+      rows.push_back(chunk->num_rows());
+    }
+    return rows;
+  };
+  auto const concatenated = [](auto const& chunks) {
+    std::vector<cudf::table_view> views;
+    for (auto const& chunk : chunks) {
+      views.push_back(chunk->view());
+    }
+    return cudf::concatenate(views);
+  };
+
+  auto const expected = cudf::io::read_avro(options());
+
+  // no limit reads all files in one chunk
+  auto chunks = read_chunks(0, options());
+  EXPECT_EQ(num_rows(chunks), (std::vector<cudf::size_type>{30}));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(chunks.front()->view(), expected.tbl->view());
+
+  // consecutive files are grouped while their total size is within the limit
+  chunks = read_chunks(files[0].size() + files[1].size(), options());
+  EXPECT_EQ(num_rows(chunks), (std::vector<cudf::size_type>{15, 15}));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(concatenated(chunks)->view(), expected.tbl->view());
+
+  // a file larger than the limit is read in a chunk of its own
+  chunks = read_chunks(1, options());
+  EXPECT_EQ(num_rows(chunks), (std::vector<cudf::size_type>{10, 5, 15}));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(concatenated(chunks)->view(), expected.tbl->view());
+
+  // the row window applies across chunks, and files after the window are not read
+  auto const expected_window = cudf::io::read_avro(options(12, 5));
+  chunks                     = read_chunks(1, options(12, 5));
+  EXPECT_EQ(num_rows(chunks), (std::vector<cudf::size_type>{0, 3, 2}));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(concatenated(chunks)->view(), expected_window.tbl->view());
+
+  for (auto& file : files) {
+    file.num_reads = 0;
+  }
+  chunks = read_chunks(1, options(2, 8));
+  EXPECT_EQ(num_rows(chunks), (std::vector<cudf::size_type>{8}));
+  EXPECT_EQ(files[1].num_reads, 0);
+  EXPECT_EQ(files[2].num_reads, 0);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,133 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/io/caching_datasource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <numeric>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> to_host(cudf::io::datasource::buffer const& buffer)
+{
+  std::vector<uint8_t> result(buffer.size());
+  CUDF_CUDA_TRY(cudaMemcpy(result.data(), buffer.data(), buffer.size(), cudaMemcpyDefault));
+  return result;
+}
+
+}  // namespace
+
+struct CachingDatasourceTest : public cudf::test::BaseFixture {
+  CachingDatasourceTest() : data(1000) { std::iota(data.begin(), data.end(), 0); }
+
+  std::unique_ptr<cudf::io::caching_datasource> make_cache(
+    cudf::io::datasource_cache_options options)
+  {
+    return std::make_unique<cudf::io::caching_datasource>(
+      cudf::io::datasource::create(cudf::host_span<std::byte const>{
+        reinterpret_cast<std::byte const*>(data.data()), data.size()}),
+      options);
+  }
+
+  std::vector<uint8_t> data;
+};
+
+TEST_F(CachingDatasourceTest, HostHits)
+{
+  auto const cache = make_cache({});
+
+  auto const first = cache->host_read(100, 200);
+  ASSERT_EQ(first->size(), 200);
+  EXPECT_TRUE(std::equal(first->data(), first->data() + 200, data.begin() + 100));
+
+  // contained ranges are served from the cached block
+  auto const second = cache->host_read(150, 50);
+  EXPECT_EQ(second->data(), first->data() + 50);
+
+  std::vector<uint8_t> out(100);
+  EXPECT_EQ(cache->host_read(950, 100, out.data()), 50);
+  EXPECT_TRUE(std::equal(out.begin(), out.begin() + 50, data.begin() + 950));
+
+  auto const stats = cache->statistics();
+  EXPECT_EQ(stats.misses, 2);
+  EXPECT_EQ(stats.host_hits, 1);
+  EXPECT_EQ(stats.host_bytes, 250);
+  EXPECT_EQ(stats.device_bytes, 0);
+}
+
+TEST_F(CachingDatasourceTest, LruEviction)
+{
+  cudf::io::datasource_cache_options options;
+  options.host_capacity = 250;
+  auto const cache      = make_cache(options);
+
+  cache->host_read(0, 100);
+  cache->host_read(100, 100);
+  cache->host_read(0, 100);    // the first range is now the most recently used
+  cache->host_read(200, 100);  // evicts the second range
+  EXPECT_EQ(cache->statistics().host_bytes, 200);
+
+  cache->host_read(0, 100);
+  cache->host_read(100, 100);
+  auto const stats = cache->statistics();
+  EXPECT_EQ(stats.host_hits, 2);
+  EXPECT_EQ(stats.misses, 4);
+
+  // ranges larger than the cache are read through
+  auto const large = cache->host_read(0, 500);
+  EXPECT_TRUE(std::equal(large->data(), large->data() + 500, data.begin()));
+  EXPECT_LE(cache->statistics().host_bytes, 250);
+}
+
+TEST_F(CachingDatasourceTest, DevicePromotion)
+{
+  cudf::io::datasource_cache_options options;
+  options.device_capacity = 300;
+  options.promotion_hits  = 1;
+  auto const cache        = make_cache(options);
+  auto const stream       = cudf::test::get_default_stream();
+  EXPECT_TRUE(cache->is_device_read_preferred(100));
+
+  auto const miss = cache->device_read(0, 200, stream);
+  EXPECT_TRUE(std::equal(data.begin(), data.begin() + 200, to_host(*miss).begin()));
+  EXPECT_EQ(cache->statistics().device_bytes, 0);
+
+  // the first hit promotes the range, later hits return views of the device copy
+  auto const promoted = cache->device_read(10, 20, stream);
+  auto const view     = cache->device_read(20, 10, stream);
+  EXPECT_EQ(view->data(), promoted->data() + 10);
+  EXPECT_TRUE(std::equal(data.begin() + 20, data.begin() + 30, to_host(*view).begin()));
+
+  std::vector<uint8_t> out(50);
+  rmm::device_buffer d_out(out.size(), stream);
+  EXPECT_EQ(cache->device_read(50, 50, static_cast<uint8_t*>(d_out.data()), stream), 50);
+  CUDF_CUDA_TRY(cudaMemcpy(out.data(), d_out.data(), out.size(), cudaMemcpyDefault));
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), data.begin() + 50));
+
+  auto const stats = cache->statistics();
+  EXPECT_EQ(stats.misses, 1);
+  EXPECT_EQ(stats.host_hits, 1);
+  EXPECT_EQ(stats.device_hits, 2);
+  EXPECT_EQ(stats.device_bytes, 200);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
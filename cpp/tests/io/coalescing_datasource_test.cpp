@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/io/datasource.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <src/io/utilities/coalescing_datasource.hpp>
+
+#include <cuda_runtime.h>
+
+#include <numeric>
+#include <vector>
+
+namespace {
+
+std::vector<uint8_t> to_host(cudf::io::datasource::buffer const& buffer)
+{
+  std::vector<uint8_t> result(buffer.size());
+  CUDF_CUDA_TRY(cudaMemcpy(result.data(), buffer.data(), buffer.size(), cudaMemcpyDefault));
+  return result;
+}
+
+}  // namespace
+
+struct CoalescingDatasourceTest : public cudf::test::BaseFixture {};
+
+TEST_F(CoalescingDatasourceTest, MergesNearbyRanges)
+{
+  std::vector<uint8_t> data(1000);
+  std::iota(data.begin(), data.end(), 0);
+  auto const source = cudf::io::datasource::create(
+    cudf::host_span<std::byte const>{reinterpret_cast<std::byte const*>(data.data()), data.size()});
+
+  cudf::io::detail::coalescing_datasource coalescer(*source, 16);
+  std::vector<cudf::io::detail::read_range> const ranges{{500, 10}, {0, 10}, {20, 10}, {25, 2}};
+  auto const stream = cudf::test::get_default_stream();
+  auto read         = coalescer.prefetch_to_device(
+    ranges, 64, stream, rmm::mr::get_current_device_resource());
+  EXPECT_EQ(coalescer.num_merged_reads(), 2);
+  EXPECT_EQ(read.get(), 30 + 10);
+
+  for (auto const& range : ranges) {
+    auto const buffer = coalescer.device_read(range.offset, range.size, stream);
+    ASSERT_EQ(buffer->size(), range.size);
+    auto const result = to_host(*buffer);
+    EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin() + range.offset));
+  }
+
+  // ranges that were not prefetched are read from the wrapped source
+  auto const buffer = coalescer.device_read(700, 50, stream);
+  auto const result = to_host(*buffer);
+  ASSERT_EQ(result.size(), 50);
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), data.begin() + 700));
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -15,6 +15,7 @@
  */
 
 #include "io/comp/gpuinflate.hpp"
+#include "io/comp/io_uncomp.hpp"
 #include "io/utilities/hostdevice_vector.hpp"
 
 #include <cudf_test/base_fixture.hpp>
@@ -27,6 +28,7 @@
 
 #include <src/io/comp/nvcomp_adapter.hpp>
 
+#include <string>
 #include <vector>
 
 using cudf::device_span;
@@ -123,6 +125,8 @@ struct BrotliDecompressTest : public DecompressTest<BrotliDecompressTest> {
 
 struct NvcompConfigTest : public cudf::test::BaseFixture {};
 
+struct HostDecompressTest : public cudf::test::BaseFixture {};
+
 TEST_F(GzipDecompressTest, HelloWorld)
 {
   constexpr char uncompressed[]  = "hello world";
@@ -171,6 +175,54 @@ TEST_F(BrotliDecompressTest, HelloWorld)
   EXPECT_EQ(output, input);
 }
 
+TEST_F(HostDecompressTest, SnappyBatch)
+{
+  constexpr uint8_t hello_compressed[] = {
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+  constexpr uint8_t aaah_compressed[] = {
+    14, 0x0, 'A', 0x0, 'a', (10 - 4) * 4 + 1, 1, 0x4, 'h', '!'};
+
+  // Repeat the inputs so the batch is decompressed by multiple threads
+  constexpr int num_buffers = 64;
+  std::vector<cudf::host_span<uint8_t const>> inputs;
+  std::vector<std::vector<uint8_t>> outputs(num_buffers, std::vector<uint8_t>(32));
+  std::vector<cudf::host_span<uint8_t>> output_spans;
+  for (int i = 0; i < num_buffers; ++i) {
+    if (i % 2 == 0) {
+      inputs.emplace_back(hello_compressed, sizeof(hello_compressed));
+    } else {
+      inputs.emplace_back(aaah_compressed, sizeof(aaah_compressed));
+    }
+    output_spans.emplace_back(outputs[i]);
+  }
+
+  auto const sizes = cudf::io::decompress(
+    cudf::io::compression_type::SNAPPY, inputs, output_spans, cudf::get_default_stream());
+  ASSERT_EQ(sizes.size(), size_t{num_buffers});
+  for (int i = 0; i < num_buffers; ++i) {
+    std::string const expected = i % 2 == 0 ? "hello world" : "Aaaaaaaaaaaah!";
+    EXPECT_EQ(std::string(outputs[i].begin(), outputs[i].begin() + sizes[i]), expected);
+  }
+}
+
+TEST_F(HostDecompressTest, InvalidInputInBatch)
+{
+  constexpr uint8_t hello_compressed[] = {
+    0xb, 0x28, 0x68, 0x65, 0x6c, 0x6c, 0x6f, 0x20, 0x77, 0x6f, 0x72, 0x6c, 0x64};
+  // The uncompressed size does not fit in the output
+  constexpr uint8_t invalid_compressed[] = {0x7f, 0x0};
+
+  std::vector<cudf::host_span<uint8_t const>> inputs{{hello_compressed, sizeof(hello_compressed)},
+                                                     {invalid_compressed, 2}};
+  std::vector<std::vector<uint8_t>> outputs(2, std::vector<uint8_t>(32));
+  std::vector<cudf::host_span<uint8_t>> output_spans{outputs[0], outputs[1]};
+
+  auto const stream = cudf::get_default_stream();
+  EXPECT_THROW(
+    cudf::io::decompress(cudf::io::compression_type::SNAPPY, inputs, output_spans, stream),
+    cudf::logic_error);
+}
+
 TEST_F(NvcompConfigTest, Compression)
 {
   using cudf::io::nvcomp::compression_type;
@@ -223,4 +275,20 @@ TEST_F(NvcompConfigTest, Decompression)
   EXPECT_TRUE(decomp_disabled(compression_type::SNAPPY, {2, 2, 0, false, false, 7}));
 }
 
+TEST_F(NvcompConfigTest, SubBatchSize)
+{
+  auto const& sub_batch_size = cudf::io::nvcomp::sub_batch_size;
+
+  // batches within the scratch limit are not split
+  EXPECT_EQ(sub_batch_size(1000, 1000, 1000, 100), size_t{1000});
+  EXPECT_EQ(sub_batch_size(0, 0, 0, 100), size_t{0});
+  // split batches are rounded down to whole waves
+  EXPECT_EQ(sub_batch_size(1000, 4000, 1000, 100), size_t{200});
+  EXPECT_EQ(sub_batch_size(1000, 2000, 900, 100), size_t{400});
+  // batches smaller than a wave are not rounded
+  EXPECT_EQ(sub_batch_size(1000, 20000, 1000, 100), size_t{50});
+  // at least one chunk per call
+  EXPECT_EQ(sub_batch_size(1000, 1000000, 10, 100), size_t{1});
+}
+
 CUDF_TEST_PROGRAM_MAIN()
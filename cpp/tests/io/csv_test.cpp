@@ -23,6 +23,8 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
+#include <cudf/concatenate.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/io/arrow_io_source.hpp>
@@ -484,6 +486,47 @@ TEST_F(CsvWriterTest, QuotingDisabled)
   test_quoting_disabled_with_delimiter('\u0001');
 }
 
+TEST_F(CsvWriterTest, MixedDirectAndConvertedColumns)
+{
+  auto const int_column =
+    column_wrapper<int64_t>{{-9223372036854775807 - 1, 0, 7, 42, -5, 1, 2, 3, 4, 10},
+                            {1, 1, 0, 1, 1, 1, 1, 1, 1, 1}};
+  auto const bool_column =
+    column_wrapper<bool>{{true, false, true, true, false, true, false, true, false, true},
+                         {1, 1, 1, 0, 1, 1, 1, 1, 1, 1}};
+  auto const decimal_column = cudf::test::fixed_point_column_wrapper<int32_t>{
+    {-1, 12345, 0, 100, 5, -250, 7, 8, 9, 10}, numeric::scale_type{-2}};
+  auto const str_column = column_wrapper<cudf::string_view>{
+    {"a", "b,c", "d", "e", "", "f", "g", "h", "i", "j"}, {1, 1, 1, 1, 0, 1, 1, 1, 1, 1}};
+  auto const input_table =
+    cudf::table_view{{int_column, bool_column, decimal_column, str_column}};
+
+  // a chunk size smaller than the table writes the rows in multiple chunks
+  std::vector<char> out_buffer;
+  auto const options =
+    cudf::io::csv_writer_options::builder(cudf::io::sink_info{&out_buffer}, input_table)
+      .include_header(false)
+      .rows_per_chunk(8)
+      .na_rep("N/A")
+      .true_value("yes")
+      .false_value("no")
+      .build();
+  cudf::io::write_csv(options);
+
+  std::string const expected =
+    "-9223372036854775808,yes,-0.01,a\n"
+    "0,no,123.45,\"b,c\"\n"
+    "N/A,yes,0.00,d\n"
+    "42,N/A,1.00,e\n"
+    "-5,no,0.05,N/A\n"
+    "1,yes,-2.50,f\n"
+    "2,no,0.07,g\n"
+    "3,yes,0.08,h\n"
+    "4,no,0.09,i\n"
+    "10,yes,0.10,j\n";
+  EXPECT_EQ(expected, std::string(out_buffer.begin(), out_buffer.end()));
+}
+
 TEST_F(CsvReaderTest, MultiColumn)
 {
   constexpr auto num_rows = 10;
@@ -1125,6 +1168,76 @@ TEST_F(CsvReaderTest, ByteRangeStrings)
   expect_column_data_equal(std::vector<std::string>{"c"}, view.column(0));
 }
 
+TEST_F(CsvReaderTest, ByteRangePlanning)
+{
+  // Quoted fields with row terminators, and a column with integers followed by floats
+  std::string input = "a,b,c\n";
+  for (int i = 0; i < 40; ++i) {
+    input += std::to_string(i) + ",\"first\nsecond " + std::to_string(i) + "\",";
+    input += (i < 20 ? std::to_string(i) : std::to_string(i) + ".5") + "\n";
+  }
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{input.c_str(), input.size()});
+
+  auto const ranges = cudf::io::plan_csv_byte_ranges(in_opts, 8);
+  ASSERT_GT(ranges.size(), size_t{1});
+  EXPECT_EQ(ranges.front().offset(), 0);
+  for (size_t i = 1; i < ranges.size(); ++i) {
+    EXPECT_EQ(ranges[i].offset(), ranges[i - 1].offset() + ranges[i - 1].size());
+    EXPECT_EQ(input[ranges[i].offset()], '\n');
+  }
+  EXPECT_EQ(ranges.back().offset() + ranges.back().size(), static_cast<int64_t>(input.size()));
+
+  std::vector<rmm::cuda_stream_view> streams(2, cudf::get_default_stream());
+  auto const parts = cudf::io::read_csv_byte_ranges(in_opts, ranges, streams);
+  ASSERT_EQ(parts.size(), ranges.size());
+  std::vector<cudf::table_view> part_views;
+  for (auto const& part : parts) {
+    ASSERT_EQ(part.tbl->num_columns(), 3);
+    EXPECT_EQ(part.metadata.schema_info[2].name, "c");
+    EXPECT_EQ(part.tbl->get_column(2).type().id(), type_id::FLOAT64);
+    part_views.push_back(part.tbl->view());
+  }
+
+  auto const expected = cudf::io::read_csv(in_opts);
+  auto const result   = cudf::concatenate(part_views);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+}
+
+TEST_F(CsvReaderTest, ChunkedReader)
+{
+  std::string input = "a,b,c\n";
+  for (int i = 0; i < 100; ++i) {
+    input += std::to_string(i) + ",\"first\nsecond " + std::to_string(i) + "\",";
+    input += std::to_string(i) + ".5\n";
+  }
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{input.c_str(), input.size()});
+  auto const expected = cudf::io::read_csv(in_opts);
+
+  for (std::size_t chunk_read_limit : {std::size_t{0}, input.size() / 10, std::size_t{100}}) {
+    cudf::io::chunked_csv_reader reader(chunk_read_limit, in_opts);
+    std::vector<cudf::io::table_with_metadata> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(reader.read_chunk());
+    }
+    if (chunk_read_limit == 0) { EXPECT_EQ(chunks.size(), std::size_t{1}); }
+    if (chunk_read_limit != 0) { EXPECT_GT(chunks.size(), std::size_t{1}); }
+
+    std::vector<cudf::table_view> chunk_views;
+    for (auto const& chunk : chunks) {
+      ASSERT_EQ(chunk.metadata.schema_info.size(), std::size_t{3});
+      EXPECT_EQ(chunk.metadata.schema_info[0].name, "a");
+      chunk_views.push_back(chunk.tbl->view());
+    }
+    auto const result = cudf::concatenate(chunk_views);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected.tbl->view(), result->view());
+
+    // all data has been read
+    EXPECT_EQ(reader.read_chunk().tbl->num_columns(), 0);
+  }
+}
+
 TEST_F(CsvReaderTest, BlanksAndComments)
 {
   auto filepath = temp_env->get_temp_dir() + "BlanksAndComments.csv";
@@ -2540,4 +2653,47 @@ TEST_F(CsvReaderTest, UTF8BOM)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result_view, expected);
 }
 
+TEST_F(CsvReaderTest, Filter)
+{
+  std::string buffer = "A,B,C\n1,one,1.5\n5,five,5.5\n2,two,\n7,seven,7.5\n,none,0.5\n";
+
+  // B is only parsed for the rows where A > 4
+  auto literal_value = cudf::numeric_scalar<int64_t>(4);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_name_reference("A");
+  auto filter        = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, literal);
+
+  cudf::io::csv_reader_options in_opts =
+    cudf::io::csv_reader_options::builder(cudf::io::source_info{buffer.c_str(), buffer.size()})
+      .filter(filter);
+  auto const result = cudf::io::read_csv(in_opts);
+
+  auto col1     = cudf::test::fixed_width_column_wrapper<int64_t>({5, 7});
+  auto col2     = cudf::test::strings_column_wrapper({"five", "seven"});
+  auto col3     = cudf::test::fixed_width_column_wrapper<double>({5.5, 7.5});
+  auto expected = cudf::table_view({col1, col2, col3});
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(result.tbl->view(), expected);
+  EXPECT_EQ(result.metadata.schema_info[1].name, "B");
+
+  // Column indices refer to the selected columns
+  auto double_value = cudf::numeric_scalar<double>(4.);
+  auto double_lit   = cudf::ast::literal(double_value);
+  auto index_ref    = cudf::ast::column_reference(1);
+  auto index_filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER, index_ref, double_lit);
+  in_opts.set_use_cols_names({"A", "C"});
+  in_opts.set_filter(index_filter);
+  auto const selected = cudf::io::read_csv(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(selected.tbl->view(), cudf::table_view({col1, col3}));
+
+  // No row passes the filter
+  auto none_value  = cudf::numeric_scalar<int64_t>(10);
+  auto none        = cudf::ast::literal(none_value);
+  auto none_filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, none);
+  in_opts.set_use_cols_names({});
+  in_opts.set_filter(none_filter);
+  auto const empty = cudf::io::read_csv(in_opts);
+  EXPECT_EQ(empty.tbl->num_columns(), 3);
+  EXPECT_EQ(empty.tbl->num_rows(), 0);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -22,9 +22,14 @@
 #include <cudf_test/cudf_gtest.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/io/json.hpp>
+#include <cudf/lists/lists_column_view.hpp>
+
 #include <rmm/resource_ref.hpp>
 
 #include <fstream>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -230,3 +235,163 @@ TEST_F(JsonReaderTest, ByteRange_MultiSource)
     CUDF_TEST_EXPECT_TABLES_EQUIVALENT(current_reader_table.tbl->view(), result->view());
   }
 }
+
+TEST_F(JsonReaderTest, PlanByteRanges)
+{
+  std::string json_string;
+  for (int i = 0; i < 100; ++i) {
+    json_string += R"({ "a": { "y" : )" + std::to_string(i) + R"(}, "b" : [)" +
+                   std::string(i % 7 + 1, '1') + R"(], "c": "str)" + std::to_string(i) + "\" }\n";
+  }
+
+  cudf::io::json_reader_options json_lines_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.c_str(), json_string.size()})
+      .lines(true);
+  auto const expected = cudf::io::read_json(json_lines_options);
+
+  for (size_t num_ranges : {1, 2, 3, 7, 64, 1000}) {
+    auto const ranges = cudf::io::plan_json_byte_ranges(json_lines_options, num_ranges);
+    ASSERT_FALSE(ranges.empty());
+    EXPECT_LE(ranges.size(), std::min<size_t>(num_ranges, 100));
+
+    std::vector<cudf::io::table_with_metadata> tables;
+    int64_t next_offset = 0;
+    for (auto range : ranges) {
+      EXPECT_EQ(range.offset(), next_offset);
+      EXPECT_TRUE(range.offset() == 0 or json_string[range.offset()] == '\n');
+      next_offset = range.offset() + range.size();
+
+      auto range_options = json_lines_options;
+      range_options.set_byte_range_offset(range.offset());
+      range_options.set_byte_range_size(range.size());
+      tables.push_back(cudf::io::read_json(range_options));
+    }
+    EXPECT_EQ(next_offset, static_cast<int64_t>(json_string.size()));
+
+    auto table_views = std::vector<cudf::table_view>(tables.size());
+    std::transform(tables.begin(), tables.end(), table_views.begin(), [](auto& table) {
+      return table.tbl->view();
+    });
+    auto result = cudf::concatenate(table_views);
+    // cannot use EQUAL due to concatenate removing null mask
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.tbl->view(), result->view());
+  }
+}
+
+TEST_F(JsonReaderTest, MergeSchemas)
+{
+  std::string const part0 = R"({ "a": 1, "b": { "x": 1 }, "c": null, "d": [1, 2] })";
+  std::string const part1 =
+    R"({ "a": 1.5, "b": { "x": "s", "y": true }, "c": null, "d": [] })";
+
+  std::vector<cudf::io::table_with_metadata> tables;
+  for (auto const& part : {part0, part1}) {
+    auto options =
+      cudf::io::json_reader_options::builder(cudf::io::source_info{part.c_str(), part.size()})
+        .lines(true)
+        .build();
+    tables.push_back(cudf::io::read_json(options));
+  }
+
+  auto const schema = cudf::io::merge_json_schemas(tables);
+  ASSERT_EQ(schema.size(), std::size_t{4});
+  EXPECT_EQ(schema.at("a").type.id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(schema.at("b").type.id(), cudf::type_id::STRUCT);
+  EXPECT_EQ(schema.at("b").child_types.at("x").type.id(), cudf::type_id::STRING);
+  EXPECT_EQ(schema.at("b").child_types.at("y").type.id(), cudf::type_id::BOOL8);
+  EXPECT_EQ(schema.at("c").type.id(), cudf::type_id::STRING);
+  EXPECT_EQ(schema.at("d").type.id(), cudf::type_id::LIST);
+  EXPECT_EQ(schema.at("d").child_types.at("element").type.id(), cudf::type_id::INT64);
+
+  // Both parts are read with the same column types when the merged schema is passed
+  for (auto const& part : {part0, part1}) {
+    auto options =
+      cudf::io::json_reader_options::builder(cudf::io::source_info{part.c_str(), part.size()})
+        .lines(true)
+        .dtypes(schema)
+        .build();
+    auto const result = cudf::io::read_json(options);
+    EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::FLOAT64);
+    EXPECT_EQ(result.tbl->get_column(1).child(0).type().id(), cudf::type_id::STRING);
+  }
+}
+
+TEST_F(JsonReaderTest, ExtractSchema)
+{
+  std::string const batch0 = R"({ "a": 1, "b": { "x": 1.5 }, "c": null, "d": ["s"] })";
+  std::string const batch1 = R"({ "a": 2, "b": { "x": 2.5 }, "c": null, "d": [], "e": 1 })";
+
+  auto const read_batch = [](std::string const& batch,
+                             std::map<std::string, cudf::io::schema_element> const& schema) {
+    auto options =
+      cudf::io::json_reader_options::builder(cudf::io::source_info{batch.c_str(), batch.size()})
+        .lines(true)
+        .build();
+    if (not schema.empty()) {
+      options.set_dtypes(schema);
+      options.enable_prune_columns(true);
+    }
+    return cudf::io::read_json(options);
+  };
+
+  auto const result0 = read_batch(batch0, {});
+  auto const schema  = cudf::io::extract_json_schema(result0);
+  ASSERT_EQ(schema.size(), std::size_t{4});
+  EXPECT_EQ(schema.at("a").type.id(), cudf::type_id::INT64);
+  EXPECT_EQ(schema.at("b").child_types.at("x").type.id(), cudf::type_id::FLOAT64);
+  EXPECT_EQ(schema.at("c").type, result0.tbl->get_column(2).type());
+  EXPECT_EQ(schema.at("d").child_types.at("element").type.id(), cudf::type_id::STRING);
+
+  // The next batch is read with the same columns and types, without the new field
+  auto const result1 = read_batch(batch1, schema);
+  ASSERT_EQ(result1.tbl->num_columns(), 4);
+  for (cudf::size_type col_idx = 0; col_idx < 4; ++col_idx) {
+    EXPECT_EQ(result1.metadata.schema_info[col_idx].name,
+              result0.metadata.schema_info[col_idx].name);
+    EXPECT_EQ(result1.tbl->get_column(col_idx).type(), result0.tbl->get_column(col_idx).type());
+  }
+  EXPECT_EQ(cudf::lists_column_view(result1.tbl->get_column(3)).child().type().id(),
+            cudf::type_id::STRING);
+}
+
+TEST_F(JsonReaderTest, ChunkedReader)
+{
+  std::string json_string;
+  for (int i = 0; i < 1000; ++i) {
+    auto const a = i % 3 == 0 ? std::string{"null"} : std::to_string(i);
+    json_string += R"({ "a": )" + a + R"(, "b": { "c": "str)" + std::to_string(i) + R"(" } })";
+    json_string += "\n";
+  }
+  auto const filepath = temp_env->get_temp_filepath("ChunkedReader.json");
+  {
+    std::ofstream outfile(filepath, std::ofstream::out);
+    outfile << json_string;
+  }
+
+  cudf::io::json_reader_options json_lines_options =
+    cudf::io::json_reader_options::builder(cudf::io::source_info{filepath}).lines(true);
+  auto const expected = cudf::io::read_json(json_lines_options);
+
+  for (size_t chunk_read_limit : {size_t{0}, json_string.size() / 10, size_t{1000}}) {
+    auto reader = cudf::io::chunked_json_reader(chunk_read_limit, json_lines_options);
+    std::vector<cudf::io::table_with_metadata> tables;
+    while (reader.has_next()) {
+      tables.push_back(reader.read_chunk());
+    }
+    if (chunk_read_limit == 0) {
+      EXPECT_EQ(tables.size(), size_t{1});
+    } else {
+      EXPECT_GE(tables.size(), json_string.size() / chunk_read_limit);
+    }
+    EXPECT_EQ(reader.read_chunk().tbl->num_columns(), 0);
+
+    auto table_views = std::vector<cudf::table_view>(tables.size());
+    std::transform(tables.begin(), tables.end(), table_views.begin(), [](auto& table) {
+      return table.tbl->view();
+    });
+    auto result = cudf::concatenate(table_views);
+    // cannot use EQUAL due to concatenate removing null mask
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected.tbl->view(), result->view());
+  }
+}
@@ -25,6 +25,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/io/arrow_io_source.hpp>
 #include <cudf/io/json.hpp>
@@ -2679,4 +2680,97 @@ TEST_F(JsonReaderTest, JsonNestedDtypeFilter)
   }
 }
 
+TEST_F(JsonReaderTest, JsonColumnProjection)
+{
+  std::string json_string = R"(
+    {"a": 1, "b": {"0": "abc", "1": [-1.]}, "c": true, "d": [{"x": 1, "y": "s"}]}
+    {"a": 1, "b": {"0": "abc"          }, "c": false, "d": []}
+    {"a": 1, "b": {}}
+    {"a": 1,                              "c": null, "d": [{"y": "t"}, {"x": 2}]}
+    )";
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.data(), json_string.size()})
+      .columns({"c", "b.1", "d.x"})
+      .lines(true);
+
+  // selected columns keep their inferred types
+  {
+    cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+    ASSERT_EQ(result.tbl->num_columns(), 3);
+    ASSERT_EQ(result.metadata.schema_info.size(), 3);
+    EXPECT_EQ(result.metadata.schema_info[0].name, "b");
+    EXPECT_EQ(result.metadata.schema_info[1].name, "c");
+    EXPECT_EQ(result.metadata.schema_info[2].name, "d");
+    ASSERT_EQ(result.metadata.schema_info[0].children.size(), 1);
+    EXPECT_EQ(result.metadata.schema_info[0].children[0].name, "1");
+    EXPECT_EQ(result.tbl->get_column(0).type().id(), cudf::type_id::STRUCT);
+    EXPECT_EQ(result.tbl->get_column(0).child(0).child(1).type().id(), cudf::type_id::FLOAT64);
+    EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::BOOL8);
+    // list levels are traversed implicitly
+    auto const& d = result.tbl->get_column(2);
+    EXPECT_EQ(d.type().id(), cudf::type_id::LIST);
+    ASSERT_EQ(d.child(1).num_children(), 1);
+    EXPECT_EQ(d.child(1).child(0).type().id(), cudf::type_id::INT64);
+
+    auto const expected_c = cudf::test::fixed_width_column_wrapper<bool>{
+      {true, false, false, false}, cudf::test::iterators::nulls_at({2, 3})};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(1), expected_c);
+  }
+  // dtypes of the selected columns are still applied
+  {
+    in_options.set_dtypes(std::map<std::string, data_type>{{"c", dtype<int32_t>()}});
+    cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+    ASSERT_EQ(result.tbl->num_columns(), 3);
+    EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::INT32);
+  }
+  // selecting a struct selects all of its children
+  {
+    in_options.set_columns({"b"});
+    cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+    ASSERT_EQ(result.tbl->num_columns(), 1);
+    EXPECT_EQ(result.metadata.schema_info[0].name, "b");
+    ASSERT_EQ(result.metadata.schema_info[0].children.size(), 2);
+  }
+}
+
+TEST_F(JsonReaderTest, JsonFilter)
+{
+  std::string json_string = R"(
+    {"a": 1, "b": "one",   "c": [1]}
+    {"a": 5, "b": "five",  "c": [5, 5]}
+    {"a": 2, "b": "two",   "c": []}
+    {"a": 7, "b": "seven", "c": [7]}
+    {        "b": "none",  "c": null}
+    )";
+
+  auto literal_value = cudf::numeric_scalar<int64_t>(4);
+  auto literal       = cudf::ast::literal(literal_value);
+  auto col_ref       = cudf::ast::column_name_reference("a");
+  auto filter        = cudf::ast::operation(cudf::ast::ast_operator::GREATER, col_ref, literal);
+
+  cudf::io::json_reader_options in_options =
+    cudf::io::json_reader_options::builder(
+      cudf::io::source_info{json_string.data(), json_string.size()})
+      .filter(filter)
+      .lines(true);
+  cudf::io::table_with_metadata result = cudf::io::read_json(in_options);
+
+  ASSERT_EQ(result.tbl->num_columns(), 3);
+  EXPECT_EQ(result.metadata.schema_info[1].name, "b");
+  auto const expected_a = cudf::test::fixed_width_column_wrapper<int64_t>{5, 7};
+  auto const expected_b = cudf::test::strings_column_wrapper{"five", "seven"};
+  auto const expected_c = cudf::test::lists_column_wrapper<int64_t>{{5, 5}, {7}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected_a);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(1), expected_b);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(2), expected_c);
+
+  // Column indices refer to the top-level output columns
+  auto index_ref    = cudf::ast::column_reference(0);
+  auto index_filter = cudf::ast::operation(cudf::ast::ast_operator::GREATER, index_ref, literal);
+  in_options.set_filter(index_filter);
+  result = cudf::io::read_json(in_options);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(result.tbl->get_column(0), expected_a);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
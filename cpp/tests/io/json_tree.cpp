@@ -836,6 +836,11 @@ std::vector<std::string> json_lines_list = {
   R"( {"a" : [], "b" : {}}
  {"a" : []}
  {"b" : {}})",
+  // flat records
+  R"( {"a": 1, "b": "x", "c": true}
+ {"b": "y"}
+ {}
+ {"c": null, "a": 2.5, "d": "z"})",
   R"([1, 2, 3]
      [4, 5, 6])",
   R"([1]
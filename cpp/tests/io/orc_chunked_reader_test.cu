@@ -1117,6 +1117,46 @@ TEST_F(OrcChunkedReaderInputLimitTest, MixedColumns)
   }
 }
 
+TEST_F(OrcChunkedReaderInputLimitTest, PrefetchNextStripes)
+{
+  auto constexpr num_rows = 1'000'000;
+
+  auto const iter1 = thrust::make_counting_iterator<int>(0);
+  auto const col1  = int32s_col(iter1, iter1 + num_rows);
+
+  auto const iter2 = thrust::make_counting_iterator<double>(0);
+  auto const col2  = doubles_col(iter2, iter2 + num_rows);
+
+  auto const filename   = std::string{"prefetch_next_stripes"};
+  auto const test_files = input_limit_get_test_names(temp_env->get_temp_filepath(filename));
+  auto const input      = cudf::table_view{{col1, col2}};
+  // The sources of a read must share the compression type.
+  for (auto const& file : test_files) {
+    input_limit_test_write_one(file, input, 20'000, cudf::io::compression_type::SNAPPY);
+  }
+
+  // Read all the files at once, so that the stripes of the different sources are loaded together.
+  auto const read_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{test_files})
+      .prefetch_next_stripes(true)
+      .build();
+  auto reader = cudf::io::chunked_orc_reader(0UL, 2 * 1024 * 1024UL, read_opts);
+
+  auto out_tables = std::vector<std::unique_ptr<cudf::table>>{};
+  do {
+    out_tables.emplace_back(reader.read_chunk().tbl);
+  } while (reader.has_next());
+  EXPECT_GT(out_tables.size(), 1UL);
+
+  auto out_tviews = std::vector<cudf::table_view>{};
+  for (auto const& tbl : out_tables) {
+    out_tviews.emplace_back(tbl->view());
+  }
+  auto const result   = cudf::concatenate(out_tviews);
+  auto const expected = cudf::concatenate(std::vector<cudf::table_view>{input, input, input});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result, *expected);
+}
+
 namespace {
 
 struct offset_gen {
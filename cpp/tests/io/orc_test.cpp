@@ -25,18 +25,24 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/concatenate.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/orc.hpp>
 #include <cudf/io/orc_metadata.hpp>
+#include <cudf/stream_compaction.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
+#include <cudf/transform.hpp>
 #include <cudf/utilities/span.hpp>
 
 #include <src/io/comp/nvcomp_adapter.hpp>
+#include <src/io/orc/bloom_filter.hpp>
 
 #include <type_traits>
 
@@ -882,6 +888,47 @@ TEST_F(OrcChunkedWriterTest, ReadStripesError)
   EXPECT_THROW(cudf::io::read_orc(read_opts), cudf::logic_error);
 }
 
+TEST_F(OrcChunkedWriterTest, LimitedEncodeBuffer)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 4096, true);
+  auto table2 = create_random_fixed_table<int>(4, 4096, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2}));
+
+  auto write_tables = [&](std::vector<char>& out_buffer, std::optional<size_t> buffer_limit) {
+    auto comp_stats = std::make_shared<cudf::io::writer_compression_statistics>();
+    cudf::io::chunked_orc_writer_options opts =
+      cudf::io::chunked_orc_writer_options::builder(cudf::io::sink_info{&out_buffer})
+        .compression(cudf::io::compression_type::SNAPPY)
+        .stripe_size_rows(1024)
+        .row_index_stride(1024)
+        .compression_statistics(comp_stats);
+    if (buffer_limit.has_value()) { opts.set_max_encode_buffer_bytes(buffer_limit.value()); }
+    cudf::io::orc_chunked_writer(opts).write(*table1).write(*table2);
+    return comp_stats;
+  };
+
+  std::vector<char> out_buffer;
+  // Every stripe is compressed and written in its own batch
+  auto const comp_stats = write_tables(out_buffer, 1);
+
+  cudf::io::orc_reader_options read_opts = cudf::io::orc_reader_options::builder(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf::io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+
+  auto const metadata =
+    cudf::io::read_orc_metadata(cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  EXPECT_EQ(metadata.num_stripes(), 8);
+
+  // The output is not affected by the batching
+  std::vector<char> expected_buffer;
+  auto const expected_comp_stats = write_tables(expected_buffer, std::nullopt);
+  EXPECT_EQ(out_buffer, expected_buffer);
+  EXPECT_EQ(comp_stats->num_compressed_bytes(), expected_comp_stats->num_compressed_bytes());
+}
+
 TYPED_TEST(OrcChunkedWriterNumericTypeTest, UnalignedSize)
 {
   // write out two 31 row tables and make sure they get
@@ -1145,6 +1192,144 @@ TEST_F(OrcReaderTest, SingleInputs)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *table1);
 }
 
+TEST_F(OrcReaderTest, FilterStripes)
+{
+  auto constexpr num_rows = 10000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string(num_rows + i); });
+  auto col0 = int64_col(sequence, sequence + num_rows);
+  auto col1 = str_col(strings, strings + num_rows);
+  auto const expected_table = table_view{{col0, col1}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterStripes.orc");
+  cudf::io::orc_writer_options write_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected_table)
+      .stripe_size_rows(1000)
+      .row_index_stride(1000);
+  cudf::io::write_orc(write_opts);
+
+  auto const read_filtered = [&](cudf::ast::expression const& filter,
+                                 std::vector<std::vector<cudf::size_type>> stripes) {
+    cudf::io::orc_reader_options read_opts =
+      cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+        .stripes(std::move(stripes))
+        .filter(filter);
+    return cudf::io::read_orc(read_opts);
+  };
+
+  {  // Filtering AST - 4500 <= table[0] < 5500
+    auto low      = cudf::numeric_scalar<int64_t>(4500);
+    auto high     = cudf::numeric_scalar<int64_t>(5500);
+    auto low_lit  = cudf::ast::literal(low);
+    auto high_lit = cudf::ast::literal(high);
+    auto col_ref  = cudf::ast::column_reference(0);
+    auto ge       = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, low_lit);
+    auto lt       = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, high_lit);
+    auto filter   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, ge, lt);
+
+    auto predicate = cudf::compute_column(expected_table, filter);
+    auto expected  = cudf::apply_boolean_mask(expected_table, *predicate);
+
+    auto result = read_filtered(filter, {});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+
+    // Stripes in the filter range that are not selected are not read
+    auto const stripes_expected = cudf::slice(expected_table, {5000, 5500});
+    result                      = read_filtered(filter, {{0, 5, 9}});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, stripes_expected[0]);
+  }
+  {  // Filtering AST - table[1] == "s12345"
+    auto value   = cudf::string_scalar("s12345");
+    auto lit     = cudf::ast::literal(value);
+    auto col_ref = cudf::ast::column_reference(1);
+    auto filter  = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, lit);
+
+    auto result = read_filtered(filter, {});
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(expected_table, {2345, 2346})[0]);
+  }
+}
+
+TEST_F(OrcReaderTest, FilterStatistics)
+{
+  auto constexpr num_rows = 10000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto col0     = int64_col(sequence, sequence + num_rows);
+  auto const expected_table = table_view{{col0}};
+
+  auto filepath = temp_env->get_temp_filepath("FilterStatistics.orc");
+  cudf::io::orc_writer_options write_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected_table)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .stripe_size_rows(1000)
+      .row_index_stride(1000);
+  cudf::io::write_orc(write_opts);
+
+  // Filtering AST - 4500 <= table[0] < 5500, in two of the ten stripes
+  auto low      = cudf::numeric_scalar<int64_t>(4500);
+  auto high     = cudf::numeric_scalar<int64_t>(5500);
+  auto low_lit  = cudf::ast::literal(low);
+  auto high_lit = cudf::ast::literal(high);
+  auto col_ref  = cudf::ast::column_reference(0);
+  auto ge       = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref, low_lit);
+  auto lt       = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref, high_lit);
+  auto filter   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, ge, lt);
+
+  auto statistics = std::make_shared<cudf::io::reader_statistics>();
+  cudf::io::orc_reader_options read_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(filter)
+      .statistics(statistics);
+  auto result = cudf::io::read_orc(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, cudf::slice(expected_table, {4500, 5500})[0]);
+
+  EXPECT_EQ(statistics->num_row_groups_total, 10);
+  EXPECT_EQ(statistics->num_row_groups_pruned, 8);
+  EXPECT_GT(statistics->num_bytes_read, 0);
+  EXPECT_GT(statistics->num_compressed_bytes, 0);
+  EXPECT_GT(statistics->num_decompressed_bytes, 0);
+  EXPECT_GT(statistics->decode_time.count(), 0);
+}
+
+TEST_F(OrcReaderTest, BloomFilterPrimitives)
+{
+  using namespace cudf::io::orc::detail;
+
+  auto const hash = [](std::string const& str) {
+    return bloom_filter_bytes_hash(reinterpret_cast<uint8_t const*>(str.data()), str.size());
+  };
+  // reference values of the ORC hash functions
+  EXPECT_EQ(hash(""), 0x74a1'8dc8'f20a'db48ul);
+  EXPECT_EQ(hash("a"), 0xddd9'b0af'19f6'1187ul);
+  EXPECT_EQ(hash("hello world!"), 0xe1d4'853d'8ec0'c40cul);
+  EXPECT_EQ(bloom_filter_long_hash(0), 0x77cf'a1ee'f01b'ca90ul);
+  EXPECT_EQ(bloom_filter_long_hash(1), 0x5bca'7c69'b794'f8ceul);
+
+  // insert a few values into a 1024-bit filter and check membership
+  constexpr uint32_t num_hash_functions = 3;
+  std::vector<uint8_t> bitset(1024 / 8, 0);
+  auto const insert = [&](uint64_t h) {
+    for (uint32_t i = 1; i <= num_hash_functions; ++i) {
+      auto const pos = bloom_filter_bit_position(h, i, static_cast<uint32_t>(bitset.size() * 8));
+      bitset[pos / 8] |= 1u << (pos % 8);
+    }
+  };
+  for (auto const& str : {"apple", "banana", "cherry"}) {
+    insert(hash(str));
+  }
+  insert(bloom_filter_long_hash(42));
+  for (auto const& str : {"apple", "banana", "cherry"}) {
+    EXPECT_TRUE(bloom_filter_contains(bitset.data(), bitset.size(), num_hash_functions, hash(str)));
+  }
+  EXPECT_TRUE(bloom_filter_contains(
+    bitset.data(), bitset.size(), num_hash_functions, bloom_filter_long_hash(42)));
+  // with 4 values and 1024 bits, false positives are practically impossible for a few lookups
+  EXPECT_FALSE(
+    bloom_filter_contains(bitset.data(), bitset.size(), num_hash_functions, hash("durian")));
+  EXPECT_FALSE(bloom_filter_contains(
+    bitset.data(), bitset.size(), num_hash_functions, bloom_filter_long_hash(43)));
+}
+
 TEST_F(OrcReaderTest, zstdCompressionRegression)
 {
   if (cudf::io::nvcomp::is_decompression_disabled(cudf::io::nvcomp::compression_type::ZSTD)) {
@@ -1551,6 +1736,52 @@ TEST_F(OrcReaderTest, DecimalOptions)
   EXPECT_NO_THROW(cudf::io::read_orc(valid_opts));
 }
 
+TEST_F(OrcReaderTest, DictionaryColumns)
+{
+  auto constexpr num_rows = 10000;
+  auto sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string(i * 7 % 37); });
+  auto mask = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto col0 = int64_col(sequence, sequence + num_rows);
+  auto col1 = str_col(strings, strings + num_rows, mask);
+  auto const expected_table = table_view{{col0, col1}};
+
+  cudf::io::table_input_metadata expected_metadata(expected_table);
+  expected_metadata.column_metadata[0].set_name("int");
+  expected_metadata.column_metadata[1].set_name("str");
+
+  auto filepath = temp_env->get_temp_filepath("OrcDictionaryColumns.orc");
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{filepath}, expected_table)
+      .metadata(std::move(expected_metadata))
+      .stripe_size_rows(1000);
+  cudf::io::write_orc(out_opts);
+
+  cudf::io::orc_reader_options in_opts =
+    cudf::io::orc_reader_options::builder(cudf::io::source_info{filepath})
+      .dictionary_columns({"int", "str"});
+  auto result = cudf::io::read_orc(in_opts);
+
+  // Only the string column is read as a dictionary
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->get_column(0), col0);
+  ASSERT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(result.metadata.schema_info[1].name, "str");
+
+  // The keys are the sorted distinct strings of all the stripes
+  auto const expected_dictionary = cudf::dictionary::encode(col1);
+  auto const dictionary = cudf::dictionary_column_view(result.tbl->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(dictionary.keys(),
+                                 cudf::dictionary_column_view(*expected_dictionary).keys());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(dictionary), col1);
+
+  // Reading no rows still produces an empty dictionary column
+  in_opts.set_num_rows(0);
+  result = cudf::io::read_orc(in_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 0);
+  EXPECT_EQ(result.tbl->get_column(1).type().id(), cudf::type_id::DICTIONARY32);
+}
+
 TEST_F(OrcWriterTest, DecimalOptionsNested)
 {
   auto const num_rows = 100;
@@ -1969,6 +2200,39 @@ TEST_F(OrcWriterTest, UnorderedDictionary)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*from_sorted, *from_unsorted);
 }
 
+TEST_F(OrcWriterTest, HighCardinalityStrings)
+{
+  auto constexpr num_rows  = 50000;
+  auto constexpr rg_stride = 10000;
+  // all distinct
+  auto unique_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "unique_string_" + std::to_string(i); });
+  // same long values repeated in every rowgroup
+  auto repeated_it = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "repeated_string_value_" + std::to_string(i % 10); });
+  str_col unique_col(unique_it, unique_it + num_rows);
+  str_col repeated_col(repeated_it, repeated_it + num_rows);
+  table_view expected({unique_col, repeated_col});
+
+  std::vector<char> out_buffer;
+  cudf::io::orc_writer_options out_opts =
+    cudf::io::orc_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .compression(cudf::io::compression_type::NONE)
+      .row_index_stride(rg_stride);
+  cudf::io::write_orc(out_opts);
+
+  cudf::io::orc_reader_options in_opts = cudf::io::orc_reader_options::builder(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto result = cudf::io::read_orc(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // The repeated column is still dictionary encoded, so its characters are not written per row
+  auto const stream         = cudf::get_default_stream();
+  auto const unique_chars   = cudf::strings_column_view(unique_col).chars_size(stream);
+  auto const repeated_chars = cudf::strings_column_view(repeated_col).chars_size(stream);
+  EXPECT_LT(out_buffer.size(), unique_chars + repeated_chars / 2);
+}
+
 TEST_F(OrcStatisticsTest, Empty)
 {
   int32_col col0{};
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <src/io/utilities/parallel_sink.hpp>
+
+#include <fstream>
+#include <future>
+#include <iterator>
+#include <numeric>
+#include <vector>
+
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct ParallelSinkTest : public cudf::test::BaseFixture {};
+
+TEST_F(ParallelSinkTest, MixedWritesKeepOrder)
+{
+  std::vector<uint8_t> expected(40 << 20);
+  std::iota(expected.begin(), expected.end(), 0);
+  auto const stream = cudf::test::get_default_stream();
+  rmm::device_buffer d_data(expected.data(), expected.size(), stream);
+  auto const d_bytes = static_cast<uint8_t const*>(d_data.data());
+
+  auto const filepath = temp_env->get_temp_filepath("ParallelSinkTest.bin");
+  {
+    auto sink = cudf::io::detail::make_parallel_file_sink(filepath, 4);
+    EXPECT_TRUE(sink->is_device_write_preferred(1));
+
+    // small host writes that share a part, a device write, then a large host write and a
+    // device write that are each split over several threads
+    size_t offset = 0;
+    for (auto size : {10, 1000, 5}) {
+      sink->host_write(expected.data() + offset, size);
+      offset += size;
+    }
+    std::vector<std::future<void>> writes;
+    writes.push_back(sink->device_write_async(d_bytes + offset, 3 << 20, stream));
+    offset += 3 << 20;
+    sink->host_write(expected.data() + offset, 17 << 20);
+    offset += 17 << 20;
+    writes.push_back(sink->device_write_async(d_bytes + offset, expected.size() - offset, stream));
+    EXPECT_EQ(sink->bytes_written(), expected.size());
+
+    for (auto& write : writes) {
+      write.get();
+    }
+    sink->flush();
+  }
+
+  std::ifstream file(filepath, std::ios::binary);
+  std::vector<uint8_t> const result((std::istreambuf_iterator<char>(file)),
+                                   std::istreambuf_iterator<char>());
+  EXPECT_EQ(result, expected);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -1159,6 +1159,43 @@ TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, MixedColumns)
   input_limit_test_read(test_filenames, tbl, 0, 1, expected_b);
 }
 
+TEST_F(ParquetChunkedReaderInputLimitConstrainedTest, PrefetchNextPass)
+{
+  auto const filepath = temp_env->get_temp_filepath("prefetch_next_pass.parquet");
+
+  constexpr auto num_rows = 1'000'000;
+  auto iter1              = thrust::make_counting_iterator<int>(0);
+  cudf::test::fixed_width_column_wrapper<int> col1(iter1, iter1 + num_rows);
+  auto iter2 = thrust::make_counting_iterator<double>(0);
+  cudf::test::fixed_width_column_wrapper<double> col2(iter2, iter2 + num_rows);
+  auto tbl = cudf::table_view{{col1, col2}};
+
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl)
+      .compression(cudf::io::compression_type::SNAPPY)
+      .row_group_size_rows(50'000);
+  cudf::io::write_parquet(out_opts);
+
+  auto const read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .prefetch_next_pass(true)
+      .build();
+  // a limit small enough to read each row group in its own pass
+  auto reader = cudf::io::chunked_parquet_reader(0, 1, read_opts);
+
+  auto out_tables = std::vector<std::unique_ptr<cudf::table>>{};
+  do {
+    out_tables.emplace_back(reader.read_chunk().tbl);
+  } while (reader.has_next());
+  EXPECT_GE(out_tables.size(), 20);
+
+  auto out_tviews = std::vector<cudf::table_view>{};
+  for (auto const& t : out_tables) {
+    out_tviews.emplace_back(t->view());
+  }
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::concatenate(out_tviews), tbl);
+}
+
 struct ParquetChunkedReaderInputLimitTest : public cudf::test::BaseFixture {};
 
 struct offset_gen {
@@ -89,6 +89,56 @@ TEST_F(ParquetChunkedWriterTest, LargeTables)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
 }
 
+TEST_F(ParquetChunkedWriterTest, LimitedEncodeBuffer)
+{
+  srand(31337);
+  auto table1 = create_random_fixed_table<int>(4, 4000, true);
+  auto table2 = create_random_fixed_table<int>(4, 4000, true);
+
+  auto full_table = cudf::concatenate(std::vector<table_view>({*table1, *table2}));
+
+  // a 1 byte limit encodes and writes each row group on its own
+  auto filepath = temp_env->get_temp_filepath("ChunkedLimitedEncodeBuffer.parquet");
+  cudf::io::chunked_parquet_writer_options args =
+    cudf::io::chunked_parquet_writer_options::builder(cudf::io::sink_info{filepath})
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(1000)
+      .max_encode_buffer_bytes(1);
+  cudf::io::parquet_chunked_writer(args).write(*table1).write(*table2);
+
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto result = cudf::io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *full_table);
+
+  // the page indexes of every batch must point at the pages of their chunk
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), 8);
+
+  for (auto const& rg : fmd.row_groups) {
+    for (auto const& chunk : rg.columns) {
+      auto const oi = read_offset_index(source, chunk);
+      ASSERT_FALSE(oi.page_locations.empty());
+      EXPECT_EQ(oi.page_locations[0].offset, chunk.meta_data.data_page_offset);
+
+      int64_t num_vals = 0;
+      for (auto const& page_loc : oi.page_locations) {
+        auto const ph = read_page_header(source, page_loc);
+        EXPECT_EQ(ph.type, cudf::io::parquet::detail::PageType::DATA_PAGE);
+        EXPECT_EQ(page_loc.first_row_index, num_vals);
+        num_vals += ph.data_page_header.num_values;
+      }
+      EXPECT_EQ(num_vals, rg.num_rows);
+
+      auto const ci = read_column_index(source, chunk);
+      EXPECT_EQ(ci.min_values.size(), oi.page_locations.size());
+    }
+  }
+}
+
 TEST_F(ParquetChunkedWriterTest, ManyTables)
 {
   srand(31337);
@@ -120,6 +170,31 @@ TEST_F(ParquetChunkedWriterTest, ManyTables)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
 }
 
+TEST_F(ParquetChunkedWriterTest, GrowingDictionaries)
+{
+  // the second table has far more distinct values than the dictionaries of the first one
+  constexpr auto num_rows = 40000;
+  auto low_values = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 8; });
+  column_wrapper<int> low_col(low_values, low_values + num_rows);
+  auto high_values = thrust::make_counting_iterator(0);
+  column_wrapper<int> high_col(high_values, high_values + num_rows);
+  auto const low_table  = table_view{{low_col}};
+  auto const high_table = table_view{{high_col}};
+
+  auto expected = cudf::concatenate(std::vector<table_view>({low_table, high_table, low_table}));
+
+  auto filepath = temp_env->get_temp_filepath("ChunkedGrowingDictionaries.parquet");
+  cudf::io::chunked_parquet_writer_options args =
+    cudf::io::chunked_parquet_writer_options::builder(cudf::io::sink_info{filepath});
+  cudf::io::parquet_chunked_writer(args).write(low_table).write(high_table).write(low_table);
+
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto result = cudf::io::read_parquet(read_opts);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *expected);
+}
+
 TEST_F(ParquetChunkedWriterTest, Strings)
 {
   std::vector<std::unique_ptr<cudf::column>> cols;
@@ -606,6 +606,14 @@ template std::unique_ptr<cudf::column> make_parquet_list_col<int64_t>(std::mt199
                                                                       int num_rows,
                                                                       int max_vals_per_row,
                                                                       bool include_validity);
+template std::unique_ptr<cudf::column> make_parquet_list_col<float>(std::mt19937& engine,
+                                                                    int num_rows,
+                                                                    int max_vals_per_row,
+                                                                    bool include_validity);
+template std::unique_ptr<cudf::column> make_parquet_list_col<double>(std::mt19937& engine,
+                                                                     int num_rows,
+                                                                     int max_vals_per_row,
+                                                                     bool include_validity);
 
 std::vector<std::string> string_values(std::mt19937& engine, int num_rows, int max_string_len)
 {
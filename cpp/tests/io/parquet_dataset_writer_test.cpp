@@ -0,0 +1,117 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "parquet_common.hpp"
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/io/parquet.hpp>
+#include <cudf/io/parquet_dataset.hpp>
+#include <cudf/sorting.hpp>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+struct ParquetDatasetWriterTest : public cudf::test::BaseFixture {
+  ParquetDatasetWriterTest()
+    : years{{1, 2, 1, 0, 2, 1}, cudf::test::iterators::null_at(3)},
+      tags{"a/b", "x", "a/b", "x", "x", "a/b"},
+      values{0, 1, 2, 3, 4, 5}
+  {
+  }
+
+  [[nodiscard]] cudf::io::table_input_metadata metadata() const
+  {
+    cudf::io::table_input_metadata metadata(table_view{{years, tags, values}});
+    metadata.column_metadata[0].set_name("year");
+    metadata.column_metadata[1].set_name("tag");
+    metadata.column_metadata[2].set_name("v");
+    return metadata;
+  }
+
+  column_wrapper<int32_t> years;
+  cudf::test::strings_column_wrapper tags;
+  column_wrapper<int64_t> values;
+};
+
+namespace {
+
+std::unique_ptr<cudf::column> read_sorted_values(std::string const& path)
+{
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{path}).build());
+  EXPECT_EQ(result.tbl->num_columns(), 1);
+  EXPECT_EQ(result.metadata.schema_info[0].name, "v");
+  return cudf::sort(result.tbl->view())->release()[0];
+}
+
+}  // namespace
+
+TEST_F(ParquetDatasetWriterTest, PartitionsAcrossWrites)
+{
+  auto const base = temp_env->get_temp_dir() + "DatasetAcrossWrites";
+  auto const options =
+    cudf::io::parquet_dataset_writer_options::builder(base, {0, 1}).metadata(metadata()).build();
+  cudf::io::parquet_dataset_writer writer{options};
+  writer.write(table_view{{years, tags, values}}).write(table_view{{years, tags, values}});
+  auto files = writer.close();
+  std::sort(files.begin(), files.end());
+
+  std::vector<std::string> const expected_files{
+    base + "/year=1/tag=a%2Fb/part-00000.parquet",
+    base + "/year=2/tag=x/part-00000.parquet",
+    base + "/year=__HIVE_DEFAULT_PARTITION__/tag=x/part-00000.parquet"};
+  ASSERT_EQ(files, expected_files);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(read_sorted_values(files[0])->view(),
+                                 column_wrapper<int64_t>{0, 0, 2, 2, 5, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(read_sorted_values(files[1])->view(),
+                                 column_wrapper<int64_t>{1, 1, 4, 4});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(read_sorted_values(files[2])->view(),
+                                 column_wrapper<int64_t>{3, 3});
+}
+
+TEST_F(ParquetDatasetWriterTest, RollsFilesBySizeAndOpenLimit)
+{
+  auto const base    = temp_env->get_temp_dir() + "DatasetRollover";
+  auto const options = cudf::io::parquet_dataset_writer_options::builder(base, {0})
+                         .metadata(metadata())
+                         .max_file_size(1)
+                         .max_open_files(1)
+                         .build();
+  cudf::io::parquet_dataset_writer writer{options};
+  writer.write(table_view{{years, tags, values}}).write(table_view{{years, tags, values}});
+  auto const files = writer.close();
+
+  // every write to a partition closes its file, so each write adds one file per partition
+  EXPECT_EQ(files.size(), 6);
+  EXPECT_EQ(std::count(files.begin(), files.end(), base + "/year=2/part-00001.parquet"), 1);
+}
+
+TEST_F(ParquetDatasetWriterTest, InvalidPartitionColumns)
+{
+  auto const base = temp_env->get_temp_dir() + "DatasetInvalid";
+  cudf::io::parquet_dataset_writer out_of_range{
+    cudf::io::parquet_dataset_writer_options::builder(base, {3})};
+  EXPECT_THROW(out_of_range.write(table_view{{years, tags, values}}), cudf::logic_error);
+
+  cudf::io::parquet_dataset_writer repeated{
+    cudf::io::parquet_dataset_writer_options::builder(base, {1, 1})};
+  EXPECT_THROW(repeated.write(table_view{{years, tags, values}}), cudf::logic_error);
+}
@@ -16,6 +16,10 @@
 
 #include "parquet_common.hpp"
 
+#include <src/io/parquet/bloom_filter.hpp>
+#include <src/io/parquet/footer_cache.hpp>
+#include <src/io/parquet/reader_impl_helpers.hpp>
+
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/io_metadata_utilities.hpp>
@@ -23,12 +27,21 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/dictionary/dictionary_column_view.hpp>
+#include <cudf/dictionary/encode.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/transform.hpp>
 
+#include <algorithm>
+#include <cstdlib>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
 TEST_F(ParquetReaderTest, UserBounds)
 {
   // trying to read more rows than there are should result in
@@ -1325,6 +1338,171 @@ TEST_F(ParquetReaderTest, ReorderedReadMultipleFiles)
   CUDF_TEST_EXPECT_TABLES_EQUAL(sliced[1], swapped2);
 }
 
+// Many small files have their footers parsed and their data read concurrently
+TEST_F(ParquetReaderTest, ReadManySmallFiles)
+{
+  constexpr auto num_files = 64;
+  constexpr auto num_rows  = 1'000;
+
+  std::vector<std::string> filepaths;
+  std::vector<std::unique_ptr<cudf::table>> expected_tables;
+  for (int f = 0; f < num_files; ++f) {
+    auto ints = cudf::detail::make_counting_transform_iterator(
+      0, [f](auto i) { return f * num_rows + i; });
+    auto strs = cudf::detail::make_counting_transform_iterator(
+      0, [f](auto i) { return "file " + std::to_string(f) + " row " + std::to_string(i); });
+    auto col0 = cudf::test::fixed_width_column_wrapper<int>(ints, ints + num_rows);
+    auto col1 = cudf::test::strings_column_wrapper(strs, strs + num_rows);
+    expected_tables.push_back(std::make_unique<cudf::table>(table_view{{col0, col1}}));
+
+    filepaths.push_back(
+      temp_env->get_temp_filepath("ReadManySmallFiles" + std::to_string(f) + ".parquet"));
+    auto out_opts = cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepaths.back()},
+                                                              expected_tables.back()->view());
+    cudf::io::write_parquet(out_opts);
+  }
+
+  std::vector<table_view> expected_views;
+  std::transform(expected_tables.begin(),
+                 expected_tables.end(),
+                 std::back_inserter(expected_views),
+                 [](auto const& tbl) { return tbl->view(); });
+  auto const expected = cudf::concatenate(expected_views);
+
+  auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepaths});
+  auto result    = cudf::io::read_parquet(read_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, StringsAsDictionaries)
+{
+  constexpr auto num_rows = 10'000;
+
+  auto str1 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "cat " + std::to_string((i * 7) % 13); });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto col0 = cudf::test::strings_column_wrapper(str1, str1 + num_rows, valids);
+  // each row group has different dictionary entries
+  auto str2 = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "dog " + std::to_string(i / 1000); });
+  auto col1 = cudf::test::strings_column_wrapper(str2, str2 + num_rows);
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto col2 = cudf::test::fixed_width_column_wrapper<int>(ints, ints + num_rows);
+  auto const expected = table_view{{col0, col1, col2}};
+
+  auto const filepath = temp_env->get_temp_filepath("StringsAsDictionaries.parquet");
+  auto out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .row_group_size_rows(2'000);
+  cudf::io::write_parquet(out_opts);
+
+  auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                     .convert_strings_to_dictionaries(true);
+  auto const result = cudf::io::read_parquet(read_opts);
+  auto const view   = result.tbl->view();
+  ASSERT_EQ(view.num_columns(), 3);
+  EXPECT_EQ(view.column(0).type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(view.column(1).type().id(), cudf::type_id::DICTIONARY32);
+  EXPECT_EQ(cudf::dictionary_column_view(view.column(0)).keys_size(), 13);
+  EXPECT_EQ(cudf::dictionary_column_view(view.column(1)).keys_size(), 10);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(view.column(0)), col0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*cudf::dictionary::decode(view.column(1)), col1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(view.column(2), col2);
+}
+
+// Only the metadata of the selected and filter columns of a wide file is decoded
+TEST_F(ParquetReaderTest, WideFileColumnSelection)
+{
+  constexpr auto num_columns = 500;
+  constexpr auto num_rows    = 1'000;
+
+  srand(31337);
+  auto written_table = create_random_fixed_table<int>(num_columns, num_rows, false);
+
+  auto const filepath = temp_env->get_temp_filepath("WideFileColumnSelection.parquet");
+  auto out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, *written_table)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN)
+      .row_group_size_rows(250);
+  cudf::io::write_parquet(out_opts);
+
+  auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                     .columns({"_col321", "_col7"});
+  auto result = cudf::io::read_parquet(read_opts);
+  auto const expected =
+    table_view{{written_table->get_column(321).view(), written_table->get_column(7).view()}};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  // the filter column is not selected
+  auto literal_value     = cudf::numeric_scalar<decltype(RAND_MAX)>(RAND_MAX / 2);
+  auto literal           = cudf::ast::literal(literal_value);
+  auto col_ref_3         = cudf::ast::column_reference(3);
+  auto col_name_3        = cudf::ast::column_name_reference("_col3");
+  auto ref_filter        = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_3, literal);
+  auto filter_expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_name_3, literal);
+
+  auto predicate = cudf::compute_column(*written_table, ref_filter);
+  auto expected_filtered =
+    cudf::apply_boolean_mask(table_view{{written_table->get_column(321).view()}}, *predicate);
+
+  auto filtered_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                         .columns({"_col321"})
+                         .filter(filter_expression);
+  auto filtered = cudf::io::read_parquet(filtered_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected_filtered->view(), filtered.tbl->view());
+}
+
+TEST_F(ParquetReaderTest, FooterCache)
+{
+  auto const filepath = temp_env->get_temp_filepath("FooterCache.parquet");
+  auto const write    = [&](cudf::size_type num_rows, int step) {
+    auto ints =
+      cudf::detail::make_counting_transform_iterator(0, [step](auto i) { return i * step; });
+    auto col0 = cudf::test::fixed_width_column_wrapper<int>(ints, ints + num_rows);
+    auto tbl  = std::make_unique<cudf::table>(table_view{{col0}});
+    auto out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, tbl->view())
+        .row_group_size_rows(1000);
+    cudf::io::write_parquet(out_opts);
+    return tbl;
+  };
+  auto const read = [&]() {
+    auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+    return cudf::io::read_parquet(read_opts).tbl;
+  };
+  auto const& cache = cudf::io::parquet::detail::get_footer_cache();
+
+  cudf::io::set_parquet_footer_cache_capacity(1024 * 1024);
+  EXPECT_EQ(cudf::io::get_parquet_footer_cache_capacity(), 1024 * 1024);
+
+  auto const expected = write(5000, 2);
+  auto const num_hits = cache.num_hits();
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits);
+  // served from the cache
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits + 1);
+
+  // a rewritten file is parsed again
+  auto const rewritten = write(3000, 2);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(rewritten->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits + 1);
+
+  // also when it is rewritten right away with the same number of rows
+  auto const same_size = write(3000, 3);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(same_size->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits + 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(same_size->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits + 2);
+
+  cudf::io::set_parquet_footer_cache_capacity(0);
+  EXPECT_EQ(cudf::io::get_parquet_footer_cache_capacity(), 0);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(same_size->view(), read()->view());
+  EXPECT_EQ(cache.num_hits(), num_hits + 2);
+}
+
 TEST_F(ParquetReaderTest, FilterSimple)
 {
   srand(31337);
@@ -1406,6 +1584,37 @@ TEST_F(ParquetReaderTest, FilterIdentity)
   CUDF_TEST_EXPECT_TABLES_EQUAL(*result.tbl, *result2.tbl);
 }
 
+TEST_F(ParquetReaderTest, FilterStatistics)
+{
+  auto [src, filepath] = create_parquet_with_stats("FilterStatistics.parquet");
+
+  // Filtering AST - table[0] < 50, only in the first of the three row groups
+  auto literal_value     = cudf::numeric_scalar<uint32_t>(50);
+  auto literal           = cudf::ast::literal(literal_value);
+  auto col_ref_0         = cudf::ast::column_reference(0);
+  auto filter_expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, literal);
+
+  auto statistics = std::make_shared<cudf::io::reader_statistics>();
+  cudf::io::parquet_reader_options read_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(filter_expression)
+      .statistics(statistics);
+  auto result = cudf::io::read_parquet(read_opts);
+  EXPECT_EQ(result.tbl->num_rows(), 5000);
+
+  EXPECT_EQ(statistics->num_row_groups_total, 3);
+  EXPECT_EQ(statistics->num_row_groups_pruned, 2);
+  EXPECT_GT(statistics->num_bytes_read, 0);
+  EXPECT_GT(statistics->metadata_time.count(), 0);
+  EXPECT_GT(statistics->decode_time.count(), 0);
+
+  // Statistics accumulate over reads
+  auto const bytes_read = statistics->num_bytes_read;
+  cudf::io::read_parquet(read_opts);
+  EXPECT_EQ(statistics->num_row_groups_total, 6);
+  EXPECT_EQ(statistics->num_bytes_read, 2 * bytes_read);
+}
+
 TEST_F(ParquetReaderTest, FilterWithColumnProjection)
 {
   // col_uint32, col_int64, col_double
@@ -1532,6 +1741,39 @@ TEST_F(ParquetReaderTest, FilterMultiple1)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
 }
 
+TEST_F(ParquetReaderTest, FilterStringOperators)
+{
+  using T = cudf::string_view;
+
+  auto const [src, filepath] = create_parquet_typed_with_stats<T>("FilterStringOperators.parquet");
+  auto const written_table   = src.view();
+
+  // Filtering AST - starts_with(table[0], "0000100") && contains(table[2], "7")
+  auto prefix_value = cudf::string_scalar("0000100");
+  auto target_value = cudf::string_scalar("7");
+  auto col_ref_0    = cudf::ast::column_reference(0);
+  auto col_ref_2    = cudf::ast::column_reference(2);
+  auto prefix       = cudf::ast::literal(prefix_value);
+  auto target       = cudf::ast::literal(target_value);
+
+  auto starts_with = cudf::ast::operation(cudf::ast::ast_operator::STARTS_WITH, col_ref_0, prefix);
+  auto contains    = cudf::ast::operation(cudf::ast::ast_operator::CONTAINS, col_ref_2, target);
+
+  auto expr = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, starts_with, contains);
+
+  // Expected result
+  auto predicate = cudf::compute_column(written_table, expr);
+  auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+  auto si                  = cudf::io::source_info(filepath);
+  auto builder             = cudf::io::parquet_reader_options::builder(si).filter(expr);
+  auto table_with_metadata = cudf::io::read_parquet(builder);
+  auto result              = table_with_metadata.tbl->view();
+
+  // tests
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result);
+}
+
 TEST_F(ParquetReaderTest, FilterMultiple2)
 {
   // multiple conditions on same column.
@@ -1925,6 +2167,411 @@ TEST_F(ParquetReaderTest, FilterFloatNAN)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected1->view(), result1);
 }
 
+// Filter using the page-level statistics of the column index
+TEST_F(ParquetReaderTest, FilterPageIndex)
+{
+  using T                 = int64_t;
+  constexpr auto num_rows = 100'000;
+  auto sorted   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto payload  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto col0     = cudf::test::fixed_width_column_wrapper<T>(sorted, sorted + num_rows);
+  auto col1     = cudf::test::fixed_width_column_wrapper<int32_t>(payload, payload + num_rows);
+  auto const written_table = table_view{{col0, col1}};
+  auto const filepath      = temp_env->get_temp_filepath("FilterPageIndex.parquet");
+  {
+    // a single row group with many pages
+    const cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+        .row_group_size_rows(num_rows)
+        .max_page_size_rows(1000)
+        .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+    cudf::io::write_parquet(out_opts);
+  }
+  auto si          = cudf::io::source_info(filepath);
+  auto filter_col0 = cudf::ast::column_reference(0);
+  auto low         = cudf::numeric_scalar<T>(45'500, true);
+  auto high        = cudf::numeric_scalar<T>(47'200, true);
+  auto low_lit     = cudf::ast::literal(low);
+  auto high_lit    = cudf::ast::literal(high);
+
+  // Filtering AST - table[0] >= 45500 AND table[0] < 47200
+  auto expr_1 = cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, filter_col0, low_lit);
+  auto expr_2 = cudf::ast::operation(cudf::ast::ast_operator::LESS, filter_col0, high_lit);
+  auto expr   = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, expr_1, expr_2);
+
+  // Expected result
+  auto predicate = cudf::compute_column(written_table, expr);
+  auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+  auto builder = cudf::io::parquet_reader_options::builder(si).filter(expr);
+  {
+    auto table_with_metadata = cudf::io::read_parquet(builder);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), table_with_metadata.tbl->view());
+  }
+  {
+    // no page can satisfy the filter
+    auto none      = cudf::numeric_scalar<T>(num_rows, true);
+    auto none_lit  = cudf::ast::literal(none);
+    auto none_expr = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, filter_col0, none_lit);
+    auto none_builder        = cudf::io::parquet_reader_options::builder(si).filter(none_expr);
+    auto table_with_metadata = cudf::io::read_parquet(none_builder);
+    EXPECT_EQ(table_with_metadata.tbl->num_rows(), 0);
+  }
+  {
+    // chunked read with a small pass limit
+    auto reader = cudf::io::chunked_parquet_reader(0, 100'000, builder.build());
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    std::vector<table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+      return tbl->view();
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), cudf::concatenate(views)->view());
+  }
+}
+
+// Filter matching interior pages of several row groups, which are the only pages decoded
+TEST_F(ParquetReaderTest, FilterPageIndexInteriorPages)
+{
+  using T                 = int64_t;
+  constexpr auto num_rows = 100'000;
+  auto sorted   = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto payload  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row" + std::to_string(i); });
+  auto validity = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5; });
+  auto col0     = cudf::test::fixed_width_column_wrapper<T>(sorted, sorted + num_rows);
+  auto col1     = cudf::test::fixed_width_column_wrapper<int32_t>(payload, payload + num_rows);
+  auto col2     = cudf::test::strings_column_wrapper(strings, strings + num_rows, validity);
+  auto const written_table = table_view{{col0, col1, col2}};
+
+  // rows in the middle of the first and third row groups, and rows across the boundary of the
+  // third and fourth row groups:
+  // (table[0] >= 12300 AND table[0] < 12800) OR (table[0] >= 61000 AND table[0] < 61500) OR
+  // (table[0] >= 74600 AND table[0] < 75400)
+  auto filter_col0 = cudf::ast::column_reference(0);
+  auto low_1       = cudf::numeric_scalar<T>(12'300, true);
+  auto high_1      = cudf::numeric_scalar<T>(12'800, true);
+  auto low_2       = cudf::numeric_scalar<T>(61'000, true);
+  auto high_2      = cudf::numeric_scalar<T>(61'500, true);
+  auto low_3       = cudf::numeric_scalar<T>(74'600, true);
+  auto high_3      = cudf::numeric_scalar<T>(75'400, true);
+  auto low_lit_1   = cudf::ast::literal(low_1);
+  auto high_lit_1  = cudf::ast::literal(high_1);
+  auto low_lit_2   = cudf::ast::literal(low_2);
+  auto high_lit_2  = cudf::ast::literal(high_2);
+  auto low_lit_3   = cudf::ast::literal(low_3);
+  auto high_lit_3  = cudf::ast::literal(high_3);
+
+  using cudf::ast::ast_operator;
+  auto low_op_1  = cudf::ast::operation(ast_operator::GREATER_EQUAL, filter_col0, low_lit_1);
+  auto high_op_1 = cudf::ast::operation(ast_operator::LESS, filter_col0, high_lit_1);
+  auto low_op_2  = cudf::ast::operation(ast_operator::GREATER_EQUAL, filter_col0, low_lit_2);
+  auto high_op_2 = cudf::ast::operation(ast_operator::LESS, filter_col0, high_lit_2);
+  auto low_op_3  = cudf::ast::operation(ast_operator::GREATER_EQUAL, filter_col0, low_lit_3);
+  auto high_op_3 = cudf::ast::operation(ast_operator::LESS, filter_col0, high_lit_3);
+  auto band_1    = cudf::ast::operation(ast_operator::LOGICAL_AND, low_op_1, high_op_1);
+  auto band_2    = cudf::ast::operation(ast_operator::LOGICAL_AND, low_op_2, high_op_2);
+  auto band_3    = cudf::ast::operation(ast_operator::LOGICAL_AND, low_op_3, high_op_3);
+  auto bands_12  = cudf::ast::operation(ast_operator::LOGICAL_OR, band_1, band_2);
+  auto expr      = cudf::ast::operation(ast_operator::LOGICAL_OR, bands_12, band_3);
+
+  auto const expected_for = [&](cudf::size_type begin, cudf::size_type end) {
+    auto const rows      = cudf::slice(written_table, {begin, end}).front();
+    auto const predicate = cudf::compute_column(rows, expr);
+    return cudf::apply_boolean_mask(rows, *predicate);
+  };
+  auto const read_chunked = [](cudf::io::parquet_reader_options const& read_opts) {
+    auto reader = cudf::io::chunked_parquet_reader(50'000, 100'000, read_opts);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    std::vector<table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+      return tbl->view();
+    });
+    return cudf::concatenate(views);
+  };
+
+  for (auto const compression :
+       {cudf::io::compression_type::NONE, cudf::io::compression_type::SNAPPY}) {
+    SCOPED_TRACE(compression == cudf::io::compression_type::NONE ? "uncompressed" : "snappy");
+    auto const filepath = temp_env->get_temp_filepath("FilterPageIndexInteriorPages.parquet");
+    {
+      // four row groups with many pages each, without dictionaries, whose pages are read for
+      // every column chunk
+      cudf::io::parquet_writer_options const out_opts =
+        cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+          .row_group_size_rows(25'000)
+          .max_page_size_rows(1'000)
+          .compression(compression)
+          .dictionary_policy(cudf::io::dictionary_policy::NEVER)
+          .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+      cudf::io::write_parquet(out_opts);
+    }
+    auto const builder = [&]() {
+      return cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .filter(expr);
+    };
+
+    {
+      auto const statistics = std::make_shared<cudf::io::reader_statistics>();
+      auto const result     = cudf::io::read_parquet(builder().statistics(statistics));
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_for(0, num_rows)->view(), result.tbl->view());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_for(0, num_rows)->view(),
+                                    read_chunked(builder().build())->view());
+
+      // only the pages holding the matching rows are decompressed
+      if (compression != cudf::io::compression_type::NONE) {
+        auto const all_statistics = std::make_shared<cudf::io::reader_statistics>();
+        auto const all_rows       = cudf::io::read_parquet(
+          cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+            .statistics(all_statistics));
+        EXPECT_EQ(all_rows.tbl->num_rows(), num_rows);
+        EXPECT_LT(statistics->num_compressed_bytes * 10, all_statistics->num_compressed_bytes);
+      }
+    }
+    {
+      // skip_rows/num_rows starting and ending within the matching rows
+      auto const read_opts = builder().skip_rows(12'500).num_rows(62'500).build();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_for(12'500, 75'000)->view(),
+                                    cudf::io::read_parquet(read_opts).tbl->view());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_for(12'500, 75'000)->view(),
+                                    read_chunked(read_opts)->view());
+    }
+    {
+      // skip_rows alone, ending with the file
+      auto const read_opts = builder().skip_rows(61'200).build();
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected_for(61'200, num_rows)->view(),
+                                    cudf::io::read_parquet(read_opts).tbl->view());
+    }
+    {
+      // row bounds outside of the matching rows
+      auto const read_opts = builder().skip_rows(20'000).num_rows(30'000).build();
+      EXPECT_EQ(cudf::io::read_parquet(read_opts).tbl->num_rows(), 0);
+    }
+    {
+      // row ranges intersecting the matching rows
+      auto const read_opts = builder().row_ranges({{0, 12'400}, {61'400, 74'700}}).build();
+      auto const expected  = cudf::concatenate(std::vector<table_view>{
+        expected_for(0, 12'400)->view(), expected_for(61'400, 74'700)->view()});
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(),
+                                    cudf::io::read_parquet(read_opts).tbl->view());
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), read_chunked(read_opts)->view());
+    }
+  }
+}
+
+// Filter reading the filter columns first and then the other columns for the matching rows only
+TEST_F(ParquetReaderTest, FilterLateMaterialization)
+{
+  using T                 = int32_t;
+  constexpr auto num_rows = 32000;
+  // every page holds a 10000, so the statistics can't prune the pages without a 5000
+  auto keys = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i == 20017 ? 5000 : (i % 1000 == 999 ? 10000 : i % 1000);
+  });
+  auto payload = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto col0    = cudf::test::fixed_width_column_wrapper<T>(keys, keys + num_rows);
+  auto col1    = cudf::test::fixed_width_column_wrapper<int64_t>(payload, payload + num_rows);
+  auto const written_table = table_view{{col0, col1}};
+  auto const filepath      = temp_env->get_temp_filepath("FilterLateMaterialization.parquet");
+  {
+    cudf::io::table_input_metadata out_metadata(written_table);
+    out_metadata.column_metadata[0].set_name("key");
+    out_metadata.column_metadata[1].set_name("payload");
+    const cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+        .metadata(std::move(out_metadata))
+        .row_group_size_rows(8000)
+        .max_page_size_rows(1000);
+    cudf::io::write_parquet(out_opts);
+  }
+  auto si       = cudf::io::source_info(filepath);
+  auto key_name = cudf::ast::column_name_reference("key");
+  auto key_ref  = cudf::ast::column_reference(0);
+
+  auto const test_filter = [&](T value) {
+    SCOPED_TRACE("key " + std::to_string(value));
+    auto s_value    = cudf::numeric_scalar<T>(value, true);
+    auto lit_value  = cudf::ast::literal(s_value);
+    auto expr       = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, key_name, lit_value);
+    auto table_expr = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, key_ref, lit_value);
+
+    // Expected result
+    auto predicate = cudf::compute_column(written_table, table_expr);
+    auto expected  = cudf::apply_boolean_mask(written_table, *predicate);
+
+    auto builder =
+      cudf::io::parquet_reader_options::builder(si).filter(expr).late_materialization(true);
+    auto result = cudf::io::read_parquet(builder);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result.tbl->view());
+
+    // filter column not in the output
+    auto projected = cudf::io::read_parquet(builder.columns({"payload"}));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected->select({1}), projected.tbl->view());
+
+    // same output as a regular read, for row selections, column orders and filters by index
+    auto const expect_regular_read = [&](cudf::io::parquet_reader_options options) {
+      auto const regular = cudf::io::read_parquet(options);
+      options.enable_late_materialization(true);
+      auto const late = cudf::io::read_parquet(options);
+      CUDF_TEST_EXPECT_TABLES_EQUAL(regular.tbl->view(), late.tbl->view());
+      ASSERT_EQ(regular.metadata.schema_info.size(), late.metadata.schema_info.size());
+      for (size_t i = 0; i < late.metadata.schema_info.size(); ++i) {
+        EXPECT_EQ(regular.metadata.schema_info[i].name, late.metadata.schema_info[i].name);
+      }
+    };
+    auto const options = [&] { return cudf::io::parquet_reader_options::builder(si).filter(expr); };
+    expect_regular_read(options().columns({"payload", "key"}));
+    expect_regular_read(options().skip_rows(12'345).num_rows(10'000));
+    expect_regular_read(options().skip_rows(20'017));
+    expect_regular_read(options().row_ranges({{100, 900}, {19'000, 24'500}, {31'000, 32'000}}));
+    expect_regular_read(options().row_groups({{1, 2}}));
+    // row groups out of file order are read without late materialization
+    expect_regular_read(options().row_groups({{3, 2, 0}}));
+    expect_regular_read(
+      cudf::io::parquet_reader_options::builder(si).columns({"key", "payload"}).filter(table_expr));
+  };
+
+  // matches in a single page
+  test_filter(5000);
+  // matches in every page
+  test_filter(7);
+  // no matches
+  test_filter(-1);
+
+  auto s_value   = cudf::numeric_scalar<T>(5000, true);
+  auto lit_value = cudf::ast::literal(s_value);
+  auto expr      = cudf::ast::operation(cudf::ast::ast_operator::EQUAL, key_name, lit_value);
+
+  // the payload pages without matching rows are not decompressed
+  auto const read_bytes = [&](bool late_materialization) {
+    auto const statistics = std::make_shared<cudf::io::reader_statistics>();
+    cudf::io::read_parquet(cudf::io::parquet_reader_options::builder(si)
+                             .filter(expr)
+                             .late_materialization(late_materialization)
+                             .statistics(statistics));
+    return statistics->num_compressed_bytes;
+  };
+  EXPECT_LT(read_bytes(true) * 2, read_bytes(false));
+
+  // the chunked reader does not support late materialization
+  EXPECT_THROW(
+    cudf::io::chunked_parquet_reader(
+      0, cudf::io::parquet_reader_options::builder(si).filter(expr).late_materialization(true)),
+    std::invalid_argument);
+}
+
+TEST_F(ParquetReaderTest, BloomFilterPrimitives)
+{
+  using namespace cudf::io::parquet::detail;
+
+  // reference values of the 64-bit xxHash with seed 0
+  auto const hash = [](std::string const& str) {
+    return bloom_filter_hash(reinterpret_cast<uint8_t const*>(str.data()), str.size());
+  };
+  EXPECT_EQ(hash(""), 0xef46'db37'51d8'e999ul);
+  EXPECT_EQ(hash("a"), 0xd24e'c4f1'a98c'6e5bul);
+  EXPECT_EQ(hash("abc"), 0x44bc'2cf5'ad77'0999ul);
+  EXPECT_EQ(hash("Nobody inspects the spammish repetition"), 0xfbce'a83c'8a37'8bf1ul);
+
+  // insert a few values into a 4-block filter and check membership
+  std::vector<uint8_t> bitset(4 * bloom_filter_block_bytes, 0);
+  auto const insert = [&](uint64_t h) {
+    auto const block = bloom_filter_block_index(h, 4) * bloom_filter_block_bytes;
+    for (int i = 0; i < bloom_filter_block_words; ++i) {
+      uint32_t word;
+      std::memcpy(&word, bitset.data() + block + i * sizeof(uint32_t), sizeof(word));
+      word |= bloom_filter_word_mask(h, i);
+      std::memcpy(bitset.data() + block + i * sizeof(uint32_t), &word, sizeof(word));
+    }
+  };
+  for (auto const& str : {"apple", "banana", "cherry"}) {
+    insert(hash(str));
+  }
+  for (auto const& str : {"apple", "banana", "cherry"}) {
+    EXPECT_TRUE(bloom_filter_contains(bitset.data(), bitset.size(), hash(str)));
+  }
+  // with 3 values and 128 bytes, false positives are practically impossible for a few lookups
+  EXPECT_FALSE(bloom_filter_contains(bitset.data(), bitset.size(), hash("durian")));
+}
+
+TEST_F(ParquetReaderTest, BloomFilterPruning)
+{
+  using namespace cudf::io::parquet::detail;
+  constexpr cudf::size_type num_rows = 40'000;
+  constexpr cudf::size_type rg_rows  = 10'000;
+
+  // only even values, so odd values within the min/max range can only be ruled out by the filter
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col0(ints, ints + num_rows);
+  auto zeros = cudf::detail::make_counting_transform_iterator(0, [](auto) { return -0.0f; });
+  cudf::test::fixed_width_column_wrapper<float> col1(zeros, zeros + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints").set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_name("zeros").set_bloom_filter(true);
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilterPruning.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(expected_metadata)
+      .row_group_size_rows(rg_rows)
+      .max_page_size_rows(rg_rows);
+  cudf::io::write_parquet(out_opts);
+
+  auto const sources = cudf::io::datasource::create(std::vector<std::string>{filepath});
+  aggregate_reader_metadata metadata(sources, false);
+  auto const dtypes = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT32},
+                                                  cudf::data_type{cudf::type_id::FLOAT32}};
+  auto const schemas = std::vector<int>{1, 2};
+
+  auto const filter_row_groups = [&](cudf::ast::expression const& filter) {
+    return metadata.filter_row_groups(
+      sources, {}, dtypes, schemas, filter, cudf::get_default_stream());
+  };
+  auto const ints_ref  = cudf::ast::column_reference(0);
+  auto const zeros_ref = cudf::ast::column_reference(1);
+
+  // the statistics keep only row group 1 for a value in its min/max range
+  auto present         = cudf::numeric_scalar<int32_t>(2 * 12'345);
+  auto present_literal = cudf::ast::literal(present);
+  auto const present_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ints_ref, present_literal);
+  auto const present_row_groups = filter_row_groups(present_filter);
+  ASSERT_TRUE(present_row_groups.has_value());
+  EXPECT_EQ(present_row_groups.value(), std::vector<std::vector<cudf::size_type>>{{1}});
+
+  // so row group 1 is only skipped for a missing odd value thanks to its Bloom filter
+  auto absent         = cudf::numeric_scalar<int32_t>(2 * 12'345 + 1);
+  auto absent_literal = cudf::ast::literal(absent);
+  auto const absent_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, ints_ref, absent_literal);
+  auto const absent_row_groups = filter_row_groups(absent_filter);
+  ASSERT_TRUE(absent_row_groups.has_value());
+  EXPECT_EQ(absent_row_groups.value(), std::vector<std::vector<cudf::size_type>>{{}});
+
+  // 0.0 equals the -0.0 in the filters despite their different bits, so nothing is skipped
+  auto zero         = cudf::numeric_scalar<float>(0.0f);
+  auto zero_literal = cudf::ast::literal(zero);
+  auto const zero_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, zeros_ref, zero_literal);
+  EXPECT_FALSE(filter_row_groups(zero_filter).has_value());
+
+  auto const zero_name_filter = cudf::ast::operation(
+    cudf::ast::ast_operator::EQUAL, cudf::ast::column_name_reference("zeros"), zero_literal);
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+      .filter(zero_name_filter);
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetReaderTest, RepeatedNoAnnotations)
 {
   constexpr unsigned char repeated_bytes[] = {
@@ -2119,6 +2766,71 @@ TEST_F(ParquetReaderTest, DeltaSkipRowsWithNulls)
   }
 }
 
+TEST_F(ParquetReaderTest, FixedWidthListsSkipRows)
+{
+  constexpr int num_rows = 10'000;
+  constexpr auto seed    = 21337;
+
+  std::mt19937 engine{seed};
+  auto float_list_nulls  = make_parquet_list_col<float>(engine, num_rows, 5, true);
+  auto float_list        = make_parquet_list_col<float>(engine, num_rows, 5, false);
+  auto double_list_nulls = make_parquet_list_col<double>(engine, num_rows, 5, true);
+  auto int32_list_nulls  = make_parquet_list_col<int32_t>(engine, num_rows, 5, true);
+  auto int8_list         = make_parquet_list_col<int8_t>(engine, num_rows, 5, false);
+
+  // list<list<float>>, two inner lists per row
+  auto inner = make_parquet_list_col<float>(engine, num_rows * 2, 5, true);
+  auto offset_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](int i) { return 2 * i; });
+  auto outer_offsets = column_wrapper<cudf::size_type>(offset_iter, offset_iter + num_rows + 1);
+  auto float_list_list =
+    cudf::make_lists_column(num_rows, outer_offsets.release(), std::move(inner), 0, {});
+
+  cudf::table_view tbl({*float_list_nulls,
+                        *float_list,
+                        *double_list_nulls,
+                        *int32_list_nulls,
+                        *int8_list,
+                        *float_list_list});
+
+  // clang-format off
+  std::vector<std::pair<int, int>> params{
+    {-1, -1}, {1, -1}, {33, -1}, {1000, -1},
+    {0, 1}, {0, 31}, {0, 129},
+    {1, 32}, {33, 139},
+    // cross page boundaries
+    {1'999, 2'001}, {3'000, 5'000}
+  };
+  // clang-format on
+
+  for (auto const policy :
+       {cudf::io::dictionary_policy::NEVER, cudf::io::dictionary_policy::ALWAYS}) {
+    std::vector<char> buffer;
+    auto const out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, tbl)
+        .compression(cudf::io::compression_type::NONE)
+        .dictionary_policy(policy)
+        .max_page_size_rows(2'000)
+        .build();
+    cudf::io::write_parquet(out_opts);
+
+    for (auto p : params) {
+      cudf::io::parquet_reader_options read_args = cudf::io::parquet_reader_options::builder(
+        cudf::io::source_info{buffer.data(), buffer.size()});
+      if (p.first >= 0) { read_args.set_skip_rows(p.first); }
+      if (p.second >= 0) { read_args.set_num_rows(p.second); }
+      auto const result = cudf::io::read_parquet(read_args);
+
+      p.first  = p.first < 0 ? 0 : p.first;
+      p.second = p.second < 0 ? num_rows - p.first : p.second;
+      std::vector<cudf::size_type> slice_indices{p.first, p.first + p.second};
+      auto const expected = cudf::slice(tbl, slice_indices);
+
+      CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected[0]);
+    }
+  }
+}
+
 TEST_F(ParquetReaderTest, DeltaByteArraySkipAllValid)
 {
   // test that the DELTA_BYTE_ARRAY decoder can handle the case where skip rows skips all valid
@@ -2153,6 +2865,46 @@ TEST_F(ParquetReaderTest, DeltaByteArraySkipAllValid)
 }
 
 // test that using page stats is working for full reads and various skip rows
+TEST_F(ParquetReaderTest, DictionaryStringsMixedLengths)
+{
+  // a few long values among short ones, so that warps copy both kinds in the same batch
+  constexpr int num_rows   = 20'000;
+  constexpr int num_unique = 100;
+  std::mt19937 engine{31337};
+  auto const short_strings = string_values(engine, num_unique, 8);
+  auto const long_strings  = string_values(engine, num_unique, 400);
+  std::vector<std::string> strings(num_rows);
+  for (int i = 0; i < num_rows; ++i) {
+    strings[i] = i % 7 == 0 ? long_strings[i % num_unique] : short_strings[i % num_unique];
+  }
+  auto const validity = random_validity(engine);
+  auto const col = cudf::test::strings_column_wrapper(strings.begin(), strings.end(), validity);
+  auto const expected = cudf::purge_nonempty_nulls(col);
+  cudf::table_view tbl({*expected});
+
+  std::vector<char> buffer;
+  auto const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, tbl)
+      .dictionary_policy(cudf::io::dictionary_policy::ALWAYS)
+      .max_page_size_rows(5'000)
+      .build();
+  cudf::io::write_parquet(out_opts);
+
+  auto const in_opts = cudf::io::parquet_reader_options::builder(
+    cudf::io::source_info{buffer.data(), buffer.size()});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), tbl);
+
+  // skipping rows starts the copies in the middle of a warp
+  auto const skip_opts = cudf::io::parquet_reader_options::builder(
+                           cudf::io::source_info{buffer.data(), buffer.size()})
+                           .skip_rows(4'321)
+                           .num_rows(10'000)
+                           .build();
+  auto const skipped = cudf::io::read_parquet(skip_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(skipped.tbl->view(), cudf::slice(tbl, {4'321, 14'321})[0]);
+}
+
 TEST_F(ParquetReaderTest, StringsWithPageStats)
 {
   constexpr int num_rows = 10'000;
@@ -2237,6 +2989,134 @@ TEST_F(ParquetReaderTest, StringsWithPageStats)
   }
 }
 
+// Skip rows using the offset index to drop the leading pages of the first row group
+TEST_F(ParquetReaderTest, SkipRowsPageIndex)
+{
+  constexpr auto num_rows = 40'000;
+  std::mt19937 gen(6542);
+  auto sorted  = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto payload = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  auto col0 = cudf::test::fixed_width_column_wrapper<int64_t>(sorted, sorted + num_rows);
+  auto col1 =
+    cudf::test::fixed_width_column_wrapper<int32_t>(payload, payload + num_rows, validity);
+  auto const str_data = string_values(gen, num_rows, 12);
+  auto col2 = cudf::test::strings_column_wrapper(str_data.begin(), str_data.end(), validity);
+  auto col3 = make_parquet_list_col<int32_t>(gen, num_rows, 5, true);
+  auto const written_table = table_view{{col0, col1, col2, *col3}};
+
+  auto const filepath = temp_env->get_temp_filepath("SkipRowsPageIndex.parquet");
+  // several row groups with many pages each, with and without dictionary pages
+  cudf::io::parquet_writer_options const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+      .row_group_size_rows(15'000)
+      .max_page_size_rows(1'000)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf::io::write_parquet(out_opts);
+
+  // clang-format off
+  std::vector<std::pair<int, int>> params{
+    // skip within the first page, to a page boundary, and deep into a row group
+    {1, -1}, {999, -1}, {1'000, -1}, {1'001, -1}, {9'876, -1}, {14'999, -1},
+    // skip into a later row group
+    {15'000, -1}, {27'345, -1}, {39'999, -1},
+    // skip and truncate, within a page and across row groups
+    {12'345, 10}, {12'345, 5'000}
+  };
+  // clang-format on
+  for (auto p : params) {
+    cudf::io::parquet_reader_options read_args =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+    read_args.set_skip_rows(p.first);
+    if (p.second >= 0) { read_args.set_num_rows(p.second); }
+    auto const result = cudf::io::read_parquet(read_args);
+
+    p.second = p.second < 0 ? num_rows - p.first : p.second;
+    std::vector<cudf::size_type> slice_indices{p.first, p.first + p.second};
+    auto const expected = cudf::slice(written_table, slice_indices);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected[0]);
+  }
+}
+
+TEST_F(ParquetReaderTest, RowRanges)
+{
+  constexpr auto num_rows = 40'000;
+  std::mt19937 gen(6543);
+  auto sorted = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+  auto col0 = cudf::test::fixed_width_column_wrapper<int64_t>(sorted, sorted + num_rows);
+  auto const str_data = string_values(gen, num_rows, 12);
+  auto col1 = cudf::test::strings_column_wrapper(str_data.begin(), str_data.end(), validity);
+  auto col2 = make_parquet_list_col<int32_t>(gen, num_rows, 5, true);
+  auto const written_table = table_view{{col0, col1, *col2}};
+
+  auto const filepath = temp_env->get_temp_filepath("RowRanges.parquet");
+  cudf::io::parquet_writer_options const out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, written_table)
+      .row_group_size_rows(10'000)
+      .max_page_size_rows(1'000)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_COLUMN);
+  cudf::io::write_parquet(out_opts);
+
+  auto const expected_for = [&](std::vector<cudf::size_type> const& indices) {
+    return cudf::concatenate(cudf::slice(written_table, indices));
+  };
+
+  {
+    // unsorted and overlapping ranges, skipping the second row group entirely
+    std::vector<std::pair<int64_t, int64_t>> const ranges{
+      {25'000, 25'010}, {5, 17}, {12, 30}, {2'500, 2'501}, {39'990, 50'000}};
+    auto const read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .row_ranges(ranges)
+        .build();
+    auto const expected = expected_for({5, 30, 2'500, 2'501, 25'000, 25'010, 39'990, 40'000});
+    auto const result   = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected->view());
+
+    // the chunked reader trims every output chunk
+    auto reader = cudf::io::chunked_parquet_reader(100'000, 200'000, read_opts);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (reader.has_next()) {
+      chunks.push_back(std::move(reader.read_chunk().tbl));
+    }
+    std::vector<table_view> views;
+    std::transform(chunks.begin(), chunks.end(), std::back_inserter(views), [](auto const& tbl) {
+      return tbl->view();
+    });
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::concatenate(views)->view(), expected->view());
+  }
+  {
+    // a range spanning row groups
+    auto const read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .row_ranges({{9'000, 21'000}})
+        .build();
+    auto const result = cudf::io::read_parquet(read_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(result.tbl->view(), expected_for({9'000, 21'000})->view());
+  }
+  {
+    // no rows selected
+    auto const read_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+        .row_ranges({{100, 100}, {num_rows, num_rows + 10}})
+        .build();
+    auto const result = cudf::io::read_parquet(read_opts);
+    EXPECT_EQ(result.tbl->num_rows(), 0);
+    EXPECT_EQ(result.tbl->num_columns(), written_table.num_columns());
+  }
+  {
+    auto read_opts = cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath})
+                       .row_ranges({{1, 2}})
+                       .build();
+    EXPECT_THROW(read_opts.set_skip_rows(1), cudf::logic_error);
+    EXPECT_THROW(read_opts.set_row_groups({{0}}), cudf::logic_error);
+    EXPECT_THROW(read_opts.set_row_ranges({{2, 1}}), cudf::logic_error);
+  }
+}
+
 ///////////////////
 // metadata tests
 
@@ -2519,3 +3399,87 @@ TYPED_TEST(ParquetReaderPredicatePushdownTest, FilterTyped)
   EXPECT_EQ(result_table.num_columns(), expected->num_columns());
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result_table);
 }
+
+TEST_F(ParquetReaderTest, ParallelFooterParse)
+{
+  // The middle row group must be decoded by neither the first nor the last task
+  if (std::thread::hardware_concurrency() < 3) { GTEST_SKIP() << "Needs at least 3 threads"; }
+
+  constexpr cudf::size_type num_rows = 3'000;
+  constexpr cudf::size_type rg_rows  = 100;
+  constexpr auto num_row_groups      = num_rows / rg_rows;
+
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto strs = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  cudf::test::fixed_width_column_wrapper<int64_t> col0(ints, ints + num_rows);
+  cudf::test::strings_column_wrapper col1(strs, strs + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  // Without statistics or dictionaries the offset of each row group is not repeated elsewhere in
+  // the footer
+  std::vector<char> out_buffer;
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .row_group_size_rows(rg_rows)
+      .max_page_size_rows(rg_rows)
+      .stats_level(cudf::io::statistics_freq::STATISTICS_NONE)
+      .dictionary_policy(cudf::io::dictionary_policy::NEVER);
+  cudf::io::write_parquet(out_opts);
+
+  auto const file     = reinterpret_cast<uint8_t const*>(out_buffer.data());
+  auto const file_end = file + out_buffer.size() - sizeof(cudf::io::parquet::detail::file_ender_s);
+  auto const ender    = reinterpret_cast<cudf::io::parquet::detail::file_ender_s const*>(file_end);
+  std::vector<uint8_t> footer(file_end - ender->footer_len, file_end);
+
+  auto const parse = [](std::vector<uint8_t> const& footer) {
+    cudf::io::parquet::detail::FileMetaData fmd;
+    cudf::io::parquet::detail::CompactProtocolReader cp(footer.data(), footer.size());
+    cp.read(&fmd);
+    return fmd;
+  };
+
+  // The footer is far below the default threshold, so it is parsed serially
+  unsetenv("LIBCUDF_PARQUET_PARALLEL_FOOTER_PARSE_SIZE");
+  auto const serial = parse(footer);
+  ASSERT_EQ(serial.row_groups.size(), static_cast<std::size_t>(num_row_groups));
+
+  setenv("LIBCUDF_PARQUET_PARALLEL_FOOTER_PARSE_SIZE", "1", 1);
+  auto const parallel = parse(footer);
+  EXPECT_EQ(parallel.num_rows, serial.num_rows);
+  EXPECT_EQ(parallel.row_groups.size(), serial.row_groups.size());
+  for (std::size_t rg = 0; rg < std::min(parallel.row_groups.size(), serial.row_groups.size());
+       ++rg) {
+    auto const& expect_rg = serial.row_groups[rg];
+    auto const& actual_rg = parallel.row_groups[rg];
+    EXPECT_EQ(actual_rg.num_rows, expect_rg.num_rows);
+    EXPECT_EQ(actual_rg.total_byte_size, expect_rg.total_byte_size);
+    EXPECT_EQ(actual_rg.file_offset, expect_rg.file_offset);
+    ASSERT_EQ(actual_rg.columns.size(), expect_rg.columns.size());
+    for (std::size_t c = 0; c < actual_rg.columns.size(); ++c) {
+      auto const& expect_md = expect_rg.columns[c].meta_data;
+      auto const& actual_md = actual_rg.columns[c].meta_data;
+      EXPECT_EQ(actual_md.type, expect_md.type);
+      EXPECT_EQ(actual_md.path_in_schema, expect_md.path_in_schema);
+      EXPECT_EQ(actual_md.num_values, expect_md.num_values);
+      EXPECT_EQ(actual_md.total_compressed_size, expect_md.total_compressed_size);
+      EXPECT_EQ(actual_md.data_page_offset, expect_md.data_page_offset);
+    }
+  }
+
+  // Change the type of the first i64 field holding the offset of the middle row group to i32.
+  // Both are varints, so the row groups are still found, but decoding the middle one fails and
+  // the error surfaces from its task.
+  auto const file_offset = serial.row_groups[num_row_groups / 2].file_offset.value();
+  std::vector<uint8_t> field{0x26};  // field id delta of 2, type i64
+  for (auto zigzag = static_cast<uint64_t>(file_offset) << 1; true; zigzag >>= 7) {
+    field.push_back(static_cast<uint8_t>(zigzag < 0x80 ? zigzag : (zigzag & 0x7f) | 0x80));
+    if (zigzag < 0x80) { break; }
+  }
+  auto const field_pos = std::search(footer.begin(), footer.end(), field.begin(), field.end());
+  ASSERT_NE(field_pos, footer.end());
+  *field_pos = 0x25;
+  EXPECT_THROW(parse(footer), cudf::logic_error);
+
+  unsetenv("LIBCUDF_PARQUET_PARALLEL_FOOTER_PARSE_SIZE");
+}
@@ -22,11 +22,14 @@
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
 
+#include <cudf/ast/expressions.hpp>
 #include <cudf/io/data_sink.hpp>
 #include <cudf/io/parquet.hpp>
 #include <cudf/io/types.hpp>
 #include <cudf/unary.hpp>
 
+#include <src/io/parquet/bloom_filter.hpp>
+#include <src/io/parquet/compact_protocol_reader.hpp>
 #include <src/io/parquet/parquet.hpp>
 #include <src/io/parquet/parquet_common.hpp>
 
@@ -346,6 +349,43 @@ TEST_F(ParquetWriterTest, CustomDataSink)
   CUDF_TEST_EXPECT_TABLES_EQUAL(buf_tbl.tbl->view(), expected->view());
 }
 
+TEST_F(ParquetWriterTest, HostWriteManyRowGroups)
+{
+  constexpr cudf::size_type num_rows = 50'000;
+  constexpr cudf::size_type rg_rows  = 5'000;
+
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i * 3; });
+  auto strs = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "row " + std::to_string(i); });
+  auto valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int64_t> col0(ints, ints + num_rows, valids);
+  cudf::test::strings_column_wrapper col1(strs, strs + num_rows);
+  auto const expected = table_view{{col0, col1}};
+
+  // a host buffer sink does not write from device memory, so every chunk goes through the bounce
+  // buffer and the host writes of consecutive chunks overlap with their copies
+  std::vector<char> out_buffer;
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&out_buffer}, expected)
+      .compression(cudf::io::compression_type::NONE)
+      .row_group_size_rows(rg_rows)
+      .max_page_size_rows(rg_rows);
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(
+    cudf::host_span<std::byte const>{reinterpret_cast<std::byte const*>(out_buffer.data()),
+                                     out_buffer.size()});
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+  EXPECT_EQ(fmd.row_groups.size(), num_rows / rg_rows);
+
+  cudf::io::parquet_reader_options in_opts = cudf::io::parquet_reader_options::builder(
+    cudf::io::source_info{out_buffer.data(), out_buffer.size()});
+  auto const result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, DeviceWriteLargeishFile)
 {
   auto filepath = temp_env->get_temp_filepath("DeviceWriteLargeishFile.parquet");
@@ -620,6 +660,44 @@ TEST_F(ParquetWriterTest, EmptyListWithStruct)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tbl->view().column(0), *L0);
 }
 
+TEST_F(ParquetWriterTest, ListOfStructSiblingLeaves)
+{
+  // The leaves of the struct share the levels of the list and the struct, and differ in their nulls
+  auto ints_col = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 3, 4, 5, 6, 7, 8},
+                                                                  {1, 0, 1, 1, 0, 1, 1, 1}};
+  auto floats_col =
+    cudf::test::fixed_width_column_wrapper<float>{1.5f, 2.5f, 3.5f, 4.5f, 5.5f, 6.5f, 7.5f, 8.5f};
+  auto longs_col = cudf::test::fixed_width_column_wrapper<int64_t>{{10, 11, 12, 13, 14, 15, 16, 17},
+                                                                   {0, 1, 1, 1, 1, 0, 1, 1}};
+  auto struct_col = cudf::test::structs_column_wrapper{{ints_col, floats_col, longs_col},
+                                                       {1, 1, 0, 1, 1, 1, 1, 1}};
+
+  auto const list_valids = std::vector<bool>{1, 1, 1, 0, 1, 1};
+  auto [null_mask, null_count] =
+    cudf::test::detail::make_null_mask(list_valids.begin(), list_valids.end());
+  auto list_col = cudf::make_lists_column(
+    6,
+    cudf::test::fixed_width_column_wrapper<int32_t>{0, 2, 2, 5, 5, 7, 8}.release(),
+    struct_col.release(),
+    null_count,
+    std::move(null_mask));
+
+  auto const expected = table_view{{*list_col}};
+  auto filepath       = temp_env->get_temp_filepath("ListOfStructSiblingLeaves.parquet");
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options_builder(cudf::io::sink_info(filepath), expected));
+  auto result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options_builder(cudf::io::source_info(filepath)));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+
+  auto const sliced = cudf::slice(expected, {1, 5});
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options_builder(cudf::io::sink_info(filepath), sliced[0]));
+  result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options_builder(cudf::io::source_info(filepath)));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(sliced[0], result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, CheckPageRows)
 {
   auto sequence = thrust::make_counting_iterator(0);
@@ -1725,6 +1803,58 @@ TEST_F(ParquetWriterTest, UserRequestedEncodings)
   EXPECT_TRUE(has_delta);
 }
 
+TEST_F(ParquetWriterTest, AdaptiveEncodings)
+{
+  using cudf::io::parquet::detail::Encoding;
+  constexpr int num_rows = 10'000;
+
+  // consecutive values delta encode to almost nothing, while random ones need more than 32 bits
+  auto const sequence = thrust::make_counting_iterator(int64_t{1'000'000'000'000});
+  auto const seq_col =
+    cudf::test::fixed_width_column_wrapper<int64_t>(sequence, sequence + num_rows, no_nulls());
+  auto const random_data = random_values<int32_t>(num_rows);
+  auto const random_col  = cudf::test::fixed_width_column_wrapper<int32_t>(
+    random_data.begin(), random_data.end(), no_nulls());
+
+  auto const strings = thrust::make_constant_iterator("string");
+  auto const string_col =
+    cudf::test::strings_column_wrapper(strings, strings + num_rows, no_nulls());
+
+  auto const expected = table_view({seq_col, random_col, string_col, seq_col});
+
+  cudf::io::table_input_metadata table_metadata(expected);
+  for (auto& col_meta : table_metadata.column_metadata) {
+    col_meta.set_nullability(false);
+  }
+  // requested encodings take precedence
+  table_metadata.column_metadata[3].set_encoding(cudf::io::column_encoding::PLAIN);
+
+  auto const filepath = temp_env->get_temp_filepath("AdaptiveEncodings.parquet");
+  cudf::io::parquet_writer_options opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(table_metadata)
+      .dictionary_policy(cudf::io::dictionary_policy::NEVER)
+      .adaptive_encoding(true);
+  cudf::io::write_parquet(opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  cudf::io::parquet::detail::FileMetaData fmd;
+  read_footer(source, &fmd);
+
+  auto const data_encoding = [&fmd](int idx) {
+    return fmd.row_groups[0].columns[idx].meta_data.encodings[0];
+  };
+  EXPECT_EQ(data_encoding(0), Encoding::DELTA_BINARY_PACKED);
+  EXPECT_EQ(data_encoding(1), Encoding::PLAIN);
+  EXPECT_EQ(data_encoding(2), Encoding::DELTA_LENGTH_BYTE_ARRAY);
+  EXPECT_EQ(data_encoding(3), Encoding::PLAIN);
+
+  cudf::io::parquet_reader_options in_opts =
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+  auto result = cudf::io::read_parquet(in_opts);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
 TEST_F(ParquetWriterTest, Decimal128DeltaByteArray)
 {
   // decimal128 in cuDF maps to FIXED_LEN_BYTE_ARRAY, which is allowed by the spec to use
@@ -1783,6 +1913,46 @@ TEST_F(ParquetWriterTest, DeltaBinaryStartsWithNulls)
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
 }
 
+TEST_F(ParquetWriterTest, DeltaEncodeBlockBoundaries)
+{
+  // the delta encoders write several DELTA_BINARY_PACKED blocks at once, so check page sizes
+  // that end just before, on, and just after those batches
+  for (int const num_rows : {1, 127, 129, 511, 512, 513, 1025, 2049}) {
+    auto const int_data = random_values<int64_t>(num_rows);
+    auto const int_col  = cudf::test::fixed_width_column_wrapper<int64_t>(
+      int_data.begin(), int_data.end(), cudf::test::iterators::nulls_at({0, num_rows / 2}));
+
+    auto const strings = cudf::detail::make_counting_transform_iterator(
+      0, [](auto i) { return "prefix_" + std::to_string(i / 3) + std::string(i % 7, 'x'); });
+    auto const str_col = cudf::test::strings_column_wrapper(
+      strings, strings + num_rows, cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+        return i % 5 != 1;
+      }));
+
+    auto const expected = table_view({int_col, str_col, str_col});
+
+    cudf::io::table_input_metadata table_metadata(expected);
+    table_metadata.column_metadata[0].set_encoding(
+      cudf::io::column_encoding::DELTA_BINARY_PACKED);
+    table_metadata.column_metadata[1].set_encoding(
+      cudf::io::column_encoding::DELTA_LENGTH_BYTE_ARRAY);
+    table_metadata.column_metadata[2].set_encoding(cudf::io::column_encoding::DELTA_BYTE_ARRAY);
+
+    auto const filepath = temp_env->get_temp_filepath("DeltaEncodeBlockBoundaries.parquet");
+    cudf::io::parquet_writer_options out_opts =
+      cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+        .metadata(table_metadata)
+        .write_v2_headers(true)
+        .dictionary_policy(cudf::io::dictionary_policy::NEVER);
+    cudf::io::write_parquet(out_opts);
+
+    cudf::io::parquet_reader_options in_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath});
+    auto result = cudf::io::read_parquet(in_opts);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+  }
+}
+
 TEST_F(ParquetWriterTest, ByteStreamSplit)
 {
   constexpr auto num_rows = 100;
@@ -2301,3 +2471,94 @@ TEST_F(ParquetWriterStressTest, DeviceWriteLargeTableWithValids)
   auto custom_tbl = cudf::io::read_parquet(custom_args);
   CUDF_TEST_EXPECT_TABLES_EQUAL(custom_tbl.tbl->view(), expected->view());
 }
+
+TEST_F(ParquetWriterTest, BloomFilter)
+{
+  using namespace cudf::io::parquet::detail;
+  constexpr cudf::size_type num_rows = 40'000;
+  constexpr cudf::size_type rg_rows  = 10'000;
+
+  // only even values, so odd values within the min/max range can only be ruled out by the filter
+  auto ints = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 2 * i; });
+  auto strs = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return "s" + std::to_string(2 * i); });
+  cudf::test::fixed_width_column_wrapper<int32_t> col0(ints, ints + num_rows);
+  cudf::test::strings_column_wrapper col1(strs, strs + num_rows);
+  auto expected = table_view{{col0, col1}};
+
+  cudf::io::table_input_metadata expected_metadata(expected);
+  expected_metadata.column_metadata[0].set_name("ints").set_bloom_filter(true);
+  expected_metadata.column_metadata[1].set_name("strs").set_bloom_filter(true);
+
+  auto filepath = temp_env->get_temp_filepath("BloomFilter.parquet");
+  cudf::io::parquet_writer_options out_opts =
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{filepath}, expected)
+      .metadata(expected_metadata)
+      .row_group_size_rows(rg_rows)
+      .max_page_size_rows(rg_rows);
+  cudf::io::write_parquet(out_opts);
+
+  auto const source = cudf::io::datasource::create(filepath);
+  FileMetaData fmd;
+  read_footer(source, &fmd);
+  ASSERT_EQ(fmd.row_groups.size(), num_rows / rg_rows);
+
+  auto const int_hash = [](int32_t v) {
+    return bloom_filter_hash(reinterpret_cast<uint8_t const*>(&v), sizeof(v));
+  };
+  auto const str_hash = [](std::string const& v) {
+    return bloom_filter_hash(reinterpret_cast<uint8_t const*>(v.data()), v.size());
+  };
+
+  for (cudf::size_type r = 0; r < static_cast<cudf::size_type>(fmd.row_groups.size()); ++r) {
+    std::vector<std::vector<uint8_t>> bitsets;
+    for (auto const& chunk : fmd.row_groups[r].columns) {
+      auto const& meta = chunk.meta_data;
+      ASSERT_TRUE(meta.bloom_filter_offset.has_value());
+      ASSERT_TRUE(meta.bloom_filter_length.has_value());
+      auto const buf = source->host_read(meta.bloom_filter_offset.value(),
+                                         meta.bloom_filter_length.value());
+      CompactProtocolReader cp(buf->data(), buf->size());
+      BloomFilterHeader header;
+      cp.read(&header);
+      EXPECT_EQ(header.algorithm.algorithm, BloomFilterAlgorithm::SPLIT_BLOCK);
+      EXPECT_EQ(header.hash.hash, BloomFilterHash::XXHASH);
+      EXPECT_EQ(header.compression.compression, BloomFilterCompression::UNCOMPRESSED);
+      ASSERT_EQ(cp.bytecount() + header.num_bytes, meta.bloom_filter_length.value());
+      bitsets.emplace_back(buf->data() + cp.bytecount(), buf->data() + buf->size());
+    }
+
+    // every written value must be found, and few of the missing ones
+    int false_positives = 0;
+    for (cudf::size_type i = r * rg_rows; i < (r + 1) * rg_rows; ++i) {
+      EXPECT_TRUE(bloom_filter_contains(bitsets[0].data(), bitsets[0].size(), int_hash(2 * i)));
+      EXPECT_TRUE(bloom_filter_contains(
+        bitsets[1].data(), bitsets[1].size(), str_hash("s" + std::to_string(2 * i))));
+      false_positives +=
+        bloom_filter_contains(bitsets[0].data(), bitsets[0].size(), int_hash(2 * i + 1));
+    }
+    EXPECT_LT(false_positives, rg_rows / 20);
+  }
+
+  // an odd literal is within the min/max range of a row group, but not in its filter
+  auto const read_with_filter = [&](cudf::ast::expression const& filter) {
+    cudf::io::parquet_reader_options in_opts =
+      cudf::io::parquet_reader_options::builder(cudf::io::source_info{filepath}).filter(filter);
+    return cudf::io::read_parquet(in_opts);
+  };
+  auto const col_ref = cudf::ast::column_name_reference("ints");
+
+  auto present         = cudf::numeric_scalar<int32_t>(2 * 12'345);
+  auto present_literal = cudf::ast::literal(present);
+  auto const present_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, present_literal);
+  auto const result = read_with_filter(present_filter);
+  ASSERT_EQ(result.tbl->num_rows(), 1);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::slice(expected, {12'345, 12'346})[0], result.tbl->view());
+
+  auto absent         = cudf::numeric_scalar<int32_t>(2 * 12'345 + 1);
+  auto absent_literal = cudf::ast::literal(absent);
+  auto const absent_filter =
+    cudf::ast::operation(cudf::ast::ast_operator::EQUAL, col_ref, absent_literal);
+  EXPECT_EQ(read_with_filter(absent_filter).tbl->num_rows(), 0);
+}
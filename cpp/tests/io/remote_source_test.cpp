@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/io/datasource.hpp>
+#include <cudf/io/parquet.hpp>
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cstring>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+/**
+ * @brief Minimal HTTP server on localhost that serves one object and honors range requests
+ */
+class range_server {
+ public:
+  explicit range_server(std::vector<char> object) : _object{std::move(object)}
+  {
+    _listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+    sockaddr_in address{};
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    address.sin_port        = 0;
+    EXPECT_EQ(bind(_listen_fd, reinterpret_cast<sockaddr*>(&address), sizeof(address)), 0);
+    EXPECT_EQ(listen(_listen_fd, 64), 0);
+    socklen_t length = sizeof(address);
+    getsockname(_listen_fd, reinterpret_cast<sockaddr*>(&address), &length);
+    _port = ntohs(address.sin_port);
+
+    _acceptor = std::thread([this] {
+      while (true) {
+        auto const fd = accept(_listen_fd, nullptr, nullptr);
+        if (fd == -1) { return; }
+        _handlers.emplace_back([this, fd] { serve(fd); });
+      }
+    });
+  }
+
+  ~range_server()
+  {
+    shutdown(_listen_fd, SHUT_RDWR);
+    close(_listen_fd);
+    _acceptor.join();
+    for (auto& handler : _handlers) {
+      handler.join();
+    }
+  }
+
+  [[nodiscard]] std::string url() const
+  {
+    return "http://127.0.0.1:" + std::to_string(_port) + "/object";
+  }
+
+  [[nodiscard]] int num_range_requests() const { return _range_requests; }
+
+ private:
+  void serve(int fd)
+  {
+    std::string request;
+    char chunk[4096];
+    while (request.find("\r\n\r\n") == std::string::npos) {
+      auto const received = recv(fd, chunk, sizeof(chunk), 0);
+      if (received <= 0) { break; }
+      request.append(chunk, received);
+    }
+
+    std::size_t begin = 0;
+    std::size_t end   = _object.size();
+    std::string head;
+    if (auto const range = request.find("Range: bytes="); range != std::string::npos) {
+      ++_range_requests;
+      auto const dash = request.find('-', range);
+      begin           = std::stoull(request.substr(range + 13, dash - range - 13));
+      end             = std::min(end, std::stoull(request.substr(dash + 1)) + 1);
+
+      head = "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " + std::to_string(begin) +
+             "-" + std::to_string(end - 1) + "/" + std::to_string(_object.size()) + "\r\n";
+    } else {
+      head = "HTTP/1.1 200 OK\r\n";
+    }
+    head += "Content-Length: " + std::to_string(end - begin) + "\r\n\r\n";
+    send(fd, head.data(), head.size(), MSG_NOSIGNAL);
+    if (request.rfind("GET", 0) == 0) {
+      send(fd, _object.data() + begin, end - begin, MSG_NOSIGNAL);
+    }
+    close(fd);
+  }
+
+  std::vector<char> _object;
+  int _listen_fd{-1};
+  int _port{0};
+  std::atomic<int> _range_requests{0};
+  std::thread _acceptor;
+  std::vector<std::thread> _handlers;
+};
+
+}  // namespace
+
+struct RemoteSourceTest : public cudf::test::BaseFixture {};
+
+TEST_F(RemoteSourceTest, RangedReads)
+{
+  std::vector<char> object(20 * 1024 * 1024);
+  std::iota(object.begin(), object.end(), 0);
+  range_server server(object);
+
+  auto const source = cudf::io::datasource::create(server.url());
+  ASSERT_EQ(source->size(), object.size());
+
+  // large reads are split into parallel range requests
+  std::vector<uint8_t> data(object.size());
+  EXPECT_EQ(source->host_read(0, data.size(), data.data()), data.size());
+  EXPECT_EQ(std::memcmp(data.data(), object.data(), object.size()), 0);
+  EXPECT_GT(server.num_range_requests(), 1);
+
+  // sequential reads are served from the readahead
+  auto const first  = source->host_read(1000, 100);
+  auto const second = source->host_read(1100, 5000);
+  auto const third  = source->host_read(6100, 100);
+  EXPECT_EQ(std::memcmp(first->data(), object.data() + 1000, 100), 0);
+  EXPECT_EQ(std::memcmp(second->data(), object.data() + 1100, 5000), 0);
+  EXPECT_EQ(std::memcmp(third->data(), object.data() + 6100, 100), 0);
+
+  // reads past the end are truncated
+  auto const tail = source->host_read(object.size() - 10, 100);
+  ASSERT_EQ(tail->size(), 10);
+  EXPECT_EQ(std::memcmp(tail->data(), object.data() + object.size() - 10, 10), 0);
+}
+
+TEST_F(RemoteSourceTest, ParquetFromURL)
+{
+  auto const sequence = thrust::make_counting_iterator(0);
+  cudf::test::fixed_width_column_wrapper<int32_t> ints(
+    sequence, sequence + 10000, cudf::test::iterators::null_at(5));
+  cudf::test::fixed_width_column_wrapper<int64_t> longs(sequence, sequence + 10000);
+  cudf::table_view const expected{{ints, longs}};
+
+  std::vector<char> buffer;
+  cudf::io::write_parquet(
+    cudf::io::parquet_writer_options::builder(cudf::io::sink_info{&buffer}, expected)
+      .row_group_size_rows(1000)
+      .build());
+  range_server server(buffer);
+
+  auto const result = cudf::io::read_parquet(
+    cudf::io::parquet_reader_options::builder(cudf::io::source_info{server.url()}).build());
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, result.tbl->view());
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -23,6 +23,7 @@
 
 #include <rmm/cuda_stream_view.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <random>
 
@@ -387,4 +388,79 @@ TEST_F(DataChunkSourceTest, BgzipSourceVirtualOffsetsSingleCompressedGZipBlock)
   test_source(input, *source);
 }
 
+TEST_F(DataChunkSourceTest, GzipSource)
+{
+  auto const filename = temp_env->get_temp_filepath("gzip_source");
+  std::string input{"bananarama"};
+  input.reserve(input.size() << 22);
+  for (int i = 0; i < 21; i++) {
+    input = input + input;
+  }
+  {
+    // BGZIP files are GZIP files with multiple members
+    std::ofstream output_stream{filename};
+    std::default_random_engine rng{};
+    write_bgzip(output_stream, input, rng, compression::ENABLED, eof::ADD_EOF_BLOCK);
+  }
+
+  auto const source =
+    cudf::io::text::make_source_from_compressed_file(filename, cudf::io::compression_type::GZIP);
+
+  test_source(input, *source);
+}
+
+void write_zstd_frame(std::ostream& output_stream, std::string const& data)
+{
+  auto const write_le = [&](uint32_t value, int size) {
+    for (int i = 0; i < size; i++) {
+      output_stream.put(static_cast<char>((value >> (8 * i)) & 0xFF));
+    }
+  };
+  write_le(0xFD2FB528u, 4);  // magic number
+  write_le(0x00, 1);         // frame header descriptor: no content size, dictionary or checksum
+  write_le(0x50, 1);         // window descriptor: 1MB window
+  // alternate between raw blocks and RLE blocks of the same data
+  std::size_t constexpr max_block_size = 1000;
+  for (std::size_t pos = 0; pos < data.size(); pos += max_block_size) {
+    auto const size    = std::min(max_block_size, data.size() - pos);
+    auto const is_last = pos + size == data.size();
+    auto const is_rle  = std::all_of(
+      data.begin() + pos, data.begin() + pos + size, [&](char c) { return c == data[pos]; });
+    // block header: block size, block type and last block flag
+    auto const header = (size << 3) | ((is_rle ? 1 : 0) << 1) | (is_last ? 1 : 0);
+    write_le(static_cast<uint32_t>(header), 3);
+    output_stream.write(data.data() + pos, is_rle ? 1 : size);
+  }
+}
+
+TEST_F(DataChunkSourceTest, ZstdSource)
+{
+  auto const filename = temp_env->get_temp_filepath("zstd_source");
+  std::string const frame1(2500, 'z');
+  std::string const frame2{"collection unit brings"};
+  std::string const frame3 = frame2 + std::string(1500, 'a') + frame2;
+  {
+    std::ofstream output_stream{filename};
+    write_zstd_frame(output_stream, frame1);
+    // skippable frame
+    output_stream.write("\x50\x2A\x4D\x18\x03\x00\x00\x00"
+                        "abc",
+                        11);
+    write_zstd_frame(output_stream, frame2);
+    write_zstd_frame(output_stream, frame3);
+  }
+
+  auto const source =
+    cudf::io::text::make_source_from_compressed_file(filename, cudf::io::compression_type::ZSTD);
+
+  test_source(frame1 + frame2 + frame3, *source);
+}
+
+TEST_F(DataChunkSourceTest, CompressedSourceInvalidCompression)
+{
+  EXPECT_THROW(cudf::io::text::make_source_from_compressed_file(
+                 "unused", cudf::io::compression_type::SNAPPY),
+               std::invalid_argument);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/io/text/finite_state_transducer.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/device_uvector.hpp>
+
+#include <string>
+
+using cudf::test::strings_column_wrapper;
+
+namespace {
+
+// Marks the start of the keys ('k') and of the values ('v') of space-separated key=value pairs
+cudf::io::text::finite_state_transducer key_value_fst()
+{
+  return cudf::io::text::finite_state_transducer{{"=", " "},
+                                                 {{2, 0, 1}, {2, 0, 1}, {2, 0, 2}},
+                                                 {{"v", "", "k"}, {"v", "", ""}, {"", "", ""}}};
+}
+
+}  // namespace
+
+struct FiniteStateTransducerTest : public cudf::test::BaseFixture {};
+
+TEST_F(FiniteStateTransducerTest, DeviceBuffer)
+{
+  auto const host_input = std::string("a=1 bc=22  d=4");
+  auto const stream     = cudf::get_default_stream();
+  rmm::device_uvector<char> input(host_input.size(), stream);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    input.data(), host_input.data(), host_input.size(), cudaMemcpyDefault, stream.value()));
+
+  auto const result = cudf::io::text::transduce(input, key_value_fst());
+
+  auto const expected_symbols =
+    cudf::test::fixed_width_column_wrapper<int8_t>{'k', 'v', 'k', 'v', 'k', 'v'};
+  auto const expected_indices =
+    cudf::test::fixed_width_column_wrapper<int64_t>{0, 1, 4, 6, 11, 12};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.symbols, expected_symbols);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result.indices, expected_indices);
+}
+
+TEST_F(FiniteStateTransducerTest, StringsColumn)
+{
+  // A row ending in a value must not carry the state over to the next row
+  auto const input = strings_column_wrapper{{"a=1 bc=22", "x=y", "", "z", "=w", "dropped"},
+                                            {true, true, true, true, true, false}};
+  auto const expected =
+    strings_column_wrapper{{"kvkv", "kv", "", "k", "v", ""}, {true, true, true, true, true, false}};
+
+  auto const result = cudf::io::text::transduce(cudf::strings_column_view{input}, key_value_fst());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+
+  auto const sliced        = cudf::slice(input, {1, 4})[0];
+  auto const sliced_result =
+    cudf::io::text::transduce(cudf::strings_column_view{sliced}, key_value_fst());
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*sliced_result, cudf::slice(expected, {1, 4})[0]);
+}
+
+TEST_F(FiniteStateTransducerTest, MultiByteOutput)
+{
+  // Escapes the double quotes and the backslashes
+  auto const fst = cudf::io::text::finite_state_transducer{{"\"", "\\", "a"},
+                                                           {{0, 0, 0, 0}},
+                                                           {{"\\\"", "\\\\", "a", ""}}};
+
+  auto const input    = strings_column_wrapper{"a\"a", "\\", "bcd", "\"\""};
+  auto const expected = strings_column_wrapper{"a\\\"a", "\\\\", "", "\\\"\\\""};
+
+  auto const result = cudf::io::text::transduce(cudf::strings_column_view{input}, fst);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
+}
+
+TEST_F(FiniteStateTransducerTest, InvalidDefinition)
+{
+  using cudf::io::text::finite_state_transducer;
+
+  // Missing the entry of the other symbols
+  EXPECT_THROW(finite_state_transducer({"a"}, {{0}}, {{""}}), cudf::logic_error);
+  // Transition to a state that does not exist
+  EXPECT_THROW(finite_state_transducer({"a"}, {{0, 1}}, {{"", ""}}), cudf::logic_error);
+  // Symbol in two symbol groups
+  EXPECT_THROW(finite_state_transducer({"ab", "b"}, {{0, 0, 0}}, {{"", "", ""}}),
+               cudf::logic_error);
+  // Invalid start state
+  EXPECT_THROW(finite_state_transducer({}, {{0}}, {{""}}, 1), cudf::logic_error);
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -220,6 +220,75 @@ TEST_F(MultibyteSplitTest, DelimiterErasureOverlap)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
 }
 
+TEST_F(MultibyteSplitTest, MultipleDelimiters)
+{
+  auto delimiters = std::vector<std::string>{"\r\n", "\n", "::"};
+
+  auto host_input = std::string("line\r\nanother line\nthird::line\r\n\nlast");
+  auto expected =
+    strings_column_wrapper{"line\r\n", "another line\n", "third::", "line\r\n", "\n", "last"};
+
+  auto source = cudf::io::text::make_source(host_input);
+  auto out    = cudf::io::text::multibyte_split(*source, delimiters);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersErasure)
+{
+  auto delimiters = std::vector<std::string>{"\r\n", "\n", "::"};
+
+  auto host_input = std::string("line\r\nanother line\nthird::line\r\n\nlast");
+  auto expected   = strings_column_wrapper{"line", "another line", "third", "line", "", "last"};
+
+  cudf::io::text::parse_options options;
+  options.strip_delimiters = true;
+  auto source              = cudf::io::text::make_source(host_input);
+  auto out                 = cudf::io::text::multibyte_split(*source, delimiters, options);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out);
+}
+
+TEST_F(MultibyteSplitTest, LargeInputMultipleDelimitersMultipleRange)
+{
+  auto host_input    = std::string();
+  auto host_expected = std::vector<std::string>();
+  for (auto i = 0; i < 100000; i++) {
+    host_expected.push_back(std::to_string(i) + (i % 3 == 0 ? "\r\n" : "\n"));
+    host_input += host_expected.back();
+  }
+
+  auto delimiters = std::vector<std::string>{"\r\n", "\n"};
+  auto source     = cudf::io::text::make_source(host_input);
+
+  auto byte_ranges = cudf::io::text::create_byte_range_infos_consecutive(host_input.size(), 3);
+  auto out0        = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[0]});
+  auto out1        = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[1]});
+  auto out2        = cudf::io::text::multibyte_split(*source, delimiters, {byte_ranges[2]});
+
+  auto out_views = std::vector<cudf::column_view>({out0->view(), out1->view(), out2->view()});
+  auto out       = cudf::concatenate(out_views);
+
+  auto expected = strings_column_wrapper(host_expected.begin(), host_expected.end());
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *out, cudf::test::debug_output_level::ALL_ERRORS);
+}
+
+TEST_F(MultibyteSplitTest, MultipleDelimitersInvalid)
+{
+  auto host_input = std::string("abc");
+  auto source     = cudf::io::text::make_source(host_input);
+
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{}),
+               cudf::logic_error);
+  EXPECT_THROW(cudf::io::text::multibyte_split(*source, std::vector<std::string>{"a", ""}),
+               cudf::logic_error);
+  // more tokens than the multistate can represent
+  EXPECT_THROW(cudf::io::text::multibyte_split(
+                 *source, std::vector<std::string>{"abcdefgh", "ijklmnop", "qrstuvwx"}),
+               cudf::logic_error);
+}
+
 TEST_F(MultibyteSplitTest, HandpickedInput)
 {
   auto delimiters = "::|";
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+#include <cudf_test/testing_main.hpp>
+
+#include <rmm/device_buffer.hpp>
+
+#include <src/io/utilities/uring_source.hpp>
+
+#include <cuda_runtime.h>
+
+#include <fstream>
+#include <numeric>
+#include <vector>
+
+auto const temp_env = static_cast<cudf::test::TempDirTestEnvironment*>(
+  ::testing::AddGlobalTestEnvironment(new cudf::test::TempDirTestEnvironment));
+
+struct UringSourceTest : public cudf::test::BaseFixture {};
+
+TEST_F(UringSourceTest, HostAndDeviceReads)
+{
+  // spans several staging buffers and ends off the direct IO alignment
+  std::vector<uint32_t> data((5 << 20) / sizeof(uint32_t) + 7);
+  std::iota(data.begin(), data.end(), 0);
+  auto const filepath = temp_env->get_temp_filepath("UringSourceTest.bin");
+  std::ofstream(filepath, std::ios::binary)
+    .write(reinterpret_cast<char const*>(data.data()), data.size() * sizeof(uint32_t));
+  auto const bytes = reinterpret_cast<uint8_t const*>(data.data());
+  auto const size  = data.size() * sizeof(uint32_t);
+
+  auto const source = cudf::io::detail::make_uring_source(filepath);
+  if (source == nullptr) { GTEST_SKIP() << "io_uring is not available"; }
+  ASSERT_EQ(source->size(), size);
+
+  auto const head = source->host_read(3, 1000);
+  ASSERT_EQ(head->size(), 1000);
+  EXPECT_TRUE(std::equal(head->data(), head->data() + 1000, bytes + 3));
+
+  // reads are clamped to the end of the file
+  std::vector<uint8_t> tail(4096);
+  EXPECT_EQ(source->host_read(size - 100, tail.size(), tail.data()), 100);
+  EXPECT_TRUE(std::equal(tail.begin(), tail.begin() + 100, bytes + size - 100));
+
+  auto const stream = cudf::test::get_default_stream();
+  auto const offset = size_t{12345};
+  auto const length = size - 2 * offset;
+  rmm::device_buffer d_data(length, stream);
+  EXPECT_EQ(
+    source->device_read_async(offset, length, static_cast<uint8_t*>(d_data.data()), stream).get(),
+    length);
+  std::vector<uint8_t> result(length);
+  CUDF_CUDA_TRY(cudaMemcpyAsync(
+    result.data(), d_data.data(), length, cudaMemcpyDefault, stream.value()));
+  stream.synchronize();
+  EXPECT_TRUE(std::equal(result.begin(), result.end(), bytes + offset));
+}
+
+CUDF_TEST_PROGRAM_MAIN()
@@ -454,6 +454,22 @@ TYPED_TEST(ConditionalInnerJoinTest, TestGreaterComparison)
   this->test({{0, 1, 2}}, {{1, 0, 0}}, expression, {{1, 1}, {1, 2}, {2, 0}, {2, 1}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestOutputLargerThanInputs)
+{
+  auto col_ref_0  = cudf::ast::column_reference(0);
+  auto col_ref_1  = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, col_ref_1);
+
+  // Every pair matches, so the output outgrows its initial capacity of one pair per row
+  std::vector<std::pair<cudf::size_type, cudf::size_type>> expected_outputs;
+  for (cudf::size_type i = 0; i < 4; ++i) {
+    for (cudf::size_type j = 0; j < 5; ++j) {
+      expected_outputs.emplace_back(i, j);
+    }
+  }
+  this->test({{0, 0, 0, 0}}, {{1, 2, 3, 4, 5}}, expression, expected_outputs);
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestGreaterTwoColumnComparison)
 {
   auto col_ref_0  = cudf::ast::column_reference(0);
@@ -522,6 +538,56 @@ TYPED_TEST(ConditionalInnerJoinTest, TestSymmetry)
     {{0, 1, 2}}, {{1, 2, 3}}, expression_reverse, {{0, 0}, {0, 1}, {0, 2}, {1, 1}, {1, 2}, {2, 2}});
 };
 
+TYPED_TEST(ConditionalInnerJoinTest, TestBandComparison)
+{
+  auto col_ref_0       = cudf::ast::column_reference(0);
+  auto right_col_ref_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto right_col_ref_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, right_col_ref_0);
+  auto upper      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, right_col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower, upper);
+
+  this->test({{1, 5, 3, 8, 3}},
+             {{0, 3, 6}, {4, 6, 9}},
+             expression,
+             {{0, 0}, {1, 1}, {2, 0}, {2, 1}, {3, 2}, {4, 0}, {4, 1}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestBandComparisonRightKey)
+{
+  auto col_ref_0       = cudf::ast::column_reference(0);
+  auto col_ref_1       = cudf::ast::column_reference(1);
+  auto right_col_ref_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto lower =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, right_col_ref_0, col_ref_0);
+  auto upper =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS_EQUAL, right_col_ref_0, col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower, upper);
+
+  this->test({{0, 4, 7}, {3, 6, 7}},
+             {{2, 5, 7, 3, 0}},
+             expression,
+             {{0, 0}, {0, 3}, {0, 4}, {1, 1}, {2, 2}});
+};
+
+TYPED_TEST(ConditionalInnerJoinTest, TestBandComparisonNulls)
+{
+  auto col_ref_0       = cudf::ast::column_reference(0);
+  auto right_col_ref_0 = cudf::ast::column_reference(0, cudf::ast::table_reference::RIGHT);
+  auto right_col_ref_1 = cudf::ast::column_reference(1, cudf::ast::table_reference::RIGHT);
+  auto lower =
+    cudf::ast::operation(cudf::ast::ast_operator::GREATER_EQUAL, col_ref_0, right_col_ref_0);
+  auto upper      = cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_0, right_col_ref_1);
+  auto expression = cudf::ast::operation(cudf::ast::ast_operator::LOGICAL_AND, lower, upper);
+
+  // Null keys and null bounds never match
+  this->test_nulls({{{1, 5, 3}, {1, 0, 1}}},
+                   {{{0, 3}, {1, 1}}, {{4, 6}, {1, 0}}},
+                   expression,
+                   {{0, 0}, {2, 0}});
+};
+
 TYPED_TEST(ConditionalInnerJoinTest, TestCompareRandomToHash)
 {
   auto [left, right] = gen_random_repeated_columns<TypeParam>();
@@ -28,6 +28,7 @@
 #include <cudf/copying.hpp>
 #include <cudf/detail/null_mask.hpp>
 #include <cudf/detail/structs/utilities.hpp>
+#include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/join.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
@@ -40,7 +41,11 @@
 
 #include <rmm/resource_ref.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
@@ -1581,6 +1586,202 @@ TEST_F(JoinTest, HashJoinWithNullsOneSide)
   }
 }
 
+TEST_F(JoinTest, HashJoinBatchedProbes)
+{
+  column_wrapper<int32_t> build_col{{1, 1, 1, 2, 3}};
+  column_wrapper<int32_t> probe_col{{1, 2, 1, 4, 3, 1}};
+  auto const build  = cudf::table_view{{build_col}};
+  auto const probe  = cudf::table_view{{probe_col}};
+  auto const stream = cudf::get_default_stream();
+
+  cudf::hash_join hash_join(build, cudf::nullable_join::NO, cudf::null_equality::EQUAL);
+
+  using index_pairs = std::vector<std::pair<cudf::size_type, cudf::size_type>>;
+  auto const append_pairs = [&](index_pairs& pairs, auto const& result) {
+    auto const left  = cudf::detail::make_std_vector_sync(*result.first, stream);
+    auto const right = cudf::detail::make_std_vector_sync(*result.second, stream);
+    for (std::size_t i = 0; i < left.size(); ++i) {
+      pairs.emplace_back(left[i], right[i]);
+    }
+  };
+
+  // The batches of each join together return the pairs of the join on the whole probe table
+  auto const check_batches = [&](auto const& join_batch, auto const& expected_result) {
+    std::size_t const max_output_size = 4;
+    index_pairs pairs;
+    cudf::size_type probe_row_offset = 0;
+    while (probe_row_offset < probe.num_rows()) {
+      auto const previous_offset = probe_row_offset;
+      auto const result          = join_batch(probe_row_offset, max_output_size);
+      EXPECT_GT(probe_row_offset, previous_offset);
+      EXPECT_LE(result.first->size(), max_output_size);
+      append_pairs(pairs, result);
+    }
+    index_pairs expected;
+    append_pairs(expected, expected_result);
+    std::sort(pairs.begin(), pairs.end());
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(pairs, expected);
+  };
+
+  check_batches(
+    [&](cudf::size_type& probe_row_offset, std::size_t max_output_size) {
+      return hash_join.inner_join_batch(probe, probe_row_offset, max_output_size);
+    },
+    hash_join.inner_join(probe));
+  check_batches(
+    [&](cudf::size_type& probe_row_offset, std::size_t max_output_size) {
+      return hash_join.left_join_batch(probe, probe_row_offset, max_output_size);
+    },
+    hash_join.left_join(probe));
+
+  cudf::size_type invalid_offset = probe.num_rows() + 1;
+  EXPECT_THROW(hash_join.inner_join_batch(probe, invalid_offset, 4), std::out_of_range);
+  cudf::size_type probe_row_offset = 0;
+  EXPECT_THROW(hash_join.inner_join_batch(probe, probe_row_offset, 0), std::invalid_argument);
+}
+
+TEST_F(JoinTest, PartitionedJoin)
+{
+  column_wrapper<int32_t> left_col0{{3, 1, 2, 0, 2, 5, 7, 1}, {1, 1, 1, 0, 1, 1, 1, 1}};
+  strcol_wrapper left_col1({"s1", "s1", "s0", "s4", "s0", "s9", "s2", "s1"});
+  column_wrapper<int32_t> right_col0{{1, 2, 2, 0, 3, 1}, {1, 1, 1, 0, 1, 1}};
+  strcol_wrapper right_col1({"s1", "s0", "s0", "s4", "s3", "s1"});
+  auto const left   = cudf::table_view{{left_col0, left_col1}};
+  auto const right  = cudf::table_view{{right_col0, right_col1}};
+  auto const stream = cudf::get_default_stream();
+
+  auto const sorted_pairs = [&](auto const& result) {
+    auto const left_indices  = cudf::detail::make_std_vector_sync(*result.first, stream);
+    auto const right_indices = cudf::detail::make_std_vector_sync(*result.second, stream);
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (std::size_t i = 0; i < left_indices.size(); ++i) {
+      pairs.emplace_back(left_indices[i], right_indices[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    for (cudf::size_type num_partitions : {1, 3, 16}) {
+      auto const inner_result =
+        cudf::partitioned_inner_join(left, right, num_partitions, compare_nulls);
+      EXPECT_EQ(sorted_pairs(inner_result),
+                sorted_pairs(cudf::inner_join(left, right, compare_nulls)));
+      auto const left_result =
+        cudf::partitioned_left_join(left, right, num_partitions, compare_nulls);
+      EXPECT_EQ(sorted_pairs(left_result),
+                sorted_pairs(cudf::left_join(left, right, compare_nulls)));
+    }
+  }
+
+  EXPECT_THROW(cudf::partitioned_inner_join(left, right, 0), std::invalid_argument);
+}
+
+TEST_F(JoinTest, SortMergeInnerJoin)
+{
+  column_wrapper<int32_t> left_col0{{0, 1, 1, 1, 2, 2, 4, 5}, {0, 1, 1, 1, 1, 1, 1, 1}};
+  strcol_wrapper left_col1({"s0", "s1", "s1", "s2", "s0", "s0", "s1", "s0"});
+  column_wrapper<int32_t> right_col0{{0, 1, 1, 2, 2, 2, 3, 5}, {0, 1, 1, 1, 1, 1, 1, 1}};
+  strcol_wrapper right_col1({"s0", "s1", "s1", "s0", "s0", "s1", "s0", "s0"});
+  auto const left   = cudf::table_view{{left_col0, left_col1}};
+  auto const right  = cudf::table_view{{right_col0, right_col1}};
+  auto const stream = cudf::get_default_stream();
+
+  auto const to_pairs = [&](auto const& result) {
+    auto const left_indices  = cudf::detail::make_std_vector_sync(*result.first, stream);
+    auto const right_indices = cudf::detail::make_std_vector_sync(*result.second, stream);
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (std::size_t i = 0; i < left_indices.size(); ++i) {
+      pairs.emplace_back(left_indices[i], right_indices[i]);
+    }
+    return pairs;
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    // The pairs are ordered by left row and then by right row
+    auto const result =
+      to_pairs(cudf::sort_merge_inner_join(left, right, {}, {}, compare_nulls, true));
+    EXPECT_TRUE(std::is_sorted(result.begin(), result.end()));
+    auto expected = to_pairs(cudf::inner_join(left, right, compare_nulls));
+    std::sort(expected.begin(), expected.end());
+    EXPECT_EQ(result, expected);
+  }
+
+  column_wrapper<int32_t> unsorted_col0{2, 1, 3};
+  strcol_wrapper unsorted_col1({"s0", "s0", "s0"});
+  auto const unsorted = cudf::table_view{{unsorted_col0, unsorted_col1}};
+  EXPECT_THROW(
+    cudf::sort_merge_inner_join(left, unsorted, {}, {}, cudf::null_equality::EQUAL, true),
+    std::invalid_argument);
+}
+
+TEST_F(JoinTest, SkewedInnerJoin)
+{
+  column_wrapper<int32_t> left_col0{{2, 1, 0, 2, 3, 1, 5}, {1, 1, 0, 1, 1, 1, 1}};
+  strcol_wrapper left_col1({"s0", "s1", "s0", "s0", "s1", "s0", "s0"});
+  column_wrapper<int32_t> right_col0{{2, 0, 2, 1, 2, 0, 3, 2, 0}, {1, 0, 1, 1, 1, 0, 1, 1, 0}};
+  strcol_wrapper right_col1({"s0", "s0", "s0", "s1", "s0", "s0", "s1", "s0", "s0"});
+  auto const left   = cudf::table_view{{left_col0, left_col1}};
+  auto const right  = cudf::table_view{{right_col0, right_col1}};
+  auto const stream = cudf::get_default_stream();
+
+  auto const to_sorted_pairs = [&](auto const& result) {
+    auto const left_indices  = cudf::detail::make_std_vector_sync(*result.first, stream);
+    auto const right_indices = cudf::detail::make_std_vector_sync(*result.second, stream);
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (std::size_t i = 0; i < left_indices.size(); ++i) {
+      pairs.emplace_back(left_indices[i], right_indices[i]);
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  // The keys (2, "s0") and (null, "s0") are heavy hitters with a threshold of 3
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    auto const expected = to_sorted_pairs(cudf::inner_join(left, right, compare_nulls));
+    for (auto const threshold : {1, 3, 100}) {
+      EXPECT_EQ(to_sorted_pairs(cudf::skewed_inner_join(left, right, compare_nulls, threshold)),
+                expected);
+    }
+  }
+
+  EXPECT_THROW(std::ignore = cudf::skewed_inner_join(left, right, cudf::null_equality::EQUAL, 0),
+               std::invalid_argument);
+}
+
+TEST_F(JoinTest, BloomFilter)
+{
+  column_wrapper<int32_t> build_col0{{3, 1, 2, 0, 2}, {1, 1, 1, 0, 1}};
+  strcol_wrapper build_col1({"s1", "s1", "s0", "s4", "s0"});
+  column_wrapper<int32_t> probe_col0{{1, 2, 0, 3, 2}, {1, 1, 0, 1, 1}};
+  strcol_wrapper probe_col1({"s1", "s0", "s4", "s1", "s0"});
+  auto const build = cudf::table_view{{build_col0, build_col1}};
+  auto const probe = cudf::table_view{{probe_col0, probe_col1}};
+
+  // All rows of the probe table match, so none of them may be filtered out
+  cudf::hash_join hash_join(build, cudf::nullable_join::YES, cudf::null_equality::EQUAL);
+  auto const filter = hash_join.make_bloom_filter();
+  EXPECT_GT(filter.size_bytes(), std::size_t{0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*filter.contains(probe),
+                                 column_wrapper<bool>{true, true, true, true, true});
+
+  // Rows with null keys never match when nulls are unequal
+  cudf::bloom_filter const unequal_filter(build, cudf::null_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*unequal_filter.contains(probe),
+                                 column_wrapper<bool>{true, true, false, true, true});
+
+  // An empty filter contains no rows
+  column_wrapper<int32_t> empty_col0{};
+  strcol_wrapper empty_col1{};
+  cudf::bloom_filter const empty_filter(cudf::table_view{{empty_col0, empty_col1}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*empty_filter.contains(probe),
+                                 column_wrapper<bool>{false, false, false, false, false});
+
+  EXPECT_THROW(cudf::bloom_filter(build, cudf::null_equality::EQUAL, 0), std::invalid_argument);
+  EXPECT_THROW(std::ignore = filter.contains(cudf::table_view{{probe_col0}}), cudf::logic_error);
+}
+
 TEST_F(JoinTest, HashJoinLargeOutputSize)
 {
   // self-join a table of zeroes to generate an output row count that would overflow int32_t
@@ -1746,6 +1947,34 @@ TEST_F(JoinDictionaryTest, InnerJoinWithNulls)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
 }
 
+TEST_F(JoinDictionaryTest, InnerJoinSharedKeys)
+{
+  // Both sides are sliced from the same dictionary, so they are joined by their indices.
+  strcol_wrapper col_w({"s1", "s0", "s2", "s1", "s0", "s1", "s3", "s2"}, {1, 1, 1, 1, 0, 1, 1, 1});
+  auto col   = cudf::dictionary::encode(col_w);
+  auto dicts = cudf::slice(col->view(), {0, 4, 4, 8});
+  auto words = cudf::slice(col_w, {0, 4, 4, 8});
+
+  auto t0 = cudf::table_view({dicts[0]});
+  auto t1 = cudf::table_view({dicts[1]});
+
+  auto result            = inner_join(t0, t1, {0}, {0});
+  auto result_view       = result->view();
+  auto decoded0          = cudf::dictionary::decode(result_view.column(0));
+  auto decoded1          = cudf::dictionary::decode(result_view.column(1));
+  auto result_decoded    = cudf::table_view({decoded0->view(), decoded1->view()});
+  auto result_sort_order = cudf::sorted_order(result_decoded);
+  auto sorted_result     = cudf::gather(result_decoded, *result_sort_order);
+
+  auto g0              = cudf::table_view({words[0]});
+  auto g1              = cudf::table_view({words[1]});
+  auto gold            = inner_join(g0, g1, {0}, {0});
+  auto gold_sort_order = cudf::sorted_order(gold->view());
+  auto sorted_gold     = cudf::gather(gold->view(), *gold_sort_order);
+
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(*sorted_gold, *sorted_result);
+}
+
 TEST_F(JoinDictionaryTest, FullJoinNoNulls)
 {
   column_wrapper<int32_t> col0_0{{3, 1, 2, 0, 3}};
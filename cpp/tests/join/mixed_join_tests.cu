@@ -20,6 +20,7 @@
 
 #include <cudf/ast/expressions.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/join.hpp>
 #include <cudf/table/table_view.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -544,6 +545,52 @@ TYPED_TEST(MixedLeftJoinTest, Basic2)
              {{0, JoinNoneValue}, {1, JoinNoneValue}, {2, JoinNoneValue}, {3, 3}});
 }
 
+TYPED_TEST(MixedLeftJoinTest, ReusableBuild)
+{
+  auto const predicate =
+    cudf::ast::operation(cudf::ast::ast_operator::LESS, col_ref_left_0, col_ref_right_0);
+  auto [left_wrappers,
+        right_wrappers,
+        left_columns,
+        right_columns,
+        left_equality,
+        right_equality,
+        left_conditional,
+        right_conditional] =
+    this->parse_input(ColumnVector<TypeParam>{{0, 1, 2, 1, 3}, {3, 4, 5, 6, 8}},
+                      ColumnVector<TypeParam>{{0, 1, 3, 1, 3}, {5, 4, 5, 7, 9}},
+                      {0},
+                      {1});
+
+  auto const to_sorted_pairs = [](PairJoinReturn const& result) {
+    std::vector<std::pair<cudf::size_type, cudf::size_type>> pairs;
+    for (std::size_t i = 0; i < result.first->size(); ++i) {
+      pairs.emplace_back(result.first->element(i, cudf::get_default_stream()),
+                         result.second->element(i, cudf::get_default_stream()));
+    }
+    std::sort(pairs.begin(), pairs.end());
+    return pairs;
+  };
+
+  // The same build state is probed with several batches of the left tables
+  cudf::mixed_join const join(right_equality, right_conditional, left_conditional, predicate);
+  for (auto const& bounds : std::vector<std::vector<cudf::size_type>>{{0, 5}, {0, 2}, {2, 5}}) {
+    auto const probe_equality    = cudf::slice(left_equality, bounds).front();
+    auto const probe_conditional = cudf::slice(left_conditional, bounds).front();
+    EXPECT_EQ(to_sorted_pairs(join.inner_join(probe_equality, probe_conditional)),
+              to_sorted_pairs(cudf::mixed_inner_join(
+                probe_equality, right_equality, probe_conditional, right_conditional, predicate)));
+    EXPECT_EQ(to_sorted_pairs(join.left_join(probe_equality, probe_conditional)),
+              to_sorted_pairs(cudf::mixed_left_join(
+                probe_equality, right_equality, probe_conditional, right_conditional, predicate)));
+  }
+
+  // The probe conditional table must have the schema the expression was planned for
+  auto const wrong_schema = cudf::table_view{{right_wrappers[0], right_wrappers[0]}};
+  EXPECT_THROW(std::ignore = join.inner_join(left_equality, wrong_schema),
+               cudf::data_type_error);
+}
+
 /**
  * Tests of mixed full joins.
  */
@@ -33,6 +33,9 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <tuple>
+#include <vector>
+
 template <typename T>
 using column_wrapper = cudf::test::fixed_width_column_wrapper<T>;
 using strcol_wrapper = cudf::test::strings_column_wrapper;
@@ -311,3 +314,64 @@ TEST_F(JoinTest, AntiJoinWithStructsAndNullsOnOneSide)
   auto expected    = column_wrapper<cudf::size_type>{1};
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result_col);
 }
+
+TEST_F(JoinTest, FilteredJoinMultipleProbes)
+{
+  column_wrapper<int32_t> build_col0{{3, 1, 2, 0, 2, 1}, {1, 1, 1, 0, 1, 1}};
+  strcol_wrapper build_col1({"s1", "s1", "s0", "s4", "s0", "s1"});
+  auto const build = cudf::table_view{{build_col0, build_col1}};
+
+  column_wrapper<int32_t> probe0_col0{{1, 2, 0, 4, 3}, {1, 1, 0, 1, 1}};
+  strcol_wrapper probe0_col1({"s1", "s1", "s4", "s0", "s1"});
+  column_wrapper<int32_t> probe1_col0{{2, 5, 1}};
+  strcol_wrapper probe1_col1({"s0", "s0", "s1"});
+  auto const probes = std::vector<cudf::table_view>{cudf::table_view{{probe0_col0, probe0_col1}},
+                                                    cudf::table_view{{probe1_col0, probe1_col1}}};
+
+  auto const to_column = [](auto const& indices) {
+    return cudf::column_view{cudf::device_span<cudf::size_type const>{*indices}};
+  };
+
+  for (auto const compare_nulls : {cudf::null_equality::EQUAL, cudf::null_equality::UNEQUAL}) {
+    cudf::filtered_join const filtered_join(build, compare_nulls);
+    for (auto const& probe : probes) {
+      auto const expected_semi = cudf::left_semi_join(probe, build, compare_nulls);
+      auto const expected_anti = cudf::left_anti_join(probe, build, compare_nulls);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(to_column(expected_semi),
+                                     to_column(filtered_join.semi_join(probe)));
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(to_column(expected_anti),
+                                     to_column(filtered_join.anti_join(probe)));
+    }
+  }
+
+  column_wrapper<int32_t> mismatched_col{1, 2};
+  cudf::filtered_join const filtered_join(build);
+  EXPECT_THROW(std::ignore = filtered_join.semi_join(cudf::table_view{{mismatched_col}}),
+               cudf::logic_error);
+}
+
+TEST_F(JoinTest, FilteredJoinWithStructs)
+{
+  auto build_col0 = [] {
+    column_wrapper<int32_t> child1{1, 2, 3, 1};
+    column_wrapper<int32_t> child2{11, 12, 13, 11};
+    return cudf::test::structs_column_wrapper{{child1, child2}};
+  }();
+  auto probe_col0 = [] {
+    column_wrapper<int32_t> child1{{1, 0, 3}, cudf::test::iterators::null_at(1)};
+    column_wrapper<int32_t> child2{11, 12, 14};
+    return cudf::test::structs_column_wrapper{{child1, child2}};
+  }();
+  auto const build = cudf::table_view{{build_col0}};
+  auto const probe = cudf::table_view{{probe_col0}};
+
+  cudf::filtered_join const filtered_join(build);
+  auto const semi_result = filtered_join.semi_join(probe);
+  auto const anti_result = filtered_join.anti_join(probe);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    column_wrapper<cudf::size_type>{0},
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*semi_result}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    column_wrapper<cudf::size_type>{1, 2},
+    cudf::column_view{cudf::device_span<cudf::size_type const>{*anti_result}});
+}
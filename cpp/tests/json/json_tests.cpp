@@ -16,6 +16,7 @@
 
 #include <cudf_test/base_fixture.hpp>
 #include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/testing_main.hpp>
 
 #include <cudf/json/json.hpp>
@@ -24,6 +25,8 @@
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <stdexcept>
+#include <string>
+#include <vector>
 
 // reference:  https://jsonpath.herokuapp.com/
 
@@ -1056,4 +1059,87 @@ TEST_F(JsonPathTests, QueriesContainingQuotes)
   do_test(R"($.'A)", R"({"B'": 3})");
 }
 
+TEST_F(JsonPathTests, GetJsonObjectMultiplePaths)
+{
+  auto const make_row = [](int i, std::string const& padding) {
+    auto const n = std::to_string(i);
+    return R"({"a": )" + n + R"(, "b": {"c": ")" + n + R"(", "d": [)" + n + "," + n +
+           R"(]}, "pad": ")" + padding + R"("})";
+  };
+  std::vector<std::string> const json_paths{
+    "$.a", "$.b.c", "$.b.d[1]", "$.b.d[*]", "$.missing", "", "$.b", "$.pad"};
+
+  auto const do_test = [&](std::string const& padding) {
+    std::vector<std::string> rows;
+    for (int i = 0; i < 100; ++i) {
+      rows.push_back(make_row(i, padding));
+    }
+    rows.push_back("");
+    auto const validity = cudf::test::iterators::null_at(50);
+    cudf::test::strings_column_wrapper input(rows.begin(), rows.end(), validity);
+    auto const col = cudf::strings_column_view(input);
+
+    auto const result = cudf::get_json_object(col, json_paths);
+    ASSERT_EQ(result->num_columns(), static_cast<cudf::size_type>(json_paths.size()));
+    for (std::size_t i = 0; i < json_paths.size(); ++i) {
+      auto const expected = cudf::get_json_object(col, cudf::string_scalar{json_paths[i]});
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expected, result->get_column(i));
+    }
+  };
+
+  do_test("");
+  // long documents are evaluated with a warp per row
+  do_test(std::string(2048, 'x'));
+}
+
+TEST_F(JsonPathTests, GetJsonObjectMultiplePathsEmptyInput)
+{
+  cudf::test::strings_column_wrapper input;
+  std::vector<std::string> const json_paths{"$.a", "$"};
+  auto const result = cudf::get_json_object(cudf::strings_column_view(input), json_paths);
+  ASSERT_EQ(result->num_columns(), 2);
+  EXPECT_EQ(result->num_rows(), 0);
+
+  std::vector<std::string> const invalid_paths{"$.a", "]["};
+  EXPECT_THROW(cudf::get_json_object(cudf::strings_column_view(input), invalid_paths),
+               std::invalid_argument);
+}
+
+TEST_F(JsonPathTests, GetJsonObjectLongDocuments)
+{
+  // long enough rows to be evaluated on the token stream of the whole column
+  auto const padding = R"(,"pad":")" + std::string(5000, 'x') + R"("})";
+  std::vector<std::string> const rows{R"({"a":1,"b":{"c":"x","d":[1,{"e":2}]})" + padding,
+                                      R"({"b":{})" + padding,
+                                      R"({"a":[1,2])" + padding,
+                                      R"({"a":1,"b":{"c":,)" + padding};
+  cudf::test::strings_column_wrapper input(rows.begin(), rows.end());
+  auto const col = cudf::strings_column_view(input);
+
+  std::vector<std::string> const json_paths{
+    "$.a", "$.b.c", "$.b.d[1].e", "$.b.d[2]", "$.missing", "$.b.d[*]"};
+  std::vector<cudf::test::strings_column_wrapper> expected;
+  expected.push_back(cudf::test::strings_column_wrapper({"1", "", "[1,2]", "1"}, {1, 0, 1, 1}));
+  expected.push_back(cudf::test::strings_column_wrapper({"x", "", "", ""}, {1, 0, 0, 0}));
+  expected.push_back(cudf::test::strings_column_wrapper({"2", "", "", ""}, {1, 0, 0, 0}));
+  expected.push_back(cudf::test::strings_column_wrapper({"", "", "", ""}, {0, 0, 0, 0}));
+  expected.push_back(cudf::test::strings_column_wrapper({"", "", "", ""}, {0, 0, 0, 0}));
+  expected.push_back(
+    cudf::test::strings_column_wrapper({R"([1,{"e":2}])", "", "", ""}, {1, 0, 0, 0}));
+
+  auto const result = cudf::get_json_object(col, json_paths);
+  for (std::size_t i = 0; i < json_paths.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected[i], result->get_column(i));
+    auto const single = cudf::get_json_object(col, cudf::string_scalar{json_paths[i]});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected[i], *single);
+  }
+
+  // missing fields of non-empty objects produce "null"
+  cudf::get_json_object_options options;
+  options.set_missing_fields_as_nulls(true);
+  auto const missing = cudf::get_json_object(col, cudf::string_scalar{"$.b.c"}, options);
+  cudf::test::strings_column_wrapper missing_expected({"x", "", "null", ""}, {1, 0, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(missing_expected, *missing);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -434,6 +434,33 @@ TEST(TestStringData, SlicedNonAsciiStringTest)
   }
 }
 
+// One-hot encoding of the bins, including values in no bin and nulls.
+TEST(OneHotEncodeBinsTest, TestNullsAndOutOfBounds)
+{
+  fwc_wrapper<double> left_edges{0, 10, 20};
+  fwc_wrapper<double> right_edges{10, 20, 30};
+  fwc_wrapper<double> input{{-5, 0, 15, 30, 25, 12, 3}, {1, 1, 1, 1, 0, 1, 1}};
+
+  auto result = cudf::one_hot_encode_bins(
+    input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  cudf::test::lists_column_wrapper<cudf::size_type> expected{{}, {0}, {1}, {}, {}, {1}, {0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, result->view());
+}
+
+TEST(OneHotEncodeBinsTest, TestEmptyInput)
+{
+  fwc_wrapper<double> left_edges{0, 10};
+  fwc_wrapper<double> right_edges{10, 20};
+  fwc_wrapper<double> input{};
+
+  auto result = cudf::one_hot_encode_bins(
+    input, left_edges, cudf::inclusive::YES, right_edges, cudf::inclusive::NO);
+
+  EXPECT_EQ(result->size(), 0);
+  EXPECT_EQ(result->type().id(), cudf::type_id::LIST);
+}
+
 }  // anonymous namespace
 
 CUDF_TEST_PROGRAM_MAIN()
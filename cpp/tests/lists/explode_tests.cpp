@@ -19,6 +19,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/lists/explode.hpp>
 
@@ -94,6 +95,36 @@ TEST_F(ExplodeTest, Basics)
   CUDF_TEST_EXPECT_TABLES_EQUAL(pos_ret->view(), pos_expected);
 }
 
+TEST_F(ExplodeTest, GatherMap)
+{
+  //    a                   b
+  //    100                [1, 2, 7]
+  //    200                null
+  //    300                [5, 6]
+  //    400                [0, 3]
+
+  auto valids = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i != 1; });
+  FCW a{100, 200, 300, 400};
+  LCW b({LCW{1, 2, 7}, LCW{}, LCW{5, 6}, LCW{0, 3}}, valids);
+
+  FCW expected_map{0, 0, 0, 2, 2, 3, 3};
+  FCW expected_child{1, 2, 7, 5, 6, 0, 3};
+
+  auto [gather_map, child] = cudf::explode_gather_map(b);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*gather_map, expected_map);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*child, expected_child);
+
+  // Gathering the other columns reproduces the output of `explode`.
+  auto const exploded = cudf::explode(cudf::table_view({a, b}), 1);
+  auto const gathered = cudf::gather(cudf::table_view({a}), *gather_map);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(gathered->get_column(0), exploded->get_column(0));
+
+  auto const sliced = cudf::slice(b, {2, 4}).front();
+  auto [sliced_map, sliced_child] = cudf::explode_gather_map(sliced);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*sliced_map, FCW{0, 0, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*sliced_child, FCW{5, 6, 0, 3});
+}
+
 TEST_F(ExplodeTest, SingleNull)
 {
   //    a                   b
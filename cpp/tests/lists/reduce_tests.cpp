@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/reduce.hpp>
+
+using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int64s_col  = cudf::test::fixed_width_column_wrapper<int64_t>;
+using strings_col = cudf::test::strings_column_wrapper;
+using structs_col = cudf::test::structs_column_wrapper;
+
+struct ListsReduceTest : public cudf::test::BaseFixture {};
+
+TEST_F(ListsReduceTest, SumWithNulls)
+{
+  using LCW = cudf::test::lists_column_wrapper<int32_t>;
+  auto const input =
+    LCW{{LCW{1, 2, 3}, LCW{4}, LCW{}, LCW{7, 8}, LCW{{5, 0, 6}, {1, 0, 1}}}, {1, 1, 1, 0, 1}};
+
+  auto const agg = cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>();
+  {
+    auto const result = cudf::lists::reduce(
+      cudf::lists_column_view{input}, *agg, cudf::data_type{cudf::type_id::INT64});
+    auto const expected = int64s_col{{6, 4, 0, 0, 11}, {1, 1, 0, 0, 1}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    auto const result = cudf::lists::reduce(cudf::lists_column_view{input},
+                                            *agg,
+                                            cudf::data_type{cudf::type_id::INT64},
+                                            cudf::null_policy::INCLUDE);
+    auto const expected = int64s_col{{6, 4, 0, 0, 0}, {1, 1, 0, 0, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    auto const sliced = cudf::slice(input, {1, 4}).front();
+    auto const result = cudf::lists::reduce(
+      cudf::lists_column_view{sliced}, *agg, cudf::data_type{cudf::type_id::INT64});
+    auto const expected = int64s_col{{4, 0, 0}, {1, 0, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
+TEST_F(ListsReduceTest, MinMaxListsOfStructs)
+{
+  // Input: [ [{1, "a"}, {3, "b"}, {3, "a"}], [{2, "z"}], [] ]
+  auto child = [] {
+    auto ints    = int32s_col{1, 3, 3, 2};
+    auto strings = strings_col{"a", "b", "a", "z"};
+    return structs_col{{ints, strings}}.release();
+  }();
+  auto offsets = int32s_col{0, 3, 4, 4}.release();
+  auto const input =
+    cudf::make_lists_column(3, std::move(offsets), std::move(child), 0, rmm::device_buffer{});
+  auto const dtype = cudf::data_type{cudf::type_id::STRUCT};
+
+  {
+    auto const agg    = cudf::make_max_aggregation<cudf::segmented_reduce_aggregation>();
+    auto const result = cudf::lists::reduce(cudf::lists_column_view{*input}, *agg, dtype);
+    auto ints         = int32s_col{3, 2, 0};
+    auto strings      = strings_col{"b", "z", ""};
+    auto const expected = structs_col{{ints, strings}, {1, 1, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+  {
+    auto const agg    = cudf::make_min_aggregation<cudf::segmented_reduce_aggregation>();
+    auto const result = cudf::lists::reduce(cudf::lists_column_view{*input}, *agg, dtype);
+    auto ints         = int32s_col{1, 2, 0};
+    auto strings      = strings_col{"a", "z", ""};
+    auto const expected = structs_col{{ints, strings}, {1, 1, 0}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *result);
+  }
+}
+
+TEST_F(ListsReduceTest, Empty)
+{
+  using LCW         = cudf::test::lists_column_wrapper<int32_t>;
+  auto const input  = LCW{};
+  auto const agg    = cudf::make_sum_aggregation<cudf::segmented_reduce_aggregation>();
+  auto const result = cudf::lists::reduce(
+    cudf::lists_column_view{input}, *agg, cudf::data_type{cudf::type_id::INT64});
+  EXPECT_EQ(result->size(), 0);
+}
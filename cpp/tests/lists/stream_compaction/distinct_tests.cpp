@@ -21,6 +21,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/lists/sorting.hpp>
 #include <cudf/lists/stream_compaction.hpp>
 
@@ -39,6 +40,7 @@ auto constexpr NAN_EQUAL    = cudf::nan_equality::ALL_EQUAL;
 auto constexpr NAN_UNEQUAL  = cudf::nan_equality::UNEQUAL;
 
 using int32s_col    = cudf::test::fixed_width_column_wrapper<int32_t>;
+using int32s_lists  = cudf::test::lists_column_wrapper<int32_t>;
 using floats_lists  = cudf::test::lists_column_wrapper<float_type>;
 using strings_lists = cudf::test::lists_column_wrapper<cudf::string_view>;
 using strings_col   = cudf::test::strings_column_wrapper;
@@ -91,6 +93,20 @@ TEST_F(ListDistinctTest, TrivialTest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *results_sorted);
 }
 
+TEST_F(ListDistinctTest, LongLists)
+{
+  // Rows longer than the per-warp hash set take the table-wide hashing path.
+  auto const values =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7; });
+  auto const input =
+    int32s_lists{int32s_lists(values, values + 300), int32s_lists{3, 3, 1}, int32s_lists{}};
+  auto const expected =
+    int32s_lists{int32s_lists{0, 1, 2, 3, 4, 5, 6}, int32s_lists{1, 3}, int32s_lists{}};
+
+  auto const results_sorted = distinct_sorted(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *results_sorted);
+}
+
 TEST_F(ListDistinctTest, FloatingPointTestsWithSignedZero)
 {
   // -0.0 and 0.0 should be considered equal.
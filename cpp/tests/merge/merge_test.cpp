@@ -25,6 +25,8 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/merge.hpp>
 #include <cudf/sorting.hpp>
@@ -36,6 +38,9 @@
 #include <thrust/iterator/counting_iterator.h>
 #include <thrust/merge.h>
 
+#include <limits>
+#include <stdexcept>
+#include <string>
 #include <vector>
 
 template <typename T>
@@ -988,6 +993,137 @@ TEST_F(MergeTest, NestedListsofStructs)
   CUDF_TEST_EXPECT_TABLES_EQUIVALENT(expected_tbl, *result);
 }
 
+class KWayMergeTest : public cudf::test::BaseFixture {
+ protected:
+  // Splits `input` into `num_tables` tables, each sorted on `key_cols`
+  std::vector<std::unique_ptr<cudf::table>> sorted_tables(
+    cudf::table_view const& input,
+    int num_tables,
+    std::vector<cudf::size_type> const& key_cols,
+    std::vector<cudf::order> const& column_order,
+    std::vector<cudf::null_order> const& null_precedence)
+  {
+    std::vector<cudf::size_type> splits;
+    for (int i = 1; i < num_tables; ++i) {
+      splits.push_back(i * input.num_rows() / num_tables + i % 3);
+    }
+    std::vector<std::unique_ptr<cudf::table>> tables;
+    for (auto const& part : cudf::split(input, splits)) {
+      tables.push_back(
+        cudf::stable_sort_by_key(part, part.select(key_cols), column_order, null_precedence));
+    }
+    return tables;
+  }
+
+  std::vector<cudf::table_view> views_of(std::vector<std::unique_ptr<cudf::table>> const& tables)
+  {
+    std::vector<cudf::table_view> views;
+    for (auto const& table : tables) {
+      views.push_back(table->view());
+    }
+    return views;
+  }
+};
+
+TEST_F(KWayMergeTest, RadixKeys)
+{
+  // rows with equal keys come from the tables in order, as in a stable sort of all rows
+  auto const nan      = std::numeric_limits<double>::quiet_NaN();
+  auto const num_rows = 600;
+  auto const keys     = cudf::detail::make_counting_transform_iterator(0, [nan](auto i) {
+    return i % 17 == 0 ? nan : i % 11 == 0 ? -0.0 : static_cast<double>((i * 7) % 50) - 25.0;
+  });
+  auto const key_validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  auto const payload = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const strings = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i * 31); });
+  cudf::test::fixed_width_column_wrapper<double> c0(keys, keys + num_rows, key_validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> c1(payload, payload + num_rows);
+  cudf::test::strings_column_wrapper c2(strings, strings + num_rows);
+  auto const input = cudf::table_view({c0, c1, c2});
+
+  std::vector<cudf::size_type> const key_cols{0};
+  for (auto const column_order : {cudf::order::ASCENDING, cudf::order::DESCENDING}) {
+    for (auto const null_precedence : {cudf::null_order::BEFORE, cudf::null_order::AFTER}) {
+      auto const tables   = sorted_tables(input, 7, key_cols, {column_order}, {null_precedence});
+      auto const views    = views_of(tables);
+      auto const all_rows = cudf::concatenate(views);
+      auto const expected = cudf::stable_sort_by_key(
+        all_rows->view(), all_rows->view().select(key_cols), {column_order}, {null_precedence});
+
+      auto const result = cudf::merge(views, key_cols, {column_order}, {null_precedence});
+      CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+    }
+  }
+}
+
+TEST_F(KWayMergeTest, MultipleKeys)
+{
+  auto const num_rows = 500;
+  auto const strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(1, static_cast<char>('a' + i % 7)); });
+  auto const ints     = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 5 != 0; });
+  cudf::test::strings_column_wrapper c0(strings, strings + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<int32_t> c1(ints, ints + num_rows);
+  cudf::test::fixed_width_column_wrapper<int64_t> c2(ints, ints + num_rows, validity);
+  auto const input = cudf::table_view({c0, c1, c2});
+
+  std::vector<cudf::size_type> const key_cols{0, 1};
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> const null_precedence{cudf::null_order::AFTER,
+                                                      cudf::null_order::BEFORE};
+  auto const tables   = sorted_tables(input, 9, key_cols, column_order, null_precedence);
+  auto const views    = views_of(tables);
+  auto const expected =
+    cudf::sort_by_key(input, input.select(key_cols), column_order, null_precedence);
+
+  auto const result = cudf::merge(views, key_cols, column_order, null_precedence);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), result->view());
+}
+
+TEST_F(KWayMergeTest, Chunked)
+{
+  auto const num_rows = 1000;
+  auto const keys =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 37) % 101; });
+  auto const strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::to_string(i); });
+  cudf::test::fixed_width_column_wrapper<int32_t> c0(keys, keys + num_rows);
+  cudf::test::strings_column_wrapper c1(strings, strings + num_rows);
+  auto const input = cudf::table_view({c0, c1});
+
+  std::vector<cudf::size_type> const key_cols{0};
+  std::vector<cudf::order> const column_order{cudf::order::ASCENDING};
+  // the 3-table merge is merged pairwise, the others with the k-way merge
+  for (auto const num_tables : {3, 8}) {
+    auto const tables   = sorted_tables(input, num_tables, key_cols, column_order, {});
+    auto const views    = views_of(tables);
+    auto const expected = cudf::merge(views, key_cols, column_order);
+
+    cudf::chunked_merge merger(views, key_cols, column_order, {}, 128);
+    std::vector<std::unique_ptr<cudf::table>> chunks;
+    while (merger.has_next()) {
+      chunks.push_back(merger.next_chunk());
+      EXPECT_LE(chunks.back()->num_rows(), 128);
+    }
+    EXPECT_EQ(chunks.size(), 8);
+    EXPECT_EQ(merger.next_chunk()->num_rows(), 0);
+
+    auto const result = cudf::concatenate(views_of(chunks));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->view().column(0), result->view().column(0));
+    std::vector<cudf::order> const all_ascending{cudf::order::ASCENDING, cudf::order::ASCENDING};
+    auto const sorted_result = cudf::sort_by_key(result->view(), result->view(), all_ascending);
+    auto const sorted_expected =
+      cudf::sort_by_key(expected->view(), expected->view(), all_ascending);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(sorted_expected->view(), sorted_result->view());
+  }
+
+  EXPECT_THROW(cudf::chunked_merge({input}, key_cols, column_order, {}, 0), std::invalid_argument);
+}
+
 template <typename T>
 struct FixedPointTestAllReps : public cudf::test::BaseFixture {};
 
@@ -21,6 +21,8 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/contiguous_split.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/hashing.hpp>
 #include <cudf/partitioning.hpp>
@@ -419,4 +421,101 @@ TEST_F(HashPartition, StructofStructWithNulls)
                                  second_result->get_column(0).view());
 }
 
+TEST_F(HashPartition, LargePartitionCounts)
+{
+  constexpr cudf::size_type num_rows = 20'000;
+
+  auto const iter  = thrust::make_counting_iterator(0);
+  auto const valid = thrust::make_transform_iterator(iter, [](auto i) { return i % 11 != 0; });
+  fixed_width_column_wrapper<int32_t> keys(iter, iter + num_rows, valid);
+  fixed_width_column_wrapper<int32_t> row_ids(iter, iter + num_rows);
+  auto const input = cudf::table_view({keys, row_ids});
+
+  for (cudf::size_type const num_partitions : {3000, 8192}) {
+    auto [output, offsets] = cudf::hash_partition(input, {0}, num_partitions);
+    ASSERT_EQ(static_cast<size_t>(num_partitions), offsets.size());
+    CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::sort(input)->view(), cudf::sort(output->view())->view());
+
+    // Rows keep their input order within each partition
+    offsets.push_back(num_rows);
+    auto const output_row_ids = cudf::test::to_host<int32_t>(output->get_column(1)).first;
+    for (cudf::size_type p = 0; p < num_partitions; ++p) {
+      EXPECT_LE(offsets[p], offsets[p + 1]);
+      EXPECT_TRUE(std::is_sorted(output_row_ids.begin() + offsets[p],
+                                 output_row_ids.begin() + offsets[p + 1]));
+    }
+  }
+}
+
+void expect_partition_and_pack_matches(cudf::table_view const& input,
+                                       std::vector<cudf::size_type> const& columns_to_hash,
+                                       cudf::size_type num_partitions)
+{
+  auto const packed = cudf::partition_and_pack(input, columns_to_hash, num_partitions);
+  auto [expected, offsets] = cudf::hash_partition(input, columns_to_hash, num_partitions);
+  ASSERT_EQ(static_cast<size_t>(num_partitions), packed.size());
+
+  // Rows within a partition may be in any order, so compare sorted partitions
+  offsets.push_back(input.num_rows());
+  for (cudf::size_type p = 0; p < num_partitions; ++p) {
+    auto const result = cudf::unpack(packed[p]);
+    auto const slice  = cudf::slice(expected->view(), {offsets[p], offsets[p + 1]})[0];
+    ASSERT_EQ(slice.num_rows(), result.num_rows());
+    if (slice.num_rows() == 0) { continue; }
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(cudf::sort(slice)->view(), cudf::sort(result)->view());
+  }
+}
+
+TEST_F(HashPartition, PartitionAndPackFixedWidth)
+{
+  auto const iter  = thrust::make_counting_iterator(0);
+  auto const keys  = thrust::make_transform_iterator(iter, [](auto i) { return i % 97; });
+  auto const valid = thrust::make_transform_iterator(iter, [](auto i) { return i % 5 != 0; });
+  fixed_width_column_wrapper<int32_t> integers(keys, keys + 1000, valid);
+  fixed_width_column_wrapper<double> doubles(iter, iter + 1000);
+  fixed_width_column_wrapper<int8_t> bytes(keys, keys + 1000, valid);
+  fixed_width_column_wrapper<bool> bools(valid, valid + 1000);
+  auto const input = cudf::table_view({integers, doubles, bytes, bools});
+
+  expect_partition_and_pack_matches(input, {0}, 7);
+  expect_partition_and_pack_matches(input, {0, 3}, 16);
+}
+
+TEST_F(HashPartition, PartitionAndPackManyPartitions)
+{
+  auto const iter  = thrust::make_counting_iterator(0);
+  auto const valid = thrust::make_transform_iterator(iter, [](auto i) { return i % 3 != 0; });
+  fixed_width_column_wrapper<int64_t> integers(iter, iter + 5000, valid);
+  fixed_width_column_wrapper<float> floats(iter, iter + 5000);
+  auto const input = cudf::table_view({integers, floats});
+
+  expect_partition_and_pack_matches(input, {0}, 1500);
+}
+
+TEST_F(HashPartition, PartitionAndPackStrings)
+{
+  fixed_width_column_wrapper<int32_t> integers({1, 2, 3, 4, 5, 6, 7, 8}, null_at(2));
+  strings_column_wrapper strings({"a", "bb", "ccc", "d", "ee", "fff", "gg", "h"}, null_at(5));
+  auto const input = cudf::table_view({integers, strings});
+
+  expect_partition_and_pack_matches(input, {1}, 3);
+}
+
+TEST_F(HashPartition, PartitionAndPackEmpty)
+{
+  fixed_width_column_wrapper<int32_t> integers{};
+  fixed_width_column_wrapper<float> floats{};
+  auto const input = cudf::table_view({integers, floats});
+
+  EXPECT_TRUE(cudf::partition_and_pack(input, {0}, 0).empty());
+
+  auto const packed = cudf::partition_and_pack(input, {0}, 4);
+  ASSERT_EQ(4, packed.size());
+  for (auto const& partition : packed) {
+    auto const result = cudf::unpack(partition);
+    EXPECT_EQ(0, result.num_rows());
+    EXPECT_EQ(input.num_columns(), result.num_columns());
+  }
+}
+
 CUDF_TEST_PROGRAM_MAIN()
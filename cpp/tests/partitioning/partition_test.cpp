@@ -345,3 +345,54 @@ TEST_F(PartitionTestNotTyped, NoIntegerOverflow)
 
   run_partition_test(table_to_partition, map, 2, expected_table, expected_offsets);
 }
+
+TEST_F(PartitionTestNotTyped, RangePartition)
+{
+  fixed_width_column_wrapper<int32_t> keys{5, 1, 9, 3, 7, 2};
+  strings_column_wrapper payload{"five", "one", "nine", "three", "seven", "two"};
+  auto table_to_partition = cudf::table_view{{payload, keys}};
+
+  fixed_width_column_wrapper<int32_t> boundaries{3, 7};
+  auto result = cudf::range_partition(table_to_partition,
+                                      {1},
+                                      cudf::table_view{{boundaries}},
+                                      {cudf::order::ASCENDING},
+                                      {cudf::null_order::BEFORE});
+
+  std::vector<cudf::size_type> expected_offsets{0, 2, 4, 6};
+  EXPECT_EQ(result.second, expected_offsets);
+
+  fixed_width_column_wrapper<int32_t> expected_keys{1, 2, 5, 3, 9, 7};
+  strings_column_wrapper expected_payload{"one", "two", "five", "three", "nine", "seven"};
+  expect_equal_partitions(
+    cudf::table_view{{expected_payload, expected_keys}}, *result.first, expected_offsets);
+}
+
+TEST_F(PartitionTestNotTyped, RangePartitionBoundaries)
+{
+  auto elements = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return 99 - i; });
+  fixed_width_column_wrapper<int32_t> sample(elements, elements + 100);
+  auto const sample_table = cudf::table_view{{sample}};
+
+  auto const boundaries = cudf::range_partition_boundaries(
+    sample_table, 4, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE});
+  fixed_width_column_wrapper<int32_t> expected{25, 50, 75};
+  CUDF_TEST_EXPECT_TABLES_EQUAL(cudf::table_view{{expected}}, boundaries->view());
+
+  // The partitions of the sample itself are balanced
+  auto const result = cudf::range_partition(sample_table,
+                                            {0},
+                                            boundaries->view(),
+                                            {cudf::order::ASCENDING},
+                                            {cudf::null_order::BEFORE});
+  std::vector<cudf::size_type> expected_offsets{0, 25, 50, 75, 100};
+  EXPECT_EQ(result.second, expected_offsets);
+
+  EXPECT_EQ(cudf::range_partition_boundaries(
+              sample_table, 1, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE})
+              ->num_rows(),
+            0);
+  EXPECT_THROW(cudf::range_partition_boundaries(
+                 sample_table, 0, {cudf::order::ASCENDING}, {cudf::null_order::BEFORE}),
+               std::invalid_argument);
+}
@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+
+#include <cudf/aggregation.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/concatenate.hpp>
+#include <cudf/reduction.hpp>
+#include <cudf/stream_compaction.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <cmath>
+#include <stdexcept>
+
+namespace {
+
+using int64s_col = cudf::test::fixed_width_column_wrapper<int64_t>;
+
+auto sketch(cudf::column_view const& input, int precision = 12)
+{
+  return cudf::reduce(input,
+                      *cudf::make_hyperloglog_aggregation<cudf::reduce_aggregation>(precision),
+                      cudf::data_type{cudf::type_id::LIST});
+}
+
+int64_t estimate(cudf::scalar const& sketch)
+{
+  auto const sketches = cudf::make_column_from_scalar(sketch, 1);
+  auto const result   = cudf::approx_distinct_count(*sketches);
+  return cudf::test::to_host<int64_t>(*result).first.front();
+}
+
+}  // namespace
+
+struct HyperLogLogReductionTest : public cudf::test::BaseFixture {};
+
+TEST_F(HyperLogLogReductionTest, SmallCardinality)
+{
+  auto const values = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 2, 3, 3, 3, 1};
+  EXPECT_EQ(estimate(*sketch(values)), 3);
+}
+
+TEST_F(HyperLogLogReductionTest, NullsAreIgnored)
+{
+  auto const values = cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2, 5, 3, 6, 3},
+                                                                      {1, 1, 0, 1, 0, 1}};
+  EXPECT_EQ(estimate(*sketch(values)), 3);
+
+  auto const all_nulls =
+    cudf::test::fixed_width_column_wrapper<int32_t>{{1, 2}, cudf::test::iterators::all_nulls()};
+  EXPECT_EQ(estimate(*sketch(all_nulls)), 0);
+}
+
+TEST_F(HyperLogLogReductionTest, Strings)
+{
+  auto const values = cudf::test::strings_column_wrapper{"a", "bb", "a", "ccc", "", "bb"};
+  EXPECT_EQ(estimate(*sketch(values)), 4);
+}
+
+TEST_F(HyperLogLogReductionTest, LargeCardinality)
+{
+  auto constexpr num_rows     = 1'000'000;
+  auto constexpr num_distinct = 200'000;
+  auto const itr              = thrust::make_transform_iterator(
+    thrust::make_counting_iterator(0), [](auto i) { return i % num_distinct; });
+  auto const values = cudf::test::fixed_width_column_wrapper<int32_t>(itr, itr + num_rows);
+
+  // Precision 12 has a standard error of about 1.6%
+  auto const result = estimate(*sketch(values));
+  EXPECT_LT(std::abs(result - num_distinct), num_distinct * 0.05);
+}
+
+TEST_F(HyperLogLogReductionTest, MergeSketches)
+{
+  auto const lhs_itr = thrust::make_counting_iterator(0);
+  auto const rhs_itr = thrust::make_counting_iterator(50'000);
+  auto const lhs = cudf::test::fixed_width_column_wrapper<int32_t>(lhs_itr, lhs_itr + 100'000);
+  auto const rhs = cudf::test::fixed_width_column_wrapper<int32_t>(rhs_itr, rhs_itr + 100'000);
+
+  auto const lhs_sketch = cudf::make_column_from_scalar(*sketch(lhs), 1);
+  auto const rhs_sketch = cudf::make_column_from_scalar(*sketch(rhs), 1);
+  auto const sketches   = cudf::concatenate(std::vector{lhs_sketch->view(), rhs_sketch->view()});
+  auto const merged =
+    cudf::reduce(*sketches,
+                 *cudf::make_merge_hyperloglog_aggregation<cudf::reduce_aggregation>(12),
+                 cudf::data_type{cudf::type_id::LIST});
+
+  // Merging is exact: the merged sketch is the sketch of the union of the values
+  auto const union_itr = thrust::make_counting_iterator(0);
+  auto const all       = cudf::test::fixed_width_column_wrapper<int32_t>(union_itr,
+                                                                   union_itr + 150'000);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(dynamic_cast<cudf::list_scalar const&>(*merged).view(),
+                                 dynamic_cast<cudf::list_scalar const&>(*sketch(all)).view());
+}
+
+TEST_F(HyperLogLogReductionTest, InvalidInputs)
+{
+  auto const values = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  EXPECT_THROW(sketch(values, 3), std::invalid_argument);
+  EXPECT_THROW(sketch(values, 19), std::invalid_argument);
+
+  // The sketches must have 2^precision registers
+  auto const sketches = cudf::make_column_from_scalar(*sketch(values, 10), 2);
+  EXPECT_THROW(cudf::reduce(*sketches,
+                            *cudf::make_merge_hyperloglog_aggregation<cudf::reduce_aggregation>(12),
+                            cudf::data_type{cudf::type_id::LIST}),
+               std::invalid_argument);
+  EXPECT_THROW(cudf::approx_distinct_count(values), std::invalid_argument);
+}
@@ -35,7 +35,10 @@
 
 #include <thrust/iterator/counting_iterator.h>
 
+#include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <stdexcept>
 #include <vector>
 
 using aggregation        = cudf::aggregation;
@@ -1524,6 +1527,59 @@ TYPED_TEST(ReductionTest, Quantile)
             expected_null_value1);
 }
 
+struct ReductionQuantileSelectionTest : public cudf::test::BaseFixture {};
+
+// large enough for the quantiles to be selected rather than found by sorting all values
+TEST_F(ReductionQuantileSelectionTest, LargeColumns)
+{
+  using cudf::reduce_aggregation;
+  auto const size = 200'001;
+
+  // a permutation of [0, size), every 10th value null
+  auto values = cudf::detail::make_counting_transform_iterator(
+    0, [size](auto i) { return static_cast<int32_t>((static_cast<int64_t>(i) * 7919) % size); });
+  auto validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 10 != 0; });
+  // mostly zeros with a few large outliers, which skews the sample buckets
+  auto skewed = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return i % 1000 == 0 ? static_cast<double>(i) : 0.0; });
+
+  cudf::test::fixed_width_column_wrapper<int32_t> col(values, values + size);
+  cudf::test::fixed_width_column_wrapper<int32_t> col_nulls(values, values + size, validity);
+  cudf::test::fixed_width_column_wrapper<double> col_skewed(skewed, skewed + size);
+
+  auto const expected = [](auto begin, auto end, double q) {
+    std::vector<double> sorted(begin, end);
+    std::sort(sorted.begin(), sorted.end());
+    auto const pos   = q * (sorted.size() - 1);
+    auto const lower = static_cast<std::size_t>(std::floor(pos));
+    auto const upper = static_cast<std::size_t>(std::ceil(pos));
+    return sorted[lower] + (pos - lower) * (sorted[upper] - sorted[lower]);
+  };
+  std::vector<double> valid_values;
+  for (auto i = 0; i < size; ++i) {
+    if (validity[i]) { valid_values.push_back(values[i]); }
+  }
+
+  auto const output_type = cudf::data_type{cudf::type_id::FLOAT64};
+  auto const median      = cudf::make_median_aggregation<reduce_aggregation>();
+  for (auto q : {0.0, 0.25, 0.5, 0.9, 1.0}) {
+    auto const agg =
+      cudf::make_quantile_aggregation<reduce_aggregation>({q}, cudf::interpolation::LINEAR);
+    auto const result = cudf::reduce(col, *agg, output_type);
+    EXPECT_EQ(static_cast<cudf::numeric_scalar<double>*>(result.get())->value(),
+              expected(values, values + size, q));
+    auto const result_nulls = cudf::reduce(col_nulls, *agg, output_type);
+    EXPECT_EQ(static_cast<cudf::numeric_scalar<double>*>(result_nulls.get())->value(),
+              expected(valid_values.begin(), valid_values.end(), q));
+    auto const result_skewed = cudf::reduce(col_skewed, *agg, output_type);
+    EXPECT_EQ(static_cast<cudf::numeric_scalar<double>*>(result_skewed.get())->value(),
+              expected(skewed, skewed + size, q));
+  }
+  auto const result = cudf::reduce(col, *median, output_type);
+  EXPECT_EQ(static_cast<cudf::numeric_scalar<double>*>(result.get())->value(), 100'000.0);
+}
+
 TYPED_TEST(ReductionTest, UniqueCount)
 {
   using T = TypeParam;
@@ -3149,4 +3205,78 @@ TEST_F(StructReductionTest, StructReductionMinMaxWithNulls)
   }
 }
 
+struct MultiReductionTest : public cudf::test::BaseFixture {};
+
+TEST_F(MultiReductionTest, FusedMatchesSingleReductions)
+{
+  auto const num_rows = 10000;
+  auto const values   = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 7919) % 1000) - 500; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> col(values, values + num_rows, validity);
+
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_max_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_sum_of_squares_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_variance_aggregation<reduce_aggregation>(1));
+  aggs.push_back(cudf::make_std_aggregation<reduce_aggregation>(0));
+  aggs.push_back(cudf::make_product_aggregation<reduce_aggregation>());  // not fused
+  aggs.push_back(cudf::make_median_aggregation<reduce_aggregation>());   // not fused
+  auto const int32_type   = cudf::data_type{cudf::type_id::INT32};
+  auto const int64_type   = cudf::data_type{cudf::type_id::INT64};
+  auto const float64_type = cudf::data_type{cudf::type_id::FLOAT64};
+  std::vector<cudf::data_type> const output_dtypes{int32_type,
+                                                   int32_type,
+                                                   int64_type,
+                                                   float64_type,
+                                                   float64_type,
+                                                   float64_type,
+                                                   float64_type,
+                                                   float64_type,
+                                                   float64_type,
+                                                   float64_type};
+
+  auto const results = cudf::reduce(col, aggs, output_dtypes);
+  ASSERT_EQ(results.size(), aggs.size());
+  for (std::size_t i = 0; i < aggs.size(); ++i) {
+    auto const expected = cudf::reduce(col, *aggs[i], output_dtypes[i]);
+    ASSERT_EQ(results[i]->type(), expected->type());
+    EXPECT_TRUE(results[i]->is_valid());
+    if (output_dtypes[i] == float64_type) {
+      auto const result_value   = static_cast<cudf::numeric_scalar<double>*>(results[i].get());
+      auto const expected_value = static_cast<cudf::numeric_scalar<double>*>(expected.get());
+      EXPECT_NEAR(result_value->value(),
+                  expected_value->value(),
+                  std::abs(expected_value->value()) * 1e-12);
+    } else if (output_dtypes[i] == int64_type) {
+      EXPECT_EQ(static_cast<cudf::numeric_scalar<int64_t>*>(results[i].get())->value(),
+                static_cast<cudf::numeric_scalar<int64_t>*>(expected.get())->value());
+    } else {
+      EXPECT_EQ(static_cast<cudf::numeric_scalar<int32_t>*>(results[i].get())->value(),
+                static_cast<cudf::numeric_scalar<int32_t>*>(expected.get())->value());
+    }
+  }
+}
+
+TEST_F(MultiReductionTest, AllNulls)
+{
+  cudf::test::fixed_width_column_wrapper<double> col({1.0, 2.0}, {0, 0});
+  std::vector<std::unique_ptr<reduce_aggregation>> aggs;
+  aggs.push_back(cudf::make_min_aggregation<reduce_aggregation>());
+  aggs.push_back(cudf::make_mean_aggregation<reduce_aggregation>());
+  std::vector<cudf::data_type> const output_dtypes{cudf::data_type{cudf::type_id::FLOAT64},
+                                                   cudf::data_type{cudf::type_id::FLOAT64}};
+
+  auto const results = cudf::reduce(col, aggs, output_dtypes);
+  EXPECT_FALSE(results[0]->is_valid());
+  EXPECT_FALSE(results[1]->is_valid());
+
+  EXPECT_THROW(cudf::reduce(col, aggs, {output_dtypes.data(), 1}), std::invalid_argument);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
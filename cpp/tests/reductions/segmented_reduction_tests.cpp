@@ -15,6 +15,7 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/type_lists.hpp>
 
@@ -22,9 +23,12 @@
 #include <cudf/detail/utilities/vector_factories.hpp>
 #include <cudf/reduction.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/types.hpp>
 
 #include <limits>
+#include <stdexcept>
 #include <utility>
 #include <vector>
 
@@ -1515,4 +1519,86 @@ TEST_F(SegmentedReductionStringTest, EmptyInputWithOffsets)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+struct SegmentStatisticsTest : public cudf::test::BaseFixture {};
+
+TEST_F(SegmentStatisticsTest, Numeric)
+{
+  // [1, 5, null], [3, 2, null], [], [null, 7]
+  auto const ints = cudf::test::fixed_width_column_wrapper<int32_t>{
+    {1, 5, XXX, 3, 2, XXX, XXX, 7}, {1, 1, 0, 1, 1, 0, 0, 1}};
+  // [1.5, -2, 0.5], [null, 4, 1], [], [2, 3]
+  auto const doubles = cudf::test::fixed_width_column_wrapper<double>{
+    {1.5, -2.0, 0.5, XXX, 4.0, 1.0, 2.0, 3.0}, {1, 1, 1, 0, 1, 1, 1, 1}};
+  auto const offsets   = std::vector<cudf::size_type>{0, 3, 6, 6, 8};
+  auto const d_offsets = cudf::detail::make_device_uvector_async(
+    offsets, cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+
+  auto const result = cudf::compute_statistics(cudf::table_view{{ints, doubles}}, d_offsets, 12);
+  ASSERT_EQ(result.size(), 2);
+
+  using int32s_col  = cudf::test::fixed_width_column_wrapper<int32_t>;
+  using int64s_col  = cudf::test::fixed_width_column_wrapper<int64_t>;
+  using doubles_col = cudf::test::fixed_width_column_wrapper<double>;
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[0].min, int32s_col({1, 2, XXX, 7}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[0].max, int32s_col({5, 3, XXX, 7}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[0].null_count, int32s_col{1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[0].sum, int64s_col({6, 5, XXX, 7}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*cudf::approx_distinct_count(*result[0].sketch),
+                                      int64s_col{2, 2, 0, 1});
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].min, doubles_col({-2.0, 1.0, XXX, 2.0}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].max, doubles_col({1.5, 4.0, XXX, 3.0}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].null_count, int32s_col{0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].sum, doubles_col({0.0, 5.0, XXX, 5.0}, {1, 1, 0, 1}));
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*cudf::approx_distinct_count(*result[1].sketch),
+                                      int64s_col{3, 2, 0, 2});
+}
+
+TEST_F(SegmentStatisticsTest, WholeColumns)
+{
+  auto const strings =
+    cudf::test::strings_column_wrapper({"b", "a", "c", "", "zz", ""}, {1, 1, 1, 0, 1, 1});
+  // seconds too far from the epoch to be represented in nanoseconds
+  auto const timestamps =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>{
+      -20'000'000'000L, 0L, 20'000'000'000L, 1L, 2L, 3L};
+  auto const decimals = cudf::test::fixed_point_column_wrapper<int32_t>{
+    {100, 250, -50, 0, 0, 0}, {1, 1, 1, 0, 0, 0}, numeric::scale_type{-2}};
+  auto const input = cudf::table_view{{strings, timestamps, decimals}};
+
+  auto const result = cudf::compute_statistics(input, {});
+  ASSERT_EQ(result.size(), 3);
+  for (auto const& stats : result) {
+    EXPECT_EQ(stats.min->size(), 1);
+    EXPECT_EQ(stats.sketch, nullptr);
+  }
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result[0].min, cudf::test::strings_column_wrapper{""});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result[0].max, cudf::test::strings_column_wrapper{"zz"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[0].null_count,
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{1});
+  EXPECT_EQ(result[0].sum, nullptr);
+
+  using timestamps_col =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].min, timestamps_col{-20'000'000'000L});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[1].max, timestamps_col{20'000'000'000L});
+  EXPECT_EQ(result[1].sum, nullptr);
+
+  using decimal32s_col = cudf::test::fixed_point_column_wrapper<int32_t>;
+  using decimal64s_col = cudf::test::fixed_point_column_wrapper<int64_t>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[2].min, decimal32s_col{{-50}, numeric::scale_type{-2}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[2].max, decimal32s_col{{250}, numeric::scale_type{-2}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[2].null_count,
+                                 cudf::test::fixed_width_column_wrapper<int32_t>{3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result[2].sum, decimal64s_col{{300}, numeric::scale_type{-2}});
+}
+
+TEST_F(SegmentStatisticsTest, UnsupportedTypes)
+{
+  auto const lists = cudf::test::lists_column_wrapper<int32_t>{{1, 2}, {3}};
+  EXPECT_THROW(cudf::compute_statistics(cudf::table_view{{lists}}, {}), std::invalid_argument);
+}
+
 #undef XXX
@@ -19,7 +19,12 @@
 #include <cudf_test/tdigest_utilities.cuh>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/concatenate.hpp>
+#include <cudf/detail/tdigest/tdigest.hpp>
 #include <cudf/reduction.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
 
 template <typename T>
 struct ReductionTDigestAllTypes : public cudf::test::BaseFixture {};
@@ -160,3 +165,72 @@ TEST_F(ReductionTDigestMerge, FewHeavyCentroids)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
 }
+
+namespace {
+
+std::unique_ptr<cudf::column> make_tdigest(std::vector<double> const& means,
+                                           std::vector<double> const& weights)
+{
+  cudf::test::fixed_width_column_wrapper<double> c(means.begin(), means.end());
+  cudf::test::fixed_width_column_wrapper<double> w(weights.begin(), weights.end());
+  cudf::test::structs_column_wrapper s({c, w});
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> offsets{
+    0, static_cast<cudf::size_type>(means.size())};
+  auto l = cudf::make_lists_column(1, offsets.release(), s.release(), 0, rmm::device_buffer{});
+  cudf::test::fixed_width_column_wrapper<double> min{means.front()};
+  cudf::test::fixed_width_column_wrapper<double> max{means.back()};
+  std::vector<std::unique_ptr<cudf::column>> children;
+  children.push_back(std::move(l));
+  children.push_back(min.release());
+  children.push_back(max.release());
+  return cudf::make_structs_column(1, std::move(children), 0, {});
+}
+
+}  // namespace
+
+// merges an odd number of digests with interleaved centroids, which exercises every merge round
+TEST_F(ReductionTDigestMerge, ManyInterleavedDigests)
+{
+  std::vector<std::unique_ptr<cudf::column>> digests;
+  digests.push_back(make_tdigest({1.0, 6.0, 11.0}, {1.0, 2.0, 3.0}));
+  digests.push_back(make_tdigest({2.0, 7.0}, {4.0, 5.0}));
+  digests.push_back(make_tdigest({3.0, 8.0, 12.0, 13.0}, {6.0, 7.0, 8.0, 9.0}));
+  digests.push_back(make_tdigest({4.0, 9.0}, {10.0, 11.0}));
+  digests.push_back(make_tdigest({5.0, 10.0}, {12.0, 13.0}));
+  std::vector<cudf::column_view> views;
+  std::transform(digests.begin(), digests.end(), std::back_inserter(views), [](auto const& d) {
+    return d->view();
+  });
+  auto values = cudf::concatenate(views);
+
+  auto result = reduce_merge_op{}(*values, 1000);
+
+  // the centroids are few enough to come back unchanged, in order of their means
+  auto expected =
+    make_tdigest({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0, 10.0, 11.0, 12.0, 13.0},
+                 {1.0, 4.0, 6.0, 10.0, 12.0, 2.0, 5.0, 7.0, 11.0, 13.0, 3.0, 8.0, 9.0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+}
+
+TEST_F(ReductionTDigestMerge, UpdateWithBatches)
+{
+  auto const stream = cudf::get_default_stream();
+  auto const mr     = rmm::mr::get_current_device_resource();
+
+  cudf::test::fixed_width_column_wrapper<int32_t> batch0{5, 1, 9};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch1{4, 8};
+  cudf::test::fixed_width_column_wrapper<int32_t> batch2{7, 2, 3, 6};
+
+  auto digest = cudf::tdigest::detail::make_empty_tdigest_column(stream, mr);
+  for (cudf::column_view batch : {batch0, batch1, batch2}) {
+    digest = cudf::tdigest::detail::update_tdigest(*digest, batch, 1000, stream, mr);
+  }
+
+  auto expected = make_tdigest({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0},
+                               {1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0, 1.0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*digest, *expected);
+
+  auto const two_digests = cudf::concatenate(std::vector<cudf::column_view>{*digest, *digest});
+  EXPECT_THROW(cudf::tdigest::detail::update_tdigest(*two_digests, batch0, 1000, stream, mr),
+               std::invalid_argument);
+}
@@ -25,11 +25,13 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/dictionary/encode.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/replace.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/scalar/scalar_factories.hpp>
+#include <cudf/table/table.hpp>
 #include <cudf/utilities/default_stream.hpp>
 #include <cudf/utilities/error.hpp>
 
@@ -750,4 +752,48 @@ TEST_F(ReplaceNullsPolicyDictionaryTest, FollowingFillTrailingNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->view(), expected->view());
 }
 
+struct ReplaceNullsPolicyTableTest : public cudf::test::BaseFixture {};
+
+TEST_F(ReplaceNullsPolicyTableTest, MatchesColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> c0({1, 2, 3, 4, 5, 6, 7}, {0, 1, 0, 0, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<double> c1({.5, 1.5, 2.5, 3.5, 4.5, 5.5, 6.5});
+  cudf::test::strings_column_wrapper c2({"a", "", "", "d", "e", "", ""}, {1, 0, 0, 1, 1, 0, 0});
+  cudf::test::fixed_width_column_wrapper<int64_t> c3({10, 20, 30, 40, 50, 60, 70});
+  // c3 shares the null mask of c0
+  auto const c3_view = cudf::column_view{cudf::data_type{cudf::type_id::INT64},
+                                         7,
+                                         cudf::column_view{c3}.data<int64_t>(),
+                                         cudf::column_view{c0}.null_mask(),
+                                         cudf::column_view{c0}.null_count()};
+  auto const input   = cudf::table_view({c0, c1, c2, c3_view});
+
+  for (auto policy : {cudf::replace_policy::PRECEDING, cudf::replace_policy::FOLLOWING}) {
+    auto const result = cudf::replace_nulls(input, policy);
+    ASSERT_EQ(result->num_columns(), input.num_columns());
+    for (cudf::size_type i = 0; i < input.num_columns(); ++i) {
+      auto const expected = cudf::replace_nulls(input.column(i), policy);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(i).view(), expected->view());
+    }
+  }
+
+  auto const sliced = cudf::slice(input, {2, 6}).front();
+  auto const result = cudf::replace_nulls(sliced, cudf::replace_policy::PRECEDING);
+  for (cudf::size_type i = 0; i < sliced.num_columns(); ++i) {
+    auto const expected = cudf::replace_nulls(sliced.column(i), cudf::replace_policy::PRECEDING);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(result->get_column(i).view(), expected->view());
+  }
+}
+
+TEST_F(ReplaceNullsPolicyTableTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> c0{};
+  cudf::test::strings_column_wrapper c1{};
+  auto const input = cudf::table_view({c0, c1});
+
+  auto const result = cudf::replace_nulls(input, cudf::replace_policy::FOLLOWING);
+  EXPECT_EQ(result->num_columns(), 2);
+  EXPECT_EQ(result->num_rows(), 0);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -21,6 +21,7 @@
 #include <cudf_test/type_lists.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/detail/iterator.cuh>
 #include <cudf/reshape.hpp>
 
 using namespace cudf::test::iterators;
@@ -172,6 +173,36 @@ TYPED_TEST(InterleaveColumnsTest, ThreeColumnsNullable)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view());
 }
 
+TYPED_TEST(InterleaveColumnsTest, ManyColumnsNullable)
+{
+  using T = TypeParam;
+
+  // more columns than a tile, with partial tiles along both dimensions
+  constexpr cudf::size_type num_cols = 45;
+  constexpr cudf::size_type num_rows = 70;
+  auto const value = [](cudf::size_type idx) { return static_cast<int32_t>(idx % 100); };
+  auto const valid = [](cudf::size_type idx) { return idx % 7 != 3; };
+
+  std::vector<cudf::test::fixed_width_column_wrapper<T, int32_t>> columns;
+  for (cudf::size_type j = 0; j < num_cols; ++j) {
+    auto const values = cudf::detail::make_counting_transform_iterator(
+      0, [&](cudf::size_type i) { return value(i * num_cols + j); });
+    auto const validity = cudf::detail::make_counting_transform_iterator(
+      0, [&](cudf::size_type i) { return valid(i * num_cols + j); });
+    columns.emplace_back(values, values + num_rows, validity);
+  }
+  cudf::table_view in(std::vector<cudf::column_view>(columns.begin(), columns.end()));
+
+  auto const expected_values   = cudf::detail::make_counting_transform_iterator(0, value);
+  auto const expected_validity = cudf::detail::make_counting_transform_iterator(0, valid);
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected(
+    expected_values, expected_values + num_cols * num_rows, expected_validity);
+
+  auto actual = cudf::interleave_columns(in);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, actual->view());
+}
+
 TYPED_TEST(InterleaveColumnsTest, MismatchedDtypes)
 {
   using T = TypeParam;
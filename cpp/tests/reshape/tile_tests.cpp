@@ -20,6 +20,7 @@
 #include <cudf_test/table_utilities.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/copying.hpp>
 #include <cudf/reshape.hpp>
 #include <cudf/table/table.hpp>
 #include <cudf/utilities/error.hpp>
@@ -113,3 +114,24 @@ TYPED_TEST(TileTest, OneColumnZeroCount)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
 }
+
+TYPED_TEST(TileTest, MixedColumns)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in_a({-1, 0, 1, 2}, {1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<T, int32_t> in_b({3, 4, 5, 6});
+  cudf::test::strings_column_wrapper in_c({"a", "", "bc", "d"}, {1, 1, 0, 1});
+  auto const in = cudf::slice(cudf::table_view{{in_a, in_b, in_c}}, {1, 4}).front();
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected_a({0, 1, 2, 0, 1, 2, 0, 1, 2},
+                                                                {0, 1, 1, 0, 1, 1, 0, 1, 1});
+  cudf::test::fixed_width_column_wrapper<T, int32_t> expected_b({4, 5, 6, 4, 5, 6, 4, 5, 6});
+  cudf::test::strings_column_wrapper expected_c({"", "bc", "d", "", "bc", "d", "", "bc", "d"},
+                                                {1, 0, 1, 1, 0, 1, 1, 0, 1});
+  cudf::table_view expected{{expected_a, expected_b, expected_c}};
+
+  auto actual = cudf::tile(in, 3);
+
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, actual->view());
+}
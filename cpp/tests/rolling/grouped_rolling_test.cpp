@@ -667,6 +667,94 @@ TEST_F(GroupedRollingTestInts, SumLargeWindow)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, expected);
 }
 
+TEST_F(GroupedRollingTestInts, MultipleRequests)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> input{0, 10, 20, 30, 40, 50, 60, 70, 80, 90};
+  cudf::test::fixed_width_column_wrapper<int32_t> nullable_input{
+    {9, 8, 7, 6, 5, 4, 3, 2, 1, 0}, cudf::test::iterators::nulls_at({1, 5, 6})};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 0, 1, 1, 1, 1, 2, 2};
+  auto const grouping_keys = cudf::table_view{{keys}};
+  auto const preceding     = cudf::window_bounds::get(2);
+  auto const following     = cudf::window_bounds::get(1);
+
+  std::vector<cudf::rolling_request> requests(2);
+  requests[0].values = input;
+  requests[0].aggregations.push_back(cudf::make_sum_aggregation<cudf::rolling_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_max_aggregation<cudf::rolling_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+  requests[1].values      = nullable_input;
+  requests[1].min_periods = 2;
+  requests[1].aggregations.push_back(cudf::make_min_aggregation<cudf::rolling_aggregation>());
+  requests[1].aggregations.push_back(cudf::make_mean_aggregation<cudf::rolling_aggregation>());
+  requests[1].aggregations.push_back(cudf::make_lag_aggregation<cudf::rolling_aggregation>(1));
+
+  auto const results = cudf::grouped_rolling_window(grouping_keys, preceding, following, requests);
+  ASSERT_EQ(results.size(), requests.size());
+
+  cudf::test::fixed_width_column_wrapper<int64_t> expected_sum{
+    10, 30, 60, 50, 90, 150, 180, 130, 170, 170};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0].results[0], expected_sum);
+
+  for (std::size_t i = 0; i < requests.size(); ++i) {
+    ASSERT_EQ(results[i].results.size(), requests[i].aggregations.size());
+    for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+      auto const expected = cudf::grouped_rolling_window(grouping_keys,
+                                                         requests[i].values,
+                                                         preceding,
+                                                         following,
+                                                         requests[i].min_periods,
+                                                         *requests[i].aggregations[j]);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[i].results[j], *expected);
+    }
+  }
+}
+
+TEST_F(GroupedRollingTestInts, MultipleNestedLeadLagRequests)
+{
+  using lcw = cudf::test::lists_column_wrapper<int32_t>;
+  lcw lists{{{0, 1}, {2}, {}, {3, 4, 5}, {6}, {7, 8}, {9}, {}}, cudf::test::iterators::null_at(2)};
+  cudf::test::strings_column_wrapper strings{"a", "bb", "", "ccc", "d", "ee", "f", "ggg"};
+  cudf::test::fixed_width_column_wrapper<int32_t> keys{0, 0, 0, 1, 1, 1, 1, 2};
+  auto const preceding = cudf::window_bounds::get(3);
+  auto const following = cudf::window_bounds::get(2);
+
+  std::vector<cudf::rolling_request> requests(2);
+  requests[0].values = lists;
+  requests[0].aggregations.push_back(cudf::make_lead_aggregation<cudf::rolling_aggregation>(1));
+  requests[0].aggregations.push_back(cudf::make_count_aggregation<cudf::rolling_aggregation>());
+  requests[0].aggregations.push_back(cudf::make_lag_aggregation<cudf::rolling_aggregation>(2));
+  requests[0].aggregations.push_back(cudf::make_lead_aggregation<cudf::rolling_aggregation>(0));
+  requests[0].aggregations.push_back(cudf::make_lag_aggregation<cudf::rolling_aggregation>(-2));
+  requests[1].values = strings;
+  requests[1].aggregations.push_back(cudf::make_lag_aggregation<cudf::rolling_aggregation>(1));
+  requests[1].aggregations.push_back(cudf::make_lead_aggregation<cudf::rolling_aggregation>(3));
+
+  // with and without groups
+  for (auto const& grouping_keys : {cudf::table_view{{keys}}, cudf::table_view{}}) {
+    auto const results =
+      cudf::grouped_rolling_window(grouping_keys, preceding, following, requests);
+    ASSERT_EQ(results.size(), requests.size());
+    for (std::size_t i = 0; i < requests.size(); ++i) {
+      ASSERT_EQ(results[i].results.size(), requests[i].aggregations.size());
+      for (std::size_t j = 0; j < requests[i].aggregations.size(); ++j) {
+        auto const expected = cudf::grouped_rolling_window(grouping_keys,
+                                                           requests[i].values,
+                                                           preceding,
+                                                           following,
+                                                           requests[i].min_periods,
+                                                           *requests[i].aggregations[j]);
+        CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results[i].results[j], *expected);
+      }
+    }
+  }
+
+  auto const results =
+    cudf::grouped_rolling_window(cudf::table_view{{keys}}, preceding, following, requests);
+  lcw expected_lead{{{2}, {}, {}, {6}, {7, 8}, {9}, {}, {}},
+                    cudf::test::iterators::nulls_at({1, 2, 6, 7})};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results[0].results[0], expected_lead);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using GroupedRollingTestStrings = GroupedRollingTest<cudf::string_view>;
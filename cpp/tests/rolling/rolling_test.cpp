@@ -40,6 +40,7 @@
 
 #include <src/rolling/detail/rolling.hpp>
 
+#include <algorithm>
 #include <limits>
 #include <type_traits>
 #include <vector>
@@ -959,6 +960,100 @@ TEST_F(RollingtVarStdTestUntyped, SimpleStaticVarianceStdInfNaN)
 #undef XXX
 }
 
+TEST_F(RollingtVarStdTestUntyped, LargeWindowVarianceStd)
+{
+  cudf::size_type const num_rows = 10000, ddof = 1, min_periods = 1, preceding_window = 1000,
+                        following_window = 500;
+
+  auto const col_data = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return static_cast<int32_t>((i * 7919) % 1000); });
+  auto const col_mask =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(
+    col_data, col_data + num_rows, col_mask);
+
+  auto const var_result = cudf::rolling_window(
+    input,
+    preceding_window,
+    following_window,
+    min_periods,
+    dynamic_cast<cudf::rolling_aggregation const&>(*cudf::make_variance_aggregation(ddof)));
+  auto const std_result = cudf::rolling_window(
+    input,
+    preceding_window,
+    following_window,
+    min_periods,
+    dynamic_cast<cudf::rolling_aggregation const&>(*cudf::make_std_aggregation(ddof)));
+  EXPECT_EQ(var_result->null_count(), 0);
+  EXPECT_EQ(std_result->null_count(), 0);
+
+  auto const var_host = cudf::test::to_host<double>(*var_result).first;
+  auto const std_host = cudf::test::to_host<double>(*std_result).first;
+  for (cudf::size_type i = 0; i < num_rows; ++i) {
+    auto const start = std::max(0, i - preceding_window + 1);
+    auto const end   = std::min(num_rows, i + following_window + 1);
+    double sum       = 0;
+    int count        = 0;
+    for (auto j = start; j < end; ++j) {
+      if (col_mask[j]) {
+        sum += col_data[j];
+        ++count;
+      }
+    }
+    double const mean = sum / count;
+    double m2         = 0;
+    for (auto j = start; j < end; ++j) {
+      if (col_mask[j]) { m2 += (col_data[j] - mean) * (col_data[j] - mean); }
+    }
+    double const expected = m2 / (count - ddof);
+    EXPECT_NEAR(var_host[i], expected, expected * 1e-9) << "row " << i;
+    EXPECT_NEAR(std_host[i], std::sqrt(expected), std::sqrt(expected) * 1e-9) << "row " << i;
+  }
+}
+
+TEST_F(RollingtVarStdTestUntyped, LargeWindowVarianceStdLargeValues)
+{
+  // Values alternating between about -1e6 and 1e6 followed by a constant run, whose windows must
+  // have a variance of exactly zero once they no longer reach the alternating values
+  cudf::size_type const num_rows = 4000, ddof = 1, min_periods = 1, preceding_window = 1000;
+
+  auto const col_data = cudf::detail::make_counting_transform_iterator(0, [](auto i) {
+    return i < num_rows / 2 ? (i % 2 == 0 ? 1'000'003 : -999'989) : 1'000'007;
+  });
+  auto const col_mask =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 13 != 0; });
+  cudf::test::fixed_width_column_wrapper<int32_t> input(col_data, col_data + num_rows, col_mask);
+
+  // Windows of every row are large enough to be aggregated by the sliding implementation, while
+  // only every 20th row has a large window below, so that it is aggregated by the rolling kernel
+  auto const is_sampled = [](auto i) { return i % 20 == 19; };
+  auto const sampled_preceding = cudf::detail::make_counting_transform_iterator(
+    0, [&](auto i) { return is_sampled(i) ? preceding_window : 1; });
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> kernel_preceding(
+    sampled_preceding, sampled_preceding + num_rows);
+  cudf::test::fixed_width_column_wrapper<cudf::size_type> kernel_following(
+    thrust::make_constant_iterator(0), thrust::make_constant_iterator(0) + num_rows);
+
+  for (auto const is_std : {false, true}) {
+    SCOPED_TRACE(is_std ? "std" : "variance");
+    auto const agg = is_std ? cudf::make_std_aggregation<cudf::rolling_aggregation>(ddof)
+                            : cudf::make_variance_aggregation<cudf::rolling_aggregation>(ddof);
+    auto const sliding_result =
+      cudf::rolling_window(input, preceding_window, 0, min_periods, *agg);
+    auto const kernel_result =
+      cudf::rolling_window(input, kernel_preceding, kernel_following, min_periods, *agg);
+
+    auto const sliding_host = cudf::test::to_host<double>(*sliding_result).first;
+    auto const kernel_host  = cudf::test::to_host<double>(*kernel_result).first;
+    for (cudf::size_type i = 0; i < num_rows; ++i) {
+      if (not is_sampled(i)) { continue; }
+      auto const expected = kernel_host[i];
+      EXPECT_NEAR(sliding_host[i], expected, std::max(expected, 1.0) * 1e-9) << "row " << i;
+      if (i - preceding_window + 1 >= num_rows / 2) { EXPECT_EQ(sliding_host[i], 0.0); }
+    }
+  }
+}
+
 /*
 // negative sizes
 TYPED_TEST(RollingTest, NegativeWindowSizes)
@@ -1170,6 +1265,35 @@ TYPED_TEST(RollingTest, RandomDynamicWithInvalid)
   this->run_test_col_agg(input, preceding_window, following_window, max_window_size);
 }
 
+// random input data, dynamic windows of hundreds of rows, with nulls
+TYPED_TEST(RollingTest, RandomLargeDynamicWithInvalid)
+{
+  cudf::size_type num_rows        = 5000;
+  cudf::size_type max_window_size = 500;
+
+  // random input with nulls
+  std::vector<TypeParam> col_data(num_rows);
+  std::vector<bool> col_valid(num_rows);
+  cudf::test::UniformRandomGenerator<TypeParam> rng;
+  cudf::test::UniformRandomGenerator<bool> rbg;
+  std::generate(col_data.begin(), col_data.end(), [&rng]() { return rng.generate(); });
+  std::generate(col_valid.begin(), col_valid.end(), [&rbg]() { return rbg.generate(); });
+  cudf::test::fixed_width_column_wrapper<TypeParam> input(
+    col_data.begin(), col_data.end(), col_valid.begin());
+
+  // random parameters
+  cudf::test::UniformRandomGenerator<cudf::size_type> window_rng(0, max_window_size);
+  auto generator = [&]() { return window_rng.generate(); };
+
+  std::vector<cudf::size_type> preceding_window(num_rows);
+  std::vector<cudf::size_type> following_window(num_rows);
+
+  std::generate(preceding_window.begin(), preceding_window.end(), generator);
+  std::generate(following_window.begin(), following_window.end(), generator);
+
+  this->run_test_col_agg(input, preceding_window, following_window, max_window_size / 2);
+}
+
 // ------------- non-fixed-width types --------------------
 
 using RollingTestStrings = RollingTest<cudf::string_view>;
@@ -747,3 +747,24 @@ TYPED_TEST(TypedStructContainsTestColumnNeedles, StructOfLists)
   auto const result   = cudf::contains(haystack, needles);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *result, verbosity);
 }
+
+TYPED_TEST(TypedStructContainsTestColumnNeedles, HashSet)
+{
+  using tdata_col = cudf::test::fixed_width_column_wrapper<TypeParam, int32_t>;
+
+  auto const haystack = [] {
+    auto child1 = tdata_col{{0, 1, 2, 3, 4}, null_at(4)};
+    auto child2 = strings_col{"a", "b", "c", "d", "e"};
+    return structs_col{{child1, child2}, null_at(3)};
+  }();
+
+  auto const needles = [] {
+    auto child1 = tdata_col{{1, 0, 2, 3, 4}, null_at(4)};
+    auto child2 = strings_col{"b", "b", "c", "x", "e"};
+    return structs_col{{child1, child2}, null_at(3)};
+  }();
+
+  auto const set      = cudf::hash_set(cudf::table_view{{haystack}});
+  auto const expected = bools_col{1, 0, 1, 1, 1};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, *set.contains(cudf::table_view{{needles}}), verbosity);
+}
@@ -20,11 +20,17 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/detail/iterator.cuh>
 #include <cudf/fixed_point/fixed_point.hpp>
 #include <cudf/search.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
+#include <stdexcept>
+
 struct SearchTest : public cudf::test::BaseFixture {};
 
 using cudf::numeric_scalar;
@@ -558,6 +564,78 @@ TEST_F(SearchTest, table__find_last__nulls_as_largest)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expect);
 }
 
+TEST_F(SearchTest, table__sorted_needles)
+{
+  auto const num_rows = 5000;
+  auto const keys_0 =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i / 300; });
+  auto const keys_1 =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return (i * 7) % 23; });
+  auto const valids =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 11 != 0; });
+  fixed_width_column_wrapper<int32_t> column_0(keys_0, keys_0 + num_rows, valids);
+  fixed_width_column_wrapper<int64_t> column_1(keys_1, keys_1 + num_rows);
+  fixed_width_column_wrapper<int32_t> values_0(keys_0, keys_0 + 2 * num_rows);
+  fixed_width_column_wrapper<int64_t> values_1(keys_1 + 13, keys_1 + 13 + 2 * num_rows, valids);
+
+  std::vector<cudf::order> order_flags{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_order_flags{cudf::null_order::BEFORE,
+                                                 cudf::null_order::AFTER};
+  auto const haystack =
+    cudf::sort(cudf::table_view{{column_0, column_1}}, order_flags, null_order_flags);
+  auto const needles =
+    cudf::sort(cudf::table_view{{values_0, values_1}}, order_flags, null_order_flags);
+
+  auto const expect_lower =
+    cudf::lower_bound(haystack->view(), needles->view(), order_flags, null_order_flags);
+  auto const expect_upper =
+    cudf::upper_bound(haystack->view(), needles->view(), order_flags, null_order_flags);
+
+  auto const lower = cudf::lower_bound(haystack->view(),
+                                       needles->view(),
+                                       order_flags,
+                                       null_order_flags,
+                                       cudf::needles_order::SORTED);
+  auto const upper = cudf::upper_bound(haystack->view(),
+                                       needles->view(),
+                                       order_flags,
+                                       null_order_flags,
+                                       cudf::needles_order::SORTED);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_lower, *lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*expect_upper, *upper);
+
+  // the search index answers unsorted needles in the original order of the haystack
+  auto const index = cudf::ordered_search_index(haystack->view(), order_flags, null_order_flags);
+  auto const unsorted_needles = cudf::table_view{{values_0, values_1}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::lower_bound(haystack->view(), unsorted_needles, order_flags, null_order_flags),
+    *index.lower_bound(unsorted_needles));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    *cudf::upper_bound(haystack->view(), unsorted_needles, order_flags, null_order_flags),
+    *index.upper_bound(unsorted_needles));
+}
+
+TEST_F(SearchTest, table__sorted_needles_small)
+{
+  fixed_width_column_wrapper<int32_t> column_0{{10, 20, 20, 20, 30, 40, 40}, {0, 1, 1, 1, 1, 1, 1}};
+  fixed_width_column_wrapper<int32_t> values_0{{0, 5, 20, 25, 40, 50}, {0, 1, 1, 1, 1, 1}};
+  std::vector<cudf::order> order_flags{cudf::order::ASCENDING};
+  std::vector<cudf::null_order> null_order_flags{cudf::null_order::BEFORE};
+  auto const haystack = cudf::table_view{{column_0}};
+  auto const needles  = cudf::table_view{{values_0}};
+
+  auto const lower = cudf::lower_bound(
+    haystack, needles, order_flags, null_order_flags, cudf::needles_order::SORTED);
+  auto const upper = cudf::upper_bound(
+    haystack, needles, order_flags, null_order_flags, cudf::needles_order::SORTED);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<size_type>{0, 1, 1, 4, 5, 7}, *lower);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<size_type>{1, 1, 4, 4, 7, 7}, *upper);
+
+  auto const index = cudf::ordered_search_index(haystack, order_flags, null_order_flags);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*lower, *index.lower_bound(needles));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*upper, *index.upper_bound(needles));
+}
+
 TEST_F(SearchTest, contains_true)
 {
   using element_type = int64_t;
@@ -644,6 +722,59 @@ TEST_F(SearchTest, contains_nullable_column_false)
   ASSERT_EQ(result, expect);
 }
 
+TEST_F(SearchTest, hash_set_contains)
+{
+  fixed_width_column_wrapper<int32_t> haystack_0{{5, 4, 1, 2, 3, 3, 0}, {1, 1, 1, 1, 1, 1, 0}};
+  cudf::test::strings_column_wrapper haystack_1{"e", "d", "a", "b", "c", "x", "z"};
+  auto const haystack = cudf::table_view{{haystack_0, haystack_1}};
+
+  auto const set = cudf::hash_set(haystack);
+  {
+    fixed_width_column_wrapper<int32_t> needles_0{0, 1, 2, 3};
+    cudf::test::strings_column_wrapper needles_1{"a", "a", "b", "x"};
+    auto const needles = cudf::table_view{{needles_0, needles_1}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{0, 1, 1, 1},
+                                   *set.contains(needles));
+  }
+  {
+    // probing the same set again with another table
+    fixed_width_column_wrapper<int32_t> needles_0{{3, 5, 0}, {1, 1, 0}};
+    cudf::test::strings_column_wrapper needles_1{"c", "d", "z"};
+    auto const needles = cudf::table_view{{needles_0, needles_1}};
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{1, 0, 1},
+                                   *set.contains(needles));
+
+    auto const unequal_nulls = cudf::hash_set(haystack, cudf::null_equality::UNEQUAL);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{1, 0, 0},
+                                   *unequal_nulls.contains(needles));
+  }
+
+  fixed_width_column_wrapper<float> wrong_type{1.f};
+  EXPECT_THROW(set.contains(cudf::table_view{{wrong_type, wrong_type}}), cudf::data_type_error);
+  EXPECT_THROW(cudf::hash_set(cudf::table_view{}), std::invalid_argument);
+}
+
+TEST_F(SearchTest, hash_set_contains_nans)
+{
+  auto const nan = std::numeric_limits<double>::quiet_NaN();
+  fixed_width_column_wrapper<double> haystack{1.0, nan, 2.0};
+  fixed_width_column_wrapper<double> needles{nan, 2.0, 3.0};
+
+  auto const nans_equal = cudf::hash_set(cudf::table_view{{haystack}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{1, 1, 0},
+                                 *nans_equal.contains(cudf::table_view{{needles}}));
+
+  auto const nans_unequal = cudf::hash_set(
+    cudf::table_view{{haystack}}, cudf::null_equality::EQUAL, cudf::nan_equality::UNEQUAL);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{0, 1, 0},
+                                 *nans_unequal.contains(cudf::table_view{{needles}}));
+
+  fixed_width_column_wrapper<double> empty{};
+  auto const empty_set = cudf::hash_set(cudf::table_view{{empty}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(fixed_width_column_wrapper<bool>{0, 0, 0},
+                                 *empty_set.contains(cudf::table_view{{needles}}));
+}
+
 TEST_F(SearchTest, empty_table_string)
 {
   std::vector<char const*> h_col_strings{};
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/concatenate.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+namespace {
+
+/**
+ * @brief Pushes `input` to `sorter` in batches of `batch_size` rows and concatenates the chunks
+ */
+std::unique_ptr<cudf::table> external_sort(cudf::external_sort& sorter,
+                                           cudf::table_view const& input,
+                                           cudf::size_type batch_size)
+{
+  for (cudf::size_type begin = 0; begin < input.num_rows(); begin += batch_size) {
+    auto const end = std::min(begin + batch_size, input.num_rows());
+    sorter.push(cudf::slice(input, {begin, end}).front());
+  }
+
+  std::vector<std::unique_ptr<cudf::table>> chunks;
+  while (sorter.has_next()) {
+    chunks.push_back(sorter.get_next());
+  }
+  std::vector<cudf::table_view> views;
+  for (auto const& chunk : chunks) {
+    views.push_back(chunk->view());
+  }
+  return views.empty() ? cudf::empty_like(input) : cudf::concatenate(views);
+}
+
+}  // namespace
+
+struct ExternalSortTest : public cudf::test::BaseFixture {};
+
+TEST_F(ExternalSortTest, FitsInMemory)
+{
+  int32s_col keys{5, 3, 9, 1, 7};
+  cudf::test::strings_column_wrapper values{"e", "c", "i", "a", "g"};
+  auto const input = cudf::table_view{{keys, values}};
+
+  auto sorter    = cudf::external_sort({0}, {}, {}, 1ul << 30);
+  auto const got = external_sort(sorter, input, 2);
+
+  auto const expected = cudf::sort_by_key(input, cudf::table_view{{keys}});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ExternalSortTest, SpilledRuns)
+{
+  // Distinct keys so that the order of the sorted rows is unique
+  auto const num_rows = 200'000;
+  auto const key_iter = thrust::make_transform_iterator(
+    thrust::counting_iterator<int64_t>(0), [](int64_t i) { return (i * 7919) % 200'003; });
+  auto const value_iter = thrust::make_transform_iterator(thrust::counting_iterator<int32_t>(0),
+                                                          [](auto i) { return i % 97; });
+  cudf::test::fixed_width_column_wrapper<int64_t> keys(
+    key_iter, key_iter + num_rows, cudf::test::iterators::null_at(10));
+  int32s_col values(value_iter, value_iter + num_rows);
+  auto const input = cudf::table_view{{values, keys}};
+
+  // Small enough for many runs, and for more runs than are merged at once
+  auto sorter =
+    cudf::external_sort({1}, {cudf::order::DESCENDING}, {cudf::null_order::AFTER}, 1ul << 20);
+  auto const got = external_sort(sorter, input, 10'000);
+
+  auto const expected = cudf::sort_by_key(
+    input, input.select({1}), {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ExternalSortTest, DuplicateKeys)
+{
+  auto const num_rows = 100'000;
+  auto const key_iter = thrust::make_transform_iterator(thrust::counting_iterator<int32_t>(0),
+                                                        [](auto i) { return (i * 7919) % 101; });
+  int32s_col keys(key_iter, key_iter + num_rows);
+  auto const input = cudf::table_view{{keys}};
+
+  auto sorter    = cudf::external_sort({0}, {}, {}, 1ul << 18);
+  auto const got = external_sort(sorter, input, 4'096);
+
+  auto const expected = cudf::sort(input);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ExternalSortTest, Empty)
+{
+  auto sorter = cudf::external_sort({0}, {}, {}, 1ul << 20);
+  EXPECT_FALSE(sorter.has_next());
+  EXPECT_THROW(sorter.get_next(), cudf::logic_error);
+}
+
+TEST_F(ExternalSortTest, Errors)
+{
+  EXPECT_THROW(cudf::external_sort({}, {}, {}, 1ul << 20), std::invalid_argument);
+  EXPECT_THROW(cudf::external_sort({0}, {}, {}, 0), std::invalid_argument);
+  EXPECT_THROW(cudf::external_sort({0}, {cudf::order::ASCENDING, cudf::order::ASCENDING}, {}, 1),
+               std::invalid_argument);
+
+  int32s_col ints{1, 2};
+  cudf::test::fixed_width_column_wrapper<int64_t> longs{1, 2};
+  auto out_of_range_sorter = cudf::external_sort({1}, {}, {}, 1ul << 20);
+  EXPECT_THROW(out_of_range_sorter.push(cudf::table_view{{ints}}), std::out_of_range);
+
+  auto sorter = cudf::external_sort({0}, {}, {}, 1ul << 20);
+  sorter.push(cudf::table_view{{ints}});
+  EXPECT_THROW(sorter.push(cudf::table_view{{longs}}), std::invalid_argument);
+  EXPECT_TRUE(sorter.has_next());
+  EXPECT_THROW(sorter.push(cudf::table_view{{ints}}), cudf::logic_error);
+}
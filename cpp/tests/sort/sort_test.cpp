@@ -1114,4 +1114,79 @@ TEST_F(SortDouble, InfinityAndNan)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+template <typename T>
+struct SortIntegerKeysTest : public cudf::test::BaseFixture {};
+
+using IntegerKeyTypes =
+  cudf::test::Concat<cudf::test::IntegralTypesNotBool, cudf::test::ChronoTypes>;
+
+TYPED_TEST_SUITE(SortIntegerKeysTest, IntegerKeyTypes);
+
+TYPED_TEST(SortIntegerKeysTest, MultipleColumnsWithNulls)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> col1{{3, 1, 3, 1, 2, 3}, {1, 1, 0, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<T, int32_t> col2{{2, 5, 1, 4, 4, 0}, {1, 1, 1, 0, 1, 1}};
+  cudf::table_view input{{col1, col2}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{2, 3, 1, 4, 0, 5}};
+  std::vector<cudf::order> column_order{cudf::order::ASCENDING, cudf::order::DESCENDING};
+  std::vector<cudf::null_order> null_precedence{cudf::null_order::BEFORE, cudf::null_order::AFTER};
+
+  auto got = cudf::sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  got = cudf::stable_sorted_order(input, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  run_sort_test(input, expected, column_order, null_precedence);
+}
+
+struct SortIntegerKeys : public cudf::test::BaseFixture {};
+
+TEST_F(SortIntegerKeys, SignedDescending)
+{
+  cudf::test::fixed_width_column_wrapper<int16_t> col1{-3, 5, -3, 0, 5};
+  cudf::test::fixed_width_column_wrapper<int32_t> col2{7, -1, -8, 2, -1};
+  cudf::table_view input{{col1, col2}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 4, 3, 2, 0}};
+  auto got =
+    cudf::stable_sorted_order(input, {cudf::order::DESCENDING, cudf::order::ASCENDING}, {});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(SortIntegerKeys, BoolAndNullsAfter)
+{
+  cudf::test::fixed_width_column_wrapper<bool> col1{true, false, true, false};
+  cudf::test::fixed_width_column_wrapper<int8_t> col2{{-1, 0, -2, 3}, {1, 0, 1, 1}};
+  cudf::table_view input{{col1, col2}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{3, 1, 2, 0}};
+  auto got = cudf::sorted_order(input, {}, {cudf::null_order::AFTER, cudf::null_order::AFTER});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(SortIntegerKeys, SingleColumnWithNulls)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col{{4, -2, 0, 9, -2}, {1, 1, 0, 1, 1}};
+  cudf::table_view input{{col}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{3, 0, 1, 4, 2}};
+  auto got =
+    cudf::stable_sorted_order(input, {cudf::order::DESCENDING}, {cudf::null_order::BEFORE});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+TEST_F(SortIntegerKeys, WiderThanKey)
+{
+  // The keys do not fit in 64 bits and are sorted with the row comparator
+  cudf::test::fixed_width_column_wrapper<int64_t> col1{{2, 0, 2}, {1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<int64_t> col2{1, 1, 0};
+  cudf::table_view input{{col1, col2}};
+
+  cudf::test::fixed_width_column_wrapper<int32_t> expected{{1, 2, 0}};
+  auto got = cudf::sorted_order(input);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
 CUDF_TEST_PROGRAM_MAIN()
@@ -300,3 +300,31 @@ TEST_F(StableSortDouble, InfinityAndNaN)
   auto results = stable_sorted_order(cudf::table_view({input}));
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
+
+struct StableSortStrings : public cudf::test::BaseFixture {};
+
+TEST_F(StableSortStrings, SharedPrefixes)
+{
+  cudf::test::strings_column_wrapper input({"https://example.com/b",
+                                            "https://example.com/a",
+                                            "",
+                                            "abc",
+                                            "https://example.com/a",
+                                            "https://example.co",
+                                            "",
+                                            "abcdefgh",
+                                            "abcdefghi"},
+                                           {1, 1, 0, 1, 1, 1, 1, 1, 1});
+
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{{2, 6, 3, 7, 8, 5, 1, 4, 0}};
+    auto got = cudf::stable_sorted_order(cudf::table_view({input}));
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  }
+  {
+    cudf::test::fixed_width_column_wrapper<int32_t> expected{{2, 0, 1, 4, 5, 8, 7, 3, 6}};
+    auto got = cudf::stable_sorted_order(
+      cudf::table_view({input}), {cudf::order::DESCENDING}, {cudf::null_order::AFTER});
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+  }
+}
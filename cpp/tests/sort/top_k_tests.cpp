@@ -0,0 +1,145 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/iterator_utilities.hpp>
+#include <cudf_test/table_utilities.hpp>
+#include <cudf_test/type_lists.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/sorting.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/types.hpp>
+
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/iterator/transform_iterator.h>
+
+#include <stdexcept>
+#include <vector>
+
+using int32s_col = cudf::test::fixed_width_column_wrapper<int32_t>;
+
+namespace {
+
+/**
+ * @brief Checks that `top_k_order` matches the first `k` rows of `stable_sorted_order`
+ */
+void expect_top_k_matches_sort(cudf::table_view const& keys,
+                               cudf::size_type k,
+                               std::vector<cudf::order> const& column_order         = {},
+                               std::vector<cudf::null_order> const& null_precedence = {})
+{
+  auto const sorted   = cudf::stable_sorted_order(keys, column_order, null_precedence);
+  auto const expected = cudf::slice(sorted->view(), {0, std::min(k, keys.num_rows())}).front();
+  auto const got      = cudf::top_k_order(keys, k, column_order, null_precedence);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->view());
+}
+
+}  // namespace
+
+template <typename T>
+struct TopKTypedTest : public cudf::test::BaseFixture {};
+
+TYPED_TEST_SUITE(TopKTypedTest, cudf::test::NumericTypes);
+
+TYPED_TEST(TopKTypedTest, Small)
+{
+  using T = TypeParam;
+
+  cudf::test::fixed_width_column_wrapper<T, int32_t> col{{5, 1, 4, 0, 3, 1, 2}};
+  auto const keys = cudf::table_view{{col}};
+
+  expect_top_k_matches_sort(keys, 3);
+  expect_top_k_matches_sort(keys, 3, {cudf::order::DESCENDING});
+  expect_top_k_matches_sort(keys, 7);
+  expect_top_k_matches_sort(keys, 10);
+}
+
+struct TopKTest : public cudf::test::BaseFixture {};
+
+TEST_F(TopKTest, SampledThreshold)
+{
+  // Enough rows so that the sampled threshold pass is taken, with many ties
+  auto const num_rows = 100'000;
+  auto const iter     = thrust::make_transform_iterator(thrust::counting_iterator<int32_t>(0),
+                                                    [](auto i) { return (i * 7919) % 1'000; });
+  int32s_col col(iter, iter + num_rows);
+  auto const keys = cudf::table_view{{col}};
+
+  expect_top_k_matches_sort(keys, 1);
+  expect_top_k_matches_sort(keys, 100);
+  expect_top_k_matches_sort(keys, 1'000, {cudf::order::DESCENDING});
+}
+
+TEST_F(TopKTest, SampledThresholdWithNulls)
+{
+  auto const num_rows = 100'000;
+  auto const iter     = thrust::make_transform_iterator(thrust::counting_iterator<int32_t>(0),
+                                                    [](auto i) { return (i * 7919) % 10'007; });
+  auto const validity = cudf::test::iterators::null_at(3);
+  int32s_col col1(iter, iter + num_rows, cudf::test::iterators::nulls_at({1, 5, 99, 512}));
+  int32s_col col2(iter, iter + num_rows, validity);
+  auto const keys = cudf::table_view{{col1, col2}};
+
+  expect_top_k_matches_sort(keys, 50, {}, {cudf::null_order::BEFORE, cudf::null_order::AFTER});
+  expect_top_k_matches_sort(keys,
+                            50,
+                            {cudf::order::DESCENDING, cudf::order::ASCENDING},
+                            {cudf::null_order::AFTER, cudf::null_order::AFTER});
+}
+
+TEST_F(TopKTest, Strings)
+{
+  cudf::test::strings_column_wrapper col({"d", "a", "", "c", "a", "b"}, {1, 1, 1, 1, 0, 1});
+  auto const keys = cudf::table_view{{col}};
+
+  expect_top_k_matches_sort(keys, 2);
+  expect_top_k_matches_sort(keys, 4, {cudf::order::DESCENDING}, {cudf::null_order::BEFORE});
+}
+
+TEST_F(TopKTest, TopKValues)
+{
+  int32s_col keys{3, 8, 1, 6, 8};
+  cudf::test::strings_column_wrapper values{"a", "b", "c", "d", "e"};
+
+  auto const got = cudf::top_k(cudf::table_view{{values}},
+                               cudf::table_view{{keys}},
+                               3,
+                               {cudf::order::DESCENDING});
+  cudf::test::strings_column_wrapper expected{"b", "e", "d"};
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, got->get_column(0));
+}
+
+TEST_F(TopKTest, Empty)
+{
+  int32s_col col{};
+  auto const keys = cudf::table_view{{col}};
+
+  EXPECT_EQ(cudf::top_k_order(keys, 5)->size(), 0);
+  EXPECT_EQ(cudf::top_k_order(cudf::table_view{{int32s_col{1, 2}}}, 0)->size(), 0);
+}
+
+TEST_F(TopKTest, Errors)
+{
+  int32s_col keys{1, 2, 3};
+  int32s_col values{1, 2};
+
+  EXPECT_THROW(cudf::top_k_order(cudf::table_view{{keys}}, -1), std::invalid_argument);
+  EXPECT_THROW(cudf::top_k(cudf::table_view{{values}}, cudf::table_view{{keys}}, 1),
+               cudf::logic_error);
+}
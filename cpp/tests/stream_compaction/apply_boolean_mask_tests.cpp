@@ -22,6 +22,7 @@
 #include <cudf_test/testing_main.hpp>
 #include <cudf_test/type_lists.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/copying.hpp>
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/null_mask.hpp>
@@ -31,10 +32,16 @@
 #include <cudf/types.hpp>
 #include <cudf/utilities/default_stream.hpp>
 
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+
 #include <thrust/copy.h>
 #include <thrust/execution_policy.h>
 #include <thrust/functional.h>
 
+#include <cstddef>
+#include <vector>
+
 struct ApplyBooleanMask : public cudf::test::BaseFixture {};
 
 TEST_F(ApplyBooleanMask, NonNullBooleanMask)
@@ -375,4 +382,120 @@ TEST_F(ApplyBooleanMask, StructOfListsFiltering)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(filtered_lists_column, expected_structs_column);
 }
 
+TEST_F(ApplyBooleanMask, FilterGather)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70, 5, 2, 10, 8, 3},
+                                                       {1, 1, 0, 1, 1, 0, 1, 1}};
+  cudf::test::strings_column_wrapper col2{{"a", "bb", "", "ccc", "d", "ee", "f", "gggg"},
+                                          {1, 0, 1, 1, 1, 1, 1, 1}};
+  cudf::table_view input{{col1, col2}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{
+    {true, true, false, true, true, false, true, true}, {1, 1, 1, 0, 1, 1, 1, 1}};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{4, 0, 2, 2, 1, 3};
+
+  auto got = cudf::filter_gather(input, gather_map, boolean_mask);
+  auto expected =
+    cudf::gather(cudf::apply_boolean_mask(input, boolean_mask)->view(), gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+
+  cudf::test::fixed_width_column_wrapper<int64_t> nullify_map{4, -1, 5, 0, 100};
+  got = cudf::filter_gather(
+    input, nullify_map, boolean_mask, cudf::out_of_bounds_policy::NULLIFY);
+  expected = cudf::gather(cudf::apply_boolean_mask(input, boolean_mask)->view(),
+                          nullify_map,
+                          cudf::out_of_bounds_policy::NULLIFY);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+
+  // many fixed-width columns are gathered together
+  std::vector<cudf::column_view> columns(8, col1);
+  auto const wide = cudf::table_view(columns);
+  got             = cudf::filter_gather(wide, gather_map, boolean_mask);
+  expected        = cudf::gather(cudf::apply_boolean_mask(wide, boolean_mask)->view(), gather_map);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected->view(), got->view());
+}
+
+TEST_F(ApplyBooleanMask, FilterGatherErrors)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> col1{{10, 40, 70}};
+  cudf::table_view input{{col1}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true}};
+  cudf::test::fixed_width_column_wrapper<int32_t> gather_map{1, 0};
+  cudf::test::fixed_width_column_wrapper<int32_t> wrong_mask{{1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> short_mask{{true, false}};
+  cudf::test::fixed_width_column_wrapper<int32_t> null_map{{1, 0}, {1, 0}};
+
+  EXPECT_THROW(cudf::filter_gather(input, gather_map, wrong_mask), cudf::logic_error);
+  EXPECT_THROW(cudf::filter_gather(input, gather_map, short_mask), cudf::logic_error);
+  EXPECT_THROW(cudf::filter_gather(input, null_map, boolean_mask), cudf::logic_error);
+}
+
+TEST_F(ApplyBooleanMask, FixedCapacity)
+{
+  auto const stream = cudf::get_default_stream();
+
+  auto const expect_filtered = [&](cudf::column_view const& input,
+                                   cudf::column_view const& boolean_mask) {
+    auto output = cudf::make_fixed_width_column(input.type(), input.size());
+    rmm::device_scalar<cudf::size_type> output_size(stream);
+    rmm::device_uvector<std::byte> temp_storage(
+      cudf::apply_boolean_mask_temp_storage_size(input.type(), input.size()), stream);
+    cudf::apply_boolean_mask(
+      input, boolean_mask, output->mutable_view(), output_size.data(), temp_storage, stream);
+
+    auto const expected = cudf::apply_boolean_mask(cudf::table_view{{input}}, boolean_mask);
+    auto const got      = cudf::slice(output->view(), {0, output_size.value(stream)}).front();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0), got);
+  };
+
+  cudf::test::fixed_width_column_wrapper<int32_t> ints{10, 40, 70, 5, 2, 10, 8, 3};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{
+    {true, true, false, true, true, false, true, true}, {1, 1, 1, 0, 1, 1, 1, 1}};
+  expect_filtered(ints, boolean_mask);
+  expect_filtered(cudf::slice(ints, {3, 8}).front(), cudf::slice(boolean_mask, {1, 6}).front());
+
+  cudf::test::fixed_width_column_wrapper<double> doubles{1.5, -2., 3.25, 0., 8., 1e10, -7., 2.};
+  expect_filtered(doubles, boolean_mask);
+  cudf::test::fixed_point_column_wrapper<__int128_t> decimals{{1, 2, 3, 4, 5, 6, 7, 8},
+                                                              numeric::scale_type{-2}};
+  expect_filtered(decimals, boolean_mask);
+  cudf::test::fixed_width_column_wrapper<bool> none{
+    {false, false, false, false, false, false, false, false}};
+  expect_filtered(ints, none);
+  cudf::test::fixed_width_column_wrapper<int32_t> empty{};
+  cudf::test::fixed_width_column_wrapper<bool> empty_mask{};
+  expect_filtered(empty, empty_mask);
+}
+
+TEST_F(ApplyBooleanMask, FixedCapacityErrors)
+{
+  auto const stream = cudf::get_default_stream();
+  cudf::test::fixed_width_column_wrapper<int32_t> input{{10, 40, 70}};
+  cudf::test::fixed_width_column_wrapper<int32_t> nullable{{10, 40, 70}, {1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> boolean_mask{{true, false, true}};
+  cudf::test::fixed_width_column_wrapper<int32_t> wrong_mask{{1, 0, 1}};
+  cudf::test::fixed_width_column_wrapper<bool> short_mask{{true, false}};
+  cudf::test::strings_column_wrapper strings{"a", "b", "c"};
+
+  auto output       = cudf::make_fixed_width_column(cudf::column_view{input}.type(), 3);
+  auto short_output = cudf::make_fixed_width_column(cudf::column_view{input}.type(), 2);
+  auto wrong_output = cudf::make_fixed_width_column(cudf::data_type{cudf::type_id::INT64}, 3);
+  rmm::device_scalar<cudf::size_type> output_size(stream);
+  rmm::device_uvector<std::byte> temp_storage(
+    cudf::apply_boolean_mask_temp_storage_size(cudf::column_view{input}.type(), 3), stream);
+  auto const filter = [&](cudf::column_view const& in,
+                          cudf::column_view const& mask,
+                          cudf::mutable_column_view const& out,
+                          cudf::device_span<std::byte> temp) {
+    cudf::apply_boolean_mask(in, mask, out, output_size.data(), temp, stream);
+  };
+
+  EXPECT_THROW(filter(nullable, boolean_mask, *output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(strings, boolean_mask, *output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(input, wrong_mask, *output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(input, short_mask, *output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(input, boolean_mask, *short_output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(input, boolean_mask, *wrong_output, temp_storage), cudf::logic_error);
+  EXPECT_THROW(filter(input, boolean_mask, *output, {}), cudf::logic_error);
+}
+
 CUDF_TEST_PROGRAM_MAIN()
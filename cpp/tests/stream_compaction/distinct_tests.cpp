@@ -21,6 +21,7 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/copying.hpp>
+#include <cudf/hashing.hpp>
 #include <cudf/sorting.hpp>
 #include <cudf/stream_compaction.hpp>
 #include <cudf/table/table.hpp>
@@ -28,6 +29,7 @@
 #include <cudf/types.hpp>
 
 #include <cmath>
+#include <stdexcept>
 
 auto constexpr null{0};  // null at current level
 auto constexpr XXX{0};   // null pushed down from parent level
@@ -58,6 +60,10 @@ struct DistinctKeepAny : public cudf::test::BaseFixture {};
 
 struct DistinctKeepFirstLastNone : public cudf::test::BaseFixture {};
 
+struct DistinctOptions : public cudf::test::BaseFixture {};
+
+struct DistinctByExtremum : public cudf::test::BaseFixture {};
+
 TEST_F(DistinctKeepAny, StringKeyColumn)
 {
   // Column(s) used to test KEEP_ANY needs to have same rows for same keys because KEEP_ANY is
@@ -1412,3 +1418,140 @@ TEST_F(DistinctKeepAny, SlicedStructsOfLists)
   auto const result_sort = cudf::sort_by_key(*result, result->select({0}));
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected_sort, *result_sort);
 }
+
+TEST_F(DistinctOptions, PrecomputedRowHashes)
+{
+  auto const col = int32s_col{{0, null, 2, 3, 4, 5, 6, 7}, null_at(1)};
+  auto const keys =
+    strings_col{{"all", "new", "new", "all", "" /*NULL*/, "the", "strings", ""}, null_at(4)};
+  auto const input   = cudf::table_view{{col, keys}};
+  auto const key_idx = std::vector<cudf::size_type>{1};
+
+  auto const hashes = cudf::hashing::murmurhash3_x86_32(input.select(key_idx));
+  auto options      = cudf::distinct_options{};
+  options.set_row_hashes(*hashes);
+
+  for (auto const keep : {KEEP_FIRST, KEEP_LAST, KEEP_NONE}) {
+    auto const expected = cudf::distinct(input, key_idx, keep);
+    auto const result   = cudf::distinct(input, key_idx, options, keep);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*cudf::sort_by_key(*expected, expected->select({0})),
+                                  *cudf::sort_by_key(*result, result->select({0})));
+
+    auto const stable_expected = cudf::stable_distinct(input, key_idx, keep);
+    auto const stable_result   = cudf::stable_distinct(input, key_idx, options, keep);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(*stable_expected, *stable_result);
+  }
+}
+
+TEST_F(DistinctOptions, SortedKeys)
+{
+  auto const col     = int32s_col{{0, 1, 2, 3, 4, 5, 6, 7}, null_at(5)};
+  auto const keys    = int32s_col{{1, 1, 2, 3, 3, 3, 5, null}, null_at(7)};
+  auto const input   = cudf::table_view{{col, keys}};
+  auto const key_idx = std::vector<cudf::size_type>{1};
+
+  auto options = cudf::distinct_options{};
+  options.set_keys_are_sorted(true);
+
+  // KEEP_FIRST
+  {
+    auto const exp_col  = int32s_col{0, 2, 3, 6, 7};
+    auto const exp_keys = int32s_col{{1, 2, 3, 5, null}, null_at(4)};
+    auto const expected = cudf::table_view{{exp_col, exp_keys}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::distinct(input, key_idx, options, KEEP_FIRST));
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected,
+                                  *cudf::stable_distinct(input, key_idx, options, KEEP_FIRST));
+  }
+
+  // KEEP_LAST
+  {
+    auto const exp_col  = int32s_col{{1, 2, 5, 6, 7}, null_at(2)};
+    auto const exp_keys = int32s_col{{1, 2, 3, 5, null}, null_at(4)};
+    auto const expected = cudf::table_view{{exp_col, exp_keys}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::distinct(input, key_idx, options, KEEP_LAST));
+  }
+
+  // KEEP_NONE
+  {
+    auto const exp_col  = int32s_col{2, 6, 7};
+    auto const exp_keys = int32s_col{{2, 5, null}, null_at(2)};
+    auto const expected = cudf::table_view{{exp_col, exp_keys}};
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::distinct(input, key_idx, options, KEEP_NONE));
+  }
+}
+
+TEST_F(DistinctOptions, InvalidRowHashes)
+{
+  auto const keys  = int32s_col{1, 1, 2};
+  auto const input = cudf::table_view{{keys}};
+
+  auto options = cudf::distinct_options{};
+  EXPECT_THROW(options.set_row_hashes(keys), std::invalid_argument);
+
+  auto const hashes = cudf::test::fixed_width_column_wrapper<uint32_t>{1, 1};
+  options.set_row_hashes(hashes);
+  EXPECT_THROW(cudf::distinct(input, {0}, options), std::invalid_argument);
+}
+
+TEST_F(DistinctByExtremum, LatestRecordPerKey)
+{
+  auto const keys     = strings_col{{"a", "b", "a", "b", "a", "" /*NULL*/, "c", ""}, null_at(5)};
+  auto const ts       = int32s_col{{5, 3, 9, 4, 7, 1, null, 2}, null_at(6)};
+  auto const payload  = int32s_col{0, 1, 2, 3, 4, 5, 6, 7};
+  auto const input    = cudf::table_view{{keys, ts, payload}};
+  auto const key_idx  = std::vector<cudf::size_type>{0};
+  auto const order_by = input.column(1);
+
+  // MAX
+  {
+    auto const exp_keys    = strings_col{{"" /*NULL*/, "", "a", "b", "c"}, null_at(0)};
+    auto const exp_ts      = int32s_col{{1, 2, 9, 4, null}, null_at(4)};
+    auto const exp_payload = int32s_col{5, 7, 2, 3, 6};
+    auto const expected    = cudf::table_view{{exp_keys, exp_ts, exp_payload}};
+
+    auto const result =
+      cudf::distinct_by_extremum(input, key_idx, order_by, cudf::keep_extremum::MAX);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::sort_by_key(*result, result->select({0})));
+  }
+
+  // MIN
+  {
+    auto const exp_keys    = strings_col{{"" /*NULL*/, "", "a", "b", "c"}, null_at(0)};
+    auto const exp_ts      = int32s_col{{1, 2, 5, 3, null}, null_at(4)};
+    auto const exp_payload = int32s_col{5, 7, 0, 1, 6};
+    auto const expected    = cudf::table_view{{exp_keys, exp_ts, exp_payload}};
+
+    auto const result =
+      cudf::distinct_by_extremum(input, key_idx, order_by, cudf::keep_extremum::MIN);
+    CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::sort_by_key(*result, result->select({0})));
+  }
+}
+
+TEST_F(DistinctByExtremum, TiesAndNulls)
+{
+  auto const keys     = int32s_col{1, 1, 1, 2, 2, 3, 3};
+  auto const order_by = floats_col{{2.f, 2.f, 1.f, 0.f, 0.f, NaN, 5.f}, nulls_at({3, 4})};
+  auto const payload  = int32s_col{0, 1, 2, 3, 4, 5, 6};
+  auto const input    = cudf::table_view{{keys, payload}};
+
+  // Ties keep the first row, a group of nulls keeps its first row and NaN is the largest value
+  auto const exp_keys    = int32s_col{1, 2, 3};
+  auto const exp_payload = int32s_col{0, 3, 5};
+  auto const expected    = cudf::table_view{{exp_keys, exp_payload}};
+
+  auto const result = cudf::distinct_by_extremum(input, {0}, order_by, cudf::keep_extremum::MAX);
+  CUDF_TEST_EXPECT_TABLES_EQUAL(expected, *cudf::sort_by_key(*result, result->select({0})));
+}
+
+TEST_F(DistinctByExtremum, InvalidOrderingColumn)
+{
+  auto const keys  = int32s_col{1, 1, 2};
+  auto const input = cudf::table_view{{keys}};
+
+  EXPECT_THROW(
+    cudf::distinct_by_extremum(input, {0}, int32s_col{1, 2}, cudf::keep_extremum::MAX),
+    std::invalid_argument);
+  EXPECT_THROW(
+    cudf::distinct_by_extremum(input, {0}, strings_col{"a", "b", "c"}, cudf::keep_extremum::MAX),
+    cudf::data_type_error);
+}
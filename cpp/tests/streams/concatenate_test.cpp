@@ -40,6 +40,22 @@ TEST_F(ConcatenateTest, Table)
   auto result = cudf::concatenate(views, cudf::test::get_default_stream());
 }
 
+TEST_F(ConcatenateTest, TableMixedColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int> const ints1({0, 1, 2}, {1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int> const ints2({3, 4}, {1, 1});
+  cudf::test::fixed_width_column_wrapper<double> const doubles1({0., 1., 2.});
+  cudf::test::fixed_width_column_wrapper<double> const doubles2({3., 4.});
+  cudf::test::strings_column_wrapper const strings1({"a", "bb", "ccc"});
+  cudf::test::strings_column_wrapper const strings2({"", "e"}, {0, 1});
+  cudf::test::lists_column_wrapper<int> const lists1{{1, 2}, {}, {3}};
+  cudf::test::lists_column_wrapper<int> const lists2{{4}, {5, 6}};
+  cudf::table_view tbl1({ints1, doubles1, strings1, lists1});
+  cudf::table_view tbl2({ints2, doubles2, strings2, lists2});
+  std::vector<cudf::table_view> views{tbl1, tbl2};
+  auto result = cudf::concatenate(views, cudf::test::get_default_stream());
+}
+
 TEST_F(ConcatenateTest, Masks)
 {
   cudf::test::fixed_width_column_wrapper<int> const input1(
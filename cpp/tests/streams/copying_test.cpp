@@ -43,6 +43,21 @@ TEST_F(CopyingTest, Gather)
                cudf::test::get_default_stream());
 }
 
+TEST_F(CopyingTest, GatherMixedColumns)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints({1, 2, 3, 4}, {1, 0, 1, 1});
+  cudf::test::strings_column_wrapper const strings({"a", "bb", "", "dddd"}, {1, 1, 0, 1});
+  cudf::test::lists_column_wrapper<int32_t> const lists{{1, 2}, {}, {3}, {4, 5, 6}};
+  cudf::test::fixed_width_column_wrapper<int32_t> const gather_map({3, 0, 2, 1});
+
+  cudf::table_view source_table({ints, strings, lists});
+
+  cudf::gather(source_table,
+               gather_map,
+               cudf::out_of_bounds_policy::NULLIFY,
+               cudf::test::get_default_stream());
+}
+
 TEST_F(CopyingTest, ReverseTable)
 {
   constexpr cudf::size_type num_values{10};
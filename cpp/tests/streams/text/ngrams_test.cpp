@@ -48,6 +48,17 @@ TEST_F(TextNGramsTest, HashCharacterNgrams)
     cudf::strings_column_view(input), 5, cudf::test::get_default_stream());
 }
 
+TEST_F(TextNGramsTest, HashNgramFeatures)
+{
+  auto input =
+    cudf::test::strings_column_wrapper({"the quick brown fox", "jumped over the lazy dog."});
+  auto const delimiter = cudf::string_scalar{"", true, cudf::test::get_default_stream()};
+  nvtext::hash_character_ngram_features(
+    cudf::strings_column_view(input), 5, 1024, true, cudf::test::get_default_stream());
+  nvtext::hash_word_ngram_features(
+    cudf::strings_column_view(input), 2, delimiter, 1024, true, cudf::test::get_default_stream());
+}
+
 TEST_F(TextNGramsTest, NgramsTokenize)
 {
   auto input =
@@ -20,6 +20,8 @@
 
 #include <nvtext/tokenize.hpp>
 
+#include <vector>
+
 class TextTokenizeTest : public cudf::test::BaseFixture {};
 
 TEST_F(TextTokenizeTest, Tokenize)
@@ -51,3 +53,17 @@ TEST_F(TextTokenizeTest, Detokenize)
   auto const separator = cudf::string_scalar{" ", true, cudf::test::get_default_stream()};
   nvtext::detokenize(view, indices, separator, cudf::test::get_default_stream());
 }
+
+TEST_F(TextTokenizeTest, TokenizeWithVocabulary)
+{
+  auto const vocabulary = cudf::test::strings_column_wrapper({"hello", "there", "world"});
+  auto const vocab      = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary),
+                                             cudf::test::get_default_stream());
+
+  auto const input1 = cudf::test::strings_column_wrapper({"hello world", "hello there"});
+  auto const input2 = cudf::test::strings_column_wrapper({"there there world", "watch out world"});
+  auto const inputs = std::vector<cudf::strings_column_view>{cudf::strings_column_view(input1),
+                                                             cudf::strings_column_view(input2)};
+  auto const delimiter = cudf::string_scalar{" ", true, cudf::test::get_default_stream()};
+  nvtext::tokenize_with_vocabulary(inputs, *vocab, delimiter, -1, cudf::test::get_default_stream());
+}
@@ -20,6 +20,8 @@
 
 #include <cudf/unary.hpp>
 
+#include <vector>
+
 class UnaryTest : public cudf::test::BaseFixture {};
 
 TEST_F(UnaryTest, UnaryOperation)
@@ -50,6 +52,19 @@ TEST_F(UnaryTest, Cast)
   cudf::cast(column, cudf::data_type{cudf::type_id::INT64}, cudf::test::get_default_stream());
 }
 
+TEST_F(UnaryTest, CastTable)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> const ints{10, 20, 30, 40, 50};
+  cudf::test::fixed_width_column_wrapper<float> const floats({1.f, 2.f, 3.f, 4.f, 5.f},
+                                                             {1, 0, 1, 1, 1});
+  cudf::test::strings_column_wrapper const strings{"a", "b", "c", "d", "e"};
+  auto const types = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT64},
+                                                  cudf::data_type{cudf::type_id::FLOAT64},
+                                                  cudf::data_type{cudf::type_id::STRING}};
+
+  cudf::cast(cudf::table_view({ints, floats, strings}), types, cudf::test::get_default_stream());
+}
+
 TEST_F(UnaryTest, IsNan)
 {
   cudf::test::fixed_width_column_wrapper<float> const column{10, 20, 30, 40, 50};
@@ -415,6 +415,36 @@ TEST_F(StringsContainsTests, CountTest)
   }
 }
 
+TEST_F(StringsContainsTests, RequiredLiteral)
+{
+  // the rows include non-ASCII characters so the instructions are evaluated
+  auto input = cudf::test::strings_column_wrapper({"ERROR: é timeout user_id=12 user_id=3",
+                                                   "ERROR: é time out user_id=",
+                                                   "timeout ERROR é userid=5",
+                                                   "ERROR timeout timeout é user_id=7é abdx",
+                                                   "",
+                                                   "abcx abx é"});
+  auto view  = cudf::strings_column_view(input);
+
+  auto prog     = cudf::strings::regex_program::create("ERROR.*timeout");
+  auto results  = cudf::strings::count_re(view, *prog);
+  auto expected = cudf::test::fixed_width_column_wrapper<int32_t>({1, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  auto expected_contains = cudf::test::fixed_width_column_wrapper<bool>({1, 0, 0, 1, 0, 0});
+  results                = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_contains);
+
+  prog     = cudf::strings::regex_program::create("user_id=(\\d+)");
+  results  = cudf::strings::count_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<int32_t>({2, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  prog     = cudf::strings::regex_program::create("(abc|abd)x");
+  results  = cudf::strings::count_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<int32_t>({0, 0, 0, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(StringsContainsTests, FixedQuantifier)
 {
   auto input = cudf::test::strings_column_wrapper({"a", "aa", "aaa", "aaaa", "aaaaa", "aaaaaa"});
@@ -708,6 +738,65 @@ TEST_F(StringsContainsTests, ASCII)
   }
 }
 
+TEST_F(StringsContainsTests, MixedASCII)
+{
+  // rows with non-ASCII characters are matched without the automaton
+  auto input = cudf::test::strings_column_wrapper(
+    {"the cat sat", "concat", "cat", "é cat", "catégorie", "", "", "cat\n"},
+    {true, true, true, true, true, false, true, true});
+  auto view = cudf::strings_column_view(input);
+
+  auto prog     = cudf::strings::regex_program::create("\\bcat\\b$");
+  auto results  = cudf::strings::contains_re(view, *prog);
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>(
+    {0, 0, 1, 1, 0, 0, 0, 1}, {true, true, true, true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  results  = cudf::strings::matches_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>(
+    {0, 0, 1, 0, 0, 0, 0, 1}, {true, true, true, true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  prog     = cudf::strings::regex_program::create("\\bcat\\b");
+  results  = cudf::strings::contains_re(view, *prog);
+  expected = cudf::test::fixed_width_column_wrapper<bool>(
+    {1, 0, 1, 1, 0, 0, 0, 1}, {true, true, true, true, true, false, true, true});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringsContainsTests, ManyRowsMultiLine)
+{
+  auto const size = 3000;
+  auto rows = cudf::detail::make_counting_transform_iterator(0, [](auto idx) -> std::string {
+    switch (idx % 3) {
+      case 0: return "abc12";
+      case 1: return "xyz\nab34";
+      default: return "é56";
+    }
+  });
+  auto input = cudf::test::strings_column_wrapper(rows, rows + size);
+  auto view  = cudf::strings_column_view(input);
+
+  auto pattern = std::string("^[a-z]+\\d{2}$");
+  auto prog    = cudf::strings::regex_program::create(pattern);
+  auto prog_ml =
+    cudf::strings::regex_program::create(pattern, cudf::strings::regex_flags::MULTILINE);
+
+  auto expected_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto idx) { return idx % 3 == 0; });
+  auto expected = cudf::test::fixed_width_column_wrapper<bool>(expected_iter, expected_iter + size);
+  auto results  = cudf::strings::contains_re(view, *prog);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+  results = cudf::strings::matches_re(view, *prog_ml);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  auto expected_ml_iter =
+    cudf::detail::make_counting_transform_iterator(0, [](auto idx) { return idx % 3 != 2; });
+  expected =
+    cudf::test::fixed_width_column_wrapper<bool>(expected_ml_iter, expected_ml_iter + size);
+  results = cudf::strings::contains_re(view, *prog_ml);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
 TEST_F(StringsContainsTests, MediumRegex)
 {
   // This results in 95 regex instructions and falls in the 'medium' range.
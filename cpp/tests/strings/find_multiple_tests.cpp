@@ -25,6 +25,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <string>
 #include <vector>
 
 struct StringsFindMultipleTest : public cudf::test::BaseFixture {};
@@ -80,3 +81,72 @@ TEST_F(StringsFindMultipleTest, ErrorTest)
   // targets cannot have nulls
   EXPECT_THROW(cudf::strings::find_multiple(strings_view, strings_view), cudf::logic_error);
 }
+
+TEST_F(StringsFindMultipleTest, ContainsAny)
+{
+  std::vector<char const*> h_strings{"Héllo", "thesé", nullptr, "lease", "test strings", ""};
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  cudf::test::strings_column_wrapper targets({"ing", "sé", "ase", "xyz", "llo", "ll"});
+  auto targets_view = cudf::strings_column_view(targets);
+
+  auto results = cudf::strings::contains_any(strings_view, targets_view);
+  cudf::test::fixed_width_column_wrapper<bool> expected({1, 1, 0, 1, 1, 0},
+                                                        {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::find_any(strings_view, targets_view);
+  cudf::test::fixed_width_column_wrapper<int32_t> expected_index({4, 1, 0, 2, 0, -1},
+                                                                 {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_index);
+
+  // overlapping targets found through the failure links
+  cudf::test::strings_column_wrapper overlaps({"blah", "tesx", "est", "sé"});
+  results = cudf::strings::find_any(strings_view, cudf::strings_column_view(overlaps));
+  expected_index =
+    cudf::test::fixed_width_column_wrapper<int32_t>({-1, 3, 0, -1, 2, -1}, {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_index);
+
+  // an empty target is found in every string
+  cudf::test::strings_column_wrapper with_empty({"xyz", ""});
+  results = cudf::strings::contains_any(strings_view, cudf::strings_column_view(with_empty));
+  expected =
+    cudf::test::fixed_width_column_wrapper<bool>({1, 1, 0, 1, 1, 1}, {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, ContainsAnyManyTargets)
+{
+  auto const targets_count = 2000;
+  std::vector<std::string> h_targets(targets_count);
+  for (auto idx = 0; idx < targets_count; ++idx) {
+    h_targets[idx] = "key" + std::to_string(idx) + ";";
+  }
+  cudf::test::strings_column_wrapper targets(h_targets.begin(), h_targets.end());
+
+  cudf::test::strings_column_wrapper strings(
+    {"key1999;", "a key12 key120; key1;", "key;", "key2000;", "key5;key05;"});
+  auto results =
+    cudf::strings::find_any(cudf::strings_column_view(strings), cudf::strings_column_view(targets));
+  cudf::test::fixed_width_column_wrapper<int32_t> expected({1999, 1, -1, -1, 5});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsFindMultipleTest, ContainsAnyErrors)
+{
+  cudf::test::strings_column_wrapper strings({"this string intentionally left blank"}, {0});
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
+  auto empty_view                     = cudf::strings_column_view(zero_size_strings_column);
+  EXPECT_THROW(cudf::strings::contains_any(strings_view, empty_view), cudf::logic_error);
+  EXPECT_THROW(cudf::strings::find_any(strings_view, strings_view), cudf::logic_error);
+
+  cudf::test::strings_column_wrapper targets({"a"});
+  auto results = cudf::strings::contains_any(empty_view, cudf::strings_column_view(targets));
+  EXPECT_EQ(results->size(), 0);
+}
@@ -20,6 +20,7 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/attributes.hpp>
 #include <cudf/strings/find.hpp>
@@ -141,6 +142,26 @@ TEST_F(StringsFindTest, FindLongStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(StringsFindTest, FindSlicedLongStrings)
+{
+  // the long rows are only processed with a warp per string when the slice is measured
+  cudf::test::strings_column_wrapper input(
+    {"a", "b", "c", "d", "e", "f", "g", "h", "i", "j", "k", "l", "m", "n", "o", "p",
+     "quick brown fox jumped over the lazy brown dog; the fat cats jump in place without moving",
+     "the following code snippet demonstrates how to use search for values in an ordered range",
+     "it returns the last position where value could be inserted without violating the ordering"});
+  auto sliced = cudf::slice(input, {16, 19}).front();
+  auto view   = cudf::strings_column_view(sliced);
+
+  auto results  = cudf::strings::find(view, cudf::string_scalar("the"));
+  auto expected = cudf::test::fixed_width_column_wrapper<cudf::size_type>({28, 0, 11});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  auto results_contains  = cudf::strings::contains(view, cudf::string_scalar("ing"));
+  auto expected_contains = cudf::test::fixed_width_column_wrapper<bool>({1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results_contains, expected_contains);
+}
+
 TEST_F(StringsFindTest, Contains)
 {
   cudf::test::strings_column_wrapper strings(
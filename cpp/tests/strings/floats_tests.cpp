@@ -24,6 +24,7 @@
 
 #include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
 #include <vector>
 
 struct StringsConvertTest : public cudf::test::BaseFixture {};
@@ -154,6 +155,23 @@ TEST_F(StringsConvertTest, ToFloats64)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, is_expected);
 }
 
+TEST_F(StringsConvertTest, TryToFloats)
+{
+  auto const strings = cudf::test::strings_column_wrapper(
+    {"1234", "", "-876.5", "", "abc", "1.5e3", "1.2.3", "-Inf", "0.25", "12-3"},
+    {1, 0, 1, 1, 1, 1, 1, 1, 1, 1});
+  auto const view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::try_to_floats(view, cudf::data_type{cudf::type_id::FLOAT64});
+  auto const inf      = std::numeric_limits<double>::infinity();
+  auto const expected = cudf::test::fixed_width_column_wrapper<double>(
+    {1234.0, 0.0, -876.5, 0.0, 0.0, 1500.0, 0.0, -inf, 0.25, 0.0}, {1, 0, 1, 0, 0, 1, 0, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+
+  EXPECT_THROW(cudf::strings::try_to_floats(view, cudf::data_type{cudf::type_id::INT32}),
+               cudf::logic_error);
+}
+
 TEST_F(StringsConvertTest, FromFloats64)
 {
   std::vector<double> h_floats{100,
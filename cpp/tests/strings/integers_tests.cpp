@@ -29,6 +29,7 @@
 #include <thrust/host_vector.h>
 #include <thrust/iterator/transform_iterator.h>
 
+#include <limits>
 #include <string>
 #include <vector>
 
@@ -236,6 +237,73 @@ TEST_F(StringsConvertTest, ToInteger)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected_u32);
 }
 
+TEST_F(StringsConvertTest, TryToInteger)
+{
+  auto const strings = cudf::test::strings_column_wrapper({"1234",
+                                                           "",
+                                                           "-9832",
+                                                           "",
+                                                           "+7",
+                                                           "93.24",
+                                                           "12345678901234567",
+                                                           "-9223372036854775808",
+                                                           "9223372036854775808",
+                                                           "-",
+                                                           "00000000000000000042",
+                                                           "18446744073709551615",
+                                                           "1234567a"},
+                                                          {1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1});
+  auto const view    = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::try_to_integers(view, cudf::data_type{cudf::type_id::INT64});
+  auto const expected_i64 = cudf::test::fixed_width_column_wrapper<int64_t>(
+    {1234L,
+     0L,
+     -9832L,
+     0L,
+     7L,
+     0L,
+     12345678901234567L,
+     std::numeric_limits<int64_t>::min(),
+     0L,
+     0L,
+     42L,
+     0L,
+     0L},
+    {1, 0, 1, 0, 1, 0, 1, 1, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_i64);
+
+  results = cudf::strings::try_to_integers(view, cudf::data_type{cudf::type_id::UINT64});
+  auto const expected_u64 = cudf::test::fixed_width_column_wrapper<uint64_t>(
+    {1234UL,
+     0UL,
+     0UL,
+     0UL,
+     7UL,
+     0UL,
+     12345678901234567UL,
+     0UL,
+     9223372036854775808UL,
+     0UL,
+     42UL,
+     std::numeric_limits<uint64_t>::max(),
+     0UL},
+    {1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_u64);
+
+  results = cudf::strings::try_to_integers(view, cudf::data_type{cudf::type_id::INT16});
+  auto const expected_i16 = cudf::test::fixed_width_column_wrapper<int16_t>(
+    {1234, 0, -9832, 0, 7, 0, 0, 0, 0, 0, 42, 0, 0}, {1, 0, 1, 0, 1, 0, 0, 0, 0, 0, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected_i16);
+
+  EXPECT_THROW(cudf::strings::try_to_integers(view, cudf::data_type{cudf::type_id::FLOAT32}),
+               cudf::logic_error);
+  auto const empty = cudf::make_empty_column(cudf::type_id::STRING);
+  results          = cudf::strings::try_to_integers(cudf::strings_column_view(empty->view()),
+                                           cudf::data_type{cudf::type_id::INT32});
+  EXPECT_EQ(results->size(), 0);
+}
+
 TEST_F(StringsConvertTest, FromInteger)
 {
   int32_t minint = std::numeric_limits<int32_t>::min();
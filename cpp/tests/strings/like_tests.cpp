@@ -162,6 +162,45 @@ TEST_F(StringsLikeTests, Escape)
   }
 }
 
+TEST_F(StringsLikeTests, Shapes)
+{
+  auto const long_str = std::string(200, 'x') + "needle" + std::string(100, 'y');
+  cudf::test::strings_column_wrapper input(
+    {"aba", "abba", "ab", "ba", long_str.c_str(), "", "ab", "áéêú"}, {1, 1, 1, 1, 1, 1, 0, 1});
+  auto const sv = cudf::strings_column_view(input);
+  {
+    // the start and end pieces must not overlap
+    auto const results = cudf::strings::like(sv, std::string("ab%ba"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, true, false, false, false, false, false, false}, {1, 1, 1, 1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%%needle%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, true, false, false, false}, {1, 1, 1, 1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {true, true, true, true, true, true, false, true}, {1, 1, 1, 1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%êú"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, false, false, true}, {1, 1, 1, 1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+  {
+    auto const results = cudf::strings::like(sv, std::string("%b\\%"), std::string("\\"));
+    cudf::test::fixed_width_column_wrapper<bool> expected(
+      {false, false, false, false, false, false, false, false}, {1, 1, 1, 1, 1, 1, 0, 1});
+    CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+  }
+}
+
 TEST_F(StringsLikeTests, MultiplePatterns)
 {
   cudf::test::strings_column_wrapper input({"abc", "a1a2b3b4c", "aaabbb", "bbbc", "", "áéêú"});
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/strings/case.hpp>
+#include <cudf/strings/pipeline.hpp>
+#include <cudf/strings/replace.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+#include <cudf/strings/strip.hpp>
+
+struct StringsPipelineTest : public cudf::test::BaseFixture {};
+
+TEST_F(StringsPipelineTest, LowerStripReplace)
+{
+  auto input = cudf::test::strings_column_wrapper(
+    {"  Hello World  ", " ABC_abc ", "", "   ", "ÀÉÎ_ÕÜ ", "Straße", "null"},
+    {1, 1, 1, 1, 1, 1, 0});
+  auto const sv = cudf::strings_column_view(input);
+
+  auto const pipeline = cudf::strings::transform_pipeline().to_lower().strip().replace(
+    {"_", "l", "ab"}, {" ", "L", ""});
+  auto const results = cudf::strings::apply_pipeline(sv, pipeline);
+
+  auto const lower    = cudf::strings::to_lower(sv);
+  auto const stripped = cudf::strings::strip(cudf::strings_column_view(lower->view()));
+  auto const targets  = cudf::test::strings_column_wrapper({"_", "l", "ab"});
+  auto const repls    = cudf::test::strings_column_wrapper({" ", "L", ""});
+  auto const expected = cudf::strings::replace(cudf::strings_column_view(stripped->view()),
+                                               cudf::strings_column_view(targets),
+                                               cudf::strings_column_view(repls));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, *expected);
+
+  auto const literal = cudf::test::strings_column_wrapper(
+    {"heLLo worLd", "c c", "", "", "àéî õü", "straße", ""}, {1, 1, 1, 1, 1, 1, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, literal);
+}
+
+TEST_F(StringsPipelineTest, ReplaceThenStrip)
+{
+  auto input = cudf::test::strings_column_wrapper({"xxaxbxxc", "x", "axxb", "bxa", "cxxa"});
+  auto const sv = cudf::strings_column_view(input);
+
+  // replacements produce the characters stripped by the next operation
+  auto const pipeline = cudf::strings::transform_pipeline()
+                          .replace({"a", "b"}, {"x"})
+                          .strip(cudf::strings::side_type::RIGHT, "x")
+                          .to_upper();
+  auto const results = cudf::strings::apply_pipeline(sv, pipeline);
+
+  auto const expected = cudf::test::strings_column_wrapper({"XXXXXXXC", "", "", "", "C"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsPipelineTest, StripSides)
+{
+  auto input = cudf::test::strings_column_wrapper({"__a_b__", "____", "a", "_a"});
+  auto const sv = cudf::strings_column_view(input);
+
+  auto results = cudf::strings::apply_pipeline(
+    sv, cudf::strings::transform_pipeline().strip(cudf::strings::side_type::LEFT, "_"));
+  auto expected = cudf::test::strings_column_wrapper({"a_b__", "", "a", "a"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  results = cudf::strings::apply_pipeline(
+    sv, cudf::strings::transform_pipeline().strip(cudf::strings::side_type::RIGHT, "_"));
+  expected = cudf::test::strings_column_wrapper({"__a_b", "", "a", "_a"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+}
+
+TEST_F(StringsPipelineTest, Errors)
+{
+  auto pipeline = cudf::strings::transform_pipeline();
+  EXPECT_THROW(pipeline.replace({}, {"x"}), cudf::logic_error);
+  EXPECT_THROW(pipeline.replace({"a", ""}, {"x"}), cudf::logic_error);
+  EXPECT_THROW(pipeline.replace({"a", "b", "c"}, {"x", "y"}), cudf::logic_error);
+  for (int idx = 0; idx < cudf::strings::transform_pipeline::max_steps; ++idx) {
+    pipeline.to_lower();
+  }
+  EXPECT_THROW(pipeline.to_upper(), cudf::logic_error);
+}
@@ -18,6 +18,7 @@
 #include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 
+#include <cudf/column/column_factories.hpp>
 #include <cudf/column/column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/slice.hpp>
@@ -165,6 +166,30 @@ INSTANTIATE_TEST_CASE_P(StringsSliceTest,
                         Parameters,
                         testing::ValuesIn(std::array<cudf::size_type, 3>{1, 2, 3}));
 
+TEST_F(StringsSliceTest, SliceView)
+{
+  cudf::test::strings_column_wrapper input({"Héllo", "thesé", "", "lease", "tést strings", ""},
+                                           {1, 1, 0, 1, 1, 1});
+  auto const view = cudf::strings_column_view(input);
+
+  auto results = cudf::strings::slice_strings_view(view, 1, 4);
+  EXPECT_EQ(results.size(), view.size());
+  EXPECT_EQ(results.null_count(), 1);
+  auto const expected = cudf::strings::slice_strings(
+    view, cudf::numeric_scalar<cudf::size_type>(1), cudf::numeric_scalar<cudf::size_type>(4));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results.materialize(), *expected);
+
+  results                 = cudf::strings::slice_strings_view(view, 2);
+  auto const expected_end = cudf::test::strings_column_wrapper(
+    {"llo", "esé", "", "ase", "st strings", ""}, {1, 1, 0, 1, 1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results.materialize(), expected_end);
+
+  auto const empty = cudf::make_empty_column(cudf::type_id::STRING);
+  results          = cudf::strings::slice_strings_view(cudf::strings_column_view(empty->view()), 1);
+  EXPECT_EQ(results.size(), 0);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results.materialize(), empty->view());
+}
+
 TEST_F(StringsSliceTest, NegativePositions)
 {
   cudf::test::strings_column_wrapper strings{
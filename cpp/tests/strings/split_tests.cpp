@@ -21,6 +21,8 @@
 #include <cudf_test/table_utilities.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/regex/regex_program.hpp>
 #include <cudf/strings/split/partition.hpp>
@@ -674,6 +676,87 @@ TEST_F(StringsSplitTest, RSplitRegexWithMaxSplit)
   }
 }
 
+TEST_F(StringsSplitTest, TokenIndex)
+{
+  auto input = cudf::test::strings_column_wrapper({"a_bc_def", "a__bc", "ab", ""}, {1, 1, 1, 0});
+  auto view  = cudf::strings_column_view(input);
+
+  auto const index     = cudf::strings::split_token_index(view, cudf::string_scalar("_"));
+  auto const positions = cudf::lists_column_view(index->view()).child();
+  auto const begins    = cudf::test::fixed_width_column_wrapper<int32_t>({0, 2, 5, 0, 2, 3, 0});
+  auto const ends      = cudf::test::fixed_width_column_wrapper<int32_t>({1, 4, 8, 1, 2, 5, 2});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(positions.child(0), begins);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(positions.child(1), ends);
+
+  auto const index_view = cudf::lists_column_view(index->view());
+  auto result           = cudf::strings::get_token_with_index(view, index_view, 1);
+  auto expected         = cudf::test::strings_column_wrapper({"bc", "", "", ""}, {1, 1, 0, 0});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+
+  auto const table_result   = cudf::strings::split_with_index(view, index_view);
+  auto const table_expected = cudf::strings::split(view, cudf::string_scalar("_"));
+  CUDF_TEST_EXPECT_TABLES_EQUAL(table_result->view(), table_expected->view());
+
+  // sliced input and index
+  auto const sliced       = cudf::slice(input, {1, 3}).front();
+  auto const sliced_index = cudf::slice(index->view(), {1, 3}).front();
+  result                  = cudf::strings::get_token_with_index(
+    cudf::strings_column_view(sliced), cudf::lists_column_view(sliced_index), 0);
+  expected = cudf::test::strings_column_wrapper({"a", "ab"});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, expected);
+  result = cudf::strings::split_record_with_index(cudf::strings_column_view(sliced),
+                                                  cudf::lists_column_view(sliced_index));
+  using LCW = cudf::test::lists_column_wrapper<cudf::string_view>;
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*result, LCW({LCW{"a", "", "bc"}, LCW{"ab"}}));
+}
+
+TEST_F(StringsSplitTest, TokenIndexSplitRecord)
+{
+  std::vector<char const*> h_strings{
+    " Héllo  thesé", nullptr, "are some  ", "tést\tString", "", "a::b:::c"};
+  auto validity =
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; });
+  cudf::test::strings_column_wrapper input(h_strings.begin(), h_strings.end(), validity);
+  auto view = cudf::strings_column_view(input);
+
+  for (auto const delimiter : {"", " ", "::"}) {
+    auto const d_delimiter = cudf::string_scalar(delimiter);
+    for (auto const maxsplit : {-1, 1}) {
+      auto index    = cudf::strings::split_token_index(view, d_delimiter, maxsplit);
+      auto result   = cudf::strings::split_record_with_index(view, index->view());
+      auto expected = cudf::strings::split_record(view, d_delimiter, maxsplit);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+
+      index    = cudf::strings::rsplit_token_index(view, d_delimiter, maxsplit);
+      result   = cudf::strings::split_record_with_index(view, index->view());
+      expected = cudf::strings::rsplit_record(view, d_delimiter, maxsplit);
+      CUDF_TEST_EXPECT_COLUMNS_EQUAL(*result, *expected);
+    }
+  }
+}
+
+TEST_F(StringsSplitTest, TokenIndexErrors)
+{
+  auto input = cudf::test::strings_column_wrapper({"a_b", "c"});
+  auto view  = cudf::strings_column_view(input);
+  auto index = cudf::strings::split_token_index(view, cudf::string_scalar("_"));
+  EXPECT_THROW(cudf::strings::get_token_with_index(view, index->view(), -1), cudf::logic_error);
+
+  auto const sliced = cudf::slice(input, {0, 1}).front();
+  EXPECT_THROW(
+    cudf::strings::split_record_with_index(cudf::strings_column_view(sliced), index->view()),
+    cudf::logic_error);
+  EXPECT_THROW(cudf::strings::split_token_index(
+                 view, cudf::string_scalar("", false), -1, cudf::get_default_stream()),
+               cudf::logic_error);
+
+  auto const empty       = cudf::make_empty_column(cudf::type_id::STRING);
+  auto const empty_view  = cudf::strings_column_view(empty->view());
+  auto const empty_index = cudf::strings::split_token_index(empty_view);
+  EXPECT_EQ(empty_index->size(), 0);
+  EXPECT_EQ(cudf::strings::split_record_with_index(empty_view, empty_index->view())->size(), 0);
+}
+
 TEST_F(StringsSplitTest, SplitZeroSizeStringsColumns)
 {
   auto const zero_size_strings_column = cudf::make_empty_column(cudf::type_id::STRING)->view();
@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/strings/string_headers.hpp>
+#include <cudf/strings/strings_column_view.hpp>
+
+#include <vector>
+
+struct StringHeadersTest : public cudf::test::BaseFixture {};
+
+TEST_F(StringHeadersTest, RoundTrip)
+{
+  auto input = cudf::test::strings_column_wrapper(
+    {"", "short", "exactly12byt", "thirteen byte", "", "a much longer string than the inline size",
+     "é世界", "null row"},
+    {1, 1, 1, 1, 0, 1, 1, 0});
+  auto const sv = cudf::strings_column_view(input);
+
+  auto const headers = cudf::strings::to_string_headers(sv);
+  EXPECT_EQ(headers.size(), sv.size());
+  EXPECT_EQ(headers.null_count(), 2);
+
+  auto const results = cudf::strings::from_string_headers(headers);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, input);
+}
+
+TEST_F(StringHeadersTest, Sliced)
+{
+  auto input = cudf::test::strings_column_wrapper(
+    {"first row is long enough", "ab", "third row is also long", "", "fifth", "sixth is long too"},
+    {1, 1, 1, 0, 1, 1});
+  auto const sliced = cudf::slice(input, {1, 5}).front();
+
+  auto const headers = cudf::strings::to_string_headers(cudf::strings_column_view(sliced));
+  EXPECT_EQ(headers.size(), 4);
+  EXPECT_EQ(headers.null_count(), 1);
+
+  auto const results  = cudf::strings::from_string_headers(headers);
+  auto const expected = cudf::test::strings_column_wrapper(
+    {"ab", "third row is also long", "", "fifth"}, {1, 1, 0, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
+}
+
+TEST_F(StringHeadersTest, ZeroSizeStringsColumn)
+{
+  auto const input   = cudf::make_empty_column(cudf::type_id::STRING)->view();
+  auto const headers = cudf::strings::to_string_headers(cudf::strings_column_view(input));
+  EXPECT_EQ(headers.size(), 0);
+  auto const results = cudf::strings::from_string_headers(headers);
+  EXPECT_EQ(results->size(), 0);
+}
@@ -48,6 +48,27 @@ TEST_F(StringsStripTest, StripLeft)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
 }
 
+TEST_F(StringsStripTest, StripView)
+{
+  std::vector<char const*> h_strings{"  aBc  ", "   ", nullptr, "aaaa ", "b", "\tccc ddd"};
+  std::vector<char const*> h_expected{"aBc", "", nullptr, "aaaa", "b", "ccc ddd"};
+
+  cudf::test::strings_column_wrapper strings(
+    h_strings.begin(),
+    h_strings.end(),
+    thrust::make_transform_iterator(h_strings.begin(), [](auto str) { return str != nullptr; }));
+  auto strings_view = cudf::strings_column_view(strings);
+
+  auto results = cudf::strings::strip_view(strings_view);
+  EXPECT_EQ(results.null_count(), 1);
+
+  cudf::test::strings_column_wrapper expected(
+    h_expected.begin(),
+    h_expected.end(),
+    thrust::make_transform_iterator(h_expected.begin(), [](auto str) { return str != nullptr; }));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results.materialize(), expected);
+}
+
 TEST_F(StringsStripTest, StripRight)
 {
   std::vector<char const*> h_strings{"  aBc  ", "   ", nullptr, "aaaa ", "b", "\tccc ddd"};
@@ -20,9 +20,11 @@
 #include <cudf_test/iterator_utilities.hpp>
 
 #include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 
 #include <nvtext/byte_pair_encoding.hpp>
+#include <nvtext/tokenize.hpp>
 
 struct TextBytePairEncoding : public cudf::test::BaseFixture {};
 
@@ -116,6 +118,65 @@ TEST_F(TextBytePairEncoding, BPEAdjacentPairs)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
 }
 
+TEST_F(TextBytePairEncoding, BytePairEncodingIds)
+{
+  auto mpt = cudf::test::strings_column_wrapper({"e n",
+                                                 "i t",
+                                                 "i s",
+                                                 "e s",
+                                                 "en t",
+                                                 "c e",
+                                                 "es t",
+                                                 "en ce",
+                                                 "t h",
+                                                 "h i",
+                                                 "th is",
+                                                 "t est",
+                                                 "s i",
+                                                 "s ent"});
+  auto merge_pairs = nvtext::load_merge_pairs(cudf::strings_column_view(mpt));
+  auto vocab_input =
+    cudf::test::strings_column_wrapper({"this", "is", " ", "test", "-", "sent", "ence", "it"});
+  auto vocabulary = nvtext::load_vocabulary(cudf::strings_column_view(vocab_input));
+
+  auto validity = cudf::test::iterators::null_at(4);
+  cudf::test::strings_column_wrapper input({"thisisit",
+                                            "thisis test-sentence-1",
+                                            "thisistestsentence-2",
+                                            "this-istestsentence 3",
+                                            "",
+                                            "",
+                                            "thisisit"},
+                                           validity);
+  auto sv = cudf::strings_column_view(input);
+
+  using LCW     = cudf::test::lists_column_wrapper<cudf::size_type>;
+  auto results  = nvtext::byte_pair_encoding_ids(sv, *merge_pairs, *vocabulary);
+  auto expected = LCW({LCW{0, 1, 7},
+                       LCW{0, 1, 2, 3, 4, 5, 6, 4, -1},
+                       LCW{0, 1, 3, 5, 6, 4, -1},
+                       LCW{0, 4, 1, 3, 5, 6, 2, -1},
+                       LCW{},
+                       LCW{},
+                       LCW{0, 1, 7}},
+                      validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), expected);
+
+  // sliced input and a non-default id for unknown tokens
+  auto sliced = cudf::slice(input, {1, 4}).front();
+  results     = nvtext::byte_pair_encoding_ids(
+    cudf::strings_column_view(sliced), *merge_pairs, *vocabulary, 99);
+  auto sliced_expected = LCW({LCW{0, 1, 2, 3, 4, 5, 6, 4, 99},
+                              LCW{0, 1, 3, 5, 6, 4, 99},
+                              LCW{0, 4, 1, 3, 5, 6, 2, 99}});
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), sliced_expected);
+
+  auto empty = cudf::make_empty_column(cudf::type_id::STRING);
+  results    = nvtext::byte_pair_encoding_ids(
+    cudf::strings_column_view(empty->view()), *merge_pairs, *vocabulary);
+  EXPECT_EQ(0, results->size());
+}
+
 TEST_F(TextBytePairEncoding, BPE_Empty)
 {
   auto mpt         = cudf::test::strings_column_wrapper({"i s", "i t"});
@@ -67,6 +67,41 @@ TEST_F(JaccardTest, WithNulls)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(*results, expected);
 }
 
+TEST_F(JaccardTest, Join)
+{
+  auto input = cudf::test::strings_column_wrapper({"the quick brown fox",
+                                                  "jumped over the lazy dog.",
+                                                  "brown fox",
+                                                  "the quick brown cat",
+                                                  "abc",
+                                                  ""},
+                                                 {1, 1, 1, 1, 1, 0});
+  auto view = cudf::strings_column_view(input);
+
+  auto results = nvtext::jaccard_join(view, view, 5, 0.3f);
+
+  using index_wrapper = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+  auto expected_rows1 = index_wrapper({0, 0, 0, 1, 2, 2, 3, 3});
+  auto expected_rows2 = index_wrapper({0, 2, 3, 1, 0, 2, 0, 3});
+  auto expected_sims  = cudf::test::fixed_width_column_wrapper<float>(
+    {1.0f, 0.333333343f, 0.666666687f, 1.0f, 0.333333343f, 1.0f, 0.666666687f, 1.0f});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_rows1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_rows2);
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->get_column(2), expected_sims);
+
+  results        = nvtext::jaccard_join(view, view, 5, 1.0f);
+  expected_rows1 = index_wrapper({0, 1, 2, 3});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_rows1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_rows1);
+
+  auto input2   = cudf::test::strings_column_wrapper({"funny bunny", "the quick brown dog"});
+  results        = nvtext::jaccard_join(view, cudf::strings_column_view(input2), 5, 0.5f);
+  expected_rows1 = index_wrapper({0, 3});
+  expected_rows2 = index_wrapper({1, 1});
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(0), expected_rows1);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(results->get_column(1), expected_rows2);
+}
+
 TEST_F(JaccardTest, Errors)
 {
   auto input = cudf::test::strings_column_wrapper({"1", "2", "3"});
@@ -77,4 +112,8 @@ TEST_F(JaccardTest, Errors)
   auto input2 = cudf::test::strings_column_wrapper({"1", "2"});
   auto view2  = cudf::strings_column_view(input2);
   EXPECT_THROW(nvtext::jaccard_index(view, view2, 5), std::invalid_argument);
+  // invalid threshold
+  EXPECT_THROW(nvtext::jaccard_join(view, view2, 5, 0.f), std::invalid_argument);
+  EXPECT_THROW(nvtext::jaccard_join(view, view2, 5, 1.5f), std::invalid_argument);
+  EXPECT_THROW(nvtext::jaccard_join(view, view2, 1, 0.5f), std::invalid_argument);
 }
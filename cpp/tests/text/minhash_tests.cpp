@@ -20,6 +20,7 @@
 #include <cudf_test/iterator_utilities.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/strings/strings_column_view.hpp>
 #include <cudf/utilities/span.hpp>
 
@@ -139,6 +140,67 @@ TEST_F(MinHashTest, MultiSeedWithNullInputRow)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results64, expected64);
 }
 
+TEST_F(MinHashTest, Permuted)
+{
+  auto validity = cudf::test::iterators::null_at(1);
+  auto input =
+    cudf::test::strings_column_wrapper({"doc 1",
+                                        "",
+                                        "this is doc 2",
+                                        "",
+                                        "d",
+                                        "The quick brown fox jumpéd over the lazy brown dog."},
+                                       validity);
+  auto view = cudf::strings_column_view(input);
+
+  auto parameter_a = cudf::test::fixed_width_column_wrapper<uint32_t>({1, 7, 2654435761, 40503});
+  auto parameter_b = cudf::test::fixed_width_column_wrapper<uint32_t>({0, 13, 2135587861, 99991});
+  auto results     = nvtext::minhash_permuted(
+    view, 0, cudf::column_view(parameter_a), cudf::column_view(parameter_b), 4);
+
+  using LCW = cudf::test::lists_column_wrapper<uint32_t>;
+  // clang-format off
+  LCW expected({LCW{1207251914u, 115477657u, 2567721451u, 3416675069u},
+                LCW{},
+                LCW{  21141582u, 147991087u,  538645460u,  220780495u},
+                LCW{         0u,         0u,          0u,          0u},
+                LCW{ 655955059u, 296718130u, 3238066840u, 3775128908u},
+                LCW{  86520422u,   5631743u,  117241849u,   64904100u}},
+               validity);
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // the band values at the same position are equal only for equal bands
+  auto bands  = nvtext::minhash_lsh_bands(cudf::lists_column_view(results->view()), 2);
+  using LCW64 = cudf::test::lists_column_wrapper<uint64_t>;
+  LCW64 expected_bands({LCW64{10455136877344895048ul, 7882610463016992549ul},
+                        LCW64{},
+                        LCW64{11489461014309892530ul, 18013130295476536664ul},
+                        LCW64{2945182322382062539ul, 8297479994805284640ul},
+                        LCW64{16135610292833211954ul, 2450618596537933815ul},
+                        LCW64{8040610198726616951ul, 10759304748818156574ul}},
+                       validity);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*bands, expected_bands);
+
+  auto parameter_a64 = cudf::test::fixed_width_column_wrapper<uint64_t>(
+    {1ul, 7ul, 11400714819323198485ul});
+  auto parameter_b64 =
+    cudf::test::fixed_width_column_wrapper<uint64_t>({0ul, 13ul, 6364136223846793005ul});
+  auto results64     = nvtext::minhash64_permuted(
+    view, 0, cudf::column_view(parameter_a64), cudf::column_view(parameter_b64), 4);
+
+  // clang-format off
+  LCW64 expected64({LCW64{ 774489391575805754ul,  809739722603252389ul,  992056385386433331ul},
+                    LCW64{},
+                    LCW64{ 536921680321302592ul,  160505205254341540ul,  806831916502224584ul},
+                    LCW64{                  0ul,                   0ul,                   0ul},
+                    LCW64{ 824988646263748476ul, 1163234505418851403ul, 1492369275912319966ul},
+                    LCW64{  44496840736841086ul,   19402068861258640ul,   84693705751622331ul}},
+                   validity);
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results64, expected64);
+}
+
 TEST_F(MinHashTest, EmptyTest)
 {
   auto input   = cudf::make_empty_column(cudf::data_type{cudf::type_id::STRING});
@@ -153,6 +215,20 @@ TEST_F(MinHashTest, ErrorsTest)
 {
   auto input = cudf::test::strings_column_wrapper({"this string intentionally left blank"});
   auto view  = cudf::strings_column_view(input);
+  auto params = cudf::test::fixed_width_column_wrapper<uint32_t>({1, 2});
+  auto empty  = cudf::test::fixed_width_column_wrapper<uint32_t>();
+  EXPECT_THROW(
+    nvtext::minhash_permuted(view, 0, cudf::column_view(empty), cudf::column_view(empty), 4),
+    std::invalid_argument);
+  EXPECT_THROW(
+    nvtext::minhash_permuted(view, 0, cudf::column_view(params), cudf::column_view(empty), 4),
+    std::invalid_argument);
+  auto minhashes = nvtext::minhash_permuted(
+    view, 0, cudf::column_view(params), cudf::column_view(params), 4);
+  EXPECT_THROW(nvtext::minhash_lsh_bands(cudf::lists_column_view(minhashes->view()), 0),
+               std::invalid_argument);
+  EXPECT_THROW(nvtext::minhash_lsh_bands(cudf::lists_column_view(minhashes->view()), 3),
+               std::invalid_argument);
   EXPECT_THROW(nvtext::minhash(view, 0, 0), std::invalid_argument);
   EXPECT_THROW(nvtext::minhash64(view, 0, 0), std::invalid_argument);
   auto seeds = cudf::test::fixed_width_column_wrapper<uint32_t>();
@@ -21,8 +21,10 @@
 #include <cudf_test/testing_main.hpp>
 
 #include <cudf/column/column.hpp>
+#include <cudf/lists/lists_column_view.hpp>
 #include <cudf/scalar/scalar.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/structs/structs_column_view.hpp>
 
 #include <nvtext/generate_ngrams.hpp>
 
@@ -175,3 +177,62 @@ TEST_F(TextGenerateNgramsTest, NgramsHashErrors)
 }
 
 CUDF_TEST_PROGRAM_MAIN()
+
+namespace {
+void expect_features(cudf::column_view const& results,
+                     std::initializer_list<cudf::size_type> offsets,
+                     std::initializer_list<cudf::size_type> indices,
+                     std::initializer_list<cudf::size_type> counts)
+{
+  using FWCW          = cudf::test::fixed_width_column_wrapper<cudf::size_type>;
+  auto const lists    = cudf::lists_column_view(results);
+  auto const features = cudf::structs_column_view(lists.child());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(lists.offsets(), FWCW(offsets));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(features.child(0), FWCW(indices));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(features.child(1), FWCW(counts));
+}
+}  // namespace
+
+TEST_F(TextGenerateNgramsTest, CharacterNgramFeatures)
+{
+  // the features are the hashes of NgramsHash modulo 10
+  auto input =
+    cudf::test::strings_column_wrapper({"the quick brown fox", "", "abc"}, {true, true, false});
+  auto view = cudf::strings_column_view(input);
+
+  auto results = nvtext::hash_character_ngram_features(view, 5, 10);
+  EXPECT_EQ(results->null_count(), 1);
+  expect_features(*results, {0, 8, 8, 8}, {0, 2, 3, 5, 6, 7, 8, 9}, {2, 2, 1, 5, 1, 2, 1, 1});
+
+  // the two ngrams of feature 0 cancel out
+  results = nvtext::hash_character_ngram_features(view, 5, 10, true);
+  expect_features(*results, {0, 7, 7, 7}, {2, 3, 5, 6, 7, 8, 9}, {-2, 1, -1, 1, -2, 1, -1});
+}
+
+TEST_F(TextGenerateNgramsTest, WordNgramFeatures)
+{
+  auto input = cudf::test::strings_column_wrapper({"a b a b", "the fox  the fox jumped", "one"});
+  auto view  = cudf::strings_column_view(input);
+
+  auto const delimiter = cudf::string_scalar("");
+
+  auto results = nvtext::hash_word_ngram_features(view, 2, delimiter, 100);
+  expect_features(*results, {0, 2, 5, 5}, {4, 70, 8, 69, 92}, {1, 2, 1, 1, 2});
+
+  results = nvtext::hash_word_ngram_features(view, 2, delimiter, 100, true);
+  expect_features(*results, {0, 2, 5, 5}, {4, 70, 8, 69, 92}, {-1, 2, -1, 1, 2});
+
+  results = nvtext::hash_word_ngram_features(view, 1, delimiter, 100);
+  expect_features(*results, {0, 2, 5, 6}, {35, 50, 38, 53, 81, 72}, {2, 2, 2, 1, 2, 1});
+}
+
+TEST_F(TextGenerateNgramsTest, NgramFeaturesErrors)
+{
+  auto input = cudf::test::strings_column_wrapper({"1", "2", "3"});
+  auto view  = cudf::strings_column_view(input);
+
+  EXPECT_THROW(nvtext::hash_character_ngram_features(view, 0, 10), std::invalid_argument);
+  EXPECT_THROW(nvtext::hash_character_ngram_features(view, 2, 0), std::invalid_argument);
+  auto const invalid = cudf::string_scalar("", false);
+  EXPECT_THROW(nvtext::hash_word_ngram_features(view, 2, invalid, 10), cudf::logic_error);
+}
@@ -20,10 +20,14 @@
 
 #include <cudf/column/column.hpp>
 #include <cudf/column/column_view.hpp>
+#include <cudf/copying.hpp>
 #include <cudf/strings/strings_column_view.hpp>
+#include <cudf/utilities/default_stream.hpp>
 
 #include <nvtext/subword_tokenize.hpp>
 
+#include <rmm/device_uvector.hpp>
+
 #include <fstream>
 #include <iostream>
 #include <vector>
@@ -440,3 +444,77 @@ TEST(TextSubwordTest, ZeroHashBinCoefficient)
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_attention_mask->view(), expected_attn);
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(result.tensor_metadata->view(), expected_metadata);
 }
+
+TEST(TextSubwordTest, TokenizerStream)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  cudf::test::strings_column_wrapper batch1(
+    {"This is a test.", "", "This is a test. This is a tést.", "this"});
+  cudf::test::strings_column_wrapper batch2({"A test", "  ", "is"}, {1, 1, 0});
+  cudf::test::strings_column_wrapper batch3({"  ", "\n\r"});
+  auto const batches = std::vector<cudf::column_view>{batch1, batch2, batch3};
+
+  uint32_t const max_seq  = 8;
+  uint32_t const stride   = 6;
+  uint32_t const max_rows = 8;
+  auto tokenizer = nvtext::subword_tokenizer_stream(*vocab, max_seq, stride, true, false, max_rows);
+
+  // one set of output buffers for each batch so they can be written concurrently
+  auto const stream = cudf::get_default_stream();
+  std::vector<rmm::device_uvector<uint32_t>> token_ids, masks, metadata;
+  std::vector<uint32_t> rows;
+  for (auto const& batch : batches) {
+    token_ids.emplace_back(max_rows * max_seq, stream);
+    masks.emplace_back(max_rows * max_seq, stream);
+    metadata.emplace_back(max_rows * 3, stream);
+    rows.push_back(tokenizer.tokenize(
+      cudf::strings_column_view(batch), token_ids.back(), masks.back(), metadata.back(), stream));
+  }
+  tokenizer.synchronize(stream);
+
+  auto const to_view = [](rmm::device_uvector<uint32_t> const& output, cudf::size_type size) {
+    return cudf::column_view(cudf::device_span<uint32_t const>(output.data(), size));
+  };
+  for (std::size_t idx = 0; idx < batches.size(); ++idx) {
+    auto const expected = nvtext::subword_tokenize(
+      cudf::strings_column_view(batches[idx]), *vocab, max_seq, stride, true, false);
+    EXPECT_EQ(expected.nrows_tensor, rows[idx]);
+    auto const tensor_size = expected.tensor_token_ids->size();
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(to_view(token_ids[idx], tensor_size),
+                                   expected.tensor_token_ids->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(to_view(masks[idx], tensor_size),
+                                   expected.tensor_attention_mask->view());
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(to_view(metadata[idx], expected.tensor_metadata->size()),
+                                   expected.tensor_metadata->view());
+  }
+}
+
+TEST(TextSubwordTest, TokenizerStreamErrors)
+{
+  std::string hash_file = temp_env->get_temp_filepath("hashed_vocab.txt");
+  create_hashed_vocab(hash_file);
+  auto vocab = nvtext::load_vocabulary_file(hash_file);
+
+  EXPECT_THROW(nvtext::subword_tokenizer_stream(*vocab, 12, 13, true, true, 4), cudf::logic_error);
+  EXPECT_THROW(nvtext::subword_tokenizer_stream(*vocab, 858993459, 5, true, true, 4),
+               std::overflow_error);
+
+  cudf::test::strings_column_wrapper strings(
+    {"This is a test.", "This is a test. This is a tést."});
+  auto const input = cudf::strings_column_view(strings);
+  auto tokenizer   = nvtext::subword_tokenizer_stream(*vocab, 8, 6, true, false, 2);
+  auto output      = rmm::device_uvector<uint32_t>(32, cudf::get_default_stream());
+  // the second string needs two output rows
+  EXPECT_THROW(tokenizer.tokenize(input, output, output, output), std::invalid_argument);
+
+  auto small = rmm::device_uvector<uint32_t>(4, cudf::get_default_stream());
+  EXPECT_THROW(tokenizer.tokenize(cudf::strings_column_view(cudf::slice(strings, {0, 1}).front()),
+                                  small,
+                                  small,
+                                  small),
+               std::invalid_argument);
+  tokenizer.synchronize();
+}
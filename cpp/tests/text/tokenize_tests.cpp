@@ -278,6 +278,61 @@ TEST_F(TextTokenizeTest, VocabularyLongStrings)
   CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(results->view(), sliced_expected);
 }
 
+TEST_F(TextTokenizeTest, VocabularyPerfectHash)
+{
+  cudf::test::strings_column_wrapper vocabulary(
+    {"ate", "chased", "cheese", "dog", "fox", "jumped", "mouse", "mousé", "over", "the"});
+  auto vocab = nvtext::load_vocabulary(cudf::strings_column_view(vocabulary),
+                                       nvtext::vocabulary_lookup::PERFECT_HASH);
+
+  auto validity = cudf::test::iterators::null_at(5);
+  auto input    = cudf::test::strings_column_wrapper({" the fox jumped over the dog ",
+                                                      " the dog chased the cat",
+                                                      "",
+                                                      "the cat chased the mouse ",
+                                                      "the mousé  ate  cheese",
+                                                      "",
+                                                      "dog"},
+                                                  validity);
+  std::vector<std::string> h_strings(
+    2, "the fox jumped chased the dog cheese mouse at the over there dog mouse cat plus the horse");
+  cudf::test::strings_column_wrapper long_input(h_strings.begin(), h_strings.end());
+
+  auto delimiter  = cudf::string_scalar(" ");
+  auto default_id = -7;
+  auto results    = nvtext::tokenize_with_vocabulary(
+    cudf::strings_column_view(input), *vocab, delimiter, default_id);
+
+  using LCW = cudf::test::lists_column_wrapper<cudf::size_type>;
+  // clang-format off
+  LCW expected({LCW{ 9, 4, 5, 8, 9, 3},
+                LCW{ 9, 3, 1, 9,-7},
+                LCW{},
+                LCW{ 9,-7, 1, 9, 6},
+                LCW{ 9, 7, 0, 2},
+                LCW{}, LCW{3}},
+                validity);
+  LCW long_expected({LCW{ 9, 4, 5, 1, 9, 3, 2, 6, -7, 9, 8, -7, 3, 6, -7, -7, 9, -7},
+                     LCW{ 9, 4, 5, 1, 9, 3, 2, 6, -7, 9, 8, -7, 3, 6, -7, -7, 9, -7}});
+  // clang-format on
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*results, expected);
+
+  // tokenize both columns in one call
+  auto const inputs =
+    std::vector<cudf::strings_column_view>{cudf::strings_column_view(input),
+                                           cudf::strings_column_view(long_input)};
+  auto const batch = nvtext::tokenize_with_vocabulary(inputs, *vocab, delimiter, default_id);
+  ASSERT_EQ(batch.size(), inputs.size());
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*batch[0], expected);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(*batch[1], long_expected);
+
+  // duplicate entries cannot be placed in a perfect hash
+  cudf::test::strings_column_wrapper duplicates({"the", "fox", "the"});
+  EXPECT_THROW(nvtext::load_vocabulary(cudf::strings_column_view(duplicates),
+                                       nvtext::vocabulary_lookup::PERFECT_HASH),
+               cudf::logic_error);
+}
+
 TEST_F(TextTokenizeTest, TokenizeErrors)
 {
   cudf::test::strings_column_wrapper empty{};
@@ -24,7 +24,9 @@
 #include <cudf_test/random.hpp>
 
 #include <cudf/detail/iterator.cuh>
+#include <cudf/jit_cache.hpp>
 #include <cudf/transform.hpp>
+#include <cudf/utilities/error.hpp>
 
 namespace transformation {
 struct UnaryOperationIntegrationTest : public cudf::test::BaseFixture {};
@@ -220,4 +222,52 @@ __device__ inline void f(cudf::timestamp_us* output, cudf::timestamp_us input)
   test_udf<dtype>(cuda, op, data_init, 500, false);
 }
 
+TEST_F(UnaryOperationIntegrationTest, PrecompiledTransform)
+{
+  // c = a*3 + 1
+  char const cuda[] =
+    R"***(
+__device__ inline void f(int64_t* output, int32_t input)
+{
+  *output = static_cast<int64_t>(input) * 3 + 1;
+}
+)***";
+
+  auto const spec = cudf::jit_kernel_spec{cudf::jit_kernel_kind::TRANSFORM,
+                                          cuda,
+                                          cudf::data_type{cudf::type_id::INT64},
+                                          {cudf::data_type{cudf::type_id::INT32}},
+                                          false};
+  cudf::precompile_jit_kernels({spec, spec}, 2).get();
+  auto const before = cudf::get_jit_cache_statistics();
+
+  auto input    = cudf::test::fixed_width_column_wrapper<int32_t>({0, 1, -5, 100});
+  auto expected = cudf::test::fixed_width_column_wrapper<int64_t>({1, 4, -14, 301});
+  auto result   = cudf::transform(input, cuda, cudf::data_type{cudf::type_id::INT64}, false);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+
+  // the transform reuses the precompiled kernel
+  auto const after = cudf::get_jit_cache_statistics();
+  EXPECT_EQ(after.kernels_loaded, before.kernels_loaded);
+  EXPECT_EQ(after.kernel_requests, before.kernel_requests + 1);
+}
+
+TEST_F(UnaryOperationIntegrationTest, PrecompileInvalidSpec)
+{
+  auto const spec = cudf::jit_kernel_spec{cudf::jit_kernel_kind::TRANSFORM,
+                                          "",
+                                          cudf::data_type{cudf::type_id::STRING},
+                                          {cudf::data_type{cudf::type_id::INT32}},
+                                          false};
+  auto future = cudf::precompile_jit_kernels({spec});
+  EXPECT_THROW(future.get(), cudf::logic_error);
+
+  auto const no_inputs = cudf::jit_kernel_spec{cudf::jit_kernel_kind::BINARY_OPERATION,
+                                               "",
+                                               cudf::data_type{cudf::type_id::INT32},
+                                               {cudf::data_type{cudf::type_id::INT32}}};
+  future = cudf::precompile_jit_kernels({no_inputs});
+  EXPECT_THROW(future.get(), cudf::logic_error);
+}
+
 }  // namespace transformation
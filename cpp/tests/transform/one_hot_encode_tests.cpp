@@ -15,6 +15,7 @@
  */
 
 #include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
 #include <cudf_test/column_wrapper.hpp>
 #include <cudf_test/iterator_utilities.hpp>
 #include <cudf_test/table_utilities.hpp>
@@ -271,3 +272,40 @@ TEST_F(OneHotEncodingTest, StructsOfStructs)
 
   CUDF_TEST_EXPECT_TABLES_EQUAL(expected, got);
 }
+
+TEST_F(OneHotEncodingTest, Sparse)
+{
+  auto const input = cudf::test::fixed_width_column_wrapper<int32_t>{{8, 7, 8, 9, 9}, null_at(2)};
+  // duplicated categories are all encoded
+  auto const category = cudf::test::fixed_width_column_wrapper<int32_t>{{9, 8, -1, 8}, null_at(2)};
+
+  auto const expected = lists_col{{1, 3}, {}, {2}, {0}, {0}};
+
+  auto const got = cudf::one_hot_encode_sparse(input, category);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *got);
+}
+
+TEST_F(OneHotEncodingTest, SparseEmpty)
+{
+  auto const input    = cudf::test::fixed_width_column_wrapper<int32_t>{8, 9};
+  auto const category = cudf::test::fixed_width_column_wrapper<int32_t>{};
+
+  auto const expected = lists_col{{}, {}};
+
+  auto const got = cudf::one_hot_encode_sparse(input, category);
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *got);
+
+  auto const empty_got = cudf::one_hot_encode_sparse(category, input);
+  EXPECT_EQ(empty_got->size(), 0);
+  EXPECT_EQ(empty_got->type().id(), cudf::type_id::LIST);
+}
+
+TEST_F(OneHotEncodingTest, SparseMismatchTypes)
+{
+  auto input    = cudf::test::fixed_width_column_wrapper<int32_t>{8, 8, 8, 9, 9};
+  auto category = cudf::test::fixed_width_column_wrapper<int64_t>{8, 9};
+
+  EXPECT_THROW(cudf::one_hot_encode_sparse(input, category), cudf::data_type_error);
+}
@@ -0,0 +1,177 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/table_utilities.hpp>
+
+#include <cudf/copying.hpp>
+#include <cudf/detail/row_conversion.hpp>
+#include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/row_conversion.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/wrappers/timestamps.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::vector<cudf::data_type> schema_of(cudf::table_view const& input)
+{
+  std::vector<cudf::data_type> schema;
+  for (auto const& col : input) {
+    schema.push_back(col.type());
+  }
+  return schema;
+}
+
+}  // namespace
+
+struct RowConversionTest : public cudf::test::BaseFixture {};
+
+TEST_F(RowConversionTest, Layout)
+{
+  cudf::test::fixed_width_column_wrapper<int8_t> c0({1, 5}, {1, 0});
+  cudf::test::fixed_width_column_wrapper<int32_t> c1({0x01020304, 7});
+  cudf::test::strings_column_wrapper c2({"ab", "xyz"});
+  auto const input = cudf::table_view({c0, c1, c2});
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1);
+
+  // int8 at 0, int32 at 4, string slot at 8, validity at 16, strings from 17, 8-byte rows
+  cudf::test::lists_column_wrapper<int8_t> expected{
+    {1, 0, 0, 0, 4, 3, 2, 1, 17, 0, 0, 0, 2, 0, 0, 0, 7, 'a', 'b', 0, 0, 0, 0, 0},
+    {5, 0, 0, 0, 7, 0, 0, 0, 17, 0, 0, 0, 3, 0, 0, 0, 6, 'x', 'y', 'z', 0, 0, 0, 0}};
+  CUDF_TEST_EXPECT_COLUMNS_EQUIVALENT(expected, *rows.front());
+}
+
+TEST_F(RowConversionTest, FixedWidthRoundTrip)
+{
+  auto const num_rows = 10000;
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 0; });
+
+  cudf::test::fixed_width_column_wrapper<int8_t> c0(sequence, sequence + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<int64_t> c1(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<bool> c2(sequence, sequence + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<double> c3(sequence, sequence + num_rows);
+  cudf::test::fixed_width_column_wrapper<int16_t> c4(sequence, sequence + num_rows, validity);
+  cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep> c5(
+    sequence, sequence + num_rows, validity);
+  cudf::test::fixed_point_column_wrapper<__int128_t> c6(
+    sequence, sequence + num_rows, validity, numeric::scale_type{-2});
+  auto const input = cudf::table_view({c0, c1, c2, c3, c4, c5, c6});
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1);
+  auto const result = cudf::convert_from_rows(rows.front()->view(), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, StringsRoundTrip)
+{
+  cudf::test::strings_column_wrapper c0({"", "a", "bc", "def", "ghij", "klmno", "pqrstu"},
+                                        {1, 1, 0, 1, 1, 0, 1});
+  cudf::test::fixed_width_column_wrapper<int32_t> c1({1, 2, 3, 4, 5, 6, 7}, {0, 1, 1, 1, 1, 1, 0});
+  cudf::test::strings_column_wrapper c2({"longer string", "", "x", "", "yz", "", "end"},
+                                        {1, 0, 1, 1, 1, 1, 1});
+  auto const input = cudf::table_view({c0, c1, c2});
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1);
+  auto const result = cudf::convert_from_rows(rows.front()->view(), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+
+  // a sliced input produces the rows of the slice only
+  auto const sliced = cudf::slice(input, {2, 6}).front();
+  auto const sliced_rows   = cudf::convert_to_rows(sliced);
+  auto const sliced_result = cudf::convert_from_rows(sliced_rows.front()->view(), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(sliced, *sliced_result);
+}
+
+TEST_F(RowConversionTest, WideRows)
+{
+  // rows too wide to stage a tile of them in shared memory
+  auto const num_rows = 100;
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 7 != 0; });
+  std::vector<cudf::test::fixed_width_column_wrapper<int64_t>> columns;
+  for (int i = 0; i < 300; ++i) {
+    columns.emplace_back(sequence + i, sequence + i + num_rows, validity + i);
+  }
+  std::vector<cudf::column_view> views(columns.begin(), columns.end());
+  auto const input = cudf::table_view(views);
+
+  auto const rows   = cudf::convert_to_rows(input);
+  auto const result = cudf::convert_from_rows(rows.front()->view(), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Batches)
+{
+  auto const num_rows = 1000;
+  auto const sequence = cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i; });
+  auto const strings  = cudf::detail::make_counting_transform_iterator(
+    0, [](auto i) { return std::string(i % 13, 'a' + i % 26); });
+  cudf::test::fixed_width_column_wrapper<int32_t> c0(sequence, sequence + num_rows);
+  cudf::test::strings_column_wrapper c1(strings, strings + num_rows);
+  auto const input = cudf::table_view({c0, c1});
+
+  auto const rows = cudf::detail::convert_to_rows(
+    input, 1024, cudf::get_default_stream(), rmm::mr::get_current_device_resource());
+  EXPECT_GT(rows.size(), 1);
+
+  cudf::size_type begin = 0;
+  for (auto const& batch : rows) {
+    EXPECT_LE(cudf::lists_column_view(batch->view()).child().size(), 1024);
+    auto const result = cudf::convert_from_rows(batch->view(), schema_of(input));
+    auto const end    = begin + batch->size();
+    CUDF_TEST_EXPECT_TABLES_EQUIVALENT(cudf::slice(input, {begin, end}).front(), *result);
+    begin = end;
+  }
+  EXPECT_EQ(begin, num_rows);
+}
+
+TEST_F(RowConversionTest, Empty)
+{
+  cudf::test::fixed_width_column_wrapper<int32_t> c0{};
+  cudf::test::strings_column_wrapper c1{};
+  auto const input = cudf::table_view({c0, c1});
+
+  auto const rows = cudf::convert_to_rows(input);
+  ASSERT_EQ(rows.size(), 1);
+  EXPECT_EQ(rows.front()->size(), 0);
+  auto const result = cudf::convert_from_rows(rows.front()->view(), schema_of(input));
+  CUDF_TEST_EXPECT_TABLES_EQUIVALENT(input, *result);
+}
+
+TEST_F(RowConversionTest, Errors)
+{
+  cudf::test::lists_column_wrapper<int32_t> nested{{1, 2}, {3}};
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view({nested})), std::invalid_argument);
+  EXPECT_THROW(cudf::convert_to_rows(cudf::table_view{}), std::invalid_argument);
+
+  std::vector<cudf::data_type> const schema{cudf::data_type{cudf::type_id::INT32}};
+  EXPECT_THROW(cudf::convert_from_rows(nested, schema), std::invalid_argument);
+}
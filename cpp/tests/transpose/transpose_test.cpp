@@ -186,6 +186,8 @@ TYPED_TEST(TransposeTest, Fat) { run_test<TypeParam>(1000, 10, false); }
 
 TYPED_TEST(TransposeTest, FatNulls) { run_test<TypeParam>(1000, 10, true); }
 
+TYPED_TEST(TransposeTest, PartialTiles) { run_test<TypeParam>(333, 77, true); }
+
 TYPED_TEST(TransposeTest, EmptyTable) { run_test<TypeParam>(0, 0, false); }
 
 TYPED_TEST(TransposeTest, EmptyColumns) { run_test<TypeParam>(10, 0, false); }
@@ -22,6 +22,8 @@
 #include <cudf/detail/iterator.cuh>
 #include <cudf/detail/utilities/integer_utils.hpp>
 #include <cudf/fixed_point/fixed_point.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
 #include <cudf/unary.hpp>
 #include <cudf/utilities/bit.hpp>
 #include <cudf/utilities/default_stream.hpp>
@@ -31,6 +33,9 @@
 #include <thrust/host_vector.h>
 #include <thrust/iterator/counting_iterator.h>
 
+#include <memory>
+#include <stdexcept>
+#include <string>
 #include <type_traits>
 #include <vector>
 
@@ -1085,3 +1090,103 @@ TEST_F(FixedPointTestSingleType, Int32ToInt64Convert)
 
   CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
 }
+
+TEST_F(FixedPointTestSingleType, Decimal128ToDecimal32NarrowingRescale)
+{
+  using namespace numeric;
+  using fp_wrapper128 = cudf::test::fixed_point_column_wrapper<__int128_t>;
+  using fp_wrapper32  = cudf::test::fixed_point_column_wrapper<int32_t>;
+
+  // the input values do not fit in 32 bits before they are rescaled
+  auto const input    = fp_wrapper128{{12345678900000000L, -98765432100000000L}, scale_type{-10}};
+  auto const expected = fp_wrapper32{{12345678, -98765432}, scale_type{-2}};
+  auto const result   = cudf::cast(input, make_fixed_point_data_type<decimal32>(-2));
+
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected, result->view());
+}
+
+struct CastTableTest : public cudf::test::BaseFixture {};
+
+TEST_F(CastTableTest, MixedTypes)
+{
+  using namespace numeric;
+  auto const ints = cudf::test::fixed_width_column_wrapper<int32_t>{{1, -2, 3}, {1, 0, 1}};
+  auto const timestamps =
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_s, cudf::timestamp_s::rep>(
+      test_timestamps_s.begin(), test_timestamps_s.end());
+  auto const decimals =
+    cudf::test::fixed_point_column_wrapper<int32_t>{{125, 250, -375}, scale_type{-2}};
+  auto const strings = cudf::test::strings_column_wrapper{"a", "bc", "def"};
+  auto const input   = cudf::table_view{{ints, timestamps, decimals, strings}};
+
+  auto const types =
+    std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::FLOAT64},
+                                 cudf::data_type{cudf::type_id::TIMESTAMP_MILLISECONDS},
+                                 make_fixed_point_data_type<decimal64>(-1),
+                                 cudf::data_type{cudf::type_id::STRING}};
+  auto const result = cudf::cast(input, types);
+
+  auto expected_ms = std::vector<int64_t>{};
+  for (auto const seconds : test_timestamps_s) {
+    expected_ms.push_back(seconds * 1000);
+  }
+
+  ASSERT_EQ(result->num_columns(), 4);
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<double>({1, 0, 3}, {1, 0, 1}), result->get_column(0));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<cudf::timestamp_ms, cudf::timestamp_ms::rep>(
+      expected_ms.begin(), expected_ms.end()),
+    result->get_column(1));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_point_column_wrapper<int64_t>({12, 25, -37}, scale_type{-1}),
+    result->get_column(2));
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(strings, result->get_column(3));
+}
+
+TEST_F(CastTableTest, Errors)
+{
+  auto const ints    = cudf::test::fixed_width_column_wrapper<int32_t>{1, 2, 3};
+  auto const strings = cudf::test::strings_column_wrapper{"a", "bc", "def"};
+
+  auto const one_type = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::INT64}};
+  EXPECT_THROW(cudf::cast(cudf::table_view{{ints, strings}}, one_type), std::invalid_argument);
+
+  auto const to_strings = std::vector<cudf::data_type>{cudf::data_type{cudf::type_id::STRING}};
+  EXPECT_THROW(cudf::cast(cudf::table_view{{ints}}, to_strings), cudf::logic_error);
+}
+
+TEST_F(CastTableTest, SmallStringAndListColumns)
+{
+  // Many small string and list columns, each of which is processed on its own stream
+  auto const validity =
+    cudf::detail::make_counting_transform_iterator(0, [](auto i) { return i % 3 != 1; });
+  std::vector<std::unique_ptr<cudf::column>> columns;
+  for (int32_t i = 0; i < 32; ++i) {
+    auto const s = std::to_string(i);
+    columns.push_back(cudf::test::strings_column_wrapper({s, "", s + s, "x" + s, s + "yz"},
+                                                         validity + i)
+                        .release());
+    columns.push_back(cudf::test::lists_column_wrapper<int32_t>(
+                        {{i, i + 1}, {}, {i * 2}, {i, i, i}, {i + 3}}, validity + i + 1)
+                        .release());
+  }
+  // and an integer column that is cast to a wider type
+  auto const ints = cudf::test::fixed_width_column_wrapper<int32_t>({1, -2, 3, 4, -5}, validity);
+  std::vector<cudf::data_type> types;
+  for (auto const& col : columns) {
+    types.push_back(col->type());
+  }
+  columns.push_back(std::make_unique<cudf::column>(ints));
+  types.push_back(cudf::data_type{cudf::type_id::INT64});
+  auto const input = cudf::table(std::move(columns));
+
+  auto const result = cudf::cast(input.view(), types);
+  ASSERT_EQ(result->num_columns(), input.num_columns());
+  for (auto i = 0; i < input.num_columns() - 1; ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(input.view().column(i), result->view().column(i));
+  }
+  CUDF_TEST_EXPECT_COLUMNS_EQUAL(
+    cudf::test::fixed_width_column_wrapper<int64_t>({1, -2, 3, 4, -5}, validity),
+    result->view().column(input.num_columns() - 1));
+}
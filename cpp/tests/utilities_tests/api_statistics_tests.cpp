@@ -0,0 +1,100 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <cudf/detail/utilities/api_statistics.hpp>
+#include <cudf/filling.hpp>
+#include <cudf/scalar/scalar.hpp>
+#include <cudf/utilities/api_statistics.hpp>
+
+#include <rmm/mr/device/per_device_resource.hpp>
+
+struct ApiStatisticsTest : public cudf::test::BaseFixture {
+  ApiStatisticsTest() : adaptor{rmm::mr::get_current_device_resource()}
+  {
+    previous = rmm::mr::set_current_device_resource(&adaptor);
+  }
+
+  ~ApiStatisticsTest() override
+  {
+    rmm::mr::set_current_device_resource(previous);
+    cudf::disable_api_statistics();
+    cudf::reset_api_statistics();
+  }
+
+  cudf::api_statistics_resource_adaptor adaptor;
+  rmm::mr::device_memory_resource* previous{};
+};
+
+TEST_F(ApiStatisticsTest, Disabled)
+{
+  cudf::numeric_scalar<int32_t> init(0, true, cudf::test::get_default_stream());
+  cudf::sequence(1000, init, cudf::test::get_default_stream());
+  EXPECT_TRUE(cudf::get_api_statistics().empty());
+}
+
+TEST_F(ApiStatisticsTest, Sequence)
+{
+  cudf::numeric_scalar<int32_t> init(0, true, cudf::test::get_default_stream());
+  cudf::enable_api_statistics();
+  auto const first  = cudf::sequence(1000, init, cudf::test::get_default_stream());
+  auto const second = cudf::sequence(2000, init, cudf::test::get_default_stream());
+  cudf::disable_api_statistics();
+  cudf::sequence(4000, init, cudf::test::get_default_stream());
+
+  auto const statistics = cudf::get_api_statistics();
+  ASSERT_EQ(statistics.size(), 1);
+  auto const& stats = statistics.at("sequence");
+  EXPECT_EQ(stats.calls, 2);
+  EXPECT_GE(stats.output_bytes, 3000 * sizeof(int32_t));
+  EXPECT_EQ(stats.allocated_bytes, stats.output_bytes + stats.temporary_bytes);
+  EXPECT_GE(stats.peak_memory_bytes, 2000 * sizeof(int32_t));
+  EXPECT_LE(stats.peak_memory_bytes, stats.allocated_bytes);
+  EXPECT_GT(stats.host_time.count(), 0);
+
+  cudf::reset_api_statistics();
+  EXPECT_TRUE(cudf::get_api_statistics().empty());
+}
+
+TEST_F(ApiStatisticsTest, ToggledWithinCall)
+{
+  cudf::numeric_scalar<int32_t> init(0, true, cudf::test::get_default_stream());
+
+  // enabling within a call records from the next call
+  {
+    cudf::detail::api_statistics_scope const outer{"outer"};
+    cudf::enable_api_statistics();
+    cudf::sequence(1000, init, cudf::test::get_default_stream());
+  }
+  EXPECT_TRUE(cudf::get_api_statistics().empty());
+  cudf::sequence(1000, init, cudf::test::get_default_stream());
+  EXPECT_EQ(cudf::get_api_statistics().at("sequence").calls, 1);
+
+  // disabling within a call still records that call, and not the next one
+  cudf::reset_api_statistics();
+  {
+    cudf::detail::api_statistics_scope const outer{"outer"};
+    cudf::disable_api_statistics();
+    cudf::sequence(1000, init, cudf::test::get_default_stream());
+  }
+  cudf::sequence(1000, init, cudf::test::get_default_stream());
+  auto const statistics = cudf::get_api_statistics();
+  ASSERT_EQ(statistics.size(), 1);
+  EXPECT_EQ(statistics.at("outer").calls, 1);
+  EXPECT_GE(statistics.at("outer").allocated_bytes, 1000 * sizeof(int32_t));
+}
@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/file_utilities.hpp>
+
+#include <cudf/detail/utilities/autotune.hpp>
+#include <cudf/utilities/default_stream.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <thread>
+#include <vector>
+
+class AutotuneTest : public cudf::test::BaseFixture {
+ protected:
+  AutotuneTest() : cache_dir{"autotune_test"}
+  {
+    setenv("LIBCUDF_KERNEL_CACHE_PATH", cache_dir.path().c_str(), 1);
+    setenv("LIBCUDF_AUTOTUNE", "1", 1);
+    cudf::detail::clear_autotuned_choices();
+  }
+
+  ~AutotuneTest() override
+  {
+    unsetenv("LIBCUDF_AUTOTUNE");
+    unsetenv("LIBCUDF_KERNEL_CACHE_PATH");
+    cudf::detail::clear_autotuned_choices();
+  }
+
+  // The tuning file is in a subdirectory specific to the version and the device
+  [[nodiscard]] std::filesystem::path tuning_file() const
+  {
+    for (auto const& entry : std::filesystem::recursive_directory_iterator(cache_dir.path())) {
+      if (entry.path().filename() == "autotune.txt") { return entry.path(); }
+    }
+    return {};
+  }
+
+  // Candidate 0 is slower, as the stream idles between the timing events while the host sleeps
+  std::size_t tune(std::string const& key, std::size_t default_choice)
+  {
+    auto const run_candidate = [&](std::size_t candidate) {
+      runs.push_back(candidate);
+      if (candidate == 0) { std::this_thread::sleep_for(std::chrono::milliseconds(5)); }
+    };
+    return cudf::detail::autotuned_choice(
+      key, 2, default_choice, run_candidate, cudf::get_default_stream());
+  }
+
+  cudf::test::temp_directory cache_dir;
+  std::vector<std::size_t> runs;
+};
+
+TEST_F(AutotuneTest, Bucket)
+{
+  EXPECT_EQ(cudf::detail::autotune_bucket(-1), 0);
+  EXPECT_EQ(cudf::detail::autotune_bucket(0), 0);
+  EXPECT_EQ(cudf::detail::autotune_bucket(1), 1);
+  EXPECT_EQ(cudf::detail::autotune_bucket(2), 2);
+  EXPECT_EQ(cudf::detail::autotune_bucket(3), 2);
+  EXPECT_EQ(cudf::detail::autotune_bucket(4), 3);
+  EXPECT_EQ(cudf::detail::autotune_bucket(1023), 10);
+  EXPECT_EQ(cudf::detail::autotune_bucket(1024), 11);
+  EXPECT_EQ(cudf::detail::autotune_bucket(std::numeric_limits<int64_t>::max()), 63);
+}
+
+TEST_F(AutotuneTest, Disabled)
+{
+  unsetenv("LIBCUDF_AUTOTUNE");
+  EXPECT_FALSE(cudf::detail::is_autotuning_enabled());
+  EXPECT_EQ(tune("disabled", 0), 0u);
+  EXPECT_EQ(tune("disabled", 1), 1u);
+  EXPECT_TRUE(runs.empty());
+  EXPECT_TRUE(tuning_file().empty());
+}
+
+TEST_F(AutotuneTest, SingleCandidate)
+{
+  auto const run_candidate = [](std::size_t) { ADD_FAILURE() << "a single candidate is not run"; };
+  EXPECT_EQ(
+    cudf::detail::autotuned_choice("single", 1, 0, run_candidate, cudf::get_default_stream()), 0u);
+}
+
+TEST_F(AutotuneTest, TuneOnce)
+{
+  EXPECT_TRUE(cudf::detail::is_autotuning_enabled());
+  EXPECT_EQ(tune("tune_once", 0), 1u);
+  // one warmup and the timed runs of each candidate
+  auto const num_runs = [&](std::size_t candidate) {
+    return static_cast<std::size_t>(std::count(runs.begin(), runs.end(), candidate));
+  };
+  EXPECT_GT(num_runs(0), 1u);
+  EXPECT_EQ(num_runs(0), num_runs(1));
+  EXPECT_EQ(num_runs(0) + num_runs(1), runs.size());
+
+  runs.clear();
+  EXPECT_EQ(tune("tune_once", 0), 1u);
+  EXPECT_TRUE(runs.empty());
+}
+
+TEST_F(AutotuneTest, PersistAndReload)
+{
+  EXPECT_EQ(tune("persisted", 0), 1u);
+  auto const path = tuning_file();
+  ASSERT_FALSE(path.empty());
+  std::ifstream file(path);
+  std::string key;
+  std::size_t choice;
+  ASSERT_TRUE(static_cast<bool>(file >> key >> choice));
+  EXPECT_EQ(key, "persisted");
+  EXPECT_EQ(choice, 1u);
+
+  // the choice is reloaded from the file rather than benchmarked again
+  cudf::detail::clear_autotuned_choices();
+  runs.clear();
+  EXPECT_EQ(tune("persisted", 0), 1u);
+  EXPECT_TRUE(runs.empty());
+}
+
+TEST_F(AutotuneTest, OutOfRangeStoredChoice)
+{
+  // create the tuning file with a first decision, then store a choice that is not a candidate
+  tune("first", 0);
+  auto const path = tuning_file();
+  ASSERT_FALSE(path.empty());
+  {
+    std::ofstream file(path, std::ios::app);
+    file << "out_of_range 5\n";
+  }
+  cudf::detail::clear_autotuned_choices();
+  runs.clear();
+
+  EXPECT_EQ(tune("out_of_range", 0), 0u);
+  EXPECT_EQ(tune("out_of_range", 1), 1u);
+  EXPECT_TRUE(runs.empty());
+}
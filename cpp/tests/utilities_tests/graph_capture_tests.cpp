@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/column_utilities.hpp>
+#include <cudf_test/column_wrapper.hpp>
+#include <cudf_test/cudf_gtest.hpp>
+
+#include <cudf/binaryop.hpp>
+#include <cudf/column/column.hpp>
+#include <cudf/column/column_factories.hpp>
+#include <cudf/copying.hpp>
+#include <cudf/stream_compaction.hpp>
+#include <cudf/table/table.hpp>
+#include <cudf/table/table_view.hpp>
+#include <cudf/unary.hpp>
+#include <cudf/utilities/default_stream.hpp>
+#include <cudf/utilities/error.hpp>
+
+#include <rmm/cuda_stream.hpp>
+#include <rmm/device_scalar.hpp>
+#include <rmm/device_uvector.hpp>
+#include <rmm/mr/device/cuda_memory_resource.hpp>
+
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+namespace {
+
+struct graph_exec_deleter {
+  void operator()(cudaGraphExec_t graph_exec) const { cudaGraphExecDestroy(graph_exec); }
+};
+
+using graph_exec_ptr = std::unique_ptr<std::remove_pointer_t<cudaGraphExec_t>, graph_exec_deleter>;
+
+// Captures the work that `enqueue` submits to `stream` into an executable graph. The capture is
+// ended even if `enqueue` throws so that the stream can still be used.
+template <typename Enqueue>
+graph_exec_ptr capture_graph(rmm::cuda_stream_view stream, Enqueue&& enqueue)
+{
+  cudaGraph_t graph = nullptr;
+  CUDF_CUDA_TRY(cudaStreamBeginCapture(stream.value(), cudaStreamCaptureModeRelaxed));
+  try {
+    enqueue();
+  } catch (...) {
+    if (cudaStreamEndCapture(stream.value(), &graph) == cudaSuccess && graph != nullptr) {
+      cudaGraphDestroy(graph);
+    }
+    throw;
+  }
+  CUDF_CUDA_TRY(cudaStreamEndCapture(stream.value(), &graph));
+
+  // The executable graph does not depend on the graph it was instantiated from
+  cudaGraphExec_t graph_exec = nullptr;
+  auto const status          = cudaGraphInstantiateWithFlags(&graph_exec, graph, 0);
+  cudaGraphDestroy(graph);
+  CUDF_CUDA_TRY(status);
+  return graph_exec_ptr{graph_exec};
+}
+
+// Overwrites the contents of a device column with those of another column of the same size
+void copy_into(cudf::mutable_column_view target,
+               cudf::column_view const& source,
+               rmm::cuda_stream_view stream)
+{
+  CUDF_CUDA_TRY(cudaMemcpyAsync(target.data<int32_t>(),
+                                source.data<int32_t>(),
+                                target.size() * sizeof(int32_t),
+                                cudaMemcpyDefault,
+                                stream.value()));
+}
+
+// Runs the element-wise APIs that are documented to be graph-capture safe
+std::vector<std::unique_ptr<cudf::column>> run_pipeline(cudf::column_view const& prices,
+                                                        cudf::column_view const& quantities,
+                                                        rmm::cuda_stream_view stream,
+                                                        rmm::device_async_resource_ref mr)
+{
+  // The intermediate columns are returned too since the graph writes to them on every launch
+  std::vector<std::unique_ptr<cudf::column>> results;
+  results.push_back(cudf::binary_operation(prices,
+                                           quantities,
+                                           cudf::binary_operator::MUL,
+                                           cudf::data_type{cudf::type_id::INT64},
+                                           stream,
+                                           mr));
+  results.push_back(
+    cudf::cast(results.back()->view(), cudf::data_type{cudf::type_id::FLOAT64}, stream, mr));
+  results.push_back(
+    cudf::unary_operation(results.back()->view(), cudf::unary_operator::SQRT, stream, mr));
+  results.push_back(cudf::binary_operation(prices,
+                                           quantities,
+                                           cudf::binary_operator::GREATER,
+                                           cudf::data_type{cudf::type_id::BOOL8},
+                                           stream,
+                                           mr));
+  return results;
+}
+
+}  // namespace
+
+struct GraphCaptureTest : public cudf::test::BaseFixture {};
+
+TEST_F(GraphCaptureTest, ElementwisePipeline)
+{
+  rmm::cuda_stream stream;
+  rmm::mr::cuda_memory_resource mr;
+
+  auto prices     = cudf::column(cudf::test::fixed_width_column_wrapper<int32_t>{4, 9, 1, 16});
+  auto quantities = cudf::column(cudf::test::fixed_width_column_wrapper<int32_t>{1, 4, 9, 1});
+  cudf::get_default_stream().synchronize();
+
+  std::vector<std::unique_ptr<cudf::column>> captured;
+  auto const graph_exec =
+    capture_graph(stream, [&] { captured = run_pipeline(prices, quantities, stream, mr); });
+
+  // Nothing was executed during the capture, the outputs are written by each launch
+  CUDF_CUDA_TRY(cudaGraphLaunch(graph_exec.get(), stream.value()));
+  stream.synchronize();
+  auto expected = run_pipeline(prices, quantities, stream, mr);
+  stream.synchronize();
+  for (std::size_t i = 0; i < captured.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*captured[i], *expected[i]);
+  }
+
+  // Replaying the graph on new data in the same input buffers
+  auto const new_prices     = cudf::test::fixed_width_column_wrapper<int32_t>{25, 2, 3, 100};
+  auto const new_quantities = cudf::test::fixed_width_column_wrapper<int32_t>{4, 8, 3, 1};
+  cudf::get_default_stream().synchronize();
+  copy_into(prices.mutable_view(), new_prices, stream);
+  copy_into(quantities.mutable_view(), new_quantities, stream);
+  CUDF_CUDA_TRY(cudaGraphLaunch(graph_exec.get(), stream.value()));
+  stream.synchronize();
+  expected = run_pipeline(new_prices, new_quantities, stream, mr);
+  stream.synchronize();
+  for (std::size_t i = 0; i < captured.size(); ++i) {
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(*captured[i], *expected[i]);
+  }
+}
+
+TEST_F(GraphCaptureTest, FixedCapacityFilter)
+{
+  rmm::cuda_stream stream;
+  rmm::mr::cuda_memory_resource mr;
+
+  auto prices     = cudf::column(cudf::test::fixed_width_column_wrapper<int32_t>{4, 9, 1, 16, 7});
+  auto quantities = cudf::column(cudf::test::fixed_width_column_wrapper<int32_t>{1, 4, 9, 1, 7});
+  cudf::get_default_stream().synchronize();
+
+  // The filter writes into buffers sized for all the rows, allocated before capturing
+  auto const type = prices.type();
+  auto filtered   = cudf::make_fixed_width_column(
+    type, prices.size(), cudf::mask_state::UNALLOCATED, stream, mr);
+  rmm::device_scalar<cudf::size_type> filtered_size(stream, mr);
+  rmm::device_uvector<std::byte> temp_storage(
+    cudf::apply_boolean_mask_temp_storage_size(type, prices.size()), stream, mr);
+
+  std::unique_ptr<cudf::column> mask;
+  auto const graph_exec = capture_graph(stream, [&] {
+    mask = cudf::binary_operation(prices,
+                                  quantities,
+                                  cudf::binary_operator::GREATER,
+                                  cudf::data_type{cudf::type_id::BOOL8},
+                                  stream,
+                                  mr);
+    cudf::apply_boolean_mask(
+      prices, *mask, filtered->mutable_view(), filtered_size.data(), temp_storage, stream);
+  });
+
+  auto const expect_filtered = [&](cudf::column_view const& new_prices,
+                                   cudf::column_view const& new_quantities) {
+    CUDF_CUDA_TRY(cudaGraphLaunch(graph_exec.get(), stream.value()));
+    auto const size = filtered_size.value(stream);
+
+    auto const expected_mask = cudf::binary_operation(new_prices,
+                                                      new_quantities,
+                                                      cudf::binary_operator::GREATER,
+                                                      cudf::data_type{cudf::type_id::BOOL8});
+
+    auto const expected = cudf::apply_boolean_mask(cudf::table_view{{new_prices}}, *expected_mask);
+    CUDF_TEST_EXPECT_COLUMNS_EQUAL(expected->get_column(0),
+                                   cudf::slice(filtered->view(), {0, size}).front());
+  };
+  expect_filtered(prices, quantities);
+
+  // The number of rows kept changes from one launch to the next
+  auto const new_prices     = cudf::test::fixed_width_column_wrapper<int32_t>{25, 2, 3, 100, 1};
+  auto const new_quantities = cudf::test::fixed_width_column_wrapper<int32_t>{4, 8, 3, 1, 0};
+  cudf::get_default_stream().synchronize();
+  copy_into(prices.mutable_view(), new_prices, stream);
+  copy_into(quantities.mutable_view(), new_quantities, stream);
+  expect_filtered(new_prices, new_quantities);
+}
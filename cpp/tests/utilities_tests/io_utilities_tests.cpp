@@ -21,12 +21,16 @@
 #include <cudf/io/memory_resource.hpp>
 #include <cudf/io/parquet.hpp>
 
+#include <rmm/aligned.hpp>
 #include <rmm/mr/device/pool_memory_resource.hpp>
 #include <rmm/mr/pinned_host_memory_resource.hpp>
 #include <rmm/resource_ref.hpp>
 
 #include <src/io/utilities/base64_utilities.hpp>
 
+#include <thread>
+#include <vector>
+
 using cudf::io::detail::base64_decode;
 using cudf::io::detail::base64_encode;
 
@@ -69,6 +73,62 @@ TEST(IoUtilitiesTest, HostMemoryGetAndSet)
   cudf::io::set_host_memory_resource(last_mr);
 }
 
+TEST(IoUtilitiesTest, PinnedStagingArenas)
+{
+  auto const last_mr = cudf::io::get_host_memory_resource();
+
+  cudf::io::pinned_staging_options opts;
+  opts.num_arenas                 = 2;
+  opts.arena_size                 = 1024 * 1024;
+  opts.large_allocation_threshold = 256 * 1024;
+  opts.large_pool_size            = 16 * 1024 * 1024;
+  ASSERT_TRUE(cudf::io::config_pinned_staging_arenas(opts));
+  EXPECT_FALSE(cudf::io::config_pinned_staging_arenas(opts));
+
+  auto mr                = cudf::io::get_host_memory_resource();
+  auto const stream      = cudf::get_default_stream();
+  auto const alignment   = rmm::RMM_DEFAULT_HOST_ALIGNMENT;
+  auto const large_bytes = std::size_t{1024 * 1024};
+
+  cudf::io::reset_pinned_staging_statistics();
+  auto small = mr.allocate_async(1024, alignment, stream);
+  mr.deallocate_async(small, 1024, alignment, stream);
+
+  // the second large allocation reuses the block cached by the first one
+  for (int i = 0; i < 2; ++i) {
+    auto large = mr.allocate_async(large_bytes, alignment, stream);
+    mr.deallocate_async(large, large_bytes, alignment, stream);
+  }
+
+  // overflowing the arena falls back to the upstream resource
+  std::vector<void*> buffers;
+  for (int i = 0; i < 6; ++i) {
+    buffers.push_back(mr.allocate_async(200 * 1024, alignment, stream));
+  }
+  for (auto buffer : buffers) {
+    mr.deallocate_async(buffer, 200 * 1024, alignment, stream);
+  }
+  stream.synchronize();
+
+  auto const stats = cudf::io::get_pinned_staging_statistics();
+  EXPECT_EQ(stats.num_allocations, 9);
+  EXPECT_EQ(stats.arena_bytes, 1024 + 5 * 200 * 1024);
+  EXPECT_EQ(stats.large_pool_bytes, large_bytes);
+  EXPECT_EQ(stats.upstream_bytes, large_bytes + 200 * 1024);
+
+  // statistics are kept per thread
+  std::thread other([&] {
+    EXPECT_EQ(cudf::io::get_pinned_staging_statistics().num_allocations, 0);
+    auto ptr = mr.allocate_async(64, alignment, stream);
+    mr.deallocate_async(ptr, 64, alignment, stream);
+    EXPECT_EQ(cudf::io::get_pinned_staging_statistics().arena_bytes, 64);
+  });
+  other.join();
+  EXPECT_EQ(cudf::io::get_pinned_staging_statistics().num_allocations, 9);
+
+  cudf::io::set_host_memory_resource(last_mr);
+}
+
 TEST(IoUtilitiesTest, Base64EncodeAndDecode)
 {
   // a vector of lorem ipsum strings
@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2024, NVIDIA CORPORATION.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cudf_test/base_fixture.hpp>
+#include <cudf_test/default_stream.hpp>
+
+#include <cudf/utilities/memory_resource.hpp>
+
+#include <rmm/device_buffer.hpp>
+#include <rmm/error.hpp>
+#include <rmm/mr/device/device_memory_resource.hpp>
+#include <rmm/mr/device/per_device_resource.hpp>
+
+namespace {
+
+/**
+ * @brief Resource that reports out of memory until it is "spilled".
+ */
+class spillable_resource final : public rmm::mr::device_memory_resource {
+ public:
+  bool full{true};
+  int allocations{0};
+
+ private:
+  void* do_allocate(std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    if (full) { throw rmm::out_of_memory("spillable_resource is full"); }
+    ++allocations;
+    return rmm::mr::get_current_device_resource()->allocate(bytes, stream);
+  }
+
+  void do_deallocate(void* ptr, std::size_t bytes, rmm::cuda_stream_view stream) override
+  {
+    rmm::mr::get_current_device_resource()->deallocate(ptr, bytes, stream);
+  }
+
+  [[nodiscard]] bool do_is_equal(device_memory_resource const& other) const noexcept override
+  {
+    return this == &other;
+  }
+};
+
+}  // namespace
+
+struct TemporaryMemoryResourceTest : public cudf::test::BaseFixture {
+  ~TemporaryMemoryResourceTest() override
+  {
+    cudf::set_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH, std::nullopt);
+    cudf::set_temporary_allocation_spill_callback(std::nullopt);
+  }
+};
+
+TEST_F(TemporaryMemoryResourceTest, SpillCallbackRetries)
+{
+  spillable_resource upstream;
+  EXPECT_FALSE(
+    cudf::set_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH, &upstream)
+      .has_value());
+
+  int spills = 0;
+  cudf::set_temporary_allocation_spill_callback(
+    [&](std::size_t bytes, cudf::temporary_allocation kind) {
+      EXPECT_EQ(bytes, 1024);
+      EXPECT_EQ(kind, cudf::temporary_allocation::IO_SCRATCH);
+      upstream.full = false;
+      return ++spills == 1;
+    });
+
+  auto const mr = cudf::get_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH);
+  {
+    rmm::device_buffer buffer(1024, cudf::test::get_default_stream(), mr);
+    EXPECT_EQ(spills, 1);
+    EXPECT_EQ(upstream.allocations, 1);
+  }
+
+  // the callback declines to free anything, so the allocation fails
+  upstream.full = true;
+  EXPECT_THROW(rmm::device_buffer(1024, cudf::test::get_default_stream(), mr), rmm::out_of_memory);
+  EXPECT_EQ(spills, 2);
+}
+
+TEST_F(TemporaryMemoryResourceTest, NoCallbackFailsImmediately)
+{
+  spillable_resource upstream;
+  cudf::set_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH, &upstream);
+
+  auto const mr = cudf::get_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH);
+  EXPECT_THROW(rmm::device_buffer(16, cudf::test::get_default_stream(), mr), rmm::out_of_memory);
+
+  // other categories keep using the current device resource
+  auto const join_mr =
+    cudf::get_temporary_memory_resource(cudf::temporary_allocation::JOIN_HASH_TABLE);
+  EXPECT_NO_THROW(rmm::device_buffer(16, cudf::test::get_default_stream(), join_mr));
+
+  auto const previous =
+    cudf::set_temporary_memory_resource(cudf::temporary_allocation::IO_SCRATCH, std::nullopt);
+  ASSERT_TRUE(previous.has_value());
+  EXPECT_EQ(*previous, rmm::device_async_resource_ref{&upstream});
+  EXPECT_NO_THROW(rmm::device_buffer(16, cudf::test::get_default_stream(), mr));
+}